@@ -0,0 +1,33 @@
+'use strict';
+const common = require('../common.js');
+
+// Base64 encoding and decoding across input sizes. `n` is the total number of
+// megabytes of binary data processed per run.
+const bench = common.createBenchmark(main, {
+  op: ['encode', 'decode', 'decode-url'],
+  size: [64, 1024, 64 * 1024, 1024 * 1024, 64 * 1024 * 1024],
+  n: [256]
+});
+
+function main({ op, size, n }) {
+  const iterations = Math.max(1, Math.floor(n * 1024 * 1024 / size));
+  const buf = Buffer.allocUnsafe(size);
+  for (let i = 0; i < size; i++)
+    buf[i] = (i * 151) & 0xff;
+
+  if (op === 'encode') {
+    bench.start();
+    for (let i = 0; i < iterations; i++)
+      buf.toString('base64');
+    bench.end(iterations);
+    return;
+  }
+
+  let str = buf.toString('base64');
+  if (op === 'decode-url')
+    str = str.replace(/\+/g, '-').replace(/\//g, '_').replace(/=+$/, '');
+  bench.start();
+  for (let i = 0; i < iterations; i++)
+    Buffer.from(str, 'base64');
+  bench.end(iterations);
+}
@@ -0,0 +1,58 @@
+'use strict';
+const common = require('../common.js');
+const { TextDecoder } = require('util');
+
+// Decoding UTF-8 buffers to strings, and writing strings back as UTF-8, for
+// pure ASCII, Latin-1 and mixed-script text. `n` is the total number of
+// megabytes of UTF-8 data processed per run.
+const bench = common.createBenchmark(main, {
+  op: ['toString', 'TextDecoder', 'write'],
+  content: ['ascii', 'latin1', 'mixed'],
+  size: [64, 1024, 64 * 1024, 1024 * 1024, 16 * 1024 * 1024],
+  n: [256]
+});
+
+const chunks = {
+  ascii: 'The quick brown fox jumps over the lazy dog. ',
+  latin1: 'Größenmaßstäbe für Käse, Crème brûlée à la façon. ',
+  mixed: 'Hello, 世界! Привет, мир! Γειά σου κόσμε! 🌍 '
+};
+
+function main({ op, content, size, n }) {
+  const chunk = Buffer.from(chunks[content]);
+  const buf = Buffer.alloc(size, chunk);
+  // Do not cut a character in two at the end.
+  let end = size;
+  while (end > 0 && (buf[end - 1] & 0xc0) === 0x80)
+    end--;
+  if (end > 0 && buf[end - 1] >= 0xc0)
+    end--;
+  const input = buf.slice(0, end);
+  const iterations = Math.max(1, Math.floor(n * 1024 * 1024 / size));
+
+  switch (op) {
+    case 'toString':
+      bench.start();
+      for (let i = 0; i < iterations; i++)
+        input.toString('utf8');
+      bench.end(iterations);
+      break;
+    case 'TextDecoder': {
+      const decoder = new TextDecoder();
+      bench.start();
+      for (let i = 0; i < iterations; i++)
+        decoder.decode(input);
+      bench.end(iterations);
+      break;
+    }
+    case 'write': {
+      const str = input.toString('utf8');
+      const target = Buffer.allocUnsafe(end);
+      bench.start();
+      for (let i = 0; i < iterations; i++)
+        target.write(str);
+      bench.end(iterations);
+      break;
+    }
+  }
+}
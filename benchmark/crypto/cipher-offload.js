@@ -0,0 +1,64 @@
+// Encrypt a file as a stream, with the cipher running on the event loop or,
+// with the `offload` option, on the threadpool. `metric=throughput` reports
+// MB/s, `metric=delay` reports the inverse of the 99th percentile event loop
+// delay during encryption so that, like every other benchmark, higher is
+// better.
+'use strict';
+const common = require('../common.js');
+const crypto = require('crypto');
+const fs = require('fs');
+const path = require('path');
+const { monitorEventLoopDelay } = require('perf_hooks');
+const { pipeline, Writable } = require('stream');
+
+const tmpdir = require('../../test/common/tmpdir');
+
+const bench = common.createBenchmark(main, {
+  offload: [0, 1],
+  metric: ['throughput', 'delay'],
+  len: [64 * 1024],
+  n: [1024]
+});
+
+function main({ offload, metric, len, n }) {
+  tmpdir.refresh();
+  const filename = path.resolve(tmpdir.path,
+                                `.removeme-benchmark-garbage-${process.pid}`);
+  const fd = fs.openSync(filename, 'w');
+  const chunk = Buffer.alloc(len, 'x');
+  for (let i = 0; i < n; i++)
+    fs.writeSync(fd, chunk);
+  fs.closeSync(fd);
+
+  const cipher = crypto.createCipheriv('aes-256-gcm',
+                                       crypto.randomBytes(32),
+                                       crypto.randomBytes(12),
+                                       { offload: offload === 1 });
+  const sink = new Writable({
+    write(chunk, encoding, callback) {
+      callback();
+    }
+  });
+  const histogram = monitorEventLoopDelay({ resolution: 1 });
+
+  histogram.enable();
+  const start = process.hrtime();
+  bench.start();
+  pipeline(
+    fs.createReadStream(filename, { highWaterMark: len }),
+    cipher,
+    sink,
+    (err) => {
+      if (err)
+        throw err;
+      histogram.disable();
+      if (metric === 'throughput') {
+        bench.end(n * len / (1024 * 1024));
+      } else {
+        const p99 = histogram.percentile(99);
+        bench.report(1e9 / p99, process.hrtime(start));
+      }
+      tmpdir.refresh();
+    }
+  );
+}
@@ -0,0 +1,45 @@
+// Create a Hash, Hmac or Cipher object per small input, which is dominated
+// by setting up the object rather than by processing the input.
+// `kind=hmac-copy` copies a keyed Hmac object instead of creating a new one.
+'use strict';
+const common = require('../common.js');
+const crypto = require('crypto');
+
+const bench = common.createBenchmark(main, {
+  kind: ['hash', 'hmac', 'hmac-copy', 'cipher'],
+  len: [64],
+  n: [1e5]
+});
+
+function main({ kind, len, n }) {
+  const data = Buffer.alloc(len, 'x');
+  const key = crypto.randomBytes(32);
+  const iv = crypto.randomBytes(12);
+  const keyed = crypto.createHmac('sha256', key);
+
+  bench.start();
+  switch (kind) {
+    case 'hash':
+      for (let i = 0; i < n; i++)
+        crypto.createHash('sha256').update(data).digest();
+      break;
+    case 'hmac':
+      for (let i = 0; i < n; i++)
+        crypto.createHmac('sha256', key).update(data).digest();
+      break;
+    case 'hmac-copy':
+      for (let i = 0; i < n; i++)
+        keyed.copy().update(data).digest();
+      break;
+    case 'cipher':
+      for (let i = 0; i < n; i++) {
+        const cipher = crypto.createCipheriv('aes-256-gcm', key, iv);
+        cipher.update(data);
+        cipher.final();
+      }
+      break;
+    default:
+      throw new Error(`Unsupported kind ${kind}`);
+  }
+  bench.end(n);
+}
@@ -0,0 +1,45 @@
+// Hash many small buffers, one by one with createHash() or all at once with
+// hashBatch(), on the main thread or on the threadpool.
+'use strict';
+const common = require('../common.js');
+const crypto = require('crypto');
+
+const bench = common.createBenchmark(main, {
+  method: ['createHash', 'hashBatch', 'hashBatchAsync'],
+  algo: ['sha256', 'md5'],
+  len: [64, 1024],
+  out: ['buffer', 'hex'],
+  n: [1e5]
+});
+
+function main({ method, algo, len, out, n }) {
+  const buffers = [];
+  for (let i = 0; i < n; i++)
+    buffers.push(Buffer.alloc(len, i));
+
+  switch (method) {
+    case 'createHash': {
+      bench.start();
+      const digests = new Array(n);
+      for (let i = 0; i < n; i++)
+        digests[i] = crypto.createHash(algo).update(buffers[i]).digest(out);
+      bench.end(n);
+      break;
+    }
+    case 'hashBatch':
+      bench.start();
+      crypto.hashBatch(algo, buffers, { outputEncoding: out });
+      bench.end(n);
+      break;
+    case 'hashBatchAsync':
+      bench.start();
+      crypto.hashBatch(algo, buffers, { outputEncoding: out }, (err) => {
+        if (err)
+          throw err;
+        bench.end(n);
+      });
+      break;
+    default:
+      throw new Error(`Unknown method: ${method}`);
+  }
+}
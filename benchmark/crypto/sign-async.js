@@ -0,0 +1,83 @@
+// Sign many small messages on the event loop, one at a time on the
+// threadpool, or in batches on the threadpool. `metric=throughput` reports
+// signatures per second, `metric=delay` reports the inverse of the 99th
+// percentile event loop delay while signing so that, like every other
+// benchmark, higher is better.
+'use strict';
+const common = require('../common.js');
+const crypto = require('crypto');
+const { monitorEventLoopDelay } = require('perf_hooks');
+
+const bench = common.createBenchmark(main, {
+  mode: ['sync', 'async', 'batch'],
+  key: ['rsa', 'ec'],
+  metric: ['throughput', 'delay'],
+  n: [1e4]
+});
+
+// The number of signatures that are in flight at a time with `mode=async`.
+const kConcurrency = 16;
+
+function main({ mode, key, metric, n }) {
+  const { privateKey } = key === 'rsa' ?
+    crypto.generateKeyPairSync('rsa', { modulusLength: 2048 }) :
+    crypto.generateKeyPairSync('ec', { namedCurve: 'P-256' });
+  const messages = [];
+  for (let i = 0; i < n; i++)
+    messages.push(Buffer.from(`{"sub":"user${i}","iat":1516239022}`));
+
+  const histogram = monitorEventLoopDelay({ resolution: 1 });
+  let start;
+
+  function done() {
+    const elapsed = process.hrtime(start);
+    // Let the histogram record the delay of the last turn of the event loop.
+    setTimeout(() => {
+      histogram.disable();
+      if (metric === 'throughput')
+        bench.report(n / (elapsed[0] + elapsed[1] / 1e9), elapsed);
+      else
+        bench.report(1e9 / histogram.percentile(99), elapsed);
+    }, 10);
+  }
+
+  histogram.enable();
+  start = process.hrtime();
+  switch (mode) {
+    case 'sync':
+      for (let i = 0; i < n; i++)
+        crypto.sign('sha256', messages[i], privateKey);
+      done();
+      break;
+    case 'async': {
+      let next = 0;
+      let pending = 0;
+      const signNext = () => {
+        if (next === n) {
+          if (pending === 0)
+            done();
+          return;
+        }
+        pending++;
+        crypto.sign('sha256', messages[next++], privateKey, (err) => {
+          if (err)
+            throw err;
+          pending--;
+          signNext();
+        });
+      };
+      for (let i = 0; i < kConcurrency; i++)
+        signNext();
+      break;
+    }
+    case 'batch':
+      crypto.signBatch('sha256', messages, privateKey, (err) => {
+        if (err)
+          throw err;
+        done();
+      });
+      break;
+    default:
+      throw new Error(`Unsupported mode ${mode}`);
+  }
+}
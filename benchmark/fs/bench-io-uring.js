@@ -0,0 +1,100 @@
+// Compare the libuv thread pool with the io_uring submission path
+// (UV_USE_IO_URING=1, Linux >= 5.6 only) for many concurrent small file
+// operations. `metric=throughput` reports operations per second,
+// `metric=p99` reports the inverse of the 99th percentile latency so that,
+// like every other benchmark, higher is better.
+'use strict';
+
+const common = require('../common.js');
+const fs = require('fs');
+const path = require('path');
+const { fork } = require('child_process');
+
+const tmpdir = require('../../test/common/tmpdir');
+
+const bench = common.createBenchmark(main, {
+  type: ['read', 'write', 'stat'],
+  io_uring: [0, 1],
+  concurrent: [1, 64, 512],
+  size: [4096],
+  metric: ['throughput', 'p99'],
+  n: [2e5]
+});
+
+function main(conf) {
+  if (process.env.UV_USE_IO_URING !== `${conf.io_uring}`) {
+    // The backend is picked when the event loop is created, rerun this
+    // configuration in a process that has the environment variable set.
+    const args = Object.keys(conf).map((key) => `${key}=${conf[key]}`);
+    const env = { ...process.env, UV_USE_IO_URING: `${conf.io_uring}` };
+    fork(__filename, args, { env }).on('message', common.sendResult);
+    return;
+  }
+
+  const { type, concurrent, size, metric, n } = conf;
+
+  tmpdir.refresh();
+  const filename = path.resolve(tmpdir.path,
+                                `.removeme-benchmark-garbage-${process.pid}`);
+  fs.writeFileSync(filename, Buffer.alloc(size * concurrent, 'x'));
+  const fd = fs.openSync(filename, 'r+');
+  const latencies = new Float64Array(n);
+  let started = 0;
+  let finished = 0;
+
+  const start = process.hrtime();
+  for (let i = 0; i < concurrent; i++)
+    issue(Buffer.alloc(size), i * size);
+
+  function issue(buffer, position) {
+    if (started === n)
+      return;
+
+    const index = started++;
+    const t = process.hrtime();
+    const done = (err) => {
+      if (err)
+        throw err;
+      const elapsed = process.hrtime(t);
+      latencies[index] = elapsed[0] * 1e9 + elapsed[1];
+      if (++finished === n)
+        return end();
+      issue(buffer, position);
+    };
+
+    switch (type) {
+      case 'read':
+        fs.read(fd, buffer, 0, size, position, done);
+        break;
+      case 'write':
+        fs.write(fd, buffer, 0, size, position, done);
+        break;
+      case 'stat':
+        fs.fstat(fd, done);
+        break;
+      default:
+        throw new Error(`invalid type: ${type}`);
+    }
+  }
+
+  function end() {
+    const elapsed = process.hrtime(start);
+    const time = elapsed[0] + elapsed[1] / 1e9;
+    fs.closeSync(fd);
+    fs.unlinkSync(filename);
+
+    let rate = n / time;
+    if (metric === 'p99') {
+      latencies.sort();
+      rate = 1e9 / latencies[Math.floor(n * 0.99)];
+    }
+
+    common.sendResult({
+      name: bench.name,
+      conf: bench.config,
+      rate,
+      time,
+      type: 'report'
+    });
+  }
+}
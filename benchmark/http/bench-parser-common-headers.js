@@ -0,0 +1,81 @@
+// Parsing requests whose headers are common (and served from the parser's
+// string cache) or uncommon. `measure=allocation` reports the number of bytes
+// allocated on the JS heap per request instead of the number of requests per
+// second.
+'use strict';
+
+const common = require('../common');
+const v8 = require('v8');
+
+const bench = common.createBenchmark(main, {
+  headers: ['common', 'uncommon'],
+  measure: ['throughput', 'allocation'],
+  n: [1e5]
+}, {
+  // A young generation large enough not to be collected while measuring
+  // allocations.
+  flags: ['--expose-internals', '--no-warnings', '--max-semi-space-size=64']
+});
+
+const commonHeaders = [
+  ['Host', 'localhost:8080'],
+  ['Connection', 'keep-alive'],
+  ['Accept', '*/*'],
+  ['Accept-Encoding', 'gzip, deflate, br'],
+  ['Accept-Language', 'en-US,en;q=0.9'],
+  ['Cache-Control', 'no-cache'],
+  ['Content-Type', 'application/json'],
+  ['Content-Length', '0'],
+  ['User-Agent', 'Mozilla/5.0 (X11; Linux x86_64)'],
+  ['Upgrade-Insecure-Requests', '1'],
+];
+
+function main({ headers, measure, n }) {
+  const { HTTPParser } = common.binding('http_parser');
+  const REQUEST = HTTPParser.REQUEST;
+  const kOnHeaders = HTTPParser.kOnHeaders | 0;
+  const kOnHeadersComplete = HTTPParser.kOnHeadersComplete | 0;
+  const kOnBody = HTTPParser.kOnBody | 0;
+  const kOnMessageComplete = HTTPParser.kOnMessageComplete | 0;
+  const CRLF = '\r\n';
+
+  const parser = new HTTPParser();
+  parser.initialize(REQUEST, {});
+  parser[kOnHeaders] = function() { };
+  parser[kOnHeadersComplete] = function() { };
+  parser[kOnBody] = function() { };
+  parser[kOnMessageComplete] = function() { };
+
+  let request = `GET /hello HTTP/1.1${CRLF}`;
+  for (const [name, value] of commonHeaders) {
+    if (headers === 'common')
+      request += `${name}: ${value}${CRLF}`;
+    else
+      request += `X-${name}: X-${value}${CRLF}`;
+  }
+  request += CRLF;
+  request = Buffer.from(request);
+
+  function parse(iterations) {
+    for (let i = 0; i < iterations; i++) {
+      parser.execute(request, 0, request.length);
+      parser.initialize(REQUEST, {});
+    }
+  }
+
+  if (measure === 'allocation') {
+    const iterations = Math.min(n, 1e4);
+    // Warm up, so that the first parse's one-time allocations do not count.
+    parse(100);
+    const start = process.hrtime();
+    const before = v8.getHeapStatistics().used_heap_size;
+    parse(iterations);
+    const after = v8.getHeapStatistics().used_heap_size;
+    bench.report((after - before) / iterations, process.hrtime(start));
+    return;
+  }
+
+  bench.start();
+  parse(n);
+  bench.end(n);
+}
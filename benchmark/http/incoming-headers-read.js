@@ -0,0 +1,74 @@
+// Parsing requests into IncomingMessages, with the headers passed by the
+// parser as one string (`block=1`) or as an array of strings (`block=0`), and
+// either left alone or read through `message.headers`.
+'use strict';
+
+const common = require('../common');
+
+const bench = common.createBenchmark(main, {
+  headers: ['common', 'uncommon'],
+  block: [0, 1],
+  read: [0, 1],
+  n: [1e5]
+}, {
+  flags: ['--expose-internals', '--no-warnings']
+});
+
+const commonHeaders = [
+  ['Host', 'localhost:8080'],
+  ['Connection', 'keep-alive'],
+  ['Accept', '*/*'],
+  ['Accept-Encoding', 'gzip, deflate, br'],
+  ['Accept-Language', 'en-US,en;q=0.9'],
+  ['Cache-Control', 'no-cache'],
+  ['Content-Type', 'application/json'],
+  ['Content-Length', '0'],
+  ['User-Agent', 'Mozilla/5.0 (X11; Linux x86_64)'],
+  ['Upgrade-Insecure-Requests', '1'],
+];
+
+function main({ headers, block, read, n }) {
+  const { HTTPParser } = common.binding('http_parser');
+  const { IncomingMessage } = require('_http_incoming');
+  const REQUEST = HTTPParser.REQUEST;
+  const kOnHeaders = HTTPParser.kOnHeaders | 0;
+  const kOnHeadersComplete = HTTPParser.kOnHeadersComplete | 0;
+  const kOnBody = HTTPParser.kOnBody | 0;
+  const kOnMessageComplete = HTTPParser.kOnMessageComplete | 0;
+  const CRLF = '\r\n';
+
+  let contentType;
+  const parser = new HTTPParser();
+  parser.initialize(REQUEST, {}, 0, false, block === 1);
+  parser[kOnHeaders] = function() { };
+  parser[kOnHeadersComplete] = function(versionMajor, versionMinor,
+                                        headers) {
+    const message = new IncomingMessage(null);
+    message._addHeaderLines(
+      headers, typeof headers === 'string' ? Infinity : headers.length);
+    if (read === 1)
+      contentType = message.headers['content-type'];
+  };
+  parser[kOnBody] = function() { };
+  parser[kOnMessageComplete] = function() { };
+
+  let request = `GET /hello HTTP/1.1${CRLF}`;
+  for (const [name, value] of commonHeaders) {
+    if (headers === 'common')
+      request += `${name}: ${value}${CRLF}`;
+    else
+      request += `X-${name}: X-${value}${CRLF}`;
+  }
+  request += CRLF;
+  request = Buffer.from(request);
+
+  bench.start();
+  for (let i = 0; i < n; i++) {
+    parser.execute(request, 0, request.length);
+    parser.initialize(REQUEST, {}, 0, false, block === 1);
+  }
+  bench.end(n);
+
+  if (read === 1 && headers === 'common' && contentType !== 'application/json')
+    throw new Error('unexpected content-type');
+}
@@ -0,0 +1,57 @@
+// Requests per second for pipelined keep-alive requests from a local client
+// that writes `pipeline` requests at a time.
+'use strict';
+const common = require('../common.js');
+const http = require('http');
+const net = require('net');
+
+const bench = common.createBenchmark(main, {
+  pipeline: [1, 16, 64],
+  n: [1e5]
+});
+
+const kStatusLine = 'HTTP/1.1 200 OK';
+
+function main({ pipeline, n }) {
+  const server = http.createServer((req, res) => {
+    res.end('ok');
+  });
+
+  server.listen(0, () => {
+    const request = Buffer.from(
+      'GET / HTTP/1.1\r\nHost: localhost\r\n\r\n'.repeat(pipeline));
+    const socket = net.connect(server.address().port);
+    let sent = 0;
+    let received = 0;
+    let tail = '';
+
+    function send() {
+      sent += pipeline;
+      socket.write(request);
+    }
+
+    socket.setEncoding('latin1');
+    socket.on('data', (data) => {
+      // Count status lines, including one split across two reads.
+      const str = tail + data;
+      for (let i = str.indexOf(kStatusLine); i !== -1;
+        i = str.indexOf(kStatusLine, i + kStatusLine.length)) {
+        received++;
+      }
+      tail = str.slice(-(kStatusLine.length - 1));
+
+      if (received < sent)
+        return;
+      if (received < n)
+        return send();
+      bench.end(received);
+      socket.destroy();
+      server.close();
+    });
+
+    socket.on('connect', () => {
+      bench.start();
+      send();
+    });
+  });
+}
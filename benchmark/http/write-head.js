@@ -0,0 +1,38 @@
+'use strict';
+
+// Building the header block of a response, without any I/O.
+const common = require('../common.js');
+const { ServerResponse } = require('http');
+
+const bench = common.createBenchmark(main, {
+  api: ['writeHead', 'setHeader'],
+  headers: [4, 16, 128],
+  n: [1e6]
+});
+
+const req = { method: 'GET', httpVersionMajor: 1, httpVersionMinor: 1 };
+
+function main({ api, headers, n }) {
+  const fields = {
+    'Content-Type': 'application/json; charset=utf-8',
+    'Content-Length': 1234,
+    'Cache-Control': 'no-cache',
+    'X-Request-Id': 'd4f1c9a2-6b1e-4c3a-9f7e-2a1b3c4d5e6f',
+  };
+  for (let i = 4; i < headers; i++)
+    fields[`X-Header-${i}`] = `some header value ${i}`;
+  const names = Object.keys(fields);
+
+  bench.start();
+  for (let i = 0; i < n; i++) {
+    const res = new ServerResponse(req);
+    if (api === 'writeHead') {
+      res.writeHead(200, fields);
+    } else {
+      for (const name of names)
+        res.setHeader(name, fields[name]);
+      res.writeHead(200);
+    }
+  }
+  bench.end(n);
+}
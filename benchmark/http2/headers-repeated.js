@@ -0,0 +1,60 @@
+'use strict';
+
+// Requests on one session that carry the same headers each time, as browsers
+// and proxies send them, or a header value that changes with every request.
+const common = require('../common.js');
+const PORT = common.PORT;
+
+const bench = common.createBenchmark(main, {
+  n: [1e4],
+  values: ['repeated', 'unique']
+}, { flags: ['--no-warnings'] });
+
+function main({ n, values }) {
+  const http2 = require('http2');
+  const server = http2.createServer();
+
+  const headersObject = {
+    ':path': '/',
+    ':scheme': 'http',
+    'accept': 'text/html,application/xhtml+xml,application/xml;q=0.9',
+    'accept-encoding': 'gzip, deflate, br',
+    'accept-language': 'en-US,en;q=0.9',
+    'cookie': `session=${'a'.repeat(64)}; tracking=${'b'.repeat(32)}`,
+    'user-agent': 'Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 ' +
+                  '(KHTML, like Gecko) Chrome/81.0.4044.92 Safari/537.36',
+    'x-forwarded-for': '203.0.113.195, 70.41.3.18, 150.172.238.178',
+    'x-request-id': ''
+  };
+
+  server.on('stream', (stream, headers) => {
+    stream.respond({
+      'content-type': 'text/plain; charset=utf-8',
+      'cache-control': 'no-cache',
+      'x-request-id': headers['x-request-id']
+    });
+    stream.end('Hi!');
+  });
+  server.listen(PORT, () => {
+    const client = http2.connect(`http://localhost:${PORT}/`);
+
+    function doRequest(remaining) {
+      if (values === 'unique')
+        headersObject['x-request-id'] = `${remaining}`;
+      const req = client.request(headersObject);
+      req.resume();
+      req.on('end', () => {
+        if (remaining > 0) {
+          doRequest(remaining - 1);
+        } else {
+          bench.end(n);
+          server.close();
+          client.destroy();
+        }
+      });
+    }
+
+    bench.start();
+    doRequest(n);
+  });
+}
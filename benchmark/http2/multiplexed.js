@@ -0,0 +1,49 @@
+'use strict';
+
+// Many concurrent streams on one session, each sending a small response in
+// several writes, so that frames from different streams share socket writes.
+const common = require('../common.js');
+const PORT = common.PORT;
+
+const bench = common.createBenchmark(main, {
+  streams: [100, 1000],
+  length: [16, 1024],
+  n: [1e4]
+}, { flags: ['--no-warnings'] });
+
+function main({ streams, length, n }) {
+  const http2 = require('http2');
+  const server = http2.createServer();
+  const chunk = Buffer.alloc(length, 'a');
+
+  server.on('stream', (stream) => {
+    stream.respond();
+    stream.write(chunk);
+    stream.write(chunk);
+    stream.end(chunk);
+  });
+  server.listen(PORT, () => {
+    const client = http2.connect(`http://localhost:${PORT}/`);
+    let started = 0;
+    let finished = 0;
+
+    function doRequest() {
+      started++;
+      const req = client.request({ ':path': '/' });
+      req.resume();
+      req.on('end', () => {
+        if (++finished === n) {
+          bench.end(n);
+          server.close();
+          client.destroy();
+        } else if (started < n) {
+          doRequest();
+        }
+      });
+    }
+
+    bench.start();
+    for (let i = 0; i < streams && i < n; i++)
+      doRequest();
+  });
+}
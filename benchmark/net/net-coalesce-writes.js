@@ -0,0 +1,62 @@
+// Request/response throughput for a server that writes every response as
+// several small chunks, with and without socket.setCoalesceWrites().
+// Run the server side under `strace -f -c -e trace=write,writev` to see the
+// number of system calls per response.
+'use strict';
+
+const common = require('../common.js');
+const net = require('net');
+const PORT = common.PORT;
+
+const bench = common.createBenchmark(main, {
+  coalesce: [0, 1],
+  writes: [1, 4, 16],
+  chunklen: [64, 1024],
+  pipeline: [1, 16],
+  dur: [5]
+});
+
+function main({ coalesce, writes, chunklen, pipeline, dur }) {
+  const chunk = Buffer.alloc(chunklen, 'x');
+  const responseSize = writes * chunklen;
+
+  const server = net.createServer((socket) => {
+    socket.setNoDelay(true);
+    if (coalesce)
+      socket.setCoalesceWrites(true);
+    // Every byte received is one request.
+    socket.on('data', (data) => {
+      for (let i = 0; i < data.length; i++) {
+        for (let j = 0; j < writes; j++)
+          socket.write(chunk);
+      }
+    });
+  });
+
+  server.listen(PORT, () => {
+    const socket = net.connect(PORT);
+    const request = Buffer.alloc(1);
+    let received = 0;
+    let responses = 0;
+
+    socket.setNoDelay(true);
+    socket.on('connect', () => {
+      bench.start();
+      socket.write(Buffer.alloc(pipeline));
+
+      setTimeout(() => {
+        bench.end(responses);
+        process.exit(0);
+      }, dur * 1000);
+    });
+
+    socket.on('data', (data) => {
+      received += data.length;
+      while (received >= responseSize) {
+        received -= responseSize;
+        responses++;
+        socket.write(request);
+      }
+    });
+  });
+}
@@ -0,0 +1,54 @@
+// Throughput of a TLS connection over loopback written to in small chunks,
+// with and without tlsSocket.setCoalesceWrites().
+'use strict';
+const common = require('../common.js');
+const bench = common.createBenchmark(main, {
+  coalesce: [0, 1],
+  size: [64, 1024, 16384],
+  dur: [5]
+});
+
+const fixtures = require('../../test/common/fixtures');
+const tls = require('tls');
+
+function main({ coalesce, size, dur }) {
+  const chunk = Buffer.alloc(size, 'b');
+  const options = {
+    key: fixtures.readKey('rsa_private.pem'),
+    cert: fixtures.readKey('rsa_cert.crt'),
+    ca: fixtures.readKey('rsa_ca.crt'),
+    ciphers: 'AES256-GCM-SHA384'
+  };
+
+  let received = 0;
+  const server = tls.createServer(options, (socket) => {
+    socket.on('data', (data) => {
+      received += data.length;
+    });
+  });
+
+  let conn;
+  server.listen(common.PORT, () => {
+    const opt = { port: common.PORT, rejectUnauthorized: false };
+    conn = tls.connect(opt, () => {
+      if (coalesce)
+        conn.setCoalesceWrites(true);
+      setTimeout(done, dur * 1000);
+      bench.start();
+      conn.on('drain', write);
+      write();
+    });
+
+    function write() {
+      while (false !== conn.write(chunk));
+    }
+  });
+
+  function done() {
+    const mbits = (received * 8) / (1024 * 1024);
+    bench.end(mbits);
+    if (conn)
+      conn.destroy();
+    server.close();
+  }
+}
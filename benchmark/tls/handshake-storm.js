@@ -0,0 +1,94 @@
+// Measure how well a TLS server keeps serving established connections while
+// it is flooded with new handshakes, with and without offloading the
+// handshakes' private key operations to the threadpool. The server runs in a
+// child process, so that the event loop under test only does server work.
+// `metric=handshakes` reports handshakes per second, `metric=p99` reports the
+// inverse of the 99th percentile round-trip latency of the established
+// connections so that, like every other benchmark, higher is better.
+'use strict';
+
+const common = require('../common.js');
+const fixtures = require('../../test/common/fixtures');
+const tls = require('tls');
+const { fork } = require('child_process');
+
+if (process.env.NODE_BENCHMARK_TLS_SERVER !== undefined) {
+  const server = tls.createServer({
+    key: fixtures.readKey('rsa_private.pem'),
+    cert: fixtures.readKey('rsa_cert.crt'),
+    offloadHandshake: process.env.NODE_BENCHMARK_TLS_SERVER === '1'
+  }, (socket) => {
+    socket.on('error', () => {});
+    socket.pipe(socket);
+  });
+  server.listen(common.PORT, () => process.send('listening'));
+  process.on('disconnect', () => process.exit(0));
+  return;
+}
+
+const bench = common.createBenchmark(main, {
+  offload: [0, 1],
+  metric: ['handshakes', 'p99'],
+  concurrency: [16],
+  dur: [5]
+});
+
+const kPingers = 4;
+
+function main({ offload, metric, concurrency, dur }) {
+  const env = { ...process.env, NODE_BENCHMARK_TLS_SERVER: `${offload}` };
+  const server = fork(__filename, [], { env });
+  server.once('message', () => run(server, metric, concurrency, dur));
+}
+
+function run(server, metric, concurrency, dur) {
+  const options = { port: common.PORT, rejectUnauthorized: false };
+  const latencies = [];
+  let handshakes = 0;
+  let running = true;
+
+  function ping() {
+    const socket = tls.connect(options, () => {
+      let sentAt;
+      socket.on('data', () => {
+        latencies.push(process.hrtime.bigint() - sentAt);
+        if (!running)
+          return socket.destroy();
+        sentAt = process.hrtime.bigint();
+        socket.write('x');
+      });
+      sentAt = process.hrtime.bigint();
+      socket.write('x');
+    });
+  }
+
+  function connect() {
+    const socket = tls.connect(options, () => {
+      handshakes++;
+      socket.end();
+      if (running)
+        connect();
+    });
+    socket.on('error', () => {});
+  }
+
+  for (let i = 0; i < kPingers; i++)
+    ping();
+
+  bench.start();
+  for (let i = 0; i < concurrency; i++)
+    connect();
+
+  setTimeout(() => {
+    running = false;
+    if (metric === 'handshakes') {
+      bench.end(handshakes);
+    } else {
+      latencies.sort((a, b) => (a < b ? -1 : a > b ? 1 : 0));
+      const p99 = latencies[Math.floor(latencies.length * 0.99)];
+      bench.report(1e9 / Number(p99), [dur, 0]);
+    }
+    server.disconnect();
+    process.exit(0);
+  }, dur * 1000);
+}
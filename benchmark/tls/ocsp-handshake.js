@@ -0,0 +1,71 @@
+// Measure the rate of handshakes of clients that request OCSP stapling, with
+// and without the server's ocspCache option. `contexts` is the number of SNI
+// contexts that clients are spread across, 0 for none. The 'OCSPRequest'
+// listener answers from memory, like a server that caches responses itself.
+'use strict';
+
+const common = require('../common.js');
+const fixtures = require('../../test/common/fixtures');
+const tls = require('tls');
+
+const bench = common.createBenchmark(main, {
+  ocspCache: [0, 1],
+  contexts: [0, 250],
+  concurrency: [16],
+  dur: [5]
+});
+
+function main({ ocspCache, contexts, concurrency, dur }) {
+  const options = {
+    key: fixtures.readKey('agent1-key.pem'),
+    cert: fixtures.readKey('agent1-cert.pem'),
+    ca: fixtures.readKey('ca1-cert.pem')
+  };
+  const response = fixtures.readKey('agent1-ocsp-response.der');
+
+  const server = tls.createServer({ ...options, ocspCache: !!ocspCache },
+                                  (socket) => socket.end());
+  server.on('OCSPRequest', (cert, issuer, callback) => {
+    setImmediate(callback, null, response);
+  });
+
+  const servernames = [];
+  for (let i = 0; i < contexts; i++) {
+    servernames.push(`host${i}.example.com`);
+    server.addContext(servernames[i], options);
+  }
+
+  let handshakes = 0;
+  let running = true;
+
+  function connect() {
+    const servername = contexts > 0 ?
+      servernames[handshakes % contexts] :
+      undefined;
+    const socket = tls.connect({
+      port: common.PORT,
+      servername,
+      requestOCSP: true,
+      rejectUnauthorized: false
+    }, () => {
+      handshakes++;
+      socket.end();
+      if (running)
+        connect();
+    });
+    socket.on('error', () => {});
+    socket.resume();
+  }
+
+  server.listen(common.PORT, () => {
+    bench.start();
+    for (let i = 0; i < concurrency; i++)
+      connect();
+
+    setTimeout(() => {
+      running = false;
+      bench.end(handshakes);
+      process.exit(0);
+    }, dur * 1000);
+  });
+}
@@ -0,0 +1,62 @@
+// Compression of small, similar JSON bodies with and without a preset
+// dictionary. `measure=ratio` reports the compression ratio (uncompressed size
+// divided by compressed size) instead of the number of bodies per second.
+'use strict';
+const common = require('../common.js');
+const zlib = require('zlib');
+
+const bench = common.createBenchmark(main, {
+  dictionary: ['none', 'buffer', 'shared'],
+  measure: ['throughput', 'ratio'],
+  level: [6],
+  n: [5e4]
+});
+
+const names = ['alice', 'bob', 'carol', 'dave', 'eve', 'mallory', 'trent'];
+const tags = ['admin', 'staff', 'guest', 'beta', 'internal'];
+
+function createBody(i) {
+  return Buffer.from(JSON.stringify({
+    id: i,
+    name: names[i % names.length],
+    email: `${names[i % names.length]}.${i}@example.com`,
+    active: i % 3 !== 0,
+    tags: tags.slice(i % tags.length),
+    created: new Date(1577836800000 + i * 3600000).toISOString(),
+    address: { city: 'Springfield', zip: `${10000 + i % 9000}` }
+  }));
+}
+
+function main({ dictionary, measure, level, n }) {
+  const bodies = [];
+  for (let i = 0; i < 256; i++)
+    bodies.push(createBody(i));
+
+  const options = { level };
+  if (dictionary !== 'none') {
+    // Built from bodies that are not part of the corpus.
+    const sample = [];
+    for (let i = 0; i < 8; i++)
+      sample.push(createBody(1000 + i));
+    options.dictionary = dictionary === 'shared' ?
+      zlib.createDictionary(Buffer.concat(sample)) :
+      Buffer.concat(sample);
+  }
+
+  if (measure === 'ratio') {
+    const start = process.hrtime();
+    let inputSize = 0;
+    let outputSize = 0;
+    for (const body of bodies) {
+      inputSize += body.length;
+      outputSize += zlib.deflateSync(body, options).length;
+    }
+    bench.report(inputSize / outputSize, process.hrtime(start));
+    return;
+  }
+
+  bench.start();
+  for (let i = 0; i < n; i++)
+    zlib.deflateSync(bodies[i % bodies.length], options);
+  bench.end(n);
+}
@@ -0,0 +1,37 @@
+// One-shot compression of small payloads, where setting up the compression
+// context is a large part of the total cost.
+'use strict';
+const common = require('../common.js');
+const zlib = require('zlib');
+
+const bench = common.createBenchmark(main, {
+  method: ['deflateSync', 'gzipSync', 'deflateRawSync', 'deflate', 'gzip'],
+  inputLen: [1024],
+  n: [1e5]
+});
+
+function main({ n, method, inputLen }) {
+  // Default method value for testing.
+  method = method || 'gzipSync';
+  const fn = zlib[method];
+  const chunk = Buffer.alloc(inputLen);
+  for (let i = 0; i < inputLen; i++)
+    chunk[i] = 'abcdefghij{}":,'.charCodeAt(i % 15) + (i % 7 === 0);
+
+  let i = 0;
+  if (method.endsWith('Sync')) {
+    bench.start();
+    for (; i < n; ++i)
+      fn(chunk);
+    bench.end(n);
+    return;
+  }
+
+  bench.start();
+  (function next(err) {
+    if (err) throw err;
+    if (i++ === n)
+      return bench.end(n);
+    fn(chunk, next);
+  })();
+}
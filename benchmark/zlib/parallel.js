@@ -0,0 +1,47 @@
+// Throughput, in MB/s of input, of compressing a large payload with a Gzip or
+// Deflate stream, depending on the `parallelism` option.
+'use strict';
+const common = require('../common.js');
+const zlib = require('zlib');
+
+const bench = common.createBenchmark(main, {
+  type: ['Gzip', 'Deflate'],
+  parallelism: [1, 2, 4, 8],
+  inputLen: [64 * 1024 * 1024],
+  level: [6]
+});
+
+function main({ type, parallelism, inputLen, level }) {
+  // Moderately compressible input, roughly like a log file. One megabyte of
+  // it is generated and then repeated, which is far beyond the window size.
+  const words = ['GET', 'POST', '/api/v1/items', '200', '404', 'ms', 'user',
+                 'session', 'cache', 'miss', 'hit', 'request', 'response'];
+  const pattern = Buffer.allocUnsafe(Math.min(inputLen, 1024 * 1024));
+  let seed = 1;
+  for (let offset = 0; offset < pattern.length;) {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    const word = (seed & 0xff) < 16 ? `${seed}\n` : `${words[seed % 13]} `;
+    offset += pattern.write(word, offset, 'latin1');
+  }
+  const input = Buffer.allocUnsafe(inputLen);
+  for (let offset = 0; offset < inputLen; offset += pattern.length)
+    pattern.copy(input, offset);
+  const chunkLen = 64 * 1024;
+
+  const stream = zlib[`create${type}`]({ parallelism, level });
+  stream.resume();
+  stream.on('end', () => bench.end(inputLen / (1024 * 1024)));
+
+  bench.start();
+  let offset = 0;
+  (function next() {
+    if (offset >= inputLen)
+      return stream.end();
+    const chunk = input.slice(offset, offset + chunkLen);
+    offset += chunkLen;
+    if (stream.write(chunk))
+      process.nextTick(next);
+    else
+      stream.once('drain', next);
+  })();
+}
@@ -1056,6 +1056,24 @@ UV_EXTERN int uv_queue_work(uv_loop_t* loop,
                             uv_after_work_cb after_work_cb);
 
 UV_EXTERN int uv_cancel(uv_req_t* req);
+UV_EXTERN int uv_req_get_work_times(const uv_req_t* req,
+                                    uint64_t* started,
+                                    uint64_t* finished);
+
+typedef struct {
+  unsigned int max_running;
+  unsigned int max_queued;
+  unsigned int running;
+  unsigned int queued;
+  uint64_t completed;
+  uint64_t wait_time;
+} uv_threadpool_usage_t;
+
+UV_EXTERN int uv_threadpool_set_limits(uv_req_type type,
+                                       unsigned int max_running,
+                                       unsigned int max_queued);
+UV_EXTERN int uv_threadpool_get_usage(uv_req_type type,
+                                      uv_threadpool_usage_t* usage);
 
 
 struct uv_cpu_times_s {
@@ -1744,9 +1762,11 @@ struct uv_loop_s {
   unsigned int active_handles;
   void* handle_queue[2];
   union {
-    void* unused[2];
+    void* unused;
     unsigned int count;
   } active_reqs;
+  /* Internal storage for future extensions. */
+  void* internal_fields;
   /* Internal flag to signal loop stop. */
   unsigned int stop_flag;
   UV_LOOP_PRIVATE_FIELDS
@@ -32,6 +32,11 @@ struct uv__work {
   void (*done)(struct uv__work *w, int status);
   struct uv_loop_s* loop;
   void* wq[2];
+  /* uv_hrtime() when a thread started and finished running the work, or 0. */
+  uint64_t started;
+  uint64_t finished;
+  uint64_t submitted;
+  int kind;  /* enum uv__work_kind */
 };
 
 #endif /* UV_THREADPOOL_H_ */
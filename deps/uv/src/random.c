@@ -113,11 +113,10 @@ int uv_random(uv_loop_t* loop,
   req->buf = buf;
   req->buflen = buflen;
 
-  uv__work_submit(loop,
-                  &req->work_req,
-                  UV__WORK_CPU,
-                  uv__random_work,
-                  uv__random_done);
-
-  return 0;
+  /* CPU work has no limits. */
+  return uv__work_submit(loop,
+                         &req->work_req,
+                         UV__WORK_CPU,
+                         uv__random_work,
+                         uv__random_done);
 }
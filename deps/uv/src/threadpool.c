@@ -29,18 +29,37 @@
 
 #define MAX_THREADPOOL_SIZE 1024
 
+/* Work of a kind with limits waits in a queue of its own. A marker in `wq`
+ * tells workers to run the next item of that queue, provided that fewer than
+ * `max_running` threads are running work of that kind. Slow I/O is limited to
+ * half of the threads by default; `max_running` and `max_queued` can also be
+ * set with uv_threadpool_set_limits().
+ */
+struct uv__work_class {
+  QUEUE pending_wq;
+  QUEUE run_message;
+  unsigned int max_running;  /* 0 means no limit. */
+  unsigned int max_queued;  /* 0 means no limit. */
+  unsigned int running;
+  unsigned int queued;
+  uint64_t completed;
+  uint64_t wait_time;
+};
+
 static uv_once_t once = UV_ONCE_INIT;
 static uv_cond_t cond;
 static uv_mutex_t mutex;
 static unsigned int idle_threads;
-static unsigned int slow_io_work_running;
 static unsigned int nthreads;
 static uv_thread_t* threads;
 static uv_thread_t default_threads[4];
 static QUEUE exit_message;
 static QUEUE wq;
-static QUEUE run_slow_work_message;
-static QUEUE slow_io_pending_wq;
+static struct uv__work_class work_classes[UV__WORK_SLOW_IO + 1];
+/* Limits passed to uv_threadpool_set_limits(), applied when the threadpool
+ * starts. */
+static unsigned int configured_max_running[UV__WORK_SLOW_IO + 1];
+static unsigned int configured_max_queued[UV__WORK_SLOW_IO + 1];
 
 static unsigned int slow_work_thread_threshold(void) {
   return (nthreads + 1) / 2;
@@ -51,13 +70,54 @@ static void uv__cancelled(struct uv__work* w) {
 }
 
 
+static int uv__work_class_limited(const struct uv__work_class* c) {
+  return c->max_running != 0 || c->max_queued != 0;
+}
+
+
+static struct uv__work_class* uv__work_class_from_message(QUEUE* q) {
+  unsigned int i;
+
+  for (i = 0; i < ARRAY_SIZE(work_classes); i++)
+    if (q == &work_classes[i].run_message)
+      return &work_classes[i];
+
+  return NULL;
+}
+
+
+static int uv__work_class_at_limit(const struct uv__work_class* c) {
+  return c->max_running != 0 && c->running >= c->max_running;
+}
+
+
+/* Whether a worker can take something from `wq`: work, the exit message or
+ * the marker of a kind of work that is below its limit. There are only a few
+ * markers, so this looks at a handful of entries at most.
+ */
+static int uv__has_runnable_work(void) {
+  struct uv__work_class* c;
+  QUEUE* q;
+
+  QUEUE_FOREACH(q, &wq) {
+    c = uv__work_class_from_message(q);
+    if (c == NULL || !uv__work_class_at_limit(c))
+      return 1;
+  }
+
+  return 0;
+}
+
+
 /* To avoid deadlock with uv_cancel() it's crucial that the worker
  * never holds the global mutex and the loop-local mutex at the same time.
  */
 static void worker(void* arg) {
   struct uv__work* w;
+  struct uv__work_class* c;
+  uint64_t submitted;
+  uint64_t started;
   QUEUE* q;
-  int is_slow_work;
 
   uv_sem_post((uv_sem_t*) arg);
   arg = NULL;
@@ -66,12 +126,9 @@ static void worker(void* arg) {
   for (;;) {
     /* `mutex` should always be locked at this point. */
 
-    /* Keep waiting while either no work is present or only slow I/O
-       and we're at the threshold for that. */
-    while (QUEUE_EMPTY(&wq) ||
-           (QUEUE_HEAD(&wq) == &run_slow_work_message &&
-            QUEUE_NEXT(&run_slow_work_message) == &wq &&
-            slow_io_work_running >= slow_work_thread_threshold())) {
+    /* Keep waiting while either no work is present or only work of kinds
+       that are at their limit. */
+    while (!uv__has_runnable_work()) {
       idle_threads += 1;
       uv_cond_wait(&cond, &mutex);
       idle_threads -= 1;
@@ -87,39 +144,43 @@ static void worker(void* arg) {
     QUEUE_REMOVE(q);
     QUEUE_INIT(q);  /* Signal uv_cancel() that the work req is executing. */
 
-    is_slow_work = 0;
-    if (q == &run_slow_work_message) {
-      /* If we're at the slow I/O threshold, re-schedule until after all
+    c = uv__work_class_from_message(q);
+    if (c != NULL) {
+      /* If this kind of work is at its limit, re-schedule until after all
          other work in the queue is done. */
-      if (slow_io_work_running >= slow_work_thread_threshold()) {
+      if (uv__work_class_at_limit(c)) {
         QUEUE_INSERT_TAIL(&wq, q);
         continue;
       }
 
-      /* If we encountered a request to run slow I/O work but there is none
-         to run, that means it's cancelled => Start over. */
-      if (QUEUE_EMPTY(&slow_io_pending_wq))
+      /* If we encountered a request to run work of this kind but there is
+         none to run, that means it's cancelled => Start over. */
+      if (QUEUE_EMPTY(&c->pending_wq))
         continue;
 
-      is_slow_work = 1;
-      slow_io_work_running++;
-
-      q = QUEUE_HEAD(&slow_io_pending_wq);
+      q = QUEUE_HEAD(&c->pending_wq);
       QUEUE_REMOVE(q);
       QUEUE_INIT(q);
 
-      /* If there is more slow I/O work, schedule it to be run as well. */
-      if (!QUEUE_EMPTY(&slow_io_pending_wq)) {
-        QUEUE_INSERT_TAIL(&wq, &run_slow_work_message);
+      /* If there is more work of this kind, schedule it to be run as well. */
+      if (!QUEUE_EMPTY(&c->pending_wq)) {
+        QUEUE_INSERT_TAIL(&wq, &c->run_message);
         if (idle_threads > 0)
           uv_cond_signal(&cond);
       }
     }
 
+    w = QUEUE_DATA(q, struct uv__work, wq);
+    c = &work_classes[w->kind];
+    c->queued--;
+    c->running++;
     uv_mutex_unlock(&mutex);
 
-    w = QUEUE_DATA(q, struct uv__work, wq);
+    submitted = w->submitted;
+    started = uv_hrtime();
+    w->started = started;
     w->work(w);
+    w->finished = uv_hrtime();
 
     uv_mutex_lock(&w->loop->wq_mutex);
     w->work = NULL;  /* Signal uv_cancel() that the work req is done
@@ -131,32 +192,44 @@ static void worker(void* arg) {
     /* Lock `mutex` since that is expected at the start of the next
      * iteration. */
     uv_mutex_lock(&mutex);
-    if (is_slow_work) {
-      /* `slow_io_work_running` is protected by `mutex`. */
-      slow_io_work_running--;
-    }
+    /* The counters are protected by `mutex`. `w` may be gone by now. */
+    c->running--;
+    c->completed++;
+    c->wait_time += started - submitted;
   }
 }
 
 
-static void post(QUEUE* q, enum uv__work_kind kind) {
+static int post(QUEUE* q, enum uv__work_kind kind) {
+  struct uv__work_class* c;
+
   uv_mutex_lock(&mutex);
-  if (kind == UV__WORK_SLOW_IO) {
+  c = &work_classes[kind];
+  if (q != &exit_message && uv__work_class_limited(c)) {
+    if (c->max_queued != 0 && c->queued >= c->max_queued) {
+      uv_mutex_unlock(&mutex);
+      return UV_EAGAIN;
+    }
+
     /* Insert into a separate queue. */
-    QUEUE_INSERT_TAIL(&slow_io_pending_wq, q);
-    if (!QUEUE_EMPTY(&run_slow_work_message)) {
-      /* Running slow I/O tasks is already scheduled => Nothing to do here.
-         The worker that runs said other task will schedule this one as well. */
+    QUEUE_INSERT_TAIL(&c->pending_wq, q);
+    c->queued++;
+    if (!QUEUE_EMPTY(&c->run_message)) {
+      /* Running this kind of work is already scheduled => Nothing to do here.
+         The worker that runs said other work will schedule this one as well. */
       uv_mutex_unlock(&mutex);
-      return;
+      return 0;
     }
-    q = &run_slow_work_message;
+    q = &c->run_message;
+  } else if (q != &exit_message) {
+    c->queued++;
   }
 
   QUEUE_INSERT_TAIL(&wq, q);
   if (idle_threads > 0)
     uv_cond_signal(&cond);
   uv_mutex_unlock(&mutex);
+  return 0;
 }
 
 
@@ -215,8 +288,18 @@ static void init_threads(void) {
     abort();
 
   QUEUE_INIT(&wq);
-  QUEUE_INIT(&slow_io_pending_wq);
-  QUEUE_INIT(&run_slow_work_message);
+  for (i = 0; i < ARRAY_SIZE(work_classes); i++) {
+    QUEUE_INIT(&work_classes[i].pending_wq);
+    QUEUE_INIT(&work_classes[i].run_message);
+    work_classes[i].max_running = configured_max_running[i];
+    work_classes[i].max_queued = configured_max_queued[i];
+    work_classes[i].running = 0;
+    work_classes[i].queued = 0;
+    work_classes[i].completed = 0;
+    work_classes[i].wait_time = 0;
+  }
+  if (work_classes[UV__WORK_SLOW_IO].max_running == 0)
+    work_classes[UV__WORK_SLOW_IO].max_running = slow_work_thread_threshold();
 
   if (uv_sem_init(&sem, 0))
     abort();
@@ -253,16 +336,20 @@ static void init_once(void) {
 }
 
 
-void uv__work_submit(uv_loop_t* loop,
-                     struct uv__work* w,
-                     enum uv__work_kind kind,
-                     void (*work)(struct uv__work* w),
-                     void (*done)(struct uv__work* w, int status)) {
+int uv__work_submit(uv_loop_t* loop,
+                    struct uv__work* w,
+                    enum uv__work_kind kind,
+                    void (*work)(struct uv__work* w),
+                    void (*done)(struct uv__work* w, int status)) {
   uv_once(&once, init_once);
   w->loop = loop;
   w->work = work;
   w->done = done;
-  post(&w->wq, kind);
+  w->started = 0;
+  w->finished = 0;
+  w->submitted = uv_hrtime();
+  w->kind = kind;
+  return post(&w->wq, kind);
 }
 
 
@@ -273,8 +360,10 @@ static int uv__work_cancel(uv_loop_t* loop, uv_req_t* req, struct uv__work* w) {
   uv_mutex_lock(&w->loop->wq_mutex);
 
   cancelled = !QUEUE_EMPTY(&w->wq) && w->work != NULL;
-  if (cancelled)
+  if (cancelled) {
     QUEUE_REMOVE(&w->wq);
+    work_classes[w->kind].queued--;
+  }
 
   uv_mutex_unlock(&w->loop->wq_mutex);
   uv_mutex_unlock(&mutex);
@@ -346,12 +435,12 @@ int uv_queue_work(uv_loop_t* loop,
   req->loop = loop;
   req->work_cb = work_cb;
   req->after_work_cb = after_work_cb;
-  uv__work_submit(loop,
-                  &req->work_req,
-                  UV__WORK_CPU,
-                  uv__queue_work,
-                  uv__queue_done);
-  return 0;
+  /* CPU work has no limits. */
+  return uv__work_submit(loop,
+                         &req->work_req,
+                         UV__WORK_CPU,
+                         uv__queue_work,
+                         uv__queue_done);
 }
 
 
@@ -386,3 +475,100 @@ int uv_cancel(uv_req_t* req) {
 
   return uv__work_cancel(loop, req, wreq);
 }
+
+
+int uv_req_get_work_times(const uv_req_t* req,
+                          uint64_t* started,
+                          uint64_t* finished) {
+  const struct uv__work* wreq;
+
+  switch (req->type) {
+  case UV_FS:
+    wreq = &((const uv_fs_t*) req)->work_req;
+    break;
+  case UV_GETADDRINFO:
+    wreq = &((const uv_getaddrinfo_t*) req)->work_req;
+    break;
+  case UV_GETNAMEINFO:
+    wreq = &((const uv_getnameinfo_t*) req)->work_req;
+    break;
+  case UV_RANDOM:
+    wreq = &((const uv_random_t*) req)->work_req;
+    break;
+  case UV_WORK:
+    wreq = &((const uv_work_t*) req)->work_req;
+    break;
+  default:
+    return UV_EINVAL;
+  }
+
+  if (wreq->started == 0)
+    return UV_ENOENT;
+
+  *started = wreq->started;
+  *finished = wreq->finished;
+  return 0;
+}
+
+
+static int uv__work_kind_of(uv_req_type type, enum uv__work_kind* kind) {
+  switch (type) {
+  case UV_FS:
+    *kind = UV__WORK_FAST_IO;
+    return 0;
+  case UV_GETADDRINFO:
+  case UV_GETNAMEINFO:
+    *kind = UV__WORK_SLOW_IO;
+    return 0;
+  case UV_RANDOM:
+  case UV_WORK:
+    *kind = UV__WORK_CPU;
+    return 0;
+  default:
+    return UV_EINVAL;
+  }
+}
+
+
+int uv_threadpool_set_limits(uv_req_type type,
+                             unsigned int max_running,
+                             unsigned int max_queued) {
+  enum uv__work_kind kind;
+  int err;
+
+  err = uv__work_kind_of(type, &kind);
+  if (err != 0 || kind == UV__WORK_CPU)
+    return UV_EINVAL;
+
+  /* The limits only take effect when the threadpool starts. */
+  if (nthreads != 0)
+    return UV_EBUSY;
+
+  configured_max_running[kind] = max_running;
+  configured_max_queued[kind] = max_queued;
+  return 0;
+}
+
+
+int uv_threadpool_get_usage(uv_req_type type, uv_threadpool_usage_t* usage) {
+  const struct uv__work_class* c;
+  enum uv__work_kind kind;
+  int err;
+
+  err = uv__work_kind_of(type, &kind);
+  if (err != 0)
+    return err;
+
+  uv_once(&once, init_once);
+  uv_mutex_lock(&mutex);
+  c = &work_classes[kind];
+  usage->max_running = c->max_running;
+  usage->max_queued = c->max_queued;
+  usage->running = c->running;
+  usage->queued = c->queued;
+  usage->completed = c->completed;
+  usage->wait_time = c->wait_time;
+  uv_mutex_unlock(&mutex);
+
+  return 0;
+}
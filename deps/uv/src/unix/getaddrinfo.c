@@ -206,12 +206,19 @@ int uv_getaddrinfo(uv_loop_t* loop,
     req->hostname = memcpy(buf + len, hostname, hostname_len);
 
   if (cb) {
-    uv__work_submit(loop,
-                    &req->work_req,
-                    UV__WORK_SLOW_IO,
-                    uv__getaddrinfo_work,
-                    uv__getaddrinfo_done);
-    return 0;
+    rc = uv__work_submit(loop,
+                         &req->work_req,
+                         UV__WORK_SLOW_IO,
+                         uv__getaddrinfo_work,
+                         uv__getaddrinfo_done);
+    if (rc != 0) {
+      uv__req_unregister(loop, req);
+      uv__free(buf);
+      req->hints = NULL;
+      req->service = NULL;
+      req->hostname = NULL;
+    }
+    return rc;
   } else {
     uv__getaddrinfo_work(&req->work_req);
     uv__getaddrinfo_done(&req->work_req, 0);
@@ -36,6 +36,7 @@
 
 #include <net/if.h>
 #include <sys/epoll.h>
+#include <sys/mman.h>
 #include <sys/param.h>
 #include <sys/prctl.h>
 #include <sys/sysinfo.h>
@@ -75,12 +76,40 @@
 # define CLOCK_BOOTTIME 7
 #endif
 
+/* Number of submission queue entries. The kernel sizes the completion queue
+ * at twice this number.
+ */
+#define UV__IOU_ENTRIES 256
+
+struct uv__iou {
+  uint32_t* sqhead;
+  uint32_t* sqtail;
+  uint32_t sqmask;
+  uint32_t* cqhead;
+  uint32_t* cqtail;
+  uint32_t cqmask;
+  uint32_t cqentries;
+  struct uv__io_uring_sqe* sqe;
+  struct uv__io_uring_cqe* cqe;
+  void* sq;
+  size_t maxlen;
+  size_t sqelen;
+  uint32_t unsubmitted;
+  uint32_t in_flight;
+  int ringfd;
+  uv__io_t ringfd_watcher;
+};
+
 static int read_models(unsigned int numcpus, uv_cpu_info_t* ci);
 static int read_times(FILE* statfile_fp,
                       unsigned int numcpus,
                       uv_cpu_info_t* ci);
 static void read_speeds(unsigned int numcpus, uv_cpu_info_t* ci);
 static uint64_t read_cpufreq(unsigned int cpunum);
+static void uv__iou_init(uv_loop_t* loop);
+static void uv__iou_delete(uv_loop_t* loop);
+static int uv__iou_flush(struct uv__iou* iou);
+static void uv__iou_fallback(uv_loop_t* loop, struct uv__iou* iou);
 
 
 int uv__platform_loop_init(uv_loop_t* loop) {
@@ -110,10 +139,13 @@ int uv__platform_loop_init(uv_loop_t* loop) {
   loop->backend_fd = fd;
   loop->inotify_fd = -1;
   loop->inotify_watchers = NULL;
+  loop->internal_fields = NULL;
 
   if (fd == -1)
     return UV__ERR(errno);
 
+  uv__iou_init(loop);
+
   return 0;
 }
 
@@ -137,6 +169,7 @@ int uv__io_fork(uv_loop_t* loop) {
 
 
 void uv__platform_loop_delete(uv_loop_t* loop) {
+  uv__iou_delete(loop);
   if (loop->inotify_fd == -1) return;
   uv__io_stop(loop, &loop->inotify_read_watcher, POLLIN);
   uv__close(loop->inotify_fd);
@@ -144,6 +177,464 @@ void uv__platform_loop_delete(uv_loop_t* loop) {
 }
 
 
+/* io_uring support is opt-in: set UV_USE_IO_URING=1 in the environment to
+ * let asynchronous file reads, writes, fsyncs and stats bypass the thread
+ * pool. Requests that cannot be submitted to the ring (kernel too old, ring
+ * full, unsupported operation) silently fall back to the thread pool.
+ */
+static int uv__use_io_uring(void) {
+  const char* val;
+
+  val = getenv("UV_USE_IO_URING");
+  return val != NULL && atoi(val) > 0;
+}
+
+
+static void uv__iou_io(uv_loop_t* loop, uv__io_t* w, unsigned int events);
+
+
+static void uv__iou_init(uv_loop_t* loop) {
+  struct uv__io_uring_params params;
+  struct uv__iou* iou;
+  uint32_t* sqarray;
+  size_t sqlen;
+  size_t cqlen;
+  size_t maxlen;
+  size_t sqelen;
+  uint32_t i;
+  char* sq;
+  char* sqe;
+  int ringfd;
+
+  if (!uv__use_io_uring())
+    return;
+
+  memset(&params, 0, sizeof(params));
+  ringfd = uv__io_uring_setup(UV__IOU_ENTRIES, &params);
+  if (ringfd == -1)
+    return;  /* ENOSYS, or EPERM when a seccomp filter rejects it. */
+
+  sq = MAP_FAILED;
+  sqe = MAP_FAILED;
+  sqlen = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+  cqlen = params.cq_off.cqes +
+          params.cq_entries * sizeof(struct uv__io_uring_cqe);
+  maxlen = sqlen < cqlen ? cqlen : sqlen;
+  sqelen = params.sq_entries * sizeof(struct uv__io_uring_sqe);
+
+  /* Require Linux >= 5.6: single mmap for both rings, no dropped completions,
+   * and IORING_OP_STATX plus off=-1 meaning "current file position".
+   */
+  if (!(params.features & UV__IORING_FEAT_SINGLE_MMAP))
+    goto fail;
+
+  if (!(params.features & UV__IORING_FEAT_NODROP))
+    goto fail;
+
+  if (!(params.features & UV__IORING_FEAT_RW_CUR_POS))
+    goto fail;
+
+  sq = mmap(0,
+            maxlen,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE,
+            ringfd,
+            UV__IORING_OFF_SQ_RING);
+
+  sqe = mmap(0,
+             sqelen,
+             PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_POPULATE,
+             ringfd,
+             UV__IORING_OFF_SQES);
+
+  if (sq == MAP_FAILED || sqe == MAP_FAILED)
+    goto fail;
+
+  iou = uv__malloc(sizeof(*iou));
+  if (iou == NULL)
+    goto fail;
+
+  /* Slot i in the submission queue always points to entry i in the sqe
+   * array, that way we only have to fill in the sqe and bump the tail.
+   */
+  sqarray = (uint32_t*) (sq + params.sq_off.array);
+  for (i = 0; i < params.sq_entries; i++)
+    sqarray[i] = i;
+
+  iou->sqhead = (uint32_t*) (sq + params.sq_off.head);
+  iou->sqtail = (uint32_t*) (sq + params.sq_off.tail);
+  iou->sqmask = *(uint32_t*) (sq + params.sq_off.ring_mask);
+  iou->cqhead = (uint32_t*) (sq + params.cq_off.head);
+  iou->cqtail = (uint32_t*) (sq + params.cq_off.tail);
+  iou->cqmask = *(uint32_t*) (sq + params.cq_off.ring_mask);
+  iou->cqentries = params.cq_entries;
+  iou->sqe = (struct uv__io_uring_sqe*) sqe;
+  iou->cqe = (struct uv__io_uring_cqe*) (sq + params.cq_off.cqes);
+  iou->sq = sq;
+  iou->maxlen = maxlen;
+  iou->sqelen = sqelen;
+  iou->unsubmitted = 0;
+  iou->in_flight = 0;
+  iou->ringfd = ringfd;
+  uv__io_init(&iou->ringfd_watcher, uv__iou_io, ringfd);
+
+  loop->internal_fields = iou;
+  return;
+
+fail:
+  if (sq != MAP_FAILED)
+    munmap(sq, maxlen);
+
+  if (sqe != MAP_FAILED)
+    munmap(sqe, sqelen);
+
+  uv__close(ringfd);
+}
+
+
+static void uv__iou_delete(uv_loop_t* loop) {
+  struct uv__iou* iou;
+
+  iou = loop->internal_fields;
+  if (iou == NULL)
+    return;
+
+  uv__io_stop(loop, &iou->ringfd_watcher, POLLIN);
+  munmap(iou->sqe, iou->sqelen);
+  munmap(iou->sq, iou->maxlen);
+  uv__close(iou->ringfd);
+  uv__free(iou);
+  loop->internal_fields = NULL;
+}
+
+
+/* Hand all queued submissions to the kernel. Called from uv__io_poll() right
+ * before blocking so that requests issued during one loop iteration are
+ * submitted with a single system call. Returns 0, or an error code when the
+ * kernel refuses the submissions for a reason that does not go away by
+ * itself.
+ */
+static int uv__iou_flush(struct uv__iou* iou) {
+  int rc;
+
+  while (iou->unsubmitted > 0) {
+    do
+      rc = uv__io_uring_enter(iou->ringfd, iou->unsubmitted, 0, 0);
+    while (rc == -1 && errno == EINTR);
+
+    if (rc == -1) {
+      /* EAGAIN and EBUSY are transient, try again on the next tick. */
+      if (errno == EAGAIN || errno == EBUSY)
+        return 0;
+      return UV__ERR(errno);
+    }
+
+    if (rc == 0)
+      return 0;
+
+    iou->unsubmitted -= rc;
+  }
+
+  return 0;
+}
+
+
+static struct uv__io_uring_sqe* uv__iou_get_sqe(uv_loop_t* loop,
+                                                uv_fs_t* req) {
+  struct uv__io_uring_sqe* sqe;
+  struct uv__iou* iou;
+  uint32_t head;
+  uint32_t tail;
+
+  iou = loop->internal_fields;
+  if (iou == NULL)
+    return NULL;
+
+  /* Never have more requests in flight than fit in the completion queue. */
+  if (iou->in_flight >= iou->cqentries)
+    return NULL;
+
+  head = __atomic_load_n(iou->sqhead, __ATOMIC_ACQUIRE);
+  tail = *iou->sqtail;
+
+  if (tail - head > iou->sqmask) {
+    /* Submission queue is full, flush it and retry once. */
+    uv__iou_flush(iou);
+    head = __atomic_load_n(iou->sqhead, __ATOMIC_ACQUIRE);
+    if (tail - head > iou->sqmask)
+      return NULL;
+  }
+
+  sqe = &iou->sqe[tail & iou->sqmask];
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->user_data = (uintptr_t) req;
+
+  /* Pacify uv_cancel(), the request is not in the work queue. */
+  req->work_req.loop = loop;
+  req->work_req.work = NULL;
+  req->work_req.done = NULL;
+  QUEUE_INIT(&req->work_req.wq);
+
+  uv__req_register(loop, req);
+  iou->in_flight++;
+
+  return sqe;
+}
+
+
+static void uv__iou_submit(uv_loop_t* loop) {
+  struct uv__iou* iou;
+
+  iou = loop->internal_fields;
+  __atomic_store_n(iou->sqtail, *iou->sqtail + 1, __ATOMIC_RELEASE);
+  iou->unsubmitted++;
+  uv__io_start(loop, &iou->ringfd_watcher, POLLIN);
+}
+
+
+int uv__iou_fs_read_or_write(uv_loop_t* loop, uv_fs_t* req, int is_read) {
+  struct uv__io_uring_sqe* sqe;
+  unsigned int iovmax;
+
+  iovmax = uv__getiovmax();
+  if (req->nbufs > iovmax) {
+    if (!is_read)
+      return 0;  /* Let uv__fs_write_all() split it up. */
+    req->nbufs = iovmax;
+  }
+
+  sqe = uv__iou_get_sqe(loop, req);
+  if (sqe == NULL)
+    return 0;
+
+  sqe->addr = (uintptr_t) req->bufs;
+  sqe->fd = req->file;
+  sqe->len = req->nbufs;
+  sqe->off = req->off < 0 ? (uint64_t) -1 : (uint64_t) req->off;
+  sqe->opcode = is_read ? UV__IORING_OP_READV : UV__IORING_OP_WRITEV;
+
+  uv__iou_submit(loop);
+
+  return 1;
+}
+
+
+int uv__iou_fs_fsync_or_fdatasync(uv_loop_t* loop,
+                                  uv_fs_t* req,
+                                  uint32_t fsync_flags) {
+  struct uv__io_uring_sqe* sqe;
+
+  sqe = uv__iou_get_sqe(loop, req);
+  if (sqe == NULL)
+    return 0;
+
+  sqe->fd = req->file;
+  sqe->fsync_flags = fsync_flags;
+  sqe->opcode = UV__IORING_OP_FSYNC;
+
+  uv__iou_submit(loop);
+
+  return 1;
+}
+
+
+int uv__iou_fs_statx(uv_loop_t* loop,
+                     uv_fs_t* req,
+                     int is_fstat,
+                     int is_lstat) {
+  struct uv__io_uring_sqe* sqe;
+  struct uv__statx* statxbuf;
+
+  statxbuf = uv__malloc(sizeof(*statxbuf));
+  if (statxbuf == NULL)
+    return 0;
+
+  sqe = uv__iou_get_sqe(loop, req);
+  if (sqe == NULL) {
+    uv__free(statxbuf);
+    return 0;
+  }
+
+  req->ptr = statxbuf;
+
+  sqe->addr = (uintptr_t) req->path;
+  sqe->addr2 = (uintptr_t) statxbuf;
+  sqe->fd = AT_FDCWD;
+  sqe->len = 0xFFF; /* STATX_BASIC_STATS + STATX_BTIME */
+  sqe->opcode = UV__IORING_OP_STATX;
+
+  if (is_fstat) {
+    sqe->addr = (uintptr_t) "";
+    sqe->fd = req->file;
+    sqe->statx_flags |= 0x1000; /* AT_EMPTY_PATH */
+  }
+
+  if (is_lstat)
+    sqe->statx_flags |= AT_SYMLINK_NOFOLLOW;
+
+  uv__iou_submit(loop);
+
+  return 1;
+}
+
+
+/* Like uv__fs_write_all(), drop the buffers that a short write has written
+ * and submit the rest. Returns 0 when everything has been written.
+ */
+static int uv__iou_fs_write_rest(uv_loop_t* loop, uv_fs_t* req, size_t size) {
+  unsigned int i;
+
+  req->result += size;
+  if (req->off >= 0)
+    req->off += size;
+
+  for (i = 0; i < req->nbufs && req->bufs[i].len <= size; i++)
+    size -= req->bufs[i].len;
+
+  if (i == req->nbufs)
+    return 0;
+
+  /* Keep req->bufs pointing at the start of the allocation, so that it can
+   * be freed.
+   */
+  req->bufs[i].base += size;
+  req->bufs[i].len -= size;
+  req->nbufs -= i;
+  memmove(req->bufs, req->bufs + i, req->nbufs * sizeof(*req->bufs));
+
+  if (!uv__iou_fs_read_or_write(loop, req, /* is_read */ 0))
+    uv__fs_post(loop, req);
+
+  return 1;
+}
+
+
+static void uv__iou_fs_done(uv_loop_t* loop, uv_fs_t* req, int32_t res) {
+  struct uv__statx* statxbuf;
+  ssize_t result;
+
+  uv__req_unregister(loop, req);
+
+  /* Errors are reported as negated errno values, same as UV__ERR(). */
+  result = res;
+
+  switch (req->fs_type) {
+  case UV_FS_WRITE:
+    if (res > 0 && uv__iou_fs_write_rest(loop, req, res))
+      return;
+    /* Report the bytes written before an error, like uv__fs_write_all(). */
+    if (res >= 0 || req->result > 0)
+      result = req->result;
+    /* Fall through. */
+  case UV_FS_READ:
+    if (req->bufs != req->bufsml)
+      uv__free(req->bufs);
+    req->bufs = NULL;
+    req->nbufs = 0;
+    break;
+  case UV_FS_STAT:
+  case UV_FS_LSTAT:
+  case UV_FS_FSTAT:
+    statxbuf = req->ptr;
+    req->ptr = NULL;
+    if (res == 0) {
+      uv__statx_to_stat(statxbuf, &req->statbuf);
+      req->ptr = &req->statbuf;
+    }
+    uv__free(statxbuf);
+    break;
+  default:
+    break;
+  }
+
+  req->result = result;
+  req->cb(req);
+}
+
+
+/* Take back the submissions that the kernel has not consumed and run them on
+ * the thread pool instead.
+ */
+static void uv__iou_fallback(uv_loop_t* loop, struct uv__iou* iou) {
+  struct uv__io_uring_sqe* sqe;
+  struct uv__work* w;
+  uv_fs_t* req;
+  QUEUE queue;
+  QUEUE* q;
+  uint32_t tail;
+
+  /* Empty the ring first: the callbacks of requests that cannot be handed
+   * to the thread pool either may submit new ones.
+   */
+  QUEUE_INIT(&queue);
+  tail = *iou->sqtail;
+
+  while (iou->unsubmitted > 0) {
+    tail--;
+    iou->unsubmitted--;
+    iou->in_flight--;
+    sqe = &iou->sqe[tail & iou->sqmask];
+    req = (uv_fs_t*) (uintptr_t) sqe->user_data;
+    uv__req_unregister(loop, req);
+    QUEUE_INSERT_HEAD(&queue, &req->work_req.wq);
+  }
+
+  __atomic_store_n(iou->sqtail, tail, __ATOMIC_RELEASE);
+
+  if (iou->in_flight == 0)
+    uv__io_stop(loop, &iou->ringfd_watcher, POLLIN);
+
+  while (!QUEUE_EMPTY(&queue)) {
+    q = QUEUE_HEAD(&queue);
+    QUEUE_REMOVE(q);
+    w = QUEUE_DATA(q, struct uv__work, wq);
+    req = container_of(w, uv_fs_t, work_req);
+
+    /* The statx buffer is only used by io_uring. */
+    if (req->fs_type == UV_FS_STAT ||
+        req->fs_type == UV_FS_LSTAT ||
+        req->fs_type == UV_FS_FSTAT) {
+      uv__free(req->ptr);
+      req->ptr = NULL;
+    }
+
+    uv__fs_post(loop, req);
+  }
+}
+
+
+static void uv__iou_io(uv_loop_t* loop, uv__io_t* w, unsigned int events) {
+  struct uv__io_uring_cqe* e;
+  struct uv__iou* iou;
+  uv_fs_t* req;
+  uint32_t head;
+  uint32_t tail;
+  int32_t res;
+
+  iou = container_of(w, struct uv__iou, ringfd_watcher);
+  head = *iou->cqhead;
+  tail = __atomic_load_n(iou->cqtail, __ATOMIC_ACQUIRE);
+
+  while (head != tail) {
+    e = &iou->cqe[head & iou->cqmask];
+    req = (uv_fs_t*) (uintptr_t) e->user_data;
+    res = e->res;
+
+    /* Release the slot before running the callback, it may queue more work. */
+    head++;
+    __atomic_store_n(iou->cqhead, head, __ATOMIC_RELEASE);
+    iou->in_flight--;
+
+    uv__iou_fs_done(loop, req, res);
+  }
+
+  /* Do not keep polling the ring while there is nothing in flight. */
+  if (iou->in_flight == 0)
+    uv__io_stop(loop, &iou->ringfd_watcher, POLLIN);
+}
+
+
 void uv__platform_invalidate_fd(uv_loop_t* loop, int fd) {
   struct epoll_event* events;
   struct epoll_event dummy;
@@ -227,6 +718,10 @@ void uv__io_poll(uv_loop_t* loop, int timeout) {
   int op;
   int i;
 
+  if (loop->internal_fields != NULL)
+    if (uv__iou_flush(loop->internal_fields))
+      uv__iou_fallback(loop, loop->internal_fields);
+
   if (loop->nfds == 0) {
     assert(QUEUE_EMPTY(&loop->watcher_queue));
     return;
@@ -219,6 +219,18 @@
 # endif
 #endif /* __NR_getrandom */
 
+/* io_uring was added after the syscall tables were unified; the numbers are
+ * the same on every architecture except alpha.
+ */
+#if !defined(__alpha__)
+# ifndef __NR_io_uring_setup
+#  define __NR_io_uring_setup 425
+# endif
+# ifndef __NR_io_uring_enter
+#  define __NR_io_uring_enter 426
+# endif
+#endif
+
 int uv__accept4(int fd, struct sockaddr* addr, socklen_t* addrlen, int flags) {
 #if defined(__i386__)
   unsigned long args[4];
@@ -392,3 +404,32 @@ ssize_t uv__getrandom(void* buf, size_t buflen, unsigned flags) {
   return errno = ENOSYS, -1;
 #endif
 }
+
+
+int uv__io_uring_setup(unsigned int entries,
+                       struct uv__io_uring_params* params) {
+#if defined(__NR_io_uring_setup)
+  return syscall(__NR_io_uring_setup, entries, params);
+#else
+  return errno = ENOSYS, -1;
+#endif
+}
+
+
+int uv__io_uring_enter(int fd,
+                       unsigned int to_submit,
+                       unsigned int min_complete,
+                       unsigned int flags) {
+#if defined(__NR_io_uring_enter)
+  /* The last two arguments (sigmask and its size) are always NULL and 0. */
+  return syscall(__NR_io_uring_enter,
+                 fd,
+                 to_submit,
+                 min_complete,
+                 flags,
+                 NULL,
+                 0L);
+#else
+  return errno = ENOSYS, -1;
+#endif
+}
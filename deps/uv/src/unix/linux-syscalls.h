@@ -123,6 +123,82 @@ struct uv__mmsghdr {
   unsigned int msg_len;
 };
 
+#define UV__IORING_FEAT_SINGLE_MMAP   0x01u
+#define UV__IORING_FEAT_NODROP        0x02u
+#define UV__IORING_FEAT_RW_CUR_POS    0x08u
+
+#define UV__IORING_OP_READV           1
+#define UV__IORING_OP_WRITEV          2
+#define UV__IORING_OP_FSYNC           3
+#define UV__IORING_OP_STATX           21
+
+#define UV__IORING_FSYNC_DATASYNC     0x01u
+
+#define UV__IORING_OFF_SQ_RING        0x00000000ull
+#define UV__IORING_OFF_SQES           0x10000000ull
+
+struct uv__io_sqring_offsets {
+  uint32_t head;
+  uint32_t tail;
+  uint32_t ring_mask;
+  uint32_t ring_entries;
+  uint32_t flags;
+  uint32_t dropped;
+  uint32_t array;
+  uint32_t reserved0;
+  uint64_t reserved1;
+};
+
+struct uv__io_cqring_offsets {
+  uint32_t head;
+  uint32_t tail;
+  uint32_t ring_mask;
+  uint32_t ring_entries;
+  uint32_t overflow;
+  uint32_t cqes;
+  uint32_t flags;
+  uint32_t reserved0;
+  uint64_t reserved1;
+};
+
+struct uv__io_uring_params {
+  uint32_t sq_entries;
+  uint32_t cq_entries;
+  uint32_t flags;
+  uint32_t sq_thread_cpu;
+  uint32_t sq_thread_idle;
+  uint32_t features;
+  uint32_t reserved[4];
+  struct uv__io_sqring_offsets sq_off;
+  struct uv__io_cqring_offsets cq_off;
+};
+
+struct uv__io_uring_sqe {
+  uint8_t opcode;
+  uint8_t flags;
+  uint16_t ioprio;
+  int32_t fd;
+  union {
+    uint64_t off;
+    uint64_t addr2;
+  };
+  uint64_t addr;
+  uint32_t len;
+  union {
+    uint32_t rw_flags;
+    uint32_t fsync_flags;
+    uint32_t statx_flags;
+  };
+  uint64_t user_data;
+  uint64_t pad[3];
+};
+
+struct uv__io_uring_cqe {
+  uint64_t user_data;
+  int32_t res;
+  uint32_t flags;
+};
+
 int uv__accept4(int fd, struct sockaddr* addr, socklen_t* addrlen, int flags);
 int uv__eventfd(unsigned int count);
 int uv__eventfd2(unsigned int count, int flags);
@@ -149,5 +225,11 @@ int uv__statx(int dirfd,
               unsigned int mask,
               struct uv__statx* statxbuf);
 ssize_t uv__getrandom(void* buf, size_t buflen, unsigned flags);
+int uv__io_uring_setup(unsigned int entries,
+                       struct uv__io_uring_params* params);
+int uv__io_uring_enter(int fd,
+                       unsigned int to_submit,
+                       unsigned int min_complete,
+                       unsigned int flags);
 
 #endif /* UV_LINUX_SYSCALL_H_ */
@@ -180,11 +180,11 @@ enum uv__work_kind {
   UV__WORK_SLOW_IO
 };
 
-void uv__work_submit(uv_loop_t* loop,
-                     struct uv__work *w,
-                     enum uv__work_kind kind,
-                     void (*work)(struct uv__work *w),
-                     void (*done)(struct uv__work *w, int status));
+int uv__work_submit(uv_loop_t* loop,
+                    struct uv__work *w,
+                    enum uv__work_kind kind,
+                    void (*work)(struct uv__work *w),
+                    void (*done)(struct uv__work *w, int status));
 
 void uv__work_done(uv_async_t* handle);
 
@@ -53,13 +53,18 @@
 #define POST                                                                  \
   do {                                                                        \
     if (cb != NULL) {                                                         \
+      int err;                                                                \
       uv__req_register(loop, req);                                            \
-      uv__work_submit(loop,                                                   \
-                      &req->work_req,                                         \
-                      UV__WORK_FAST_IO,                                       \
-                      uv__fs_work,                                            \
-                      uv__fs_done);                                           \
-      return 0;                                                               \
+      err = uv__work_submit(loop,                                             \
+                            &req->work_req,                                   \
+                            UV__WORK_FAST_IO,                                 \
+                            uv__fs_work,                                      \
+                            uv__fs_done);                                     \
+      if (err != 0) {                                                         \
+        uv__req_unregister(loop, req);                                        \
+        uv_fs_req_cleanup(req);                                               \
+      }                                                                       \
+      return err;                                                             \
     } else {                                                                  \
       uv__fs_work(&req->work_req);                                            \
       return req->result;                                                     \
@@ -376,12 +376,18 @@ int uv_getaddrinfo(uv_loop_t* loop,
   uv__req_register(loop, req);
 
   if (getaddrinfo_cb) {
-    uv__work_submit(loop,
-                    &req->work_req,
-                    UV__WORK_SLOW_IO,
-                    uv__getaddrinfo_work,
-                    uv__getaddrinfo_done);
-    return 0;
+    int r;
+    r = uv__work_submit(loop,
+                        &req->work_req,
+                        UV__WORK_SLOW_IO,
+                        uv__getaddrinfo_work,
+                        uv__getaddrinfo_done);
+    if (r != 0) {
+      uv__req_unregister(loop, req);
+      uv__free(req->alloc);
+      req->alloc = NULL;
+    }
+    return r;
   } else {
     uv__getaddrinfo_work(&req->work_req);
     uv__getaddrinfo_done(&req->work_req, 0);
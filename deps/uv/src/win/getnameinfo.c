@@ -143,12 +143,15 @@ int uv_getnameinfo(uv_loop_t* loop,
   req->retcode = 0;
 
   if (getnameinfo_cb) {
-    uv__work_submit(loop,
-                    &req->work_req,
-                    UV__WORK_SLOW_IO,
-                    uv__getnameinfo_work,
-                    uv__getnameinfo_done);
-    return 0;
+    int err;
+    err = uv__work_submit(loop,
+                          &req->work_req,
+                          UV__WORK_SLOW_IO,
+                          uv__getnameinfo_work,
+                          uv__getnameinfo_done);
+    if (err != 0)
+      uv__req_unregister(loop, req);
+    return err;
   } else {
     uv__getnameinfo_work(&req->work_req);
     uv__getnameinfo_done(&req->work_req, 0);
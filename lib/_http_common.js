@@ -47,6 +47,7 @@ const kOnHeadersComplete = HTTPParser.kOnHeadersComplete | 0;
 const kOnBody = HTTPParser.kOnBody | 0;
 const kOnMessageComplete = HTTPParser.kOnMessageComplete | 0;
 const kOnExecute = HTTPParser.kOnExecute | 0;
+const kOnMessages = HTTPParser.kOnMessages | 0;
 
 const MAX_HEADER_PAIRS = 2000;
 
@@ -96,7 +97,9 @@ function parserOnHeadersComplete(versionMajor, versionMinor, headers, method,
   incoming.url = url;
   incoming.upgrade = upgrade;
 
-  let n = headers.length;
+  // A header block from the parser is a string, see _http_incoming.js. Its
+  // number of entries is only known once it has been split up.
+  let n = typeof headers === 'string' ? Infinity : headers.length;
 
   // If parser.maxHeaderPairs <= 0 assume that there's no limit.
   if (parser.maxHeaderPairs > 0)
@@ -154,6 +157,23 @@ function parserOnMessageComplete() {
   readStart(parser.socket);
 }
 
+// Called with the requests without a body that were parsed in one go, as a
+// flat list of [versionMajor, versionMinor, headers, method, url,
+// shouldKeepAlive] entries. This list needs to be kept in sync with
+// `Parser::BatchMessage()` in src/node_http_parser.cc.
+function parserOnMessages(messages) {
+  for (let i = 0; i < messages.length; i += 6) {
+    // Stop if a listener for an earlier request freed the parser.
+    if (this.socket === null)
+      return;
+    parserOnHeadersComplete.call(this, messages[i], messages[i + 1],
+                                 messages[i + 2], messages[i + 3],
+                                 messages[i + 4], undefined, undefined,
+                                 false, messages[i + 5]);
+    parserOnMessageComplete.call(this);
+  }
+}
+
 
 const parsers = new FreeList('parsers', 1000, function parsersCb() {
   const parser = new HTTPParser();
@@ -165,6 +185,7 @@ const parsers = new FreeList('parsers', 1000, function parsersCb() {
   parser[kOnHeadersComplete] = parserOnHeadersComplete;
   parser[kOnBody] = parserOnBody;
   parser[kOnMessageComplete] = parserOnMessageComplete;
+  parser[kOnMessages] = parserOnMessages;
 
   return parser;
 });
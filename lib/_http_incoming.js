@@ -22,12 +22,24 @@
 'use strict';
 
 const {
+  MathMin,
   ObjectDefineProperty,
   ObjectSetPrototypeOf,
+  StringPrototypeCharCodeAt,
+  StringPrototypeIndexOf,
+  StringPrototypeSlice,
+  StringPrototypeSplit,
+  Symbol,
 } = primordials;
 
 const Stream = require('stream');
 
+const kHeaders = Symbol('kHeaders');
+const kHeadersCount = Symbol('kHeadersCount');
+const kRawHeaders = Symbol('kRawHeaders');
+const kTrailers = Symbol('kTrailers');
+const kTrailersCount = Symbol('kTrailersCount');
+
 function readStart(socket) {
   if (socket && !socket._paused && socket.readable)
     socket.resume();
@@ -58,9 +70,14 @@ function IncomingMessage(socket) {
   this.httpVersionMinor = null;
   this.httpVersion = null;
   this.complete = false;
-  this.headers = {};
-  this.rawHeaders = [];
-  this.trailers = {};
+  // `headers` and `trailers` are only built from `rawHeaders` and
+  // `rawTrailers` when they are first accessed. The parser passes the raw
+  // headers as one string, which is only split up into `rawHeaders` then.
+  this[kHeaders] = null;
+  this[kHeadersCount] = 0;
+  this[kRawHeaders] = [];
+  this[kTrailers] = null;
+  this[kTrailersCount] = 0;
   this.rawTrailers = [];
 
   this.aborted = false;
@@ -93,6 +110,53 @@ ObjectDefineProperty(IncomingMessage.prototype, 'connection', {
   }
 });
 
+ObjectDefineProperty(IncomingMessage.prototype, 'rawHeaders', {
+  get: function() {
+    // A header block from the parser, with names and values joined by '\n'.
+    if (typeof this[kRawHeaders] === 'string')
+      this[kRawHeaders] = StringPrototypeSplit(this[kRawHeaders], '\n');
+    return this[kRawHeaders];
+  },
+  set: function(val) {
+    this[kRawHeaders] = val;
+  }
+});
+
+ObjectDefineProperty(IncomingMessage.prototype, 'headers', {
+  get: function() {
+    if (!this[kHeaders]) {
+      this[kHeaders] = {};
+      const src = this.rawHeaders;
+      const dst = this[kHeaders];
+      const count = MathMin(this[kHeadersCount], src.length);
+      for (let n = 0; n < count; n += 2) {
+        this._addHeaderLine(src[n], src[n + 1], dst);
+      }
+    }
+    return this[kHeaders];
+  },
+  set: function(val) {
+    this[kHeaders] = val;
+  }
+});
+
+ObjectDefineProperty(IncomingMessage.prototype, 'trailers', {
+  get: function() {
+    if (!this[kTrailers]) {
+      this[kTrailers] = {};
+      const src = this.rawTrailers;
+      const dst = this[kTrailers];
+      for (let n = 0; n < this[kTrailersCount]; n += 2) {
+        this._addHeaderLine(src[n], src[n + 1], dst);
+      }
+    }
+    return this[kTrailers];
+  },
+  set: function(val) {
+    this[kTrailers] = val;
+  }
+});
+
 IncomingMessage.prototype.setTimeout = function setTimeout(msecs, callback) {
   if (callback)
     this.on('timeout', callback);
@@ -130,16 +194,85 @@ function _addHeaderLines(headers, n) {
     let dest;
     if (this.complete) {
       this.rawTrailers = headers;
-      dest = this.trailers;
+      this[kTrailersCount] = n;
+      dest = this[kTrailers];
     } else {
-      this.rawHeaders = headers;
-      dest = this.headers;
+      // `headers` can be a header block from the parser, in which case `n`
+      // is only an upper bound.
+      this[kRawHeaders] = headers;
+      this[kHeadersCount] = n;
+      dest = this[kHeaders];
+      if (dest && typeof headers === 'string') {
+        headers = this.rawHeaders;
+        n = MathMin(n, headers.length);
+      }
     }
 
-    for (let i = 0; i < n; i += 2) {
-      this._addHeaderLine(headers[i], headers[i + 1], dest);
+    // Only add to `headers` or `trailers` if they were built already.
+    if (dest) {
+      for (let i = 0; i < n; i += 2) {
+        this._addHeaderLine(headers[i], headers[i + 1], dest);
+      }
+    }
+  }
+}
+
+
+// Returns whether the header name at `start` in `str`, which is as long as
+// the lowercase `name`, matches it case-insensitively.
+function headerNameMatches(str, start, name) {
+  for (let i = 0; i < name.length; i++) {
+    let c = StringPrototypeCharCodeAt(str, start + i);
+    if (c >= 65 && c <= 90)  // 'A' to 'Z'
+      c += 32;
+    if (c !== StringPrototypeCharCodeAt(name, i))
+      return false;
+  }
+  return true;
+}
+
+function joinHeaderValue(value, next) {
+  return value === undefined ? next : `${value}, ${next}`;
+}
+
+// Returns what `message.headers[name]` is for a lowercase `name` whose
+// repeated values are joined with ', ', without building `message.headers`
+// if it does not exist yet.
+function getJoinedHeader(message, name) {
+  if (message[kHeaders])
+    return message[kHeaders][name];
+  const raw = message[kRawHeaders];
+  const count = message[kHeadersCount];
+  let value;
+  if (typeof raw === 'string') {
+    // Walk a header block from the parser without splitting it up.
+    let start = 0;
+    for (let n = 0; n < count; n += 2) {
+      const nameEnd = StringPrototypeIndexOf(raw, '\n', start);
+      if (nameEnd === -1)
+        break;
+      let valueEnd = StringPrototypeIndexOf(raw, '\n', nameEnd + 1);
+      if (valueEnd === -1)
+        valueEnd = raw.length;
+      if (nameEnd - start === name.length &&
+          headerNameMatches(raw, start, name)) {
+        value = joinHeaderValue(value,
+                                StringPrototypeSlice(raw, nameEnd + 1,
+                                                     valueEnd));
+      }
+      start = valueEnd + 1;
+    }
+    return value;
+  }
+  const end = MathMin(count, raw.length);
+  for (let i = 0; i < end; i += 2) {
+    const field = raw[i];
+    if (field.length === name.length &&
+        (field === name || headerNameMatches(field, 0, name))) {
+      value = joinHeaderValue(value, raw[i + 1]);
     }
   }
+  return value;
 }
 
 
@@ -299,6 +432,7 @@ IncomingMessage.prototype._dump = function _dump() {
 
 module.exports = {
   IncomingMessage,
+  getJoinedHeader,
   readStart,
   readStop
 };
@@ -61,6 +61,7 @@ const {
   hideStackFrames
 } = require('internal/errors');
 const { validateString } = require('internal/validators');
+const { serializeHeaders } = internalBinding('http_parser');
 
 const HIGH_WATER_MARK = getDefaultHighWaterMark();
 const { CRLF, debug } = common;
@@ -361,7 +362,8 @@ function _storeHeader(firstLine, headers) {
     date: false,
     expect: false,
     trailer: false,
-    header: firstLine
+    // Header names and values, joined with `firstLine` at the end.
+    fields: []
   };
 
   if (headers) {
@@ -383,11 +385,11 @@ function _storeHeader(firstLine, headers) {
     }
   }
 
-  let { header } = state;
+  const { fields } = state;
 
   // Date header
   if (this.sendDate && !state.date) {
-    header += 'Date: ' + utcDate() + CRLF;
+    fields.push('Date', utcDate());
   }
 
   // Force the connection to close when the response is a 204 No Content or
@@ -417,10 +419,10 @@ function _storeHeader(firstLine, headers) {
     const shouldSendKeepAlive = this.shouldKeepAlive &&
         (state.contLen || this.useChunkedEncodingByDefault || this.agent);
     if (shouldSendKeepAlive) {
-      header += 'Connection: keep-alive\r\n';
+      fields.push('Connection', 'keep-alive');
     } else {
       this._last = true;
-      header += 'Connection: close\r\n';
+      fields.push('Connection', 'close');
     }
   }
 
@@ -433,9 +435,9 @@ function _storeHeader(firstLine, headers) {
     } else if (!state.trailer &&
                !this._removedContLen &&
                typeof this._contentLength === 'number') {
-      header += 'Content-Length: ' + this._contentLength + CRLF;
+      fields.push('Content-Length', '' + this._contentLength);
     } else if (!this._removedTE) {
-      header += 'Transfer-Encoding: chunked\r\n';
+      fields.push('Transfer-Encoding', 'chunked');
       this.chunkedEncoding = true;
     } else {
       // We should only be able to get here if both Content-Length and
@@ -453,7 +455,14 @@ function _storeHeader(firstLine, headers) {
     throw new ERR_HTTP_TRAILER_INVALID();
   }
 
-  this._header = header + CRLF;
+  this._header = serializeHeaders(firstLine, fields);
+  if (this._header === undefined) {
+    // Not Latin-1, which serializeHeaders() leaves to us.
+    let header = firstLine;
+    for (let i = 0; i < fields.length; i += 2)
+      header += fields[i] + ': ' + fields[i + 1] + CRLF;
+    this._header = header + CRLF;
+  }
   this._headerSent = false;
 
   // Wait until the first body chunk, or close(), is sent to flush,
@@ -480,7 +489,7 @@ function processHeader(self, state, key, value, validate) {
 function storeHeader(self, state, key, value, validate) {
   if (validate)
     validateHeaderValue(key, value);
-  state.header += key + ': ' + value + CRLF;
+  state.fields.push(key, '' + value);
   matchHeader(self, state, key, value);
 }
 
@@ -56,7 +56,7 @@ const {
   defaultTriggerAsyncIdScope,
   getOrSetAsyncId
 } = require('internal/async_hooks');
-const { IncomingMessage } = require('_http_incoming');
+const { IncomingMessage, getJoinedHeader } = require('_http_incoming');
 const {
   ERR_HTTP_HEADERS_SENT,
   ERR_HTTP_INVALID_STATUS_CODE,
@@ -160,7 +160,8 @@ function ServerResponse(req) {
   this._expect_continue = false;
 
   if (req.httpVersionMajor < 1 || req.httpVersionMinor < 1) {
-    this.useChunkedEncodingByDefault = chunkExpression.test(req.headers.te);
+    this.useChunkedEncodingByDefault =
+      chunkExpression.test(getJoinedHeader(req, 'te'));
     this.shouldKeepAlive = false;
   }
 
@@ -426,6 +427,7 @@ function connectionListenerInternal(server, socket) {
     server.maxHeaderSize || 0,
     server.insecureHTTPParser === undefined ?
       isLenient() : server.insecureHTTPParser,
+    true,  // Pass headers as one string, see _http_incoming.js.
   );
   parser.socket = socket;
 
@@ -768,9 +770,11 @@ function parserOnIncoming(server, socket, state, req, keepAlive) {
   res.on('finish',
          resOnFinish.bind(undefined, req, res, socket, state, server));
 
-  if (req.headers.expect !== undefined &&
+  // Do not build `req.headers` here, the 'request' listener may never need it.
+  const expect = getJoinedHeader(req, 'expect');
+  if (expect !== undefined &&
       (req.httpVersionMajor === 1 && req.httpVersionMinor === 1)) {
-    if (continueExpression.test(req.headers.expect)) {
+    if (continueExpression.test(expect)) {
       res._expect_continue = true;
 
       if (server.listenerCount('checkContinue') > 0) {
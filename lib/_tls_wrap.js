@@ -37,7 +37,7 @@ const {
 
 assertCrypto();
 
-const { setImmediate } = require('timers');
+const { clearImmediate, setImmediate } = require('timers');
 const assert = require('internal/assert');
 const crypto = require('crypto');
 const EE = require('events');
@@ -53,6 +53,10 @@ const { Pipe, constants: PipeConstants } = internalBinding('pipe_wrap');
 const { owner_symbol } = require('internal/async_hooks').symbols;
 const { isArrayBufferView } = require('internal/util/types');
 const { SecureContext: NativeSecureContext } = internalBinding('crypto');
+const {
+  kOCSPResponseMissing,
+  kOCSPResponseStale
+} = NativeSecureContext;
 const { connResetException, codes } = require('internal/errors');
 const {
   ERR_INVALID_ARG_TYPE,
@@ -70,22 +74,33 @@ const {
 } = codes;
 const { onpskexchange: kOnPskExchange } = internalBinding('symbols');
 const { getOptionValue } = require('internal/options');
+const { initSharedSessionCache } = require('internal/tls');
 const { validateString, validateBuffer } = require('internal/validators');
 const traceTls = getOptionValue('--trace-tls');
 const tlsKeylog = getOptionValue('--tls-keylog');
 const { appendFile } = require('fs');
+const kCoalesceImmediate = Symbol('coalesce-immediate');
 const kConnectOptions = Symbol('connect-options');
 const kDisableRenegotiation = Symbol('disable-renegotiation');
 const kErrorEmitted = Symbol('error-emitted');
 const kHandshakeTimeout = Symbol('handshake-timeout');
 const kRes = Symbol('res');
+const kSharedSessionCache = Symbol('shared-session-cache');
+const kOffloadHandshake = Symbol('offload-handshake');
+const kOCSPCache = Symbol('ocsp-cache');
+const kOCSPRefreshing = Symbol('ocsp-refreshing');
 const kSNICallback = Symbol('snicallback');
 const kEnableTrace = Symbol('enableTrace');
 const kPskCallback = Symbol('pskcallback');
 const kPskIdentityHint = Symbol('pskidentityhint');
+const kCoalesceWrites = Symbol('coalesce-writes');
 
 const noop = () => {};
 
+// Cleartext held back by TLSSocket#setCoalesceWrites() is flushed once it
+// fills four maximum-sized TLS records.
+const kMaxCoalescedLength = 4 * 16384;
+
 let ipServernameWarned = false;
 let tlsTracingWarned = false;
 
@@ -227,6 +242,18 @@ function requestOCSP(socket, info) {
     return requestOCSPDone(socket);
   }
 
+  // A cached response is stapled in C++. Once it is stale, it is refreshed
+  // in the background while it is still being stapled.
+  const cache = socket.server[kOCSPCache];
+  if (cache) {
+    const state = ctx.getOCSPResponseState();
+    if (state !== kOCSPResponseMissing) {
+      if (state === kOCSPResponseStale)
+        refreshOCSPResponse(socket.server, ctx);
+      return requestOCSPDone(socket);
+    }
+  }
+
   let once = false;
   const onOCSP = (err, response) => {
     debug('server OCSPRequest done', 'handle?', !!socket._handle, 'once?', once,
@@ -241,8 +268,11 @@ function requestOCSP(socket, info) {
     if (socket._handle === null)
       return socket.destroy(new ERR_SOCKET_CLOSED());
 
-    if (response)
+    if (response) {
       socket._handle.setOCSPResponse(response);
+      if (cache)
+        ctx.setOCSPResponse(response);
+    }
     requestOCSPDone(socket);
   };
 
@@ -253,6 +283,29 @@ function requestOCSP(socket, info) {
                      onOCSP);
 }
 
+function refreshOCSPResponse(server, ctx) {
+  if (ctx[kOCSPRefreshing])
+    return;
+  ctx[kOCSPRefreshing] = true;
+
+  // There is no connection to fail if the refresh does, so the stale
+  // response is kept until it expires. After that, handshakes wait for the
+  // 'OCSPRequest' listeners again, and see their errors.
+  let once = false;
+  debug('server emit OCSPRequest to refresh cached response');
+  server.emit('OCSPRequest',
+              ctx.getCertificate(),
+              ctx.getIssuer(),
+              (err, response) => {
+                if (once)
+                  return;
+                once = true;
+                ctx[kOCSPRefreshing] = false;
+                if (!err && response)
+                  ctx.setOCSPResponse(response);
+              });
+}
+
 function requestOCSPDone(socket) {
   debug('server certcb done');
   try {
@@ -465,6 +518,8 @@ function TLSSocket(socket, opts) {
   this.authorized = false;
   this.authorizationError = null;
   this[kRes] = null;
+  this[kCoalesceWrites] = false;
+  this[kCoalesceImmediate] = null;
 
   let wrap;
   if ((socket instanceof net.Socket && socket._handle) || !socket) {
@@ -516,6 +571,39 @@ ObjectSetPrototypeOf(TLSSocket.prototype, net.Socket.prototype);
 ObjectSetPrototypeOf(TLSSocket, net.Socket);
 exports.TLSSocket = TLSSocket;
 
+// While write coalescing is enabled, the cleartext written during an event
+// loop iteration is held back and passed to the TLSWrap as a single writev().
+// It is encrypted with one SSL_write() into full-sized records, and sent
+// with one write to the underlying stream.
+TLSSocket.prototype.setCoalesceWrites = function(coalesce) {
+  this[kCoalesceWrites] = coalesce === undefined ? true : !!coalesce;
+  if (!this[kCoalesceWrites] && this[kCoalesceImmediate] !== null) {
+    clearImmediate(this[kCoalesceImmediate]);
+    uncorkCoalescedWrites(this);
+  }
+  return this;
+};
+
+TLSSocket.prototype.write = function(chunk, encoding, cb) {
+  if (this[kCoalesceWrites] && this[kCoalesceImmediate] === null) {
+    this.cork();
+    this[kCoalesceImmediate] = setImmediate(uncorkCoalescedWrites, this);
+  }
+  const ret = net.Socket.prototype.write.call(this, chunk, encoding, cb);
+  // Do not hold back more than a few records' worth of data.
+  if (this[kCoalesceImmediate] !== null &&
+      this.writableLength >= kMaxCoalescedLength) {
+    clearImmediate(this[kCoalesceImmediate]);
+    uncorkCoalescedWrites(this);
+  }
+  return ret;
+};
+
+function uncorkCoalescedWrites(socket) {
+  socket[kCoalesceImmediate] = null;
+  socket.uncork();
+}
+
 const proxiedMethods = [
   'ref', 'unref', 'open', 'bind', 'listen', 'connect', 'bind6',
   'connect6', 'getsockname', 'getpeername', 'setNoDelay', 'setKeepAlive',
@@ -755,6 +843,15 @@ TLSSocket.prototype._init = function(socket, wrap) {
     ssl.enableCertCb();
   }
 
+  // Without an SNI callback, the certificate callback is only needed for
+  // OCSP requests, which can then be answered from the context's cache.
+  if (options.isServer &&
+      this.server &&
+      this.server[kOCSPCache] &&
+      !this._SNICallback) {
+    ssl.enableOCSPCache();
+  }
+
   if (options.ALPNProtocols) {
     // Keep reference in secureContext not to be GC-ed
     ssl._secureContext.alpnBuffer = options.ALPNProtocols;
@@ -786,6 +883,15 @@ TLSSocket.prototype._init = function(socket, wrap) {
     }
   }
 
+  // The PSK callback runs during the handshake, so handshakes that use it
+  // can't be offloaded.
+  if (options.isServer &&
+      this.server &&
+      this.server[kOffloadHandshake] &&
+      !options.pskCallback) {
+    ssl.enableHandshakeOffload();
+  }
+
 
   if (options.handshakeTimeout > 0)
     this.setTimeout(options.handshakeTimeout, this._handleTimeout);
@@ -1156,6 +1262,27 @@ function Server(options, listener) {
   if (options.ALPNProtocols)
     tls.convertALPNProtocols(options.ALPNProtocols, this);
 
+  this[kSharedSessionCache] = options.sharedSessionCache;
+  if (this[kSharedSessionCache] !== undefined &&
+      typeof this[kSharedSessionCache] !== 'boolean') {
+    throw new ERR_INVALID_ARG_TYPE(
+      'options.sharedSessionCache', 'boolean', options.sharedSessionCache);
+  }
+
+  this[kOffloadHandshake] = options.offloadHandshake;
+  if (this[kOffloadHandshake] !== undefined &&
+      typeof this[kOffloadHandshake] !== 'boolean') {
+    throw new ERR_INVALID_ARG_TYPE(
+      'options.offloadHandshake', 'boolean', options.offloadHandshake);
+  }
+
+  this[kOCSPCache] = options.ocspCache;
+  if (this[kOCSPCache] !== undefined &&
+      typeof this[kOCSPCache] !== 'boolean') {
+    throw new ERR_INVALID_ARG_TYPE(
+      'options.ocspCache', 'boolean', options.ocspCache);
+  }
+
   this.setSecureContext(options);
 
   this[kHandshakeTimeout] = options.handshakeTimeout || (120 * 1000);
@@ -1311,10 +1438,22 @@ Server.prototype.setSecureContext = function(options) {
     crl: this.crl,
     sessionIdContext: this.sessionIdContext
   });
+  // Servers that cache OCSP responses also build their certificate chains
+  // once, instead of on every handshake.
+  if (this[kOCSPCache])
+    this._sharedCreds.context.buildCertChain();
 
   if (this.sessionTimeout)
     this._sharedCreds.context.setSessionTimeout(this.sessionTimeout);
 
+  if (this[kSharedSessionCache]) {
+    initSharedSessionCache();
+    this._sharedCreds.context.enableSharedSessionCache();
+  }
+
+  if (this[kOffloadHandshake])
+    this._sharedCreds.context.enableKeyOffload();
+
   if (options.ticketKeys) {
     this.ticketKeys = options.ticketKeys;
     this.setTicketKeys(this.ticketKeys);
@@ -1395,7 +1534,10 @@ Server.prototype.addContext = function(servername, context) {
                       servername.replace(/([.^$+?\-\\[\]{}])/g, '\\$1')
                                 .replace(/\*/g, '[^.]*') +
                       '$');
-  this._contexts.push([re, tls.createSecureContext(context).context]);
+  const ctx = tls.createSecureContext(context).context;
+  if (this[kOCSPCache])
+    ctx.buildCertChain();
+  this._contexts.push([re, ctx]);
 };
 
 Server.prototype[EE.captureRejectionSymbol] = function(
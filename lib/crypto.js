@@ -85,13 +85,15 @@ const {
 } = require('internal/crypto/cipher');
 const {
   Sign,
+  signBatch,
   signOneShot,
   Verify,
   verifyOneShot
 } = require('internal/crypto/sig');
 const {
   Hash,
-  Hmac
+  Hmac,
+  hashBatch
 } = require('internal/crypto/hash');
 const {
   getCiphers,
@@ -169,6 +171,7 @@ module.exports = {
   getCurves,
   getDiffieHellman: createDiffieHellmanGroup,
   getHashes,
+  hashBatch,
   pbkdf2,
   pbkdf2Sync,
   generateKeyPair,
@@ -183,6 +186,7 @@ module.exports = {
   scrypt,
   scryptSync,
   sign: signOneShot,
+  signBatch,
   setEngine,
   timingSafeEqual,
   getFips: !fipsMode ? getFipsDisabled :
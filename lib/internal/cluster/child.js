@@ -32,6 +32,15 @@ cluster._setupWorker = function() {
 
   cluster.worker = worker;
 
+  // The master passes the shared TLS session cache on as an extra stdio
+  // entry. Set it up now, so that TLS servers with `sharedSessionCache`
+  // use it rather than creating a cache of their own.
+  const sessionCacheFd = process.env.NODE_TLS_SESSION_CACHE_FD;
+  if (sessionCacheFd !== undefined) {
+    delete process.env.NODE_TLS_SESSION_CACHE_FD;
+    internalBinding('crypto').initSharedSessionCache(+sessionCacheFd, 0);
+  }
+
   process.once('disconnect', () => {
     worker.emit('disconnect');
 
@@ -1,6 +1,7 @@
 'use strict';
 
 const {
+  ArrayIsArray,
   Map,
   ObjectKeys,
   ObjectValues,
@@ -20,6 +21,8 @@ const intercom = new EventEmitter();
 const SCHED_NONE = 1;
 const SCHED_RR = 2;
 const { isLegalPort } = require('internal/net');
+const { initSharedSessionCache } = require('internal/tls');
+const { validateUint32 } = require('internal/validators');
 const [ minPort, maxPort ] = [ 1024, 65535 ];
 
 module.exports = cluster;
@@ -131,6 +134,21 @@ function createWorkerProcess(id, env) {
     execArgv.push(`--inspect-port=${inspectPort}`);
   }
 
+  let stdio = cluster.settings.stdio;
+  const { tlsSessionCacheSize } = cluster.settings;
+  if (tlsSessionCacheSize !== undefined) {
+    validateUint32(tlsSessionCacheSize, 'tlsSessionCacheSize', true);
+    // The worker picks up the cache from the extra stdio entry, see
+    // cluster._setupWorker().
+    if (!ArrayIsArray(stdio)) {
+      const mode = typeof stdio === 'string' ? stdio :
+        cluster.settings.silent ? 'pipe' : 'inherit';
+      stdio = [mode, mode, mode, 'ipc'];
+    }
+    stdio = [...stdio, initSharedSessionCache(tlsSessionCacheSize)];
+    workerEnv.NODE_TLS_SESSION_CACHE_FD = `${stdio.length - 1}`;
+  }
+
   return fork(cluster.settings.exec, cluster.settings.args, {
     cwd: cluster.settings.cwd,
     env: workerEnv,
@@ -138,7 +156,7 @@ function createWorkerProcess(id, env) {
     silent: cluster.settings.silent,
     windowsHide: cluster.settings.windowsHide,
     execArgv: execArgv,
-    stdio: cluster.settings.stdio,
+    stdio,
     gid: cluster.settings.gid,
     uid: cluster.settings.uid
   });
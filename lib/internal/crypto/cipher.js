@@ -4,6 +4,7 @@ const {
   ObjectSetPrototypeOf,
 } = primordials;
 
+const { Providers } = internalBinding('async_wrap');
 const {
   RSA_PKCS1_OAEP_PADDING,
   RSA_PKCS1_PADDING
@@ -22,9 +23,13 @@ const {
   prepareSecretKey
 } = require('internal/crypto/keys');
 const {
+  checkNoPendingUpdate,
   getDefaultEncoding,
+  getOffloadOption,
   kHandle,
-  getArrayBufferView
+  kOffload,
+  getArrayBufferView,
+  offloadUpdate
 } = require('internal/crypto/util');
 
 const { isArrayBufferView } = require('internal/util/types');
@@ -95,6 +100,7 @@ function getUIntOption(options, key) {
 
 function createCipherBase(cipher, credential, options, decipher, iv) {
   const authTagLength = getUIntOption(options, 'authTagLength');
+  const offload = getOffloadOption(options);
 
   this[kHandle] = new CipherBase(decipher);
   if (iv === undefined) {
@@ -103,6 +109,7 @@ function createCipherBase(cipher, credential, options, decipher, iv) {
     this[kHandle].initiv(cipher, credential, iv, authTagLength);
   }
   this._decoder = null;
+  this[kOffload] = offload;
 
   LazyTransform.call(this, options);
 }
@@ -132,6 +139,15 @@ ObjectSetPrototypeOf(Cipher.prototype, LazyTransform.prototype);
 ObjectSetPrototypeOf(Cipher, LazyTransform);
 
 Cipher.prototype._transform = function _transform(chunk, encoding, callback) {
+  if (this[kOffload]) {
+    offloadUpdate(this, Providers.CIPHERREQUEST, chunk, encoding,
+                  (ok, out) => {
+                    if (!ok)
+                      return callback(new ERR_CRYPTO_INVALID_STATE('update'));
+                    callback(null, out);
+                  });
+    return;
+  }
   this.push(this[kHandle].update(chunk, encoding));
   callback();
 };
@@ -157,6 +173,7 @@ Cipher.prototype.update = function update(data, inputEncoding, outputEncoding) {
   }
 
   validateEncoding(data, inputEncoding);
+  checkNoPendingUpdate(this, 'update');
 
   const ret = this[kHandle].update(data, inputEncoding);
 
@@ -171,6 +188,7 @@ Cipher.prototype.update = function update(data, inputEncoding, outputEncoding) {
 
 Cipher.prototype.final = function final(outputEncoding) {
   outputEncoding = outputEncoding || getDefaultEncoding();
+  checkNoPendingUpdate(this, 'final');
   const ret = this[kHandle].final();
 
   if (outputEncoding && outputEncoding !== 'buffer') {
@@ -183,6 +201,7 @@ Cipher.prototype.final = function final(outputEncoding) {
 
 
 Cipher.prototype.setAutoPadding = function setAutoPadding(ap) {
+  checkNoPendingUpdate(this, 'setAutoPadding');
   if (!this[kHandle].setAutoPadding(!!ap))
     throw new ERR_CRYPTO_INVALID_STATE('setAutoPadding');
   return this;
@@ -215,6 +234,7 @@ Cipher.prototype.setAAD = function setAAD(aadbuf, options) {
   }
 
   const plaintextLength = getUIntOption(options, 'plaintextLength');
+  checkNoPendingUpdate(this, 'setAAD');
   if (!this[kHandle].setAAD(aadbuf, plaintextLength))
     throw new ERR_CRYPTO_INVALID_STATE('setAAD');
   return this;
@@ -1,18 +1,26 @@
 'use strict';
 
 const {
+  Array,
+  MathMin,
   ObjectSetPrototypeOf,
   Symbol,
 } = primordials;
 
+const { AsyncWrap, Providers } = internalBinding('async_wrap');
 const {
   Hash: _Hash,
-  Hmac: _Hmac
+  Hmac: _Hmac,
+  hashBatch: _hashBatch
 } = internalBinding('crypto');
 
 const {
+  checkNoPendingUpdate,
   getDefaultEncoding,
+  getOffloadOption,
   kHandle,
+  kOffload,
+  offloadUpdate,
   toBuf
 } = require('internal/crypto/util');
 
@@ -25,15 +33,26 @@ const { Buffer } = require('buffer');
 const {
   ERR_CRYPTO_HASH_FINALIZED,
   ERR_CRYPTO_HASH_UPDATE_FAILED,
-  ERR_INVALID_ARG_TYPE
+  ERR_CRYPTO_INVALID_DIGEST,
+  ERR_INVALID_ARG_TYPE,
+  ERR_INVALID_CALLBACK,
+  ERR_INVALID_OPT_VALUE
 } = require('internal/errors').codes;
-const { validateEncoding, validateString, validateUint32 } =
-  require('internal/validators');
+const {
+  validateArray,
+  validateEncoding,
+  validateObject,
+  validateString,
+  validateUint32
+} = require('internal/validators');
 const { isArrayBufferView } = require('internal/util/types');
 const LazyTransform = require('internal/streams/lazy_transform');
 const kState = Symbol('kState');
 const kFinalized = Symbol('kFinalized');
 
+// The number of buffers that one threadpool request of hashBatch() hashes.
+const kHashBatchRequestSize = 1024;
+
 function Hash(algorithm, options) {
   if (!(this instanceof Hash))
     return new Hash(algorithm, options);
@@ -43,6 +62,7 @@ function Hash(algorithm, options) {
     options.outputLength : undefined;
   if (xofLen !== undefined)
     validateUint32(xofLen, 'options.outputLength');
+  this[kOffload] = getOffloadOption(options);
   this[kHandle] = new _Hash(algorithm, xofLen);
   this[kState] = {
     [kFinalized]: false
@@ -57,11 +77,18 @@ Hash.prototype.copy = function copy(options) {
   const state = this[kState];
   if (state[kFinalized])
     throw new ERR_CRYPTO_HASH_FINALIZED();
+  checkNoPendingUpdate(this, 'copy');
 
   return new Hash(this[kHandle], options);
 };
 
 Hash.prototype._transform = function _transform(chunk, encoding, callback) {
+  if (this[kOffload]) {
+    offloadUpdate(this, Providers.HASHREQUEST, chunk, encoding, (ok) => {
+      callback(ok ? null : new ERR_CRYPTO_HASH_UPDATE_FAILED());
+    });
+    return;
+  }
   this[kHandle].update(chunk, encoding);
   callback();
 };
@@ -88,6 +115,7 @@ Hash.prototype.update = function update(data, encoding) {
   }
 
   validateEncoding(data, encoding);
+  checkNoPendingUpdate(this, 'update');
 
   if (!this[kHandle].update(data, encoding))
     throw new ERR_CRYPTO_HASH_UPDATE_FAILED();
@@ -100,6 +128,7 @@ Hash.prototype.digest = function digest(outputEncoding) {
   if (state[kFinalized])
     throw new ERR_CRYPTO_HASH_FINALIZED();
   outputEncoding = outputEncoding || getDefaultEncoding();
+  checkNoPendingUpdate(this, 'digest');
 
   // Explicit conversion for backward compatibility.
   const ret = this[kHandle].digest(`${outputEncoding}`);
@@ -111,10 +140,16 @@ Hash.prototype.digest = function digest(outputEncoding) {
 function Hmac(hmac, key, options) {
   if (!(this instanceof Hmac))
     return new Hmac(hmac, key, options);
-  validateString(hmac, 'hmac');
-  key = prepareSecretKey(key);
-  this[kHandle] = new _Hmac();
-  this[kHandle].init(hmac, toBuf(key));
+  if (hmac instanceof _Hmac) {
+    this[kOffload] = getOffloadOption(options);
+    this[kHandle] = new _Hmac(hmac);
+  } else {
+    validateString(hmac, 'hmac');
+    key = prepareSecretKey(key);
+    this[kOffload] = getOffloadOption(options);
+    this[kHandle] = new _Hmac();
+    this[kHandle].init(hmac, toBuf(key));
+  }
   this[kState] = {
     [kFinalized]: false
   };
@@ -124,6 +159,15 @@ function Hmac(hmac, key, options) {
 ObjectSetPrototypeOf(Hmac.prototype, LazyTransform.prototype);
 ObjectSetPrototypeOf(Hmac, LazyTransform);
 
+Hmac.prototype.copy = function copy(options) {
+  const state = this[kState];
+  if (state[kFinalized])
+    throw new ERR_CRYPTO_HASH_FINALIZED();
+  checkNoPendingUpdate(this, 'copy');
+
+  return new Hmac(this[kHandle], undefined, options);
+};
+
 Hmac.prototype.update = Hash.prototype.update;
 
 Hmac.prototype.digest = function digest(outputEncoding) {
@@ -135,6 +179,7 @@ Hmac.prototype.digest = function digest(outputEncoding) {
     return outputEncoding === 'buffer' ? buf : buf.toString(outputEncoding);
   }
 
+  checkNoPendingUpdate(this, 'digest');
   // Explicit conversion for backward compatibility.
   const ret = this[kHandle].digest(`${outputEncoding}`);
   state[kFinalized] = true;
@@ -144,7 +189,101 @@ Hmac.prototype.digest = function digest(outputEncoding) {
 Hmac.prototype._flush = Hash.prototype._flush;
 Hmac.prototype._transform = Hash.prototype._transform;
 
+function hashBatch(algorithm, buffers, options, callback) {
+  if (typeof options === 'function') {
+    callback = options;
+    options = undefined;
+  }
+
+  validateString(algorithm, 'algorithm');
+  validateArray(buffers, 'buffers');
+  let outputEncoding = 'buffer';
+  if (options !== undefined) {
+    validateObject(options, 'options');
+    if (options.outputEncoding !== undefined) {
+      outputEncoding = options.outputEncoding;
+      if (outputEncoding !== 'buffer' && !Buffer.isEncoding(outputEncoding)) {
+        throw new ERR_INVALID_OPT_VALUE('options.outputEncoding',
+                                        outputEncoding);
+      }
+    }
+  }
+  if (callback !== undefined && typeof callback !== 'function')
+    throw new ERR_INVALID_CALLBACK(callback);
+
+  buffers = toBuffers(buffers);
+  const digests = new Array(buffers.length);
+
+  if (callback === undefined || buffers.length === 0) {
+    const out = _hashBatch(algorithm, buffers, 0, buffers.length);
+    if (out === -1)
+      throw new ERR_CRYPTO_INVALID_DIGEST(algorithm);
+    splitDigests(out, digests, 0, buffers.length, outputEncoding);
+    if (callback === undefined)
+      return digests;
+    process.nextTick(callback, null, digests);
+    return;
+  }
+
+  // Large batches are split into several requests, so that they can be
+  // hashed by several threads.
+  let pending = 0;
+  let failed = false;
+  for (let start = 0; start < buffers.length; start += kHashBatchRequestSize) {
+    const end = MathMin(start + kHashBatchRequestSize, buffers.length);
+    const wrap = new AsyncWrap(Providers.HASHBATCHREQUEST);
+    wrap.buffers = buffers;  // Keep reference alive.
+    wrap.ondone = (err, out) => {
+      if (failed)
+        return;
+      if (err) {
+        failed = true;
+        return callback.call(wrap, err);
+      }
+      splitDigests(out, digests, start, end, outputEncoding);
+      if (--pending === 0)
+        callback.call(wrap, null, digests);
+    };
+    if (_hashBatch(algorithm, buffers, start, end, wrap) === -1)
+      throw new ERR_CRYPTO_INVALID_DIGEST(algorithm);
+    pending++;
+  }
+}
+
+// Returns a new array that holds every element of `buffers` as an
+// ArrayBufferView. Each element is read only once, so the native side never
+// sees values that were not validated here.
+function toBuffers(buffers) {
+  const result = new Array(buffers.length);
+  for (let i = 0; i < result.length; i++) {
+    const buffer = buffers[i];
+    if (isArrayBufferView(buffer)) {
+      result[i] = buffer;
+    } else if (typeof buffer === 'string') {
+      result[i] = Buffer.from(buffer, 'utf8');
+    } else {
+      throw new ERR_INVALID_ARG_TYPE(`buffers[${i}]`,
+                                     ['string',
+                                      'Buffer',
+                                      'TypedArray',
+                                      'DataView'],
+                                     buffer);
+    }
+  }
+  return result;
+}
+
+function splitDigests(out, digests, start, end, outputEncoding) {
+  const size = out.length / (end - start);
+  for (let i = start, offset = 0; i < end; i++, offset += size) {
+    digests[i] = outputEncoding === 'buffer' ?
+      out.slice(offset, offset + size) :
+      out.toString(outputEncoding, offset, offset + size);
+  }
+}
+
 module.exports = {
   Hash,
-  Hmac
+  Hmac,
+  hashBatch
 };
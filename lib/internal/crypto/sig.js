@@ -1,21 +1,27 @@
 'use strict';
 
 const {
+  Array,
+  MathMin,
   ObjectSetPrototypeOf,
 } = primordials;
 
 const {
   ERR_CRYPTO_SIGN_KEY_REQUIRED,
   ERR_INVALID_ARG_TYPE,
+  ERR_INVALID_CALLBACK,
   ERR_INVALID_OPT_VALUE
 } = require('internal/errors').codes;
-const { validateString } = require('internal/validators');
+const { validateArray, validateString } = require('internal/validators');
+const { AsyncWrap, Providers } = internalBinding('async_wrap');
 const {
   Sign: _Sign,
   Verify: _Verify,
   kSigEncDER,
   kSigEncP1363,
+  signBatch: _signBatch,
   signOneShot: _signOneShot,
+  verifyAsync: _verifyAsync,
   verifyOneShot: _verifyOneShot
 } = internalBinding('crypto');
 const {
@@ -30,6 +36,9 @@ const {
 const { Writable } = require('stream');
 const { isArrayBufferView } = require('internal/util/types');
 
+// The number of messages that one threadpool request of signBatch() signs.
+const kSignBatchRequestSize = 64;
+
 function Sign(algorithm, options) {
   if (!(this instanceof Sign))
     return new Sign(algorithm, options);
@@ -112,7 +121,7 @@ Sign.prototype.sign = function sign(options, encoding) {
   return ret;
 };
 
-function signOneShot(algorithm, data, key) {
+function signOneShot(algorithm, data, key, callback) {
   if (algorithm != null)
     validateString(algorithm, 'algorithm');
 
@@ -127,6 +136,9 @@ function signOneShot(algorithm, data, key) {
   if (!key)
     throw new ERR_CRYPTO_SIGN_KEY_REQUIRED();
 
+  if (callback !== undefined && typeof callback !== 'function')
+    throw new ERR_INVALID_CALLBACK(callback);
+
   const {
     data: keyData,
     format: keyFormat,
@@ -141,8 +153,94 @@ function signOneShot(algorithm, data, key) {
   // Options specific to (EC)DSA
   const dsaSigEnc = getDSASignatureEncoding(key);
 
-  return _signOneShot(keyData, keyFormat, keyType, keyPassphrase, data,
-                      algorithm, rsaPadding, pssSaltLength, dsaSigEnc);
+  if (callback === undefined) {
+    return _signOneShot(keyData, keyFormat, keyType, keyPassphrase, data,
+                        algorithm, rsaPadding, pssSaltLength, dsaSigEnc);
+  }
+
+  const messages = [data];
+  const wrap = new AsyncWrap(Providers.SIGNREQUEST);
+  wrap.messages = messages;  // Keep reference alive.
+  wrap.ondone = (err, signatures) => {
+    if (err)
+      return callback.call(wrap, err);
+    callback.call(wrap, null, signatures[0]);
+  };
+  _signBatch(keyData, keyFormat, keyType, keyPassphrase, messages, algorithm,
+             rsaPadding, pssSaltLength, dsaSigEnc, wrap);
+}
+
+function signBatch(algorithm, messages, key, callback) {
+  if (algorithm != null)
+    validateString(algorithm, 'algorithm');
+
+  validateArray(messages, 'messages');
+  for (let i = 0; i < messages.length; i++) {
+    if (!isArrayBufferView(messages[i])) {
+      throw new ERR_INVALID_ARG_TYPE(
+        `messages[${i}]`,
+        ['Buffer', 'TypedArray', 'DataView'],
+        messages[i]
+      );
+    }
+  }
+
+  if (!key)
+    throw new ERR_CRYPTO_SIGN_KEY_REQUIRED();
+
+  if (callback !== undefined && typeof callback !== 'function')
+    throw new ERR_INVALID_CALLBACK(callback);
+
+  const {
+    data: keyData,
+    format: keyFormat,
+    type: keyType,
+    passphrase: keyPassphrase
+  } = preparePrivateKey(key);
+
+  // Options specific to RSA
+  const rsaPadding = getPadding(key);
+  const pssSaltLength = getSaltLength(key);
+
+  // Options specific to (EC)DSA
+  const dsaSigEnc = getDSASignatureEncoding(key);
+
+  if (callback === undefined || messages.length === 0) {
+    const signatures =
+      _signBatch(keyData, keyFormat, keyType, keyPassphrase, messages,
+                 algorithm, rsaPadding, pssSaltLength, dsaSigEnc);
+    if (callback === undefined)
+      return signatures;
+    process.nextTick(callback, null, signatures);
+    return;
+  }
+
+  // Large batches are split into several requests, so that they can be
+  // signed by several threads.
+  const signatures = new Array(messages.length);
+  let pending = 0;
+  let failed = false;
+  for (let start = 0; start < messages.length; start += kSignBatchRequestSize) {
+    const end = MathMin(start + kSignBatchRequestSize, messages.length);
+    const chunk = messages.slice(start, end);
+    const wrap = new AsyncWrap(Providers.SIGNREQUEST);
+    wrap.messages = chunk;  // Keep reference alive.
+    wrap.ondone = (err, result) => {
+      if (failed)
+        return;
+      if (err) {
+        failed = true;
+        return callback.call(wrap, err);
+      }
+      for (let i = 0; i < result.length; i++)
+        signatures[start + i] = result[i];
+      if (--pending === 0)
+        callback.call(wrap, null, signatures);
+    };
+    _signBatch(keyData, keyFormat, keyType, keyPassphrase, chunk, algorithm,
+               rsaPadding, pssSaltLength, dsaSigEnc, wrap);
+    pending++;
+  }
 }
 
 function Verify(algorithm, options) {
@@ -184,7 +282,7 @@ Verify.prototype.verify = function verify(options, signature, sigEncoding) {
                               rsaPadding, pssSaltLength, dsaSigEnc);
 };
 
-function verifyOneShot(algorithm, data, key, signature) {
+function verifyOneShot(algorithm, data, key, signature, callback) {
   if (algorithm != null)
     validateString(algorithm, 'algorithm');
 
@@ -218,12 +316,30 @@ function verifyOneShot(algorithm, data, key, signature) {
     );
   }
 
-  return _verifyOneShot(keyData, keyFormat, keyType, keyPassphrase, signature,
-                        data, algorithm, rsaPadding, pssSaltLength, dsaSigEnc);
+  if (callback === undefined) {
+    return _verifyOneShot(keyData, keyFormat, keyType, keyPassphrase,
+                          signature, data, algorithm, rsaPadding,
+                          pssSaltLength, dsaSigEnc);
+  }
+
+  if (typeof callback !== 'function')
+    throw new ERR_INVALID_CALLBACK(callback);
+
+  const wrap = new AsyncWrap(Providers.VERIFYREQUEST);
+  wrap.data = data;  // Keep references alive.
+  wrap.signature = signature;
+  wrap.ondone = (err, result) => {
+    if (err)
+      return callback.call(wrap, err);
+    callback.call(wrap, null, result);
+  };
+  _verifyAsync(keyData, keyFormat, keyType, keyPassphrase, signature, data,
+               algorithm, rsaPadding, pssSaltLength, dsaSigEnc, wrap);
 }
 
 module.exports = {
   Sign,
+  signBatch,
   signOneShot,
   Verify,
   verifyOneShot
@@ -4,6 +4,7 @@ const {
   Symbol,
 } = primordials;
 
+const { AsyncWrap } = internalBinding('async_wrap');
 const {
   getCiphers: _getCiphers,
   getCurves: _getCurves,
@@ -20,6 +21,7 @@ const {
   hideStackFrames,
   codes: {
     ERR_CRYPTO_ENGINE_UNKNOWN,
+    ERR_CRYPTO_INVALID_STATE,
     ERR_CRYPTO_TIMING_SAFE_EQUAL_LENGTH,
     ERR_INVALID_ARG_TYPE,
   }
@@ -35,6 +37,8 @@ const {
 } = require('internal/util/types');
 
 const kHandle = Symbol('kHandle');
+const kOffload = Symbol('kOffload');
+const kUpdatePending = Symbol('kUpdatePending');
 
 var defaultEncoding = 'buffer';
 
@@ -107,13 +111,46 @@ const getArrayBufferView = hideStackFrames((buffer, name, encoding) => {
   return buffer;
 });
 
+// Returns the `offload` option of a cipher, hash or HMAC object.
+function getOffloadOption(options) {
+  const offload = options != null ? options.offload : undefined;
+  if (offload !== undefined && typeof offload !== 'boolean')
+    throw new ERR_INVALID_ARG_TYPE('options.offload', 'boolean', offload);
+  return offload === true;
+}
+
+// Runs the update of a cipher, hash or HMAC object with a chunk of its
+// stream on the threadpool. The stream passes on the next chunk only once
+// `callback` has been called, so the chunks are processed in order.
+function offloadUpdate(self, provider, chunk, encoding, callback) {
+  if (typeof chunk === 'string')
+    chunk = Buffer.from(chunk, encoding);
+  const wrap = new AsyncWrap(provider);
+  wrap.chunk = chunk;  // Keep reference alive.
+  wrap.ondone = (ok, out) => {
+    self[kUpdatePending] = false;
+    callback(ok, out);
+  };
+  self[kHandle].updateAsync(chunk, wrap);
+  self[kUpdatePending] = true;
+}
+
+function checkNoPendingUpdate(self, operation) {
+  if (self[kUpdatePending])
+    throw new ERR_CRYPTO_INVALID_STATE(operation);
+}
+
 module.exports = {
+  checkNoPendingUpdate,
   getArrayBufferView,
   getCiphers,
   getCurves,
   getDefaultEncoding,
   getHashes,
+  getOffloadOption,
   kHandle,
+  kOffload,
+  offloadUpdate,
   setDefaultEncoding,
   setEngine,
   timingSafeEqual,
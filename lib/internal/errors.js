@@ -1329,6 +1329,8 @@ E('ERR_TLS_RENEGOTIATION_DISABLED',
 E('ERR_TLS_REQUIRED_SERVER_NAME',
   '"servername" is required parameter for Server.addContext', Error);
 E('ERR_TLS_SESSION_ATTACK', 'TLS session renegotiation attack detected', Error);
+E('ERR_TLS_SHARED_SESSION_CACHE_FAILED',
+  'Failed to set up the shared TLS session cache', Error);
 E('ERR_TLS_SNI_FROM_SERVER',
   'Cannot issue SNI from a TLS server-side socket', Error);
 E('ERR_TRACE_EVENTS_CATEGORY_REQUIRED',
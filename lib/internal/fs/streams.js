@@ -11,10 +11,13 @@ const {
 } = primordials;
 
 const {
-  ERR_INVALID_ARG_TYPE,
-  ERR_OUT_OF_RANGE,
-  ERR_STREAM_DESTROYED
-} = require('internal/errors').codes;
+  codes: {
+    ERR_INVALID_ARG_TYPE,
+    ERR_OUT_OF_RANGE,
+    ERR_STREAM_DESTROYED
+  },
+  errnoException
+} = require('internal/errors');
 const internalUtil = require('internal/util');
 const { validateNumber } = require('internal/validators');
 const fs = require('fs');
@@ -25,8 +28,18 @@ const {
 } = require('internal/fs/utils');
 const { Readable, Writable } = require('stream');
 const { toPathIfFileURL } = require('internal/url');
+const { FileHandle } = internalBinding('fs');
+const { StreamPipe } = internalBinding('stream_pipe');
+const { TCP } = internalBinding('tcp_wrap');
+const { UV_ECANCELED } = internalBinding('uv');
+const { kSendFileQueue } = require('internal/stream_base_commons');
 const kIoDone = Symbol('kIoDone');
 const kIsPerformingIO = Symbol('kIsPerformingIO');
+const kSendFile = Symbol('kSendFile');
+// Number of bytes sent with sendfile(), for tests.
+const kSendFileBytes = Symbol('kSendFileBytes');
+
+const isWindows = process.platform === 'win32';
 
 const kMinPoolSpace = 128;
 const kFs = Symbol('kFs');
@@ -109,6 +122,7 @@ function ReadStream(path, options) {
   this.bytesRead = 0;
   this.closed = false;
   this[kIsPerformingIO] = false;
+  this[kSendFileBytes] = 0;
 
   if (this.start !== undefined) {
     checkPosition(this.start, 'start');
@@ -172,6 +186,10 @@ function _openReadFs(stream) {
 }
 
 ReadStream.prototype._read = function(n) {
+  // The file is being sent to a socket with sendfile(), see pipe() below.
+  if (this[kSendFile] !== undefined)
+    return;
+
   if (typeof this.fd !== 'number') {
     return this.once('open', function() {
       this._read(n);
@@ -250,6 +268,9 @@ ReadStream.prototype._read = function(n) {
 };
 
 ReadStream.prototype._destroy = function(err, cb) {
+  if (this[kSendFile] !== undefined && this[kSendFile].pipe !== null)
+    this[kSendFile].pipe.unpipe();
+
   if (typeof this.fd !== 'number') {
     this.once('open', closeFsStream.bind(null, this, cb, err));
     return;
@@ -276,6 +297,185 @@ ReadStream.prototype.close = function(cb) {
   this.destroy(null, cb);
 };
 
+// A file that is piped, as a whole, into a plaintext TCP socket is sent with
+// sendfile(2) by a native StreamPipe, without passing through JS. Anything
+// that needs to observe the data, such as 'data' listeners, other pipe
+// destinations or an encoding, makes it fall back to Readable#pipe().
+function canSendFile(stream, dest) {
+  if (isWindows || stream[kFs] !== fs || stream.destroyed ||
+      stream[kIsPerformingIO] || stream.bytesRead !== 0 ||
+      stream.listenerCount('data') > 0) {
+    return false;
+  }
+  const state = stream._readableState;
+  if (state.flowing !== null || state.length !== 0 || state.ended ||
+      state.decoder !== null || state.pipes.length !== 0) {
+    return false;
+  }
+  return canSendFileTo(dest);
+}
+
+// sendfile() writes to the socket's fd directly, so nothing may be queued
+// on the socket ahead of it.
+function canSendFileTo(dest) {
+  return dest !== null && typeof dest === 'object' &&
+         dest._handle instanceof TCP && !dest.connecting &&
+         !dest.destroyed && !dest.writableEnded && dest.writableLength === 0;
+}
+
+ReadStream.prototype.pipe = function(dest, options) {
+  // A file descriptor passed in by the user is read from its current
+  // position unless `start` is given, and sendfile() would not advance it.
+  if (this[kSendFile] !== undefined || !canSendFile(this, dest) ||
+      (typeof this.fd === 'number' && this.pos === undefined)) {
+    return Readable.prototype.pipe.call(this, dest, options);
+  }
+
+  // Reserve the stream for sendfile() until the file has been opened.
+  const sendfile = {
+    dest,
+    options,
+    pipe: null,
+    started: false,
+    paused: false,
+    unpiped: false
+  };
+  this[kSendFile] = sendfile;
+  if (typeof this.fd === 'number') {
+    startSendFile(this, sendfile);
+  } else {
+    this.once('open', () => {
+      if (this[kSendFile] !== sendfile || sendfile.paused)
+        return;
+      if (canSendFile(this, dest)) {
+        startSendFile(this, sendfile);
+      } else {
+        this[kSendFile] = undefined;
+        Readable.prototype.pipe.call(this, dest, options);
+      }
+    });
+  }
+  return dest;
+};
+
+// unpipe() and pause() stop the transfer once the chunk that is currently
+// being sent is done; resume() continues it from there.
+ReadStream.prototype.unpipe = function(dest) {
+  const sendfile = this[kSendFile];
+  if (sendfile === undefined || (dest && dest !== sendfile.dest))
+    return Readable.prototype.unpipe.call(this, dest);
+
+  this._readableState.flowing = false;
+  if (sendfile.pipe !== null) {
+    sendfile.unpiped = true;
+    sendfile.pipe.unpipe();
+  } else {
+    this[kSendFile] = undefined;
+    if (sendfile.started)
+      sendfile.dest.emit('unpipe', this);
+  }
+  return this;
+};
+
+ReadStream.prototype.pause = function() {
+  const sendfile = this[kSendFile];
+  if (sendfile !== undefined && !sendfile.paused) {
+    sendfile.paused = true;
+    if (sendfile.pipe !== null)
+      sendfile.pipe.unpipe();
+  }
+  return Readable.prototype.pause.call(this);
+};
+
+ReadStream.prototype.resume = function() {
+  const sendfile = this[kSendFile];
+  if (sendfile !== undefined && sendfile.paused) {
+    sendfile.paused = false;
+    // Otherwise, the transfer is started once the file has been opened, or
+    // continues once the current chunk is done.
+    if (sendfile.pipe === null && typeof this.fd === 'number')
+      continueSendFile(this, sendfile);
+  }
+  return Readable.prototype.resume.call(this);
+};
+
+function continueSendFile(stream, sendfile) {
+  const { dest, options } = sendfile;
+  if (canSendFileTo(dest))
+    return startSendFile(stream, sendfile);
+
+  // Data was written to the socket in the meantime.
+  stream[kSendFile] = undefined;
+  Readable.prototype.pipe.call(stream, dest, options);
+}
+
+function startSendFile(stream, sendfile) {
+  const { dest, options } = sendfile;
+  const start = stream.pos === undefined ? 0 : stream.pos;
+  const length = stream.end === Infinity ? -1 : stream.end - start + 1;
+  const handle = new FileHandle(stream.fd, start, length);
+  const pipe = new StreamPipe(handle, dest._handle);
+
+  let destClosed = false;
+  const onDestClose = () => {
+    destClosed = true;
+    pipe.unpipe();
+  };
+  dest.once('close', onDestClose);
+
+  pipe.onunpipe = (status, bytes) => {
+    dest.removeListener('close', onDestClose);
+    handle.releaseFD();
+    sendfile.pipe = null;
+    stream[kIsPerformingIO] = false;
+    stream[kSendFileBytes] += bytes;
+    stream.bytesRead += bytes;
+    stream.pos = start + bytes;
+
+    // Let writes that were made in the meantime through.
+    const queue = dest[kSendFileQueue];
+    dest[kSendFileQueue] = undefined;
+    for (const fn of queue)
+      fn();
+
+    if (stream.destroyed)
+      return stream.emit(kIoDone);
+
+    if (status === UV_ECANCELED && !destClosed) {
+      if (sendfile.unpiped) {
+        stream[kSendFile] = undefined;
+        dest.emit('unpipe', stream);
+      } else if (!sendfile.paused) {
+        continueSendFile(stream, sendfile);
+      }
+      return;
+    }
+
+    if (status < 0) {
+      // Errors from either side surface on the socket, as they most likely
+      // come from the peer going away.
+      if (!dest.destroyed)
+        dest.destroy(errnoException(status, 'sendfile'));
+      stream.destroy();
+      return;
+    }
+
+    stream.push(null);
+    stream.read(0);
+    if (options === undefined || options.end !== false)
+      dest.end();
+  };
+
+  sendfile.pipe = pipe;
+  stream[kIsPerformingIO] = true;
+  dest[kSendFileQueue] = [];
+  if (!sendfile.started) {
+    sendfile.started = true;
+    dest.emit('pipe', stream);
+  }
+  pipe.start();
+}
+
 ObjectDefineProperty(ReadStream.prototype, 'pending', {
   get() { return this.fd === null; },
   configurable: true
@@ -503,5 +703,6 @@ ObjectDefineProperty(WriteStream.prototype, 'pending', {
 
 module.exports = {
   ReadStream,
-  WriteStream
+  WriteStream,
+  kSendFileBytes
 };
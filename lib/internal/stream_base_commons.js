@@ -36,6 +36,8 @@ const kUpdateTimer = Symbol('kUpdateTimer');
 const kAfterAsyncWrite = Symbol('kAfterAsyncWrite');
 const kHandle = Symbol('kHandle');
 const kSession = Symbol('kSession');
+// Writes to a socket that a file is being sent to with sendfile() wait here.
+const kSendFileQueue = Symbol('kSendFileQueue');
 
 const debug = require('internal/util/debuglog').debuglog('stream');
 const kBuffer = Symbol('kBuffer');
@@ -263,6 +265,7 @@ module.exports = {
   kUpdateTimer,
   kHandle,
   kSession,
+  kSendFileQueue,
   setStreamTimeout,
   kBuffer,
   kBufferCb,
@@ -5,6 +5,13 @@ const {
   ObjectCreate,
 } = primordials;
 
+const {
+  ERR_FEATURE_UNAVAILABLE_ON_PLATFORM,
+  ERR_TLS_SHARED_SESSION_CACHE_FAILED,
+} = require('internal/errors').codes;
+
+const kDefaultSharedSessionCacheSize = 1024;
+
 // Example:
 // C=US\nST=CA\nL=SF\nO=Joyent\nOU=Node.js\nCN=ca1\nemailAddress=ry@clouds.org
 function parseCertString(s) {
@@ -27,6 +34,20 @@ function parseCertString(s) {
   return out;
 }
 
+// Returns the file descriptor of the TLS session cache that the servers of
+// this process share with each other and with the other processes of a
+// cluster. The cache is set up with room for `size` sessions if it does not
+// exist yet.
+function initSharedSessionCache(size = kDefaultSharedSessionCacheSize) {
+  if (process.platform === 'win32')
+    throw new ERR_FEATURE_UNAVAILABLE_ON_PLATFORM('sharedSessionCache');
+  const fd = internalBinding('crypto').initSharedSessionCache(-1, size);
+  if (fd === undefined)
+    throw new ERR_TLS_SHARED_SESSION_CACHE_FAILED();
+  return fd;
+}
+
 module.exports = {
+  initSharedSessionCache,
   parseCertString
 };
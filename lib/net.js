@@ -77,6 +77,7 @@ const {
   kAfterAsyncWrite,
   kHandle,
   kUpdateTimer,
+  kSendFileQueue,
   setStreamTimeout,
   kBuffer,
   kBufferCb,
@@ -404,6 +405,13 @@ Socket.prototype._final = function(cb) {
     return this.once('connect', () => this._final(cb));
   }
 
+  // A file is being sent to this socket with sendfile(), see
+  // lib/internal/fs/streams.js. Shut down once it is done.
+  if (this[kSendFileQueue] !== undefined) {
+    this[kSendFileQueue].push(() => this._final(cb));
+    return;
+  }
+
   if (!this._handle)
     return cb();
 
@@ -512,6 +520,19 @@ Socket.prototype.setKeepAlive = function(setting, msecs) {
 };
 
 
+Socket.prototype.setCoalesceWrites = function(coalesce) {
+  if (!this._handle) {
+    this.once('connect', () => this.setCoalesceWrites(coalesce));
+    return this;
+  }
+
+  if (this._handle.setCoalesceWrites)
+    this._handle.setCoalesceWrites(coalesce === undefined ? true : !!coalesce);
+
+  return this;
+};
+
+
 Socket.prototype.address = function() {
   return this._getsockname();
 };
@@ -771,6 +792,14 @@ Socket.prototype._writeGeneric = function(writev, data, encoding, cb) {
   this._pendingData = null;
   this._pendingEncoding = '';
 
+  // Like above, buffer this while a file is being sent with sendfile().
+  if (this[kSendFileQueue] !== undefined) {
+    this[kSendFileQueue].push(() => {
+      this._writeGeneric(writev, data, encoding, cb);
+    });
+    return;
+  }
+
   if (!this._handle) {
     cb(new ERR_SOCKET_CLOSED());
     return false;
@@ -3,6 +3,7 @@
 const {
   ArrayIsArray,
   Boolean,
+  Float64Array,
   Map,
   NumberIsSafeInteger,
   ObjectDefineProperties,
@@ -14,6 +15,7 @@ const {
 
 const {
   ELDHistogram: _ELDHistogram,
+  ThreadPoolHistogram: _ThreadPoolHistogram,
   PerformanceEntry,
   mark: _mark,
   clearMark: _clearMark,
@@ -26,7 +28,10 @@ const {
   timerify,
   constants,
   installGarbageCollectionTracking,
-  removeGarbageCollectionTracking
+  removeGarbageCollectionTracking,
+  getThreadPoolUsage,
+  threadPoolWorkTypes,
+  threadPoolMonitorTypes
 } = internalBinding('performance');
 
 const {
@@ -43,7 +48,20 @@ const {
   NODE_PERFORMANCE_MILESTONE_LOOP_START,
   NODE_PERFORMANCE_MILESTONE_LOOP_EXIT,
   NODE_PERFORMANCE_MILESTONE_BOOTSTRAP_COMPLETE,
-  NODE_PERFORMANCE_MILESTONE_ENVIRONMENT
+  NODE_PERFORMANCE_MILESTONE_ENVIRONMENT,
+
+  kThreadPoolUsageLimit,
+  kThreadPoolUsageQueueLimit,
+  kThreadPoolUsageRunning,
+  kThreadPoolUsageQueued,
+  kThreadPoolUsageCompleted,
+  kThreadPoolUsageWaitTime,
+  kThreadPoolUsageFieldCount,
+
+  kThreadPoolHistogramWait,
+  kThreadPoolHistogramRun,
+  kThreadPoolHistogramLatency,
+  kThreadPoolHistogramPhaseCount
 } = constants;
 
 const { AsyncResource } = require('async_hooks');
@@ -72,6 +90,7 @@ const kTimerified = Symbol('timerified');
 const kInsertEntry = Symbol('insert-entry');
 const kGetEntries = Symbol('get-entries');
 const kIndex = Symbol('index');
+const kHistogramIndex = Symbol('histogram-index');
 const kMarks = Symbol('marks');
 const kCount = Symbol('count');
 
@@ -557,6 +576,16 @@ function sortedInsert(list, entry) {
   list.splice(location, 0, entry);
 }
 
+function validatePercentile(percentile) {
+  if (typeof percentile !== 'number') {
+    throw new ERR_INVALID_ARG_TYPE('percentile', 'number', percentile);
+  }
+  if (percentile <= 0 || percentile > 100) {
+    throw new ERR_INVALID_ARG_VALUE.RangeError('percentile',
+                                               percentile);
+  }
+}
+
 class ELDHistogram {
   constructor(handle) {
     this[kHandle] = handle;
@@ -573,13 +602,7 @@ class ELDHistogram {
   get mean() { return this[kHandle].mean(); }
   get stddev() { return this[kHandle].stddev(); }
   percentile(percentile) {
-    if (typeof percentile !== 'number') {
-      throw new ERR_INVALID_ARG_TYPE('percentile', 'number', percentile);
-    }
-    if (percentile <= 0 || percentile > 100) {
-      throw new ERR_INVALID_ARG_VALUE.RangeError('percentile',
-                                                 percentile);
-    }
+    validatePercentile(percentile);
     return this[kHandle].percentile(percentile);
   }
   get percentiles() {
@@ -615,10 +638,98 @@ function monitorEventLoopDelay(options = {}) {
   return new ELDHistogram(new _ELDHistogram(resolution));
 }
 
+// A view on one of the histograms owned by a native ThreadPoolHistogram.
+class ThreadpoolHistogram {
+  constructor(handle, index) {
+    this[kHandle] = handle;
+    this[kHistogramIndex] = index;
+    this[kMap] = new Map();
+  }
+
+  get count() { return this[kHandle].count(this[kHistogramIndex]); }
+  get min() { return this[kHandle].min(this[kHistogramIndex]); }
+  get max() { return this[kHandle].max(this[kHistogramIndex]); }
+  get mean() { return this[kHandle].mean(this[kHistogramIndex]); }
+  get stddev() { return this[kHandle].stddev(this[kHistogramIndex]); }
+  percentile(percentile) {
+    validatePercentile(percentile);
+    return this[kHandle].percentile(this[kHistogramIndex], percentile);
+  }
+  get percentiles() {
+    this[kMap].clear();
+    this[kHandle].percentiles(this[kHistogramIndex], this[kMap]);
+    return this[kMap];
+  }
+
+  [kInspect]() {
+    return {
+      count: this.count,
+      min: this.min,
+      max: this.max,
+      mean: this.mean,
+      stddev: this.stddev,
+      percentiles: this.percentiles
+    };
+  }
+}
+
+class ThreadpoolMonitor {
+  constructor(handle) {
+    this[kHandle] = handle;
+    for (let i = 0; i < threadPoolMonitorTypes.length; i++) {
+      const offset = i * kThreadPoolHistogramPhaseCount;
+      this[threadPoolMonitorTypes[i]] = {
+        wait: new ThreadpoolHistogram(handle,
+                                      offset + kThreadPoolHistogramWait),
+        run: new ThreadpoolHistogram(handle, offset + kThreadPoolHistogramRun),
+        latency: new ThreadpoolHistogram(handle,
+                                         offset + kThreadPoolHistogramLatency)
+      };
+    }
+  }
+
+  reset() { this[kHandle].reset(); }
+  enable() { return this[kHandle].enable(); }
+  disable() { return this[kHandle].disable(); }
+}
+
+function monitorThreadpool() {
+  return new ThreadpoolMonitor(new _ThreadPoolHistogram());
+}
+
+let threadPoolUsageFields;
+
+function threadpoolUsage() {
+  if (threadPoolUsageFields === undefined) {
+    threadPoolUsageFields =
+      new Float64Array(threadPoolWorkTypes.length * kThreadPoolUsageFieldCount);
+  }
+  getThreadPoolUsage(threadPoolUsageFields);
+
+  const usage = {};
+  for (let i = 0; i < threadPoolWorkTypes.length; i++) {
+    const offset = i * kThreadPoolUsageFieldCount;
+    const limit = threadPoolUsageFields[offset + kThreadPoolUsageLimit];
+    const queueLimit =
+      threadPoolUsageFields[offset + kThreadPoolUsageQueueLimit];
+    usage[threadPoolWorkTypes[i]] = {
+      limit: limit === 0 ? Infinity : limit,
+      queueLimit: queueLimit === 0 ? Infinity : queueLimit,
+      running: threadPoolUsageFields[offset + kThreadPoolUsageRunning],
+      queued: threadPoolUsageFields[offset + kThreadPoolUsageQueued],
+      completed: threadPoolUsageFields[offset + kThreadPoolUsageCompleted],
+      waitTime: threadPoolUsageFields[offset + kThreadPoolUsageWaitTime] / 1e6
+    };
+  }
+  return usage;
+}
+
 module.exports = {
   performance,
   PerformanceObserver,
-  monitorEventLoopDelay
+  monitorEventLoopDelay,
+  monitorThreadpool,
+  threadpoolUsage
 };
 
 ObjectDefineProperty(module.exports, 'constants', {
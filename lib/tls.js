@@ -40,7 +40,11 @@ const { isArrayBufferView } = require('internal/util/types');
 const net = require('net');
 const { getOptionValue } = require('internal/options');
 const url = require('url');
-const { getRootCertificates, getSSLCiphers } = internalBinding('crypto');
+const {
+  getRootCertificates,
+  getSSLCiphers,
+  getSharedSessionCacheStats,
+} = internalBinding('crypto');
 const { Buffer } = require('buffer');
 const EventEmitter = require('events');
 const { URL } = require('internal/url');
@@ -100,6 +104,14 @@ ObjectDefineProperty(exports, 'rootCertificates', {
   },
 });
 
+exports.getSharedSessionCacheStats = function() {
+  const stats = getSharedSessionCacheStats();
+  if (stats === undefined)
+    return undefined;
+  const [handshakes, resumed, lookups, hits, stores, evictions] = stats;
+  return { handshakes, resumed, lookups, hits, stores, evictions };
+};
+
 // Convert protocols array into valid OpenSSL protocols list
 // ("\x06spdy/2\x08http/1.1\x08http/1.0")
 function convertProtocols(protocols) {
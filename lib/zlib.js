@@ -21,9 +21,12 @@
 
 'use strict';
 
+/* global SharedArrayBuffer */
+
 const {
   Error,
   MathMax,
+  MathMin,
   NumberIsFinite,
   NumberIsNaN,
   ObjectDefineProperties,
@@ -32,6 +35,7 @@ const {
   ObjectGetPrototypeOf,
   ObjectKeys,
   ObjectSetPrototypeOf,
+  SafeMap,
   Symbol,
 } = primordials;
 
@@ -51,8 +55,10 @@ const {
 } = require('internal/util');
 const {
   isArrayBufferView,
-  isAnyArrayBuffer
+  isAnyArrayBuffer,
+  isSharedArrayBuffer
 } = require('internal/util/types');
+const { validateInteger } = require('internal/validators');
 const binding = internalBinding('zlib');
 const assert = require('internal/assert');
 const {
@@ -62,6 +68,12 @@ const {
 const { owner_symbol } = require('internal/async_hooks').symbols;
 
 const kFlushFlag = Symbol('kFlushFlag');
+const kParallel = Symbol('kParallel');
+const kParallelBlock = Symbol('kParallelBlock');
+const kUseHandlePool = Symbol('kUseHandlePool');
+const kDictionaryBuffer = Symbol('kDictionaryBuffer');
+const kHandlePoolKey = Symbol('kHandlePoolKey');
+const kWriteState = Symbol('kWriteState');
 
 const constants = internalBinding('constants').zlib;
 const {
@@ -71,6 +83,7 @@ const {
   Z_MIN_CHUNK, Z_MIN_WINDOWBITS, Z_MAX_WINDOWBITS, Z_MIN_LEVEL, Z_MAX_LEVEL,
   Z_MIN_MEMLEVEL, Z_MAX_MEMLEVEL, Z_DEFAULT_CHUNK, Z_DEFAULT_COMPRESSION,
   Z_DEFAULT_STRATEGY, Z_DEFAULT_WINDOWBITS, Z_DEFAULT_MEMLEVEL, Z_FIXED,
+  Z_HUFFMAN_ONLY,
   // Node's compression stream modes (node_zlib_mode)
   DEFLATE, DEFLATERAW, INFLATE, INFLATERAW, GZIP, GUNZIP, UNZIP,
   BROTLI_DECODE, BROTLI_ENCODE,
@@ -173,8 +186,8 @@ function zlibOnError(message, errno, code) {
   const self = this[owner_symbol];
   // There is no way to cleanly recover.
   // Continuing only obscures problems.
-  _close(self);
   self._hadError = true;
+  _close(self);
 
   // eslint-disable-next-line no-restricted-syntax
   const error = new Error(message);
@@ -488,6 +501,9 @@ function processChunk(self, chunk, flushFlag, cb) {
   const handle = self._handle;
   if (!handle) return process.nextTick(cb);
 
+  if (self[kParallel] !== undefined)
+    return processChunkParallel(self, chunk, flushFlag, cb);
+
   handle.buffer = chunk;
   handle.cb = cb;
   handle.availOutBefore = self._chunkSize - self._outOffset;
@@ -586,8 +602,104 @@ function _close(engine, callback) {
   if (!engine._handle)
     return;
 
-  engine._handle.close();
+  const handle = engine._handle;
   engine._handle = null;
+  if (engine[kParallel] !== undefined)
+    closeParallelHandles(engine[kParallel]);
+  // Handles with a write in progress (`handle.buffer` is set) or an error
+  // cannot be reused.
+  if (handle[kHandlePoolKey] !== undefined && !engine._hadError &&
+      !handle.buffer) {
+    releasePooledHandle(handle);
+  } else {
+    handle.close();
+  }
+}
+
+// The one-shot compression methods borrow their native handles from a pool,
+// keyed by the parameters they were initialized with. Setting up a deflate
+// context allocates a few hundred kilobytes, which dominates the cost of
+// compressing small inputs; deflateReset() keeps that memory around. Like
+// pooled HTTP parsers, each use of a handle is its own async resource.
+const kMaxPooledHandles = 4;
+const handlePool = new SafeMap();
+
+function getHandlePoolKey(opts, mode, windowBits, level, memLevel, strategy,
+                          dictionary) {
+  if (!opts || !opts[kUseHandlePool] || dictionary !== undefined ||
+      (mode !== DEFLATE && mode !== GZIP && mode !== DEFLATERAW)) {
+    return undefined;
+  }
+  return `${mode} ${windowBits} ${level} ${memLevel} ${strategy}`;
+}
+
+function takePooledHandle(key) {
+  const handles = handlePool.get(key);
+  if (handles === undefined || handles.length === 0)
+    return undefined;
+  const handle = handles.pop();
+  handle.asyncReset(handle);
+  return handle;
+}
+
+function releasePooledHandle(handle) {
+  handle.reset();
+  handle.cb = null;
+  handle[owner_symbol] = null;
+  const key = handle[kHandlePoolKey];
+  let handles = handlePool.get(key);
+  if (handles === undefined) {
+    handles = [];
+    handlePool.set(key, handles);
+  }
+  if (handles.length < kMaxPooledHandles) {
+    handle.release();
+    handles.push(handle);
+  } else {
+    handle.close();
+  }
+}
+
+// A preset dictionary backed by a SharedArrayBuffer. The native streams
+// reference its memory instead of copying it, and the buffer can be posted to
+// other threads without copying it either.
+class Dictionary {
+  constructor(buffer) {
+    this[kDictionaryBuffer] = buffer;
+  }
+
+  get buffer() {
+    return this[kDictionaryBuffer];
+  }
+
+  get byteLength() {
+    return this[kDictionaryBuffer].byteLength;
+  }
+}
+
+function createDictionary(data) {
+  let buffer;
+  if (isSharedArrayBuffer(data)) {
+    buffer = Buffer.from(data);
+  } else if (isArrayBufferView(data) && isSharedArrayBuffer(data.buffer)) {
+    buffer = Buffer.from(data.buffer, data.byteOffset, data.byteLength);
+  } else {
+    if (typeof data === 'string') {
+      data = Buffer.from(data);
+    } else if (isAnyArrayBuffer(data)) {
+      data = new Uint8Array(data);
+    } else if (!isArrayBufferView(data)) {
+      throw new ERR_INVALID_ARG_TYPE(
+        'buffer',
+        ['string', 'Buffer', 'TypedArray', 'DataView', 'ArrayBuffer',
+         'SharedArrayBuffer'],
+        data
+      );
+    }
+    buffer = Buffer.from(new SharedArrayBuffer(data.byteLength));
+    buffer.set(new Uint8Array(data.buffer, data.byteOffset, data.byteLength));
+  }
+  return new Dictionary(buffer);
 }
 
 const zlibDefaultOpts = {
@@ -603,6 +715,7 @@ function Zlib(opts, mode) {
   let memLevel = Z_DEFAULT_MEMLEVEL;
   let strategy = Z_DEFAULT_STRATEGY;
   let dictionary;
+  let parallelism = 1;
 
   if (opts) {
     // windowBits is special. On the compression side, 0 is an invalid value.
@@ -632,7 +745,9 @@ function Zlib(opts, mode) {
       Z_DEFAULT_STRATEGY, Z_FIXED, Z_DEFAULT_STRATEGY);
 
     dictionary = opts.dictionary;
-    if (dictionary !== undefined && !isArrayBufferView(dictionary)) {
+    if (dictionary instanceof Dictionary) {
+      dictionary = dictionary[kDictionaryBuffer];
+    } else if (dictionary !== undefined && !isArrayBufferView(dictionary)) {
       if (isAnyArrayBuffer(dictionary)) {
         dictionary = Buffer.from(dictionary);
       } else {
@@ -643,30 +758,53 @@ function Zlib(opts, mode) {
         );
       }
     }
+
+    if ((mode === GZIP || mode === DEFLATE) &&
+        opts.parallelism !== undefined) {
+      parallelism = opts.parallelism;
+      validateInteger(parallelism, 'options.parallelism', 1, kMaxParallelism);
+    }
   }
 
-  const handle = new binding.Zlib(mode);
-  // Ideally, we could let ZlibBase() set up _writeState. I haven't been able
-  // to come up with a good solution that doesn't break our internal API,
-  // and with it all supported npm versions at the time of writing.
-  this._writeState = new Uint32Array(2);
-  if (!handle.init(windowBits,
-                   level,
-                   memLevel,
-                   strategy,
-                   this._writeState,
-                   processCallback,
-                   dictionary)) {
-    // TODO(addaleax): Sometimes we generate better error codes in C++ land,
-    // e.g. ERR_BROTLI_PARAM_SET_FAILED -- it's hard to access them with
-    // the current bindings setup, though.
-    throw new ERR_ZLIB_INITIALIZATION_FAILED();
+  const poolKey = getHandlePoolKey(opts, mode, windowBits, level, memLevel,
+                                   strategy, dictionary);
+  let handle = poolKey !== undefined ? takePooledHandle(poolKey) : undefined;
+  if (handle !== undefined) {
+    this._writeState = handle[kWriteState];
+  } else {
+    handle = new binding.Zlib(mode);
+    // Ideally, we could let ZlibBase() set up _writeState. I haven't been able
+    // to come up with a good solution that doesn't break our internal API,
+    // and with it all supported npm versions at the time of writing.
+    this._writeState = new Uint32Array(2);
+    if (!handle.init(windowBits,
+                     level,
+                     memLevel,
+                     strategy,
+                     this._writeState,
+                     processCallback,
+                     dictionary)) {
+      // TODO(addaleax): Sometimes we generate better error codes in C++ land,
+      // e.g. ERR_BROTLI_PARAM_SET_FAILED -- it's hard to access them with
+      // the current bindings setup, though.
+      throw new ERR_ZLIB_INITIALIZATION_FAILED();
+    }
+    if (poolKey !== undefined) {
+      handle[kHandlePoolKey] = poolKey;
+      handle[kWriteState] = this._writeState;
+    }
   }
 
   ZlibBase.call(this, opts, mode, handle, zlibDefaultOpts);
 
   this._level = level;
   this._strategy = strategy;
+
+  // The synchronous methods keep using `handle`.
+  if (parallelism > 1 && dictionary === undefined) {
+    this[kParallel] =
+      new ParallelState(mode, parallelism, windowBits, memLevel);
+  }
 }
 ObjectSetPrototypeOf(Zlib.prototype, ZlibBase.prototype);
 ObjectSetPrototypeOf(Zlib, ZlibBase);
@@ -678,6 +816,10 @@ ObjectSetPrototypeOf(Zlib, ZlibBase);
 function paramsAfterFlushCallback(level, strategy, callback) {
   assert(this._handle, 'zlib binding closed');
   this._handle.params(level, strategy);
+  // The flush has completed all parallel blocks. Their handles were set up
+  // with the old parameters.
+  if (this[kParallel] !== undefined)
+    closeParallelHandles(this[kParallel]);
   if (!this._hadError) {
     this._level = level;
     this._strategy = strategy;
@@ -697,6 +839,253 @@ Zlib.prototype.params = function params(level, strategy, callback) {
   }
 };
 
+// Gzip and Deflate streams with `parallelism > 1` are compressed the way pigz
+// does it: the input is split into blocks that are compressed independently as
+// raw deflate data on the threadpool, each one primed with the preceding window
+// of input as its dictionary. Z_SYNC_FLUSH makes every block end on a byte
+// boundary, so that the blocks can simply be concatenated between a header and
+// a trailer that are generated here. The checksum of every block is computed
+// on the threadpool along with its compression, and combined in order.
+const kParallelBlockSize = 128 * 1024;
+const kMaxParallelism = 256;
+
+function ParallelState(mode, parallelism, windowBits, memLevel) {
+  this.mode = mode;
+  this.parallelism = parallelism;
+  // A window size of 256 bytes is silently upgraded to 512 bytes by zlib.
+  this.windowBits = MathMax(windowBits, 9);
+  this.memLevel = memLevel;
+  // The block that is currently being filled with input.
+  this.block = null;
+  this.blockLength = 0;
+  // The last window of input, used as the dictionary for the next block.
+  this.window = null;
+  // Blocks that are being compressed or waiting to be pushed, in order.
+  this.blocks = [];
+  // Idle DEFLATERAW handles, reset and reused for later blocks.
+  this.handles = [];
+  this.check = mode === GZIP ? 0 : 1;
+  this.totalLength = 0;
+  this.headerWritten = false;
+  this.finishing = false;
+  this.flushing = false;
+  this.callback = null;
+}
+
+function processChunkParallel(self, chunk, flushFlag, cb) {
+  const state = self[kParallel];
+  const length = chunk.byteLength;
+
+  // The input is copied, because the chunk may be reused once `cb` is called.
+  let offset = 0;
+  while (offset < length) {
+    if (state.block === null) {
+      state.block = Buffer.allocUnsafe(kParallelBlockSize);
+      state.blockLength = 0;
+    }
+    const n = MathMin(length - offset, kParallelBlockSize - state.blockLength);
+    state.block.set(chunk.subarray(offset, offset + n), state.blockLength);
+    state.blockLength += n;
+    offset += n;
+    if (state.blockLength === kParallelBlockSize)
+      startParallelBlock(self, state, Z_SYNC_FLUSH);
+  }
+
+  // Any kind of flush ends the current block early.
+  if (flushFlag === Z_FINISH) {
+    state.finishing = true;
+    startParallelBlock(self, state, Z_FINISH);
+  } else if (flushFlag !== Z_NO_FLUSH && state.blockLength > 0) {
+    startParallelBlock(self, state, Z_SYNC_FLUSH);
+  }
+  // After a full flush, the output can be decompressed from that point on
+  // without the data that precedes it.
+  if (flushFlag === Z_FULL_FLUSH)
+    state.window = null;
+
+  state.flushing = flushFlag !== Z_NO_FLUSH;
+  state.callback = cb;
+  maybeContinueParallel(state);
+}
+
+function startParallelBlock(self, state, flushFlag) {
+  const input = state.block === null ?
+    Buffer.alloc(0) : state.block.slice(0, state.blockLength);
+  state.block = null;
+  state.blockLength = 0;
+
+  if (!state.headerWritten) {
+    state.headerWritten = true;
+    self.push(parallelHeader(self, state));
+  }
+
+  let handle = state.handles.pop();
+  if (handle === undefined) {
+    handle = new binding.Zlib(DEFLATERAW);
+    handle[kWriteState] = new Uint32Array(2);
+    if (!handle.init(state.windowBits,
+                     self._level,
+                     state.memLevel,
+                     self._strategy,
+                     handle[kWriteState],
+                     processParallelCallback,
+                     undefined)) {
+      self.destroy(new ERR_ZLIB_INITIALIZATION_FAILED());
+      return;
+    }
+    handle[owner_symbol] = self;
+    handle.onerror = zlibOnError;
+  }
+  handle.resetBlock(state.mode,
+                    state.window === null ? undefined : state.window);
+  if (self._hadError)
+    return;
+
+  const windowSize = 1 << state.windowBits;
+  if (input.length >= windowSize) {
+    state.window = input.slice(input.length - windowSize);
+  } else if (input.length > 0) {
+    const window = state.window === null ?
+      input : Buffer.concat([state.window, input]);
+    state.window = window.slice(MathMax(window.length - windowSize, 0));
+  }
+
+  const block = {
+    handle,
+    input,
+    flushFlag,
+    inOff: 0,
+    availInBefore: input.length,
+    availOutBefore: self._chunkSize,
+    outBuffer: Buffer.allocUnsafe(self._chunkSize),
+    output: [],
+    check: 0,
+    done: false
+  };
+  handle[kParallelBlock] = block;
+  state.blocks.push(block);
+
+  handle.write(flushFlag,
+               input, // in
+               0, // in_off
+               block.availInBefore, // in_len
+               block.outBuffer, // out
+               0, // out_off
+               block.availOutBefore); // out_len
+}
+
+function processParallelCallback() {
+  // This callback's context (`this`) is the block's own handle.
+  const handle = this;
+  const self = this[owner_symbol];
+  const block = this[kParallelBlock];
+  const state = self[kParallel];
+
+  if (self._hadError || self.destroyed) {
+    handle.close();
+    maybeContinueParallel(state);
+    return;
+  }
+
+  const availOutAfter = handle[kWriteState][0];
+  const availInAfter = handle[kWriteState][1];
+
+  const have = block.availOutBefore - availOutAfter;
+  if (have > 0)
+    block.output.push(block.outBuffer.slice(0, have));
+
+  if (availOutAfter === 0) {
+    // Not actually done, continue with a fresh output buffer.
+    block.inOff += block.availInBefore - availInAfter;
+    block.availInBefore = availInAfter;
+    block.outBuffer = Buffer.allocUnsafe(self._chunkSize);
+    handle.write(block.flushFlag,
+                 block.input, // in
+                 block.inOff, // in_off
+                 block.availInBefore, // in_len
+                 block.outBuffer, // out
+                 0, // out_off
+                 block.availOutBefore); // out_len
+    return;
+  }
+
+  block.check = handle.getChecksum();
+  block.handle = null;
+  block.done = true;
+  block.outBuffer = null;
+  if (state.handles.length < state.parallelism)
+    state.handles.push(handle);
+  else
+    handle.close();
+
+  // Push the output of all blocks that are done, in order.
+  while (state.blocks.length > 0 && state.blocks[0].done) {
+    const { input, output, check } = state.blocks.shift();
+    if (state.mode === GZIP)
+      state.check = binding.crc32Combine(state.check, check, input.length);
+    else
+      state.check = binding.adler32Combine(state.check, check, input.length);
+    state.totalLength += input.length;
+    self.bytesWritten += input.length;
+    for (const out of output)
+      self.push(out);
+  }
+
+  if (state.finishing && state.blocks.length === 0) {
+    self.push(parallelTrailer(state));
+    closeParallelHandles(state);
+  }
+
+  maybeContinueParallel(state);
+}
+
+// Ask for more input while fewer than `parallelism` blocks are in flight.
+// Flushes are only complete once all pending blocks have been pushed.
+function maybeContinueParallel(state) {
+  const cb = state.callback;
+  if (cb === null)
+    return;
+  if (state.flushing ?
+    state.blocks.length > 0 : state.blocks.length >= state.parallelism) {
+    return;
+  }
+  state.callback = null;
+  cb();
+}
+
+function closeParallelHandles(state) {
+  for (const handle of state.handles)
+    handle.close();
+  state.handles = [];
+}
+
+function parallelHeader(self, state) {
+  const level = self._level === Z_DEFAULT_COMPRESSION ? 6 : self._level;
+  const fast = level < 2 || self._strategy >= Z_HUFFMAN_ONLY;
+  if (state.mode === GZIP) {
+    // No file name, modification time or other optional fields. The operating
+    // system is always reported as Unix.
+    const xfl = level === 9 ? 2 : (fast ? 4 : 0);
+    return Buffer.from([0x1f, 0x8b, 8, 0, 0, 0, 0, 0, xfl, 3]);
+  }
+  const cmf = ((state.windowBits - 8) << 4) | 8;
+  let flg = (fast ? 0 : level < 6 ? 1 : level === 6 ? 2 : 3) << 6;
+  flg += 31 - ((cmf * 256 + flg) % 31);
+  return Buffer.from([cmf, flg]);
+}
+
+function parallelTrailer(state) {
+  if (state.mode === GZIP) {
+    const trailer = Buffer.allocUnsafe(8);
+    trailer.writeUInt32LE(state.check, 0);
+    trailer.writeUInt32LE(state.totalLength % 2 ** 32, 4);
+    return trailer;
+  }
+  const trailer = Buffer.allocUnsafe(4);
+  trailer.writeUInt32BE(state.check, 0);
+  return trailer;
+}
+
 // generic zlib
 // minimal 2-byte header
 function Deflate(opts) {
@@ -759,6 +1148,7 @@ ObjectSetPrototypeOf(Unzip, Zlib);
 function createConvenienceMethod(ctor, sync) {
   if (sync) {
     return function syncBufferWrapper(buffer, opts) {
+      opts = { ...opts, [kUseHandlePool]: true };
       return zlibBufferSync(new ctor(opts), buffer);
     };
   } else {
@@ -767,6 +1157,7 @@ function createConvenienceMethod(ctor, sync) {
         callback = opts;
         opts = {};
       }
+      opts = { ...opts, [kUseHandlePool]: true };
       return zlibBuffer(new ctor(opts), buffer, callback);
     };
   }
@@ -864,6 +1255,8 @@ module.exports = {
   BrotliCompress,
   BrotliDecompress,
 
+  createDictionary,
+
   // Convenience methods.
   // compress/decompress a string or buffer in one step.
   deflate: createConvenienceMethod(Deflate, false),
@@ -526,6 +526,7 @@
         'src/api/utils.cc',
 
         'src/async_wrap.cc',
+        'src/base64.cc',
         'src/cares_wrap.cc',
         'src/connect_wrap.cc',
         'src/connection_wrap.cc',
@@ -601,6 +602,7 @@
         'src/tracing/traced_value.cc',
         'src/tty_wrap.cc',
         'src/udp_wrap.cc',
+        'src/utf8.cc',
         'src/util.cc',
         'src/uv.cc',
         # headers to make for a more pleasant IDE experience
@@ -685,6 +687,7 @@
         'src/tracing/traced_value.h',
         'src/tty_wrap.h',
         'src/udp_wrap.h',
+        'src/utf8.h',
         'src/util.h',
         'src/util-inl.h',
         # Dependency headers
@@ -821,11 +824,13 @@
             'src/node_crypto.cc',
             'src/node_crypto_bio.cc',
             'src/node_crypto_clienthello.cc',
+            'src/node_crypto_session_cache.cc',
             'src/node_crypto.h',
             'src/node_crypto_bio.h',
             'src/node_crypto_clienthello.h',
             'src/node_crypto_clienthello-inl.h',
             'src/node_crypto_groups.h',
+            'src/node_crypto_session_cache.h',
             'src/tls_wrap.cc',
             'src/tls_wrap.h'
           ],
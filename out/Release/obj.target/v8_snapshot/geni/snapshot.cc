@@ -0,0 +1,6766 @@
+// Autogenerated snapshot file. Do not edit.
+
+#include "src/init/v8.h"
+#include "src/base/platform/platform.h"
+
+#include "src/snapshot/snapshot.h"
+
+namespace v8 {
+namespace internal {
+
+alignas(kPointerAlignment) static const byte blob_data[] = {
+1,0,0,0,1,0,0,0,16,21,45,118,186,246,50,127,55,46,57,46,51,49,55,46,50,53,45,110,111,100,101
+,46,50,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,61,2,0,64,151,2,0,107,3,222,192,6,0,0
+,0,48,61,2,0,0,0,0,128,0,0,0,128,88,40,1,128,128,55,2,128,160,0,0,128,0,0,0,128,0,0,0
+,0,96,0,0,0,0,3,0,0,0,96,0,0,0,0,0,0,0,0,96,0,0,0,0,0,0,0,0,96,0,0,0
+,0,185,0,0,0,96,0,0,0,0,53,0,0,0,96,0,0,0,0,253,0,0,0,96,0,0,0,0,187,0,0,0
+,26,2,32,17,73,6,17,237,5,96,0,0,0,0,36,1,0,0,68,2,8,88,33,77,13,2,8,88,33,13,13,2
+,8,88,33,13,13,68,2,32,144,17,197,3,96,0,0,0,0,36,1,0,0,68,2,8,88,33,61,13,2,8,88,33
+,17,13,2,8,88,33,17,13,68,2,32,144,146,96,0,0,0,0,36,1,0,0,68,2,8,88,33,77,13,2,8,88
+,33,21,13,2,8,88,33,21,13,68,2,32,144,17,249,3,96,0,0,0,0,36,1,0,0,68,2,8,88,33,77,13
+,2,8,88,33,25,13,2,8,88,33,25,13,68,2,32,144,17,217,4,96,0,0,0,0,68,1,0,0,68,2,8,88
+,33,65,13,2,8,88,33,29,13,2,8,88,33,29,13,68,2,32,144,17,77,2,96,0,0,0,0,36,1,0,0,68
+,2,8,88,33,77,13,2,8,88,33,33,13,2,8,88,33,33,13,68,2,32,144,17,173,2,96,0,0,0,0,36,1
+,0,0,68,2,8,88,33,77,13,2,8,88,33,37,13,2,8,88,33,37,13,68,2,32,144,147,96,0,0,0,0,36
+,1,0,0,68,2,8,88,33,77,13,2,8,88,33,41,13,2,8,88,33,41,13,68,2,32,144,146,96,0,0,0,0
+,36,1,0,0,68,2,8,88,33,77,13,2,8,88,33,45,13,2,8,88,33,45,13,68,2,32,144,17,109,4,96,0
+,0,0,0,36,1,0,0,68,2,8,88,33,69,13,2,8,88,33,49,13,2,8,88,33,49,13,68,2,32,144,17,149
+,3,96,0,0,0,0,68,1,0,0,68,2,8,88,33,77,13,2,8,88,33,53,13,2,8,88,33,53,13,68,2,32
+,17,73,6,146,96,0,0,0,0,36,1,0,0,68,2,8,88,33,77,13,2,8,88,33,57,13,2,8,88,33,57,13
+,68,4,40,74,97,4,4,4,27,33,4,0,25,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0
+,0,17,253,1,2,8,86,96,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,4,40,74,97,12,12,12
+,27,44,4,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,146,10,0,1,21,96,0
+,0,0,0,0,0,0,0,2,64,17,137,6,73,68,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68
+,96,0,0,0,0,0,0,0,0,68,96,0,0,0,0,1,0,0,0,68,96,0,0,0,0,0,0,0,0,146,96,0
+,0,0,0,4,0,0,0,128,68,93,2,12,17,224,68,96,0,4,0,0,0,0,0,0,147,2,20,87,73,97,0,0
+,0,0,0,0,0,0,0,0,0,0,1,0,0,0,146,2,20,87,73,97,0,0,0,0,0,0,0,0,0,0,0,0
+,1,0,0,0,146,2,20,87,73,97,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,146,2,20,87,73,97
+,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,146,2,20,87,73,97,0,0,0,0,0,0,0,0,0,0
+,0,0,1,0,0,0,146,2,20,87,73,97,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,146,2,20,87
+,73,97,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,146,2,20,87,73,97,0,0,0,0,0,0,0,0
+,0,0,0,0,1,0,0,0,146,2,20,87,73,97,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,146,2
+,20,87,73,97,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,146,2,20,87,73,97,0,0,0,0,0,0
+,0,0,0,0,0,0,1,0,0,0,146,2,20,87,73,97,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0
+,146,2,20,87,73,97,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,146,2,20,87,73,97,0,0,0,0
+,0,0,0,0,0,0,0,0,1,0,0,0,146,2,20,87,73,97,0,0,0,0,0,0,0,0,0,0,0,0,1,0
+,0,0,146,2,9,4,76,96,0,0,0,0,0,1,0,0,27,72,68,19,0,27,37,3,68,2,9,4,76,31,33,32
+,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,2,9,4,76,31,33,32,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,189,3,76,96,0,0,0,0
+,237,0,0,0,19,4,19,8,19,12,19,16,19,20,19,24,19,28,19,32,19,36,19,40,19,44,19,48,19,52,19,56
+,19,60,19,64,19,68,19,72,19,76,19,80,19,84,19,88,19,92,19,96,19,100,19,104,19,108,19,112,19,116,19,120
+,19,124,19,128,19,132,19,136,19,140,19,144,19,148,19,152,19,156,19,160,19,164,19,168,19,172,19,176,19,180,19,184
+,19,188,19,192,19,196,19,200,19,204,19,208,19,0,19,212,19,216,19,220,19,224,19,228,19,232,19,236,19,240,19,244
+,19,248,19,252,19,1,1,19,5,1,19,9,1,19,13,1,19,17,1,19,21,1,19,25,1,19,29,1,19,33,1,19
+,37,1,19,41,1,19,45,1,19,49,1,19,53,1,19,57,1,19,61,1,19,65,1,19,69,1,19,73,1,19,77,1
+,19,81,1,19,85,1,19,89,1,19,93,1,19,97,1,19,101,1,19,105,1,19,109,1,19,113,1,19,117,1,19,121
+,1,19,125,1,19,129,1,19,133,1,19,137,1,19,141,1,19,145,1,19,149,1,19,153,1,19,157,1,19,161,1,19
+,165,1,19,169,1,19,173,1,19,177,1,19,181,1,19,185,1,19,189,1,19,193,1,19,197,1,19,201,1,19,205,1
+,19,209,1,19,213,1,19,217,1,19,221,1,19,225,1,19,229,1,19,233,1,19,237,1,19,241,1,19,245,1,19,249
+,1,19,253,1,19,1,2,19,5,2,19,9,2,19,13,2,19,17,2,19,21,2,19,25,2,19,29,2,19,33,2,19
+,37,2,19,41,2,19,45,2,19,49,2,19,53,2,19,57,2,19,61,2,19,65,2,19,69,2,19,73,2,19,77,2
+,19,81,2,19,85,2,19,89,2,19,93,2,19,97,2,19,101,2,19,105,2,19,109,2,19,113,2,19,117,2,19,121
+,2,19,125,2,19,129,2,19,133,2,19,137,2,19,141,2,19,145,2,19,149,2,19,153,2,19,157,2,19,161,2,19
+,165,2,19,169,2,19,173,2,19,177,2,19,181,2,19,185,2,19,189,2,19,193,2,19,197,2,19,201,2,19,205,2
+,19,209,2,19,213,2,19,217,2,19,221,2,19,225,2,19,229,2,19,233,2,19,237,2,19,241,2,19,245,2,19,249
+,2,19,253,2,19,1,3,19,5,3,19,9,3,19,13,3,19,17,3,19,21,3,19,25,3,19,29,3,19,33,3,19
+,37,3,19,41,3,19,45,3,19,49,3,19,53,3,19,57,3,19,61,3,19,65,3,19,69,3,19,73,3,19,77,3
+,19,81,3,19,85,3,19,89,3,19,93,3,19,97,3,19,101,3,19,105,3,19,109,3,19,113,3,19,117,3,19,121
+,3,19,125,3,19,129,3,19,133,3,19,137,3,19,141,3,19,145,3,19,149,3,19,153,3,19,157,3,19,161,3,19
+,165,3,19,169,3,19,173,3,19,177,3,2,9,8,76,96,0,0,0,0,0,2,0,0,27,185,7,68,17,245,1,150
+,150,2,28,17,69,1,97,0,0,0,0,4,0,0,0,0,0,0,0,2,0,0,0,36,17,37,7,36,2,64,148,2
+,12,80,97,102,146,213,212,5,0,0,0,40,41,32,123,125,0,0,0,68,97,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,68,96,0,0,0,0,0,0,0,0,68,96,0,0,0,0,2,0,0,0,68,96,0,0,0,0,0
+,0,0,0,2,16,17,65,1,96,0,0,0,0,2,0,0,0,68,36,2,28,83,96,0,0,0,0,161,0,0,0,17
+,45,2,17,237,1,10,0,193,224,97,0,0,255,255,0,0,0,0,64,0,2,0,255,255,255,255,96,0,0,0,0,0
+,0,0,0,128,68,93,128,68,93,17,1,2,149,149,68,93,93,2,16,76,97,0,0,0,0,2,0,0,0,0,0,0
+,0,0,0,0,0,68,68,68,68,3,209,1,84,30,225,13,73,3,0,0,6,0,0,0,73,3,0,0,73,3,0,0
+,73,3,0,0,56,0,0,0,72,139,71,23,76,139,112,7,77,139,86,255,102,65,131,122,11,99,117,4,77,139,118,7
+,73,139,70,255,102,129,120,11,134,0,15,133,242,0,0,0,72,139,95,39,72,139,91,7,72,139,75,255,102,129,121,11
+,159,0,15,133,26,0,0,0,72,139,75,15,73,186,0,0,0,0,1,0,0,0,73,59,202,15,133,10,1,0,0,255
+,67,35,85,72,137,229,86,87,102,65,199,70,51,0,0,73,199,193,53,0,0,0,65,86,73,139,201,72,193,225,32,81
+,65,139,78,39,72,137,224,72,43,193,73,59,69,208,15,130,174,2,0,0,73,139,69,32,233,1,0,0,0,80,72,131
+,233,8,125,249,73,99,78,47,133,201,116,5,72,137,84,205,0,77,139,189,136,19,0,0,71,15,182,28,14,75,139,12
+,223,255,209,76,139,117,232,68,139,77,228,77,99,201,67,15,182,28,14,73,139,141,48,16,0,0,128,251,3,119,29,65
+,255,193,246,195,1,67,15,182,28,14,117,9,72,129,193,220,2,0,0,235,7,72,129,193,184,5,0,0,128,251,171,15
+,132,15,0,0,0,128,251,176,15,132,6,0,0,0,68,3,12,153,235,157,72,139,93,232,139,91,43,201,89,72,3,227
+,81,195,85,72,137,229,106,34,87,82,87,184,1,0,0,0,73,139,157,184,28,0,0,232,0,0,0,0,72,139,200,90
+,95,72,139,229,93,247,65,43,0,0,0,128,15,133,9,0,0,0,72,131,193,63,233,11,0,0,0,139,73,59,73,139
+,140,205,240,43,0,0,255,225,204,246,193,1,15,133,6,1,0,0,72,133,201,15,133,70,0,0,0,85,72,137,229,106
+,34,87,82,87,184,1,0,0,0,73,139,157,216,28,0,0,232,0,0,0,0,72,139,200,90,95,72,139,229,93,247,65
+,43,0,0,0,128,15,133,9,0,0,0,72,131,193,63,233,11,0,0,0,139,73,59,73,139,140,205,240,43,0,0,255
+,225,73,186,0,0,0,0,2,0,0,0,73,59,202,15,133,70,0,0,0,85,72,137,229,106,34,87,82,87,184,1,0
+,0,0,73,139,157,200,28,0,0,232,0,0,0,0,72,139,200,90,95,72,139,229,93,247,65,43,0,0,0,128,15,133
+,9,0,0,0,72,131,193,63,233,11,0,0,0,139,73,59,73,139,140,205,240,43,0,0,255,225,73,186,0,0,0,0
+,3,0,0,0,73,59,202,15,133,70,0,0,0,85,72,137,229,106,34,87,82,87,184,1,0,0,0,73,139,157,192,28
+,0,0,232,0,0,0,0,72,139,200,90,95,72,139,229,93,247,65,43,0,0,0,128,15,133,9,0,0,0,72,131,193
+,63,233,11,0,0,0,139,73,59,73,139,140,205,240,43,0,0,255,225,233,231,253,255,255,131,249,3,15,132,222,253,255
+,255,72,131,225,253,76,139,89,31,65,246,67,15,1,15,133,104,0,0,0,72,137,79,47,76,139,217,76,141,127,47,73
+,129,227,0,0,252,255,65,246,67,8,2,116,44,73,199,195,0,0,252,255,76,35,223,65,246,67,8,4,116,27,80,81
+,82,86,87,73,139,247,72,139,21,129,253,255,255,51,201,232,0,0,0,0,95,94,90,89,88,247,65,43,0,0,0,128
+,15,133,9,0,0,0,72,131,193,63,233,11,0,0,0,139,73,59,73,139,140,205,240,43,0,0,255,225,85,72,137,229
+,106,34,87,82,87,184,1,0,0,0,73,139,157,208,28,0,0,232,0,0,0,0,72,139,200,90,95,72,139,229,93,247
+,65,43,0,0,0,128,15,133,9,0,0,0,72,131,193,63,233,11,0,0,0,139,73,59,73,139,140,205,240,43,0,0
+,255,225,51,192,73,139,157,120,32,0,0,232,0,0,0,0,204,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,2,20,75,99,0,0,0,0,19,0,0,0,233,9,3,71,53,5,71,101,3,71,101,3
+,71,101,3,71,193,9,71,0,0,0,0,0,93,17,205,1,2,12,17,208,68,96,0,0,0,0,0,0,0,0,3,144
+,84,30,225,3,217,0,0,0,6,0,0,0,217,0,0,0,217,0,0,0,217,0,0,0,174,2,0,0,85,72,137,229
+,106,6,106,0,76,139,240,73,137,173,160,43,0,0,73,137,181,64,43,0,0,73,137,157,176,43,0,0,78,141,124,245
+,8,72,131,228,240,72,137,101,240,73,139,254,73,139,247,73,141,85,128,255,211,73,59,133,0,1,0,0,15,132,32,0
+,0,0,72,139,77,8,72,139,109,0,73,141,103,8,81,73,139,181,64,43,0,0,73,199,133,160,43,0,0,0,0,0
+,0,195,72,199,199,0,0,0,0,72,199,198,0,0,0,0,73,141,85,128,73,137,226,72,131,236,8,72,131,228,240,76
+,137,20,36,73,139,133,176,32,0,0,76,141,21,0,0,0,0,77,137,85,192,73,137,109,184,255,208,73,199,69,184,0
+,0,0,0,72,139,36,36,73,139,181,88,43,0,0,73,139,165,120,43,0,0,73,139,173,112,43,0,0,72,133,246,116
+,4,72,137,117,248,73,199,196,255,255,255,255,73,139,189,96,43,0,0,255,231,0,0,0,0,0,0,0,2,8,75,96
+,0,0,0,0,0,0,0,0,93,150,2,12,151,68,96,0,0,0,0,0,0,0,0,11,0,129,14,144,144,3,129,3
+,84,30,97,27,174,6,0,0,198,3,0,0,88,6,0,0,174,6,0,0,174,6,0,0,0,0,0,0,85,72,137,229
+,106,26,72,131,236,32,72,139,199,72,137,125,224,72,137,117,240,72,139,249,72,137,77,232,51,201,72,59,209,15,133,44
+,4,0,0,73,139,149,200,19,0,0,128,58,0,15,133,243,1,0,0,72,37,0,0,252,255,72,139,80,56,72,137,69
+,224,72,131,250,0,116,66,72,43,240,72,139,198,72,193,232,13,72,139,4,194,72,131,248,0,116,46,72,139,214,72,193
+,234,6,72,193,238,3,72,131,226,124,72,131,230,31,72,3,194,186,1,0,0,0,72,139,206,72,211,226,72,99,8,72
+,11,209,137,16,233,190,5,0,0,72,59,249,15,132,56,1,0,0,81,82,83,85,86,87,65,80,65,81,65,82,65,83
+,72,129,236,128,0,0,0,242,15,17,4,36,242,15,17,76,36,8,242,15,17,84,36,16,242,15,17,92,36,24,242,15
+,17,100,36,32,242,15,17,108,36,40,242,15,17,116,36,48,242,15,17,124,36,56,242,68,15,17,68,36,64,242,68,15
+,17,76,36,72,242,68,15,17,84,36,80,242,68,15,17,92,36,88,242,68,15,17,100,36,96,242,68,15,17,108,36,104
+,242,68,15,17,116,36,112,242,68,15,17,124,36,120,73,137,226,72,131,236,8,72,131,228,240,76,137,20,36,72,139,125
+,224,72,139,117,240,73,139,133,88,17,0,0,76,141,21,0,0,0,0,77,137,85,192,73,137,109,184,255,208,73,199,69
+,184,0,0,0,0,72,139,36,36,242,15,16,4,36,242,15,16,76,36,8,242,15,16,84,36,16,242,15,16,92,36,24
+,242,15,16,100,36,32,242,15,16,108,36,40,242,15,16,116,36,48,242,15,16,124,36,56,242,68,15,16,68,36,64,242
+,68,15,16,76,36,72,242,68,15,16,84,36,80,242,68,15,16,92,36,88,242,68,15,16,100,36,96,242,68,15,16,108
+,36,104,242,68,15,16,116,36,112,242,68,15,16,124,36,120,72,129,196,128,0,0,0,65,91,65,90,65,89,65,88,95
+,94,93,91,90,89,233,125,4,0,0,81,82,83,85,86,87,65,80,65,81,65,82,65,83,73,137,226,72,131,236,8,72
+,131,228,240,76,137,20,36,72,139,117,240,72,139,125,224,73,139,133,88,17,0,0,76,141,21,0,0,0,0,77,137,85
+,192,73,137,109,184,255,208,73,199,69,184,0,0,0,0,72,139,36,36,65,91,65,90,65,89,65,88,95,94,93,91,90
+,89,233,33,4,0,0,72,139,22,72,129,226,0,0,252,255,246,66,8,24,15,132,21,2,0,0,72,139,208,72,129,226
+,0,0,252,255,246,66,8,24,15,133,1,2,0,0,72,139,208,72,129,226,0,0,252,255,72,139,66,56,72,137,85,216
+,72,131,248,0,116,75,72,43,242,72,139,214,72,193,234,13,72,139,4,208,72,131,248,0,116,55,72,139,214,72,193,234
+,6,72,193,238,3,72,131,226,124,72,131,230,31,72,3,194,186,1,0,0,0,76,139,209,72,139,206,73,139,242,72,211
+,226,72,99,8,72,11,209,137,16,72,139,206,233,158,1,0,0,72,59,249,15,132,59,1,0,0,81,82,83,85,86,87
+,65,80,65,81,65,82,65,83,72,129,236,128,0,0,0,242,15,17,4,36,242,15,17,76,36,8,242,15,17,84,36,16
+,242,15,17,92,36,24,242,15,17,100,36,32,242,15,17,108,36,40,242,15,17,116,36,48,242,15,17,124,36,56,242,68
+,15,17,68,36,64,242,68,15,17,76,36,72,242,68,15,17,84,36,80,242,68,15,17,92,36,88,242,68,15,17,100,36
+,96,242,68,15,17,108,36,104,242,68,15,17,116,36,112,242,68,15,17,124,36,120,73,137,226,72,131,236,8,72,131,228
+,240,76,137,20,36,72,139,215,72,139,125,216,72,139,69,240,72,139,240,73,139,133,88,17,0,0,76,141,21,0,0,0
+,0,77,137,85,192,73,137,109,184,255,208,73,199,69,184,0,0,0,0,72,139,36,36,242,15,16,4,36,242,15,16,76
+,36,8,242,15,16,84,36,16,242,15,16,92,36,24,242,15,16,100,36,32,242,15,16,108,36,40,242,15,16,116,36,48
+,242,15,16,124,36,56,242,68,15,16,68,36,64,242,68,15,16,76,36,72,242,68,15,16,84,36,80,242,68,15,16,92
+,36,88,242,68,15,16,100,36,96,242,68,15,16,108,36,104,242,68,15,16,116,36,112,242,68,15,16,124,36,120,72,129
+,196,128,0,0,0,65,91,65,90,65,89,65,88,95,94,93,91,90,89,235,90,81,82,83,85,86,87,65,80,65,81,65
+,82,65,83,73,137,226,72,131,236,8,72,131,228,240,76,137,20,36,72,139,199,72,139,125,216,72,139,117,240,73,139,133
+,88,17,0,0,76,141,21,0,0,0,0,77,137,85,192,73,137,109,184,255,208,73,199,69,184,0,0,0,0,72,139,36
+,36,65,91,65,90,65,89,65,88,95,94,93,91,90,89,72,139,117,240,72,139,6,72,139,208,72,193,234,3,72,139,240
+,72,193,238,6,72,37,0,0,252,255,72,131,226,31,72,129,230,252,15,0,0,72,139,120,16,72,139,202,186,1,0,0
+,0,72,211,226,133,20,62,116,30,246,64,8,64,15,132,180,1,0,0,72,139,69,224,72,37,0,0,252,255,246,64,8
+,88,15,133,160,1,0,0,51,192,72,59,69,232,15,132,57,1,0,0,81,82,83,85,86,87,65,80,65,81,65,82,65
+,83,72,129,236,128,0,0,0,242,15,17,4,36,242,15,17,76,36,8,242,15,17,84,36,16,242,15,17,92,36,24,242
+,15,17,100,36,32,242,15,17,108,36,40,242,15,17,116,36,48,242,15,17,124,36,56,242,68,15,17,68,36,64,242,68
+,15,17,76,36,72,242,68,15,17,84,36,80,242,68,15,17,92,36,88,242,68,15,17,100,36,96,242,68,15,17,108,36
+,104,242,68,15,17,116,36,112,242,68,15,17,124,36,120,73,137,226,72,131,236,8,72,131,228,240,76,137,20,36,73,141
+,85,128,72,139,125,224,72,139,117,240,73,139,133,80,17,0,0,76,141,21,0,0,0,0,77,137,85,192,73,137,109,184
+,255,208,73,199,69,184,0,0,0,0,72,139,36,36,242,15,16,4,36,242,15,16,76,36,8,242,15,16,84,36,16,242
+,15,16,92,36,24,242,15,16,100,36,32,242,15,16,108,36,40,242,15,16,116,36,48,242,15,16,124,36,56,242,68,15
+,16,68,36,64,242,68,15,16,76,36,72,242,68,15,16,84,36,80,242,68,15,16,92,36,88,242,68,15,16,100,36,96
+,242,68,15,16,108,36,104,242,68,15,16,116,36,112,242,68,15,16,124,36,120,72,129,196,128,0,0,0,65,91,65,90
+,65,89,65,88,95,94,93,91,90,89,235,91,81,82,83,85,86,87,65,80,65,81,65,82,65,83,73,137,226,72,131,236
+,8,72,131,228,240,76,137,20,36,72,139,125,224,72,139,117,240,73,141,85,128,73,139,133,80,17,0,0,76,141,21,0
+,0,0,0,77,137,85,192,73,137,109,184,255,208,73,199,69,184,0,0,0,0,72,139,36,36,65,91,65,90,65,89,65
+,88,95,94,93,91,90,89,73,139,69,56,72,139,229,93,195,144,15,31,0,6,0,0,0,1,0,0,0,77,1,0,0
+,255,255,255,255,255,255,255,255,23,2,0,0,255,255,255,255,255,255,255,255,123,3,0,0,255,255,255,255,255,255,255,255
+,69,4,0,0,255,255,255,255,255,255,255,255,114,5,0,0,255,255,255,255,255,255,255,255,61,6,0,0,255,255,255,255
+,255,255,255,255,0,0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,8,75,96
+,0,0,0,0,0,0,0,0,93,150,2,12,151,68,96,0,0,0,0,0,0,0,0,144,144,68,149,26,93,26,26,69
+,69,96,0,0,0,0,0,0,0,0,69,26,26,96,0,0,0,0,0,0,0,0,96,0,0,0,0,0,0,0,0,96
+,0,0,0,0,0,0,0,0,26,68,68,68,68,68,26,26,3,48,84,30,224,13,0,0,0,198,3,0,128,88,6,0
+,0,174,6,0,0,174,6,0,0,0,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,17,29,2,93,150,17,33,2,37,0,3,48,84,30,224,13,0,0,0
+,198,1,0,128,160,1,0,0,181,1,0,0,181,1,0,0,1,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255
+,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,4,3,48,84,30,224,13
+,0,0,0,198,1,0,128,36,0,0,0,44,0,0,0,44,0,0,0,2,0,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,8,3,48,84
+,30,224,13,0,0,0,6,0,0,128,35,1,0,0,35,1,0,0,35,1,0,0,3,0,0,0,73,186,0,0,0,0
+,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,12
+,3,48,84,30,224,13,0,0,0,6,0,0,128,203,0,0,0,203,0,0,0,203,0,0,0,4,0,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,16,3,48,84,30,224,13,0,0,0,6,0,0,128,4,1,0,0,4,1,0,0,4,1,0,0,5,0,0,0
+,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,145,93,150,146,37,20,3,48,84,30,224,13,0,0,0,6,0,0,128,29,1,0,0,29,1,0,0,29,1,0,0,6
+,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,24,3,48,84,30,224,13,0,0,0,6,0,0,128,127,0,0,0,127,0,0,0,127,0
+,0,0,7,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,145,93,150,146,37,28,3,48,84,30,224,13,0,0,0,6,0,0,128,105,0,0,0,105,0,0
+,0,105,0,0,0,8,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,32,3,48,84,30,224,13,0,0,0,6,0,0,128,105,0,0,0
+,105,0,0,0,105,0,0,0,9,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,36,3,48,84,30,224,13,0,0,0,6,0,0,128,105
+,0,0,0,105,0,0,0,105,0,0,0,10,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,40,3,48,84,30,224,13,0,0,0,70,6
+,0,128,216,2,0,0,66,3,0,0,66,3,0,0,11,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,44,3,48,84,30,224,13,0,0
+,0,6,0,0,128,75,0,0,0,75,0,0,0,75,0,0,0,12,0,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,48,3,48,84,30,224
+,13,0,0,0,198,6,0,128,164,3,0,0,0,4,0,0,0,4,0,0,13,0,0,0,73,186,0,0,0,0,0,0
+,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,52,3,48
+,84,30,224,13,0,0,0,70,6,0,128,96,3,0,0,174,3,0,0,174,3,0,0,14,0,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,56,3,48,84,30,224,13,0,0,0,6,0,0,128,100,0,0,0,100,0,0,0,100,0,0,0,15,0,0,0,73,186
+,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93
+,150,146,37,60,3,48,84,30,224,13,0,0,0,6,0,0,128,100,0,0,0,100,0,0,0,100,0,0,0,16,0,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,64,3,48,84,30,224,13,0,0,0,198,3,0,128,136,0,0,0,157,0,0,0,157,0,0,0
+,17,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,145,93,150,146,37,68,3,48,84,30,224,13,0,0,0,198,1,0,128,224,0,0,0,245,0,0,0,245
+,0,0,0,18,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,72,3,48,84,30,224,13,0,0,0,198,3,0,128,60,1,0,0,94,1
+,0,0,94,1,0,0,19,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,76,3,48,84,30,224,13,0,0,0,6,0,0,128,26,0,0
+,0,26,0,0,0,26,0,0,0,20,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,80,3,48,84,30,224,13,0,0,0,6,0,0,128
+,127,0,0,0,127,0,0,0,127,0,0,0,21,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,84,3,48,84,30,224,13,0,0,0,6
+,0,0,128,28,0,0,0,28,0,0,0,28,0,0,0,22,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,88,3,48,84,30,224,13,0
+,0,0,6,0,0,128,86,0,0,0,86,0,0,0,86,0,0,0,23,0,0,0,73,186,0,0,0,0,0,0,0,0
+,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,92,3,48,84,30
+,224,13,0,0,0,6,0,0,128,75,0,0,0,75,0,0,0,75,0,0,0,24,0,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,96,3
+,48,84,30,224,13,0,0,0,70,7,0,128,188,3,0,0,24,4,0,0,24,4,0,0,25,0,0,0,73,186,0,0
+,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146
+,37,100,3,48,84,30,224,13,0,0,0,198,6,0,128,164,3,0,0,0,4,0,0,0,4,0,0,26,0,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,104,3,48,84,30,224,13,0,0,0,6,0,0,128,139,0,0,0,139,0,0,0,139,0,0,0,27,0
+,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,145,93,150,146,37,108,3,48,84,30,224,13,0,0,0,6,0,0,128,139,0,0,0,139,0,0,0,139,0,0
+,0,28,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,112,3,48,84,30,224,13,0,0,0,6,0,0,128,69,1,0,0,69,1,0,0
+,69,1,0,0,29,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,145,93,150,146,37,116,3,48,84,30,224,13,0,0,0,6,0,0,128,241,0,0,0,241
+,0,0,0,241,0,0,0,30,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,120,3,48,84,30,224,13,0,0,0,198,3,0,128,204,2
+,0,0,251,2,0,0,251,2,0,0,31,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,124,3,48,84,30,224,13,0,0,0,70,4,0
+,128,28,1,0,0,49,1,0,0,49,1,0,0,32,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,128,3,48,84,30,224,13,0,0,0
+,198,3,0,128,196,0,0,0,217,0,0,0,217,0,0,0,33,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255
+,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,132,3,48,84,30,224,13
+,0,0,0,198,3,0,128,196,0,0,0,217,0,0,0,217,0,0,0,34,0,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,136,3,48,84
+,30,224,13,0,0,0,70,2,0,128,212,0,0,0,246,0,0,0,246,0,0,0,35,0,0,0,73,186,0,0,0,0
+,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,140
+,3,48,84,30,224,13,0,0,0,70,3,0,128,8,2,0,0,42,2,0,0,42,2,0,0,36,0,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,144,3,48,84,30,224,13,0,0,0,198,5,0,128,8,4,0,0,156,4,0,0,156,4,0,0,37,0,0,0
+,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,145,93,150,146,37,148,3,48,84,30,224,13,0,0,0,70,6,0,128,176,5,0,0,54,6,0,0,54,6,0,0,38
+,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,152,3,48,84,30,224,13,0,0,0,70,6,0,128,216,2,0,0,66,3,0,0,66,3
+,0,0,39,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,145,93,150,146,37,156,3,48,84,30,224,13,0,0,0,6,0,0,128,180,0,0,0,180,0,0
+,0,188,0,0,0,40,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,160,3,48,84,30,224,13,0,0,0,6,0,0,128,180,0,0,0
+,180,0,0,0,188,0,0,0,41,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,164,3,48,84,30,224,13,0,0,0,6,0,0,128,180
+,0,0,0,180,0,0,0,188,0,0,0,42,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,168,3,48,84,30,224,13,0,0,0,6,0
+,0,128,95,0,0,0,95,0,0,0,95,0,0,0,43,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,172,3,48,84,30,224,13,0,0
+,0,6,0,0,128,95,0,0,0,95,0,0,0,95,0,0,0,44,0,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,176,3,48,84,30,224
+,13,0,0,0,6,0,0,128,51,1,0,0,51,1,0,0,51,1,0,0,45,0,0,0,73,186,0,0,0,0,0,0
+,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,180,3,48
+,84,30,224,13,0,0,0,198,3,0,128,32,3,0,0,66,3,0,0,66,3,0,0,46,0,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,184,3,48,84,30,224,13,0,0,0,198,3,0,128,4,5,0,0,77,5,0,0,77,5,0,0,47,0,0,0,73,186
+,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93
+,150,146,37,188,3,48,84,30,224,13,0,0,0,198,1,0,128,32,2,0,0,40,2,0,0,40,2,0,0,48,0,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,192,3,48,84,30,224,13,0,0,0,198,1,0,128,24,1,0,0,32,1,0,0,32,1,0,0
+,49,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,145,93,150,146,37,196,3,48,84,30,224,13,0,0,0,198,1,0,128,24,1,0,0,32,1,0,0,32
+,1,0,0,50,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,200,3,48,84,30,224,13,0,0,0,70,4,0,128,32,4,0,0,53,4
+,0,0,53,4,0,0,51,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,204,3,48,84,30,224,13,0,0,0,198,1,0,128,24,1,0
+,0,32,1,0,0,32,1,0,0,52,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,208,3,48,84,30,224,13,0,0,0,198,1,0,128
+,24,1,0,0,32,1,0,0,32,1,0,0,53,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,212,3,48,84,30,224,13,0,0,0,198
+,4,0,128,248,11,0,0,252,12,0,0,252,12,0,0,54,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,216,3,48,84,30,224,13,0
+,0,0,198,1,0,128,84,0,0,0,92,0,0,0,92,0,0,0,55,0,0,0,73,186,0,0,0,0,0,0,0,0
+,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,220,3,48,84,30
+,224,13,0,0,0,6,0,0,128,73,3,0,0,73,3,0,0,73,3,0,0,56,0,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,224,3
+,48,84,30,224,13,0,0,0,6,0,0,128,79,0,0,0,79,0,0,0,79,0,0,0,57,0,0,0,73,186,0,0
+,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146
+,37,228,3,48,84,30,224,13,0,0,0,6,0,0,128,85,0,0,0,85,0,0,0,85,0,0,0,58,0,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,232,3,48,84,30,224,13,0,0,0,6,0,0,128,82,0,0,0,82,0,0,0,82,0,0,0,59,0
+,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,145,93,150,146,37,236,3,48,84,30,224,13,0,0,0,6,0,0,128,78,0,0,0,78,0,0,0,78,0,0
+,0,60,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,240,3,48,84,30,224,13,0,0,0,6,0,0,128,78,0,0,0,78,0,0,0
+,78,0,0,0,61,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,145,93,150,146,37,244,3,48,84,30,224,13,0,0,0,6,0,0,128,81,0,0,0,81
+,0,0,0,81,0,0,0,62,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,248,3,48,84,30,224,13,0,0,0,6,0,0,128,184,0
+,0,0,184,0,0,0,184,0,0,0,63,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,252,3,48,84,30,224,13,0,0,0,6,0,0
+,128,81,0,0,0,81,0,0,0,81,0,0,0,64,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,1,1,3,48,84,30,224,13,0,0
+,0,6,0,0,128,51,0,0,0,51,0,0,0,51,0,0,0,65,0,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,5,1,3,48,84,30
+,224,13,0,0,0,198,3,0,128,28,4,0,0,49,4,0,0,49,4,0,0,66,0,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,9,1
+,3,48,84,30,224,13,0,0,0,198,1,0,128,84,0,0,0,92,0,0,0,92,0,0,0,67,0,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,13,1,3,48,84,30,224,13,0,0,0,6,0,0,128,177,0,0,0,177,0,0,0,177,0,0,0,68,0,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,17,1,3,48,84,30,224,13,0,0,0,6,0,0,128,32,0,0,0,32,0,0,0,32,0,0
+,0,69,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,21,1,3,48,84,30,224,13,0,0,0,6,0,0,128,52,0,0,0,52,0,0
+,0,52,0,0,0,70,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,25,1,3,48,84,30,224,13,0,0,0,6,0,0,128,60,0,0
+,0,60,0,0,0,60,0,0,0,71,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,29,1,3,48,84,30,224,13,0,0,0,6,0,0
+,128,56,0,0,0,56,0,0,0,56,0,0,0,72,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,33,1,3,48,84,30,224,13,0,0
+,0,6,0,0,128,64,0,0,0,64,0,0,0,64,0,0,0,73,0,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,37,1,3,48,84,30
+,224,13,0,0,0,6,0,0,128,31,1,0,0,31,1,0,0,31,1,0,0,74,0,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,41,1
+,3,48,84,30,224,13,0,0,0,6,0,0,128,13,1,0,0,13,1,0,0,13,1,0,0,75,0,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,45,1,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,76,0,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,49,1,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0
+,0,77,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,53,1,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0
+,0,12,0,0,0,78,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,57,1,3,48,84,30,224,13,0,0,0,198,1,0,128,64,0,0
+,0,72,0,0,0,72,0,0,0,79,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,61,1,3,48,84,30,224,13,0,0,0,198,1,0
+,128,56,0,0,0,64,0,0,0,64,0,0,0,80,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,65,1,3,48,84,30,224,13,0,0
+,0,198,1,0,128,64,0,0,0,72,0,0,0,72,0,0,0,81,0,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,69,1,3,48,84,30
+,224,13,0,0,0,198,1,0,128,56,0,0,0,64,0,0,0,64,0,0,0,82,0,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,73,1
+,3,48,84,30,224,13,0,0,0,198,4,0,128,192,1,0,0,242,1,0,0,242,1,0,0,83,0,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,77,1,3,48,84,30,224,13,0,0,0,198,3,0,128,0,2,0,0,47,2,0,0,47,2,0,0,84,0,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,81,1,3,48,84,30,224,13,0,0,0,198,3,0,128,148,1,0,0,182,1,0,0,182,1,0
+,0,85,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,85,1,3,48,84,30,224,13,0,0,0,198,3,0,128,92,1,0,0,113,1,0
+,0,113,1,0,0,86,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,89,1,3,48,84,30,224,13,0,0,0,70,5,0,128,216,1,0
+,0,252,1,0,0,252,1,0,0,87,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,93,1,3,48,84,30,224,13,0,0,0,6,0,0
+,128,141,0,0,0,141,0,0,0,141,0,0,0,88,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,97,1,3,48,84,30,224,13,0,0
+,0,6,0,0,128,45,0,0,0,45,0,0,0,45,0,0,0,89,0,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,101,1,3,48,84,30
+,224,13,0,0,0,198,2,0,128,216,0,0,0,250,0,0,0,250,0,0,0,90,0,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,105,1
+,3,48,84,30,224,13,0,0,0,198,1,0,128,96,0,0,0,104,0,0,0,104,0,0,0,91,0,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,109,1,3,48,84,30,224,13,0,0,0,198,2,0,128,196,0,0,0,13,1,0,0,13,1,0,0,92,0,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,113,1,3,48,84,30,224,13,0,0,0,198,2,0,128,196,0,0,0,13,1,0,0,13,1,0
+,0,93,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,117,1,3,48,84,30,224,13,0,0,0,198,2,0,128,172,0,0,0,219,0,0
+,0,219,0,0,0,94,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,121,1,3,48,84,30,224,13,0,0,0,198,2,0,128,172,0,0
+,0,219,0,0,0,219,0,0,0,95,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,125,1,3,48,84,30,224,13,0,0,0,198,2,0
+,128,172,0,0,0,219,0,0,0,219,0,0,0,96,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,129,1,3,48,84,30,224,13,0,0
+,0,198,1,0,128,64,0,0,0,85,0,0,0,85,0,0,0,97,0,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,133,1,3,48,84,30
+,224,13,0,0,0,70,2,0,128,108,0,0,0,129,0,0,0,129,0,0,0,98,0,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,137,1
+,3,48,84,30,224,13,0,0,0,70,2,0,128,188,0,0,0,235,0,0,0,235,0,0,0,99,0,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,141,1,3,48,84,30,224,13,0,0,0,70,2,0,128,208,0,0,0,255,0,0,0,255,0,0,0,100,0,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,145,1,3,48,84,30,224,13,0,0,0,70,2,0,128,192,0,0,0,239,0,0,0,239,0,0
+,0,101,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,149,1,3,48,84,30,224,13,0,0,0,70,2,0,128,212,0,0,0,16,1,0
+,0,16,1,0,0,102,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,153,1,3,48,84,30,224,13,0,0,0,70,2,0,128,228,0,0
+,0,19,1,0,0,19,1,0,0,103,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,157,1,3,48,84,30,224,13,0,0,0,198,1,0
+,128,240,0,0,0,5,1,0,0,5,1,0,0,104,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,161,1,3,48,84,30,224,13,0,0
+,0,70,2,0,128,164,1,0,0,198,1,0,0,198,1,0,0,105,0,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,165,1,3,48,84,30
+,224,13,0,0,0,70,2,0,128,176,1,0,0,210,1,0,0,210,1,0,0,106,0,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,169,1
+,3,48,84,30,224,13,0,0,0,70,2,0,128,92,1,0,0,126,1,0,0,126,1,0,0,107,0,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,173,1,3,48,84,30,224,13,0,0,0,198,1,0,128,132,0,0,0,140,0,0,0,140,0,0,0,108,0,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,177,1,3,48,84,30,224,13,0,0,0,198,1,0,128,48,0,0,0,69,0,0,0,69,0,0
+,0,109,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,181,1,3,48,84,30,224,13,0,0,0,198,1,0,128,112,0,0,0,133,0,0
+,0,133,0,0,0,110,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,185,1,3,48,84,30,224,13,0,0,0,198,1,0,128,4,0,0
+,0,12,0,0,0,12,0,0,0,111,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,189,1,3,48,84,30,224,13,0,0,0,70,2,0
+,128,32,1,0,0,53,1,0,0,53,1,0,0,112,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,193,1,3,48,84,30,224,13,0,0
+,0,198,1,0,128,4,0,0,0,12,0,0,0,12,0,0,0,113,0,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,197,1,3,48,84,30
+,224,13,0,0,0,198,1,0,128,104,0,0,0,112,0,0,0,112,0,0,0,114,0,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,201,1
+,3,48,84,30,224,13,0,0,0,70,3,0,128,152,13,0,0,173,13,0,0,173,13,0,0,115,0,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,205,1,3,48,84,30,224,13,0,0,0,198,1,0,128,28,0,0,0,36,0,0,0,36,0,0,0,116,0,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,209,1,3,48,84,30,224,13,0,0,0,198,6,0,128,84,60,0,0,214,61,0,0,214,61,0
+,0,117,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,213,1,3,48,84,30,224,13,0,0,0,198,1,0,128,32,0,0,0,40,0,0
+,0,40,0,0,0,118,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,217,1,3,48,84,30,224,13,0,0,0,198,1,0,128,60,0,0
+,0,68,0,0,0,68,0,0,0,119,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,221,1,3,48,84,30,224,13,0,0,0,198,1,0
+,128,12,0,0,0,20,0,0,0,20,0,0,0,120,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,225,1,3,48,84,30,224,13,0,0
+,0,198,1,0,128,16,0,0,0,24,0,0,0,24,0,0,0,121,0,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,229,1,3,48,84,30
+,224,13,0,0,0,198,4,0,128,108,12,0,0,200,12,0,0,200,12,0,0,122,0,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,233,1
+,3,48,84,30,224,13,0,0,0,198,1,0,128,32,0,0,0,40,0,0,0,40,0,0,0,123,0,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,237,1,3,48,84,30,224,13,0,0,0,198,6,0,128,108,26,0,0,228,26,0,0,228,26,0,0,124,0,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,241,1,3,48,84,30,224,13,0,0,0,198,1,0,128,32,0,0,0,40,0,0,0,40,0,0
+,0,125,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,245,1,3,48,84,30,224,13,0,0,0,198,1,0,128,180,0,0,0,188,0,0
+,0,188,0,0,0,126,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,249,1,3,48,84,30,224,13,0,0,0,198,1,0,128,72,0,0
+,0,80,0,0,0,80,0,0,0,127,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,253,1,3,48,84,30,224,13,0,0,0,198,1,0
+,128,92,1,0,0,100,1,0,0,100,1,0,0,128,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,1,2,3,48,84,30,224,13,0,0
+,0,198,1,0,128,92,1,0,0,100,1,0,0,100,1,0,0,129,0,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,5,2,3,48,84,30
+,224,13,0,0,0,198,1,0,128,92,1,0,0,100,1,0,0,100,1,0,0,130,0,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,9,2
+,3,48,84,30,224,13,0,0,0,198,1,0,128,92,1,0,0,100,1,0,0,100,1,0,0,131,0,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,13,2,3,48,84,30,224,13,0,0,0,198,1,0,128,32,0,0,0,40,0,0,0,40,0,0,0,132,0,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,17,2,3,48,84,30,224,13,0,0,0,198,5,0,128,160,24,0,0,136,25,0,0,136,25,0
+,0,133,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,21,2,3,48,84,30,224,13,0,0,0,70,7,0,128,140,34,0,0,140,36,0
+,0,140,36,0,0,134,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,25,2,3,48,84,30,224,13,0,0,0,198,5,0,128,156,24,0
+,0,132,25,0,0,132,25,0,0,135,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,29,2,3,48,84,30,224,13,0,0,0,70,5,0
+,128,156,21,0,0,132,22,0,0,132,22,0,0,136,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,33,2,3,48,84,30,224,13,0,0
+,0,198,1,0,128,32,0,0,0,40,0,0,0,40,0,0,0,137,0,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,37,2,3,48,84,30
+,224,13,0,0,0,198,1,0,128,32,0,0,0,40,0,0,0,40,0,0,0,138,0,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,41,2
+,3,48,84,30,224,13,0,0,0,198,1,0,128,32,0,0,0,40,0,0,0,40,0,0,0,139,0,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,45,2,3,48,84,30,224,13,0,0,0,198,1,0,128,32,0,0,0,40,0,0,0,40,0,0,0,140,0,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,49,2,3,48,84,30,224,13,0,0,0,198,1,0,128,32,0,0,0,40,0,0,0,40,0,0
+,0,141,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,53,2,3,48,84,30,224,13,0,0,0,198,1,0,128,32,0,0,0,40,0,0
+,0,40,0,0,0,142,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,57,2,3,48,84,30,224,13,0,0,0,198,1,0,128,32,0,0
+,0,40,0,0,0,40,0,0,0,143,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,61,2,3,48,84,30,224,13,0,0,0,70,8,0
+,128,104,34,0,0,108,35,0,0,108,35,0,0,144,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,65,2,3,48,84,30,224,13,0,0
+,0,70,8,0,128,100,71,0,0,120,75,0,0,120,75,0,0,145,0,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,69,2,3,48,84,30
+,224,13,0,0,0,70,8,0,128,104,34,0,0,108,35,0,0,108,35,0,0,146,0,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,73,2
+,3,48,84,30,224,13,0,0,0,70,8,0,128,232,44,0,0,204,46,0,0,204,46,0,0,147,0,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,77,2,3,48,84,30,224,13,0,0,0,70,2,0,128,244,2,0,0,252,2,0,0,252,2,0,0,148,0,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,81,2,3,48,84,30,224,13,0,0,0,198,1,0,128,180,0,0,0,188,0,0,0,188,0,0
+,0,149,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,85,2,3,48,84,30,224,13,0,0,0,198,1,0,128,72,0,0,0,80,0,0
+,0,80,0,0,0,150,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,89,2,3,48,84,30,224,13,0,0,0,198,1,0,128,28,0,0
+,0,36,0,0,0,36,0,0,0,151,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,93,2,3,48,84,30,224,13,0,0,0,198,1,0
+,128,144,0,0,0,165,0,0,0,165,0,0,0,152,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,97,2,3,48,84,30,224,13,0,0
+,0,6,0,0,128,8,0,0,0,8,0,0,0,8,0,0,0,153,0,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,101,2,3,48,84,30
+,224,13,0,0,0,70,5,0,128,180,6,0,0,128,7,0,0,168,7,0,0,154,0,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,105,2
+,3,48,84,30,224,13,0,0,0,70,5,0,128,152,8,0,0,230,8,0,0,230,8,0,0,155,0,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,109,2,3,48,84,30,224,13,0,0,0,198,4,0,128,120,4,0,0,184,4,0,0,184,4,0,0,156,0,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,113,2,3,48,84,30,224,13,0,0,0,70,9,0,128,200,7,0,0,27,8,0,0,27,8,0
+,0,157,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,117,2,3,48,84,30,224,13,0,0,0,198,11,0,128,160,33,0,0,122,34,0
+,0,122,34,0,0,158,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,121,2,3,48,84,30,224,13,0,0,0,198,1,0,128,28,0,0
+,0,36,0,0,0,36,0,0,0,159,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,125,2,3,48,84,30,224,13,0,0,0,198,1,0
+,128,28,0,0,0,36,0,0,0,36,0,0,0,160,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,129,2,3,48,84,30,224,13,0,0
+,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,161,0,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,133,2,3,48,84,30
+,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,162,0,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,137,2
+,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,163,0,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,141,2,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,164,0,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,145,2,3,48,84,30,224,13,0,0,0,198,2,0,128,44,0,0,0,65,0,0,0,65,0,0
+,0,165,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,149,2,3,48,84,30,224,13,0,0,0,198,1,0,128,28,0,0,0,36,0,0
+,0,36,0,0,0,166,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,153,2,3,48,84,30,224,13,0,0,0,198,1,0,128,136,1,0
+,0,157,1,0,0,157,1,0,0,167,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,157,2,3,48,84,30,224,13,0,0,0,198,2,0
+,128,200,0,0,0,221,0,0,0,221,0,0,0,168,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,161,2,3,48,84,30,224,13,0,0
+,0,198,2,0,128,200,0,0,0,221,0,0,0,221,0,0,0,169,0,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,165,2,3,48,84,30
+,224,13,0,0,0,70,2,0,128,160,0,0,0,181,0,0,0,181,0,0,0,170,0,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,169,2
+,3,48,84,30,224,13,0,0,0,70,2,0,128,160,0,0,0,181,0,0,0,181,0,0,0,171,0,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,173,2,3,48,84,30,224,13,0,0,0,70,2,0,128,160,0,0,0,181,0,0,0,181,0,0,0,172,0,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,177,2,3,48,84,30,224,13,0,0,0,70,2,0,128,160,0,0,0,181,0,0,0,181,0,0
+,0,173,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,181,2,3,48,84,30,224,13,0,0,0,70,2,0,128,172,0,0,0,193,0,0
+,0,193,0,0,0,174,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,185,2,3,48,84,30,224,13,0,0,0,70,2,0,128,172,0,0
+,0,193,0,0,0,193,0,0,0,175,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,189,2,3,48,84,30,224,13,0,0,0,198,2,0
+,128,12,1,0,0,33,1,0,0,33,1,0,0,176,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,193,2,3,48,84,30,224,13,0,0
+,0,198,2,0,128,200,1,0,0,221,1,0,0,221,1,0,0,177,0,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,197,2,3,48,84,30
+,224,13,0,0,0,70,2,0,128,220,0,0,0,241,0,0,0,241,0,0,0,178,0,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,201,2
+,3,48,84,30,224,13,0,0,0,70,2,0,128,120,1,0,0,141,1,0,0,141,1,0,0,179,0,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,205,2,3,48,84,30,224,13,0,0,0,70,2,0,128,220,0,0,0,241,0,0,0,241,0,0,0,180,0,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,209,2,3,48,84,30,224,13,0,0,0,70,2,0,128,120,1,0,0,141,1,0,0,141,1,0
+,0,181,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,213,2,3,48,84,30,224,13,0,0,0,70,2,0,128,220,0,0,0,241,0,0
+,0,241,0,0,0,182,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,217,2,3,48,84,30,224,13,0,0,0,70,2,0,128,136,1,0
+,0,157,1,0,0,157,1,0,0,183,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,221,2,3,48,84,30,224,13,0,0,0,198,1,0
+,128,60,0,0,0,68,0,0,0,68,0,0,0,184,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,225,2,3,48,84,30,224,13,0,0
+,0,6,0,0,128,5,0,0,0,5,0,0,0,5,0,0,0,185,0,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,229,2,3,48,84,30
+,224,13,0,0,0,6,0,0,128,5,0,0,0,5,0,0,0,5,0,0,0,186,0,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,233,2
+,3,48,84,30,224,13,0,0,0,70,2,0,128,152,0,0,0,173,0,0,0,173,0,0,0,187,0,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,237,2,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,188,0,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,241,2,3,48,84,30,224,13,0,0,0,70,3,0,128,116,0,0,0,150,0,0,0,150,0,0
+,0,189,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,245,2,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0
+,0,12,0,0,0,190,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,249,2,3,48,84,30,224,13,0,0,0,70,8,0,128,216,12,0
+,0,216,14,0,0,248,14,0,0,191,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,253,2,3,48,84,30,224,13,0,0,0,70,5,0
+,128,172,3,0,0,194,3,0,0,194,3,0,0,192,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,1,3,3,48,84,30,224,13,0,0
+,0,198,1,0,128,140,0,0,0,148,0,0,0,148,0,0,0,193,0,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,5,3,3,48,84,30
+,224,13,0,0,0,198,1,0,128,208,0,0,0,216,0,0,0,216,0,0,0,194,0,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,9,3
+,3,48,84,30,224,13,0,0,0,198,3,0,128,224,1,0,0,41,2,0,0,41,2,0,0,195,0,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,13,3,3,48,84,30,224,13,0,0,0,70,5,0,128,96,3,0,0,118,3,0,0,118,3,0,0,196,0,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,17,3,3,48,84,30,224,13,0,0,0,198,1,0,128,116,0,0,0,124,0,0,0,124,0,0
+,0,197,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,21,3,3,48,84,30,224,13,0,0,0,198,1,0,128,116,0,0,0,124,0,0
+,0,124,0,0,0,198,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,25,3,3,48,84,30,224,13,0,0,0,198,3,0,128,232,1,0
+,0,49,2,0,0,49,2,0,0,199,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,29,3,3,48,84,30,224,13,0,0,0,6,0,0
+,128,12,0,0,0,12,0,0,0,12,0,0,0,200,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,33,3,3,48,84,30,224,13,0,0
+,0,198,3,0,128,128,2,0,0,162,2,0,0,162,2,0,0,201,0,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,37,3,3,48,84,30
+,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,202,0,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,41,3
+,3,48,84,30,224,13,0,0,0,198,7,0,128,20,10,0,0,182,10,0,0,182,10,0,0,203,0,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,45,3,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,204,0,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,49,3,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0
+,0,205,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,53,3,3,48,84,30,224,13,0,0,0,198,5,0,128,196,3,0,0,74,4,0
+,0,74,4,0,0,206,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,57,3,3,48,84,30,224,13,0,0,0,70,6,0,128,236,8,0
+,0,226,9,0,0,226,9,0,0,207,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,61,3,3,48,84,30,224,13,0,0,0,198,5,0
+,128,228,3,0,0,106,4,0,0,106,4,0,0,208,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,65,3,3,48,84,30,224,13,0,0
+,0,198,3,0,128,236,0,0,0,27,1,0,0,27,1,0,0,209,0,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,69,3,3,48,84,30
+,224,13,0,0,0,198,3,0,128,216,0,0,0,7,1,0,0,7,1,0,0,210,0,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,73,3
+,3,48,84,30,224,13,0,0,0,198,3,0,128,236,0,0,0,27,1,0,0,27,1,0,0,211,0,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,77,3,3,48,84,30,224,13,0,0,0,70,6,0,128,220,14,0,0,252,15,0,0,252,15,0,0,212,0,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,81,3,3,48,84,30,224,13,0,0,0,70,8,0,128,224,15,0,0,228,16,0,0,228,16,0
+,0,213,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,85,3,3,48,84,30,224,13,0,0,0,70,8,0,128,44,15,0,0,48,16,0
+,0,48,16,0,0,214,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,89,3,3,48,84,30,224,13,0,0,0,198,5,0,128,140,1,0
+,0,4,2,0,0,4,2,0,0,215,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,93,3,3,48,84,30,224,13,0,0,0,70,6,0
+,128,184,1,0,0,48,2,0,0,48,2,0,0,216,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,97,3,3,48,84,30,224,13,0,0
+,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,217,0,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,101,3,3,48,84,30
+,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,218,0,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,105,3
+,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,219,0,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,109,3,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,220,0,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,113,3,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0
+,0,221,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,117,3,3,48,84,30,224,13,0,0,0,70,4,0,128,32,2,0,0,92,2,0
+,0,92,2,0,0,222,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,121,3,3,48,84,30,224,13,0,0,0,70,3,0,128,140,0,0
+,0,161,0,0,0,161,0,0,0,223,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,125,3,3,48,84,30,224,13,0,0,0,70,3,0
+,128,132,0,0,0,153,0,0,0,153,0,0,0,224,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,129,3,3,48,84,30,224,13,0,0
+,0,198,1,0,128,12,0,0,0,20,0,0,0,20,0,0,0,225,0,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,133,3,3,48,84,30
+,224,13,0,0,0,70,5,0,128,112,4,0,0,246,4,0,0,246,4,0,0,226,0,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,17,37,2,37
+,137,3,3,48,84,30,224,13,0,0,0,70,5,0,128,112,4,0,0,246,4,0,0,246,4,0,0,227,0,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,147,37,141,3,3,48,84,30,224,13,0,0,0,198,3,0,128,140,0,0,0,187,0,0,0,187,0,0,0,228
+,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,145,3,3,48,84,30,224,13,0,0,0,198,3,0,128,132,0,0,0,179,0,0,0,179
+,0,0,0,229,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,149,3,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12
+,0,0,0,12,0,0,0,230,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,153,3,3,48,84,30,224,13,0,0,0,6,0,0,128,12
+,0,0,0,12,0,0,0,12,0,0,0,231,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,157,3,3,48,84,30,224,13,0,0,0,6
+,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,232,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,161,3,3,48,84,30,224,13
+,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,233,0,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,165,3,3,48
+,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,234,0,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,169,3,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,235,0,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,173,3,3,48,84,30,224,13,0,0,0,70,3,0,128,144,0,0,0,178,0,0,0,178,0,0,0,236
+,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,177,3,3,48,84,30,224,13,0,0,0,70,3,0,128,136,0,0,0,170,0,0,0,170
+,0,0,0,237,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,181,3,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12
+,0,0,0,12,0,0,0,238,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,185,3,3,48,84,30,224,13,0,0,0,6,0,0,128,12
+,0,0,0,12,0,0,0,12,0,0,0,239,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,189,3,3,48,84,30,224,13,0,0,0,6
+,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,240,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,193,3,3,48,84,30,224,13
+,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,241,0,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,197,3,3,48
+,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,242,0,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,201,3,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,243,0,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,205,3,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,244
+,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,209,3,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12
+,0,0,0,245,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,213,3,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12
+,0,0,0,12,0,0,0,246,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,217,3,3,48,84,30,224,13,0,0,0,6,0,0,128,12
+,0,0,0,12,0,0,0,12,0,0,0,247,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,221,3,3,48,84,30,224,13,0,0,0,6
+,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,248,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,225,3,3,48,84,30,224,13
+,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,249,0,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,229,3,3,48
+,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,250,0,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,233,3,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,251,0,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,237,3,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,252
+,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,241,3,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12
+,0,0,0,253,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,245,3,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12
+,0,0,0,12,0,0,0,254,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,249,3,3,48,84,30,224,13,0,0,0,6,0,0,128,12
+,0,0,0,12,0,0,0,12,0,0,0,255,0,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,253,3,3,48,84,30,224,13,0,0,0,6
+,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,0,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,1,4,3,48,84,30,224,13
+,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,1,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,5,4,3,48
+,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,2,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,9,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,3,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,13,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,4
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,17,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12
+,0,0,0,5,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,21,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12
+,0,0,0,12,0,0,0,6,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,25,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12
+,0,0,0,12,0,0,0,12,0,0,0,7,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,29,4,3,48,84,30,224,13,0,0,0,6
+,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,8,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,33,4,3,48,84,30,224,13
+,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,9,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,37,4,3,48
+,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,10,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,41,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,11,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,45,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,12
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,49,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12
+,0,0,0,13,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,53,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12
+,0,0,0,12,0,0,0,14,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,57,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12
+,0,0,0,12,0,0,0,12,0,0,0,15,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,61,4,3,48,84,30,224,13,0,0,0,6
+,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,16,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,65,4,3,48,84,30,224,13
+,0,0,0,70,4,0,128,48,1,0,0,69,1,0,0,69,1,0,0,17,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,69,4,3,48
+,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,18,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,73,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,19,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,77,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,20
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,81,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12
+,0,0,0,21,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,85,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12
+,0,0,0,12,0,0,0,22,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,89,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12
+,0,0,0,12,0,0,0,12,0,0,0,23,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,93,4,3,48,84,30,224,13,0,0,0,6
+,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,24,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,97,4,3,48,84,30,224,13
+,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,25,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,101,4,3,48
+,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,26,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,105,4,3,48,84,30,224,13,0,0,0,70,3,0,128,192,0,0,0,239,0,0,0,239,0,0,0,27,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,109,4,3,48,84,30,224,13,0,0,0,70,3,0,128,192,0,0,0,239,0,0,0,239,0,0,0,28
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,113,4,3,48,84,30,224,13,0,0,0,70,3,0,128,192,0,0,0,239,0,0,0,239
+,0,0,0,29,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,117,4,3,48,84,30,224,13,0,0,0,70,3,0,128,192,0,0,0,239
+,0,0,0,239,0,0,0,30,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,121,4,3,48,84,30,224,13,0,0,0,70,3,0,128,164
+,0,0,0,211,0,0,0,211,0,0,0,31,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,125,4,3,48,84,30,224,13,0,0,0,70
+,3,0,128,192,0,0,0,239,0,0,0,239,0,0,0,32,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,129,4,3,48,84,30,224,13
+,0,0,0,70,3,0,128,192,0,0,0,239,0,0,0,239,0,0,0,33,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,133,4,3,48
+,84,30,224,13,0,0,0,70,3,0,128,192,0,0,0,239,0,0,0,239,0,0,0,34,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,137,4,3,48,84,30,224,13,0,0,0,70,3,0,128,108,0,0,0,142,0,0,0,142,0,0,0,35,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,141,4,3,48,84,30,224,13,0,0,0,70,3,0,128,164,0,0,0,211,0,0,0,211,0,0,0,36
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,145,4,3,48,84,30,224,13,0,0,0,70,3,0,128,164,0,0,0,211,0,0,0,211
+,0,0,0,37,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,149,4,3,48,84,30,224,13,0,0,0,70,3,0,128,164,0,0,0,211
+,0,0,0,211,0,0,0,38,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,153,4,3,48,84,30,224,13,0,0,0,70,3,0,128,164
+,0,0,0,211,0,0,0,211,0,0,0,39,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,157,4,3,48,84,30,224,13,0,0,0,70
+,3,0,128,164,0,0,0,211,0,0,0,211,0,0,0,40,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,161,4,3,48,84,30,224,13
+,0,0,0,70,3,0,128,164,0,0,0,211,0,0,0,211,0,0,0,41,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,165,4,3,48
+,84,30,224,13,0,0,0,70,3,0,128,164,0,0,0,211,0,0,0,211,0,0,0,42,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,169,4,3,48,84,30,224,13,0,0,0,70,3,0,128,164,0,0,0,211,0,0,0,211,0,0,0,43,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,173,4,3,48,84,30,224,13,0,0,0,70,3,0,128,164,0,0,0,211,0,0,0,211,0,0,0,44
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,177,4,3,48,84,30,224,13,0,0,0,70,3,0,128,108,0,0,0,142,0,0,0,142
+,0,0,0,45,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,181,4,3,48,84,30,224,13,0,0,0,70,3,0,128,104,1,0,0,216
+,1,0,0,216,1,0,0,46,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,185,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12
+,0,0,0,12,0,0,0,12,0,0,0,47,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,189,4,3,48,84,30,224,13,0,0,0,6
+,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,48,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,193,4,3,48,84,30,224,13
+,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,49,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,197,4,3,48
+,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,50,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,201,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,51,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,205,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,52
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,209,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12
+,0,0,0,53,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,213,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12
+,0,0,0,12,0,0,0,54,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,217,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12
+,0,0,0,12,0,0,0,12,0,0,0,55,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,221,4,3,48,84,30,224,13,0,0,0,6
+,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,56,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,225,4,3,48,84,30,224,13
+,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,57,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,229,4,3,48
+,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,58,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,233,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,59,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,237,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,60
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,241,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12
+,0,0,0,61,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,245,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12
+,0,0,0,12,0,0,0,62,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,249,4,3,48,84,30,224,13,0,0,0,6,0,0,128,12
+,0,0,0,12,0,0,0,12,0,0,0,63,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,253,4,3,48,84,30,224,13,0,0,0,6
+,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,64,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,1,5,3,48,84,30,224,13
+,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,65,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,5,5,3,48
+,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,66,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,9,5,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,67,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,13,5,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,68
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,17,5,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12
+,0,0,0,69,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,21,5,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12
+,0,0,0,12,0,0,0,70,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,25,5,3,48,84,30,224,13,0,0,0,6,0,0,128,12
+,0,0,0,12,0,0,0,12,0,0,0,71,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,29,5,3,48,84,30,224,13,0,0,0,6
+,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,72,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,33,5,3,48,84,30,224,13
+,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,73,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,37,5,3,48
+,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,74,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,41,5,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,75,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,45,5,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,76
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,49,5,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12
+,0,0,0,77,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,53,5,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12
+,0,0,0,12,0,0,0,78,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,57,5,3,48,84,30,224,13,0,0,0,6,0,0,128,12
+,0,0,0,12,0,0,0,12,0,0,0,79,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,61,5,3,48,84,30,224,13,0,0,0,6
+,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,80,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,65,5,3,48,84,30,224,13
+,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,81,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,69,5,3,48
+,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,82,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,73,5,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,83,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,77,5,3,48,84,30,224,13,0,0,0,6,0,0,128,64,0,0,0,64,0,0,0,64,0,0,0,84
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,81,5,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12
+,0,0,0,85,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,85,5,3,48,84,30,224,13,0,0,0,198,6,0,128,60,3,0,0,124
+,3,0,0,124,3,0,0,86,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,89,5,3,48,84,30,224,13,0,0,0,6,0,0,128,47
+,0,0,0,47,0,0,0,47,0,0,0,87,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,93,5,3,48,84,30,224,13,0,0,0,70
+,3,0,128,104,1,0,0,151,1,0,0,151,1,0,0,88,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,97,5,3,48,84,30,224,13
+,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,89,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,101,5,3,48
+,84,30,224,13,0,0,0,198,3,0,128,180,0,0,0,201,0,0,0,201,0,0,0,90,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,105,5,3,48,84,30,224,13,0,0,0,70,5,0,128,240,2,0,0,62,3,0,0,62,3,0,0,91,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,109,5,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,92
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,113,5,3,48,84,30,224,13,0,0,0,70,4,0,128,164,1,0,0,8,2,0,0,16
+,2,0,0,93,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,117,5,3,48,84,30,224,13,0,0,0,70,4,0,128,172,1,0,0,16
+,2,0,0,24,2,0,0,94,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,121,5,3,48,84,30,224,13,0,0,0,70,4,0,128,180
+,1,0,0,24,2,0,0,32,2,0,0,95,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,125,5,3,48,84,30,224,13,0,0,0,6
+,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,96,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,129,5,3,48,84,30,224,13
+,0,0,0,198,1,0,128,36,0,0,0,57,0,0,0,57,0,0,0,97,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,133,5,3,48
+,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,98,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,137,5,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,99,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,141,5,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,100
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,145,5,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12
+,0,0,0,101,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,149,5,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12
+,0,0,0,12,0,0,0,102,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,153,5,3,48,84,30,224,13,0,0,0,6,0,0,128,12
+,0,0,0,12,0,0,0,12,0,0,0,103,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,157,5,3,48,84,30,224,13,0,0,0,6
+,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,104,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,161,5,3,48,84,30,224,13
+,0,0,0,70,3,0,128,124,0,0,0,145,0,0,0,145,0,0,0,105,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,165,5,3,48
+,84,30,224,13,0,0,0,70,3,0,128,116,0,0,0,137,0,0,0,137,0,0,0,106,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,169,5,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,107,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,173,5,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,108
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,177,5,3,48,84,30,224,13,0,0,0,198,2,0,128,196,14,0,0,217,14,0,0,217
+,14,0,0,109,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,181,5,3,48,84,30,224,13,0,0,0,198,3,0,128,168,12,0,0,189
+,12,0,0,189,12,0,0,110,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,185,5,3,48,84,30,224,13,0,0,0,198,3,0,128,228
+,12,0,0,249,12,0,0,249,12,0,0,111,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,189,5,3,48,84,30,224,13,0,0,0,198
+,1,0,128,44,0,0,0,52,0,0,0,52,0,0,0,112,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,193,5,3,48,84,30,224,13
+,0,0,0,198,1,0,128,44,0,0,0,52,0,0,0,52,0,0,0,113,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,197,5,3,48
+,84,30,224,13,0,0,0,70,6,0,128,40,25,0,0,58,26,0,0,58,26,0,0,114,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,201,5,3,48,84,30,224,13,0,0,0,198,5,0,128,132,46,0,0,48,48,0,0,48,48,0,0,115,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,205,5,3,48,84,30,224,13,0,0,0,198,1,0,128,44,0,0,0,52,0,0,0,52,0,0,0,116
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,209,5,3,48,84,30,224,13,0,0,0,198,1,0,128,44,0,0,0,52,0,0,0,52
+,0,0,0,117,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,213,5,3,48,84,30,224,13,0,0,0,70,6,0,128,240,20,0,0,104
+,21,0,0,104,21,0,0,118,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,217,5,3,48,84,30,224,13,0,0,0,198,1,0,128,44
+,0,0,0,52,0,0,0,52,0,0,0,119,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,221,5,3,48,84,30,224,13,0,0,0,70
+,6,0,128,180,21,0,0,44,22,0,0,44,22,0,0,120,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,225,5,3,48,84,30,224,13
+,0,0,0,198,1,0,128,44,0,0,0,52,0,0,0,52,0,0,0,121,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,229,5,3,48
+,84,30,224,13,0,0,0,70,6,0,128,56,23,0,0,176,23,0,0,176,23,0,0,122,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,233,5,3,48,84,30,224,13,0,0,0,198,1,0,128,44,0,0,0,52,0,0,0,52,0,0,0,123,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,237,5,3,48,84,30,224,13,0,0,0,198,1,0,128,124,1,0,0,132,1,0,0,132,1,0,0,124
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,241,5,3,48,84,30,224,13,0,0,0,70,2,0,128,32,9,0,0,53,9,0,0,53
+,9,0,0,125,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,245,5,3,48,84,30,224,13,0,0,0,70,2,0,128,12,9,0,0,33
+,9,0,0,33,9,0,0,126,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,249,5,3,48,84,30,224,13,0,0,0,198,1,0,128,44
+,0,0,0,52,0,0,0,52,0,0,0,127,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,253,5,3,48,84,30,224,13,0,0,0,198
+,1,0,128,44,0,0,0,52,0,0,0,52,0,0,0,128,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,1,6,3,48,84,30,224,13
+,0,0,0,70,6,0,128,60,7,0,0,236,7,0,0,236,7,0,0,129,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,5,6,3,48
+,84,30,224,13,0,0,0,70,7,0,128,84,8,0,0,218,8,0,0,218,8,0,0,130,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,9,6,3,48,84,30,224,13,0,0,0,70,6,0,128,132,8,0,0,168,8,0,0,168,8,0,0,131,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,13,6,3,48,84,30,224,13,0,0,0,70,5,0,128,156,8,0,0,234,8,0,0,234,8,0,0,132
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,17,6,3,48,84,30,224,13,0,0,0,198,6,0,128,176,5,0,0,138,6,0,0,138
+,6,0,0,133,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,21,6,3,48,84,30,224,13,0,0,0,198,2,0,128,96,2,0,0,169
+,2,0,0,169,2,0,0,134,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,25,6,3,48,84,30,224,13,0,0,0,198,1,0,128,92
+,0,0,0,100,0,0,0,100,0,0,0,135,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,29,6,3,48,84,30,224,13,0,0,0,70
+,7,0,128,0,4,0,0,190,4,0,0,190,4,0,0,136,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,33,6,3,48,84,30,224,13
+,0,0,0,198,6,0,128,136,6,0,0,168,7,0,0,192,7,0,0,137,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,37,6,3,48
+,84,30,224,13,0,0,0,70,4,0,128,196,4,0,0,217,4,0,0,217,4,0,0,138,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,41,6,3,48,84,30,224,13,0,0,0,198,8,0,128,76,18,0,0,84,20,0,0,132,20,0,0,139,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,45,6,3,48,84,30,224,13,0,0,0,70,6,0,128,12,8,0,0,160,8,0,0,160,8,0,0,140
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,49,6,3,48,84,30,224,13,0,0,0,70,5,0,128,248,5,0,0,126,6,0,0,126
+,6,0,0,141,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,53,6,3,48,84,30,224,13,0,0,0,198,3,0,128,180,0,0,0,227
+,0,0,0,227,0,0,0,142,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,57,6,3,48,84,30,224,13,0,0,0,70,3,0,128,148
+,0,0,0,195,0,0,0,195,0,0,0,143,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,61,6,3,48,84,30,224,13,0,0,0,6
+,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,144,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,65,6,3,48,84,30,224,13
+,0,0,0,198,3,0,128,244,0,0,0,35,1,0,0,35,1,0,0,145,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,69,6,3,48
+,84,30,224,13,0,0,0,70,3,0,128,128,0,0,0,162,0,0,0,162,0,0,0,146,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,73,6,3,48,84,30,224,13,0,0,0,70,6,0,128,8,2,0,0,86,2,0,0,86,2,0,0,147,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,77,6,3,48,84,30,224,13,0,0,0,198,3,0,128,244,0,0,0,35,1,0,0,35,1,0,0,148
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,81,6,3,48,84,30,224,13,0,0,0,198,3,0,128,244,0,0,0,35,1,0,0,35
+,1,0,0,149,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,85,6,3,48,84,30,224,13,0,0,0,70,4,0,128,96,3,0,0,169
+,3,0,0,169,3,0,0,150,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,89,6,3,48,84,30,224,13,0,0,0,198,5,0,128,208
+,4,0,0,58,5,0,0,58,5,0,0,151,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,93,6,3,48,84,30,224,13,0,0,0,70
+,3,0,128,232,0,0,0,23,1,0,0,23,1,0,0,152,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,97,6,3,48,84,30,224,13
+,0,0,0,70,3,0,128,168,1,0,0,215,1,0,0,215,1,0,0,153,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,101,6,3,48
+,84,30,224,13,0,0,0,70,3,0,128,168,1,0,0,215,1,0,0,215,1,0,0,154,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,105,6,3,48,84,30,224,13,0,0,0,198,3,0,128,36,1,0,0,57,1,0,0,57,1,0,0,155,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,109,6,3,48,84,30,224,13,0,0,0,70,5,0,128,172,1,0,0,222,1,0,0,222,1,0,0,156
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,113,6,3,48,84,30,224,13,0,0,0,70,5,0,128,184,1,0,0,234,1,0,0,234
+,1,0,0,157,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,117,6,3,48,84,30,224,13,0,0,0,198,3,0,128,112,1,0,0,172
+,1,0,0,172,1,0,0,158,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,121,6,3,48,84,30,224,13,0,0,0,70,3,0,128,12
+,1,0,0,59,1,0,0,59,1,0,0,159,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,125,6,3,48,84,30,224,13,0,0,0,70
+,3,0,128,236,1,0,0,27,2,0,0,27,2,0,0,160,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,129,6,3,48,84,30,224,13
+,0,0,0,70,3,0,128,168,1,0,0,215,1,0,0,215,1,0,0,161,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,133,6,3,48
+,84,30,224,13,0,0,0,198,1,0,128,76,0,0,0,97,0,0,0,97,0,0,0,162,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,137,6,3,48,84,30,224,13,0,0,0,198,4,0,128,0,2,0,0,92,2,0,0,92,2,0,0,163,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,141,6,3,48,84,30,224,13,0,0,0,198,2,0,128,92,0,0,0,113,0,0,0,113,0,0,0,164
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,145,6,3,48,84,30,224,13,0,0,0,198,2,0,128,88,1,0,0,109,1,0,0,109
+,1,0,0,165,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,149,6,3,48,84,30,224,13,0,0,0,198,2,0,128,84,0,0,0,105
+,0,0,0,105,0,0,0,166,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,153,6,3,48,84,30,224,13,0,0,0,198,2,0,128,120
+,1,0,0,141,1,0,0,141,1,0,0,167,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,157,6,3,48,84,30,224,13,0,0,0,70
+,3,0,128,180,0,0,0,227,0,0,0,227,0,0,0,168,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,161,6,3,48,84,30,224,13
+,0,0,0,70,3,0,128,68,0,0,0,102,0,0,0,102,0,0,0,169,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,165,6,3,48
+,84,30,224,13,0,0,0,198,1,0,128,36,1,0,0,57,1,0,0,57,1,0,0,170,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,169,6,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,171,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,173,6,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,172
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,177,6,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12
+,0,0,0,173,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,181,6,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12
+,0,0,0,12,0,0,0,174,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,185,6,3,48,84,30,224,13,0,0,0,6,0,0,128,12
+,0,0,0,12,0,0,0,12,0,0,0,175,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,189,6,3,48,84,30,224,13,0,0,0,70
+,3,0,128,144,0,0,0,178,0,0,0,178,0,0,0,176,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,193,6,3,48,84,30,224,13
+,0,0,0,70,3,0,128,48,3,0,0,212,3,0,0,212,3,0,0,177,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,197,6,3,48
+,84,30,224,13,0,0,0,70,3,0,128,164,1,0,0,237,1,0,0,237,1,0,0,178,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,201,6,3,48,84,30,224,13,0,0,0,198,3,0,128,52,2,0,0,138,2,0,0,138,2,0,0,179,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,205,6,3,48,84,30,224,13,0,0,0,70,3,0,128,224,1,0,0,41,2,0,0,41,2,0,0,180
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,209,6,3,48,84,30,224,13,0,0,0,70,3,0,128,28,2,0,0,101,2,0,0,101
+,2,0,0,181,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,213,6,3,48,84,30,224,13,0,0,0,70,3,0,128,40,2,0,0,139
+,2,0,0,139,2,0,0,182,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,217,6,3,48,84,30,224,13,0,0,0,198,3,0,128,164
+,1,0,0,224,1,0,0,224,1,0,0,183,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,221,6,3,48,84,30,224,13,0,0,0,198
+,3,0,128,164,1,0,0,224,1,0,0,224,1,0,0,184,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,225,6,3,48,84,30,224,13
+,0,0,0,198,3,0,128,164,1,0,0,224,1,0,0,224,1,0,0,185,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,229,6,3,48
+,84,30,224,13,0,0,0,198,3,0,128,172,1,0,0,232,1,0,0,232,1,0,0,186,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,233,6,3,48,84,30,224,13,0,0,0,198,3,0,128,172,1,0,0,232,1,0,0,232,1,0,0,187,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,237,6,3,48,84,30,224,13,0,0,0,198,3,0,128,24,2,0,0,97,2,0,0,97,2,0,0,188
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,241,6,3,48,84,30,224,13,0,0,0,70,3,0,128,48,3,0,0,34,4,0,0,34
+,4,0,0,189,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,245,6,3,48,84,30,224,13,0,0,0,70,3,0,128,48,3,0,0,34
+,4,0,0,34,4,0,0,190,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,249,6,3,48,84,30,224,13,0,0,0,70,3,0,128,48
+,3,0,0,34,4,0,0,34,4,0,0,191,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,253,6,3,48,84,30,224,13,0,0,0,70
+,3,0,128,48,3,0,0,34,4,0,0,34,4,0,0,192,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,1,7,3,48,84,30,224,13
+,0,0,0,70,3,0,128,56,3,0,0,168,3,0,0,168,3,0,0,193,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,5,7,3,48
+,84,30,224,13,0,0,0,198,1,0,128,72,1,0,0,93,1,0,0,93,1,0,0,194,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,9,7,3,48,84,30,224,13,0,0,0,198,1,0,128,204,0,0,0,212,0,0,0,212,0,0,0,195,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,13,7,3,48,84,30,224,13,0,0,0,198,1,0,128,80,1,0,0,101,1,0,0,101,1,0,0,196
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,17,7,3,48,84,30,224,13,0,0,0,70,2,0,128,124,0,0,0,158,0,0,0,158
+,0,0,0,197,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,21,7,3,48,84,30,224,13,0,0,0,70,2,0,128,124,0,0,0,158
+,0,0,0,158,0,0,0,198,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,25,7,3,48,84,30,224,13,0,0,0,70,2,0,128,124
+,0,0,0,158,0,0,0,158,0,0,0,199,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,29,7,3,48,84,30,224,13,0,0,0,70
+,2,0,128,72,1,0,0,132,1,0,0,132,1,0,0,200,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,33,7,3,48,84,30,224,13
+,0,0,0,198,4,0,128,88,1,0,0,152,1,0,0,152,1,0,0,201,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,37,7,3,48
+,84,30,224,13,0,0,0,70,5,0,128,24,1,0,0,74,1,0,0,74,1,0,0,202,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,41,7,3,48,84,30,224,13,0,0,0,198,4,0,128,112,3,0,0,176,3,0,0,176,3,0,0,203,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,45,7,3,48,84,30,224,13,0,0,0,70,3,0,128,224,2,0,0,15,3,0,0,15,3,0,0,204
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,49,7,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12
+,0,0,0,205,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,53,7,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12
+,0,0,0,12,0,0,0,206,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,57,7,3,48,84,30,224,13,0,0,0,6,0,0,128,12
+,0,0,0,12,0,0,0,12,0,0,0,207,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,61,7,3,48,84,30,224,13,0,0,0,6
+,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,208,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,65,7,3,48,84,30,224,13
+,0,0,0,70,8,0,128,20,6,0,0,168,6,0,0,168,6,0,0,209,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,69,7,3,48
+,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,210,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,73,7,3,48,84,30,224,13,0,0,0,70,6,0,128,164,22,0,0,84,23,0,0,84,23,0,0,211,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,77,7,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,212
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,81,7,3,48,84,30,224,13,0,0,0,198,4,0,128,176,2,0,0,12,3,0,0,12
+,3,0,0,213,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,85,7,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12
+,0,0,0,12,0,0,0,214,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,89,7,3,48,84,30,224,13,0,0,0,198,2,0,128,112
+,1,0,0,133,1,0,0,133,1,0,0,215,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,93,7,3,48,84,30,224,13,0,0,0,6
+,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,216,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,97,7,3,48,84,30,224,13
+,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,217,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,101,7,3,48
+,84,30,224,13,0,0,0,198,4,0,128,104,2,0,0,182,2,0,0,182,2,0,0,218,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,105,7,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,219,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,109,7,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,220
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,113,7,3,48,84,30,224,13,0,0,0,70,3,0,128,64,0,0,0,98,0,0,0,98
+,0,0,0,221,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,117,7,3,48,84,30,224,13,0,0,0,70,3,0,128,80,0,0,0,114
+,0,0,0,114,0,0,0,222,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,121,7,3,48,84,30,224,13,0,0,0,198,4,0,128,244
+,6,0,0,52,7,0,0,52,7,0,0,223,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,125,7,3,48,84,30,224,13,0,0,0,70
+,3,0,128,196,0,0,0,243,0,0,0,243,0,0,0,224,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,129,7,3,48,84,30,224,13
+,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,225,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,133,7,3,48
+,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,226,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,137,7,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,227,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,141,7,3,48,84,30,224,13,0,0,0,70,3,0,128,172,0,0,0,232,0,0,0,232,0,0,0,228
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,145,7,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12
+,0,0,0,229,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,149,7,3,48,84,30,224,13,0,0,0,70,3,0,128,140,4,0,0,48
+,5,0,0,48,5,0,0,230,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,153,7,3,48,84,30,224,13,0,0,0,198,7,0,128,32
+,5,0,0,166,5,0,0,166,5,0,0,231,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,157,7,3,48,84,30,224,13,0,0,0,198
+,1,0,128,76,1,0,0,97,1,0,0,97,1,0,0,232,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,161,7,3,48,84,30,224,13
+,0,0,0,70,3,0,128,84,1,0,0,170,1,0,0,170,1,0,0,233,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,165,7,3,48
+,84,30,224,13,0,0,0,198,1,0,128,4,1,0,0,12,1,0,0,12,1,0,0,234,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,169,7,3,48,84,30,224,13,0,0,0,70,5,0,128,176,8,0,0,240,8,0,0,240,8,0,0,235,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,146,37,173,7,3,48,84,30,224,13,0,0,0,70,3,0,128,216,2,0,0,237,2,0,0,237,2,0,0,236
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,146,37,177,7,3,48,84,30,224,13,0,0,0,70,3,0,128,124,3,0,0,145,3,0,0,145
+,3,0,0,237,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,181,7,3,48,84,30,224,13,0,0,0,198,3,0,128,240,1,0,0,32
+,2,0,0,40,2,0,0,238,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,147,37,185,7,3,48,84,30,224,13,0,0,0,70,3,0,128,112
+,0,0,0,159,0,0,0,159,0,0,0,239,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,189,7,3,48,84,30,224,13,0,0,0,70
+,3,0,128,108,0,0,0,155,0,0,0,155,0,0,0,240,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,193,7,3,48,84,30,224,13
+,0,0,0,70,3,0,128,36,1,0,0,70,1,0,0,70,1,0,0,241,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,197,7,3,48
+,84,30,224,13,0,0,0,198,5,0,128,188,7,0,0,108,8,0,0,108,8,0,0,242,1,0,0,73,186,0,0,0
+,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37
+,201,7,3,48,84,30,224,13,0,0,0,70,3,0,128,88,0,0,0,122,0,0,0,122,0,0,0,243,1,0,0,73
+,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145
+,93,150,147,37,205,7,3,48,84,30,224,13,0,0,0,70,7,0,128,124,9,0,0,144,10,0,0,152,10,0,0,244
+,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,145,93,150,147,37,209,7,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12
+,0,0,0,245,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,145,93,150,146,37,213,7,3,48,84,30,224,13,0,0,0,198,5,0,128,4,6,0,0,194
+,6,0,0,194,6,0,0,246,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,217,7,3,48,84,30,224,13,0,0,0,198,4,0,128,140
+,3,0,0,204,3,0,0,204,3,0,0,247,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,221,7,3,48,84,30,224,13,0,0,0,70
+,3,0,128,188,0,0,0,248,0,0,0,248,0,0,0,248,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,225,7,3,48,84,30,224,13
+,0,0,0,198,2,0,128,20,1,0,0,68,1,0,0,92,1,0,0,249,1,0,0,73,186,0,0,0,0,0,0,0
+,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,19,181,3,37,229,7
+,3,48,84,30,224,13,0,0,0,198,2,0,128,164,0,0,0,188,0,0,0,204,0,0,0,250,1,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,147,37,233,7,3,48,84,30,224,13,0,0,0,70,6,0,128,244,3,0,0,68,4,0,0,76,4,0,0,251,1,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,237,7,3,48,84,30,224,13,0,0,0,70,3,0,128,128,0,0,0,175,0,0,0,175,0,0
+,0,252,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,241,7,3,48,84,30,224,13,0,0,0,198,3,0,128,188,1,0,0,18,2,0
+,0,18,2,0,0,253,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,245,7,3,48,84,30,224,13,0,0,0,70,4,0,128,176,1,0
+,0,19,2,0,0,19,2,0,0,254,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,249,7,3,48,84,30,224,13,0,0,0,198,5,0
+,128,96,5,0,0,16,6,0,0,16,6,0,0,255,1,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,253,7,3,48,84,30,224,13,0,0
+,0,70,6,0,128,224,2,0,0,88,3,0,0,88,3,0,0,0,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,1,8,3,48,84,30
+,224,13,0,0,0,70,6,0,128,224,2,0,0,88,3,0,0,88,3,0,0,1,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,5,8
+,3,48,84,30,224,13,0,0,0,70,3,0,128,60,0,0,0,81,0,0,0,81,0,0,0,2,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,9,8,3,48,84,30,224,13,0,0,0,70,3,0,128,72,0,0,0,106,0,0,0,106,0,0,0,3,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,13,8,3,48,84,30,224,13,0,0,0,70,9,0,128,116,14,0,0,124,16,0,0,12,17,0
+,0,4,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,147,37,17,8,3,48,84,30,224,13,0,0,0,70,6,0,128,16,4,0,0,80,4,0
+,0,80,4,0,0,5,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,21,8,3,48,84,30,224,13,0,0,0,198,7,0,128,16,5,0
+,0,92,6,0,0,220,6,0,0,6,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,147,37,25,8,3,48,84,30,224,13,0,0,0,198,9,0
+,128,184,15,0,0,208,17,0,0,96,18,0,0,7,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,29,8,3,48,84,30,224,13,0,0
+,0,198,6,0,128,4,5,0,0,110,5,0,0,110,5,0,0,8,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,33,8,3,48,84,30
+,224,13,0,0,0,198,6,0,128,12,5,0,0,118,5,0,0,118,5,0,0,9,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,37,8
+,3,48,84,30,224,13,0,0,0,70,4,0,128,220,0,0,0,11,1,0,0,11,1,0,0,10,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,41,8,3,48,84,30,224,13,0,0,0,70,3,0,128,116,0,0,0,163,0,0,0,163,0,0,0,11,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,45,8,3,48,84,30,224,13,0,0,0,70,3,0,128,112,0,0,0,159,0,0,0,159,0,0
+,0,12,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,49,8,3,48,84,30,224,13,0,0,0,6,0,0,128,51,0,0,0,51,0,0
+,0,51,0,0,0,13,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,53,8,3,48,84,30,224,13,0,0,0,6,0,0,128,57,0,0
+,0,57,0,0,0,57,0,0,0,14,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,57,8,3,48,84,30,224,13,0,0,0,6,0,0
+,128,12,0,0,0,12,0,0,0,12,0,0,0,15,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,61,8,3,48,84,30,224,13,0,0
+,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,16,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,65,8,3,48,84,30
+,224,13,0,0,0,70,3,0,128,120,0,0,0,167,0,0,0,167,0,0,0,17,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,69,8
+,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,18,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,73,8,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,19,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,77,8,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0
+,0,20,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,81,8,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0
+,0,12,0,0,0,21,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,85,8,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0
+,0,12,0,0,0,12,0,0,0,22,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,89,8,3,48,84,30,224,13,0,0,0,6,0,0
+,128,12,0,0,0,12,0,0,0,12,0,0,0,23,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,93,8,3,48,84,30,224,13,0,0
+,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,24,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,97,8,3,48,84,30
+,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,25,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,101,8
+,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,26,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,105,8,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,27,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,109,8,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0
+,0,28,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,113,8,3,48,84,30,224,13,0,0,0,198,8,0,128,48,9,0,0,70,10,0
+,0,70,10,0,0,29,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,117,8,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0
+,0,12,0,0,0,12,0,0,0,30,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,121,8,3,48,84,30,224,13,0,0,0,6,0,0
+,128,12,0,0,0,12,0,0,0,12,0,0,0,31,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,125,8,3,48,84,30,224,13,0,0
+,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,32,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,129,8,3,48,84,30
+,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,33,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,133,8
+,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,34,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,137,8,3,48,84,30,224,13,0,0,0,70,7,0,128,20,4,0,0,154,4,0,0,154,4,0,0,35,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,141,8,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0
+,0,36,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,145,8,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0
+,0,12,0,0,0,37,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,149,8,3,48,84,30,224,13,0,0,0,70,3,0,128,32,1,0
+,0,53,1,0,0,53,1,0,0,38,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,153,8,3,48,84,30,224,13,0,0,0,198,4,0
+,128,16,4,0,0,80,4,0,0,80,4,0,0,39,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,157,8,3,48,84,30,224,13,0,0
+,0,6,0,0,128,7,0,0,0,7,0,0,0,7,0,0,0,40,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,161,8,3,48,84,30
+,224,13,0,0,0,70,6,0,128,84,12,0,0,200,13,0,0,224,13,0,0,41,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,165,8
+,3,48,84,30,224,13,0,0,0,70,4,0,128,244,4,0,0,100,5,0,0,100,5,0,0,42,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,169,8,3,48,84,30,224,13,0,0,0,198,5,0,128,216,6,0,0,108,7,0,0,108,7,0,0,43,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,173,8,3,48,84,30,224,13,0,0,0,70,5,0,128,196,5,0,0,74,6,0,0,74,6,0
+,0,44,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,177,8,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0
+,0,12,0,0,0,45,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,181,8,3,48,84,30,224,13,0,0,0,198,3,0,128,244,0,0
+,0,35,1,0,0,35,1,0,0,46,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,185,8,3,48,84,30,224,13,0,0,0,70,3,0
+,128,128,0,0,0,162,0,0,0,162,0,0,0,47,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,189,8,3,48,84,30,224,13,0,0
+,0,70,6,0,128,216,1,0,0,38,2,0,0,38,2,0,0,48,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,193,8,3,48,84,30
+,224,13,0,0,0,198,3,0,128,244,0,0,0,35,1,0,0,35,1,0,0,49,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,197,8
+,3,48,84,30,224,13,0,0,0,70,4,0,128,24,3,0,0,97,3,0,0,97,3,0,0,50,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,201,8,3,48,84,30,224,13,0,0,0,198,5,0,128,136,4,0,0,242,4,0,0,242,4,0,0,51,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,205,8,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0
+,0,52,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,209,8,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0
+,0,12,0,0,0,53,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,213,8,3,48,84,30,224,13,0,0,0,198,4,0,128,168,4,0
+,0,60,5,0,0,60,5,0,0,54,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,217,8,3,48,84,30,224,13,0,0,0,198,5,0
+,128,40,3,0,0,174,3,0,0,174,3,0,0,55,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,221,8,3,48,84,30,224,13,0,0
+,0,70,5,0,128,36,6,0,0,240,6,0,0,240,6,0,0,56,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,225,8,3,48,84,30
+,224,13,0,0,0,70,6,0,128,212,7,0,0,216,8,0,0,216,8,0,0,57,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,229,8
+,3,48,84,30,224,13,0,0,0,70,5,0,128,136,6,0,0,84,7,0,0,84,7,0,0,58,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,233,8,3,48,84,30,224,13,0,0,0,70,5,0,128,136,6,0,0,84,7,0,0,84,7,0,0,59,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,237,8,3,48,84,30,224,13,0,0,0,70,5,0,128,136,6,0,0,84,7,0,0,84,7,0
+,0,60,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,241,8,3,48,84,30,224,13,0,0,0,70,5,0,128,136,6,0,0,84,7,0
+,0,84,7,0,0,61,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,245,8,3,48,84,30,224,13,0,0,0,70,5,0,128,136,6,0
+,0,84,7,0,0,84,7,0,0,62,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,249,8,3,48,84,30,224,13,0,0,0,6,0,0
+,128,12,0,0,0,12,0,0,0,12,0,0,0,63,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,253,8,3,48,84,30,224,13,0,0
+,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,64,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,1,9,3,48,84,30
+,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,65,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,5,9
+,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,66,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,9,9,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,67,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,13,9,3,48,84,30,224,13,0,0,0,70,8,0,128,16,7,0,0,192,7,0,0,192,7,0
+,0,68,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,17,9,3,48,84,30,224,13,0,0,0,70,6,0,128,172,6,0,0,36,7,0
+,0,36,7,0,0,69,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,21,9,3,48,84,30,224,13,0,0,0,70,6,0,128,204,5,0
+,0,68,6,0,0,68,6,0,0,70,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,25,9,3,48,84,30,224,13,0,0,0,6,0,0
+,128,12,0,0,0,12,0,0,0,12,0,0,0,71,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,29,9,3,48,84,30,224,13,0,0
+,0,70,5,0,128,180,3,0,0,100,4,0,0,100,4,0,0,72,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,33,9,3,48,84,30
+,224,13,0,0,0,70,8,0,128,196,10,0,0,112,12,0,0,112,12,0,0,73,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,37,9
+,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,74,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,41,9,3,48,84,30,224,13,0,0,0,198,6,0,128,240,4,0,0,44,6,0,0,44,6,0,0,75,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,45,9,3,48,84,30,224,13,0,0,0,70,5,0,128,180,3,0,0,100,4,0,0,100,4,0
+,0,76,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,49,9,3,48,84,30,224,13,0,0,0,70,8,0,128,64,11,0,0,82,12,0
+,0,82,12,0,0,77,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,53,9,3,48,84,30,224,13,0,0,0,70,6,0,128,84,14,0
+,0,172,15,0,0,172,15,0,0,78,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,57,9,3,48,84,30,224,13,0,0,0,70,6,0
+,128,140,16,0,0,214,17,0,0,214,17,0,0,79,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,61,9,3,48,84,30,224,13,0,0
+,0,198,5,0,128,76,15,0,0,150,16,0,0,150,16,0,0,80,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,65,9,3,48,84,30
+,224,13,0,0,0,70,6,0,128,80,15,0,0,154,16,0,0,154,16,0,0,81,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,69,9
+,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,82,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,73,9,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,83,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,77,9,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0
+,0,84,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,81,9,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0
+,0,12,0,0,0,85,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,85,9,3,48,84,30,224,13,0,0,0,70,3,0,128,144,0,0
+,0,178,0,0,0,178,0,0,0,86,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,89,9,3,48,84,30,224,13,0,0,0,70,3,0
+,128,136,0,0,0,170,0,0,0,170,0,0,0,87,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,93,9,3,48,84,30,224,13,0,0
+,0,70,3,0,128,156,0,0,0,203,0,0,0,203,0,0,0,88,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,97,9,3,48,84,30
+,224,13,0,0,0,70,3,0,128,136,0,0,0,170,0,0,0,170,0,0,0,89,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,101,9
+,3,48,84,30,224,13,0,0,0,70,3,0,128,92,0,0,0,126,0,0,0,126,0,0,0,90,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,105,9,3,48,84,30,224,13,0,0,0,198,2,0,128,44,0,0,0,65,0,0,0,65,0,0,0,91,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,109,9,3,48,84,30,224,13,0,0,0,198,4,0,128,12,1,0,0,76,1,0,0,76,1,0
+,0,92,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,113,9,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0
+,0,12,0,0,0,93,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,117,9,3,48,84,30,224,13,0,0,0,70,3,0,128,20,1,0
+,0,67,1,0,0,67,1,0,0,94,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,121,9,3,48,84,30,224,13,0,0,0,70,3,0
+,128,20,1,0,0,67,1,0,0,67,1,0,0,95,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,125,9,3,48,84,30,224,13,0,0
+,0,70,3,0,128,20,1,0,0,67,1,0,0,67,1,0,0,96,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,129,9,3,48,84,30
+,224,13,0,0,0,70,3,0,128,52,1,0,0,112,1,0,0,112,1,0,0,97,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,133,9
+,3,48,84,30,224,13,0,0,0,70,3,0,128,44,1,0,0,104,1,0,0,104,1,0,0,98,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,137,9,3,48,84,30,224,13,0,0,0,70,3,0,128,52,1,0,0,112,1,0,0,112,1,0,0,99,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,141,9,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0
+,0,100,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,145,9,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0
+,0,12,0,0,0,101,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,149,9,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0
+,0,12,0,0,0,12,0,0,0,102,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,153,9,3,48,84,30,224,13,0,0,0,6,0,0
+,128,12,0,0,0,12,0,0,0,12,0,0,0,103,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,157,9,3,48,84,30,224,13,0,0
+,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,104,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,161,9,3,48,84,30
+,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,105,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,165,9
+,3,48,84,30,224,13,0,0,0,198,5,0,128,216,6,0,0,136,7,0,0,136,7,0,0,106,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,169,9,3,48,84,30,224,13,0,0,0,198,2,0,128,40,1,0,0,61,1,0,0,61,1,0,0,107,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,173,9,3,48,84,30,224,13,0,0,0,198,9,0,128,56,35,0,0,240,39,0,0,240,39,0
+,0,108,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,177,9,3,48,84,30,224,13,0,0,0,198,5,0,128,20,13,0,0,52,14,0
+,0,52,14,0,0,109,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,181,9,3,48,84,30,224,13,0,0,0,198,7,0,128,152,13,0
+,0,96,15,0,0,96,15,0,0,110,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,185,9,3,48,84,30,224,13,0,0,0,6,0,0
+,128,189,0,0,0,189,0,0,0,189,0,0,0,111,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,189,9,3,48,84,30,224,13,0,0
+,0,198,1,0,128,48,0,0,0,56,0,0,0,56,0,0,0,112,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,193,9,3,48,84,30
+,224,13,0,0,0,70,5,0,128,0,1,0,0,50,1,0,0,50,1,0,0,113,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,197,9
+,3,48,84,30,224,13,0,0,0,198,5,0,128,52,1,0,0,116,1,0,0,116,1,0,0,114,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,201,9,3,48,84,30,224,13,0,0,0,70,6,0,128,124,1,0,0,202,1,0,0,202,1,0,0,115,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,205,9,3,48,84,30,224,13,0,0,0,198,1,0,128,108,0,0,0,129,0,0,0,129,0,0
+,0,116,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,209,9,3,48,84,30,224,13,0,0,0,198,1,0,128,152,0,0,0,160,0,0
+,0,160,0,0,0,117,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,213,9,3,48,84,30,224,13,0,0,0,198,1,0,128,152,0,0
+,0,160,0,0,0,160,0,0,0,118,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,217,9,3,48,84,30,224,13,0,0,0,198,1,0
+,128,48,0,0,0,56,0,0,0,56,0,0,0,119,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,221,9,3,48,84,30,224,13,0,0
+,0,198,1,0,128,64,0,0,0,72,0,0,0,72,0,0,0,120,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,225,9,3,48,84,30
+,224,13,0,0,0,198,1,0,128,64,0,0,0,72,0,0,0,72,0,0,0,121,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,229,9
+,3,48,84,30,224,13,0,0,0,198,1,0,128,48,0,0,0,56,0,0,0,56,0,0,0,122,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,233,9,3,48,84,30,224,13,0,0,0,198,1,0,128,76,0,0,0,84,0,0,0,84,0,0,0,123,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,237,9,3,48,84,30,224,13,0,0,0,198,1,0,128,76,0,0,0,84,0,0,0,84,0,0
+,0,124,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,241,9,3,48,84,30,224,13,0,0,0,198,1,0,128,84,0,0,0,92,0,0
+,0,92,0,0,0,125,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,245,9,3,48,84,30,224,13,0,0,0,198,1,0,128,84,0,0
+,0,92,0,0,0,92,0,0,0,126,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,249,9,3,48,84,30,224,13,0,0,0,198,1,0
+,128,84,0,0,0,92,0,0,0,92,0,0,0,127,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,253,9,3,48,84,30,224,13,0,0
+,0,198,1,0,128,84,0,0,0,92,0,0,0,92,0,0,0,128,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,1,10,3,48,84,30
+,224,13,0,0,0,198,1,0,128,84,0,0,0,92,0,0,0,92,0,0,0,129,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,5,10
+,3,48,84,30,224,13,0,0,0,198,1,0,128,84,0,0,0,92,0,0,0,92,0,0,0,130,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,9,10,3,48,84,30,224,13,0,0,0,198,1,0,128,84,0,0,0,92,0,0,0,92,0,0,0,131,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,13,10,3,48,84,30,224,13,0,0,0,198,1,0,128,84,0,0,0,92,0,0,0,92,0,0
+,0,132,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,17,10,3,48,84,30,224,13,0,0,0,198,1,0,128,84,0,0,0,92,0,0
+,0,92,0,0,0,133,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,21,10,3,48,84,30,224,13,0,0,0,198,1,0,128,84,0,0
+,0,92,0,0,0,92,0,0,0,134,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,25,10,3,48,84,30,224,13,0,0,0,198,1,0
+,128,84,0,0,0,92,0,0,0,92,0,0,0,135,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,29,10,3,48,84,30,224,13,0,0
+,0,198,1,0,128,84,0,0,0,92,0,0,0,92,0,0,0,136,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,33,10,3,48,84,30
+,224,13,0,0,0,198,1,0,128,48,0,0,0,56,0,0,0,56,0,0,0,137,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,37,10
+,3,48,84,30,224,13,0,0,0,198,1,0,128,4,0,0,0,12,0,0,0,12,0,0,0,138,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,41,10,3,48,84,30,224,13,0,0,0,198,1,0,128,48,0,0,0,56,0,0,0,56,0,0,0,139,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,45,10,3,48,84,30,224,13,0,0,0,198,1,0,128,4,0,0,0,12,0,0,0,12,0,0
+,0,140,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,49,10,3,48,84,30,224,13,0,0,0,70,9,0,128,208,16,0,0,232,18,0
+,0,24,19,0,0,141,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,53,10,3,48,84,30,224,13,0,0,0,198,1,0,128,208,0,0
+,0,216,0,0,0,216,0,0,0,142,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,57,10,3,48,84,30,224,13,0,0,0,198,3,0
+,128,184,0,0,0,231,0,0,0,231,0,0,0,143,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,61,10,3,48,84,30,224,13,0,0
+,0,70,3,0,128,156,0,0,0,203,0,0,0,203,0,0,0,144,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,65,10,3,48,84,30
+,224,13,0,0,0,70,3,0,128,180,0,0,0,240,0,0,0,240,0,0,0,145,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,69,10
+,3,48,84,30,224,13,0,0,0,70,3,0,128,128,0,0,0,175,0,0,0,175,0,0,0,146,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,73,10,3,48,84,30,224,13,0,0,0,70,6,0,128,176,11,0,0,52,13,0,0,76,13,0,0,147,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,77,10,3,48,84,30,224,13,0,0,0,70,3,0,128,156,0,0,0,203,0,0,0,203,0,0
+,0,148,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,81,10,3,48,84,30,224,13,0,0,0,70,3,0,128,180,0,0,0,240,0,0
+,0,240,0,0,0,149,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,85,10,3,48,84,30,224,13,0,0,0,70,3,0,128,128,0,0
+,0,175,0,0,0,175,0,0,0,150,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,89,10,3,48,84,30,224,13,0,0,0,198,1,0
+,128,140,1,0,0,161,1,0,0,161,1,0,0,151,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,93,10,3,48,84,30,224,13,0,0
+,0,198,4,0,128,80,3,0,0,116,3,0,0,116,3,0,0,152,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,97,10,3,48,84,30
+,224,13,0,0,0,198,3,0,128,48,1,0,0,95,1,0,0,95,1,0,0,153,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,147,37,101,10
+,3,48,84,30,224,13,0,0,0,198,1,0,128,116,0,0,0,137,0,0,0,137,0,0,0,154,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,105,10,3,48,84,30,224,13,0,0,0,198,5,0,128,92,4,0,0,212,4,0,0,212,4,0,0,155,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,109,10,3,48,84,30,224,13,0,0,0,70,6,0,128,200,4,0,0,64,5,0,0,64,5,0
+,0,156,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,113,10,3,48,84,30,224,13,0,0,0,198,3,0,128,76,1,0,0,136,1,0
+,0,136,1,0,0,157,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,117,10,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0
+,0,12,0,0,0,12,0,0,0,158,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,121,10,3,48,84,30,224,13,0,0,0,198,5,0
+,128,84,3,0,0,190,3,0,0,190,3,0,0,159,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,125,10,3,48,84,30,224,13,0,0
+,0,198,5,0,128,96,3,0,0,202,3,0,0,202,3,0,0,160,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,129,10,3,48,84,30
+,224,13,0,0,0,198,5,0,128,100,3,0,0,206,3,0,0,206,3,0,0,161,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,133,10
+,3,48,84,30,224,13,0,0,0,70,5,0,128,72,4,0,0,192,4,0,0,192,4,0,0,162,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,147,37,137,10,3,48,84,30,224,13,0,0,0,70,5,0,128,72,4,0,0,192,4,0,0,192,4,0,0,163,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,147,37,141,10,3,48,84,30,224,13,0,0,0,198,3,0,128,176,0,0,0,210,0,0,0,210,0,0
+,0,164,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,145,10,3,48,84,30,224,13,0,0,0,198,3,0,128,192,0,0,0,226,0,0
+,0,226,0,0,0,165,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,149,10,3,48,84,30,224,13,0,0,0,198,3,0,128,176,0,0
+,0,210,0,0,0,210,0,0,0,166,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,153,10,3,48,84,30,224,13,0,0,0,198,3,0
+,128,176,0,0,0,210,0,0,0,210,0,0,0,167,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,157,10,3,48,84,30,224,13,0,0
+,0,198,3,0,128,172,0,0,0,206,0,0,0,206,0,0,0,168,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,161,10,3,48,84,30
+,224,13,0,0,0,198,3,0,128,192,0,0,0,226,0,0,0,226,0,0,0,169,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,165,10
+,3,48,84,30,224,13,0,0,0,198,6,0,128,168,4,0,0,116,5,0,0,148,5,0,0,170,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,147,37,169,10,3,48,84,30,224,13,0,0,0,198,6,0,128,236,4,0,0,200,5,0,0,232,5,0,0,171,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,147,37,173,10,3,48,84,30,224,13,0,0,0,198,6,0,128,244,4,0,0,236,5,0,0,12,6,0
+,0,172,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,147,37,177,10,3,48,84,30,224,13,0,0,0,70,3,0,128,68,0,0,0,102,0,0
+,0,102,0,0,0,173,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,181,10,3,48,84,30,224,13,0,0,0,6,0,0,128,217,0,0
+,0,217,0,0,0,217,0,0,0,174,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,185,10,3,48,84,30,224,13,0,0,0,6,0,0
+,128,217,0,0,0,217,0,0,0,217,0,0,0,175,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,189,10,3,48,84,30,224,13,0,0
+,0,6,0,0,128,200,0,0,0,200,0,0,0,200,0,0,0,176,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,193,10,3,48,84,30
+,224,13,0,0,0,6,0,0,128,138,1,0,0,138,1,0,0,138,1,0,0,177,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,197,10
+,3,48,84,30,224,13,0,0,0,6,0,0,128,138,1,0,0,138,1,0,0,138,1,0,0,178,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,201,10,3,48,84,30,224,13,0,0,0,6,0,0,128,217,0,0,0,217,0,0,0,217,0,0,0,179,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,205,10,3,48,84,30,224,13,0,0,0,6,0,0,128,217,0,0,0,217,0,0,0,217,0,0
+,0,180,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,209,10,3,48,84,30,224,13,0,0,0,6,0,0,128,200,0,0,0,200,0,0
+,0,200,0,0,0,181,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,213,10,3,48,84,30,224,13,0,0,0,6,0,0,128,138,1,0
+,0,138,1,0,0,138,1,0,0,182,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,217,10,3,48,84,30,224,13,0,0,0,6,0,0
+,128,138,1,0,0,138,1,0,0,138,1,0,0,183,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,221,10,3,48,84,30,224,13,0,0
+,0,6,0,0,128,1,0,0,0,1,0,0,0,1,0,0,0,184,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,225,10,3,48,84,30
+,224,13,0,0,0,70,5,0,128,120,5,0,0,240,5,0,0,240,5,0,0,185,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,229,10
+,3,48,84,30,224,13,0,0,0,198,4,0,128,0,12,0,0,4,13,0,0,4,13,0,0,186,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,233,10,3,48,84,30,224,13,0,0,0,6,0,0,128,14,0,0,0,14,0,0,0,14,0,0,0,187,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,237,10,3,48,84,30,224,13,0,0,0,6,0,0,128,82,0,0,0,82,0,0,0,82,0,0
+,0,188,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,241,10,3,48,84,30,224,13,0,0,0,70,5,0,128,236,9,0,0,58,10,0
+,0,58,10,0,0,189,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,245,10,3,48,84,30,224,13,0,0,0,70,6,0,128,212,10,0
+,0,48,11,0,0,48,11,0,0,190,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,249,10,3,48,84,30,224,13,0,0,0,198,6,0
+,128,184,60,0,0,44,62,0,0,44,62,0,0,191,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,253,10,3,48,84,30,224,13,0,0
+,0,198,6,0,128,196,53,0,0,0,55,0,0,0,55,0,0,192,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,1,11,3,48,84,30
+,224,13,0,0,0,6,0,0,128,5,0,0,0,5,0,0,0,5,0,0,0,193,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,5,11
+,3,48,84,30,224,13,0,0,0,6,0,0,128,5,0,0,0,5,0,0,0,5,0,0,0,194,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,9,11,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,195,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,13,11,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0
+,0,196,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,17,11,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0
+,0,12,0,0,0,197,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,21,11,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0
+,0,12,0,0,0,12,0,0,0,198,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,25,11,3,48,84,30,224,13,0,0,0,6,0,0
+,128,12,0,0,0,12,0,0,0,12,0,0,0,199,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,29,11,3,48,84,30,224,13,0,0
+,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,200,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,33,11,3,48,84,30
+,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,201,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,37,11
+,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,202,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,41,11,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,203,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,45,11,3,48,84,30,224,13,0,0,0,70,4,0,128,168,1,0,0,12,2,0,0,20,2,0
+,0,204,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,49,11,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0
+,0,12,0,0,0,205,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,53,11,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0
+,0,12,0,0,0,12,0,0,0,206,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,57,11,3,48,84,30,224,13,0,0,0,70,8,0
+,128,124,22,0,0,212,23,0,0,212,23,0,0,207,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,61,11,3,48,84,30,224,13,0,0
+,0,70,3,0,128,180,0,0,0,214,0,0,0,214,0,0,0,208,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,65,11,3,48,84,30
+,224,13,0,0,0,198,3,0,128,56,2,0,0,103,2,0,0,103,2,0,0,209,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,69,11
+,3,48,84,30,224,13,0,0,0,70,7,0,128,84,12,0,0,204,12,0,0,204,12,0,0,210,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,73,11,3,48,84,30,224,13,0,0,0,198,7,0,128,84,5,0,0,218,5,0,0,218,5,0,0,211,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,77,11,3,48,84,30,224,13,0,0,0,70,3,0,128,240,0,0,0,18,1,0,0,18,1,0
+,0,212,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,81,11,3,48,84,30,224,13,0,0,0,70,4,0,128,136,3,0,0,209,3,0
+,0,209,3,0,0,213,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,85,11,3,48,84,30,224,13,0,0,0,70,8,0,128,172,13,0
+,0,64,14,0,0,64,14,0,0,214,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,89,11,3,48,84,30,224,13,0,0,0,70,12,0
+,128,180,16,0,0,21,18,0,0,21,18,0,0,215,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,93,11,3,48,84,30,224,13,0,0
+,0,70,3,0,128,172,0,0,0,206,0,0,0,206,0,0,0,216,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,97,11,3,48,84,30
+,224,13,0,0,0,198,2,0,128,32,0,0,0,53,0,0,0,53,0,0,0,217,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,101,11
+,3,48,84,30,224,13,0,0,0,70,3,0,128,28,1,0,0,62,1,0,0,62,1,0,0,218,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,105,11,3,48,84,30,224,13,0,0,0,198,5,0,128,40,2,0,0,90,2,0,0,90,2,0,0,219,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,109,11,3,48,84,30,224,13,0,0,0,198,7,0,128,68,5,0,0,202,5,0,0,202,5,0
+,0,220,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,113,11,3,48,84,30,224,13,0,0,0,70,3,0,128,172,0,0,0,206,0,0
+,0,206,0,0,0,221,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,117,11,3,48,84,30,224,13,0,0,0,198,2,0,128,32,0,0
+,0,53,0,0,0,53,0,0,0,222,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,121,11,3,48,84,30,224,13,0,0,0,70,3,0
+,128,28,1,0,0,62,1,0,0,62,1,0,0,223,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,125,11,3,48,84,30,224,13,0,0
+,0,70,5,0,128,40,2,0,0,90,2,0,0,90,2,0,0,224,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,129,11,3,48,84,30
+,224,13,0,0,0,198,7,0,128,80,5,0,0,214,5,0,0,214,5,0,0,225,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,133,11
+,3,48,84,30,224,13,0,0,0,70,3,0,128,180,0,0,0,214,0,0,0,214,0,0,0,226,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,137,11,3,48,84,30,224,13,0,0,0,70,3,0,128,180,0,0,0,214,0,0,0,214,0,0,0,227,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,141,11,3,48,84,30,224,13,0,0,0,70,7,0,128,216,11,0,0,80,12,0,0,80,12,0
+,0,228,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,145,11,3,48,84,30,224,13,0,0,0,198,7,0,128,188,4,0,0,66,5,0
+,0,66,5,0,0,229,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,149,11,3,48,84,30,224,13,0,0,0,198,4,0,128,92,1,0
+,0,128,1,0,0,128,1,0,0,230,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,153,11,3,48,84,30,224,13,0,0,0,198,1,0
+,128,40,0,0,0,48,0,0,0,48,0,0,0,231,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,157,11,3,48,84,30,224,13,0,0
+,0,70,2,0,128,132,0,0,0,153,0,0,0,153,0,0,0,232,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,161,11,3,48,84,30
+,224,13,0,0,0,198,3,0,128,68,1,0,0,154,1,0,0,154,1,0,0,233,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,165,11
+,3,48,84,30,224,13,0,0,0,70,5,0,128,124,3,0,0,174,3,0,0,174,3,0,0,234,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,169,11,3,48,84,30,224,13,0,0,0,70,2,0,128,52,1,0,0,86,1,0,0,86,1,0,0,235,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,173,11,3,48,84,30,224,13,0,0,0,198,13,0,128,248,24,0,0,192,27,0,0,80,28,0
+,0,236,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,177,11,3,48,84,30,224,13,0,0,0,198,14,0,128,28,24,0,0,212,26,0
+,0,92,27,0,0,237,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,181,11,3,48,84,30,224,13,0,0,0,70,4,0,128,4,1,0
+,0,77,1,0,0,77,1,0,0,238,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,185,11,3,48,84,30,224,13,0,0,0,70,12,0
+,128,92,22,0,0,188,24,0,0,60,25,0,0,239,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,189,11,3,48,84,30,224,13,0,0
+,0,70,13,0,128,116,21,0,0,236,23,0,0,100,24,0,0,240,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,193,11,3,48,84,30
+,224,13,0,0,0,70,7,0,128,40,14,0,0,44,15,0,0,44,15,0,0,241,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,197,11
+,3,48,84,30,224,13,0,0,0,70,3,0,128,204,0,0,0,238,0,0,0,238,0,0,0,242,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,201,11,3,48,84,30,224,13,0,0,0,198,3,0,128,224,1,0,0,28,2,0,0,28,2,0,0,243,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,205,11,3,48,84,30,224,13,0,0,0,198,7,0,128,40,12,0,0,174,12,0,0,174,12,0
+,0,244,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,209,11,3,48,84,30,224,13,0,0,0,70,10,0,128,16,14,0,0,143,15,0
+,0,143,15,0,0,245,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,213,11,3,48,84,30,224,13,0,0,0,198,5,0,128,116,3,0
+,0,222,3,0,0,222,3,0,0,246,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,217,11,3,48,84,30,224,13,0,0,0,70,3,0
+,128,136,0,0,0,170,0,0,0,170,0,0,0,247,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,221,11,3,48,84,30,224,13,0,0
+,0,70,3,0,128,172,0,0,0,206,0,0,0,206,0,0,0,248,2,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,225,11,3,48,84,30
+,224,13,0,0,0,70,3,0,128,172,0,0,0,206,0,0,0,206,0,0,0,249,2,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,229,11
+,3,48,84,30,224,13,0,0,0,198,6,0,128,52,11,0,0,186,11,0,0,186,11,0,0,250,2,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,233,11,3,48,84,30,224,13,0,0,0,198,7,0,128,48,7,0,0,224,7,0,0,224,7,0,0,251,2,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,237,11,3,48,84,30,224,13,0,0,0,70,3,0,128,136,0,0,0,170,0,0,0,170,0,0
+,0,252,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,241,11,3,48,84,30,224,13,0,0,0,70,3,0,128,172,0,0,0,206,0,0
+,0,206,0,0,0,253,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,245,11,3,48,84,30,224,13,0,0,0,70,3,0,128,172,0,0
+,0,206,0,0,0,206,0,0,0,254,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,249,11,3,48,84,30,224,13,0,0,0,70,7,0
+,128,32,12,0,0,166,12,0,0,166,12,0,0,255,2,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,253,11,3,48,84,30,224,13,0,0
+,0,70,8,0,128,192,5,0,0,84,6,0,0,84,6,0,0,0,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,1,12,3,48,84,30
+,224,13,0,0,0,198,8,0,128,60,13,0,0,157,14,0,0,157,14,0,0,1,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,5,12
+,3,48,84,30,224,13,0,0,0,70,8,0,128,92,15,0,0,166,16,0,0,166,16,0,0,2,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,9,12,3,48,84,30,224,13,0,0,0,70,8,0,128,196,19,0,0,42,21,0,0,42,21,0,0,3,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,13,12,3,48,84,30,224,13,0,0,0,70,3,0,128,180,0,0,0,214,0,0,0,214,0,0
+,0,4,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,17,12,3,48,84,30,224,13,0,0,0,198,3,0,128,16,2,0,0,63,2,0
+,0,63,2,0,0,5,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,21,12,3,48,84,30,224,13,0,0,0,70,7,0,128,72,12,0
+,0,192,12,0,0,192,12,0,0,6,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,25,12,3,48,84,30,224,13,0,0,0,198,7,0
+,128,68,5,0,0,202,5,0,0,202,5,0,0,7,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,29,12,3,48,84,30,224,13,0,0
+,0,70,12,0,128,208,61,0,0,181,66,0,0,181,66,0,0,8,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,33,12,3,48,84,30
+,224,13,0,0,0,70,10,0,128,24,13,0,0,76,14,0,0,76,14,0,0,9,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,37,12
+,3,48,84,30,224,13,0,0,0,198,2,0,128,148,1,0,0,208,1,0,0,208,1,0,0,10,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,41,12,3,48,84,30,224,13,0,0,0,70,6,0,128,144,10,0,0,50,11,0,0,50,11,0,0,11,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,45,12,3,48,84,30,224,13,0,0,0,70,3,0,128,152,2,0,0,212,2,0,0,212,2,0
+,0,12,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,49,12,3,48,84,30,224,13,0,0,0,198,4,0,128,204,4,0,0,124,5,0
+,0,124,5,0,0,13,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,53,12,3,48,84,30,224,13,0,0,0,198,4,0,128,56,5,0
+,0,4,6,0,0,4,6,0,0,14,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,57,12,3,48,84,30,224,13,0,0,0,198,3,0
+,128,44,1,0,0,78,1,0,0,78,1,0,0,15,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,61,12,3,48,84,30,224,13,0,0
+,0,198,5,0,128,204,3,0,0,26,4,0,0,26,4,0,0,16,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,65,12,3,48,84,30
+,224,13,0,0,0,198,3,0,128,160,0,0,0,194,0,0,0,194,0,0,0,17,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,69,12
+,3,48,84,30,224,13,0,0,0,198,3,0,128,80,1,0,0,127,1,0,0,127,1,0,0,18,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,73,12,3,48,84,30,224,13,0,0,0,198,3,0,128,80,1,0,0,127,1,0,0,127,1,0,0,19,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,77,12,3,48,84,30,224,13,0,0,0,70,4,0,128,56,3,0,0,142,3,0,0,142,3,0
+,0,20,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,81,12,3,48,84,30,224,13,0,0,0,70,4,0,128,56,3,0,0,142,3,0
+,0,142,3,0,0,21,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,85,12,3,48,84,30,224,13,0,0,0,198,4,0,128,148,3,0
+,0,240,3,0,0,240,3,0,0,22,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,89,12,3,48,84,30,224,13,0,0,0,198,4,0
+,128,144,3,0,0,236,3,0,0,236,3,0,0,23,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,93,12,3,48,84,30,224,13,0,0
+,0,198,4,0,128,56,4,0,0,162,4,0,0,162,4,0,0,24,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,97,12,3,48,84,30
+,224,13,0,0,0,198,4,0,128,184,3,0,0,20,4,0,0,20,4,0,0,25,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,101,12
+,3,48,84,30,224,13,0,0,0,198,4,0,128,24,4,0,0,130,4,0,0,130,4,0,0,26,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,105,12,3,48,84,30,224,13,0,0,0,198,4,0,128,96,4,0,0,202,4,0,0,202,4,0,0,27,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,109,12,3,48,84,30,224,13,0,0,0,198,4,0,128,76,5,0,0,210,5,0,0,210,5,0
+,0,28,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,113,12,3,48,84,30,224,13,0,0,0,198,4,0,128,92,5,0,0,226,5,0
+,0,226,5,0,0,29,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,117,12,3,48,84,30,224,13,0,0,0,198,5,0,128,236,4,0
+,0,114,5,0,0,114,5,0,0,30,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,121,12,3,48,84,30,224,13,0,0,0,198,5,0
+,128,236,4,0,0,114,5,0,0,114,5,0,0,31,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,125,12,3,48,84,30,224,13,0,0
+,0,70,6,0,128,76,5,0,0,210,5,0,0,210,5,0,0,32,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,129,12,3,48,84,30
+,224,13,0,0,0,70,6,0,128,76,5,0,0,210,5,0,0,210,5,0,0,33,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,133,12
+,3,48,84,30,224,13,0,0,0,70,6,0,128,112,5,0,0,246,5,0,0,246,5,0,0,34,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,137,12,3,48,84,30,224,13,0,0,0,70,6,0,128,112,5,0,0,246,5,0,0,246,5,0,0,35,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,141,12,3,48,84,30,224,13,0,0,0,70,6,0,128,76,5,0,0,210,5,0,0,210,5,0
+,0,36,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,145,12,3,48,84,30,224,13,0,0,0,70,6,0,128,136,5,0,0,14,6,0
+,0,14,6,0,0,37,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,149,12,3,48,84,30,224,13,0,0,0,70,6,0,128,212,4,0
+,0,76,5,0,0,76,5,0,0,38,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,153,12,3,48,84,30,224,13,0,0,0,70,6,0
+,128,212,4,0,0,76,5,0,0,76,5,0,0,39,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,157,12,3,48,84,30,224,13,0,0
+,0,198,3,0,128,124,0,0,0,158,0,0,0,158,0,0,0,40,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,161,12,3,48,84,30
+,224,13,0,0,0,198,3,0,128,124,0,0,0,158,0,0,0,158,0,0,0,41,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,165,12
+,3,48,84,30,224,13,0,0,0,198,3,0,128,124,0,0,0,158,0,0,0,158,0,0,0,42,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,169,12,3,48,84,30,224,13,0,0,0,198,1,0,128,112,0,0,0,120,0,0,0,120,0,0,0,43,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,173,12,3,48,84,30,224,13,0,0,0,198,3,0,128,124,0,0,0,171,0,0,0,171,0,0
+,0,44,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,177,12,3,48,84,30,224,13,0,0,0,70,2,0,128,136,1,0,0,183,1,0
+,0,183,1,0,0,45,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,181,12,3,48,84,30,224,13,0,0,0,198,3,0,128,12,1,0
+,0,59,1,0,0,59,1,0,0,46,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,185,12,3,48,84,30,224,13,0,0,0,198,3,0
+,128,12,1,0,0,59,1,0,0,59,1,0,0,47,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,189,12,3,48,84,30,224,13,0,0
+,0,198,3,0,128,12,1,0,0,59,1,0,0,59,1,0,0,48,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,193,12,3,48,84,30
+,224,13,0,0,0,198,3,0,128,12,1,0,0,59,1,0,0,59,1,0,0,49,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,197,12
+,3,48,84,30,224,13,0,0,0,198,3,0,128,12,1,0,0,59,1,0,0,59,1,0,0,50,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,201,12,3,48,84,30,224,13,0,0,0,70,4,0,128,104,1,0,0,164,1,0,0,164,1,0,0,51,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,205,12,3,48,84,30,224,13,0,0,0,198,3,0,128,12,1,0,0,59,1,0,0,59,1,0
+,0,52,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,209,12,3,48,84,30,224,13,0,0,0,198,3,0,128,12,1,0,0,59,1,0
+,0,59,1,0,0,53,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,213,12,3,48,84,30,224,13,0,0,0,70,3,0,128,152,0,0
+,0,186,0,0,0,186,0,0,0,54,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,217,12,3,48,84,30,224,13,0,0,0,198,3,0
+,128,12,1,0,0,59,1,0,0,59,1,0,0,55,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,221,12,3,48,84,30,224,13,0,0
+,0,198,3,0,128,12,1,0,0,59,1,0,0,59,1,0,0,56,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,225,12,3,48,84,30
+,224,13,0,0,0,198,3,0,128,12,1,0,0,59,1,0,0,59,1,0,0,57,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,229,12
+,3,48,84,30,224,13,0,0,0,198,3,0,128,12,1,0,0,59,1,0,0,59,1,0,0,58,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,233,12,3,48,84,30,224,13,0,0,0,70,3,0,128,204,0,0,0,251,0,0,0,251,0,0,0,59,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,237,12,3,48,84,30,224,13,0,0,0,198,3,0,128,12,1,0,0,59,1,0,0,59,1,0
+,0,60,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,241,12,3,48,84,30,224,13,0,0,0,198,3,0,128,12,1,0,0,59,1,0
+,0,59,1,0,0,61,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,245,12,3,48,84,30,224,13,0,0,0,198,3,0,128,12,1,0
+,0,59,1,0,0,59,1,0,0,62,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,249,12,3,48,84,30,224,13,0,0,0,198,3,0
+,128,12,1,0,0,59,1,0,0,59,1,0,0,63,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,253,12,3,48,84,30,224,13,0,0
+,0,198,3,0,128,12,1,0,0,59,1,0,0,59,1,0,0,64,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,1,13,3,48,84,30
+,224,13,0,0,0,70,3,0,128,148,0,0,0,182,0,0,0,182,0,0,0,65,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,5,13
+,3,48,84,30,224,13,0,0,0,198,3,0,128,12,1,0,0,59,1,0,0,59,1,0,0,66,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,9,13,3,48,84,30,224,13,0,0,0,70,3,0,128,188,0,0,0,235,0,0,0,235,0,0,0,67,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,13,13,3,48,84,30,224,13,0,0,0,198,3,0,128,12,1,0,0,59,1,0,0,59,1,0
+,0,68,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,17,13,3,48,84,30,224,13,0,0,0,198,3,0,128,12,1,0,0,59,1,0
+,0,59,1,0,0,69,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,21,13,3,48,84,30,224,13,0,0,0,70,6,0,128,244,3,0
+,0,108,4,0,0,108,4,0,0,70,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,25,13,3,48,84,30,224,13,0,0,0,198,7,0
+,128,100,11,0,0,216,12,0,0,40,13,0,0,71,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,29,13,3,48,84,30,224,13,0,0
+,0,70,3,0,128,116,0,0,0,163,0,0,0,163,0,0,0,72,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,33,13,3,48,84,30
+,224,13,0,0,0,70,3,0,128,120,0,0,0,167,0,0,0,167,0,0,0,73,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,37,13
+,3,48,84,30,224,13,0,0,0,70,3,0,128,128,0,0,0,188,0,0,0,188,0,0,0,74,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,41,13,3,48,84,30,224,13,0,0,0,70,3,0,128,4,1,0,0,77,1,0,0,77,1,0,0,75,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,45,13,3,48,84,30,224,13,0,0,0,198,3,0,128,176,1,0,0,249,1,0,0,249,1,0
+,0,76,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,49,13,3,48,84,30,224,13,0,0,0,198,4,0,128,8,7,0,0,170,7,0
+,0,170,7,0,0,77,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,53,13,3,48,84,30,224,13,0,0,0,198,4,0,128,96,8,0
+,0,16,9,0,0,16,9,0,0,78,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,57,13,3,48,84,30,224,13,0,0,0,198,3,0
+,128,20,4,0,0,249,4,0,0,249,4,0,0,79,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,61,13,3,48,84,30,224,13,0,0
+,0,198,4,0,128,152,6,0,0,30,7,0,0,30,7,0,0,80,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,65,13,3,48,84,30
+,224,13,0,0,0,198,3,0,128,240,2,0,0,122,3,0,0,122,3,0,0,81,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,69,13
+,3,48,84,30,224,13,0,0,0,198,3,0,128,12,3,0,0,189,3,0,0,189,3,0,0,82,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,73,13,3,48,84,30,224,13,0,0,0,70,6,0,128,4,4,0,0,110,4,0,0,110,4,0,0,83,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,77,13,3,48,84,30,224,13,0,0,0,70,3,0,128,92,0,0,0,113,0,0,0,113,0,0
+,0,84,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,81,13,3,48,84,30,224,13,0,0,0,198,4,0,128,208,8,0,0,142,9,0
+,0,142,9,0,0,85,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,85,13,3,48,84,30,224,13,0,0,0,70,4,0,128,244,4,0
+,0,230,5,0,0,230,5,0,0,86,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,89,13,3,48,84,30,224,13,0,0,0,70,3,0
+,128,156,0,0,0,216,0,0,0,216,0,0,0,87,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,93,13,3,48,84,30,224,13,0,0
+,0,70,3,0,128,160,0,0,0,220,0,0,0,220,0,0,0,88,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,97,13,3,48,84,30
+,224,13,0,0,0,70,3,0,128,156,0,0,0,216,0,0,0,216,0,0,0,89,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,101,13
+,3,48,84,30,224,13,0,0,0,70,3,0,128,224,0,0,0,41,1,0,0,41,1,0,0,90,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,105,13,3,48,84,30,224,13,0,0,0,70,4,0,128,68,1,0,0,128,1,0,0,128,1,0,0,91,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,109,13,3,48,84,30,224,13,0,0,0,70,3,0,128,128,0,0,0,175,0,0,0,175,0,0
+,0,92,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,113,13,3,48,84,30,224,13,0,0,0,198,7,0,128,224,16,0,0,0,18,0
+,0,0,18,0,0,93,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,117,13,3,48,84,30,224,13,0,0,0,70,8,0,128,52,17,0
+,0,56,18,0,0,56,18,0,0,94,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,121,13,3,48,84,30,224,13,0,0,0,198,8,0
+,128,52,8,0,0,134,9,0,0,134,9,0,0,95,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,125,13,3,48,84,30,224,13,0,0
+,0,70,9,0,128,180,31,0,0,5,34,0,0,5,34,0,0,96,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,129,13,3,48,84,30
+,224,13,0,0,0,70,8,0,128,192,31,0,0,108,33,0,0,108,33,0,0,97,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,133,13
+,3,48,84,30,224,13,0,0,0,198,7,0,128,56,13,0,0,14,15,0,0,14,15,0,0,98,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,137,13,3,48,84,30,224,13,0,0,0,70,8,0,128,68,17,0,0,156,18,0,0,156,18,0,0,99,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,141,13,3,48,84,30,224,13,0,0,0,198,4,0,128,176,1,0,0,254,1,0,0,254,1,0
+,0,100,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,145,13,3,48,84,30,224,13,0,0,0,198,5,0,128,4,6,0,0,68,6,0
+,0,68,6,0,0,101,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,149,13,3,48,84,30,224,13,0,0,0,198,4,0,128,28,6,0
+,0,18,7,0,0,18,7,0,0,102,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,153,13,3,48,84,30,224,13,0,0,0,70,3,0
+,128,188,0,0,0,235,0,0,0,235,0,0,0,103,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,157,13,3,48,84,30,224,13,0,0
+,0,198,10,0,128,108,17,0,0,250,18,0,0,250,18,0,0,104,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,161,13,3,48,84,30
+,224,13,0,0,0,198,4,0,128,176,1,0,0,254,1,0,0,254,1,0,0,105,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,165,13
+,3,48,84,30,224,13,0,0,0,198,5,0,128,112,8,0,0,46,9,0,0,46,9,0,0,106,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,169,13,3,48,84,30,224,13,0,0,0,70,5,0,128,0,5,0,0,64,5,0,0,64,5,0,0,107,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,173,13,3,48,84,30,224,13,0,0,0,70,3,0,128,228,0,0,0,19,1,0,0,19,1,0
+,0,108,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,177,13,3,48,84,30,224,13,0,0,0,70,3,0,128,232,0,0,0,23,1,0
+,0,23,1,0,0,109,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,181,13,3,48,84,30,224,13,0,0,0,70,3,0,128,232,0,0
+,0,23,1,0,0,23,1,0,0,110,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,185,13,3,48,84,30,224,13,0,0,0,70,3,0
+,128,204,0,0,0,238,0,0,0,238,0,0,0,111,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,189,13,3,48,84,30,224,13,0,0
+,0,70,3,0,128,232,0,0,0,23,1,0,0,23,1,0,0,112,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,193,13,3,48,84,30
+,224,13,0,0,0,70,3,0,128,232,0,0,0,23,1,0,0,23,1,0,0,113,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,197,13
+,3,48,84,30,224,13,0,0,0,70,6,0,128,124,8,0,0,72,9,0,0,72,9,0,0,114,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,201,13,3,48,84,30,224,13,0,0,0,70,3,0,128,140,0,0,0,174,0,0,0,174,0,0,0,115,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,205,13,3,48,84,30,224,13,0,0,0,70,3,0,128,140,0,0,0,174,0,0,0,174,0,0
+,0,116,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,209,13,3,48,84,30,224,13,0,0,0,198,6,0,128,124,8,0,0,30,9,0
+,0,30,9,0,0,117,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,213,13,3,48,84,30,224,13,0,0,0,70,4,0,128,120,3,0
+,0,232,3,0,0,232,3,0,0,118,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,217,13,3,48,84,30,224,13,0,0,0,198,3,0
+,128,44,2,0,0,130,2,0,0,130,2,0,0,119,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,221,13,3,48,84,30,224,13,0,0
+,0,198,4,0,128,196,3,0,0,46,4,0,0,46,4,0,0,120,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,225,13,3,48,84,30
+,224,13,0,0,0,70,5,0,128,160,1,0,0,252,1,0,0,252,1,0,0,121,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,229,13
+,3,48,84,30,224,13,0,0,0,198,5,0,128,16,4,0,0,122,4,0,0,122,4,0,0,122,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,233,13,3,48,84,30,224,13,0,0,0,70,3,0,128,228,1,0,0,58,2,0,0,58,2,0,0,123,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,237,13,3,48,84,30,224,13,0,0,0,70,3,0,128,236,1,0,0,66,2,0,0,66,2,0
+,0,124,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,241,13,3,48,84,30,224,13,0,0,0,70,3,0,128,156,2,0,0,177,2,0
+,0,177,2,0,0,125,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,245,13,3,48,84,30,224,13,0,0,0,70,6,0,128,116,10,0
+,0,50,11,0,0,50,11,0,0,126,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,249,13,3,48,84,30,224,13,0,0,0,198,4,0
+,128,252,1,0,0,228,2,0,0,228,2,0,0,127,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,253,13,3,48,84,30,224,13,0,0
+,0,198,3,0,128,160,0,0,0,194,0,0,0,194,0,0,0,128,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,1,14,3,48,84,30
+,224,13,0,0,0,198,3,0,128,144,0,0,0,178,0,0,0,178,0,0,0,129,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,5,14
+,3,48,84,30,224,13,0,0,0,198,3,0,128,144,0,0,0,178,0,0,0,178,0,0,0,130,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,9,14,3,48,84,30,224,13,0,0,0,198,3,0,128,144,0,0,0,178,0,0,0,178,0,0,0,131,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,13,14,3,48,84,30,224,13,0,0,0,198,3,0,128,168,0,0,0,202,0,0,0,202,0,0
+,0,132,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,17,14,3,48,84,30,224,13,0,0,0,198,3,0,128,168,0,0,0,202,0,0
+,0,202,0,0,0,133,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,21,14,3,48,84,30,224,13,0,0,0,198,3,0,128,144,0,0
+,0,178,0,0,0,178,0,0,0,134,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,25,14,3,48,84,30,224,13,0,0,0,198,3,0
+,128,144,0,0,0,178,0,0,0,178,0,0,0,135,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,29,14,3,48,84,30,224,13,0,0
+,0,198,3,0,128,168,0,0,0,202,0,0,0,202,0,0,0,136,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,33,14,3,48,84,30
+,224,13,0,0,0,198,3,0,128,144,0,0,0,178,0,0,0,178,0,0,0,137,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,37,14
+,3,48,84,30,224,13,0,0,0,198,3,0,128,144,0,0,0,178,0,0,0,178,0,0,0,138,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,41,14,3,48,84,30,224,13,0,0,0,198,3,0,128,144,0,0,0,178,0,0,0,178,0,0,0,139,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,45,14,3,48,84,30,224,13,0,0,0,198,3,0,128,144,0,0,0,178,0,0,0,178,0,0
+,0,140,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,49,14,3,48,84,30,224,13,0,0,0,198,3,0,128,56,1,0,0,129,1,0
+,0,129,1,0,0,141,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,53,14,3,48,84,30,224,13,0,0,0,70,5,0,128,160,6,0
+,0,38,7,0,0,38,7,0,0,142,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,57,14,3,48,84,30,224,13,0,0,0,70,6,0
+,128,72,3,0,0,6,4,0,0,6,4,0,0,143,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,61,14,3,48,84,30,224,13,0,0
+,0,70,6,0,128,72,3,0,0,6,4,0,0,6,4,0,0,144,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,65,14,3,48,84,30
+,224,13,0,0,0,198,3,0,128,144,0,0,0,178,0,0,0,178,0,0,0,145,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,69,14
+,3,48,84,30,224,13,0,0,0,198,3,0,128,156,1,0,0,12,2,0,0,12,2,0,0,146,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,73,14,3,48,84,30,224,13,0,0,0,70,6,0,128,28,14,0,0,116,15,0,0,116,15,0,0,147,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,77,14,3,48,84,30,224,13,0,0,0,198,7,0,128,140,10,0,0,74,11,0,0,74,11,0
+,0,148,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,81,14,3,48,84,30,224,13,0,0,0,70,6,0,128,92,14,0,0,180,15,0
+,0,180,15,0,0,149,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,85,14,3,48,84,30,224,13,0,0,0,198,7,0,128,128,29,0
+,0,208,32,0,0,208,32,0,0,150,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,89,14,3,48,84,30,224,13,0,0,0,198,6,0
+,128,52,4,0,0,158,4,0,0,158,4,0,0,151,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,93,14,3,48,84,30,224,13,0,0
+,0,198,9,0,128,216,11,0,0,72,13,0,0,72,13,0,0,152,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,97,14,3,48,84,30
+,224,13,0,0,0,70,7,0,128,52,4,0,0,158,4,0,0,158,4,0,0,153,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,101,14
+,3,48,84,30,224,13,0,0,0,198,6,0,128,52,4,0,0,158,4,0,0,158,4,0,0,154,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,105,14,3,48,84,30,224,13,0,0,0,70,7,0,128,164,3,0,0,14,4,0,0,14,4,0,0,155,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,109,14,3,48,84,30,224,13,0,0,0,70,7,0,128,248,3,0,0,112,4,0,0,112,4,0
+,0,156,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,113,14,3,48,84,30,224,13,0,0,0,198,6,0,128,0,4,0,0,120,4,0
+,0,120,4,0,0,157,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,117,14,3,48,84,30,224,13,0,0,0,70,6,0,128,220,7,0
+,0,224,8,0,0,224,8,0,0,158,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,121,14,3,48,84,30,224,13,0,0,0,198,6,0
+,128,48,4,0,0,154,4,0,0,154,4,0,0,159,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,125,14,3,48,84,30,224,13,0,0
+,0,70,6,0,128,252,6,0,0,214,7,0,0,214,7,0,0,160,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,129,14,3,48,84,30
+,224,13,0,0,0,70,7,0,128,232,4,0,0,54,5,0,0,54,5,0,0,161,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,133,14
+,3,48,84,30,224,13,0,0,0,70,8,0,128,100,7,0,0,48,8,0,0,48,8,0,0,162,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,137,14,3,48,84,30,224,13,0,0,0,198,1,0,128,36,0,0,0,44,0,0,0,44,0,0,0,163,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,141,14,3,48,84,30,224,13,0,0,0,198,1,0,128,36,0,0,0,44,0,0,0,44,0,0
+,0,164,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,145,14,3,48,84,30,224,13,0,0,0,70,2,0,128,136,0,0,0,157,0,0
+,0,157,0,0,0,165,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,149,14,3,48,84,30,224,13,0,0,0,198,1,0,128,36,0,0
+,0,44,0,0,0,44,0,0,0,166,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,153,14,3,48,84,30,224,13,0,0,0,198,1,0
+,128,112,0,0,0,120,0,0,0,120,0,0,0,167,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,157,14,3,48,84,30,224,13,0,0
+,0,198,1,0,128,52,0,0,0,60,0,0,0,60,0,0,0,168,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,161,14,3,48,84,30
+,224,13,0,0,0,198,1,0,128,40,0,0,0,48,0,0,0,48,0,0,0,169,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,165,14
+,3,48,84,30,224,13,0,0,0,198,1,0,128,40,0,0,0,48,0,0,0,48,0,0,0,170,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,169,14,3,48,84,30,224,13,0,0,0,198,1,0,128,32,0,0,0,40,0,0,0,40,0,0,0,171,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,173,14,3,48,84,30,224,13,0,0,0,198,3,0,128,64,1,0,0,137,1,0,0,137,1,0
+,0,172,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,177,14,3,48,84,30,224,13,0,0,0,70,2,0,128,96,0,0,0,130,0,0
+,0,130,0,0,0,173,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,181,14,3,48,84,30,224,13,0,0,0,198,1,0,128,8,0,0
+,0,16,0,0,0,16,0,0,0,174,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,185,14,3,48,84,30,224,13,0,0,0,198,1,0
+,128,124,1,0,0,132,1,0,0,132,1,0,0,175,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,189,14,3,48,84,30,224,13,0,0
+,0,198,10,0,128,72,24,0,0,184,25,0,0,184,25,0,0,176,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,193,14,3,48,84,30
+,224,13,0,0,0,70,6,0,128,56,3,0,0,78,3,0,0,78,3,0,0,177,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,197,14
+,3,48,84,30,224,13,0,0,0,70,6,0,128,84,3,0,0,106,3,0,0,106,3,0,0,178,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,201,14,3,48,84,30,224,13,0,0,0,70,9,0,128,80,15,0,0,42,16,0,0,42,16,0,0,179,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,205,14,3,48,84,30,224,13,0,0,0,198,10,0,128,164,8,0,0,156,9,0,0,156,9,0
+,0,180,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,209,14,3,48,84,30,224,13,0,0,0,198,1,0,128,4,0,0,0,12,0,0
+,0,12,0,0,0,181,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,213,14,3,48,84,30,224,13,0,0,0,198,1,0,128,20,0,0
+,0,28,0,0,0,28,0,0,0,182,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,217,14,3,48,84,30,224,13,0,0,0,198,1,0
+,128,20,0,0,0,28,0,0,0,28,0,0,0,183,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,221,14,3,48,84,30,224,13,0,0
+,0,70,2,0,128,96,0,0,0,117,0,0,0,117,0,0,0,184,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,225,14,3,48,84,30
+,224,13,0,0,0,198,1,0,128,20,0,0,0,41,0,0,0,41,0,0,0,185,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,229,14
+,3,48,84,30,224,13,0,0,0,198,1,0,128,28,0,0,0,36,0,0,0,36,0,0,0,186,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,233,14,3,48,84,30,224,13,0,0,0,70,2,0,128,120,0,0,0,141,0,0,0,141,0,0,0,187,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,237,14,3,48,84,30,224,13,0,0,0,70,2,0,128,116,0,0,0,137,0,0,0,137,0,0
+,0,188,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,241,14,3,48,84,30,224,13,0,0,0,198,1,0,128,28,0,0,0,36,0,0
+,0,36,0,0,0,189,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,245,14,3,48,84,30,224,13,0,0,0,70,2,0,128,28,1,0
+,0,49,1,0,0,49,1,0,0,190,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,249,14,3,48,84,30,224,13,0,0,0,70,2,0
+,128,52,1,0,0,73,1,0,0,73,1,0,0,191,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,253,14,3,48,84,30,224,13,0,0
+,0,198,1,0,128,28,0,0,0,36,0,0,0,36,0,0,0,192,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,1,15,3,48,84,30
+,224,13,0,0,0,198,1,0,128,28,0,0,0,36,0,0,0,36,0,0,0,193,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,5,15
+,3,48,84,30,224,13,0,0,0,198,1,0,128,28,0,0,0,36,0,0,0,36,0,0,0,194,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,9,15,3,48,84,30,224,13,0,0,0,198,1,0,128,28,0,0,0,36,0,0,0,36,0,0,0,195,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,13,15,3,48,84,30,224,13,0,0,0,70,2,0,128,136,0,0,0,157,0,0,0,157,0,0
+,0,196,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,17,15,3,48,84,30,224,13,0,0,0,198,1,0,128,28,0,0,0,36,0,0
+,0,36,0,0,0,197,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,21,15,3,48,84,30,224,13,0,0,0,70,2,0,128,120,0,0
+,0,141,0,0,0,141,0,0,0,198,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,25,15,3,48,84,30,224,13,0,0,0,70,2,0
+,128,116,0,0,0,137,0,0,0,137,0,0,0,199,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,29,15,3,48,84,30,224,13,0,0
+,0,198,1,0,128,28,0,0,0,36,0,0,0,36,0,0,0,200,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,33,15,3,48,84,30
+,224,13,0,0,0,70,2,0,128,28,1,0,0,49,1,0,0,49,1,0,0,201,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,37,15
+,3,48,84,30,224,13,0,0,0,70,2,0,128,52,1,0,0,73,1,0,0,73,1,0,0,202,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,41,15,3,48,84,30,224,13,0,0,0,198,1,0,128,28,0,0,0,36,0,0,0,36,0,0,0,203,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,45,15,3,48,84,30,224,13,0,0,0,198,1,0,128,28,0,0,0,36,0,0,0,36,0,0
+,0,204,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,49,15,3,48,84,30,224,13,0,0,0,198,1,0,128,28,0,0,0,36,0,0
+,0,36,0,0,0,205,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,53,15,3,48,84,30,224,13,0,0,0,198,1,0,128,28,0,0
+,0,36,0,0,0,36,0,0,0,206,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,57,15,3,48,84,30,224,13,0,0,0,70,2,0
+,128,136,0,0,0,157,0,0,0,157,0,0,0,207,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,61,15,3,48,84,30,224,13,0,0
+,0,198,3,0,128,176,0,0,0,197,0,0,0,197,0,0,0,208,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,65,15,3,48,84,30
+,224,13,0,0,0,198,1,0,128,36,0,0,0,44,0,0,0,44,0,0,0,209,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,69,15
+,3,48,84,30,224,13,0,0,0,198,1,0,128,32,0,0,0,40,0,0,0,40,0,0,0,210,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,73,15,3,48,84,30,224,13,0,0,0,198,1,0,128,28,0,0,0,36,0,0,0,36,0,0,0,211,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,77,15,3,48,84,30,224,13,0,0,0,198,1,0,128,60,0,0,0,68,0,0,0,68,0,0
+,0,212,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,81,15,3,48,84,30,224,13,0,0,0,198,1,0,128,60,0,0,0,68,0,0
+,0,68,0,0,0,213,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,85,15,3,48,84,30,224,13,0,0,0,198,1,0,128,28,0,0
+,0,36,0,0,0,36,0,0,0,214,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,89,15,3,48,84,30,224,13,0,0,0,198,1,0
+,128,28,0,0,0,36,0,0,0,36,0,0,0,215,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,93,15,3,48,84,30,224,13,0,0
+,0,198,1,0,128,32,0,0,0,40,0,0,0,40,0,0,0,216,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,97,15,3,48,84,30
+,224,13,0,0,0,198,1,0,128,32,0,0,0,40,0,0,0,40,0,0,0,217,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,101,15
+,3,48,84,30,224,13,0,0,0,198,3,0,128,176,0,0,0,197,0,0,0,197,0,0,0,218,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,105,15,3,48,84,30,224,13,0,0,0,198,1,0,128,32,0,0,0,40,0,0,0,40,0,0,0,219,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,109,15,3,48,84,30,224,13,0,0,0,198,1,0,128,32,0,0,0,40,0,0,0,40,0,0
+,0,220,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,113,15,3,48,84,30,224,13,0,0,0,198,1,0,128,32,0,0,0,40,0,0
+,0,40,0,0,0,221,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,117,15,3,48,84,30,224,13,0,0,0,70,5,0,128,44,9,0
+,0,136,9,0,0,136,9,0,0,222,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,121,15,3,48,84,30,224,13,0,0,0,198,1,0
+,128,24,0,0,0,45,0,0,0,45,0,0,0,223,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,125,15,3,48,84,30,224,13,0,0
+,0,198,1,0,128,36,0,0,0,57,0,0,0,57,0,0,0,224,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,129,15,3,48,84,30
+,224,13,0,0,0,198,1,0,128,8,0,0,0,16,0,0,0,16,0,0,0,225,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,133,15
+,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,226,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,137,15,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0,0,227,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,141,15,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0,0,12,0,0
+,0,228,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,145,15,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0,0,12,0,0
+,0,12,0,0,0,229,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,149,15,3,48,84,30,224,13,0,0,0,6,0,0,128,12,0,0
+,0,12,0,0,0,12,0,0,0,230,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,153,15,3,48,84,30,224,13,0,0,0,194,1,0
+,128,24,0,0,0,32,0,0,0,32,0,0,0,231,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,157,15,3,48,84,30,224,13,0,0
+,0,194,1,0,128,24,0,0,0,32,0,0,0,32,0,0,0,232,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,161,15,3,48,84,30
+,224,13,0,0,0,66,5,0,128,232,0,0,0,26,1,0,0,26,1,0,0,233,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,165,15
+,3,48,84,30,224,13,0,0,0,66,5,0,128,232,0,0,0,26,1,0,0,26,1,0,0,234,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,169,15,3,48,84,30,224,13,0,0,0,66,5,0,128,232,0,0,0,26,1,0,0,26,1,0,0,235,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,173,15,3,48,84,30,224,13,0,0,0,66,5,0,128,232,0,0,0,26,1,0,0,26,1,0
+,0,236,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,177,15,3,48,84,30,224,13,0,0,0,66,5,0,128,232,0,0,0,26,1,0
+,0,26,1,0,0,237,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,181,15,3,48,84,30,224,13,0,0,0,66,5,0,128,232,0,0
+,0,26,1,0,0,26,1,0,0,238,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,185,15,3,48,84,30,224,13,0,0,0,66,5,0
+,128,232,0,0,0,26,1,0,0,26,1,0,0,239,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,189,15,3,48,84,30,224,13,0,0
+,0,66,5,0,128,232,0,0,0,26,1,0,0,26,1,0,0,240,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,193,15,3,48,84,30
+,224,13,0,0,0,66,5,0,128,232,0,0,0,26,1,0,0,26,1,0,0,241,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,197,15
+,3,48,84,30,224,13,0,0,0,194,1,0,128,52,0,0,0,60,0,0,0,60,0,0,0,242,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,201,15,3,48,84,30,224,13,0,0,0,194,1,0,128,60,0,0,0,68,0,0,0,68,0,0,0,243,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,205,15,3,48,84,30,224,13,0,0,0,194,1,0,128,56,0,0,0,64,0,0,0,64,0,0
+,0,244,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,209,15,3,48,84,30,224,13,0,0,0,194,1,0,128,56,0,0,0,64,0,0
+,0,64,0,0,0,245,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,213,15,3,48,84,30,224,13,0,0,0,194,1,0,128,56,0,0
+,0,64,0,0,0,64,0,0,0,246,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,217,15,3,48,84,30,224,13,0,0,0,194,1,0
+,128,20,0,0,0,28,0,0,0,28,0,0,0,247,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,221,15,3,48,84,30,224,13,0,0
+,0,194,1,0,128,20,0,0,0,28,0,0,0,28,0,0,0,248,3,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,225,15,3,48,84,30
+,224,13,0,0,0,194,1,0,128,64,0,0,0,72,0,0,0,72,0,0,0,249,3,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,229,15
+,3,48,84,30,224,13,0,0,0,66,5,0,128,172,16,0,0,134,17,0,0,134,17,0,0,250,3,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,233,15,3,48,84,30,224,13,0,0,0,66,5,0,128,204,13,0,0,152,14,0,0,152,14,0,0,251,3,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,237,15,3,48,84,30,224,13,0,0,0,194,3,0,128,220,0,0,0,241,0,0,0,241,0,0
+,0,252,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,241,15,3,48,84,30,224,13,0,0,0,194,1,0,128,40,0,0,0,48,0,0
+,0,48,0,0,0,253,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,245,15,3,48,84,30,224,13,0,0,0,194,1,0,128,36,0,0
+,0,44,0,0,0,44,0,0,0,254,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,249,15,3,48,84,30,224,13,0,0,0,194,1,0
+,128,92,0,0,0,100,0,0,0,100,0,0,0,255,3,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,253,15,3,48,84,30,224,13,0,0
+,0,194,1,0,128,64,0,0,0,72,0,0,0,72,0,0,0,0,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,1,16,3,48,84,30
+,224,13,0,0,0,194,1,0,128,64,0,0,0,72,0,0,0,72,0,0,0,1,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,5,16
+,3,48,84,30,224,13,0,0,0,194,1,0,128,36,0,0,0,44,0,0,0,44,0,0,0,2,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,9,16,3,48,84,30,224,13,0,0,0,194,1,0,128,140,0,0,0,148,0,0,0,148,0,0,0,3,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,13,16,3,48,84,30,224,13,0,0,0,194,1,0,128,112,0,0,0,120,0,0,0,120,0,0
+,0,4,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,17,16,3,48,84,30,224,13,0,0,0,66,3,0,128,124,0,0,0,145,0,0
+,0,145,0,0,0,5,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,21,16,3,48,84,30,224,13,0,0,0,66,3,0,128,212,0,0
+,0,233,0,0,0,233,0,0,0,6,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,25,16,3,48,84,30,224,13,0,0,0,194,5,0
+,128,228,14,0,0,204,15,0,0,204,15,0,0,7,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,29,16,3,48,84,30,224,13,0,0
+,0,66,3,0,128,124,0,0,0,145,0,0,0,145,0,0,0,8,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,33,16,3,48,84,30
+,224,13,0,0,0,66,3,0,128,212,0,0,0,233,0,0,0,233,0,0,0,9,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,37,16
+,3,48,84,30,224,13,0,0,0,194,5,0,128,144,14,0,0,106,15,0,0,106,15,0,0,10,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,41,16,3,48,84,30,224,13,0,0,0,66,3,0,128,212,0,0,0,233,0,0,0,233,0,0,0,11,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,45,16,3,48,84,30,224,13,0,0,0,194,1,0,128,32,0,0,0,40,0,0,0,40,0,0
+,0,12,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,49,16,3,48,84,30,224,13,0,0,0,194,1,0,128,32,0,0,0,40,0,0
+,0,40,0,0,0,13,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,53,16,3,48,84,30,224,13,0,0,0,194,1,0,128,40,0,0
+,0,48,0,0,0,48,0,0,0,14,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,57,16,3,48,84,30,224,13,0,0,0,194,4,0
+,128,224,15,0,0,246,15,0,0,246,15,0,0,15,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,61,16,3,48,84,30,224,13,0,0
+,0,66,3,0,128,120,0,0,0,141,0,0,0,141,0,0,0,16,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,65,16,3,48,84,30
+,224,13,0,0,0,66,3,0,128,184,0,0,0,205,0,0,0,205,0,0,0,17,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,69,16
+,3,48,84,30,224,13,0,0,0,194,1,0,128,136,0,0,0,144,0,0,0,144,0,0,0,18,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,73,16,3,48,84,30,224,13,0,0,0,194,3,0,128,32,1,0,0,53,1,0,0,53,1,0,0,19,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,77,16,3,48,84,30,224,13,0,0,0,66,3,0,128,172,0,0,0,193,0,0,0,193,0,0
+,0,20,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,81,16,3,48,84,30,224,13,0,0,0,66,3,0,128,136,0,0,0,157,0,0
+,0,157,0,0,0,21,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,85,16,3,48,84,30,224,13,0,0,0,66,3,0,128,172,0,0
+,0,193,0,0,0,193,0,0,0,22,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,89,16,3,48,84,30,224,13,0,0,0,66,3,0
+,128,164,0,0,0,185,0,0,0,185,0,0,0,23,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,93,16,3,48,84,30,224,13,0,0
+,0,66,3,0,128,164,0,0,0,185,0,0,0,185,0,0,0,24,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,97,16,3,48,84,30
+,224,13,0,0,0,194,3,0,128,196,0,0,0,217,0,0,0,217,0,0,0,25,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,101,16
+,3,48,84,30,224,13,0,0,0,194,3,0,128,160,0,0,0,181,0,0,0,181,0,0,0,26,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,105,16,3,48,84,30,224,13,0,0,0,194,5,0,128,84,4,0,0,162,4,0,0,162,4,0,0,27,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,109,16,3,48,84,30,224,13,0,0,0,66,5,0,128,244,3,0,0,10,4,0,0,10,4,0
+,0,28,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,113,16,3,48,84,30,224,13,0,0,0,66,5,0,128,48,4,0,0,70,4,0
+,0,70,4,0,0,29,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,117,16,3,48,84,30,224,13,0,0,0,66,5,0,128,20,4,0
+,0,42,4,0,0,42,4,0,0,30,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,121,16,3,48,84,30,224,13,0,0,0,66,5,0
+,128,188,3,0,0,210,3,0,0,210,3,0,0,31,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,125,16,3,48,84,30,224,13,0,0
+,0,66,3,0,128,184,0,0,0,205,0,0,0,205,0,0,0,32,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,129,16,3,48,84,30
+,224,13,0,0,0,194,7,0,128,16,4,0,0,80,4,0,0,80,4,0,0,33,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,133,16
+,3,48,84,30,224,13,0,0,0,194,7,0,128,40,4,0,0,104,4,0,0,104,4,0,0,34,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,137,16,3,48,84,30,224,13,0,0,0,194,7,0,128,40,4,0,0,104,4,0,0,104,4,0,0,35,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,141,16,3,48,84,30,224,13,0,0,0,194,7,0,128,80,4,0,0,144,4,0,0,144,4,0
+,0,36,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,145,16,3,48,84,30,224,13,0,0,0,194,7,0,128,80,4,0,0,144,4,0
+,0,144,4,0,0,37,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,149,16,3,48,84,30,224,13,0,0,0,194,7,0,128,244,4,0
+,0,66,5,0,0,66,5,0,0,38,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,153,16,3,48,84,30,224,13,0,0,0,194,6,0
+,128,144,3,0,0,222,3,0,0,222,3,0,0,39,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,157,16,3,48,84,30,224,13,0,0
+,0,66,5,0,128,60,3,0,0,124,3,0,0,124,3,0,0,40,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,161,16,3,48,84,30
+,224,13,0,0,0,66,5,0,128,88,3,0,0,110,3,0,0,110,3,0,0,41,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,165,16
+,3,48,84,30,224,13,0,0,0,66,5,0,128,120,3,0,0,142,3,0,0,142,3,0,0,42,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,169,16,3,48,84,30,224,13,0,0,0,66,5,0,128,248,2,0,0,14,3,0,0,14,3,0,0,43,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,173,16,3,48,84,30,224,13,0,0,0,66,3,0,128,184,0,0,0,205,0,0,0,205,0,0
+,0,44,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,177,16,3,48,84,30,224,13,0,0,0,194,5,0,128,236,1,0,0,16,2,0
+,0,16,2,0,0,45,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,181,16,3,48,84,30,224,13,0,0,0,194,5,0,128,236,1,0
+,0,16,2,0,0,16,2,0,0,46,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,185,16,3,48,84,30,224,13,0,0,0,194,5,0
+,128,236,1,0,0,16,2,0,0,16,2,0,0,47,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,189,16,3,48,84,30,224,13,0,0
+,0,194,5,0,128,4,2,0,0,40,2,0,0,40,2,0,0,48,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,193,16,3,48,84,30
+,224,13,0,0,0,194,5,0,128,4,2,0,0,40,2,0,0,40,2,0,0,49,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,197,16
+,3,48,84,30,224,13,0,0,0,66,6,0,128,160,2,0,0,210,2,0,0,210,2,0,0,50,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,201,16,3,48,84,30,224,13,0,0,0,66,4,0,128,80,2,0,0,101,2,0,0,101,2,0,0,51,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,205,16,3,48,84,30,224,13,0,0,0,66,4,0,128,80,2,0,0,101,2,0,0,101,2,0
+,0,52,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,209,16,3,48,84,30,224,13,0,0,0,66,4,0,128,88,2,0,0,109,2,0
+,0,109,2,0,0,53,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,213,16,3,48,84,30,224,13,0,0,0,194,5,0,128,248,1,0
+,0,28,2,0,0,28,2,0,0,54,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,217,16,3,48,84,30,224,13,0,0,0,194,1,0
+,128,112,0,0,0,120,0,0,0,120,0,0,0,55,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,221,16,3,48,84,30,224,13,0,0
+,0,194,1,0,128,36,0,0,0,44,0,0,0,44,0,0,0,56,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,225,16,3,48,84,30
+,224,13,0,0,0,194,1,0,128,192,0,0,0,200,0,0,0,200,0,0,0,57,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,229,16
+,3,48,84,30,224,13,0,0,0,66,3,0,128,120,0,0,0,141,0,0,0,141,0,0,0,58,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,233,16,3,48,84,30,224,13,0,0,0,66,3,0,128,112,0,0,0,133,0,0,0,133,0,0,0,59,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,237,16,3,48,84,30,224,13,0,0,0,194,1,0,128,100,0,0,0,121,0,0,0,121,0,0
+,0,60,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,241,16,3,48,84,30,224,13,0,0,0,194,1,0,128,96,1,0,0,104,1,0
+,0,104,1,0,0,61,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,245,16,3,48,84,30,224,13,0,0,0,194,1,0,128,96,1,0
+,0,104,1,0,0,104,1,0,0,62,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,249,16,3,48,84,30,224,13,0,0,0,194,1,0
+,128,92,1,0,0,100,1,0,0,100,1,0,0,63,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,253,16,3,48,84,30,224,13,0,0
+,0,194,1,0,128,108,1,0,0,116,1,0,0,116,1,0,0,64,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,1,17,3,48,84,30
+,224,13,0,0,0,194,1,0,128,120,1,0,0,128,1,0,0,128,1,0,0,65,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,5,17
+,3,48,84,30,224,13,0,0,0,194,1,0,128,92,1,0,0,100,1,0,0,100,1,0,0,66,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,9,17,3,48,84,30,224,13,0,0,0,194,1,0,128,100,1,0,0,108,1,0,0,108,1,0,0,67,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,13,17,3,48,84,30,224,13,0,0,0,194,1,0,128,100,1,0,0,108,1,0,0,108,1,0
+,0,68,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,17,17,3,48,84,30,224,13,0,0,0,194,1,0,128,112,1,0,0,120,1,0
+,0,120,1,0,0,69,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,21,17,3,48,84,30,224,13,0,0,0,194,1,0,128,60,0,0
+,0,68,0,0,0,68,0,0,0,70,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,25,17,3,48,84,30,224,13,0,0,0,194,1,0
+,128,96,1,0,0,104,1,0,0,104,1,0,0,71,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,29,17,3,48,84,30,224,13,0,0
+,0,66,2,0,128,124,0,0,0,145,0,0,0,145,0,0,0,72,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,33,17,3,48,84,30
+,224,13,0,0,0,194,2,0,128,160,0,0,0,181,0,0,0,181,0,0,0,73,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,37,17
+,3,48,84,30,224,13,0,0,0,194,1,0,128,60,0,0,0,68,0,0,0,68,0,0,0,74,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,41,17,3,48,84,30,224,13,0,0,0,66,4,0,128,232,5,0,0,14,7,0,0,14,7,0,0,75,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,45,17,3,48,84,30,224,13,0,0,0,194,5,0,128,204,3,0,0,254,3,0,0,254,3,0
+,0,76,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,49,17,3,48,84,30,224,13,0,0,0,66,2,0,128,224,1,0,0,245,1,0
+,0,245,1,0,0,77,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,53,17,3,48,84,30,224,13,0,0,0,66,6,0,128,220,6,0
+,0,84,7,0,0,84,7,0,0,78,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,57,17,3,48,84,30,224,13,0,0,0,194,3,0
+,128,84,4,0,0,105,4,0,0,105,4,0,0,79,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,61,17,3,48,84,30,224,13,0,0
+,0,194,5,0,128,20,6,0,0,24,7,0,0,24,7,0,0,80,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,65,17,3,48,84,30
+,224,13,0,0,0,194,5,0,128,20,6,0,0,24,7,0,0,24,7,0,0,81,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,69,17
+,3,48,84,30,224,13,0,0,0,194,5,0,128,20,6,0,0,24,7,0,0,24,7,0,0,82,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,73,17,3,48,84,30,224,13,0,0,0,194,5,0,128,20,6,0,0,24,7,0,0,24,7,0,0,83,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,77,17,3,48,84,30,224,13,0,0,0,194,1,0,128,48,0,0,0,56,0,0,0,56,0,0
+,0,84,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,81,17,3,48,84,30,224,13,0,0,0,66,5,0,128,76,3,0,0,168,3,0
+,0,168,3,0,0,85,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,85,17,3,48,84,30,224,13,0,0,0,66,3,0,128,156,0,0
+,0,177,0,0,0,177,0,0,0,86,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,89,17,3,48,84,30,224,13,0,0,0,194,1,0
+,128,52,0,0,0,60,0,0,0,60,0,0,0,87,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,93,17,3,48,84,30,224,13,0,0
+,0,194,1,0,128,36,0,0,0,44,0,0,0,44,0,0,0,88,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,97,17,3,48,84,30
+,224,13,0,0,0,194,1,0,128,36,0,0,0,44,0,0,0,44,0,0,0,89,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,101,17
+,3,48,84,30,224,13,0,0,0,194,1,0,128,80,1,0,0,88,1,0,0,88,1,0,0,90,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,105,17,3,48,84,30,224,13,0,0,0,194,3,0,128,116,0,0,0,137,0,0,0,137,0,0,0,91,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,109,17,3,48,84,30,224,13,0,0,0,66,3,0,128,208,0,0,0,229,0,0,0,229,0,0
+,0,92,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,113,17,3,48,84,30,224,13,0,0,0,66,3,0,128,236,0,0,0,1,1,0
+,0,1,1,0,0,93,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,117,17,3,48,84,30,224,13,0,0,0,194,3,0,128,116,0,0
+,0,137,0,0,0,137,0,0,0,94,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,121,17,3,48,84,30,224,13,0,0,0,66,3,0
+,128,116,0,0,0,137,0,0,0,137,0,0,0,95,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,125,17,3,48,84,30,224,13,0,0
+,0,194,2,0,128,100,1,0,0,134,1,0,0,134,1,0,0,96,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,129,17,3,48,84,30
+,224,13,0,0,0,194,7,0,128,132,5,0,0,24,6,0,0,24,6,0,0,97,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,133,17
+,3,48,84,30,224,13,0,0,0,66,3,0,128,92,0,0,0,113,0,0,0,113,0,0,0,98,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,137,17,3,48,84,30,224,13,0,0,0,194,4,0,128,28,3,0,0,78,3,0,0,78,3,0,0,99,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,141,17,3,48,84,30,224,13,0,0,0,194,7,0,128,20,7,0,0,168,7,0,0,168,7,0
+,0,100,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,145,17,3,48,84,30,224,13,0,0,0,66,4,0,128,208,0,0,0,229,0,0
+,0,229,0,0,0,101,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,149,17,3,48,84,30,224,13,0,0,0,66,3,0,128,168,0,0
+,0,189,0,0,0,189,0,0,0,102,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,153,17,3,48,84,30,224,13,0,0,0,194,4,0
+,128,84,1,0,0,106,1,0,0,106,1,0,0,103,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,157,17,3,48,84,30,224,13,0,0
+,0,66,3,0,128,64,1,0,0,85,1,0,0,85,1,0,0,104,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,161,17,3,48,84,30
+,224,13,0,0,0,66,2,0,128,120,0,0,0,141,0,0,0,141,0,0,0,105,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,165,17
+,3,48,84,30,224,13,0,0,0,66,2,0,128,132,0,0,0,153,0,0,0,153,0,0,0,106,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,169,17,3,48,84,30,224,13,0,0,0,66,5,0,128,4,1,0,0,26,1,0,0,26,1,0,0,107,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,173,17,3,48,84,30,224,13,0,0,0,66,5,0,128,4,1,0,0,26,1,0,0,26,1,0
+,0,108,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,177,17,3,48,84,30,224,13,0,0,0,66,2,0,128,132,0,0,0,153,0,0
+,0,153,0,0,0,109,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,181,17,3,48,84,30,224,13,0,0,0,194,7,0,128,60,4,0
+,0,138,4,0,0,138,4,0,0,110,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,185,17,3,48,84,30,224,13,0,0,0,66,5,0
+,128,52,2,0,0,102,2,0,0,102,2,0,0,111,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,189,17,3,48,84,30,224,13,0,0
+,0,194,5,0,128,48,2,0,0,98,2,0,0,98,2,0,0,112,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,193,17,3,48,84,30
+,224,13,0,0,0,194,4,0,128,108,1,0,0,130,1,0,0,130,1,0,0,113,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,197,17
+,3,48,84,30,224,13,0,0,0,194,1,0,128,44,0,0,0,52,0,0,0,52,0,0,0,114,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,201,17,3,48,84,30,224,13,0,0,0,194,1,0,128,60,0,0,0,68,0,0,0,68,0,0,0,115,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,205,17,3,48,84,30,224,13,0,0,0,194,1,0,128,80,0,0,0,88,0,0,0,88,0,0
+,0,116,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,209,17,3,48,84,30,224,13,0,0,0,194,1,0,128,80,0,0,0,88,0,0
+,0,88,0,0,0,117,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,213,17,3,48,84,30,224,13,0,0,0,194,1,0,128,80,0,0
+,0,88,0,0,0,88,0,0,0,118,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,217,17,3,48,84,30,224,13,0,0,0,194,1,0
+,128,80,0,0,0,88,0,0,0,88,0,0,0,119,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,221,17,3,48,84,30,224,13,0,0
+,0,194,1,0,128,84,0,0,0,92,0,0,0,92,0,0,0,120,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,225,17,3,48,84,30
+,224,13,0,0,0,194,1,0,128,80,0,0,0,88,0,0,0,88,0,0,0,121,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,229,17
+,3,48,84,30,224,13,0,0,0,194,1,0,128,80,0,0,0,88,0,0,0,88,0,0,0,122,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,233,17,3,48,84,30,224,13,0,0,0,194,1,0,128,88,0,0,0,96,0,0,0,96,0,0,0,123,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,237,17,3,48,84,30,224,13,0,0,0,194,1,0,128,156,0,0,0,164,0,0,0,164,0,0
+,0,124,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,241,17,3,48,84,30,224,13,0,0,0,194,1,0,128,156,0,0,0,164,0,0
+,0,164,0,0,0,125,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,245,17,3,48,84,30,224,13,0,0,0,194,1,0,128,144,0,0
+,0,152,0,0,0,152,0,0,0,126,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,249,17,3,48,84,30,224,13,0,0,0,194,1,0
+,128,144,0,0,0,152,0,0,0,152,0,0,0,127,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,253,17,3,48,84,30,224,13,0,0
+,0,194,1,0,128,68,0,0,0,76,0,0,0,76,0,0,0,128,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,1,18,3,48,84,30
+,224,13,0,0,0,194,1,0,128,68,0,0,0,76,0,0,0,76,0,0,0,129,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,5,18
+,3,48,84,30,224,13,0,0,0,194,1,0,128,68,0,0,0,76,0,0,0,76,0,0,0,130,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,9,18,3,48,84,30,224,13,0,0,0,194,1,0,128,68,0,0,0,76,0,0,0,76,0,0,0,131,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,13,18,3,48,84,30,224,13,0,0,0,194,1,0,128,68,0,0,0,76,0,0,0,76,0,0
+,0,132,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,17,18,3,48,84,30,224,13,0,0,0,194,1,0,128,68,0,0,0,76,0,0
+,0,76,0,0,0,133,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,21,18,3,48,84,30,224,13,0,0,0,194,1,0,128,72,0,0
+,0,80,0,0,0,80,0,0,0,134,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,25,18,3,48,84,30,224,13,0,0,0,194,1,0
+,128,76,0,0,0,84,0,0,0,84,0,0,0,135,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,29,18,3,48,84,30,224,13,0,0
+,0,194,1,0,128,112,0,0,0,120,0,0,0,120,0,0,0,136,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,33,18,3,48,84,30
+,224,13,0,0,0,66,3,0,128,208,1,0,0,229,1,0,0,229,1,0,0,137,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,37,18
+,3,48,84,30,224,13,0,0,0,194,1,0,128,28,1,0,0,36,1,0,0,36,1,0,0,138,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,41,18,3,48,84,30,224,13,0,0,0,194,1,0,128,60,0,0,0,68,0,0,0,68,0,0,0,139,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,45,18,3,48,84,30,224,13,0,0,0,66,3,0,128,4,1,0,0,25,1,0,0,25,1,0
+,0,140,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,49,18,3,48,84,30,224,13,0,0,0,194,1,0,128,48,0,0,0,56,0,0
+,0,56,0,0,0,141,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,53,18,3,48,84,30,224,13,0,0,0,194,3,0,128,124,0,0
+,0,145,0,0,0,145,0,0,0,142,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,57,18,3,48,84,30,224,13,0,0,0,194,1,0
+,128,36,0,0,0,44,0,0,0,44,0,0,0,143,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,61,18,3,48,84,30,224,13,0,0
+,0,194,2,0,128,120,0,0,0,141,0,0,0,141,0,0,0,144,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,65,18,3,48,84,30
+,224,13,0,0,0,194,2,0,128,120,0,0,0,141,0,0,0,141,0,0,0,145,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,69,18
+,3,48,84,30,224,13,0,0,0,66,2,0,128,116,0,0,0,137,0,0,0,137,0,0,0,146,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,73,18,3,48,84,30,224,13,0,0,0,194,2,0,128,160,0,0,0,181,0,0,0,181,0,0,0,147,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,77,18,3,48,84,30,224,13,0,0,0,194,2,0,128,136,0,0,0,157,0,0,0,157,0,0
+,0,148,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,81,18,3,48,84,30,224,13,0,0,0,194,2,0,128,136,0,0,0,157,0,0
+,0,157,0,0,0,149,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,85,18,3,48,84,30,224,13,0,0,0,194,1,0,128,124,0,0
+,0,132,0,0,0,132,0,0,0,150,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,89,18,3,48,84,30,224,13,0,0,0,66,4,0
+,128,92,2,0,0,113,2,0,0,113,2,0,0,151,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,93,18,3,48,84,30,224,13,0,0
+,0,194,1,0,128,132,0,0,0,140,0,0,0,140,0,0,0,152,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,97,18,3,48,84,30
+,224,13,0,0,0,66,2,0,128,160,0,0,0,181,0,0,0,181,0,0,0,153,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,101,18
+,3,48,84,30,224,13,0,0,0,194,3,0,128,104,0,0,0,125,0,0,0,125,0,0,0,154,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,105,18,3,48,84,30,224,13,0,0,0,194,3,0,128,124,0,0,0,145,0,0,0,145,0,0,0,155,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,109,18,3,48,84,30,224,13,0,0,0,194,1,0,128,56,0,0,0,77,0,0,0,77,0,0
+,0,156,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,113,18,3,48,84,30,224,13,0,0,0,194,1,0,128,60,0,0,0,81,0,0
+,0,81,0,0,0,157,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,117,18,3,48,84,30,224,13,0,0,0,66,5,0,128,236,0,0
+,0,30,1,0,0,30,1,0,0,158,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,121,18,3,48,84,30,224,13,0,0,0,66,5,0
+,128,236,0,0,0,30,1,0,0,30,1,0,0,159,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,125,18,3,48,84,30,224,13,0,0
+,0,66,5,0,128,236,0,0,0,30,1,0,0,30,1,0,0,160,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,129,18,3,48,84,30
+,224,13,0,0,0,66,5,0,128,236,0,0,0,30,1,0,0,30,1,0,0,161,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,133,18
+,3,48,84,30,224,13,0,0,0,66,5,0,128,236,0,0,0,30,1,0,0,30,1,0,0,162,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,137,18,3,48,84,30,224,13,0,0,0,66,5,0,128,236,0,0,0,30,1,0,0,30,1,0,0,163,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,141,18,3,48,84,30,224,13,0,0,0,194,1,0,128,32,0,0,0,40,0,0,0,40,0,0
+,0,164,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,145,18,3,48,84,30,224,13,0,0,0,194,1,0,128,32,0,0,0,40,0,0
+,0,40,0,0,0,165,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,149,18,3,48,84,30,224,13,0,0,0,66,5,0,128,56,14,0
+,0,18,15,0,0,18,15,0,0,166,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,153,18,3,48,84,30,224,13,0,0,0,66,5,0
+,128,24,14,0,0,228,14,0,0,228,14,0,0,167,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,157,18,3,48,84,30,224,13,0,0
+,0,194,3,0,128,224,0,0,0,245,0,0,0,245,0,0,0,168,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,161,18,3,48,84,30
+,224,13,0,0,0,194,1,0,128,40,0,0,0,48,0,0,0,48,0,0,0,169,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,165,18
+,3,48,84,30,224,13,0,0,0,194,1,0,128,36,0,0,0,44,0,0,0,44,0,0,0,170,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,169,18,3,48,84,30,224,13,0,0,0,194,1,0,128,64,0,0,0,72,0,0,0,72,0,0,0,171,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,173,18,3,48,84,30,224,13,0,0,0,194,1,0,128,64,0,0,0,72,0,0,0,72,0,0
+,0,172,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,177,18,3,48,84,30,224,13,0,0,0,194,1,0,128,36,0,0,0,44,0,0
+,0,44,0,0,0,173,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,181,18,3,48,84,30,224,13,0,0,0,194,1,0,128,36,0,0
+,0,44,0,0,0,44,0,0,0,174,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,185,18,3,48,84,30,224,13,0,0,0,194,1,0
+,128,140,0,0,0,148,0,0,0,148,0,0,0,175,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,189,18,3,48,84,30,224,13,0,0
+,0,194,1,0,128,112,0,0,0,120,0,0,0,120,0,0,0,176,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,193,18,3,48,84,30
+,224,13,0,0,0,66,3,0,128,128,0,0,0,149,0,0,0,149,0,0,0,177,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,197,18
+,3,48,84,30,224,13,0,0,0,66,3,0,128,220,0,0,0,241,0,0,0,241,0,0,0,178,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,201,18,3,48,84,30,224,13,0,0,0,194,5,0,128,232,14,0,0,208,15,0,0,208,15,0,0,179,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,205,18,3,48,84,30,224,13,0,0,0,66,3,0,128,128,0,0,0,149,0,0,0,149,0,0
+,0,180,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,209,18,3,48,84,30,224,13,0,0,0,66,3,0,128,220,0,0,0,241,0,0
+,0,241,0,0,0,181,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,213,18,3,48,84,30,224,13,0,0,0,194,5,0,128,148,14,0
+,0,110,15,0,0,110,15,0,0,182,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,217,18,3,48,84,30,224,13,0,0,0,66,3,0
+,128,224,0,0,0,245,0,0,0,245,0,0,0,183,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,221,18,3,48,84,30,224,13,0,0
+,0,194,1,0,128,32,0,0,0,40,0,0,0,40,0,0,0,184,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,225,18,3,48,84,30
+,224,13,0,0,0,194,1,0,128,32,0,0,0,40,0,0,0,40,0,0,0,185,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,229,18
+,3,48,84,30,224,13,0,0,0,194,1,0,128,40,0,0,0,48,0,0,0,48,0,0,0,186,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,233,18,3,48,84,30,224,13,0,0,0,194,4,0,128,220,15,0,0,242,15,0,0,242,15,0,0,187,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,237,18,3,48,84,30,224,13,0,0,0,66,3,0,128,124,0,0,0,145,0,0,0,145,0,0
+,0,188,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,241,18,3,48,84,30,224,13,0,0,0,66,3,0,128,156,0,0,0,177,0,0
+,0,177,0,0,0,189,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,245,18,3,48,84,30,224,13,0,0,0,194,1,0,128,136,0,0
+,0,144,0,0,0,144,0,0,0,190,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,249,18,3,48,84,30,224,13,0,0,0,194,3,0
+,128,36,1,0,0,57,1,0,0,57,1,0,0,191,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,253,18,3,48,84,30,224,13,0,0
+,0,66,3,0,128,176,0,0,0,197,0,0,0,197,0,0,0,192,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,1,19,3,48,84,30
+,224,13,0,0,0,66,3,0,128,140,0,0,0,161,0,0,0,161,0,0,0,193,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,5,19
+,3,48,84,30,224,13,0,0,0,66,3,0,128,176,0,0,0,197,0,0,0,197,0,0,0,194,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,9,19,3,48,84,30,224,13,0,0,0,66,3,0,128,168,0,0,0,189,0,0,0,189,0,0,0,195,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,13,19,3,48,84,30,224,13,0,0,0,66,3,0,128,168,0,0,0,189,0,0,0,189,0,0
+,0,196,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,17,19,3,48,84,30,224,13,0,0,0,194,3,0,128,200,0,0,0,221,0,0
+,0,221,0,0,0,197,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,21,19,3,48,84,30,224,13,0,0,0,194,3,0,128,164,0,0
+,0,185,0,0,0,185,0,0,0,198,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,25,19,3,48,84,30,224,13,0,0,0,194,5,0
+,128,56,4,0,0,134,4,0,0,134,4,0,0,199,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,29,19,3,48,84,30,224,13,0,0
+,0,66,5,0,128,224,3,0,0,246,3,0,0,246,3,0,0,200,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,33,19,3,48,84,30
+,224,13,0,0,0,66,5,0,128,28,4,0,0,50,4,0,0,50,4,0,0,201,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,37,19
+,3,48,84,30,224,13,0,0,0,66,5,0,128,28,4,0,0,50,4,0,0,50,4,0,0,202,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,41,19,3,48,84,30,224,13,0,0,0,66,5,0,128,196,3,0,0,218,3,0,0,218,3,0,0,203,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,45,19,3,48,84,30,224,13,0,0,0,66,3,0,128,184,0,0,0,205,0,0,0,205,0,0
+,0,204,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,49,19,3,48,84,30,224,13,0,0,0,194,7,0,128,20,4,0,0,84,4,0
+,0,84,4,0,0,205,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,53,19,3,48,84,30,224,13,0,0,0,194,7,0,128,44,4,0
+,0,108,4,0,0,108,4,0,0,206,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,57,19,3,48,84,30,224,13,0,0,0,194,7,0
+,128,44,4,0,0,108,4,0,0,108,4,0,0,207,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,61,19,3,48,84,30,224,13,0,0
+,0,194,7,0,128,84,4,0,0,148,4,0,0,148,4,0,0,208,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,65,19,3,48,84,30
+,224,13,0,0,0,194,7,0,128,84,4,0,0,148,4,0,0,148,4,0,0,209,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,69,19
+,3,48,84,30,224,13,0,0,0,194,7,0,128,248,4,0,0,70,5,0,0,70,5,0,0,210,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,73,19,3,48,84,30,224,13,0,0,0,194,6,0,128,120,3,0,0,198,3,0,0,198,3,0,0,211,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,77,19,3,48,84,30,224,13,0,0,0,66,5,0,128,40,3,0,0,104,3,0,0,104,3,0
+,0,212,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,81,19,3,48,84,30,224,13,0,0,0,66,5,0,128,92,3,0,0,114,3,0
+,0,114,3,0,0,213,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,85,19,3,48,84,30,224,13,0,0,0,66,5,0,128,128,3,0
+,0,150,3,0,0,150,3,0,0,214,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,89,19,3,48,84,30,224,13,0,0,0,66,5,0
+,128,252,2,0,0,18,3,0,0,18,3,0,0,215,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,93,19,3,48,84,30,224,13,0,0
+,0,66,3,0,128,188,0,0,0,209,0,0,0,209,0,0,0,216,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,97,19,3,48,84,30
+,224,13,0,0,0,194,5,0,128,244,1,0,0,24,2,0,0,24,2,0,0,217,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,101,19
+,3,48,84,30,224,13,0,0,0,194,5,0,128,244,1,0,0,24,2,0,0,24,2,0,0,218,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,105,19,3,48,84,30,224,13,0,0,0,194,5,0,128,244,1,0,0,24,2,0,0,24,2,0,0,219,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,109,19,3,48,84,30,224,13,0,0,0,194,5,0,128,12,2,0,0,48,2,0,0,48,2,0
+,0,220,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,113,19,3,48,84,30,224,13,0,0,0,194,5,0,128,12,2,0,0,48,2,0
+,0,48,2,0,0,221,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,117,19,3,48,84,30,224,13,0,0,0,66,6,0,128,168,2,0
+,0,218,2,0,0,218,2,0,0,222,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,121,19,3,48,84,30,224,13,0,0,0,66,4,0
+,128,60,2,0,0,81,2,0,0,81,2,0,0,223,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,125,19,3,48,84,30,224,13,0,0
+,0,66,4,0,128,60,2,0,0,81,2,0,0,81,2,0,0,224,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,129,19,3,48,84,30
+,224,13,0,0,0,66,4,0,128,96,2,0,0,117,2,0,0,117,2,0,0,225,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,133,19
+,3,48,84,30,224,13,0,0,0,194,5,0,128,0,2,0,0,36,2,0,0,36,2,0,0,226,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,137,19,3,48,84,30,224,13,0,0,0,66,3,0,128,124,0,0,0,145,0,0,0,145,0,0,0,227,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,141,19,3,48,84,30,224,13,0,0,0,66,3,0,128,116,0,0,0,137,0,0,0,137,0,0
+,0,228,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,145,19,3,48,84,30,224,13,0,0,0,194,1,0,128,104,0,0,0,125,0,0
+,0,125,0,0,0,229,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,149,19,3,48,84,30,224,13,0,0,0,194,1,0,128,96,1,0
+,0,104,1,0,0,104,1,0,0,230,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,153,19,3,48,84,30,224,13,0,0,0,194,1,0
+,128,96,1,0,0,104,1,0,0,104,1,0,0,231,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,157,19,3,48,84,30,224,13,0,0
+,0,194,1,0,128,96,1,0,0,104,1,0,0,104,1,0,0,232,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,161,19,3,48,84,30
+,224,13,0,0,0,194,1,0,128,112,1,0,0,120,1,0,0,120,1,0,0,233,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,165,19
+,3,48,84,30,224,13,0,0,0,194,1,0,128,124,1,0,0,132,1,0,0,132,1,0,0,234,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,169,19,3,48,84,30,224,13,0,0,0,194,1,0,128,96,1,0,0,104,1,0,0,104,1,0,0,235,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,173,19,3,48,84,30,224,13,0,0,0,194,1,0,128,100,1,0,0,108,1,0,0,108,1,0
+,0,236,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,177,19,3,48,84,30,224,13,0,0,0,194,1,0,128,104,1,0,0,112,1,0
+,0,112,1,0,0,237,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,181,19,3,48,84,30,224,13,0,0,0,194,1,0,128,112,1,0
+,0,120,1,0,0,120,1,0,0,238,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,185,19,3,48,84,30,224,13,0,0,0,194,1,0
+,128,64,0,0,0,72,0,0,0,72,0,0,0,239,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,189,19,3,48,84,30,224,13,0,0
+,0,194,1,0,128,96,1,0,0,104,1,0,0,104,1,0,0,240,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,193,19,3,48,84,30
+,224,13,0,0,0,66,2,0,128,128,0,0,0,149,0,0,0,149,0,0,0,241,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,197,19
+,3,48,84,30,224,13,0,0,0,194,2,0,128,172,0,0,0,193,0,0,0,193,0,0,0,242,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,201,19,3,48,84,30,224,13,0,0,0,194,1,0,128,64,0,0,0,72,0,0,0,72,0,0,0,243,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,205,19,3,48,84,30,224,13,0,0,0,66,4,0,128,236,5,0,0,18,7,0,0,18,7,0
+,0,244,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,209,19,3,48,84,30,224,13,0,0,0,194,5,0,128,176,3,0,0,226,3,0
+,0,226,3,0,0,245,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,213,19,3,48,84,30,224,13,0,0,0,66,2,0,128,200,1,0
+,0,221,1,0,0,221,1,0,0,246,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,217,19,3,48,84,30,224,13,0,0,0,66,6,0
+,128,252,6,0,0,116,7,0,0,116,7,0,0,247,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,221,19,3,48,84,30,224,13,0,0
+,0,194,3,0,128,92,4,0,0,113,4,0,0,113,4,0,0,248,4,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,225,19,3,48,84,30
+,224,13,0,0,0,194,5,0,128,16,6,0,0,20,7,0,0,20,7,0,0,249,4,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,229,19
+,3,48,84,30,224,13,0,0,0,194,5,0,128,16,6,0,0,20,7,0,0,20,7,0,0,250,4,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,233,19,3,48,84,30,224,13,0,0,0,194,5,0,128,16,6,0,0,20,7,0,0,20,7,0,0,251,4,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,237,19,3,48,84,30,224,13,0,0,0,194,5,0,128,16,6,0,0,20,7,0,0,20,7,0
+,0,252,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,241,19,3,48,84,30,224,13,0,0,0,194,1,0,128,48,0,0,0,56,0,0
+,0,56,0,0,0,253,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,245,19,3,48,84,30,224,13,0,0,0,66,5,0,128,80,3,0
+,0,172,3,0,0,172,3,0,0,254,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,249,19,3,48,84,30,224,13,0,0,0,66,3,0
+,128,156,0,0,0,177,0,0,0,177,0,0,0,255,4,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,253,19,3,48,84,30,224,13,0,0
+,0,194,3,0,128,120,0,0,0,141,0,0,0,141,0,0,0,0,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,1,20,3,48,84,30
+,224,13,0,0,0,66,3,0,128,212,0,0,0,233,0,0,0,233,0,0,0,1,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,5,20
+,3,48,84,30,224,13,0,0,0,66,3,0,128,236,0,0,0,1,1,0,0,1,1,0,0,2,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,9,20,3,48,84,30,224,13,0,0,0,194,3,0,128,120,0,0,0,141,0,0,0,141,0,0,0,3,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,13,20,3,48,84,30,224,13,0,0,0,194,2,0,128,104,1,0,0,138,1,0,0,138,1,0
+,0,4,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,17,20,3,48,84,30,224,13,0,0,0,194,7,0,128,156,5,0,0,48,6,0
+,0,48,6,0,0,5,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,21,20,3,48,84,30,224,13,0,0,0,194,4,0,128,28,3,0
+,0,78,3,0,0,78,3,0,0,6,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,25,20,3,48,84,30,224,13,0,0,0,194,7,0
+,128,40,7,0,0,188,7,0,0,188,7,0,0,7,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,29,20,3,48,84,30,224,13,0,0
+,0,66,3,0,128,172,0,0,0,193,0,0,0,193,0,0,0,8,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,33,20,3,48,84,30
+,224,13,0,0,0,194,4,0,128,88,1,0,0,110,1,0,0,110,1,0,0,9,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,37,20
+,3,48,84,30,224,13,0,0,0,66,3,0,128,68,1,0,0,89,1,0,0,89,1,0,0,10,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,41,20,3,48,84,30,224,13,0,0,0,66,2,0,128,124,0,0,0,145,0,0,0,145,0,0,0,11,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,45,20,3,48,84,30,224,13,0,0,0,66,2,0,128,136,0,0,0,157,0,0,0,157,0,0
+,0,12,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,49,20,3,48,84,30,224,13,0,0,0,66,5,0,128,4,1,0,0,26,1,0
+,0,26,1,0,0,13,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,53,20,3,48,84,30,224,13,0,0,0,66,5,0,128,4,1,0
+,0,26,1,0,0,26,1,0,0,14,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,57,20,3,48,84,30,224,13,0,0,0,66,2,0
+,128,136,0,0,0,157,0,0,0,157,0,0,0,15,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,61,20,3,48,84,30,224,13,0,0
+,0,194,4,0,128,124,1,0,0,146,1,0,0,146,1,0,0,16,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,65,20,3,48,84,30
+,224,13,0,0,0,194,1,0,128,44,0,0,0,52,0,0,0,52,0,0,0,17,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,69,20
+,3,48,84,30,224,13,0,0,0,194,1,0,128,60,0,0,0,68,0,0,0,68,0,0,0,18,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,73,20,3,48,84,30,224,13,0,0,0,194,1,0,128,80,0,0,0,88,0,0,0,88,0,0,0,19,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,77,20,3,48,84,30,224,13,0,0,0,194,1,0,128,80,0,0,0,88,0,0,0,88,0,0
+,0,20,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,81,20,3,48,84,30,224,13,0,0,0,194,1,0,128,80,0,0,0,88,0,0
+,0,88,0,0,0,21,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,85,20,3,48,84,30,224,13,0,0,0,194,1,0,128,80,0,0
+,0,88,0,0,0,88,0,0,0,22,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,89,20,3,48,84,30,224,13,0,0,0,194,1,0
+,128,84,0,0,0,92,0,0,0,92,0,0,0,23,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,93,20,3,48,84,30,224,13,0,0
+,0,194,1,0,128,80,0,0,0,88,0,0,0,88,0,0,0,24,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,97,20,3,48,84,30
+,224,13,0,0,0,194,1,0,128,80,0,0,0,88,0,0,0,88,0,0,0,25,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,101,20
+,3,48,84,30,224,13,0,0,0,194,1,0,128,88,0,0,0,96,0,0,0,96,0,0,0,26,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,105,20,3,48,84,30,224,13,0,0,0,194,1,0,128,156,0,0,0,164,0,0,0,164,0,0,0,27,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,109,20,3,48,84,30,224,13,0,0,0,194,1,0,128,156,0,0,0,164,0,0,0,164,0,0
+,0,28,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,113,20,3,48,84,30,224,13,0,0,0,194,1,0,128,144,0,0,0,152,0,0
+,0,152,0,0,0,29,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,117,20,3,48,84,30,224,13,0,0,0,194,1,0,128,144,0,0
+,0,152,0,0,0,152,0,0,0,30,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,121,20,3,48,84,30,224,13,0,0,0,194,1,0
+,128,68,0,0,0,76,0,0,0,76,0,0,0,31,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,125,20,3,48,84,30,224,13,0,0
+,0,194,1,0,128,68,0,0,0,76,0,0,0,76,0,0,0,32,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,129,20,3,48,84,30
+,224,13,0,0,0,194,1,0,128,68,0,0,0,76,0,0,0,76,0,0,0,33,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,133,20
+,3,48,84,30,224,13,0,0,0,194,1,0,128,68,0,0,0,76,0,0,0,76,0,0,0,34,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,137,20,3,48,84,30,224,13,0,0,0,194,1,0,128,68,0,0,0,76,0,0,0,76,0,0,0,35,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,141,20,3,48,84,30,224,13,0,0,0,194,1,0,128,68,0,0,0,76,0,0,0,76,0,0
+,0,36,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,145,20,3,48,84,30,224,13,0,0,0,194,1,0,128,72,0,0,0,80,0,0
+,0,80,0,0,0,37,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,149,20,3,48,84,30,224,13,0,0,0,194,1,0,128,76,0,0
+,0,84,0,0,0,84,0,0,0,38,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,153,20,3,48,84,30,224,13,0,0,0,194,1,0
+,128,112,0,0,0,120,0,0,0,120,0,0,0,39,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,157,20,3,48,84,30,224,13,0,0
+,0,66,3,0,128,212,1,0,0,233,1,0,0,233,1,0,0,40,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,161,20,3,48,84,30
+,224,13,0,0,0,194,1,0,128,28,1,0,0,36,1,0,0,36,1,0,0,41,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,165,20
+,3,48,84,30,224,13,0,0,0,194,1,0,128,60,0,0,0,68,0,0,0,68,0,0,0,42,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,169,20,3,48,84,30,224,13,0,0,0,66,3,0,128,8,1,0,0,29,1,0,0,29,1,0,0,43,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,173,20,3,48,84,30,224,13,0,0,0,194,1,0,128,48,0,0,0,56,0,0,0,56,0,0
+,0,44,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,177,20,3,48,84,30,224,13,0,0,0,194,2,0,128,164,0,0,0,185,0,0
+,0,185,0,0,0,45,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,181,20,3,48,84,30,224,13,0,0,0,194,1,0,128,124,0,0
+,0,132,0,0,0,132,0,0,0,46,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,185,20,3,48,84,30,224,13,0,0,0,194,3,0
+,128,104,2,0,0,125,2,0,0,125,2,0,0,47,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,189,20,3,48,84,30,224,13,0,0
+,0,194,1,0,128,132,0,0,0,140,0,0,0,140,0,0,0,48,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,193,20,3,48,84,30
+,224,13,0,0,0,66,2,0,128,164,0,0,0,185,0,0,0,185,0,0,0,49,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,197,20
+,3,48,84,30,224,13,0,0,0,194,3,0,128,128,0,0,0,149,0,0,0,149,0,0,0,50,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,201,20,3,48,84,30,224,13,0,0,0,194,1,0,128,56,0,0,0,77,0,0,0,77,0,0,0,51,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,205,20,3,48,84,30,224,13,0,0,0,66,5,0,128,236,0,0,0,30,1,0,0,30,1,0
+,0,52,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,209,20,3,48,84,30,224,13,0,0,0,66,5,0,128,236,0,0,0,30,1,0
+,0,30,1,0,0,53,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,213,20,3,48,84,30,224,13,0,0,0,66,5,0,128,236,0,0
+,0,30,1,0,0,30,1,0,0,54,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,217,20,3,48,84,30,224,13,0,0,0,66,5,0
+,128,236,0,0,0,30,1,0,0,30,1,0,0,55,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,221,20,3,48,84,30,224,13,0,0
+,0,66,5,0,128,236,0,0,0,30,1,0,0,30,1,0,0,56,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,225,20,3,48,84,30
+,224,13,0,0,0,66,5,0,128,236,0,0,0,30,1,0,0,30,1,0,0,57,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,229,20
+,3,48,84,30,224,13,0,0,0,194,1,0,128,28,0,0,0,36,0,0,0,36,0,0,0,58,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,233,20,3,48,84,30,224,13,0,0,0,194,1,0,128,32,0,0,0,40,0,0,0,40,0,0,0,59,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,237,20,3,48,84,30,224,13,0,0,0,66,5,0,128,44,14,0,0,6,15,0,0,6,15,0
+,0,60,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,241,20,3,48,84,30,224,13,0,0,0,66,5,0,128,12,14,0,0,216,14,0
+,0,216,14,0,0,61,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,245,20,3,48,84,30,224,13,0,0,0,194,3,0,128,220,0,0
+,0,241,0,0,0,241,0,0,0,62,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,249,20,3,48,84,30,224,13,0,0,0,194,1,0
+,128,36,0,0,0,44,0,0,0,44,0,0,0,63,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,253,20,3,48,84,30,224,13,0,0
+,0,194,1,0,128,32,0,0,0,40,0,0,0,40,0,0,0,64,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,1,21,3,48,84,30
+,224,13,0,0,0,194,1,0,128,60,0,0,0,68,0,0,0,68,0,0,0,65,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,5,21
+,3,48,84,30,224,13,0,0,0,194,1,0,128,60,0,0,0,68,0,0,0,68,0,0,0,66,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,9,21,3,48,84,30,224,13,0,0,0,194,1,0,128,36,0,0,0,44,0,0,0,44,0,0,0,67,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,13,21,3,48,84,30,224,13,0,0,0,194,1,0,128,36,0,0,0,44,0,0,0,44,0,0
+,0,68,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,17,21,3,48,84,30,224,13,0,0,0,194,1,0,128,136,0,0,0,144,0,0
+,0,144,0,0,0,69,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,21,21,3,48,84,30,224,13,0,0,0,194,1,0,128,108,0,0
+,0,116,0,0,0,116,0,0,0,70,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,25,21,3,48,84,30,224,13,0,0,0,66,3,0
+,128,124,0,0,0,145,0,0,0,145,0,0,0,71,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,29,21,3,48,84,30,224,13,0,0
+,0,66,3,0,128,216,0,0,0,237,0,0,0,237,0,0,0,72,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,33,21,3,48,84,30
+,224,13,0,0,0,194,5,0,128,220,14,0,0,196,15,0,0,196,15,0,0,73,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,37,21
+,3,48,84,30,224,13,0,0,0,66,3,0,128,124,0,0,0,145,0,0,0,145,0,0,0,74,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,41,21,3,48,84,30,224,13,0,0,0,66,3,0,128,216,0,0,0,237,0,0,0,237,0,0,0,75,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,45,21,3,48,84,30,224,13,0,0,0,194,5,0,128,132,14,0,0,94,15,0,0,94,15,0
+,0,76,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,49,21,3,48,84,30,224,13,0,0,0,66,3,0,128,224,0,0,0,245,0,0
+,0,245,0,0,0,77,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,53,21,3,48,84,30,224,13,0,0,0,194,1,0,128,32,0,0
+,0,40,0,0,0,40,0,0,0,78,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,57,21,3,48,84,30,224,13,0,0,0,194,1,0
+,128,28,0,0,0,36,0,0,0,36,0,0,0,79,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,61,21,3,48,84,30,224,13,0,0
+,0,194,1,0,128,40,0,0,0,48,0,0,0,48,0,0,0,80,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,65,21,3,48,84,30
+,224,13,0,0,0,194,4,0,128,208,15,0,0,230,15,0,0,230,15,0,0,81,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,69,21
+,3,48,84,30,224,13,0,0,0,66,3,0,128,124,0,0,0,145,0,0,0,145,0,0,0,82,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,73,21,3,48,84,30,224,13,0,0,0,66,3,0,128,156,0,0,0,177,0,0,0,177,0,0,0,83,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,77,21,3,48,84,30,224,13,0,0,0,194,1,0,128,132,0,0,0,140,0,0,0,140,0,0
+,0,84,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,81,21,3,48,84,30,224,13,0,0,0,194,3,0,128,36,1,0,0,57,1,0
+,0,57,1,0,0,85,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,85,21,3,48,84,30,224,13,0,0,0,66,3,0,128,172,0,0
+,0,193,0,0,0,193,0,0,0,86,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,89,21,3,48,84,30,224,13,0,0,0,66,3,0
+,128,136,0,0,0,157,0,0,0,157,0,0,0,87,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,93,21,3,48,84,30,224,13,0,0
+,0,66,3,0,128,172,0,0,0,193,0,0,0,193,0,0,0,88,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,97,21,3,48,84,30
+,224,13,0,0,0,66,3,0,128,168,0,0,0,189,0,0,0,189,0,0,0,89,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,101,21
+,3,48,84,30,224,13,0,0,0,66,3,0,128,168,0,0,0,189,0,0,0,189,0,0,0,90,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,105,21,3,48,84,30,224,13,0,0,0,194,3,0,128,196,0,0,0,217,0,0,0,217,0,0,0,91,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,109,21,3,48,84,30,224,13,0,0,0,194,3,0,128,164,0,0,0,185,0,0,0,185,0,0
+,0,92,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,113,21,3,48,84,30,224,13,0,0,0,194,5,0,128,52,4,0,0,130,4,0
+,0,130,4,0,0,93,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,117,21,3,48,84,30,224,13,0,0,0,66,5,0,128,220,3,0
+,0,242,3,0,0,242,3,0,0,94,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,121,21,3,48,84,30,224,13,0,0,0,66,5,0
+,128,28,4,0,0,50,4,0,0,50,4,0,0,95,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,125,21,3,48,84,30,224,13,0,0
+,0,66,5,0,128,24,4,0,0,46,4,0,0,46,4,0,0,96,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,129,21,3,48,84,30
+,224,13,0,0,0,66,5,0,128,192,3,0,0,214,3,0,0,214,3,0,0,97,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,133,21
+,3,48,84,30,224,13,0,0,0,66,3,0,128,184,0,0,0,205,0,0,0,205,0,0,0,98,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,137,21,3,48,84,30,224,13,0,0,0,194,7,0,128,20,4,0,0,84,4,0,0,84,4,0,0,99,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,141,21,3,48,84,30,224,13,0,0,0,194,7,0,128,40,4,0,0,104,4,0,0,104,4,0
+,0,100,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,145,21,3,48,84,30,224,13,0,0,0,194,7,0,128,40,4,0,0,104,4,0
+,0,104,4,0,0,101,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,149,21,3,48,84,30,224,13,0,0,0,194,7,0,128,80,4,0
+,0,144,4,0,0,144,4,0,0,102,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,153,21,3,48,84,30,224,13,0,0,0,194,7,0
+,128,80,4,0,0,144,4,0,0,144,4,0,0,103,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,157,21,3,48,84,30,224,13,0,0
+,0,194,7,0,128,248,4,0,0,70,5,0,0,70,5,0,0,104,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,161,21,3,48,84,30
+,224,13,0,0,0,194,6,0,128,116,3,0,0,194,3,0,0,194,3,0,0,105,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,165,21
+,3,48,84,30,224,13,0,0,0,66,5,0,128,36,3,0,0,100,3,0,0,100,3,0,0,106,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,169,21,3,48,84,30,224,13,0,0,0,66,5,0,128,92,3,0,0,114,3,0,0,114,3,0,0,107,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,173,21,3,48,84,30,224,13,0,0,0,66,5,0,128,124,3,0,0,146,3,0,0,146,3,0
+,0,108,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,177,21,3,48,84,30,224,13,0,0,0,66,5,0,128,248,2,0,0,14,3,0
+,0,14,3,0,0,109,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,181,21,3,48,84,30,224,13,0,0,0,66,3,0,128,188,0,0
+,0,209,0,0,0,209,0,0,0,110,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,185,21,3,48,84,30,224,13,0,0,0,194,5,0
+,128,244,1,0,0,24,2,0,0,24,2,0,0,111,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,189,21,3,48,84,30,224,13,0,0
+,0,194,5,0,128,244,1,0,0,24,2,0,0,24,2,0,0,112,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,193,21,3,48,84,30
+,224,13,0,0,0,194,5,0,128,244,1,0,0,24,2,0,0,24,2,0,0,113,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,197,21
+,3,48,84,30,224,13,0,0,0,194,5,0,128,8,2,0,0,44,2,0,0,44,2,0,0,114,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,201,21,3,48,84,30,224,13,0,0,0,194,5,0,128,8,2,0,0,44,2,0,0,44,2,0,0,115,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,205,21,3,48,84,30,224,13,0,0,0,66,6,0,128,164,2,0,0,214,2,0,0,214,2,0
+,0,116,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,209,21,3,48,84,30,224,13,0,0,0,66,4,0,128,60,2,0,0,81,2,0
+,0,81,2,0,0,117,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,213,21,3,48,84,30,224,13,0,0,0,66,4,0,128,56,2,0
+,0,77,2,0,0,77,2,0,0,118,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,217,21,3,48,84,30,224,13,0,0,0,66,4,0
+,128,96,2,0,0,117,2,0,0,117,2,0,0,119,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,221,21,3,48,84,30,224,13,0,0
+,0,194,5,0,128,0,2,0,0,36,2,0,0,36,2,0,0,120,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,225,21,3,48,84,30
+,224,13,0,0,0,66,3,0,128,124,0,0,0,145,0,0,0,145,0,0,0,121,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,229,21
+,3,48,84,30,224,13,0,0,0,66,3,0,128,116,0,0,0,137,0,0,0,137,0,0,0,122,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,233,21,3,48,84,30,224,13,0,0,0,194,1,0,128,104,0,0,0,125,0,0,0,125,0,0,0,123,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,237,21,3,48,84,30,224,13,0,0,0,194,1,0,128,92,1,0,0,100,1,0,0,100,1,0
+,0,124,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,241,21,3,48,84,30,224,13,0,0,0,194,1,0,128,92,1,0,0,100,1,0
+,0,100,1,0,0,125,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,245,21,3,48,84,30,224,13,0,0,0,194,1,0,128,92,1,0
+,0,100,1,0,0,100,1,0,0,126,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,249,21,3,48,84,30,224,13,0,0,0,194,1,0
+,128,108,1,0,0,116,1,0,0,116,1,0,0,127,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,253,21,3,48,84,30,224,13,0,0
+,0,194,1,0,128,120,1,0,0,128,1,0,0,128,1,0,0,128,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,1,22,3,48,84,30
+,224,13,0,0,0,194,1,0,128,92,1,0,0,100,1,0,0,100,1,0,0,129,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,5,22
+,3,48,84,30,224,13,0,0,0,194,1,0,128,100,1,0,0,108,1,0,0,108,1,0,0,130,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,9,22,3,48,84,30,224,13,0,0,0,194,1,0,128,100,1,0,0,108,1,0,0,108,1,0,0,131,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,13,22,3,48,84,30,224,13,0,0,0,194,1,0,128,108,1,0,0,116,1,0,0,116,1,0
+,0,132,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,17,22,3,48,84,30,224,13,0,0,0,194,1,0,128,60,0,0,0,68,0,0
+,0,68,0,0,0,133,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,21,22,3,48,84,30,224,13,0,0,0,194,1,0,128,92,1,0
+,0,100,1,0,0,100,1,0,0,134,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,25,22,3,48,84,30,224,13,0,0,0,66,2,0
+,128,128,0,0,0,149,0,0,0,149,0,0,0,135,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,29,22,3,48,84,30,224,13,0,0
+,0,194,2,0,128,168,0,0,0,189,0,0,0,189,0,0,0,136,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,33,22,3,48,84,30
+,224,13,0,0,0,194,1,0,128,60,0,0,0,68,0,0,0,68,0,0,0,137,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,37,22
+,3,48,84,30,224,13,0,0,0,66,4,0,128,232,5,0,0,14,7,0,0,14,7,0,0,138,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,41,22,3,48,84,30,224,13,0,0,0,194,5,0,128,172,3,0,0,222,3,0,0,222,3,0,0,139,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,45,22,3,48,84,30,224,13,0,0,0,66,2,0,128,196,1,0,0,217,1,0,0,217,1,0
+,0,140,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,49,22,3,48,84,30,224,13,0,0,0,66,6,0,128,248,6,0,0,112,7,0
+,0,112,7,0,0,141,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,53,22,3,48,84,30,224,13,0,0,0,194,3,0,128,88,4,0
+,0,109,4,0,0,109,4,0,0,142,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,57,22,3,48,84,30,224,13,0,0,0,194,5,0
+,128,16,6,0,0,20,7,0,0,20,7,0,0,143,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,61,22,3,48,84,30,224,13,0,0
+,0,194,5,0,128,16,6,0,0,20,7,0,0,20,7,0,0,144,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,65,22,3,48,84,30
+,224,13,0,0,0,194,5,0,128,16,6,0,0,20,7,0,0,20,7,0,0,145,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,69,22
+,3,48,84,30,224,13,0,0,0,194,5,0,128,16,6,0,0,20,7,0,0,20,7,0,0,146,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,73,22,3,48,84,30,224,13,0,0,0,194,1,0,128,48,0,0,0,56,0,0,0,56,0,0,0,147,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,77,22,3,48,84,30,224,13,0,0,0,66,5,0,128,80,3,0,0,172,3,0,0,172,3,0
+,0,148,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,81,22,3,48,84,30,224,13,0,0,0,66,3,0,128,156,0,0,0,177,0,0
+,0,177,0,0,0,149,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,85,22,3,48,84,30,224,13,0,0,0,194,3,0,128,116,0,0
+,0,137,0,0,0,137,0,0,0,150,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,89,22,3,48,84,30,224,13,0,0,0,66,3,0
+,128,212,0,0,0,233,0,0,0,233,0,0,0,151,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,93,22,3,48,84,30,224,13,0,0
+,0,66,3,0,128,236,0,0,0,1,1,0,0,1,1,0,0,152,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,97,22,3,48,84,30
+,224,13,0,0,0,194,3,0,128,116,0,0,0,137,0,0,0,137,0,0,0,153,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,101,22
+,3,48,84,30,224,13,0,0,0,194,2,0,128,100,1,0,0,134,1,0,0,134,1,0,0,154,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,105,22,3,48,84,30,224,13,0,0,0,194,7,0,128,156,5,0,0,48,6,0,0,48,6,0,0,155,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,109,22,3,48,84,30,224,13,0,0,0,194,4,0,128,24,3,0,0,74,3,0,0,74,3,0
+,0,156,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,113,22,3,48,84,30,224,13,0,0,0,194,7,0,128,36,7,0,0,184,7,0
+,0,184,7,0,0,157,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,117,22,3,48,84,30,224,13,0,0,0,66,3,0,128,168,0,0
+,0,189,0,0,0,189,0,0,0,158,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,121,22,3,48,84,30,224,13,0,0,0,194,4,0
+,128,84,1,0,0,106,1,0,0,106,1,0,0,159,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,125,22,3,48,84,30,224,13,0,0
+,0,66,3,0,128,68,1,0,0,89,1,0,0,89,1,0,0,160,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,129,22,3,48,84,30
+,224,13,0,0,0,66,2,0,128,124,0,0,0,145,0,0,0,145,0,0,0,161,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,133,22
+,3,48,84,30,224,13,0,0,0,66,2,0,128,132,0,0,0,153,0,0,0,153,0,0,0,162,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,137,22,3,48,84,30,224,13,0,0,0,66,5,0,128,0,1,0,0,22,1,0,0,22,1,0,0,163,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,141,22,3,48,84,30,224,13,0,0,0,66,5,0,128,0,1,0,0,22,1,0,0,22,1,0
+,0,164,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,145,22,3,48,84,30,224,13,0,0,0,66,2,0,128,132,0,0,0,153,0,0
+,0,153,0,0,0,165,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,149,22,3,48,84,30,224,13,0,0,0,194,4,0,128,112,1,0
+,0,134,1,0,0,134,1,0,0,166,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,153,22,3,48,84,30,224,13,0,0,0,194,1,0
+,128,44,0,0,0,52,0,0,0,52,0,0,0,167,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,157,22,3,48,84,30,224,13,0,0
+,0,194,1,0,128,56,0,0,0,64,0,0,0,64,0,0,0,168,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,161,22,3,48,84,30
+,224,13,0,0,0,194,1,0,128,80,0,0,0,88,0,0,0,88,0,0,0,169,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,165,22
+,3,48,84,30,224,13,0,0,0,194,1,0,128,80,0,0,0,88,0,0,0,88,0,0,0,170,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,169,22,3,48,84,30,224,13,0,0,0,194,1,0,128,80,0,0,0,88,0,0,0,88,0,0,0,171,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,173,22,3,48,84,30,224,13,0,0,0,194,1,0,128,80,0,0,0,88,0,0,0,88,0,0
+,0,172,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,177,22,3,48,84,30,224,13,0,0,0,194,1,0,128,84,0,0,0,92,0,0
+,0,92,0,0,0,173,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,181,22,3,48,84,30,224,13,0,0,0,194,1,0,128,80,0,0
+,0,88,0,0,0,88,0,0,0,174,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,185,22,3,48,84,30,224,13,0,0,0,194,1,0
+,128,80,0,0,0,88,0,0,0,88,0,0,0,175,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,189,22,3,48,84,30,224,13,0,0
+,0,194,1,0,128,88,0,0,0,96,0,0,0,96,0,0,0,176,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,193,22,3,48,84,30
+,224,13,0,0,0,194,1,0,128,156,0,0,0,164,0,0,0,164,0,0,0,177,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,197,22
+,3,48,84,30,224,13,0,0,0,194,1,0,128,156,0,0,0,164,0,0,0,164,0,0,0,178,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,201,22,3,48,84,30,224,13,0,0,0,194,1,0,128,140,0,0,0,148,0,0,0,148,0,0,0,179,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,205,22,3,48,84,30,224,13,0,0,0,194,1,0,128,140,0,0,0,148,0,0,0,148,0,0
+,0,180,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,209,22,3,48,84,30,224,13,0,0,0,194,1,0,128,64,0,0,0,72,0,0
+,0,72,0,0,0,181,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,213,22,3,48,84,30,224,13,0,0,0,194,1,0,128,64,0,0
+,0,72,0,0,0,72,0,0,0,182,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,217,22,3,48,84,30,224,13,0,0,0,194,1,0
+,128,64,0,0,0,72,0,0,0,72,0,0,0,183,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,221,22,3,48,84,30,224,13,0,0
+,0,194,1,0,128,64,0,0,0,72,0,0,0,72,0,0,0,184,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,225,22,3,48,84,30
+,224,13,0,0,0,194,1,0,128,64,0,0,0,72,0,0,0,72,0,0,0,185,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,229,22
+,3,48,84,30,224,13,0,0,0,194,1,0,128,64,0,0,0,72,0,0,0,72,0,0,0,186,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,233,22,3,48,84,30,224,13,0,0,0,194,1,0,128,72,0,0,0,80,0,0,0,80,0,0,0,187,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,237,22,3,48,84,30,224,13,0,0,0,194,1,0,128,76,0,0,0,84,0,0,0,84,0,0
+,0,188,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,241,22,3,48,84,30,224,13,0,0,0,194,1,0,128,108,0,0,0,116,0,0
+,0,116,0,0,0,189,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,245,22,3,48,84,30,224,13,0,0,0,66,3,0,128,212,1,0
+,0,233,1,0,0,233,1,0,0,190,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,249,22,3,48,84,30,224,13,0,0,0,194,1,0
+,128,24,1,0,0,32,1,0,0,32,1,0,0,191,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,253,22,3,48,84,30,224,13,0,0
+,0,194,1,0,128,56,0,0,0,64,0,0,0,64,0,0,0,192,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,1,23,3,48,84,30
+,224,13,0,0,0,66,3,0,128,4,1,0,0,25,1,0,0,25,1,0,0,193,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,5,23
+,3,48,84,30,224,13,0,0,0,194,1,0,128,44,0,0,0,52,0,0,0,52,0,0,0,194,5,0,0,73,186,0
+,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150
+,146,37,9,23,3,48,84,30,224,13,0,0,0,194,2,0,128,160,0,0,0,181,0,0,0,181,0,0,0,195,5,0
+,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,145,93,150,146,37,13,23,3,48,84,30,224,13,0,0,0,194,1,0,128,120,0,0,0,128,0,0,0,128,0,0
+,0,196,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,145,93,150,146,37,17,23,3,48,84,30,224,13,0,0,0,194,3,0,128,104,2,0,0,125,2,0
+,0,125,2,0,0,197,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,145,93,150,146,37,21,23,3,48,84,30,224,13,0,0,0,194,1,0,128,128,0,0
+,0,136,0,0,0,136,0,0,0,198,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,25,23,3,48,84,30,224,13,0,0,0,66,2,0
+,128,160,0,0,0,181,0,0,0,181,0,0,0,199,5,0,0,73,186,0,0,0,0,0,0,0,0,65,255,226,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,29,23,3,48,84,30,224,13,0,0
+,0,194,3,0,128,128,0,0,0,149,0,0,0,149,0,0,0,200,5,0,0,73,186,0,0,0,0,0,0,0,0,65
+,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,33,23,3,48,84,30
+,224,13,0,0,0,194,1,0,128,56,0,0,0,77,0,0,0,77,0,0,0,201,5,0,0,73,186,0,0,0,0,0
+,0,0,0,65,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,93,150,146,37,37,23
+,26,26,26,26,96,0,0,0,0,0,0,0,0,96,0,0,0,0,0,0,0,0,96,0,0,0,0,0,0,0,0,26
+,2,28,83,96,0,0,0,0,163,0,0,0,73,17,237,1,68,97,0,0,255,255,0,0,0,0,64,0,2,2,255,255
+,255,255,11,0,130,35,1,2,12,81,97,246,2,75,215,4,0,0,0,99,97,108,108,0,0,0,0,2,28,83,96,0
+,0,0,0,83,1,0,0,17,81,3,148,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130
+,43,2,2,28,83,96,0,0,0,0,84,1,0,0,17,69,2,148,68,97,2,0,255,255,0,0,0,0,96,0,2,2
+,255,255,255,255,11,0,2,45,2,2,28,83,96,0,0,0,0,86,1,0,0,17,133,2,148,68,97,1,0,255,255,0
+,0,0,0,96,0,2,2,255,255,255,255,11,0,2,48,2,2,28,83,96,0,0,0,0,87,1,0,0,10,0,33,232
+,17,237,1,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,49,2,2,28,83,96,0,0
+,0,0,89,1,0,0,17,29,5,149,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,52
+,2,2,28,83,96,0,0,0,0,88,1,0,0,2,20,81,99,230,71,75,183,20,0,0,0,91,83,121,109,98,111,108
+,46,104,97,115,73,110,115,116,97,110,99,101,93,0,0,0,0,149,68,97,1,0,1,0,0,0,0,0,96,0,2,2
+,255,255,255,255,11,0,2,51,2,10,0,161,227,11,0,130,32,1,2,12,81,97,214,250,179,51,6,0,0,0,97,115
+,115,105,103,110,0,0,2,24,81,100,222,43,150,19,25,0,0,0,103,101,116,79,119,110,80,114,111,112,101,114,116,121
+,68,101,115,99,114,105,112,116,111,114,115,0,0,0,0,0,0,0,2,20,81,99,254,103,248,89,19,0,0,0,103,101
+,116,79,119,110,80,114,111,112,101,114,116,121,78,97,109,101,115,0,0,0,0,0,2,20,81,99,254,233,33,3,21,0
+,0,0,103,101,116,79,119,110,80,114,111,112,101,114,116,121,83,121,109,98,111,108,115,0,0,0,2,12,81,97,142,201
+,26,100,2,0,0,0,105,115,0,0,0,0,0,0,2,12,81,97,78,175,38,24,4,0,0,0,115,101,97,108,0,0
+,0,0,2,12,81,97,22,227,30,20,6,0,0,0,99,114,101,97,116,101,0,0,2,16,81,98,158,138,54,93,16,0
+,0,0,100,101,102,105,110,101,80,114,111,112,101,114,116,105,101,115,2,12,81,97,62,230,91,252,6,0,0,0,102,114
+,101,101,122,101,0,0,2,12,81,97,62,90,248,194,8,0,0,0,105,115,70,114,111,122,101,110,2,12,81,97,54,243
+,251,27,8,0,0,0,105,115,83,101,97,108,101,100,2,12,81,97,78,115,242,194,7,0,0,0,101,110,116,114,105,101
+,115,0,2,16,81,98,70,204,179,163,11,0,0,0,102,114,111,109,69,110,116,114,105,101,115,0,0,0,0,0,2,12
+,81,97,246,170,63,125,6,0,0,0,118,97,108,117,101,115,0,0,2,28,83,96,0,0,0,0,202,1,0,0,10,0
+,97,238,149,68,97,2,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,222,2,2,28,83,96,0,0
+,0,0,211,1,0,0,17,109,3,17,237,1,68,97,2,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0
+,130,235,2,2,28,83,96,0,0,0,0,212,1,0,0,10,0,193,238,151,68,97,1,0,255,255,0,0,0,0,96,0
+,2,2,255,255,255,255,11,0,2,237,2,2,28,83,96,0,0,0,0,213,1,0,0,10,0,129,239,151,68,97,1,0
+,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,238,2,2,28,83,96,0,0,0,0,214,1,0,0,10
+,0,33,240,151,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,240,2,2,28,83,96,0
+,0,0,0,215,1,0,0,10,0,193,240,17,237,1,68,97,2,0,2,0,0,0,0,0,96,0,2,2,255,255,255,255
+,11,0,130,241,2,2,28,83,96,0,0,0,0,73,3,0,0,17,93,4,144,68,97,1,0,1,0,0,0,0,0,96
+,0,2,2,255,255,255,255,11,0,130,28,5,2,28,83,96,0,0,0,0,229,1,0,0,10,0,33,241,144,68,97,1
+,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,6,3,2,28,83,96,0,0,0,0,203,1,0,0
+,10,0,129,241,144,68,97,2,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,223,2,2,28,83,96
+,0,0,0,0,206,1,0,0,10,0,225,241,17,237,1,68,97,2,0,2,0,0,0,0,0,96,0,2,2,255,255,255
+,255,11,0,2,228,2,2,28,83,96,0,0,0,0,207,1,0,0,17,225,2,145,68,97,3,0,3,0,0,0,0,0
+,96,0,2,2,255,255,255,255,11,0,130,229,2,2,28,83,96,0,0,0,0,210,1,0,0,10,0,97,242,145,68,97
+,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,234,2,2,28,83,96,0,0,0,0,74,3,0
+,0,17,113,3,145,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,30,5,2,28,83,96
+,0,0,0,0,75,3,0,0,17,201,4,17,237,1,68,97,2,0,2,0,0,0,0,0,96,0,2,2,255,255,255,255
+,11,0,130,31,5,2,28,83,96,0,0,0,0,72,3,0,0,17,177,3,146,68,97,1,0,1,0,0,0,0,0,96
+,0,2,2,255,255,255,255,11,0,2,27,5,2,28,83,96,0,0,0,0,216,1,0,0,10,0,193,242,146,68,97,1
+,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,243,2,2,28,83,96,0,0,0,0,217,1,0,0
+,10,0,33,243,146,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,244,2,2,28,83,96
+,0,0,0,0,218,1,0,0,17,189,3,17,237,1,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255
+,11,0,2,246,2,2,28,83,96,0,0,0,0,209,1,0,0,10,0,129,243,147,68,97,1,0,1,0,0,0,0,0
+,96,0,2,2,255,255,255,255,11,0,130,232,2,2,28,83,96,0,0,0,0,71,3,0,0,10,0,225,243,147,68,97
+,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,25,5,2,28,83,96,0,0,0,0,231,1,0
+,0,10,0,97,244,147,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,9,3,2,28,83
+,96,0,0,0,0,201,1,0,0,17,57,4,17,237,1,68,97,1,0,255,255,4,0,0,0,96,0,2,2,255,255,255
+,255,11,0,130,220,2,2,16,81,98,142,144,237,140,16,0,0,0,95,95,100,101,102,105,110,101,71,101,116,116,101,114
+,95,95,2,16,81,98,254,63,175,251,16,0,0,0,95,95,100,101,102,105,110,101,83,101,116,116,101,114,95,95,2,16
+,81,98,54,118,90,128,14,0,0,0,104,97,115,79,119,110,80,114,111,112,101,114,116,121,0,0,2,16,81,98,86,160
+,205,205,16,0,0,0,95,95,108,111,111,107,117,112,71,101,116,116,101,114,95,95,2,16,81,98,158,74,99,123,16,0
+,0,0,95,95,108,111,111,107,117,112,83,101,116,116,101,114,95,95,2,16,81,98,222,114,130,146,13,0,0,0,105,115
+,80,114,111,116,111,116,121,112,101,79,102,0,0,0,2,20,81,99,70,62,246,12,20,0,0,0,112,114,111,112,101,114
+,116,121,73,115,69,110,117,109,101,114,97,98,108,101,0,0,0,0,2,28,83,96,0,0,0,0,226,1,0,0,2,16
+,80,98,7,0,0,0,13,0,0,0,103,101,116,32,95,95,112,114,111,116,111,95,95,0,0,0,148,68,97,0,0,0
+,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,2,3,2,28,83,96,0,0,0,0,227,1,0,0,2,16
+,80,98,7,0,0,0,13,0,0,0,115,101,116,32,95,95,112,114,111,116,111,95,95,0,0,0,148,68,97,1,0,1
+,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,3,3,2,28,83,96,0,0,0,0,219,1,0,0,10,0
+,130,9,1,148,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,247,2,2,28,83,96,0
+,0,0,0,220,1,0,0,10,0,2,10,1,148,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11
+,0,2,249,2,2,28,83,96,0,0,0,0,224,1,0,0,10,0,130,10,1,17,237,1,68,97,1,0,1,0,0,0
+,0,0,96,0,2,2,255,255,255,255,11,0,2,255,2,2,28,83,96,0,0,0,0,225,1,0,0,10,0,2,11,1
+,149,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,0,3,2,28,83,96,0,0,0,0
+,221,1,0,0,17,29,5,149,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,250,2,2
+,28,83,96,0,0,0,0,222,1,0,0,17,81,5,149,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255
+,255,11,0,2,252,2,2,28,83,96,0,0,0,0,228,1,0,0,19,125,1,149,68,97,0,0,0,0,0,0,0,0
+,96,0,2,2,255,255,255,255,11,0,2,5,3,2,28,83,96,0,0,0,0,205,1,0,0,10,0,2,8,1,17,237
+,1,68,97,2,0,2,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,226,2,2,28,83,96,0,0,0,0
+,208,1,0,0,10,0,130,8,1,151,68,97,2,0,2,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,231
+,2,2,28,83,96,0,0,0,0,223,1,0,0,10,0,2,9,1,151,68,97,1,0,1,0,0,0,0,0,96,0,2
+,2,255,255,255,255,11,0,130,253,2,2,28,83,96,0,0,0,0,162,0,0,0,73,151,68,97,0,0,0,0,0,0
+,0,0,64,0,2,2,255,255,255,255,11,0,2,34,1,2,20,81,99,22,192,106,204,18,0,0,0,100,101,99,111,100
+,101,85,82,73,67,111,109,112,111,110,101,110,116,0,0,0,0,0,0,2,28,83,96,0,0,0,0,99,1,0,0,10
+,0,2,24,1,151,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,67,2,2,12,81,97
+,54,248,232,145,7,0,0,0,99,111,110,115,111,108,101,0,2,28,83,96,0,0,0,0,162,0,0,0,10,0,130,25
+,1,17,237,1,68,97,0,0,0,0,0,0,0,0,64,0,2,2,255,255,255,255,2,12,81,97,22,17,187,156,5,0
+,0,0,100,101,98,117,103,0,0,0,2,12,81,97,6,182,160,82,5,0,0,0,101,114,114,111,114,0,0,0,2,12
+,81,97,62,123,191,102,4,0,0,0,105,110,102,111,0,0,0,0,2,12,81,97,254,171,28,52,3,0,0,0,108,111
+,103,0,0,0,0,0,2,12,81,97,94,123,49,74,4,0,0,0,119,97,114,110,0,0,0,0,2,12,81,97,190,136
+,229,191,3,0,0,0,100,105,114,0,0,0,0,0,2,12,81,97,78,11,92,210,6,0,0,0,100,105,114,120,109,108
+,0,0,2,12,81,97,102,236,227,120,5,0,0,0,116,97,98,108,101,0,0,0,2,12,81,97,142,241,36,60,5,0
+,0,0,116,114,97,99,101,0,0,0,2,12,81,97,134,185,102,4,5,0,0,0,103,114,111,117,112,0,0,0,2,16
+,81,98,118,4,121,205,14,0,0,0,103,114,111,117,112,67,111,108,108,97,112,115,101,100,0,0,2,12,81,97,110,42
+,38,0,8,0,0,0,103,114,111,117,112,69,110,100,2,12,81,97,86,51,71,210,5,0,0,0,99,108,101,97,114,0
+,0,0,2,12,81,97,190,128,141,170,5,0,0,0,99,111,117,110,116,0,0,0,2,16,81,98,238,20,158,17,10,0
+,0,0,99,111,117,110,116,82,101,115,101,116,0,0,0,0,0,0,2,12,81,97,142,130,250,108,6,0,0,0,97,115
+,115,101,114,116,0,0,2,12,81,97,142,12,210,29,7,0,0,0,112,114,111,102,105,108,101,0,2,16,81,98,38,45
+,210,75,10,0,0,0,112,114,111,102,105,108,101,69,110,100,0,0,0,0,0,0,2,12,81,97,246,46,14,145,4,0
+,0,0,116,105,109,101,0,0,0,0,2,12,81,97,102,153,208,63,7,0,0,0,116,105,109,101,76,111,103,0,2,12
+,81,97,78,79,181,36,7,0,0,0,116,105,109,101,69,110,100,0,2,16,81,98,54,22,161,212,9,0,0,0,116,105
+,109,101,83,116,97,109,112,0,0,0,0,0,0,0,2,12,81,97,142,12,85,207,7,0,0,0,99,111,110,116,101,120
+,116,0,2,28,83,96,0,0,0,0,1,1,0,0,10,0,194,26,1,145,68,97,0,0,255,255,0,0,0,0,96,0
+,2,2,255,255,255,255,11,0,130,176,1,2,28,83,96,0,0,0,0,2,1,0,0,10,0,34,27,1,145,68,97,0
+,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,178,1,2,28,83,96,0,0,0,0,3,1,0,0
+,10,0,130,27,1,145,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,179,1,2,28,83
+,96,0,0,0,0,4,1,0,0,10,0,226,27,1,145,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255
+,255,11,0,2,181,1,2,28,83,96,0,0,0,0,5,1,0,0,10,0,66,28,1,17,237,1,68,97,0,0,255,255
+,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,182,1,2,28,83,96,0,0,0,0,6,1,0,0,10,0,162
+,28,1,147,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,184,1,2,28,83,96,0,0
+,0,0,7,1,0,0,10,0,2,29,1,147,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0
+,130,185,1,2,28,83,96,0,0,0,0,8,1,0,0,10,0,98,29,1,147,68,97,1,0,255,255,0,0,0,0,96
+,0,2,2,255,255,255,255,11,0,2,187,1,2,28,83,96,0,0,0,0,9,1,0,0,10,0,194,29,1,17,237,1
+,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,188,1,2,28,83,96,0,0,0,0,10
+,1,0,0,10,0,34,30,1,148,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,190,1
+,2,28,83,96,0,0,0,0,11,1,0,0,10,0,130,30,1,148,68,97,0,0,255,255,0,0,0,0,96,0,2,2
+,255,255,255,255,11,0,130,191,1,2,28,83,96,0,0,0,0,12,1,0,0,10,0,2,31,1,148,68,97,0,0,255
+,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,193,1,2,28,83,96,0,0,0,0,13,1,0,0,10,0
+,98,31,1,17,237,1,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,194,1,2,28,83
+,96,0,0,0,0,14,1,0,0,10,0,194,31,1,149,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255
+,255,11,0,2,196,1,2,28,83,96,0,0,0,0,15,1,0,0,10,0,34,32,1,149,68,97,0,0,255,255,0,0
+,0,0,96,0,2,2,255,255,255,255,11,0,130,197,1,2,28,83,96,0,0,0,0,17,1,0,0,10,0,162,32,1
+,149,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,200,1,2,28,83,96,0,0,0,0
+,18,1,0,0,10,0,2,33,1,17,237,1,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0
+,2,202,1,2,28,83,96,0,0,0,0,19,1,0,0,10,0,98,33,1,150,68,97,0,0,255,255,0,0,0,0,96
+,0,2,2,255,255,255,255,11,0,130,203,1,2,28,83,96,0,0,0,0,20,1,0,0,10,0,226,33,1,150,68,97
+,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,205,1,2,28,83,96,0,0,0,0,21,1,0
+,0,10,0,66,34,1,150,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,206,1,2,28
+,83,96,0,0,0,0,22,1,0,0,10,0,162,34,1,17,237,1,68,97,0,0,255,255,0,0,0,0,96,0,2,2
+,255,255,255,255,11,0,2,208,1,2,28,83,96,0,0,0,0,23,1,0,0,10,0,2,35,1,151,68,97,0,0,255
+,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,209,1,2,28,83,96,0,0,0,0,24,1,0,0,10,0
+,130,35,1,151,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,211,1,2,28,83,96,0
+,0,0,0,165,0,0,0,2,20,80,99,7,0,0,0,20,0,0,0,103,101,116,32,91,83,121,109,98,111,108,46,115
+,112,101,99,105,101,115,93,0,0,0,0,151,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0
+,130,38,1,2,28,83,96,0,0,0,0,30,2,0,0,2,16,80,98,7,0,0,0,9,0,0,0,103,101,116,32,105
+,110,112,117,116,0,0,0,0,0,0,0,151,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0
+,2,92,3,2,28,83,96,0,0,0,0,31,2,0,0,2,16,80,98,7,0,0,0,9,0,0,0,115,101,116,32,105
+,110,112,117,116,0,0,0,0,0,0,0,151,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0
+,130,93,3,2,12,81,97,158,26,236,85,2,0,0,0,36,95,0,0,0,0,0,0,2,28,83,96,0,0,0,0,30
+,2,0,0,2,12,80,97,7,0,0,0,6,0,0,0,103,101,116,32,36,95,0,0,17,237,1,68,97,0,0,0,0
+,0,0,0,0,96,0,2,2,255,255,255,255,2,28,83,96,0,0,0,0,31,2,0,0,2,12,80,97,7,0,0,0
+,6,0,0,0,115,101,116,32,36,95,0,0,144,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,2
+,16,81,98,206,17,138,76,9,0,0,0,108,97,115,116,77,97,116,99,104,0,0,0,0,0,0,0,2,28,83,96,0
+,0,0,0,32,2,0,0,2,16,80,98,7,0,0,0,13,0,0,0,103,101,116,32,108,97,115,116,77,97,116,99,104
+,0,0,0,144,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,95,3,2,28,83,96,0
+,0,0,0,161,0,0,0,2,16,80,98,7,0,0,0,13,0,0,0,115,101,116,32,108,97,115,116,77,97,116,99,104
+,0,0,0,144,68,97,1,0,1,0,0,0,0,0,96,0,2,0,255,255,255,255,2,12,81,97,214,203,4,174,2,0
+,0,0,36,38,0,0,0,0,0,0,2,28,83,96,0,0,0,0,32,2,0,0,2,12,80,97,7,0,0,0,6,0
+,0,0,103,101,116,32,36,38,0,0,144,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,2,28,83
+,96,0,0,0,0,161,0,0,0,2,12,80,97,7,0,0,0,6,0,0,0,115,101,116,32,36,38,0,0,144,68,97
+,1,0,1,0,0,0,0,0,96,0,2,0,255,255,255,255,2,16,81,98,190,101,178,214,9,0,0,0,108,97,115,116
+,80,97,114,101,110,0,0,0,0,0,0,0,2,28,83,96,0,0,0,0,33,2,0,0,2,16,80,98,7,0,0,0
+,13,0,0,0,103,101,116,32,108,97,115,116,80,97,114,101,110,0,0,0,144,68,97,0,0,0,0,0,0,0,0,96
+,0,2,2,255,255,255,255,11,0,130,96,3,2,28,83,96,0,0,0,0,161,0,0,0,2,16,80,98,7,0,0,0
+,13,0,0,0,115,101,116,32,108,97,115,116,80,97,114,101,110,0,0,0,144,68,97,1,0,1,0,0,0,0,0,96
+,0,2,0,255,255,255,255,2,12,81,97,70,138,59,13,2,0,0,0,36,43,0,0,0,0,0,0,2,28,83,96,0
+,0,0,0,33,2,0,0,2,12,80,97,7,0,0,0,6,0,0,0,103,101,116,32,36,43,0,0,144,68,97,0,0
+,0,0,0,0,0,0,96,0,2,2,255,255,255,255,2,28,83,96,0,0,0,0,161,0,0,0,2,12,80,97,7,0
+,0,0,6,0,0,0,115,101,116,32,36,43,0,0,144,68,97,1,0,1,0,0,0,0,0,96,0,2,0,255,255,255
+,255,2,16,81,98,78,127,254,187,11,0,0,0,108,101,102,116,67,111,110,116,101,120,116,0,0,0,0,0,2,28,83
+,96,0,0,0,0,34,2,0,0,2,16,80,98,7,0,0,0,15,0,0,0,103,101,116,32,108,101,102,116,67,111,110
+,116,101,120,116,0,144,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,98,3,2,28,83
+,96,0,0,0,0,161,0,0,0,2,16,80,98,7,0,0,0,15,0,0,0,115,101,116,32,108,101,102,116,67,111,110
+,116,101,120,116,0,144,68,97,1,0,1,0,0,0,0,0,96,0,2,0,255,255,255,255,2,12,81,97,14,198,178,171
+,2,0,0,0,36,96,0,0,0,0,0,0,2,28,83,96,0,0,0,0,34,2,0,0,2,12,80,97,7,0,0,0
+,6,0,0,0,103,101,116,32,36,96,0,0,144,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,2
+,28,83,96,0,0,0,0,161,0,0,0,2,12,80,97,7,0,0,0,6,0,0,0,115,101,116,32,36,96,0,0,144
+,68,97,1,0,1,0,0,0,0,0,96,0,2,0,255,255,255,255,2,16,81,98,150,2,158,28,12,0,0,0,114,105
+,103,104,116,67,111,110,116,101,120,116,0,0,0,0,2,28,83,96,0,0,0,0,37,2,0,0,2,16,80,98,7,0
+,0,0,16,0,0,0,103,101,116,32,114,105,103,104,116,67,111,110,116,101,120,116,144,68,97,0,0,0,0,0,0,0
+,0,96,0,2,2,255,255,255,255,11,0,130,102,3,2,28,83,96,0,0,0,0,161,0,0,0,2,16,80,98,7,0
+,0,0,16,0,0,0,115,101,116,32,114,105,103,104,116,67,111,110,116,101,120,116,144,68,97,1,0,1,0,0,0,0
+,0,96,0,2,0,255,255,255,255,2,12,81,97,238,253,19,71,2,0,0,0,36,39,0,0,0,0,0,0,2,28,83
+,96,0,0,0,0,37,2,0,0,2,12,80,97,7,0,0,0,6,0,0,0,103,101,116,32,36,39,0,0,144,68,97
+,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,2,28,83,96,0,0,0,0,161,0,0,0,2,12,80,97
+,7,0,0,0,6,0,0,0,115,101,116,32,36,39,0,0,144,68,97,1,0,1,0,0,0,0,0,96,0,2,0,255
+,255,255,255,2,12,81,97,102,10,192,77,2,0,0,0,36,49,0,0,0,0,0,0,2,28,83,96,0,0,0,0,20
+,2,0,0,2,12,80,97,7,0,0,0,6,0,0,0,103,101,116,32,36,49,0,0,144,68,97,0,0,0,0,0,0
+,0,0,96,0,2,2,255,255,255,255,11,0,2,77,3,2,28,83,96,0,0,0,0,161,0,0,0,2,12,80,97,7
+,0,0,0,6,0,0,0,115,101,116,32,36,49,0,0,144,68,97,1,0,1,0,0,0,0,0,96,0,2,0,255,255
+,255,255,2,12,81,97,246,228,22,187,2,0,0,0,36,50,0,0,0,0,0,0,2,28,83,96,0,0,0,0,21,2
+,0,0,2,12,80,97,7,0,0,0,6,0,0,0,103,101,116,32,36,50,0,0,144,68,97,0,0,0,0,0,0,0
+,0,96,0,2,2,255,255,255,255,11,0,130,78,3,2,28,83,96,0,0,0,0,161,0,0,0,2,12,80,97,7,0
+,0,0,6,0,0,0,115,101,116,32,36,50,0,0,144,68,97,1,0,1,0,0,0,0,0,96,0,2,0,255,255,255
+,255,2,12,81,97,190,83,110,114,2,0,0,0,36,51,0,0,0,0,0,0,2,28,83,96,0,0,0,0,22,2,0
+,0,2,12,80,97,7,0,0,0,6,0,0,0,103,101,116,32,36,51,0,0,144,68,97,0,0,0,0,0,0,0,0
+,96,0,2,2,255,255,255,255,11,0,2,80,3,2,28,83,96,0,0,0,0,161,0,0,0,2,12,80,97,7,0,0
+,0,6,0,0,0,115,101,116,32,36,51,0,0,144,68,97,1,0,1,0,0,0,0,0,96,0,2,0,255,255,255,255
+,2,12,81,97,222,46,255,223,2,0,0,0,36,52,0,0,0,0,0,0,2,28,83,96,0,0,0,0,23,2,0,0
+,2,12,80,97,7,0,0,0,6,0,0,0,103,101,116,32,36,52,0,0,144,68,97,0,0,0,0,0,0,0,0,96
+,0,2,2,255,255,255,255,11,0,130,81,3,2,28,83,96,0,0,0,0,161,0,0,0,2,12,80,97,7,0,0,0
+,6,0,0,0,115,101,116,32,36,52,0,0,17,237,1,68,97,1,0,1,0,0,0,0,0,96,0,2,0,255,255,255
+,255,2,12,81,97,182,184,245,36,2,0,0,0,36,53,0,0,0,0,0,0,2,28,83,96,0,0,0,0,24,2,0
+,0,2,12,80,97,7,0,0,0,6,0,0,0,103,101,116,32,36,53,0,0,145,68,97,0,0,0,0,0,0,0,0
+,96,0,2,2,255,255,255,255,11,0,2,83,3,2,28,83,96,0,0,0,0,161,0,0,0,2,12,80,97,7,0,0
+,0,6,0,0,0,115,101,116,32,36,53,0,0,145,68,97,1,0,1,0,0,0,0,0,96,0,2,0,255,255,255,255
+,2,12,81,97,158,148,230,146,2,0,0,0,36,54,0,0,0,0,0,0,2,28,83,96,0,0,0,0,25,2,0,0
+,2,12,80,97,7,0,0,0,6,0,0,0,103,101,116,32,36,54,0,0,145,68,97,0,0,0,0,0,0,0,0,96
+,0,2,2,255,255,255,255,11,0,130,84,3,2,28,83,96,0,0,0,0,161,0,0,0,2,12,80,97,7,0,0,0
+,6,0,0,0,115,101,116,32,36,54,0,0,145,68,97,1,0,1,0,0,0,0,0,96,0,2,0,255,255,255,255,2
+,12,81,97,110,195,83,42,2,0,0,0,36,55,0,0,0,0,0,0,2,28,83,96,0,0,0,0,26,2,0,0,2
+,12,80,97,7,0,0,0,6,0,0,0,103,101,116,32,36,55,0,0,145,68,97,0,0,0,0,0,0,0,0,96,0
+,2,2,255,255,255,255,11,0,2,86,3,2,28,83,96,0,0,0,0,161,0,0,0,2,12,80,97,7,0,0,0,6
+,0,0,0,115,101,116,32,36,55,0,0,145,68,97,1,0,1,0,0,0,0,0,96,0,2,0,255,255,255,255,2,12
+,81,97,198,220,252,182,2,0,0,0,36,56,0,0,0,0,0,0,2,28,83,96,0,0,0,0,27,2,0,0,2,12
+,80,97,7,0,0,0,6,0,0,0,103,101,116,32,36,56,0,0,145,68,97,0,0,0,0,0,0,0,0,96,0,2
+,2,255,255,255,255,11,0,130,87,3,2,28,83,96,0,0,0,0,161,0,0,0,2,12,80,97,7,0,0,0,6,0
+,0,0,115,101,116,32,36,56,0,0,145,68,97,1,0,1,0,0,0,0,0,96,0,2,0,255,255,255,255,2,12,81
+,97,6,41,25,221,2,0,0,0,36,57,0,0,0,0,0,0,2,28,83,96,0,0,0,0,28,2,0,0,2,12,80
+,97,7,0,0,0,6,0,0,0,103,101,116,32,36,57,0,0,145,68,97,0,0,0,0,0,0,0,0,96,0,2,2
+,255,255,255,255,11,0,2,89,3,2,28,83,96,0,0,0,0,161,0,0,0,2,12,80,97,7,0,0,0,6,0,0
+,0,115,101,116,32,36,57,0,0,145,68,97,1,0,1,0,0,0,0,0,96,0,2,0,255,255,255,255,2,28,83,96
+,0,0,0,0,29,2,0,0,17,145,4,145,68,97,2,0,2,0,1,0,0,0,96,0,2,2,255,255,255,255,11,0
+,130,90,3,2,28,83,96,0,0,0,0,111,3,0,0,2,16,80,98,7,0,0,0,10,0,0,0,103,101,116,32,100
+,111,116,65,108,108,0,0,0,0,0,0,145,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0
+,130,85,5,2,28,83,96,0,0,0,0,114,3,0,0,2,16,80,98,7,0,0,0,9,0,0,0,103,101,116,32,102
+,108,97,103,115,0,0,0,0,0,0,0,17,237,1,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255
+,11,0,2,90,5,2,28,83,96,0,0,0,0,108,3,0,0,2,16,80,98,7,0,0,0,10,0,0,0,103,101,116
+,32,103,108,111,98,97,108,0,0,0,0,0,0,146,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255
+,11,0,2,81,5,2,28,83,96,0,0,0,0,109,3,0,0,2,16,80,98,7,0,0,0,14,0,0,0,103,101,116
+,32,105,103,110,111,114,101,67,97,115,101,0,0,146,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255
+,11,0,130,82,5,2,28,83,96,0,0,0,0,110,3,0,0,2,16,80,98,7,0,0,0,13,0,0,0,103,101,116
+,32,109,117,108,116,105,108,105,110,101,0,0,0,146,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255
+,11,0,2,84,5,2,28,83,96,0,0,0,0,103,3,0,0,2,16,80,98,7,0,0,0,10,0,0,0,103,101,116
+,32,115,111,117,114,99,101,0,0,0,0,0,0,146,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255
+,11,0,130,73,5,2,28,83,96,0,0,0,0,112,3,0,0,2,16,80,98,7,0,0,0,10,0,0,0,103,101,116
+,32,115,116,105,99,107,121,0,0,0,0,0,0,146,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255
+,11,0,2,87,5,2,28,83,96,0,0,0,0,113,3,0,0,2,16,80,98,7,0,0,0,11,0,0,0,103,101,116
+,32,117,110,105,99,111,100,101,0,0,0,0,0,146,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255
+,11,0,130,88,5,2,12,81,97,46,126,10,41,7,0,0,0,99,111,109,112,105,108,101,0,2,12,81,97,54,117,52
+,87,4,0,0,0,116,101,115,116,0,0,0,0,2,28,83,96,0,0,0,0,106,3,0,0,10,0,194,125,1,17,237
+,1,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,78,5,2,28,83,96,0,0,0,0
+,98,3,0,0,2,16,81,98,190,237,167,16,14,0,0,0,91,83,121,109,98,111,108,46,109,97,116,99,104,93,0,0
+,147,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,66,5,2,28,83,96,0,0,0,0
+,95,3,0,0,2,20,81,99,206,197,148,23,17,0,0,0,91,83,121,109,98,111,108,46,109,97,116,99,104,65,108,108
+,93,0,0,0,0,0,0,0,147,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,61,5
+,2,28,83,96,0,0,0,0,100,3,0,0,2,16,81,98,158,140,150,212,16,0,0,0,91,83,121,109,98,111,108,46
+,114,101,112,108,97,99,101,93,147,68,97,2,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,69,5
+,2,28,83,96,0,0,0,0,102,3,0,0,2,16,81,98,238,108,241,15,15,0,0,0,91,83,121,109,98,111,108,46
+,115,101,97,114,99,104,93,0,147,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,72,5
+,2,28,83,96,0,0,0,0,105,3,0,0,2,16,81,98,78,107,143,11,14,0,0,0,91,83,121,109,98,111,108,46
+,115,112,108,105,116,93,0,0,147,68,97,2,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,76,5
+,2,28,83,96,0,0,0,0,94,3,0,0,17,57,3,147,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255
+,255,255,11,0,2,60,5,2,28,83,96,0,0,0,0,35,2,0,0,10,0,98,125,1,17,237,1,68,97,2,0,2
+,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,99,3,2,28,83,96,0,0,0,0,36,2,0,0,17,29
+,5,149,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,101,3,2,20,81,99,46,105,13
+,29,17,0,0,0,99,97,112,116,117,114,101,83,116,97,99,107,84,114,97,99,101,0,0,0,0,0,0,0,2,28,83
+,96,0,0,0,0,74,1,0,0,10,0,162,136,1,149,68,97,2,0,255,255,0,0,0,0,96,0,2,2,255,255,255
+,255,11,0,2,30,2,2,28,83,96,0,0,0,0,73,1,0,0,17,41,3,149,68,97,1,0,255,255,2,0,0,0
+,96,0,2,2,255,255,255,255,11,0,130,28,2,2,28,83,96,0,0,0,0,75,1,0,0,151,149,68,97,0,0,0
+,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,31,2,2,28,83,96,0,0,0,0,73,1,0,0,17,133
+,4,17,237,1,68,97,1,0,255,255,2,0,0,0,96,0,2,2,255,255,255,255,2,16,81,98,94,116,222,15,9,0
+,0,0,101,110,99,111,100,101,85,82,73,0,0,0,0,0,0,0,2,28,83,96,0,0,0,0,100,1,0,0,10,0
+,194,140,1,151,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,69,2,2,28,83,96,0
+,0,0,0,165,0,0,0,2,20,80,99,7,0,0,0,20,0,0,0,103,101,116,32,91,83,121,109,98,111,108,46,115
+,112,101,99,105,101,115,93,0,0,0,0,151,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,2,28
+,83,96,0,0,0,0,109,2,0,0,17,69,4,151,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255
+,11,0,130,210,3,2,28,83,96,0,0,0,0,110,2,0,0,17,77,3,151,68,97,1,0,255,255,0,0,0,0,96
+,0,2,2,255,255,255,255,11,0,2,212,3,2,28,83,96,0,0,0,0,90,2,0,0,19,5,1,151,68,97,0,0
+,0,0,0,0,0,0,64,0,2,2,255,255,255,255,11,0,2,182,3,2,28,83,96,0,0,0,0,93,2,0,0,2
+,16,80,98,7,0,0,0,10,0,0,0,103,101,116,32,98,117,102,102,101,114,0,0,0,0,0,0,151,68,97,0,0
+,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,186,3,2,28,83,96,0,0,0,0,94,2,0,0,2
+,16,80,98,7,0,0,0,14,0,0,0,103,101,116,32,98,121,116,101,76,101,110,103,116,104,0,0,17,237,1,68,97
+,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,188,3,2,28,83,96,0,0,0,0,95,2,0
+,0,2,16,80,98,7,0,0,0,14,0,0,0,103,101,116,32,98,121,116,101,79,102,102,115,101,116,0,0,144,68,97
+,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,189,3,2,28,83,96,0,0,0,0,96,2,0
+,0,2,16,80,98,7,0,0,0,10,0,0,0,103,101,116,32,108,101,110,103,116,104,0,0,0,0,0,0,144,68,97
+,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,191,3,2,28,83,96,0,0,0,0,107,2,0
+,0,2,20,80,99,7,0,0,0,24,0,0,0,103,101,116,32,91,83,121,109,98,111,108,46,116,111,83,116,114,105,110
+,103,84,97,103,93,144,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,207,3,2,16,81
+,98,150,18,132,170,10,0,0,0,99,111,112,121,87,105,116,104,105,110,0,0,0,0,0,0,2,12,81,97,54,69,201
+,42,5,0,0,0,101,118,101,114,121,0,0,0,2,12,81,97,150,5,149,190,4,0,0,0,102,105,108,108,0,0,0
+,0,2,12,81,97,150,28,53,179,6,0,0,0,102,105,108,116,101,114,0,0,2,12,81,97,38,109,7,133,4,0,0
+,0,102,105,110,100,0,0,0,0,2,16,81,98,126,19,220,11,9,0,0,0,102,105,110,100,73,110,100,101,120,0,0
+,0,0,0,0,0,2,12,81,97,38,4,82,178,7,0,0,0,102,111,114,69,97,99,104,0,2,12,81,97,102,201,100
+,189,8,0,0,0,105,110,99,108,117,100,101,115,2,12,81,97,174,113,18,201,7,0,0,0,105,110,100,101,120,79,102
+,0,2,16,81,98,158,122,127,30,11,0,0,0,108,97,115,116,73,110,100,101,120,79,102,0,0,0,0,0,2,12,81
+,97,214,254,138,43,3,0,0,0,109,97,112,0,0,0,0,0,2,12,81,97,174,197,112,29,7,0,0,0,114,101,118
+,101,114,115,101,0,2,12,81,97,126,182,205,39,6,0,0,0,114,101,100,117,99,101,0,0,2,16,81,98,222,105,50
+,98,11,0,0,0,114,101,100,117,99,101,82,105,103,104,116,0,0,0,0,0,2,12,81,97,158,94,41,249,5,0,0
+,0,115,108,105,99,101,0,0,0,2,12,81,97,150,218,143,235,4,0,0,0,115,111,109,101,0,0,0,0,2,12,81
+,97,118,160,59,247,4,0,0,0,115,111,114,116,0,0,0,0,2,12,81,97,70,127,112,244,8,0,0,0,115,117,98
+,97,114,114,97,121,2,28,83,96,0,0,0,0,99,2,0,0,10,0,97,244,144,68,97,0,0,0,0,0,0,0,0
+,96,0,2,2,255,255,255,255,11,0,130,195,3,2,28,83,96,0,0,0,0,100,2,0,0,10,0,66,153,1,144,68
+,97,2,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,197,3,2,28,83,96,0,0,0,0,151,3
+,0,0,10,0,194,153,1,17,237,1,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,145
+,5,2,28,83,96,0,0,0,0,101,2,0,0,10,0,34,154,1,146,68,97,1,0,255,255,0,0,0,0,96,0,2
+,2,255,255,255,255,11,0,130,198,3,2,28,83,96,0,0,0,0,152,3,0,0,10,0,130,154,1,146,68,97,1,0
+,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,147,5,2,28,83,96,0,0,0,0,153,3,0,0,10
+,0,226,154,1,146,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,148,5,2,28,83,96
+,0,0,0,0,154,3,0,0,10,0,66,155,1,17,237,1,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255
+,255,255,11,0,2,150,5,2,28,83,96,0,0,0,0,155,3,0,0,10,0,194,155,1,147,68,97,1,0,255,255,0
+,0,0,0,96,0,2,2,255,255,255,255,11,0,130,151,5,2,28,83,96,0,0,0,0,102,2,0,0,10,0,34,156
+,1,147,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,200,3,2,28,83,96,0,0,0
+,0,103,2,0,0,10,0,130,156,1,147,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130
+,201,3,2,28,83,96,0,0,0,0,239,2,0,0,19,141,1,147,68,97,1,0,255,255,0,0,0,0,96,0,2,2
+,255,255,255,255,11,0,130,149,4,2,28,83,96,0,0,0,0,104,2,0,0,10,0,226,156,1,17,237,1,68,97,1
+,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,203,3,2,28,83,96,0,0,0,0,108,2,0,0
+,10,0,98,157,1,149,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,209,3,2,28,83
+,96,0,0,0,0,105,2,0,0,10,0,194,157,1,149,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255
+,255,11,0,130,204,3,2,28,83,96,0,0,0,0,156,3,0,0,10,0,34,158,1,149,68,97,1,0,255,255,0,0
+,0,0,96,0,2,2,255,255,255,255,11,0,2,153,5,2,28,83,96,0,0,0,0,157,3,0,0,10,0,130,158,1
+,17,237,1,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,154,5,2,28,83,96,0,0
+,0,0,106,2,0,0,17,193,4,150,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,206
+,3,2,28,83,96,0,0,0,0,158,3,0,0,10,0,2,159,1,150,68,97,2,0,255,255,0,0,0,0,96,0,2
+,2,255,255,255,255,11,0,2,156,5,2,28,83,96,0,0,0,0,159,3,0,0,10,0,98,159,1,150,68,97,1,0
+,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,157,5,2,28,83,96,0,0,0,0,162,3,0,0,10
+,0,194,159,1,17,237,1,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,162,5,2,28
+,83,96,0,0,0,0,160,3,0,0,10,0,34,160,1,151,68,97,2,0,255,255,0,0,0,0,96,0,2,2,255,255
+,255,255,11,0,2,159,5,2,28,83,96,0,0,0,0,240,2,0,0,19,125,1,151,68,97,0,0,255,255,0,0,0
+,0,96,0,2,2,255,255,255,255,11,0,2,151,4,2,28,83,96,0,0,0,0,238,2,0,0,17,29,5,151,68,97
+,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,148,4,2,28,83,96,0,0,0,0,97,2,0
+,0,10,0,129,243,151,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,192,3,2,28,83
+,96,0,0,0,0,98,2,0,0,17,189,3,17,237,1,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255
+,255,11,0,2,194,3,2,20,81,99,62,127,175,142,17,0,0,0,66,89,84,69,83,95,80,69,82,95,69,76,69,77
+,69,78,84,0,0,0,0,0,0,0,2,28,83,96,0,0,0,0,92,2,0,0,17,69,3,145,68,97,3,0,255,255
+,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,185,3,2,20,81,99,102,136,139,65,18,0,0,0,101,110,99
+,111,100,101,85,82,73,67,111,109,112,111,110,101,110,116,0,0,0,0,0,0,2,28,83,96,0,0,0,0,101,1,0
+,0,10,0,226,183,1,145,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,70,2,2,12
+,81,97,118,148,137,236,8,0,0,0,105,115,70,105,110,105,116,101,2,28,83,96,0,0,0,0,105,1,0,0,10,0
+,98,185,1,145,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,76,2,2,28,83,96,0
+,0,0,0,73,1,0,0,17,253,4,17,237,1,68,97,1,0,255,255,2,0,0,0,96,0,2,2,255,255,255,255,2
+,12,81,97,142,244,135,179,8,0,0,0,68,97,116,97,86,105,101,119,2,28,83,96,0,0,0,0,25,1,0,0,10
+,0,130,187,1,146,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,212,1,2,28,83,96
+,0,0,0,0,17,3,0,0,2,16,80,98,7,0,0,0,10,0,0,0,103,101,116,32,98,117,102,102,101,114,0,0
+,0,0,0,0,146,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,200,4,2,28,83,96
+,0,0,0,0,18,3,0,0,2,16,80,98,7,0,0,0,14,0,0,0,103,101,116,32,98,121,116,101,76,101,110,103
+,116,104,0,0,146,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,202,4,2,28,83,96
+,0,0,0,0,19,3,0,0,2,16,80,98,7,0,0,0,14,0,0,0,103,101,116,32,98,121,116,101,79,102,102,115
+,101,116,0,0,146,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,203,4,2,12,81,97
+,246,131,81,176,7,0,0,0,103,101,116,73,110,116,56,0,2,12,81,97,158,160,153,145,7,0,0,0,115,101,116,73
+,110,116,56,0,2,12,81,97,54,225,168,211,8,0,0,0,103,101,116,85,105,110,116,56,2,12,81,97,38,242,149,226
+,8,0,0,0,115,101,116,85,105,110,116,56,2,12,81,97,6,113,248,166,8,0,0,0,103,101,116,73,110,116,49,54
+,2,12,81,97,38,192,245,234,8,0,0,0,115,101,116,73,110,116,49,54,2,16,81,98,230,159,3,168,9,0,0,0
+,103,101,116,85,105,110,116,49,54,0,0,0,0,0,0,0,2,16,81,98,158,233,27,232,9,0,0,0,115,101,116,85
+,105,110,116,49,54,0,0,0,0,0,0,0,2,12,81,97,246,248,66,23,8,0,0,0,103,101,116,73,110,116,51,50
+,2,12,81,97,198,210,16,125,8,0,0,0,115,101,116,73,110,116,51,50,2,16,81,98,206,197,254,13,9,0,0,0
+,103,101,116,85,105,110,116,51,50,0,0,0,0,0,0,0,2,16,81,98,54,104,126,54,9,0,0,0,115,101,116,85
+,105,110,116,51,50,0,0,0,0,0,0,0,2,16,81,98,78,10,111,52,10,0,0,0,103,101,116,70,108,111,97,116
+,51,50,0,0,0,0,0,0,2,16,81,98,110,189,18,179,10,0,0,0,115,101,116,70,108,111,97,116,51,50,0,0
+,0,0,0,0,2,16,81,98,150,80,179,124,10,0,0,0,103,101,116,70,108,111,97,116,54,52,0,0,0,0,0,0
+,2,16,81,98,214,226,132,115,10,0,0,0,115,101,116,70,108,111,97,116,54,52,0,0,0,0,0,0,2,16,81,98
+,254,1,209,183,11,0,0,0,103,101,116,66,105,103,73,110,116,54,52,0,0,0,0,0,2,16,81,98,78,214,138,40
+,11,0,0,0,115,101,116,66,105,103,73,110,116,54,52,0,0,0,0,0,2,16,81,98,54,219,235,72,12,0,0,0
+,103,101,116,66,105,103,85,105,110,116,54,52,0,0,0,0,2,16,81,98,118,229,148,107,12,0,0,0,115,101,116,66
+,105,103,85,105,110,116,54,52,0,0,0,0,2,28,83,96,0,0,0,0,20,3,0,0,10,0,162,193,1,146,68,97
+,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,205,4,2,28,83,96,0,0,0,0,30,3,0
+,0,10,0,2,194,1,17,237,1,68,97,2,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,220,4
+,2,28,83,96,0,0,0,0,23,3,0,0,10,0,98,194,1,147,68,97,1,0,255,255,0,0,0,0,96,0,2,2
+,255,255,255,255,11,0,130,209,4,2,28,83,96,0,0,0,0,33,3,0,0,10,0,194,194,1,147,68,97,2,0,255
+,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,224,4,2,28,83,96,0,0,0,0,22,3,0,0,10,0
+,34,195,1,147,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,208,4,2,28,83,96,0
+,0,0,0,32,3,0,0,10,0,162,195,1,17,237,1,68,97,2,0,255,255,0,0,0,0,96,0,2,2,255,255,255
+,255,11,0,2,223,4,2,28,83,96,0,0,0,0,25,3,0,0,10,0,34,196,1,148,68,97,1,0,255,255,0,0
+,0,0,96,0,2,2,255,255,255,255,11,0,130,212,4,2,28,83,96,0,0,0,0,35,3,0,0,10,0,130,196,1
+,148,68,97,2,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,227,4,2,28,83,96,0,0,0,0
+,24,3,0,0,10,0,226,196,1,148,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,211
+,4,2,28,83,96,0,0,0,0,34,3,0,0,10,0,98,197,1,17,237,1,68,97,2,0,255,255,0,0,0,0,96
+,0,2,2,255,255,255,255,11,0,2,226,4,2,28,83,96,0,0,0,0,26,3,0,0,10,0,226,197,1,149,68,97
+,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,214,4,2,28,83,96,0,0,0,0,36,3,0
+,0,10,0,98,198,1,149,68,97,2,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,229,4,2,28
+,83,96,0,0,0,0,27,3,0,0,10,0,226,198,1,149,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255
+,255,255,11,0,130,215,4,2,28,83,96,0,0,0,0,37,3,0,0,10,0,98,199,1,17,237,1,68,97,2,0,255
+,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,230,4,2,28,83,96,0,0,0,0,29,3,0,0,10,0
+,226,199,1,150,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,218,4,2,28,83,96,0
+,0,0,0,39,3,0,0,10,0,98,200,1,150,68,97,2,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11
+,0,130,233,4,2,28,83,96,0,0,0,0,28,3,0,0,10,0,226,200,1,150,68,97,1,0,255,255,0,0,0,0
+,96,0,2,2,255,255,255,255,11,0,2,217,4,2,28,83,96,0,0,0,0,38,3,0,0,10,0,98,201,1,17,237
+,1,68,97,2,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,232,4,2,28,83,96,0,0,0,0
+,21,3,0,0,10,0,226,192,1,151,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,206
+,4,2,28,83,96,0,0,0,0,31,3,0,0,10,0,66,193,1,151,68,97,2,0,255,255,0,0,0,0,96,0,2
+,2,255,255,255,255,11,0,130,221,4,2,12,81,97,86,113,59,121,3,0,0,0,110,111,119,0,0,0,0,0,2,12
+,81,97,70,170,73,202,5,0,0,0,112,97,114,115,101,0,0,0,2,12,81,97,222,29,89,104,3,0,0,0,85,84
+,67,0,0,0,0,0,2,28,83,96,0,0,0,0,49,1,0,0,10,0,98,219,1,151,68,97,0,0,255,255,0,0
+,0,0,96,0,2,2,255,255,255,255,11,0,130,248,1,2,28,83,96,0,0,0,0,50,1,0,0,10,0,194,219,1
+,17,237,1,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,250,1,2,28,83,96,0,0
+,0,0,72,1,0,0,10,0,34,220,1,144,68,97,7,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0
+,2,27,2,2,28,83,96,0,0,0,0,26,1,0,0,17,213,2,144,68,97,7,0,255,255,0,0,0,0,96,0,2
+,2,255,255,255,255,11,0,2,214,1,2,16,81,98,190,40,16,142,12,0,0,0,116,111,68,97,116,101,83,116,114,105
+,110,103,0,0,0,0,2,16,81,98,134,179,85,146,12,0,0,0,116,111,84,105,109,101,83,116,114,105,110,103,0,0
+,0,0,2,16,81,98,238,151,131,94,11,0,0,0,116,111,73,83,79,83,116,114,105,110,103,0,0,0,0,0,2,16
+,81,98,14,99,98,6,11,0,0,0,116,111,85,84,67,83,116,114,105,110,103,0,0,0,0,0,2,16,81,98,94,67
+,40,71,11,0,0,0,116,111,71,77,84,83,116,114,105,110,103,0,0,0,0,0,2,12,81,97,54,47,122,129,7,0
+,0,0,103,101,116,68,97,116,101,0,2,12,81,97,46,189,33,55,7,0,0,0,115,101,116,68,97,116,101,0,2,12
+,81,97,54,17,76,92,6,0,0,0,103,101,116,68,97,121,0,0,2,16,81,98,70,187,116,166,11,0,0,0,103,101
+,116,70,117,108,108,89,101,97,114,0,0,0,0,0,2,16,81,98,22,136,47,49,11,0,0,0,115,101,116,70,117,108
+,108,89,101,97,114,0,0,0,0,0,2,12,81,97,182,56,100,36,8,0,0,0,103,101,116,72,111,117,114,115,2,12
+,81,97,94,28,232,92,8,0,0,0,115,101,116,72,111,117,114,115,2,16,81,98,222,117,203,19,15,0,0,0,103,101
+,116,77,105,108,108,105,115,101,99,111,110,100,115,0,2,16,81,98,198,115,193,48,15,0,0,0,115,101,116,77,105,108
+,108,105,115,101,99,111,110,100,115,0,2,16,81,98,110,175,160,35,10,0,0,0,103,101,116,77,105,110,117,116,101,115
+,0,0,0,0,0,0,2,16,81,98,222,74,87,106,10,0,0,0,115,101,116,77,105,110,117,116,101,115,0,0,0,0
+,0,0,2,12,81,97,118,230,90,174,8,0,0,0,103,101,116,77,111,110,116,104,2,12,81,97,62,80,59,129,8,0
+,0,0,115,101,116,77,111,110,116,104,2,16,81,98,198,101,24,127,10,0,0,0,103,101,116,83,101,99,111,110,100,115
+,0,0,0,0,0,0,2,16,81,98,86,166,122,231,10,0,0,0,115,101,116,83,101,99,111,110,100,115,0,0,0,0
+,0,0,2,12,81,97,86,201,170,80,7,0,0,0,103,101,116,84,105,109,101,0,2,12,81,97,70,82,76,60,7,0
+,0,0,115,101,116,84,105,109,101,0,2,20,81,99,46,61,33,252,17,0,0,0,103,101,116,84,105,109,101,122,111,110
+,101,79,102,102,115,101,116,0,0,0,0,0,0,0,2,16,81,98,246,69,44,8,10,0,0,0,103,101,116,85,84,67
+,68,97,116,101,0,0,0,0,0,0,2,16,81,98,134,112,184,205,10,0,0,0,115,101,116,85,84,67,68,97,116,101
+,0,0,0,0,0,0,2,16,81,98,142,247,38,222,9,0,0,0,103,101,116,85,84,67,68,97,121,0,0,0,0,0
+,0,0,2,16,81,98,198,82,230,244,14,0,0,0,103,101,116,85,84,67,70,117,108,108,89,101,97,114,0,0,2,16
+,81,98,38,56,26,154,14,0,0,0,115,101,116,85,84,67,70,117,108,108,89,101,97,114,0,0,2,16,81,98,174,223
+,102,79,11,0,0,0,103,101,116,85,84,67,72,111,117,114,115,0,0,0,0,0,2,16,81,98,142,220,239,148,11,0
+,0,0,115,101,116,85,84,67,72,111,117,114,115,0,0,0,0,0,2,20,81,99,14,177,253,97,18,0,0,0,103,101
+,116,85,84,67,77,105,108,108,105,115,101,99,111,110,100,115,0,0,0,0,0,0,2,20,81,99,254,215,129,155,18,0
+,0,0,115,101,116,85,84,67,77,105,108,108,105,115,101,99,111,110,100,115,0,0,0,0,0,0,2,16,81,98,222,150
+,175,53,13,0,0,0,103,101,116,85,84,67,77,105,110,117,116,101,115,0,0,0,2,16,81,98,198,68,223,110,13,0
+,0,0,115,101,116,85,84,67,77,105,110,117,116,101,115,0,0,0,2,16,81,98,14,29,169,253,11,0,0,0,103,101
+,116,85,84,67,77,111,110,116,104,0,0,0,0,0,2,16,81,98,190,163,159,47,11,0,0,0,115,101,116,85,84,67
+,77,111,110,116,104,0,0,0,0,0,2,16,81,98,174,84,92,213,13,0,0,0,103,101,116,85,84,67,83,101,99,111
+,110,100,115,0,0,0,2,16,81,98,94,218,170,207,13,0,0,0,115,101,116,85,84,67,83,101,99,111,110,100,115,0
+,0,0,2,12,81,97,142,133,219,166,7,0,0,0,103,101,116,89,101,97,114,0,2,12,81,97,78,237,64,136,7,0
+,0,0,115,101,116,89,101,97,114,0,2,20,81,99,206,118,73,231,18,0,0,0,116,111,76,111,99,97,108,101,68,97
+,116,101,83,116,114,105,110,103,0,0,0,0,0,0,2,20,81,99,198,143,163,178,18,0,0,0,116,111,76,111,99,97
+,108,101,84,105,109,101,83,116,114,105,110,103,0,0,0,0,0,0,2,28,83,96,0,0,0,0,67,1,0,0,10,0
+,2,225,1,144,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,19,2,2,28,83,96,0
+,0,0,0,68,1,0,0,10,0,130,225,1,17,237,1,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255
+,255,11,0,2,21,2,2,28,83,96,0,0,0,0,27,1,0,0,10,0,130,226,1,145,68,97,0,0,0,0,0,0
+,0,0,96,0,2,2,255,255,255,255,11,0,130,215,1,2,28,83,96,0,0,0,0,51,1,0,0,10,0,226,226,1
+,145,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,251,1,2,28,83,96,0,0,0,0
+,28,1,0,0,10,0,66,227,1,145,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,217
+,1,2,28,83,96,0,0,0,0,29,1,0,0,10,0,162,227,1,17,237,1,68,97,0,0,0,0,0,0,0,0,96
+,0,2,2,255,255,255,255,11,0,130,218,1,2,28,83,96,0,0,0,0,52,1,0,0,10,0,34,228,1,146,68,97
+,3,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,253,1,2,28,83,96,0,0,0,0,30,1,0
+,0,10,0,162,228,1,146,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,220,1,2,28
+,83,96,0,0,0,0,53,1,0,0,10,0,2,229,1,146,68,97,4,0,255,255,0,0,0,0,96,0,2,2,255,255
+,255,255,11,0,130,254,1,2,28,83,96,0,0,0,0,31,1,0,0,10,0,98,229,1,17,237,1,68,97,0,0,0
+,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,221,1,2,28,83,96,0,0,0,0,54,1,0,0,10,0
+,226,229,1,147,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,0,2,2,28,83,96,0
+,0,0,0,32,1,0,0,10,0,98,230,1,147,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11
+,0,2,223,1,2,28,83,96,0,0,0,0,55,1,0,0,10,0,226,230,1,147,68,97,3,0,255,255,0,0,0,0
+,96,0,2,2,255,255,255,255,11,0,130,1,2,2,28,83,96,0,0,0,0,33,1,0,0,10,0,98,231,1,17,237
+,1,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,224,1,2,28,83,96,0,0,0,0
+,56,1,0,0,10,0,194,231,1,148,68,97,2,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,3
+,2,2,28,83,96,0,0,0,0,34,1,0,0,10,0,34,232,1,148,68,97,0,0,0,0,0,0,0,0,96,0,2
+,2,255,255,255,255,11,0,2,226,1,2,28,83,96,0,0,0,0,57,1,0,0,10,0,162,232,1,148,68,97,2,0
+,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,4,2,2,28,83,96,0,0,0,0,35,1,0,0,10
+,0,34,233,1,17,237,1,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,227,1,2,28
+,83,96,0,0,0,0,58,1,0,0,10,0,130,233,1,149,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255
+,255,255,11,0,2,6,2,2,28,83,96,0,0,0,0,36,1,0,0,10,0,226,233,1,149,68,97,0,0,0,0,0
+,0,0,0,96,0,2,2,255,255,255,255,11,0,2,229,1,2,28,83,96,0,0,0,0,37,1,0,0,10,0,130,234
+,1,149,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,230,1,2,28,83,96,0,0,0
+,0,59,1,0,0,10,0,2,235,1,17,237,1,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11
+,0,130,7,2,2,28,83,96,0,0,0,0,38,1,0,0,10,0,130,235,1,150,68,97,0,0,0,0,0,0,0,0
+,96,0,2,2,255,255,255,255,11,0,2,232,1,2,28,83,96,0,0,0,0,39,1,0,0,10,0,2,236,1,150,68
+,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,233,1,2,28,83,96,0,0,0,0,60,1
+,0,0,10,0,130,236,1,150,68,97,3,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,9,2,2
+,28,83,96,0,0,0,0,40,1,0,0,10,0,2,237,1,17,237,1,68,97,0,0,0,0,0,0,0,0,96,0,2
+,2,255,255,255,255,11,0,2,235,1,2,28,83,96,0,0,0,0,61,1,0,0,10,0,130,237,1,151,68,97,4,0
+,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,10,2,2,28,83,96,0,0,0,0,41,1,0,0,10
+,0,2,238,1,151,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,236,1,2,28,83,96
+,0,0,0,0,62,1,0,0,10,0,162,238,1,151,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255
+,11,0,2,12,2,2,28,83,96,0,0,0,0,42,1,0,0,10,0,66,239,1,17,237,1,68,97,0,0,0,0,0
+,0,0,0,96,0,2,2,255,255,255,255,11,0,2,238,1,2,28,83,96,0,0,0,0,63,1,0,0,10,0,194,239
+,1,144,68,97,3,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,13,2,2,28,83,96,0,0,0
+,0,43,1,0,0,10,0,66,240,1,144,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130
+,239,1,2,28,83,96,0,0,0,0,64,1,0,0,10,0,194,240,1,144,68,97,2,0,255,255,0,0,0,0,96,0
+,2,2,255,255,255,255,11,0,2,15,2,2,28,83,96,0,0,0,0,44,1,0,0,10,0,66,241,1,17,237,1,68
+,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,241,1,2,28,83,96,0,0,0,0,65,1
+,0,0,10,0,194,241,1,145,68,97,2,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,16,2,2
+,28,83,96,0,0,0,0,45,1,0,0,17,81,5,145,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255
+,255,11,0,130,242,1,2,28,83,96,0,0,0,0,47,1,0,0,10,0,66,242,1,145,68,97,0,0,0,0,0,0
+,0,0,96,0,2,2,255,255,255,255,11,0,130,245,1,2,28,83,96,0,0,0,0,48,1,0,0,10,0,162,242,1
+,17,237,1,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,247,1,2,28,83,96,0,0
+,0,0,71,1,0,0,17,25,5,146,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,25
+,2,2,28,83,96,0,0,0,0,69,1,0,0,19,125,1,146,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255
+,255,255,255,11,0,130,22,2,2,28,83,96,0,0,0,0,66,1,0,0,10,0,2,243,1,146,68,97,0,0,255,255
+,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,18,2,2,28,83,96,0,0,0,0,70,1,0,0,10,0,162
+,243,1,146,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,24,2,2,28,83,96,0,0
+,0,0,46,1,0,0,2,20,81,99,214,1,222,51,20,0,0,0,91,83,121,109,98,111,108,46,116,111,80,114,105,109
+,105,116,105,118,101,93,0,0,0,0,17,237,1,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11
+,0,2,244,1,2,28,83,96,0,0,0,0,69,1,0,0,17,29,5,147,68,97,0,0,255,255,0,0,0,0,96,0
+,2,2,255,255,255,255,2,28,83,96,0,0,0,0,66,1,0,0,10,0,2,224,1,147,68,97,0,0,255,255,0,0
+,0,0,96,0,2,2,255,255,255,255,2,28,83,96,0,0,0,0,70,1,0,0,10,0,130,224,1,147,68,97,0,0
+,255,255,0,0,0,0,96,0,2,2,255,255,255,255,2,28,83,96,0,0,0,0,73,1,0,0,17,53,3,147,68,97
+,1,0,255,255,2,0,0,0,96,0,2,2,255,255,255,255,2,16,81,98,214,9,72,120,12,0,0,0,102,114,111,109
+,67,104,97,114,67,111,100,101,0,0,0,0,2,16,81,98,102,121,74,216,13,0,0,0,102,114,111,109,67,111,100,101
+,80,111,105,110,116,0,0,0,2,28,83,96,0,0,0,0,68,2,0,0,10,0,2,30,2,147,68,97,1,0,255,255
+,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,149,3,2,28,83,96,0,0,0,0,67,2,0,0,10,0,130
+,30,2,17,237,1,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,147,3,2,28,83,96
+,0,0,0,0,82,2,0,0,17,129,4,148,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0
+,2,170,3,2,28,83,96,0,0,0,0,122,3,0,0,17,229,4,148,68,97,1,0,255,255,0,0,0,0,96,0,2
+,2,255,255,255,255,11,0,2,102,5,2,12,81,97,134,92,207,125,6,0,0,0,97,110,99,104,111,114,0,0,2,12
+,81,97,22,170,244,239,4,0,0,0,98,111,108,100,0,0,0,0,2,12,81,97,118,105,108,40,6,0,0,0,99,104
+,97,114,65,116,0,0,2,16,81,98,174,125,146,138,10,0,0,0,99,104,97,114,67,111,100,101,65,116,0,0,0,0
+,0,0,2,16,81,98,230,191,136,241,11,0,0,0,99,111,100,101,80,111,105,110,116,65,116,0,0,0,0,0,2,12
+,81,97,70,116,138,47,6,0,0,0,99,111,110,99,97,116,0,0,2,12,81,97,230,140,20,255,8,0,0,0,101,110
+,100,115,87,105,116,104,2,16,81,98,22,12,78,175,9,0,0,0,102,111,110,116,99,111,108,111,114,0,0,0,0,0
+,0,0,2,12,81,97,14,74,69,135,8,0,0,0,102,111,110,116,115,105,122,101,2,12,81,97,46,99,139,116,5,0
+,0,0,102,105,120,101,100,0,0,0,2,12,81,97,14,231,29,61,7,0,0,0,105,116,97,108,105,99,115,0,2,12
+,81,97,14,57,177,185,4,0,0,0,108,105,110,107,0,0,0,0,2,16,81,98,158,234,149,67,13,0,0,0,108,111
+,99,97,108,101,67,111,109,112,97,114,101,0,0,0,2,12,81,97,214,181,184,55,5,0,0,0,109,97,116,99,104,0
+,0,0,2,12,81,97,38,142,81,148,8,0,0,0,109,97,116,99,104,65,108,108,2,16,81,98,102,20,32,115,9,0
+,0,0,110,111,114,109,97,108,105,122,101,0,0,0,0,0,0,0,2,12,81,97,102,40,204,55,6,0,0,0,112,97
+,100,69,110,100,0,0,2,12,81,97,102,172,6,113,8,0,0,0,112,97,100,83,116,97,114,116,2,12,81,97,62,91
+,238,222,6,0,0,0,114,101,112,101,97,116,0,0,2,12,81,97,6,115,100,179,7,0,0,0,114,101,112,108,97,99
+,101,0,2,12,81,97,246,151,70,206,6,0,0,0,115,101,97,114,99,104,0,0,2,12,81,97,166,123,100,24,5,0
+,0,0,115,112,108,105,116,0,0,0,2,12,81,97,70,99,151,22,6,0,0,0,115,117,98,115,116,114,0,0,2,16
+,81,98,158,6,242,32,9,0,0,0,115,117,98,115,116,114,105,110,103,0,0,0,0,0,0,0,2,16,81,98,254,157
+,111,160,10,0,0,0,115,116,97,114,116,115,87,105,116,104,0,0,0,0,0,0,2,12,81,97,174,111,113,241,4,0
+,0,0,116,114,105,109,0,0,0,0,2,16,81,98,158,9,165,227,9,0,0,0,116,114,105,109,83,116,97,114,116,0
+,0,0,0,0,0,0,2,12,81,97,126,15,220,139,8,0,0,0,116,114,105,109,76,101,102,116,2,12,81,97,62,208
+,125,76,7,0,0,0,116,114,105,109,69,110,100,0,2,16,81,98,78,11,101,158,9,0,0,0,116,114,105,109,82,105
+,103,104,116,0,0,0,0,0,0,0,2,20,81,99,206,4,135,241,17,0,0,0,116,111,76,111,99,97,108,101,76,111
+,119,101,114,67,97,115,101,0,0,0,0,0,0,0,2,20,81,99,86,51,57,149,17,0,0,0,116,111,76,111,99,97
+,108,101,85,112,112,101,114,67,97,115,101,0,0,0,0,0,0,0,2,16,81,98,102,156,22,153,11,0,0,0,116,111
+,76,111,119,101,114,67,97,115,101,0,0,0,0,0,2,16,81,98,182,164,8,223,11,0,0,0,116,111,85,112,112,101
+,114,67,97,115,101,0,0,0,0,0,2,28,83,96,0,0,0,0,128,3,0,0,10,0,130,34,2,148,68,97,1,0
+,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,111,5,2,28,83,96,0,0,0,0,129,3,0,0,19
+,253,2,148,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,112,5,2,28,83,96,0,0
+,0,0,130,3,0,0,19,5,3,17,237,1,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0
+,2,114,5,2,28,83,96,0,0,0,0,131,3,0,0,10,0,226,34,2,149,68,97,0,0,255,255,0,0,0,0,96
+,0,2,2,255,255,255,255,11,0,130,115,5,2,28,83,96,0,0,0,0,118,3,0,0,10,0,66,35,2,149,68,97
+,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,96,5,2,28,83,96,0,0,0,0,119,3,0
+,0,10,0,162,35,2,149,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,97,5,2,28
+,83,96,0,0,0,0,120,3,0,0,10,0,34,36,2,17,237,1,68,97,1,0,1,0,0,0,0,0,96,0,2,2
+,255,255,255,255,11,0,2,99,5,2,28,83,96,0,0,0,0,121,3,0,0,10,0,162,36,2,150,68,97,1,0,255
+,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,100,5,2,28,83,96,0,0,0,0,126,3,0,0,10,0
+,2,37,2,150,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,108,5,2,28,83,96,0
+,0,0,0,132,3,0,0,10,0,98,37,2,150,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11
+,0,2,117,5,2,28,83,96,0,0,0,0,133,3,0,0,10,0,226,37,2,17,237,1,68,97,1,0,255,255,0,0
+,0,0,96,0,2,2,255,255,255,255,11,0,130,118,5,2,28,83,96,0,0,0,0,134,3,0,0,10,0,66,38,2
+,151,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,120,5,2,28,83,96,0,0,0,0
+,69,2,0,0,10,0,34,156,1,151,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,150
+,3,2,28,83,96,0,0,0,0,70,2,0,0,10,0,130,156,1,151,68,97,1,0,255,255,0,0,0,0,96,0,2
+,2,255,255,255,255,11,0,2,152,3,2,28,83,96,0,0,0,0,135,3,0,0,10,0,162,38,2,17,237,1,68,97
+,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,121,5,2,28,83,96,0,0,0,0,71,2,0
+,0,10,0,226,156,1,144,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,153,3,2,28
+,83,96,0,0,0,0,136,3,0,0,10,0,2,39,2,144,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255
+,255,255,11,0,2,123,5,2,28,83,96,0,0,0,0,74,2,0,0,10,0,98,39,2,144,68,97,1,0,1,0,0
+,0,0,0,96,0,2,2,255,255,255,255,11,0,2,158,3,2,28,83,96,0,0,0,0,72,2,0,0,10,0,226,39
+,2,17,237,1,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,155,3,2,28,83,96,0
+,0,0,0,73,2,0,0,10,0,66,40,2,145,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11
+,0,130,156,3,2,28,83,96,0,0,0,0,226,3,0,0,10,0,162,40,2,145,68,97,0,0,255,255,0,0,0,0
+,96,0,2,2,255,255,255,255,11,0,2,2,6,2,28,83,96,0,0,0,0,144,3,0,0,10,0,34,41,2,145,68
+,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,135,5,2,28,83,96,0,0,0,0,143,3
+,0,0,10,0,130,41,2,17,237,1,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,133
+,5,2,28,83,96,0,0,0,0,146,3,0,0,10,0,226,41,2,146,68,97,1,0,1,0,0,0,0,0,96,0,2
+,2,255,255,255,255,11,0,2,138,5,2,28,83,96,0,0,0,0,75,2,0,0,10,0,66,42,2,146,68,97,2,0
+,2,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,159,3,2,28,83,96,0,0,0,0,76,2,0,0,10
+,0,162,42,2,146,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,161,3,2,28,83,96
+,0,0,0,0,147,3,0,0,10,0,2,159,1,17,237,1,68,97,2,0,255,255,0,0,0,0,96,0,2,2,255,255
+,255,255,11,0,130,139,5,2,28,83,96,0,0,0,0,137,3,0,0,19,65,3,147,68,97,0,0,255,255,0,0,0
+,0,96,0,2,2,255,255,255,255,11,0,130,124,5,2,28,83,96,0,0,0,0,77,2,0,0,10,0,2,43,2,147
+,68,97,2,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,162,3,2,28,83,96,0,0,0,0,138
+,3,0,0,19,73,3,147,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,126,5,2,28
+,83,96,0,0,0,0,139,3,0,0,19,81,3,147,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255
+,11,0,130,127,5,2,28,83,96,0,0,0,0,78,2,0,0,10,0,98,43,2,147,68,97,2,0,255,255,0,0,0
+,0,96,0,2,2,255,255,255,255,11,0,2,164,3,2,28,83,96,0,0,0,0,149,3,0,0,10,0,194,43,2,17
+,237,1,68,97,2,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,142,5,2,28,83,96,0,0,0
+,0,140,3,0,0,19,89,3,149,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,129,5
+,2,28,83,96,0,0,0,0,148,3,0,0,10,0,66,44,2,149,68,97,1,0,255,255,0,0,0,0,96,0,2,2
+,255,255,255,255,11,0,2,141,5,2,28,83,96,0,0,0,0,115,3,0,0,17,29,5,149,68,97,0,0,0,0,0
+,0,0,0,96,0,2,2,255,255,255,255,11,0,130,91,5,2,28,83,96,0,0,0,0,79,2,0,0,10,0,194,44
+,2,149,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,165,3,2,28,83,96,0,0,0
+,0,81,2,0,0,10,0,34,45,2,17,237,1,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11
+,0,130,168,3,2,28,83,96,0,0,0,0,80,2,0,0,10,0,2,46,2,151,68,97,0,0,255,255,0,0,0,0
+,96,0,2,2,255,255,255,255,11,0,2,167,3,2,28,83,96,0,0,0,0,227,3,0,0,10,0,226,46,2,151,68
+,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,3,6,2,28,83,96,0,0,0,0,228,3
+,0,0,10,0,130,47,2,151,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,5,6,2
+,28,83,96,0,0,0,0,229,3,0,0,10,0,34,48,2,17,237,1,68,97,0,0,255,255,0,0,0,0,96,0,2
+,2,255,255,255,255,11,0,130,6,6,2,28,83,96,0,0,0,0,230,3,0,0,10,0,162,48,2,144,68,97,0,0
+,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,8,6,2,28,83,96,0,0,0,0,116,3,0,0,17
+,81,5,144,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,93,5,2,28,83,96,0,0
+,0,0,141,3,0,0,2,20,81,99,230,15,224,98,17,0,0,0,91,83,121,109,98,111,108,46,105,116,101,114,97,116
+,111,114,93,0,0,0,0,0,0,0,144,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130
+,130,5,2,28,83,96,0,0,0,0,92,2,0,0,17,73,3,144,68,97,3,0,255,255,0,0,0,0,96,0,2,2
+,255,255,255,255,2,28,83,96,0,0,0,0,92,2,0,0,17,169,3,17,237,1,68,97,3,0,255,255,0,0,0,0
+,96,0,2,2,255,255,255,255,2,28,83,96,0,0,0,0,165,0,0,0,2,20,80,99,7,0,0,0,20,0,0,0
+,103,101,116,32,91,83,121,109,98,111,108,46,115,112,101,99,105,101,115,93,0,0,0,0,145,68,97,0,0,0,0,0
+,0,0,0,96,0,2,2,255,255,255,255,2,12,81,97,126,141,206,125,3,0,0,0,97,108,108,0,0,0,0,0,2
+,12,81,97,38,87,192,152,4,0,0,0,114,97,99,101,0,0,0,0,2,12,81,97,214,10,27,78,6,0,0,0,114
+,101,106,101,99,116,0,0,2,28,83,96,0,0,0,0,4,2,0,0,10,0,98,92,2,145,68,97,1,0,1,0,0
+,0,0,0,96,0,2,2,255,255,255,255,11,0,2,53,3,2,28,83,96,0,0,0,0,6,2,0,0,10,0,194,92
+,2,145,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,56,3,2,28,83,96,0,0,0
+,0,252,1,0,0,17,153,4,145,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,41,3
+,2,28,83,96,0,0,0,0,254,1,0,0,10,0,34,93,2,145,68,97,1,0,1,0,0,0,0,0,96,0,2,2
+,255,255,255,255,11,0,2,44,3,2,28,83,96,0,0,0,0,244,1,0,0,17,101,4,17,237,1,68,97,1,0,1
+,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,29,3,2,12,81,97,214,33,119,37,5,0,0,0,99,97
+,116,99,104,0,0,0,2,12,81,97,198,117,145,237,7,0,0,0,102,105,110,97,108,108,121,0,2,28,83,96,0,0
+,0,0,255,1,0,0,10,0,66,98,2,147,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0
+,130,45,3,2,28,83,96,0,0,0,0,246,1,0,0,17,5,5,147,68,97,2,0,2,0,0,0,0,0,96,0,2
+,2,255,255,255,255,11,0,2,32,3,2,28,83,96,0,0,0,0,248,1,0,0,10,0,226,97,2,147,68,97,1,0
+,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,35,3,2,28,83,96,0,0,0,0,92,2,0,0,17
+,129,2,17,237,1,68,97,3,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,2,28,83,96,0,0,0,0,165
+,0,0,0,2,20,80,99,7,0,0,0,20,0,0,0,103,101,116,32,91,83,121,109,98,111,108,46,115,112,101,99,105
+,101,115,93,0,0,0,0,148,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,2,28,83,96,0,0
+,0,0,41,2,0,0,17,181,4,148,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,108
+,3,2,12,81,97,70,108,169,84,6,0,0,0,100,101,108,101,116,101,0,0,2,28,83,96,0,0,0,0,47,2,0
+,0,2,12,80,97,7,0,0,0,8,0,0,0,103,101,116,32,115,105,122,101,148,68,97,0,0,0,0,0,0,0,0
+,96,0,2,2,255,255,255,255,11,0,130,117,3,2,28,83,96,0,0,0,0,44,2,0,0,10,0,130,104,2,148,68
+,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,113,3,2,28,83,96,0,0,0,0,45,2
+,0,0,10,0,98,31,1,148,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,114,3,2
+,28,83,96,0,0,0,0,46,2,0,0,10,0,129,243,17,237,1,68,97,0,0,0,0,0,0,0,0,96,0,2,2
+,255,255,255,255,11,0,2,116,3,2,28,83,96,0,0,0,0,48,2,0,0,10,0,194,155,1,149,68,97,1,0,255
+,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,119,3,2,28,83,96,0,0,0,0,49,2,0,0,10,0
+,97,244,149,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,120,3,2,28,83,96,0,0
+,0,0,42,2,0,0,17,129,3,149,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,110
+,3,2,28,83,96,0,0,0,0,43,2,0,0,17,53,2,17,237,1,68,97,1,0,1,0,0,0,0,0,96,0,2
+,2,255,255,255,255,11,0,130,111,3,2,16,81,98,166,213,142,245,10,0,0,0,112,97,114,115,101,70,108,111,97,116
+,0,0,0,0,0,0,2,28,83,96,0,0,0,0,168,1,0,0,10,0,66,112,2,150,68,97,1,0,1,0,0,0
+,0,0,96,0,2,2,255,255,255,255,11,0,2,171,2,2,12,81,97,174,9,79,98,4,0,0,0,74,83,79,78,0
+,0,0,0,2,16,81,98,62,71,252,66,9,0,0,0,115,116,114,105,110,103,105,102,121,0,0,0,0,0,0,0,2
+,28,83,96,0,0,0,0,107,1,0,0,10,0,194,219,1,150,68,97,2,0,255,255,0,0,0,0,96,0,2,2,255
+,255,255,255,11,0,130,79,2,2,28,83,96,0,0,0,0,108,1,0,0,10,0,2,114,2,150,68,97,3,0,3,0
+,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,81,2,2,12,81,97,62,176,66,180,7,0,0,0,97,115,85
+,105,110,116,78,0,2,12,81,97,102,69,19,252,6,0,0,0,97,115,73,110,116,78,0,0,2,28,83,96,0,0,0
+,0,231,0,0,0,10,0,66,116,2,17,237,1,68,97,2,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11
+,0,130,137,1,2,28,83,96,0,0,0,0,232,0,0,0,10,0,162,116,2,151,68,97,2,0,255,255,0,0,0,0
+,96,0,2,2,255,255,255,255,11,0,2,139,1,2,28,83,96,0,0,0,0,230,0,0,0,17,117,2,151,68,97,1
+,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,136,1,2,28,83,96,0,0,0,0,233,0,0,0
+,19,125,1,151,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,140,1,2,28,83,96,0
+,0,0,0,234,0,0,0,17,29,5,151,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2
+,142,1,2,28,83,96,0,0,0,0,235,0,0,0,17,81,5,17,237,1,68,97,0,0,255,255,0,0,0,0,96,0
+,2,2,255,255,255,255,11,0,130,143,1,2,28,83,96,0,0,0,0,165,0,0,0,2,20,80,99,7,0,0,0,20
+,0,0,0,103,101,116,32,91,83,121,109,98,111,108,46,115,112,101,99,105,101,115,93,0,0,0,0,145,68,97,0,0
+,0,0,0,0,0,0,96,0,2,2,255,255,255,255,2,28,83,96,0,0,0,0,139,1,0,0,17,217,3,145,68,97
+,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,127,2,2,28,83,96,0,0,0,0,146,1,0
+,0,2,12,80,97,7,0,0,0,8,0,0,0,103,101,116,32,115,105,122,101,145,68,97,0,0,0,0,0,0,0,0
+,96,0,2,2,255,255,255,255,11,0,2,138,2,2,28,83,96,0,0,0,0,143,1,0,0,17,129,3,145,68,97,1
+,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,133,2,2,28,83,96,0,0,0,0,141,1,0,0
+,10,0,130,104,2,145,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,130,2,2,28,83
+,96,0,0,0,0,144,1,0,0,10,0,98,31,1,17,237,1,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255
+,255,255,255,11,0,2,135,2,2,28,83,96,0,0,0,0,145,1,0,0,10,0,129,243,147,68,97,0,0,0,0,0
+,0,0,0,96,0,2,2,255,255,255,255,11,0,130,136,2,2,28,83,96,0,0,0,0,147,1,0,0,10,0,194,155
+,1,147,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,139,2,2,28,83,96,0,0,0
+,0,148,1,0,0,17,189,3,147,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,141,2
+,2,28,83,96,0,0,0,0,149,1,0,0,10,0,97,244,17,237,1,68,97,0,0,0,0,0,0,0,0,96,0,2
+,2,255,255,255,255,11,0,130,142,2,2,28,83,96,0,0,0,0,142,1,0,0,17,105,3,148,68,97,1,0,1,0
+,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,132,2,2,28,83,96,0,0,0,0,140,1,0,0,17,193,4
+,148,68,97,2,0,2,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,129,2,2,12,81,97,246,93,62,203
+,8,0,0,0,117,110,101,115,99,97,112,101,2,28,83,96,0,0,0,0,103,1,0,0,10,0,194,133,2,148,68,97
+,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,73,2,2,28,83,96,0,0,0,0,165,0,0
+,0,2,20,80,99,7,0,0,0,20,0,0,0,103,101,116,32,91,83,121,109,98,111,108,46,115,112,101,99,105,101,115
+,93,0,0,0,0,148,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,2,12,81,97,70,133,169,166
+,7,0,0,0,105,115,65,114,114,97,121,0,2,28,83,96,0,0,0,0,189,0,0,0,10,0,130,136,2,17,237,1
+,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,74,1,2,28,83,96,0,0,0,0,191
+,0,0,0,17,77,3,149,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,77,1,2,28
+,83,96,0,0,0,0,246,2,0,0,17,69,4,149,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255
+,11,0,2,160,4,2,28,83,96,0,0,0,0,166,0,0,0,17,85,2,149,68,97,1,0,255,255,0,0,0,0,96
+,0,2,2,255,255,255,255,11,0,2,40,1,2,12,81,97,70,34,253,174,3,0,0,0,112,111,112,0,0,0,0,0
+,2,12,81,97,214,174,200,64,4,0,0,0,112,117,115,104,0,0,0,0,2,12,81,97,22,45,243,102,5,0,0,0
+,115,104,105,102,116,0,0,0,2,12,81,97,190,193,96,68,7,0,0,0,117,110,115,104,105,102,116,0,2,12,81,97
+,150,27,175,9,6,0,0,0,115,112,108,105,99,101,0,0,2,12,81,97,158,112,174,254,4,0,0,0,102,108,97,116
+,0,0,0,0,2,12,81,97,238,245,156,99,7,0,0,0,102,108,97,116,77,97,112,0,2,28,83,96,0,0,0,0
+,188,0,0,0,10,0,162,36,2,17,237,1,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0
+,2,73,1,2,28,83,96,0,0,0,0,207,2,0,0,10,0,66,153,1,150,68,97,2,0,255,255,0,0,0,0,96
+,0,2,2,255,255,255,255,11,0,130,101,4,2,28,83,96,0,0,0,0,190,0,0,0,10,0,34,154,1,150,68,97
+,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,76,1,2,28,83,96,0,0,0,0,220,2,0
+,0,10,0,226,154,1,150,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,121,4,2,28
+,83,96,0,0,0,0,225,2,0,0,10,0,66,155,1,17,237,1,68,97,1,0,255,255,0,0,0,0,96,0,2,2
+,255,255,255,255,11,0,130,128,4,2,28,83,96,0,0,0,0,241,2,0,0,10,0,226,156,1,151,68,97,1,0,255
+,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,152,4,2,28,83,96,0,0,0,0,201,0,0,0,10,0
+,98,140,2,151,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,92,1,2,28,83,96,0
+,0,0,0,203,0,0,0,10,0,194,140,2,151,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11
+,0,130,95,1,2,28,83,96,0,0,0,0,1,3,0,0,10,0,194,157,1,17,237,1,68,97,0,0,255,255,0,0
+,0,0,96,0,2,2,255,255,255,255,11,0,130,176,4,2,28,83,96,0,0,0,0,2,3,0,0,10,0,34,141,2
+,144,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,178,4,2,28,83,96,0,0,0,0
+,9,3,0,0,10,0,130,141,2,144,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,188
+,4,2,28,83,96,0,0,0,0,3,3,0,0,10,0,2,159,1,144,68,97,2,0,255,255,0,0,0,0,96,0,2
+,2,255,255,255,255,11,0,130,179,4,2,28,83,96,0,0,0,0,180,3,0,0,10,0,194,159,1,17,237,1,68,97
+,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,189,5,2,28,83,96,0,0,0,0,8,3,0
+,0,10,0,226,141,2,145,68,97,2,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,187,4,2,28
+,83,96,0,0,0,0,195,0,0,0,10,0,34,156,1,145,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255
+,255,255,11,0,130,83,1,2,28,83,96,0,0,0,0,199,0,0,0,10,0,130,156,1,145,68,97,1,0,255,255,0
+,0,0,0,96,0,2,2,255,255,255,255,11,0,130,89,1,2,28,83,96,0,0,0,0,236,2,0,0,19,141,1,145
+,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,145,4,2,28,83,96,0,0,0,0,210
+,0,0,0,17,189,3,17,237,1,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,106,1
+,2,28,83,96,0,0,0,0,209,0,0,0,10,0,129,243,147,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255
+,255,255,255,11,0,130,104,1,2,28,83,96,0,0,0,0,211,0,0,0,10,0,97,244,147,68,97,0,0,0,0,0
+,0,0,0,96,0,2,2,255,255,255,255,11,0,130,107,1,2,28,83,96,0,0,0,0,229,2,0,0,10,0,194,155
+,1,147,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,134,4,2,28,83,96,0,0,0
+,0,215,2,0,0,10,0,130,154,1,17,237,1,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11
+,0,130,113,4,2,28,83,96,0,0,0,0,215,0,0,0,10,0,66,142,2,148,68,97,0,0,255,255,0,0,0,0
+,96,0,2,2,255,255,255,255,11,0,130,113,1,2,28,83,96,0,0,0,0,216,0,0,0,10,0,162,142,2,148,68
+,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,115,1,2,28,83,96,0,0,0,0,245,2
+,0,0,10,0,98,157,1,148,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,158,4,2
+,28,83,96,0,0,0,0,211,2,0,0,10,0,194,153,1,17,237,1,68,97,1,0,255,255,0,0,0,0,96,0,2
+,2,255,255,255,255,11,0,130,107,4,2,28,83,96,0,0,0,0,7,3,0,0,10,0,98,159,1,149,68,97,1,0
+,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,185,4,2,28,83,96,0,0,0,0,0,3,0,0,10
+,0,34,158,1,149,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,175,4,2,28,83,96
+,0,0,0,0,251,2,0,0,10,0,130,158,1,149,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255
+,11,0,130,167,4,2,28,83,96,0,0,0,0,237,2,0,0,19,125,1,149,68,97,0,0,255,255,0,0,0,0,96
+,0,2,2,255,255,255,255,11,0,130,146,4,2,28,83,96,0,0,0,0,73,1,0,0,17,41,5,17,237,1,68,97
+,1,0,255,255,2,0,0,0,96,0,2,2,255,255,255,255,2,28,83,96,0,0,0,0,73,1,0,0,17,73,5,151
+,68,97,1,0,255,255,2,0,0,0,96,0,2,2,255,255,255,255,2,28,83,96,0,0,0,0,104,1,0,0,17,49
+,3,151,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,75,2,2,28,83,96,0,0,0
+,0,92,2,0,0,17,165,3,151,68,97,3,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,2,28,83,96,0
+,0,0,0,92,2,0,0,17,173,3,151,68,97,3,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,2,12,81
+,97,150,147,50,102,3,0,0,0,102,111,114,0,0,0,0,0,2,12,81,97,110,249,21,7,6,0,0,0,107,101,121
+,70,111,114,0,0,2,16,81,98,86,163,243,131,13,0,0,0,97,115,121,110,99,73,116,101,114,97,116,111,114,0,0
+,0,2,16,81,98,158,200,48,224,11,0,0,0,104,97,115,73,110,115,116,97,110,99,101,0,0,0,0,0,2,20,81
+,99,238,157,62,231,18,0,0,0,105,115,67,111,110,99,97,116,83,112,114,101,97,100,97,98,108,101,0,0,0,0,0
+,0,2,12,81,97,222,211,9,196,8,0,0,0,105,116,101,114,97,116,111,114,2,12,81,97,14,20,104,219,7,0,0
+,0,115,112,101,99,105,101,115,0,2,16,81,98,54,46,62,3,11,0,0,0,116,111,80,114,105,109,105,116,105,118,101
+,0,0,0,0,0,2,16,81,98,118,113,46,255,11,0,0,0,116,111,83,116,114,105,110,103,84,97,103,0,0,0,0
+,0,2,16,81,98,174,178,97,124,11,0,0,0,117,110,115,99,111,112,97,98,108,101,115,0,0,0,0,0,2,28,83
+,96,0,0,0,0,84,2,0,0,10,0,162,173,2,151,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255
+,255,11,0,2,173,3,2,28,83,96,0,0,0,0,85,2,0,0,10,0,2,174,2,17,237,1,68,97,1,0,255,255
+,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,174,3,2,28,83,96,0,0,0,0,83,2,0,0,17,245,4
+,144,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,171,3,2,16,81,98,38,107,1,191
+,11,0,0,0,100,101,115,99,114,105,112,116,105,111,110,0,0,0,0,0,2,28,83,96,0,0,0,0,86,2,0,0
+,2,16,80,98,7,0,0,0,15,0,0,0,103,101,116,32,100,101,115,99,114,105,112,116,105,111,110,0,144,68,97,0
+,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,176,3,2,28,83,96,0,0,0,0,87,2,0,0
+,10,0,226,25,2,144,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,177,3,2,28,83
+,96,0,0,0,0,88,2,0,0,17,29,5,144,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11
+,0,2,179,3,2,28,83,96,0,0,0,0,89,2,0,0,17,81,5,17,237,1,68,97,0,0,0,0,0,0,0,0
+,96,0,2,2,255,255,255,255,11,0,130,180,3,2,28,83,96,0,0,0,0,92,2,0,0,17,45,5,146,68,97,3
+,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,2,28,83,96,0,0,0,0,141,2,0,0,17,85,5,146,68
+,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,2,4,2,28,83,96,0,0,0,0,144,2
+,0,0,17,129,3,146,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,7,4,2,28,83
+,96,0,0,0,0,146,2,0,0,10,0,130,104,2,146,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255
+,255,11,0,2,10,4,2,28,83,96,0,0,0,0,143,2,0,0,17,105,3,17,237,1,68,97,1,0,1,0,0,0
+,0,0,96,0,2,2,255,255,255,255,11,0,130,5,4,2,28,83,96,0,0,0,0,145,2,0,0,17,193,4,148,68
+,97,2,0,2,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,8,4,2,28,83,96,0,0,0,0,92,2
+,0,0,17,53,5,148,68,97,3,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,2,16,81,98,158,108,245,188
+,9,0,0,0,105,115,73,110,116,101,103,101,114,0,0,0,0,0,0,0,2,12,81,97,174,139,103,228,5,0,0,0
+,105,115,78,97,78,0,0,0,2,16,81,98,246,19,15,91,13,0,0,0,105,115,83,97,102,101,73,110,116,101,103,101
+,114,0,0,0,2,12,81,97,230,166,168,231,8,0,0,0,112,97,114,115,101,73,110,116,2,16,81,98,198,191,98,138
+,9,0,0,0,77,65,88,95,86,65,76,85,69,0,0,0,0,0,0,0,2,16,81,98,238,60,25,190,9,0,0,0
+,77,73,78,95,86,65,76,85,69,0,0,0,0,0,0,0,2,20,81,99,206,84,252,99,17,0,0,0,78,69,71,65
+,84,73,86,69,95,73,78,70,73,78,73,84,89,0,0,0,0,0,0,0,2,20,81,99,198,126,47,65,17,0,0,0
+,80,79,83,73,84,73,86,69,95,73,78,70,73,78,73,84,89,0,0,0,0,0,0,0,2,16,81,98,254,177,104,180
+,16,0,0,0,77,65,88,95,83,65,70,69,95,73,78,84,69,71,69,82,2,16,81,98,134,177,127,72,16,0,0,0
+,77,73,78,95,83,65,70,69,95,73,78,84,69,71,69,82,2,12,81,97,222,36,245,206,7,0,0,0,69,80,83,73
+,76,79,78,0,2,28,83,96,0,0,0,0,164,1,0,0,10,0,98,185,1,148,68,97,1,0,1,0,0,0,0,0
+,96,0,2,2,255,255,255,255,11,0,2,165,2,2,28,83,96,0,0,0,0,165,1,0,0,10,0,130,191,2,148,68
+,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,166,2,2,28,83,96,0,0,0,0,166,1
+,0,0,10,0,2,192,2,17,237,1,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,168
+,2,2,28,83,96,0,0,0,0,167,1,0,0,10,0,98,192,2,150,68,97,1,0,1,0,0,0,0,0,96,0,2
+,2,255,255,255,255,11,0,130,169,2,2,28,83,96,0,0,0,0,169,1,0,0,10,0,226,192,2,150,68,97,2,0
+,2,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,172,2,2,8,89,96,255,255,255,255,255,255,239,127,2
+,8,89,96,1,0,0,0,0,0,0,0,2,8,89,96,0,0,0,0,0,0,240,255,2,8,89,96,255,255,255,255,255
+,255,63,67,2,8,89,96,255,255,255,255,255,255,63,195,2,8,89,96,0,0,0,0,0,0,176,60,2,28,83,96,0
+,0,0,0,163,1,0,0,17,45,4,150,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130
+,163,2,2,16,81,98,54,88,145,49,13,0,0,0,116,111,69,120,112,111,110,101,110,116,105,97,108,0,0,0,2,12
+,81,97,54,101,109,137,7,0,0,0,116,111,70,105,120,101,100,0,2,16,81,98,94,113,117,238,11,0,0,0,116,111
+,80,114,101,99,105,115,105,111,110,0,0,0,0,0,2,28,83,96,0,0,0,0,171,1,0,0,10,0,162,203,2,17
+,237,1,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,175,2,2,28,83,96,0,0,0
+,0,172,1,0,0,10,0,34,204,2,151,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2
+,177,2,2,28,83,96,0,0,0,0,174,1,0,0,10,0,130,204,2,151,68,97,1,0,255,255,0,0,0,0,96,0
+,2,2,255,255,255,255,11,0,2,180,2,2,28,83,96,0,0,0,0,175,1,0,0,17,29,5,151,68,97,1,0,255
+,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,181,2,2,28,83,96,0,0,0,0,176,1,0,0,17,81
+,5,17,237,1,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,183,2,2,28,83,96,0
+,0,0,0,173,1,0,0,19,125,1,144,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130
+,178,2,2,28,83,96,0,0,0,0,73,1,0,0,17,125,4,144,68,97,1,0,255,255,2,0,0,0,96,0,2,2
+,255,255,255,255,2,12,81,97,254,182,15,223,6,0,0,0,101,115,99,97,112,101,0,0,2,28,83,96,0,0,0,0
+,102,1,0,0,10,0,34,211,2,144,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,72
+,2,2,28,83,96,0,0,0,0,92,2,0,0,17,57,5,144,68,97,3,0,255,255,0,0,0,0,96,0,2,2,255
+,255,255,255,2,28,83,96,0,0,0,0,92,2,0,0,17,125,2,144,68,97,3,0,255,255,0,0,0,0,96,0,2
+,2,255,255,255,255,2,12,81,97,54,87,192,133,7,0,0,0,82,101,102,108,101,99,116,0,2,28,83,96,0,0,0
+,0,91,3,0,0,17,105,3,17,237,1,68,97,2,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130
+,55,5,2,28,83,96,0,0,0,0,16,2,0,0,17,109,3,145,68,97,2,0,2,0,0,0,0,0,96,0,2,2
+,255,255,255,255,11,0,2,71,3,2,28,83,96,0,0,0,0,89,3,0,0,17,113,3,145,68,97,1,0,1,0,0
+,0,0,0,96,0,2,2,255,255,255,255,11,0,130,52,5,2,28,83,96,0,0,0,0,17,2,0,0,17,129,3,145
+,68,97,2,0,2,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,72,3,2,28,83,96,0,0,0,0,87
+,3,0,0,17,177,3,17,237,1,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,49,5
+,2,28,83,96,0,0,0,0,18,2,0,0,17,81,4,146,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255
+,255,255,11,0,2,74,3,2,28,83,96,0,0,0,0,88,3,0,0,17,93,4,146,68,97,1,0,1,0,0,0,0
+,0,96,0,2,2,255,255,255,255,11,0,2,51,5,2,28,83,96,0,0,0,0,19,2,0,0,17,193,4,146,68,97
+,3,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,75,3,2,28,83,96,0,0,0,0,90,3,0
+,0,17,201,4,17,237,1,68,97,2,0,2,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,54,5,2,28
+,83,96,0,0,0,0,15,2,0,0,17,225,2,147,68,97,3,0,3,0,0,0,0,0,96,0,2,2,255,255,255,255
+,11,0,130,69,3,2,28,83,96,0,0,0,0,92,3,0,0,17,229,2,147,68,97,2,0,2,0,0,0,0,0,96
+,0,2,2,255,255,255,255,11,0,2,57,5,2,28,83,96,0,0,0,0,13,2,0,0,17,69,2,147,68,97,3,0
+,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,66,3,2,28,83,96,0,0,0,0,14,2,0,0,17
+,205,2,17,237,1,68,97,2,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,68,3,2,28,83,96
+,0,0,0,0,92,2,0,0,17,49,5,148,68,97,3,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,2,16
+,81,98,86,6,127,142,9,0,0,0,114,101,118,111,99,97,98,108,101,0,0,0,0,0,0,0,2,28,83,96,0,0
+,0,0,83,3,0,0,10,0,194,226,2,148,68,97,2,0,2,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0
+,130,43,5,2,28,83,96,0,0,0,0,76,3,0,0,17,117,4,148,68,97,2,0,2,0,0,0,0,0,64,0,2
+,2,255,255,255,255,11,0,2,33,5,2,16,81,98,134,75,120,50,9,0,0,0,100,101,99,111,100,101,85,82,73,0
+,0,0,0,0,0,0,2,28,83,96,0,0,0,0,98,1,0,0,10,0,2,229,2,148,68,97,1,0,255,255,0,0
+,0,0,96,0,2,2,255,255,255,255,11,0,2,66,2,2,12,81,97,142,255,68,40,4,0,0,0,77,97,116,104,0
+,0,0,0,2,12,81,97,254,143,107,228,3,0,0,0,97,98,115,0,0,0,0,0,2,12,81,97,150,204,171,204,4
+,0,0,0,97,99,111,115,0,0,0,0,2,12,81,97,174,216,250,214,5,0,0,0,97,99,111,115,104,0,0,0,2
+,12,81,97,54,88,98,97,4,0,0,0,97,115,105,110,0,0,0,0,2,12,81,97,230,101,254,74,5,0,0,0,97
+,115,105,110,104,0,0,0,2,12,81,97,182,136,6,47,4,0,0,0,97,116,97,110,0,0,0,0,2,12,81,97,190
+,97,152,11,5,0,0,0,97,116,97,110,104,0,0,0,2,12,81,97,38,28,142,232,5,0,0,0,97,116,97,110,50
+,0,0,0,2,12,81,97,22,127,202,212,4,0,0,0,99,101,105,108,0,0,0,0,2,12,81,97,158,131,238,169,4
+,0,0,0,99,98,114,116,0,0,0,0,2,12,81,97,230,208,184,148,5,0,0,0,101,120,112,109,49,0,0,0,2
+,12,81,97,166,218,154,194,5,0,0,0,99,108,122,51,50,0,0,0,2,12,81,97,14,247,238,121,3,0,0,0,99
+,111,115,0,0,0,0,0,2,12,81,97,182,39,108,102,4,0,0,0,99,111,115,104,0,0,0,0,2,12,81,97,182
+,149,161,133,3,0,0,0,101,120,112,0,0,0,0,0,2,12,81,97,14,140,44,24,5,0,0,0,102,108,111,111,114
+,0,0,0,2,12,81,97,230,42,222,70,6,0,0,0,102,114,111,117,110,100,0,0,2,12,81,97,174,165,178,246,5
+,0,0,0,104,121,112,111,116,0,0,0,2,12,81,97,70,57,104,105,4,0,0,0,105,109,117,108,0,0,0,0,2
+,12,81,97,206,31,104,60,5,0,0,0,108,111,103,49,112,0,0,0,2,12,81,97,206,168,129,151,4,0,0,0,108
+,111,103,50,0,0,0,0,2,12,81,97,110,254,115,43,5,0,0,0,108,111,103,49,48,0,0,0,2,12,81,97,46
+,20,91,54,3,0,0,0,109,97,120,0,0,0,0,0,2,12,81,97,94,156,121,101,3,0,0,0,109,105,110,0,0
+,0,0,0,2,12,81,97,126,182,16,121,3,0,0,0,112,111,119,0,0,0,0,0,2,12,81,97,134,249,9,173,6
+,0,0,0,114,97,110,100,111,109,0,0,2,12,81,97,110,70,200,135,5,0,0,0,114,111,117,110,100,0,0,0,2
+,12,81,97,54,255,103,15,4,0,0,0,115,105,103,110,0,0,0,0,2,12,81,97,70,81,66,191,3,0,0,0,115
+,105,110,0,0,0,0,0,2,12,81,97,230,242,253,203,4,0,0,0,115,105,110,104,0,0,0,0,2,12,81,97,222
+,39,117,128,4,0,0,0,115,113,114,116,0,0,0,0,2,12,81,97,174,103,86,41,3,0,0,0,116,97,110,0,0
+,0,0,0,2,12,81,97,22,188,149,178,4,0,0,0,116,97,110,104,0,0,0,0,2,12,81,97,86,230,230,11,5
+,0,0,0,116,114,117,110,99,0,0,0,2,12,81,97,70,117,189,155,1,0,0,0,69,0,0,0,0,0,0,0,2
+,12,81,97,126,241,60,137,4,0,0,0,76,78,49,48,0,0,0,0,2,12,81,97,110,135,126,136,3,0,0,0,76
+,78,50,0,0,0,0,0,2,12,81,97,182,18,154,154,6,0,0,0,76,79,71,49,48,69,0,0,2,12,81,97,102
+,176,19,169,5,0,0,0,76,79,71,50,69,0,0,0,2,12,81,97,38,101,26,71,2,0,0,0,80,73,0,0,0
+,0,0,0,2,12,81,97,206,171,62,73,7,0,0,0,83,81,82,84,49,95,50,0,2,12,81,97,254,57,86,194,5
+,0,0,0,83,81,82,84,50,0,0,0,2,28,83,96,0,0,0,0,49,3,0,0,10,0,66,232,2,17,237,1,68
+,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,248,4,2,28,83,96,0,0,0,0,50,3
+,0,0,10,0,162,232,2,150,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,250,4,2
+,28,83,96,0,0,0,0,52,3,0,0,10,0,2,233,2,150,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255
+,255,255,255,11,0,2,253,4,2,28,83,96,0,0,0,0,51,3,0,0,10,0,98,233,2,150,68,97,2,0,2,0
+,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,251,4,2,28,83,96,0,0,0,0,153,1,0,0,10,0,194
+,233,2,17,237,1,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,148,2,2,28,83,96
+,0,0,0,0,53,3,0,0,10,0,34,234,2,151,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255
+,11,0,130,254,4,2,28,83,96,0,0,0,0,58,3,0,0,10,0,130,234,2,151,68,97,1,0,1,0,0,0,0
+,0,96,0,2,2,255,255,255,255,11,0,2,6,5,2,28,83,96,0,0,0,0,54,3,0,0,10,0,226,234,2,151
+,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,0,5,2,28,83,96,0,0,0,0,55
+,3,0,0,10,0,66,235,2,17,237,1,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130
+,1,5,2,28,83,96,0,0,0,0,56,3,0,0,10,0,162,235,2,144,68,97,1,0,1,0,0,0,0,0,96,0
+,2,2,255,255,255,255,11,0,2,3,5,2,28,83,96,0,0,0,0,57,3,0,0,10,0,2,236,2,144,68,97,1
+,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,4,5,2,28,83,96,0,0,0,0,154,1,0,0
+,10,0,98,236,2,144,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,150,2,2,28,83
+,96,0,0,0,0,59,3,0,0,10,0,194,236,2,17,237,1,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255
+,255,255,255,11,0,130,7,5,2,28,83,96,0,0,0,0,70,3,0,0,10,0,34,237,2,145,68,97,2,0,255,255
+,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,24,5,2,28,83,96,0,0,0,0,155,1,0,0,10,0,130
+,237,2,145,68,97,2,0,2,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,151,2,2,28,83,96,0,0
+,0,0,60,3,0,0,10,0,226,27,1,145,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0
+,2,9,5,2,28,83,96,0,0,0,0,61,3,0,0,10,0,226,237,2,17,237,1,68,97,1,0,1,0,0,0,0
+,0,96,0,2,2,255,255,255,255,11,0,130,10,5,2,28,83,96,0,0,0,0,63,3,0,0,10,0,66,238,2,146
+,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,13,5,2,28,83,96,0,0,0,0,62
+,3,0,0,10,0,162,238,2,146,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,12,5
+,2,28,83,96,0,0,0,0,156,1,0,0,10,0,2,239,2,146,68,97,2,0,255,255,0,0,0,0,96,0,2,2
+,255,255,255,255,11,0,2,153,2,2,28,83,96,0,0,0,0,157,1,0,0,10,0,98,239,2,17,237,1,68,97,2
+,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,154,2,2,28,83,96,0,0,0,0,158,1,0,0
+,10,0,194,239,2,147,68,97,2,0,2,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,156,2,2,28,83
+,96,0,0,0,0,159,1,0,0,10,0,34,240,2,147,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255
+,255,11,0,130,157,2,2,28,83,96,0,0,0,0,160,1,0,0,10,0,130,240,2,147,68,97,1,0,1,0,0,0
+,0,0,96,0,2,2,255,255,255,255,11,0,2,159,2,2,28,83,96,0,0,0,0,65,3,0,0,10,0,226,240,2
+,17,237,1,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,16,5,2,28,83,96,0,0
+,0,0,64,3,0,0,10,0,66,241,2,148,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0
+,2,15,5,2,28,83,96,0,0,0,0,66,3,0,0,10,0,162,241,2,148,68,97,1,0,1,0,0,0,0,0,96
+,0,2,2,255,255,255,255,11,0,2,18,5,2,28,83,96,0,0,0,0,67,3,0,0,10,0,2,242,2,148,68,97
+,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,19,5,2,28,83,96,0,0,0,0,68,3,0
+,0,10,0,98,242,2,17,237,1,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,21,5
+,2,28,83,96,0,0,0,0,69,3,0,0,10,0,194,242,2,149,68,97,1,0,1,0,0,0,0,0,96,0,2,2
+,255,255,255,255,11,0,130,22,5,2,28,83,96,0,0,0,0,161,1,0,0,10,0,34,243,2,149,68,97,1,0,1
+,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,160,2,2,8,89,96,105,87,20,139,10,191,5,64,2,8
+,89,96,22,85,181,187,177,107,2,64,2,8,89,96,239,57,250,254,66,46,230,63,2,8,89,96,14,229,38,21,123,203
+,219,63,2,8,89,96,254,130,43,101,71,21,247,63,2,8,89,96,24,45,68,84,251,33,9,64,2,8,89,96,205,59
+,127,102,158,160,230,63,2,8,89,96,205,59,127,102,158,160,246,63,2,28,83,96,0,0,0,0,152,1,0,0,10,0
+,194,230,2,149,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,147,2,2,28,83,96,0
+,0,0,0,46,3,0,0,10,0,34,231,2,17,237,1,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255
+,255,11,0,2,244,4,2,28,83,96,0,0,0,0,47,3,0,0,10,0,130,231,2,150,68,97,1,0,1,0,0,0
+,0,0,96,0,2,2,255,255,255,255,11,0,130,245,4,2,28,83,96,0,0,0,0,48,3,0,0,10,0,226,231,2
+,150,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,247,4,2,28,83,96,0,0,0,0
+,106,1,0,0,10,0,2,192,2,150,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,78
+,2,2,28,83,96,0,0,0,0,147,2,0,0,17,93,5,17,237,1,68,97,0,0,255,255,0,0,0,0,96,0,2
+,2,255,255,255,255,11,0,130,11,4,2,28,83,96,0,0,0,0,150,2,0,0,10,0,130,104,2,151,68,97,1,0
+,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,16,4,2,28,83,96,0,0,0,0,148,2,0,0,17
+,129,3,151,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,13,4,2,28,83,96,0,0
+,0,0,149,2,0,0,17,53,2,151,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,14
+,4,2,28,83,96,0,0,0,0,16,3,0,0,17,137,2,17,237,1,68,97,1,0,255,255,0,0,0,0,96,0,2
+,2,255,255,255,255,11,0,2,199,4,2,28,83,96,0,0,0,0,236,0,0,0,17,29,5,144,68,97,0,0,0,0
+,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,145,1,2,28,83,96,0,0,0,0,237,0,0,0,17,81,5
+,144,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,146,1,2,12,81,97,46,173,249,6
+,6,0,0,0,105,115,86,105,101,119,0,0,2,28,83,96,0,0,0,0,165,0,0,0,2,20,80,99,7,0,0,0
+,20,0,0,0,103,101,116,32,91,83,121,109,98,111,108,46,115,112,101,99,105,101,115,93,0,0,0,0,144,68,97,0
+,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,2,28,83,96,0,0,0,0,220,0,0,0,10,0,34,30,3
+,144,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,121,1,2,28,83,96,0,0,0,0
+,217,0,0,0,17,93,2,17,237,1,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,116
+,1,2,28,83,96,0,0,0,0,219,0,0,0,2,16,80,98,7,0,0,0,14,0,0,0,103,101,116,32,98,121,116
+,101,76,101,110,103,116,104,0,0,145,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,119
+,1,2,28,83,96,0,0,0,0,221,0,0,0,10,0,2,159,1,145,68,97,2,0,2,0,0,0,0,0,96,0,2
+,2,255,255,255,255,11,0,130,122,1,2,28,83,96,0,0,0,0,218,0,0,0,2,28,81,101,6,154,141,221,38,0
+,0,0,97,114,114,97,121,66,117,102,102,101,114,67,111,110,115,116,114,117,99,116,111,114,95,68,111,78,111,116,73,110
+,105,116,105,97,108,105,122,101,0,0,145,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2
+,118,1,2,28,83,96,0,0,0,0,165,0,0,0,2,20,81,99,126,106,253,57,22,0,0,0,91,83,121,109,98,111
+,108,46,97,115,121,110,99,73,116,101,114,97,116,111,114,93,0,0,145,68,97,0,0,0,0,0,0,0,0,96,0,2
+,2,255,255,255,255,2,28,83,96,0,0,0,0,170,2,0,0,17,13,4,145,68,97,1,0,1,0,0,0,0,0,96
+,0,2,2,255,255,255,255,11,0,2,46,4,2,28,83,96,0,0,0,0,172,2,0,0,17,157,4,17,237,1,68,97
+,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,49,4,2,28,83,96,0,0,0,0,171,2,0
+,0,17,17,5,146,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,47,4,2,20,81,99
+,214,152,246,232,24,0,0,0,65,115,121,110,99,45,102,114,111,109,45,83,121,110,99,32,73,116,101,114,97,116,111,114
+,2,28,83,96,0,0,0,0,228,0,0,0,73,146,68,97,1,0,1,0,0,0,0,0,0,0,0,2,255,255,255,255
+,2,28,83,96,0,0,0,0,229,0,0,0,73,146,68,97,1,0,1,0,0,0,0,0,0,0,0,2,255,255,255,255
+,2,28,83,96,0,0,0,0,96,1,0,0,2,16,81,98,62,79,56,205,13,0,0,0,65,115,121,110,99,70,117,110
+,99,116,105,111,110,0,0,0,146,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,63,2
+,10,0,34,45,3,2,28,83,96,0,0,0,0,158,2,0,0,2,20,81,99,70,252,63,156,22,0,0,0,65,115,121
+,110,99,71,101,110,101,114,97,116,111,114,70,117,110,99,116,105,111,110,0,0,146,68,97,1,0,255,255,0,0,0,0
+,96,0,2,2,255,255,255,255,11,0,2,28,4,2,28,83,96,0,0,0,0,161,2,0,0,148,146,68,97,1,0,255
+,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,32,4,2,16,81,98,46,194,176,111,14,0,0,0,65,115
+,121,110,99,71,101,110,101,114,97,116,111,114,0,0,2,28,83,96,0,0,0,0,159,2,0,0,17,13,4,17,237,1
+,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,29,4,2,28,83,96,0,0,0,0,160
+,2,0,0,17,157,4,147,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,31,4,10,0
+,130,46,3,2,28,83,96,0,0,0,0,173,2,0,0,73,147,68,97,1,0,1,0,0,0,0,0,0,0,0,2,255
+,255,255,255,2,28,83,96,0,0,0,0,165,2,0,0,73,147,68,97,1,0,1,0,0,0,0,0,0,0,0,2,255
+,255,255,255,2,28,83,96,0,0,0,0,164,2,0,0,73,147,68,97,1,0,1,0,0,0,0,0,0,0,0,2,255
+,255,255,255,2,28,83,96,0,0,0,0,166,2,0,0,73,147,68,97,1,0,1,0,0,0,0,0,0,0,0,2,255
+,255,255,255,2,28,83,96,0,0,0,0,169,2,0,0,73,147,68,97,1,0,1,0,0,0,0,0,0,0,0,2,255
+,255,255,255,2,28,83,96,0,0,0,0,167,2,0,0,73,147,68,97,1,0,1,0,0,0,0,0,0,0,0,2,255
+,255,255,255,2,28,83,96,0,0,0,0,168,2,0,0,73,147,68,97,1,0,1,0,0,0,0,0,0,0,0,2,255
+,255,255,255,2,12,81,97,134,30,152,201,4,0,0,0,108,111,97,100,0,0,0,0,2,12,81,97,246,70,172,22,5
+,0,0,0,115,116,111,114,101,0,0,0,2,12,81,97,238,244,181,40,3,0,0,0,97,110,100,0,0,0,0,0,2
+,12,81,97,62,188,21,12,2,0,0,0,111,114,0,0,0,0,0,0,2,12,81,97,62,92,203,90,3,0,0,0,120
+,111,114,0,0,0,0,0,2,12,81,97,126,23,12,254,8,0,0,0,101,120,99,104,97,110,103,101,2,16,81,98,102
+,99,56,221,15,0,0,0,99,111,109,112,97,114,101,69,120,99,104,97,110,103,101,0,2,16,81,98,22,183,32,153,10
+,0,0,0,105,115,76,111,99,107,70,114,101,101,0,0,0,0,0,0,2,12,81,97,246,146,38,65,4,0,0,0,119
+,97,105,116,0,0,0,0,2,12,81,97,46,241,219,249,4,0,0,0,119,97,107,101,0,0,0,0,2,12,81,97,78
+,17,15,30,6,0,0,0,110,111,116,105,102,121,0,0,2,28,83,96,0,0,0,0,60,2,0,0,10,0,34,57,3
+,147,68,97,3,0,3,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,137,3,2,28,83,96,0,0,0,0
+,61,2,0,0,10,0,130,57,3,147,68,97,3,0,3,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,138
+,3,2,28,83,96,0,0,0,0,62,2,0,0,10,0,226,57,3,17,237,1,68,97,3,0,3,0,0,0,0,0,96
+,0,2,2,255,255,255,255,11,0,2,140,3,2,28,83,96,0,0,0,0,56,2,0,0,10,0,66,58,3,149,68,97
+,3,0,3,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,131,3,2,28,83,96,0,0,0,0,57,2,0
+,0,10,0,162,58,3,149,68,97,4,0,4,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,132,3,2,28
+,83,96,0,0,0,0,64,2,0,0,10,0,34,59,3,149,68,97,1,0,1,0,0,0,0,0,96,0,2,2,255,255
+,255,255,11,0,2,143,3,2,28,83,96,0,0,0,0,65,2,0,0,10,0,162,59,3,17,237,1,68,97,4,0,4
+,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,144,3,2,28,83,96,0,0,0,0,66,2,0,0,10,0
+,2,60,3,150,68,97,3,0,3,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,146,3,2,28,83,96,0
+,0,0,0,63,2,0,0,10,0,98,60,3,150,68,97,3,0,3,0,0,0,0,0,96,0,2,2,255,255,255,255,11
+,0,130,141,3,2,28,83,96,0,0,0,0,54,2,0,0,10,0,98,56,3,150,68,97,2,0,2,0,0,0,0,0
+,96,0,2,2,255,255,255,255,11,0,2,128,3,2,28,83,96,0,0,0,0,55,2,0,0,10,0,194,56,3,17,237
+,1,68,97,3,0,3,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,129,3,2,28,83,96,0,0,0,0
+,58,2,0,0,17,53,2,151,68,97,3,0,3,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,134,3,2
+,28,83,96,0,0,0,0,59,2,0,0,19,81,3,151,68,97,3,0,3,0,0,0,0,0,96,0,2,2,255,255,255
+,255,11,0,130,135,3,2,28,83,96,0,0,0,0,78,0,0,0,73,151,68,97,0,0,255,255,0,0,0,0,96,0
+,2,2,255,255,255,255,11,0,1,164,2,28,83,96,0,0,0,0,77,0,0,0,73,151,68,97,0,0,255,255,0,0
+,0,0,96,0,2,2,255,255,255,255,11,0,129,162,2,28,83,96,0,0,0,0,205,2,0,0,73,151,68,97,1,0
+,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,98,4,2,28,83,96,0,0,0,0,206,2,0,0,73
+,151,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,100,4,2,28,83,96,0,0,0,0
+,164,0,0,0,2,12,81,97,54,236,202,245,8,0,0,0,67,97,108,108,83,105,116,101,17,237,1,68,97,0,0,255
+,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,37,1,2,16,81,98,214,10,151,212,15,0,0,0,103,101
+,116,67,111,108,117,109,110,78,117,109,98,101,114,0,2,16,81,98,134,247,239,146,13,0,0,0,103,101,116,69,118,97
+,108,79,114,105,103,105,110,0,0,0,2,16,81,98,158,123,177,28,11,0,0,0,103,101,116,70,105,108,101,78,97,109
+,101,0,0,0,0,0,2,16,81,98,246,234,242,176,11,0,0,0,103,101,116,70,117,110,99,116,105,111,110,0,0,0
+,0,0,2,16,81,98,54,106,143,238,15,0,0,0,103,101,116,70,117,110,99,116,105,111,110,78,97,109,101,0,2,16
+,81,98,214,113,42,155,13,0,0,0,103,101,116,76,105,110,101,78,117,109,98,101,114,0,0,0,2,16,81,98,118,49
+,45,135,13,0,0,0,103,101,116,77,101,116,104,111,100,78,97,109,101,0,0,0,2,16,81,98,214,84,68,162,11,0
+,0,0,103,101,116,80,111,115,105,116,105,111,110,0,0,0,0,0,2,16,81,98,222,119,165,187,15,0,0,0,103,101
+,116,80,114,111,109,105,115,101,73,110,100,101,120,0,2,20,81,99,62,209,130,164,24,0,0,0,103,101,116,83,99,114
+,105,112,116,78,97,109,101,79,114,83,111,117,114,99,101,85,82,76,2,12,81,97,46,151,14,104,7,0,0,0,103,101
+,116,84,104,105,115,0,2,16,81,98,70,254,189,232,11,0,0,0,103,101,116,84,121,112,101,78,97,109,101,0,0,0
+,0,0,2,12,81,97,22,66,30,193,7,0,0,0,105,115,65,115,121,110,99,0,2,16,81,98,214,113,134,176,13,0
+,0,0,105,115,67,111,110,115,116,114,117,99,116,111,114,0,0,0,2,12,81,97,22,31,229,145,6,0,0,0,105,115
+,69,118,97,108,0,0,2,12,81,97,150,178,20,90,8,0,0,0,105,115,78,97,116,105,118,101,2,16,81,98,86,133
+,89,54,12,0,0,0,105,115,80,114,111,109,105,115,101,65,108,108,0,0,0,0,2,16,81,98,166,79,160,3,10,0
+,0,0,105,115,84,111,112,108,101,118,101,108,0,0,0,0,0,0,2,28,83,96,0,0,0,0,241,0,0,0,10,0
+,98,78,3,144,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,152,1,2,28,83,96,0
+,0,0,0,242,0,0,0,10,0,226,78,3,144,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11
+,0,2,154,1,2,28,83,96,0,0,0,0,243,0,0,0,10,0,98,79,3,144,68,97,0,0,0,0,0,0,0,0
+,96,0,2,2,255,255,255,255,11,0,130,155,1,2,28,83,96,0,0,0,0,244,0,0,0,10,0,226,79,3,17,237
+,1,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,157,1,2,28,83,96,0,0,0,0
+,245,0,0,0,10,0,98,80,3,145,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,158
+,1,2,28,83,96,0,0,0,0,246,0,0,0,10,0,226,80,3,145,68,97,0,0,0,0,0,0,0,0,96,0,2
+,2,255,255,255,255,11,0,2,160,1,2,28,83,96,0,0,0,0,247,0,0,0,10,0,98,81,3,145,68,97,0,0
+,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,161,1,2,28,83,96,0,0,0,0,248,0,0,0,10
+,0,2,82,3,17,237,1,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,163,1,2,28
+,83,96,0,0,0,0,249,0,0,0,10,0,98,82,3,146,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255
+,255,255,11,0,130,164,1,2,28,83,96,0,0,0,0,250,0,0,0,10,0,226,82,3,146,68,97,0,0,0,0,0
+,0,0,0,96,0,2,2,255,255,255,255,11,0,2,166,1,2,28,83,96,0,0,0,0,251,0,0,0,10,0,66,83
+,3,146,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,167,1,2,28,83,96,0,0,0
+,0,252,0,0,0,10,0,194,83,3,17,237,1,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11
+,0,2,169,1,2,28,83,96,0,0,0,0,253,0,0,0,10,0,34,84,3,147,68,97,0,0,0,0,0,0,0,0
+,96,0,2,2,255,255,255,255,11,0,130,170,1,2,28,83,96,0,0,0,0,254,0,0,0,10,0,130,84,3,147,68
+,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,172,1,2,28,83,96,0,0,0,0,255,0
+,0,0,10,0,2,85,3,147,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,173,1,2
+,28,83,96,0,0,0,0,0,1,0,0,17,29,5,17,237,1,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255
+,255,255,255,11,0,2,175,1,2,28,83,96,0,0,0,0,238,0,0,0,10,0,226,76,3,148,68,97,0,0,0,0
+,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,148,1,2,28,83,96,0,0,0,0,239,0,0,0,10,0,98
+,77,3,148,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,149,1,2,28,83,96,0,0
+,0,0,240,0,0,0,10,0,226,77,3,148,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0
+,2,151,1,2,28,83,96,0,0,0,0,162,0,0,0,73,148,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255
+,255,255,255,2,20,81,99,206,34,72,164,22,0,0,0,105,115,84,114,97,99,101,67,97,116,101,103,111,114,121,69,110
+,97,98,108,101,100,0,0,2,28,83,96,0,0,0,0,195,2,0,0,10,0,2,103,3,17,237,1,68,97,1,0,1
+,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,83,4,2,28,83,96,0,0,0,0,196,2,0,0,10,0
+,194,29,1,149,68,97,5,0,5,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,85,4,2,20,81,99,70
+,128,70,227,19,0,0,0,73,110,116,101,114,110,97,108,80,97,99,107,101,100,65,114,114,97,121,0,0,0,0,0,2
+,20,81,99,142,67,231,167,19,0,0,0,99,114,101,97,116,101,80,114,105,118,97,116,101,83,121,109,98,111,108,0,0
+,0,0,0,2,16,81,98,94,234,35,209,11,0,0,0,117,110,99,117,114,114,121,84,104,105,115,0,0,0,0,0,2
+,20,81,99,166,236,157,95,20,0,0,0,109,97,114,107,80,114,111,109,105,115,101,65,115,72,97,110,100,108,101,100,0
+,0,0,0,2,16,81,98,118,244,251,0,12,0,0,0,112,114,111,109,105,115,101,83,116,97,116,101,0,0,0,0,2
+,16,81,98,230,84,0,161,16,0,0,0,107,80,82,79,77,73,83,69,95,80,69,78,68,73,78,71,2,20,81,99,126
+,172,90,60,18,0,0,0,107,80,82,79,77,73,83,69,95,70,85,76,70,73,76,76,69,68,0,0,0,0,0,0,2
+,20,81,99,6,213,166,68,17,0,0,0,107,80,82,79,77,73,83,69,95,82,69,74,69,67,84,69,68,0,0,0,0
+,0,0,0,2,16,81,98,206,93,1,28,13,0,0,0,99,114,101,97,116,101,80,114,111,109,105,115,101,0,0,0,2
+,16,81,98,86,217,40,151,13,0,0,0,114,101,106,101,99,116,80,114,111,109,105,115,101,0,0,0,2,16,81,98,126
+,20,168,171,14,0,0,0,114,101,115,111,108,118,101,80,114,111,109,105,115,101,0,0,2,16,81,98,254,206,94,190,9
+,0,0,0,105,115,80,114,111,109,105,115,101,0,0,0,0,0,0,0,2,28,83,96,0,0,0,0,42,3,0,0,10
+,0,194,107,3,149,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,238,4,2,28,83,96
+,0,0,0,0,10,2,0,0,73,149,68,97,1,0,1,0,0,0,0,0,64,0,2,2,255,255,255,255,11,0,2,62
+,3,2,28,83,96,0,0,0,0,11,2,0,0,73,149,68,97,2,0,2,0,0,0,0,0,64,0,2,2,255,255,255
+,255,11,0,130,63,3,2,28,83,96,0,0,0,0,12,2,0,0,73,149,68,97,2,0,2,0,0,0,0,0,64,0
+,2,2,255,255,255,255,11,0,2,65,3,2,28,83,96,0,0,0,0,245,1,0,0,73,17,237,1,68,97,1,0,255
+,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,30,3,2,28,83,96,0,0,0,0,185,0,0,0,10,0
+,98,105,3,150,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,68,1,2,28,83,96,0
+,0,0,0,40,3,0,0,10,0,2,106,3,150,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11
+,0,2,235,4,2,28,83,96,0,0,0,0,81,1,0,0,10,0,162,106,3,150,68,97,1,0,255,255,0,0,0,0
+,96,0,2,2,255,255,255,255,11,0,130,40,2,2,28,83,96,0,0,0,0,41,3,0,0,10,0,34,107,3,17,237
+,1,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,236,4,2,28,83,96,0,0,0,0
+,162,0,0,0,17,73,2,151,68,97,0,0,0,0,2,0,0,0,64,0,2,2,255,255,255,255,2,28,83,96,0,0
+,0,0,92,1,0,0,2,20,81,99,14,29,1,153,17,0,0,0,71,101,110,101,114,97,116,111,114,70,117,110,99,116
+,105,111,110,0,0,0,0,0,0,0,151,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2
+,57,2,10,0,162,121,3,2,28,83,96,0,0,0,0,165,0,0,0,10,0,130,88,2,151,68,97,0,0,0,0,0
+,0,0,0,96,0,2,2,255,255,255,255,2,28,83,96,0,0,0,0,95,1,0,0,17,17,5,151,68,97,1,0,255
+,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,61,2,2,28,83,96,0,0,0,0,93,1,0,0,17,13
+,4,17,237,1,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,130,58,2,2,28,83,96,0
+,0,0,0,94,1,0,0,17,157,4,144,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2
+,60,2,2,28,83,96,0,0,0,0,212,0,0,0,151,144,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255
+,255,255,11,0,2,109,1,2,28,83,96,0,0,0,0,162,0,0,0,17,97,2,144,68,97,0,0,0,0,0,0,0
+,0,64,0,2,2,255,255,255,255,2,28,83,96,0,0,0,0,150,1,0,0,151,144,68,97,0,0,0,0,0,0,0
+,0,96,0,2,2,255,255,255,255,11,0,2,144,2,2,28,83,96,0,0,0,0,50,2,0,0,151,144,68,97,0,0
+,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,122,3,2,16,81,98,14,70,22,136,15,0,0,0,83
+,116,114,105,110,103,32,73,116,101,114,97,116,111,114,0,2,28,83,96,0,0,0,0,142,3,0,0,17,13,4,17,237
+,1,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,132,5,2,28,83,96,0,0,0,0
+,162,0,0,0,2,16,81,98,38,187,228,150,14,0,0,0,83,116,114,105,110,103,73,116,101,114,97,116,111,114,0,0
+,145,68,97,0,0,0,0,0,0,0,0,64,0,2,2,255,255,255,255,2,28,83,96,0,0,0,0,162,0,0,0,2
+,16,81,98,46,213,82,64,11,0,0,0,77,97,112,73,116,101,114,97,116,111,114,0,0,0,0,0,145,68,97,0,0
+,0,0,0,0,0,0,64,0,2,2,255,255,255,255,2,28,83,96,0,0,0,0,162,0,0,0,73,145,68,97,0,0
+,0,0,0,0,0,0,96,0,2,2,255,255,255,255,2,28,83,96,0,0,0,0,84,3,0,0,73,145,68,97,0,0
+,0,0,0,0,0,0,0,0,0,2,255,255,255,255,2,28,83,96,0,0,0,0,241,1,0,0,73,145,68,97,2,0
+,2,0,0,0,0,0,0,0,0,2,255,255,255,255,2,28,83,96,0,0,0,0,239,1,0,0,73,145,68,97,1,0
+,1,0,0,0,0,0,49,128,3,2,255,255,255,255,2,28,83,96,0,0,0,0,240,1,0,0,73,145,68,97,1,0
+,1,0,0,0,0,0,49,128,3,2,255,255,255,255,2,28,83,96,0,0,0,0,0,2,0,0,73,145,68,97,1,0
+,1,0,0,0,0,0,32,0,0,2,255,255,255,255,2,28,83,96,0,0,0,0,1,2,0,0,73,145,68,97,1,0
+,1,0,0,0,0,0,32,0,0,2,255,255,255,255,2,28,83,96,0,0,0,0,2,2,0,0,73,145,68,97,0,0
+,0,0,0,0,0,0,0,0,0,2,255,255,255,255,2,28,83,96,0,0,0,0,3,2,0,0,73,145,68,97,0,0
+,0,0,0,0,0,0,0,0,0,2,255,255,255,255,2,28,83,96,0,0,0,0,5,2,0,0,73,145,68,97,1,0
+,1,0,0,0,0,0,0,0,0,2,255,255,255,255,2,20,81,99,94,213,183,68,22,0,0,0,82,101,103,69,120,112
+,32,83,116,114,105,110,103,32,73,116,101,114,97,116,111,114,0,0,2,28,83,96,0,0,0,0,96,3,0,0,144,145
+,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,63,5,2,28,83,96,0,0,0,0,162
+,0,0,0,2,20,81,99,126,76,202,110,20,0,0,0,82,101,103,69,120,112,83,116,114,105,110,103,73,116,101,114,97
+,116,111,114,0,0,0,0,145,68,97,0,0,0,0,0,0,0,0,64,0,2,2,255,255,255,255,2,28,83,96,0,0
+,0,0,162,0,0,0,2,16,81,98,86,108,210,176,11,0,0,0,83,101,116,73,116,101,114,97,116,111,114,0,0,0
+,0,0,145,68,97,0,0,0,0,0,0,0,0,64,0,2,2,255,255,255,255,2,28,83,96,0,0,0,0,165,0,0
+,0,2,20,80,99,7,0,0,0,20,0,0,0,103,101,116,32,91,83,121,109,98,111,108,46,115,112,101,99,105,101,115
+,93,0,0,0,0,145,68,97,0,0,0,0,0,0,0,0,96,0,2,2,255,255,255,255,2,28,83,96,0,0,0,0
+,217,0,0,0,17,205,4,145,68,97,1,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,2,28,83,96,0,0
+,0,0,52,2,0,0,2,16,80,98,7,0,0,0,14,0,0,0,103,101,116,32,98,121,116,101,76,101,110,103,116,104
+,0,0,145,68,97,0,0,255,255,0,0,0,0,96,0,2,2,255,255,255,255,11,0,2,125,3,2,28,83,96,0,0
+,0,0,53,2,0,0,10,0,2,159,1,145,68,97,2,0,2,0,0,0,0,0,96,0,2,2,255,255,255,255,11,0
+,130,126,3,2,28,83,96,0,0,0,0,162,0,0,0,73,145,68,97,0,0,0,0,0,0,0,0,64,0,2,2,255
+,255,255,255,2,28,83,96,0,0,0,0,73,1,0,0,17,165,2,145,68,97,1,0,255,255,2,0,0,0,96,0,2
+,2,255,255,255,255,2,28,83,96,0,0,0,0,73,1,0,0,17,209,3,17,237,1,68,97,1,0,255,255,2,0,0
+,0,96,0,2,2,255,255,255,255,2,28,83,96,0,0,0,0,73,1,0,0,17,165,4,146,68,97,1,0,255,255,2
+,0,0,0,96,0,2,2,255,255,255,255,2,28,83,96,0,0,0,0,93,1,0,0,17,13,4,146,68,97,1,0,255
+,255,0,0,0,0,64,0,2,2,255,255,255,255,2,28,83,96,0,0,0,0,204,2,0,0,148,146,68,97,1,0,255
+,255,0,0,0,0,64,0,2,2,255,255,255,255,11,0,2,97,4,2,28,83,96,0,0,0,0,76,1,0,0,73,146
+,68,97,0,0,255,255,0,0,0,0,64,0,2,2,255,255,255,255,11,0,2,33,2,2,28,83,96,0,0,0,0,77
+,1,0,0,73,146,68,97,0,0,255,255,0,0,0,0,64,0,2,2,255,255,255,255,11,0,130,34,2,2,28,83,96
+,0,0,0,0,78,1,0,0,73,146,68,97,0,0,255,255,0,0,0,0,64,0,2,2,255,255,255,255,11,0,2,36
+,2,2,28,83,96,0,0,0,0,79,1,0,0,73,146,68,97,0,0,255,255,0,0,0,0,64,0,2,2,255,255,255
+,255,11,0,130,37,2,2,28,83,96,0,0,0,0,80,1,0,0,73,146,68,97,0,0,255,255,0,0,0,0,64,0
+,2,2,255,255,255,255,11,0,2,39,2,68,2,21,32,17,49,1,99,0,0,0,0,3,8,0,0,0,0,0,0,16
+,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,17,109,5,17,77,4,10,0,2,24,1,19,221
+,1,19,148,17,249,2,19,100,19,185,3,10,0,98,105,3,68,10,0,194,194,1,135,68,19,153,2,128,68,10,0,194
+,31,1,136,68,19,181,1,132,68,19,209,2,68,19,173,3,129,68,19,65,3,17,181,4,129,68,19,5,1,128,68,17
+,217,3,10,0,130,141,2,19,141,2,10,0,226,25,2,130,68,10,0,226,199,1,128,68,17,157,3,19,88,68,19,61
+,2,10,0,2,48,3,68,19,89,3,129,68,10,0,226,82,3,129,68,19,116,17,217,4,10,0,130,81,1,19,77,1
+,10,0,162,32,1,129,68,19,49,3,131,68,10,0,33,232,129,68,19,141,1,68,19,125,3,19,205,2,68,17,49,5
+,129,68,10,0,2,226,1,68,10,0,226,104,1,129,68,10,0,2,106,3,68,10,0,34,234,2,68,19,85,3,68,19
+,97,3,68,17,137,2,19,80,17,93,2,128,68,10,0,226,192,1,131,68,10,0,194,155,1,128,68,19,225,2,132,68
+,10,0,130,30,1,135,68,10,0,194,239,1,10,0,226,46,2,68,19,205,1,19,5,2,68,17,89,4,129,68,19,65
+,1,129,68,10,0,194,153,1,19,44,10,0,130,136,2,68,10,0,130,84,3,68,10,0,162,116,2,19,9,3,19,68
+,128,68,10,0,66,242,1,10,0,34,154,1,128,68,10,0,194,157,1,68,19,197,1,68,10,0,66,129,1,10,0,226
+,196,1,68,19,69,2,68,10,0,130,234,1,128,68,10,0,66,129,3,10,0,162,78,1,132,68,17,61,5,19,208,19
+,93,2,68,10,0,130,240,2,128,68,10,0,194,226,2,17,97,5,19,121,2,19,189,3,10,0,194,43,2,129,68,19
+,125,1,128,68,17,37,3,128,68,10,0,194,56,3,19,153,1,129,68,19,193,3,68,17,209,3,68,19,45,3,10,0
+,2,114,2,130,68,10,0,66,244,2,130,68,17,173,2,135,68,10,0,193,237,131,68,17,165,4,10,0,34,228,1,19
+,196,133,68,10,0,226,183,1,130,68,17,1,4,17,229,2,17,69,4,19,181,2,68,10,0,226,174,2,10,0,162,232
+,2,10,0,162,28,1,68,17,101,2,17,153,3,19,177,1,129,68,17,73,2,19,145,3,68,19,185,2,128,68,17,253
+,3,19,17,1,128,68,19,193,2,10,0,34,233,1,10,0,34,156,1,130,68,10,0,193,240,68,10,0,34,45,2,17
+,161,3,10,0,162,113,2,68,17,61,3,68,19,168,10,0,2,30,2,131,68,17,161,4,19,57,3,10,0,226,37,2
+,131,68,10,0,130,72,1,10,0,226,197,1,68,17,165,3,10,0,162,87,1,68,19,133,3,17,105,3,17,149,3,68
+,17,45,5,10,0,225,241,17,93,3,19,92,10,0,2,10,1,17,105,4,128,68,10,0,34,93,2,10,0,226,230,1
+,68,10,0,226,76,3,132,68,19,245,1,130,68,10,0,98,46,2,19,17,3,68,19,161,2,17,185,2,68,10,0,2
+,29,1,10,0,2,229,2,68,19,121,3,128,68,10,0,2,192,2,17,185,4,19,53,3,128,68,10,0,98,66,1,68
+,17,105,2,130,68,10,0,98,236,2,10,0,98,37,2,17,65,5,130,68,17,177,3,10,0,225,243,68,19,216,19,89
+,1,128,68,10,0,130,144,3,68,19,104,10,0,34,231,2,10,0,194,130,1,17,205,4,68,17,85,4,17,193,2,17
+,213,2,128,68,10,0,2,33,1,10,0,2,37,2,17,121,3,128,68,10,0,130,35,1,137,68,17,169,4,128,68,10
+,0,98,92,2,130,68,17,237,4,19,229,2,128,68,17,101,3,135,68,19,121,1,68,10,0,66,40,2,143,68,19,160
+,134,68,10,0,130,111,3,19,113,1,128,68,17,125,3,128,68,19,157,1,10,0,34,45,3,68,19,61,3,10,0,162
+,34,1,130,68,10,0,162,45,2,128,68,19,108,68,17,33,3,10,0,2,85,3,128,68,10,0,162,243,1,129,68,10
+,0,130,88,2,19,200,68,10,0,194,230,2,133,68,10,0,2,46,2,17,37,4,19,169,2,17,205,2,17,133,4,68
+,19,197,3,128,68,19,149,3,10,0,2,8,1,19,201,3,10,0,226,198,1,128,68,10,0,194,231,1,131,68,10,0
+,130,234,2,68,19,197,2,17,77,3,128,68,10,0,194,26,1,128,68,19,40,10,0,66,227,1,10,0,98,81,3,10
+,0,66,241,2,10,0,98,60,3,130,68,17,225,2,17,49,4,129,68,17,17,5,17,225,4,68,17,5,5,128,68,10
+,0,34,63,1,68,17,57,2,131,68,17,85,2,68,19,137,3,17,41,5,17,17,3,17,133,3,17,89,3,10,0,130
+,233,1,68,17,77,5,133,68,10,0,66,153,1,129,68,17,113,4,17,53,5,10,0,2,236,1,10,0,162,244,2,68
+,17,45,4,68,17,201,4,10,0,162,59,3,68,19,205,3,68,10,0,130,196,1,68,17,221,4,136,68,10,0,66,155
+,1,17,141,4,19,209,3,10,0,162,173,2,19,213,3,19,217,3,19,1,3,68,17,149,2,19,161,1,68,10,0,98
+,93,1,10,0,2,176,2,128,68,10,0,98,192,2,128,68,10,0,98,176,2,19,13,3,128,68,10,0,2,239,2,129
+,68,19,161,3,128,68,17,93,4,10,0,162,40,2,10,0,98,185,1,17,85,3,10,0,2,111,3,19,132,68,10,0
+,2,102,1,68,10,0,66,241,1,128,68,19,93,1,19,109,3,10,0,66,194,2,10,0,98,80,3,10,0,66,108,3
+,17,13,3,10,0,34,32,1,68,19,144,10,0,98,109,3,129,68,10,0,226,132,3,131,68,10,0,34,142,3,132,68
+,19,153,3,17,137,3,10,0,66,112,2,68,10,0,2,236,2,129,68,19,48,133,68,17,113,3,128,68,17,89,5,10
+,0,2,35,1,128,68,10,0,98,200,1,135,68,19,188,132,68,19,45,2,10,0,66,239,1,133,68,19,37,1,10,0
+,194,92,2,17,125,2,10,0,34,214,2,68,10,0,2,82,3,132,68,10,0,66,58,3,128,68,17,205,3,136,68,10
+,0,2,225,1,19,172,10,0,162,42,2,10,0,162,238,1,131,68,10,0,162,203,2,19,120,68,10,0,226,231,2,19
+,253,2,128,68,17,29,5,68,19,149,1,128,68,19,49,1,128,68,10,0,130,231,2,130,68,19,192,10,0,226,41,3
+,17,213,4,139,68,10,0,130,110,3,68,10,0,66,34,1,134,68,17,197,2,19,224,130,68,19,101,2,17,33,4,129
+,68,10,0,226,36,3,68,17,45,3,19,165,3,128,68,19,77,2,10,0,193,242,129,68,10,0,194,241,1,128,68,17
+,249,3,128,68,19,117,1,10,0,98,159,1,10,0,66,60,1,17,217,2,10,0,226,234,2,129,68,19,117,2,133,68
+,73,130,68,10,0,226,200,1,10,0,226,41,2,128,68,19,73,3,17,81,5,132,68,10,0,226,141,2,17,209,2,128
+,68,17,97,3,130,68,19,136,68,19,113,2,68,19,241,2,130,68,17,21,3,10,0,98,233,2,17,69,5,10,0,226
+,57,3,128,68,19,177,3,10,0,2,229,1,10,0,34,48,2,68,10,0,98,239,2,68,10,0,130,34,2,10,0,130
+,237,1,10,0,130,154,1,19,105,1,130,68,10,0,194,107,1,131,68,19,221,3,128,68,10,0,162,121,3,10,0,66
+,240,1,139,68,17,181,2,134,68,19,72,10,0,2,110,3,10,0,34,220,1,68,17,213,3,17,5,3,10,0,66,44
+,2,10,0,98,175,2,19,93,3,128,68,10,0,194,133,2,134,68,17,105,5,128,68,10,0,98,56,3,128,68,10,0
+,2,159,1,131,68,19,25,3,134,68,10,0,194,83,3,68,17,57,5,131,68,19,105,3,68,17,65,3,129,68,19,36
+,68,17,245,2,68,19,81,1,17,29,3,17,189,3,19,225,3,10,0,2,237,1,17,173,4,10,0,226,237,2,68,10
+,0,34,195,1,129,68,17,61,2,128,68,17,141,3,19,41,1,68,19,149,2,128,68,17,97,2,10,0,130,9,1,17
+,201,3,128,68,10,0,194,159,1,19,237,1,129,68,10,0,66,193,1,128,68,19,229,3,68,19,0,68,17,189,4,68
+,17,1,5,128,68,19,109,1,132,68,10,0,162,193,1,128,68,17,233,2,19,101,1,17,101,4,19,228,130,68,19,29
+,1,19,233,2,68,17,189,2,19,45,1,68,10,0,2,233,2,19,32,68,10,0,226,97,2,68,19,21,1,19,145,1
+,131,68,17,57,4,19,112,17,221,3,19,33,3,68,10,0,98,140,2,142,68,10,0,2,103,3,10,0,98,199,1,131
+,68,19,233,3,10,0,130,225,1,10,0,129,241,128,68,10,0,66,38,2,19,41,3,68,10,0,98,43,2,68,19,29
+,2,10,0,98,174,2,10,0,162,58,3,17,201,2,17,21,5,131,68,19,173,2,128,68,10,0,194,240,1,133,68,17
+,193,4,19,137,2,131,68,19,156,133,68,19,129,3,68,17,253,4,128,68,19,213,2,128,68,10,0,162,48,2,17,109
+,2,128,68,19,21,2,10,0,130,196,2,128,68,10,0,130,90,1,68,17,245,3,19,60,128,68,19,61,1,17,41,4
+,19,177,2,10,0,34,204,2,128,68,10,0,98,245,2,128,68,17,169,2,10,0,98,201,1,132,68,17,117,2,10,0
+,34,237,2,10,0,66,69,1,10,0,34,232,1,128,68,17,209,4,10,0,66,232,2,131,68,17,237,2,68,17,253,2
+,128,68,10,0,97,242,128,68,10,0,162,232,1,10,0,34,243,2,17,141,2,68,10,0,98,231,1,68,17,229,3,137
+,68,10,0,226,192,2,17,53,4,17,233,4,68,19,240,10,0,162,38,2,68,19,237,3,131,68,19,212,131,68,17,17
+,4,19,248,130,68,10,0,98,242,2,10,0,162,235,2,130,68,19,129,2,10,0,2,242,2,68,19,84,10,0,129,239
+,132,68,10,0,98,197,1,68,19,69,3,129,68,10,0,34,41,2,133,68,19,125,2,128,68,10,0,2,224,1,68,17
+,53,3,10,0,66,238,2,131,68,10,0,162,110,1,130,68,10,0,162,136,1,68,17,145,2,19,105,2,128,68,17,233
+,3,128,68,10,0,66,35,2,128,68,17,73,4,68,10,0,162,195,1,128,68,17,129,3,130,68,10,0,130,158,1,129
+,68,10,0,33,240,128,68,10,0,226,34,2,128,68,17,73,5,10,0,226,78,3,68,19,101,3,10,0,194,219,1,17
+,49,3,10,0,162,106,3,68,10,0,2,31,1,19,53,1,10,0,162,38,3,129,68,17,153,4,10,0,98,39,2,128
+,68,19,152,130,68,10,0,194,236,2,68,10,0,97,244,19,241,3,68,19,245,3,128,68,10,0,226,180,2,129,68,10
+,0,98,78,3,10,0,130,133,1,141,68,17,109,3,10,0,194,245,2,10,0,193,238,129,68,10,0,226,27,1,132,68
+,19,249,3,10,0,130,76,3,10,0,130,104,2,68,10,0,2,146,3,68,10,0,130,41,2,10,0,98,29,1,19,4
+,10,0,194,108,3,17,153,2,128,68,10,0,130,191,2,10,0,34,107,3,129,68,19,133,2,130,68,10,0,34,132,1
+,19,1,1,68,17,177,2,68,10,0,34,141,2,19,164,10,0,226,154,1,19,133,1,10,0,34,30,3,10,0,98,33
+,1,17,221,2,10,0,162,242,1,130,68,17,65,4,19,189,2,68,17,161,2,131,68,10,0,226,127,1,140,68,10,0
+,194,176,2,134,68,17,121,4,17,81,4,17,165,2,17,9,3,129,68,19,85,1,17,137,4,128,68,10,0,194,140,2
+,17,125,4,10,0,66,96,1,17,9,5,10,0,226,33,1,130,68,19,229,1,19,77,3,68,10,0,130,226,1,68,17
+,117,4,10,0,33,241,19,253,3,128,68,10,0,98,230,1,132,68,17,101,5,10,0,194,44,2,17,21,4,136,68,17
+,121,2,131,68,10,0,66,116,2,17,145,4,68,19,5,3,68,17,69,3,10,0,2,245,2,128,68,10,0,2,235,1
+,68,19,221,2,10,0,66,142,2,131,68,19,13,1,68,17,1,3,68,17,229,4,128,68,10,0,98,194,1,10,0,2
+,238,1,129,68,10,0,2,60,3,130,68,10,0,98,219,1,10,0,130,204,2,19,245,2,68,10,0,66,177,2,10,0
+,226,243,2,10,0,2,196,2,10,0,194,29,1,128,68,10,0,226,79,3,10,0,130,156,1,130,68,10,0,98,79,3
+,10,0,66,83,3,128,68,19,56,10,0,130,195,2,19,252,129,68,10,0,2,194,1,130,68,17,25,4,128,68,17,173
+,3,19,25,1,17,65,2,129,68,10,0,34,84,3,19,37,2,19,157,3,10,0,194,177,2,129,68,19,1,4,68,10
+,0,130,10,1,10,0,162,241,2,129,68,10,0,66,42,2,130,68,17,13,5,10,0,33,243,128,68,19,244,10,0,130
+,47,2,17,29,4,10,0,129,243,10,0,98,31,1,128,68,10,0,130,224,1,131,68,19,117,3,68,10,0,226,229,1
+,128,68,17,77,2,68,17,241,4,132,68,17,149,4,17,57,3,128,68,10,0,162,36,2,128,68,19,81,3,10,0,194
+,140,1,68,10,0,194,107,3,128,68,10,0,130,187,1,128,68,17,25,3,19,53,2,68,17,25,5,131,68,17,225,3
+,19,85,2,17,241,3,17,145,3,19,5,4,68,17,9,4,68,17,53,2,17,73,3,10,0,194,125,1,10,0,130,243
+,2,19,13,2,19,165,2,17,129,2,10,0,34,57,3,68,17,197,4,130,68,19,204,130,68,10,0,66,98,2,19,21
+,3,10,0,226,39,2,10,0,98,229,1,68,10,0,162,142,2,128,68,10,0,34,27,1,128,68,17,113,2,19,128,19
+,180,10,0,2,9,1,130,68,19,249,2,19,76,68,19,217,2,17,117,3,10,0,34,158,1,17,245,4,17,109,4,68
+,17,177,4,10,0,194,239,2,128,68,17,193,3,17,181,3,17,33,5,19,69,1,10,0,2,243,1,19,124,19,113,3
+,10,0,34,211,2,68,19,145,2,10,0,66,235,2,10,0,34,59,3,132,68,19,189,1,68,19,29,3,129,68,10,0
+,98,77,3,10,0,130,235,1,134,68,19,184,10,0,226,80,3,68,19,12,17,81,3,68,19,213,1,129,68,10,0,130
+,236,1,17,81,2,19,165,1,10,0,130,25,1,68,17,249,4,132,68,17,61,4,131,68,10,0,162,228,1,19,176,68
+,10,0,34,99,1,130,68,10,0,34,196,1,68,17,241,2,10,0,2,39,2,132,68,10,0,130,237,2,19,237,2,128
+,68,10,0,130,30,2,10,0,2,174,2,68,19,57,1,10,0,34,240,2,10,0,34,30,1,128,68,19,9,4,132,68
+,19,232,19,13,4,128,68,10,0,34,246,2,128,68,17,89,2,68,19,52,17,5,4,68,19,33,1,17,41,3,128,68
+,17,133,2,131,68,19,64,19,253,1,10,0,226,156,1,129,68,17,185,3,128,68,19,201,2,17,97,4,68,10,0,97
+,238,128,68,19,37,3,17,69,2,19,157,2,68,10,0,130,131,3,68,19,109,2,10,0,130,27,1,10,0,162,227,1
+,128,68,10,0,66,28,1,68,19,73,1,68,17,157,4,128,68,19,9,1,10,0,226,77,3,17,37,5,10,0,2,43
+,2,138,68,10,0,194,242,2,130,68,10,0,130,57,3,10,0,130,46,3,143,68,17,237,3,128,68,10,0,194,193,2
+,17,13,4,129,68,19,236,17,169,3,68,10,0,226,226,1,10,0,226,233,1,132,68,10,0,98,198,1,133,68,10,0
+,162,35,2,133,68,10,0,194,84,1,128,68,19,169,3,130,68,10,0,98,125,1,128,68,10,0,2,11,1,10,0,98
+,82,3,129,68,10,0,162,238,2,133,68,17,85,5,19,185,1,17,129,4,10,0,226,194,2,68,10,0,98,157,1,133
+,68,10,0,194,233,2,129,68,10,0,226,240,2,10,0,98,182,1,10,0,34,160,1,10,0,98,75,1,128,68,17,197
+,3,130,68,10,0,98,230,2,128,68,17,157,2,19,140,68,17,93,5,10,0,66,193,2,68,19,97,1,68,10,0,34
+,36,2,19,141,3,68,10,0,130,8,1,26,26,26,20,20,20,107,3,222,192,6,0,0,0,104,89,0,0,72,117,0
+,128,0,0,0,128,0,0,0,128,0,0,0,128,0,0,0,128,0,0,0,128,0,0,0,0,0,40,0,40,8,0,65
+,1,97,10,0,0,31,162,0,0,24,255,3,64,0,0,0,0,0,128,0,24,0,40,144,97,6,0,0,33,67,0,16
+,24,255,3,64,0,0,0,0,0,128,8,0,129,2,0,12,0,40,144,97,0,0,0,15,156,0,0,24,255,3,64,0
+,0,0,0,0,128,145,8,0,129,4,96,0,0,0,0,0,0,0,0,0,8,0,40,144,97,0,0,0,55,151,0,0
+,24,255,3,64,0,0,0,0,0,128,145,146,96,0,0,0,0,0,0,0,0,8,0,33,6,97,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,22,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,22,96,0,0
+,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,22,146,96,0,0,0,0,0
+,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,97,0,0,0,21,161,0,0,25,255,3
+,64,8,0,0,0,0,128,145,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,40,144,97,1,0,0,2,160,0,0,25,255,3,64,8,0,0,0,0,128,145,146,96,0,0,0,0
+,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,144,97,2,0,0,2,160,0
+,0,25,255,3,64,8,0,0,0,0,128,145,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,24,0,40,144,97,6,0,0,33,67,0,0,25,255,3,64,8,0,0,0,0,128,145
+,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,0,0,0
+,0,0,0,240,191,0,16,0,40,144,97,0,185,0,4,8,0,0,25,255,3,64,8,0,0,0,0,128,145,146,96,0
+,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,30,231,168,92,13,0
+,0,0,117,110,105,110,105,116,105,97,108,105,122,101,100,0,0,0,96,0,0,0,0,255,255,255,255,0,16,8,0,161
+,12,98,78,134,75,167,9,0,0,0,117,110,100,101,102,105,110,101,100,0,0,0,0,0,0,0,96,0,0,0,0,6
+,0,0,0,0,24,0,40,144,97,6,0,0,33,67,0,16,24,255,3,64,0,0,0,0,0,128,145,146,96,0,0,0
+,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,0,0,0,0,0,0,248,127
+,8,0,225,13,0,8,0,40,144,97,2,113,0,2,66,0,0,25,255,3,64,8,0,0,0,0,128,145,146,96,0,0
+,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,0,0,0,0,0,0,248
+,127,149,96,0,0,0,0,5,0,0,0,0,24,0,40,144,97,6,0,0,33,67,0,0,24,255,3,64,0,0,0,0
+,0,128,145,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96
+,255,255,247,255,255,255,247,255,0,12,148,97,182,160,27,127,4,0,0,0,104,111,108,101,0,0,0,0,0,8,8,0
+,161,16,96,255,255,247,255,255,255,247,255,149,96,0,0,0,0,2,0,0,0,145,0,24,0,40,144,97,6,30,0,33
+,67,0,0,25,255,3,64,8,0,0,0,0,128,145,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,96,0,0,0,0,0,0,240,63,0,12,148,97,206,118,113,152,4,0,0,0,116
+,114,117,101,0,0,0,0,96,0,0,0,0,1,0,0,0,0,12,148,97,102,102,218,1,7,0,0,0,98,111,111,108
+,101,97,110,0,96,0,0,0,0,1,0,0,0,0,24,8,0,65,21,96,0,0,0,0,0,0,0,0,0,12,148,97
+,190,201,42,122,5,0,0,0,102,97,108,115,101,0,0,0,96,0,0,0,0,0,0,0,0,8,0,225,22,96,0,0
+,0,0,0,0,0,0,0,8,148,96,14,27,5,227,0,0,0,0,8,0,65,1,0,40,145,97,0,0,0,1,133,0
+,0,25,255,3,64,8,0,0,0,0,128,70,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,40,145,97,0,0,0,20,118,0,0,24,255,3,64,0,0,0,0,0,128,70,146,96
+,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,0,0
+,0,20,118,0,0,24,255,3,64,0,0,0,0,0,128,70,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,0,0,0,20,119,0,0,25,255,3,64,8,0,0,0,0
+,128,70,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40
+,145,97,3,187,0,46,64,0,0,25,255,3,64,8,0,0,0,0,128,70,146,96,0,0,0,0,0,0,0,0,147,97
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,0,185,0,4,40,0,0,25,255,3,64,8
+,0,0,0,0,128,70,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,148,0,40,145,97,0,0,0,20,131,0,0,25,255,3,64,8,0,0,0,0,128,70,146,96,0,0,0,0,0
+,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,7,0,0,38,166,0,0
+,25,255,3,64,8,0,0,0,0,128,70,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,40,145,97,0,0,0,10,154,0,0,25,255,3,64,8,0,0,0,0,128,70,146,96,0
+,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,0,0,0
+,13,141,0,0,25,255,3,64,8,0,0,0,0,128,70,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,2,0,0,9,153,0,0,25,255,3,64,8,0,0,0,0,128
+,70,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145
+,97,5,0,0,36,165,0,0,25,255,3,64,8,0,0,0,0,128,70,146,96,0,0,0,0,0,0,0,0,147,97,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,2,0,0,2,70,0,0,25,255,3,64,8,0
+,0,0,0,128,70,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,150,0,40,145,97,0,0,0,49,152,0,0,25,255,3,64,8,0,0,0,0,128,70,146,96,0,0,0,0,0,0
+,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,0,0,0,19,159,0,0,25
+,255,3,64,8,0,0,0,0,128,70,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,8,82,96,0,0,0,0,0,0,0,0,0,8,76,96,0,0,0,0,0,0,0,0,146,0
+,24,0,40,145,97,6,0,0,33,67,0,0,25,255,3,64,8,0,0,0,0,128,70,146,96,0,0,0,0,0,0,0
+,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,0,0,0,0,0,0,16,192,0,16,148,98
+,190,159,209,141,16,0,0,0,97,114,103,117,109,101,110,116,115,95,109,97,114,107,101,114,96,0,0,0,0,252,255,255
+,255,149,96,0,0,0,0,4,0,0,0,0,24,0,40,145,97,6,0,0,33,67,0,0,25,255,3,64,8,0,0,0
+,0,128,70,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96
+,0,0,0,0,0,0,20,192,0,16,148,98,206,50,128,179,9,0,0,0,101,120,99,101,112,116,105,111,110,0,0,0
+,0,0,0,0,96,0,0,0,0,251,255,255,255,149,96,0,0,0,0,8,0,0,0,0,24,0,40,145,97,6,0,0
+,33,67,0,0,25,255,3,64,8,0,0,0,0,128,70,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,96,0,0,0,0,0,0,8,192,0,20,148,99,158,83,139,196,21,0,0,0
+,116,101,114,109,105,110,97,116,105,111,110,95,101,120,99,101,112,116,105,111,110,0,0,0,96,0,0,0,0,253,255,255
+,255,149,96,0,0,0,0,7,0,0,0,0,24,0,40,145,97,6,0,0,33,67,0,0,25,255,3,64,8,0,0,0
+,0,128,70,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96
+,0,0,0,0,0,0,24,192,0,16,148,98,246,106,117,53,13,0,0,0,111,112,116,105,109,105,122,101,100,95,111,117
+,116,0,0,0,96,0,0,0,0,250,255,255,255,149,96,0,0,0,0,9,0,0,0,0,24,0,40,145,97,6,0,0
+,33,67,0,0,25,255,3,64,8,0,0,0,0,128,70,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,96,0,0,0,0,0,0,28,192,0,16,148,98,246,92,255,224,14,0,0,0
+,115,116,97,108,101,95,114,101,103,105,115,116,101,114,0,0,96,0,0,0,0,249,255,255,255,149,96,0,0,0,0,10
+,0,0,0,0,40,145,97,0,0,0,32,143,0,0,25,255,3,64,8,0,0,0,0,128,70,146,96,0,0,0,0,0
+,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,0,0,0,13,142,0,0
+,25,255,3,64,8,0,0,0,0,128,70,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,40,145,97,0,0,0,13,140,0,0,25,255,3,64,8,0,0,0,0,128,70,146,96,0
+,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,0,0,0
+,13,144,0,0,25,255,3,64,8,0,0,0,0,128,70,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,0,0,0,13,136,0,0,25,255,3,64,8,0,0,0,0,128
+,70,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145
+,97,0,0,0,13,137,0,0,25,255,3,64,8,0,0,0,0,128,70,146,96,0,0,0,0,0,0,0,0,147,97,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,0,0,0,13,138,0,0,25,255,3,64,8,0
+,0,0,0,128,70,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,40,145,97,0,0,0,13,145,0,0,25,255,3,64,8,0,0,0,0,128,70,146,96,0,0,0,0,0,0,0
+,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,0,0,0,13,139,0,0,25,255
+,3,64,8,0,0,0,0,128,70,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,40,145,97,0,0,0,20,132,0,0,25,255,3,64,8,0,0,0,0,128,70,146,96,0,0,0
+,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,0,0,0,20,129
+,0,0,25,255,3,64,8,0,0,0,0,128,70,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,40,145,97,0,0,0,2,158,0,0,25,255,3,64,8,0,0,0,0,128,70,146
+,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,0
+,0,0,20,118,0,0,25,255,3,64,8,0,0,0,0,128,70,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,0,27,0,0,65,0,0,25,255,3,64,8,0,0,0
+,0,128,70,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,40,145,97,0,0,0,20,130,0,0,25,255,3,64,8,0,0,0,0,128,70,146,96,0,0,0,0,0,0,0,0,147
+,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,0,0,0,8,134,0,0,25,255,3,64
+,8,0,0,0,0,128,70,146,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,40,145,97,3,0,0,11,155,0,0,25,255,3,64,8,0,0,0,0,128,70,146,96,0,0,0,0,0
+,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,225,4,0,40,145,97,0,0,0
+,3,135,0,0,41,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,0,0,0,20,121,0,0,25,255,3,64,8,0,0,0,0,128
+,70,94,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145
+,97,3,0,0,18,95,0,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,147,97,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,0,0,0,20,118,0,0,25,255,3,64,8,0
+,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,40,145,97,0,0,0,20,122,0,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0
+,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,3,0,0,18,95,0,0,25,255
+,3,64,10,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,40,145,97,0,0,0,20,123,0,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0
+,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,3,0,0,18,95
+,0,0,25,255,3,64,10,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,40,145,97,0,0,0,20,124,0,0,25,255,3,64,8,0,0,0,0,128,70,94
+,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,0
+,0,0,20,125,0,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,147,97,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,0,0,0,20,126,0,0,25,255,3,64,8,0,0,0
+,0,128,70,94,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,40,145,97,0,0,0,34,163,0,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,147
+,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,0,0,0,35,164,0,0,25,255,3,64
+,8,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,40,145,97,4,0,0,45,91,0,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0,0
+,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,4,0,0,45,91,0,0
+,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,40,145,97,4,0,0,45,91,0,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0
+,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,0,0,0
+,20,127,0,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,0,0,0,20,118,0,0,25,255,3,64,8,0,0,0,0,128
+,70,94,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145
+,97,0,0,0,41,146,0,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,147,97,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,0,0,0,42,147,0,0,25,255,3,64,8,0
+,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,40,145,97,0,0,0,43,148,0,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0
+,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,18,0,0,44,68,0,0,25,255
+,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,40,145,97,0,0,0,20,128,0,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0
+,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,9,0,0,47,69
+,0,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,40,145,97,3,0,0,50,150,0,0,25,255,3,64,8,0,0,0,0,128,70,94
+,96,0,0,0,0,0,0,0,0,147,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,4
+,0,0,51,149,0,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,147,97,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,97,6,0,40,145,97,0,0,0,55,167,0,0,24,255,3,64
+,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,8,0,33,6,97,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,40,145,97,0,0,0,17,120,0,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0
+,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,0,0,0,16
+,157,0,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,40,145,97,9,0,0,56,168,0,0,25,255,3,64,8,0,0,0,0,128,70
+,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97
+,3,185,0,2,58,0,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,0,185,0,5,32,0,0,25,255,3,64,8,0,0
+,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,40,145,97,4,185,0,39,41,0,0,25,255,3,64,10,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0
+,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,4,185,0,39,33,0,0,25,255,3
+,64,10,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,40,145,97,3,185,0,48,45,0,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0
+,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,3,185,0,48,37,0
+,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,40,145,97,4,185,0,40,35,0,0,25,255,3,64,8,0,0,0,0,128,70,94,96
+,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,4,185
+,0,40,43,0,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,4,185,0,2,34,0,0,25,255,3,64,8,0,0,0,0
+,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40
+,145,97,4,185,0,2,42,0,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,3,185,0,2,50,0,0,25,255,3,64,8
+,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,40,145,97,0,185,0,5,0,0,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0,0,0
+,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,4,185,0,2,2,0,0,25
+,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,40,145,97,4,185,0,2,10,0,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0
+,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97,3,185,0,2
+,18,0,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,40,145,97,3,185,0,2,26,0,0,25,255,3,64,8,0,0,0,0,128,70
+,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,145,97
+,3,185,0,2,58,0,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,33,15,8,0,161,18,8,0,65,3,8,0,65,21,8,0
+,225,10,8,0,161,44,8,0,33,47,8,0,161,49,8,0,65,52,8,0,193,54,0,40,74,97,6,0,0,33,67,0
+,0,25,255,3,64,8,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,8,0,33,6,97,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,12,0,40,74,97,3,0,0,45,94,0,0,24,255,3,64,0,0,0,0
+,0,128,70,94,96,0,0,0,0,0,0,0,0,151,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128
+,93,0,8,17,9,1,96,0,0,0,0,0,0,0,0,0,8,75,96,0,0,0,0,0,0,0,0,0,12,17,200,97
+,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,12,0,40,74,97,3,0,0,45,88,0,0,24,255,3
+,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,151,97,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,96,0,0,0,0,0,0,0,0,93,0,8,17,184,96,0,0,0,0,0,0,0,0,0,16,17,29,1
+,96,0,0,0,0,2,0,0,0,128,68,0,36,17,240,99,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,130,68,0,20,17,248,99,0,0,0,0,3,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20,17,252,99,0,0,0,0
+,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,17,188
+,96,0,0,0,0,0,0,0,0,0,20,87,73,96,0,0,0,0,0,0,0,0,69,8,0,33,6,0,40,17,232,101
+,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0
+,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,129,68,0,40,0,40,74,97,10,0,0,45,97,0,0,24
+,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,144,97,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,134,68,96,0,0,0,0,0,0,0,0,144,0,12,17,69,1,97,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,8,0,97,16,8,0,65,20,0,8,89,96,0,0,0,0,0,0,240,127,0,8,89,96
+,0,0,0,0,0,0,0,128,0,8,89,96,0,0,0,0,0,0,240,255,0,24,17,193,1,96,0,0,0,0,0,0
+,240,191,0,20,81,99,158,6,11,217,21,0,0,0,115,101,108,102,95,114,101,102,101,114,101,110,99,101,95,109,97,114
+,107,101,114,0,0,0,96,0,0,0,0,255,255,255,255,8,0,225,13,96,0,0,0,0,10,0,0,0,0,12,75,97
+,0,0,0,0,2,0,0,0,2,43,0,0,0,0,0,0,0,12,17,208,68,96,0,0,0,0,0,0,0,0,0,12
+,151,68,96,16,0,0,0,0,0,0,0,0,40,82,99,0,0,0,0,8,0,0,0,0,0,0,0,68,1,1,0,0
+,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,12,81,97,46,243,141,152,4,0,0,0,116,104,105,115,0
+,0,0,0,99,0,0,0,0,209,255,63,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,40,82,99,0,0,0,0,8,0,0,0,0,0,0,0,194,113,1,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,73,96,0,0,0,0,0,0,0,0,73,97,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,12,75,97,0,0,0,0,8,0,0,0,23,70,19,26,119,63,35,46,0,12,81,97,46,53,150,44
+,3,0,0,0,97,100,100,0,0,0,0,0,0,12,81,97,222,81,86,117,6,0,0,0,97,108,119,97,121,115,0,0
+,0,20,81,99,6,224,14,130,20,0,0,0,40,97,110,111,110,121,109,111,117,115,32,102,117,110,99,116,105,111,110,41
+,0,0,0,0,0,16,81,98,118,114,166,234,9,0,0,0,97,110,111,110,121,109,111,117,115,0,0,0,0,0,0,0
+,0,12,81,97,14,123,21,179,5,0,0,0,97,112,112,108,121,0,0,0,0,16,81,98,6,73,163,94,9,0,0,0
+,65,114,103,117,109,101,110,116,115,0,0,0,0,0,0,0,0,16,81,98,222,243,31,101,9,0,0,0,97,114,103,117
+,109,101,110,116,115,0,0,0,0,0,0,0,0,20,81,99,46,120,198,5,18,0,0,0,91,111,98,106,101,99,116,32
+,65,114,103,117,109,101,110,116,115,93,0,0,0,0,0,0,0,12,81,97,14,82,234,213,5,0,0,0,65,114,114,97
+,121,0,0,0,0,16,81,98,22,186,194,35,14,0,0,0,91,111,98,106,101,99,116,32,65,114,114,97,121,93,0,0
+,0,16,81,98,222,67,62,75,11,0,0,0,65,114,114,97,121,66,117,102,102,101,114,0,0,0,0,0,0,16,81,98
+,78,224,120,251,14,0,0,0,65,114,114,97,121,32,73,116,101,114,97,116,111,114,0,0,0,12,81,97,214,72,136,153
+,2,0,0,0,97,115,0,0,0,0,0,0,0,12,81,97,230,11,123,61,5,0,0,0,97,115,121,110,99,0,0,0
+,0,12,81,97,182,228,175,104,4,0,0,0,97,117,116,111,0,0,0,0,0,12,81,97,30,118,133,1,5,0,0,0
+,97,119,97,105,116,0,0,0,0,12,81,97,174,165,187,218,6,0,0,0,66,105,103,73,110,116,0,0,0,12,81,97
+,14,112,116,212,6,0,0,0,98,105,103,105,110,116,0,0,0,16,81,98,46,23,87,192,13,0,0,0,66,105,103,73
+,110,116,54,52,65,114,114,97,121,0,0,0,0,16,81,98,94,53,164,136,14,0,0,0,66,105,103,85,105,110,116,54
+,52,65,114,114,97,121,0,0,0,12,81,97,94,250,133,223,4,0,0,0,98,105,110,100,0,0,0,0,0,12,81,97
+,206,3,171,235,7,0,0,0,66,111,111,108,101,97,110,0,8,0,225,22,0,16,81,98,62,233,153,151,16,0,0,0
+,91,111,98,106,101,99,116,32,66,111,111,108,101,97,110,93,0,12,81,97,190,147,166,249,6,0,0,0,98,111,117,110
+,100,32,0,0,0,12,81,97,134,236,167,35,6,0,0,0,98,117,102,102,101,114,0,0,0,16,81,98,166,255,11,241
+,10,0,0,0,98,121,116,101,76,101,110,103,116,104,0,0,0,0,0,0,0,16,81,98,142,109,27,160,10,0,0,0
+,98,121,116,101,79,102,102,115,101,116,0,0,0,0,0,0,0,16,81,98,134,238,103,107,12,0,0,0,67,111,109,112
+,105,108,101,69,114,114,111,114,0,0,0,0,0,12,81,97,110,37,166,13,6,0,0,0,99,97,108,108,101,101,0,0
+,0,12,81,97,150,7,63,127,6,0,0,0,99,97,108,108,101,114,0,0,0,16,81,98,6,109,156,118,9,0,0,0
+,99,104,97,114,97,99,116,101,114,0,0,0,0,0,0,0,0,16,81,98,134,221,33,192,9,0,0,0,40,99,108,111
+,115,117,114,101,41,0,0,0,0,0,0,0,0,12,81,97,110,139,210,45,4,0,0,0,99,111,100,101,0,0,0,0
+,0,12,81,97,166,97,167,142,6,0,0,0,99,111,108,117,109,110,0,0,0,16,81,98,190,76,239,161,10,0,0,0
+,60,99,111,109,112,117,116,101,100,62,0,0,0,0,0,0,0,16,81,98,174,217,31,153,12,0,0,0,99,111,110,102
+,105,103,117,114,97,98,108,101,0,0,0,0,0,16,81,98,110,35,12,22,11,0,0,0,99,111,110,106,117,110,99,116
+,105,111,110,0,0,0,0,0,0,16,81,98,86,144,251,211,9,0,0,0,99,111,110,115,116,114,117,99,116,0,0,0
+,0,0,0,0,0,16,81,98,158,155,157,248,11,0,0,0,99,111,110,115,116,114,117,99,116,111,114,0,0,0,0,0
+,0,12,81,97,190,204,36,75,4,0,0,0,68,97,116,101,0,0,0,0,0,16,81,98,166,90,26,175,13,0,0,0
+,91,111,98,106,101,99,116,32,68,97,116,101,93,0,0,0,0,12,81,97,70,237,219,231,7,0,0,0,100,101,102,97
+,117,108,116,0,0,16,81,98,118,209,161,144,14,0,0,0,100,101,102,105,110,101,80,114,111,112,101,114,116,121,0,0
+,0,16,81,98,150,72,101,23,14,0,0,0,100,101,108,101,116,101,80,114,111,112,101,114,116,121,0,0,0,16,81,98
+,78,161,17,233,11,0,0,0,100,105,115,106,117,110,99,116,105,111,110,0,0,0,0,0,0,16,81,98,22,166,222,186
+,11,0,0,0,100,105,115,112,108,97,121,78,97,109,101,0,0,0,0,0,0,12,81,97,6,249,66,88,4,0,0,0
+,100,111,110,101,0,0,0,0,0,12,81,97,150,223,65,218,6,0,0,0,46,98,114,97,110,100,0,0,0,12,81,97
+,46,192,221,132,6,0,0,0,46,99,97,116,99,104,0,0,0,12,81,97,38,102,109,7,8,0,0,0,46,100,101,102
+,97,117,108,116,0,12,81,97,222,48,205,127,4,0,0,0,46,102,111,114,0,0,0,0,0,20,81,99,246,93,38,88
+,17,0,0,0,46,103,101,110,101,114,97,116,111,114,95,111,98,106,101,99,116,0,0,0,0,0,0,0,0,16,81,98
+,150,46,244,252,9,0,0,0,46,105,116,101,114,97,116,111,114,0,0,0,0,0,0,0,0,12,81,97,238,84,9,12
+,8,0,0,0,46,112,114,111,109,105,115,101,0,12,81,97,46,18,104,39,7,0,0,0,46,114,101,115,117,108,116,0
+,0,12,81,97,38,28,110,239,1,0,0,0,46,0,0,0,0,0,0,0,0,16,81,98,166,116,9,205,11,0,0,0
+,46,115,119,105,116,99,104,95,116,97,103,0,0,0,0,0,0,12,81,97,174,159,102,125,6,0,0,0,100,111,116,65
+,108,108,0,0,0,16,81,98,166,207,80,160,10,0,0,0,101,110,117,109,101,114,97,98,108,101,0,0,0,0,0,0
+,0,12,81,97,222,6,249,135,7,0,0,0,101,108,101,109,101,110,116,0,0,12,81,97,62,250,62,21,5,0,0,0
+,69,114,114,111,114,0,0,0,0,16,81,98,22,154,227,118,14,0,0,0,91,111,98,106,101,99,116,32,69,114,114,111
+,114,93,0,0,0,12,81,97,86,170,11,112,4,0,0,0,101,118,97,108,0,0,0,0,0,16,81,98,206,168,255,15
+,9,0,0,0,69,118,97,108,69,114,114,111,114,0,0,0,0,0,0,0,0,12,81,97,46,52,68,103,4,0,0,0
+,101,120,101,99,0,0,0,0,8,0,1,24,0,12,81,97,102,223,232,110,5,0,0,0,102,108,97,103,115,0,0,0
+,0,16,81,98,102,240,221,139,12,0,0,0,70,108,111,97,116,51,50,65,114,114,97,121,0,0,0,0,0,16,81,98
+,6,117,50,11,12,0,0,0,70,108,111,97,116,54,52,65,114,114,97,121,0,0,0,0,0,12,81,97,254,208,230,117
+,4,0,0,0,102,114,111,109,0,0,0,0,0,12,81,97,246,183,67,181,8,0,0,0,70,117,110,99,116,105,111,110
+,0,24,81,100,102,212,112,132,29,0,0,0,102,117,110,99,116,105,111,110,32,40,41,32,123,32,91,110,97,116,105,118
+,101,32,99,111,100,101,93,32,125,0,0,0,0,12,81,97,62,210,98,136,8,0,0,0,102,117,110,99,116,105,111,110
+,0,20,81,99,158,202,32,167,17,0,0,0,91,111,98,106,101,99,116,32,70,117,110,99,116,105,111,110,93,0,0,0
+,0,0,0,0,0,16,81,98,182,155,78,100,9,0,0,0,71,101,110,101,114,97,116,111,114,0,0,0,0,0,0,0
+,0,12,81,97,198,141,140,43,4,0,0,0,103,101,116,32,0,0,0,0,0,12,81,97,126,74,191,102,3,0,0,0
+,103,101,116,0,0,0,0,0,0,20,81,99,206,107,104,57,24,0,0,0,103,101,116,79,119,110,80,114,111,112,101,114
+,116,121,68,101,115,99,114,105,112,116,111,114,0,16,81,98,22,214,213,94,14,0,0,0,103,101,116,80,114,111,116,111
+,116,121,112,101,79,102,0,0,0,12,81,97,126,182,255,103,6,0,0,0,103,108,111,98,97,108,0,0,0,16,81,98
+,238,76,80,136,10,0,0,0,103,108,111,98,97,108,84,104,105,115,0,0,0,0,0,0,0,12,81,97,30,143,106,169
+,6,0,0,0,103,114,111,117,112,115,0,0,0,12,81,97,182,41,67,223,3,0,0,0,104,97,115,0,0,0,0,0
+,0,16,81,98,46,210,69,212,10,0,0,0,105,103,110,111,114,101,67,97,115,101,0,0,0,0,0,0,0,16,81,98
+,158,85,242,121,14,0,0,0,105,108,108,101,103,97,108,32,97,99,99,101,115,115,0,0,0,16,81,98,30,96,224,58
+,16,0,0,0,105,108,108,101,103,97,108,32,97,114,103,117,109,101,110,116,0,12,81,97,254,244,10,80,5,0,0,0
+,105,110,100,101,120,0,0,0,0,12,81,97,126,74,166,44,7,0,0,0,105,110,100,105,99,101,115,0,0,12,81,97
+,222,8,136,170,8,0,0,0,73,110,102,105,110,105,116,121,0,12,81,97,22,130,95,29,8,0,0,0,105,110,102,105
+,110,105,116,121,0,12,81,97,166,201,111,125,5,0,0,0,105,110,112,117,116,0,0,0,0,16,81,98,94,10,135,111
+,10,0,0,0,73,110,116,49,54,65,114,114,97,121,0,0,0,0,0,0,0,16,81,98,30,125,45,167,10,0,0,0
+,73,110,116,51,50,65,114,114,97,121,0,0,0,0,0,0,0,16,81,98,102,242,139,221,9,0,0,0,73,110,116,56
+,65,114,114,97,121,0,0,0,0,0,0,0,0,16,81,98,70,204,121,175,12,0,0,0,105,115,69,120,116,101,110,115
+,105,98,108,101,0,0,0,0,0,16,81,98,206,182,65,72,16,0,0,0,106,115,77,101,109,111,114,121,69,115,116,105
+,109,97,116,101,0,16,81,98,190,186,254,232,13,0,0,0,106,115,77,101,109,111,114,121,82,97,110,103,101,0,0,0
+,0,12,81,97,174,31,232,193,4,0,0,0,107,101,121,115,0,0,0,0,0,16,81,98,198,54,56,122,9,0,0,0
+,108,97,115,116,73,110,100,101,120,0,0,0,0,0,0,0,0,12,81,97,102,255,31,144,6,0,0,0,108,101,110,103
+,116,104,0,0,0,12,81,97,94,160,133,55,3,0,0,0,108,101,116,0,0,0,0,0,0,12,81,97,150,87,251,200
+,4,0,0,0,108,105,110,101,0,0,0,0,0,16,81,98,46,7,66,155,9,0,0,0,76,105,110,107,69,114,114,111
+,114,0,0,0,0,0,0,0,0,12,81,97,238,29,192,197,4,0,0,0,108,111,110,103,0,0,0,0,0,12,81,97
+,190,193,46,131,3,0,0,0,77,97,112,0,0,0,0,0,0,16,81,98,46,162,48,120,12,0,0,0,77,97,112,32
+,73,116,101,114,97,116,111,114,0,0,0,0,0,12,81,97,238,180,228,12,6,0,0,0,109,101,100,105,117,109,0,0
+,0,12,81,97,134,102,95,244,7,0,0,0,109,101,115,115,97,103,101,0,0,12,81,97,94,105,72,126,4,0,0,0
+,109,101,116,97,0,0,0,0,0,16,81,98,214,252,109,20,9,0,0,0,45,73,110,102,105,110,105,116,121,0,0,0
+,0,0,0,0,0,12,81,97,254,180,189,165,6,0,0,0,77,111,100,117,108,101,0,0,0,16,81,98,6,37,13,156
+,9,0,0,0,109,117,108,116,105,108,105,110,101,0,0,0,0,0,0,0,0,12,81,97,118,26,243,170,4,0,0,0
+,110,97,109,101,0,0,0,0,0,12,81,97,6,73,84,218,3,0,0,0,78,97,78,0,0,0,0,0,0,12,81,97
+,142,136,141,125,6,0,0,0,110,97,114,114,111,119,0,0,0,12,81,97,46,186,133,4,6,0,0,0,110,97,116,105
+,118,101,0,0,0,16,81,98,30,181,229,151,11,0,0,0,46,110,101,119,46,116,97,114,103,101,116,0,0,0,0,0
+,0,12,81,97,246,60,213,15,4,0,0,0,110,101,120,116,0,0,0,0,0,12,81,97,126,39,254,231,3,0,0,0
+,78,70,67,0,0,0,0,0,0,12,81,97,182,47,34,236,3,0,0,0,78,70,68,0,0,0,0,0,0,12,81,97
+,78,242,86,201,4,0,0,0,78,70,75,67,0,0,0,0,0,12,81,97,86,115,216,137,4,0,0,0,78,70,75,68
+,0,0,0,0,0,16,81,98,230,153,66,49,9,0,0,0,110,111,116,45,101,113,117,97,108,0,0,0,0,0,0,0
+,0,12,81,97,70,80,48,191,4,0,0,0,110,117,108,108,0,0,0,0,0,16,81,98,38,101,145,18,13,0,0,0
+,91,111,98,106,101,99,116,32,78,117,108,108,93,0,0,0,0,12,81,97,222,146,95,247,6,0,0,0,78,117,109,98
+,101,114,0,0,0,12,81,97,118,209,169,200,6,0,0,0,110,117,109,98,101,114,0,0,0,16,81,98,238,102,163,56
+,15,0,0,0,91,111,98,106,101,99,116,32,78,117,109,98,101,114,93,0,0,12,81,97,30,162,18,102,6,0,0,0
+,79,98,106,101,99,116,0,0,0,12,81,97,134,120,102,97,6,0,0,0,111,98,106,101,99,116,0,0,0,16,81,98
+,118,237,135,188,15,0,0,0,91,111,98,106,101,99,116,32,79,98,106,101,99,116,93,0,0,12,81,97,158,136,127,241
+,2,0,0,0,111,102,0,0,0,0,0,0,0,12,81,97,142,105,184,98,2,0,0,0,111,107,0,0,0,0,0,0
+,0,12,81,97,8,0,0,8,1,0,0,0,49,0,0,0,0,0,0,0,0,12,81,97,134,174,84,20,7,0,0,0
+,111,119,110,75,101,121,115,0,0,12,81,97,182,76,92,172,7,0,0,0,112,101,114,99,101,110,116,0,0,12,81,97
+,246,4,10,127,8,0,0,0,112,111,115,105,116,105,111,110,0,20,81,99,102,20,109,63,17,0,0,0,112,114,101,118
+,101,110,116,69,120,116,101,110,115,105,111,110,115,0,0,0,0,0,0,0,0,16,81,98,222,250,33,163,12,0,0,0
+,35,99,111,110,115,116,114,117,99,116,111,114,0,0,0,0,0,12,81,97,94,97,48,177,7,0,0,0,80,114,111,109
+,105,115,101,0,0,16,81,98,182,74,151,213,9,0,0,0,95,95,112,114,111,116,111,95,95,0,0,0,0,0,0,0
+,0,16,81,98,150,118,138,170,9,0,0,0,112,114,111,116,111,116,121,112,101,0,0,0,0,0,0,0,0,12,81,97
+,182,146,26,35,5,0,0,0,112,114,111,120,121,0,0,0,0,12,81,97,70,111,37,213,5,0,0,0,80,114,111,120
+,121,0,0,0,0,12,81,97,126,238,78,148,4,0,0,0,40,63,58,41,0,0,0,0,0,16,81,98,222,174,231,240
+,10,0,0,0,82,97,110,103,101,69,114,114,111,114,0,0,0,0,0,0,0,12,81,97,190,190,46,45,3,0,0,0
+,114,97,119,0,0,0,0,0,0,16,81,98,86,144,20,58,14,0,0,0,82,101,102,101,114,101,110,99,101,69,114,114
+,111,114,0,0,0,16,81,98,190,110,77,200,11,0,0,0,82,101,102,108,101,99,116,46,103,101,116,0,0,0,0,0
+,0,16,81,98,134,147,132,73,11,0,0,0,82,101,102,108,101,99,116,46,104,97,115,0,0,0,0,0,0,12,81,97
+,70,48,159,17,6,0,0,0,82,101,103,69,120,112,0,0,0,16,81,98,38,244,62,39,15,0,0,0,91,111,98,106
+,101,99,116,32,82,101,103,69,120,112,93,0,0,12,81,97,158,106,148,196,7,0,0,0,114,101,115,111,108,118,101,0
+,0,12,81,97,126,187,159,95,6,0,0,0,114,101,116,117,114,110,0,0,0,12,81,97,6,10,43,255,6,0,0,0
+,114,101,118,111,107,101,0,0,0,16,81,98,22,200,233,34,12,0,0,0,82,117,110,116,105,109,101,69,114,114,111,114
+,0,0,0,0,0,12,81,97,102,141,60,139,6,0,0,0,83,99,114,105,112,116,0,0,0,12,81,97,182,223,0,200
+,6,0,0,0,115,99,114,105,112,116,0,0,0,12,81,97,166,246,44,85,5,0,0,0,115,104,111,114,116,0,0,0
+,0,12,81,97,134,1,212,113,3,0,0,0,83,101,116,0,0,0,0,0,0,12,81,97,174,75,195,225,8,0,0,0
+,115,101,110,116,101,110,99,101,0,12,81,97,214,224,165,211,4,0,0,0,115,101,116,32,0,0,0,0,0,12,81,97
+,254,35,22,111,3,0,0,0,115,101,116,0,0,0,0,0,0,16,81,98,118,53,138,5,12,0,0,0,83,101,116,32
+,73,116,101,114,97,116,111,114,0,0,0,0,0,16,81,98,238,18,207,182,14,0,0,0,115,101,116,80,114,111,116,111
+,116,121,112,101,79,102,0,0,0,20,81,99,166,76,151,171,17,0,0,0,83,104,97,114,101,100,65,114,114,97,121,66
+,117,102,102,101,114,0,0,0,0,0,0,0,0,12,81,97,222,37,234,45,6,0,0,0,115,111,117,114,99,101,0,0
+,0,16,81,98,230,152,76,85,10,0,0,0,115,111,117,114,99,101,84,101,120,116,0,0,0,0,0,0,0,12,81,97
+,142,2,229,225,5,0,0,0,115,116,97,99,107,0,0,0,0,16,81,98,38,211,86,199,15,0,0,0,115,116,97,99
+,107,84,114,97,99,101,76,105,109,105,116,0,0,12,81,97,158,209,174,62,6,0,0,0,115,116,105,99,107,121,0,0
+,0,12,81,97,238,240,244,95,6,0,0,0,83,116,114,105,110,103,0,0,0,12,81,97,246,102,120,162,6,0,0,0
+,115,116,114,105,110,103,0,0,0,16,81,98,166,141,22,149,15,0,0,0,91,111,98,106,101,99,116,32,83,116,114,105
+,110,103,93,0,0,16,81,98,238,51,181,31,16,0,0,0,91,83,121,109,98,111,108,46,115,112,101,99,105,101,115,93
+,0,12,81,97,134,118,253,165,6,0,0,0,83,121,109,98,111,108,0,0,0,12,81,97,78,184,63,30,6,0,0,0
+,115,121,109,98,111,108,0,0,0,16,81,98,134,228,136,46,11,0,0,0,83,121,110,116,97,120,69,114,114,111,114,0
+,0,0,0,0,0,12,81,97,230,32,30,35,6,0,0,0,116,97,114,103,101,116,0,0,0,12,81,97,182,145,82,222
+,4,0,0,0,116,104,101,110,0,0,0,0,0,16,81,98,214,110,248,119,14,0,0,0,46,116,104,105,115,95,102,117
+,110,99,116,105,111,110,0,0,8,0,129,154,0,12,81,97,158,145,237,211,5,0,0,0,116,104,114,111,119,0,0,0
+,0,16,81,98,118,163,214,55,9,0,0,0,116,105,109,101,100,45,111,117,116,0,0,0,0,0,0,0,0,12,81,97
+,166,244,142,11,6,0,0,0,116,111,74,83,79,78,0,0,0,12,81,97,110,24,94,8,8,0,0,0,116,111,83,116
+,114,105,110,103,8,0,129,22,0,12,81,97,166,59,151,50,5,0,0,0,116,111,116,97,108,0,0,0,0,16,81,98
+,38,210,218,60,9,0,0,0,84,121,112,101,69,114,114,111,114,0,0,0,0,0,0,0,0,16,81,98,150,74,35,224
+,11,0,0,0,85,105,110,116,49,54,65,114,114,97,121,0,0,0,0,0,0,16,81,98,62,131,18,58,11,0,0,0
+,85,105,110,116,51,50,65,114,114,97,121,0,0,0,0,0,0,16,81,98,182,146,16,56,10,0,0,0,85,105,110,116
+,56,65,114,114,97,121,0,0,0,0,0,0,0,20,81,99,38,95,220,23,17,0,0,0,85,105,110,116,56,67,108,97
+,109,112,101,100,65,114,114,97,121,0,0,0,0,0,0,0,150,0,20,81,99,22,76,32,18,18,0,0,0,91,111,98
+,106,101,99,116,32,85,110,100,101,102,105,110,101,100,93,0,0,0,0,0,0,0,12,81,97,54,28,79,22,7,0,0
+,0,117,110,105,99,111,100,101,0,0,12,81,97,46,106,155,24,8,0,0,0,85,82,73,69,114,114,111,114,0,12,81
+,97,86,210,45,139,5,0,0,0,118,97,108,117,101,0,0,0,0,12,81,97,94,91,15,97,7,0,0,0,118,97,108
+,117,101,79,102,0,0,12,81,97,174,254,139,155,7,0,0,0,87,101,97,107,77,97,112,0,0,12,81,97,46,214,214
+,227,7,0,0,0,87,101,97,107,82,101,102,0,0,12,81,97,190,127,188,51,7,0,0,0,87,101,97,107,83,101,116
+,0,0,12,81,97,142,70,196,155,4,0,0,0,119,101,101,107,0,0,0,0,0,12,81,97,166,239,53,136,4,0,0
+,0,119,111,114,100,0,0,0,0,0,12,81,97,110,30,130,193,8,0,0,0,119,114,105,116,97,98,108,101,0,12,81
+,97,0,0,0,8,1,0,0,0,48,0,0,0,0,0,0,0,0,12,79,96,242,54,29,32,1,0,0,0,68,0,12
+,79,96,50,62,220,146,1,0,0,0,68,0,12,79,96,242,237,95,250,1,0,0,0,68,0,12,79,96,42,155,33,66
+,1,0,0,0,68,0,12,79,96,66,79,239,78,1,0,0,0,68,0,12,79,96,50,106,99,246,1,0,0,0,68,0
+,12,79,96,202,139,229,68,1,0,0,0,68,0,12,79,96,122,129,45,199,1,0,0,0,68,0,12,79,96,138,177,251
+,171,1,0,0,0,68,0,12,79,96,90,227,170,38,1,0,0,0,68,0,12,79,96,42,89,125,240,1,0,0,0,68
+,0,12,79,96,10,34,53,121,1,0,0,0,68,0,12,79,96,114,28,155,252,1,0,0,0,68,0,12,79,96,202,84
+,75,121,1,0,0,0,68,0,12,79,96,154,44,230,183,1,0,0,0,68,0,12,79,96,162,239,92,41,1,0,0,0
+,68,0,12,79,96,58,136,236,95,1,0,0,0,68,0,12,79,96,42,52,228,36,1,0,0,0,68,0,12,79,96,10
+,112,155,230,1,0,0,0,68,0,12,79,96,82,135,255,215,1,0,0,0,68,0,12,79,96,138,137,221,27,1,0,0
+,0,68,0,12,79,96,218,27,30,147,1,0,0,0,68,0,12,79,96,194,113,215,171,1,0,0,0,68,0,12,79,96
+,186,157,63,11,1,0,0,0,68,0,12,79,96,202,253,246,148,1,0,0,0,68,0,12,79,96,74,104,227,167,1,0
+,0,0,68,0,12,79,96,202,208,14,254,1,0,0,0,68,0,12,79,96,178,2,206,63,1,0,0,0,68,0,12,79
+,96,26,209,124,103,1,0,0,0,68,0,12,79,96,10,53,220,18,1,0,0,0,68,0,12,79,96,194,61,63,3,0
+,0,0,0,0,20,81,99,6,147,18,217,20,0,0,0,83,121,109,98,111,108,46,97,115,121,110,99,73,116,101,114,97
+,116,111,114,0,0,0,0,0,12,79,96,122,50,141,104,0,0,0,0,0,16,81,98,54,172,78,233,15,0,0,0,83
+,121,109,98,111,108,46,105,116,101,114,97,116,111,114,0,0,12,79,96,186,156,92,131,0,0,0,0,0,16,81,98,30
+,135,52,103,12,0,0,0,73,110,116,108,70,97,108,108,98,97,99,107,0,0,0,0,0,12,79,96,90,231,7,215,0
+,0,0,0,0,16,81,98,110,80,97,100,15,0,0,0,83,121,109,98,111,108,46,109,97,116,99,104,65,108,108,0,0
+,12,79,96,146,179,169,178,0,0,0,0,0,16,81,98,14,53,173,82,12,0,0,0,83,121,109,98,111,108,46,109,97
+,116,99,104,0,0,0,0,0,12,79,96,50,51,186,10,0,0,0,0,0,16,81,98,54,64,33,46,14,0,0,0,83
+,121,109,98,111,108,46,114,101,112,108,97,99,101,0,0,0,12,79,96,210,34,255,124,0,0,0,0,0,16,81,98,14
+,171,162,187,13,0,0,0,83,121,109,98,111,108,46,115,101,97,114,99,104,0,0,0,0,12,79,96,66,140,199,212,0
+,0,0,0,0,16,81,98,166,185,78,15,14,0,0,0,83,121,109,98,111,108,46,115,112,101,99,105,101,115,0,0,0
+,12,79,96,250,238,185,171,0,0,0,0,0,16,81,98,134,147,105,178,12,0,0,0,83,121,109,98,111,108,46,115,112
+,108,105,116,0,0,0,0,0,12,79,96,42,17,7,59,0,0,0,0,0,20,81,99,78,111,54,77,18,0,0,0,83
+,121,109,98,111,108,46,116,111,80,114,105,109,105,116,105,118,101,0,0,0,0,0,0,0,12,79,96,10,65,206,12,0
+,0,0,0,0,20,81,99,150,16,142,47,18,0,0,0,83,121,109,98,111,108,46,117,110,115,99,111,112,97,98,108,101
+,115,0,0,0,0,0,0,0,12,79,96,114,140,74,38,2,0,0,0,0,20,81,99,6,35,171,110,18,0,0,0,83
+,121,109,98,111,108,46,104,97,115,73,110,115,116,97,110,99,101,0,0,0,0,0,0,0,12,79,96,178,97,100,152,2
+,0,0,0,0,24,81,100,230,185,131,108,25,0,0,0,83,121,109,98,111,108,46,105,115,67,111,110,99,97,116,83,112
+,114,101,97,100,97,98,108,101,0,0,0,0,0,0,0,0,12,79,96,250,5,240,166,10,0,0,0,0,20,81,99,166
+,19,253,152,18,0,0,0,83,121,109,98,111,108,46,116,111,83,116,114,105,110,103,84,97,103,0,0,0,0,0,0,0
+,40,74,97,5,0,0,45,71,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,17
+,253,1,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,5,0,0,45,72,0,0,24,255
+,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,40,74,97,3,0,0,45,73,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0
+,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,3,0,0,45,74
+,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,40,74,97,5,0,0,45,75,0,0,24,255,3,64,0,0,0,0,0,128,70,94
+,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,14
+,0,0,45,78,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,8,0,0,45,79,0,0,24,255,3,64,0,0,0,0
+,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,40,74,97,3,0,0,45,80,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148
+,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,4,0,0,45,81,0,0,24,255,3,64
+,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,40,74,97,5,0,0,45,82,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0
+,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,8,0,0,45,83,0,0
+,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,40,74,97,3,0,0,45,84,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0
+,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,2,0,0
+,45,85,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,2,0,0,45,86,0,0,24,255,3,64,0,0,0,0,0,128
+,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,161
+,140,0,40,74,97,5,0,0,45,89,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0
+,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,5,0,0,45,90,0,0,24,255
+,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,40,74,97,3,0,0,45,92,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0
+,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,9,0,0,45,93
+,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,8,0,33,138,0,40,74,97,9,0,0,45,96,0,0,24,255,3,64,0,0,0,0
+,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8
+,0,97,148,0,40,74,97,3,0,0,45,99,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0
+,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,4,0,0,45,100,0,0
+,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,40,74,97,5,0,0,45,101,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0
+,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,7,0,0
+,37,102,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,16,0,0,45,103,0,0,24,255,3,64,0,0,0,0,0,128
+,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74
+,97,3,0,0,45,107,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,8,0,0,45,108,0,0,24,255,3,64,0,0
+,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,40,74,97,14,0,0,45,109,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0
+,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,5,0,0,45,110,0,0,24,255
+,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,40,74,97,3,0,0,45,111,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0
+,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,5,0,0,52,112
+,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,40,74,97,7,0,0,45,113,0,0,24,255,3,64,0,0,0,0,0,128,70,94
+,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,2
+,0,0,45,114,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,8,0,0,45,115,0,0,24,255,3,64,0,0,0,0
+,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,40,74,97,6,0,0,53,116,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148
+,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,6,0,0,45,117,0,0,24,255,3,64
+,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,40,74,97,17,0,0,45,106,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0
+,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,3,0,0,45,98,0,0
+,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,40,74,97,3,0,0,45,105,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0
+,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,3,0,0
+,45,104,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,6,0,0,7,87,0,0,24,255,3,64,0,0,0,0,0,128
+,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74
+,97,5,0,0,7,87,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,4,0,0,14,76,0,0,24,255,3,64,0,0
+,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,40,74,97,5,0,0,14,76,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0
+,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,6,0,0,14,76,0,0,24,255
+,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,40,74,97,3,0,0,14,77,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0
+,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,4,0,0,14,77
+,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,40,74,97,5,0,0,14,77,0,0,24,255,3,64,0,0,0,0,0,128,70,94
+,96,0,0,0,0,0,0,0,0,148,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,74,97,6
+,0,0,14,77,0,0,24,255,3,64,0,0,0,0,0,128,70,94,96,0,0,0,0,0,0,0,0,148,97,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,12,81,97,198,224,152,81,1,0,0,0,36,0,0,0,0,0
+,0,0,0,12,81,97,118,172,231,184,8,0,0,0,84,111,79,98,106,101,99,116,0,8,89,96,255,255,255,255,255,255
+,63,67,0,24,81,100,238,183,142,233,29,0,0,0,65,114,114,97,121,32,73,116,101,114,97,116,111,114,46,112,114,111
+,116,111,116,121,112,101,46,110,101,120,116,0,0,0,0,8,89,96,255,255,255,255,255,255,63,67,0,8,89,96,0,0
+,224,255,255,255,239,65,0,8,89,96,255,255,255,255,255,255,63,67,0,8,89,96,255,255,255,255,255,255,63,67,0,24
+,81,100,198,33,88,149,26,0,0,0,66,111,111,108,101,97,110,46,112,114,111,116,111,116,121,112,101,46,116,111,83,116
+,114,105,110,103,0,0,0,0,0,0,0,24,81,100,134,159,156,59,25,0,0,0,66,111,111,108,101,97,110,46,112,114
+,111,116,111,116,121,112,101,46,118,97,108,117,101,79,102,0,0,0,0,0,0,0,0,24,81,100,46,209,126,132,32,0
+,0,0,68,97,116,101,46,112,114,111,116,111,116,121,112,101,32,91,32,64,64,116,111,80,114,105,109,105,116,105,118,101
+,32,93,0,24,81,100,62,5,66,115,26,0,0,0,91,71,101,110,101,114,97,116,111,114,93,46,112,114,111,116,111,116
+,121,112,101,46,110,101,120,116,0,0,0,0,0,0,0,24,81,100,214,85,237,85,28,0,0,0,91,71,101,110,101,114
+,97,116,111,114,93,46,112,114,111,116,111,116,121,112,101,46,114,101,116,117,114,110,0,0,0,0,0,24,81,100,38,186
+,74,57,27,0,0,0,91,71,101,110,101,114,97,116,111,114,93,46,112,114,111,116,111,116,121,112,101,46,116,104,114,111
+,119,0,0,0,0,0,0,20,81,99,246,113,84,234,17,0,0,0,77,97,112,46,112,114,111,116,111,116,121,112,101,46
+,115,101,116,0,0,0,0,0,0,0,0,20,81,99,14,37,174,235,20,0,0,0,77,97,112,46,112,114,111,116,111,116
+,121,112,101,46,100,101,108,101,116,101,0,0,0,0,0,20,81,99,142,250,236,9,17,0,0,0,77,97,112,46,112,114
+,111,116,111,116,121,112,101,46,103,101,116,0,0,0,0,0,0,0,0,20,81,99,110,197,62,79,17,0,0,0,77,97
+,112,46,112,114,111,116,111,116,121,112,101,46,104,97,115,0,0,0,0,0,0,0,0,20,81,99,206,157,206,43,21,0
+,0,0,77,97,112,46,112,114,111,116,111,116,121,112,101,46,101,110,116,114,105,101,115,0,0,0,0,20,81,99,102,118
+,39,165,22,0,0,0,103,101,116,32,77,97,112,46,112,114,111,116,111,116,121,112,101,46,115,105,122,101,0,0,0,20
+,81,99,206,131,211,157,21,0,0,0,77,97,112,46,112,114,111,116,111,116,121,112,101,46,102,111,114,69,97,99,104,0
+,0,0,0,20,81,99,246,231,115,11,18,0,0,0,77,97,112,46,112,114,111,116,111,116,121,112,101,46,107,101,121,115
+,0,0,0,0,0,0,0,20,81,99,22,130,45,31,20,0,0,0,77,97,112,46,112,114,111,116,111,116,121,112,101,46
+,118,97,108,117,101,115,0,0,0,0,0,24,81,100,126,74,85,174,27,0,0,0,77,97,112,32,73,116,101,114,97,116
+,111,114,46,112,114,111,116,111,116,121,112,101,46,110,101,120,116,0,0,0,0,0,0,8,89,96,0,0,0,0,0,0
+,224,65,0,20,81,99,30,64,34,112,24,0,0,0,78,117,109,98,101,114,46,112,114,111,116,111,116,121,112,101,46,118
+,97,108,117,101,79,102,0,24,81,100,142,12,25,123,31,0,0,0,79,98,106,101,99,116,46,112,114,111,116,111,116,121
+,112,101,46,116,111,76,111,99,97,108,101,83,116,114,105,110,103,0,0,12,81,97,150,79,176,29,8,0,0,0,91,111
+,98,106,101,99,116,32,0,12,81,97,30,162,117,178,1,0,0,0,93,0,0,0,0,0,0,0,0,20,81,99,134,130
+,137,146,22,0,0,0,80,114,111,109,105,115,101,46,112,114,111,116,111,116,121,112,101,46,116,104,101,110,0,0,0,16
+,81,98,62,216,200,76,14,0,0,0,80,114,111,109,105,115,101,82,101,115,111,108,118,101,0,0,0,16,81,98,214,246
+,121,47,13,0,0,0,80,114,111,109,105,115,101,82,101,106,101,99,116,0,0,0,0,24,81,100,30,246,0,13,25,0
+,0,0,80,114,111,109,105,115,101,46,112,114,111,116,111,116,121,112,101,46,102,105,110,97,108,108,121,0,0,0,0,0
+,0,0,0,16,81,98,142,212,166,78,11,0,0,0,80,114,111,109,105,115,101,46,97,108,108,0,0,0,0,0,0,16
+,81,98,222,91,248,198,12,0,0,0,80,114,111,109,105,115,101,46,114,97,99,101,0,0,0,0,0,12,81,97,174,255
+,82,251,6,0,0,0,115,116,97,116,117,115,0,0,0,16,81,98,6,21,254,76,9,0,0,0,102,117,108,102,105,108
+,108,101,100,0,0,0,0,0,0,0,0,12,81,97,38,0,91,213,8,0,0,0,114,101,106,101,99,116,101,100,0,12
+,81,97,190,106,10,92,6,0,0,0,114,101,97,115,111,110,0,0,0,20,81,99,54,100,58,147,24,0,0,0,82,101
+,103,69,120,112,46,112,114,111,116,111,116,121,112,101,46,99,111,109,112,105,108,101,0,20,81,99,182,14,18,155,17,0
+,0,0,83,101,116,46,112,114,111,116,111,116,121,112,101,46,104,97,115,0,0,0,0,0,0,0,0,20,81,99,30,109
+,213,16,17,0,0,0,83,101,116,46,112,114,111,116,111,116,121,112,101,46,97,100,100,0,0,0,0,0,0,0,0,20
+,81,99,206,137,73,199,20,0,0,0,83,101,116,46,112,114,111,116,111,116,121,112,101,46,100,101,108,101,116,101,0,0
+,0,0,0,20,81,99,246,151,83,41,21,0,0,0,83,101,116,46,112,114,111,116,111,116,121,112,101,46,101,110,116,114
+,105,101,115,0,0,0,0,20,81,99,190,248,230,245,22,0,0,0,103,101,116,32,83,101,116,46,112,114,111,116,111,116
+,121,112,101,46,115,105,122,101,0,0,0,20,81,99,46,118,253,77,21,0,0,0,83,101,116,46,112,114,111,116,111,116
+,121,112,101,46,102,111,114,69,97,99,104,0,0,0,0,20,81,99,214,247,59,53,20,0,0,0,83,101,116,46,112,114
+,111,116,111,116,121,112,101,46,118,97,108,117,101,115,0,0,0,0,0,24,81,100,158,22,120,131,27,0,0,0,83,101
+,116,32,73,116,101,114,97,116,111,114,46,112,114,111,116,111,116,121,112,101,46,110,101,120,116,0,0,0,0,0,0,20
+,81,99,214,152,226,226,22,0,0,0,83,116,114,105,110,103,46,112,114,111,116,111,116,121,112,101,46,109,97,116,99,104
+,0,0,0,12,81,97,38,200,130,69,1,0,0,0,103,0,0,0,0,0,0,0,0,12,81,97,238,207,86,73,1,0
+,0,0,117,0,0,0,0,0,0,0,0,24,81,100,158,117,4,142,25,0,0,0,83,116,114,105,110,103,46,112,114,111
+,116,111,116,121,112,101,46,109,97,116,99,104,65,108,108,0,0,0,0,0,0,0,0,24,81,100,78,134,78,234,27,0
+,0,0,82,101,103,69,120,112,46,112,114,111,116,111,116,121,112,101,46,64,64,109,97,116,99,104,65,108,108,0,0,0
+,0,0,0,20,81,99,78,103,199,85,24,0,0,0,83,116,114,105,110,103,46,112,114,111,116,111,116,121,112,101,46,114
+,101,112,108,97,99,101,0,20,81,99,94,140,93,61,23,0,0,0,83,116,114,105,110,103,46,112,114,111,116,111,116,121
+,112,101,46,115,101,97,114,99,104,0,0,8,89,96,0,0,224,255,255,255,239,65,0,20,81,99,174,89,89,0,22,0
+,0,0,83,116,114,105,110,103,46,112,114,111,116,111,116,121,112,101,46,115,112,108,105,116,0,0,0,20,81,99,102,33
+,234,245,23,0,0,0,83,116,114,105,110,103,46,112,114,111,116,111,116,121,112,101,46,115,117,98,115,116,114,0,0,20
+,81,99,222,249,52,57,21,0,0,0,83,116,114,105,110,103,46,112,114,111,116,111,116,121,112,101,46,116,114,105,109,0
+,0,0,0,24,81,100,22,253,159,76,26,0,0,0,83,116,114,105,110,103,46,112,114,111,116,111,116,121,112,101,46,116
+,114,105,109,82,105,103,104,116,0,0,0,0,0,0,0,24,81,100,6,167,130,90,25,0,0,0,83,116,114,105,110,103
+,46,112,114,111,116,111,116,121,112,101,46,116,114,105,109,76,101,102,116,0,0,0,0,0,0,0,0,24,81,100,78,115
+,226,47,28,0,0,0,83,121,109,98,111,108,46,112,114,111,116,111,116,121,112,101,46,100,101,115,99,114,105,112,116,105
+,111,110,0,0,0,0,0,28,81,101,134,167,63,190,34,0,0,0,83,121,109,98,111,108,46,112,114,111,116,111,116,121
+,112,101,32,91,32,64,64,116,111,80,114,105,109,105,116,105,118,101,32,93,0,0,0,0,0,0,0,24,81,100,6,50
+,167,134,25,0,0,0,83,121,109,98,111,108,46,112,114,111,116,111,116,121,112,101,46,116,111,83,116,114,105,110,103,0
+,0,0,0,0,0,0,0,20,81,99,246,44,219,209,24,0,0,0,83,121,109,98,111,108,46,112,114,111,116,111,116,121
+,112,101,46,118,97,108,117,101,79,102,0,16,81,98,166,1,120,249,10,0,0,0,84,121,112,101,100,65,114,114,97,121
+,0,0,0,0,0,0,0,28,81,101,150,187,168,164,35,0,0,0,103,101,116,32,84,121,112,101,100,65,114,114,97,121
+,46,112,114,111,116,111,116,121,112,101,46,98,121,116,101,76,101,110,103,116,104,0,0,0,0,0,0,28,81,101,206,112
+,249,43,35,0,0,0,103,101,116,32,84,121,112,101,100,65,114,114,97,121,46,112,114,111,116,111,116,121,112,101,46,98
+,121,116,101,79,102,102,115,101,116,0,0,0,0,0,0,24,81,100,62,73,119,165,31,0,0,0,103,101,116,32,84,121
+,112,101,100,65,114,114,97,121,46,112,114,111,116,111,116,121,112,101,46,108,101,110,103,116,104,0,0,24,81,100,230,33
+,86,152,32,0,0,0,37,84,121,112,101,100,65,114,114,97,121,37,46,112,114,111,116,111,116,121,112,101,46,101,110,116
+,114,105,101,115,40,41,0,24,81,100,110,178,178,143,29,0,0,0,37,84,121,112,101,100,65,114,114,97,121,37,46,112
+,114,111,116,111,116,121,112,101,46,107,101,121,115,40,41,0,0,0,0,24,81,100,142,225,137,65,31,0,0,0,37,84
+,121,112,101,100,65,114,114,97,121,37,46,112,114,111,116,111,116,121,112,101,46,118,97,108,117,101,115,40,41,0,0,24
+,81,100,38,122,115,237,26,0,0,0,37,84,121,112,101,100,65,114,114,97,121,37,46,112,114,111,116,111,116,121,112,101
+,46,115,101,116,0,0,0,0,0,0,0,24,81,100,30,151,45,26,26,0,0,0,37,84,121,112,101,100,65,114,114,97
+,121,37,46,112,114,111,116,111,116,121,112,101,46,109,97,112,0,0,0,0,0,0,0,16,81,98,30,224,36,46,15,0
+,0,0,37,84,121,112,101,100,65,114,114,97,121,37,46,111,102,0,0,20,81,99,174,33,254,103,17,0,0,0,37,84
+,121,112,101,100,65,114,114,97,121,37,46,102,114,111,109,0,0,0,0,0,0,0,0,20,81,99,150,216,85,59,21,0
+,0,0,87,101,97,107,77,97,112,46,112,114,111,116,111,116,121,112,101,46,103,101,116,0,0,0,0,20,81,99,118,42
+,51,56,21,0,0,0,87,101,97,107,77,97,112,46,112,114,111,116,111,116,121,112,101,46,104,97,115,0,0,0,0,20
+,81,99,126,57,242,54,21,0,0,0,87,101,97,107,77,97,112,46,112,114,111,116,111,116,121,112,101,46,115,101,116,0
+,0,0,0,20,81,99,38,37,137,129,24,0,0,0,87,101,97,107,77,97,112,46,112,114,111,116,111,116,121,112,101,46
+,100,101,108,101,116,101,0,20,81,99,22,69,225,112,21,0,0,0,87,101,97,107,83,101,116,46,112,114,111,116,111,116
+,121,112,101,46,104,97,115,0,0,0,0,20,81,99,198,54,159,20,21,0,0,0,87,101,97,107,83,101,116,46,112,114
+,111,116,111,116,121,112,101,46,97,100,100,0,0,0,0,20,81,99,110,251,181,29,24,0,0,0,87,101,97,107,83,101
+,116,46,112,114,111,116,111,116,121,112,101,46,100,101,108,101,116,101,0,24,81,100,158,66,197,199,31,0,0,0,91,65
+,115,121,110,99,71,101,110,101,114,97,116,111,114,93,46,112,114,111,116,111,116,121,112,101,46,110,101,120,116,0,0,28
+,81,101,166,31,207,8,33,0,0,0,91,65,115,121,110,99,71,101,110,101,114,97,116,111,114,93,46,112,114,111,116,111
+,116,121,112,101,46,114,101,116,117,114,110,0,0,0,0,0,0,0,0,24,81,100,182,46,180,188,32,0,0,0,91,65
+,115,121,110,99,71,101,110,101,114,97,116,111,114,93,46,112,114,111,116,111,116,121,112,101,46,116,104,114,111,119,0,32
+,81,102,94,204,70,19,41,0,0,0,91,65,115,121,110,99,45,102,114,111,109,45,83,121,110,99,32,73,116,101,114,97
+,116,111,114,93,46,112,114,111,116,111,116,121,112,101,46,110,101,120,116,0,0,0,0,0,0,0,0,32,81,102,198,148
+,229,51,42,0,0,0,91,65,115,121,110,99,45,102,114,111,109,45,83,121,110,99,32,73,116,101,114,97,116,111,114,93
+,46,112,114,111,116,111,116,121,112,101,46,116,104,114,111,119,0,0,0,0,0,0,0,32,81,102,166,127,128,140,43,0
+,0,0,91,65,115,121,110,99,45,102,114,111,109,45,83,121,110,99,32,73,116,101,114,97,116,111,114,93,46,112,114,111
+,116,111,116,121,112,101,46,114,101,116,117,114,110,0,0,0,0,0,0,20,81,99,78,97,120,246,22,0,0,0,91,65
+,115,121,110,99,77,111,100,117,108,101,93,46,101,118,97,108,117,97,116,101,0,0,0,20,81,99,158,28,123,6,21,0
+,0,0,65,114,114,97,121,46,112,114,111,116,111,116,121,112,101,46,101,118,101,114,121,0,0,0,0,20,81,99,254,160
+,157,49,22,0,0,0,65,114,114,97,121,46,112,114,111,116,111,116,121,112,101,46,102,105,108,116,101,114,0,0,0,20
+,81,99,6,207,17,213,20,0,0,0,65,114,114,97,121,46,112,114,111,116,111,116,121,112,101,46,102,105,110,100,0,0
+,0,0,0,24,81,100,142,218,95,64,25,0,0,0,65,114,114,97,121,46,112,114,111,116,111,116,121,112,101,46,102,105
+,110,100,73,110,100,101,120,0,0,0,0,0,0,0,0,20,81,99,22,14,137,184,23,0,0,0,65,114,114,97,121,46
+,112,114,111,116,111,116,121,112,101,46,102,111,114,69,97,99,104,0,0,16,81,98,198,70,101,140,14,0,0,0,116,111
+,76,111,99,97,108,101,83,116,114,105,110,103,0,0,0,8,89,96,0,0,224,255,255,255,239,65,0,12,81,97,46,237
+,183,215,1,0,0,0,44,0,0,0,0,0,0,0,0,8,89,96,0,0,224,255,255,255,239,65,0,12,81,97,22,195
+,178,137,4,0,0,0,106,111,105,110,0,0,0,0,0,24,81,100,238,161,223,81,27,0,0,0,37,84,121,112,101,100
+,65,114,114,97,121,37,46,112,114,111,116,111,116,121,112,101,46,106,111,105,110,0,0,0,0,0,0,28,81,101,126,88
+,69,122,37,0,0,0,37,84,121,112,101,100,65,114,114,97,121,37,46,112,114,111,116,111,116,121,112,101,46,116,111,76
+,111,99,97,108,101,83,116,114,105,110,103,0,0,0,0,20,81,99,254,70,204,72,19,0,0,0,65,114,114,97,121,46
+,112,114,111,116,111,116,121,112,101,46,109,97,112,0,0,0,0,0,0,24,81,100,54,79,17,205,27,0,0,0,65,114
+,114,97,121,46,112,114,111,116,111,116,121,112,101,46,114,101,100,117,99,101,82,105,103,104,116,0,0,0,0,0,0,20
+,81,99,190,147,67,43,22,0,0,0,65,114,114,97,121,46,112,114,111,116,111,116,121,112,101,46,114,101,100,117,99,101
+,0,0,0,20,81,99,54,248,255,95,20,0,0,0,65,114,114,97,121,46,112,114,111,116,111,116,121,112,101,46,115,111
+,109,101,0,0,0,0,0,8,89,96,255,255,255,255,255,255,63,67,0,8,89,96,255,255,255,255,255,255,63,67,0,32
+,81,102,222,136,63,239,45,0,0,0,82,97,110,103,101,32,116,121,112,101,32,97,115,115,101,114,116,105,111,110,32,102
+,97,105,108,101,100,33,32,40,118,97,108,117,101,47,109,105,110,47,109,97,120,41,10,0,0,0,0,24,81,100,22,129
+,96,237,29,0,0,0,103,101,116,32,68,97,116,97,86,105,101,119,46,112,114,111,116,111,116,121,112,101,46,98,117,102
+,102,101,114,0,0,0,0,28,81,101,182,190,138,15,34,0,0,0,103,101,116,32,68,97,116,97,86,105,101,119,46,112
+,114,111,116,111,116,121,112,101,46,98,121,116,101,95,108,101,110,103,116,104,0,0,0,0,0,0,0,28,81,101,86,119
+,204,67,34,0,0,0,103,101,116,32,68,97,116,97,86,105,101,119,46,112,114,111,116,111,116,121,112,101,46,98,121,116
+,101,95,111,102,102,115,101,116,0,0,0,0,0,0,0,8,89,96,255,255,255,255,255,255,63,67,0,24,81,100,190,133
+,245,255,27,0,0,0,68,97,116,97,86,105,101,119,46,112,114,111,116,111,116,121,112,101,46,103,101,116,85,105,110,116
+,56,0,0,0,0,0,0,8,89,96,255,255,255,255,255,255,63,67,0,24,81,100,222,4,46,82,26,0,0,0,68,97
+,116,97,86,105,101,119,46,112,114,111,116,111,116,121,112,101,46,103,101,116,73,110,116,56,0,0,0,0,0,0,0,8
+,89,96,255,255,255,255,255,255,63,67,0,24,81,100,238,247,251,210,28,0,0,0,68,97,116,97,86,105,101,119,46,112
+,114,111,116,111,116,121,112,101,46,103,101,116,85,105,110,116,49,54,0,0,0,0,0,8,89,96,255,255,255,255,255,255
+,63,67,0,24,81,100,30,0,219,111,27,0,0,0,68,97,116,97,86,105,101,119,46,112,114,111,116,111,116,121,112,101
+,46,103,101,116,73,110,116,49,54,0,0,0,0,0,0,8,89,96,255,255,255,255,255,255,63,67,0,24,81,100,30,47
+,41,83,28,0,0,0,68,97,116,97,86,105,101,119,46,112,114,111,116,111,116,121,112,101,46,103,101,116,85,105,110,116
+,51,50,0,0,0,0,0,8,89,96,255,255,255,255,255,255,63,67,0,24,81,100,126,96,205,150,27,0,0,0,68,97
+,116,97,86,105,101,119,46,112,114,111,116,111,116,121,112,101,46,103,101,116,73,110,116,51,50,0,0,0,0,0,0,8
+,89,96,255,255,255,255,255,255,63,67,0,24,81,100,38,75,142,228,29,0,0,0,68,97,116,97,86,105,101,119,46,112
+,114,111,116,111,116,121,112,101,46,103,101,116,70,108,111,97,116,51,50,0,0,0,0,8,89,96,255,255,255,255,255,255
+,63,67,0,24,81,100,150,58,54,239,29,0,0,0,68,97,116,97,86,105,101,119,46,112,114,111,116,111,116,121,112,101
+,46,103,101,116,70,108,111,97,116,54,52,0,0,0,0,8,89,96,255,255,255,255,255,255,63,67,0,24,81,100,222,132
+,3,36,31,0,0,0,68,97,116,97,86,105,101,119,46,112,114,111,116,111,116,121,112,101,46,103,101,116,66,105,103,85
+,105,110,116,54,52,0,0,8,89,96,255,255,255,255,255,255,63,67,0,24,81,100,78,53,10,134,30,0,0,0,68,97
+,116,97,86,105,101,119,46,112,114,111,116,111,116,121,112,101,46,103,101,116,66,105,103,73,110,116,54,52,0,0,0,8
+,89,96,255,255,255,255,255,255,63,67,0,24,81,100,214,228,239,39,27,0,0,0,68,97,116,97,86,105,101,119,46,112
+,114,111,116,111,116,121,112,101,46,115,101,116,85,105,110,116,56,0,0,0,0,0,0,8,89,96,255,255,255,255,255,255
+,63,67,0,24,81,100,86,163,27,208,26,0,0,0,68,97,116,97,86,105,101,119,46,112,114,111,116,111,116,121,112,101
+,46,115,101,116,73,110,116,56,0,0,0,0,0,0,0,8,89,96,255,255,255,255,255,255,63,67,0,24,81,100,158,178
+,36,48,28,0,0,0,68,97,116,97,86,105,101,119,46,112,114,111,116,111,116,121,112,101,46,115,101,116,85,105,110,116
+,49,54,0,0,0,0,0,8,89,96,255,255,255,255,255,255,63,67,0,24,81,100,214,150,225,4,27,0,0,0,68,97
+,116,97,86,105,101,119,46,112,114,111,116,111,116,121,112,101,46,115,101,116,73,110,116,49,54,0,0,0,0,0,0,8
+,89,96,255,255,255,255,255,255,63,67,0,24,81,100,174,52,63,69,28,0,0,0,68,97,116,97,86,105,101,119,46,112
+,114,111,116,111,116,121,112,101,46,115,101,116,85,105,110,116,51,50,0,0,0,0,0,8,89,96,255,255,255,255,255,255
+,63,67,0,24,81,100,22,2,66,30,27,0,0,0,68,97,116,97,86,105,101,119,46,112,114,111,116,111,116,121,112,101
+,46,115,101,116,73,110,116,51,50,0,0,0,0,0,0,8,89,96,255,255,255,255,255,255,63,67,0,24,81,100,230,69
+,51,33,29,0,0,0,68,97,116,97,86,105,101,119,46,112,114,111,116,111,116,121,112,101,46,115,101,116,70,108,111,97
+,116,51,50,0,0,0,0,8,89,96,255,255,255,255,255,255,63,67,0,24,81,100,54,218,87,108,29,0,0,0,68,97
+,116,97,86,105,101,119,46,112,114,111,116,111,116,121,112,101,46,115,101,116,70,108,111,97,116,54,52,0,0,0,0,8
+,89,96,255,255,255,255,255,255,63,67,0,24,81,100,238,244,241,106,31,0,0,0,68,97,116,97,86,105,101,119,46,112
+,114,111,116,111,116,121,112,101,46,115,101,116,66,105,103,85,105,110,116,54,52,0,0,8,89,96,255,255,255,255,255,255
+,63,67,0,24,81,100,86,134,39,212,30,0,0,0,68,97,116,97,86,105,101,119,46,112,114,111,116,111,116,121,112,101
+,46,115,101,116,66,105,103,73,110,116,54,52,0,0,0,8,89,96,0,0,0,0,0,0,240,127,0,20,81,99,222,89
+,177,138,21,0,0,0,79,98,106,101,99,116,46,115,101,116,80,114,111,116,111,116,121,112,101,79,102,0,0,0,0,16
+,81,98,70,41,172,151,15,0,0,0,80,114,111,120,121,46,114,101,118,111,99,97,98,108,101,0,0,20,81,99,54,59
+,133,113,20,0,0,0,82,101,102,108,101,99,116,46,105,115,69,120,116,101,110,115,105,98,108,101,0,0,0,0,0,24
+,81,100,238,219,84,172,25,0,0,0,82,101,102,108,101,99,116,46,112,114,101,118,101,110,116,69,120,116,101,110,115,105
+,111,110,115,0,0,0,0,0,0,0,0,20,81,99,206,154,216,31,22,0,0,0,82,101,102,108,101,99,116,46,103,101
+,116,80,114,111,116,111,116,121,112,101,79,102,0,0,0,20,81,99,150,6,198,101,22,0,0,0,82,101,102,108,101,99
+,116,46,115,101,116,80,114,111,116,111,116,121,112,101,79,102,0,0,0,20,81,99,166,40,7,90,22,0,0,0,82,101
+,102,108,101,99,116,46,100,101,108,101,116,101,80,114,111,112,101,114,116,121,0,0,0,20,81,99,222,167,241,239,21,0
+,0,0,82,101,103,69,120,112,46,112,114,111,116,111,116,121,112,101,46,101,120,101,99,0,0,0,0,28,81,101,198,172
+,200,42,37,0,0,0,37,82,101,103,69,120,112,83,116,114,105,110,103,73,116,101,114,97,116,111,114,37,46,112,114,111
+,116,111,116,121,112,101,46,110,101,120,116,0,0,0,0,20,81,99,6,100,133,156,24,0,0,0,82,101,103,69,120,112
+,46,112,114,111,116,111,116,121,112,101,46,64,64,109,97,116,99,104,0,24,81,100,206,129,207,187,26,0,0,0,82,101
+,103,69,120,112,46,112,114,111,116,111,116,121,112,101,46,64,64,114,101,112,108,97,99,101,0,0,0,0,0,0,0,24
+,81,100,14,247,222,193,25,0,0,0,82,101,103,69,120,112,46,112,114,111,116,111,116,121,112,101,46,64,64,115,101,97
+,114,99,104,0,0,0,0,0,0,0,0,20,81,99,54,160,198,157,23,0,0,0,82,101,103,69,120,112,46,112,114,111
+,116,111,116,121,112,101,46,115,111,117,114,99,101,0,0,20,81,99,166,192,93,39,24,0,0,0,82,101,103,69,120,112
+,46,112,114,111,116,111,116,121,112,101,46,64,64,115,112,108,105,116,0,20,81,99,22,123,230,241,21,0,0,0,82,101
+,103,69,120,112,46,112,114,111,116,111,116,121,112,101,46,116,101,115,116,0,0,0,0,20,81,99,102,11,181,98,23,0
+,0,0,82,101,103,69,120,112,46,112,114,111,116,111,116,121,112,101,46,103,108,111,98,97,108,0,0,24,81,100,86,245
+,210,211,27,0,0,0,82,101,103,69,120,112,46,112,114,111,116,111,116,121,112,101,46,105,103,110,111,114,101,67,97,115
+,101,0,0,0,0,0,0,24,81,100,78,80,54,60,26,0,0,0,82,101,103,69,120,112,46,112,114,111,116,111,116,121
+,112,101,46,109,117,108,116,105,108,105,110,101,0,0,0,0,0,0,0,20,81,99,166,35,115,210,23,0,0,0,82,101
+,103,69,120,112,46,112,114,111,116,111,116,121,112,101,46,100,111,116,65,108,108,0,0,20,81,99,54,229,136,136,23,0
+,0,0,82,101,103,69,120,112,46,112,114,111,116,111,116,121,112,101,46,115,116,105,99,107,121,0,0,20,81,99,166,8
+,195,170,24,0,0,0,82,101,103,69,120,112,46,112,114,111,116,111,116,121,112,101,46,117,110,105,99,111,100,101,0,20
+,81,99,30,9,152,235,22,0,0,0,82,101,103,69,120,112,46,112,114,111,116,111,116,121,112,101,46,102,108,97,103,115
+,0,0,0,24,81,100,126,173,34,110,25,0,0,0,83,116,114,105,110,103,46,112,114,111,116,111,116,121,112,101,46,116
+,111,83,116,114,105,110,103,0,0,0,0,0,0,0,0,20,81,99,6,73,58,214,24,0,0,0,83,116,114,105,110,103
+,46,112,114,111,116,111,116,121,112,101,46,118,97,108,117,101,79,102,0,20,81,99,246,16,62,29,23,0,0,0,83,116
+,114,105,110,103,46,112,114,111,116,111,116,121,112,101,46,99,104,97,114,65,116,0,0,24,81,100,214,122,186,49,27,0
+,0,0,83,116,114,105,110,103,46,112,114,111,116,111,116,121,112,101,46,99,104,97,114,67,111,100,101,65,116,0,0,0
+,0,0,0,24,81,100,46,131,236,113,28,0,0,0,83,116,114,105,110,103,46,112,114,111,116,111,116,121,112,101,46,99
+,111,100,101,80,111,105,110,116,65,116,0,0,0,0,0,20,81,99,78,65,76,135,23,0,0,0,83,116,114,105,110,103
+,46,112,114,111,116,111,116,121,112,101,46,99,111,110,99,97,116,0,0,24,81,100,158,228,216,48,25,0,0,0,83,116
+,114,105,110,103,46,112,114,111,116,111,116,121,112,101,46,101,110,100,115,87,105,116,104,0,0,0,0,0,0,0,0,12
+,81,97,118,54,77,124,1,0,0,0,60,0,0,0,0,0,0,0,0,12,81,97,150,112,125,153,1,0,0,0,32,0
+,0,0,0,0,0,0,0,12,81,97,62,196,42,152,2,0,0,0,61,34,0,0,0,0,0,0,0,12,81,97,166,77
+,7,136,1,0,0,0,34,0,0,0,0,0,0,0,0,12,81,97,142,97,219,145,1,0,0,0,62,0,0,0,0,0
+,0,0,0,12,81,97,78,121,77,229,2,0,0,0,60,47,0,0,0,0,0,0,0,20,81,99,254,27,197,19,23,0
+,0,0,83,116,114,105,110,103,46,112,114,111,116,111,116,121,112,101,46,97,110,99,104,111,114,0,0,12,81,97,102,113
+,29,154,1,0,0,0,97,0,0,0,0,0,0,0,0,20,81,99,94,118,86,211,20,0,0,0,83,116,114,105,110,103
+,46,112,114,111,116,111,116,121,112,101,46,98,105,103,0,0,0,0,0,12,81,97,86,152,227,169,3,0,0,0,98,105
+,103,0,0,0,0,0,0,20,81,99,166,83,208,67,22,0,0,0,83,116,114,105,110,103,46,112,114,111,116,111,116,121
+,112,101,46,98,108,105,110,107,0,0,0,12,81,97,86,112,106,158,5,0,0,0,98,108,105,110,107,0,0,0,0,20
+,81,99,110,5,115,5,21,0,0,0,83,116,114,105,110,103,46,112,114,111,116,111,116,121,112,101,46,98,111,108,100,0
+,0,0,0,12,81,97,22,148,112,43,1,0,0,0,98,0,0,0,0,0,0,0,0,24,81,100,86,139,143,222,26,0
+,0,0,83,116,114,105,110,103,46,112,114,111,116,111,116,121,112,101,46,102,111,110,116,99,111,108,111,114,0,0,0,0
+,0,0,0,12,81,97,206,245,240,96,4,0,0,0,102,111,110,116,0,0,0,0,0,12,81,97,206,94,165,85,5,0
+,0,0,99,111,108,111,114,0,0,0,0,24,81,100,102,247,195,147,25,0,0,0,83,116,114,105,110,103,46,112,114,111
+,116,111,116,121,112,101,46,102,111,110,116,115,105,122,101,0,0,0,0,0,0,0,0,12,81,97,46,226,253,106,4,0
+,0,0,115,105,122,101,0,0,0,0,0,20,81,99,6,59,209,89,22,0,0,0,83,116,114,105,110,103,46,112,114,111
+,116,111,116,121,112,101,46,102,105,120,101,100,0,0,0,12,81,97,54,227,69,183,2,0,0,0,116,116,0,0,0,0
+,0,0,0,20,81,99,62,199,163,106,24,0,0,0,83,116,114,105,110,103,46,112,114,111,116,111,116,121,112,101,46,105
+,116,97,108,105,99,115,0,12,81,97,198,194,240,67,1,0,0,0,105,0,0,0,0,0,0,0,0,20,81,99,190,203
+,15,22,21,0,0,0,83,116,114,105,110,103,46,112,114,111,116,111,116,121,112,101,46,108,105,110,107,0,0,0,0,12
+,81,97,6,10,165,187,4,0,0,0,104,114,101,102,0,0,0,0,0,20,81,99,78,207,89,220,22,0,0,0,83,116
+,114,105,110,103,46,112,114,111,116,111,116,121,112,101,46,115,109,97,108,108,0,0,0,12,81,97,126,1,252,129,5,0
+,0,0,115,109,97,108,108,0,0,0,0,20,81,99,70,168,207,161,23,0,0,0,83,116,114,105,110,103,46,112,114,111
+,116,111,116,121,112,101,46,115,116,114,105,107,101,0,0,12,81,97,86,155,172,175,6,0,0,0,115,116,114,105,107,101
+,0,0,0,20,81,99,30,47,129,0,20,0,0,0,83,116,114,105,110,103,46,112,114,111,116,111,116,121,112,101,46,115
+,117,98,0,0,0,0,0,12,81,97,94,52,3,34,3,0,0,0,115,117,98,0,0,0,0,0,0,20,81,99,174,67
+,185,10,20,0,0,0,83,116,114,105,110,103,46,112,114,111,116,111,116,121,112,101,46,115,117,112,0,0,0,0,0,12
+,81,97,70,130,152,200,3,0,0,0,115,117,112,0,0,0,0,0,0,28,81,101,14,30,30,221,33,0,0,0,83,116
+,114,105,110,103,46,112,114,111,116,111,116,121,112,101,91,83,121,109,98,111,108,46,105,116,101,114,97,116,111,114,93,0
+,0,0,0,0,0,0,0,24,81,100,190,67,36,235,30,0,0,0,83,116,114,105,110,103,32,73,116,101,114,97,116,111
+,114,46,112,114,111,116,111,116,121,112,101,46,110,101,120,116,0,0,0,24,81,100,70,106,152,161,25,0,0,0,83,116
+,114,105,110,103,46,112,114,111,116,111,116,121,112,101,46,112,97,100,83,116,97,114,116,0,0,0,0,0,0,0,0,20
+,81,99,86,31,56,141,23,0,0,0,83,116,114,105,110,103,46,112,114,111,116,111,116,121,112,101,46,112,97,100,69,110
+,100,0,0,20,81,99,198,20,21,232,23,0,0,0,83,116,114,105,110,103,46,112,114,111,116,111,116,121,112,101,46,114
+,101,112,101,97,116,0,0,20,81,99,246,118,106,238,22,0,0,0,83,116,114,105,110,103,46,112,114,111,116,111,116,121
+,112,101,46,115,108,105,99,101,0,0,0,24,81,100,182,243,3,146,27,0,0,0,83,116,114,105,110,103,46,112,114,111
+,116,111,116,121,112,101,46,115,116,97,114,116,115,87,105,116,104,0,0,0,0,0,0,24,81,100,150,11,207,247,26,0
+,0,0,83,116,114,105,110,103,46,112,114,111,116,111,116,121,112,101,46,115,117,98,115,116,114,105,110,103,0,0,0,0
+,0,0,0,16,81,98,38,195,190,57,9,0,0,0,67,111,110,115,116,114,117,99,116,0,0,0,0,0,0,0,0,16
+,81,98,118,36,115,163,11,0,0,0,98,121,116,101,32,108,101,110,103,116,104,0,0,0,0,0,0,16,81,98,118,202
+,66,105,12,0,0,0,115,116,97,114,116,32,111,102,102,115,101,116,0,0,0,0,0,24,81,100,30,82,48,186,28,0
+,0,0,37,84,121,112,101,100,65,114,114,97,121,37,46,112,114,111,116,111,116,121,112,101,46,101,118,101,114,121,0,0
+,0,0,0,24,81,100,230,255,77,32,29,0,0,0,37,84,121,112,101,100,65,114,114,97,121,37,46,112,114,111,116,111
+,116,121,112,101,46,102,105,108,116,101,114,0,0,0,0,24,81,100,14,137,182,38,27,0,0,0,37,84,121,112,101,100
+,65,114,114,97,121,37,46,112,114,111,116,111,116,121,112,101,46,102,105,110,100,0,0,0,0,0,0,24,81,100,134,144
+,170,60,32,0,0,0,37,84,121,112,101,100,65,114,114,97,121,37,46,112,114,111,116,111,116,121,112,101,46,102,105,110
+,100,73,110,100,101,120,0,24,81,100,150,149,111,114,30,0,0,0,37,84,121,112,101,100,65,114,114,97,121,37,46,112
+,114,111,116,111,116,121,112,101,46,102,111,114,69,97,99,104,0,0,0,24,81,100,166,50,140,22,29,0,0,0,37,84
+,121,112,101,100,65,114,114,97,121,37,46,112,114,111,116,111,116,121,112,101,46,114,101,100,117,99,101,0,0,0,0,28
+,81,101,78,20,230,189,34,0,0,0,37,84,121,112,101,100,65,114,114,97,121,37,46,112,114,111,116,111,116,121,112,101
+,46,114,101,100,117,99,101,82,105,103,104,116,0,0,0,0,0,0,0,24,81,100,22,218,214,104,28,0,0,0,37,84
+,121,112,101,100,65,114,114,97,121,37,46,112,114,111,116,111,116,121,112,101,46,115,108,105,99,101,0,0,0,0,0,24
+,81,100,6,254,21,182,27,0,0,0,37,84,121,112,101,100,65,114,114,97,121,37,46,112,114,111,116,111,116,121,112,101
+,46,115,111,109,101,0,0,0,0,0,0,24,81,100,94,65,209,179,31,0,0,0,37,84,121,112,101,100,65,114,114,97
+,121,37,46,112,114,111,116,111,116,121,112,101,46,115,117,98,97,114,114,97,121,0,0,24,81,100,86,220,143,196,27,0
+,0,0,37,84,121,112,101,100,65,114,114,97,121,37,46,112,114,111,116,111,116,121,112,101,46,115,111,114,116,0,0,0
+,0,0,0,12,17,208,68,96,32,0,0,0,0,0,0,0,8,0,98,4,1,8,0,129,151,8,0,194,1,1,8,0
+,162,2,1,8,0,226,8,1,8,0,225,255,8,0,2,7,1,8,0,225,50,8,0,2,12,1,8,0,1,56,8,0
+,225,45,8,0,225,19,8,0,226,9,1,8,0,33,12,8,0,129,53,8,0,66,5,1,8,0,226,0,1,8,0,226
+,7,1,8,0,97,48,8,0,130,3,1,8,0,34,6,1,8,0,226,10,1,68,0,0,129,2,24,96,0,0,0,0
+,0,0,0,0,17,37,4,96,0,0,0,0,0,0,0,0,17,61,4,96,0,0,0,0,3,0,0,0,0,0,129,4
+,12,96,0,0,0,0,0,0,0,0,17,197,1,0,0,33,6,8,96,0,0,0,0,0,0,0,0,26,20,20,20,20
+,20,107,3,222,192,29,0,0,0,72,179,0,0,0,0,0,128,0,0,0,128,24,14,0,0,248,12,0,0,232,13,0
+,0,240,15,0,0,248,15,0,0,224,15,0,0,248,15,0,0,32,12,0,0,224,15,0,0,232,15,0,0,8,14,0
+,0,216,15,0,0,96,15,0,0,240,15,0,0,0,16,0,0,0,16,0,0,80,14,0,0,112,15,0,0,16,32,0
+,0,208,15,0,0,136,9,0,0,40,32,0,0,248,15,0,0,248,1,0,128,0,0,0,128,128,72,0,128,0,0,0
+,128,2,1,4,17,144,96,0,0,0,0,253,0,0,64,17,45,2,96,0,0,0,0,0,0,0,0,2,20,4,40,74
+,97,5,5,5,22,170,0,0,25,255,3,112,26,0,0,0,0,2,28,4,40,74,97,7,3,4,27,33,4,0,25,255
+,7,80,8,0,0,0,0,2,28,4,40,74,97,7,3,2,27,33,4,0,27,255,51,80,8,0,0,0,0,70,2,32
+,4,40,74,97,8,8,0,25,57,4,194,25,255,99,64,8,0,0,0,0,2,28,4,40,74,97,7,7,0,25,57,4
+,2,25,255,43,80,8,0,0,0,0,10,0,129,33,70,2,132,17,212,96,10,0,10,0,0,0,0,0,17,197,1,17
+,197,3,96,0,0,0,0,31,17,0,0,17,13,7,17,249,3,96,0,0,0,0,31,19,0,0,17,9,7,17,77,2
+,96,0,0,0,0,23,5,0,0,2,12,17,77,6,2,28,4,40,74,97,7,7,0,25,57,4,2,97,255,11,64,0
+,0,0,0,0,10,0,97,35,70,2,36,17,212,96,2,0,2,0,0,0,0,0,17,197,1,17,197,3,97,0,0,0
+,0,60,1,0,0,0,0,0,0,1,0,0,0,151,97,0,0,0,0,60,3,8,0,0,0,0,0,1,0,0,0,96
+,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,16,17,9,1,97,0,0,0
+,0,2,0,0,0,0,0,0,0,0,0,0,0,73,17,225,1,16,0,10,0,0,17,41,7,16,4,10,0,193,40,17
+,173,2,96,0,0,0,0,23,7,0,0,10,0,97,40,17,209,2,96,0,0,0,0,212,0,0,0,35,17,69,2,97
+,0,0,0,0,212,2,8,0,0,0,0,0,1,0,0,0,17,133,2,97,0,0,0,0,212,10,16,0,0,0,0,0
+,1,0,0,0,16,8,97,0,0,0,0,212,14,24,0,0,0,0,0,1,0,0,0,17,29,5,97,0,0,0,0,212
+,12,32,0,0,0,0,0,1,0,0,0,17,21,6,97,0,0,0,0,252,8,40,0,0,0,0,0,1,0,0,0,96
+,0,0,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0
+,0,255,255,255,255,68,68,96,0,0,0,0,1,0,0,0,2,32,17,9,1,96,0,0,0,0,6,0,0,0,2,32
+,4,40,74,97,8,8,2,25,57,4,194,25,255,19,80,8,0,0,0,0,10,0,97,35,70,2,60,17,212,96,4,0
+,4,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,7,0,0,17,13,7,17,249,3,96,0,0,0,0
+,31,1,0,0,17,9,7,17,109,4,96,0,0,0,0,63,5,0,0,17,17,7,17,177,5,97,0,0,0,0,16,3
+,0,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0
+,0,0,2,20,17,9,1,97,0,0,0,0,3,0,0,0,0,0,0,0,52,0,0,0,128,68,93,16,12,10,0,0
+,17,41,7,16,16,4,40,74,97,8,8,8,25,57,4,194,25,255,23,64,8,0,0,0,0,10,0,97,35,10,0,33
+,45,2,72,17,212,96,5,0,5,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,5,0,0,17,13,7
+,17,249,3,96,0,0,0,0,31,7,0,0,17,9,7,17,77,2,96,0,0,0,0,63,1,0,0,17,1,7,17,173
+,2,96,0,0,0,0,63,9,0,0,17,5,7,17,109,4,96,0,0,0,0,55,3,0,0,17,17,7,96,0,0,0
+,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,28,4,40,74,97,7,7,7,25,57,4
+,2,25,255,11,64,10,0,0,0,0,10,0,97,35,70,2,36,17,212,96,2,0,2,0,0,0,0,0,17,197,1,17
+,197,3,96,0,0,0,0,31,1,0,0,17,13,7,17,249,3,96,0,0,0,0,31,3,0,0,17,9,7,96,0,0
+,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,128,93,16,20,10,0,0,17,41,7,16
+,24,2,28,12,32,128,93,16,28,145,146,16,32,2,28,147,128,93,16,36,145,146,16,40,2,28,147,128,93,16,44,145
+,146,16,48,2,28,147,128,93,16,52,145,146,16,56,93,16,60,145,146,16,64,70,21,2,2,45,1,17,212,96,24,0
+,24,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,15,0,0,17,13,7,17,249,3,96,0,0,0,0
+,31,11,0,0,17,9,7,17,109,4,96,0,0,0,0,63,23,0,0,17,17,7,16,68,97,0,0,0,0,16,21,0
+,0,0,0,0,0,1,0,0,0,17,109,3,97,0,0,0,0,16,39,8,0,0,0,0,0,1,0,0,0,16,72,97
+,0,0,0,0,16,7,16,0,0,0,0,0,1,0,0,0,16,76,97,0,0,0,0,16,9,24,0,0,0,0,0,1
+,0,0,0,16,80,97,0,0,0,0,16,19,32,0,0,0,0,0,1,0,0,0,16,84,97,0,0,0,0,16,13,40
+,0,0,0,0,0,1,0,0,0,17,93,4,97,0,0,0,0,16,25,48,0,0,0,0,0,1,0,0,0,16,88,97
+,0,0,0,0,16,31,56,0,0,0,0,0,1,0,0,0,16,92,97,0,0,0,0,16,17,64,0,0,0,0,0,1
+,0,0,0,16,96,97,0,0,0,0,16,47,72,0,0,0,0,0,1,0,0,0,17,225,2,97,0,0,0,0,16,1
+,80,0,0,0,0,0,1,0,0,0,16,100,97,0,0,0,0,16,27,88,0,0,0,0,0,1,0,0,0,17,113,3
+,97,0,0,0,0,16,45,96,0,0,0,0,0,1,0,0,0,17,201,4,97,0,0,0,0,16,5,104,0,0,0,0
+,0,1,0,0,0,17,177,3,97,0,0,0,0,16,3,112,0,0,0,0,0,1,0,0,0,16,104,97,0,0,0,0
+,16,35,120,0,0,0,0,0,1,0,0,0,16,108,97,0,0,0,0,16,33,128,0,0,0,0,0,1,0,0,0,17
+,189,3,97,0,0,0,0,16,41,136,0,0,0,0,0,1,0,0,0,16,112,97,0,0,0,0,16,43,144,0,0,0
+,0,0,1,0,0,0,16,116,97,0,0,0,0,16,37,152,0,0,0,0,0,1,0,0,0,16,120,97,0,0,0,0
+,16,29,160,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0
+,0,0,0,0,2,92,17,9,1,96,0,0,0,0,21,0,0,0,2,28,12,32,128,93,16,124,10,0,0,17,41,7
+,16,128,2,28,150,128,93,16,132,151,144,16,136,2,28,150,128,93,16,140,151,144,16,144,2,28,150,128,93,16,148,151
+,144,16,152,2,28,150,128,93,16,156,151,144,16,160,2,28,150,128,93,16,164,151,144,16,168,2,28,150,128,93,16,172
+,151,144,16,176,2,28,150,128,93,16,180,151,144,16,184,2,28,150,128,93,16,188,151,144,16,192,2,28,150,128,93,16
+,196,151,144,16,200,2,28,150,128,93,16,204,151,144,16,208,2,28,150,128,93,16,212,151,144,16,216,2,28,150,128,93
+,16,220,151,144,16,224,2,28,150,128,93,16,228,151,144,16,232,2,28,150,128,93,16,236,151,144,16,240,2,28,150,128
+,93,16,244,151,144,16,248,2,28,150,128,93,16,252,151,144,16,1,1,2,28,150,128,93,16,5,1,151,144,16,9,1
+,2,28,150,128,93,16,13,1,151,144,16,17,1,2,28,150,128,93,16,21,1,151,144,16,25,1,2,28,150,128,93,16
+,29,1,151,144,16,33,1,93,16,37,1,151,144,16,41,1,4,40,74,97,7,3,3,27,33,4,0,25,255,3,64,10
+,0,0,0,0,10,0,129,33,10,0,97,34,94,96,0,0,0,0,0,0,0,0,147,148,96,0,0,0,0,0,0,0
+,0,2,156,17,212,96,12,0,12,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0,0,16,17,0,0,0,0,0
+,0,1,0,0,0,16,45,1,97,0,0,0,0,212,14,8,0,0,0,0,0,1,0,0,0,16,49,1,97,0,0,0
+,0,212,18,16,0,0,0,0,0,1,0,0,0,16,53,1,97,0,0,0,0,212,10,24,0,0,0,0,0,1,0,0
+,0,16,57,1,97,0,0,0,0,212,6,32,0,0,0,0,0,1,0,0,0,16,61,1,97,0,0,0,0,212,22,40
+,0,0,0,0,0,1,0,0,0,16,65,1,97,0,0,0,0,212,2,48,0,0,0,0,0,1,0,0,0,16,69,1
+,97,0,0,0,0,212,12,56,0,0,0,0,0,1,0,0,0,17,29,5,97,0,0,0,0,212,8,64,0,0,0,0
+,0,1,0,0,0,17,81,5,97,0,0,0,0,212,20,72,0,0,0,0,0,1,0,0,0,17,105,4,96,0,0,0
+,0,23,1,0,0,2,12,17,77,6,2,28,12,32,128,93,16,73,1,10,0,0,17,41,7,16,77,1,2,28,146,128
+,93,16,81,1,147,148,16,85,1,19,125,1,97,0,0,0,0,212,4,80,0,0,0,0,0,1,0,0,0,96,0,0
+,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255
+,255,255,255,68,68,96,0,0,0,0,1,0,0,0,2,44,17,9,1,96,0,0,0,0,9,0,0,0,2,28,146,128
+,93,16,89,1,147,148,16,93,1,2,28,146,128,93,16,97,1,147,148,16,101,1,2,28,146,128,93,16,105,1,147,148
+,16,109,1,2,28,146,128,93,16,113,1,147,148,16,117,1,2,28,146,128,93,16,121,1,147,148,16,125,1,2,28,146
+,128,93,16,129,1,147,148,16,133,1,2,28,146,128,93,16,137,1,147,148,16,141,1,128,68,93,10,0,97,34,2,28
+,146,128,93,16,145,1,147,148,16,149,1,2,28,146,128,93,16,153,1,147,148,16,157,1,2,28,146,128,93,16,161,1
+,147,148,16,165,1,145,2,24,17,212,96,1,0,1,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0,0,16,1
+,0,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,149,150,96,0,0,0,0,0,0,0,0,17,201
+,1,93,145,129,68,2,32,4,40,74,97,8,8,8,25,57,4,194,25,255,15,64,10,0,0,0,0,10,0,97,35,10
+,0,33,45,2,48,146,96,3,0,3,0,0,0,0,0,147,17,197,3,96,0,0,0,0,31,1,0,0,17,13,7,17
+,249,3,96,0,0,0,0,31,5,0,0,17,9,7,17,109,4,96,0,0,0,0,55,3,0,0,17,17,7,96,0,0
+,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,128,93,16,169,1,10,0,0,17,41,7
+,16,173,1,4,40,74,97,5,5,5,22,170,0,0,25,255,3,112,26,0,0,0,0,10,0,161,32,10,4,97,49,94
+,96,0,0,0,0,0,0,0,0,150,151,96,0,0,0,0,0,0,0,0,94,96,0,0,0,0,0,0,0,0,150,151
+,96,0,0,0,0,0,0,0,0,21,2,2,29,2,17,220,101,0,0,0,0,133,0,0,0,0,0,0,0,55,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,111,0,0,0,0,0,0,0,0,0,0
+,0,128,68,2,20,87,16,177,1,96,0,0,0,0,80,96,0,0,2,28,12,32,128,93,16,181,1,144,145,16,185,1
+,150,129,68,2,20,87,16,189,1,96,0,0,0,0,80,52,0,0,2,12,4,40,74,97,3,3,0,27,33,4,0,25
+,255,99,64,24,0,0,0,0,2,28,4,40,74,97,7,3,3,27,33,4,0,25,255,3,80,8,0,0,0,0,10,0
+,129,33,10,0,97,34,94,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,128
+,93,130,68,2,32,12,40,128,93,16,193,1,10,0,0,17,41,7,16,173,1,4,40,74,97,3,3,3,27,33,4,0
+,25,255,3,64,10,0,0,0,0,10,8,97,19,10,8,65,20,94,96,0,0,0,0,0,0,0,0,144,145,96,0,0
+,0,0,0,0,0,0,2,45,1,17,212,96,24,0,24,0,0,0,0,0,17,197,1,16,197,1,97,0,0,0,0,0
+,23,0,0,0,0,0,0,1,0,0,0,16,201,1,97,0,0,0,0,0,19,8,0,0,0,0,0,1,0,0,0,16
+,205,1,97,0,0,0,0,0,29,16,0,0,0,0,0,1,0,0,0,16,209,1,97,0,0,0,0,0,33,24,0,0
+,0,0,0,1,0,0,0,16,213,1,97,0,0,0,0,0,41,32,0,0,0,0,0,1,0,0,0,16,217,1,97,0
+,0,0,0,0,7,40,0,0,0,0,0,1,0,0,0,16,221,1,97,0,0,0,0,0,17,48,0,0,0,0,0,1
+,0,0,0,16,225,1,97,0,0,0,0,0,39,56,0,0,0,0,0,1,0,0,0,16,229,1,97,0,0,0,0,0
+,9,64,0,0,0,0,0,1,0,0,0,16,233,1,97,0,0,0,0,0,35,72,0,0,0,0,0,1,0,0,0,16
+,237,1,97,0,0,0,0,0,3,80,0,0,0,0,0,1,0,0,0,16,241,1,97,0,0,0,0,0,5,88,0,0
+,0,0,0,1,0,0,0,16,245,1,97,0,0,0,0,0,31,96,0,0,0,0,0,1,0,0,0,16,249,1,97,0
+,0,0,0,0,15,104,0,0,0,0,0,1,0,0,0,16,253,1,97,0,0,0,0,0,37,112,0,0,0,0,0,1
+,0,0,0,16,1,2,97,0,0,0,0,0,1,120,0,0,0,0,0,1,0,0,0,16,5,2,97,0,0,0,0,0
+,47,128,0,0,0,0,0,1,0,0,0,16,9,2,97,0,0,0,0,0,27,136,0,0,0,0,0,1,0,0,0,16
+,13,2,97,0,0,0,0,0,11,144,0,0,0,0,0,1,0,0,0,16,17,2,97,0,0,0,0,0,21,152,0,0
+,0,0,0,1,0,0,0,16,21,2,97,0,0,0,0,0,45,160,0,0,0,0,0,1,0,0,0,16,25,2,97,0
+,0,0,0,0,25,168,0,0,0,0,0,1,0,0,0,16,29,2,97,0,0,0,0,0,13,176,0,0,0,0,0,1
+,0,0,0,17,29,6,97,0,0,0,0,24,43,184,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0
+,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,104,17,9,1,96,0,0,0,0,24,0,0,0,2,28,12
+,32,128,93,16,33,2,10,0,0,17,41,7,16,37,2,2,28,149,128,93,16,41,2,150,151,16,45,2,2,28,149,128
+,93,16,49,2,150,151,16,53,2,2,28,149,128,93,16,57,2,150,151,16,61,2,2,28,149,128,93,16,65,2,150,151
+,16,69,2,2,28,149,128,93,16,73,2,150,151,16,77,2,2,28,149,128,93,16,81,2,150,151,16,85,2,2,28,149
+,128,93,16,89,2,150,151,16,93,2,2,28,149,128,93,16,97,2,150,151,16,101,2,2,28,149,128,93,16,105,2,150
+,151,16,109,2,2,28,149,128,93,16,113,2,150,151,16,117,2,2,28,149,128,93,16,121,2,150,151,16,125,2,2,28
+,149,128,93,16,129,2,150,151,16,133,2,2,28,149,128,93,16,137,2,150,151,16,141,2,2,28,149,128,93,16,145,2
+,150,151,16,149,2,2,28,149,128,93,16,153,2,150,151,16,157,2,2,28,149,128,93,16,161,2,150,151,16,165,2,2
+,28,149,128,93,16,169,2,150,151,16,173,2,2,28,149,128,93,16,177,2,150,151,16,181,2,2,28,149,128,93,16,185
+,2,150,151,16,189,2,2,28,149,128,93,16,193,2,150,151,16,197,2,2,28,149,128,93,16,201,2,150,151,16,205,2
+,2,28,149,128,93,16,209,2,150,151,16,213,2,17,57,4,93,146,68,2,20,87,17,145,4,96,0,0,0,0,80,30
+,0,0,2,32,4,40,74,97,8,8,2,25,57,4,194,25,255,99,64,8,0,0,0,0,10,0,97,35,10,0,33,45
+,21,2,2,45,1,17,212,96,24,0,24,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,21,0,0,17
+,13,7,17,249,3,96,0,0,0,0,31,27,0,0,17,9,7,17,109,4,96,0,0,0,0,63,39,0,0,17,17,7
+,17,177,5,97,0,0,0,0,16,43,0,0,0,0,0,0,1,0,0,0,17,5,6,96,0,0,0,0,23,29,0,0
+,2,12,17,77,6,2,28,12,32,128,93,16,217,2,10,0,0,17,41,7,16,221,2,68,17,161,3,96,0,0,0,0
+,23,15,0,0,2,12,150,2,28,151,128,93,16,225,2,144,145,16,229,2,2,28,151,128,93,16,233,2,144,145,16,237
+,2,16,241,2,96,0,0,0,0,23,31,0,0,2,12,150,2,28,151,128,93,16,245,2,144,145,16,229,2,2,28,151
+,128,93,16,249,2,144,145,16,237,2,16,253,2,96,0,0,0,0,23,13,0,0,2,12,150,2,28,151,128,93,16,1
+,3,144,145,16,5,3,2,28,151,128,93,16,9,3,144,145,16,64,16,13,3,96,0,0,0,0,23,7,0,0,2,12
+,150,2,28,151,128,93,16,17,3,144,145,16,5,3,2,28,151,128,93,16,21,3,144,145,16,64,16,25,3,96,0,0
+,0,0,23,35,0,0,2,12,150,2,28,151,128,93,16,29,3,144,145,16,33,3,2,28,151,128,93,16,37,3,144,145
+,16,64,16,41,3,96,0,0,0,0,23,11,0,0,2,12,150,2,28,151,128,93,16,45,3,144,145,16,33,3,2,28
+,151,128,93,16,49,3,144,145,16,64,16,53,3,96,0,0,0,0,23,1,0,0,2,12,150,2,28,151,128,93,16,57
+,3,144,145,16,61,3,2,28,151,128,93,16,65,3,144,145,16,64,16,69,3,96,0,0,0,0,23,41,0,0,2,12
+,150,2,28,151,128,93,16,73,3,144,145,16,61,3,2,28,151,128,93,16,77,3,144,145,16,64,16,81,3,96,0,0
+,0,0,23,5,0,0,2,12,150,2,28,151,128,93,16,85,3,144,145,16,89,3,2,28,151,128,93,16,93,3,144,145
+,16,64,16,97,3,96,0,0,0,0,23,3,0,0,2,12,150,2,28,151,128,93,16,101,3,144,145,16,89,3,2,28
+,151,128,93,16,105,3,144,145,16,64,16,109,3,96,0,0,0,0,23,25,0,0,2,12,150,2,28,151,128,93,16,113
+,3,144,145,16,117,3,2,28,151,128,93,16,121,3,144,145,16,64,16,125,3,96,0,0,0,0,23,17,0,0,2,12
+,150,2,28,151,128,93,16,129,3,144,145,16,133,3,2,28,151,128,93,16,137,3,144,145,16,64,16,141,3,96,0,0
+,0,0,23,45,0,0,2,12,150,2,28,151,128,93,16,145,3,144,145,16,149,3,2,28,151,128,93,16,153,3,144,145
+,16,64,16,157,3,96,0,0,0,0,23,33,0,0,2,12,150,2,28,151,128,93,16,161,3,144,145,16,165,3,2,28
+,151,128,93,16,169,3,144,145,16,64,16,173,3,96,0,0,0,0,23,23,0,0,2,12,150,2,28,151,128,93,16,177
+,3,144,145,16,181,3,2,28,151,128,93,16,185,3,144,145,16,64,16,189,3,96,0,0,0,0,23,9,0,0,2,12
+,150,2,28,151,128,93,16,193,3,144,145,16,197,3,2,28,151,128,93,16,201,3,144,145,16,64,16,205,3,96,0,0
+,0,0,23,19,0,0,2,12,150,2,28,151,128,93,16,209,3,144,145,16,213,3,2,28,151,128,93,16,217,3,144,145
+,16,64,16,221,3,96,0,0,0,0,23,47,0,0,2,12,150,2,28,151,128,93,16,225,3,144,145,16,229,3,2,28
+,151,128,93,16,233,3,144,145,16,64,16,237,3,96,0,0,0,0,23,37,0,0,2,12,150,2,28,151,128,93,16,241
+,3,144,145,16,245,3,2,28,151,128,93,16,249,3,144,145,16,64,96,0,0,0,0,0,0,0,0,17,253,1,17,45
+,7,96,0,0,0,0,0,0,0,0,2,20,17,9,1,97,0,0,0,0,3,0,0,0,0,0,0,0,135,0,0,0
+,128,68,93,16,253,3,144,145,16,1,4,4,40,74,97,7,6,7,27,46,4,0,25,255,7,64,8,0,0,0,0,2
+,28,4,40,74,97,7,3,0,27,33,4,0,25,255,75,80,8,0,0,0,0,10,0,129,33,10,0,97,34,2,228,17
+,212,96,18,0,18,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0,0,16,23,0,0,0,0,0,0,1,0,0
+,0,17,57,3,97,0,0,0,0,212,30,8,0,0,0,0,0,1,0,0,0,17,29,3,96,0,0,0,0,23,19,0
+,0,2,12,17,77,6,2,28,12,32,128,93,16,5,4,10,0,0,17,41,7,16,9,4,68,17,65,3,96,0,0,0
+,0,23,21,0,0,2,12,149,2,28,150,128,93,16,13,4,151,144,16,17,4,68,17,117,3,96,0,0,0,0,23,15
+,0,0,2,12,149,2,28,150,128,93,16,21,4,151,144,16,25,4,68,17,133,3,96,0,0,0,0,23,17,0,0,2
+,12,149,21,2,2,28,150,128,93,16,29,4,151,144,16,33,4,68,17,245,3,96,0,0,0,0,23,25,0,0,2,12
+,149,2,28,150,128,93,16,37,4,151,144,16,41,4,68,17,209,4,96,0,0,0,0,23,3,0,0,2,12,17,77,6
+,2,28,12,32,128,93,16,45,4,10,0,0,17,41,7,16,49,4,68,17,225,4,96,0,0,0,0,23,9,0,0,2
+,12,150,2,28,151,128,93,16,53,4,144,145,16,57,4,68,17,69,5,96,0,0,0,0,23,7,0,0,2,12,150,2
+,28,151,128,93,16,61,4,144,145,16,65,4,68,16,69,4,97,0,0,0,0,212,32,16,0,0,0,0,0,1,0,0
+,0,17,29,5,97,0,0,0,0,212,4,24,0,0,0,0,0,1,0,0,0,16,73,4,97,0,0,0,0,212,12,32
+,0,0,0,0,0,1,0,0,0,17,249,5,97,0,0,0,0,212,34,40,0,0,0,0,0,1,0,0,0,17,245,5
+,97,0,0,0,0,212,26,48,0,0,0,0,0,1,0,0,0,17,253,5,97,0,0,0,0,212,10,56,0,0,0,0
+,0,1,0,0,0,17,1,6,97,0,0,0,0,212,28,64,0,0,0,0,0,1,0,0,0,17,9,6,97,0,0,0
+,0,212,0,72,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133
+,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0,0,0,2,32
+,17,9,1,96,0,0,0,0,6,0,0,0,2,28,12,32,128,93,16,77,4,10,0,0,17,41,7,16,81,4,2,28
+,150,128,93,16,85,4,151,144,16,89,4,2,28,150,128,93,16,93,4,151,144,16,97,4,2,28,150,128,93,16,101,4
+,151,144,16,105,4,2,28,150,128,93,16,109,4,151,144,16,113,4,2,28,150,128,93,16,117,4,151,144,16,121,4,93
+,10,8,161,54,2,28,150,128,93,16,125,4,151,144,16,129,4,2,28,150,128,93,16,133,4,151,144,16,137,4,2,28
+,150,128,93,16,141,4,151,144,16,145,4,145,2,24,17,212,96,1,0,1,0,0,0,0,0,17,197,1,17,193,3,97
+,0,0,0,0,48,1,0,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96
+,0,0,0,0,0,0,0,0,149,68,2,20,87,17,133,4,96,0,0,0,0,80,38,0,0,2,32,4,40,74,97,8
+,8,2,25,57,4,194,25,255,19,64,8,0,0,0,0,2,32,4,40,74,97,8,8,1,25,57,4,194,25,255,23,80
+,8,0,0,0,0,10,0,97,35,10,0,97,34,2,72,146,96,5,0,5,0,0,0,0,0,147,17,197,3,96,0,0
+,0,0,31,7,0,0,17,13,7,17,249,3,96,0,0,0,0,31,9,0,0,17,9,7,17,109,4,96,0,0,0,0
+,63,1,0,0,17,17,7,16,149,4,97,0,0,0,0,16,5,0,0,0,0,0,0,1,0,0,0,17,177,5,97,0
+,0,0,0,16,3,8,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0
+,0,0,0,0,0,0,0,2,20,17,9,1,96,0,0,0,0,3,0,0,0,2,28,12,32,128,93,16,153,4,10,0
+,0,17,41,7,16,157,4,96,0,0,0,0,206,0,0,0,68,93,16,161,4,149,150,16,165,4,4,40,74,97,5,3
+,3,27,41,4,0,25,255,7,64,8,0,0,0,0,2,28,4,40,74,97,7,3,7,27,33,4,0,25,255,19,80,8
+,0,0,0,0,10,0,129,33,10,0,97,34,2,60,17,212,96,4,0,4,0,0,0,0,0,17,197,1,17,209,2,97
+,0,0,0,0,16,7,0,0,0,0,0,0,1,0,0,0,17,249,3,97,0,0,0,0,212,2,8,0,0,0,0,0
+,1,0,0,0,17,229,3,97,0,0,0,0,212,4,16,0,0,0,0,0,1,0,0,0,17,29,5,97,0,0,0,0
+,212,0,24,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133,6
+,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0,0,0,17,201,1
+,93,10,16,1,18,17,41,3,73,2,28,12,32,128,93,16,169,4,10,0,0,17,41,7,16,173,4,147,2,24,17,212
+,96,1,0,1,0,0,0,0,0,17,197,1,17,217,4,96,0,0,0,0,23,1,0,0,17,253,6,96,0,0,0,0
+,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,10,0,33,45,2,60,144,96,4,0,4,0,0
+,0,0,0,145,17,197,3,96,0,0,0,0,31,7,0,0,17,13,7,17,249,3,96,0,0,0,0,31,1,0,0,17
+,9,7,17,109,4,96,0,0,0,0,63,5,0,0,17,17,7,17,177,5,97,0,0,0,0,16,3,0,0,0,0,0
+,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,20,17
+,9,1,97,0,0,0,0,3,0,0,0,0,0,0,0,221,0,0,0,128,68,93,16,177,4,10,0,0,17,41,7,16
+,165,4,4,40,74,97,5,3,3,27,41,4,0,25,255,7,64,8,0,0,0,0,2,28,4,40,74,97,7,3,7,27
+,33,4,0,25,255,19,80,8,0,0,0,0,10,16,193,22,10,0,97,34,2,60,17,212,96,4,0,4,0,0,0,0
+,0,17,197,1,17,209,2,97,0,0,0,0,16,7,0,0,0,0,0,0,1,0,0,0,17,249,3,97,0,0,0,0
+,212,2,8,0,0,0,0,0,1,0,0,0,17,229,3,97,0,0,0,0,212,4,16,0,0,0,0,0,1,0,0,0
+,17,29,5,97,0,0,0,0,212,0,24,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1
+,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0
+,0,1,0,0,0,17,201,1,93,10,16,1,17,17,133,4,73,10,16,97,26,151,2,24,17,212,96,1,0,1,0,0
+,0,0,0,17,197,1,17,217,4,96,0,0,0,0,23,1,0,0,17,253,6,96,0,0,0,0,0,0,0,0,17,253
+,1,17,45,7,96,0,0,0,0,0,0,0,0,150,2,20,87,16,181,4,96,0,0,0,0,80,98,0,0,2,28,12
+,32,128,93,16,185,4,10,0,0,17,41,7,16,189,4,150,2,20,87,17,69,3,96,0,0,0,0,80,68,0,0,2
+,32,4,40,74,97,8,8,1,25,57,4,194,25,255,23,64,8,0,0,0,0,2,32,4,40,74,97,8,8,1,25,57
+,4,194,25,255,27,80,8,0,0,0,0,10,0,97,35,10,0,97,34,2,84,17,212,96,6,0,6,0,0,0,0,0
+,17,197,1,17,197,3,96,0,0,0,0,31,11,0,0,17,13,7,17,249,3,96,0,0,0,0,31,1,0,0,17,9
+,7,17,109,4,96,0,0,0,0,63,5,0,0,17,17,7,17,5,6,96,0,0,0,0,23,3,0,0,2,12,17,77
+,6,2,28,12,32,128,93,16,193,4,10,0,0,17,41,7,16,221,2,68,17,69,4,97,0,0,0,0,16,7,0,0
+,0,0,0,0,1,0,0,0,17,77,3,97,0,0,0,0,16,9,8,0,0,0,0,0,1,0,0,0,96,0,0,0
+,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,20,17,9,1,96,0,0,0,0,3,0
+,0,0,2,28,144,128,93,16,197,4,145,146,16,201,4,2,28,144,128,93,16,205,4,145,146,16,209,4,68,93,16,213
+,4,145,146,16,217,4,4,40,74,97,9,9,9,28,27,4,0,25,255,3,64,8,0,0,0,0,2,28,4,40,74,97
+,7,3,1,27,33,4,0,25,255,131,80,24,0,0,0,0,10,0,129,33,10,0,97,34,2,141,1,17,212,96,32,0
+,32,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0,0,16,63,0,0,0,0,0,0,1,0,0,0,17,153,2
+,96,0,0,0,0,23,31,0,0,2,12,17,77,6,2,28,12,32,128,93,16,221,4,10,0,0,17,41,7,16,225,4
+,68,17,157,2,96,0,0,0,0,23,45,0,0,2,12,150,2,28,151,128,93,16,229,4,144,145,16,233,4,68,17,161
+,2,96,0,0,0,0,23,41,0,0,2,12,150,2,28,151,128,93,16,237,4,144,145,16,241,4,68,17,197,3,96,0
+,0,0,0,23,3,0,0,2,12,150,2,28,151,128,93,16,245,4,144,145,16,249,4,68,17,29,6,96,0,0,0,0
+,23,47,0,0,2,12,150,21,2,2,28,151,128,93,16,253,4,144,145,16,1,5,68,16,112,97,0,0,0,0,212,22
+,8,0,0,0,0,0,1,0,0,0,17,189,3,97,0,0,0,0,212,42,16,0,0,0,0,0,1,0,0,0,16,120
+,97,0,0,0,0,212,48,24,0,0,0,0,0,1,0,0,0,17,237,5,97,0,0,0,0,212,18,32,0,0,0,0
+,0,1,0,0,0,16,5,5,97,0,0,0,0,212,50,40,0,0,0,0,0,1,0,0,0,16,9,5,97,0,0,0
+,0,212,16,48,0,0,0,0,0,1,0,0,0,16,13,5,97,0,0,0,0,212,28,56,0,0,0,0,0,1,0,0
+,0,16,17,5,97,0,0,0,0,212,38,64,0,0,0,0,0,1,0,0,0,16,21,5,97,0,0,0,0,212,60,72
+,0,0,0,0,0,1,0,0,0,16,25,5,97,0,0,0,0,212,8,80,0,0,0,0,0,1,0,0,0,16,29,5
+,97,0,0,0,0,212,6,88,0,0,0,0,0,1,0,0,0,16,33,5,97,0,0,0,0,212,10,96,0,0,0,0
+,0,1,0,0,0,16,37,5,97,0,0,0,0,212,20,104,0,0,0,0,0,1,0,0,0,19,141,1,97,0,0,0
+,0,212,32,112,0,0,0,0,0,1,0,0,0,16,41,5,97,0,0,0,0,212,26,120,0,0,0,0,0,1,0,0
+,0,16,45,5,97,0,0,0,0,212,34,128,0,0,0,0,0,1,0,0,0,16,49,5,97,0,0,0,0,212,24,136
+,0,0,0,0,0,1,0,0,0,16,53,5,97,0,0,0,0,212,14,144,0,0,0,0,0,1,0,0,0,16,57,5
+,97,0,0,0,0,212,12,152,0,0,0,0,0,1,0,0,0,17,193,4,97,0,0,0,0,212,36,160,0,0,0,0
+,0,1,0,0,0,16,61,5,97,0,0,0,0,212,54,168,0,0,0,0,0,1,0,0,0,16,65,5,97,0,0,0
+,0,212,4,176,0,0,0,0,0,1,0,0,0,16,69,5,97,0,0,0,0,212,58,184,0,0,0,0,0,1,0,0
+,0,16,73,5,97,0,0,0,0,212,56,192,0,0,0,0,0,1,0,0,0,19,125,1,97,0,0,0,0,212,0,200
+,0,0,0,0,0,1,0,0,0,17,29,5,97,0,0,0,0,212,52,208,0,0,0,0,0,1,0,0,0,96,0,0
+,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255
+,255,255,255,68,68,96,0,0,0,0,1,0,0,0,2,104,17,9,1,96,0,0,0,0,24,0,0,0,2,28,12,32
+,128,93,16,77,5,10,0,0,17,41,7,16,81,5,2,28,150,128,93,16,85,5,151,144,16,89,5,2,28,150,128,93
+,16,93,5,151,144,16,97,5,2,28,150,128,93,16,101,5,151,144,16,105,5,2,28,150,128,93,16,109,5,151,144,16
+,113,5,2,28,150,128,93,16,117,5,151,144,16,121,5,2,28,150,128,93,16,125,5,151,144,16,129,5,2,28,150,128
+,93,16,133,5,151,144,16,137,5,2,28,150,128,93,16,141,5,151,144,16,145,5,2,28,150,128,93,16,149,5,151,144
+,16,153,5,2,28,150,128,93,16,157,5,151,144,16,161,5,2,28,150,128,93,16,165,5,151,144,16,169,5,2,28,150
+,128,93,16,173,5,151,144,16,177,5,2,28,150,128,93,16,181,5,151,144,16,185,5,2,28,150,128,93,16,189,5,151
+,144,16,193,5,2,28,150,128,93,16,197,5,151,144,16,201,5,2,28,150,128,93,16,205,5,151,144,16,209,5,2,28
+,150,128,93,16,213,5,151,144,16,217,5,2,28,150,128,93,16,221,5,151,144,16,225,5,2,28,150,128,93,16,229,5
+,151,144,16,233,5,2,28,150,128,93,16,237,5,151,144,16,241,5,2,28,150,128,93,16,245,5,151,144,16,249,5,2
+,28,150,128,93,16,253,5,151,144,16,1,6,68,93,10,16,1,38,2,28,150,128,93,16,5,6,151,144,16,9,6,2
+,28,150,128,93,16,13,6,151,144,16,17,6,10,20,1,5,145,94,96,0,0,0,0,0,0,0,0,17,253,1,17,45
+,7,96,0,0,0,0,0,0,0,0,10,0,33,45,2,72,17,212,96,5,0,5,0,0,0,0,0,17,197,1,17,197
+,3,96,0,0,0,0,31,9,0,0,17,13,7,17,249,3,96,0,0,0,0,31,7,0,0,17,9,7,17,109,4,96
+,0,0,0,0,63,1,0,0,17,17,7,16,21,6,97,0,0,0,0,56,5,0,0,0,0,0,0,1,0,0,0,17
+,177,5,97,0,0,0,0,16,3,8,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17
+,45,7,96,0,0,0,0,0,0,0,0,2,20,17,9,1,98,0,0,0,0,3,0,0,0,0,0,0,0,4,0,0
+,0,0,0,0,0,50,0,0,0,68,93,16,25,6,10,0,0,17,41,7,16,29,6,4,40,74,97,11,11,11,28,27
+,4,0,185,255,3,64,8,0,0,0,0,2,28,4,40,74,97,7,3,5,27,33,4,0,25,255,11,80,8,0,0,0
+,0,10,16,65,45,10,0,97,34,2,36,17,212,96,2,0,2,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0
+,0,16,3,0,0,0,0,0,0,1,0,0,0,16,21,6,97,0,0,0,0,124,0,8,0,0,0,0,0,1,0,0
+,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0
+,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0,0,0,17,201,1,93,10,16,1,37,96,0,0,0,0,4
+,0,0,0,128,68,149,94,96,0,0,0,0,0,0,0,0,145,146,96,0,0,0,0,0,0,0,0,145,2,20,87,16
+,33,6,96,0,0,0,0,80,100,0,0,2,28,12,32,128,93,16,37,6,10,0,0,17,41,7,16,41,6,145,2,20
+,87,16,45,6,96,0,0,0,0,80,108,0,0,2,28,150,128,93,16,49,6,151,144,16,53,6,145,68,2,20,87,17
+,253,4,96,0,0,0,0,80,40,0,0,2,32,4,40,74,97,8,8,2,25,57,4,194,25,255,19,64,8,0,0,0
+,0,10,16,1,18,10,0,33,45,2,60,17,212,96,4,0,4,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0
+,0,31,7,0,0,17,13,7,17,249,3,96,0,0,0,0,31,1,0,0,17,9,7,17,109,4,96,0,0,0,0,63
+,5,0,0,17,17,7,17,177,5,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0
+,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,20,17,9,1,97,0,0,0,0,3,0,0,0
+,0,0,0,0,225,0,0,0,128,68,93,16,57,6,10,0,0,17,41,7,16,165,4,4,40,74,97,5,3,3,27,41
+,4,0,25,255,7,64,8,0,0,0,0,2,28,4,40,74,97,7,3,7,27,33,4,0,25,255,19,80,8,0,0,0
+,0,10,16,193,22,10,0,97,34,2,60,17,212,96,4,0,4,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0
+,0,16,7,0,0,0,0,0,0,1,0,0,0,17,249,3,97,0,0,0,0,212,2,8,0,0,0,0,0,1,0,0
+,0,17,229,3,97,0,0,0,0,212,4,16,0,0,0,0,0,1,0,0,0,17,29,5,97,0,0,0,0,212,0,24
+,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133,6,68,97,0
+,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0,0,0,17,201,1,93,10,20
+,65,36,17,253,4,73,10,16,97,26,150,2,24,17,212,96,1,0,1,0,0,0,0,0,17,197,1,17,217,4,96,0
+,0,0,0,23,1,0,0,17,253,6,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0
+,0,0,149,2,20,87,16,61,6,96,0,0,0,0,80,78,0,0,2,32,4,40,74,97,8,8,2,25,57,4,194,25
+,255,19,64,8,0,0,0,0,10,0,97,35,10,0,33,45,2,60,145,96,4,0,4,0,0,0,0,0,146,17,197,3
+,96,0,0,0,0,31,7,0,0,17,13,7,17,249,3,96,0,0,0,0,31,1,0,0,17,9,7,17,109,4,96,0
+,0,0,0,63,5,0,0,17,17,7,17,177,5,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0,0,96,0
+,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,20,17,9,1,97,0,0,0,0
+,3,0,0,0,0,0,0,0,40,0,0,0,128,68,93,16,65,6,10,0,0,17,41,7,16,69,6,4,40,74,97,9
+,9,9,24,26,4,0,25,255,3,64,8,0,0,0,0,2,28,4,40,74,97,7,3,0,27,33,4,0,25,255,103,80
+,24,0,0,0,0,10,0,129,33,10,0,97,34,2,57,1,17,212,96,25,0,25,0,0,0,0,0,17,197,1,17,209
+,2,97,0,0,0,0,16,31,0,0,0,0,0,0,1,0,0,0,17,29,6,97,0,0,0,0,220,26,8,0,0,0
+,0,0,1,0,0,0,17,153,2,96,0,0,0,0,23,5,0,0,2,12,17,77,6,2,28,12,32,128,93,16,73,6
+,10,0,0,17,41,7,16,77,6,68,17,157,2,96,0,0,0,0,23,45,0,0,2,12,148,2,28,149,128,93,16,81
+,6,150,151,16,85,6,68,17,161,2,96,0,0,0,0,23,35,0,0,2,12,148,2,28,149,128,93,16,89,6,150,151
+,16,93,6,68,16,97,6,97,0,0,0,0,212,32,16,0,0,0,0,0,1,0,0,0,16,101,6,97,0,0,0,0
+,212,46,24,0,0,0,0,0,1,0,0,0,16,105,6,97,0,0,0,0,212,48,32,0,0,0,0,0,1,0,0,0
+,16,109,6,97,0,0,0,0,212,40,40,0,0,0,0,0,1,0,0,0,16,113,6,97,0,0,0,0,212,38,48,0
+,0,0,0,0,1,0,0,0,16,117,6,97,0,0,0,0,212,28,56,0,0,0,0,0,1,0,0,0,16,121,6,97
+,0,0,0,0,212,12,64,0,0,0,0,0,1,0,0,0,16,125,6,97,0,0,0,0,212,8,72,0,0,0,0,0
+,1,0,0,0,16,129,6,97,0,0,0,0,212,2,80,0,0,0,0,0,1,0,0,0,16,133,6,97,0,0,0,0
+,212,18,88,0,0,0,0,0,1,0,0,0,16,137,6,97,0,0,0,0,212,22,96,0,0,0,0,0,1,0,0,0
+,16,141,6,97,0,0,0,0,212,10,104,0,0,0,0,0,1,0,0,0,16,145,6,97,0,0,0,0,212,36,112,0
+,0,0,0,0,1,0,0,0,16,149,6,97,0,0,0,0,212,42,120,0,0,0,0,0,1,0,0,0,16,153,6,97
+,0,0,0,0,212,14,128,0,0,0,0,0,1,0,0,0,16,157,6,97,0,0,0,0,212,16,136,0,0,0,0,0
+,1,0,0,0,16,161,6,97,0,0,0,0,212,24,144,0,0,0,0,0,1,0,0,0,16,165,6,97,0,0,0,0
+,212,20,152,0,0,0,0,0,1,0,0,0,16,169,6,97,0,0,0,0,212,6,160,0,0,0,0,0,1,0,0,0
+,16,173,6,97,0,0,0,0,212,0,168,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1
+,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0
+,0,1,0,0,0,21,2,2,80,17,9,1,96,0,0,0,0,18,0,0,0,2,28,12,32,128,93,16,177,6,10,0
+,0,17,41,7,16,181,6,2,28,150,128,93,16,185,6,151,144,16,189,6,2,28,150,128,93,16,193,6,151,144,16,197
+,6,2,28,150,128,93,16,201,6,151,144,16,205,6,2,28,150,128,93,16,209,6,151,144,16,213,6,2,28,150,128,93
+,16,217,6,151,144,16,221,6,2,28,150,128,93,16,225,6,151,144,16,229,6,2,28,150,128,93,16,233,6,151,144,16
+,237,6,2,28,150,128,93,16,241,6,151,144,16,245,6,2,28,150,128,93,16,249,6,151,144,16,253,6,2,28,150,128
+,93,16,1,7,151,144,16,5,7,2,28,150,128,93,16,9,7,151,144,16,13,7,2,28,150,128,93,16,17,7,151,144
+,16,21,7,2,28,150,128,93,16,25,7,151,144,16,29,7,2,28,150,128,93,16,33,7,151,144,16,37,7,2,28,150
+,128,93,16,41,7,151,144,16,45,7,2,28,150,128,93,16,49,7,151,144,16,53,7,2,28,150,128,93,16,57,7,151
+,144,16,61,7,93,10,20,193,44,16,61,6,2,28,150,128,93,16,65,7,151,144,16,69,7,2,28,150,128,93,16,73
+,7,151,144,16,77,7,145,94,96,0,0,0,0,0,0,0,0,146,147,96,0,0,0,0,0,0,0,0,146,131,68,2
+,20,87,17,213,2,96,0,0,0,0,80,26,0,0,2,32,4,40,74,97,8,8,2,25,57,4,194,25,255,31,64,8
+,0,0,0,0,10,0,97,35,10,0,33,45,2,96,17,212,96,7,0,7,0,0,0,0,0,17,197,1,17,197,3,96
+,0,0,0,0,31,7,0,0,17,13,7,17,249,3,96,0,0,0,0,31,13,0,0,17,9,7,17,109,4,96,0,0
+,0,0,63,9,0,0,17,17,7,17,177,5,97,0,0,0,0,16,1,0,0,0,0,0,0,1,0,0,0,16,81,7
+,97,0,0,0,0,16,5,8,0,0,0,0,0,1,0,0,0,16,85,7,97,0,0,0,0,16,3,16,0,0,0,0
+,0,1,0,0,0,16,89,7,97,0,0,0,0,16,11,24,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0
+,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,32,17,9,1,97,0,0,0,0,6,0,0,0,0
+,0,0,0,41,0,0,0,2,28,12,32,128,93,16,93,7,10,0,0,17,41,7,16,97,7,2,28,145,128,93,16,101
+,7,146,147,16,105,7,2,28,145,128,93,16,109,7,146,147,16,113,7,128,68,93,16,117,7,146,147,16,121,7,4,40
+,74,97,12,12,12,27,40,4,0,25,255,3,64,8,0,0,0,0,2,28,4,40,74,97,7,3,1,27,33,4,0,25
+,255,195,80,8,0,0,0,0,10,0,129,33,10,0,97,34,2,77,2,17,212,96,48,0,48,0,0,0,0,0,17,197
+,1,17,209,2,97,0,0,0,0,16,11,0,0,0,0,0,0,1,0,0,0,17,29,5,97,0,0,0,0,212,50,8
+,0,0,0,0,0,1,0,0,0,16,125,7,97,0,0,0,0,212,2,16,0,0,0,0,0,1,0,0,0,16,129,7
+,97,0,0,0,0,212,86,24,0,0,0,0,0,1,0,0,0,16,133,7,97,0,0,0,0,212,28,32,0,0,0,0
+,0,1,0,0,0,16,137,7,97,0,0,0,0,212,32,40,0,0,0,0,0,1,0,0,0,16,141,7,97,0,0,0
+,0,212,24,48,0,0,0,0,0,1,0,0,0,16,145,7,97,0,0,0,0,212,74,56,0,0,0,0,0,1,0,0
+,0,16,149,7,97,0,0,0,0,212,30,64,0,0,0,0,0,1,0,0,0,16,153,7,97,0,0,0,0,212,22,72
+,0,0,0,0,0,1,0,0,0,16,157,7,97,0,0,0,0,212,68,80,0,0,0,0,0,1,0,0,0,16,161,7
+,97,0,0,0,0,212,16,88,0,0,0,0,0,1,0,0,0,16,165,7,97,0,0,0,0,212,94,96,0,0,0,0
+,0,1,0,0,0,16,169,7,97,0,0,0,0,212,46,104,0,0,0,0,0,1,0,0,0,16,173,7,97,0,0,0
+,0,212,12,112,0,0,0,0,0,1,0,0,0,16,177,7,97,0,0,0,0,212,60,120,0,0,0,0,0,1,0,0
+,0,16,181,7,97,0,0,0,0,212,44,128,0,0,0,0,0,1,0,0,0,16,185,7,97,0,0,0,0,212,18,136
+,0,0,0,0,0,1,0,0,0,16,189,7,97,0,0,0,0,212,26,144,0,0,0,0,0,1,0,0,0,16,193,7
+,97,0,0,0,0,212,8,152,0,0,0,0,0,1,0,0,0,16,197,7,97,0,0,0,0,212,80,160,0,0,0,0
+,0,1,0,0,0,16,201,7,97,0,0,0,0,212,64,168,0,0,0,0,0,1,0,0,0,16,205,7,97,0,0,0
+,0,212,34,176,0,0,0,0,0,1,0,0,0,16,209,7,97,0,0,0,0,212,70,184,0,0,0,0,0,1,0,0
+,0,16,213,7,97,0,0,0,0,212,40,192,0,0,0,0,0,1,0,0,0,16,217,7,97,0,0,0,0,212,38,200
+,0,0,0,0,0,1,0,0,0,16,221,7,97,0,0,0,0,212,14,208,0,0,0,0,0,1,0,0,0,16,225,7
+,97,0,0,0,0,212,84,216,0,0,0,0,0,1,0,0,0,16,229,7,97,0,0,0,0,212,88,224,0,0,0,0
+,0,1,0,0,0,16,233,7,97,0,0,0,0,212,4,232,0,0,0,0,0,1,0,0,0,16,237,7,97,0,0,0
+,0,212,6,240,0,0,0,0,0,1,0,0,0,16,241,7,97,0,0,0,0,212,62,248,0,0,0,0,0,1,0,0
+,0,16,245,7,97,0,0,0,0,212,58,0,1,0,0,0,0,1,0,0,0,16,249,7,97,0,0,0,0,212,66,8
+,1,0,0,0,0,1,0,0,0,16,253,7,97,0,0,0,0,212,20,16,1,0,0,0,0,1,0,0,0,16,1,8
+,97,0,0,0,0,212,82,24,1,0,0,0,0,1,0,0,0,16,5,8,97,0,0,0,0,212,36,32,1,0,0,0
+,0,1,0,0,0,16,9,8,97,0,0,0,0,212,92,40,1,0,0,0,0,1,0,0,0,16,13,8,97,0,0,0
+,0,212,52,48,1,0,0,0,0,1,0,0,0,16,17,8,97,0,0,0,0,212,78,56,1,0,0,0,0,1,0,0
+,0,17,81,5,97,0,0,0,0,212,76,64,1,0,0,0,0,1,0,0,0,16,21,8,97,0,0,0,0,212,54,72
+,1,0,0,0,0,1,0,0,0,16,25,8,97,0,0,0,0,212,90,80,1,0,0,0,0,1,0,0,0,17,25,5
+,97,0,0,0,0,212,42,88,1,0,0,0,0,1,0,0,0,19,125,1,97,0,0,0,0,212,56,96,1,0,0,0
+,0,1,0,0,0,16,29,8,97,0,0,0,0,212,0,104,1,0,0,0,0,1,0,0,0,16,33,8,97,0,0,0
+,0,212,48,112,1,0,0,0,0,1,0,0,0,17,13,6,97,0,0,0,0,220,72,120,1,0,0,0,0,1,0,0
+,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0
+,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0,0,0,2,188,17,9,1,96,0,0,0,0,45,0,0,0
+,2,28,12,32,128,93,16,37,8,10,0,0,17,41,7,16,41,8,2,28,145,128,93,16,45,8,146,147,16,49,8,10
+,24,33,55,2,28,145,128,93,16,53,8,146,147,16,57,8,2,28,145,128,93,16,61,8,146,147,16,65,8,2,28,145
+,128,93,16,69,8,146,147,16,73,8,2,28,145,128,93,16,77,8,146,147,16,81,8,2,28,145,128,93,16,85,8,146
+,147,16,89,8,2,28,145,128,93,16,93,8,146,147,16,97,8,2,28,145,128,93,16,101,8,146,147,16,105,8,2,28
+,145,128,93,16,109,8,146,147,16,113,8,2,28,145,128,93,16,117,8,146,147,16,121,8,21,2,2,28,145,128,93,16
+,125,8,146,147,16,129,8,2,28,145,128,93,16,133,8,146,147,16,137,8,2,28,145,128,93,16,141,8,146,147,16,145
+,8,2,28,145,128,93,16,149,8,146,147,16,153,8,2,28,145,128,93,16,157,8,146,147,16,161,8,2,28,145,128,93
+,16,165,8,146,147,16,169,8,2,28,145,128,93,16,173,8,146,147,16,177,8,2,28,145,128,93,16,181,8,146,147,16
+,185,8,2,28,145,128,93,16,189,8,146,147,16,193,8,2,28,145,128,93,16,197,8,146,147,16,201,8,2,28,145,128
+,93,16,205,8,146,147,16,209,8,2,28,145,128,93,16,213,8,146,147,16,217,8,2,28,145,128,93,16,221,8,146,147
+,16,225,8,2,28,145,128,93,16,229,8,146,147,16,233,8,2,28,145,128,93,16,237,8,146,147,16,241,8,2,28,145
+,128,93,16,245,8,146,147,16,249,8,2,28,145,128,93,16,253,8,146,147,16,1,9,2,28,145,128,93,16,5,9,146
+,147,16,9,9,2,28,145,128,93,16,13,9,146,147,16,17,9,2,28,145,128,93,16,21,9,146,147,16,25,9,2,28
+,145,128,93,16,29,9,146,147,16,33,9,2,28,145,128,93,16,37,9,146,147,16,41,9,2,28,145,128,93,16,45,9
+,146,147,16,49,9,2,28,145,128,93,16,53,9,146,147,16,57,9,2,28,145,128,93,16,61,9,146,147,16,65,9,2
+,28,145,128,93,16,69,9,146,147,16,73,9,2,28,145,128,93,16,77,9,146,147,16,81,9,2,28,145,128,93,16,85
+,9,146,147,16,89,9,2,28,145,128,93,16,93,9,146,147,16,97,9,2,28,145,128,93,16,101,9,146,147,16,105,9
+,2,28,145,128,93,16,109,9,146,147,16,113,9,2,28,145,128,93,16,117,9,146,147,16,121,9,68,93,10,24,161,20
+,2,28,145,128,93,16,125,9,146,147,16,97,9,2,28,145,128,93,16,129,9,146,147,16,105,9,2,28,145,128,93,16
+,133,9,146,147,16,113,9,149,94,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0
+,0,150,68,2,20,87,17,53,3,96,0,0,0,0,80,34,0,0,2,32,4,40,74,97,8,8,2,25,57,4,194,25
+,255,19,64,8,0,0,0,0,10,16,1,18,10,0,33,45,2,60,17,212,96,4,0,4,0,0,0,0,0,17,197,1
+,17,197,3,96,0,0,0,0,31,7,0,0,17,13,7,17,249,3,96,0,0,0,0,31,1,0,0,17,9,7,17,109
+,4,96,0,0,0,0,63,5,0,0,17,17,7,17,177,5,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0
+,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,20,17,9,1,97,0
+,0,0,0,3,0,0,0,0,0,0,0,208,0,0,0,128,68,93,16,137,9,10,0,0,17,41,7,16,165,4,4,40
+,74,97,5,3,3,27,41,4,0,25,255,7,64,8,0,0,0,0,2,28,4,40,74,97,7,3,7,27,33,4,0,25
+,255,19,80,8,0,0,0,0,10,16,193,22,10,0,97,34,2,60,17,212,96,4,0,4,0,0,0,0,0,17,197,1
+,17,209,2,97,0,0,0,0,16,7,0,0,0,0,0,0,1,0,0,0,17,249,3,97,0,0,0,0,212,2,8,0
+,0,0,0,0,1,0,0,0,17,229,3,97,0,0,0,0,212,4,16,0,0,0,0,0,1,0,0,0,17,29,5,97
+,0,0,0,0,212,0,24,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,2
+,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0,0
+,0,17,201,1,93,10,28,65,31,17,53,3,73,10,16,97,26,149,2,24,17,212,96,1,0,1,0,0,0,0,0,17
+,197,1,17,217,4,96,0,0,0,0,23,1,0,0,17,253,6,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7
+,96,0,0,0,0,0,0,0,0,148,68,2,20,87,17,153,3,96,0,0,0,0,120,14,0,0,17,13,2,148,68,2
+,20,87,17,229,4,96,0,0,0,0,80,22,0,0,2,32,4,40,74,97,8,8,2,25,57,4,194,25,255,31,64,8
+,0,0,0,0,10,0,97,35,10,0,33,45,2,96,17,212,96,7,0,7,0,0,0,0,0,17,197,1,17,197,3,96
+,0,0,0,0,31,13,0,0,17,13,7,17,249,3,96,0,0,0,0,31,7,0,0,17,9,7,17,109,4,96,0,0
+,0,0,63,9,0,0,17,17,7,17,177,5,97,0,0,0,0,16,1,0,0,0,0,0,0,1,0,0,0,16,141,9
+,97,0,0,0,0,16,5,8,0,0,0,0,0,1,0,0,0,16,145,9,97,0,0,0,0,16,3,16,0,0,0,0
+,0,1,0,0,0,17,129,4,97,0,0,0,0,16,11,24,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0
+,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,32,17,9,1,97,0,0,0,0,6,0,0,0,0
+,0,0,0,185,0,0,0,2,28,12,32,128,93,16,149,9,10,0,0,17,41,7,16,153,9,2,28,144,128,93,16,157
+,9,145,146,16,161,9,2,28,144,128,93,16,165,9,145,146,16,169,9,128,68,93,16,173,9,145,146,16,177,9,4,40
+,74,97,4,4,4,27,17,4,0,121,255,7,64,8,0,0,0,0,2,16,4,40,74,97,4,4,0,27,17,4,0,121
+,255,199,80,8,0,0,0,0,10,0,129,33,10,0,97,34,21,2,2,89,2,17,212,96,49,0,49,0,0,0,0,0
+,17,197,1,17,197,3,96,0,0,0,0,63,75,0,0,17,25,7,17,209,2,97,0,0,0,0,20,67,0,0,0,0
+,0,0,1,0,0,0,16,181,9,97,0,0,0,0,20,61,8,0,0,0,0,0,1,0,0,0,19,253,2,97,0,0
+,0,0,20,35,16,0,0,0,0,0,1,0,0,0,19,5,3,97,0,0,0,0,20,69,24,0,0,0,0,0,1,0
+,0,0,16,185,9,97,0,0,0,0,20,65,32,0,0,0,0,0,1,0,0,0,16,189,9,97,0,0,0,0,20,13
+,40,0,0,0,0,0,1,0,0,0,16,193,9,97,0,0,0,0,20,19,48,0,0,0,0,0,1,0,0,0,16,197
+,9,97,0,0,0,0,20,41,56,0,0,0,0,0,1,0,0,0,16,201,9,97,0,0,0,0,20,47,64,0,0,0
+,0,0,1,0,0,0,16,205,9,97,0,0,0,0,20,33,72,0,0,0,0,0,1,0,0,0,16,209,9,97,0,0
+,0,0,20,39,80,0,0,0,0,0,1,0,0,0,16,213,9,97,0,0,0,0,20,83,88,0,0,0,0,0,1,0
+,0,0,16,217,9,97,0,0,0,0,20,95,96,0,0,0,0,0,1,0,0,0,16,33,5,97,0,0,0,0,20,97
+,104,0,0,0,0,0,1,0,0,0,16,37,5,97,0,0,0,0,20,49,112,0,0,0,0,0,1,0,0,0,16,221
+,9,97,0,0,0,0,20,45,120,0,0,0,0,0,1,0,0,0,16,41,5,97,0,0,0,0,20,27,128,0,0,0
+,0,0,1,0,0,0,16,225,9,97,0,0,0,0,20,5,136,0,0,0,0,0,1,0,0,0,16,229,9,97,0,0
+,0,0,20,59,144,0,0,0,0,0,1,0,0,0,16,233,9,97,0,0,0,0,20,25,152,0,0,0,0,0,1,0
+,0,0,16,237,9,97,0,0,0,0,20,15,160,0,0,0,0,0,1,0,0,0,16,241,9,97,0,0,0,0,20,81
+,168,0,0,0,0,0,1,0,0,0,16,245,9,97,0,0,0,0,20,1,176,0,0,0,0,0,1,0,0,0,16,249
+,9,97,0,0,0,0,20,43,184,0,0,0,0,0,1,0,0,0,16,253,9,97,0,0,0,0,20,89,192,0,0,0
+,0,0,1,0,0,0,16,1,10,97,0,0,0,0,20,91,200,0,0,0,0,0,1,0,0,0,16,5,10,97,0,0
+,0,0,20,85,208,0,0,0,0,0,1,0,0,0,16,61,5,97,0,0,0,0,20,9,216,0,0,0,0,0,1,0
+,0,0,19,65,3,97,0,0,0,0,20,73,224,0,0,0,0,0,1,0,0,0,16,9,10,97,0,0,0,0,20,7
+,232,0,0,0,0,0,1,0,0,0,19,73,3,97,0,0,0,0,20,23,240,0,0,0,0,0,1,0,0,0,19,81
+,3,97,0,0,0,0,20,63,248,0,0,0,0,0,1,0,0,0,16,13,10,97,0,0,0,0,20,53,0,1,0,0
+,0,0,1,0,0,0,16,17,10,97,0,0,0,0,20,37,8,1,0,0,0,0,1,0,0,0,19,89,3,97,0,0
+,0,0,20,29,16,1,0,0,0,0,1,0,0,0,16,21,10,97,0,0,0,0,20,71,24,1,0,0,0,0,1,0
+,0,0,17,29,5,97,0,0,0,0,20,31,32,1,0,0,0,0,1,0,0,0,16,25,10,97,0,0,0,0,20,55
+,40,1,0,0,0,0,1,0,0,0,16,29,10,97,0,0,0,0,20,51,48,1,0,0,0,0,1,0,0,0,16,33
+,10,97,0,0,0,0,20,93,56,1,0,0,0,0,1,0,0,0,16,37,10,97,0,0,0,0,20,79,64,1,0,0
+,0,0,1,0,0,0,16,41,10,97,0,0,0,0,20,11,72,1,0,0,0,0,1,0,0,0,16,45,10,97,0,0
+,0,0,20,77,80,1,0,0,0,0,1,0,0,0,16,49,10,97,0,0,0,0,20,87,88,1,0,0,0,0,1,0
+,0,0,16,53,10,97,0,0,0,0,20,17,96,1,0,0,0,0,1,0,0,0,16,57,10,97,0,0,0,0,20,3
+,104,1,0,0,0,0,1,0,0,0,17,81,5,97,0,0,0,0,20,57,112,1,0,0,0,0,1,0,0,0,17,237
+,5,97,0,0,0,0,20,21,120,1,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45
+,7,96,0,0,0,0,0,0,0,0,2,200,17,9,1,96,0,0,0,0,48,0,0,0,10,28,97,40,2,28,12,32
+,128,93,16,61,10,10,0,0,17,41,7,16,65,10,2,28,145,128,93,16,69,10,146,147,16,73,10,2,28,145,128,93
+,16,77,10,146,147,16,81,10,2,28,145,128,93,16,85,10,146,147,16,89,10,2,28,145,128,93,16,93,10,146,147,16
+,97,10,2,28,145,128,93,16,101,10,146,147,16,105,10,2,28,145,128,93,16,109,10,146,147,16,113,10,2,28,145,128
+,93,16,117,10,146,147,16,121,10,2,28,145,128,93,16,125,10,146,147,16,129,10,2,28,145,128,93,16,133,10,146,147
+,16,137,10,2,28,145,128,93,16,141,10,146,147,16,145,10,2,28,145,128,93,16,149,10,146,147,16,153,10,2,28,145
+,128,93,16,157,10,146,147,16,161,10,2,28,145,128,93,16,165,10,146,147,16,169,10,2,28,145,128,93,16,173,10,146
+,147,16,177,10,2,28,145,128,93,16,181,10,146,147,16,185,10,2,28,145,128,93,16,189,10,146,147,16,193,10,2,28
+,145,128,93,16,197,10,146,147,16,201,10,2,28,145,128,93,16,205,10,146,147,16,209,10,2,28,145,128,93,16,213,10
+,146,147,16,217,10,2,28,145,128,93,16,221,10,146,147,16,225,10,2,28,145,128,93,16,229,10,146,147,16,233,10,2
+,28,145,128,93,16,237,10,146,147,16,241,10,2,28,145,128,93,16,245,10,146,147,16,249,10,2,28,145,128,93,16,253
+,10,146,147,16,1,11,2,28,145,128,93,16,5,11,146,147,16,9,11,2,28,145,128,93,16,13,11,146,147,16,17,11
+,2,28,145,128,93,16,21,11,146,147,16,25,11,2,28,145,128,93,16,29,11,146,147,16,33,11,2,28,145,128,93,16
+,37,11,146,147,16,41,11,2,28,145,128,93,16,45,11,146,147,16,49,11,2,28,145,128,93,16,53,11,146,147,16,57
+,11,2,28,145,128,93,16,61,11,146,147,16,65,11,2,28,145,128,93,16,69,11,146,147,16,73,11,2,28,145,128,93
+,16,77,11,146,147,16,81,11,2,28,145,128,93,16,85,11,146,147,16,89,11,2,28,145,128,93,16,93,11,146,147,16
+,97,11,2,28,145,128,93,16,101,11,146,147,16,105,11,10,32,97,57,2,28,145,128,93,16,109,11,146,147,16,113,11
+,10,32,65,58,2,28,145,128,93,16,117,11,146,147,16,121,11,2,28,145,128,93,16,125,11,146,147,16,129,11,2,28
+,145,128,93,16,133,11,146,147,16,137,11,2,28,145,128,93,16,141,11,146,147,16,145,11,2,28,145,128,93,16,149,11
+,146,147,16,153,11,21,2,2,28,145,128,93,16,157,11,146,147,16,161,11,93,73,144,2,24,17,212,96,1,0,1,0
+,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,63,1,0,0,17,25,7,96,0,0,0,0,0,0,0,0,17
+,253,1,17,45,7,96,0,0,0,0,0,0,0,0,146,2,20,87,17,121,3,96,0,0,0,0,80,46,0,0,18,0
+,146,68,2,20,87,17,253,3,96,0,0,0,0,120,16,0,0,17,5,2,146,2,20,87,17,73,3,96,0,0,0,0
+,80,70,0,0,2,32,4,40,74,97,8,8,1,25,57,4,194,25,255,23,64,8,0,0,0,0,10,16,1,38,10,0
+,33,45,2,72,17,212,96,5,0,5,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,9,0,0,17,13
+,7,17,249,3,96,0,0,0,0,31,7,0,0,17,9,7,17,109,4,96,0,0,0,0,63,1,0,0,17,17,7,16
+,21,6,97,0,0,0,0,56,5,0,0,0,0,0,0,1,0,0,0,17,177,5,97,0,0,0,0,16,3,8,0,0
+,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2
+,20,17,9,1,98,0,0,0,0,3,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,51,0,0,0,68,93,16
+,165,11,10,0,0,17,41,7,16,29,6,4,40,74,97,11,11,11,28,27,4,0,193,255,3,64,8,0,0,0,0,2
+,28,4,40,74,97,7,3,5,27,33,4,0,25,255,11,80,8,0,0,0,0,10,16,65,45,10,0,97,34,2,36,17
+,212,96,2,0,2,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0
+,0,16,21,6,97,0,0,0,0,124,0,8,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253
+,1,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0
+,0,0,1,0,0,0,17,201,1,93,10,36,129,3,96,0,0,0,0,8,0,0,0,128,68,145,94,96,0,0,0,0
+,0,0,0,0,149,150,96,0,0,0,0,0,0,0,0,149,68,2,20,87,17,169,3,96,0,0,0,0,80,66,0,0
+,2,32,4,40,74,97,8,8,1,25,57,4,194,25,255,23,64,8,0,0,0,0,10,16,1,38,10,0,33,45,2,72
+,17,212,96,5,0,5,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,9,0,0,17,13,7,17,249,3
+,96,0,0,0,0,31,7,0,0,17,9,7,17,109,4,96,0,0,0,0,63,1,0,0,17,17,7,16,21,6,97,0
+,0,0,0,56,5,0,0,0,0,0,0,1,0,0,0,17,177,5,97,0,0,0,0,16,3,8,0,0,0,0,0,1
+,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,20,17,9,1
+,98,0,0,0,0,3,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,75,0,0,0,68,93,16,169,11,10,0
+,0,17,41,7,16,29,6,4,40,74,97,11,11,11,28,27,4,0,177,255,3,64,8,0,0,0,0,2,28,4,40,74
+,97,7,3,5,27,33,4,0,25,255,11,80,8,0,0,0,0,10,16,65,45,10,0,97,34,2,36,17,212,96,2,0
+,2,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0,0,16,21,6
+,97,0,0,0,0,124,0,8,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7
+,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0
+,0,0,17,201,1,93,10,36,225,10,96,0,0,0,0,4,0,0,0,128,68,148,94,96,0,0,0,0,0,0,0,0
+,144,145,96,0,0,0,0,0,0,0,0,144,133,68,2,20,87,17,101,4,96,0,0,0,0,80,28,0,0,2,32,4
+,40,74,97,8,8,1,25,57,4,194,25,255,39,64,8,0,0,0,0,10,0,97,35,10,0,33,45,2,120,17,212,96
+,9,0,9,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,17,0,0,17,13,7,17,249,3,96,0,0
+,0,0,31,7,0,0,17,9,7,17,109,4,96,0,0,0,0,63,11,0,0,17,17,7,17,177,5,97,0,0,0,0
+,16,1,0,0,0,0,0,0,1,0,0,0,17,5,6,96,0,0,0,0,23,13,0,0,2,12,17,77,6,2,28,12
+,32,128,93,16,173,11,10,0,0,17,41,7,16,221,2,68,16,177,11,97,0,0,0,0,16,5,8,0,0,0,0,0
+,1,0,0,0,16,181,11,97,0,0,0,0,16,3,16,0,0,0,0,0,1,0,0,0,17,153,4,97,0,0,0,0
+,16,15,24,0,0,0,0,0,1,0,0,0,16,185,11,97,0,0,0,0,16,9,32,0,0,0,0,0,1,0,0,0
+,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,32,17,9,1,97,0,0
+,0,0,6,0,0,0,0,0,0,0,219,0,0,0,2,28,147,128,93,16,189,11,148,149,16,193,11,2,28,147,128,93
+,16,197,11,148,149,16,201,11,2,28,147,128,93,16,205,11,148,149,16,209,11,2,28,147,128,93,16,213,11,148,149,16
+,217,11,68,93,16,221,11,148,149,16,225,11,4,40,74,97,6,6,6,27,45,4,0,25,255,3,64,8,0,0,0,0
+,2,28,4,40,74,97,7,3,2,27,33,4,0,25,255,23,80,24,0,0,0,0,10,0,129,33,10,0,97,34,2,72
+,17,212,96,5,0,5,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0,0,16,7,0,0,0,0,0,0,1,0
+,0,0,17,29,6,97,0,0,0,0,220,2,8,0,0,0,0,0,1,0,0,0,17,5,5,97,0,0,0,0,212,4
+,16,0,0,0,0,0,1,0,0,0,16,229,11,97,0,0,0,0,212,8,24,0,0,0,0,0,1,0,0,0,16,233
+,11,97,0,0,0,0,212,0,32,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45
+,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1
+,0,0,0,2,20,17,9,1,96,0,0,0,0,3,0,0,0,2,28,12,32,128,93,16,237,11,10,0,0,17,41,7
+,16,241,11,128,68,93,10,36,65,18,17,101,4,2,28,149,128,93,16,245,11,150,151,16,249,11,2,28,149,128,93,16
+,253,11,150,151,16,1,12,144,94,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0
+,0,146,2,20,87,17,129,2,96,0,0,0,0,80,74,0,0,2,32,4,40,74,97,8,8,1,25,57,4,194,25,255
+,23,64,8,0,0,0,0,10,16,1,38,10,0,33,45,2,72,17,212,96,5,0,5,0,0,0,0,0,17,197,1,17
+,197,3,96,0,0,0,0,31,9,0,0,17,13,7,17,249,3,96,0,0,0,0,31,7,0,0,17,9,7,17,109,4
+,96,0,0,0,0,63,1,0,0,17,17,7,16,21,6,97,0,0,0,0,56,5,0,0,0,0,0,0,1,0,0,0
+,17,177,5,97,0,0,0,0,16,3,8,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1
+,17,45,7,96,0,0,0,0,0,0,0,0,2,20,17,9,1,98,0,0,0,0,3,0,0,0,0,0,0,0,8,0
+,0,0,0,0,0,0,29,0,0,0,68,93,16,5,12,10,0,0,17,41,7,16,29,6,4,40,74,97,11,11,11,28
+,27,4,0,209,255,3,64,8,0,0,0,0,2,28,4,40,74,97,7,3,5,27,33,4,0,25,255,11,80,8,0,0
+,0,0,10,16,65,45,10,0,97,34,2,36,17,212,96,2,0,2,0,0,0,0,0,17,197,1,17,209,2,97,0,0
+,0,0,16,3,0,0,0,0,0,0,1,0,0,0,16,21,6,97,0,0,0,0,124,0,8,0,0,0,0,0,1,0
+,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0
+,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0,0,0,17,201,1,93,10,36,161,36,96,0,0,0,0
+,8,0,0,0,128,68,150,94,96,0,0,0,0,0,0,0,0,146,147,96,0,0,0,0,0,0,0,0,146,129,68,2
+,20,87,17,181,4,96,0,0,0,0,80,84,0,0,2,32,4,40,74,97,8,8,2,25,57,4,194,25,255,23,64,8
+,0,0,0,0,10,0,97,35,10,0,33,45,2,72,17,212,96,5,0,5,0,0,0,0,0,17,197,1,17,197,3,96
+,0,0,0,0,31,7,0,0,17,13,7,17,249,3,96,0,0,0,0,31,1,0,0,17,9,7,17,109,4,96,0,0
+,0,0,63,5,0,0,17,17,7,17,177,5,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0,0,17,5,6
+,96,0,0,0,0,23,9,0,0,2,12,17,77,6,2,28,12,32,128,93,16,9,12,10,0,0,17,41,7,16,221,2
+,68,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,20,17,9,1,97,0
+,0,0,0,3,0,0,0,0,0,0,0,96,0,0,0,128,68,93,16,13,12,150,151,16,17,12,4,40,74,97,4,4
+,4,27,29,4,0,25,255,3,64,8,0,0,0,0,2,28,4,40,74,97,7,3,2,27,33,4,0,25,255,51,80,24
+,0,0,0,0,10,0,129,33,10,0,97,34,2,156,17,212,96,12,0,12,0,0,0,0,0,17,197,1,17,209,2,97
+,0,0,0,0,16,7,0,0,0,0,0,0,1,0,0,0,17,29,6,97,0,0,0,0,220,8,8,0,0,0,0,0
+,1,0,0,0,17,129,3,97,0,0,0,0,212,22,16,0,0,0,0,0,1,0,0,0,17,53,2,97,0,0,0,0
+,212,16,24,0,0,0,0,0,1,0,0,0,16,21,12,97,0,0,0,0,212,18,32,0,0,0,0,0,1,0,0,0
+,16,245,1,97,0,0,0,0,212,2,40,0,0,0,0,0,1,0,0,0,16,112,97,0,0,0,0,212,14,48,0,0
+,0,0,0,1,0,0,0,16,29,5,97,0,0,0,0,212,20,56,0,0,0,0,0,1,0,0,0,19,33,3,96,0
+,0,0,0,23,13,0,0,2,12,17,77,6,2,28,12,32,128,93,16,25,12,10,0,0,17,41,7,16,29,12,68,16
+,120,97,0,0,0,0,212,10,64,0,0,0,0,0,1,0,0,0,17,189,3,97,0,0,0,0,212,4,72,0,0,0
+,0,0,1,0,0,0,17,237,5,97,0,0,0,0,212,0,80,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0
+,0,0,0,17,253,1,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255
+,68,68,96,0,0,0,0,1,0,0,0,2,44,17,9,1,96,0,0,0,0,9,0,0,0,2,28,12,32,128,93,16
+,33,12,10,0,0,17,41,7,16,37,12,2,28,149,128,93,16,41,12,150,151,16,45,12,2,28,149,128,93,16,49,12
+,150,151,16,53,12,2,28,149,128,93,16,57,12,150,151,16,61,12,2,28,149,128,93,16,65,12,150,151,16,69,12,10
+,36,225,61,144,128,68,93,10,36,1,44,17,181,4,2,28,149,128,93,16,73,12,150,151,16,77,12,21,2,2,28,149
+,128,93,16,81,12,150,151,16,85,12,145,94,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0
+,0,0,0,0,147,129,68,2,20,87,16,89,12,96,0,0,0,0,80,10,0,0,2,28,149,128,93,16,93,12,150,151
+,16,97,12,147,2,20,87,16,101,12,96,0,0,0,0,80,48,0,0,2,28,4,40,74,97,7,3,6,27,33,4,0
+,25,255,15,64,24,0,0,0,0,10,0,129,33,10,0,97,34,2,48,17,212,96,3,0,3,0,0,0,0,0,17,197
+,1,16,85,7,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0,0,16,105,12,97,0,0,0,0,16,5,8
+,0,0,0,0,0,1,0,0,0,17,29,6,97,0,0,0,0,24,1,16,0,0,0,0,0,1,0,0,0,96,0,0
+,0,0,0,0,0,0,147,148,96,0,0,0,0,0,0,0,0,17,201,1,93,2,28,12,32,128,93,16,109,12,10,0
+,0,17,41,7,16,113,12,2,28,147,128,93,16,117,12,148,149,16,121,12,16,101,12,68,17,253,1,2,20,87,17,117
+,2,96,0,0,0,0,80,82,0,0,2,32,4,40,74,97,8,8,0,25,57,4,194,25,255,27,64,8,0,0,0,0
+,10,0,97,35,10,0,33,45,2,84,17,212,96,6,0,6,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0
+,31,7,0,0,17,13,7,17,249,3,96,0,0,0,0,31,1,0,0,17,9,7,17,109,4,96,0,0,0,0,63,5
+,0,0,17,17,7,17,177,5,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0,0,16,125,12,97,0,0,0
+,0,16,9,8,0,0,0,0,0,1,0,0,0,16,129,12,97,0,0,0,0,16,11,16,0,0,0,0,0,1,0,0
+,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,20,17,9,1,97,0
+,0,0,0,3,0,0,0,0,0,0,0,27,0,0,0,2,28,12,32,128,93,16,133,12,10,0,0,17,41,7,16,137
+,12,2,28,150,128,93,16,141,12,151,144,16,145,12,93,16,149,12,151,144,16,153,12,4,40,74,97,4,4,4,27,17
+,4,0,25,255,3,64,8,0,0,0,0,2,28,4,40,74,97,7,3,2,27,33,4,0,25,255,23,80,24,0,0,0
+,0,10,0,129,33,10,0,97,34,2,72,17,212,96,5,0,5,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0
+,0,16,5,0,0,0,0,0,0,1,0,0,0,19,125,1,97,0,0,0,0,212,6,8,0,0,0,0,0,1,0,0
+,0,17,29,5,97,0,0,0,0,212,2,16,0,0,0,0,0,1,0,0,0,17,81,5,97,0,0,0,0,212,8,24
+,0,0,0,0,0,1,0,0,0,17,29,6,97,0,0,0,0,220,0,32,0,0,0,0,0,1,0,0,0,96,0,0
+,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255
+,255,255,255,68,68,96,0,0,0,0,1,0,0,0,2,20,17,9,1,96,0,0,0,0,3,0,0,0,17,117,2,128
+,68,93,10,40,193,7,2,28,12,32,128,93,16,157,12,10,0,0,17,41,7,16,161,12,2,28,151,128,93,16,165,12
+,144,145,16,169,12,2,28,151,128,93,16,173,12,144,145,16,177,12,150,94,96,0,0,0,0,0,0,0,0,17,253,1
+,17,45,7,96,0,0,0,0,0,0,0,0,146,2,20,87,17,217,3,96,0,0,0,0,80,80,0,0,2,32,4,40
+,74,97,8,8,2,25,57,4,194,25,255,23,64,8,0,0,0,0,10,0,97,35,10,0,33,45,2,72,17,212,96,5
+,0,5,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,7,0,0,17,13,7,17,249,3,96,0,0,0
+,0,31,1,0,0,17,9,7,17,109,4,96,0,0,0,0,63,5,0,0,17,17,7,17,177,5,97,0,0,0,0,16
+,3,0,0,0,0,0,0,1,0,0,0,17,5,6,96,0,0,0,0,23,9,0,0,2,12,17,77,6,2,28,12,32
+,128,93,16,181,12,10,0,0,17,41,7,16,221,2,68,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0
+,0,0,0,0,0,0,0,2,20,17,9,1,97,0,0,0,0,3,0,0,0,0,0,0,0,93,0,0,0,128,68,93
+,16,185,12,147,148,16,189,12,4,40,74,97,4,4,4,27,28,4,0,25,255,3,64,8,0,0,0,0,2,28,4,40
+,74,97,7,3,1,27,33,4,0,25,255,55,80,24,0,0,0,0,10,0,129,33,10,0,97,34,2,168,17,212,96,13
+,0,13,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0,0,16,11,0,0,0,0,0,0,1,0,0,0,17,29
+,6,97,0,0,0,0,220,4,8,0,0,0,0,0,1,0,0,0,17,105,3,97,0,0,0,0,212,16,16,0,0,0
+,0,0,1,0,0,0,17,193,4,97,0,0,0,0,212,22,24,0,0,0,0,0,1,0,0,0,17,129,3,97,0,0
+,0,0,212,6,32,0,0,0,0,0,1,0,0,0,16,21,12,97,0,0,0,0,212,24,40,0,0,0,0,0,1,0
+,0,0,16,245,1,97,0,0,0,0,212,2,48,0,0,0,0,0,1,0,0,0,16,112,97,0,0,0,0,212,18,56
+,0,0,0,0,0,1,0,0,0,17,237,5,97,0,0,0,0,212,20,64,0,0,0,0,0,1,0,0,0,16,29,5
+,97,0,0,0,0,212,14,72,0,0,0,0,0,1,0,0,0,17,189,3,97,0,0,0,0,212,12,80,0,0,0,0
+,0,1,0,0,0,19,33,3,96,0,0,0,0,23,9,0,0,2,12,17,77,6,2,28,12,32,128,93,16,193,12,10
+,0,0,17,41,7,16,197,12,68,16,120,97,0,0,0,0,212,0,88,0,0,0,0,0,1,0,0,0,96,0,0,0
+,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255
+,255,255,68,68,96,0,0,0,0,1,0,0,0,2,44,17,9,1,96,0,0,0,0,9,0,0,0,2,28,148,128,93
+,16,201,12,149,150,16,205,12,2,28,148,128,93,16,209,12,149,150,16,213,12,2,28,148,128,93,16,217,12,149,150,16
+,221,12,2,28,148,128,93,16,225,12,149,150,16,229,12,10,40,1,39,2,28,148,128,93,16,233,12,149,150,16,237,12
+,2,28,148,128,93,16,241,12,149,150,16,245,12,2,28,148,128,93,16,249,12,149,150,16,253,12,68,93,10,40,161,21
+,17,217,3,2,28,12,32,128,93,16,1,13,10,0,0,17,41,7,16,5,13,2,28,150,128,93,16,9,13,151,144,16
+,13,13,148,94,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,145,132,68,2
+,20,87,16,17,13,96,0,0,0,0,80,104,0,0,2,28,150,128,93,16,21,13,151,144,16,25,13,145,128,68,2,20
+,87,17,85,2,96,0,0,0,0,80,6,0,0,2,32,4,40,74,97,8,8,2,25,57,4,194,25,255,35,64,8,0
+,0,0,0,10,0,97,35,10,0,33,45,2,108,17,212,96,8,0,8,0,0,0,0,0,17,197,1,17,197,3,96,0
+,0,0,0,31,7,0,0,17,13,7,17,249,3,96,0,0,0,0,31,13,0,0,17,9,7,17,109,4,96,0,0,0
+,0,63,1,0,0,17,17,7,17,177,5,97,0,0,0,0,16,11,0,0,0,0,0,0,1,0,0,0,17,5,6,96
+,0,0,0,0,23,5,0,0,2,12,17,77,6,2,28,12,32,128,93,16,29,13,10,0,0,17,41,7,16,221,2,68
+,16,33,13,97,0,0,0,0,16,3,8,0,0,0,0,0,1,0,0,0,17,77,3,97,0,0,0,0,16,9,16,0
+,0,0,0,0,1,0,0,0,17,69,4,97,0,0,0,0,16,15,24,0,0,0,0,0,1,0,0,0,96,0,0,0
+,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,32,17,9,1,97,0,0,0,0,6,0
+,0,0,0,0,0,0,11,0,0,0,2,28,145,128,93,16,37,13,146,147,16,41,13,2,28,145,128,93,16,45,13,146
+,147,16,49,13,2,28,145,128,93,16,53,13,146,147,16,57,13,128,68,93,16,61,13,146,147,16,65,13,4,40,74,97
+,4,4,4,27,35,4,0,1,255,7,64,10,0,0,0,0,2,16,4,40,74,97,4,4,2,27,35,4,0,25,255,143
+,80,8,0,0,0,0,10,0,129,33,10,0,97,34,21,2,2,177,1,17,212,96,35,0,35,0,0,0,0,0,17,197
+,1,17,197,3,96,0,0,0,0,55,67,0,0,17,241,6,17,209,2,97,0,0,0,0,20,31,0,0,0,0,0,0
+,1,0,0,0,16,201,9,97,0,0,0,0,20,13,8,0,0,0,0,0,1,0,0,0,16,5,5,97,0,0,0,0
+,20,69,16,0,0,0,0,0,1,0,0,0,16,13,5,97,0,0,0,0,20,21,24,0,0,0,0,0,1,0,0,0
+,16,21,5,97,0,0,0,0,20,15,32,0,0,0,0,0,1,0,0,0,16,25,5,97,0,0,0,0,20,61,40,0
+,0,0,0,0,1,0,0,0,16,41,5,97,0,0,0,0,20,57,48,0,0,0,0,0,1,0,0,0,16,69,13,97
+,0,0,0,0,20,55,56,0,0,0,0,0,1,0,0,0,16,73,13,97,0,0,0,0,20,5,64,0,0,0,0,0
+,1,0,0,0,16,49,5,97,0,0,0,0,20,19,72,0,0,0,0,0,1,0,0,0,16,77,13,97,0,0,0,0
+,20,25,80,0,0,0,0,0,1,0,0,0,16,81,13,97,0,0,0,0,20,63,88,0,0,0,0,0,1,0,0,0
+,16,61,5,97,0,0,0,0,20,53,96,0,0,0,0,0,1,0,0,0,16,69,5,97,0,0,0,0,20,23,104,0
+,0,0,0,0,1,0,0,0,16,85,13,97,0,0,0,0,20,45,112,0,0,0,0,0,1,0,0,0,16,33,5,97
+,0,0,0,0,20,43,120,0,0,0,0,0,1,0,0,0,16,37,5,97,0,0,0,0,20,11,128,0,0,0,0,0
+,1,0,0,0,19,141,1,97,0,0,0,0,20,37,136,0,0,0,0,0,1,0,0,0,17,189,3,97,0,0,0,0
+,20,65,144,0,0,0,0,0,1,0,0,0,16,112,97,0,0,0,0,20,1,152,0,0,0,0,0,1,0,0,0,16
+,120,97,0,0,0,0,20,7,160,0,0,0,0,0,1,0,0,0,17,237,5,97,0,0,0,0,20,17,168,0,0,0
+,0,0,1,0,0,0,16,29,5,97,0,0,0,0,20,47,176,0,0,0,0,0,1,0,0,0,16,17,5,97,0,0
+,0,0,20,49,184,0,0,0,0,0,1,0,0,0,16,89,13,97,0,0,0,0,20,33,192,0,0,0,0,0,1,0
+,0,0,16,93,13,97,0,0,0,0,20,9,200,0,0,0,0,0,1,0,0,0,16,45,5,97,0,0,0,0,20,39
+,208,0,0,0,0,0,1,0,0,0,16,9,5,97,0,0,0,0,20,41,216,0,0,0,0,0,1,0,0,0,16,65
+,5,97,0,0,0,0,20,35,224,0,0,0,0,0,1,0,0,0,16,53,5,97,0,0,0,0,20,59,232,0,0,0
+,0,0,1,0,0,0,16,57,5,97,0,0,0,0,20,29,240,0,0,0,0,0,1,0,0,0,19,125,1,97,0,0
+,0,0,20,3,248,0,0,0,0,0,1,0,0,0,17,29,5,97,0,0,0,0,20,27,0,1,0,0,0,0,1,0
+,0,0,17,17,6,97,0,0,0,0,28,51,8,1,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17
+,253,1,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0
+,0,0,0,1,0,0,0,2,152,17,9,1,96,0,0,0,0,36,0,0,0,10,40,97,46,2,28,12,32,128,93,16
+,97,13,10,0,0,17,41,7,16,101,13,2,28,145,128,93,16,105,13,146,147,16,109,13,2,28,145,128,93,16,113,13
+,146,147,16,117,13,2,28,145,128,93,16,121,13,146,147,16,125,13,2,28,145,128,93,16,129,13,146,147,16,133,13,2
+,28,145,128,93,16,137,13,146,147,16,141,13,2,28,145,128,93,16,145,13,146,147,16,149,13,2,28,145,128,93,16,153
+,13,146,147,16,157,13,2,28,145,128,93,16,161,13,146,147,16,165,13,2,28,145,128,93,16,169,13,146,147,16,173,13
+,2,28,145,128,93,16,177,13,146,147,16,181,13,2,28,145,128,93,16,185,13,146,147,16,189,13,2,28,145,128,93,16
+,193,13,146,147,16,197,13,2,28,145,128,93,16,201,13,146,147,16,205,13,2,28,145,128,93,16,209,13,146,147,16,213
+,13,2,28,145,128,93,16,217,13,146,147,16,221,13,2,28,145,128,93,16,225,13,146,147,16,229,13,2,28,145,128,93
+,16,233,13,146,147,16,237,13,2,28,145,128,93,16,241,13,146,147,16,245,13,2,28,145,128,93,16,249,13,146,147,16
+,253,13,10,44,193,35,2,28,145,128,93,16,1,14,146,147,16,5,14,2,28,145,128,93,16,9,14,146,147,16,13,14
+,2,28,145,128,93,16,17,14,146,147,16,21,14,2,28,145,128,93,16,25,14,146,147,16,29,14,2,28,145,128,93,16
+,33,14,146,147,16,37,14,2,28,145,128,93,16,41,14,146,147,16,45,14,2,28,145,128,93,16,49,14,146,147,16,53
+,14,2,28,145,128,93,16,57,14,146,147,16,61,14,2,28,145,128,93,16,65,14,146,147,16,69,14,2,28,145,128,93
+,16,73,14,146,147,16,77,14,10,20,65,24,2,28,4,40,74,97,7,3,0,27,33,4,0,25,255,43,64,8,0,0
+,0,0,70,10,0,97,34,2,132,17,212,96,10,0,10,0,0,0,0,0,17,197,1,16,5,5,97,0,0,0,0,0
+,9,0,0,0,0,0,0,1,0,0,0,16,112,97,0,0,0,0,0,13,8,0,0,0,0,0,1,0,0,0,16,13
+,5,97,0,0,0,0,0,19,16,0,0,0,0,0,1,0,0,0,16,21,5,97,0,0,0,0,0,7,24,0,0,0
+,0,0,1,0,0,0,16,25,5,97,0,0,0,0,0,1,32,0,0,0,0,0,1,0,0,0,16,89,13,97,0,0
+,0,0,0,15,40,0,0,0,0,0,1,0,0,0,16,93,13,97,0,0,0,0,0,5,48,0,0,0,0,0,1,0
+,0,0,16,33,5,97,0,0,0,0,0,17,56,0,0,0,0,0,1,0,0,0,17,189,3,97,0,0,0,0,0,3
+,64,0,0,0,0,0,1,0,0,0,16,120,97,0,0,0,0,0,11,72,0,0,0,0,0,1,0,0,0,96,0,0
+,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,32,17,9,1,96,0,0,0,0,6
+,0,0,0,132,71,93,130,71,128,68,93,96,0,0,0,0,0,0,0,0,10,40,97,46,2,24,151,96,1,0,1,0
+,0,0,0,0,144,17,197,3,96,0,0,0,0,55,1,0,0,17,241,6,96,0,0,0,0,0,0,0,0,146,147,2
+,24,90,98,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,17,141,5,36,4
+,40,74,97,4,4,4,27,35,4,0,9,255,7,0,10,0,0,0,0,10,40,161,55,12,17,1,10,44,97,51,96,0
+,0,0,0,0,0,0,0,17,253,1,17,45,7,2,24,90,98,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,1,0,0,0,144,36,4,40,74,97,4,4,4,27,35,4,0,33,255,7,0,10,0,0,0,0,145
+,12,29,1,147,96,0,0,0,0,0,0,0,0,148,149,2,24,90,98,0,0,0,0,4,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,1,0,0,0,144,36,4,40,74,97,4,4,4,27,35,4,0,41,255,7,0,10,0,0,0
+,0,145,12,33,1,147,96,0,0,0,0,0,0,0,0,148,149,2,24,90,98,0,0,0,0,4,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,1,0,0,0,144,36,4,40,74,97,4,4,4,27,35,4,0,17,255,7,0,10,0
+,0,0,0,145,12,37,1,147,96,0,0,0,0,0,0,0,0,148,149,2,24,90,98,0,0,0,0,4,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,17,141,5,36,4,40,74,97,4,4,4,27,35,4,0,25,255
+,7,64,8,0,0,0,0,10,40,161,55,12,41,1,10,44,97,51,96,0,0,0,0,0,0,0,0,17,253,1,17,45
+,7,96,0,0,0,0,0,0,0,0,149,68,2,20,87,17,57,4,96,0,0,0,0,80,2,0,0,10,0,97,34,149
+,2,20,87,17,41,5,96,0,0,0,0,80,42,0,0,2,32,4,40,74,97,8,8,2,25,57,4,194,25,255,19,64
+,8,0,0,0,0,10,16,1,18,10,0,33,45,2,60,17,212,96,4,0,4,0,0,0,0,0,17,197,1,17,197,3
+,96,0,0,0,0,31,7,0,0,17,13,7,17,249,3,96,0,0,0,0,31,1,0,0,17,9,7,17,109,4,96,0
+,0,0,0,63,5,0,0,17,17,7,17,177,5,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0,0,96,0
+,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,20,17,9,1,97,0,0,0,0
+,3,0,0,0,0,0,0,0,226,0,0,0,128,68,93,16,81,14,10,0,0,17,41,7,16,165,4,4,40,74,97,5
+,3,3,27,41,4,0,25,255,7,64,8,0,0,0,0,2,28,4,40,74,97,7,3,7,27,33,4,0,25,255,19,80
+,8,0,0,0,0,10,16,193,22,10,0,97,34,2,60,17,212,96,4,0,4,0,0,0,0,0,17,197,1,17,209,2
+,97,0,0,0,0,16,7,0,0,0,0,0,0,1,0,0,0,17,249,3,97,0,0,0,0,212,2,8,0,0,0,0
+,0,1,0,0,0,17,229,3,97,0,0,0,0,212,4,16,0,0,0,0,0,1,0,0,0,17,29,5,97,0,0,0
+,0,212,0,24,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,21,2,2,28
+,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0,0,0
+,17,201,1,93,10,44,33,57,17,41,5,73,10,16,97,26,150,2,24,17,212,96,1,0,1,0,0,0,0,0,17,197
+,1,17,217,4,96,0,0,0,0,23,1,0,0,17,253,6,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96
+,0,0,0,0,0,0,0,0,149,2,20,87,17,73,5,96,0,0,0,0,80,44,0,0,2,32,4,40,74,97,8,8
+,2,25,57,4,194,25,255,19,64,8,0,0,0,0,10,16,1,18,10,0,33,45,2,60,17,212,96,4,0,4,0,0
+,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,7,0,0,17,13,7,17,249,3,96,0,0,0,0,31,1,0
+,0,17,9,7,17,109,4,96,0,0,0,0,63,5,0,0,17,17,7,17,177,5,97,0,0,0,0,16,3,0,0,0
+,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2
+,20,17,9,1,97,0,0,0,0,3,0,0,0,0,0,0,0,227,0,0,0,128,68,93,16,85,14,10,0,0,17,41
+,7,16,165,4,4,40,74,97,5,3,3,27,41,4,0,25,255,7,64,8,0,0,0,0,2,28,4,40,74,97,7,3
+,7,27,33,4,0,25,255,19,80,8,0,0,0,0,10,16,193,22,10,0,97,34,2,60,17,212,96,4,0,4,0,0
+,0,0,0,17,197,1,17,209,2,97,0,0,0,0,16,7,0,0,0,0,0,0,1,0,0,0,17,249,3,97,0,0
+,0,0,212,2,8,0,0,0,0,0,1,0,0,0,17,229,3,97,0,0,0,0,212,4,16,0,0,0,0,0,1,0
+,0,0,17,29,5,97,0,0,0,0,212,0,24,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17
+,253,1,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0
+,0,0,0,1,0,0,0,17,201,1,93,10,48,65,2,17,73,5,73,10,16,97,26,148,2,24,17,212,96,1,0,1
+,0,0,0,0,0,17,197,1,17,217,4,96,0,0,0,0,23,1,0,0,17,253,6,96,0,0,0,0,0,0,0,0
+,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,147,68,2,20,87,17,41,3,96,0,0,0,0,80,32,0,0
+,10,16,1,18,147,68,2,20,87,17,61,5,96,0,0,0,0,56,18,0,0,68,147,2,20,87,17,49,3,96,0,0
+,0,0,80,106,0,0,2,28,12,32,128,93,16,89,14,10,0,0,17,41,7,16,93,14,17,253,1,2,20,87,17,165
+,3,96,0,0,0,0,80,62,0,0,2,32,4,40,74,97,8,8,1,25,57,4,194,25,255,23,64,8,0,0,0,0
+,10,16,1,38,10,0,33,45,2,72,17,212,96,5,0,5,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0
+,31,9,0,0,17,13,7,17,249,3,96,0,0,0,0,31,7,0,0,17,9,7,17,109,4,96,0,0,0,0,63,1
+,0,0,17,17,7,16,21,6,97,0,0,0,0,56,5,0,0,0,0,0,0,1,0,0,0,17,177,5,97,0,0,0
+,0,16,3,8,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0
+,0,0,0,0,0,2,20,17,9,1,98,0,0,0,0,3,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,74
+,0,0,0,68,93,16,97,14,10,0,0,17,41,7,16,29,6,4,40,74,97,11,11,11,28,27,4,0,161,255,3,64
+,8,0,0,0,0,2,28,4,40,74,97,7,3,5,27,33,4,0,25,255,11,80,8,0,0,0,0,10,16,65,45,10
+,0,97,34,2,36,17,212,96,2,0,2,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0,0,16,3,0,0,0
+,0,0,0,1,0,0,0,16,21,6,97,0,0,0,0,124,0,8,0,0,0,0,0,1,0,0,0,96,0,0,0,0
+,0,0,0,0,17,253,1,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255
+,255,68,68,96,0,0,0,0,1,0,0,0,17,201,1,93,10,48,129,13,96,0,0,0,0,2,0,0,0,128,68,151
+,94,96,0,0,0,0,0,0,0,0,147,148,96,0,0,0,0,0,0,0,0,147,2,20,87,17,173,3,96,0,0,0
+,0,80,58,0,0,2,32,4,40,74,97,8,8,1,25,57,4,194,25,255,23,64,8,0,0,0,0,10,16,1,38,10
+,0,33,45,2,72,17,212,96,5,0,5,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,9,0,0,17
+,13,7,17,249,3,96,0,0,0,0,31,7,0,0,17,9,7,17,109,4,96,0,0,0,0,63,1,0,0,17,17,7
+,16,21,6,97,0,0,0,0,56,5,0,0,0,0,0,0,1,0,0,0,17,177,5,97,0,0,0,0,16,3,8,0
+,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0
+,2,20,17,9,1,98,0,0,0,0,3,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,76,0,0,0,68,93
+,16,101,14,10,0,0,17,41,7,16,29,6,4,40,74,97,11,11,11,28,27,4,0,145,255,3,64,8,0,0,0,0
+,2,28,4,40,74,97,7,3,5,27,33,4,0,25,255,11,80,8,0,0,0,0,10,16,65,45,10,0,97,34,2,36
+,17,212,96,2,0,2,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0
+,0,0,16,21,6,97,0,0,0,0,124,0,8,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17
+,253,1,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0
+,0,0,0,1,0,0,0,17,201,1,93,10,48,225,20,96,0,0,0,0,1,0,0,0,128,68,146,94,96,0,0,0
+,0,0,0,0,0,150,151,96,0,0,0,0,0,0,0,0,150,129,68,2,20,87,17,245,4,96,0,0,0,0,80,24
+,0,0,2,32,4,40,74,97,8,8,0,25,57,4,194,25,255,75,64,8,0,0,0,0,10,0,97,35,10,0,33,45
+,2,228,17,212,96,18,0,18,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,31,0,0,17,13,7,17
+,249,3,96,0,0,0,0,31,9,0,0,17,9,7,17,109,4,96,0,0,0,0,63,29,0,0,17,17,7,16,105,14
+,97,0,0,0,0,16,19,0,0,0,0,0,0,1,0,0,0,16,109,14,97,0,0,0,0,16,7,8,0,0,0,0
+,0,1,0,0,0,16,113,14,97,0,0,0,0,56,35,16,0,0,0,0,0,1,0,0,0,16,117,14,97,0,0,0
+,0,56,11,24,0,0,0,0,0,1,0,0,0,16,121,14,97,0,0,0,0,56,1,32,0,0,0,0,0,1,0,0
+,0,16,125,14,97,0,0,0,0,56,21,40,0,0,0,0,0,1,0,0,0,16,233,9,97,0,0,0,0,56,5,48
+,0,0,0,0,0,1,0,0,0,16,237,9,97,0,0,0,0,56,3,56,0,0,0,0,0,1,0,0,0,16,1,10
+,97,0,0,0,0,56,23,64,0,0,0,0,0,1,0,0,0,16,5,10,97,0,0,0,0,56,17,72,0,0,0,0
+,0,1,0,0,0,16,129,14,97,0,0,0,0,56,25,80,0,0,0,0,0,1,0,0,0,16,9,10,97,0,0,0
+,0,56,27,88,0,0,0,0,0,1,0,0,0,16,133,14,97,0,0,0,0,56,13,96,0,0,0,0,0,1,0,0
+,0,16,137,14,97,0,0,0,0,56,15,104,0,0,0,0,0,1,0,0,0,16,141,14,97,0,0,0,0,56,33,112
+,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0
+,0,2,68,17,9,1,96,0,0,0,0,15,0,0,0,2,28,12,32,128,93,16,145,14,10,0,0,17,41,7,16,149
+,14,2,28,145,128,93,16,153,14,146,147,16,157,14,17,233,5,17,21,6,17,25,6,17,237,5,17,249,5,17,245,5
+,17,253,5,17,1,6,17,5,6,17,9,6,17,13,6,17,29,6,17,17,6,93,16,161,14,10,0,0,17,41,7,16
+,165,14,4,40,74,97,4,4,4,27,17,4,0,25,255,3,64,8,0,0,0,0,2,28,4,40,74,97,7,3,2,27
+,33,4,0,25,255,27,80,24,0,0,0,0,10,0,129,33,10,0,97,34,2,84,17,212,96,6,0,6,0,0,0,0
+,0,17,197,1,17,209,2,97,0,0,0,0,16,5,0,0,0,0,0,0,1,0,0,0,17,29,6,97,0,0,0,0
+,220,10,8,0,0,0,0,0,1,0,0,0,17,29,5,97,0,0,0,0,212,6,16,0,0,0,0,0,1,0,0,0
+,17,81,5,97,0,0,0,0,212,2,24,0,0,0,0,0,1,0,0,0,16,169,14,96,0,0,0,0,23,9,0,0
+,2,12,17,77,6,2,28,12,32,128,93,16,173,14,10,0,0,17,41,7,16,177,14,68,17,13,6,97,0,0,0,0
+,220,0,32,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133,6
+,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0,0,0,2,20,17
+,9,1,96,0,0,0,0,3,0,0,0,2,28,148,128,93,16,181,14,149,150,16,185,14,128,68,93,10,48,65,28,17
+,245,4,2,28,12,32,128,93,16,189,14,10,0,0,17,41,7,16,193,14,2,28,150,128,93,16,197,14,151,144,16,201
+,14,148,94,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,145,68,2,20,87
+,17,45,5,96,0,0,0,0,80,60,0,0,2,32,4,40,74,97,8,8,1,25,57,4,194,25,255,23,64,8,0,0
+,0,0,10,16,1,38,10,0,33,45,2,72,17,212,96,5,0,5,0,0,0,0,0,17,197,1,17,197,3,96,0,0
+,0,0,31,9,0,0,17,13,7,17,249,3,96,0,0,0,0,31,7,0,0,17,9,7,17,109,4,96,0,0,0,0
+,63,1,0,0,17,17,7,16,21,6,97,0,0,0,0,56,5,0,0,0,0,0,0,1,0,0,0,17,177,5,97,0
+,0,0,0,16,3,8,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0
+,0,0,0,0,0,0,0,2,20,17,9,1,98,0,0,0,0,3,0,0,0,0,0,0,0,2,0,0,0,0,0,0
+,0,198,0,0,0,68,93,16,205,14,10,0,0,17,41,7,16,29,6,4,40,74,97,11,11,11,28,27,4,0,153,255
+,3,64,8,0,0,0,0,2,28,4,40,74,97,7,3,5,27,33,4,0,25,255,11,80,8,0,0,0,0,10,16,65
+,45,10,0,97,34,2,36,17,212,96,2,0,2,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0,0,16,3,0
+,0,0,0,0,0,1,0,0,0,16,21,6,97,0,0,0,0,124,0,8,0,0,0,0,0,1,0,0,0,96,0,0
+,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255
+,255,255,255,68,68,96,0,0,0,0,1,0,0,0,17,201,1,93,10,48,193,49,96,0,0,0,0,2,0,0,0,128
+,68,149,94,96,0,0,0,0,0,0,0,0,145,146,96,0,0,0,0,0,0,0,0,145,128,68,2,20,87,17,85,5
+,96,0,0,0,0,80,86,0,0,2,32,4,40,74,97,8,8,2,25,57,4,194,25,255,19,64,8,0,0,0,0,10
+,0,97,35,10,0,33,45,2,60,17,212,96,4,0,4,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31
+,7,0,0,17,13,7,17,249,3,96,0,0,0,0,31,1,0,0,17,9,7,17,109,4,96,0,0,0,0,63,5,0
+,0,17,17,7,17,177,5,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0
+,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,20,17,9,1,97,0,0,0,0,3,0,0,0,0,0
+,0,0,100,0,0,0,128,68,93,16,209,14,10,0,0,17,41,7,16,213,14,4,40,74,97,4,4,4,30,30,4,0
+,25,255,3,64,8,0,0,0,0,2,28,4,40,74,97,7,3,1,27,33,4,0,25,255,27,80,24,0,0,0,0,10
+,0,129,33,10,0,97,34,21,2,2,84,17,212,96,6,0,6,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0
+,0,16,3,0,0,0,0,0,0,1,0,0,0,16,21,12,97,0,0,0,0,212,4,8,0,0,0,0,0,1,0,0
+,0,17,105,3,97,0,0,0,0,212,6,16,0,0,0,0,0,1,0,0,0,17,193,4,97,0,0,0,0,212,10,24
+,0,0,0,0,0,1,0,0,0,17,129,3,97,0,0,0,0,212,8,32,0,0,0,0,0,1,0,0,0,17,29,6
+,97,0,0,0,0,220,0,40,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7
+,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0
+,0,0,2,20,17,9,1,96,0,0,0,0,3,0,0,0,2,28,12,32,128,93,16,217,14,10,0,0,17,41,7,16
+,221,14,17,85,5,68,93,10,48,33,57,2,28,148,128,93,16,225,14,149,150,16,229,14,2,28,148,128,93,16,233,14
+,149,150,16,237,14,2,28,148,128,93,16,241,14,149,150,16,245,14,144,94,96,0,0,0,0,0,0,0,0,17,253,1
+,17,45,7,96,0,0,0,0,0,0,0,0,145,2,20,87,17,53,5,96,0,0,0,0,80,56,0,0,2,32,4,40
+,74,97,8,8,1,25,57,4,194,25,255,23,64,8,0,0,0,0,10,16,1,38,10,0,33,45,2,72,17,212,96,5
+,0,5,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,9,0,0,17,13,7,17,249,3,96,0,0,0
+,0,31,7,0,0,17,9,7,17,109,4,96,0,0,0,0,63,1,0,0,17,17,7,16,21,6,97,0,0,0,0,56
+,5,0,0,0,0,0,0,1,0,0,0,17,177,5,97,0,0,0,0,16,3,8,0,0,0,0,0,1,0,0,0,96
+,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,20,17,9,1,98,0,0,0
+,0,3,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,200,0,0,0,68,93,16,249,14,10,0,0,17,41,7
+,16,29,6,4,40,74,97,11,11,11,28,27,4,0,137,255,3,64,8,0,0,0,0,2,28,4,40,74,97,7,3,5
+,27,33,4,0,25,255,11,80,8,0,0,0,0,10,16,65,45,10,0,97,34,2,36,17,212,96,2,0,2,0,0,0
+,0,0,17,197,1,17,209,2,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0,0,16,21,6,97,0,0,0
+,0,124,0,8,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133
+,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0,0,0,17,201
+,1,93,10,52,65,8,96,0,0,0,0,1,0,0,0,128,68,149,94,96,0,0,0,0,0,0,0,0,145,146,96,0
+,0,0,0,0,0,0,0,145,130,68,2,20,87,17,45,4,96,0,0,0,0,80,8,0,0,2,32,4,40,74,97,8
+,8,0,25,57,4,194,25,255,75,64,8,0,0,0,0,10,0,97,35,10,0,33,45,2,228,17,212,96,18,0,18,0
+,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,29,0,0,17,13,7,17,249,3,96,0,0,0,0,31,33
+,0,0,17,9,7,17,109,4,96,0,0,0,0,63,15,0,0,17,17,7,17,177,5,97,0,0,0,0,16,7,0,0
+,0,0,0,0,1,0,0,0,16,45,6,97,0,0,0,0,16,27,8,0,0,0,0,0,1,0,0,0,16,253,14,97
+,0,0,0,0,16,21,16,0,0,0,0,0,1,0,0,0,16,1,15,97,0,0,0,0,16,1,24,0,0,0,0,0
+,1,0,0,0,16,5,15,97,0,0,0,0,16,5,32,0,0,0,0,0,1,0,0,0,16,89,12,97,0,0,0,0
+,16,3,40,0,0,0,0,0,1,0,0,0,16,9,15,97,0,0,0,0,16,31,48,0,0,0,0,0,1,0,0,0
+,16,13,15,97,0,0,0,0,56,11,56,0,0,0,0,0,1,0,0,0,16,17,15,97,0,0,0,0,56,23,64,0
+,0,0,0,0,1,0,0,0,17,253,3,97,0,0,0,0,56,35,72,0,0,0,0,0,1,0,0,0,16,21,15,97
+,0,0,0,0,56,25,80,0,0,0,0,0,1,0,0,0,16,25,15,97,0,0,0,0,56,13,88,0,0,0,0,0
+,1,0,0,0,16,29,15,97,0,0,0,0,56,19,96,0,0,0,0,0,1,0,0,0,16,33,15,97,0,0,0,0
+,56,9,104,0,0,0,0,0,1,0,0,0,16,37,15,97,0,0,0,0,56,17,112,0,0,0,0,0,1,0,0,0
+,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,68,17,9,1,97,0,0
+,0,0,15,0,0,0,0,0,0,0,113,0,0,0,2,28,12,32,128,93,16,41,15,10,0,0,17,41,7,16,45,15
+,2,28,150,128,93,16,49,15,151,144,16,53,15,2,28,150,128,93,16,57,15,151,144,16,61,15,2,28,150,128,93,16
+,65,15,151,144,16,69,15,10,40,129,1,2,28,150,128,93,16,73,15,151,144,16,77,15,16,81,15,16,85,15,17,5
+,2,16,89,15,17,13,2,16,93,15,16,97,15,16,101,15,93,16,105,15,151,144,16,109,15,4,40,74,97,4,4,4
+,27,17,4,0,25,255,3,64,8,0,0,0,0,2,16,4,40,74,97,4,4,2,27,17,4,0,25,255,31,80,8,0
+,0,0,0,10,0,129,33,10,0,97,34,2,96,17,212,96,7,0,7,0,0,0,0,0,17,197,1,17,209,2,97,0
+,0,0,0,20,9,0,0,0,0,0,0,1,0,0,0,16,113,15,97,0,0,0,0,20,3,8,0,0,0,0,0,1
+,0,0,0,16,117,15,97,0,0,0,0,20,11,16,0,0,0,0,0,1,0,0,0,16,121,15,97,0,0,0,0,20
+,5,24,0,0,0,0,0,1,0,0,0,17,29,5,97,0,0,0,0,20,13,32,0,0,0,0,0,1,0,0,0,17
+,81,5,97,0,0,0,0,20,7,40,0,0,0,0,0,1,0,0,0,19,125,1,97,0,0,0,0,20,1,48,0,0
+,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2
+,44,17,9,1,96,0,0,0,0,9,0,0,0,10,52,161,15,2,28,12,32,128,93,16,125,15,10,0,0,17,41,7
+,16,129,15,2,28,151,128,93,16,133,15,144,145,16,137,15,2,28,151,128,93,16,141,15,144,145,16,145,15,2,28,151
+,128,93,16,149,15,144,145,16,153,15,2,28,151,128,93,16,157,15,144,145,16,161,15,2,28,151,128,93,16,165,15,144
+,145,16,169,15,128,68,93,96,0,0,0,0,0,0,0,0,150,94,96,0,0,0,0,0,0,0,0,147,148,96,0,0
+,0,0,0,0,0,0,147,2,20,87,16,9,15,96,0,0,0,0,80,12,0,0,10,52,97,29,147,68,2,20,87,17
+,125,4,96,0,0,0,0,80,36,0,0,2,32,4,40,74,97,8,8,2,25,57,4,194,25,255,19,64,8,0,0,0
+,0,10,16,1,18,10,0,33,45,2,60,17,212,96,4,0,4,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0
+,0,31,7,0,0,17,13,7,17,249,3,96,0,0,0,0,31,1,0,0,17,9,7,17,109,4,96,0,0,0,0,63
+,5,0,0,17,17,7,17,177,5,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0
+,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,20,17,9,1,97,0,0,0,0,3,0,0,0
+,0,0,0,0,220,0,0,0,128,68,93,16,173,15,10,0,0,17,41,7,16,165,4,4,40,74,97,5,3,3,27,41
+,4,0,25,255,7,64,8,0,0,0,0,2,28,4,40,74,97,7,3,7,27,33,4,0,25,255,19,80,8,0,0,0
+,0,10,16,193,22,10,0,97,34,2,60,17,212,96,4,0,4,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0
+,0,16,7,0,0,0,0,0,0,1,0,0,0,17,249,3,97,0,0,0,0,212,2,8,0,0,0,0,0,1,0,0
+,0,17,229,3,97,0,0,0,0,212,4,16,0,0,0,0,0,1,0,0,0,17,29,5,97,0,0,0,0,212,0,24
+,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133,6,68,97,0
+,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0,0,0,17,201,1,93,10,52
+,161,41,17,125,4,73,10,16,97,26,144,2,24,17,212,96,1,0,1,0,0,0,0,0,17,197,1,17,217,4,96,0
+,0,0,0,23,1,0,0,17,253,6,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0
+,0,0,151,2,20,87,16,177,15,96,0,0,0,0,80,102,0,0,2,28,12,32,128,93,16,181,15,10,0,0,17,41
+,7,16,185,15,151,130,68,2,20,87,17,57,5,96,0,0,0,0,80,72,0,0,2,32,4,40,74,97,8,8,1,25
+,57,4,194,25,255,23,64,8,0,0,0,0,10,16,1,38,10,0,33,45,2,72,17,212,96,5,0,5,0,0,0,0
+,0,17,197,1,17,197,3,96,0,0,0,0,31,9,0,0,17,13,7,17,249,3,96,0,0,0,0,31,7,0,0,17
+,9,7,17,109,4,96,0,0,0,0,63,1,0,0,17,17,7,16,21,6,97,0,0,0,0,56,5,0,0,0,0,0
+,0,1,0,0,0,17,177,5,97,0,0,0,0,16,3,8,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0
+,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,20,17,9,1,98,0,0,0,0,3,0,0,0,0
+,0,0,0,1,0,0,0,0,0,0,0,201,0,0,0,68,93,16,189,15,10,0,0,17,41,7,16,29,6,4,40,74
+,97,11,11,11,28,27,4,0,201,255,3,64,8,0,0,0,0,2,28,4,40,74,97,7,3,5,27,33,4,0,25,255
+,11,80,8,0,0,0,0,10,16,65,45,10,0,97,34,2,36,17,212,96,2,0,2,0,0,0,0,0,17,197,1,17
+,209,2,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0,0,16,21,6,97,0,0,0,0,124,0,8,0,0
+,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133,6,68,97,0,0,0
+,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0,0,0,17,201,1,93,10,52,161,51
+,96,0,0,0,0,1,0,0,0,128,68,150,94,96,0,0,0,0,0,0,0,0,146,147,96,0,0,0,0,0,0,0
+,0,146,2,20,87,17,125,2,96,0,0,0,0,80,76,0,0,2,32,4,40,74,97,8,8,1,25,57,4,194,25,255
+,23,64,8,0,0,0,0,10,16,1,38,10,0,33,45,2,72,17,212,96,5,0,5,0,0,0,0,0,17,197,1,17
+,197,3,96,0,0,0,0,31,9,0,0,17,13,7,17,249,3,96,0,0,0,0,31,7,0,0,17,9,7,17,109,4
+,96,0,0,0,0,63,1,0,0,17,17,7,16,21,6,97,0,0,0,0,56,5,0,0,0,0,0,0,1,0,0,0
+,17,177,5,97,0,0,0,0,16,3,8,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1
+,17,45,7,96,0,0,0,0,0,0,0,0,2,20,17,9,1,98,0,0,0,0,3,0,0,0,0,0,0,0,8,0
+,0,0,0,0,0,0,28,0,0,0,68,93,16,193,15,10,0,0,17,41,7,16,29,6,4,40,74,97,11,11,11,28
+,27,4,0,217,255,3,64,8,0,0,0,0,2,28,4,40,74,97,7,3,5,27,33,4,0,25,255,11,80,8,0,0
+,0,0,10,16,65,45,10,0,97,34,21,2,2,36,17,212,96,2,0,2,0,0,0,0,0,17,197,1,17,209,2,97
+,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0,0,16,21,6,97,0,0,0,0,124,0,8,0,0,0,0,0
+,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0
+,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0,0,0,17,201,1,93,10,52,1,59,96,0,0
+,0,0,8,0,0,0,128,68,145,94,96,0,0,0,0,0,0,0,0,149,150,96,0,0,0,0,0,0,0,0,149,2
+,20,87,16,197,15,96,0,0,0,0,80,92,0,0,2,28,4,40,74,97,7,3,0,27,33,4,0,25,255,55,64,8
+,0,0,0,0,10,0,129,33,10,0,97,34,2,168,17,212,96,13,0,13,0,0,0,0,0,17,197,1,17,225,2,97
+,0,0,0,0,16,19,0,0,0,0,0,0,1,0,0,0,17,229,2,97,0,0,0,0,16,3,8,0,0,0,0,0
+,1,0,0,0,17,69,2,97,0,0,0,0,16,11,16,0,0,0,0,0,1,0,0,0,17,205,2,97,0,0,0,0
+,16,21,24,0,0,0,0,0,1,0,0,0,17,105,3,97,0,0,0,0,16,13,32,0,0,0,0,0,1,0,0,0
+,17,109,3,97,0,0,0,0,16,9,40,0,0,0,0,0,1,0,0,0,17,113,3,97,0,0,0,0,16,23,48,0
+,0,0,0,0,1,0,0,0,17,129,3,97,0,0,0,0,16,1,56,0,0,0,0,0,1,0,0,0,17,177,3,97
+,0,0,0,0,16,17,64,0,0,0,0,0,1,0,0,0,17,81,4,97,0,0,0,0,16,5,72,0,0,0,0,0
+,1,0,0,0,17,93,4,97,0,0,0,0,16,25,80,0,0,0,0,0,1,0,0,0,17,193,4,97,0,0,0,0
+,16,7,88,0,0,0,0,0,1,0,0,0,17,201,4,97,0,0,0,0,16,15,96,0,0,0,0,0,1,0,0,0
+,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,44,17,9,1,96,0,0
+,0,0,9,0,0,0,2,28,12,32,128,93,16,201,15,10,0,0,17,41,7,16,205,15,2,28,150,128,93,16,209,15
+,151,144,16,213,15,2,28,150,128,93,16,217,15,151,144,16,221,15,2,28,150,128,93,16,225,15,151,144,16,229,15,2
+,28,150,128,93,16,233,15,151,144,16,237,15,2,28,150,128,93,16,241,15,151,144,16,245,15,2,28,150,128,93,16,249
+,15,151,144,16,253,15,2,28,150,128,93,16,1,16,151,144,16,5,16,2,28,150,128,93,16,9,16,151,144,16,13,16
+,93,2,28,150,128,93,16,17,16,151,144,16,21,16,2,28,150,128,93,16,25,16,151,144,16,29,16,2,28,150,128,93
+,16,33,16,151,144,16,37,16,2,28,150,128,93,16,41,16,151,144,16,45,16,147,2,20,87,17,49,5,96,0,0,0
+,0,80,64,0,0,2,32,4,40,74,97,8,8,1,25,57,4,194,25,255,23,64,8,0,0,0,0,10,16,1,38,10
+,0,33,45,2,72,17,212,96,5,0,5,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,9,0,0,17
+,13,7,17,249,3,96,0,0,0,0,31,7,0,0,17,9,7,17,109,4,96,0,0,0,0,63,1,0,0,17,17,7
+,16,21,6,97,0,0,0,0,56,5,0,0,0,0,0,0,1,0,0,0,17,177,5,97,0,0,0,0,16,3,8,0
+,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0
+,2,20,17,9,1,98,0,0,0,0,3,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,199,0,0,0,68,93
+,16,49,16,10,0,0,17,41,7,16,29,6,4,40,74,97,11,11,11,28,27,4,0,169,255,3,64,8,0,0,0,0
+,2,28,4,40,74,97,7,3,5,27,33,4,0,25,255,11,80,8,0,0,0,0,10,16,65,45,10,0,97,34,2,36
+,17,212,96,2,0,2,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0
+,0,0,16,21,6,97,0,0,0,0,124,0,8,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17
+,253,1,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0
+,0,0,0,1,0,0,0,17,201,1,93,10,56,33,22,96,0,0,0,0,4,0,0,0,128,68,147,94,96,0,0,0
+,0,0,0,0,0,151,144,96,0,0,0,0,0,0,0,0,151,2,20,87,17,117,4,96,0,0,0,0,80,90,0,0
+,2,28,4,40,74,97,7,7,2,25,57,4,66,25,255,15,64,8,0,0,0,0,10,0,97,35,70,2,48,17,212,96
+,3,0,3,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,5,0,0,17,13,7,17,249,3,96,0,0
+,0,0,31,1,0,0,17,9,7,16,53,16,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0,0,96,0,0
+,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,20,17,9,1,96,0,0,0,0,3
+,0,0,0,2,28,12,32,128,93,16,57,16,10,0,0,17,41,7,16,61,16,128,68,93,16,65,16,144,145,16,69,16
+,148,133,68,2,20,87,16,73,16,96,0,0,0,0,80,94,0,0,2,28,151,128,93,16,77,16,144,145,16,81,16,148
+,2,20,87,16,85,16,96,0,0,0,0,80,50,0,0,2,28,4,40,74,97,7,3,2,27,33,4,0,25,255,179,64
+,24,0,0,0,0,10,0,129,33,10,0,97,34,2,29,2,17,212,96,44,0,44,0,0,0,0,0,17,197,1,16,89
+,16,97,0,0,0,0,16,13,0,0,0,0,0,0,1,0,0,0,16,93,16,97,0,0,0,0,16,69,8,0,0,0
+,0,0,1,0,0,0,16,97,16,97,0,0,0,0,16,57,16,0,0,0,0,0,1,0,0,0,16,101,16,97,0,0
+,0,0,16,31,24,0,0,0,0,0,1,0,0,0,16,105,16,97,0,0,0,0,16,65,32,0,0,0,0,0,1,0
+,0,0,16,109,16,97,0,0,0,0,16,45,40,0,0,0,0,0,1,0,0,0,16,113,16,97,0,0,0,0,16,11
+,48,0,0,0,0,0,1,0,0,0,16,117,16,97,0,0,0,0,16,39,56,0,0,0,0,0,1,0,0,0,16,121
+,16,97,0,0,0,0,16,47,64,0,0,0,0,0,1,0,0,0,16,125,16,97,0,0,0,0,16,41,72,0,0,0
+,0,0,1,0,0,0,16,129,16,97,0,0,0,0,16,33,80,0,0,0,0,0,1,0,0,0,16,133,16,97,0,0
+,0,0,16,81,88,0,0,0,0,0,1,0,0,0,16,137,16,97,0,0,0,0,16,83,96,0,0,0,0,0,1,0
+,0,0,16,141,16,97,0,0,0,0,16,9,104,0,0,0,0,0,1,0,0,0,16,145,16,97,0,0,0,0,16,7
+,112,0,0,0,0,0,1,0,0,0,16,149,16,97,0,0,0,0,16,49,120,0,0,0,0,0,1,0,0,0,16,153
+,16,97,0,0,0,0,16,27,128,0,0,0,0,0,1,0,0,0,16,157,16,97,0,0,0,0,16,37,136,0,0,0
+,0,0,1,0,0,0,16,161,16,97,0,0,0,0,16,51,144,0,0,0,0,0,1,0,0,0,16,209,1,97,0,0
+,0,0,16,25,152,0,0,0,0,0,1,0,0,0,16,165,16,97,0,0,0,0,16,63,160,0,0,0,0,0,1,0
+,0,0,16,169,16,97,0,0,0,0,16,29,168,0,0,0,0,0,1,0,0,0,16,173,16,97,0,0,0,0,16,55
+,176,0,0,0,0,0,1,0,0,0,16,177,16,97,0,0,0,0,16,75,184,0,0,0,0,0,1,0,0,0,16,181
+,16,97,0,0,0,0,16,73,192,0,0,0,0,0,1,0,0,0,16,185,16,97,0,0,0,0,16,21,200,0,0,0
+,0,0,1,0,0,0,16,189,16,97,0,0,0,0,16,43,208,0,0,0,0,0,1,0,0,0,16,193,16,97,0,0
+,0,0,16,77,216,0,0,0,0,0,1,0,0,0,16,197,16,97,0,0,0,0,16,71,224,0,0,0,0,0,1,0
+,0,0,16,201,16,97,0,0,0,0,16,87,232,0,0,0,0,0,1,0,0,0,16,205,16,97,0,0,0,0,16,79
+,240,0,0,0,0,0,1,0,0,0,16,209,16,97,0,0,0,0,16,19,248,0,0,0,0,0,1,0,0,0,16,213
+,16,97,0,0,0,0,16,53,0,1,0,0,0,0,1,0,0,0,16,217,16,97,0,0,0,0,16,67,8,1,0,0
+,0,0,1,0,0,0,16,221,16,97,0,0,0,0,16,59,16,1,0,0,0,0,1,0,0,0,16,225,16,97,0,0
+,0,0,56,85,24,1,0,0,0,0,1,0,0,0,16,229,16,97,0,0,0,0,56,23,32,1,0,0,0,0,1,0
+,0,0,16,233,16,97,0,0,0,0,56,61,40,1,0,0,0,0,1,0,0,0,16,237,16,97,0,0,0,0,56,3
+,48,1,0,0,0,0,1,0,0,0,16,241,16,97,0,0,0,0,56,17,56,1,0,0,0,0,1,0,0,0,16,245
+,16,97,0,0,0,0,56,5,64,1,0,0,0,0,1,0,0,0,16,249,16,97,0,0,0,0,56,1,72,1,0,0
+,0,0,1,0,0,0,16,253,16,97,0,0,0,0,56,15,80,1,0,0,0,0,1,0,0,0,17,29,6,97,0,0
+,0,0,24,35,88,1,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0
+,0,0,0,0,0,0,2,176,17,9,1,96,0,0,0,0,42,0,0,0,2,28,12,32,128,93,16,1,17,10,0,0
+,17,41,7,16,5,17,2,28,146,128,93,16,9,17,147,148,16,13,17,2,28,146,128,93,16,17,17,147,148,16,21,17
+,2,28,146,128,93,16,25,17,147,148,16,29,17,2,28,146,128,93,16,33,17,147,148,16,37,17,2,28,146,128,93,16
+,41,17,147,148,16,45,17,21,2,2,28,146,128,93,16,49,17,147,148,16,53,17,2,28,146,128,93,16,57,17,147,148
+,16,61,17,2,28,146,128,93,16,65,17,147,148,16,69,17,2,28,146,128,93,16,73,17,147,148,16,77,17,2,28,146
+,128,93,16,81,17,147,148,16,85,17,2,28,146,128,93,16,89,17,147,148,16,93,17,2,28,146,128,93,16,97,17,147
+,148,16,101,17,2,28,146,128,93,16,105,17,147,148,16,109,17,2,28,146,128,93,16,113,17,147,148,16,117,17,2,28
+,146,128,93,16,121,17,147,148,16,125,17,2,28,146,128,93,16,129,17,147,148,16,133,17,2,28,146,128,93,16,137,17
+,147,148,16,141,17,2,28,146,128,93,16,145,17,147,148,16,149,17,2,28,146,128,93,16,153,17,147,148,16,157,17,2
+,28,146,128,93,16,161,17,147,148,16,165,17,2,28,146,128,93,16,169,17,147,148,16,173,17,2,28,146,128,93,16,177
+,17,147,148,16,181,17,2,28,146,128,93,16,185,17,147,148,16,189,17,2,28,146,128,93,16,193,17,147,148,16,197,17
+,2,28,146,128,93,16,201,17,147,148,16,205,17,2,28,146,128,93,16,209,17,147,148,16,213,17,2,28,146,128,93,16
+,217,17,147,148,16,221,17,2,28,146,128,93,16,225,17,147,148,16,229,17,2,28,146,128,93,16,233,17,147,148,16,237
+,17,2,28,146,128,93,16,241,17,147,148,16,245,17,16,249,17,16,253,17,16,1,18,16,5,18,16,9,18,16,13,18
+,16,17,18,16,21,18,16,85,16,128,68,93,2,28,146,128,93,16,25,18,147,148,16,29,18,2,28,146,128,93,16,33
+,18,147,148,16,37,18,2,28,146,128,93,16,41,18,147,148,16,45,18,2,28,146,128,93,16,49,18,147,148,16,53,18
+,151,129,68,2,20,87,16,1,15,96,0,0,0,0,80,110,0,0,2,28,146,128,93,16,57,18,147,148,16,61,18,151
+,68,2,20,87,17,93,5,96,0,0,0,0,80,88,0,0,2,32,4,40,74,97,8,8,2,25,57,4,194,25,255,19
+,64,8,0,0,0,0,10,0,97,35,10,0,33,45,2,60,17,212,96,4,0,4,0,0,0,0,0,17,197,1,17,197
+,3,96,0,0,0,0,31,7,0,0,17,13,7,17,249,3,96,0,0,0,0,31,1,0,0,17,9,7,17,109,4,96
+,0,0,0,0,63,5,0,0,17,17,7,17,177,5,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0,0,96
+,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,20,17,9,1,97,0,0,0
+,0,3,0,0,0,0,0,0,0,101,0,0,0,128,68,93,16,65,18,10,0,0,17,41,7,16,69,18,4,40,74,97
+,4,4,4,30,31,4,0,25,255,3,64,8,0,0,0,0,2,28,4,40,74,97,7,3,2,27,33,4,0,25,255,23
+,80,24,0,0,0,0,10,0,129,33,10,0,97,34,2,72,17,212,96,5,0,5,0,0,0,0,0,17,197,1,17,209
+,2,97,0,0,0,0,16,7,0,0,0,0,0,0,1,0,0,0,16,21,12,97,0,0,0,0,212,2,8,0,0,0
+,0,0,1,0,0,0,17,129,3,97,0,0,0,0,212,8,16,0,0,0,0,0,1,0,0,0,17,53,2,97,0,0
+,0,0,212,4,24,0,0,0,0,0,1,0,0,0,17,29,6,97,0,0,0,0,220,0,32,0,0,0,0,0,1,0
+,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0
+,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0,0,0,2,20,17,9,1,96,0,0,0,0,3,0,0
+,0,17,93,5,128,68,93,10,60,129,27,2,28,12,32,128,93,16,73,18,10,0,0,17,41,7,16,77,18,2,28,148
+,128,93,16,81,18,149,150,16,85,18,2,28,148,128,93,16,89,18,149,150,16,93,18,147,94,96,0,0,0,0,0,0
+,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,151,68,2,20,87,17,137,2,96,0,0,0,0,80,20
+,0,0,2,32,4,40,74,97,8,8,2,25,57,4,194,25,255,19,64,8,0,0,0,0,10,0,97,35,10,0,33,45
+,2,60,17,212,96,4,0,4,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,7,0,0,17,13,7,17
+,249,3,96,0,0,0,0,31,1,0,0,17,9,7,17,109,4,96,0,0,0,0,63,5,0,0,17,17,7,17,177,5
+,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7
+,96,0,0,0,0,0,0,0,0,2,20,17,9,1,97,0,0,0,0,3,0,0,0,0,0,0,0,30,0,0,0,128
+,68,93,16,97,18,10,0,0,17,41,7,16,101,18,4,40,74,97,4,4,4,27,17,4,0,25,255,3,64,8,0,0
+,0,0,2,16,4,40,74,97,4,4,0,27,17,4,0,25,255,15,80,8,0,0,0,0,10,0,129,33,10,0,97,34
+,2,48,17,212,96,3,0,3,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0,0,20,3,0,0,0,0,0,0
+,1,0,0,0,17,29,5,97,0,0,0,0,20,5,8,0,0,0,0,0,1,0,0,0,17,81,5,97,0,0,0,0
+,20,1,16,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0
+,0,0,0,0,2,20,17,9,1,96,0,0,0,0,3,0,0,0,10,60,225,38,2,28,12,32,128,93,16,105,18,10
+,0,0,17,41,7,16,109,18,2,28,149,128,93,16,113,18,150,151,16,117,18,93,72,148,94,96,0,0,0,0,0,0
+,0,0,145,146,96,0,0,0,0,0,0,0,0,145,68,2,20,87,17,93,2,96,0,0,0,0,80,54,0,0,2,32
+,4,40,74,97,8,8,1,25,57,4,194,25,255,27,64,8,0,0,0,0,10,0,97,35,10,0,33,45,2,84,17,212
+,96,6,0,6,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,7,0,0,17,13,7,17,249,3,96,0
+,0,0,0,31,9,0,0,17,9,7,17,109,4,96,0,0,0,0,63,1,0,0,17,17,7,16,121,18,97,0,0,0
+,0,16,5,0,0,0,0,0,0,1,0,0,0,17,177,5,97,0,0,0,0,16,3,8,0,0,0,0,0,1,0,0
+,0,17,5,6,96,0,0,0,0,23,11,0,0,2,12,17,77,6,2,28,12,32,128,93,16,125,18,10,0,0,17,41
+,7,16,221,2,68,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,20,17
+,9,1,96,0,0,0,0,3,0,0,0,2,28,150,128,93,16,129,18,151,144,16,133,18,96,0,0,0,0,8,0,0
+,0,68,93,16,137,18,151,144,16,141,18,4,40,74,97,8,8,8,23,36,4,0,25,255,3,64,8,0,0,0,0,2
+,28,4,40,74,97,7,3,6,27,33,4,0,25,255,19,80,24,0,0,0,0,10,0,129,33,10,0,97,34,2,60,17
+,212,96,4,0,4,0,0,0,0,0,17,197,1,17,29,6,97,0,0,0,0,24,1,0,0,0,0,0,0,1,0,0
+,0,17,209,2,97,0,0,0,0,212,4,8,0,0,0,0,0,1,0,0,0,17,157,2,96,0,0,0,0,23,3,0
+,0,2,12,17,77,6,2,28,12,32,128,93,16,145,18,10,0,0,17,41,7,16,149,18,68,16,61,5,97,0,0,0
+,0,212,6,16,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133
+,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0,0,0,17,201
+,1,93,17,93,2,10,60,97,47,2,28,12,32,128,93,16,153,18,10,0,0,17,41,7,16,157,18,68,148,94,96,0
+,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,144,128,68,2,20,87,17,81,3,96
+,0,0,0,0,80,4,0,0,10,0,33,45,144,68,93,150,18,0,150,18,0,2,8,17,77,1,96,0,0,0,0,0
+,0,0,0,4,40,74,97,7,3,7,27,33,4,0,25,255,19,64,8,0,0,0,0,10,0,129,33,10,0,97,34,2
+,60,17,212,96,4,0,4,0,0,0,0,0,17,197,1,17,105,3,97,0,0,0,0,0,1,0,0,0,0,0,0,1
+,0,0,0,17,193,4,97,0,0,0,0,0,3,8,0,0,0,0,0,1,0,0,0,17,33,3,97,0,0,0,0,0
+,7,16,0,0,0,0,0,1,0,0,0,17,197,2,97,0,0,0,0,0,5,24,0,0,0,0,0,1,0,0,0,96
+,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,68,10,60,97,47,12,245,1,2
+,28,12,32,128,93,16,161,18,10,0,0,17,41,7,16,165,18,10,40,97,46,68,4,40,74,97,5,5,5,27,38,4
+,0,25,255,3,64,8,0,0,0,0,2,28,4,40,74,97,7,3,7,27,33,4,0,25,255,19,80,24,0,0,0,0
+,21,2,2,28,4,40,74,97,7,3,4,27,33,4,0,25,255,7,80,8,0,0,0,0,10,0,129,33,10,0,97,34
+,2,24,17,212,96,1,0,1,0,0,0,0,0,17,197,1,17,233,5,97,0,0,0,0,16,1,0,0,0,0,0,0
+,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,17,201,1,93
+,2,28,12,32,128,93,16,169,18,10,0,0,17,41,7,16,221,2,129,68,10,0,97,34,2,60,17,212,96,4,0,4
+,0,0,0,0,0,17,197,1,17,13,4,97,0,0,0,0,16,1,0,0,0,0,0,0,1,0,0,0,17,157,4,97
+,0,0,0,0,16,3,8,0,0,0,0,0,1,0,0,0,17,17,5,97,0,0,0,0,16,7,16,0,0,0,0,0
+,1,0,0,0,17,29,6,97,0,0,0,0,24,5,24,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0
+,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,17,201,1,93,2,28,12,32,128,93,16,173,18,10,0,0
+,17,41,7,16,177,18,2,28,146,128,93,16,181,18,147,148,16,185,18,2,28,146,128,93,16,189,18,147,148,16,193,18
+,16,197,18,70,94,96,0,0,0,0,0,0,0,0,151,144,96,0,0,0,0,0,0,0,0,16,201,18,16,205,18,2
+,32,4,40,74,97,8,8,8,25,57,4,194,25,255,15,64,8,0,0,0,0,10,0,33,45,149,2,48,17,212,96,3
+,0,3,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,1,0,0,17,13,7,17,249,3,96,0,0,0
+,0,31,5,0,0,17,9,7,17,109,4,96,0,0,0,0,63,3,0,0,17,17,7,96,0,0,0,0,0,0,0,0
+,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,128,93,16,209,18,10,0,0,17,41,7,16,213,18,4,40,74
+,97,7,7,7,25,57,4,2,25,255,11,64,8,0,0,0,0,2,28,4,40,74,97,7,3,5,27,33,4,0,25,255
+,11,80,24,0,0,0,0,10,0,97,35,10,0,97,34,2,36,17,212,96,2,0,2,0,0,0,0,0,17,197,1,17
+,29,6,97,0,0,0,0,24,1,0,0,0,0,0,0,1,0,0,0,17,209,2,96,0,0,0,0,220,2,8,0,36
+,12,13,2,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0
+,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0,0,0,17,201,1,93,16,217,18,10,64,1,7,128
+,68,149,2,36,17,212,96,2,0,2,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,1,0,0,17,13
+,7,17,249,3,96,0,0,0,0,31,3,0,0,17,9,7,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96
+,0,0,0,0,0,0,0,0,4,40,74,97,11,11,11,27,24,4,0,25,255,3,64,8,0,0,0,0,128,70,94,96
+,0,0,0,0,0,0,0,0,148,149,96,0,0,0,0,0,0,0,0,2,32,4,40,74,97,8,8,2,25,57,4,194
+,25,255,19,64,8,0,0,0,0,10,0,33,45,150,2,60,17,212,96,4,0,4,0,0,0,0,0,17,197,1,17,197
+,3,96,0,0,0,0,31,7,0,0,17,13,7,17,249,3,96,0,0,0,0,31,1,0,0,17,9,7,17,109,4,96
+,0,0,0,0,63,5,0,0,17,17,7,17,177,5,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0,0,96
+,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,20,17,9,1,97,0,0,0
+,0,3,0,0,0,0,0,0,0,18,0,0,0,128,68,93,16,221,18,10,0,0,17,41,7,16,225,18,4,40,74,97
+,8,8,8,25,57,4,130,25,255,15,64,8,0,0,0,0,2,28,4,40,74,97,7,3,6,27,33,4,0,25,255,15
+,80,24,0,0,0,0,10,0,97,35,10,0,97,34,2,48,17,212,96,3,0,3,0,0,0,0,0,17,197,1,17,109
+,4,97,0,0,0,0,24,3,0,0,0,0,0,0,1,0,0,0,17,29,6,97,0,0,0,0,24,1,8,0,0,0
+,0,0,1,0,0,0,17,209,2,96,0,0,0,0,220,4,16,0,36,12,29,2,96,0,0,0,0,0,0,0,0,17
+,253,1,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0
+,0,0,0,1,0,0,0,17,201,1,93,2,28,4,40,74,97,7,3,2,27,33,4,0,25,255,23,80,24,0,0,0
+,0,10,64,0,10,0,97,34,2,72,17,212,96,5,0,5,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0,0
+,24,5,0,0,0,0,0,0,1,0,0,0,17,29,6,97,0,0,0,0,24,7,8,0,0,0,0,0,1,0,0,0
+,17,13,4,97,0,0,0,0,16,3,16,0,0,0,0,0,1,0,0,0,17,157,4,97,0,0,0,0,16,9,24,0
+,0,0,0,0,1,0,0,0,17,17,5,97,0,0,0,0,16,1,32,0,0,0,0,0,1,0,0,0,96,0,0,0
+,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,20,17,9,1,96,0,0,0,0,3,0
+,0,0,2,28,12,32,128,93,16,229,18,10,0,0,17,41,7,16,233,18,128,68,93,10,64,1,17,16,237,18,2,28
+,149,128,93,16,241,18,150,151,16,245,18,2,28,149,128,93,16,249,18,150,151,16,253,18,16,1,19,10,64,129,13,68
+,145,2,48,17,212,96,3,0,3,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,1,0,0,17,13,7
+,17,249,3,96,0,0,0,0,31,5,0,0,17,9,7,17,109,4,96,0,0,0,0,55,3,0,0,17,17,7,96,0
+,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,16,5,19,16,9,19,16,13,19,16
+,17,19,16,21,19,16,25,19,16,29,19,2,28,4,40,74,97,7,3,0,27,33,4,0,25,255,55,64,8,0,0,0
+,0,10,0,129,33,10,0,97,34,2,168,17,212,96,13,0,13,0,0,0,0,0,17,197,1,16,33,19,97,0,0,0
+,0,16,11,0,0,0,0,0,0,1,0,0,0,16,37,19,97,0,0,0,0,16,3,8,0,0,0,0,0,1,0,0
+,0,17,53,2,97,0,0,0,0,16,25,16,0,0,0,0,0,1,0,0,0,19,81,3,97,0,0,0,0,16,7,24
+,0,0,0,0,0,1,0,0,0,16,41,19,97,0,0,0,0,16,9,32,0,0,0,0,0,1,0,0,0,16,45,19
+,97,0,0,0,0,16,5,40,0,0,0,0,0,1,0,0,0,16,49,19,97,0,0,0,0,16,21,48,0,0,0,0
+,0,1,0,0,0,16,53,19,97,0,0,0,0,16,13,56,0,0,0,0,0,1,0,0,0,16,57,19,97,0,0,0
+,0,16,19,64,0,0,0,0,0,1,0,0,0,16,61,19,97,0,0,0,0,16,1,72,0,0,0,0,0,1,0,0
+,0,16,65,19,97,0,0,0,0,16,17,80,0,0,0,0,0,1,0,0,0,16,69,19,97,0,0,0,0,16,23,88
+,0,0,0,0,0,1,0,0,0,16,73,19,97,0,0,0,0,16,15,96,0,0,0,0,0,1,0,0,0,96,0,0
+,0,0,0,0,0,0,146,147,96,0,0,0,0,0,0,0,0,2,44,17,9,1,96,0,0,0,0,9,0,0,0,2
+,28,12,32,128,93,16,77,19,10,0,0,17,41,7,16,81,19,2,28,146,128,93,16,85,19,147,148,16,89,19,2,28
+,146,128,93,16,93,19,147,148,16,97,19,2,28,146,128,93,16,101,19,147,148,16,105,19,2,28,146,128,93,16,109,19
+,147,148,16,113,19,2,28,146,128,93,16,117,19,147,148,16,121,19,2,28,146,128,93,16,125,19,147,148,16,129,19,2
+,28,146,128,93,16,133,19,147,148,16,137,19,2,28,146,128,93,16,141,19,147,148,16,145,19,93,2,28,146,128,93,16
+,149,19,147,148,16,153,19,2,28,146,128,93,16,157,19,147,148,16,161,19,2,28,146,128,93,16,165,19,147,148,16,169
+,19,2,28,146,128,93,16,173,19,147,148,16,177,19,10,40,193,7,10,52,1,59,10,36,161,36,10,60,225,38,4,40
+,74,97,6,6,6,27,56,4,66,25,255,11,64,8,0,0,0,0,10,0,97,35,10,0,97,34,2,36,17,212,96,2
+,0,2,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,1,0,0,17,245,6,17,249,3,96,0,0,0
+,0,31,3,0,0,17,249,6,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0
+,4,40,74,97,6,6,6,27,56,4,2,25,255,11,64,10,0,0,0,0,10,0,97,35,10,0,97,34,2,36,17,212
+,96,2,0,2,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,1,0,0,17,245,6,17,249,3,96,0
+,0,0,0,31,3,0,0,17,249,6,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0
+,0,0,2,28,12,32,128,93,16,181,19,10,0,0,17,41,7,16,185,19,2,28,149,128,93,16,189,19,150,151,16,193
+,19,2,28,149,128,93,16,197,19,150,151,16,201,19,2,28,149,128,93,16,205,19,150,151,16,209,19,2,32,4,40,74
+,97,8,8,8,25,57,4,194,25,255,15,64,10,0,0,0,0,10,0,97,35,10,0,33,45,2,48,17,212,96,3,0
+,3,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,1,0,0,17,13,7,17,249,3,96,0,0,0,0
+,31,5,0,0,17,9,7,17,109,4,96,0,0,0,0,63,3,0,0,17,17,7,96,0,0,0,0,0,0,0,0,17
+,253,1,17,45,7,2,16,90,96,0,0,0,0,2,0,0,0,2,20,17,65,1,97,0,0,0,0,3,0,0,0,0
+,0,0,0,1,0,0,0,35,68,96,0,0,0,0,0,0,0,0,128,93,16,213,19,10,0,0,17,41,7,16,217,19
+,4,40,74,97,3,3,3,27,33,4,0,25,255,3,64,8,0,0,0,0,2,28,4,40,74,97,7,3,2,27,33,4
+,0,25,255,83,80,8,0,0,0,0,10,0,129,33,10,0,97,34,21,2,2,252,17,212,96,20,0,20,0,0,0,0
+,0,17,197,1,17,209,2,97,0,0,0,0,16,37,0,0,0,0,0,0,1,0,0,0,16,221,19,97,0,0,0,0
+,252,38,8,0,0,0,0,0,1,0,0,0,16,225,19,97,0,0,0,0,252,6,16,0,0,0,0,0,1,0,0,0
+,16,229,19,97,0,0,0,0,252,34,24,0,0,0,0,0,1,0,0,0,16,233,19,97,0,0,0,0,252,32,32,0
+,0,0,0,0,1,0,0,0,16,237,19,97,0,0,0,0,252,22,40,0,0,0,0,0,1,0,0,0,16,241,19,97
+,0,0,0,0,252,14,48,0,0,0,0,0,1,0,0,0,16,245,19,97,0,0,0,0,252,30,56,0,0,0,0,0
+,1,0,0,0,16,249,19,97,0,0,0,0,252,4,64,0,0,0,0,0,1,0,0,0,16,253,19,97,0,0,0,0
+,252,12,72,0,0,0,0,0,1,0,0,0,16,1,20,97,0,0,0,0,252,16,80,0,0,0,0,0,1,0,0,0
+,16,5,20,97,0,0,0,0,252,20,88,0,0,0,0,0,1,0,0,0,16,9,20,97,0,0,0,0,252,28,96,0
+,0,0,0,0,1,0,0,0,16,13,20,97,0,0,0,0,252,8,104,0,0,0,0,0,1,0,0,0,16,17,20,97
+,0,0,0,0,252,18,112,0,0,0,0,0,1,0,0,0,16,21,20,97,0,0,0,0,252,26,120,0,0,0,0,0
+,1,0,0,0,16,25,20,97,0,0,0,0,252,2,128,0,0,0,0,0,1,0,0,0,16,29,20,97,0,0,0,0
+,252,24,136,0,0,0,0,0,1,0,0,0,16,33,20,97,0,0,0,0,252,10,144,0,0,0,0,0,1,0,0,0
+,17,29,5,97,0,0,0,0,252,0,152,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1
+,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0
+,0,1,0,0,0,2,80,17,9,1,96,0,0,0,0,18,0,0,0,2,28,12,32,128,93,16,37,20,10,0,0,17
+,41,7,16,41,20,2,28,145,128,93,16,45,20,146,147,16,49,20,2,28,145,128,93,16,53,20,146,147,16,57,20,2
+,28,145,128,93,16,61,20,146,147,16,65,20,2,28,145,128,93,16,69,20,146,147,16,73,20,2,28,145,128,93,16,77
+,20,146,147,16,81,20,2,28,145,128,93,16,85,20,146,147,16,89,20,2,28,145,128,93,16,93,20,146,147,16,97,20
+,2,28,145,128,93,16,101,20,146,147,16,105,20,2,28,145,128,93,16,109,20,146,147,16,113,20,2,28,145,128,93,16
+,117,20,146,147,16,121,20,2,28,145,128,93,16,125,20,146,147,16,129,20,2,28,145,128,93,16,133,20,146,147,16,137
+,20,2,28,145,128,93,16,141,20,146,147,16,145,20,2,28,145,128,93,16,149,20,146,147,16,153,20,2,28,145,128,93
+,16,157,20,146,147,16,161,20,128,68,93,10,64,193,52,2,28,145,128,93,16,165,20,146,147,16,169,20,2,28,145,128
+,93,16,173,20,146,147,16,177,20,2,28,145,128,93,16,181,20,146,147,16,185,20,148,94,96,0,0,0,0,0,0,0
+,0,149,150,96,0,0,0,0,0,0,0,0,2,32,12,57,2,128,93,16,189,20,146,147,16,173,1,4,40,74,97,3
+,3,3,27,39,4,0,25,255,3,64,8,0,0,0,0,2,28,4,40,74,97,7,3,4,27,33,4,0,25,255,7,80
+,8,0,0,0,0,10,0,129,33,10,0,97,34,2,24,17,212,96,1,0,1,0,0,0,0,0,17,197,1,17,209,2
+,97,0,0,0,0,16,1,0,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7
+,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0
+,0,0,17,201,1,93,10,68,225,27,129,68,151,94,96,0,0,0,0,0,0,0,0,147,148,96,0,0,0,0,0,0
+,0,0,4,40,74,97,7,3,7,27,33,4,0,25,255,19,64,8,0,0,0,0,10,0,129,33,10,0,97,34,2,60
+,17,212,96,4,0,4,0,0,0,0,0,17,197,1,17,77,5,97,0,0,0,0,0,1,0,0,0,0,0,0,1,0
+,0,0,17,105,5,97,0,0,0,0,0,7,8,0,0,0,0,0,1,0,0,0,17,33,3,97,0,0,0,0,0,5
+,16,0,0,0,0,0,1,0,0,0,17,197,2,97,0,0,0,0,0,3,24,0,0,0,0,0,1,0,0,0,96,0
+,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,10,20,193,44,10,24,161,20,68,10
+,0,97,35,68,96,0,0,0,0,0,0,0,0,2,28,4,40,74,97,7,3,5,27,33,4,0,25,255,11,64,8,0
+,0,0,0,70,10,0,97,34,2,36,17,212,96,2,0,2,0,0,0,0,0,17,197,1,16,193,20,97,0,0,0,0
+,16,3,0,0,0,0,0,0,1,0,0,0,16,229,1,97,0,0,0,0,16,1,8,0,0,0,0,0,1,0,0,0
+,96,0,0,0,0,0,0,0,0,144,145,96,0,0,0,0,0,0,0,0,17,201,1,93,2,28,12,32,128,93,16,197
+,20,10,0,0,17,41,7,16,201,20,2,28,145,128,93,16,205,20,146,147,16,209,20,128,68,2,28,4,40,74,97,7
+,3,1,27,33,4,0,25,255,51,64,8,0,0,0,0,70,149,2,156,150,96,12,0,12,0,0,0,0,0,151,16,213
+,20,97,0,0,0,0,16,9,0,0,0,0,0,0,1,0,0,0,16,217,20,97,0,0,0,0,16,17,8,0,0,0
+,0,0,1,0,0,0,16,221,20,97,0,0,0,0,16,13,16,0,0,0,0,0,1,0,0,0,16,225,20,97,0,0
+,0,0,16,15,24,0,0,0,0,0,1,0,0,0,16,229,20,97,0,0,0,0,16,7,32,0,0,0,0,0,1,0
+,0,0,16,233,20,97,0,0,0,0,16,19,40,0,0,0,0,0,1,0,0,0,16,237,20,97,0,0,0,0,16,11
+,48,0,0,0,0,0,1,0,0,0,16,241,20,97,0,0,0,0,16,3,56,0,0,0,0,0,1,0,0,0,16,245
+,20,97,0,0,0,0,16,21,64,0,0,0,0,0,1,0,0,0,16,249,20,97,0,0,0,0,16,23,72,0,0,0
+,0,0,1,0,0,0,16,253,20,97,0,0,0,0,16,5,80,0,0,0,0,0,1,0,0,0,16,1,21,97,0,0
+,0,0,16,1,88,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0
+,0,0,0,0,0,0,2,44,17,9,1,96,0,0,0,0,9,0,0,0,2,28,145,128,93,16,5,21,146,147,16,9
+,21,98,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,2,0,0,0,2,28,145,128,93,16
+,13,21,146,147,16,17,21,2,28,145,128,93,16,21,21,146,147,16,25,21,2,28,145,128,93,16,29,21,146,147,16,33
+,21,2,28,145,128,93,16,37,21,146,147,16,41,21,68,93,2,32,12,57,2,128,93,16,45,21,146,147,16,49,21,4
+,40,74,97,4,4,4,27,35,4,0,17,255,7,64,8,0,0,0,0,2,28,4,40,74,97,7,3,0,27,33,4,0
+,25,255,27,80,8,0,0,0,0,70,10,0,97,34,2,84,17,212,96,6,0,6,0,0,0,0,0,17,197,1,16,73
+,13,97,0,0,0,0,60,9,0,0,0,0,0,0,1,0,0,0,16,69,13,97,0,0,0,0,60,1,8,0,0,0
+,0,0,1,0,0,0,16,77,13,97,0,0,0,0,60,7,16,0,0,0,0,0,1,0,0,0,16,81,13,97,0,0
+,0,0,60,5,24,0,0,0,0,0,1,0,0,0,16,85,13,97,0,0,0,0,60,3,32,0,0,0,0,0,1,0
+,0,0,16,61,5,97,0,0,0,0,60,11,40,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,148
+,149,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1
+,0,0,0,2,16,150,96,0,0,0,0,2,0,0,0,10,44,129,30,10,44,193,28,93,10,44,65,25,10,44,97,24
+,10,44,1,27,10,44,225,27,10,68,129,48,2,24,17,212,96,1,0,1,0,0,0,0,0,17,197,1,17,197,3,96
+,0,0,0,0,55,1,0,0,17,241,6,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0
+,0,0,0,2,28,12,32,128,93,16,53,21,10,0,0,17,41,7,16,57,21,2,28,145,128,93,16,61,21,146,147,16
+,65,21,2,28,145,128,93,16,69,21,146,147,16,73,21,4,40,74,97,5,3,5,27,34,4,0,105,255,15,64,10,0
+,0,0,0,10,0,129,33,2,32,12,40,128,93,16,77,21,146,147,16,173,1,4,40,74,97,5,3,5,27,34,4,0
+,17,255,15,64,10,0,0,0,0,148,10,68,193,57,2,48,17,212,96,3,0,3,0,0,0,0,0,17,197,1,17,197
+,3,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0,0,17,169,2,97,0,0,0,0,16,5,8,0,0,0
+,0,0,1,0,0,0,17,237,5,96,0,0,0,0,23,1,0,0,17,237,6,96,0,0,0,0,0,0,0,0,17,253
+,1,17,45,7,96,0,0,0,0,0,0,0,0,2,48,151,96,3,0,3,0,0,0,0,0,144,145,97,0,0,0,0
+,16,3,0,0,0,0,0,0,1,0,0,0,146,97,0,0,0,0,16,5,8,0,0,0,0,0,1,0,0,0,147,96
+,0,0,0,0,23,1,0,0,148,96,0,0,0,0,0,0,0,0,149,150,96,0,0,0,0,0,0,0,0,21,2,2
+,9,16,76,96,0,0,0,0,0,4,0,0,27,185,15,68,10,16,1,37,10,36,129,3,10,0,33,45,21,2,2,32
+,4,40,74,97,8,8,2,25,57,4,194,25,255,19,64,8,0,0,0,0,145,145,2,60,17,212,96,4,0,4,0,0
+,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,7,0,0,17,13,7,17,249,3,96,0,0,0,0,31,1,0
+,0,17,9,7,17,109,4,96,0,0,0,0,63,5,0,0,17,17,7,17,177,5,97,0,0,0,0,16,3,0,0,0
+,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2
+,20,17,9,1,97,0,0,0,0,3,0,0,0,0,0,0,0,53,0,0,0,128,68,93,16,81,21,10,0,0,17,41
+,7,16,85,21,4,40,74,97,8,8,8,25,57,4,130,25,255,15,64,8,0,0,0,0,2,28,4,40,74,97,7,3
+,6,27,33,4,0,25,255,15,80,24,0,0,0,0,10,0,97,35,10,0,97,34,2,48,17,212,96,3,0,3,0,0
+,0,0,0,17,197,1,17,29,6,97,0,0,0,0,24,1,0,0,0,0,0,0,1,0,0,0,17,109,4,97,0,0
+,0,0,24,3,8,0,0,0,0,0,1,0,0,0,17,209,2,96,0,0,0,0,220,4,16,0,36,12,105,2,96,0
+,0,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0
+,255,255,255,255,68,68,96,0,0,0,0,1,0,0,0,17,201,1,93,16,89,21,2,28,4,40,74,97,7,3,2,27
+,33,4,0,25,255,23,80,24,0,0,0,0,2,28,4,40,74,97,7,3,4,27,33,4,0,25,255,7,80,8,0,0
+,0,0,10,0,129,33,10,0,97,34,2,24,17,212,96,1,0,1,0,0,0,0,0,17,197,1,17,237,5,97,0,0
+,0,0,16,1,0,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17
+,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0,0,0,17
+,201,1,93,2,28,12,32,128,93,16,93,21,10,0,0,17,41,7,16,221,2,129,68,10,0,97,34,2,72,17,212,96
+,5,0,5,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0,0,24,5,0,0,0,0,0,0,1,0,0,0,17
+,29,6,97,0,0,0,0,24,7,8,0,0,0,0,0,1,0,0,0,17,13,4,97,0,0,0,0,16,3,16,0,0
+,0,0,0,1,0,0,0,17,157,4,97,0,0,0,0,16,9,24,0,0,0,0,0,1,0,0,0,17,17,5,97,0
+,0,0,0,16,1,32,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0
+,0,0,0,0,0,0,0,2,20,17,9,1,96,0,0,0,0,3,0,0,0,2,28,12,32,128,93,16,97,21,10,0
+,0,17,41,7,16,101,21,128,68,93,10,76,129,3,17,97,3,2,28,147,128,93,16,105,21,148,149,16,109,21,2,28
+,147,128,93,16,113,21,148,149,16,117,21,10,76,0,68,144,2,48,17,212,96,3,0,3,0,0,0,0,0,17,197,1
+,17,197,3,96,0,0,0,0,31,1,0,0,17,13,7,17,249,3,96,0,0,0,0,31,5,0,0,17,9,7,17,109
+,4,96,0,0,0,0,55,3,0,0,17,17,7,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0
+,0,0,0,0,0,4,40,74,97,3,3,3,27,33,4,0,25,255,3,64,8,0,0,0,0,10,76,193,6,10,0,97
+,34,94,96,0,0,0,0,0,0,0,0,145,146,96,0,0,0,0,0,0,0,0,4,40,74,97,3,3,3,27,33,4
+,0,25,255,3,64,8,0,0,0,0,10,64,65,20,148,94,96,0,0,0,0,0,0,0,0,145,146,96,0,0,0,0
+,0,0,0,0,4,40,74,97,6,6,6,27,37,4,0,25,255,3,64,8,0,0,0,0,2,28,4,40,74,97,7,3
+,5,27,33,4,0,25,255,11,80,24,0,0,0,0,10,76,161,7,148,2,36,17,212,96,2,0,2,0,0,0,0,0
+,17,197,1,17,29,6,97,0,0,0,0,24,3,0,0,0,0,0,0,1,0,0,0,17,13,4,97,0,0,0,0,16
+,1,8,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133,6,68
+,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0,0,0,17,201,1,93
+,17,97,2,2,28,12,32,128,93,16,121,21,10,0,0,17,41,7,16,125,21,128,68,2,32,12,57,2,128,93,16,129
+,21,145,146,16,173,1,12,133,2,94,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0
+,0,0,10,76,1,18,10,40,161,55,10,16,193,22,10,76,193,6,10,64,65,20,10,76,161,7,2,28,4,40,74,97
+,7,3,5,27,33,4,0,25,255,11,80,24,0,0,0,0,148,10,0,97,34,2,36,17,212,96,2,0,2,0,0,0
+,0,0,17,197,1,17,29,6,97,0,0,0,0,24,3,0,0,0,0,0,0,1,0,0,0,17,13,4,97,0,0,0
+,0,16,1,8,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133
+,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0,0,0,17,201
+,1,93,17,221,3,2,28,12,32,128,93,16,133,21,10,0,0,17,41,7,16,137,21,128,68,12,9,1,10,0,129,33
+,2,28,4,40,74,97,7,3,5,27,33,4,0,25,255,11,80,24,0,0,0,0,10,76,161,7,10,0,97,34,2,36
+,17,212,96,2,0,2,0,0,0,0,0,17,197,1,17,29,6,97,0,0,0,0,24,3,0,0,0,0,0,0,1,0
+,0,0,17,13,4,97,0,0,0,0,16,1,8,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17
+,253,1,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0
+,0,0,0,1,0,0,0,17,201,1,93,17,197,4,2,28,12,32,128,93,16,141,21,10,0,0,17,41,7,16,145,21
+,128,68,10,36,33,49,12,236,4,40,74,97,5,5,5,27,48,4,0,25,255,3,64,8,0,0,0,0,2,28,4,40
+,74,97,7,3,5,27,33,4,0,25,255,11,80,24,0,0,0,0,10,76,161,7,10,0,97,34,2,36,17,212,96,2
+,0,2,0,0,0,0,0,17,197,1,17,29,6,97,0,0,0,0,24,3,0,0,0,0,0,0,1,0,0,0,17,13
+,4,97,0,0,0,0,16,1,8,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45
+,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1
+,0,0,0,17,201,1,93,16,149,21,2,28,12,32,128,93,16,153,21,10,0,0,17,41,7,16,157,21,128,68,2,32
+,12,57,2,128,93,16,161,21,151,144,16,173,1,12,149,2,94,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7
+,96,0,0,0,0,0,0,0,0,10,76,65,30,10,28,1,48,12,129,1,12,225,1,10,48,129,13,10,36,225,10,10
+,48,225,20,135,68,4,40,74,97,5,3,5,27,33,4,0,25,255,11,64,8,0,0,0,0,10,0,129,33,4,40,74
+,97,5,3,4,27,33,4,0,25,255,7,0,10,0,0,0,0,148,4,40,74,97,5,3,3,27,33,4,0,25,255,3
+,64,10,0,0,0,0,148,10,0,97,34,94,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,36,12,161,2,2
+,36,17,212,96,2,0,2,0,0,0,0,0,17,197,1,17,77,5,97,0,0,0,0,4,3,0,0,0,0,0,0,1
+,0,0,0,17,241,2,97,0,0,0,0,4,1,8,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0
+,150,151,36,12,157,2,10,76,1,35,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0
+,0,0,12,17,1,12,29,1,12,41,1,12,45,1,12,33,1,12,37,1,10,40,161,21,12,5,1,4,40,74,97,5
+,4,5,27,172,0,0,25,255,7,64,24,0,0,0,0,70,10,0,97,34,2,24,17,212,96,1,0,1,0,0,0,0
+,0,17,197,1,17,29,6,97,0,0,0,0,56,1,0,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0
+,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,10,36,1,44,12,232,128,68,10,48,33,57,10,60,129,27
+,128,68,2,9,2,17,65,1,96,0,0,0,0,128,0,0,0,68,36,12,165,2,27,177,1,68,4,40,74,97,5,5
+,5,27,18,4,0,25,255,3,64,10,0,0,0,0,10,76,193,22,2,32,12,57,2,128,93,16,165,21,10,0,0,17
+,41,7,16,173,1,12,173,2,94,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0
+,0,4,40,74,97,5,5,5,27,19,4,0,25,255,3,64,8,0,0,0,0,149,10,76,33,53,94,96,0,0,0,0
+,0,0,0,0,146,147,96,0,0,0,0,0,0,0,0,4,40,74,97,5,5,5,27,20,4,0,25,255,3,64,8,0
+,0,0,0,149,148,94,96,0,0,0,0,0,0,0,0,146,147,96,0,0,0,0,0,0,0,0,96,0,0,0,0,0
+,0,0,0,2,16,75,98,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2
+,9,1,17,216,31,33,8,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,12,76,97,0,0,0,0,1,0,0,0,0,0,0,0,0
+,0,0,0,21,2,2,9,1,17,65,1,96,0,0,0,0,64,0,0,0,27,184,68,10,52,161,15,10,0,97,34,12
+,8,2,32,12,57,2,128,93,16,169,21,10,0,0,17,41,7,16,173,1,4,40,74,97,4,4,4,27,17,4,0,25
+,255,3,64,8,0,0,0,0,2,28,4,40,74,97,7,3,3,27,33,4,0,25,255,3,80,8,0,0,0,0,10,0
+,129,33,144,94,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0
+,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0,0,0,128,93,130,68,10,80,65,8,94,96,0
+,0,0,0,0,0,0,0,150,151,96,0,0,0,0,0,0,0,0,4,40,74,97,4,0,0,45,169,0,2,25,255,3
+,96,26,0,0,0,0,70,10,0,33,45,94,96,0,0,0,0,0,0,0,0,150,97,0,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,4,40,74,97,4,0,0,45,169,0,66,25,255,3,96,26,0,0,0,0,70,146,94,96,0
+,0,0,0,0,0,0,0,150,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,56,129,29,4,40,74
+,97,4,0,0,45,169,0,0,25,255,3,96,26,0,0,0,0,70,147,94,96,0,0,0,0,0,0,0,0,150,97,0
+,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,40,74,97,5,3,5,27,33,4,0,25,255,11,64,8,0
+,0,0,0,149,10,0,97,34,2,36,17,212,96,2,0,2,0,0,0,0,0,17,197,1,17,113,4,97,0,0,0,0
+,0,1,0,0,0,0,0,0,1,0,0,0,17,161,4,97,0,0,0,0,0,3,8,0,0,0,0,0,1,0,0,0
+,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,16,173,21,16,177,21,16,181
+,21,16,185,21,16,189,21,16,193,21,16,197,21,16,201,21,16,205,21,128,68,10,36,193,28,10,16,1,13,10,8,161
+,54,2,28,76,97,0,0,0,0,5,0,0,0,0,0,0,0,2,0,0,0,73,68,97,0,0,0,0,0,0,0,0
+,0,0,0,0,0,0,0,0,10,16,129,9,10,16,161,8,10,12,161,51,12,68,10,16,97,10,4,40,74,97,9,4
+,9,27,35,4,0,25,255,27,64,8,0,0,0,0,10,40,161,55,10,40,97,46,2,84,17,212,96,6,0,6,0,0
+,0,0,0,17,197,1,17,197,3,96,0,0,0,0,55,11,0,0,17,241,6,17,145,3,97,0,0,0,0,0,3,0
+,0,0,0,0,0,1,0,0,0,17,161,3,97,0,0,0,0,0,5,8,0,0,0,0,0,1,0,0,0,17,125,3
+,97,0,0,0,0,0,1,16,0,0,0,0,0,1,0,0,0,17,201,5,97,0,0,0,0,16,7,24,0,0,0,0
+,0,1,0,0,0,17,205,5,97,0,0,0,0,16,9,32,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0
+,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,4,40,74,97,5,4,5,27,35,4,0,25,255,11,64
+,8,0,0,0,0,10,40,161,55,10,40,97,46,2,36,17,212,96,2,0,2,0,0,0,0,0,17,197,1,17,197,3
+,96,0,0,0,0,55,1,0,0,17,241,6,17,125,3,97,0,0,0,0,0,3,0,0,0,0,0,0,1,0,0,0
+,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,10,16,65,11,10,16,33,12
+,4,40,74,97,6,6,6,27,47,4,0,25,255,3,64,8,0,0,0,0,2,28,4,40,74,97,7,3,5,27,33,4
+,0,25,255,11,80,24,0,0,0,0,10,76,161,7,10,0,97,34,2,36,17,212,96,2,0,2,0,0,0,0,0,17
+,197,1,17,29,6,97,0,0,0,0,24,3,0,0,0,0,0,0,1,0,0,0,17,13,4,97,0,0,0,0,16,1
+,8,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133,6,68,97
+,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0,0,0,17,201,1,93,16
+,209,21,2,28,12,32,128,93,16,213,21,10,0,0,17,41,7,16,217,21,128,68,2,32,12,57,2,128,93,16,221,21
+,150,151,16,173,1,12,217,2,94,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0
+,0,2,16,17,180,97,0,0,0,0,2,0,0,0,0,0,0,0,1,0,0,0,2,28,17,156,96,0,0,0,0,5
+,0,0,64,17,41,2,10,0,0,69,151,18,0,68,10,0,1,32,93,4,40,74,97,5,5,5,27,22,4,0,25,255
+,3,64,10,0,0,0,0,10,76,129,26,2,32,12,57,2,128,93,16,225,21,151,17,41,7,16,173,1,12,225,2,94
+,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,4,40,74,97,5,5,5,27
+,21,4,0,25,255,3,64,8,0,0,0,0,145,10,80,225,22,94,96,0,0,0,0,0,0,0,0,149,150,96,0,0
+,0,0,0,0,0,0,2,32,4,40,74,97,8,8,2,25,57,4,194,25,255,23,64,8,0,0,0,0,10,0,97,35
+,10,0,33,45,2,72,17,212,96,5,0,5,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,7,0,0
+,17,13,7,17,249,3,96,0,0,0,0,31,1,0,0,17,9,7,17,109,4,96,0,0,0,0,63,5,0,0,17,17
+,7,17,177,5,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0,0,17,5,6,96,0,0,0,0,23,9,0
+,0,2,12,17,77,6,2,28,12,32,128,93,16,229,21,10,0,0,17,41,7,16,221,2,68,96,0,0,0,0,0,0
+,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,20,17,9,1,97,0,0,0,0,3,0,0,0,0
+,0,0,0,153,0,0,0,128,68,93,16,233,21,150,151,16,141,18,4,40,74,97,8,8,8,23,36,4,0,25,255,3
+,64,8,0,0,0,0,2,28,4,40,74,97,7,3,6,27,33,4,0,25,255,19,80,24,0,0,0,0,10,0,129,33
+,10,0,97,34,2,60,17,212,96,4,0,4,0,0,0,0,0,17,197,1,17,29,6,97,0,0,0,0,24,1,0,0
+,0,0,0,0,1,0,0,0,17,209,2,97,0,0,0,0,212,4,8,0,0,0,0,0,1,0,0,0,17,157,2,96
+,0,0,0,0,23,3,0,0,2,12,17,77,6,2,28,12,32,128,93,16,237,21,10,0,0,17,41,7,16,241,21,68
+,16,61,5,97,0,0,0,0,212,6,16,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1
+,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0
+,0,1,0,0,0,17,201,1,93,17,205,4,10,80,225,23,2,28,12,32,128,93,16,245,21,10,0,0,17,41,7,16
+,249,21,68,147,94,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,12,101,2
+,4,40,74,97,5,3,5,27,34,4,0,113,255,15,64,8,0,0,0,0,10,0,129,33,10,68,193,57,2,48,17,212
+,96,3,0,3,0,0,0,0,0,17,197,1,17,197,3,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0,0
+,17,169,2,97,0,0,0,0,16,5,8,0,0,0,0,0,1,0,0,0,17,237,5,96,0,0,0,0,23,1,0,0
+,17,237,6,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,4,40,74,97,4
+,3,4,27,34,4,0,17,255,15,64,8,0,0,0,0,10,0,129,33,10,68,193,57,2,48,17,212,96,3,0,3,0
+,0,0,0,0,17,197,1,17,197,3,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0,0,17,169,2,96,0
+,0,0,0,63,5,0,0,2,12,17,77,6,10,0,193,40,147,17,237,5,96,0,0,0,0,23,1,0,0,17,237,6
+,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,4,40,74,97,3,3,3,27
+,33,4,0,25,255,3,96,26,0,0,0,0,70,10,0,97,34,94,96,0,0,0,0,0,0,0,0,150,151,96,0,0
+,0,0,0,0,0,0,4,40,74,97,3,3,3,27,33,4,0,25,255,3,96,26,0,0,0,0,10,0,129,33,144,94
+,96,0,0,0,0,0,0,0,0,150,151,96,0,0,0,0,0,0,0,0,21,2,2,21,16,17,25,1,99,0,0,0
+,0,3,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,27,185,15
+,68,21,2,2,20,87,73,97,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,150,12,28,4,40,74,97,9
+,8,9,25,57,4,194,25,255,23,64,8,0,0,0,0,10,0,97,35,10,0,33,45,2,72,17,212,96,5,0,5,0
+,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,5,0,0,17,13,7,17,249,3,97,0,0,0,0,24,7
+,0,0,0,0,0,0,1,0,0,0,17,77,2,96,0,0,0,0,63,1,0,0,17,1,7,17,173,2,96,0,0,0
+,0,63,9,0,0,17,5,7,17,109,4,96,0,0,0,0,55,3,0,0,17,17,7,96,0,0,0,0,0,0,0,0
+,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,4,40,74,97,7,7,7,25,57,4,2,25,255,19,64,8,0
+,0,0,0,10,0,97,35,70,2,60,17,212,96,4,0,4,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0
+,31,5,0,0,17,13,7,17,249,3,96,0,0,0,0,31,7,0,0,17,9,7,17,77,2,96,0,0,0,0,63,1
+,0,0,17,1,7,17,173,2,96,0,0,0,0,63,3,0,0,17,5,7,96,0,0,0,0,0,0,0,0,17,253,1
+,17,45,7,96,0,0,0,0,0,0,0,0,4,40,74,97,8,8,8,25,57,4,194,25,255,23,64,8,0,0,0,0
+,10,0,97,35,10,0,33,45,2,72,17,212,96,5,0,5,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0
+,31,5,0,0,17,13,7,17,249,3,96,0,0,0,0,31,7,0,0,17,9,7,17,77,2,96,0,0,0,0,63,1
+,0,0,17,1,7,17,173,2,96,0,0,0,0,63,9,0,0,17,5,7,17,109,4,96,0,0,0,0,63,3,0,0
+,17,17,7,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,12,40,4,40,74
+,97,9,8,9,25,57,4,194,25,255,15,64,10,0,0,0,0,10,0,97,35,10,0,33,45,2,60,17,212,96,4,0
+,3,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,1,0,0,17,13,7,17,249,3,97,0,0,0,0
+,24,5,0,0,0,0,0,0,1,0,0,0,17,109,4,96,0,0,0,0,55,3,0,0,17,17,7,129,68,96,0,0
+,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,12,57,2,12,32,4,40,74,97,8,7
+,8,25,57,4,2,25,255,11,64,10,0,0,0,0,10,0,97,35,70,2,48,17,212,96,3,0,2,0,0,0,0,0
+,17,197,1,17,197,3,96,0,0,0,0,31,1,0,0,17,13,7,17,249,3,97,0,0,0,0,24,3,0,0,0,0
+,0,0,1,0,0,0,129,68,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0
+,4,40,74,97,8,7,8,25,57,4,2,25,255,15,64,10,0,0,0,0,150,70,2,48,151,96,3,0,3,0,0,0
+,0,0,144,145,96,0,0,0,0,31,5,0,0,146,147,96,0,0,0,0,31,1,0,0,17,9,7,17,165,5,97,0
+,0,0,0,16,3,0,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,148,149,96,0,0,0,0,0
+,0,0,0,4,40,74,97,9,7,9,25,57,4,2,25,255,15,64,10,0,0,0,0,10,0,97,35,70,2,60,17,212
+,96,4,0,3,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,5,0,0,17,13,7,17,249,3,97,0
+,0,0,0,24,1,0,0,0,0,0,0,1,0,0,0,151,97,0,0,0,0,16,3,8,0,0,0,0,0,1,0,0
+,0,129,68,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,4,40,74,97,7
+,7,7,25,57,4,2,25,255,11,64,10,0,0,0,0,10,64,129,9,70,2,36,145,96,2,0,2,0,0,0,0,0
+,146,147,96,0,0,0,0,31,1,0,0,148,149,96,0,0,0,0,31,3,0,0,17,9,7,96,0,0,0,0,0,0
+,0,0,150,151,96,0,0,0,0,0,0,0,0,4,40,74,97,8,7,8,25,57,4,2,25,255,11,64,8,0,0,0
+,0,144,70,2,36,17,212,96,2,0,2,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,1,0,0,17
+,13,7,17,249,3,97,0,0,0,0,24,3,0,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17
+,253,1,17,45,7,96,0,0,0,0,0,0,0,0,4,40,74,97,8,7,8,25,57,4,2,25,255,15,64,8,0,0
+,0,0,10,64,129,9,70,2,48,146,96,3,0,3,0,0,0,0,0,147,148,96,0,0,0,0,31,5,0,0,149,150
+,96,0,0,0,0,31,1,0,0,17,9,7,17,165,5,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0,0
+,96,0,0,0,0,0,0,0,0,151,144,96,0,0,0,0,0,0,0,0,4,40,74,97,9,7,9,25,57,4,2,25
+,255,15,64,8,0,0,0,0,145,70,2,48,17,212,96,3,0,3,0,0,0,0,0,17,197,1,17,197,3,96,0,0
+,0,0,31,5,0,0,17,13,7,17,249,3,97,0,0,0,0,24,1,0,0,0,0,0,0,1,0,0,0,147,97,0
+,0,0,0,16,3,8,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0
+,0,0,0,0,0,0,0,12,109,2,4,40,74,97,9,8,9,25,57,4,130,25,255,15,64,8,0,0,0,0,10,76
+,129,3,70,2,48,17,212,96,3,0,3,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,1,0,0,17
+,13,7,17,249,3,97,0,0,0,0,24,5,0,0,0,0,0,0,1,0,0,0,17,109,4,96,0,0,0,0,55,3
+,0,0,17,17,7,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,4,40,74
+,97,9,8,9,25,57,4,130,25,255,19,64,8,0,0,0,0,10,76,129,3,70,2,60,17,212,96,4,0,4,0,0
+,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,5,0,0,17,13,7,17,249,3,96,0,0,0,0,31,1,0
+,0,17,9,7,17,165,5,97,0,0,0,0,16,7,0,0,0,0,0,0,1,0,0,0,17,109,4,96,0,0,0,0
+,55,3,0,0,17,17,7,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,4
+,40,74,97,10,8,10,25,57,4,130,25,255,19,64,8,0,0,0,0,10,76,129,3,70,2,60,17,212,96,4,0,4
+,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,5,0,0,17,13,7,17,249,3,97,0,0,0,0,24
+,1,0,0,0,0,0,0,1,0,0,0,17,165,5,97,0,0,0,0,16,7,8,0,0,0,0,0,1,0,0,0,17
+,109,4,96,0,0,0,0,55,3,0,0,17,17,7,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0
+,0,0,0,0,0,0,12,33,2,4,40,74,97,9,8,9,25,57,4,130,25,255,15,64,8,0,0,0,0,10,64,1
+,17,70,2,48,17,212,96,3,0,3,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,1,0,0,17,13
+,7,17,249,3,97,0,0,0,0,24,5,0,0,0,0,0,0,1,0,0,0,17,109,4,96,0,0,0,0,55,3,0
+,0,17,17,7,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,4,40,74,97
+,9,8,9,25,57,4,130,25,255,19,64,8,0,0,0,0,10,64,1,17,70,2,60,17,212,96,4,0,4,0,0,0
+,0,0,17,197,1,17,197,3,96,0,0,0,0,31,5,0,0,17,13,7,17,249,3,96,0,0,0,0,31,1,0,0
+,17,9,7,17,165,5,97,0,0,0,0,16,7,0,0,0,0,0,0,1,0,0,0,17,109,4,96,0,0,0,0,55
+,3,0,0,17,17,7,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,4,40
+,74,97,10,8,10,25,57,4,130,25,255,19,64,8,0,0,0,0,10,64,1,17,70,2,60,17,212,96,4,0,4,0
+,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,5,0,0,17,13,7,17,249,3,97,0,0,0,0,24,1
+,0,0,0,0,0,0,1,0,0,0,17,165,5,97,0,0,0,0,16,7,8,0,0,0,0,0,1,0,0,0,17,109
+,4,96,0,0,0,0,55,3,0,0,17,17,7,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0
+,0,0,0,0,0,4,40,74,97,8,8,8,25,57,4,194,25,255,11,80,8,0,0,0,0,10,0,97,35,10,0,33
+,45,2,36,17,212,96,2,0,2,0,0,0,0,0,17,197,1,17,197,3,96,0,0,0,0,31,1,0,0,17,13,7
+,17,109,4,96,0,0,0,0,63,3,0,0,17,17,7,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0
+,0,0,0,0,0,0,0,10,28,97,40,12,176,10,48,65,28,134,68,10,16,1,38,10,16,65,45,10,48,193,49,10
+,56,33,22,10,52,65,8,10,52,161,51,10,44,225,34,10,44,161,36,10,44,1,34,10,44,193,35,10,16,1,18,10
+,16,97,26,10,28,65,31,10,48,1,12,2,32,12,40,128,93,16,253,21,10,0,0,17,41,7,16,173,1,4,40,74
+,97,4,4,4,22,171,0,32,25,255,3,64,26,0,0,0,0,2,28,4,40,74,97,7,3,4,27,33,4,0,25,255
+,7,80,8,0,0,0,0,10,0,129,33,10,0,97,34,2,24,17,212,96,1,0,1,0,0,0,0,0,17,197,1,17
+,209,2,97,0,0,0,0,16,1,0,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17
+,45,7,96,0,0,0,0,0,0,0,0,17,201,1,93,10,88,161,30,129,68,149,94,96,0,0,0,0,0,0,0,0
+,146,147,96,0,0,0,0,0,0,0,0,10,40,65,37,10,40,129,42,10,40,97,36,10,40,97,43,10,0,129,55,10
+,4,97,43,10,36,65,25,10,36,33,35,10,36,65,18,10,52,161,41,10,16,1,17,10,40,0,10,36,97,58,10,36
+,193,62,10,20,65,36,10,44,33,57,10,48,65,2,2,32,4,40,74,97,8,8,2,25,57,4,194,25,255,19,64,8
+,0,0,0,0,10,16,1,18,10,0,33,45,2,60,17,212,96,4,0,4,0,0,0,0,0,17,197,1,17,197,3,96
+,0,0,0,0,31,7,0,0,17,13,7,17,249,3,96,0,0,0,0,31,1,0,0,17,9,7,17,109,4,96,0,0
+,0,0,63,5,0,0,17,17,7,17,177,5,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0,0,96,0,0
+,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,20,17,9,1,97,0,0,0,0,3
+,0,0,0,0,0,0,0,228,0,0,0,128,68,93,16,1,22,10,0,0,17,41,7,16,165,4,4,40,74,97,5,3
+,3,27,41,4,0,25,255,7,64,8,0,0,0,0,2,28,4,40,74,97,7,3,7,27,33,4,0,25,255,19,80,8
+,0,0,0,0,10,16,193,22,10,0,97,34,2,60,17,212,96,4,0,4,0,0,0,0,0,17,197,1,17,209,2,97
+,0,0,0,0,16,7,0,0,0,0,0,0,1,0,0,0,17,249,3,97,0,0,0,0,212,2,8,0,0,0,0,0
+,1,0,0,0,17,229,3,97,0,0,0,0,212,4,16,0,0,0,0,0,1,0,0,0,17,29,5,97,0,0,0,0
+,212,0,24,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133,6
+,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0,0,0,17,201,1
+,93,10,88,65,33,17,165,2,73,10,16,97,26,147,2,24,17,212,96,1,0,1,0,0,0,0,0,17,197,1,17,217
+,4,96,0,0,0,0,23,1,0,0,17,253,6,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0
+,0,0,0,0,0,2,32,4,40,74,97,8,8,2,25,57,4,194,25,255,19,64,8,0,0,0,0,10,16,1,18,10
+,0,33,45,2,60,150,96,4,0,4,0,0,0,0,0,151,17,197,3,96,0,0,0,0,31,7,0,0,17,13,7,17
+,249,3,96,0,0,0,0,31,1,0,0,17,9,7,17,109,4,96,0,0,0,0,63,5,0,0,17,17,7,17,177,5
+,97,0,0,0,0,16,3,0,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7
+,96,0,0,0,0,0,0,0,0,2,20,17,9,1,97,0,0,0,0,3,0,0,0,0,0,0,0,229,0,0,0,128
+,68,93,16,5,22,10,0,0,17,41,7,16,165,4,4,40,74,97,5,3,3,27,41,4,0,25,255,7,64,8,0,0
+,0,0,2,28,4,40,74,97,7,3,7,27,33,4,0,25,255,19,80,8,0,0,0,0,10,16,193,22,10,0,97,34
+,2,60,17,212,96,4,0,4,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0,0,16,7,0,0,0,0,0,0
+,1,0,0,0,17,249,3,97,0,0,0,0,212,2,8,0,0,0,0,0,1,0,0,0,17,229,3,97,0,0,0,0
+,212,4,16,0,0,0,0,0,1,0,0,0,17,29,5,97,0,0,0,0,212,0,24,0,0,0,0,0,1,0,0,0
+,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0
+,0,0,255,255,255,255,68,68,96,0,0,0,0,1,0,0,0,17,201,1,93,10,88,33,41,17,209,3,73,10,16,97
+,26,150,2,24,17,212,96,1,0,1,0,0,0,0,0,17,197,1,17,217,4,96,0,0,0,0,23,1,0,0,17,253
+,6,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,32,4,40,74,97,8
+,8,2,25,57,4,194,25,255,19,64,8,0,0,0,0,10,16,1,18,10,0,33,45,2,60,145,96,4,0,4,0,0
+,0,0,0,146,17,197,3,96,0,0,0,0,31,7,0,0,17,13,7,17,249,3,96,0,0,0,0,31,1,0,0,17
+,9,7,17,109,4,96,0,0,0,0,63,5,0,0,17,17,7,17,177,5,97,0,0,0,0,16,3,0,0,0,0,0
+,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,2,20,17
+,9,1,97,0,0,0,0,3,0,0,0,0,0,0,0,230,0,0,0,128,68,93,16,9,22,10,0,0,17,41,7,16
+,165,4,4,40,74,97,5,3,3,27,41,4,0,25,255,7,64,8,0,0,0,0,2,28,4,40,74,97,7,3,7,27
+,33,4,0,25,255,19,80,8,0,0,0,0,10,16,193,22,10,0,97,34,2,60,17,212,96,4,0,4,0,0,0,0
+,0,17,197,1,17,209,2,97,0,0,0,0,16,7,0,0,0,0,0,0,1,0,0,0,17,249,3,97,0,0,0,0
+,212,2,8,0,0,0,0,0,1,0,0,0,17,229,3,97,0,0,0,0,212,4,16,0,0,0,0,0,1,0,0,0
+,17,29,5,97,0,0,0,0,212,0,24,0,0,0,0,0,1,0,0,0,96,0,0,0,0,0,0,0,0,17,253,1
+,17,45,7,2,28,17,133,6,68,97,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,68,68,96,0,0,0
+,0,1,0,0,0,17,201,1,93,10,88,1,49,17,165,4,73,10,16,97,26,145,2,24,17,212,96,1,0,1,0,0
+,0,0,0,17,197,1,17,217,4,96,0,0,0,0,23,1,0,0,17,253,6,96,0,0,0,0,0,0,0,0,17,253
+,1,17,45,7,96,0,0,0,0,0,0,0,0,10,52,193,6,10,52,225,5,10,60,97,37,144,2,28,12,32,128,93
+,16,13,22,10,0,0,17,41,7,16,109,21,2,28,149,128,93,16,17,22,150,151,16,21,22,2,32,12,40,128,93,16
+,25,22,150,151,16,29,22,4,40,74,97,3,3,3,27,33,4,0,25,255,3,64,8,0,0,0,0,2,28,4,40,74
+,97,7,3,4,27,33,4,0,25,255,7,80,8,0,0,0,0,10,0,129,33,10,0,97,34,2,24,17,212,96,1,0
+,1,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0,0,16,1,0,0,0,0,0,0,1,0,0,0,96,0,0
+,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,17,201,1,93,10,88,161,58,129,68,145
+,94,96,0,0,0,0,0,0,0,0,150,151,96,0,0,0,0,0,0,0,0,2,32,12,40,128,93,16,33,22,10,0
+,0,17,41,7,16,37,22,4,40,74,97,3,3,3,27,33,4,0,25,255,3,64,8,0,0,0,0,2,28,4,40,74
+,97,7,3,4,27,33,4,0,25,255,7,80,8,0,0,0,0,10,0,129,33,10,0,97,34,2,24,17,212,96,1,0
+,1,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0,0,16,1,0,0,0,0,0,0,1,0,0,0,96,0,0
+,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,17,201,1,93,10,88,65,61,129,68,149
+,94,96,0,0,0,0,0,0,0,0,146,147,96,0,0,0,0,0,0,0,0,21,2,2,32,12,40,128,93,16,41,22
+,10,0,0,17,41,7,16,45,22,4,40,74,97,3,3,3,27,33,4,0,25,255,3,64,8,0,0,0,0,2,28,4
+,40,74,97,7,3,4,27,33,4,0,25,255,7,80,8,0,0,0,0,10,0,129,33,10,0,97,34,2,24,17,212,96
+,1,0,1,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0,0,16,1,0,0,0,0,0,0,1,0,0,0,96
+,0,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,17,201,1,93,10,92,0,129,68
+,145,94,96,0,0,0,0,0,0,0,0,150,151,96,0,0,0,0,0,0,0,0,2,32,12,40,128,93,16,49,22,10
+,0,0,17,41,7,16,53,22,4,40,74,97,3,3,3,27,33,4,0,25,255,3,64,8,0,0,0,0,2,28,4,40
+,74,97,7,3,4,27,33,4,0,25,255,7,80,8,0,0,0,0,10,0,129,33,10,0,97,34,2,24,17,212,96,1
+,0,1,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0,0,16,1,0,0,0,0,0,0,1,0,0,0,96,0
+,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,17,201,1,93,10,92,161,2,129,68
+,149,94,96,0,0,0,0,0,0,0,0,146,147,96,0,0,0,0,0,0,0,0,2,32,12,40,128,93,16,57,22,10
+,0,0,17,41,7,16,61,22,4,40,74,97,3,3,3,27,33,4,0,25,255,3,64,8,0,0,0,0,2,28,4,40
+,74,97,7,3,4,27,33,4,0,25,255,7,80,8,0,0,0,0,10,0,129,33,10,0,97,34,2,24,17,212,96,1
+,0,1,0,0,0,0,0,17,197,1,17,209,2,97,0,0,0,0,16,1,0,0,0,0,0,0,1,0,0,0,96,0
+,0,0,0,0,0,0,0,17,253,1,17,45,7,96,0,0,0,0,0,0,0,0,17,201,1,93,10,92,65,5,129,68
+,145,94,96,0,0,0,0,0,0,0,0,150,151,96,0,0,0,0,0,0,0,0,10,4,65,19,10,56,193,19,10,56
+,161,20,10,60,97,4,10,60,33,13,68,10,68,161,47,10,36,65,34,129,68,96,0,0,0,0,0,0,0,0,26,20
+,20,20,20,20,20,20,20,20,20
+};
+static const int blob_size = 215816;
+static const v8::StartupData blob =
+{ (const char*) blob_data, blob_size };
+const v8::StartupData* Snapshot::DefaultSnapshotBlob() {
+  return &blob;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,17 @@
+#ifndef V8_GEN_TORQUE_GENERATED_______DEPS_V8_SRC_BUILTINS_ARGUMENTS_TQ_H_
+#define V8_GEN_TORQUE_GENERATED_______DEPS_V8_SRC_BUILTINS_ARGUMENTS_TQ_H_
+
+#include "src/compiler/code-assembler.h"
+#include "src/codegen/code-stub-assembler.h"
+#include "src/utils/utils.h"
+#include "torque-generated/field-offsets-tq.h"
+#include "torque-generated/csa-types-tq.h"
+
+namespace v8 {
+namespace internal {
+
+TorqueStructArgumentsInfo GetArgumentsFrameAndCount_0(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<JSFunction> p_f);
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_GEN_TORQUE_GENERATED_______DEPS_V8_SRC_BUILTINS_ARGUMENTS_TQ_H_
@@ -0,0 +1,2355 @@
+#include "src/builtins/builtins-array-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-utils-gen.h"
+#include "src/builtins/builtins.h"
+#include "src/codegen/code-factory.h"
+#include "src/heap/factory-inl.h"
+#include "src/objects/arguments.h"
+#include "src/objects/bigint.h"
+#include "src/objects/elements-kind.h"
+#include "src/objects/free-space.h"
+#include "src/objects/js-generator.h"
+#include "src/objects/js-promise.h"
+#include "src/objects/js-regexp-string-iterator.h"
+#include "src/objects/js-weak-refs.h"
+#include "src/objects/objects.h"
+#include "src/objects/source-text-module.h"
+#include "src/objects/stack-frame-info.h"
+#include "src/objects/synthetic-module.h"
+#include "src/objects/template-objects.h"
+#include "src/builtins/builtins-bigint-gen.h"
+#include "src/builtins/builtins-collections-gen.h"
+#include "src/builtins/builtins-data-view-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-iterator-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-string-gen.h"
+#include "src/builtins/builtins-string-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-constructor-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "torque-generated/../../deps/v8/src/builtins/arguments-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-copywithin-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-join-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-lastindexof-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-map-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-right-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reverse-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-shift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-splice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-unshift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/base-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/bigint-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/boolean-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/collections-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/data-view-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/extras-utils-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/frames-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/growable-fixed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/internal-coverage-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/math-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-fromentries-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-constructor-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-delete-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-has-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-is-extensible-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-prevent-extensions-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revocable-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revoke-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/reflect-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-exec-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-all-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-replace-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-search-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-source-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-split-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-test-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-endswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-html-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-pad-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-repeat-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-startswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-substring-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/torque-internal-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-createtypedarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduceright-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-subarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/third_party/v8/builtins/array-sort-tq-csa.h"
+#include "torque-generated/../../deps/v8/test/torque/test-torque-tq-csa.h"
+
+namespace v8 {
+namespace internal {
+
+TF_BUILTIN(ArrayEveryLoopEagerDeoptContinuation, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = UncheckedCast<Object>(Parameter(Descriptor::kReceiver));
+USE(parameter1);
+  TNode<Object> parameter2 = UncheckedCast<Object>(Parameter(Descriptor::kCallback));
+  USE(parameter2);
+  TNode<Object> parameter3 = UncheckedCast<Object>(Parameter(Descriptor::kThisArg));
+  USE(parameter3);
+  TNode<Object> parameter4 = UncheckedCast<Object>(Parameter(Descriptor::kInitialK));
+  USE(parameter4);
+  TNode<Object> parameter5 = UncheckedCast<Object>(Parameter(Descriptor::kLength));
+  USE(parameter5);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, Object> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, Object, JSReceiver> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Object> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Object, Number> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Number> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Number, Object> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Number, Object, Number> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Number> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Number, Number> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2, parameter3, parameter4, parameter5);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    TNode<Object> tmp2;
+    TNode<Object> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4, &tmp5);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 17);
+    TNode<JSReceiver> tmp6;
+    USE(tmp6);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp6 = Cast10JSReceiver_1365(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1}, &label0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp1, tmp6);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block4, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp1);
+    }
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp7;
+    TNode<Object> tmp8;
+    TNode<Object> tmp9;
+    TNode<Object> tmp10;
+    TNode<Object> tmp11;
+    TNode<Object> tmp12;
+    TNode<Object> tmp13;
+    ca_.Bind(&block4, &tmp7, &tmp8, &tmp9, &tmp10, &tmp11, &tmp12, &tmp13);
+    ca_.Goto(&block2, tmp7, tmp8, tmp9, tmp10, tmp11, tmp12);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp14;
+    TNode<Object> tmp15;
+    TNode<Object> tmp16;
+    TNode<Object> tmp17;
+    TNode<Object> tmp18;
+    TNode<Object> tmp19;
+    TNode<Object> tmp20;
+    TNode<JSReceiver> tmp21;
+    ca_.Bind(&block3, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21);
+    ca_.Goto(&block1, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19, tmp21);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp22;
+    TNode<Object> tmp23;
+    TNode<Object> tmp24;
+    TNode<Object> tmp25;
+    TNode<Object> tmp26;
+    TNode<Object> tmp27;
+    ca_.Bind(&block2, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp28;
+    TNode<Object> tmp29;
+    TNode<Object> tmp30;
+    TNode<Object> tmp31;
+    TNode<Object> tmp32;
+    TNode<Object> tmp33;
+    TNode<JSReceiver> tmp34;
+    ca_.Bind(&block1, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 18);
+    TNode<JSReceiver> tmp35;
+    USE(tmp35);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp35 = Cast71UT19ATCallableApiObject17ATCallableJSProxy15JSBoundFunction10JSFunction_1366(state_, TNode<Context>{tmp28}, TNode<Object>{tmp30}, &label0);
+    ca_.Goto(&block7, tmp28, tmp29, tmp30, tmp31, tmp32, tmp33, tmp34, tmp30, tmp35);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block8, tmp28, tmp29, tmp30, tmp31, tmp32, tmp33, tmp34, tmp30);
+    }
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp36;
+    TNode<Object> tmp37;
+    TNode<Object> tmp38;
+    TNode<Object> tmp39;
+    TNode<Object> tmp40;
+    TNode<Object> tmp41;
+    TNode<JSReceiver> tmp42;
+    TNode<Object> tmp43;
+    ca_.Bind(&block8, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43);
+    ca_.Goto(&block6, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp44;
+    TNode<Object> tmp45;
+    TNode<Object> tmp46;
+    TNode<Object> tmp47;
+    TNode<Object> tmp48;
+    TNode<Object> tmp49;
+    TNode<JSReceiver> tmp50;
+    TNode<Object> tmp51;
+    TNode<JSReceiver> tmp52;
+    ca_.Bind(&block7, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52);
+    ca_.Goto(&block5, tmp44, tmp45, tmp46, tmp47, tmp48, tmp49, tmp50, tmp52);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp53;
+    TNode<Object> tmp54;
+    TNode<Object> tmp55;
+    TNode<Object> tmp56;
+    TNode<Object> tmp57;
+    TNode<Object> tmp58;
+    TNode<JSReceiver> tmp59;
+    ca_.Bind(&block6, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp60;
+    TNode<Object> tmp61;
+    TNode<Object> tmp62;
+    TNode<Object> tmp63;
+    TNode<Object> tmp64;
+    TNode<Object> tmp65;
+    TNode<JSReceiver> tmp66;
+    TNode<JSReceiver> tmp67;
+    ca_.Bind(&block5, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66, &tmp67);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 19);
+    TNode<Number> tmp68;
+    USE(tmp68);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp68 = Cast20UT5ATSmi10HeapNumber_85(state_, TNode<Object>{tmp64}, &label0);
+    ca_.Goto(&block11, tmp60, tmp61, tmp62, tmp63, tmp64, tmp65, tmp66, tmp67, tmp64, tmp68);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block12, tmp60, tmp61, tmp62, tmp63, tmp64, tmp65, tmp66, tmp67, tmp64);
+    }
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp69;
+    TNode<Object> tmp70;
+    TNode<Object> tmp71;
+    TNode<Object> tmp72;
+    TNode<Object> tmp73;
+    TNode<Object> tmp74;
+    TNode<JSReceiver> tmp75;
+    TNode<JSReceiver> tmp76;
+    TNode<Object> tmp77;
+    ca_.Bind(&block12, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76, &tmp77);
+    ca_.Goto(&block10, tmp69, tmp70, tmp71, tmp72, tmp73, tmp74, tmp75, tmp76);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp78;
+    TNode<Object> tmp79;
+    TNode<Object> tmp80;
+    TNode<Object> tmp81;
+    TNode<Object> tmp82;
+    TNode<Object> tmp83;
+    TNode<JSReceiver> tmp84;
+    TNode<JSReceiver> tmp85;
+    TNode<Object> tmp86;
+    TNode<Number> tmp87;
+    ca_.Bind(&block11, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86, &tmp87);
+    ca_.Goto(&block9, tmp78, tmp79, tmp80, tmp81, tmp82, tmp83, tmp84, tmp85, tmp87);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp88;
+    TNode<Object> tmp89;
+    TNode<Object> tmp90;
+    TNode<Object> tmp91;
+    TNode<Object> tmp92;
+    TNode<Object> tmp93;
+    TNode<JSReceiver> tmp94;
+    TNode<JSReceiver> tmp95;
+    ca_.Bind(&block10, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp96;
+    TNode<Object> tmp97;
+    TNode<Object> tmp98;
+    TNode<Object> tmp99;
+    TNode<Object> tmp100;
+    TNode<Object> tmp101;
+    TNode<JSReceiver> tmp102;
+    TNode<JSReceiver> tmp103;
+    TNode<Number> tmp104;
+    ca_.Bind(&block9, &tmp96, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 20);
+    TNode<Number> tmp105;
+    USE(tmp105);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp105 = Cast20UT5ATSmi10HeapNumber_85(state_, TNode<Object>{tmp101}, &label0);
+    ca_.Goto(&block15, tmp96, tmp97, tmp98, tmp99, tmp100, tmp101, tmp102, tmp103, tmp104, tmp101, tmp105);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block16, tmp96, tmp97, tmp98, tmp99, tmp100, tmp101, tmp102, tmp103, tmp104, tmp101);
+    }
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp106;
+    TNode<Object> tmp107;
+    TNode<Object> tmp108;
+    TNode<Object> tmp109;
+    TNode<Object> tmp110;
+    TNode<Object> tmp111;
+    TNode<JSReceiver> tmp112;
+    TNode<JSReceiver> tmp113;
+    TNode<Number> tmp114;
+    TNode<Object> tmp115;
+    ca_.Bind(&block16, &tmp106, &tmp107, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115);
+    ca_.Goto(&block14, tmp106, tmp107, tmp108, tmp109, tmp110, tmp111, tmp112, tmp113, tmp114);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp116;
+    TNode<Object> tmp117;
+    TNode<Object> tmp118;
+    TNode<Object> tmp119;
+    TNode<Object> tmp120;
+    TNode<Object> tmp121;
+    TNode<JSReceiver> tmp122;
+    TNode<JSReceiver> tmp123;
+    TNode<Number> tmp124;
+    TNode<Object> tmp125;
+    TNode<Number> tmp126;
+    ca_.Bind(&block15, &tmp116, &tmp117, &tmp118, &tmp119, &tmp120, &tmp121, &tmp122, &tmp123, &tmp124, &tmp125, &tmp126);
+    ca_.Goto(&block13, tmp116, tmp117, tmp118, tmp119, tmp120, tmp121, tmp122, tmp123, tmp124, tmp126);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp127;
+    TNode<Object> tmp128;
+    TNode<Object> tmp129;
+    TNode<Object> tmp130;
+    TNode<Object> tmp131;
+    TNode<Object> tmp132;
+    TNode<JSReceiver> tmp133;
+    TNode<JSReceiver> tmp134;
+    TNode<Number> tmp135;
+    ca_.Bind(&block14, &tmp127, &tmp128, &tmp129, &tmp130, &tmp131, &tmp132, &tmp133, &tmp134, &tmp135);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp136;
+    TNode<Object> tmp137;
+    TNode<Object> tmp138;
+    TNode<Object> tmp139;
+    TNode<Object> tmp140;
+    TNode<Object> tmp141;
+    TNode<JSReceiver> tmp142;
+    TNode<JSReceiver> tmp143;
+    TNode<Number> tmp144;
+    TNode<Number> tmp145;
+    ca_.Bind(&block13, &tmp136, &tmp137, &tmp138, &tmp139, &tmp140, &tmp141, &tmp142, &tmp143, &tmp144, &tmp145);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 23);
+    TNode<Oddball> tmp146;
+    USE(tmp146);
+    tmp146 = Undefined_64(state_);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 24);
+    TNode<Oddball> tmp147;
+    USE(tmp147);
+    tmp147 = Undefined_64(state_);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 22);
+    TNode<Object> tmp148;
+    tmp148 = CodeStubAssembler(state_).CallBuiltin(Builtins::kArrayEveryLoopContinuation, tmp136, tmp142, tmp143, tmp139, tmp146, tmp142, tmp144, tmp145, tmp147);
+    USE(tmp148);
+    CodeStubAssembler(state_).Return(tmp148);
+  }
+}
+
+TF_BUILTIN(ArrayEveryLoopLazyDeoptContinuation, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = UncheckedCast<Object>(Parameter(Descriptor::kReceiver));
+USE(parameter1);
+  TNode<Object> parameter2 = UncheckedCast<Object>(Parameter(Descriptor::kCallback));
+  USE(parameter2);
+  TNode<Object> parameter3 = UncheckedCast<Object>(Parameter(Descriptor::kThisArg));
+  USE(parameter3);
+  TNode<Object> parameter4 = UncheckedCast<Object>(Parameter(Descriptor::kInitialK));
+  USE(parameter4);
+  TNode<Object> parameter5 = UncheckedCast<Object>(Parameter(Descriptor::kLength));
+  USE(parameter5);
+  TNode<Object> parameter6 = UncheckedCast<Object>(Parameter(Descriptor::kResult));
+  USE(parameter6);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, Object> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, Object, JSReceiver> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Object> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Object, Number> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Number> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Number, Object> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Number, Object, Number> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Number> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Number, Number> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Number, Number> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Number, Number> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2, parameter3, parameter4, parameter5, parameter6);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    TNode<Object> tmp2;
+    TNode<Object> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    TNode<Object> tmp6;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4, &tmp5, &tmp6);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 35);
+    TNode<JSReceiver> tmp7;
+    USE(tmp7);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp7 = Cast10JSReceiver_1365(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1}, &label0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp1, tmp7);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block4, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp1);
+    }
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp8;
+    TNode<Object> tmp9;
+    TNode<Object> tmp10;
+    TNode<Object> tmp11;
+    TNode<Object> tmp12;
+    TNode<Object> tmp13;
+    TNode<Object> tmp14;
+    TNode<Object> tmp15;
+    ca_.Bind(&block4, &tmp8, &tmp9, &tmp10, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15);
+    ca_.Goto(&block2, tmp8, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp16;
+    TNode<Object> tmp17;
+    TNode<Object> tmp18;
+    TNode<Object> tmp19;
+    TNode<Object> tmp20;
+    TNode<Object> tmp21;
+    TNode<Object> tmp22;
+    TNode<Object> tmp23;
+    TNode<JSReceiver> tmp24;
+    ca_.Bind(&block3, &tmp16, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24);
+    ca_.Goto(&block1, tmp16, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22, tmp24);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp25;
+    TNode<Object> tmp26;
+    TNode<Object> tmp27;
+    TNode<Object> tmp28;
+    TNode<Object> tmp29;
+    TNode<Object> tmp30;
+    TNode<Object> tmp31;
+    ca_.Bind(&block2, &tmp25, &tmp26, &tmp27, &tmp28, &tmp29, &tmp30, &tmp31);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp32;
+    TNode<Object> tmp33;
+    TNode<Object> tmp34;
+    TNode<Object> tmp35;
+    TNode<Object> tmp36;
+    TNode<Object> tmp37;
+    TNode<Object> tmp38;
+    TNode<JSReceiver> tmp39;
+    ca_.Bind(&block1, &tmp32, &tmp33, &tmp34, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 36);
+    TNode<JSReceiver> tmp40;
+    USE(tmp40);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp40 = Cast71UT19ATCallableApiObject17ATCallableJSProxy15JSBoundFunction10JSFunction_1366(state_, TNode<Context>{tmp32}, TNode<Object>{tmp34}, &label0);
+    ca_.Goto(&block7, tmp32, tmp33, tmp34, tmp35, tmp36, tmp37, tmp38, tmp39, tmp34, tmp40);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block8, tmp32, tmp33, tmp34, tmp35, tmp36, tmp37, tmp38, tmp39, tmp34);
+    }
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp41;
+    TNode<Object> tmp42;
+    TNode<Object> tmp43;
+    TNode<Object> tmp44;
+    TNode<Object> tmp45;
+    TNode<Object> tmp46;
+    TNode<Object> tmp47;
+    TNode<JSReceiver> tmp48;
+    TNode<Object> tmp49;
+    ca_.Bind(&block8, &tmp41, &tmp42, &tmp43, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49);
+    ca_.Goto(&block6, tmp41, tmp42, tmp43, tmp44, tmp45, tmp46, tmp47, tmp48);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp50;
+    TNode<Object> tmp51;
+    TNode<Object> tmp52;
+    TNode<Object> tmp53;
+    TNode<Object> tmp54;
+    TNode<Object> tmp55;
+    TNode<Object> tmp56;
+    TNode<JSReceiver> tmp57;
+    TNode<Object> tmp58;
+    TNode<JSReceiver> tmp59;
+    ca_.Bind(&block7, &tmp50, &tmp51, &tmp52, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59);
+    ca_.Goto(&block5, tmp50, tmp51, tmp52, tmp53, tmp54, tmp55, tmp56, tmp57, tmp59);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp60;
+    TNode<Object> tmp61;
+    TNode<Object> tmp62;
+    TNode<Object> tmp63;
+    TNode<Object> tmp64;
+    TNode<Object> tmp65;
+    TNode<Object> tmp66;
+    TNode<JSReceiver> tmp67;
+    ca_.Bind(&block6, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66, &tmp67);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp68;
+    TNode<Object> tmp69;
+    TNode<Object> tmp70;
+    TNode<Object> tmp71;
+    TNode<Object> tmp72;
+    TNode<Object> tmp73;
+    TNode<Object> tmp74;
+    TNode<JSReceiver> tmp75;
+    TNode<JSReceiver> tmp76;
+    ca_.Bind(&block5, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 37);
+    TNode<Number> tmp77;
+    USE(tmp77);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp77 = Cast20UT5ATSmi10HeapNumber_85(state_, TNode<Object>{tmp72}, &label0);
+    ca_.Goto(&block11, tmp68, tmp69, tmp70, tmp71, tmp72, tmp73, tmp74, tmp75, tmp76, tmp72, tmp77);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block12, tmp68, tmp69, tmp70, tmp71, tmp72, tmp73, tmp74, tmp75, tmp76, tmp72);
+    }
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp78;
+    TNode<Object> tmp79;
+    TNode<Object> tmp80;
+    TNode<Object> tmp81;
+    TNode<Object> tmp82;
+    TNode<Object> tmp83;
+    TNode<Object> tmp84;
+    TNode<JSReceiver> tmp85;
+    TNode<JSReceiver> tmp86;
+    TNode<Object> tmp87;
+    ca_.Bind(&block12, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86, &tmp87);
+    ca_.Goto(&block10, tmp78, tmp79, tmp80, tmp81, tmp82, tmp83, tmp84, tmp85, tmp86);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp88;
+    TNode<Object> tmp89;
+    TNode<Object> tmp90;
+    TNode<Object> tmp91;
+    TNode<Object> tmp92;
+    TNode<Object> tmp93;
+    TNode<Object> tmp94;
+    TNode<JSReceiver> tmp95;
+    TNode<JSReceiver> tmp96;
+    TNode<Object> tmp97;
+    TNode<Number> tmp98;
+    ca_.Bind(&block11, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96, &tmp97, &tmp98);
+    ca_.Goto(&block9, tmp88, tmp89, tmp90, tmp91, tmp92, tmp93, tmp94, tmp95, tmp96, tmp98);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp99;
+    TNode<Object> tmp100;
+    TNode<Object> tmp101;
+    TNode<Object> tmp102;
+    TNode<Object> tmp103;
+    TNode<Object> tmp104;
+    TNode<Object> tmp105;
+    TNode<JSReceiver> tmp106;
+    TNode<JSReceiver> tmp107;
+    ca_.Bind(&block10, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104, &tmp105, &tmp106, &tmp107);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp108;
+    TNode<Object> tmp109;
+    TNode<Object> tmp110;
+    TNode<Object> tmp111;
+    TNode<Object> tmp112;
+    TNode<Object> tmp113;
+    TNode<Object> tmp114;
+    TNode<JSReceiver> tmp115;
+    TNode<JSReceiver> tmp116;
+    TNode<Number> tmp117;
+    ca_.Bind(&block9, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115, &tmp116, &tmp117);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 38);
+    TNode<Number> tmp118;
+    USE(tmp118);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp118 = Cast20UT5ATSmi10HeapNumber_85(state_, TNode<Object>{tmp113}, &label0);
+    ca_.Goto(&block15, tmp108, tmp109, tmp110, tmp111, tmp112, tmp113, tmp114, tmp115, tmp116, tmp117, tmp113, tmp118);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block16, tmp108, tmp109, tmp110, tmp111, tmp112, tmp113, tmp114, tmp115, tmp116, tmp117, tmp113);
+    }
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp119;
+    TNode<Object> tmp120;
+    TNode<Object> tmp121;
+    TNode<Object> tmp122;
+    TNode<Object> tmp123;
+    TNode<Object> tmp124;
+    TNode<Object> tmp125;
+    TNode<JSReceiver> tmp126;
+    TNode<JSReceiver> tmp127;
+    TNode<Number> tmp128;
+    TNode<Object> tmp129;
+    ca_.Bind(&block16, &tmp119, &tmp120, &tmp121, &tmp122, &tmp123, &tmp124, &tmp125, &tmp126, &tmp127, &tmp128, &tmp129);
+    ca_.Goto(&block14, tmp119, tmp120, tmp121, tmp122, tmp123, tmp124, tmp125, tmp126, tmp127, tmp128);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp130;
+    TNode<Object> tmp131;
+    TNode<Object> tmp132;
+    TNode<Object> tmp133;
+    TNode<Object> tmp134;
+    TNode<Object> tmp135;
+    TNode<Object> tmp136;
+    TNode<JSReceiver> tmp137;
+    TNode<JSReceiver> tmp138;
+    TNode<Number> tmp139;
+    TNode<Object> tmp140;
+    TNode<Number> tmp141;
+    ca_.Bind(&block15, &tmp130, &tmp131, &tmp132, &tmp133, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138, &tmp139, &tmp140, &tmp141);
+    ca_.Goto(&block13, tmp130, tmp131, tmp132, tmp133, tmp134, tmp135, tmp136, tmp137, tmp138, tmp139, tmp141);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp142;
+    TNode<Object> tmp143;
+    TNode<Object> tmp144;
+    TNode<Object> tmp145;
+    TNode<Object> tmp146;
+    TNode<Object> tmp147;
+    TNode<Object> tmp148;
+    TNode<JSReceiver> tmp149;
+    TNode<JSReceiver> tmp150;
+    TNode<Number> tmp151;
+    ca_.Bind(&block14, &tmp142, &tmp143, &tmp144, &tmp145, &tmp146, &tmp147, &tmp148, &tmp149, &tmp150, &tmp151);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp152;
+    TNode<Object> tmp153;
+    TNode<Object> tmp154;
+    TNode<Object> tmp155;
+    TNode<Object> tmp156;
+    TNode<Object> tmp157;
+    TNode<Object> tmp158;
+    TNode<JSReceiver> tmp159;
+    TNode<JSReceiver> tmp160;
+    TNode<Number> tmp161;
+    TNode<Number> tmp162;
+    ca_.Bind(&block13, &tmp152, &tmp153, &tmp154, &tmp155, &tmp156, &tmp157, &tmp158, &tmp159, &tmp160, &tmp161, &tmp162);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 43);
+    TNode<BoolT> tmp163;
+    USE(tmp163);
+    tmp163 = ToBoolean_243(state_, TNode<Object>{tmp158});
+    TNode<BoolT> tmp164;
+    USE(tmp164);
+    tmp164 = CodeStubAssembler(state_).Word32BinaryNot(TNode<BoolT>{tmp163});
+    ca_.Branch(tmp164, &block17, &block18, tmp152, tmp153, tmp154, tmp155, tmp156, tmp157, tmp158, tmp159, tmp160, tmp161, tmp162);
+  }
+
+  if (block17.is_used()) {
+    TNode<Context> tmp165;
+    TNode<Object> tmp166;
+    TNode<Object> tmp167;
+    TNode<Object> tmp168;
+    TNode<Object> tmp169;
+    TNode<Object> tmp170;
+    TNode<Object> tmp171;
+    TNode<JSReceiver> tmp172;
+    TNode<JSReceiver> tmp173;
+    TNode<Number> tmp174;
+    TNode<Number> tmp175;
+    ca_.Bind(&block17, &tmp165, &tmp166, &tmp167, &tmp168, &tmp169, &tmp170, &tmp171, &tmp172, &tmp173, &tmp174, &tmp175);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 44);
+    TNode<Oddball> tmp176;
+    USE(tmp176);
+    tmp176 = False_66(state_);
+    CodeStubAssembler(state_).Return(tmp176);
+  }
+
+  if (block18.is_used()) {
+    TNode<Context> tmp177;
+    TNode<Object> tmp178;
+    TNode<Object> tmp179;
+    TNode<Object> tmp180;
+    TNode<Object> tmp181;
+    TNode<Object> tmp182;
+    TNode<Object> tmp183;
+    TNode<JSReceiver> tmp184;
+    TNode<JSReceiver> tmp185;
+    TNode<Number> tmp186;
+    TNode<Number> tmp187;
+    ca_.Bind(&block18, &tmp177, &tmp178, &tmp179, &tmp180, &tmp181, &tmp182, &tmp183, &tmp184, &tmp185, &tmp186, &tmp187);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 47);
+    TNode<Number> tmp188;
+    USE(tmp188);
+    tmp188 = FromConstexpr20UT5ATSmi10HeapNumber17ATconstexpr_int31_161(state_, 1);
+    TNode<Number> tmp189;
+    USE(tmp189);
+    tmp189 = CodeStubAssembler(state_).NumberAdd(TNode<Number>{tmp186}, TNode<Number>{tmp188});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 50);
+    TNode<Oddball> tmp190;
+    USE(tmp190);
+    tmp190 = Undefined_64(state_);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 51);
+    TNode<Oddball> tmp191;
+    USE(tmp191);
+    tmp191 = Undefined_64(state_);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 49);
+    TNode<Object> tmp192;
+    tmp192 = CodeStubAssembler(state_).CallBuiltin(Builtins::kArrayEveryLoopContinuation, tmp177, tmp184, tmp185, tmp180, tmp190, tmp184, tmp189, tmp187, tmp191);
+    USE(tmp192);
+    CodeStubAssembler(state_).Return(tmp192);
+  }
+}
+
+TF_BUILTIN(ArrayEveryLoopContinuation, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<JSReceiver> parameter1 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<0>()));
+  USE(parameter1);
+  TNode<JSReceiver> parameter2 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<1>()));
+  USE(parameter2);
+  TNode<Object> parameter3 = UncheckedCast<Object>(Parameter(Descriptor::ParameterIndex<2>()));
+  USE(parameter3);
+  TNode<Object> parameter4 = UncheckedCast<Object>(Parameter(Descriptor::ParameterIndex<3>()));
+  USE(parameter4);
+  TNode<JSReceiver> parameter5 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<4>()));
+  USE(parameter5);
+  TNode<Number> parameter6 = UncheckedCast<Number>(Parameter(Descriptor::ParameterIndex<5>()));
+  USE(parameter6);
+  TNode<Number> parameter7 = UncheckedCast<Number>(Parameter(Descriptor::ParameterIndex<6>()));
+  USE(parameter7);
+  TNode<Object> parameter8 = UncheckedCast<Object>(Parameter(Descriptor::ParameterIndex<7>()));
+  USE(parameter8);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, Object, JSReceiver, Number, Number, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, Object, JSReceiver, Number, Number, Object, Number> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, Object, JSReceiver, Number, Number, Object, Number> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, Object, JSReceiver, Number, Number, Object, Number, Oddball> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, Object, JSReceiver, Number, Number, Object, Number, Oddball, Object, Object> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, Object, JSReceiver, Number, Number, Object, Number, Oddball, Object, Object> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, Object, JSReceiver, Number, Number, Object, Number, Oddball> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, Object, JSReceiver, Number, Number, Object, Number> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, Object, JSReceiver, Number, Number, Object, Number> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2, parameter3, parameter4, parameter5, parameter6, parameter7, parameter8);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<JSReceiver> tmp2;
+    TNode<Object> tmp3;
+    TNode<Object> tmp4;
+    TNode<JSReceiver> tmp5;
+    TNode<Number> tmp6;
+    TNode<Number> tmp7;
+    TNode<Object> tmp8;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4, &tmp5, &tmp6, &tmp7, &tmp8);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 60);
+    ca_.Goto(&block3, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp6);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp9;
+    TNode<JSReceiver> tmp10;
+    TNode<JSReceiver> tmp11;
+    TNode<Object> tmp12;
+    TNode<Object> tmp13;
+    TNode<JSReceiver> tmp14;
+    TNode<Number> tmp15;
+    TNode<Number> tmp16;
+    TNode<Object> tmp17;
+    TNode<Number> tmp18;
+    ca_.Bind(&block3, &tmp9, &tmp10, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18);
+    TNode<BoolT> tmp19;
+    USE(tmp19);
+    tmp19 = NumberIsLessThan_75(state_, TNode<Number>{tmp18}, TNode<Number>{tmp16});
+    ca_.Branch(tmp19, &block1, &block2, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15, tmp16, tmp17, tmp18);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp20;
+    TNode<JSReceiver> tmp21;
+    TNode<JSReceiver> tmp22;
+    TNode<Object> tmp23;
+    TNode<Object> tmp24;
+    TNode<JSReceiver> tmp25;
+    TNode<Number> tmp26;
+    TNode<Number> tmp27;
+    TNode<Object> tmp28;
+    TNode<Number> tmp29;
+    ca_.Bind(&block1, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27, &tmp28, &tmp29);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 66);
+    TNode<Oddball> tmp30;
+    USE(tmp30);
+    tmp30 = CodeStubAssembler(state_).HasProperty_Inline(TNode<Context>{tmp20}, TNode<JSReceiver>{tmp25}, TNode<Object>{tmp29});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 69);
+    TNode<Oddball> tmp31;
+    USE(tmp31);
+    tmp31 = True_65(state_);
+    TNode<BoolT> tmp32;
+    USE(tmp32);
+    tmp32 = CodeStubAssembler(state_).TaggedEqual(TNode<HeapObject>{tmp30}, TNode<HeapObject>{tmp31});
+    ca_.Branch(tmp32, &block5, &block6, tmp20, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27, tmp28, tmp29, tmp30);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp33;
+    TNode<JSReceiver> tmp34;
+    TNode<JSReceiver> tmp35;
+    TNode<Object> tmp36;
+    TNode<Object> tmp37;
+    TNode<JSReceiver> tmp38;
+    TNode<Number> tmp39;
+    TNode<Number> tmp40;
+    TNode<Object> tmp41;
+    TNode<Number> tmp42;
+    TNode<Oddball> tmp43;
+    ca_.Bind(&block5, &tmp33, &tmp34, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 71);
+    TNode<Object> tmp44;
+    USE(tmp44);
+    tmp44 = CodeStubAssembler(state_).GetProperty(TNode<Context>{tmp33}, TNode<Object>{tmp38}, TNode<Object>{tmp42});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 74);
+    TNode<Object> tmp45;
+    USE(tmp45);
+    tmp45 = CodeStubAssembler(state_).Call(TNode<Context>{tmp33}, TNode<JSReceiver>{tmp35}, TNode<Object>{tmp36}, TNode<Object>{tmp44}, TNode<Object>{tmp42}, TNode<Object>{tmp38});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 77);
+    TNode<BoolT> tmp46;
+    USE(tmp46);
+    tmp46 = ToBoolean_243(state_, TNode<Object>{tmp45});
+    TNode<BoolT> tmp47;
+    USE(tmp47);
+    tmp47 = CodeStubAssembler(state_).Word32BinaryNot(TNode<BoolT>{tmp46});
+    ca_.Branch(tmp47, &block7, &block8, tmp33, tmp34, tmp35, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42, tmp43, tmp44, tmp45);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp48;
+    TNode<JSReceiver> tmp49;
+    TNode<JSReceiver> tmp50;
+    TNode<Object> tmp51;
+    TNode<Object> tmp52;
+    TNode<JSReceiver> tmp53;
+    TNode<Number> tmp54;
+    TNode<Number> tmp55;
+    TNode<Object> tmp56;
+    TNode<Number> tmp57;
+    TNode<Oddball> tmp58;
+    TNode<Object> tmp59;
+    TNode<Object> tmp60;
+    ca_.Bind(&block7, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 78);
+    TNode<Oddball> tmp61;
+    USE(tmp61);
+    tmp61 = False_66(state_);
+    CodeStubAssembler(state_).Return(tmp61);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp62;
+    TNode<JSReceiver> tmp63;
+    TNode<JSReceiver> tmp64;
+    TNode<Object> tmp65;
+    TNode<Object> tmp66;
+    TNode<JSReceiver> tmp67;
+    TNode<Number> tmp68;
+    TNode<Number> tmp69;
+    TNode<Object> tmp70;
+    TNode<Number> tmp71;
+    TNode<Oddball> tmp72;
+    TNode<Object> tmp73;
+    TNode<Object> tmp74;
+    ca_.Bind(&block8, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 69);
+    ca_.Goto(&block6, tmp62, tmp63, tmp64, tmp65, tmp66, tmp67, tmp68, tmp69, tmp70, tmp71, tmp72);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp75;
+    TNode<JSReceiver> tmp76;
+    TNode<JSReceiver> tmp77;
+    TNode<Object> tmp78;
+    TNode<Object> tmp79;
+    TNode<JSReceiver> tmp80;
+    TNode<Number> tmp81;
+    TNode<Number> tmp82;
+    TNode<Object> tmp83;
+    TNode<Number> tmp84;
+    TNode<Oddball> tmp85;
+    ca_.Bind(&block6, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 60);
+    ca_.Goto(&block4, tmp75, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, tmp83, tmp84);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp86;
+    TNode<JSReceiver> tmp87;
+    TNode<JSReceiver> tmp88;
+    TNode<Object> tmp89;
+    TNode<Object> tmp90;
+    TNode<JSReceiver> tmp91;
+    TNode<Number> tmp92;
+    TNode<Number> tmp93;
+    TNode<Object> tmp94;
+    TNode<Number> tmp95;
+    ca_.Bind(&block4, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95);
+    TNode<Number> tmp96;
+    USE(tmp96);
+    tmp96 = FromConstexpr20UT5ATSmi10HeapNumber17ATconstexpr_int31_161(state_, 1);
+    TNode<Number> tmp97;
+    USE(tmp97);
+    tmp97 = CodeStubAssembler(state_).NumberAdd(TNode<Number>{tmp95}, TNode<Number>{tmp96});
+    ca_.Goto(&block3, tmp86, tmp87, tmp88, tmp89, tmp90, tmp91, tmp92, tmp93, tmp94, tmp97);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp98;
+    TNode<JSReceiver> tmp99;
+    TNode<JSReceiver> tmp100;
+    TNode<Object> tmp101;
+    TNode<Object> tmp102;
+    TNode<JSReceiver> tmp103;
+    TNode<Number> tmp104;
+    TNode<Number> tmp105;
+    TNode<Object> tmp106;
+    TNode<Number> tmp107;
+    ca_.Bind(&block2, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104, &tmp105, &tmp106, &tmp107);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 84);
+    TNode<Oddball> tmp108;
+    USE(tmp108);
+    tmp108 = True_65(state_);
+    CodeStubAssembler(state_).Return(tmp108);
+  }
+}
+
+TNode<Object> FastArrayEvery_2(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<JSReceiver> p_o, TNode<Number> p_len, TNode<JSReceiver> p_callbackfn, TNode<Object> p_thisArg, compiler::CodeAssemblerLabel* label_Bailout, compiler::TypedCodeAssemblerVariable<Smi>* label_Bailout_parameter_0) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Number> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Number, Smi> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSReceiver> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSReceiver, JSArray> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Smi, JSArray> block24(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block22(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block23(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Smi, Context, Smi> block28(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Smi, Context, Smi, JSArray, Smi> block32(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Smi, Context, Smi, JSArray, Smi, Object> block31(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Smi, Context, Smi> block29(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Smi, Context, Smi, JSArray, Smi> block34(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Smi, Context, Smi, JSArray, Smi, Object> block33(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Smi, Context, Smi, Object> block27(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block26(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object> block25(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Context, JSReceiver, Object, Object, Smi, JSArray> block35(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object> block36(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object> block37(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Smi, Smi, JSArray, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Smi> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object> block38(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o, p_len, p_callbackfn, p_thisArg);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<Number> tmp2;
+    TNode<JSReceiver> tmp3;
+    TNode<Object> tmp4;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 90);
+    TNode<Smi> tmp5;
+    USE(tmp5);
+    tmp5 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 91);
+    TNode<Smi> tmp6;
+    USE(tmp6);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp6 = Cast5ATSmi_83(state_, TNode<Object>{tmp2}, &label0);
+    ca_.Goto(&block5, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp2, tmp6);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block6, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp2);
+    }
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp7;
+    TNode<JSReceiver> tmp8;
+    TNode<Number> tmp9;
+    TNode<JSReceiver> tmp10;
+    TNode<Object> tmp11;
+    TNode<Smi> tmp12;
+    TNode<Number> tmp13;
+    ca_.Bind(&block6, &tmp7, &tmp8, &tmp9, &tmp10, &tmp11, &tmp12, &tmp13);
+    ca_.Goto(&block4, tmp7, tmp8, tmp9, tmp10, tmp11, tmp12);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp14;
+    TNode<JSReceiver> tmp15;
+    TNode<Number> tmp16;
+    TNode<JSReceiver> tmp17;
+    TNode<Object> tmp18;
+    TNode<Smi> tmp19;
+    TNode<Number> tmp20;
+    TNode<Smi> tmp21;
+    ca_.Bind(&block5, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21);
+    ca_.Goto(&block3, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19, tmp21);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp22;
+    TNode<JSReceiver> tmp23;
+    TNode<Number> tmp24;
+    TNode<JSReceiver> tmp25;
+    TNode<Object> tmp26;
+    TNode<Smi> tmp27;
+    ca_.Bind(&block4, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27);
+    ca_.Goto(&block1, tmp27);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp28;
+    TNode<JSReceiver> tmp29;
+    TNode<Number> tmp30;
+    TNode<JSReceiver> tmp31;
+    TNode<Object> tmp32;
+    TNode<Smi> tmp33;
+    TNode<Smi> tmp34;
+    ca_.Bind(&block3, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 92);
+    TNode<JSArray> tmp35;
+    USE(tmp35);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp35 = Cast13ATFastJSArray_138(state_, TNode<Context>{tmp28}, TNode<HeapObject>{tmp29}, &label0);
+    ca_.Goto(&block9, tmp28, tmp29, tmp30, tmp31, tmp32, tmp33, tmp34, tmp29, tmp35);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block10, tmp28, tmp29, tmp30, tmp31, tmp32, tmp33, tmp34, tmp29);
+    }
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp36;
+    TNode<JSReceiver> tmp37;
+    TNode<Number> tmp38;
+    TNode<JSReceiver> tmp39;
+    TNode<Object> tmp40;
+    TNode<Smi> tmp41;
+    TNode<Smi> tmp42;
+    TNode<JSReceiver> tmp43;
+    ca_.Bind(&block10, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43);
+    ca_.Goto(&block8, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42);
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp44;
+    TNode<JSReceiver> tmp45;
+    TNode<Number> tmp46;
+    TNode<JSReceiver> tmp47;
+    TNode<Object> tmp48;
+    TNode<Smi> tmp49;
+    TNode<Smi> tmp50;
+    TNode<JSReceiver> tmp51;
+    TNode<JSArray> tmp52;
+    ca_.Bind(&block9, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52);
+    ca_.Goto(&block7, tmp44, tmp45, tmp46, tmp47, tmp48, tmp49, tmp50, tmp52);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp53;
+    TNode<JSReceiver> tmp54;
+    TNode<Number> tmp55;
+    TNode<JSReceiver> tmp56;
+    TNode<Object> tmp57;
+    TNode<Smi> tmp58;
+    TNode<Smi> tmp59;
+    ca_.Bind(&block8, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59);
+    ca_.Goto(&block1, tmp58);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp60;
+    TNode<JSReceiver> tmp61;
+    TNode<Number> tmp62;
+    TNode<JSReceiver> tmp63;
+    TNode<Object> tmp64;
+    TNode<Smi> tmp65;
+    TNode<Smi> tmp66;
+    TNode<JSArray> tmp67;
+    ca_.Bind(&block7, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66, &tmp67);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 93);
+    TNode<JSArray> tmp68;
+    USE(tmp68);
+    TNode<JSArray> tmp69;
+    USE(tmp69);
+    TNode<Map> tmp70;
+    USE(tmp70);
+    TNode<BoolT> tmp71;
+    USE(tmp71);
+    TNode<BoolT> tmp72;
+    USE(tmp72);
+    TNode<BoolT> tmp73;
+    USE(tmp73);
+    std::tie(tmp68, tmp69, tmp70, tmp71, tmp72, tmp73) = NewFastJSArrayWitness_239(state_, TNode<JSArray>{tmp67}).Flatten();
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 96);
+    ca_.Goto(&block13, tmp60, tmp61, tmp62, tmp63, tmp64, tmp65, tmp66, tmp67, tmp68, tmp69, tmp70, tmp71, tmp72, tmp73);
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp74;
+    TNode<JSReceiver> tmp75;
+    TNode<Number> tmp76;
+    TNode<JSReceiver> tmp77;
+    TNode<Object> tmp78;
+    TNode<Smi> tmp79;
+    TNode<Smi> tmp80;
+    TNode<JSArray> tmp81;
+    TNode<JSArray> tmp82;
+    TNode<JSArray> tmp83;
+    TNode<Map> tmp84;
+    TNode<BoolT> tmp85;
+    TNode<BoolT> tmp86;
+    TNode<BoolT> tmp87;
+    ca_.Bind(&block13, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86, &tmp87);
+    TNode<BoolT> tmp88;
+    USE(tmp88);
+    tmp88 = CodeStubAssembler(state_).SmiLessThan(TNode<Smi>{tmp79}, TNode<Smi>{tmp80});
+    ca_.Branch(tmp88, &block11, &block12, tmp74, tmp75, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, tmp83, tmp84, tmp85, tmp86, tmp87);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp89;
+    TNode<JSReceiver> tmp90;
+    TNode<Number> tmp91;
+    TNode<JSReceiver> tmp92;
+    TNode<Object> tmp93;
+    TNode<Smi> tmp94;
+    TNode<Smi> tmp95;
+    TNode<JSArray> tmp96;
+    TNode<JSArray> tmp97;
+    TNode<JSArray> tmp98;
+    TNode<Map> tmp99;
+    TNode<BoolT> tmp100;
+    TNode<BoolT> tmp101;
+    TNode<BoolT> tmp102;
+    ca_.Bind(&block11, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3306);
+    TNode<IntPtrT> tmp103 = ca_.IntPtrConstant(HeapObject::kMapOffset);
+    USE(tmp103);
+    TNode<Map>tmp104 = CodeStubAssembler(state_).LoadReference<Map>(CodeStubAssembler::Reference{tmp97, tmp103});
+    TNode<BoolT> tmp105;
+    USE(tmp105);
+    tmp105 = CodeStubAssembler(state_).TaggedNotEqual(TNode<HeapObject>{tmp104}, TNode<HeapObject>{tmp99});
+    ca_.Branch(tmp105, &block18, &block19, tmp89, tmp90, tmp91, tmp92, tmp93, tmp94, tmp95, tmp96, tmp97, tmp98, tmp99, tmp100, tmp101, tmp102);
+  }
+
+  if (block18.is_used()) {
+    TNode<Context> tmp106;
+    TNode<JSReceiver> tmp107;
+    TNode<Number> tmp108;
+    TNode<JSReceiver> tmp109;
+    TNode<Object> tmp110;
+    TNode<Smi> tmp111;
+    TNode<Smi> tmp112;
+    TNode<JSArray> tmp113;
+    TNode<JSArray> tmp114;
+    TNode<JSArray> tmp115;
+    TNode<Map> tmp116;
+    TNode<BoolT> tmp117;
+    TNode<BoolT> tmp118;
+    TNode<BoolT> tmp119;
+    ca_.Bind(&block18, &tmp106, &tmp107, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115, &tmp116, &tmp117, &tmp118, &tmp119);
+    ca_.Goto(&block16, tmp106, tmp107, tmp108, tmp109, tmp110, tmp111, tmp112, tmp113, tmp114, tmp115, tmp116, tmp117, tmp118, tmp119);
+  }
+
+  if (block19.is_used()) {
+    TNode<Context> tmp120;
+    TNode<JSReceiver> tmp121;
+    TNode<Number> tmp122;
+    TNode<JSReceiver> tmp123;
+    TNode<Object> tmp124;
+    TNode<Smi> tmp125;
+    TNode<Smi> tmp126;
+    TNode<JSArray> tmp127;
+    TNode<JSArray> tmp128;
+    TNode<JSArray> tmp129;
+    TNode<Map> tmp130;
+    TNode<BoolT> tmp131;
+    TNode<BoolT> tmp132;
+    TNode<BoolT> tmp133;
+    ca_.Bind(&block19, &tmp120, &tmp121, &tmp122, &tmp123, &tmp124, &tmp125, &tmp126, &tmp127, &tmp128, &tmp129, &tmp130, &tmp131, &tmp132, &tmp133);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3313);
+    TNode<BoolT> tmp134;
+    USE(tmp134);
+    tmp134 = CodeStubAssembler(state_).IsNoElementsProtectorCellInvalid();
+    ca_.Branch(tmp134, &block20, &block21, tmp120, tmp121, tmp122, tmp123, tmp124, tmp125, tmp126, tmp127, tmp128, tmp129, tmp130, tmp131, tmp132, tmp133);
+  }
+
+  if (block20.is_used()) {
+    TNode<Context> tmp135;
+    TNode<JSReceiver> tmp136;
+    TNode<Number> tmp137;
+    TNode<JSReceiver> tmp138;
+    TNode<Object> tmp139;
+    TNode<Smi> tmp140;
+    TNode<Smi> tmp141;
+    TNode<JSArray> tmp142;
+    TNode<JSArray> tmp143;
+    TNode<JSArray> tmp144;
+    TNode<Map> tmp145;
+    TNode<BoolT> tmp146;
+    TNode<BoolT> tmp147;
+    TNode<BoolT> tmp148;
+    ca_.Bind(&block20, &tmp135, &tmp136, &tmp137, &tmp138, &tmp139, &tmp140, &tmp141, &tmp142, &tmp143, &tmp144, &tmp145, &tmp146, &tmp147, &tmp148);
+    ca_.Goto(&block16, tmp135, tmp136, tmp137, tmp138, tmp139, tmp140, tmp141, tmp142, tmp143, tmp144, tmp145, tmp146, tmp147, tmp148);
+  }
+
+  if (block21.is_used()) {
+    TNode<Context> tmp149;
+    TNode<JSReceiver> tmp150;
+    TNode<Number> tmp151;
+    TNode<JSReceiver> tmp152;
+    TNode<Object> tmp153;
+    TNode<Smi> tmp154;
+    TNode<Smi> tmp155;
+    TNode<JSArray> tmp156;
+    TNode<JSArray> tmp157;
+    TNode<JSArray> tmp158;
+    TNode<Map> tmp159;
+    TNode<BoolT> tmp160;
+    TNode<BoolT> tmp161;
+    TNode<BoolT> tmp162;
+    ca_.Bind(&block21, &tmp149, &tmp150, &tmp151, &tmp152, &tmp153, &tmp154, &tmp155, &tmp156, &tmp157, &tmp158, &tmp159, &tmp160, &tmp161, &tmp162);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3314);
+    TNode<JSArray> tmp163;
+    USE(tmp163);
+    tmp163 = (TNode<JSArray>{tmp157});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 97);
+    ca_.Goto(&block17, tmp149, tmp150, tmp151, tmp152, tmp153, tmp154, tmp155, tmp156, tmp157, tmp163, tmp159, tmp160, tmp161, tmp162);
+  }
+
+  if (block17.is_used()) {
+    TNode<Context> tmp164;
+    TNode<JSReceiver> tmp165;
+    TNode<Number> tmp166;
+    TNode<JSReceiver> tmp167;
+    TNode<Object> tmp168;
+    TNode<Smi> tmp169;
+    TNode<Smi> tmp170;
+    TNode<JSArray> tmp171;
+    TNode<JSArray> tmp172;
+    TNode<JSArray> tmp173;
+    TNode<Map> tmp174;
+    TNode<BoolT> tmp175;
+    TNode<BoolT> tmp176;
+    TNode<BoolT> tmp177;
+    ca_.Bind(&block17, &tmp164, &tmp165, &tmp166, &tmp167, &tmp168, &tmp169, &tmp170, &tmp171, &tmp172, &tmp173, &tmp174, &tmp175, &tmp176, &tmp177);
+    ca_.Goto(&block15, tmp164, tmp165, tmp166, tmp167, tmp168, tmp169, tmp170, tmp171, tmp172, tmp173, tmp174, tmp175, tmp176, tmp177);
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp178;
+    TNode<JSReceiver> tmp179;
+    TNode<Number> tmp180;
+    TNode<JSReceiver> tmp181;
+    TNode<Object> tmp182;
+    TNode<Smi> tmp183;
+    TNode<Smi> tmp184;
+    TNode<JSArray> tmp185;
+    TNode<JSArray> tmp186;
+    TNode<JSArray> tmp187;
+    TNode<Map> tmp188;
+    TNode<BoolT> tmp189;
+    TNode<BoolT> tmp190;
+    TNode<BoolT> tmp191;
+    ca_.Bind(&block16, &tmp178, &tmp179, &tmp180, &tmp181, &tmp182, &tmp183, &tmp184, &tmp185, &tmp186, &tmp187, &tmp188, &tmp189, &tmp190, &tmp191);
+    ca_.Goto(&block1, tmp183);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp192;
+    TNode<JSReceiver> tmp193;
+    TNode<Number> tmp194;
+    TNode<JSReceiver> tmp195;
+    TNode<Object> tmp196;
+    TNode<Smi> tmp197;
+    TNode<Smi> tmp198;
+    TNode<JSArray> tmp199;
+    TNode<JSArray> tmp200;
+    TNode<JSArray> tmp201;
+    TNode<Map> tmp202;
+    TNode<BoolT> tmp203;
+    TNode<BoolT> tmp204;
+    TNode<BoolT> tmp205;
+    ca_.Bind(&block15, &tmp192, &tmp193, &tmp194, &tmp195, &tmp196, &tmp197, &tmp198, &tmp199, &tmp200, &tmp201, &tmp202, &tmp203, &tmp204, &tmp205);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 100);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3302);
+    ca_.Goto(&block24, tmp192, tmp193, tmp194, tmp195, tmp196, tmp197, tmp198, tmp199, tmp200, tmp201, tmp202, tmp203, tmp204, tmp205, tmp197, tmp201);
+  }
+
+  if (block24.is_used()) {
+    TNode<Context> tmp206;
+    TNode<JSReceiver> tmp207;
+    TNode<Number> tmp208;
+    TNode<JSReceiver> tmp209;
+    TNode<Object> tmp210;
+    TNode<Smi> tmp211;
+    TNode<Smi> tmp212;
+    TNode<JSArray> tmp213;
+    TNode<JSArray> tmp214;
+    TNode<JSArray> tmp215;
+    TNode<Map> tmp216;
+    TNode<BoolT> tmp217;
+    TNode<BoolT> tmp218;
+    TNode<BoolT> tmp219;
+    TNode<Smi> tmp220;
+    TNode<JSArray> tmp221;
+    ca_.Bind(&block24, &tmp206, &tmp207, &tmp208, &tmp209, &tmp210, &tmp211, &tmp212, &tmp213, &tmp214, &tmp215, &tmp216, &tmp217, &tmp218, &tmp219, &tmp220, &tmp221);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 100);
+    TNode<Smi> tmp222;
+    USE(tmp222);
+    tmp222 = CodeStubAssembler(state_).LoadFastJSArrayLength(TNode<JSArray>{tmp221});
+    TNode<BoolT> tmp223;
+    USE(tmp223);
+    tmp223 = CodeStubAssembler(state_).SmiGreaterThanOrEqual(TNode<Smi>{tmp220}, TNode<Smi>{tmp222});
+    ca_.Branch(tmp223, &block22, &block23, tmp206, tmp207, tmp208, tmp209, tmp210, tmp211, tmp212, tmp213, tmp214, tmp215, tmp216, tmp217, tmp218, tmp219);
+  }
+
+  if (block22.is_used()) {
+    TNode<Context> tmp224;
+    TNode<JSReceiver> tmp225;
+    TNode<Number> tmp226;
+    TNode<JSReceiver> tmp227;
+    TNode<Object> tmp228;
+    TNode<Smi> tmp229;
+    TNode<Smi> tmp230;
+    TNode<JSArray> tmp231;
+    TNode<JSArray> tmp232;
+    TNode<JSArray> tmp233;
+    TNode<Map> tmp234;
+    TNode<BoolT> tmp235;
+    TNode<BoolT> tmp236;
+    TNode<BoolT> tmp237;
+    ca_.Bind(&block22, &tmp224, &tmp225, &tmp226, &tmp227, &tmp228, &tmp229, &tmp230, &tmp231, &tmp232, &tmp233, &tmp234, &tmp235, &tmp236, &tmp237);
+    ca_.Goto(&block1, tmp229);
+  }
+
+  if (block23.is_used()) {
+    TNode<Context> tmp238;
+    TNode<JSReceiver> tmp239;
+    TNode<Number> tmp240;
+    TNode<JSReceiver> tmp241;
+    TNode<Object> tmp242;
+    TNode<Smi> tmp243;
+    TNode<Smi> tmp244;
+    TNode<JSArray> tmp245;
+    TNode<JSArray> tmp246;
+    TNode<JSArray> tmp247;
+    TNode<Map> tmp248;
+    TNode<BoolT> tmp249;
+    TNode<BoolT> tmp250;
+    TNode<BoolT> tmp251;
+    ca_.Bind(&block23, &tmp238, &tmp239, &tmp240, &tmp241, &tmp242, &tmp243, &tmp244, &tmp245, &tmp246, &tmp247, &tmp248, &tmp249, &tmp250, &tmp251);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 101);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3319);
+    ca_.Branch(tmp249, &block28, &block29, tmp238, tmp239, tmp240, tmp241, tmp242, tmp243, tmp244, tmp245, tmp246, tmp247, tmp248, tmp249, tmp250, tmp251, tmp243, tmp238, tmp243);
+  }
+
+  if (block28.is_used()) {
+    TNode<Context> tmp252;
+    TNode<JSReceiver> tmp253;
+    TNode<Number> tmp254;
+    TNode<JSReceiver> tmp255;
+    TNode<Object> tmp256;
+    TNode<Smi> tmp257;
+    TNode<Smi> tmp258;
+    TNode<JSArray> tmp259;
+    TNode<JSArray> tmp260;
+    TNode<JSArray> tmp261;
+    TNode<Map> tmp262;
+    TNode<BoolT> tmp263;
+    TNode<BoolT> tmp264;
+    TNode<BoolT> tmp265;
+    TNode<Smi> tmp266;
+    TNode<Context> tmp267;
+    TNode<Smi> tmp268;
+    ca_.Bind(&block28, &tmp252, &tmp253, &tmp254, &tmp255, &tmp256, &tmp257, &tmp258, &tmp259, &tmp260, &tmp261, &tmp262, &tmp263, &tmp264, &tmp265, &tmp266, &tmp267, &tmp268);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3320);
+    TNode<Object> tmp269;
+    USE(tmp269);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp269 = LoadElementNoHole16FixedDoubleArray_238(state_, TNode<Context>{tmp267}, TNode<JSArray>{tmp261}, TNode<Smi>{tmp268}, &label0);
+    ca_.Goto(&block31, tmp252, tmp253, tmp254, tmp255, tmp256, tmp257, tmp258, tmp259, tmp260, tmp261, tmp262, tmp263, tmp264, tmp265, tmp266, tmp267, tmp268, tmp261, tmp268, tmp269);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block32, tmp252, tmp253, tmp254, tmp255, tmp256, tmp257, tmp258, tmp259, tmp260, tmp261, tmp262, tmp263, tmp264, tmp265, tmp266, tmp267, tmp268, tmp261, tmp268);
+    }
+  }
+
+  if (block32.is_used()) {
+    TNode<Context> tmp270;
+    TNode<JSReceiver> tmp271;
+    TNode<Number> tmp272;
+    TNode<JSReceiver> tmp273;
+    TNode<Object> tmp274;
+    TNode<Smi> tmp275;
+    TNode<Smi> tmp276;
+    TNode<JSArray> tmp277;
+    TNode<JSArray> tmp278;
+    TNode<JSArray> tmp279;
+    TNode<Map> tmp280;
+    TNode<BoolT> tmp281;
+    TNode<BoolT> tmp282;
+    TNode<BoolT> tmp283;
+    TNode<Smi> tmp284;
+    TNode<Context> tmp285;
+    TNode<Smi> tmp286;
+    TNode<JSArray> tmp287;
+    TNode<Smi> tmp288;
+    ca_.Bind(&block32, &tmp270, &tmp271, &tmp272, &tmp273, &tmp274, &tmp275, &tmp276, &tmp277, &tmp278, &tmp279, &tmp280, &tmp281, &tmp282, &tmp283, &tmp284, &tmp285, &tmp286, &tmp287, &tmp288);
+    ca_.Goto(&block26, tmp270, tmp271, tmp272, tmp273, tmp274, tmp275, tmp276, tmp277, tmp278, tmp279, tmp280, tmp281, tmp282, tmp283);
+  }
+
+  if (block31.is_used()) {
+    TNode<Context> tmp289;
+    TNode<JSReceiver> tmp290;
+    TNode<Number> tmp291;
+    TNode<JSReceiver> tmp292;
+    TNode<Object> tmp293;
+    TNode<Smi> tmp294;
+    TNode<Smi> tmp295;
+    TNode<JSArray> tmp296;
+    TNode<JSArray> tmp297;
+    TNode<JSArray> tmp298;
+    TNode<Map> tmp299;
+    TNode<BoolT> tmp300;
+    TNode<BoolT> tmp301;
+    TNode<BoolT> tmp302;
+    TNode<Smi> tmp303;
+    TNode<Context> tmp304;
+    TNode<Smi> tmp305;
+    TNode<JSArray> tmp306;
+    TNode<Smi> tmp307;
+    TNode<Object> tmp308;
+    ca_.Bind(&block31, &tmp289, &tmp290, &tmp291, &tmp292, &tmp293, &tmp294, &tmp295, &tmp296, &tmp297, &tmp298, &tmp299, &tmp300, &tmp301, &tmp302, &tmp303, &tmp304, &tmp305, &tmp306, &tmp307, &tmp308);
+    ca_.Goto(&block27, tmp289, tmp290, tmp291, tmp292, tmp293, tmp294, tmp295, tmp296, tmp297, tmp298, tmp299, tmp300, tmp301, tmp302, tmp303, tmp304, tmp305, tmp308);
+  }
+
+  if (block29.is_used()) {
+    TNode<Context> tmp309;
+    TNode<JSReceiver> tmp310;
+    TNode<Number> tmp311;
+    TNode<JSReceiver> tmp312;
+    TNode<Object> tmp313;
+    TNode<Smi> tmp314;
+    TNode<Smi> tmp315;
+    TNode<JSArray> tmp316;
+    TNode<JSArray> tmp317;
+    TNode<JSArray> tmp318;
+    TNode<Map> tmp319;
+    TNode<BoolT> tmp320;
+    TNode<BoolT> tmp321;
+    TNode<BoolT> tmp322;
+    TNode<Smi> tmp323;
+    TNode<Context> tmp324;
+    TNode<Smi> tmp325;
+    ca_.Bind(&block29, &tmp309, &tmp310, &tmp311, &tmp312, &tmp313, &tmp314, &tmp315, &tmp316, &tmp317, &tmp318, &tmp319, &tmp320, &tmp321, &tmp322, &tmp323, &tmp324, &tmp325);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3323);
+    TNode<Object> tmp326;
+    USE(tmp326);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp326 = LoadElementNoHole10FixedArray_237(state_, TNode<Context>{tmp324}, TNode<JSArray>{tmp318}, TNode<Smi>{tmp325}, &label0);
+    ca_.Goto(&block33, tmp309, tmp310, tmp311, tmp312, tmp313, tmp314, tmp315, tmp316, tmp317, tmp318, tmp319, tmp320, tmp321, tmp322, tmp323, tmp324, tmp325, tmp318, tmp325, tmp326);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block34, tmp309, tmp310, tmp311, tmp312, tmp313, tmp314, tmp315, tmp316, tmp317, tmp318, tmp319, tmp320, tmp321, tmp322, tmp323, tmp324, tmp325, tmp318, tmp325);
+    }
+  }
+
+  if (block34.is_used()) {
+    TNode<Context> tmp327;
+    TNode<JSReceiver> tmp328;
+    TNode<Number> tmp329;
+    TNode<JSReceiver> tmp330;
+    TNode<Object> tmp331;
+    TNode<Smi> tmp332;
+    TNode<Smi> tmp333;
+    TNode<JSArray> tmp334;
+    TNode<JSArray> tmp335;
+    TNode<JSArray> tmp336;
+    TNode<Map> tmp337;
+    TNode<BoolT> tmp338;
+    TNode<BoolT> tmp339;
+    TNode<BoolT> tmp340;
+    TNode<Smi> tmp341;
+    TNode<Context> tmp342;
+    TNode<Smi> tmp343;
+    TNode<JSArray> tmp344;
+    TNode<Smi> tmp345;
+    ca_.Bind(&block34, &tmp327, &tmp328, &tmp329, &tmp330, &tmp331, &tmp332, &tmp333, &tmp334, &tmp335, &tmp336, &tmp337, &tmp338, &tmp339, &tmp340, &tmp341, &tmp342, &tmp343, &tmp344, &tmp345);
+    ca_.Goto(&block26, tmp327, tmp328, tmp329, tmp330, tmp331, tmp332, tmp333, tmp334, tmp335, tmp336, tmp337, tmp338, tmp339, tmp340);
+  }
+
+  if (block33.is_used()) {
+    TNode<Context> tmp346;
+    TNode<JSReceiver> tmp347;
+    TNode<Number> tmp348;
+    TNode<JSReceiver> tmp349;
+    TNode<Object> tmp350;
+    TNode<Smi> tmp351;
+    TNode<Smi> tmp352;
+    TNode<JSArray> tmp353;
+    TNode<JSArray> tmp354;
+    TNode<JSArray> tmp355;
+    TNode<Map> tmp356;
+    TNode<BoolT> tmp357;
+    TNode<BoolT> tmp358;
+    TNode<BoolT> tmp359;
+    TNode<Smi> tmp360;
+    TNode<Context> tmp361;
+    TNode<Smi> tmp362;
+    TNode<JSArray> tmp363;
+    TNode<Smi> tmp364;
+    TNode<Object> tmp365;
+    ca_.Bind(&block33, &tmp346, &tmp347, &tmp348, &tmp349, &tmp350, &tmp351, &tmp352, &tmp353, &tmp354, &tmp355, &tmp356, &tmp357, &tmp358, &tmp359, &tmp360, &tmp361, &tmp362, &tmp363, &tmp364, &tmp365);
+    ca_.Goto(&block27, tmp346, tmp347, tmp348, tmp349, tmp350, tmp351, tmp352, tmp353, tmp354, tmp355, tmp356, tmp357, tmp358, tmp359, tmp360, tmp361, tmp362, tmp365);
+  }
+
+  if (block27.is_used()) {
+    TNode<Context> tmp366;
+    TNode<JSReceiver> tmp367;
+    TNode<Number> tmp368;
+    TNode<JSReceiver> tmp369;
+    TNode<Object> tmp370;
+    TNode<Smi> tmp371;
+    TNode<Smi> tmp372;
+    TNode<JSArray> tmp373;
+    TNode<JSArray> tmp374;
+    TNode<JSArray> tmp375;
+    TNode<Map> tmp376;
+    TNode<BoolT> tmp377;
+    TNode<BoolT> tmp378;
+    TNode<BoolT> tmp379;
+    TNode<Smi> tmp380;
+    TNode<Context> tmp381;
+    TNode<Smi> tmp382;
+    TNode<Object> tmp383;
+    ca_.Bind(&block27, &tmp366, &tmp367, &tmp368, &tmp369, &tmp370, &tmp371, &tmp372, &tmp373, &tmp374, &tmp375, &tmp376, &tmp377, &tmp378, &tmp379, &tmp380, &tmp381, &tmp382, &tmp383);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 101);
+    ca_.Goto(&block25, tmp366, tmp367, tmp368, tmp369, tmp370, tmp371, tmp372, tmp373, tmp374, tmp375, tmp376, tmp377, tmp378, tmp379, tmp383);
+  }
+
+  if (block26.is_used()) {
+    TNode<Context> tmp384;
+    TNode<JSReceiver> tmp385;
+    TNode<Number> tmp386;
+    TNode<JSReceiver> tmp387;
+    TNode<Object> tmp388;
+    TNode<Smi> tmp389;
+    TNode<Smi> tmp390;
+    TNode<JSArray> tmp391;
+    TNode<JSArray> tmp392;
+    TNode<JSArray> tmp393;
+    TNode<Map> tmp394;
+    TNode<BoolT> tmp395;
+    TNode<BoolT> tmp396;
+    TNode<BoolT> tmp397;
+    ca_.Bind(&block26, &tmp384, &tmp385, &tmp386, &tmp387, &tmp388, &tmp389, &tmp390, &tmp391, &tmp392, &tmp393, &tmp394, &tmp395, &tmp396, &tmp397);
+    ca_.Goto(&block14, tmp384, tmp385, tmp386, tmp387, tmp388, tmp389, tmp390, tmp391, tmp392, tmp393, tmp394, tmp395, tmp396, tmp397);
+  }
+
+  if (block25.is_used()) {
+    TNode<Context> tmp398;
+    TNode<JSReceiver> tmp399;
+    TNode<Number> tmp400;
+    TNode<JSReceiver> tmp401;
+    TNode<Object> tmp402;
+    TNode<Smi> tmp403;
+    TNode<Smi> tmp404;
+    TNode<JSArray> tmp405;
+    TNode<JSArray> tmp406;
+    TNode<JSArray> tmp407;
+    TNode<Map> tmp408;
+    TNode<BoolT> tmp409;
+    TNode<BoolT> tmp410;
+    TNode<BoolT> tmp411;
+    TNode<Object> tmp412;
+    ca_.Bind(&block25, &tmp398, &tmp399, &tmp400, &tmp401, &tmp402, &tmp403, &tmp404, &tmp405, &tmp406, &tmp407, &tmp408, &tmp409, &tmp410, &tmp411, &tmp412);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 103);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3302);
+    ca_.Goto(&block35, tmp398, tmp399, tmp400, tmp401, tmp402, tmp403, tmp404, tmp405, tmp406, tmp407, tmp408, tmp409, tmp410, tmp411, tmp412, tmp398, tmp401, tmp402, tmp412, tmp403, tmp407);
+  }
+
+  if (block35.is_used()) {
+    TNode<Context> tmp413;
+    TNode<JSReceiver> tmp414;
+    TNode<Number> tmp415;
+    TNode<JSReceiver> tmp416;
+    TNode<Object> tmp417;
+    TNode<Smi> tmp418;
+    TNode<Smi> tmp419;
+    TNode<JSArray> tmp420;
+    TNode<JSArray> tmp421;
+    TNode<JSArray> tmp422;
+    TNode<Map> tmp423;
+    TNode<BoolT> tmp424;
+    TNode<BoolT> tmp425;
+    TNode<BoolT> tmp426;
+    TNode<Object> tmp427;
+    TNode<Context> tmp428;
+    TNode<JSReceiver> tmp429;
+    TNode<Object> tmp430;
+    TNode<Object> tmp431;
+    TNode<Smi> tmp432;
+    TNode<JSArray> tmp433;
+    ca_.Bind(&block35, &tmp413, &tmp414, &tmp415, &tmp416, &tmp417, &tmp418, &tmp419, &tmp420, &tmp421, &tmp422, &tmp423, &tmp424, &tmp425, &tmp426, &tmp427, &tmp428, &tmp429, &tmp430, &tmp431, &tmp432, &tmp433);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 103);
+    TNode<Object> tmp434;
+    USE(tmp434);
+    tmp434 = CodeStubAssembler(state_).Call(TNode<Context>{tmp428}, TNode<JSReceiver>{tmp429}, TNode<Object>{tmp430}, TNode<Object>{tmp431}, TNode<Object>{tmp432}, TNode<Object>{tmp433});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 102);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 104);
+    TNode<BoolT> tmp435;
+    USE(tmp435);
+    tmp435 = ToBoolean_243(state_, TNode<Object>{tmp434});
+    TNode<BoolT> tmp436;
+    USE(tmp436);
+    tmp436 = CodeStubAssembler(state_).Word32BinaryNot(TNode<BoolT>{tmp435});
+    ca_.Branch(tmp436, &block36, &block37, tmp413, tmp414, tmp415, tmp416, tmp417, tmp418, tmp419, tmp420, tmp421, tmp422, tmp423, tmp424, tmp425, tmp426, tmp427, tmp434);
+  }
+
+  if (block36.is_used()) {
+    TNode<Context> tmp437;
+    TNode<JSReceiver> tmp438;
+    TNode<Number> tmp439;
+    TNode<JSReceiver> tmp440;
+    TNode<Object> tmp441;
+    TNode<Smi> tmp442;
+    TNode<Smi> tmp443;
+    TNode<JSArray> tmp444;
+    TNode<JSArray> tmp445;
+    TNode<JSArray> tmp446;
+    TNode<Map> tmp447;
+    TNode<BoolT> tmp448;
+    TNode<BoolT> tmp449;
+    TNode<BoolT> tmp450;
+    TNode<Object> tmp451;
+    TNode<Object> tmp452;
+    ca_.Bind(&block36, &tmp437, &tmp438, &tmp439, &tmp440, &tmp441, &tmp442, &tmp443, &tmp444, &tmp445, &tmp446, &tmp447, &tmp448, &tmp449, &tmp450, &tmp451, &tmp452);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 105);
+    TNode<Oddball> tmp453;
+    USE(tmp453);
+    tmp453 = False_66(state_);
+    ca_.Goto(&block2, tmp437, tmp438, tmp439, tmp440, tmp441, tmp453);
+  }
+
+  if (block37.is_used()) {
+    TNode<Context> tmp454;
+    TNode<JSReceiver> tmp455;
+    TNode<Number> tmp456;
+    TNode<JSReceiver> tmp457;
+    TNode<Object> tmp458;
+    TNode<Smi> tmp459;
+    TNode<Smi> tmp460;
+    TNode<JSArray> tmp461;
+    TNode<JSArray> tmp462;
+    TNode<JSArray> tmp463;
+    TNode<Map> tmp464;
+    TNode<BoolT> tmp465;
+    TNode<BoolT> tmp466;
+    TNode<BoolT> tmp467;
+    TNode<Object> tmp468;
+    TNode<Object> tmp469;
+    ca_.Bind(&block37, &tmp454, &tmp455, &tmp456, &tmp457, &tmp458, &tmp459, &tmp460, &tmp461, &tmp462, &tmp463, &tmp464, &tmp465, &tmp466, &tmp467, &tmp468, &tmp469);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 96);
+    ca_.Goto(&block14, tmp454, tmp455, tmp456, tmp457, tmp458, tmp459, tmp460, tmp461, tmp462, tmp463, tmp464, tmp465, tmp466, tmp467);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp470;
+    TNode<JSReceiver> tmp471;
+    TNode<Number> tmp472;
+    TNode<JSReceiver> tmp473;
+    TNode<Object> tmp474;
+    TNode<Smi> tmp475;
+    TNode<Smi> tmp476;
+    TNode<JSArray> tmp477;
+    TNode<JSArray> tmp478;
+    TNode<JSArray> tmp479;
+    TNode<Map> tmp480;
+    TNode<BoolT> tmp481;
+    TNode<BoolT> tmp482;
+    TNode<BoolT> tmp483;
+    ca_.Bind(&block14, &tmp470, &tmp471, &tmp472, &tmp473, &tmp474, &tmp475, &tmp476, &tmp477, &tmp478, &tmp479, &tmp480, &tmp481, &tmp482, &tmp483);
+    TNode<Smi> tmp484;
+    USE(tmp484);
+    tmp484 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 1);
+    TNode<Smi> tmp485;
+    USE(tmp485);
+    tmp485 = CodeStubAssembler(state_).SmiAdd(TNode<Smi>{tmp475}, TNode<Smi>{tmp484});
+    ca_.Goto(&block13, tmp470, tmp471, tmp472, tmp473, tmp474, tmp485, tmp476, tmp477, tmp478, tmp479, tmp480, tmp481, tmp482, tmp483);
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp486;
+    TNode<JSReceiver> tmp487;
+    TNode<Number> tmp488;
+    TNode<JSReceiver> tmp489;
+    TNode<Object> tmp490;
+    TNode<Smi> tmp491;
+    TNode<Smi> tmp492;
+    TNode<JSArray> tmp493;
+    TNode<JSArray> tmp494;
+    TNode<JSArray> tmp495;
+    TNode<Map> tmp496;
+    TNode<BoolT> tmp497;
+    TNode<BoolT> tmp498;
+    TNode<BoolT> tmp499;
+    ca_.Bind(&block12, &tmp486, &tmp487, &tmp488, &tmp489, &tmp490, &tmp491, &tmp492, &tmp493, &tmp494, &tmp495, &tmp496, &tmp497, &tmp498, &tmp499);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 108);
+    TNode<Oddball> tmp500;
+    USE(tmp500);
+    tmp500 = True_65(state_);
+    ca_.Goto(&block2, tmp486, tmp487, tmp488, tmp489, tmp490, tmp500);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp501;
+    TNode<JSReceiver> tmp502;
+    TNode<Number> tmp503;
+    TNode<JSReceiver> tmp504;
+    TNode<Object> tmp505;
+    TNode<Object> tmp506;
+    ca_.Bind(&block2, &tmp501, &tmp502, &tmp503, &tmp504, &tmp505, &tmp506);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 87);
+    ca_.Goto(&block38, tmp501, tmp502, tmp503, tmp504, tmp505, tmp506);
+  }
+
+  if (block1.is_used()) {
+    TNode<Smi> tmp507;
+    ca_.Bind(&block1, &tmp507);
+    *label_Bailout_parameter_0 = tmp507;
+    ca_.Goto(label_Bailout);
+  }
+
+    TNode<Context> tmp508;
+    TNode<JSReceiver> tmp509;
+    TNode<Number> tmp510;
+    TNode<JSReceiver> tmp511;
+    TNode<Object> tmp512;
+    TNode<Object> tmp513;
+    ca_.Bind(&block38, &tmp508, &tmp509, &tmp510, &tmp511, &tmp512, &tmp513);
+  return TNode<Object>{tmp513};
+}
+
+TF_BUILTIN(ArrayEvery, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  Node* argc = Parameter(Descriptor::kJSActualArgumentsCount);
+  TNode<IntPtrT> arguments_length(ChangeInt32ToIntPtr(argc));
+  TNode<RawPtrT> arguments_frame = UncheckedCast<RawPtrT>(LoadFramePointer());
+  TorqueStructArguments torque_arguments(GetFrameArguments(arguments_frame, arguments_length));
+  CodeStubArguments arguments(this, torque_arguments);
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = arguments.GetReceiver();
+USE(parameter1);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, Object> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, Object, JSReceiver> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, JSReceiver, Object, Smi> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, JSReceiver, Object, Object> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, Smi> block12(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object> block2(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+    ca_.Goto(&block0, torque_arguments.frame, torque_arguments.base, torque_arguments.length, parameter0, parameter1);
+
+  if (block0.is_used()) {
+    TNode<RawPtrT> tmp0;
+    TNode<RawPtrT> tmp1;
+    TNode<IntPtrT> tmp2;
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 116);
+    TNode<Object> tmp5;
+    USE(tmp5);
+    tmp5 = RequireObjectCoercible_244(state_, TNode<Context>{tmp3}, TNode<Object>{tmp4}, "Array.prototype.every");
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 119);
+    TNode<JSReceiver> tmp6;
+    USE(tmp6);
+    tmp6 = CodeStubAssembler(state_).ToObject_Inline(TNode<Context>{tmp3}, TNode<Object>{tmp4});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 122);
+    TNode<Number> tmp7;
+    USE(tmp7);
+    tmp7 = GetLengthProperty_247(state_, TNode<Context>{tmp3}, TNode<Object>{tmp6});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 125);
+    TNode<IntPtrT> tmp8;
+    USE(tmp8);
+    tmp8 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<BoolT> tmp9;
+    USE(tmp9);
+    tmp9 = CodeStubAssembler(state_).WordEqual(TNode<IntPtrT>{tmp2}, TNode<IntPtrT>{tmp8});
+    ca_.Branch(tmp9, &block3, &block4, tmp0, tmp1, tmp2, tmp3, tmp4, tmp6, tmp7);
+  }
+
+  if (block3.is_used()) {
+    TNode<RawPtrT> tmp10;
+    TNode<RawPtrT> tmp11;
+    TNode<IntPtrT> tmp12;
+    TNode<Context> tmp13;
+    TNode<Object> tmp14;
+    TNode<JSReceiver> tmp15;
+    TNode<Number> tmp16;
+    ca_.Bind(&block3, &tmp10, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 126);
+    ca_.Goto(&block2, tmp10, tmp11, tmp12, tmp13, tmp14);
+  }
+
+  if (block4.is_used()) {
+    TNode<RawPtrT> tmp17;
+    TNode<RawPtrT> tmp18;
+    TNode<IntPtrT> tmp19;
+    TNode<Context> tmp20;
+    TNode<Object> tmp21;
+    TNode<JSReceiver> tmp22;
+    TNode<Number> tmp23;
+    ca_.Bind(&block4, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 128);
+    TNode<IntPtrT> tmp24;
+    USE(tmp24);
+    tmp24 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<Object> tmp25;
+    USE(tmp25);
+    tmp25 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp17}, TNode<RawPtrT>{tmp18}, TNode<IntPtrT>{tmp19}}, TNode<IntPtrT>{tmp24});
+    TNode<JSReceiver> tmp26;
+    USE(tmp26);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp26 = Cast71UT19ATCallableApiObject17ATCallableJSProxy15JSBoundFunction10JSFunction_1366(state_, TNode<Context>{tmp20}, TNode<Object>{tmp25}, &label0);
+    ca_.Goto(&block5, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp25, tmp26);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block6, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp25);
+    }
+  }
+
+  if (block6.is_used()) {
+    TNode<RawPtrT> tmp27;
+    TNode<RawPtrT> tmp28;
+    TNode<IntPtrT> tmp29;
+    TNode<Context> tmp30;
+    TNode<Object> tmp31;
+    TNode<JSReceiver> tmp32;
+    TNode<Number> tmp33;
+    TNode<Object> tmp34;
+    ca_.Bind(&block6, &tmp27, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34);
+    ca_.Goto(&block2, tmp27, tmp28, tmp29, tmp30, tmp31);
+  }
+
+  if (block5.is_used()) {
+    TNode<RawPtrT> tmp35;
+    TNode<RawPtrT> tmp36;
+    TNode<IntPtrT> tmp37;
+    TNode<Context> tmp38;
+    TNode<Object> tmp39;
+    TNode<JSReceiver> tmp40;
+    TNode<Number> tmp41;
+    TNode<Object> tmp42;
+    TNode<JSReceiver> tmp43;
+    ca_.Bind(&block5, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 131);
+    TNode<IntPtrT> tmp44;
+    USE(tmp44);
+    tmp44 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<BoolT> tmp45;
+    USE(tmp45);
+    tmp45 = CodeStubAssembler(state_).IntPtrGreaterThan(TNode<IntPtrT>{tmp37}, TNode<IntPtrT>{tmp44});
+    ca_.Branch(tmp45, &block7, &block8, tmp35, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp43);
+  }
+
+  if (block7.is_used()) {
+    TNode<RawPtrT> tmp46;
+    TNode<RawPtrT> tmp47;
+    TNode<IntPtrT> tmp48;
+    TNode<Context> tmp49;
+    TNode<Object> tmp50;
+    TNode<JSReceiver> tmp51;
+    TNode<Number> tmp52;
+    TNode<JSReceiver> tmp53;
+    ca_.Bind(&block7, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53);
+    TNode<IntPtrT> tmp54;
+    USE(tmp54);
+    tmp54 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<Object> tmp55;
+    USE(tmp55);
+    tmp55 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp46}, TNode<RawPtrT>{tmp47}, TNode<IntPtrT>{tmp48}}, TNode<IntPtrT>{tmp54});
+    ca_.Goto(&block10, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51, tmp52, tmp53, tmp55);
+  }
+
+  if (block8.is_used()) {
+    TNode<RawPtrT> tmp56;
+    TNode<RawPtrT> tmp57;
+    TNode<IntPtrT> tmp58;
+    TNode<Context> tmp59;
+    TNode<Object> tmp60;
+    TNode<JSReceiver> tmp61;
+    TNode<Number> tmp62;
+    TNode<JSReceiver> tmp63;
+    ca_.Bind(&block8, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63);
+    TNode<Oddball> tmp64;
+    USE(tmp64);
+    tmp64 = Undefined_64(state_);
+    ca_.Goto(&block9, tmp56, tmp57, tmp58, tmp59, tmp60, tmp61, tmp62, tmp63, tmp64);
+  }
+
+  if (block10.is_used()) {
+    TNode<RawPtrT> tmp65;
+    TNode<RawPtrT> tmp66;
+    TNode<IntPtrT> tmp67;
+    TNode<Context> tmp68;
+    TNode<Object> tmp69;
+    TNode<JSReceiver> tmp70;
+    TNode<Number> tmp71;
+    TNode<JSReceiver> tmp72;
+    TNode<Object> tmp73;
+    ca_.Bind(&block10, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73);
+    ca_.Goto(&block9, tmp65, tmp66, tmp67, tmp68, tmp69, tmp70, tmp71, tmp72, tmp73);
+  }
+
+  if (block9.is_used()) {
+    TNode<RawPtrT> tmp74;
+    TNode<RawPtrT> tmp75;
+    TNode<IntPtrT> tmp76;
+    TNode<Context> tmp77;
+    TNode<Object> tmp78;
+    TNode<JSReceiver> tmp79;
+    TNode<Number> tmp80;
+    TNode<JSReceiver> tmp81;
+    TNode<Object> tmp82;
+    ca_.Bind(&block9, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 135);
+    TNode<Object> tmp83;
+    USE(tmp83);
+    compiler::TypedCodeAssemblerVariable<Smi> result_0_0(&ca_);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp83 = FastArrayEvery_2(state_, TNode<Context>{tmp77}, TNode<JSReceiver>{tmp79}, TNode<Number>{tmp80}, TNode<JSReceiver>{tmp81}, TNode<Object>{tmp82}, &label0, &result_0_0);
+    ca_.Goto(&block13, tmp74, tmp75, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, tmp79, tmp80, tmp81, tmp82, tmp83);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block14, tmp74, tmp75, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, tmp79, tmp80, tmp81, tmp82, result_0_0.value());
+    }
+  }
+
+  if (block14.is_used()) {
+    TNode<RawPtrT> tmp84;
+    TNode<RawPtrT> tmp85;
+    TNode<IntPtrT> tmp86;
+    TNode<Context> tmp87;
+    TNode<Object> tmp88;
+    TNode<JSReceiver> tmp89;
+    TNode<Number> tmp90;
+    TNode<JSReceiver> tmp91;
+    TNode<Object> tmp92;
+    TNode<JSReceiver> tmp93;
+    TNode<Number> tmp94;
+    TNode<JSReceiver> tmp95;
+    TNode<Object> tmp96;
+    TNode<Smi> tmp97;
+    ca_.Bind(&block14, &tmp84, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96, &tmp97);
+    ca_.Goto(&block12, tmp84, tmp85, tmp86, tmp87, tmp88, tmp89, tmp90, tmp91, tmp92, tmp97);
+  }
+
+  if (block13.is_used()) {
+    TNode<RawPtrT> tmp98;
+    TNode<RawPtrT> tmp99;
+    TNode<IntPtrT> tmp100;
+    TNode<Context> tmp101;
+    TNode<Object> tmp102;
+    TNode<JSReceiver> tmp103;
+    TNode<Number> tmp104;
+    TNode<JSReceiver> tmp105;
+    TNode<Object> tmp106;
+    TNode<JSReceiver> tmp107;
+    TNode<Number> tmp108;
+    TNode<JSReceiver> tmp109;
+    TNode<Object> tmp110;
+    TNode<Object> tmp111;
+    ca_.Bind(&block13, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104, &tmp105, &tmp106, &tmp107, &tmp108, &tmp109, &tmp110, &tmp111);
+    arguments.PopAndReturn(tmp111);
+  }
+
+  if (block12.is_used()) {
+    TNode<RawPtrT> tmp112;
+    TNode<RawPtrT> tmp113;
+    TNode<IntPtrT> tmp114;
+    TNode<Context> tmp115;
+    TNode<Object> tmp116;
+    TNode<JSReceiver> tmp117;
+    TNode<Number> tmp118;
+    TNode<JSReceiver> tmp119;
+    TNode<Object> tmp120;
+    TNode<Smi> tmp121;
+    ca_.Bind(&block12, &tmp112, &tmp113, &tmp114, &tmp115, &tmp116, &tmp117, &tmp118, &tmp119, &tmp120, &tmp121);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 140);
+    TNode<Oddball> tmp122;
+    USE(tmp122);
+    tmp122 = Undefined_64(state_);
+    TNode<Oddball> tmp123;
+    USE(tmp123);
+    tmp123 = Undefined_64(state_);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 139);
+    TNode<Object> tmp124;
+    tmp124 = CodeStubAssembler(state_).CallBuiltin(Builtins::kArrayEveryLoopContinuation, tmp115, tmp117, tmp119, tmp120, tmp122, tmp117, tmp121, tmp118, tmp123);
+    USE(tmp124);
+    arguments.PopAndReturn(tmp124);
+  }
+
+  if (block2.is_used()) {
+    TNode<RawPtrT> tmp125;
+    TNode<RawPtrT> tmp126;
+    TNode<IntPtrT> tmp127;
+    TNode<Context> tmp128;
+    TNode<Object> tmp129;
+    ca_.Bind(&block2, &tmp125, &tmp126, &tmp127, &tmp128, &tmp129);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 144);
+    TNode<IntPtrT> tmp130;
+    USE(tmp130);
+    tmp130 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<Object> tmp131;
+    USE(tmp131);
+    tmp131 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp125}, TNode<RawPtrT>{tmp126}, TNode<IntPtrT>{tmp127}}, TNode<IntPtrT>{tmp130});
+    CodeStubAssembler(state_).ThrowTypeError(TNode<Context>{tmp128}, MessageTemplate::kCalledNonCallable, TNode<Object>{tmp131});
+  }
+}
+
+TNode<JSReceiver> Cast10JSReceiver_1365(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o, compiler::CodeAssemblerLabel* label_CastError) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, HeapObject> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, HeapObject> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, HeapObject, JSReceiver> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 2215);
+    TNode<HeapObject> tmp2;
+    USE(tmp2);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp2 = CodeStubAssembler(state_).TaggedToHeapObject(TNode<Object>{tmp1}, &label0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp1, tmp2);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block4, tmp0, tmp1, tmp1);
+    }
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    ca_.Bind(&block4, &tmp3, &tmp4, &tmp5);
+    ca_.Goto(&block1);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp6;
+    TNode<Object> tmp7;
+    TNode<Object> tmp8;
+    TNode<HeapObject> tmp9;
+    ca_.Bind(&block3, &tmp6, &tmp7, &tmp8, &tmp9);
+    TNode<JSReceiver> tmp10;
+    USE(tmp10);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp10 = Cast10JSReceiver_143(state_, TNode<HeapObject>{tmp9}, &label0);
+    ca_.Goto(&block5, tmp6, tmp7, tmp9, tmp10);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block6, tmp6, tmp7, tmp9);
+    }
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp11;
+    TNode<Object> tmp12;
+    TNode<HeapObject> tmp13;
+    ca_.Bind(&block6, &tmp11, &tmp12, &tmp13);
+    ca_.Goto(&block1);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp14;
+    TNode<Object> tmp15;
+    TNode<HeapObject> tmp16;
+    TNode<JSReceiver> tmp17;
+    ca_.Bind(&block5, &tmp14, &tmp15, &tmp16, &tmp17);
+    ca_.Goto(&block2, tmp14, tmp15, tmp17);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp18;
+    TNode<Object> tmp19;
+    TNode<JSReceiver> tmp20;
+    ca_.Bind(&block2, &tmp18, &tmp19, &tmp20);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 17);
+    ca_.Goto(&block7, tmp18, tmp19, tmp20);
+  }
+
+  if (block1.is_used()) {
+    ca_.Bind(&block1);
+    ca_.Goto(label_CastError);
+  }
+
+    TNode<Context> tmp21;
+    TNode<Object> tmp22;
+    TNode<JSReceiver> tmp23;
+    ca_.Bind(&block7, &tmp21, &tmp22, &tmp23);
+  return TNode<JSReceiver>{tmp23};
+}
+
+TNode<JSReceiver> Cast71UT19ATCallableApiObject17ATCallableJSProxy15JSBoundFunction10JSFunction_1366(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o, compiler::CodeAssemblerLabel* label_CastError) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, HeapObject> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, HeapObject> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, HeapObject, JSReceiver> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 2215);
+    TNode<HeapObject> tmp2;
+    USE(tmp2);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp2 = CodeStubAssembler(state_).TaggedToHeapObject(TNode<Object>{tmp1}, &label0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp1, tmp2);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block4, tmp0, tmp1, tmp1);
+    }
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    ca_.Bind(&block4, &tmp3, &tmp4, &tmp5);
+    ca_.Goto(&block1);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp6;
+    TNode<Object> tmp7;
+    TNode<Object> tmp8;
+    TNode<HeapObject> tmp9;
+    ca_.Bind(&block3, &tmp6, &tmp7, &tmp8, &tmp9);
+    TNode<JSReceiver> tmp10;
+    USE(tmp10);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp10 = Cast71UT19ATCallableApiObject17ATCallableJSProxy15JSBoundFunction10JSFunction_112(state_, TNode<HeapObject>{tmp9}, &label0);
+    ca_.Goto(&block5, tmp6, tmp7, tmp9, tmp10);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block6, tmp6, tmp7, tmp9);
+    }
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp11;
+    TNode<Object> tmp12;
+    TNode<HeapObject> tmp13;
+    ca_.Bind(&block6, &tmp11, &tmp12, &tmp13);
+    ca_.Goto(&block1);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp14;
+    TNode<Object> tmp15;
+    TNode<HeapObject> tmp16;
+    TNode<JSReceiver> tmp17;
+    ca_.Bind(&block5, &tmp14, &tmp15, &tmp16, &tmp17);
+    ca_.Goto(&block2, tmp14, tmp15, tmp17);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp18;
+    TNode<Object> tmp19;
+    TNode<JSReceiver> tmp20;
+    ca_.Bind(&block2, &tmp18, &tmp19, &tmp20);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-every.tq", 18);
+    ca_.Goto(&block7, tmp18, tmp19, tmp20);
+  }
+
+  if (block1.is_used()) {
+    ca_.Bind(&block1);
+    ca_.Goto(label_CastError);
+  }
+
+    TNode<Context> tmp21;
+    TNode<Object> tmp22;
+    TNode<JSReceiver> tmp23;
+    ca_.Bind(&block7, &tmp21, &tmp22, &tmp23);
+  return TNode<JSReceiver>{tmp23};
+}
+
+}  // namespace internal
+}  // namespace v8
+
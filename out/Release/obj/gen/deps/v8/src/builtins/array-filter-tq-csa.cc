@@ -0,0 +1,4462 @@
+#include "src/builtins/builtins-array-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-utils-gen.h"
+#include "src/builtins/builtins.h"
+#include "src/codegen/code-factory.h"
+#include "src/heap/factory-inl.h"
+#include "src/objects/arguments.h"
+#include "src/objects/bigint.h"
+#include "src/objects/elements-kind.h"
+#include "src/objects/free-space.h"
+#include "src/objects/js-generator.h"
+#include "src/objects/js-promise.h"
+#include "src/objects/js-regexp-string-iterator.h"
+#include "src/objects/js-weak-refs.h"
+#include "src/objects/objects.h"
+#include "src/objects/source-text-module.h"
+#include "src/objects/stack-frame-info.h"
+#include "src/objects/synthetic-module.h"
+#include "src/objects/template-objects.h"
+#include "src/builtins/builtins-bigint-gen.h"
+#include "src/builtins/builtins-collections-gen.h"
+#include "src/builtins/builtins-data-view-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-iterator-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-string-gen.h"
+#include "src/builtins/builtins-string-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-constructor-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "torque-generated/../../deps/v8/src/builtins/arguments-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-copywithin-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-join-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-lastindexof-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-map-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-right-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reverse-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-shift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-splice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-unshift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/base-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/bigint-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/boolean-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/collections-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/data-view-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/extras-utils-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/frames-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/growable-fixed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/internal-coverage-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/math-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-fromentries-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-constructor-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-delete-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-has-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-is-extensible-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-prevent-extensions-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revocable-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revoke-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/reflect-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-exec-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-all-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-replace-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-search-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-source-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-split-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-test-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-endswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-html-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-pad-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-repeat-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-startswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-substring-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/torque-internal-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-createtypedarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduceright-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-subarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/third_party/v8/builtins/array-sort-tq-csa.h"
+#include "torque-generated/../../deps/v8/test/torque/test-torque-tq-csa.h"
+
+namespace v8 {
+namespace internal {
+
+TF_BUILTIN(ArrayFilterLoopEagerDeoptContinuation, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = UncheckedCast<Object>(Parameter(Descriptor::kReceiver));
+USE(parameter1);
+  TNode<Object> parameter2 = UncheckedCast<Object>(Parameter(Descriptor::kCallback));
+  USE(parameter2);
+  TNode<Object> parameter3 = UncheckedCast<Object>(Parameter(Descriptor::kThisArg));
+  USE(parameter3);
+  TNode<Object> parameter4 = UncheckedCast<Object>(Parameter(Descriptor::kArray));
+  USE(parameter4);
+  TNode<Object> parameter5 = UncheckedCast<Object>(Parameter(Descriptor::kInitialK));
+  USE(parameter5);
+  TNode<Object> parameter6 = UncheckedCast<Object>(Parameter(Descriptor::kLength));
+  USE(parameter6);
+  TNode<Object> parameter7 = UncheckedCast<Object>(Parameter(Descriptor::kInitialTo));
+  USE(parameter7);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, Object> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, Object, JSReceiver> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Object> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Object, JSReceiver> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Object> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Object, Number> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number, Object> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number, Object, Number> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number, Number> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number, Number, Object> block24(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number, Number, Object, Number> block23(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number, Number> block22(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number, Number, Number> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2, parameter3, parameter4, parameter5, parameter6, parameter7);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    TNode<Object> tmp2;
+    TNode<Object> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    TNode<Object> tmp6;
+    TNode<Object> tmp7;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4, &tmp5, &tmp6, &tmp7);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 18);
+    TNode<JSReceiver> tmp8;
+    USE(tmp8);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp8 = Cast10JSReceiver_1365(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1}, &label0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp1, tmp8);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block4, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp1);
+    }
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp9;
+    TNode<Object> tmp10;
+    TNode<Object> tmp11;
+    TNode<Object> tmp12;
+    TNode<Object> tmp13;
+    TNode<Object> tmp14;
+    TNode<Object> tmp15;
+    TNode<Object> tmp16;
+    TNode<Object> tmp17;
+    ca_.Bind(&block4, &tmp9, &tmp10, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16, &tmp17);
+    ca_.Goto(&block2, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15, tmp16);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp18;
+    TNode<Object> tmp19;
+    TNode<Object> tmp20;
+    TNode<Object> tmp21;
+    TNode<Object> tmp22;
+    TNode<Object> tmp23;
+    TNode<Object> tmp24;
+    TNode<Object> tmp25;
+    TNode<Object> tmp26;
+    TNode<JSReceiver> tmp27;
+    ca_.Bind(&block3, &tmp18, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27);
+    ca_.Goto(&block1, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp24, tmp25, tmp27);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp28;
+    TNode<Object> tmp29;
+    TNode<Object> tmp30;
+    TNode<Object> tmp31;
+    TNode<Object> tmp32;
+    TNode<Object> tmp33;
+    TNode<Object> tmp34;
+    TNode<Object> tmp35;
+    ca_.Bind(&block2, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34, &tmp35);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp36;
+    TNode<Object> tmp37;
+    TNode<Object> tmp38;
+    TNode<Object> tmp39;
+    TNode<Object> tmp40;
+    TNode<Object> tmp41;
+    TNode<Object> tmp42;
+    TNode<Object> tmp43;
+    TNode<JSReceiver> tmp44;
+    ca_.Bind(&block1, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 19);
+    TNode<JSReceiver> tmp45;
+    USE(tmp45);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp45 = Cast71UT19ATCallableApiObject17ATCallableJSProxy15JSBoundFunction10JSFunction_1366(state_, TNode<Context>{tmp36}, TNode<Object>{tmp38}, &label0);
+    ca_.Goto(&block7, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42, tmp43, tmp44, tmp38, tmp45);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block8, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42, tmp43, tmp44, tmp38);
+    }
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp46;
+    TNode<Object> tmp47;
+    TNode<Object> tmp48;
+    TNode<Object> tmp49;
+    TNode<Object> tmp50;
+    TNode<Object> tmp51;
+    TNode<Object> tmp52;
+    TNode<Object> tmp53;
+    TNode<JSReceiver> tmp54;
+    TNode<Object> tmp55;
+    ca_.Bind(&block8, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53, &tmp54, &tmp55);
+    ca_.Goto(&block6, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51, tmp52, tmp53, tmp54);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp56;
+    TNode<Object> tmp57;
+    TNode<Object> tmp58;
+    TNode<Object> tmp59;
+    TNode<Object> tmp60;
+    TNode<Object> tmp61;
+    TNode<Object> tmp62;
+    TNode<Object> tmp63;
+    TNode<JSReceiver> tmp64;
+    TNode<Object> tmp65;
+    TNode<JSReceiver> tmp66;
+    ca_.Bind(&block7, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66);
+    ca_.Goto(&block5, tmp56, tmp57, tmp58, tmp59, tmp60, tmp61, tmp62, tmp63, tmp64, tmp66);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp67;
+    TNode<Object> tmp68;
+    TNode<Object> tmp69;
+    TNode<Object> tmp70;
+    TNode<Object> tmp71;
+    TNode<Object> tmp72;
+    TNode<Object> tmp73;
+    TNode<Object> tmp74;
+    TNode<JSReceiver> tmp75;
+    ca_.Bind(&block6, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp76;
+    TNode<Object> tmp77;
+    TNode<Object> tmp78;
+    TNode<Object> tmp79;
+    TNode<Object> tmp80;
+    TNode<Object> tmp81;
+    TNode<Object> tmp82;
+    TNode<Object> tmp83;
+    TNode<JSReceiver> tmp84;
+    TNode<JSReceiver> tmp85;
+    ca_.Bind(&block5, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 20);
+    TNode<JSReceiver> tmp86;
+    USE(tmp86);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp86 = Cast10JSReceiver_1365(state_, TNode<Context>{tmp76}, TNode<Object>{tmp80}, &label0);
+    ca_.Goto(&block11, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, tmp83, tmp84, tmp85, tmp80, tmp86);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block12, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, tmp83, tmp84, tmp85, tmp80);
+    }
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp87;
+    TNode<Object> tmp88;
+    TNode<Object> tmp89;
+    TNode<Object> tmp90;
+    TNode<Object> tmp91;
+    TNode<Object> tmp92;
+    TNode<Object> tmp93;
+    TNode<Object> tmp94;
+    TNode<JSReceiver> tmp95;
+    TNode<JSReceiver> tmp96;
+    TNode<Object> tmp97;
+    ca_.Bind(&block12, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96, &tmp97);
+    ca_.Goto(&block10, tmp87, tmp88, tmp89, tmp90, tmp91, tmp92, tmp93, tmp94, tmp95, tmp96);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp98;
+    TNode<Object> tmp99;
+    TNode<Object> tmp100;
+    TNode<Object> tmp101;
+    TNode<Object> tmp102;
+    TNode<Object> tmp103;
+    TNode<Object> tmp104;
+    TNode<Object> tmp105;
+    TNode<JSReceiver> tmp106;
+    TNode<JSReceiver> tmp107;
+    TNode<Object> tmp108;
+    TNode<JSReceiver> tmp109;
+    ca_.Bind(&block11, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104, &tmp105, &tmp106, &tmp107, &tmp108, &tmp109);
+    ca_.Goto(&block9, tmp98, tmp99, tmp100, tmp101, tmp102, tmp103, tmp104, tmp105, tmp106, tmp107, tmp109);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp110;
+    TNode<Object> tmp111;
+    TNode<Object> tmp112;
+    TNode<Object> tmp113;
+    TNode<Object> tmp114;
+    TNode<Object> tmp115;
+    TNode<Object> tmp116;
+    TNode<Object> tmp117;
+    TNode<JSReceiver> tmp118;
+    TNode<JSReceiver> tmp119;
+    ca_.Bind(&block10, &tmp110, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115, &tmp116, &tmp117, &tmp118, &tmp119);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp120;
+    TNode<Object> tmp121;
+    TNode<Object> tmp122;
+    TNode<Object> tmp123;
+    TNode<Object> tmp124;
+    TNode<Object> tmp125;
+    TNode<Object> tmp126;
+    TNode<Object> tmp127;
+    TNode<JSReceiver> tmp128;
+    TNode<JSReceiver> tmp129;
+    TNode<JSReceiver> tmp130;
+    ca_.Bind(&block9, &tmp120, &tmp121, &tmp122, &tmp123, &tmp124, &tmp125, &tmp126, &tmp127, &tmp128, &tmp129, &tmp130);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 21);
+    TNode<Number> tmp131;
+    USE(tmp131);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp131 = Cast20UT5ATSmi10HeapNumber_85(state_, TNode<Object>{tmp125}, &label0);
+    ca_.Goto(&block15, tmp120, tmp121, tmp122, tmp123, tmp124, tmp125, tmp126, tmp127, tmp128, tmp129, tmp130, tmp125, tmp131);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block16, tmp120, tmp121, tmp122, tmp123, tmp124, tmp125, tmp126, tmp127, tmp128, tmp129, tmp130, tmp125);
+    }
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp132;
+    TNode<Object> tmp133;
+    TNode<Object> tmp134;
+    TNode<Object> tmp135;
+    TNode<Object> tmp136;
+    TNode<Object> tmp137;
+    TNode<Object> tmp138;
+    TNode<Object> tmp139;
+    TNode<JSReceiver> tmp140;
+    TNode<JSReceiver> tmp141;
+    TNode<JSReceiver> tmp142;
+    TNode<Object> tmp143;
+    ca_.Bind(&block16, &tmp132, &tmp133, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138, &tmp139, &tmp140, &tmp141, &tmp142, &tmp143);
+    ca_.Goto(&block14, tmp132, tmp133, tmp134, tmp135, tmp136, tmp137, tmp138, tmp139, tmp140, tmp141, tmp142);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp144;
+    TNode<Object> tmp145;
+    TNode<Object> tmp146;
+    TNode<Object> tmp147;
+    TNode<Object> tmp148;
+    TNode<Object> tmp149;
+    TNode<Object> tmp150;
+    TNode<Object> tmp151;
+    TNode<JSReceiver> tmp152;
+    TNode<JSReceiver> tmp153;
+    TNode<JSReceiver> tmp154;
+    TNode<Object> tmp155;
+    TNode<Number> tmp156;
+    ca_.Bind(&block15, &tmp144, &tmp145, &tmp146, &tmp147, &tmp148, &tmp149, &tmp150, &tmp151, &tmp152, &tmp153, &tmp154, &tmp155, &tmp156);
+    ca_.Goto(&block13, tmp144, tmp145, tmp146, tmp147, tmp148, tmp149, tmp150, tmp151, tmp152, tmp153, tmp154, tmp156);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp157;
+    TNode<Object> tmp158;
+    TNode<Object> tmp159;
+    TNode<Object> tmp160;
+    TNode<Object> tmp161;
+    TNode<Object> tmp162;
+    TNode<Object> tmp163;
+    TNode<Object> tmp164;
+    TNode<JSReceiver> tmp165;
+    TNode<JSReceiver> tmp166;
+    TNode<JSReceiver> tmp167;
+    ca_.Bind(&block14, &tmp157, &tmp158, &tmp159, &tmp160, &tmp161, &tmp162, &tmp163, &tmp164, &tmp165, &tmp166, &tmp167);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp168;
+    TNode<Object> tmp169;
+    TNode<Object> tmp170;
+    TNode<Object> tmp171;
+    TNode<Object> tmp172;
+    TNode<Object> tmp173;
+    TNode<Object> tmp174;
+    TNode<Object> tmp175;
+    TNode<JSReceiver> tmp176;
+    TNode<JSReceiver> tmp177;
+    TNode<JSReceiver> tmp178;
+    TNode<Number> tmp179;
+    ca_.Bind(&block13, &tmp168, &tmp169, &tmp170, &tmp171, &tmp172, &tmp173, &tmp174, &tmp175, &tmp176, &tmp177, &tmp178, &tmp179);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 22);
+    TNode<Number> tmp180;
+    USE(tmp180);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp180 = Cast20UT5ATSmi10HeapNumber_85(state_, TNode<Object>{tmp175}, &label0);
+    ca_.Goto(&block19, tmp168, tmp169, tmp170, tmp171, tmp172, tmp173, tmp174, tmp175, tmp176, tmp177, tmp178, tmp179, tmp175, tmp180);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block20, tmp168, tmp169, tmp170, tmp171, tmp172, tmp173, tmp174, tmp175, tmp176, tmp177, tmp178, tmp179, tmp175);
+    }
+  }
+
+  if (block20.is_used()) {
+    TNode<Context> tmp181;
+    TNode<Object> tmp182;
+    TNode<Object> tmp183;
+    TNode<Object> tmp184;
+    TNode<Object> tmp185;
+    TNode<Object> tmp186;
+    TNode<Object> tmp187;
+    TNode<Object> tmp188;
+    TNode<JSReceiver> tmp189;
+    TNode<JSReceiver> tmp190;
+    TNode<JSReceiver> tmp191;
+    TNode<Number> tmp192;
+    TNode<Object> tmp193;
+    ca_.Bind(&block20, &tmp181, &tmp182, &tmp183, &tmp184, &tmp185, &tmp186, &tmp187, &tmp188, &tmp189, &tmp190, &tmp191, &tmp192, &tmp193);
+    ca_.Goto(&block18, tmp181, tmp182, tmp183, tmp184, tmp185, tmp186, tmp187, tmp188, tmp189, tmp190, tmp191, tmp192);
+  }
+
+  if (block19.is_used()) {
+    TNode<Context> tmp194;
+    TNode<Object> tmp195;
+    TNode<Object> tmp196;
+    TNode<Object> tmp197;
+    TNode<Object> tmp198;
+    TNode<Object> tmp199;
+    TNode<Object> tmp200;
+    TNode<Object> tmp201;
+    TNode<JSReceiver> tmp202;
+    TNode<JSReceiver> tmp203;
+    TNode<JSReceiver> tmp204;
+    TNode<Number> tmp205;
+    TNode<Object> tmp206;
+    TNode<Number> tmp207;
+    ca_.Bind(&block19, &tmp194, &tmp195, &tmp196, &tmp197, &tmp198, &tmp199, &tmp200, &tmp201, &tmp202, &tmp203, &tmp204, &tmp205, &tmp206, &tmp207);
+    ca_.Goto(&block17, tmp194, tmp195, tmp196, tmp197, tmp198, tmp199, tmp200, tmp201, tmp202, tmp203, tmp204, tmp205, tmp207);
+  }
+
+  if (block18.is_used()) {
+    TNode<Context> tmp208;
+    TNode<Object> tmp209;
+    TNode<Object> tmp210;
+    TNode<Object> tmp211;
+    TNode<Object> tmp212;
+    TNode<Object> tmp213;
+    TNode<Object> tmp214;
+    TNode<Object> tmp215;
+    TNode<JSReceiver> tmp216;
+    TNode<JSReceiver> tmp217;
+    TNode<JSReceiver> tmp218;
+    TNode<Number> tmp219;
+    ca_.Bind(&block18, &tmp208, &tmp209, &tmp210, &tmp211, &tmp212, &tmp213, &tmp214, &tmp215, &tmp216, &tmp217, &tmp218, &tmp219);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block17.is_used()) {
+    TNode<Context> tmp220;
+    TNode<Object> tmp221;
+    TNode<Object> tmp222;
+    TNode<Object> tmp223;
+    TNode<Object> tmp224;
+    TNode<Object> tmp225;
+    TNode<Object> tmp226;
+    TNode<Object> tmp227;
+    TNode<JSReceiver> tmp228;
+    TNode<JSReceiver> tmp229;
+    TNode<JSReceiver> tmp230;
+    TNode<Number> tmp231;
+    TNode<Number> tmp232;
+    ca_.Bind(&block17, &tmp220, &tmp221, &tmp222, &tmp223, &tmp224, &tmp225, &tmp226, &tmp227, &tmp228, &tmp229, &tmp230, &tmp231, &tmp232);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 23);
+    TNode<Number> tmp233;
+    USE(tmp233);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp233 = Cast20UT5ATSmi10HeapNumber_85(state_, TNode<Object>{tmp226}, &label0);
+    ca_.Goto(&block23, tmp220, tmp221, tmp222, tmp223, tmp224, tmp225, tmp226, tmp227, tmp228, tmp229, tmp230, tmp231, tmp232, tmp226, tmp233);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block24, tmp220, tmp221, tmp222, tmp223, tmp224, tmp225, tmp226, tmp227, tmp228, tmp229, tmp230, tmp231, tmp232, tmp226);
+    }
+  }
+
+  if (block24.is_used()) {
+    TNode<Context> tmp234;
+    TNode<Object> tmp235;
+    TNode<Object> tmp236;
+    TNode<Object> tmp237;
+    TNode<Object> tmp238;
+    TNode<Object> tmp239;
+    TNode<Object> tmp240;
+    TNode<Object> tmp241;
+    TNode<JSReceiver> tmp242;
+    TNode<JSReceiver> tmp243;
+    TNode<JSReceiver> tmp244;
+    TNode<Number> tmp245;
+    TNode<Number> tmp246;
+    TNode<Object> tmp247;
+    ca_.Bind(&block24, &tmp234, &tmp235, &tmp236, &tmp237, &tmp238, &tmp239, &tmp240, &tmp241, &tmp242, &tmp243, &tmp244, &tmp245, &tmp246, &tmp247);
+    ca_.Goto(&block22, tmp234, tmp235, tmp236, tmp237, tmp238, tmp239, tmp240, tmp241, tmp242, tmp243, tmp244, tmp245, tmp246);
+  }
+
+  if (block23.is_used()) {
+    TNode<Context> tmp248;
+    TNode<Object> tmp249;
+    TNode<Object> tmp250;
+    TNode<Object> tmp251;
+    TNode<Object> tmp252;
+    TNode<Object> tmp253;
+    TNode<Object> tmp254;
+    TNode<Object> tmp255;
+    TNode<JSReceiver> tmp256;
+    TNode<JSReceiver> tmp257;
+    TNode<JSReceiver> tmp258;
+    TNode<Number> tmp259;
+    TNode<Number> tmp260;
+    TNode<Object> tmp261;
+    TNode<Number> tmp262;
+    ca_.Bind(&block23, &tmp248, &tmp249, &tmp250, &tmp251, &tmp252, &tmp253, &tmp254, &tmp255, &tmp256, &tmp257, &tmp258, &tmp259, &tmp260, &tmp261, &tmp262);
+    ca_.Goto(&block21, tmp248, tmp249, tmp250, tmp251, tmp252, tmp253, tmp254, tmp255, tmp256, tmp257, tmp258, tmp259, tmp260, tmp262);
+  }
+
+  if (block22.is_used()) {
+    TNode<Context> tmp263;
+    TNode<Object> tmp264;
+    TNode<Object> tmp265;
+    TNode<Object> tmp266;
+    TNode<Object> tmp267;
+    TNode<Object> tmp268;
+    TNode<Object> tmp269;
+    TNode<Object> tmp270;
+    TNode<JSReceiver> tmp271;
+    TNode<JSReceiver> tmp272;
+    TNode<JSReceiver> tmp273;
+    TNode<Number> tmp274;
+    TNode<Number> tmp275;
+    ca_.Bind(&block22, &tmp263, &tmp264, &tmp265, &tmp266, &tmp267, &tmp268, &tmp269, &tmp270, &tmp271, &tmp272, &tmp273, &tmp274, &tmp275);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block21.is_used()) {
+    TNode<Context> tmp276;
+    TNode<Object> tmp277;
+    TNode<Object> tmp278;
+    TNode<Object> tmp279;
+    TNode<Object> tmp280;
+    TNode<Object> tmp281;
+    TNode<Object> tmp282;
+    TNode<Object> tmp283;
+    TNode<JSReceiver> tmp284;
+    TNode<JSReceiver> tmp285;
+    TNode<JSReceiver> tmp286;
+    TNode<Number> tmp287;
+    TNode<Number> tmp288;
+    TNode<Number> tmp289;
+    ca_.Bind(&block21, &tmp276, &tmp277, &tmp278, &tmp279, &tmp280, &tmp281, &tmp282, &tmp283, &tmp284, &tmp285, &tmp286, &tmp287, &tmp288, &tmp289);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 26);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 27);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 25);
+    TNode<Object> tmp290;
+    tmp290 = CodeStubAssembler(state_).CallBuiltin(Builtins::kArrayFilterLoopContinuation, tmp276, tmp284, tmp285, tmp279, tmp286, tmp284, tmp287, tmp289, tmp288);
+    USE(tmp290);
+    CodeStubAssembler(state_).Return(tmp290);
+  }
+}
+
+TF_BUILTIN(ArrayFilterLoopLazyDeoptContinuation, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = UncheckedCast<Object>(Parameter(Descriptor::kReceiver));
+USE(parameter1);
+  TNode<Object> parameter2 = UncheckedCast<Object>(Parameter(Descriptor::kCallback));
+  USE(parameter2);
+  TNode<Object> parameter3 = UncheckedCast<Object>(Parameter(Descriptor::kThisArg));
+  USE(parameter3);
+  TNode<Object> parameter4 = UncheckedCast<Object>(Parameter(Descriptor::kArray));
+  USE(parameter4);
+  TNode<Object> parameter5 = UncheckedCast<Object>(Parameter(Descriptor::kInitialK));
+  USE(parameter5);
+  TNode<Object> parameter6 = UncheckedCast<Object>(Parameter(Descriptor::kLength));
+  USE(parameter6);
+  TNode<Object> parameter7 = UncheckedCast<Object>(Parameter(Descriptor::kValueK));
+  USE(parameter7);
+  TNode<Object> parameter8 = UncheckedCast<Object>(Parameter(Descriptor::kInitialTo));
+  USE(parameter8);
+  TNode<Object> parameter9 = UncheckedCast<Object>(Parameter(Descriptor::kResult));
+  USE(parameter9);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver, Object> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver, Object, JSReceiver> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Object> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Object, JSReceiver> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Object> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Object, Number> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number, Object> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number, Object, Number> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number, Number> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number, Number, Object> block24(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number, Number, Object, Number> block23(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number, Number> block22(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number, Number, Number> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number, Number, Number> block25(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number, Number, Number> block26(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2, parameter3, parameter4, parameter5, parameter6, parameter7, parameter8, parameter9);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    TNode<Object> tmp2;
+    TNode<Object> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    TNode<Object> tmp6;
+    TNode<Object> tmp7;
+    TNode<Object> tmp8;
+    TNode<Object> tmp9;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4, &tmp5, &tmp6, &tmp7, &tmp8, &tmp9);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 38);
+    TNode<JSReceiver> tmp10;
+    USE(tmp10);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp10 = Cast10JSReceiver_1365(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1}, &label0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp1, tmp10);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block4, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp1);
+    }
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp11;
+    TNode<Object> tmp12;
+    TNode<Object> tmp13;
+    TNode<Object> tmp14;
+    TNode<Object> tmp15;
+    TNode<Object> tmp16;
+    TNode<Object> tmp17;
+    TNode<Object> tmp18;
+    TNode<Object> tmp19;
+    TNode<Object> tmp20;
+    TNode<Object> tmp21;
+    ca_.Bind(&block4, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21);
+    ca_.Goto(&block2, tmp11, tmp12, tmp13, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19, tmp20);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp22;
+    TNode<Object> tmp23;
+    TNode<Object> tmp24;
+    TNode<Object> tmp25;
+    TNode<Object> tmp26;
+    TNode<Object> tmp27;
+    TNode<Object> tmp28;
+    TNode<Object> tmp29;
+    TNode<Object> tmp30;
+    TNode<Object> tmp31;
+    TNode<Object> tmp32;
+    TNode<JSReceiver> tmp33;
+    ca_.Bind(&block3, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33);
+    ca_.Goto(&block1, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27, tmp28, tmp29, tmp30, tmp31, tmp33);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp34;
+    TNode<Object> tmp35;
+    TNode<Object> tmp36;
+    TNode<Object> tmp37;
+    TNode<Object> tmp38;
+    TNode<Object> tmp39;
+    TNode<Object> tmp40;
+    TNode<Object> tmp41;
+    TNode<Object> tmp42;
+    TNode<Object> tmp43;
+    ca_.Bind(&block2, &tmp34, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp44;
+    TNode<Object> tmp45;
+    TNode<Object> tmp46;
+    TNode<Object> tmp47;
+    TNode<Object> tmp48;
+    TNode<Object> tmp49;
+    TNode<Object> tmp50;
+    TNode<Object> tmp51;
+    TNode<Object> tmp52;
+    TNode<Object> tmp53;
+    TNode<JSReceiver> tmp54;
+    ca_.Bind(&block1, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53, &tmp54);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 39);
+    TNode<JSReceiver> tmp55;
+    USE(tmp55);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp55 = Cast71UT19ATCallableApiObject17ATCallableJSProxy15JSBoundFunction10JSFunction_1366(state_, TNode<Context>{tmp44}, TNode<Object>{tmp46}, &label0);
+    ca_.Goto(&block7, tmp44, tmp45, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51, tmp52, tmp53, tmp54, tmp46, tmp55);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block8, tmp44, tmp45, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51, tmp52, tmp53, tmp54, tmp46);
+    }
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp56;
+    TNode<Object> tmp57;
+    TNode<Object> tmp58;
+    TNode<Object> tmp59;
+    TNode<Object> tmp60;
+    TNode<Object> tmp61;
+    TNode<Object> tmp62;
+    TNode<Object> tmp63;
+    TNode<Object> tmp64;
+    TNode<Object> tmp65;
+    TNode<JSReceiver> tmp66;
+    TNode<Object> tmp67;
+    ca_.Bind(&block8, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66, &tmp67);
+    ca_.Goto(&block6, tmp56, tmp57, tmp58, tmp59, tmp60, tmp61, tmp62, tmp63, tmp64, tmp65, tmp66);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp68;
+    TNode<Object> tmp69;
+    TNode<Object> tmp70;
+    TNode<Object> tmp71;
+    TNode<Object> tmp72;
+    TNode<Object> tmp73;
+    TNode<Object> tmp74;
+    TNode<Object> tmp75;
+    TNode<Object> tmp76;
+    TNode<Object> tmp77;
+    TNode<JSReceiver> tmp78;
+    TNode<Object> tmp79;
+    TNode<JSReceiver> tmp80;
+    ca_.Bind(&block7, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80);
+    ca_.Goto(&block5, tmp68, tmp69, tmp70, tmp71, tmp72, tmp73, tmp74, tmp75, tmp76, tmp77, tmp78, tmp80);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp81;
+    TNode<Object> tmp82;
+    TNode<Object> tmp83;
+    TNode<Object> tmp84;
+    TNode<Object> tmp85;
+    TNode<Object> tmp86;
+    TNode<Object> tmp87;
+    TNode<Object> tmp88;
+    TNode<Object> tmp89;
+    TNode<Object> tmp90;
+    TNode<JSReceiver> tmp91;
+    ca_.Bind(&block6, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp92;
+    TNode<Object> tmp93;
+    TNode<Object> tmp94;
+    TNode<Object> tmp95;
+    TNode<Object> tmp96;
+    TNode<Object> tmp97;
+    TNode<Object> tmp98;
+    TNode<Object> tmp99;
+    TNode<Object> tmp100;
+    TNode<Object> tmp101;
+    TNode<JSReceiver> tmp102;
+    TNode<JSReceiver> tmp103;
+    ca_.Bind(&block5, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 40);
+    TNode<JSReceiver> tmp104;
+    USE(tmp104);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp104 = Cast10JSReceiver_1365(state_, TNode<Context>{tmp92}, TNode<Object>{tmp96}, &label0);
+    ca_.Goto(&block11, tmp92, tmp93, tmp94, tmp95, tmp96, tmp97, tmp98, tmp99, tmp100, tmp101, tmp102, tmp103, tmp96, tmp104);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block12, tmp92, tmp93, tmp94, tmp95, tmp96, tmp97, tmp98, tmp99, tmp100, tmp101, tmp102, tmp103, tmp96);
+    }
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp105;
+    TNode<Object> tmp106;
+    TNode<Object> tmp107;
+    TNode<Object> tmp108;
+    TNode<Object> tmp109;
+    TNode<Object> tmp110;
+    TNode<Object> tmp111;
+    TNode<Object> tmp112;
+    TNode<Object> tmp113;
+    TNode<Object> tmp114;
+    TNode<JSReceiver> tmp115;
+    TNode<JSReceiver> tmp116;
+    TNode<Object> tmp117;
+    ca_.Bind(&block12, &tmp105, &tmp106, &tmp107, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115, &tmp116, &tmp117);
+    ca_.Goto(&block10, tmp105, tmp106, tmp107, tmp108, tmp109, tmp110, tmp111, tmp112, tmp113, tmp114, tmp115, tmp116);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp118;
+    TNode<Object> tmp119;
+    TNode<Object> tmp120;
+    TNode<Object> tmp121;
+    TNode<Object> tmp122;
+    TNode<Object> tmp123;
+    TNode<Object> tmp124;
+    TNode<Object> tmp125;
+    TNode<Object> tmp126;
+    TNode<Object> tmp127;
+    TNode<JSReceiver> tmp128;
+    TNode<JSReceiver> tmp129;
+    TNode<Object> tmp130;
+    TNode<JSReceiver> tmp131;
+    ca_.Bind(&block11, &tmp118, &tmp119, &tmp120, &tmp121, &tmp122, &tmp123, &tmp124, &tmp125, &tmp126, &tmp127, &tmp128, &tmp129, &tmp130, &tmp131);
+    ca_.Goto(&block9, tmp118, tmp119, tmp120, tmp121, tmp122, tmp123, tmp124, tmp125, tmp126, tmp127, tmp128, tmp129, tmp131);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp132;
+    TNode<Object> tmp133;
+    TNode<Object> tmp134;
+    TNode<Object> tmp135;
+    TNode<Object> tmp136;
+    TNode<Object> tmp137;
+    TNode<Object> tmp138;
+    TNode<Object> tmp139;
+    TNode<Object> tmp140;
+    TNode<Object> tmp141;
+    TNode<JSReceiver> tmp142;
+    TNode<JSReceiver> tmp143;
+    ca_.Bind(&block10, &tmp132, &tmp133, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138, &tmp139, &tmp140, &tmp141, &tmp142, &tmp143);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp144;
+    TNode<Object> tmp145;
+    TNode<Object> tmp146;
+    TNode<Object> tmp147;
+    TNode<Object> tmp148;
+    TNode<Object> tmp149;
+    TNode<Object> tmp150;
+    TNode<Object> tmp151;
+    TNode<Object> tmp152;
+    TNode<Object> tmp153;
+    TNode<JSReceiver> tmp154;
+    TNode<JSReceiver> tmp155;
+    TNode<JSReceiver> tmp156;
+    ca_.Bind(&block9, &tmp144, &tmp145, &tmp146, &tmp147, &tmp148, &tmp149, &tmp150, &tmp151, &tmp152, &tmp153, &tmp154, &tmp155, &tmp156);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 41);
+    TNode<Number> tmp157;
+    USE(tmp157);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp157 = Cast20UT5ATSmi10HeapNumber_85(state_, TNode<Object>{tmp149}, &label0);
+    ca_.Goto(&block15, tmp144, tmp145, tmp146, tmp147, tmp148, tmp149, tmp150, tmp151, tmp152, tmp153, tmp154, tmp155, tmp156, tmp149, tmp157);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block16, tmp144, tmp145, tmp146, tmp147, tmp148, tmp149, tmp150, tmp151, tmp152, tmp153, tmp154, tmp155, tmp156, tmp149);
+    }
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp158;
+    TNode<Object> tmp159;
+    TNode<Object> tmp160;
+    TNode<Object> tmp161;
+    TNode<Object> tmp162;
+    TNode<Object> tmp163;
+    TNode<Object> tmp164;
+    TNode<Object> tmp165;
+    TNode<Object> tmp166;
+    TNode<Object> tmp167;
+    TNode<JSReceiver> tmp168;
+    TNode<JSReceiver> tmp169;
+    TNode<JSReceiver> tmp170;
+    TNode<Object> tmp171;
+    ca_.Bind(&block16, &tmp158, &tmp159, &tmp160, &tmp161, &tmp162, &tmp163, &tmp164, &tmp165, &tmp166, &tmp167, &tmp168, &tmp169, &tmp170, &tmp171);
+    ca_.Goto(&block14, tmp158, tmp159, tmp160, tmp161, tmp162, tmp163, tmp164, tmp165, tmp166, tmp167, tmp168, tmp169, tmp170);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp172;
+    TNode<Object> tmp173;
+    TNode<Object> tmp174;
+    TNode<Object> tmp175;
+    TNode<Object> tmp176;
+    TNode<Object> tmp177;
+    TNode<Object> tmp178;
+    TNode<Object> tmp179;
+    TNode<Object> tmp180;
+    TNode<Object> tmp181;
+    TNode<JSReceiver> tmp182;
+    TNode<JSReceiver> tmp183;
+    TNode<JSReceiver> tmp184;
+    TNode<Object> tmp185;
+    TNode<Number> tmp186;
+    ca_.Bind(&block15, &tmp172, &tmp173, &tmp174, &tmp175, &tmp176, &tmp177, &tmp178, &tmp179, &tmp180, &tmp181, &tmp182, &tmp183, &tmp184, &tmp185, &tmp186);
+    ca_.Goto(&block13, tmp172, tmp173, tmp174, tmp175, tmp176, tmp177, tmp178, tmp179, tmp180, tmp181, tmp182, tmp183, tmp184, tmp186);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp187;
+    TNode<Object> tmp188;
+    TNode<Object> tmp189;
+    TNode<Object> tmp190;
+    TNode<Object> tmp191;
+    TNode<Object> tmp192;
+    TNode<Object> tmp193;
+    TNode<Object> tmp194;
+    TNode<Object> tmp195;
+    TNode<Object> tmp196;
+    TNode<JSReceiver> tmp197;
+    TNode<JSReceiver> tmp198;
+    TNode<JSReceiver> tmp199;
+    ca_.Bind(&block14, &tmp187, &tmp188, &tmp189, &tmp190, &tmp191, &tmp192, &tmp193, &tmp194, &tmp195, &tmp196, &tmp197, &tmp198, &tmp199);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp200;
+    TNode<Object> tmp201;
+    TNode<Object> tmp202;
+    TNode<Object> tmp203;
+    TNode<Object> tmp204;
+    TNode<Object> tmp205;
+    TNode<Object> tmp206;
+    TNode<Object> tmp207;
+    TNode<Object> tmp208;
+    TNode<Object> tmp209;
+    TNode<JSReceiver> tmp210;
+    TNode<JSReceiver> tmp211;
+    TNode<JSReceiver> tmp212;
+    TNode<Number> tmp213;
+    ca_.Bind(&block13, &tmp200, &tmp201, &tmp202, &tmp203, &tmp204, &tmp205, &tmp206, &tmp207, &tmp208, &tmp209, &tmp210, &tmp211, &tmp212, &tmp213);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 42);
+    TNode<Number> tmp214;
+    USE(tmp214);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp214 = Cast20UT5ATSmi10HeapNumber_85(state_, TNode<Object>{tmp208}, &label0);
+    ca_.Goto(&block19, tmp200, tmp201, tmp202, tmp203, tmp204, tmp205, tmp206, tmp207, tmp208, tmp209, tmp210, tmp211, tmp212, tmp213, tmp208, tmp214);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block20, tmp200, tmp201, tmp202, tmp203, tmp204, tmp205, tmp206, tmp207, tmp208, tmp209, tmp210, tmp211, tmp212, tmp213, tmp208);
+    }
+  }
+
+  if (block20.is_used()) {
+    TNode<Context> tmp215;
+    TNode<Object> tmp216;
+    TNode<Object> tmp217;
+    TNode<Object> tmp218;
+    TNode<Object> tmp219;
+    TNode<Object> tmp220;
+    TNode<Object> tmp221;
+    TNode<Object> tmp222;
+    TNode<Object> tmp223;
+    TNode<Object> tmp224;
+    TNode<JSReceiver> tmp225;
+    TNode<JSReceiver> tmp226;
+    TNode<JSReceiver> tmp227;
+    TNode<Number> tmp228;
+    TNode<Object> tmp229;
+    ca_.Bind(&block20, &tmp215, &tmp216, &tmp217, &tmp218, &tmp219, &tmp220, &tmp221, &tmp222, &tmp223, &tmp224, &tmp225, &tmp226, &tmp227, &tmp228, &tmp229);
+    ca_.Goto(&block18, tmp215, tmp216, tmp217, tmp218, tmp219, tmp220, tmp221, tmp222, tmp223, tmp224, tmp225, tmp226, tmp227, tmp228);
+  }
+
+  if (block19.is_used()) {
+    TNode<Context> tmp230;
+    TNode<Object> tmp231;
+    TNode<Object> tmp232;
+    TNode<Object> tmp233;
+    TNode<Object> tmp234;
+    TNode<Object> tmp235;
+    TNode<Object> tmp236;
+    TNode<Object> tmp237;
+    TNode<Object> tmp238;
+    TNode<Object> tmp239;
+    TNode<JSReceiver> tmp240;
+    TNode<JSReceiver> tmp241;
+    TNode<JSReceiver> tmp242;
+    TNode<Number> tmp243;
+    TNode<Object> tmp244;
+    TNode<Number> tmp245;
+    ca_.Bind(&block19, &tmp230, &tmp231, &tmp232, &tmp233, &tmp234, &tmp235, &tmp236, &tmp237, &tmp238, &tmp239, &tmp240, &tmp241, &tmp242, &tmp243, &tmp244, &tmp245);
+    ca_.Goto(&block17, tmp230, tmp231, tmp232, tmp233, tmp234, tmp235, tmp236, tmp237, tmp238, tmp239, tmp240, tmp241, tmp242, tmp243, tmp245);
+  }
+
+  if (block18.is_used()) {
+    TNode<Context> tmp246;
+    TNode<Object> tmp247;
+    TNode<Object> tmp248;
+    TNode<Object> tmp249;
+    TNode<Object> tmp250;
+    TNode<Object> tmp251;
+    TNode<Object> tmp252;
+    TNode<Object> tmp253;
+    TNode<Object> tmp254;
+    TNode<Object> tmp255;
+    TNode<JSReceiver> tmp256;
+    TNode<JSReceiver> tmp257;
+    TNode<JSReceiver> tmp258;
+    TNode<Number> tmp259;
+    ca_.Bind(&block18, &tmp246, &tmp247, &tmp248, &tmp249, &tmp250, &tmp251, &tmp252, &tmp253, &tmp254, &tmp255, &tmp256, &tmp257, &tmp258, &tmp259);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block17.is_used()) {
+    TNode<Context> tmp260;
+    TNode<Object> tmp261;
+    TNode<Object> tmp262;
+    TNode<Object> tmp263;
+    TNode<Object> tmp264;
+    TNode<Object> tmp265;
+    TNode<Object> tmp266;
+    TNode<Object> tmp267;
+    TNode<Object> tmp268;
+    TNode<Object> tmp269;
+    TNode<JSReceiver> tmp270;
+    TNode<JSReceiver> tmp271;
+    TNode<JSReceiver> tmp272;
+    TNode<Number> tmp273;
+    TNode<Number> tmp274;
+    ca_.Bind(&block17, &tmp260, &tmp261, &tmp262, &tmp263, &tmp264, &tmp265, &tmp266, &tmp267, &tmp268, &tmp269, &tmp270, &tmp271, &tmp272, &tmp273, &tmp274);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 43);
+    TNode<Number> tmp275;
+    USE(tmp275);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp275 = Cast20UT5ATSmi10HeapNumber_85(state_, TNode<Object>{tmp266}, &label0);
+    ca_.Goto(&block23, tmp260, tmp261, tmp262, tmp263, tmp264, tmp265, tmp266, tmp267, tmp268, tmp269, tmp270, tmp271, tmp272, tmp273, tmp274, tmp266, tmp275);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block24, tmp260, tmp261, tmp262, tmp263, tmp264, tmp265, tmp266, tmp267, tmp268, tmp269, tmp270, tmp271, tmp272, tmp273, tmp274, tmp266);
+    }
+  }
+
+  if (block24.is_used()) {
+    TNode<Context> tmp276;
+    TNode<Object> tmp277;
+    TNode<Object> tmp278;
+    TNode<Object> tmp279;
+    TNode<Object> tmp280;
+    TNode<Object> tmp281;
+    TNode<Object> tmp282;
+    TNode<Object> tmp283;
+    TNode<Object> tmp284;
+    TNode<Object> tmp285;
+    TNode<JSReceiver> tmp286;
+    TNode<JSReceiver> tmp287;
+    TNode<JSReceiver> tmp288;
+    TNode<Number> tmp289;
+    TNode<Number> tmp290;
+    TNode<Object> tmp291;
+    ca_.Bind(&block24, &tmp276, &tmp277, &tmp278, &tmp279, &tmp280, &tmp281, &tmp282, &tmp283, &tmp284, &tmp285, &tmp286, &tmp287, &tmp288, &tmp289, &tmp290, &tmp291);
+    ca_.Goto(&block22, tmp276, tmp277, tmp278, tmp279, tmp280, tmp281, tmp282, tmp283, tmp284, tmp285, tmp286, tmp287, tmp288, tmp289, tmp290);
+  }
+
+  if (block23.is_used()) {
+    TNode<Context> tmp292;
+    TNode<Object> tmp293;
+    TNode<Object> tmp294;
+    TNode<Object> tmp295;
+    TNode<Object> tmp296;
+    TNode<Object> tmp297;
+    TNode<Object> tmp298;
+    TNode<Object> tmp299;
+    TNode<Object> tmp300;
+    TNode<Object> tmp301;
+    TNode<JSReceiver> tmp302;
+    TNode<JSReceiver> tmp303;
+    TNode<JSReceiver> tmp304;
+    TNode<Number> tmp305;
+    TNode<Number> tmp306;
+    TNode<Object> tmp307;
+    TNode<Number> tmp308;
+    ca_.Bind(&block23, &tmp292, &tmp293, &tmp294, &tmp295, &tmp296, &tmp297, &tmp298, &tmp299, &tmp300, &tmp301, &tmp302, &tmp303, &tmp304, &tmp305, &tmp306, &tmp307, &tmp308);
+    ca_.Goto(&block21, tmp292, tmp293, tmp294, tmp295, tmp296, tmp297, tmp298, tmp299, tmp300, tmp301, tmp302, tmp303, tmp304, tmp305, tmp306, tmp308);
+  }
+
+  if (block22.is_used()) {
+    TNode<Context> tmp309;
+    TNode<Object> tmp310;
+    TNode<Object> tmp311;
+    TNode<Object> tmp312;
+    TNode<Object> tmp313;
+    TNode<Object> tmp314;
+    TNode<Object> tmp315;
+    TNode<Object> tmp316;
+    TNode<Object> tmp317;
+    TNode<Object> tmp318;
+    TNode<JSReceiver> tmp319;
+    TNode<JSReceiver> tmp320;
+    TNode<JSReceiver> tmp321;
+    TNode<Number> tmp322;
+    TNode<Number> tmp323;
+    ca_.Bind(&block22, &tmp309, &tmp310, &tmp311, &tmp312, &tmp313, &tmp314, &tmp315, &tmp316, &tmp317, &tmp318, &tmp319, &tmp320, &tmp321, &tmp322, &tmp323);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block21.is_used()) {
+    TNode<Context> tmp324;
+    TNode<Object> tmp325;
+    TNode<Object> tmp326;
+    TNode<Object> tmp327;
+    TNode<Object> tmp328;
+    TNode<Object> tmp329;
+    TNode<Object> tmp330;
+    TNode<Object> tmp331;
+    TNode<Object> tmp332;
+    TNode<Object> tmp333;
+    TNode<JSReceiver> tmp334;
+    TNode<JSReceiver> tmp335;
+    TNode<JSReceiver> tmp336;
+    TNode<Number> tmp337;
+    TNode<Number> tmp338;
+    TNode<Number> tmp339;
+    ca_.Bind(&block21, &tmp324, &tmp325, &tmp326, &tmp327, &tmp328, &tmp329, &tmp330, &tmp331, &tmp332, &tmp333, &tmp334, &tmp335, &tmp336, &tmp337, &tmp338, &tmp339);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 49);
+    TNode<BoolT> tmp340;
+    USE(tmp340);
+    tmp340 = ToBoolean_243(state_, TNode<Object>{tmp333});
+    ca_.Branch(tmp340, &block25, &block26, tmp324, tmp325, tmp326, tmp327, tmp328, tmp329, tmp330, tmp331, tmp332, tmp333, tmp334, tmp335, tmp336, tmp337, tmp338, tmp339);
+  }
+
+  if (block25.is_used()) {
+    TNode<Context> tmp341;
+    TNode<Object> tmp342;
+    TNode<Object> tmp343;
+    TNode<Object> tmp344;
+    TNode<Object> tmp345;
+    TNode<Object> tmp346;
+    TNode<Object> tmp347;
+    TNode<Object> tmp348;
+    TNode<Object> tmp349;
+    TNode<Object> tmp350;
+    TNode<JSReceiver> tmp351;
+    TNode<JSReceiver> tmp352;
+    TNode<JSReceiver> tmp353;
+    TNode<Number> tmp354;
+    TNode<Number> tmp355;
+    TNode<Number> tmp356;
+    ca_.Bind(&block25, &tmp341, &tmp342, &tmp343, &tmp344, &tmp345, &tmp346, &tmp347, &tmp348, &tmp349, &tmp350, &tmp351, &tmp352, &tmp353, &tmp354, &tmp355, &tmp356);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 50);
+    TNode<Object> tmp357;
+    tmp357 = CodeStubAssembler(state_).CallBuiltin(Builtins::kFastCreateDataProperty, tmp341, tmp353, tmp355, tmp348);
+    USE(tmp357);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 51);
+    TNode<Number> tmp358;
+    USE(tmp358);
+    tmp358 = FromConstexpr20UT5ATSmi10HeapNumber17ATconstexpr_int31_161(state_, 1);
+    TNode<Number> tmp359;
+    USE(tmp359);
+    tmp359 = CodeStubAssembler(state_).NumberAdd(TNode<Number>{tmp355}, TNode<Number>{tmp358});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 49);
+    ca_.Goto(&block26, tmp341, tmp342, tmp343, tmp344, tmp345, tmp346, tmp347, tmp348, tmp349, tmp350, tmp351, tmp352, tmp353, tmp354, tmp359, tmp356);
+  }
+
+  if (block26.is_used()) {
+    TNode<Context> tmp360;
+    TNode<Object> tmp361;
+    TNode<Object> tmp362;
+    TNode<Object> tmp363;
+    TNode<Object> tmp364;
+    TNode<Object> tmp365;
+    TNode<Object> tmp366;
+    TNode<Object> tmp367;
+    TNode<Object> tmp368;
+    TNode<Object> tmp369;
+    TNode<JSReceiver> tmp370;
+    TNode<JSReceiver> tmp371;
+    TNode<JSReceiver> tmp372;
+    TNode<Number> tmp373;
+    TNode<Number> tmp374;
+    TNode<Number> tmp375;
+    ca_.Bind(&block26, &tmp360, &tmp361, &tmp362, &tmp363, &tmp364, &tmp365, &tmp366, &tmp367, &tmp368, &tmp369, &tmp370, &tmp371, &tmp372, &tmp373, &tmp374, &tmp375);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 54);
+    TNode<Number> tmp376;
+    USE(tmp376);
+    tmp376 = FromConstexpr20UT5ATSmi10HeapNumber17ATconstexpr_int31_161(state_, 1);
+    TNode<Number> tmp377;
+    USE(tmp377);
+    tmp377 = CodeStubAssembler(state_).NumberAdd(TNode<Number>{tmp373}, TNode<Number>{tmp376});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 57);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 58);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 56);
+    TNode<Object> tmp378;
+    tmp378 = CodeStubAssembler(state_).CallBuiltin(Builtins::kArrayFilterLoopContinuation, tmp360, tmp370, tmp371, tmp363, tmp372, tmp370, tmp377, tmp375, tmp374);
+    USE(tmp378);
+    CodeStubAssembler(state_).Return(tmp378);
+  }
+}
+
+TF_BUILTIN(ArrayFilterLoopContinuation, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<JSReceiver> parameter1 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<0>()));
+  USE(parameter1);
+  TNode<JSReceiver> parameter2 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<1>()));
+  USE(parameter2);
+  TNode<Object> parameter3 = UncheckedCast<Object>(Parameter(Descriptor::ParameterIndex<2>()));
+  USE(parameter3);
+  TNode<JSReceiver> parameter4 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<3>()));
+  USE(parameter4);
+  TNode<JSReceiver> parameter5 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<4>()));
+  USE(parameter5);
+  TNode<Number> parameter6 = UncheckedCast<Number>(Parameter(Descriptor::ParameterIndex<5>()));
+  USE(parameter6);
+  TNode<Number> parameter7 = UncheckedCast<Number>(Parameter(Descriptor::ParameterIndex<6>()));
+  USE(parameter7);
+  TNode<Number> parameter8 = UncheckedCast<Number>(Parameter(Descriptor::ParameterIndex<7>()));
+  USE(parameter8);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, JSReceiver, Number, Number, Number> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, JSReceiver, Number, Number, Number, Number, Number> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, JSReceiver, Number, Number, Number, Number, Number> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, JSReceiver, Number, Number, Number, Number, Number, Oddball> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, JSReceiver, Number, Number, Number, Number, Number, Oddball, Object, Object> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, JSReceiver, Number, Number, Number, Number, Number, Oddball, Object, Object> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, JSReceiver, Number, Number, Number, Number, Number, Oddball> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, JSReceiver, Number, Number, Number, Number, Number> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, JSReceiver, Number, Number, Number, Number, Number> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2, parameter3, parameter4, parameter5, parameter6, parameter7, parameter8);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<JSReceiver> tmp2;
+    TNode<Object> tmp3;
+    TNode<JSReceiver> tmp4;
+    TNode<JSReceiver> tmp5;
+    TNode<Number> tmp6;
+    TNode<Number> tmp7;
+    TNode<Number> tmp8;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4, &tmp5, &tmp6, &tmp7, &tmp8);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 65);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 68);
+    ca_.Goto(&block3, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp8, tmp6);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp9;
+    TNode<JSReceiver> tmp10;
+    TNode<JSReceiver> tmp11;
+    TNode<Object> tmp12;
+    TNode<JSReceiver> tmp13;
+    TNode<JSReceiver> tmp14;
+    TNode<Number> tmp15;
+    TNode<Number> tmp16;
+    TNode<Number> tmp17;
+    TNode<Number> tmp18;
+    TNode<Number> tmp19;
+    ca_.Bind(&block3, &tmp9, &tmp10, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18, &tmp19);
+    TNode<BoolT> tmp20;
+    USE(tmp20);
+    tmp20 = NumberIsLessThan_75(state_, TNode<Number>{tmp19}, TNode<Number>{tmp16});
+    ca_.Branch(tmp20, &block1, &block2, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp21;
+    TNode<JSReceiver> tmp22;
+    TNode<JSReceiver> tmp23;
+    TNode<Object> tmp24;
+    TNode<JSReceiver> tmp25;
+    TNode<JSReceiver> tmp26;
+    TNode<Number> tmp27;
+    TNode<Number> tmp28;
+    TNode<Number> tmp29;
+    TNode<Number> tmp30;
+    TNode<Number> tmp31;
+    ca_.Bind(&block1, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27, &tmp28, &tmp29, &tmp30, &tmp31);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 74);
+    TNode<Oddball> tmp32;
+    USE(tmp32);
+    tmp32 = CodeStubAssembler(state_).HasProperty_Inline(TNode<Context>{tmp21}, TNode<JSReceiver>{tmp26}, TNode<Object>{tmp31});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 77);
+    TNode<Oddball> tmp33;
+    USE(tmp33);
+    tmp33 = True_65(state_);
+    TNode<BoolT> tmp34;
+    USE(tmp34);
+    tmp34 = CodeStubAssembler(state_).TaggedEqual(TNode<HeapObject>{tmp32}, TNode<HeapObject>{tmp33});
+    ca_.Branch(tmp34, &block5, &block6, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27, tmp28, tmp29, tmp30, tmp31, tmp32);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp35;
+    TNode<JSReceiver> tmp36;
+    TNode<JSReceiver> tmp37;
+    TNode<Object> tmp38;
+    TNode<JSReceiver> tmp39;
+    TNode<JSReceiver> tmp40;
+    TNode<Number> tmp41;
+    TNode<Number> tmp42;
+    TNode<Number> tmp43;
+    TNode<Number> tmp44;
+    TNode<Number> tmp45;
+    TNode<Oddball> tmp46;
+    ca_.Bind(&block5, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44, &tmp45, &tmp46);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 79);
+    TNode<Object> tmp47;
+    USE(tmp47);
+    tmp47 = CodeStubAssembler(state_).GetProperty(TNode<Context>{tmp35}, TNode<Object>{tmp40}, TNode<Object>{tmp45});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 82);
+    TNode<Object> tmp48;
+    USE(tmp48);
+    tmp48 = CodeStubAssembler(state_).Call(TNode<Context>{tmp35}, TNode<JSReceiver>{tmp37}, TNode<Object>{tmp38}, TNode<Object>{tmp47}, TNode<Object>{tmp45}, TNode<Object>{tmp40});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 85);
+    TNode<BoolT> tmp49;
+    USE(tmp49);
+    tmp49 = ToBoolean_243(state_, TNode<Object>{tmp48});
+    ca_.Branch(tmp49, &block7, &block8, tmp35, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42, tmp43, tmp44, tmp45, tmp46, tmp47, tmp48);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp50;
+    TNode<JSReceiver> tmp51;
+    TNode<JSReceiver> tmp52;
+    TNode<Object> tmp53;
+    TNode<JSReceiver> tmp54;
+    TNode<JSReceiver> tmp55;
+    TNode<Number> tmp56;
+    TNode<Number> tmp57;
+    TNode<Number> tmp58;
+    TNode<Number> tmp59;
+    TNode<Number> tmp60;
+    TNode<Oddball> tmp61;
+    TNode<Object> tmp62;
+    TNode<Object> tmp63;
+    ca_.Bind(&block7, &tmp50, &tmp51, &tmp52, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 87);
+    TNode<Object> tmp64;
+    tmp64 = CodeStubAssembler(state_).CallBuiltin(Builtins::kFastCreateDataProperty, tmp50, tmp54, tmp59, tmp62);
+    USE(tmp64);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 89);
+    TNode<Number> tmp65;
+    USE(tmp65);
+    tmp65 = FromConstexpr20UT5ATSmi10HeapNumber17ATconstexpr_int31_161(state_, 1);
+    TNode<Number> tmp66;
+    USE(tmp66);
+    tmp66 = CodeStubAssembler(state_).NumberAdd(TNode<Number>{tmp59}, TNode<Number>{tmp65});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 85);
+    ca_.Goto(&block8, tmp50, tmp51, tmp52, tmp53, tmp54, tmp55, tmp56, tmp57, tmp58, tmp66, tmp60, tmp61, tmp62, tmp63);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp67;
+    TNode<JSReceiver> tmp68;
+    TNode<JSReceiver> tmp69;
+    TNode<Object> tmp70;
+    TNode<JSReceiver> tmp71;
+    TNode<JSReceiver> tmp72;
+    TNode<Number> tmp73;
+    TNode<Number> tmp74;
+    TNode<Number> tmp75;
+    TNode<Number> tmp76;
+    TNode<Number> tmp77;
+    TNode<Oddball> tmp78;
+    TNode<Object> tmp79;
+    TNode<Object> tmp80;
+    ca_.Bind(&block8, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 77);
+    ca_.Goto(&block6, tmp67, tmp68, tmp69, tmp70, tmp71, tmp72, tmp73, tmp74, tmp75, tmp76, tmp77, tmp78);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp81;
+    TNode<JSReceiver> tmp82;
+    TNode<JSReceiver> tmp83;
+    TNode<Object> tmp84;
+    TNode<JSReceiver> tmp85;
+    TNode<JSReceiver> tmp86;
+    TNode<Number> tmp87;
+    TNode<Number> tmp88;
+    TNode<Number> tmp89;
+    TNode<Number> tmp90;
+    TNode<Number> tmp91;
+    TNode<Oddball> tmp92;
+    ca_.Bind(&block6, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 68);
+    ca_.Goto(&block4, tmp81, tmp82, tmp83, tmp84, tmp85, tmp86, tmp87, tmp88, tmp89, tmp90, tmp91);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp93;
+    TNode<JSReceiver> tmp94;
+    TNode<JSReceiver> tmp95;
+    TNode<Object> tmp96;
+    TNode<JSReceiver> tmp97;
+    TNode<JSReceiver> tmp98;
+    TNode<Number> tmp99;
+    TNode<Number> tmp100;
+    TNode<Number> tmp101;
+    TNode<Number> tmp102;
+    TNode<Number> tmp103;
+    ca_.Bind(&block4, &tmp93, &tmp94, &tmp95, &tmp96, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103);
+    TNode<Number> tmp104;
+    USE(tmp104);
+    tmp104 = FromConstexpr20UT5ATSmi10HeapNumber17ATconstexpr_int31_161(state_, 1);
+    TNode<Number> tmp105;
+    USE(tmp105);
+    tmp105 = CodeStubAssembler(state_).NumberAdd(TNode<Number>{tmp103}, TNode<Number>{tmp104});
+    ca_.Goto(&block3, tmp93, tmp94, tmp95, tmp96, tmp97, tmp98, tmp99, tmp100, tmp101, tmp102, tmp105);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp106;
+    TNode<JSReceiver> tmp107;
+    TNode<JSReceiver> tmp108;
+    TNode<Object> tmp109;
+    TNode<JSReceiver> tmp110;
+    TNode<JSReceiver> tmp111;
+    TNode<Number> tmp112;
+    TNode<Number> tmp113;
+    TNode<Number> tmp114;
+    TNode<Number> tmp115;
+    TNode<Number> tmp116;
+    ca_.Bind(&block2, &tmp106, &tmp107, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115, &tmp116);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 95);
+    CodeStubAssembler(state_).Return(tmp110);
+  }
+}
+
+void FastArrayFilter_3(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<JSArray> p_fastO, TNode<Smi> p_len, TNode<JSReceiver> p_callbackfn, TNode<Object> p_thisArg, TNode<JSArray> p_output, compiler::CodeAssemblerLabel* label_Bailout, compiler::TypedCodeAssemblerVariable<Number>* label_Bailout_parameter_0, compiler::TypedCodeAssemblerVariable<Number>* label_Bailout_parameter_1) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Context, Map> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Context, Map, Int32T> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Context> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Smi, JSArray> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Smi, Context, Smi> block25(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Smi, Context, Smi, JSArray, Smi> block29(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Smi, Context, Smi, JSArray, Smi, Object> block28(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Smi, Context, Smi> block26(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Smi, Context, Smi, JSArray, Smi> block31(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Smi, Context, Smi, JSArray, Smi, Object> block30(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Smi, Context, Smi, Object> block24(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block23(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object> block22(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Context, JSReceiver, Object, Object, Smi, JSArray> block32(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object> block33(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object> block38(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object> block39(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object> block40(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object> block41(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object> block37(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, JSArray> block44(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object> block42(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object> block43(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, Object, Object> block46(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, Object, Object> block49(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, Object, Object> block48(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, Object, Object> block47(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, Object, Object> block50(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, Object, Object, JSArray, Object> block54(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, Object, Object, JSArray, Object> block53(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, Object, Object> block51(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, Object, Object> block55(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, Object, Object, JSArray, Object> block59(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, Object, Object, JSArray, Object> block58(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, Object, Object> block56(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, Object, Object> block60(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, Object, Object, BoolT> block64(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, Object, Object, BoolT> block65(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, Object, Object, BoolT, BoolT> block66(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, Object, Object> block63(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, Object, Object> block62(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, Object, Object> block61(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, Object, Object, JSArray, Object> block68(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, Object, Object, JSArray, Object> block67(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, Object, Object> block57(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, Object, Object> block52(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object, Object, Object> block45(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object> block36(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object> block35(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT, Object, Object> block34(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray, Smi, Smi, JSArray, JSArray, Map, BoolT, BoolT, BoolT, JSArray, JSArray, Map, BoolT, BoolT, BoolT> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Number, Number> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray> block69(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_fastO, p_len, p_callbackfn, p_thisArg, p_output);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSArray> tmp1;
+    TNode<Smi> tmp2;
+    TNode<JSReceiver> tmp3;
+    TNode<Object> tmp4;
+    TNode<JSArray> tmp5;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4, &tmp5);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 101);
+    TNode<Smi> tmp6;
+    USE(tmp6);
+    tmp6 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 102);
+    TNode<Smi> tmp7;
+    USE(tmp7);
+    tmp7 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 103);
+    TNode<JSArray> tmp8;
+    USE(tmp8);
+    TNode<JSArray> tmp9;
+    USE(tmp9);
+    TNode<Map> tmp10;
+    USE(tmp10);
+    TNode<BoolT> tmp11;
+    USE(tmp11);
+    TNode<BoolT> tmp12;
+    USE(tmp12);
+    TNode<BoolT> tmp13;
+    USE(tmp13);
+    std::tie(tmp8, tmp9, tmp10, tmp11, tmp12, tmp13) = NewFastJSArrayWitness_239(state_, TNode<JSArray>{tmp1}).Flatten();
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 104);
+    TNode<JSArray> tmp14;
+    USE(tmp14);
+    TNode<JSArray> tmp15;
+    USE(tmp15);
+    TNode<Map> tmp16;
+    USE(tmp16);
+    TNode<BoolT> tmp17;
+    USE(tmp17);
+    TNode<BoolT> tmp18;
+    USE(tmp18);
+    TNode<BoolT> tmp19;
+    USE(tmp19);
+    std::tie(tmp14, tmp15, tmp16, tmp17, tmp18, tmp19) = NewFastJSArrayWitness_239(state_, TNode<JSArray>{tmp5}).Flatten();
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 106);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3350);
+    TNode<Int32T> tmp20;
+    USE(tmp20);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp20 = CodeStubAssembler(state_).EnsureArrayPushable(TNode<Map>{tmp16}, &label0);
+    ca_.Goto(&block6, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19, tmp0, tmp16, tmp20);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block7, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19, tmp0, tmp16);
+    }
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp21;
+    TNode<JSArray> tmp22;
+    TNode<Smi> tmp23;
+    TNode<JSReceiver> tmp24;
+    TNode<Object> tmp25;
+    TNode<JSArray> tmp26;
+    TNode<Smi> tmp27;
+    TNode<Smi> tmp28;
+    TNode<JSArray> tmp29;
+    TNode<JSArray> tmp30;
+    TNode<Map> tmp31;
+    TNode<BoolT> tmp32;
+    TNode<BoolT> tmp33;
+    TNode<BoolT> tmp34;
+    TNode<JSArray> tmp35;
+    TNode<JSArray> tmp36;
+    TNode<Map> tmp37;
+    TNode<BoolT> tmp38;
+    TNode<BoolT> tmp39;
+    TNode<BoolT> tmp40;
+    TNode<Context> tmp41;
+    TNode<Map> tmp42;
+    ca_.Bind(&block7, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42);
+    ca_.Goto(&block4, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27, tmp28, tmp29, tmp30, tmp31, tmp32, tmp33, tmp34, tmp35, tmp36, tmp37, tmp38, tmp39, tmp40);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp43;
+    TNode<JSArray> tmp44;
+    TNode<Smi> tmp45;
+    TNode<JSReceiver> tmp46;
+    TNode<Object> tmp47;
+    TNode<JSArray> tmp48;
+    TNode<Smi> tmp49;
+    TNode<Smi> tmp50;
+    TNode<JSArray> tmp51;
+    TNode<JSArray> tmp52;
+    TNode<Map> tmp53;
+    TNode<BoolT> tmp54;
+    TNode<BoolT> tmp55;
+    TNode<BoolT> tmp56;
+    TNode<JSArray> tmp57;
+    TNode<JSArray> tmp58;
+    TNode<Map> tmp59;
+    TNode<BoolT> tmp60;
+    TNode<BoolT> tmp61;
+    TNode<BoolT> tmp62;
+    TNode<Context> tmp63;
+    TNode<Map> tmp64;
+    TNode<Int32T> tmp65;
+    ca_.Bind(&block6, &tmp43, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3351);
+    EnsureWriteableFastElements_50(state_, TNode<Context>{tmp63}, TNode<JSArray>{tmp58});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3352);
+    TNode<BoolT> tmp66;
+    USE(tmp66);
+    tmp66 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, true);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 106);
+    ca_.Goto(&block5, tmp43, tmp44, tmp45, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51, tmp52, tmp53, tmp54, tmp55, tmp56, tmp57, tmp58, tmp59, tmp60, tmp61, tmp66, tmp63);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp67;
+    TNode<JSArray> tmp68;
+    TNode<Smi> tmp69;
+    TNode<JSReceiver> tmp70;
+    TNode<Object> tmp71;
+    TNode<JSArray> tmp72;
+    TNode<Smi> tmp73;
+    TNode<Smi> tmp74;
+    TNode<JSArray> tmp75;
+    TNode<JSArray> tmp76;
+    TNode<Map> tmp77;
+    TNode<BoolT> tmp78;
+    TNode<BoolT> tmp79;
+    TNode<BoolT> tmp80;
+    TNode<JSArray> tmp81;
+    TNode<JSArray> tmp82;
+    TNode<Map> tmp83;
+    TNode<BoolT> tmp84;
+    TNode<BoolT> tmp85;
+    TNode<BoolT> tmp86;
+    TNode<Context> tmp87;
+    ca_.Bind(&block5, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86, &tmp87);
+    ca_.Goto(&block3, tmp67, tmp68, tmp69, tmp70, tmp71, tmp72, tmp73, tmp74, tmp75, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, tmp83, tmp84, tmp85, tmp86);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp88;
+    TNode<JSArray> tmp89;
+    TNode<Smi> tmp90;
+    TNode<JSReceiver> tmp91;
+    TNode<Object> tmp92;
+    TNode<JSArray> tmp93;
+    TNode<Smi> tmp94;
+    TNode<Smi> tmp95;
+    TNode<JSArray> tmp96;
+    TNode<JSArray> tmp97;
+    TNode<Map> tmp98;
+    TNode<BoolT> tmp99;
+    TNode<BoolT> tmp100;
+    TNode<BoolT> tmp101;
+    TNode<JSArray> tmp102;
+    TNode<JSArray> tmp103;
+    TNode<Map> tmp104;
+    TNode<BoolT> tmp105;
+    TNode<BoolT> tmp106;
+    TNode<BoolT> tmp107;
+    ca_.Bind(&block4, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104, &tmp105, &tmp106, &tmp107);
+    ca_.Goto(&block1, tmp94, tmp95);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp108;
+    TNode<JSArray> tmp109;
+    TNode<Smi> tmp110;
+    TNode<JSReceiver> tmp111;
+    TNode<Object> tmp112;
+    TNode<JSArray> tmp113;
+    TNode<Smi> tmp114;
+    TNode<Smi> tmp115;
+    TNode<JSArray> tmp116;
+    TNode<JSArray> tmp117;
+    TNode<Map> tmp118;
+    TNode<BoolT> tmp119;
+    TNode<BoolT> tmp120;
+    TNode<BoolT> tmp121;
+    TNode<JSArray> tmp122;
+    TNode<JSArray> tmp123;
+    TNode<Map> tmp124;
+    TNode<BoolT> tmp125;
+    TNode<BoolT> tmp126;
+    TNode<BoolT> tmp127;
+    ca_.Bind(&block3, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115, &tmp116, &tmp117, &tmp118, &tmp119, &tmp120, &tmp121, &tmp122, &tmp123, &tmp124, &tmp125, &tmp126, &tmp127);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 109);
+    ca_.Goto(&block10, tmp108, tmp109, tmp110, tmp111, tmp112, tmp113, tmp114, tmp115, tmp116, tmp117, tmp118, tmp119, tmp120, tmp121, tmp122, tmp123, tmp124, tmp125, tmp126, tmp127);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp128;
+    TNode<JSArray> tmp129;
+    TNode<Smi> tmp130;
+    TNode<JSReceiver> tmp131;
+    TNode<Object> tmp132;
+    TNode<JSArray> tmp133;
+    TNode<Smi> tmp134;
+    TNode<Smi> tmp135;
+    TNode<JSArray> tmp136;
+    TNode<JSArray> tmp137;
+    TNode<Map> tmp138;
+    TNode<BoolT> tmp139;
+    TNode<BoolT> tmp140;
+    TNode<BoolT> tmp141;
+    TNode<JSArray> tmp142;
+    TNode<JSArray> tmp143;
+    TNode<Map> tmp144;
+    TNode<BoolT> tmp145;
+    TNode<BoolT> tmp146;
+    TNode<BoolT> tmp147;
+    ca_.Bind(&block10, &tmp128, &tmp129, &tmp130, &tmp131, &tmp132, &tmp133, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138, &tmp139, &tmp140, &tmp141, &tmp142, &tmp143, &tmp144, &tmp145, &tmp146, &tmp147);
+    TNode<BoolT> tmp148;
+    USE(tmp148);
+    tmp148 = CodeStubAssembler(state_).SmiLessThan(TNode<Smi>{tmp134}, TNode<Smi>{tmp130});
+    ca_.Branch(tmp148, &block8, &block9, tmp128, tmp129, tmp130, tmp131, tmp132, tmp133, tmp134, tmp135, tmp136, tmp137, tmp138, tmp139, tmp140, tmp141, tmp142, tmp143, tmp144, tmp145, tmp146, tmp147);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp149;
+    TNode<JSArray> tmp150;
+    TNode<Smi> tmp151;
+    TNode<JSReceiver> tmp152;
+    TNode<Object> tmp153;
+    TNode<JSArray> tmp154;
+    TNode<Smi> tmp155;
+    TNode<Smi> tmp156;
+    TNode<JSArray> tmp157;
+    TNode<JSArray> tmp158;
+    TNode<Map> tmp159;
+    TNode<BoolT> tmp160;
+    TNode<BoolT> tmp161;
+    TNode<BoolT> tmp162;
+    TNode<JSArray> tmp163;
+    TNode<JSArray> tmp164;
+    TNode<Map> tmp165;
+    TNode<BoolT> tmp166;
+    TNode<BoolT> tmp167;
+    TNode<BoolT> tmp168;
+    ca_.Bind(&block8, &tmp149, &tmp150, &tmp151, &tmp152, &tmp153, &tmp154, &tmp155, &tmp156, &tmp157, &tmp158, &tmp159, &tmp160, &tmp161, &tmp162, &tmp163, &tmp164, &tmp165, &tmp166, &tmp167, &tmp168);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3306);
+    TNode<IntPtrT> tmp169 = ca_.IntPtrConstant(HeapObject::kMapOffset);
+    USE(tmp169);
+    TNode<Map>tmp170 = CodeStubAssembler(state_).LoadReference<Map>(CodeStubAssembler::Reference{tmp157, tmp169});
+    TNode<BoolT> tmp171;
+    USE(tmp171);
+    tmp171 = CodeStubAssembler(state_).TaggedNotEqual(TNode<HeapObject>{tmp170}, TNode<HeapObject>{tmp159});
+    ca_.Branch(tmp171, &block15, &block16, tmp149, tmp150, tmp151, tmp152, tmp153, tmp154, tmp155, tmp156, tmp157, tmp158, tmp159, tmp160, tmp161, tmp162, tmp163, tmp164, tmp165, tmp166, tmp167, tmp168);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp172;
+    TNode<JSArray> tmp173;
+    TNode<Smi> tmp174;
+    TNode<JSReceiver> tmp175;
+    TNode<Object> tmp176;
+    TNode<JSArray> tmp177;
+    TNode<Smi> tmp178;
+    TNode<Smi> tmp179;
+    TNode<JSArray> tmp180;
+    TNode<JSArray> tmp181;
+    TNode<Map> tmp182;
+    TNode<BoolT> tmp183;
+    TNode<BoolT> tmp184;
+    TNode<BoolT> tmp185;
+    TNode<JSArray> tmp186;
+    TNode<JSArray> tmp187;
+    TNode<Map> tmp188;
+    TNode<BoolT> tmp189;
+    TNode<BoolT> tmp190;
+    TNode<BoolT> tmp191;
+    ca_.Bind(&block15, &tmp172, &tmp173, &tmp174, &tmp175, &tmp176, &tmp177, &tmp178, &tmp179, &tmp180, &tmp181, &tmp182, &tmp183, &tmp184, &tmp185, &tmp186, &tmp187, &tmp188, &tmp189, &tmp190, &tmp191);
+    ca_.Goto(&block13, tmp172, tmp173, tmp174, tmp175, tmp176, tmp177, tmp178, tmp179, tmp180, tmp181, tmp182, tmp183, tmp184, tmp185, tmp186, tmp187, tmp188, tmp189, tmp190, tmp191);
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp192;
+    TNode<JSArray> tmp193;
+    TNode<Smi> tmp194;
+    TNode<JSReceiver> tmp195;
+    TNode<Object> tmp196;
+    TNode<JSArray> tmp197;
+    TNode<Smi> tmp198;
+    TNode<Smi> tmp199;
+    TNode<JSArray> tmp200;
+    TNode<JSArray> tmp201;
+    TNode<Map> tmp202;
+    TNode<BoolT> tmp203;
+    TNode<BoolT> tmp204;
+    TNode<BoolT> tmp205;
+    TNode<JSArray> tmp206;
+    TNode<JSArray> tmp207;
+    TNode<Map> tmp208;
+    TNode<BoolT> tmp209;
+    TNode<BoolT> tmp210;
+    TNode<BoolT> tmp211;
+    ca_.Bind(&block16, &tmp192, &tmp193, &tmp194, &tmp195, &tmp196, &tmp197, &tmp198, &tmp199, &tmp200, &tmp201, &tmp202, &tmp203, &tmp204, &tmp205, &tmp206, &tmp207, &tmp208, &tmp209, &tmp210, &tmp211);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3313);
+    TNode<BoolT> tmp212;
+    USE(tmp212);
+    tmp212 = CodeStubAssembler(state_).IsNoElementsProtectorCellInvalid();
+    ca_.Branch(tmp212, &block17, &block18, tmp192, tmp193, tmp194, tmp195, tmp196, tmp197, tmp198, tmp199, tmp200, tmp201, tmp202, tmp203, tmp204, tmp205, tmp206, tmp207, tmp208, tmp209, tmp210, tmp211);
+  }
+
+  if (block17.is_used()) {
+    TNode<Context> tmp213;
+    TNode<JSArray> tmp214;
+    TNode<Smi> tmp215;
+    TNode<JSReceiver> tmp216;
+    TNode<Object> tmp217;
+    TNode<JSArray> tmp218;
+    TNode<Smi> tmp219;
+    TNode<Smi> tmp220;
+    TNode<JSArray> tmp221;
+    TNode<JSArray> tmp222;
+    TNode<Map> tmp223;
+    TNode<BoolT> tmp224;
+    TNode<BoolT> tmp225;
+    TNode<BoolT> tmp226;
+    TNode<JSArray> tmp227;
+    TNode<JSArray> tmp228;
+    TNode<Map> tmp229;
+    TNode<BoolT> tmp230;
+    TNode<BoolT> tmp231;
+    TNode<BoolT> tmp232;
+    ca_.Bind(&block17, &tmp213, &tmp214, &tmp215, &tmp216, &tmp217, &tmp218, &tmp219, &tmp220, &tmp221, &tmp222, &tmp223, &tmp224, &tmp225, &tmp226, &tmp227, &tmp228, &tmp229, &tmp230, &tmp231, &tmp232);
+    ca_.Goto(&block13, tmp213, tmp214, tmp215, tmp216, tmp217, tmp218, tmp219, tmp220, tmp221, tmp222, tmp223, tmp224, tmp225, tmp226, tmp227, tmp228, tmp229, tmp230, tmp231, tmp232);
+  }
+
+  if (block18.is_used()) {
+    TNode<Context> tmp233;
+    TNode<JSArray> tmp234;
+    TNode<Smi> tmp235;
+    TNode<JSReceiver> tmp236;
+    TNode<Object> tmp237;
+    TNode<JSArray> tmp238;
+    TNode<Smi> tmp239;
+    TNode<Smi> tmp240;
+    TNode<JSArray> tmp241;
+    TNode<JSArray> tmp242;
+    TNode<Map> tmp243;
+    TNode<BoolT> tmp244;
+    TNode<BoolT> tmp245;
+    TNode<BoolT> tmp246;
+    TNode<JSArray> tmp247;
+    TNode<JSArray> tmp248;
+    TNode<Map> tmp249;
+    TNode<BoolT> tmp250;
+    TNode<BoolT> tmp251;
+    TNode<BoolT> tmp252;
+    ca_.Bind(&block18, &tmp233, &tmp234, &tmp235, &tmp236, &tmp237, &tmp238, &tmp239, &tmp240, &tmp241, &tmp242, &tmp243, &tmp244, &tmp245, &tmp246, &tmp247, &tmp248, &tmp249, &tmp250, &tmp251, &tmp252);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3314);
+    TNode<JSArray> tmp253;
+    USE(tmp253);
+    tmp253 = (TNode<JSArray>{tmp241});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 110);
+    ca_.Goto(&block14, tmp233, tmp234, tmp235, tmp236, tmp237, tmp238, tmp239, tmp240, tmp241, tmp253, tmp243, tmp244, tmp245, tmp246, tmp247, tmp248, tmp249, tmp250, tmp251, tmp252);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp254;
+    TNode<JSArray> tmp255;
+    TNode<Smi> tmp256;
+    TNode<JSReceiver> tmp257;
+    TNode<Object> tmp258;
+    TNode<JSArray> tmp259;
+    TNode<Smi> tmp260;
+    TNode<Smi> tmp261;
+    TNode<JSArray> tmp262;
+    TNode<JSArray> tmp263;
+    TNode<Map> tmp264;
+    TNode<BoolT> tmp265;
+    TNode<BoolT> tmp266;
+    TNode<BoolT> tmp267;
+    TNode<JSArray> tmp268;
+    TNode<JSArray> tmp269;
+    TNode<Map> tmp270;
+    TNode<BoolT> tmp271;
+    TNode<BoolT> tmp272;
+    TNode<BoolT> tmp273;
+    ca_.Bind(&block14, &tmp254, &tmp255, &tmp256, &tmp257, &tmp258, &tmp259, &tmp260, &tmp261, &tmp262, &tmp263, &tmp264, &tmp265, &tmp266, &tmp267, &tmp268, &tmp269, &tmp270, &tmp271, &tmp272, &tmp273);
+    ca_.Goto(&block12, tmp254, tmp255, tmp256, tmp257, tmp258, tmp259, tmp260, tmp261, tmp262, tmp263, tmp264, tmp265, tmp266, tmp267, tmp268, tmp269, tmp270, tmp271, tmp272, tmp273);
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp274;
+    TNode<JSArray> tmp275;
+    TNode<Smi> tmp276;
+    TNode<JSReceiver> tmp277;
+    TNode<Object> tmp278;
+    TNode<JSArray> tmp279;
+    TNode<Smi> tmp280;
+    TNode<Smi> tmp281;
+    TNode<JSArray> tmp282;
+    TNode<JSArray> tmp283;
+    TNode<Map> tmp284;
+    TNode<BoolT> tmp285;
+    TNode<BoolT> tmp286;
+    TNode<BoolT> tmp287;
+    TNode<JSArray> tmp288;
+    TNode<JSArray> tmp289;
+    TNode<Map> tmp290;
+    TNode<BoolT> tmp291;
+    TNode<BoolT> tmp292;
+    TNode<BoolT> tmp293;
+    ca_.Bind(&block13, &tmp274, &tmp275, &tmp276, &tmp277, &tmp278, &tmp279, &tmp280, &tmp281, &tmp282, &tmp283, &tmp284, &tmp285, &tmp286, &tmp287, &tmp288, &tmp289, &tmp290, &tmp291, &tmp292, &tmp293);
+    ca_.Goto(&block1, tmp280, tmp281);
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp294;
+    TNode<JSArray> tmp295;
+    TNode<Smi> tmp296;
+    TNode<JSReceiver> tmp297;
+    TNode<Object> tmp298;
+    TNode<JSArray> tmp299;
+    TNode<Smi> tmp300;
+    TNode<Smi> tmp301;
+    TNode<JSArray> tmp302;
+    TNode<JSArray> tmp303;
+    TNode<Map> tmp304;
+    TNode<BoolT> tmp305;
+    TNode<BoolT> tmp306;
+    TNode<BoolT> tmp307;
+    TNode<JSArray> tmp308;
+    TNode<JSArray> tmp309;
+    TNode<Map> tmp310;
+    TNode<BoolT> tmp311;
+    TNode<BoolT> tmp312;
+    TNode<BoolT> tmp313;
+    ca_.Bind(&block12, &tmp294, &tmp295, &tmp296, &tmp297, &tmp298, &tmp299, &tmp300, &tmp301, &tmp302, &tmp303, &tmp304, &tmp305, &tmp306, &tmp307, &tmp308, &tmp309, &tmp310, &tmp311, &tmp312, &tmp313);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 113);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3302);
+    ca_.Goto(&block21, tmp294, tmp295, tmp296, tmp297, tmp298, tmp299, tmp300, tmp301, tmp302, tmp303, tmp304, tmp305, tmp306, tmp307, tmp308, tmp309, tmp310, tmp311, tmp312, tmp313, tmp300, tmp303);
+  }
+
+  if (block21.is_used()) {
+    TNode<Context> tmp314;
+    TNode<JSArray> tmp315;
+    TNode<Smi> tmp316;
+    TNode<JSReceiver> tmp317;
+    TNode<Object> tmp318;
+    TNode<JSArray> tmp319;
+    TNode<Smi> tmp320;
+    TNode<Smi> tmp321;
+    TNode<JSArray> tmp322;
+    TNode<JSArray> tmp323;
+    TNode<Map> tmp324;
+    TNode<BoolT> tmp325;
+    TNode<BoolT> tmp326;
+    TNode<BoolT> tmp327;
+    TNode<JSArray> tmp328;
+    TNode<JSArray> tmp329;
+    TNode<Map> tmp330;
+    TNode<BoolT> tmp331;
+    TNode<BoolT> tmp332;
+    TNode<BoolT> tmp333;
+    TNode<Smi> tmp334;
+    TNode<JSArray> tmp335;
+    ca_.Bind(&block21, &tmp314, &tmp315, &tmp316, &tmp317, &tmp318, &tmp319, &tmp320, &tmp321, &tmp322, &tmp323, &tmp324, &tmp325, &tmp326, &tmp327, &tmp328, &tmp329, &tmp330, &tmp331, &tmp332, &tmp333, &tmp334, &tmp335);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 113);
+    TNode<Smi> tmp336;
+    USE(tmp336);
+    tmp336 = CodeStubAssembler(state_).LoadFastJSArrayLength(TNode<JSArray>{tmp335});
+    TNode<BoolT> tmp337;
+    USE(tmp337);
+    tmp337 = CodeStubAssembler(state_).SmiGreaterThanOrEqual(TNode<Smi>{tmp334}, TNode<Smi>{tmp336});
+    ca_.Branch(tmp337, &block19, &block20, tmp314, tmp315, tmp316, tmp317, tmp318, tmp319, tmp320, tmp321, tmp322, tmp323, tmp324, tmp325, tmp326, tmp327, tmp328, tmp329, tmp330, tmp331, tmp332, tmp333);
+  }
+
+  if (block19.is_used()) {
+    TNode<Context> tmp338;
+    TNode<JSArray> tmp339;
+    TNode<Smi> tmp340;
+    TNode<JSReceiver> tmp341;
+    TNode<Object> tmp342;
+    TNode<JSArray> tmp343;
+    TNode<Smi> tmp344;
+    TNode<Smi> tmp345;
+    TNode<JSArray> tmp346;
+    TNode<JSArray> tmp347;
+    TNode<Map> tmp348;
+    TNode<BoolT> tmp349;
+    TNode<BoolT> tmp350;
+    TNode<BoolT> tmp351;
+    TNode<JSArray> tmp352;
+    TNode<JSArray> tmp353;
+    TNode<Map> tmp354;
+    TNode<BoolT> tmp355;
+    TNode<BoolT> tmp356;
+    TNode<BoolT> tmp357;
+    ca_.Bind(&block19, &tmp338, &tmp339, &tmp340, &tmp341, &tmp342, &tmp343, &tmp344, &tmp345, &tmp346, &tmp347, &tmp348, &tmp349, &tmp350, &tmp351, &tmp352, &tmp353, &tmp354, &tmp355, &tmp356, &tmp357);
+    ca_.Goto(&block1, tmp344, tmp345);
+  }
+
+  if (block20.is_used()) {
+    TNode<Context> tmp358;
+    TNode<JSArray> tmp359;
+    TNode<Smi> tmp360;
+    TNode<JSReceiver> tmp361;
+    TNode<Object> tmp362;
+    TNode<JSArray> tmp363;
+    TNode<Smi> tmp364;
+    TNode<Smi> tmp365;
+    TNode<JSArray> tmp366;
+    TNode<JSArray> tmp367;
+    TNode<Map> tmp368;
+    TNode<BoolT> tmp369;
+    TNode<BoolT> tmp370;
+    TNode<BoolT> tmp371;
+    TNode<JSArray> tmp372;
+    TNode<JSArray> tmp373;
+    TNode<Map> tmp374;
+    TNode<BoolT> tmp375;
+    TNode<BoolT> tmp376;
+    TNode<BoolT> tmp377;
+    ca_.Bind(&block20, &tmp358, &tmp359, &tmp360, &tmp361, &tmp362, &tmp363, &tmp364, &tmp365, &tmp366, &tmp367, &tmp368, &tmp369, &tmp370, &tmp371, &tmp372, &tmp373, &tmp374, &tmp375, &tmp376, &tmp377);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 114);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3319);
+    ca_.Branch(tmp369, &block25, &block26, tmp358, tmp359, tmp360, tmp361, tmp362, tmp363, tmp364, tmp365, tmp366, tmp367, tmp368, tmp369, tmp370, tmp371, tmp372, tmp373, tmp374, tmp375, tmp376, tmp377, tmp364, tmp358, tmp364);
+  }
+
+  if (block25.is_used()) {
+    TNode<Context> tmp378;
+    TNode<JSArray> tmp379;
+    TNode<Smi> tmp380;
+    TNode<JSReceiver> tmp381;
+    TNode<Object> tmp382;
+    TNode<JSArray> tmp383;
+    TNode<Smi> tmp384;
+    TNode<Smi> tmp385;
+    TNode<JSArray> tmp386;
+    TNode<JSArray> tmp387;
+    TNode<Map> tmp388;
+    TNode<BoolT> tmp389;
+    TNode<BoolT> tmp390;
+    TNode<BoolT> tmp391;
+    TNode<JSArray> tmp392;
+    TNode<JSArray> tmp393;
+    TNode<Map> tmp394;
+    TNode<BoolT> tmp395;
+    TNode<BoolT> tmp396;
+    TNode<BoolT> tmp397;
+    TNode<Smi> tmp398;
+    TNode<Context> tmp399;
+    TNode<Smi> tmp400;
+    ca_.Bind(&block25, &tmp378, &tmp379, &tmp380, &tmp381, &tmp382, &tmp383, &tmp384, &tmp385, &tmp386, &tmp387, &tmp388, &tmp389, &tmp390, &tmp391, &tmp392, &tmp393, &tmp394, &tmp395, &tmp396, &tmp397, &tmp398, &tmp399, &tmp400);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3320);
+    TNode<Object> tmp401;
+    USE(tmp401);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp401 = LoadElementNoHole16FixedDoubleArray_238(state_, TNode<Context>{tmp399}, TNode<JSArray>{tmp387}, TNode<Smi>{tmp400}, &label0);
+    ca_.Goto(&block28, tmp378, tmp379, tmp380, tmp381, tmp382, tmp383, tmp384, tmp385, tmp386, tmp387, tmp388, tmp389, tmp390, tmp391, tmp392, tmp393, tmp394, tmp395, tmp396, tmp397, tmp398, tmp399, tmp400, tmp387, tmp400, tmp401);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block29, tmp378, tmp379, tmp380, tmp381, tmp382, tmp383, tmp384, tmp385, tmp386, tmp387, tmp388, tmp389, tmp390, tmp391, tmp392, tmp393, tmp394, tmp395, tmp396, tmp397, tmp398, tmp399, tmp400, tmp387, tmp400);
+    }
+  }
+
+  if (block29.is_used()) {
+    TNode<Context> tmp402;
+    TNode<JSArray> tmp403;
+    TNode<Smi> tmp404;
+    TNode<JSReceiver> tmp405;
+    TNode<Object> tmp406;
+    TNode<JSArray> tmp407;
+    TNode<Smi> tmp408;
+    TNode<Smi> tmp409;
+    TNode<JSArray> tmp410;
+    TNode<JSArray> tmp411;
+    TNode<Map> tmp412;
+    TNode<BoolT> tmp413;
+    TNode<BoolT> tmp414;
+    TNode<BoolT> tmp415;
+    TNode<JSArray> tmp416;
+    TNode<JSArray> tmp417;
+    TNode<Map> tmp418;
+    TNode<BoolT> tmp419;
+    TNode<BoolT> tmp420;
+    TNode<BoolT> tmp421;
+    TNode<Smi> tmp422;
+    TNode<Context> tmp423;
+    TNode<Smi> tmp424;
+    TNode<JSArray> tmp425;
+    TNode<Smi> tmp426;
+    ca_.Bind(&block29, &tmp402, &tmp403, &tmp404, &tmp405, &tmp406, &tmp407, &tmp408, &tmp409, &tmp410, &tmp411, &tmp412, &tmp413, &tmp414, &tmp415, &tmp416, &tmp417, &tmp418, &tmp419, &tmp420, &tmp421, &tmp422, &tmp423, &tmp424, &tmp425, &tmp426);
+    ca_.Goto(&block23, tmp402, tmp403, tmp404, tmp405, tmp406, tmp407, tmp408, tmp409, tmp410, tmp411, tmp412, tmp413, tmp414, tmp415, tmp416, tmp417, tmp418, tmp419, tmp420, tmp421);
+  }
+
+  if (block28.is_used()) {
+    TNode<Context> tmp427;
+    TNode<JSArray> tmp428;
+    TNode<Smi> tmp429;
+    TNode<JSReceiver> tmp430;
+    TNode<Object> tmp431;
+    TNode<JSArray> tmp432;
+    TNode<Smi> tmp433;
+    TNode<Smi> tmp434;
+    TNode<JSArray> tmp435;
+    TNode<JSArray> tmp436;
+    TNode<Map> tmp437;
+    TNode<BoolT> tmp438;
+    TNode<BoolT> tmp439;
+    TNode<BoolT> tmp440;
+    TNode<JSArray> tmp441;
+    TNode<JSArray> tmp442;
+    TNode<Map> tmp443;
+    TNode<BoolT> tmp444;
+    TNode<BoolT> tmp445;
+    TNode<BoolT> tmp446;
+    TNode<Smi> tmp447;
+    TNode<Context> tmp448;
+    TNode<Smi> tmp449;
+    TNode<JSArray> tmp450;
+    TNode<Smi> tmp451;
+    TNode<Object> tmp452;
+    ca_.Bind(&block28, &tmp427, &tmp428, &tmp429, &tmp430, &tmp431, &tmp432, &tmp433, &tmp434, &tmp435, &tmp436, &tmp437, &tmp438, &tmp439, &tmp440, &tmp441, &tmp442, &tmp443, &tmp444, &tmp445, &tmp446, &tmp447, &tmp448, &tmp449, &tmp450, &tmp451, &tmp452);
+    ca_.Goto(&block24, tmp427, tmp428, tmp429, tmp430, tmp431, tmp432, tmp433, tmp434, tmp435, tmp436, tmp437, tmp438, tmp439, tmp440, tmp441, tmp442, tmp443, tmp444, tmp445, tmp446, tmp447, tmp448, tmp449, tmp452);
+  }
+
+  if (block26.is_used()) {
+    TNode<Context> tmp453;
+    TNode<JSArray> tmp454;
+    TNode<Smi> tmp455;
+    TNode<JSReceiver> tmp456;
+    TNode<Object> tmp457;
+    TNode<JSArray> tmp458;
+    TNode<Smi> tmp459;
+    TNode<Smi> tmp460;
+    TNode<JSArray> tmp461;
+    TNode<JSArray> tmp462;
+    TNode<Map> tmp463;
+    TNode<BoolT> tmp464;
+    TNode<BoolT> tmp465;
+    TNode<BoolT> tmp466;
+    TNode<JSArray> tmp467;
+    TNode<JSArray> tmp468;
+    TNode<Map> tmp469;
+    TNode<BoolT> tmp470;
+    TNode<BoolT> tmp471;
+    TNode<BoolT> tmp472;
+    TNode<Smi> tmp473;
+    TNode<Context> tmp474;
+    TNode<Smi> tmp475;
+    ca_.Bind(&block26, &tmp453, &tmp454, &tmp455, &tmp456, &tmp457, &tmp458, &tmp459, &tmp460, &tmp461, &tmp462, &tmp463, &tmp464, &tmp465, &tmp466, &tmp467, &tmp468, &tmp469, &tmp470, &tmp471, &tmp472, &tmp473, &tmp474, &tmp475);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3323);
+    TNode<Object> tmp476;
+    USE(tmp476);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp476 = LoadElementNoHole10FixedArray_237(state_, TNode<Context>{tmp474}, TNode<JSArray>{tmp462}, TNode<Smi>{tmp475}, &label0);
+    ca_.Goto(&block30, tmp453, tmp454, tmp455, tmp456, tmp457, tmp458, tmp459, tmp460, tmp461, tmp462, tmp463, tmp464, tmp465, tmp466, tmp467, tmp468, tmp469, tmp470, tmp471, tmp472, tmp473, tmp474, tmp475, tmp462, tmp475, tmp476);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block31, tmp453, tmp454, tmp455, tmp456, tmp457, tmp458, tmp459, tmp460, tmp461, tmp462, tmp463, tmp464, tmp465, tmp466, tmp467, tmp468, tmp469, tmp470, tmp471, tmp472, tmp473, tmp474, tmp475, tmp462, tmp475);
+    }
+  }
+
+  if (block31.is_used()) {
+    TNode<Context> tmp477;
+    TNode<JSArray> tmp478;
+    TNode<Smi> tmp479;
+    TNode<JSReceiver> tmp480;
+    TNode<Object> tmp481;
+    TNode<JSArray> tmp482;
+    TNode<Smi> tmp483;
+    TNode<Smi> tmp484;
+    TNode<JSArray> tmp485;
+    TNode<JSArray> tmp486;
+    TNode<Map> tmp487;
+    TNode<BoolT> tmp488;
+    TNode<BoolT> tmp489;
+    TNode<BoolT> tmp490;
+    TNode<JSArray> tmp491;
+    TNode<JSArray> tmp492;
+    TNode<Map> tmp493;
+    TNode<BoolT> tmp494;
+    TNode<BoolT> tmp495;
+    TNode<BoolT> tmp496;
+    TNode<Smi> tmp497;
+    TNode<Context> tmp498;
+    TNode<Smi> tmp499;
+    TNode<JSArray> tmp500;
+    TNode<Smi> tmp501;
+    ca_.Bind(&block31, &tmp477, &tmp478, &tmp479, &tmp480, &tmp481, &tmp482, &tmp483, &tmp484, &tmp485, &tmp486, &tmp487, &tmp488, &tmp489, &tmp490, &tmp491, &tmp492, &tmp493, &tmp494, &tmp495, &tmp496, &tmp497, &tmp498, &tmp499, &tmp500, &tmp501);
+    ca_.Goto(&block23, tmp477, tmp478, tmp479, tmp480, tmp481, tmp482, tmp483, tmp484, tmp485, tmp486, tmp487, tmp488, tmp489, tmp490, tmp491, tmp492, tmp493, tmp494, tmp495, tmp496);
+  }
+
+  if (block30.is_used()) {
+    TNode<Context> tmp502;
+    TNode<JSArray> tmp503;
+    TNode<Smi> tmp504;
+    TNode<JSReceiver> tmp505;
+    TNode<Object> tmp506;
+    TNode<JSArray> tmp507;
+    TNode<Smi> tmp508;
+    TNode<Smi> tmp509;
+    TNode<JSArray> tmp510;
+    TNode<JSArray> tmp511;
+    TNode<Map> tmp512;
+    TNode<BoolT> tmp513;
+    TNode<BoolT> tmp514;
+    TNode<BoolT> tmp515;
+    TNode<JSArray> tmp516;
+    TNode<JSArray> tmp517;
+    TNode<Map> tmp518;
+    TNode<BoolT> tmp519;
+    TNode<BoolT> tmp520;
+    TNode<BoolT> tmp521;
+    TNode<Smi> tmp522;
+    TNode<Context> tmp523;
+    TNode<Smi> tmp524;
+    TNode<JSArray> tmp525;
+    TNode<Smi> tmp526;
+    TNode<Object> tmp527;
+    ca_.Bind(&block30, &tmp502, &tmp503, &tmp504, &tmp505, &tmp506, &tmp507, &tmp508, &tmp509, &tmp510, &tmp511, &tmp512, &tmp513, &tmp514, &tmp515, &tmp516, &tmp517, &tmp518, &tmp519, &tmp520, &tmp521, &tmp522, &tmp523, &tmp524, &tmp525, &tmp526, &tmp527);
+    ca_.Goto(&block24, tmp502, tmp503, tmp504, tmp505, tmp506, tmp507, tmp508, tmp509, tmp510, tmp511, tmp512, tmp513, tmp514, tmp515, tmp516, tmp517, tmp518, tmp519, tmp520, tmp521, tmp522, tmp523, tmp524, tmp527);
+  }
+
+  if (block24.is_used()) {
+    TNode<Context> tmp528;
+    TNode<JSArray> tmp529;
+    TNode<Smi> tmp530;
+    TNode<JSReceiver> tmp531;
+    TNode<Object> tmp532;
+    TNode<JSArray> tmp533;
+    TNode<Smi> tmp534;
+    TNode<Smi> tmp535;
+    TNode<JSArray> tmp536;
+    TNode<JSArray> tmp537;
+    TNode<Map> tmp538;
+    TNode<BoolT> tmp539;
+    TNode<BoolT> tmp540;
+    TNode<BoolT> tmp541;
+    TNode<JSArray> tmp542;
+    TNode<JSArray> tmp543;
+    TNode<Map> tmp544;
+    TNode<BoolT> tmp545;
+    TNode<BoolT> tmp546;
+    TNode<BoolT> tmp547;
+    TNode<Smi> tmp548;
+    TNode<Context> tmp549;
+    TNode<Smi> tmp550;
+    TNode<Object> tmp551;
+    ca_.Bind(&block24, &tmp528, &tmp529, &tmp530, &tmp531, &tmp532, &tmp533, &tmp534, &tmp535, &tmp536, &tmp537, &tmp538, &tmp539, &tmp540, &tmp541, &tmp542, &tmp543, &tmp544, &tmp545, &tmp546, &tmp547, &tmp548, &tmp549, &tmp550, &tmp551);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 114);
+    ca_.Goto(&block22, tmp528, tmp529, tmp530, tmp531, tmp532, tmp533, tmp534, tmp535, tmp536, tmp537, tmp538, tmp539, tmp540, tmp541, tmp542, tmp543, tmp544, tmp545, tmp546, tmp547, tmp551);
+  }
+
+  if (block23.is_used()) {
+    TNode<Context> tmp552;
+    TNode<JSArray> tmp553;
+    TNode<Smi> tmp554;
+    TNode<JSReceiver> tmp555;
+    TNode<Object> tmp556;
+    TNode<JSArray> tmp557;
+    TNode<Smi> tmp558;
+    TNode<Smi> tmp559;
+    TNode<JSArray> tmp560;
+    TNode<JSArray> tmp561;
+    TNode<Map> tmp562;
+    TNode<BoolT> tmp563;
+    TNode<BoolT> tmp564;
+    TNode<BoolT> tmp565;
+    TNode<JSArray> tmp566;
+    TNode<JSArray> tmp567;
+    TNode<Map> tmp568;
+    TNode<BoolT> tmp569;
+    TNode<BoolT> tmp570;
+    TNode<BoolT> tmp571;
+    ca_.Bind(&block23, &tmp552, &tmp553, &tmp554, &tmp555, &tmp556, &tmp557, &tmp558, &tmp559, &tmp560, &tmp561, &tmp562, &tmp563, &tmp564, &tmp565, &tmp566, &tmp567, &tmp568, &tmp569, &tmp570, &tmp571);
+    ca_.Goto(&block11, tmp552, tmp553, tmp554, tmp555, tmp556, tmp557, tmp558, tmp559, tmp560, tmp561, tmp562, tmp563, tmp564, tmp565, tmp566, tmp567, tmp568, tmp569, tmp570, tmp571);
+  }
+
+  if (block22.is_used()) {
+    TNode<Context> tmp572;
+    TNode<JSArray> tmp573;
+    TNode<Smi> tmp574;
+    TNode<JSReceiver> tmp575;
+    TNode<Object> tmp576;
+    TNode<JSArray> tmp577;
+    TNode<Smi> tmp578;
+    TNode<Smi> tmp579;
+    TNode<JSArray> tmp580;
+    TNode<JSArray> tmp581;
+    TNode<Map> tmp582;
+    TNode<BoolT> tmp583;
+    TNode<BoolT> tmp584;
+    TNode<BoolT> tmp585;
+    TNode<JSArray> tmp586;
+    TNode<JSArray> tmp587;
+    TNode<Map> tmp588;
+    TNode<BoolT> tmp589;
+    TNode<BoolT> tmp590;
+    TNode<BoolT> tmp591;
+    TNode<Object> tmp592;
+    ca_.Bind(&block22, &tmp572, &tmp573, &tmp574, &tmp575, &tmp576, &tmp577, &tmp578, &tmp579, &tmp580, &tmp581, &tmp582, &tmp583, &tmp584, &tmp585, &tmp586, &tmp587, &tmp588, &tmp589, &tmp590, &tmp591, &tmp592);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 116);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3302);
+    ca_.Goto(&block32, tmp572, tmp573, tmp574, tmp575, tmp576, tmp577, tmp578, tmp579, tmp580, tmp581, tmp582, tmp583, tmp584, tmp585, tmp586, tmp587, tmp588, tmp589, tmp590, tmp591, tmp592, tmp572, tmp575, tmp576, tmp592, tmp578, tmp581);
+  }
+
+  if (block32.is_used()) {
+    TNode<Context> tmp593;
+    TNode<JSArray> tmp594;
+    TNode<Smi> tmp595;
+    TNode<JSReceiver> tmp596;
+    TNode<Object> tmp597;
+    TNode<JSArray> tmp598;
+    TNode<Smi> tmp599;
+    TNode<Smi> tmp600;
+    TNode<JSArray> tmp601;
+    TNode<JSArray> tmp602;
+    TNode<Map> tmp603;
+    TNode<BoolT> tmp604;
+    TNode<BoolT> tmp605;
+    TNode<BoolT> tmp606;
+    TNode<JSArray> tmp607;
+    TNode<JSArray> tmp608;
+    TNode<Map> tmp609;
+    TNode<BoolT> tmp610;
+    TNode<BoolT> tmp611;
+    TNode<BoolT> tmp612;
+    TNode<Object> tmp613;
+    TNode<Context> tmp614;
+    TNode<JSReceiver> tmp615;
+    TNode<Object> tmp616;
+    TNode<Object> tmp617;
+    TNode<Smi> tmp618;
+    TNode<JSArray> tmp619;
+    ca_.Bind(&block32, &tmp593, &tmp594, &tmp595, &tmp596, &tmp597, &tmp598, &tmp599, &tmp600, &tmp601, &tmp602, &tmp603, &tmp604, &tmp605, &tmp606, &tmp607, &tmp608, &tmp609, &tmp610, &tmp611, &tmp612, &tmp613, &tmp614, &tmp615, &tmp616, &tmp617, &tmp618, &tmp619);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 116);
+    TNode<Object> tmp620;
+    USE(tmp620);
+    tmp620 = CodeStubAssembler(state_).Call(TNode<Context>{tmp614}, TNode<JSReceiver>{tmp615}, TNode<Object>{tmp616}, TNode<Object>{tmp617}, TNode<Object>{tmp618}, TNode<Object>{tmp619});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 115);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 117);
+    TNode<BoolT> tmp621;
+    USE(tmp621);
+    tmp621 = ToBoolean_243(state_, TNode<Object>{tmp620});
+    ca_.Branch(tmp621, &block33, &block34, tmp593, tmp594, tmp595, tmp596, tmp597, tmp598, tmp599, tmp600, tmp601, tmp602, tmp603, tmp604, tmp605, tmp606, tmp607, tmp608, tmp609, tmp610, tmp611, tmp612, tmp613, tmp620);
+  }
+
+  if (block33.is_used()) {
+    TNode<Context> tmp622;
+    TNode<JSArray> tmp623;
+    TNode<Smi> tmp624;
+    TNode<JSReceiver> tmp625;
+    TNode<Object> tmp626;
+    TNode<JSArray> tmp627;
+    TNode<Smi> tmp628;
+    TNode<Smi> tmp629;
+    TNode<JSArray> tmp630;
+    TNode<JSArray> tmp631;
+    TNode<Map> tmp632;
+    TNode<BoolT> tmp633;
+    TNode<BoolT> tmp634;
+    TNode<BoolT> tmp635;
+    TNode<JSArray> tmp636;
+    TNode<JSArray> tmp637;
+    TNode<Map> tmp638;
+    TNode<BoolT> tmp639;
+    TNode<BoolT> tmp640;
+    TNode<BoolT> tmp641;
+    TNode<Object> tmp642;
+    TNode<Object> tmp643;
+    ca_.Bind(&block33, &tmp622, &tmp623, &tmp624, &tmp625, &tmp626, &tmp627, &tmp628, &tmp629, &tmp630, &tmp631, &tmp632, &tmp633, &tmp634, &tmp635, &tmp636, &tmp637, &tmp638, &tmp639, &tmp640, &tmp641, &tmp642, &tmp643);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3306);
+    TNode<IntPtrT> tmp644 = ca_.IntPtrConstant(HeapObject::kMapOffset);
+    USE(tmp644);
+    TNode<Map>tmp645 = CodeStubAssembler(state_).LoadReference<Map>(CodeStubAssembler::Reference{tmp636, tmp644});
+    TNode<BoolT> tmp646;
+    USE(tmp646);
+    tmp646 = CodeStubAssembler(state_).TaggedNotEqual(TNode<HeapObject>{tmp645}, TNode<HeapObject>{tmp638});
+    ca_.Branch(tmp646, &block38, &block39, tmp622, tmp623, tmp624, tmp625, tmp626, tmp627, tmp628, tmp629, tmp630, tmp631, tmp632, tmp633, tmp634, tmp635, tmp636, tmp637, tmp638, tmp639, tmp640, tmp641, tmp642, tmp643);
+  }
+
+  if (block38.is_used()) {
+    TNode<Context> tmp647;
+    TNode<JSArray> tmp648;
+    TNode<Smi> tmp649;
+    TNode<JSReceiver> tmp650;
+    TNode<Object> tmp651;
+    TNode<JSArray> tmp652;
+    TNode<Smi> tmp653;
+    TNode<Smi> tmp654;
+    TNode<JSArray> tmp655;
+    TNode<JSArray> tmp656;
+    TNode<Map> tmp657;
+    TNode<BoolT> tmp658;
+    TNode<BoolT> tmp659;
+    TNode<BoolT> tmp660;
+    TNode<JSArray> tmp661;
+    TNode<JSArray> tmp662;
+    TNode<Map> tmp663;
+    TNode<BoolT> tmp664;
+    TNode<BoolT> tmp665;
+    TNode<BoolT> tmp666;
+    TNode<Object> tmp667;
+    TNode<Object> tmp668;
+    ca_.Bind(&block38, &tmp647, &tmp648, &tmp649, &tmp650, &tmp651, &tmp652, &tmp653, &tmp654, &tmp655, &tmp656, &tmp657, &tmp658, &tmp659, &tmp660, &tmp661, &tmp662, &tmp663, &tmp664, &tmp665, &tmp666, &tmp667, &tmp668);
+    ca_.Goto(&block36, tmp647, tmp648, tmp649, tmp650, tmp651, tmp652, tmp653, tmp654, tmp655, tmp656, tmp657, tmp658, tmp659, tmp660, tmp661, tmp662, tmp663, tmp664, tmp665, tmp666, tmp667, tmp668);
+  }
+
+  if (block39.is_used()) {
+    TNode<Context> tmp669;
+    TNode<JSArray> tmp670;
+    TNode<Smi> tmp671;
+    TNode<JSReceiver> tmp672;
+    TNode<Object> tmp673;
+    TNode<JSArray> tmp674;
+    TNode<Smi> tmp675;
+    TNode<Smi> tmp676;
+    TNode<JSArray> tmp677;
+    TNode<JSArray> tmp678;
+    TNode<Map> tmp679;
+    TNode<BoolT> tmp680;
+    TNode<BoolT> tmp681;
+    TNode<BoolT> tmp682;
+    TNode<JSArray> tmp683;
+    TNode<JSArray> tmp684;
+    TNode<Map> tmp685;
+    TNode<BoolT> tmp686;
+    TNode<BoolT> tmp687;
+    TNode<BoolT> tmp688;
+    TNode<Object> tmp689;
+    TNode<Object> tmp690;
+    ca_.Bind(&block39, &tmp669, &tmp670, &tmp671, &tmp672, &tmp673, &tmp674, &tmp675, &tmp676, &tmp677, &tmp678, &tmp679, &tmp680, &tmp681, &tmp682, &tmp683, &tmp684, &tmp685, &tmp686, &tmp687, &tmp688, &tmp689, &tmp690);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3313);
+    TNode<BoolT> tmp691;
+    USE(tmp691);
+    tmp691 = CodeStubAssembler(state_).IsNoElementsProtectorCellInvalid();
+    ca_.Branch(tmp691, &block40, &block41, tmp669, tmp670, tmp671, tmp672, tmp673, tmp674, tmp675, tmp676, tmp677, tmp678, tmp679, tmp680, tmp681, tmp682, tmp683, tmp684, tmp685, tmp686, tmp687, tmp688, tmp689, tmp690);
+  }
+
+  if (block40.is_used()) {
+    TNode<Context> tmp692;
+    TNode<JSArray> tmp693;
+    TNode<Smi> tmp694;
+    TNode<JSReceiver> tmp695;
+    TNode<Object> tmp696;
+    TNode<JSArray> tmp697;
+    TNode<Smi> tmp698;
+    TNode<Smi> tmp699;
+    TNode<JSArray> tmp700;
+    TNode<JSArray> tmp701;
+    TNode<Map> tmp702;
+    TNode<BoolT> tmp703;
+    TNode<BoolT> tmp704;
+    TNode<BoolT> tmp705;
+    TNode<JSArray> tmp706;
+    TNode<JSArray> tmp707;
+    TNode<Map> tmp708;
+    TNode<BoolT> tmp709;
+    TNode<BoolT> tmp710;
+    TNode<BoolT> tmp711;
+    TNode<Object> tmp712;
+    TNode<Object> tmp713;
+    ca_.Bind(&block40, &tmp692, &tmp693, &tmp694, &tmp695, &tmp696, &tmp697, &tmp698, &tmp699, &tmp700, &tmp701, &tmp702, &tmp703, &tmp704, &tmp705, &tmp706, &tmp707, &tmp708, &tmp709, &tmp710, &tmp711, &tmp712, &tmp713);
+    ca_.Goto(&block36, tmp692, tmp693, tmp694, tmp695, tmp696, tmp697, tmp698, tmp699, tmp700, tmp701, tmp702, tmp703, tmp704, tmp705, tmp706, tmp707, tmp708, tmp709, tmp710, tmp711, tmp712, tmp713);
+  }
+
+  if (block41.is_used()) {
+    TNode<Context> tmp714;
+    TNode<JSArray> tmp715;
+    TNode<Smi> tmp716;
+    TNode<JSReceiver> tmp717;
+    TNode<Object> tmp718;
+    TNode<JSArray> tmp719;
+    TNode<Smi> tmp720;
+    TNode<Smi> tmp721;
+    TNode<JSArray> tmp722;
+    TNode<JSArray> tmp723;
+    TNode<Map> tmp724;
+    TNode<BoolT> tmp725;
+    TNode<BoolT> tmp726;
+    TNode<BoolT> tmp727;
+    TNode<JSArray> tmp728;
+    TNode<JSArray> tmp729;
+    TNode<Map> tmp730;
+    TNode<BoolT> tmp731;
+    TNode<BoolT> tmp732;
+    TNode<BoolT> tmp733;
+    TNode<Object> tmp734;
+    TNode<Object> tmp735;
+    ca_.Bind(&block41, &tmp714, &tmp715, &tmp716, &tmp717, &tmp718, &tmp719, &tmp720, &tmp721, &tmp722, &tmp723, &tmp724, &tmp725, &tmp726, &tmp727, &tmp728, &tmp729, &tmp730, &tmp731, &tmp732, &tmp733, &tmp734, &tmp735);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3314);
+    TNode<JSArray> tmp736;
+    USE(tmp736);
+    tmp736 = (TNode<JSArray>{tmp728});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 122);
+    ca_.Goto(&block37, tmp714, tmp715, tmp716, tmp717, tmp718, tmp719, tmp720, tmp721, tmp722, tmp723, tmp724, tmp725, tmp726, tmp727, tmp728, tmp736, tmp730, tmp731, tmp732, tmp733, tmp734, tmp735);
+  }
+
+  if (block37.is_used()) {
+    TNode<Context> tmp737;
+    TNode<JSArray> tmp738;
+    TNode<Smi> tmp739;
+    TNode<JSReceiver> tmp740;
+    TNode<Object> tmp741;
+    TNode<JSArray> tmp742;
+    TNode<Smi> tmp743;
+    TNode<Smi> tmp744;
+    TNode<JSArray> tmp745;
+    TNode<JSArray> tmp746;
+    TNode<Map> tmp747;
+    TNode<BoolT> tmp748;
+    TNode<BoolT> tmp749;
+    TNode<BoolT> tmp750;
+    TNode<JSArray> tmp751;
+    TNode<JSArray> tmp752;
+    TNode<Map> tmp753;
+    TNode<BoolT> tmp754;
+    TNode<BoolT> tmp755;
+    TNode<BoolT> tmp756;
+    TNode<Object> tmp757;
+    TNode<Object> tmp758;
+    ca_.Bind(&block37, &tmp737, &tmp738, &tmp739, &tmp740, &tmp741, &tmp742, &tmp743, &tmp744, &tmp745, &tmp746, &tmp747, &tmp748, &tmp749, &tmp750, &tmp751, &tmp752, &tmp753, &tmp754, &tmp755, &tmp756, &tmp757, &tmp758);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3302);
+    ca_.Goto(&block44, tmp737, tmp738, tmp739, tmp740, tmp741, tmp742, tmp743, tmp744, tmp745, tmp746, tmp747, tmp748, tmp749, tmp750, tmp751, tmp752, tmp753, tmp754, tmp755, tmp756, tmp757, tmp758, tmp752);
+  }
+
+  if (block44.is_used()) {
+    TNode<Context> tmp759;
+    TNode<JSArray> tmp760;
+    TNode<Smi> tmp761;
+    TNode<JSReceiver> tmp762;
+    TNode<Object> tmp763;
+    TNode<JSArray> tmp764;
+    TNode<Smi> tmp765;
+    TNode<Smi> tmp766;
+    TNode<JSArray> tmp767;
+    TNode<JSArray> tmp768;
+    TNode<Map> tmp769;
+    TNode<BoolT> tmp770;
+    TNode<BoolT> tmp771;
+    TNode<BoolT> tmp772;
+    TNode<JSArray> tmp773;
+    TNode<JSArray> tmp774;
+    TNode<Map> tmp775;
+    TNode<BoolT> tmp776;
+    TNode<BoolT> tmp777;
+    TNode<BoolT> tmp778;
+    TNode<Object> tmp779;
+    TNode<Object> tmp780;
+    TNode<JSArray> tmp781;
+    ca_.Bind(&block44, &tmp759, &tmp760, &tmp761, &tmp762, &tmp763, &tmp764, &tmp765, &tmp766, &tmp767, &tmp768, &tmp769, &tmp770, &tmp771, &tmp772, &tmp773, &tmp774, &tmp775, &tmp776, &tmp777, &tmp778, &tmp779, &tmp780, &tmp781);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 123);
+    TNode<Smi> tmp782;
+    USE(tmp782);
+    tmp782 = CodeStubAssembler(state_).LoadFastJSArrayLength(TNode<JSArray>{tmp781});
+    TNode<BoolT> tmp783;
+    USE(tmp783);
+    tmp783 = CodeStubAssembler(state_).SmiNotEqual(TNode<Smi>{tmp782}, TNode<Smi>{tmp766});
+    ca_.Branch(tmp783, &block42, &block43, tmp759, tmp760, tmp761, tmp762, tmp763, tmp764, tmp765, tmp766, tmp767, tmp768, tmp769, tmp770, tmp771, tmp772, tmp773, tmp774, tmp775, tmp776, tmp777, tmp778, tmp779, tmp780);
+  }
+
+  if (block42.is_used()) {
+    TNode<Context> tmp784;
+    TNode<JSArray> tmp785;
+    TNode<Smi> tmp786;
+    TNode<JSReceiver> tmp787;
+    TNode<Object> tmp788;
+    TNode<JSArray> tmp789;
+    TNode<Smi> tmp790;
+    TNode<Smi> tmp791;
+    TNode<JSArray> tmp792;
+    TNode<JSArray> tmp793;
+    TNode<Map> tmp794;
+    TNode<BoolT> tmp795;
+    TNode<BoolT> tmp796;
+    TNode<BoolT> tmp797;
+    TNode<JSArray> tmp798;
+    TNode<JSArray> tmp799;
+    TNode<Map> tmp800;
+    TNode<BoolT> tmp801;
+    TNode<BoolT> tmp802;
+    TNode<BoolT> tmp803;
+    TNode<Object> tmp804;
+    TNode<Object> tmp805;
+    ca_.Bind(&block42, &tmp784, &tmp785, &tmp786, &tmp787, &tmp788, &tmp789, &tmp790, &tmp791, &tmp792, &tmp793, &tmp794, &tmp795, &tmp796, &tmp797, &tmp798, &tmp799, &tmp800, &tmp801, &tmp802, &tmp803, &tmp804, &tmp805);
+    ca_.Goto(&block36, tmp784, tmp785, tmp786, tmp787, tmp788, tmp789, tmp790, tmp791, tmp792, tmp793, tmp794, tmp795, tmp796, tmp797, tmp798, tmp799, tmp800, tmp801, tmp802, tmp803, tmp804, tmp805);
+  }
+
+  if (block43.is_used()) {
+    TNode<Context> tmp806;
+    TNode<JSArray> tmp807;
+    TNode<Smi> tmp808;
+    TNode<JSReceiver> tmp809;
+    TNode<Object> tmp810;
+    TNode<JSArray> tmp811;
+    TNode<Smi> tmp812;
+    TNode<Smi> tmp813;
+    TNode<JSArray> tmp814;
+    TNode<JSArray> tmp815;
+    TNode<Map> tmp816;
+    TNode<BoolT> tmp817;
+    TNode<BoolT> tmp818;
+    TNode<BoolT> tmp819;
+    TNode<JSArray> tmp820;
+    TNode<JSArray> tmp821;
+    TNode<Map> tmp822;
+    TNode<BoolT> tmp823;
+    TNode<BoolT> tmp824;
+    TNode<BoolT> tmp825;
+    TNode<Object> tmp826;
+    TNode<Object> tmp827;
+    ca_.Bind(&block43, &tmp806, &tmp807, &tmp808, &tmp809, &tmp810, &tmp811, &tmp812, &tmp813, &tmp814, &tmp815, &tmp816, &tmp817, &tmp818, &tmp819, &tmp820, &tmp821, &tmp822, &tmp823, &tmp824, &tmp825, &tmp826, &tmp827);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 124);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3361);
+    ca_.Goto(&block47, tmp806, tmp807, tmp808, tmp809, tmp810, tmp811, tmp812, tmp813, tmp814, tmp815, tmp816, tmp817, tmp818, tmp819, tmp820, tmp821, tmp822, tmp823, tmp824, tmp825, tmp826, tmp827, tmp826, tmp826);
+  }
+
+  if (block46.is_used()) {
+    TNode<Context> tmp828;
+    TNode<JSArray> tmp829;
+    TNode<Smi> tmp830;
+    TNode<JSReceiver> tmp831;
+    TNode<Object> tmp832;
+    TNode<JSArray> tmp833;
+    TNode<Smi> tmp834;
+    TNode<Smi> tmp835;
+    TNode<JSArray> tmp836;
+    TNode<JSArray> tmp837;
+    TNode<Map> tmp838;
+    TNode<BoolT> tmp839;
+    TNode<BoolT> tmp840;
+    TNode<BoolT> tmp841;
+    TNode<JSArray> tmp842;
+    TNode<JSArray> tmp843;
+    TNode<Map> tmp844;
+    TNode<BoolT> tmp845;
+    TNode<BoolT> tmp846;
+    TNode<BoolT> tmp847;
+    TNode<Object> tmp848;
+    TNode<Object> tmp849;
+    TNode<Object> tmp850;
+    TNode<Object> tmp851;
+    ca_.Bind(&block46, &tmp828, &tmp829, &tmp830, &tmp831, &tmp832, &tmp833, &tmp834, &tmp835, &tmp836, &tmp837, &tmp838, &tmp839, &tmp840, &tmp841, &tmp842, &tmp843, &tmp844, &tmp845, &tmp846, &tmp847, &tmp848, &tmp849, &tmp850, &tmp851);
+    ca_.Branch(tmp847, &block48, &block49, tmp828, tmp829, tmp830, tmp831, tmp832, tmp833, tmp834, tmp835, tmp836, tmp837, tmp838, tmp839, tmp840, tmp841, tmp842, tmp843, tmp844, tmp845, tmp846, tmp847, tmp848, tmp849, tmp850, tmp851);
+  }
+
+  if (block49.is_used()) {
+    TNode<Context> tmp852;
+    TNode<JSArray> tmp853;
+    TNode<Smi> tmp854;
+    TNode<JSReceiver> tmp855;
+    TNode<Object> tmp856;
+    TNode<JSArray> tmp857;
+    TNode<Smi> tmp858;
+    TNode<Smi> tmp859;
+    TNode<JSArray> tmp860;
+    TNode<JSArray> tmp861;
+    TNode<Map> tmp862;
+    TNode<BoolT> tmp863;
+    TNode<BoolT> tmp864;
+    TNode<BoolT> tmp865;
+    TNode<JSArray> tmp866;
+    TNode<JSArray> tmp867;
+    TNode<Map> tmp868;
+    TNode<BoolT> tmp869;
+    TNode<BoolT> tmp870;
+    TNode<BoolT> tmp871;
+    TNode<Object> tmp872;
+    TNode<Object> tmp873;
+    TNode<Object> tmp874;
+    TNode<Object> tmp875;
+    ca_.Bind(&block49, &tmp852, &tmp853, &tmp854, &tmp855, &tmp856, &tmp857, &tmp858, &tmp859, &tmp860, &tmp861, &tmp862, &tmp863, &tmp864, &tmp865, &tmp866, &tmp867, &tmp868, &tmp869, &tmp870, &tmp871, &tmp872, &tmp873, &tmp874, &tmp875);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'this.arrayIsPushable' failed", "../../deps/v8/src/builtins/base.tq", 3361);
+  }
+
+  if (block48.is_used()) {
+    TNode<Context> tmp876;
+    TNode<JSArray> tmp877;
+    TNode<Smi> tmp878;
+    TNode<JSReceiver> tmp879;
+    TNode<Object> tmp880;
+    TNode<JSArray> tmp881;
+    TNode<Smi> tmp882;
+    TNode<Smi> tmp883;
+    TNode<JSArray> tmp884;
+    TNode<JSArray> tmp885;
+    TNode<Map> tmp886;
+    TNode<BoolT> tmp887;
+    TNode<BoolT> tmp888;
+    TNode<BoolT> tmp889;
+    TNode<JSArray> tmp890;
+    TNode<JSArray> tmp891;
+    TNode<Map> tmp892;
+    TNode<BoolT> tmp893;
+    TNode<BoolT> tmp894;
+    TNode<BoolT> tmp895;
+    TNode<Object> tmp896;
+    TNode<Object> tmp897;
+    TNode<Object> tmp898;
+    TNode<Object> tmp899;
+    ca_.Bind(&block48, &tmp876, &tmp877, &tmp878, &tmp879, &tmp880, &tmp881, &tmp882, &tmp883, &tmp884, &tmp885, &tmp886, &tmp887, &tmp888, &tmp889, &tmp890, &tmp891, &tmp892, &tmp893, &tmp894, &tmp895, &tmp896, &tmp897, &tmp898, &tmp899);
+  }
+
+  if (block47.is_used()) {
+    TNode<Context> tmp900;
+    TNode<JSArray> tmp901;
+    TNode<Smi> tmp902;
+    TNode<JSReceiver> tmp903;
+    TNode<Object> tmp904;
+    TNode<JSArray> tmp905;
+    TNode<Smi> tmp906;
+    TNode<Smi> tmp907;
+    TNode<JSArray> tmp908;
+    TNode<JSArray> tmp909;
+    TNode<Map> tmp910;
+    TNode<BoolT> tmp911;
+    TNode<BoolT> tmp912;
+    TNode<BoolT> tmp913;
+    TNode<JSArray> tmp914;
+    TNode<JSArray> tmp915;
+    TNode<Map> tmp916;
+    TNode<BoolT> tmp917;
+    TNode<BoolT> tmp918;
+    TNode<BoolT> tmp919;
+    TNode<Object> tmp920;
+    TNode<Object> tmp921;
+    TNode<Object> tmp922;
+    TNode<Object> tmp923;
+    ca_.Bind(&block47, &tmp900, &tmp901, &tmp902, &tmp903, &tmp904, &tmp905, &tmp906, &tmp907, &tmp908, &tmp909, &tmp910, &tmp911, &tmp912, &tmp913, &tmp914, &tmp915, &tmp916, &tmp917, &tmp918, &tmp919, &tmp920, &tmp921, &tmp922, &tmp923);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3362);
+    ca_.Branch(tmp917, &block50, &block51, tmp900, tmp901, tmp902, tmp903, tmp904, tmp905, tmp906, tmp907, tmp908, tmp909, tmp910, tmp911, tmp912, tmp913, tmp914, tmp915, tmp916, tmp917, tmp918, tmp919, tmp920, tmp921, tmp922, tmp923);
+  }
+
+  if (block50.is_used()) {
+    TNode<Context> tmp924;
+    TNode<JSArray> tmp925;
+    TNode<Smi> tmp926;
+    TNode<JSReceiver> tmp927;
+    TNode<Object> tmp928;
+    TNode<JSArray> tmp929;
+    TNode<Smi> tmp930;
+    TNode<Smi> tmp931;
+    TNode<JSArray> tmp932;
+    TNode<JSArray> tmp933;
+    TNode<Map> tmp934;
+    TNode<BoolT> tmp935;
+    TNode<BoolT> tmp936;
+    TNode<BoolT> tmp937;
+    TNode<JSArray> tmp938;
+    TNode<JSArray> tmp939;
+    TNode<Map> tmp940;
+    TNode<BoolT> tmp941;
+    TNode<BoolT> tmp942;
+    TNode<BoolT> tmp943;
+    TNode<Object> tmp944;
+    TNode<Object> tmp945;
+    TNode<Object> tmp946;
+    TNode<Object> tmp947;
+    ca_.Bind(&block50, &tmp924, &tmp925, &tmp926, &tmp927, &tmp928, &tmp929, &tmp930, &tmp931, &tmp932, &tmp933, &tmp934, &tmp935, &tmp936, &tmp937, &tmp938, &tmp939, &tmp940, &tmp941, &tmp942, &tmp943, &tmp944, &tmp945, &tmp946, &tmp947);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3363);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    CodeStubAssembler(state_).BuildAppendJSArray(HOLEY_DOUBLE_ELEMENTS, TNode<JSArray>{tmp939}, TNode<Object>{tmp947}, &label0);
+    ca_.Goto(&block53, tmp924, tmp925, tmp926, tmp927, tmp928, tmp929, tmp930, tmp931, tmp932, tmp933, tmp934, tmp935, tmp936, tmp937, tmp938, tmp939, tmp940, tmp941, tmp942, tmp943, tmp944, tmp945, tmp946, tmp947, tmp939, tmp947);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block54, tmp924, tmp925, tmp926, tmp927, tmp928, tmp929, tmp930, tmp931, tmp932, tmp933, tmp934, tmp935, tmp936, tmp937, tmp938, tmp939, tmp940, tmp941, tmp942, tmp943, tmp944, tmp945, tmp946, tmp947, tmp939, tmp947);
+    }
+  }
+
+  if (block54.is_used()) {
+    TNode<Context> tmp948;
+    TNode<JSArray> tmp949;
+    TNode<Smi> tmp950;
+    TNode<JSReceiver> tmp951;
+    TNode<Object> tmp952;
+    TNode<JSArray> tmp953;
+    TNode<Smi> tmp954;
+    TNode<Smi> tmp955;
+    TNode<JSArray> tmp956;
+    TNode<JSArray> tmp957;
+    TNode<Map> tmp958;
+    TNode<BoolT> tmp959;
+    TNode<BoolT> tmp960;
+    TNode<BoolT> tmp961;
+    TNode<JSArray> tmp962;
+    TNode<JSArray> tmp963;
+    TNode<Map> tmp964;
+    TNode<BoolT> tmp965;
+    TNode<BoolT> tmp966;
+    TNode<BoolT> tmp967;
+    TNode<Object> tmp968;
+    TNode<Object> tmp969;
+    TNode<Object> tmp970;
+    TNode<Object> tmp971;
+    TNode<JSArray> tmp972;
+    TNode<Object> tmp973;
+    ca_.Bind(&block54, &tmp948, &tmp949, &tmp950, &tmp951, &tmp952, &tmp953, &tmp954, &tmp955, &tmp956, &tmp957, &tmp958, &tmp959, &tmp960, &tmp961, &tmp962, &tmp963, &tmp964, &tmp965, &tmp966, &tmp967, &tmp968, &tmp969, &tmp970, &tmp971, &tmp972, &tmp973);
+    ca_.Goto(&block36, tmp948, tmp949, tmp950, tmp951, tmp952, tmp953, tmp954, tmp955, tmp956, tmp957, tmp958, tmp959, tmp960, tmp961, tmp962, tmp963, tmp964, tmp965, tmp966, tmp967, tmp968, tmp969);
+  }
+
+  if (block53.is_used()) {
+    TNode<Context> tmp974;
+    TNode<JSArray> tmp975;
+    TNode<Smi> tmp976;
+    TNode<JSReceiver> tmp977;
+    TNode<Object> tmp978;
+    TNode<JSArray> tmp979;
+    TNode<Smi> tmp980;
+    TNode<Smi> tmp981;
+    TNode<JSArray> tmp982;
+    TNode<JSArray> tmp983;
+    TNode<Map> tmp984;
+    TNode<BoolT> tmp985;
+    TNode<BoolT> tmp986;
+    TNode<BoolT> tmp987;
+    TNode<JSArray> tmp988;
+    TNode<JSArray> tmp989;
+    TNode<Map> tmp990;
+    TNode<BoolT> tmp991;
+    TNode<BoolT> tmp992;
+    TNode<BoolT> tmp993;
+    TNode<Object> tmp994;
+    TNode<Object> tmp995;
+    TNode<Object> tmp996;
+    TNode<Object> tmp997;
+    TNode<JSArray> tmp998;
+    TNode<Object> tmp999;
+    ca_.Bind(&block53, &tmp974, &tmp975, &tmp976, &tmp977, &tmp978, &tmp979, &tmp980, &tmp981, &tmp982, &tmp983, &tmp984, &tmp985, &tmp986, &tmp987, &tmp988, &tmp989, &tmp990, &tmp991, &tmp992, &tmp993, &tmp994, &tmp995, &tmp996, &tmp997, &tmp998, &tmp999);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3362);
+    ca_.Goto(&block52, tmp974, tmp975, tmp976, tmp977, tmp978, tmp979, tmp980, tmp981, tmp982, tmp983, tmp984, tmp985, tmp986, tmp987, tmp988, tmp989, tmp990, tmp991, tmp992, tmp993, tmp994, tmp995, tmp996, tmp997);
+  }
+
+  if (block51.is_used()) {
+    TNode<Context> tmp1000;
+    TNode<JSArray> tmp1001;
+    TNode<Smi> tmp1002;
+    TNode<JSReceiver> tmp1003;
+    TNode<Object> tmp1004;
+    TNode<JSArray> tmp1005;
+    TNode<Smi> tmp1006;
+    TNode<Smi> tmp1007;
+    TNode<JSArray> tmp1008;
+    TNode<JSArray> tmp1009;
+    TNode<Map> tmp1010;
+    TNode<BoolT> tmp1011;
+    TNode<BoolT> tmp1012;
+    TNode<BoolT> tmp1013;
+    TNode<JSArray> tmp1014;
+    TNode<JSArray> tmp1015;
+    TNode<Map> tmp1016;
+    TNode<BoolT> tmp1017;
+    TNode<BoolT> tmp1018;
+    TNode<BoolT> tmp1019;
+    TNode<Object> tmp1020;
+    TNode<Object> tmp1021;
+    TNode<Object> tmp1022;
+    TNode<Object> tmp1023;
+    ca_.Bind(&block51, &tmp1000, &tmp1001, &tmp1002, &tmp1003, &tmp1004, &tmp1005, &tmp1006, &tmp1007, &tmp1008, &tmp1009, &tmp1010, &tmp1011, &tmp1012, &tmp1013, &tmp1014, &tmp1015, &tmp1016, &tmp1017, &tmp1018, &tmp1019, &tmp1020, &tmp1021, &tmp1022, &tmp1023);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3365);
+    ca_.Branch(tmp1018, &block55, &block56, tmp1000, tmp1001, tmp1002, tmp1003, tmp1004, tmp1005, tmp1006, tmp1007, tmp1008, tmp1009, tmp1010, tmp1011, tmp1012, tmp1013, tmp1014, tmp1015, tmp1016, tmp1017, tmp1018, tmp1019, tmp1020, tmp1021, tmp1022, tmp1023);
+  }
+
+  if (block55.is_used()) {
+    TNode<Context> tmp1024;
+    TNode<JSArray> tmp1025;
+    TNode<Smi> tmp1026;
+    TNode<JSReceiver> tmp1027;
+    TNode<Object> tmp1028;
+    TNode<JSArray> tmp1029;
+    TNode<Smi> tmp1030;
+    TNode<Smi> tmp1031;
+    TNode<JSArray> tmp1032;
+    TNode<JSArray> tmp1033;
+    TNode<Map> tmp1034;
+    TNode<BoolT> tmp1035;
+    TNode<BoolT> tmp1036;
+    TNode<BoolT> tmp1037;
+    TNode<JSArray> tmp1038;
+    TNode<JSArray> tmp1039;
+    TNode<Map> tmp1040;
+    TNode<BoolT> tmp1041;
+    TNode<BoolT> tmp1042;
+    TNode<BoolT> tmp1043;
+    TNode<Object> tmp1044;
+    TNode<Object> tmp1045;
+    TNode<Object> tmp1046;
+    TNode<Object> tmp1047;
+    ca_.Bind(&block55, &tmp1024, &tmp1025, &tmp1026, &tmp1027, &tmp1028, &tmp1029, &tmp1030, &tmp1031, &tmp1032, &tmp1033, &tmp1034, &tmp1035, &tmp1036, &tmp1037, &tmp1038, &tmp1039, &tmp1040, &tmp1041, &tmp1042, &tmp1043, &tmp1044, &tmp1045, &tmp1046, &tmp1047);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3366);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    CodeStubAssembler(state_).BuildAppendJSArray(HOLEY_SMI_ELEMENTS, TNode<JSArray>{tmp1039}, TNode<Object>{tmp1047}, &label0);
+    ca_.Goto(&block58, tmp1024, tmp1025, tmp1026, tmp1027, tmp1028, tmp1029, tmp1030, tmp1031, tmp1032, tmp1033, tmp1034, tmp1035, tmp1036, tmp1037, tmp1038, tmp1039, tmp1040, tmp1041, tmp1042, tmp1043, tmp1044, tmp1045, tmp1046, tmp1047, tmp1039, tmp1047);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block59, tmp1024, tmp1025, tmp1026, tmp1027, tmp1028, tmp1029, tmp1030, tmp1031, tmp1032, tmp1033, tmp1034, tmp1035, tmp1036, tmp1037, tmp1038, tmp1039, tmp1040, tmp1041, tmp1042, tmp1043, tmp1044, tmp1045, tmp1046, tmp1047, tmp1039, tmp1047);
+    }
+  }
+
+  if (block59.is_used()) {
+    TNode<Context> tmp1048;
+    TNode<JSArray> tmp1049;
+    TNode<Smi> tmp1050;
+    TNode<JSReceiver> tmp1051;
+    TNode<Object> tmp1052;
+    TNode<JSArray> tmp1053;
+    TNode<Smi> tmp1054;
+    TNode<Smi> tmp1055;
+    TNode<JSArray> tmp1056;
+    TNode<JSArray> tmp1057;
+    TNode<Map> tmp1058;
+    TNode<BoolT> tmp1059;
+    TNode<BoolT> tmp1060;
+    TNode<BoolT> tmp1061;
+    TNode<JSArray> tmp1062;
+    TNode<JSArray> tmp1063;
+    TNode<Map> tmp1064;
+    TNode<BoolT> tmp1065;
+    TNode<BoolT> tmp1066;
+    TNode<BoolT> tmp1067;
+    TNode<Object> tmp1068;
+    TNode<Object> tmp1069;
+    TNode<Object> tmp1070;
+    TNode<Object> tmp1071;
+    TNode<JSArray> tmp1072;
+    TNode<Object> tmp1073;
+    ca_.Bind(&block59, &tmp1048, &tmp1049, &tmp1050, &tmp1051, &tmp1052, &tmp1053, &tmp1054, &tmp1055, &tmp1056, &tmp1057, &tmp1058, &tmp1059, &tmp1060, &tmp1061, &tmp1062, &tmp1063, &tmp1064, &tmp1065, &tmp1066, &tmp1067, &tmp1068, &tmp1069, &tmp1070, &tmp1071, &tmp1072, &tmp1073);
+    ca_.Goto(&block36, tmp1048, tmp1049, tmp1050, tmp1051, tmp1052, tmp1053, tmp1054, tmp1055, tmp1056, tmp1057, tmp1058, tmp1059, tmp1060, tmp1061, tmp1062, tmp1063, tmp1064, tmp1065, tmp1066, tmp1067, tmp1068, tmp1069);
+  }
+
+  if (block58.is_used()) {
+    TNode<Context> tmp1074;
+    TNode<JSArray> tmp1075;
+    TNode<Smi> tmp1076;
+    TNode<JSReceiver> tmp1077;
+    TNode<Object> tmp1078;
+    TNode<JSArray> tmp1079;
+    TNode<Smi> tmp1080;
+    TNode<Smi> tmp1081;
+    TNode<JSArray> tmp1082;
+    TNode<JSArray> tmp1083;
+    TNode<Map> tmp1084;
+    TNode<BoolT> tmp1085;
+    TNode<BoolT> tmp1086;
+    TNode<BoolT> tmp1087;
+    TNode<JSArray> tmp1088;
+    TNode<JSArray> tmp1089;
+    TNode<Map> tmp1090;
+    TNode<BoolT> tmp1091;
+    TNode<BoolT> tmp1092;
+    TNode<BoolT> tmp1093;
+    TNode<Object> tmp1094;
+    TNode<Object> tmp1095;
+    TNode<Object> tmp1096;
+    TNode<Object> tmp1097;
+    TNode<JSArray> tmp1098;
+    TNode<Object> tmp1099;
+    ca_.Bind(&block58, &tmp1074, &tmp1075, &tmp1076, &tmp1077, &tmp1078, &tmp1079, &tmp1080, &tmp1081, &tmp1082, &tmp1083, &tmp1084, &tmp1085, &tmp1086, &tmp1087, &tmp1088, &tmp1089, &tmp1090, &tmp1091, &tmp1092, &tmp1093, &tmp1094, &tmp1095, &tmp1096, &tmp1097, &tmp1098, &tmp1099);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3365);
+    ca_.Goto(&block57, tmp1074, tmp1075, tmp1076, tmp1077, tmp1078, tmp1079, tmp1080, tmp1081, tmp1082, tmp1083, tmp1084, tmp1085, tmp1086, tmp1087, tmp1088, tmp1089, tmp1090, tmp1091, tmp1092, tmp1093, tmp1094, tmp1095, tmp1096, tmp1097);
+  }
+
+  if (block56.is_used()) {
+    TNode<Context> tmp1100;
+    TNode<JSArray> tmp1101;
+    TNode<Smi> tmp1102;
+    TNode<JSReceiver> tmp1103;
+    TNode<Object> tmp1104;
+    TNode<JSArray> tmp1105;
+    TNode<Smi> tmp1106;
+    TNode<Smi> tmp1107;
+    TNode<JSArray> tmp1108;
+    TNode<JSArray> tmp1109;
+    TNode<Map> tmp1110;
+    TNode<BoolT> tmp1111;
+    TNode<BoolT> tmp1112;
+    TNode<BoolT> tmp1113;
+    TNode<JSArray> tmp1114;
+    TNode<JSArray> tmp1115;
+    TNode<Map> tmp1116;
+    TNode<BoolT> tmp1117;
+    TNode<BoolT> tmp1118;
+    TNode<BoolT> tmp1119;
+    TNode<Object> tmp1120;
+    TNode<Object> tmp1121;
+    TNode<Object> tmp1122;
+    TNode<Object> tmp1123;
+    ca_.Bind(&block56, &tmp1100, &tmp1101, &tmp1102, &tmp1103, &tmp1104, &tmp1105, &tmp1106, &tmp1107, &tmp1108, &tmp1109, &tmp1110, &tmp1111, &tmp1112, &tmp1113, &tmp1114, &tmp1115, &tmp1116, &tmp1117, &tmp1118, &tmp1119, &tmp1120, &tmp1121, &tmp1122, &tmp1123);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3369);
+    ca_.Goto(&block61, tmp1100, tmp1101, tmp1102, tmp1103, tmp1104, tmp1105, tmp1106, tmp1107, tmp1108, tmp1109, tmp1110, tmp1111, tmp1112, tmp1113, tmp1114, tmp1115, tmp1116, tmp1117, tmp1118, tmp1119, tmp1120, tmp1121, tmp1122, tmp1123);
+  }
+
+  if (block60.is_used()) {
+    TNode<Context> tmp1124;
+    TNode<JSArray> tmp1125;
+    TNode<Smi> tmp1126;
+    TNode<JSReceiver> tmp1127;
+    TNode<Object> tmp1128;
+    TNode<JSArray> tmp1129;
+    TNode<Smi> tmp1130;
+    TNode<Smi> tmp1131;
+    TNode<JSArray> tmp1132;
+    TNode<JSArray> tmp1133;
+    TNode<Map> tmp1134;
+    TNode<BoolT> tmp1135;
+    TNode<BoolT> tmp1136;
+    TNode<BoolT> tmp1137;
+    TNode<JSArray> tmp1138;
+    TNode<JSArray> tmp1139;
+    TNode<Map> tmp1140;
+    TNode<BoolT> tmp1141;
+    TNode<BoolT> tmp1142;
+    TNode<BoolT> tmp1143;
+    TNode<Object> tmp1144;
+    TNode<Object> tmp1145;
+    TNode<Object> tmp1146;
+    TNode<Object> tmp1147;
+    ca_.Bind(&block60, &tmp1124, &tmp1125, &tmp1126, &tmp1127, &tmp1128, &tmp1129, &tmp1130, &tmp1131, &tmp1132, &tmp1133, &tmp1134, &tmp1135, &tmp1136, &tmp1137, &tmp1138, &tmp1139, &tmp1140, &tmp1141, &tmp1142, &tmp1143, &tmp1144, &tmp1145, &tmp1146, &tmp1147);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3370);
+    TNode<Int32T> tmp1148;
+    USE(tmp1148);
+    tmp1148 = CodeStubAssembler(state_).LoadMapElementsKind(TNode<Map>{tmp1140});
+    TNode<Int32T> tmp1149;
+    USE(tmp1149);
+    tmp1149 = FromConstexpr14ATElementsKind24ATconstexpr_ElementsKind_170(state_, HOLEY_ELEMENTS);
+    TNode<BoolT> tmp1150;
+    USE(tmp1150);
+    tmp1150 = CodeStubAssembler(state_).ElementsKindEqual(TNode<Int32T>{tmp1148}, TNode<Int32T>{tmp1149});
+    ca_.Branch(tmp1150, &block64, &block65, tmp1124, tmp1125, tmp1126, tmp1127, tmp1128, tmp1129, tmp1130, tmp1131, tmp1132, tmp1133, tmp1134, tmp1135, tmp1136, tmp1137, tmp1138, tmp1139, tmp1140, tmp1141, tmp1142, tmp1143, tmp1144, tmp1145, tmp1146, tmp1147, tmp1150);
+  }
+
+  if (block64.is_used()) {
+    TNode<Context> tmp1151;
+    TNode<JSArray> tmp1152;
+    TNode<Smi> tmp1153;
+    TNode<JSReceiver> tmp1154;
+    TNode<Object> tmp1155;
+    TNode<JSArray> tmp1156;
+    TNode<Smi> tmp1157;
+    TNode<Smi> tmp1158;
+    TNode<JSArray> tmp1159;
+    TNode<JSArray> tmp1160;
+    TNode<Map> tmp1161;
+    TNode<BoolT> tmp1162;
+    TNode<BoolT> tmp1163;
+    TNode<BoolT> tmp1164;
+    TNode<JSArray> tmp1165;
+    TNode<JSArray> tmp1166;
+    TNode<Map> tmp1167;
+    TNode<BoolT> tmp1168;
+    TNode<BoolT> tmp1169;
+    TNode<BoolT> tmp1170;
+    TNode<Object> tmp1171;
+    TNode<Object> tmp1172;
+    TNode<Object> tmp1173;
+    TNode<Object> tmp1174;
+    TNode<BoolT> tmp1175;
+    ca_.Bind(&block64, &tmp1151, &tmp1152, &tmp1153, &tmp1154, &tmp1155, &tmp1156, &tmp1157, &tmp1158, &tmp1159, &tmp1160, &tmp1161, &tmp1162, &tmp1163, &tmp1164, &tmp1165, &tmp1166, &tmp1167, &tmp1168, &tmp1169, &tmp1170, &tmp1171, &tmp1172, &tmp1173, &tmp1174, &tmp1175);
+    TNode<BoolT> tmp1176;
+    USE(tmp1176);
+    tmp1176 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, true);
+    ca_.Goto(&block66, tmp1151, tmp1152, tmp1153, tmp1154, tmp1155, tmp1156, tmp1157, tmp1158, tmp1159, tmp1160, tmp1161, tmp1162, tmp1163, tmp1164, tmp1165, tmp1166, tmp1167, tmp1168, tmp1169, tmp1170, tmp1171, tmp1172, tmp1173, tmp1174, tmp1175, tmp1176);
+  }
+
+  if (block65.is_used()) {
+    TNode<Context> tmp1177;
+    TNode<JSArray> tmp1178;
+    TNode<Smi> tmp1179;
+    TNode<JSReceiver> tmp1180;
+    TNode<Object> tmp1181;
+    TNode<JSArray> tmp1182;
+    TNode<Smi> tmp1183;
+    TNode<Smi> tmp1184;
+    TNode<JSArray> tmp1185;
+    TNode<JSArray> tmp1186;
+    TNode<Map> tmp1187;
+    TNode<BoolT> tmp1188;
+    TNode<BoolT> tmp1189;
+    TNode<BoolT> tmp1190;
+    TNode<JSArray> tmp1191;
+    TNode<JSArray> tmp1192;
+    TNode<Map> tmp1193;
+    TNode<BoolT> tmp1194;
+    TNode<BoolT> tmp1195;
+    TNode<BoolT> tmp1196;
+    TNode<Object> tmp1197;
+    TNode<Object> tmp1198;
+    TNode<Object> tmp1199;
+    TNode<Object> tmp1200;
+    TNode<BoolT> tmp1201;
+    ca_.Bind(&block65, &tmp1177, &tmp1178, &tmp1179, &tmp1180, &tmp1181, &tmp1182, &tmp1183, &tmp1184, &tmp1185, &tmp1186, &tmp1187, &tmp1188, &tmp1189, &tmp1190, &tmp1191, &tmp1192, &tmp1193, &tmp1194, &tmp1195, &tmp1196, &tmp1197, &tmp1198, &tmp1199, &tmp1200, &tmp1201);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3371);
+    TNode<Int32T> tmp1202;
+    USE(tmp1202);
+    tmp1202 = CodeStubAssembler(state_).LoadMapElementsKind(TNode<Map>{tmp1193});
+    TNode<Int32T> tmp1203;
+    USE(tmp1203);
+    tmp1203 = FromConstexpr14ATElementsKind24ATconstexpr_ElementsKind_170(state_, PACKED_ELEMENTS);
+    TNode<BoolT> tmp1204;
+    USE(tmp1204);
+    tmp1204 = CodeStubAssembler(state_).ElementsKindEqual(TNode<Int32T>{tmp1202}, TNode<Int32T>{tmp1203});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3370);
+    ca_.Goto(&block66, tmp1177, tmp1178, tmp1179, tmp1180, tmp1181, tmp1182, tmp1183, tmp1184, tmp1185, tmp1186, tmp1187, tmp1188, tmp1189, tmp1190, tmp1191, tmp1192, tmp1193, tmp1194, tmp1195, tmp1196, tmp1197, tmp1198, tmp1199, tmp1200, tmp1201, tmp1204);
+  }
+
+  if (block66.is_used()) {
+    TNode<Context> tmp1205;
+    TNode<JSArray> tmp1206;
+    TNode<Smi> tmp1207;
+    TNode<JSReceiver> tmp1208;
+    TNode<Object> tmp1209;
+    TNode<JSArray> tmp1210;
+    TNode<Smi> tmp1211;
+    TNode<Smi> tmp1212;
+    TNode<JSArray> tmp1213;
+    TNode<JSArray> tmp1214;
+    TNode<Map> tmp1215;
+    TNode<BoolT> tmp1216;
+    TNode<BoolT> tmp1217;
+    TNode<BoolT> tmp1218;
+    TNode<JSArray> tmp1219;
+    TNode<JSArray> tmp1220;
+    TNode<Map> tmp1221;
+    TNode<BoolT> tmp1222;
+    TNode<BoolT> tmp1223;
+    TNode<BoolT> tmp1224;
+    TNode<Object> tmp1225;
+    TNode<Object> tmp1226;
+    TNode<Object> tmp1227;
+    TNode<Object> tmp1228;
+    TNode<BoolT> tmp1229;
+    TNode<BoolT> tmp1230;
+    ca_.Bind(&block66, &tmp1205, &tmp1206, &tmp1207, &tmp1208, &tmp1209, &tmp1210, &tmp1211, &tmp1212, &tmp1213, &tmp1214, &tmp1215, &tmp1216, &tmp1217, &tmp1218, &tmp1219, &tmp1220, &tmp1221, &tmp1222, &tmp1223, &tmp1224, &tmp1225, &tmp1226, &tmp1227, &tmp1228, &tmp1229, &tmp1230);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3369);
+    ca_.Branch(tmp1230, &block62, &block63, tmp1205, tmp1206, tmp1207, tmp1208, tmp1209, tmp1210, tmp1211, tmp1212, tmp1213, tmp1214, tmp1215, tmp1216, tmp1217, tmp1218, tmp1219, tmp1220, tmp1221, tmp1222, tmp1223, tmp1224, tmp1225, tmp1226, tmp1227, tmp1228);
+  }
+
+  if (block63.is_used()) {
+    TNode<Context> tmp1231;
+    TNode<JSArray> tmp1232;
+    TNode<Smi> tmp1233;
+    TNode<JSReceiver> tmp1234;
+    TNode<Object> tmp1235;
+    TNode<JSArray> tmp1236;
+    TNode<Smi> tmp1237;
+    TNode<Smi> tmp1238;
+    TNode<JSArray> tmp1239;
+    TNode<JSArray> tmp1240;
+    TNode<Map> tmp1241;
+    TNode<BoolT> tmp1242;
+    TNode<BoolT> tmp1243;
+    TNode<BoolT> tmp1244;
+    TNode<JSArray> tmp1245;
+    TNode<JSArray> tmp1246;
+    TNode<Map> tmp1247;
+    TNode<BoolT> tmp1248;
+    TNode<BoolT> tmp1249;
+    TNode<BoolT> tmp1250;
+    TNode<Object> tmp1251;
+    TNode<Object> tmp1252;
+    TNode<Object> tmp1253;
+    TNode<Object> tmp1254;
+    ca_.Bind(&block63, &tmp1231, &tmp1232, &tmp1233, &tmp1234, &tmp1235, &tmp1236, &tmp1237, &tmp1238, &tmp1239, &tmp1240, &tmp1241, &tmp1242, &tmp1243, &tmp1244, &tmp1245, &tmp1246, &tmp1247, &tmp1248, &tmp1249, &tmp1250, &tmp1251, &tmp1252, &tmp1253, &tmp1254);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'this.map.elements_kind == HOLEY_ELEMENTS || this.map.elements_kind == PACKED_ELEMENTS' failed", "../../deps/v8/src/builtins/base.tq", 3369);
+  }
+
+  if (block62.is_used()) {
+    TNode<Context> tmp1255;
+    TNode<JSArray> tmp1256;
+    TNode<Smi> tmp1257;
+    TNode<JSReceiver> tmp1258;
+    TNode<Object> tmp1259;
+    TNode<JSArray> tmp1260;
+    TNode<Smi> tmp1261;
+    TNode<Smi> tmp1262;
+    TNode<JSArray> tmp1263;
+    TNode<JSArray> tmp1264;
+    TNode<Map> tmp1265;
+    TNode<BoolT> tmp1266;
+    TNode<BoolT> tmp1267;
+    TNode<BoolT> tmp1268;
+    TNode<JSArray> tmp1269;
+    TNode<JSArray> tmp1270;
+    TNode<Map> tmp1271;
+    TNode<BoolT> tmp1272;
+    TNode<BoolT> tmp1273;
+    TNode<BoolT> tmp1274;
+    TNode<Object> tmp1275;
+    TNode<Object> tmp1276;
+    TNode<Object> tmp1277;
+    TNode<Object> tmp1278;
+    ca_.Bind(&block62, &tmp1255, &tmp1256, &tmp1257, &tmp1258, &tmp1259, &tmp1260, &tmp1261, &tmp1262, &tmp1263, &tmp1264, &tmp1265, &tmp1266, &tmp1267, &tmp1268, &tmp1269, &tmp1270, &tmp1271, &tmp1272, &tmp1273, &tmp1274, &tmp1275, &tmp1276, &tmp1277, &tmp1278);
+  }
+
+  if (block61.is_used()) {
+    TNode<Context> tmp1279;
+    TNode<JSArray> tmp1280;
+    TNode<Smi> tmp1281;
+    TNode<JSReceiver> tmp1282;
+    TNode<Object> tmp1283;
+    TNode<JSArray> tmp1284;
+    TNode<Smi> tmp1285;
+    TNode<Smi> tmp1286;
+    TNode<JSArray> tmp1287;
+    TNode<JSArray> tmp1288;
+    TNode<Map> tmp1289;
+    TNode<BoolT> tmp1290;
+    TNode<BoolT> tmp1291;
+    TNode<BoolT> tmp1292;
+    TNode<JSArray> tmp1293;
+    TNode<JSArray> tmp1294;
+    TNode<Map> tmp1295;
+    TNode<BoolT> tmp1296;
+    TNode<BoolT> tmp1297;
+    TNode<BoolT> tmp1298;
+    TNode<Object> tmp1299;
+    TNode<Object> tmp1300;
+    TNode<Object> tmp1301;
+    TNode<Object> tmp1302;
+    ca_.Bind(&block61, &tmp1279, &tmp1280, &tmp1281, &tmp1282, &tmp1283, &tmp1284, &tmp1285, &tmp1286, &tmp1287, &tmp1288, &tmp1289, &tmp1290, &tmp1291, &tmp1292, &tmp1293, &tmp1294, &tmp1295, &tmp1296, &tmp1297, &tmp1298, &tmp1299, &tmp1300, &tmp1301, &tmp1302);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3372);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    CodeStubAssembler(state_).BuildAppendJSArray(HOLEY_ELEMENTS, TNode<JSArray>{tmp1294}, TNode<Object>{tmp1302}, &label0);
+    ca_.Goto(&block67, tmp1279, tmp1280, tmp1281, tmp1282, tmp1283, tmp1284, tmp1285, tmp1286, tmp1287, tmp1288, tmp1289, tmp1290, tmp1291, tmp1292, tmp1293, tmp1294, tmp1295, tmp1296, tmp1297, tmp1298, tmp1299, tmp1300, tmp1301, tmp1302, tmp1294, tmp1302);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block68, tmp1279, tmp1280, tmp1281, tmp1282, tmp1283, tmp1284, tmp1285, tmp1286, tmp1287, tmp1288, tmp1289, tmp1290, tmp1291, tmp1292, tmp1293, tmp1294, tmp1295, tmp1296, tmp1297, tmp1298, tmp1299, tmp1300, tmp1301, tmp1302, tmp1294, tmp1302);
+    }
+  }
+
+  if (block68.is_used()) {
+    TNode<Context> tmp1303;
+    TNode<JSArray> tmp1304;
+    TNode<Smi> tmp1305;
+    TNode<JSReceiver> tmp1306;
+    TNode<Object> tmp1307;
+    TNode<JSArray> tmp1308;
+    TNode<Smi> tmp1309;
+    TNode<Smi> tmp1310;
+    TNode<JSArray> tmp1311;
+    TNode<JSArray> tmp1312;
+    TNode<Map> tmp1313;
+    TNode<BoolT> tmp1314;
+    TNode<BoolT> tmp1315;
+    TNode<BoolT> tmp1316;
+    TNode<JSArray> tmp1317;
+    TNode<JSArray> tmp1318;
+    TNode<Map> tmp1319;
+    TNode<BoolT> tmp1320;
+    TNode<BoolT> tmp1321;
+    TNode<BoolT> tmp1322;
+    TNode<Object> tmp1323;
+    TNode<Object> tmp1324;
+    TNode<Object> tmp1325;
+    TNode<Object> tmp1326;
+    TNode<JSArray> tmp1327;
+    TNode<Object> tmp1328;
+    ca_.Bind(&block68, &tmp1303, &tmp1304, &tmp1305, &tmp1306, &tmp1307, &tmp1308, &tmp1309, &tmp1310, &tmp1311, &tmp1312, &tmp1313, &tmp1314, &tmp1315, &tmp1316, &tmp1317, &tmp1318, &tmp1319, &tmp1320, &tmp1321, &tmp1322, &tmp1323, &tmp1324, &tmp1325, &tmp1326, &tmp1327, &tmp1328);
+    ca_.Goto(&block36, tmp1303, tmp1304, tmp1305, tmp1306, tmp1307, tmp1308, tmp1309, tmp1310, tmp1311, tmp1312, tmp1313, tmp1314, tmp1315, tmp1316, tmp1317, tmp1318, tmp1319, tmp1320, tmp1321, tmp1322, tmp1323, tmp1324);
+  }
+
+  if (block67.is_used()) {
+    TNode<Context> tmp1329;
+    TNode<JSArray> tmp1330;
+    TNode<Smi> tmp1331;
+    TNode<JSReceiver> tmp1332;
+    TNode<Object> tmp1333;
+    TNode<JSArray> tmp1334;
+    TNode<Smi> tmp1335;
+    TNode<Smi> tmp1336;
+    TNode<JSArray> tmp1337;
+    TNode<JSArray> tmp1338;
+    TNode<Map> tmp1339;
+    TNode<BoolT> tmp1340;
+    TNode<BoolT> tmp1341;
+    TNode<BoolT> tmp1342;
+    TNode<JSArray> tmp1343;
+    TNode<JSArray> tmp1344;
+    TNode<Map> tmp1345;
+    TNode<BoolT> tmp1346;
+    TNode<BoolT> tmp1347;
+    TNode<BoolT> tmp1348;
+    TNode<Object> tmp1349;
+    TNode<Object> tmp1350;
+    TNode<Object> tmp1351;
+    TNode<Object> tmp1352;
+    TNode<JSArray> tmp1353;
+    TNode<Object> tmp1354;
+    ca_.Bind(&block67, &tmp1329, &tmp1330, &tmp1331, &tmp1332, &tmp1333, &tmp1334, &tmp1335, &tmp1336, &tmp1337, &tmp1338, &tmp1339, &tmp1340, &tmp1341, &tmp1342, &tmp1343, &tmp1344, &tmp1345, &tmp1346, &tmp1347, &tmp1348, &tmp1349, &tmp1350, &tmp1351, &tmp1352, &tmp1353, &tmp1354);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3365);
+    ca_.Goto(&block57, tmp1329, tmp1330, tmp1331, tmp1332, tmp1333, tmp1334, tmp1335, tmp1336, tmp1337, tmp1338, tmp1339, tmp1340, tmp1341, tmp1342, tmp1343, tmp1344, tmp1345, tmp1346, tmp1347, tmp1348, tmp1349, tmp1350, tmp1351, tmp1352);
+  }
+
+  if (block57.is_used()) {
+    TNode<Context> tmp1355;
+    TNode<JSArray> tmp1356;
+    TNode<Smi> tmp1357;
+    TNode<JSReceiver> tmp1358;
+    TNode<Object> tmp1359;
+    TNode<JSArray> tmp1360;
+    TNode<Smi> tmp1361;
+    TNode<Smi> tmp1362;
+    TNode<JSArray> tmp1363;
+    TNode<JSArray> tmp1364;
+    TNode<Map> tmp1365;
+    TNode<BoolT> tmp1366;
+    TNode<BoolT> tmp1367;
+    TNode<BoolT> tmp1368;
+    TNode<JSArray> tmp1369;
+    TNode<JSArray> tmp1370;
+    TNode<Map> tmp1371;
+    TNode<BoolT> tmp1372;
+    TNode<BoolT> tmp1373;
+    TNode<BoolT> tmp1374;
+    TNode<Object> tmp1375;
+    TNode<Object> tmp1376;
+    TNode<Object> tmp1377;
+    TNode<Object> tmp1378;
+    ca_.Bind(&block57, &tmp1355, &tmp1356, &tmp1357, &tmp1358, &tmp1359, &tmp1360, &tmp1361, &tmp1362, &tmp1363, &tmp1364, &tmp1365, &tmp1366, &tmp1367, &tmp1368, &tmp1369, &tmp1370, &tmp1371, &tmp1372, &tmp1373, &tmp1374, &tmp1375, &tmp1376, &tmp1377, &tmp1378);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3362);
+    ca_.Goto(&block52, tmp1355, tmp1356, tmp1357, tmp1358, tmp1359, tmp1360, tmp1361, tmp1362, tmp1363, tmp1364, tmp1365, tmp1366, tmp1367, tmp1368, tmp1369, tmp1370, tmp1371, tmp1372, tmp1373, tmp1374, tmp1375, tmp1376, tmp1377, tmp1378);
+  }
+
+  if (block52.is_used()) {
+    TNode<Context> tmp1379;
+    TNode<JSArray> tmp1380;
+    TNode<Smi> tmp1381;
+    TNode<JSReceiver> tmp1382;
+    TNode<Object> tmp1383;
+    TNode<JSArray> tmp1384;
+    TNode<Smi> tmp1385;
+    TNode<Smi> tmp1386;
+    TNode<JSArray> tmp1387;
+    TNode<JSArray> tmp1388;
+    TNode<Map> tmp1389;
+    TNode<BoolT> tmp1390;
+    TNode<BoolT> tmp1391;
+    TNode<BoolT> tmp1392;
+    TNode<JSArray> tmp1393;
+    TNode<JSArray> tmp1394;
+    TNode<Map> tmp1395;
+    TNode<BoolT> tmp1396;
+    TNode<BoolT> tmp1397;
+    TNode<BoolT> tmp1398;
+    TNode<Object> tmp1399;
+    TNode<Object> tmp1400;
+    TNode<Object> tmp1401;
+    TNode<Object> tmp1402;
+    ca_.Bind(&block52, &tmp1379, &tmp1380, &tmp1381, &tmp1382, &tmp1383, &tmp1384, &tmp1385, &tmp1386, &tmp1387, &tmp1388, &tmp1389, &tmp1390, &tmp1391, &tmp1392, &tmp1393, &tmp1394, &tmp1395, &tmp1396, &tmp1397, &tmp1398, &tmp1399, &tmp1400, &tmp1401, &tmp1402);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 124);
+    ca_.Goto(&block45, tmp1379, tmp1380, tmp1381, tmp1382, tmp1383, tmp1384, tmp1385, tmp1386, tmp1387, tmp1388, tmp1389, tmp1390, tmp1391, tmp1392, tmp1393, tmp1394, tmp1395, tmp1396, tmp1397, tmp1398, tmp1399, tmp1400, tmp1401, tmp1402);
+  }
+
+  if (block45.is_used()) {
+    TNode<Context> tmp1403;
+    TNode<JSArray> tmp1404;
+    TNode<Smi> tmp1405;
+    TNode<JSReceiver> tmp1406;
+    TNode<Object> tmp1407;
+    TNode<JSArray> tmp1408;
+    TNode<Smi> tmp1409;
+    TNode<Smi> tmp1410;
+    TNode<JSArray> tmp1411;
+    TNode<JSArray> tmp1412;
+    TNode<Map> tmp1413;
+    TNode<BoolT> tmp1414;
+    TNode<BoolT> tmp1415;
+    TNode<BoolT> tmp1416;
+    TNode<JSArray> tmp1417;
+    TNode<JSArray> tmp1418;
+    TNode<Map> tmp1419;
+    TNode<BoolT> tmp1420;
+    TNode<BoolT> tmp1421;
+    TNode<BoolT> tmp1422;
+    TNode<Object> tmp1423;
+    TNode<Object> tmp1424;
+    TNode<Object> tmp1425;
+    TNode<Object> tmp1426;
+    ca_.Bind(&block45, &tmp1403, &tmp1404, &tmp1405, &tmp1406, &tmp1407, &tmp1408, &tmp1409, &tmp1410, &tmp1411, &tmp1412, &tmp1413, &tmp1414, &tmp1415, &tmp1416, &tmp1417, &tmp1418, &tmp1419, &tmp1420, &tmp1421, &tmp1422, &tmp1423, &tmp1424, &tmp1425, &tmp1426);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 126);
+    ca_.Goto(&block35, tmp1403, tmp1404, tmp1405, tmp1406, tmp1407, tmp1408, tmp1409, tmp1410, tmp1411, tmp1412, tmp1413, tmp1414, tmp1415, tmp1416, tmp1417, tmp1418, tmp1419, tmp1420, tmp1421, tmp1422, tmp1423, tmp1424);
+  }
+
+  if (block36.is_used()) {
+    TNode<Context> tmp1427;
+    TNode<JSArray> tmp1428;
+    TNode<Smi> tmp1429;
+    TNode<JSReceiver> tmp1430;
+    TNode<Object> tmp1431;
+    TNode<JSArray> tmp1432;
+    TNode<Smi> tmp1433;
+    TNode<Smi> tmp1434;
+    TNode<JSArray> tmp1435;
+    TNode<JSArray> tmp1436;
+    TNode<Map> tmp1437;
+    TNode<BoolT> tmp1438;
+    TNode<BoolT> tmp1439;
+    TNode<BoolT> tmp1440;
+    TNode<JSArray> tmp1441;
+    TNode<JSArray> tmp1442;
+    TNode<Map> tmp1443;
+    TNode<BoolT> tmp1444;
+    TNode<BoolT> tmp1445;
+    TNode<BoolT> tmp1446;
+    TNode<Object> tmp1447;
+    TNode<Object> tmp1448;
+    ca_.Bind(&block36, &tmp1427, &tmp1428, &tmp1429, &tmp1430, &tmp1431, &tmp1432, &tmp1433, &tmp1434, &tmp1435, &tmp1436, &tmp1437, &tmp1438, &tmp1439, &tmp1440, &tmp1441, &tmp1442, &tmp1443, &tmp1444, &tmp1445, &tmp1446, &tmp1447, &tmp1448);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 127);
+    TNode<Object> tmp1449;
+    tmp1449 = CodeStubAssembler(state_).CallBuiltin(Builtins::kFastCreateDataProperty, tmp1427, tmp1441, tmp1434, tmp1447);
+    USE(tmp1449);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 118);
+    ca_.Goto(&block35, tmp1427, tmp1428, tmp1429, tmp1430, tmp1431, tmp1432, tmp1433, tmp1434, tmp1435, tmp1436, tmp1437, tmp1438, tmp1439, tmp1440, tmp1441, tmp1442, tmp1443, tmp1444, tmp1445, tmp1446, tmp1447, tmp1448);
+  }
+
+  if (block35.is_used()) {
+    TNode<Context> tmp1450;
+    TNode<JSArray> tmp1451;
+    TNode<Smi> tmp1452;
+    TNode<JSReceiver> tmp1453;
+    TNode<Object> tmp1454;
+    TNode<JSArray> tmp1455;
+    TNode<Smi> tmp1456;
+    TNode<Smi> tmp1457;
+    TNode<JSArray> tmp1458;
+    TNode<JSArray> tmp1459;
+    TNode<Map> tmp1460;
+    TNode<BoolT> tmp1461;
+    TNode<BoolT> tmp1462;
+    TNode<BoolT> tmp1463;
+    TNode<JSArray> tmp1464;
+    TNode<JSArray> tmp1465;
+    TNode<Map> tmp1466;
+    TNode<BoolT> tmp1467;
+    TNode<BoolT> tmp1468;
+    TNode<BoolT> tmp1469;
+    TNode<Object> tmp1470;
+    TNode<Object> tmp1471;
+    ca_.Bind(&block35, &tmp1450, &tmp1451, &tmp1452, &tmp1453, &tmp1454, &tmp1455, &tmp1456, &tmp1457, &tmp1458, &tmp1459, &tmp1460, &tmp1461, &tmp1462, &tmp1463, &tmp1464, &tmp1465, &tmp1466, &tmp1467, &tmp1468, &tmp1469, &tmp1470, &tmp1471);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 129);
+    TNode<Smi> tmp1472;
+    USE(tmp1472);
+    tmp1472 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 1);
+    TNode<Smi> tmp1473;
+    USE(tmp1473);
+    tmp1473 = CodeStubAssembler(state_).SmiAdd(TNode<Smi>{tmp1457}, TNode<Smi>{tmp1472});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 117);
+    ca_.Goto(&block34, tmp1450, tmp1451, tmp1452, tmp1453, tmp1454, tmp1455, tmp1456, tmp1473, tmp1458, tmp1459, tmp1460, tmp1461, tmp1462, tmp1463, tmp1464, tmp1465, tmp1466, tmp1467, tmp1468, tmp1469, tmp1470, tmp1471);
+  }
+
+  if (block34.is_used()) {
+    TNode<Context> tmp1474;
+    TNode<JSArray> tmp1475;
+    TNode<Smi> tmp1476;
+    TNode<JSReceiver> tmp1477;
+    TNode<Object> tmp1478;
+    TNode<JSArray> tmp1479;
+    TNode<Smi> tmp1480;
+    TNode<Smi> tmp1481;
+    TNode<JSArray> tmp1482;
+    TNode<JSArray> tmp1483;
+    TNode<Map> tmp1484;
+    TNode<BoolT> tmp1485;
+    TNode<BoolT> tmp1486;
+    TNode<BoolT> tmp1487;
+    TNode<JSArray> tmp1488;
+    TNode<JSArray> tmp1489;
+    TNode<Map> tmp1490;
+    TNode<BoolT> tmp1491;
+    TNode<BoolT> tmp1492;
+    TNode<BoolT> tmp1493;
+    TNode<Object> tmp1494;
+    TNode<Object> tmp1495;
+    ca_.Bind(&block34, &tmp1474, &tmp1475, &tmp1476, &tmp1477, &tmp1478, &tmp1479, &tmp1480, &tmp1481, &tmp1482, &tmp1483, &tmp1484, &tmp1485, &tmp1486, &tmp1487, &tmp1488, &tmp1489, &tmp1490, &tmp1491, &tmp1492, &tmp1493, &tmp1494, &tmp1495);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 109);
+    ca_.Goto(&block11, tmp1474, tmp1475, tmp1476, tmp1477, tmp1478, tmp1479, tmp1480, tmp1481, tmp1482, tmp1483, tmp1484, tmp1485, tmp1486, tmp1487, tmp1488, tmp1489, tmp1490, tmp1491, tmp1492, tmp1493);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp1496;
+    TNode<JSArray> tmp1497;
+    TNode<Smi> tmp1498;
+    TNode<JSReceiver> tmp1499;
+    TNode<Object> tmp1500;
+    TNode<JSArray> tmp1501;
+    TNode<Smi> tmp1502;
+    TNode<Smi> tmp1503;
+    TNode<JSArray> tmp1504;
+    TNode<JSArray> tmp1505;
+    TNode<Map> tmp1506;
+    TNode<BoolT> tmp1507;
+    TNode<BoolT> tmp1508;
+    TNode<BoolT> tmp1509;
+    TNode<JSArray> tmp1510;
+    TNode<JSArray> tmp1511;
+    TNode<Map> tmp1512;
+    TNode<BoolT> tmp1513;
+    TNode<BoolT> tmp1514;
+    TNode<BoolT> tmp1515;
+    ca_.Bind(&block11, &tmp1496, &tmp1497, &tmp1498, &tmp1499, &tmp1500, &tmp1501, &tmp1502, &tmp1503, &tmp1504, &tmp1505, &tmp1506, &tmp1507, &tmp1508, &tmp1509, &tmp1510, &tmp1511, &tmp1512, &tmp1513, &tmp1514, &tmp1515);
+    TNode<Smi> tmp1516;
+    USE(tmp1516);
+    tmp1516 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 1);
+    TNode<Smi> tmp1517;
+    USE(tmp1517);
+    tmp1517 = CodeStubAssembler(state_).SmiAdd(TNode<Smi>{tmp1502}, TNode<Smi>{tmp1516});
+    ca_.Goto(&block10, tmp1496, tmp1497, tmp1498, tmp1499, tmp1500, tmp1501, tmp1517, tmp1503, tmp1504, tmp1505, tmp1506, tmp1507, tmp1508, tmp1509, tmp1510, tmp1511, tmp1512, tmp1513, tmp1514, tmp1515);
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp1518;
+    TNode<JSArray> tmp1519;
+    TNode<Smi> tmp1520;
+    TNode<JSReceiver> tmp1521;
+    TNode<Object> tmp1522;
+    TNode<JSArray> tmp1523;
+    TNode<Smi> tmp1524;
+    TNode<Smi> tmp1525;
+    TNode<JSArray> tmp1526;
+    TNode<JSArray> tmp1527;
+    TNode<Map> tmp1528;
+    TNode<BoolT> tmp1529;
+    TNode<BoolT> tmp1530;
+    TNode<BoolT> tmp1531;
+    TNode<JSArray> tmp1532;
+    TNode<JSArray> tmp1533;
+    TNode<Map> tmp1534;
+    TNode<BoolT> tmp1535;
+    TNode<BoolT> tmp1536;
+    TNode<BoolT> tmp1537;
+    ca_.Bind(&block9, &tmp1518, &tmp1519, &tmp1520, &tmp1521, &tmp1522, &tmp1523, &tmp1524, &tmp1525, &tmp1526, &tmp1527, &tmp1528, &tmp1529, &tmp1530, &tmp1531, &tmp1532, &tmp1533, &tmp1534, &tmp1535, &tmp1536, &tmp1537);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 100);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 98);
+    ca_.Goto(&block2, tmp1518, tmp1519, tmp1520, tmp1521, tmp1522, tmp1523);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp1538;
+    TNode<JSArray> tmp1539;
+    TNode<Smi> tmp1540;
+    TNode<JSReceiver> tmp1541;
+    TNode<Object> tmp1542;
+    TNode<JSArray> tmp1543;
+    ca_.Bind(&block2, &tmp1538, &tmp1539, &tmp1540, &tmp1541, &tmp1542, &tmp1543);
+    ca_.Goto(&block69, tmp1538, tmp1539, tmp1540, tmp1541, tmp1542, tmp1543);
+  }
+
+  if (block1.is_used()) {
+    TNode<Number> tmp1544;
+    TNode<Number> tmp1545;
+    ca_.Bind(&block1, &tmp1544, &tmp1545);
+    *label_Bailout_parameter_1 = tmp1545;
+    *label_Bailout_parameter_0 = tmp1544;
+    ca_.Goto(label_Bailout);
+  }
+
+    TNode<Context> tmp1546;
+    TNode<JSArray> tmp1547;
+    TNode<Smi> tmp1548;
+    TNode<JSReceiver> tmp1549;
+    TNode<Object> tmp1550;
+    TNode<JSArray> tmp1551;
+    ca_.Bind(&block69, &tmp1546, &tmp1547, &tmp1548, &tmp1549, &tmp1550, &tmp1551);
+}
+
+TNode<JSReceiver> FastFilterSpeciesCreate_4(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<JSReceiver> p_receiver, compiler::CodeAssemblerLabel* label_Slow) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Smi> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Smi> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Smi, JSReceiver> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Smi, JSReceiver, JSArray> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_receiver);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 139);
+    TNode<Smi> tmp2;
+    USE(tmp2);
+    tmp2 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 140);
+    TNode<BoolT> tmp3;
+    USE(tmp3);
+    tmp3 = CodeStubAssembler(state_).IsArraySpeciesProtectorCellInvalid();
+    ca_.Branch(tmp3, &block3, &block4, tmp0, tmp1, tmp2);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp4;
+    TNode<JSReceiver> tmp5;
+    TNode<Smi> tmp6;
+    ca_.Bind(&block3, &tmp4, &tmp5, &tmp6);
+    ca_.Goto(&block1);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp7;
+    TNode<JSReceiver> tmp8;
+    TNode<Smi> tmp9;
+    ca_.Bind(&block4, &tmp7, &tmp8, &tmp9);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 141);
+    TNode<JSArray> tmp10;
+    USE(tmp10);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp10 = Cast13ATFastJSArray_138(state_, TNode<Context>{tmp7}, TNode<HeapObject>{tmp8}, &label0);
+    ca_.Goto(&block5, tmp7, tmp8, tmp9, tmp8, tmp10);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block6, tmp7, tmp8, tmp9, tmp8);
+    }
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp11;
+    TNode<JSReceiver> tmp12;
+    TNode<Smi> tmp13;
+    TNode<JSReceiver> tmp14;
+    ca_.Bind(&block6, &tmp11, &tmp12, &tmp13, &tmp14);
+    ca_.Goto(&block1);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp15;
+    TNode<JSReceiver> tmp16;
+    TNode<Smi> tmp17;
+    TNode<JSReceiver> tmp18;
+    TNode<JSArray> tmp19;
+    ca_.Bind(&block5, &tmp15, &tmp16, &tmp17, &tmp18, &tmp19);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 143);
+    TNode<IntPtrT> tmp20 = ca_.IntPtrConstant(HeapObject::kMapOffset);
+    USE(tmp20);
+    TNode<Map>tmp21 = CodeStubAssembler(state_).LoadReference<Map>(CodeStubAssembler::Reference{tmp19, tmp20});
+    TNode<Int32T> tmp22;
+    USE(tmp22);
+    tmp22 = CodeStubAssembler(state_).LoadMapElementsKind(TNode<Map>{tmp21});
+    TNode<NativeContext> tmp23;
+    USE(tmp23);
+    tmp23 = CodeStubAssembler(state_).LoadNativeContext(TNode<Context>{tmp15});
+    TNode<Map> tmp24;
+    USE(tmp24);
+    tmp24 = CodeStubAssembler(state_).LoadJSArrayElementsMap(TNode<Int32T>{tmp22}, TNode<NativeContext>{tmp23});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 142);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 144);
+    TNode<JSArray> tmp25;
+    USE(tmp25);
+    tmp25 = CodeStubAssembler(state_).AllocateJSArray(PACKED_SMI_ELEMENTS, TNode<Map>{tmp24}, TNode<Smi>{tmp17}, TNode<Smi>{tmp17});
+    ca_.Goto(&block2, tmp15, tmp16, tmp25);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp26;
+    TNode<JSReceiver> tmp27;
+    TNode<JSReceiver> tmp28;
+    ca_.Bind(&block2, &tmp26, &tmp27, &tmp28);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 137);
+    ca_.Goto(&block7, tmp26, tmp27, tmp28);
+  }
+
+  if (block1.is_used()) {
+    ca_.Bind(&block1);
+    ca_.Goto(label_Slow);
+  }
+
+    TNode<Context> tmp29;
+    TNode<JSReceiver> tmp30;
+    TNode<JSReceiver> tmp31;
+    ca_.Bind(&block7, &tmp29, &tmp30, &tmp31);
+  return TNode<JSReceiver>{tmp31};
+}
+
+TF_BUILTIN(ArrayFilter, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  Node* argc = Parameter(Descriptor::kJSActualArgumentsCount);
+  TNode<IntPtrT> arguments_length(ChangeInt32ToIntPtr(argc));
+  TNode<RawPtrT> arguments_frame = UncheckedCast<RawPtrT>(LoadFramePointer());
+  TorqueStructArguments torque_arguments(GetFrameArguments(arguments_frame, arguments_length));
+  CodeStubArguments arguments(this, torque_arguments);
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = arguments.GetReceiver();
+USE(parameter1);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, Object> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, Object, JSReceiver> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, Number, JSReceiver> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, Number, JSReceiver, JSReceiver> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, Number, Number> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, Number, Number, Smi> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, Number> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, Number, Smi> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, Number, Smi, JSReceiver> block24(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, Number, Smi, JSReceiver, JSArray> block23(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, Number, Smi> block22(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, Number, Smi, JSArray> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, Number, Smi, JSArray, JSReceiver> block28(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, Number, Smi, JSArray, JSReceiver, JSArray> block27(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, Number, Smi, JSArray> block26(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, Number, Smi, JSArray, JSArray> block25(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, Number, Smi, JSArray, JSArray, JSArray, Smi, JSReceiver, Object, JSArray, Number, Number> block30(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, Number, Smi, JSArray, JSArray, JSArray, Smi, JSReceiver, Object, JSArray> block29(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, Number, Number, Number> block16(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, Number, Number, Number> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, Number> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, Number> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object> block2(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+    ca_.Goto(&block0, torque_arguments.frame, torque_arguments.base, torque_arguments.length, parameter0, parameter1);
+
+  if (block0.is_used()) {
+    TNode<RawPtrT> tmp0;
+    TNode<RawPtrT> tmp1;
+    TNode<IntPtrT> tmp2;
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 152);
+    TNode<Object> tmp5;
+    USE(tmp5);
+    tmp5 = RequireObjectCoercible_244(state_, TNode<Context>{tmp3}, TNode<Object>{tmp4}, "Array.prototype.filter");
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 155);
+    TNode<JSReceiver> tmp6;
+    USE(tmp6);
+    tmp6 = CodeStubAssembler(state_).ToObject_Inline(TNode<Context>{tmp3}, TNode<Object>{tmp4});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 158);
+    TNode<Number> tmp7;
+    USE(tmp7);
+    tmp7 = GetLengthProperty_247(state_, TNode<Context>{tmp3}, TNode<Object>{tmp6});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 161);
+    TNode<IntPtrT> tmp8;
+    USE(tmp8);
+    tmp8 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<BoolT> tmp9;
+    USE(tmp9);
+    tmp9 = CodeStubAssembler(state_).WordEqual(TNode<IntPtrT>{tmp2}, TNode<IntPtrT>{tmp8});
+    ca_.Branch(tmp9, &block3, &block4, tmp0, tmp1, tmp2, tmp3, tmp4, tmp6, tmp7);
+  }
+
+  if (block3.is_used()) {
+    TNode<RawPtrT> tmp10;
+    TNode<RawPtrT> tmp11;
+    TNode<IntPtrT> tmp12;
+    TNode<Context> tmp13;
+    TNode<Object> tmp14;
+    TNode<JSReceiver> tmp15;
+    TNode<Number> tmp16;
+    ca_.Bind(&block3, &tmp10, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 162);
+    ca_.Goto(&block2, tmp10, tmp11, tmp12, tmp13, tmp14);
+  }
+
+  if (block4.is_used()) {
+    TNode<RawPtrT> tmp17;
+    TNode<RawPtrT> tmp18;
+    TNode<IntPtrT> tmp19;
+    TNode<Context> tmp20;
+    TNode<Object> tmp21;
+    TNode<JSReceiver> tmp22;
+    TNode<Number> tmp23;
+    ca_.Bind(&block4, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 164);
+    TNode<IntPtrT> tmp24;
+    USE(tmp24);
+    tmp24 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<Object> tmp25;
+    USE(tmp25);
+    tmp25 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp17}, TNode<RawPtrT>{tmp18}, TNode<IntPtrT>{tmp19}}, TNode<IntPtrT>{tmp24});
+    TNode<JSReceiver> tmp26;
+    USE(tmp26);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp26 = Cast71UT19ATCallableApiObject17ATCallableJSProxy15JSBoundFunction10JSFunction_1366(state_, TNode<Context>{tmp20}, TNode<Object>{tmp25}, &label0);
+    ca_.Goto(&block5, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp25, tmp26);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block6, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp25);
+    }
+  }
+
+  if (block6.is_used()) {
+    TNode<RawPtrT> tmp27;
+    TNode<RawPtrT> tmp28;
+    TNode<IntPtrT> tmp29;
+    TNode<Context> tmp30;
+    TNode<Object> tmp31;
+    TNode<JSReceiver> tmp32;
+    TNode<Number> tmp33;
+    TNode<Object> tmp34;
+    ca_.Bind(&block6, &tmp27, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34);
+    ca_.Goto(&block2, tmp27, tmp28, tmp29, tmp30, tmp31);
+  }
+
+  if (block5.is_used()) {
+    TNode<RawPtrT> tmp35;
+    TNode<RawPtrT> tmp36;
+    TNode<IntPtrT> tmp37;
+    TNode<Context> tmp38;
+    TNode<Object> tmp39;
+    TNode<JSReceiver> tmp40;
+    TNode<Number> tmp41;
+    TNode<Object> tmp42;
+    TNode<JSReceiver> tmp43;
+    ca_.Bind(&block5, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 167);
+    TNode<IntPtrT> tmp44;
+    USE(tmp44);
+    tmp44 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<BoolT> tmp45;
+    USE(tmp45);
+    tmp45 = CodeStubAssembler(state_).IntPtrGreaterThan(TNode<IntPtrT>{tmp37}, TNode<IntPtrT>{tmp44});
+    ca_.Branch(tmp45, &block7, &block8, tmp35, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp43);
+  }
+
+  if (block7.is_used()) {
+    TNode<RawPtrT> tmp46;
+    TNode<RawPtrT> tmp47;
+    TNode<IntPtrT> tmp48;
+    TNode<Context> tmp49;
+    TNode<Object> tmp50;
+    TNode<JSReceiver> tmp51;
+    TNode<Number> tmp52;
+    TNode<JSReceiver> tmp53;
+    ca_.Bind(&block7, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53);
+    TNode<IntPtrT> tmp54;
+    USE(tmp54);
+    tmp54 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<Object> tmp55;
+    USE(tmp55);
+    tmp55 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp46}, TNode<RawPtrT>{tmp47}, TNode<IntPtrT>{tmp48}}, TNode<IntPtrT>{tmp54});
+    ca_.Goto(&block10, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51, tmp52, tmp53, tmp55);
+  }
+
+  if (block8.is_used()) {
+    TNode<RawPtrT> tmp56;
+    TNode<RawPtrT> tmp57;
+    TNode<IntPtrT> tmp58;
+    TNode<Context> tmp59;
+    TNode<Object> tmp60;
+    TNode<JSReceiver> tmp61;
+    TNode<Number> tmp62;
+    TNode<JSReceiver> tmp63;
+    ca_.Bind(&block8, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63);
+    TNode<Oddball> tmp64;
+    USE(tmp64);
+    tmp64 = Undefined_64(state_);
+    ca_.Goto(&block9, tmp56, tmp57, tmp58, tmp59, tmp60, tmp61, tmp62, tmp63, tmp64);
+  }
+
+  if (block10.is_used()) {
+    TNode<RawPtrT> tmp65;
+    TNode<RawPtrT> tmp66;
+    TNode<IntPtrT> tmp67;
+    TNode<Context> tmp68;
+    TNode<Object> tmp69;
+    TNode<JSReceiver> tmp70;
+    TNode<Number> tmp71;
+    TNode<JSReceiver> tmp72;
+    TNode<Object> tmp73;
+    ca_.Bind(&block10, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73);
+    ca_.Goto(&block9, tmp65, tmp66, tmp67, tmp68, tmp69, tmp70, tmp71, tmp72, tmp73);
+  }
+
+  if (block9.is_used()) {
+    TNode<RawPtrT> tmp74;
+    TNode<RawPtrT> tmp75;
+    TNode<IntPtrT> tmp76;
+    TNode<Context> tmp77;
+    TNode<Object> tmp78;
+    TNode<JSReceiver> tmp79;
+    TNode<Number> tmp80;
+    TNode<JSReceiver> tmp81;
+    TNode<Object> tmp82;
+    ca_.Bind(&block9, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 168);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 171);
+    TNode<Number> tmp83;
+    USE(tmp83);
+    tmp83 = FromConstexpr20UT5ATSmi10HeapNumber17ATconstexpr_int31_161(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 172);
+    TNode<Number> tmp84;
+    USE(tmp84);
+    tmp84 = FromConstexpr20UT5ATSmi10HeapNumber17ATconstexpr_int31_161(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 174);
+    TNode<JSReceiver> tmp85;
+    USE(tmp85);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp85 = FastFilterSpeciesCreate_4(state_, TNode<Context>{tmp77}, TNode<JSReceiver>{tmp79}, &label0);
+    ca_.Goto(&block13, tmp74, tmp75, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, ca_.Uninitialized<JSReceiver>(), tmp83, tmp84, tmp79, tmp85);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block14, tmp74, tmp75, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, ca_.Uninitialized<JSReceiver>(), tmp83, tmp84, tmp79);
+    }
+  }
+
+  if (block14.is_used()) {
+    TNode<RawPtrT> tmp86;
+    TNode<RawPtrT> tmp87;
+    TNode<IntPtrT> tmp88;
+    TNode<Context> tmp89;
+    TNode<Object> tmp90;
+    TNode<JSReceiver> tmp91;
+    TNode<Number> tmp92;
+    TNode<JSReceiver> tmp93;
+    TNode<Object> tmp94;
+    TNode<JSReceiver> tmp95;
+    TNode<Number> tmp96;
+    TNode<Number> tmp97;
+    TNode<JSReceiver> tmp98;
+    ca_.Bind(&block14, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96, &tmp97, &tmp98);
+    ca_.Goto(&block12, tmp86, tmp87, tmp88, tmp89, tmp90, tmp91, tmp92, tmp93, tmp94, tmp95, tmp96, tmp97);
+  }
+
+  if (block13.is_used()) {
+    TNode<RawPtrT> tmp99;
+    TNode<RawPtrT> tmp100;
+    TNode<IntPtrT> tmp101;
+    TNode<Context> tmp102;
+    TNode<Object> tmp103;
+    TNode<JSReceiver> tmp104;
+    TNode<Number> tmp105;
+    TNode<JSReceiver> tmp106;
+    TNode<Object> tmp107;
+    TNode<JSReceiver> tmp108;
+    TNode<Number> tmp109;
+    TNode<Number> tmp110;
+    TNode<JSReceiver> tmp111;
+    TNode<JSReceiver> tmp112;
+    ca_.Bind(&block13, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104, &tmp105, &tmp106, &tmp107, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 177);
+    TNode<Smi> tmp113;
+    USE(tmp113);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp113 = Cast5ATSmi_83(state_, TNode<Object>{tmp105}, &label0);
+    ca_.Goto(&block19, tmp99, tmp100, tmp101, tmp102, tmp103, tmp104, tmp105, tmp106, tmp107, tmp112, tmp109, tmp110, tmp105, tmp113);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block20, tmp99, tmp100, tmp101, tmp102, tmp103, tmp104, tmp105, tmp106, tmp107, tmp112, tmp109, tmp110, tmp105);
+    }
+  }
+
+  if (block20.is_used()) {
+    TNode<RawPtrT> tmp114;
+    TNode<RawPtrT> tmp115;
+    TNode<IntPtrT> tmp116;
+    TNode<Context> tmp117;
+    TNode<Object> tmp118;
+    TNode<JSReceiver> tmp119;
+    TNode<Number> tmp120;
+    TNode<JSReceiver> tmp121;
+    TNode<Object> tmp122;
+    TNode<JSReceiver> tmp123;
+    TNode<Number> tmp124;
+    TNode<Number> tmp125;
+    TNode<Number> tmp126;
+    ca_.Bind(&block20, &tmp114, &tmp115, &tmp116, &tmp117, &tmp118, &tmp119, &tmp120, &tmp121, &tmp122, &tmp123, &tmp124, &tmp125, &tmp126);
+    ca_.Goto(&block18, tmp114, tmp115, tmp116, tmp117, tmp118, tmp119, tmp120, tmp121, tmp122, tmp123, tmp124, tmp125);
+  }
+
+  if (block19.is_used()) {
+    TNode<RawPtrT> tmp127;
+    TNode<RawPtrT> tmp128;
+    TNode<IntPtrT> tmp129;
+    TNode<Context> tmp130;
+    TNode<Object> tmp131;
+    TNode<JSReceiver> tmp132;
+    TNode<Number> tmp133;
+    TNode<JSReceiver> tmp134;
+    TNode<Object> tmp135;
+    TNode<JSReceiver> tmp136;
+    TNode<Number> tmp137;
+    TNode<Number> tmp138;
+    TNode<Number> tmp139;
+    TNode<Smi> tmp140;
+    ca_.Bind(&block19, &tmp127, &tmp128, &tmp129, &tmp130, &tmp131, &tmp132, &tmp133, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138, &tmp139, &tmp140);
+    ca_.Goto(&block17, tmp127, tmp128, tmp129, tmp130, tmp131, tmp132, tmp133, tmp134, tmp135, tmp136, tmp137, tmp138, tmp140);
+  }
+
+  if (block18.is_used()) {
+    TNode<RawPtrT> tmp141;
+    TNode<RawPtrT> tmp142;
+    TNode<IntPtrT> tmp143;
+    TNode<Context> tmp144;
+    TNode<Object> tmp145;
+    TNode<JSReceiver> tmp146;
+    TNode<Number> tmp147;
+    TNode<JSReceiver> tmp148;
+    TNode<Object> tmp149;
+    TNode<JSReceiver> tmp150;
+    TNode<Number> tmp151;
+    TNode<Number> tmp152;
+    ca_.Bind(&block18, &tmp141, &tmp142, &tmp143, &tmp144, &tmp145, &tmp146, &tmp147, &tmp148, &tmp149, &tmp150, &tmp151, &tmp152);
+    ca_.Goto(&block16, tmp141, tmp142, tmp143, tmp144, tmp145, tmp146, tmp147, tmp148, tmp149, tmp150, tmp151, tmp152, tmp151, tmp152);
+  }
+
+  if (block17.is_used()) {
+    TNode<RawPtrT> tmp153;
+    TNode<RawPtrT> tmp154;
+    TNode<IntPtrT> tmp155;
+    TNode<Context> tmp156;
+    TNode<Object> tmp157;
+    TNode<JSReceiver> tmp158;
+    TNode<Number> tmp159;
+    TNode<JSReceiver> tmp160;
+    TNode<Object> tmp161;
+    TNode<JSReceiver> tmp162;
+    TNode<Number> tmp163;
+    TNode<Number> tmp164;
+    TNode<Smi> tmp165;
+    ca_.Bind(&block17, &tmp153, &tmp154, &tmp155, &tmp156, &tmp157, &tmp158, &tmp159, &tmp160, &tmp161, &tmp162, &tmp163, &tmp164, &tmp165);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 179);
+    TNode<JSArray> tmp166;
+    USE(tmp166);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp166 = Cast13ATFastJSArray_138(state_, TNode<Context>{tmp156}, TNode<HeapObject>{tmp162}, &label0);
+    ca_.Goto(&block23, tmp153, tmp154, tmp155, tmp156, tmp157, tmp158, tmp159, tmp160, tmp161, tmp162, tmp163, tmp164, tmp165, tmp162, tmp166);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block24, tmp153, tmp154, tmp155, tmp156, tmp157, tmp158, tmp159, tmp160, tmp161, tmp162, tmp163, tmp164, tmp165, tmp162);
+    }
+  }
+
+  if (block24.is_used()) {
+    TNode<RawPtrT> tmp167;
+    TNode<RawPtrT> tmp168;
+    TNode<IntPtrT> tmp169;
+    TNode<Context> tmp170;
+    TNode<Object> tmp171;
+    TNode<JSReceiver> tmp172;
+    TNode<Number> tmp173;
+    TNode<JSReceiver> tmp174;
+    TNode<Object> tmp175;
+    TNode<JSReceiver> tmp176;
+    TNode<Number> tmp177;
+    TNode<Number> tmp178;
+    TNode<Smi> tmp179;
+    TNode<JSReceiver> tmp180;
+    ca_.Bind(&block24, &tmp167, &tmp168, &tmp169, &tmp170, &tmp171, &tmp172, &tmp173, &tmp174, &tmp175, &tmp176, &tmp177, &tmp178, &tmp179, &tmp180);
+    ca_.Goto(&block22, tmp167, tmp168, tmp169, tmp170, tmp171, tmp172, tmp173, tmp174, tmp175, tmp176, tmp177, tmp178, tmp179);
+  }
+
+  if (block23.is_used()) {
+    TNode<RawPtrT> tmp181;
+    TNode<RawPtrT> tmp182;
+    TNode<IntPtrT> tmp183;
+    TNode<Context> tmp184;
+    TNode<Object> tmp185;
+    TNode<JSReceiver> tmp186;
+    TNode<Number> tmp187;
+    TNode<JSReceiver> tmp188;
+    TNode<Object> tmp189;
+    TNode<JSReceiver> tmp190;
+    TNode<Number> tmp191;
+    TNode<Number> tmp192;
+    TNode<Smi> tmp193;
+    TNode<JSReceiver> tmp194;
+    TNode<JSArray> tmp195;
+    ca_.Bind(&block23, &tmp181, &tmp182, &tmp183, &tmp184, &tmp185, &tmp186, &tmp187, &tmp188, &tmp189, &tmp190, &tmp191, &tmp192, &tmp193, &tmp194, &tmp195);
+    ca_.Goto(&block21, tmp181, tmp182, tmp183, tmp184, tmp185, tmp186, tmp187, tmp188, tmp189, tmp190, tmp191, tmp192, tmp193, tmp195);
+  }
+
+  if (block22.is_used()) {
+    TNode<RawPtrT> tmp196;
+    TNode<RawPtrT> tmp197;
+    TNode<IntPtrT> tmp198;
+    TNode<Context> tmp199;
+    TNode<Object> tmp200;
+    TNode<JSReceiver> tmp201;
+    TNode<Number> tmp202;
+    TNode<JSReceiver> tmp203;
+    TNode<Object> tmp204;
+    TNode<JSReceiver> tmp205;
+    TNode<Number> tmp206;
+    TNode<Number> tmp207;
+    TNode<Smi> tmp208;
+    ca_.Bind(&block22, &tmp196, &tmp197, &tmp198, &tmp199, &tmp200, &tmp201, &tmp202, &tmp203, &tmp204, &tmp205, &tmp206, &tmp207, &tmp208);
+    ca_.Goto(&block16, tmp196, tmp197, tmp198, tmp199, tmp200, tmp201, tmp202, tmp203, tmp204, tmp205, tmp206, tmp207, tmp206, tmp207);
+  }
+
+  if (block21.is_used()) {
+    TNode<RawPtrT> tmp209;
+    TNode<RawPtrT> tmp210;
+    TNode<IntPtrT> tmp211;
+    TNode<Context> tmp212;
+    TNode<Object> tmp213;
+    TNode<JSReceiver> tmp214;
+    TNode<Number> tmp215;
+    TNode<JSReceiver> tmp216;
+    TNode<Object> tmp217;
+    TNode<JSReceiver> tmp218;
+    TNode<Number> tmp219;
+    TNode<Number> tmp220;
+    TNode<Smi> tmp221;
+    TNode<JSArray> tmp222;
+    ca_.Bind(&block21, &tmp209, &tmp210, &tmp211, &tmp212, &tmp213, &tmp214, &tmp215, &tmp216, &tmp217, &tmp218, &tmp219, &tmp220, &tmp221, &tmp222);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 180);
+    TNode<JSArray> tmp223;
+    USE(tmp223);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp223 = Cast13ATFastJSArray_138(state_, TNode<Context>{tmp212}, TNode<HeapObject>{tmp214}, &label0);
+    ca_.Goto(&block27, tmp209, tmp210, tmp211, tmp212, tmp213, tmp214, tmp215, tmp216, tmp217, tmp218, tmp219, tmp220, tmp221, tmp222, tmp214, tmp223);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block28, tmp209, tmp210, tmp211, tmp212, tmp213, tmp214, tmp215, tmp216, tmp217, tmp218, tmp219, tmp220, tmp221, tmp222, tmp214);
+    }
+  }
+
+  if (block28.is_used()) {
+    TNode<RawPtrT> tmp224;
+    TNode<RawPtrT> tmp225;
+    TNode<IntPtrT> tmp226;
+    TNode<Context> tmp227;
+    TNode<Object> tmp228;
+    TNode<JSReceiver> tmp229;
+    TNode<Number> tmp230;
+    TNode<JSReceiver> tmp231;
+    TNode<Object> tmp232;
+    TNode<JSReceiver> tmp233;
+    TNode<Number> tmp234;
+    TNode<Number> tmp235;
+    TNode<Smi> tmp236;
+    TNode<JSArray> tmp237;
+    TNode<JSReceiver> tmp238;
+    ca_.Bind(&block28, &tmp224, &tmp225, &tmp226, &tmp227, &tmp228, &tmp229, &tmp230, &tmp231, &tmp232, &tmp233, &tmp234, &tmp235, &tmp236, &tmp237, &tmp238);
+    ca_.Goto(&block26, tmp224, tmp225, tmp226, tmp227, tmp228, tmp229, tmp230, tmp231, tmp232, tmp233, tmp234, tmp235, tmp236, tmp237);
+  }
+
+  if (block27.is_used()) {
+    TNode<RawPtrT> tmp239;
+    TNode<RawPtrT> tmp240;
+    TNode<IntPtrT> tmp241;
+    TNode<Context> tmp242;
+    TNode<Object> tmp243;
+    TNode<JSReceiver> tmp244;
+    TNode<Number> tmp245;
+    TNode<JSReceiver> tmp246;
+    TNode<Object> tmp247;
+    TNode<JSReceiver> tmp248;
+    TNode<Number> tmp249;
+    TNode<Number> tmp250;
+    TNode<Smi> tmp251;
+    TNode<JSArray> tmp252;
+    TNode<JSReceiver> tmp253;
+    TNode<JSArray> tmp254;
+    ca_.Bind(&block27, &tmp239, &tmp240, &tmp241, &tmp242, &tmp243, &tmp244, &tmp245, &tmp246, &tmp247, &tmp248, &tmp249, &tmp250, &tmp251, &tmp252, &tmp253, &tmp254);
+    ca_.Goto(&block25, tmp239, tmp240, tmp241, tmp242, tmp243, tmp244, tmp245, tmp246, tmp247, tmp248, tmp249, tmp250, tmp251, tmp252, tmp254);
+  }
+
+  if (block26.is_used()) {
+    TNode<RawPtrT> tmp255;
+    TNode<RawPtrT> tmp256;
+    TNode<IntPtrT> tmp257;
+    TNode<Context> tmp258;
+    TNode<Object> tmp259;
+    TNode<JSReceiver> tmp260;
+    TNode<Number> tmp261;
+    TNode<JSReceiver> tmp262;
+    TNode<Object> tmp263;
+    TNode<JSReceiver> tmp264;
+    TNode<Number> tmp265;
+    TNode<Number> tmp266;
+    TNode<Smi> tmp267;
+    TNode<JSArray> tmp268;
+    ca_.Bind(&block26, &tmp255, &tmp256, &tmp257, &tmp258, &tmp259, &tmp260, &tmp261, &tmp262, &tmp263, &tmp264, &tmp265, &tmp266, &tmp267, &tmp268);
+    ca_.Goto(&block16, tmp255, tmp256, tmp257, tmp258, tmp259, tmp260, tmp261, tmp262, tmp263, tmp264, tmp265, tmp266, tmp265, tmp266);
+  }
+
+  if (block25.is_used()) {
+    TNode<RawPtrT> tmp269;
+    TNode<RawPtrT> tmp270;
+    TNode<IntPtrT> tmp271;
+    TNode<Context> tmp272;
+    TNode<Object> tmp273;
+    TNode<JSReceiver> tmp274;
+    TNode<Number> tmp275;
+    TNode<JSReceiver> tmp276;
+    TNode<Object> tmp277;
+    TNode<JSReceiver> tmp278;
+    TNode<Number> tmp279;
+    TNode<Number> tmp280;
+    TNode<Smi> tmp281;
+    TNode<JSArray> tmp282;
+    TNode<JSArray> tmp283;
+    ca_.Bind(&block25, &tmp269, &tmp270, &tmp271, &tmp272, &tmp273, &tmp274, &tmp275, &tmp276, &tmp277, &tmp278, &tmp279, &tmp280, &tmp281, &tmp282, &tmp283);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 182);
+    compiler::TypedCodeAssemblerVariable<Number> result_0_0(&ca_);
+    compiler::TypedCodeAssemblerVariable<Number> result_0_1(&ca_);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    FastArrayFilter_3(state_, TNode<Context>{tmp272}, TNode<JSArray>{tmp283}, TNode<Smi>{tmp281}, TNode<JSReceiver>{tmp276}, TNode<Object>{tmp277}, TNode<JSArray>{tmp282}, &label0, &result_0_0, &result_0_1);
+    ca_.Goto(&block29, tmp269, tmp270, tmp271, tmp272, tmp273, tmp274, tmp275, tmp276, tmp277, tmp278, tmp279, tmp280, tmp281, tmp282, tmp283, tmp283, tmp281, tmp276, tmp277, tmp282);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block30, tmp269, tmp270, tmp271, tmp272, tmp273, tmp274, tmp275, tmp276, tmp277, tmp278, tmp279, tmp280, tmp281, tmp282, tmp283, tmp283, tmp281, tmp276, tmp277, tmp282, result_0_0.value(), result_0_1.value());
+    }
+  }
+
+  if (block30.is_used()) {
+    TNode<RawPtrT> tmp284;
+    TNode<RawPtrT> tmp285;
+    TNode<IntPtrT> tmp286;
+    TNode<Context> tmp287;
+    TNode<Object> tmp288;
+    TNode<JSReceiver> tmp289;
+    TNode<Number> tmp290;
+    TNode<JSReceiver> tmp291;
+    TNode<Object> tmp292;
+    TNode<JSReceiver> tmp293;
+    TNode<Number> tmp294;
+    TNode<Number> tmp295;
+    TNode<Smi> tmp296;
+    TNode<JSArray> tmp297;
+    TNode<JSArray> tmp298;
+    TNode<JSArray> tmp299;
+    TNode<Smi> tmp300;
+    TNode<JSReceiver> tmp301;
+    TNode<Object> tmp302;
+    TNode<JSArray> tmp303;
+    TNode<Number> tmp304;
+    TNode<Number> tmp305;
+    ca_.Bind(&block30, &tmp284, &tmp285, &tmp286, &tmp287, &tmp288, &tmp289, &tmp290, &tmp291, &tmp292, &tmp293, &tmp294, &tmp295, &tmp296, &tmp297, &tmp298, &tmp299, &tmp300, &tmp301, &tmp302, &tmp303, &tmp304, &tmp305);
+    ca_.Goto(&block16, tmp284, tmp285, tmp286, tmp287, tmp288, tmp289, tmp290, tmp291, tmp292, tmp293, tmp294, tmp295, tmp304, tmp305);
+  }
+
+  if (block29.is_used()) {
+    TNode<RawPtrT> tmp306;
+    TNode<RawPtrT> tmp307;
+    TNode<IntPtrT> tmp308;
+    TNode<Context> tmp309;
+    TNode<Object> tmp310;
+    TNode<JSReceiver> tmp311;
+    TNode<Number> tmp312;
+    TNode<JSReceiver> tmp313;
+    TNode<Object> tmp314;
+    TNode<JSReceiver> tmp315;
+    TNode<Number> tmp316;
+    TNode<Number> tmp317;
+    TNode<Smi> tmp318;
+    TNode<JSArray> tmp319;
+    TNode<JSArray> tmp320;
+    TNode<JSArray> tmp321;
+    TNode<Smi> tmp322;
+    TNode<JSReceiver> tmp323;
+    TNode<Object> tmp324;
+    TNode<JSArray> tmp325;
+    ca_.Bind(&block29, &tmp306, &tmp307, &tmp308, &tmp309, &tmp310, &tmp311, &tmp312, &tmp313, &tmp314, &tmp315, &tmp316, &tmp317, &tmp318, &tmp319, &tmp320, &tmp321, &tmp322, &tmp323, &tmp324, &tmp325);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 184);
+    arguments.PopAndReturn(tmp315);
+  }
+
+  if (block16.is_used()) {
+    TNode<RawPtrT> tmp326;
+    TNode<RawPtrT> tmp327;
+    TNode<IntPtrT> tmp328;
+    TNode<Context> tmp329;
+    TNode<Object> tmp330;
+    TNode<JSReceiver> tmp331;
+    TNode<Number> tmp332;
+    TNode<JSReceiver> tmp333;
+    TNode<Object> tmp334;
+    TNode<JSReceiver> tmp335;
+    TNode<Number> tmp336;
+    TNode<Number> tmp337;
+    TNode<Number> tmp338;
+    TNode<Number> tmp339;
+    ca_.Bind(&block16, &tmp326, &tmp327, &tmp328, &tmp329, &tmp330, &tmp331, &tmp332, &tmp333, &tmp334, &tmp335, &tmp336, &tmp337, &tmp338, &tmp339);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 187);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 188);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 176);
+    ca_.Goto(&block15, tmp326, tmp327, tmp328, tmp329, tmp330, tmp331, tmp332, tmp333, tmp334, tmp335, tmp338, tmp339, tmp338, tmp339);
+  }
+
+  if (block15.is_used()) {
+    TNode<RawPtrT> tmp340;
+    TNode<RawPtrT> tmp341;
+    TNode<IntPtrT> tmp342;
+    TNode<Context> tmp343;
+    TNode<Object> tmp344;
+    TNode<JSReceiver> tmp345;
+    TNode<Number> tmp346;
+    TNode<JSReceiver> tmp347;
+    TNode<Object> tmp348;
+    TNode<JSReceiver> tmp349;
+    TNode<Number> tmp350;
+    TNode<Number> tmp351;
+    TNode<Number> tmp352;
+    TNode<Number> tmp353;
+    ca_.Bind(&block15, &tmp340, &tmp341, &tmp342, &tmp343, &tmp344, &tmp345, &tmp346, &tmp347, &tmp348, &tmp349, &tmp350, &tmp351, &tmp352, &tmp353);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 191);
+    ca_.Goto(&block11, tmp340, tmp341, tmp342, tmp343, tmp344, tmp345, tmp346, tmp347, tmp348, tmp349, tmp350, tmp351);
+  }
+
+  if (block12.is_used()) {
+    TNode<RawPtrT> tmp354;
+    TNode<RawPtrT> tmp355;
+    TNode<IntPtrT> tmp356;
+    TNode<Context> tmp357;
+    TNode<Object> tmp358;
+    TNode<JSReceiver> tmp359;
+    TNode<Number> tmp360;
+    TNode<JSReceiver> tmp361;
+    TNode<Object> tmp362;
+    TNode<JSReceiver> tmp363;
+    TNode<Number> tmp364;
+    TNode<Number> tmp365;
+    ca_.Bind(&block12, &tmp354, &tmp355, &tmp356, &tmp357, &tmp358, &tmp359, &tmp360, &tmp361, &tmp362, &tmp363, &tmp364, &tmp365);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 192);
+    TNode<Number> tmp366;
+    USE(tmp366);
+    tmp366 = FromConstexpr20UT5ATSmi10HeapNumber17ATconstexpr_int31_161(state_, 0);
+    TNode<JSReceiver> tmp367;
+    USE(tmp367);
+    tmp367 = CodeStubAssembler(state_).ArraySpeciesCreate(TNode<Context>{tmp357}, TNode<Object>{tmp358}, TNode<Number>{tmp366});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 173);
+    ca_.Goto(&block11, tmp354, tmp355, tmp356, tmp357, tmp358, tmp359, tmp360, tmp361, tmp362, tmp367, tmp364, tmp365);
+  }
+
+  if (block11.is_used()) {
+    TNode<RawPtrT> tmp368;
+    TNode<RawPtrT> tmp369;
+    TNode<IntPtrT> tmp370;
+    TNode<Context> tmp371;
+    TNode<Object> tmp372;
+    TNode<JSReceiver> tmp373;
+    TNode<Number> tmp374;
+    TNode<JSReceiver> tmp375;
+    TNode<Object> tmp376;
+    TNode<JSReceiver> tmp377;
+    TNode<Number> tmp378;
+    TNode<Number> tmp379;
+    ca_.Bind(&block11, &tmp368, &tmp369, &tmp370, &tmp371, &tmp372, &tmp373, &tmp374, &tmp375, &tmp376, &tmp377, &tmp378, &tmp379);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 196);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 195);
+    TNode<Object> tmp380;
+    tmp380 = CodeStubAssembler(state_).CallBuiltin(Builtins::kArrayFilterLoopContinuation, tmp371, tmp373, tmp375, tmp376, tmp377, tmp373, tmp378, tmp374, tmp379);
+    USE(tmp380);
+    arguments.PopAndReturn(tmp380);
+  }
+
+  if (block2.is_used()) {
+    TNode<RawPtrT> tmp381;
+    TNode<RawPtrT> tmp382;
+    TNode<IntPtrT> tmp383;
+    TNode<Context> tmp384;
+    TNode<Object> tmp385;
+    ca_.Bind(&block2, &tmp381, &tmp382, &tmp383, &tmp384, &tmp385);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-filter.tq", 199);
+    TNode<IntPtrT> tmp386;
+    USE(tmp386);
+    tmp386 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<Object> tmp387;
+    USE(tmp387);
+    tmp387 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp381}, TNode<RawPtrT>{tmp382}, TNode<IntPtrT>{tmp383}}, TNode<IntPtrT>{tmp386});
+    CodeStubAssembler(state_).ThrowTypeError(TNode<Context>{tmp384}, MessageTemplate::kCalledNonCallable, TNode<Object>{tmp387});
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
+
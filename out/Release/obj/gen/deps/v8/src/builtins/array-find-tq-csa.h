@@ -0,0 +1,17 @@
+#ifndef V8_GEN_TORQUE_GENERATED_______DEPS_V8_SRC_BUILTINS_ARRAY_FIND_TQ_H_
+#define V8_GEN_TORQUE_GENERATED_______DEPS_V8_SRC_BUILTINS_ARRAY_FIND_TQ_H_
+
+#include "src/compiler/code-assembler.h"
+#include "src/codegen/code-stub-assembler.h"
+#include "src/utils/utils.h"
+#include "torque-generated/field-offsets-tq.h"
+#include "torque-generated/csa-types-tq.h"
+
+namespace v8 {
+namespace internal {
+
+TNode<Object> FastArrayFind_5(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<JSReceiver> p_o, TNode<Number> p_len, TNode<JSReceiver> p_callbackfn, TNode<Object> p_thisArg, compiler::CodeAssemblerLabel* label_Bailout, compiler::TypedCodeAssemblerVariable<Smi>* label_Bailout_parameter_0);
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_GEN_TORQUE_GENERATED_______DEPS_V8_SRC_BUILTINS_ARRAY_FIND_TQ_H_
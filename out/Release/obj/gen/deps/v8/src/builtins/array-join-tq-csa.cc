@@ -0,0 +1,12573 @@
+#include "src/builtins/builtins-array-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-utils-gen.h"
+#include "src/builtins/builtins.h"
+#include "src/codegen/code-factory.h"
+#include "src/heap/factory-inl.h"
+#include "src/objects/arguments.h"
+#include "src/objects/bigint.h"
+#include "src/objects/elements-kind.h"
+#include "src/objects/free-space.h"
+#include "src/objects/js-generator.h"
+#include "src/objects/js-promise.h"
+#include "src/objects/js-regexp-string-iterator.h"
+#include "src/objects/js-weak-refs.h"
+#include "src/objects/objects.h"
+#include "src/objects/source-text-module.h"
+#include "src/objects/stack-frame-info.h"
+#include "src/objects/synthetic-module.h"
+#include "src/objects/template-objects.h"
+#include "src/builtins/builtins-bigint-gen.h"
+#include "src/builtins/builtins-collections-gen.h"
+#include "src/builtins/builtins-data-view-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-iterator-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-string-gen.h"
+#include "src/builtins/builtins-string-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-constructor-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "torque-generated/../../deps/v8/src/builtins/arguments-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-copywithin-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-join-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-lastindexof-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-map-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-right-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reverse-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-shift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-splice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-unshift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/base-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/bigint-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/boolean-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/collections-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/data-view-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/extras-utils-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/frames-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/growable-fixed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/internal-coverage-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/math-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-fromentries-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-constructor-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-delete-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-has-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-is-extensible-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-prevent-extensions-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revocable-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revoke-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/reflect-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-exec-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-all-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-replace-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-search-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-source-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-split-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-test-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-endswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-html-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-pad-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-repeat-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-startswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-substring-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/torque-internal-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-createtypedarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduceright-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-subarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/third_party/v8/builtins/array-sort-tq-csa.h"
+#include "torque-generated/../../deps/v8/test/torque/test-torque-tq-csa.h"
+
+namespace v8 {
+namespace internal {
+
+TF_BUILTIN(LoadJoinElement20ATDictionaryElements, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<JSReceiver> parameter1 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<0>()));
+  USE(parameter1);
+  TNode<Number> parameter2 = UncheckedCast<Number>(Parameter(Descriptor::ParameterIndex<1>()));
+  USE(parameter2);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSArray, NumberDictionary, NumberDictionary, IntPtrT> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSArray, NumberDictionary, NumberDictionary, IntPtrT> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSArray, NumberDictionary, NumberDictionary, IntPtrT, Object> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSArray, NumberDictionary> block4(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSArray, NumberDictionary> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<Number> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 21);
+    TNode<JSArray> tmp3;
+    USE(tmp3);
+    tmp3 = UnsafeCast7JSArray_1368(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 22);
+    TNode<IntPtrT> tmp4 = ca_.IntPtrConstant(JSObject::kElementsOffset);
+    USE(tmp4);
+    TNode<FixedArrayBase>tmp5 = CodeStubAssembler(state_).LoadReference<FixedArrayBase>(CodeStubAssembler::Reference{tmp3, tmp4});
+    TNode<NumberDictionary> tmp6;
+    USE(tmp6);
+    tmp6 = UnsafeCast16NumberDictionary_1369(state_, TNode<Context>{tmp0}, TNode<Object>{tmp5});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 24);
+    TNode<UintPtrT> tmp7;
+    USE(tmp7);
+    tmp7 = Convert9ATuintptr20UT5ATSmi10HeapNumber_198(state_, TNode<Number>{tmp2});
+    TNode<IntPtrT> tmp8;
+    USE(tmp8);
+    tmp8 = CodeStubAssembler(state_).Signed(TNode<UintPtrT>{tmp7});
+    TNode<Object> tmp9;
+    USE(tmp9);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    compiler::CodeAssemblerLabel label1(&ca_);
+    tmp9 = CodeStubAssembler(state_).BasicLoadNumberDictionaryElement(TNode<NumberDictionary>{tmp6}, TNode<IntPtrT>{tmp8}, &label0, &label1);
+    ca_.Goto(&block5, tmp0, tmp1, tmp2, tmp3, tmp6, tmp6, tmp8, tmp9);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block6, tmp0, tmp1, tmp2, tmp3, tmp6, tmp6, tmp8);
+    }
+    if (label1.is_used()) {
+      ca_.Bind(&label1);
+      ca_.Goto(&block7, tmp0, tmp1, tmp2, tmp3, tmp6, tmp6, tmp8);
+    }
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp10;
+    TNode<JSReceiver> tmp11;
+    TNode<Number> tmp12;
+    TNode<JSArray> tmp13;
+    TNode<NumberDictionary> tmp14;
+    TNode<NumberDictionary> tmp15;
+    TNode<IntPtrT> tmp16;
+    ca_.Bind(&block6, &tmp10, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16);
+    ca_.Goto(&block4, tmp10, tmp11, tmp12, tmp13, tmp14);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp17;
+    TNode<JSReceiver> tmp18;
+    TNode<Number> tmp19;
+    TNode<JSArray> tmp20;
+    TNode<NumberDictionary> tmp21;
+    TNode<NumberDictionary> tmp22;
+    TNode<IntPtrT> tmp23;
+    ca_.Bind(&block7, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23);
+    ca_.Goto(&block2, tmp17, tmp18, tmp19, tmp20, tmp21);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp24;
+    TNode<JSReceiver> tmp25;
+    TNode<Number> tmp26;
+    TNode<JSArray> tmp27;
+    TNode<NumberDictionary> tmp28;
+    TNode<NumberDictionary> tmp29;
+    TNode<IntPtrT> tmp30;
+    TNode<Object> tmp31;
+    ca_.Bind(&block5, &tmp24, &tmp25, &tmp26, &tmp27, &tmp28, &tmp29, &tmp30, &tmp31);
+    CodeStubAssembler(state_).Return(tmp31);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp32;
+    TNode<JSReceiver> tmp33;
+    TNode<Number> tmp34;
+    TNode<JSArray> tmp35;
+    TNode<NumberDictionary> tmp36;
+    ca_.Bind(&block4, &tmp32, &tmp33, &tmp34, &tmp35, &tmp36);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 28);
+    TNode<Object> tmp37;
+    USE(tmp37);
+    tmp37 = CodeStubAssembler(state_).GetProperty(TNode<Context>{tmp32}, TNode<Object>{tmp33}, TNode<Object>{tmp34});
+    CodeStubAssembler(state_).Return(tmp37);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp38;
+    TNode<JSReceiver> tmp39;
+    TNode<Number> tmp40;
+    TNode<JSArray> tmp41;
+    TNode<NumberDictionary> tmp42;
+    ca_.Bind(&block2, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 31);
+    TNode<String> tmp43;
+    USE(tmp43);
+    tmp43 = kEmptyString_67(state_);
+    CodeStubAssembler(state_).Return(tmp43);
+  }
+}
+
+TF_BUILTIN(LoadJoinElement25ATFastSmiOrObjectElements, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<JSReceiver> parameter1 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<0>()));
+  USE(parameter1);
+  TNode<Number> parameter2 = UncheckedCast<Number>(Parameter(Descriptor::ParameterIndex<1>()));
+  USE(parameter2);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSArray, FixedArray, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSArray, FixedArray, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSArray, FixedArray, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSArray, FixedArray, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSArray, FixedArray, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSArray, FixedArray, FixedArray, IntPtrT, IntPtrT, Smi, Smi, HeapObject, IntPtrT> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSArray, FixedArray, Object> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSArray, FixedArray, Object> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSArray, FixedArray, Object, String> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSArray, FixedArray, Object, Object> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<Number> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 37);
+    TNode<JSArray> tmp3;
+    USE(tmp3);
+    tmp3 = UnsafeCast7JSArray_1368(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 38);
+    TNode<IntPtrT> tmp4 = ca_.IntPtrConstant(JSObject::kElementsOffset);
+    USE(tmp4);
+    TNode<FixedArrayBase>tmp5 = CodeStubAssembler(state_).LoadReference<FixedArrayBase>(CodeStubAssembler::Reference{tmp3, tmp4});
+    TNode<FixedArray> tmp6;
+    USE(tmp6);
+    tmp6 = UnsafeCast10FixedArray_1370(state_, TNode<Context>{tmp0}, TNode<Object>{tmp5});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 39);
+    TNode<IntPtrT> tmp7 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp7);
+    TNode<IntPtrT> tmp8 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp8);
+    TNode<Smi>tmp9 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp6, tmp8});
+    TNode<IntPtrT> tmp10;
+    USE(tmp10);
+    tmp10 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp9});
+    TNode<Smi> tmp11;
+    USE(tmp11);
+    tmp11 = UnsafeCast5ATSmi_1371(state_, TNode<Context>{tmp0}, TNode<Object>{tmp2});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 55);
+    TNode<IntPtrT> tmp12;
+    USE(tmp12);
+    tmp12 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp11});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 56);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp13;
+    USE(tmp13);
+    tmp13 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp12});
+    TNode<UintPtrT> tmp14;
+    USE(tmp14);
+    tmp14 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp10});
+    TNode<BoolT> tmp15;
+    USE(tmp15);
+    tmp15 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp13}, TNode<UintPtrT>{tmp14});
+    ca_.Branch(tmp15, &block5, &block6, tmp0, tmp1, tmp2, tmp3, tmp6, tmp6, tmp7, tmp10, tmp11, tmp11, tmp12, tmp6, tmp7, tmp10, tmp12, tmp12);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp16;
+    TNode<JSReceiver> tmp17;
+    TNode<Number> tmp18;
+    TNode<JSArray> tmp19;
+    TNode<FixedArray> tmp20;
+    TNode<FixedArray> tmp21;
+    TNode<IntPtrT> tmp22;
+    TNode<IntPtrT> tmp23;
+    TNode<Smi> tmp24;
+    TNode<Smi> tmp25;
+    TNode<IntPtrT> tmp26;
+    TNode<HeapObject> tmp27;
+    TNode<IntPtrT> tmp28;
+    TNode<IntPtrT> tmp29;
+    TNode<IntPtrT> tmp30;
+    TNode<IntPtrT> tmp31;
+    ca_.Bind(&block5, &tmp16, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27, &tmp28, &tmp29, &tmp30, &tmp31);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp32;
+    USE(tmp32);
+    tmp32 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp33;
+    USE(tmp33);
+    tmp33 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp31}, TNode<IntPtrT>{tmp32});
+    TNode<IntPtrT> tmp34;
+    USE(tmp34);
+    tmp34 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp28}, TNode<IntPtrT>{tmp33});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp35;
+    USE(tmp35);
+    TNode<IntPtrT> tmp36;
+    USE(tmp36);
+    std::tie(tmp35, tmp36) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp27}, TNode<IntPtrT>{tmp34}).Flatten();
+    ca_.Goto(&block4, tmp16, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27, tmp28, tmp29, tmp30, tmp31, tmp35, tmp36);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp37;
+    TNode<JSReceiver> tmp38;
+    TNode<Number> tmp39;
+    TNode<JSArray> tmp40;
+    TNode<FixedArray> tmp41;
+    TNode<FixedArray> tmp42;
+    TNode<IntPtrT> tmp43;
+    TNode<IntPtrT> tmp44;
+    TNode<Smi> tmp45;
+    TNode<Smi> tmp46;
+    TNode<IntPtrT> tmp47;
+    TNode<HeapObject> tmp48;
+    TNode<IntPtrT> tmp49;
+    TNode<IntPtrT> tmp50;
+    TNode<IntPtrT> tmp51;
+    TNode<IntPtrT> tmp52;
+    ca_.Bind(&block6, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block3, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42, tmp43, tmp44, tmp45, tmp46, tmp47);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp53;
+    TNode<JSReceiver> tmp54;
+    TNode<Number> tmp55;
+    TNode<JSArray> tmp56;
+    TNode<FixedArray> tmp57;
+    TNode<FixedArray> tmp58;
+    TNode<IntPtrT> tmp59;
+    TNode<IntPtrT> tmp60;
+    TNode<Smi> tmp61;
+    TNode<Smi> tmp62;
+    TNode<IntPtrT> tmp63;
+    TNode<HeapObject> tmp64;
+    TNode<IntPtrT> tmp65;
+    TNode<IntPtrT> tmp66;
+    TNode<IntPtrT> tmp67;
+    TNode<IntPtrT> tmp68;
+    TNode<HeapObject> tmp69;
+    TNode<IntPtrT> tmp70;
+    ca_.Bind(&block4, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 56);
+    ca_.Goto(&block2, tmp53, tmp54, tmp55, tmp56, tmp57, tmp58, tmp59, tmp60, tmp61, tmp62, tmp63, tmp69, tmp70);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp71;
+    TNode<JSReceiver> tmp72;
+    TNode<Number> tmp73;
+    TNode<JSArray> tmp74;
+    TNode<FixedArray> tmp75;
+    TNode<FixedArray> tmp76;
+    TNode<IntPtrT> tmp77;
+    TNode<IntPtrT> tmp78;
+    TNode<Smi> tmp79;
+    TNode<Smi> tmp80;
+    TNode<IntPtrT> tmp81;
+    ca_.Bind(&block3, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp82;
+    TNode<JSReceiver> tmp83;
+    TNode<Number> tmp84;
+    TNode<JSArray> tmp85;
+    TNode<FixedArray> tmp86;
+    TNode<FixedArray> tmp87;
+    TNode<IntPtrT> tmp88;
+    TNode<IntPtrT> tmp89;
+    TNode<Smi> tmp90;
+    TNode<Smi> tmp91;
+    TNode<IntPtrT> tmp92;
+    TNode<HeapObject> tmp93;
+    TNode<IntPtrT> tmp94;
+    ca_.Bind(&block2, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94);
+    ca_.Goto(&block1, tmp82, tmp83, tmp84, tmp85, tmp86, tmp87, tmp88, tmp89, tmp90, tmp91, tmp93, tmp94);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp95;
+    TNode<JSReceiver> tmp96;
+    TNode<Number> tmp97;
+    TNode<JSArray> tmp98;
+    TNode<FixedArray> tmp99;
+    TNode<FixedArray> tmp100;
+    TNode<IntPtrT> tmp101;
+    TNode<IntPtrT> tmp102;
+    TNode<Smi> tmp103;
+    TNode<Smi> tmp104;
+    TNode<HeapObject> tmp105;
+    TNode<IntPtrT> tmp106;
+    ca_.Bind(&block1, &tmp95, &tmp96, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104, &tmp105, &tmp106);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 39);
+    TNode<Object>tmp107 = CodeStubAssembler(state_).LoadReference<Object>(CodeStubAssembler::Reference{tmp105, tmp106});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 40);
+    TNode<Oddball> tmp108;
+    USE(tmp108);
+    tmp108 = TheHole_62(state_);
+    TNode<BoolT> tmp109;
+    USE(tmp109);
+    tmp109 = CodeStubAssembler(state_).TaggedEqual(TNode<Object>{tmp107}, TNode<HeapObject>{tmp108});
+    ca_.Branch(tmp109, &block8, &block9, tmp95, tmp96, tmp97, tmp98, tmp99, tmp107);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp110;
+    TNode<JSReceiver> tmp111;
+    TNode<Number> tmp112;
+    TNode<JSArray> tmp113;
+    TNode<FixedArray> tmp114;
+    TNode<Object> tmp115;
+    ca_.Bind(&block8, &tmp110, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115);
+    TNode<String> tmp116;
+    USE(tmp116);
+    tmp116 = kEmptyString_67(state_);
+    ca_.Goto(&block11, tmp110, tmp111, tmp112, tmp113, tmp114, tmp115, tmp116);
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp117;
+    TNode<JSReceiver> tmp118;
+    TNode<Number> tmp119;
+    TNode<JSArray> tmp120;
+    TNode<FixedArray> tmp121;
+    TNode<Object> tmp122;
+    ca_.Bind(&block9, &tmp117, &tmp118, &tmp119, &tmp120, &tmp121, &tmp122);
+    TNode<Object> tmp123;
+    USE(tmp123);
+    tmp123 = UnsafeCast90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol_1373(state_, TNode<Context>{tmp117}, TNode<Object>{tmp122});
+    ca_.Goto(&block10, tmp117, tmp118, tmp119, tmp120, tmp121, tmp122, tmp123);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp124;
+    TNode<JSReceiver> tmp125;
+    TNode<Number> tmp126;
+    TNode<JSArray> tmp127;
+    TNode<FixedArray> tmp128;
+    TNode<Object> tmp129;
+    TNode<String> tmp130;
+    ca_.Bind(&block11, &tmp124, &tmp125, &tmp126, &tmp127, &tmp128, &tmp129, &tmp130);
+    ca_.Goto(&block10, tmp124, tmp125, tmp126, tmp127, tmp128, tmp129, tmp130);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp131;
+    TNode<JSReceiver> tmp132;
+    TNode<Number> tmp133;
+    TNode<JSArray> tmp134;
+    TNode<FixedArray> tmp135;
+    TNode<Object> tmp136;
+    TNode<Object> tmp137;
+    ca_.Bind(&block10, &tmp131, &tmp132, &tmp133, &tmp134, &tmp135, &tmp136, &tmp137);
+    CodeStubAssembler(state_).Return(tmp137);
+  }
+}
+
+TF_BUILTIN(LoadJoinElement20ATFastDoubleElements, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<JSReceiver> parameter1 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<0>()));
+  USE(parameter1);
+  TNode<Number> parameter2 = UncheckedCast<Number>(Parameter(Descriptor::ParameterIndex<1>()));
+  USE(parameter2);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSArray, FixedDoubleArray, FixedDoubleArray, Smi> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSArray, FixedDoubleArray, FixedDoubleArray, Smi, Float64T> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSArray, FixedDoubleArray> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSArray, FixedDoubleArray, Float64T> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<Number> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 45);
+    TNode<JSArray> tmp3;
+    USE(tmp3);
+    tmp3 = UnsafeCast7JSArray_1368(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 47);
+    TNode<IntPtrT> tmp4 = ca_.IntPtrConstant(JSObject::kElementsOffset);
+    USE(tmp4);
+    TNode<FixedArrayBase>tmp5 = CodeStubAssembler(state_).LoadReference<FixedArrayBase>(CodeStubAssembler::Reference{tmp3, tmp4});
+    TNode<FixedDoubleArray> tmp6;
+    USE(tmp6);
+    tmp6 = UnsafeCast16FixedDoubleArray_1374(state_, TNode<Context>{tmp0}, TNode<Object>{tmp5});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 46);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 49);
+    TNode<Smi> tmp7;
+    USE(tmp7);
+    tmp7 = UnsafeCast5ATSmi_1371(state_, TNode<Context>{tmp0}, TNode<Object>{tmp2});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 48);
+    TNode<Float64T> tmp8;
+    USE(tmp8);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp8 = CodeStubAssembler(state_).LoadDoubleWithHoleCheck(TNode<FixedDoubleArray>{tmp6}, TNode<Smi>{tmp7}, &label0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp2, tmp3, tmp6, tmp6, tmp7, tmp8);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block4, tmp0, tmp1, tmp2, tmp3, tmp6, tmp6, tmp7);
+    }
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp9;
+    TNode<JSReceiver> tmp10;
+    TNode<Number> tmp11;
+    TNode<JSArray> tmp12;
+    TNode<FixedDoubleArray> tmp13;
+    TNode<FixedDoubleArray> tmp14;
+    TNode<Smi> tmp15;
+    ca_.Bind(&block4, &tmp9, &tmp10, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15);
+    ca_.Goto(&block2, tmp9, tmp10, tmp11, tmp12, tmp13);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp16;
+    TNode<JSReceiver> tmp17;
+    TNode<Number> tmp18;
+    TNode<JSArray> tmp19;
+    TNode<FixedDoubleArray> tmp20;
+    TNode<FixedDoubleArray> tmp21;
+    TNode<Smi> tmp22;
+    TNode<Float64T> tmp23;
+    ca_.Bind(&block3, &tmp16, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23);
+    ca_.Goto(&block1, tmp16, tmp17, tmp18, tmp19, tmp20, tmp23);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp24;
+    TNode<JSReceiver> tmp25;
+    TNode<Number> tmp26;
+    TNode<JSArray> tmp27;
+    TNode<FixedDoubleArray> tmp28;
+    ca_.Bind(&block2, &tmp24, &tmp25, &tmp26, &tmp27, &tmp28);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 49);
+    TNode<String> tmp29;
+    USE(tmp29);
+    tmp29 = kEmptyString_67(state_);
+    CodeStubAssembler(state_).Return(tmp29);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp30;
+    TNode<JSReceiver> tmp31;
+    TNode<Number> tmp32;
+    TNode<JSArray> tmp33;
+    TNode<FixedDoubleArray> tmp34;
+    TNode<Float64T> tmp35;
+    ca_.Bind(&block1, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34, &tmp35);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 48);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 50);
+    TNode<HeapNumber> tmp36;
+    USE(tmp36);
+    tmp36 = CodeStubAssembler(state_).AllocateHeapNumberWithValue(TNode<Float64T>{tmp35});
+    CodeStubAssembler(state_).Return(tmp36);
+  }
+}
+
+TF_BUILTIN(ConvertToLocaleString, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = UncheckedCast<Object>(Parameter(Descriptor::ParameterIndex<0>()));
+  USE(parameter1);
+  TNode<Object> parameter2 = UncheckedCast<Object>(Parameter(Descriptor::ParameterIndex<1>()));
+  USE(parameter2);
+  TNode<Object> parameter3 = UncheckedCast<Object>(Parameter(Descriptor::ParameterIndex<2>()));
+  USE(parameter3);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, JSReceiver, Object> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, JSReceiver, Object> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, JSReceiver, Object> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, JSReceiver, Object> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, JSReceiver, Object> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, JSReceiver, Object> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2, parameter3);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    TNode<Object> tmp2;
+    TNode<Object> tmp3;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 65);
+    TNode<BoolT> tmp4;
+    USE(tmp4);
+    tmp4 = CodeStubAssembler(state_).IsNullOrUndefined(TNode<Object>{tmp1});
+    ca_.Branch(tmp4, &block1, &block2, tmp0, tmp1, tmp2, tmp3);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp5;
+    TNode<Object> tmp6;
+    TNode<Object> tmp7;
+    TNode<Object> tmp8;
+    ca_.Bind(&block1, &tmp5, &tmp6, &tmp7, &tmp8);
+    TNode<String> tmp9;
+    USE(tmp9);
+    tmp9 = kEmptyString_67(state_);
+    CodeStubAssembler(state_).Return(tmp9);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp10;
+    TNode<Object> tmp11;
+    TNode<Object> tmp12;
+    TNode<Object> tmp13;
+    ca_.Bind(&block2, &tmp10, &tmp11, &tmp12, &tmp13);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 67);
+    TNode<Object> tmp14;
+    USE(tmp14);
+    tmp14 = FromConstexpr90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol18ATconstexpr_string_172(state_, "toLocaleString");
+    TNode<Object> tmp15;
+    USE(tmp15);
+    tmp15 = CodeStubAssembler(state_).GetProperty(TNode<Context>{tmp10}, TNode<Object>{tmp11}, TNode<Object>{tmp14});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 69);
+    TNode<JSReceiver> tmp16;
+    USE(tmp16);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp16 = Cast71UT19ATCallableApiObject17ATCallableJSProxy15JSBoundFunction10JSFunction_1366(state_, TNode<Context>{tmp10}, TNode<Object>{tmp15}, &label0);
+    ca_.Goto(&block5, tmp10, tmp11, tmp12, tmp13, tmp15, tmp15, tmp16);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block6, tmp10, tmp11, tmp12, tmp13, tmp15, tmp15);
+    }
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp17;
+    TNode<Object> tmp18;
+    TNode<Object> tmp19;
+    TNode<Object> tmp20;
+    TNode<Object> tmp21;
+    TNode<Object> tmp22;
+    ca_.Bind(&block6, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21, &tmp22);
+    ca_.Goto(&block4, tmp17, tmp18, tmp19, tmp20, tmp21);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp23;
+    TNode<Object> tmp24;
+    TNode<Object> tmp25;
+    TNode<Object> tmp26;
+    TNode<Object> tmp27;
+    TNode<Object> tmp28;
+    TNode<JSReceiver> tmp29;
+    ca_.Bind(&block5, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27, &tmp28, &tmp29);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 70);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 71);
+    TNode<BoolT> tmp30;
+    USE(tmp30);
+    tmp30 = CodeStubAssembler(state_).IsNullOrUndefined(TNode<Object>{tmp25});
+    ca_.Branch(tmp30, &block7, &block8, tmp23, tmp24, tmp25, tmp26, tmp27, tmp29, ca_.Uninitialized<Object>());
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp31;
+    TNode<Object> tmp32;
+    TNode<Object> tmp33;
+    TNode<Object> tmp34;
+    TNode<Object> tmp35;
+    TNode<JSReceiver> tmp36;
+    TNode<Object> tmp37;
+    ca_.Bind(&block7, &tmp31, &tmp32, &tmp33, &tmp34, &tmp35, &tmp36, &tmp37);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 72);
+    TNode<Object> tmp38;
+    USE(tmp38);
+    tmp38 = CodeStubAssembler(state_).Call(TNode<Context>{tmp31}, TNode<JSReceiver>{tmp36}, TNode<Object>{tmp32});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 71);
+    ca_.Goto(&block9, tmp31, tmp32, tmp33, tmp34, tmp35, tmp36, tmp38);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp39;
+    TNode<Object> tmp40;
+    TNode<Object> tmp41;
+    TNode<Object> tmp42;
+    TNode<Object> tmp43;
+    TNode<JSReceiver> tmp44;
+    TNode<Object> tmp45;
+    ca_.Bind(&block8, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44, &tmp45);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 73);
+    TNode<BoolT> tmp46;
+    USE(tmp46);
+    tmp46 = CodeStubAssembler(state_).IsNullOrUndefined(TNode<Object>{tmp42});
+    ca_.Branch(tmp46, &block10, &block11, tmp39, tmp40, tmp41, tmp42, tmp43, tmp44, tmp45);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp47;
+    TNode<Object> tmp48;
+    TNode<Object> tmp49;
+    TNode<Object> tmp50;
+    TNode<Object> tmp51;
+    TNode<JSReceiver> tmp52;
+    TNode<Object> tmp53;
+    ca_.Bind(&block10, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 74);
+    TNode<Object> tmp54;
+    USE(tmp54);
+    tmp54 = CodeStubAssembler(state_).Call(TNode<Context>{tmp47}, TNode<JSReceiver>{tmp52}, TNode<Object>{tmp48}, TNode<Object>{tmp49});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 73);
+    ca_.Goto(&block12, tmp47, tmp48, tmp49, tmp50, tmp51, tmp52, tmp54);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp55;
+    TNode<Object> tmp56;
+    TNode<Object> tmp57;
+    TNode<Object> tmp58;
+    TNode<Object> tmp59;
+    TNode<JSReceiver> tmp60;
+    TNode<Object> tmp61;
+    ca_.Bind(&block11, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 76);
+    TNode<Object> tmp62;
+    USE(tmp62);
+    tmp62 = CodeStubAssembler(state_).Call(TNode<Context>{tmp55}, TNode<JSReceiver>{tmp60}, TNode<Object>{tmp56}, TNode<Object>{tmp57}, TNode<Object>{tmp58});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 73);
+    ca_.Goto(&block12, tmp55, tmp56, tmp57, tmp58, tmp59, tmp60, tmp62);
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp63;
+    TNode<Object> tmp64;
+    TNode<Object> tmp65;
+    TNode<Object> tmp66;
+    TNode<Object> tmp67;
+    TNode<JSReceiver> tmp68;
+    TNode<Object> tmp69;
+    ca_.Bind(&block12, &tmp63, &tmp64, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 71);
+    ca_.Goto(&block9, tmp63, tmp64, tmp65, tmp66, tmp67, tmp68, tmp69);
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp70;
+    TNode<Object> tmp71;
+    TNode<Object> tmp72;
+    TNode<Object> tmp73;
+    TNode<Object> tmp74;
+    TNode<JSReceiver> tmp75;
+    TNode<Object> tmp76;
+    ca_.Bind(&block9, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 78);
+    TNode<String> tmp77;
+    USE(tmp77);
+    tmp77 = CodeStubAssembler(state_).ToString_Inline(TNode<Context>{tmp70}, TNode<Object>{tmp76});
+    CodeStubAssembler(state_).Return(tmp77);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp78;
+    TNode<Object> tmp79;
+    TNode<Object> tmp80;
+    TNode<Object> tmp81;
+    TNode<Object> tmp82;
+    ca_.Bind(&block4, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 81);
+    CodeStubAssembler(state_).ThrowTypeError(TNode<Context>{tmp78}, MessageTemplate::kCalledNonCallable, TNode<Object>{tmp82});
+  }
+}
+
+TNode<BoolT> CannotUseSameArrayAccessor7JSArray_8(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<BuiltinPtr> p_loadFn, TNode<JSReceiver> p_receiver, TNode<Map> p_originalMap, TNode<Number> p_originalLen) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, BuiltinPtr, JSReceiver, Map, Number> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, BuiltinPtr, JSReceiver, Map, Number> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, BuiltinPtr, JSReceiver, Map, Number> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, BuiltinPtr, JSReceiver, Map, Number, JSArray> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, BuiltinPtr, JSReceiver, Map, Number, JSArray> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, BuiltinPtr, JSReceiver, Map, Number, JSArray> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, BuiltinPtr, JSReceiver, Map, Number, JSArray> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, BuiltinPtr, JSReceiver, Map, Number, JSArray> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, BuiltinPtr, JSReceiver, Map, Number, JSArray> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, BuiltinPtr, JSReceiver, Map, Number, BoolT> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, BuiltinPtr, JSReceiver, Map, Number, BoolT> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_loadFn, p_receiver, p_originalMap, p_originalLen);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<BuiltinPtr> tmp1;
+    TNode<JSReceiver> tmp2;
+    TNode<Map> tmp3;
+    TNode<Number> tmp4;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 94);
+    TNode<BoolT> tmp5;
+    USE(tmp5);
+    tmp5 = CodeStubAssembler(state_).SmiEqual(TNode<Smi>{tmp1}, TNode<Smi>{ca_.UncheckedCast<BuiltinPtr>(ca_.SmiConstant(Builtins::kLoadJoinElement25ATGenericElementsAccessor))});
+    ca_.Branch(tmp5, &block2, &block3, tmp0, tmp1, tmp2, tmp3, tmp4);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp6;
+    TNode<BuiltinPtr> tmp7;
+    TNode<JSReceiver> tmp8;
+    TNode<Map> tmp9;
+    TNode<Number> tmp10;
+    ca_.Bind(&block2, &tmp6, &tmp7, &tmp8, &tmp9, &tmp10);
+    TNode<BoolT> tmp11;
+    USE(tmp11);
+    tmp11 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, false);
+    ca_.Goto(&block1, tmp6, tmp7, tmp8, tmp9, tmp10, tmp11);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp12;
+    TNode<BuiltinPtr> tmp13;
+    TNode<JSReceiver> tmp14;
+    TNode<Map> tmp15;
+    TNode<Number> tmp16;
+    ca_.Bind(&block3, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 96);
+    TNode<JSArray> tmp17;
+    USE(tmp17);
+    tmp17 = UnsafeCast7JSArray_1368(state_, TNode<Context>{tmp12}, TNode<Object>{tmp14});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 97);
+    TNode<IntPtrT> tmp18 = ca_.IntPtrConstant(HeapObject::kMapOffset);
+    USE(tmp18);
+    TNode<Map>tmp19 = CodeStubAssembler(state_).LoadReference<Map>(CodeStubAssembler::Reference{tmp17, tmp18});
+    TNode<BoolT> tmp20;
+    USE(tmp20);
+    tmp20 = CodeStubAssembler(state_).TaggedNotEqual(TNode<HeapObject>{tmp15}, TNode<HeapObject>{tmp19});
+    ca_.Branch(tmp20, &block4, &block5, tmp12, tmp13, tmp14, tmp15, tmp16, tmp17);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp21;
+    TNode<BuiltinPtr> tmp22;
+    TNode<JSReceiver> tmp23;
+    TNode<Map> tmp24;
+    TNode<Number> tmp25;
+    TNode<JSArray> tmp26;
+    ca_.Bind(&block4, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26);
+    TNode<BoolT> tmp27;
+    USE(tmp27);
+    tmp27 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, true);
+    ca_.Goto(&block1, tmp21, tmp22, tmp23, tmp24, tmp25, tmp27);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp28;
+    TNode<BuiltinPtr> tmp29;
+    TNode<JSReceiver> tmp30;
+    TNode<Map> tmp31;
+    TNode<Number> tmp32;
+    TNode<JSArray> tmp33;
+    ca_.Bind(&block5, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 98);
+    TNode<IntPtrT> tmp34 = ca_.IntPtrConstant(JSArray::kLengthOffset);
+    USE(tmp34);
+    TNode<Number>tmp35 = CodeStubAssembler(state_).LoadReference<Number>(CodeStubAssembler::Reference{tmp33, tmp34});
+    TNode<BoolT> tmp36;
+    USE(tmp36);
+    tmp36 = IsNumberNotEqual_74(state_, TNode<Number>{tmp32}, TNode<Number>{tmp35});
+    ca_.Branch(tmp36, &block6, &block7, tmp28, tmp29, tmp30, tmp31, tmp32, tmp33);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp37;
+    TNode<BuiltinPtr> tmp38;
+    TNode<JSReceiver> tmp39;
+    TNode<Map> tmp40;
+    TNode<Number> tmp41;
+    TNode<JSArray> tmp42;
+    ca_.Bind(&block6, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42);
+    TNode<BoolT> tmp43;
+    USE(tmp43);
+    tmp43 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, true);
+    ca_.Goto(&block1, tmp37, tmp38, tmp39, tmp40, tmp41, tmp43);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp44;
+    TNode<BuiltinPtr> tmp45;
+    TNode<JSReceiver> tmp46;
+    TNode<Map> tmp47;
+    TNode<Number> tmp48;
+    TNode<JSArray> tmp49;
+    ca_.Bind(&block7, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 99);
+    TNode<BoolT> tmp50;
+    USE(tmp50);
+    tmp50 = CodeStubAssembler(state_).IsNoElementsProtectorCellInvalid();
+    ca_.Branch(tmp50, &block8, &block9, tmp44, tmp45, tmp46, tmp47, tmp48, tmp49);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp51;
+    TNode<BuiltinPtr> tmp52;
+    TNode<JSReceiver> tmp53;
+    TNode<Map> tmp54;
+    TNode<Number> tmp55;
+    TNode<JSArray> tmp56;
+    ca_.Bind(&block8, &tmp51, &tmp52, &tmp53, &tmp54, &tmp55, &tmp56);
+    TNode<BoolT> tmp57;
+    USE(tmp57);
+    tmp57 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, true);
+    ca_.Goto(&block1, tmp51, tmp52, tmp53, tmp54, tmp55, tmp57);
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp58;
+    TNode<BuiltinPtr> tmp59;
+    TNode<JSReceiver> tmp60;
+    TNode<Map> tmp61;
+    TNode<Number> tmp62;
+    TNode<JSArray> tmp63;
+    ca_.Bind(&block9, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 100);
+    TNode<BoolT> tmp64;
+    USE(tmp64);
+    tmp64 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, false);
+    ca_.Goto(&block1, tmp58, tmp59, tmp60, tmp61, tmp62, tmp64);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp65;
+    TNode<BuiltinPtr> tmp66;
+    TNode<JSReceiver> tmp67;
+    TNode<Map> tmp68;
+    TNode<Number> tmp69;
+    TNode<BoolT> tmp70;
+    ca_.Bind(&block1, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 91);
+    ca_.Goto(&block10, tmp65, tmp66, tmp67, tmp68, tmp69, tmp70);
+  }
+
+    TNode<Context> tmp71;
+    TNode<BuiltinPtr> tmp72;
+    TNode<JSReceiver> tmp73;
+    TNode<Map> tmp74;
+    TNode<Number> tmp75;
+    TNode<BoolT> tmp76;
+    ca_.Bind(&block10, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76);
+  return TNode<BoolT>{tmp76};
+}
+
+TNode<BoolT> CannotUseSameArrayAccessor12JSTypedArray_9(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<BuiltinPtr> p__loadFn, TNode<JSReceiver> p_receiver, TNode<Map> p__initialMap, TNode<Number> p__initialLen) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, BuiltinPtr, JSReceiver, Map, Number> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, BuiltinPtr, JSReceiver, Map, Number, BoolT> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, BuiltinPtr, JSReceiver, Map, Number, BoolT> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p__loadFn, p_receiver, p__initialMap, p__initialLen);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<BuiltinPtr> tmp1;
+    TNode<JSReceiver> tmp2;
+    TNode<Map> tmp3;
+    TNode<Number> tmp4;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 106);
+    TNode<JSTypedArray> tmp5;
+    USE(tmp5);
+    tmp5 = UnsafeCast12JSTypedArray_1375(state_, TNode<Context>{tmp0}, TNode<Object>{tmp2});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 107);
+    TNode<IntPtrT> tmp6 = ca_.IntPtrConstant(JSArrayBufferView::kBufferOffset);
+    USE(tmp6);
+    TNode<JSArrayBuffer>tmp7 = CodeStubAssembler(state_).LoadReference<JSArrayBuffer>(CodeStubAssembler::Reference{tmp5, tmp6});
+    TNode<BoolT> tmp8;
+    USE(tmp8);
+    tmp8 = CodeStubAssembler(state_).IsDetachedBuffer(TNode<JSArrayBuffer>{tmp7});
+    ca_.Goto(&block1, tmp0, tmp1, tmp2, tmp3, tmp4, tmp8);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp9;
+    TNode<BuiltinPtr> tmp10;
+    TNode<JSReceiver> tmp11;
+    TNode<Map> tmp12;
+    TNode<Number> tmp13;
+    TNode<BoolT> tmp14;
+    ca_.Bind(&block1, &tmp9, &tmp10, &tmp11, &tmp12, &tmp13, &tmp14);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 103);
+    ca_.Goto(&block2, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14);
+  }
+
+    TNode<Context> tmp15;
+    TNode<BuiltinPtr> tmp16;
+    TNode<JSReceiver> tmp17;
+    TNode<Map> tmp18;
+    TNode<Number> tmp19;
+    TNode<BoolT> tmp20;
+    ca_.Bind(&block2, &tmp15, &tmp16, &tmp17, &tmp18, &tmp19, &tmp20);
+  return TNode<BoolT>{tmp20};
+}
+
+TNode<IntPtrT> AddStringLength_10(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<IntPtrT> p_lenA, TNode<IntPtrT> p_lenB) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, IntPtrT, IntPtrT> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, IntPtrT, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, IntPtrT, IntPtrT, IntPtrT> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, IntPtrT, IntPtrT, IntPtrT> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, IntPtrT, IntPtrT> block3(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, IntPtrT, IntPtrT, IntPtrT> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, IntPtrT, IntPtrT, IntPtrT> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_lenA, p_lenB);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<IntPtrT> tmp1;
+    TNode<IntPtrT> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 116);
+    TNode<IntPtrT> tmp3;
+    USE(tmp3);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp3 = CodeStubAssembler(state_).TryIntPtrAdd(TNode<IntPtrT>{tmp1}, TNode<IntPtrT>{tmp2}, &label0);
+    ca_.Goto(&block4, tmp0, tmp1, tmp2, tmp1, tmp2, tmp3);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block5, tmp0, tmp1, tmp2, tmp1, tmp2);
+    }
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp4;
+    TNode<IntPtrT> tmp5;
+    TNode<IntPtrT> tmp6;
+    TNode<IntPtrT> tmp7;
+    TNode<IntPtrT> tmp8;
+    ca_.Bind(&block5, &tmp4, &tmp5, &tmp6, &tmp7, &tmp8);
+    ca_.Goto(&block3, tmp4, tmp5, tmp6);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp9;
+    TNode<IntPtrT> tmp10;
+    TNode<IntPtrT> tmp11;
+    TNode<IntPtrT> tmp12;
+    TNode<IntPtrT> tmp13;
+    TNode<IntPtrT> tmp14;
+    ca_.Bind(&block4, &tmp9, &tmp10, &tmp11, &tmp12, &tmp13, &tmp14);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 117);
+    TNode<IntPtrT> tmp15;
+    USE(tmp15);
+    tmp15 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, String::kMaxLength);
+    TNode<BoolT> tmp16;
+    USE(tmp16);
+    tmp16 = CodeStubAssembler(state_).IntPtrGreaterThan(TNode<IntPtrT>{tmp14}, TNode<IntPtrT>{tmp15});
+    ca_.Branch(tmp16, &block6, &block7, tmp9, tmp10, tmp11, tmp14);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp17;
+    TNode<IntPtrT> tmp18;
+    TNode<IntPtrT> tmp19;
+    TNode<IntPtrT> tmp20;
+    ca_.Bind(&block6, &tmp17, &tmp18, &tmp19, &tmp20);
+    ca_.Goto(&block3, tmp17, tmp18, tmp19);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp21;
+    TNode<IntPtrT> tmp22;
+    TNode<IntPtrT> tmp23;
+    TNode<IntPtrT> tmp24;
+    ca_.Bind(&block7, &tmp21, &tmp22, &tmp23, &tmp24);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 118);
+    ca_.Goto(&block1, tmp21, tmp22, tmp23, tmp24);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp25;
+    TNode<IntPtrT> tmp26;
+    TNode<IntPtrT> tmp27;
+    ca_.Bind(&block3, &tmp25, &tmp26, &tmp27);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 121);
+    CodeStubAssembler(state_).CallRuntime(Runtime::kThrowInvalidStringLength, tmp25);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp29;
+    TNode<IntPtrT> tmp30;
+    TNode<IntPtrT> tmp31;
+    TNode<IntPtrT> tmp32;
+    ca_.Bind(&block1, &tmp29, &tmp30, &tmp31, &tmp32);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 113);
+    ca_.Goto(&block8, tmp29, tmp30, tmp31, tmp32);
+  }
+
+    TNode<Context> tmp33;
+    TNode<IntPtrT> tmp34;
+    TNode<IntPtrT> tmp35;
+    TNode<IntPtrT> tmp36;
+    ca_.Bind(&block8, &tmp33, &tmp34, &tmp35, &tmp36);
+  return TNode<IntPtrT>{tmp36};
+}
+
+TorqueStructBuffer NewBuffer_11(compiler::CodeAssemblerState* state_, TNode<UintPtrT> p_len, TNode<String> p_sep) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<UintPtrT, String> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<UintPtrT, String> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<UintPtrT, String> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<UintPtrT, String> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<UintPtrT, String, IntPtrT> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<UintPtrT, String, IntPtrT> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<UintPtrT, String, IntPtrT> block9(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<UintPtrT, String, IntPtrT> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<UintPtrT, String, IntPtrT> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<UintPtrT, String, FixedArray, IntPtrT, IntPtrT, BoolT> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<UintPtrT, String, FixedArray, IntPtrT, IntPtrT, BoolT> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_len, p_sep);
+
+  if (block0.is_used()) {
+    TNode<UintPtrT> tmp0;
+    TNode<String> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 213);
+    TNode<UintPtrT> tmp2;
+    USE(tmp2);
+    tmp2 = FromConstexpr9ATuintptr17ATconstexpr_int31_165(state_, FixedArray::kMaxRegularLength);
+    TNode<BoolT> tmp3;
+    USE(tmp3);
+    tmp3 = CodeStubAssembler(state_).UintPtrGreaterThan(TNode<UintPtrT>{tmp0}, TNode<UintPtrT>{tmp2});
+    ca_.Branch(tmp3, &block2, &block3, tmp0, tmp1);
+  }
+
+  if (block2.is_used()) {
+    TNode<UintPtrT> tmp4;
+    TNode<String> tmp5;
+    ca_.Bind(&block2, &tmp4, &tmp5);
+    ca_.Goto(&block5, tmp4, tmp5);
+  }
+
+  if (block3.is_used()) {
+    TNode<UintPtrT> tmp6;
+    TNode<String> tmp7;
+    ca_.Bind(&block3, &tmp6, &tmp7);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 215);
+    TNode<IntPtrT> tmp8;
+    USE(tmp8);
+    tmp8 = CodeStubAssembler(state_).Signed(TNode<UintPtrT>{tmp6});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 213);
+    ca_.Goto(&block4, tmp6, tmp7, tmp8);
+  }
+
+  if (block5.is_used()) {
+    TNode<UintPtrT> tmp9;
+    TNode<String> tmp10;
+    ca_.Bind(&block5, &tmp9, &tmp10);
+    TNode<IntPtrT> tmp11;
+    USE(tmp11);
+    tmp11 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, FixedArray::kMaxRegularLength);
+    ca_.Goto(&block4, tmp9, tmp10, tmp11);
+  }
+
+  if (block4.is_used()) {
+    TNode<UintPtrT> tmp12;
+    TNode<String> tmp13;
+    TNode<IntPtrT> tmp14;
+    ca_.Bind(&block4, &tmp12, &tmp13, &tmp14);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 216);
+    ca_.Goto(&block7, tmp12, tmp13, tmp14);
+  }
+
+  if (block6.is_used()) {
+    TNode<UintPtrT> tmp15;
+    TNode<String> tmp16;
+    TNode<IntPtrT> tmp17;
+    ca_.Bind(&block6, &tmp15, &tmp16, &tmp17);
+    TNode<IntPtrT> tmp18;
+    USE(tmp18);
+    tmp18 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<BoolT> tmp19;
+    USE(tmp19);
+    tmp19 = CodeStubAssembler(state_).IntPtrGreaterThan(TNode<IntPtrT>{tmp17}, TNode<IntPtrT>{tmp18});
+    ca_.Branch(tmp19, &block8, &block9, tmp15, tmp16, tmp17);
+  }
+
+  if (block9.is_used()) {
+    TNode<UintPtrT> tmp20;
+    TNode<String> tmp21;
+    TNode<IntPtrT> tmp22;
+    ca_.Bind(&block9, &tmp20, &tmp21, &tmp22);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'cappedBufferSize > 0' failed", "../../deps/v8/src/builtins/array-join.tq", 216);
+  }
+
+  if (block8.is_used()) {
+    TNode<UintPtrT> tmp23;
+    TNode<String> tmp24;
+    TNode<IntPtrT> tmp25;
+    ca_.Bind(&block8, &tmp23, &tmp24, &tmp25);
+  }
+
+  if (block7.is_used()) {
+    TNode<UintPtrT> tmp26;
+    TNode<String> tmp27;
+    TNode<IntPtrT> tmp28;
+    ca_.Bind(&block7, &tmp26, &tmp27, &tmp28);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 218);
+    TNode<FixedArray> tmp29;
+    USE(tmp29);
+    tmp29 = CodeStubAssembler(state_).AllocateZeroedFixedArray(TNode<IntPtrT>{tmp28});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 221);
+    TNode<Uint16T> tmp30;
+    USE(tmp30);
+    tmp30 = CodeStubAssembler(state_).LoadInstanceType(TNode<HeapObject>{tmp27});
+    TNode<BoolT> tmp31;
+    USE(tmp31);
+    tmp31 = CodeStubAssembler(state_).IsOneByteStringInstanceType(TNode<Uint16T>{tmp30});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 217);
+    TNode<IntPtrT> tmp32;
+    USE(tmp32);
+    tmp32 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<IntPtrT> tmp33;
+    USE(tmp33);
+    tmp33 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    ca_.Goto(&block1, tmp26, tmp27, tmp29, tmp32, tmp33, tmp31);
+  }
+
+  if (block1.is_used()) {
+    TNode<UintPtrT> tmp34;
+    TNode<String> tmp35;
+    TNode<FixedArray> tmp36;
+    TNode<IntPtrT> tmp37;
+    TNode<IntPtrT> tmp38;
+    TNode<BoolT> tmp39;
+    ca_.Bind(&block1, &tmp34, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 212);
+    ca_.Goto(&block10, tmp34, tmp35, tmp36, tmp37, tmp38, tmp39);
+  }
+
+    TNode<UintPtrT> tmp40;
+    TNode<String> tmp41;
+    TNode<FixedArray> tmp42;
+    TNode<IntPtrT> tmp43;
+    TNode<IntPtrT> tmp44;
+    TNode<BoolT> tmp45;
+    ca_.Bind(&block10, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44, &tmp45);
+  return TorqueStructBuffer{TNode<FixedArray>{tmp42}, TNode<IntPtrT>{tmp43}, TNode<IntPtrT>{tmp44}, TNode<BoolT>{tmp45}};
+}
+
+TNode<String> BufferJoin_12(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TorqueStructBuffer p_buffer, TNode<String> p_sep) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String> block5(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String, FixedArray, FixedArray, IntPtrT, IntPtrT, HeapObject, IntPtrT> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String, FixedArray, Object, Object> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String, FixedArray, Object, Object, String> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String, FixedArray, Object> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String, FixedArray, Object, Object> block24(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String, FixedArray, Object, Object, Number> block23(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String, FixedArray, Object> block22(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String, Uint32T> block25(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String, Uint32T> block26(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String, Uint32T, String> block28(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String, Uint32T, String> block27(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String, String> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, IntPtrT, IntPtrT, BoolT, String, String> block29(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_buffer.fixedArray, p_buffer.index, p_buffer.totalStringLength, p_buffer.isOneByte, p_sep);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<FixedArray> tmp1;
+    TNode<IntPtrT> tmp2;
+    TNode<IntPtrT> tmp3;
+    TNode<BoolT> tmp4;
+    TNode<String> tmp5;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4, &tmp5);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 227);
+    ca_.Goto(&block3, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp6;
+    TNode<FixedArray> tmp7;
+    TNode<IntPtrT> tmp8;
+    TNode<IntPtrT> tmp9;
+    TNode<BoolT> tmp10;
+    TNode<String> tmp11;
+    ca_.Bind(&block2, &tmp6, &tmp7, &tmp8, &tmp9, &tmp10, &tmp11);
+    TNode<BoolT> tmp12;
+    USE(tmp12);
+    tmp12 = CodeStubAssembler(state_).IsValidPositiveSmi(TNode<IntPtrT>{tmp9});
+    ca_.Branch(tmp12, &block4, &block5, tmp6, tmp7, tmp8, tmp9, tmp10, tmp11);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp13;
+    TNode<FixedArray> tmp14;
+    TNode<IntPtrT> tmp15;
+    TNode<IntPtrT> tmp16;
+    TNode<BoolT> tmp17;
+    TNode<String> tmp18;
+    ca_.Bind(&block5, &tmp13, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'IsValidPositiveSmi(buffer.totalStringLength)' failed", "../../deps/v8/src/builtins/array-join.tq", 227);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp19;
+    TNode<FixedArray> tmp20;
+    TNode<IntPtrT> tmp21;
+    TNode<IntPtrT> tmp22;
+    TNode<BoolT> tmp23;
+    TNode<String> tmp24;
+    ca_.Bind(&block4, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp25;
+    TNode<FixedArray> tmp26;
+    TNode<IntPtrT> tmp27;
+    TNode<IntPtrT> tmp28;
+    TNode<BoolT> tmp29;
+    TNode<String> tmp30;
+    ca_.Bind(&block3, &tmp25, &tmp26, &tmp27, &tmp28, &tmp29, &tmp30);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 228);
+    TNode<IntPtrT> tmp31;
+    USE(tmp31);
+    tmp31 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<BoolT> tmp32;
+    USE(tmp32);
+    tmp32 = CodeStubAssembler(state_).WordEqual(TNode<IntPtrT>{tmp28}, TNode<IntPtrT>{tmp31});
+    ca_.Branch(tmp32, &block6, &block7, tmp25, tmp26, tmp27, tmp28, tmp29, tmp30);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp33;
+    TNode<FixedArray> tmp34;
+    TNode<IntPtrT> tmp35;
+    TNode<IntPtrT> tmp36;
+    TNode<BoolT> tmp37;
+    TNode<String> tmp38;
+    ca_.Bind(&block6, &tmp33, &tmp34, &tmp35, &tmp36, &tmp37, &tmp38);
+    TNode<String> tmp39;
+    USE(tmp39);
+    tmp39 = kEmptyString_67(state_);
+    ca_.Goto(&block1, tmp33, tmp34, tmp35, tmp36, tmp37, tmp38, tmp39);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp40;
+    TNode<FixedArray> tmp41;
+    TNode<IntPtrT> tmp42;
+    TNode<IntPtrT> tmp43;
+    TNode<BoolT> tmp44;
+    TNode<String> tmp45;
+    ca_.Bind(&block7, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44, &tmp45);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 231);
+    TNode<IntPtrT> tmp46;
+    USE(tmp46);
+    tmp46 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<BoolT> tmp47;
+    USE(tmp47);
+    tmp47 = CodeStubAssembler(state_).WordEqual(TNode<IntPtrT>{tmp42}, TNode<IntPtrT>{tmp46});
+    ca_.Branch(tmp47, &block8, &block9, tmp40, tmp41, tmp42, tmp43, tmp44, tmp45);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp48;
+    TNode<FixedArray> tmp49;
+    TNode<IntPtrT> tmp50;
+    TNode<IntPtrT> tmp51;
+    TNode<BoolT> tmp52;
+    TNode<String> tmp53;
+    ca_.Bind(&block8, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 232);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 233);
+    TNode<IntPtrT> tmp54 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp54);
+    TNode<IntPtrT> tmp55 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp55);
+    TNode<Smi>tmp56 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp49, tmp55});
+    TNode<IntPtrT> tmp57;
+    USE(tmp57);
+    tmp57 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp56});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 50);
+    TNode<IntPtrT> tmp58;
+    USE(tmp58);
+    tmp58 = Convert8ATintptr17ATconstexpr_int31_1376(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 51);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp59;
+    USE(tmp59);
+    tmp59 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp58});
+    TNode<UintPtrT> tmp60;
+    USE(tmp60);
+    tmp60 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp57});
+    TNode<BoolT> tmp61;
+    USE(tmp61);
+    tmp61 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp59}, TNode<UintPtrT>{tmp60});
+    ca_.Branch(tmp61, &block14, &block15, tmp48, tmp49, tmp50, tmp51, tmp52, tmp53, tmp49, tmp49, tmp54, tmp57, tmp58, tmp49, tmp54, tmp57, tmp58, tmp58);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp62;
+    TNode<FixedArray> tmp63;
+    TNode<IntPtrT> tmp64;
+    TNode<IntPtrT> tmp65;
+    TNode<BoolT> tmp66;
+    TNode<String> tmp67;
+    TNode<FixedArray> tmp68;
+    TNode<FixedArray> tmp69;
+    TNode<IntPtrT> tmp70;
+    TNode<IntPtrT> tmp71;
+    TNode<IntPtrT> tmp72;
+    TNode<HeapObject> tmp73;
+    TNode<IntPtrT> tmp74;
+    TNode<IntPtrT> tmp75;
+    TNode<IntPtrT> tmp76;
+    TNode<IntPtrT> tmp77;
+    ca_.Bind(&block14, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76, &tmp77);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp78;
+    USE(tmp78);
+    tmp78 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp79;
+    USE(tmp79);
+    tmp79 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp77}, TNode<IntPtrT>{tmp78});
+    TNode<IntPtrT> tmp80;
+    USE(tmp80);
+    tmp80 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp74}, TNode<IntPtrT>{tmp79});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp81;
+    USE(tmp81);
+    TNode<IntPtrT> tmp82;
+    USE(tmp82);
+    std::tie(tmp81, tmp82) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp73}, TNode<IntPtrT>{tmp80}).Flatten();
+    ca_.Goto(&block13, tmp62, tmp63, tmp64, tmp65, tmp66, tmp67, tmp68, tmp69, tmp70, tmp71, tmp72, tmp73, tmp74, tmp75, tmp76, tmp77, tmp81, tmp82);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp83;
+    TNode<FixedArray> tmp84;
+    TNode<IntPtrT> tmp85;
+    TNode<IntPtrT> tmp86;
+    TNode<BoolT> tmp87;
+    TNode<String> tmp88;
+    TNode<FixedArray> tmp89;
+    TNode<FixedArray> tmp90;
+    TNode<IntPtrT> tmp91;
+    TNode<IntPtrT> tmp92;
+    TNode<IntPtrT> tmp93;
+    TNode<HeapObject> tmp94;
+    TNode<IntPtrT> tmp95;
+    TNode<IntPtrT> tmp96;
+    TNode<IntPtrT> tmp97;
+    TNode<IntPtrT> tmp98;
+    ca_.Bind(&block15, &tmp83, &tmp84, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96, &tmp97, &tmp98);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block12, tmp83, tmp84, tmp85, tmp86, tmp87, tmp88, tmp89, tmp90, tmp91, tmp92, tmp93);
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp99;
+    TNode<FixedArray> tmp100;
+    TNode<IntPtrT> tmp101;
+    TNode<IntPtrT> tmp102;
+    TNode<BoolT> tmp103;
+    TNode<String> tmp104;
+    TNode<FixedArray> tmp105;
+    TNode<FixedArray> tmp106;
+    TNode<IntPtrT> tmp107;
+    TNode<IntPtrT> tmp108;
+    TNode<IntPtrT> tmp109;
+    TNode<HeapObject> tmp110;
+    TNode<IntPtrT> tmp111;
+    TNode<IntPtrT> tmp112;
+    TNode<IntPtrT> tmp113;
+    TNode<IntPtrT> tmp114;
+    TNode<HeapObject> tmp115;
+    TNode<IntPtrT> tmp116;
+    ca_.Bind(&block13, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104, &tmp105, &tmp106, &tmp107, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115, &tmp116);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 51);
+    ca_.Goto(&block11, tmp99, tmp100, tmp101, tmp102, tmp103, tmp104, tmp105, tmp106, tmp107, tmp108, tmp109, tmp115, tmp116);
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp117;
+    TNode<FixedArray> tmp118;
+    TNode<IntPtrT> tmp119;
+    TNode<IntPtrT> tmp120;
+    TNode<BoolT> tmp121;
+    TNode<String> tmp122;
+    TNode<FixedArray> tmp123;
+    TNode<FixedArray> tmp124;
+    TNode<IntPtrT> tmp125;
+    TNode<IntPtrT> tmp126;
+    TNode<IntPtrT> tmp127;
+    ca_.Bind(&block12, &tmp117, &tmp118, &tmp119, &tmp120, &tmp121, &tmp122, &tmp123, &tmp124, &tmp125, &tmp126, &tmp127);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp128;
+    TNode<FixedArray> tmp129;
+    TNode<IntPtrT> tmp130;
+    TNode<IntPtrT> tmp131;
+    TNode<BoolT> tmp132;
+    TNode<String> tmp133;
+    TNode<FixedArray> tmp134;
+    TNode<FixedArray> tmp135;
+    TNode<IntPtrT> tmp136;
+    TNode<IntPtrT> tmp137;
+    TNode<IntPtrT> tmp138;
+    TNode<HeapObject> tmp139;
+    TNode<IntPtrT> tmp140;
+    ca_.Bind(&block11, &tmp128, &tmp129, &tmp130, &tmp131, &tmp132, &tmp133, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138, &tmp139, &tmp140);
+    ca_.Goto(&block10, tmp128, tmp129, tmp130, tmp131, tmp132, tmp133, tmp134, tmp135, tmp136, tmp137, tmp139, tmp140);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp141;
+    TNode<FixedArray> tmp142;
+    TNode<IntPtrT> tmp143;
+    TNode<IntPtrT> tmp144;
+    TNode<BoolT> tmp145;
+    TNode<String> tmp146;
+    TNode<FixedArray> tmp147;
+    TNode<FixedArray> tmp148;
+    TNode<IntPtrT> tmp149;
+    TNode<IntPtrT> tmp150;
+    TNode<HeapObject> tmp151;
+    TNode<IntPtrT> tmp152;
+    ca_.Bind(&block10, &tmp141, &tmp142, &tmp143, &tmp144, &tmp145, &tmp146, &tmp147, &tmp148, &tmp149, &tmp150, &tmp151, &tmp152);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 233);
+    TNode<Object>tmp153 = CodeStubAssembler(state_).LoadReference<Object>(CodeStubAssembler::Reference{tmp151, tmp152});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 236);
+    TNode<String> tmp154;
+    USE(tmp154);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp154 = Cast6String_1377(state_, TNode<Context>{tmp141}, TNode<Object>{tmp153}, &label0);
+    ca_.Goto(&block19, tmp141, tmp142, tmp143, tmp144, tmp145, tmp146, tmp147, tmp153, tmp153, tmp154);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block20, tmp141, tmp142, tmp143, tmp144, tmp145, tmp146, tmp147, tmp153, tmp153);
+    }
+  }
+
+  if (block20.is_used()) {
+    TNode<Context> tmp155;
+    TNode<FixedArray> tmp156;
+    TNode<IntPtrT> tmp157;
+    TNode<IntPtrT> tmp158;
+    TNode<BoolT> tmp159;
+    TNode<String> tmp160;
+    TNode<FixedArray> tmp161;
+    TNode<Object> tmp162;
+    TNode<Object> tmp163;
+    ca_.Bind(&block20, &tmp155, &tmp156, &tmp157, &tmp158, &tmp159, &tmp160, &tmp161, &tmp162, &tmp163);
+    ca_.Goto(&block18, tmp155, tmp156, tmp157, tmp158, tmp159, tmp160, tmp161, tmp162);
+  }
+
+  if (block19.is_used()) {
+    TNode<Context> tmp164;
+    TNode<FixedArray> tmp165;
+    TNode<IntPtrT> tmp166;
+    TNode<IntPtrT> tmp167;
+    TNode<BoolT> tmp168;
+    TNode<String> tmp169;
+    TNode<FixedArray> tmp170;
+    TNode<Object> tmp171;
+    TNode<Object> tmp172;
+    TNode<String> tmp173;
+    ca_.Bind(&block19, &tmp164, &tmp165, &tmp166, &tmp167, &tmp168, &tmp169, &tmp170, &tmp171, &tmp172, &tmp173);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 237);
+    ca_.Goto(&block1, tmp164, tmp165, tmp166, tmp167, tmp168, tmp169, tmp173);
+  }
+
+  if (block18.is_used()) {
+    TNode<Context> tmp174;
+    TNode<FixedArray> tmp175;
+    TNode<IntPtrT> tmp176;
+    TNode<IntPtrT> tmp177;
+    TNode<BoolT> tmp178;
+    TNode<String> tmp179;
+    TNode<FixedArray> tmp180;
+    TNode<Object> tmp181;
+    ca_.Bind(&block18, &tmp174, &tmp175, &tmp176, &tmp177, &tmp178, &tmp179, &tmp180, &tmp181);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 242);
+    TNode<Number> tmp182;
+    USE(tmp182);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp182 = Cast20UT5ATSmi10HeapNumber_85(state_, TNode<Object>{ca_.UncheckedCast<Object>(tmp181)}, &label0);
+    ca_.Goto(&block23, tmp174, tmp175, tmp176, tmp177, tmp178, tmp179, tmp180, tmp181, ca_.UncheckedCast<Object>(tmp181), tmp182);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block24, tmp174, tmp175, tmp176, tmp177, tmp178, tmp179, tmp180, tmp181, ca_.UncheckedCast<Object>(tmp181));
+    }
+  }
+
+  if (block24.is_used()) {
+    TNode<Context> tmp183;
+    TNode<FixedArray> tmp184;
+    TNode<IntPtrT> tmp185;
+    TNode<IntPtrT> tmp186;
+    TNode<BoolT> tmp187;
+    TNode<String> tmp188;
+    TNode<FixedArray> tmp189;
+    TNode<Object> tmp190;
+    TNode<Object> tmp191;
+    ca_.Bind(&block24, &tmp183, &tmp184, &tmp185, &tmp186, &tmp187, &tmp188, &tmp189, &tmp190, &tmp191);
+    ca_.Goto(&block22, tmp183, tmp184, tmp185, tmp186, tmp187, tmp188, tmp189, tmp190);
+  }
+
+  if (block23.is_used()) {
+    TNode<Context> tmp192;
+    TNode<FixedArray> tmp193;
+    TNode<IntPtrT> tmp194;
+    TNode<IntPtrT> tmp195;
+    TNode<BoolT> tmp196;
+    TNode<String> tmp197;
+    TNode<FixedArray> tmp198;
+    TNode<Object> tmp199;
+    TNode<Object> tmp200;
+    TNode<Number> tmp201;
+    ca_.Bind(&block23, &tmp192, &tmp193, &tmp194, &tmp195, &tmp196, &tmp197, &tmp198, &tmp199, &tmp200, &tmp201);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 243);
+    TNode<String> tmp202;
+    tmp202 = TORQUE_CAST(CodeStubAssembler(state_).CallBuiltin(Builtins::kStringRepeat, tmp192, tmp197, tmp201));
+    USE(tmp202);
+    ca_.Goto(&block1, tmp192, tmp193, tmp194, tmp195, tmp196, tmp197, tmp202);
+  }
+
+  if (block22.is_used()) {
+    TNode<Context> tmp203;
+    TNode<FixedArray> tmp204;
+    TNode<IntPtrT> tmp205;
+    TNode<IntPtrT> tmp206;
+    TNode<BoolT> tmp207;
+    TNode<String> tmp208;
+    TNode<FixedArray> tmp209;
+    TNode<Object> tmp210;
+    ca_.Bind(&block22, &tmp203, &tmp204, &tmp205, &tmp206, &tmp207, &tmp208, &tmp209, &tmp210);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 245);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 246);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp211;
+    TNode<FixedArray> tmp212;
+    TNode<IntPtrT> tmp213;
+    TNode<IntPtrT> tmp214;
+    TNode<BoolT> tmp215;
+    TNode<String> tmp216;
+    ca_.Bind(&block9, &tmp211, &tmp212, &tmp213, &tmp214, &tmp215, &tmp216);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 251);
+    TNode<UintPtrT> tmp217;
+    USE(tmp217);
+    tmp217 = CodeStubAssembler(state_).Unsigned(TNode<IntPtrT>{tmp214});
+    TNode<Uint32T> tmp218;
+    USE(tmp218);
+    tmp218 = Convert8ATuint329ATuintptr_188(state_, TNode<UintPtrT>{tmp217});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 252);
+    ca_.Branch(tmp215, &block25, &block26, tmp211, tmp212, tmp213, tmp214, tmp215, tmp216, tmp218);
+  }
+
+  if (block25.is_used()) {
+    TNode<Context> tmp219;
+    TNode<FixedArray> tmp220;
+    TNode<IntPtrT> tmp221;
+    TNode<IntPtrT> tmp222;
+    TNode<BoolT> tmp223;
+    TNode<String> tmp224;
+    TNode<Uint32T> tmp225;
+    ca_.Bind(&block25, &tmp219, &tmp220, &tmp221, &tmp222, &tmp223, &tmp224, &tmp225);
+    TNode<String> tmp226;
+    USE(tmp226);
+    tmp226 = CodeStubAssembler(state_).AllocateSeqOneByteString(TNode<Uint32T>{tmp225});
+    ca_.Goto(&block28, tmp219, tmp220, tmp221, tmp222, tmp223, tmp224, tmp225, tmp226);
+  }
+
+  if (block26.is_used()) {
+    TNode<Context> tmp227;
+    TNode<FixedArray> tmp228;
+    TNode<IntPtrT> tmp229;
+    TNode<IntPtrT> tmp230;
+    TNode<BoolT> tmp231;
+    TNode<String> tmp232;
+    TNode<Uint32T> tmp233;
+    ca_.Bind(&block26, &tmp227, &tmp228, &tmp229, &tmp230, &tmp231, &tmp232, &tmp233);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 253);
+    TNode<String> tmp234;
+    USE(tmp234);
+    tmp234 = CodeStubAssembler(state_).AllocateSeqTwoByteString(TNode<Uint32T>{tmp233});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 252);
+    ca_.Goto(&block27, tmp227, tmp228, tmp229, tmp230, tmp231, tmp232, tmp233, tmp234);
+  }
+
+  if (block28.is_used()) {
+    TNode<Context> tmp235;
+    TNode<FixedArray> tmp236;
+    TNode<IntPtrT> tmp237;
+    TNode<IntPtrT> tmp238;
+    TNode<BoolT> tmp239;
+    TNode<String> tmp240;
+    TNode<Uint32T> tmp241;
+    TNode<String> tmp242;
+    ca_.Bind(&block28, &tmp235, &tmp236, &tmp237, &tmp238, &tmp239, &tmp240, &tmp241, &tmp242);
+    ca_.Goto(&block27, tmp235, tmp236, tmp237, tmp238, tmp239, tmp240, tmp241, tmp242);
+  }
+
+  if (block27.is_used()) {
+    TNode<Context> tmp243;
+    TNode<FixedArray> tmp244;
+    TNode<IntPtrT> tmp245;
+    TNode<IntPtrT> tmp246;
+    TNode<BoolT> tmp247;
+    TNode<String> tmp248;
+    TNode<Uint32T> tmp249;
+    TNode<String> tmp250;
+    ca_.Bind(&block27, &tmp243, &tmp244, &tmp245, &tmp246, &tmp247, &tmp248, &tmp249, &tmp250);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 255);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 254);
+    TNode<String> tmp251;
+    USE(tmp251);
+    tmp251 = ArrayBuiltinsAssembler(state_).CallJSArrayArrayJoinConcatToSequentialString(TNode<FixedArray>{tmp244}, TNode<IntPtrT>{tmp245}, TNode<String>{tmp248}, TNode<String>{tmp250});
+    ca_.Goto(&block1, tmp243, tmp244, tmp245, tmp246, tmp247, tmp248, tmp251);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp252;
+    TNode<FixedArray> tmp253;
+    TNode<IntPtrT> tmp254;
+    TNode<IntPtrT> tmp255;
+    TNode<BoolT> tmp256;
+    TNode<String> tmp257;
+    TNode<String> tmp258;
+    ca_.Bind(&block1, &tmp252, &tmp253, &tmp254, &tmp255, &tmp256, &tmp257, &tmp258);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 225);
+    ca_.Goto(&block29, tmp252, tmp253, tmp254, tmp255, tmp256, tmp257, tmp258);
+  }
+
+    TNode<Context> tmp259;
+    TNode<FixedArray> tmp260;
+    TNode<IntPtrT> tmp261;
+    TNode<IntPtrT> tmp262;
+    TNode<BoolT> tmp263;
+    TNode<String> tmp264;
+    TNode<String> tmp265;
+    ca_.Bind(&block29, &tmp259, &tmp260, &tmp261, &tmp262, &tmp263, &tmp264, &tmp265);
+  return TNode<String>{tmp265};
+}
+
+TNode<Object> ArrayJoin7JSArray_13(compiler::CodeAssemblerState* state_, TNode<Context> p_context, bool p_useToLocaleString, TNode<JSReceiver> p_receiver, TNode<String> p_sep, TNode<Number> p_lenNumber, TNode<Object> p_locales, TNode<Object> p_options) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSReceiver> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSReceiver, JSArray> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSArray> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSArray> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSArray> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSArray> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSArray> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSArray> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSArray> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSArray> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSArray> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSArray> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSArray> block18(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSArray, NumberDictionary, Smi> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSArray, NumberDictionary, Smi> block24(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSArray, NumberDictionary, Smi> block25(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSArray, NumberDictionary, Smi, Number> block29(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSArray, NumberDictionary, Smi, Number, Smi> block28(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSArray, NumberDictionary, Smi> block27(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSArray, NumberDictionary, Smi> block22(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSArray, NumberDictionary, Smi> block23(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSArray> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSArray> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSArray> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr, JSArray> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Object> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Object> block30(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_receiver, p_sep, p_lenNumber, p_locales, p_options);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<String> tmp2;
+    TNode<Number> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4, &tmp5);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 329);
+    TNode<IntPtrT> tmp6 = ca_.IntPtrConstant(HeapObject::kMapOffset);
+    USE(tmp6);
+    TNode<Map>tmp7 = CodeStubAssembler(state_).LoadReference<Map>(CodeStubAssembler::Reference{tmp1, tmp6});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 330);
+    TNode<Int32T> tmp8;
+    USE(tmp8);
+    tmp8 = CodeStubAssembler(state_).LoadMapElementsKind(TNode<Map>{tmp7});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 331);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 334);
+    TNode<JSArray> tmp9;
+    USE(tmp9);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp9 = Cast7JSArray_114(state_, TNode<HeapObject>{tmp1}, &label0);
+    ca_.Goto(&block4, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp7, tmp8, ca_.Uninitialized<BuiltinPtr>(), tmp1, tmp9);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block5, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp7, tmp8, ca_.Uninitialized<BuiltinPtr>(), tmp1);
+    }
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp10;
+    TNode<JSReceiver> tmp11;
+    TNode<String> tmp12;
+    TNode<Number> tmp13;
+    TNode<Object> tmp14;
+    TNode<Object> tmp15;
+    TNode<Map> tmp16;
+    TNode<Int32T> tmp17;
+    TNode<BuiltinPtr> tmp18;
+    TNode<JSReceiver> tmp19;
+    ca_.Bind(&block5, &tmp10, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18, &tmp19);
+    ca_.Goto(&block3, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15, tmp16, tmp17, tmp18);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp20;
+    TNode<JSReceiver> tmp21;
+    TNode<String> tmp22;
+    TNode<Number> tmp23;
+    TNode<Object> tmp24;
+    TNode<Object> tmp25;
+    TNode<Map> tmp26;
+    TNode<Int32T> tmp27;
+    TNode<BuiltinPtr> tmp28;
+    TNode<JSReceiver> tmp29;
+    TNode<JSArray> tmp30;
+    ca_.Bind(&block4, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27, &tmp28, &tmp29, &tmp30);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 335);
+    TNode<IntPtrT> tmp31 = ca_.IntPtrConstant(JSArray::kLengthOffset);
+    USE(tmp31);
+    TNode<Number>tmp32 = CodeStubAssembler(state_).LoadReference<Number>(CodeStubAssembler::Reference{tmp30, tmp31});
+    TNode<BoolT> tmp33;
+    USE(tmp33);
+    tmp33 = IsNumberNotEqual_74(state_, TNode<Number>{tmp32}, TNode<Number>{tmp23});
+    ca_.Branch(tmp33, &block6, &block7, tmp20, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27, tmp28, tmp30);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp34;
+    TNode<JSReceiver> tmp35;
+    TNode<String> tmp36;
+    TNode<Number> tmp37;
+    TNode<Object> tmp38;
+    TNode<Object> tmp39;
+    TNode<Map> tmp40;
+    TNode<Int32T> tmp41;
+    TNode<BuiltinPtr> tmp42;
+    TNode<JSArray> tmp43;
+    ca_.Bind(&block6, &tmp34, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43);
+    ca_.Goto(&block3, tmp34, tmp35, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp44;
+    TNode<JSReceiver> tmp45;
+    TNode<String> tmp46;
+    TNode<Number> tmp47;
+    TNode<Object> tmp48;
+    TNode<Object> tmp49;
+    TNode<Map> tmp50;
+    TNode<Int32T> tmp51;
+    TNode<BuiltinPtr> tmp52;
+    TNode<JSArray> tmp53;
+    ca_.Bind(&block7, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 336);
+    TNode<BoolT> tmp54;
+    USE(tmp54);
+    tmp54 = CodeStubAssembler(state_).IsPrototypeInitialArrayPrototype(TNode<Context>{tmp44}, TNode<Map>{tmp50});
+    TNode<BoolT> tmp55;
+    USE(tmp55);
+    tmp55 = CodeStubAssembler(state_).Word32BinaryNot(TNode<BoolT>{tmp54});
+    ca_.Branch(tmp55, &block8, &block9, tmp44, tmp45, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51, tmp52, tmp53);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp56;
+    TNode<JSReceiver> tmp57;
+    TNode<String> tmp58;
+    TNode<Number> tmp59;
+    TNode<Object> tmp60;
+    TNode<Object> tmp61;
+    TNode<Map> tmp62;
+    TNode<Int32T> tmp63;
+    TNode<BuiltinPtr> tmp64;
+    TNode<JSArray> tmp65;
+    ca_.Bind(&block8, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65);
+    ca_.Goto(&block3, tmp56, tmp57, tmp58, tmp59, tmp60, tmp61, tmp62, tmp63, tmp64);
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp66;
+    TNode<JSReceiver> tmp67;
+    TNode<String> tmp68;
+    TNode<Number> tmp69;
+    TNode<Object> tmp70;
+    TNode<Object> tmp71;
+    TNode<Map> tmp72;
+    TNode<Int32T> tmp73;
+    TNode<BuiltinPtr> tmp74;
+    TNode<JSArray> tmp75;
+    ca_.Bind(&block9, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 337);
+    TNode<BoolT> tmp76;
+    USE(tmp76);
+    tmp76 = CodeStubAssembler(state_).IsNoElementsProtectorCellInvalid();
+    ca_.Branch(tmp76, &block10, &block11, tmp66, tmp67, tmp68, tmp69, tmp70, tmp71, tmp72, tmp73, tmp74, tmp75);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp77;
+    TNode<JSReceiver> tmp78;
+    TNode<String> tmp79;
+    TNode<Number> tmp80;
+    TNode<Object> tmp81;
+    TNode<Object> tmp82;
+    TNode<Map> tmp83;
+    TNode<Int32T> tmp84;
+    TNode<BuiltinPtr> tmp85;
+    TNode<JSArray> tmp86;
+    ca_.Bind(&block10, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86);
+    ca_.Goto(&block3, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, tmp83, tmp84, tmp85);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp87;
+    TNode<JSReceiver> tmp88;
+    TNode<String> tmp89;
+    TNode<Number> tmp90;
+    TNode<Object> tmp91;
+    TNode<Object> tmp92;
+    TNode<Map> tmp93;
+    TNode<Int32T> tmp94;
+    TNode<BuiltinPtr> tmp95;
+    TNode<JSArray> tmp96;
+    ca_.Bind(&block11, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 339);
+    TNode<BoolT> tmp97;
+    USE(tmp97);
+    tmp97 = CodeStubAssembler(state_).IsElementsKindLessThanOrEqual(TNode<Int32T>{tmp94}, HOLEY_ELEMENTS);
+    ca_.Branch(tmp97, &block12, &block13, tmp87, tmp88, tmp89, tmp90, tmp91, tmp92, tmp93, tmp94, tmp95, tmp96);
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp98;
+    TNode<JSReceiver> tmp99;
+    TNode<String> tmp100;
+    TNode<Number> tmp101;
+    TNode<Object> tmp102;
+    TNode<Object> tmp103;
+    TNode<Map> tmp104;
+    TNode<Int32T> tmp105;
+    TNode<BuiltinPtr> tmp106;
+    TNode<JSArray> tmp107;
+    ca_.Bind(&block12, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104, &tmp105, &tmp106, &tmp107);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 340);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 339);
+    ca_.Goto(&block14, tmp98, tmp99, tmp100, tmp101, tmp102, tmp103, tmp104, tmp105, ca_.UncheckedCast<BuiltinPtr>(ca_.SmiConstant(Builtins::kLoadJoinElement25ATFastSmiOrObjectElements)), tmp107);
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp108;
+    TNode<JSReceiver> tmp109;
+    TNode<String> tmp110;
+    TNode<Number> tmp111;
+    TNode<Object> tmp112;
+    TNode<Object> tmp113;
+    TNode<Map> tmp114;
+    TNode<Int32T> tmp115;
+    TNode<BuiltinPtr> tmp116;
+    TNode<JSArray> tmp117;
+    ca_.Bind(&block13, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115, &tmp116, &tmp117);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 341);
+    TNode<BoolT> tmp118;
+    USE(tmp118);
+    tmp118 = CodeStubAssembler(state_).IsElementsKindLessThanOrEqual(TNode<Int32T>{tmp115}, HOLEY_DOUBLE_ELEMENTS);
+    ca_.Branch(tmp118, &block15, &block16, tmp108, tmp109, tmp110, tmp111, tmp112, tmp113, tmp114, tmp115, tmp116, tmp117);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp119;
+    TNode<JSReceiver> tmp120;
+    TNode<String> tmp121;
+    TNode<Number> tmp122;
+    TNode<Object> tmp123;
+    TNode<Object> tmp124;
+    TNode<Map> tmp125;
+    TNode<Int32T> tmp126;
+    TNode<BuiltinPtr> tmp127;
+    TNode<JSArray> tmp128;
+    ca_.Bind(&block15, &tmp119, &tmp120, &tmp121, &tmp122, &tmp123, &tmp124, &tmp125, &tmp126, &tmp127, &tmp128);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 342);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 341);
+    ca_.Goto(&block17, tmp119, tmp120, tmp121, tmp122, tmp123, tmp124, tmp125, tmp126, ca_.UncheckedCast<BuiltinPtr>(ca_.SmiConstant(Builtins::kLoadJoinElement20ATFastDoubleElements)), tmp128);
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp129;
+    TNode<JSReceiver> tmp130;
+    TNode<String> tmp131;
+    TNode<Number> tmp132;
+    TNode<Object> tmp133;
+    TNode<Object> tmp134;
+    TNode<Map> tmp135;
+    TNode<Int32T> tmp136;
+    TNode<BuiltinPtr> tmp137;
+    TNode<JSArray> tmp138;
+    ca_.Bind(&block16, &tmp129, &tmp130, &tmp131, &tmp132, &tmp133, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 343);
+    TNode<Int32T> tmp139;
+    USE(tmp139);
+    tmp139 = FromConstexpr14ATElementsKind24ATconstexpr_ElementsKind_170(state_, DICTIONARY_ELEMENTS);
+    TNode<BoolT> tmp140;
+    USE(tmp140);
+    tmp140 = CodeStubAssembler(state_).ElementsKindEqual(TNode<Int32T>{tmp136}, TNode<Int32T>{tmp139});
+    ca_.Branch(tmp140, &block18, &block19, tmp129, tmp130, tmp131, tmp132, tmp133, tmp134, tmp135, tmp136, tmp137, tmp138);
+  }
+
+  if (block18.is_used()) {
+    TNode<Context> tmp141;
+    TNode<JSReceiver> tmp142;
+    TNode<String> tmp143;
+    TNode<Number> tmp144;
+    TNode<Object> tmp145;
+    TNode<Object> tmp146;
+    TNode<Map> tmp147;
+    TNode<Int32T> tmp148;
+    TNode<BuiltinPtr> tmp149;
+    TNode<JSArray> tmp150;
+    ca_.Bind(&block18, &tmp141, &tmp142, &tmp143, &tmp144, &tmp145, &tmp146, &tmp147, &tmp148, &tmp149, &tmp150);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 346);
+    TNode<IntPtrT> tmp151 = ca_.IntPtrConstant(JSObject::kElementsOffset);
+    USE(tmp151);
+    TNode<FixedArrayBase>tmp152 = CodeStubAssembler(state_).LoadReference<FixedArrayBase>(CodeStubAssembler::Reference{tmp150, tmp151});
+    TNode<NumberDictionary> tmp153;
+    USE(tmp153);
+    tmp153 = UnsafeCast16NumberDictionary_1369(state_, TNode<Context>{tmp141}, TNode<Object>{tmp152});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 345);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 347);
+    TNode<Smi> tmp154;
+    USE(tmp154);
+    tmp154 = CodeStubAssembler(state_).GetNumberDictionaryNumberOfElements(TNode<NumberDictionary>{tmp153});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 348);
+    TNode<Smi> tmp155;
+    USE(tmp155);
+    tmp155 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 0);
+    TNode<BoolT> tmp156;
+    USE(tmp156);
+    tmp156 = CodeStubAssembler(state_).SmiEqual(TNode<Smi>{tmp154}, TNode<Smi>{tmp155});
+    ca_.Branch(tmp156, &block21, &block22, tmp141, tmp142, tmp143, tmp144, tmp145, tmp146, tmp147, tmp148, tmp149, tmp150, tmp153, tmp154);
+  }
+
+  if (block21.is_used()) {
+    TNode<Context> tmp157;
+    TNode<JSReceiver> tmp158;
+    TNode<String> tmp159;
+    TNode<Number> tmp160;
+    TNode<Object> tmp161;
+    TNode<Object> tmp162;
+    TNode<Map> tmp163;
+    TNode<Int32T> tmp164;
+    TNode<BuiltinPtr> tmp165;
+    TNode<JSArray> tmp166;
+    TNode<NumberDictionary> tmp167;
+    TNode<Smi> tmp168;
+    ca_.Bind(&block21, &tmp157, &tmp158, &tmp159, &tmp160, &tmp161, &tmp162, &tmp163, &tmp164, &tmp165, &tmp166, &tmp167, &tmp168);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 349);
+    TNode<String> tmp169;
+    USE(tmp169);
+    tmp169 = kEmptyString_67(state_);
+    TNode<BoolT> tmp170;
+    USE(tmp170);
+    tmp170 = CodeStubAssembler(state_).TaggedEqual(TNode<Object>{tmp159}, TNode<HeapObject>{tmp169});
+    ca_.Branch(tmp170, &block24, &block25, tmp157, tmp158, tmp159, tmp160, tmp161, tmp162, tmp163, tmp164, tmp165, tmp166, tmp167, tmp168);
+  }
+
+  if (block24.is_used()) {
+    TNode<Context> tmp171;
+    TNode<JSReceiver> tmp172;
+    TNode<String> tmp173;
+    TNode<Number> tmp174;
+    TNode<Object> tmp175;
+    TNode<Object> tmp176;
+    TNode<Map> tmp177;
+    TNode<Int32T> tmp178;
+    TNode<BuiltinPtr> tmp179;
+    TNode<JSArray> tmp180;
+    TNode<NumberDictionary> tmp181;
+    TNode<Smi> tmp182;
+    ca_.Bind(&block24, &tmp171, &tmp172, &tmp173, &tmp174, &tmp175, &tmp176, &tmp177, &tmp178, &tmp179, &tmp180, &tmp181, &tmp182);
+    TNode<String> tmp183;
+    USE(tmp183);
+    tmp183 = kEmptyString_67(state_);
+    ca_.Goto(&block1, tmp171, tmp172, tmp173, tmp174, tmp175, tmp176, tmp183);
+  }
+
+  if (block25.is_used()) {
+    TNode<Context> tmp184;
+    TNode<JSReceiver> tmp185;
+    TNode<String> tmp186;
+    TNode<Number> tmp187;
+    TNode<Object> tmp188;
+    TNode<Object> tmp189;
+    TNode<Map> tmp190;
+    TNode<Int32T> tmp191;
+    TNode<BuiltinPtr> tmp192;
+    TNode<JSArray> tmp193;
+    TNode<NumberDictionary> tmp194;
+    TNode<Smi> tmp195;
+    ca_.Bind(&block25, &tmp184, &tmp185, &tmp186, &tmp187, &tmp188, &tmp189, &tmp190, &tmp191, &tmp192, &tmp193, &tmp194, &tmp195);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 352);
+    TNode<Number> tmp196;
+    USE(tmp196);
+    tmp196 = FromConstexpr20UT5ATSmi10HeapNumber17ATconstexpr_int31_161(state_, 1);
+    TNode<Number> tmp197;
+    USE(tmp197);
+    tmp197 = CodeStubAssembler(state_).NumberSub(TNode<Number>{tmp187}, TNode<Number>{tmp196});
+    TNode<Smi> tmp198;
+    USE(tmp198);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp198 = Cast5ATSmi_83(state_, TNode<Object>{tmp197}, &label0);
+    ca_.Goto(&block28, tmp184, tmp185, tmp186, tmp187, tmp188, tmp189, tmp190, tmp191, tmp192, tmp193, tmp194, tmp195, tmp197, tmp198);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block29, tmp184, tmp185, tmp186, tmp187, tmp188, tmp189, tmp190, tmp191, tmp192, tmp193, tmp194, tmp195, tmp197);
+    }
+  }
+
+  if (block29.is_used()) {
+    TNode<Context> tmp199;
+    TNode<JSReceiver> tmp200;
+    TNode<String> tmp201;
+    TNode<Number> tmp202;
+    TNode<Object> tmp203;
+    TNode<Object> tmp204;
+    TNode<Map> tmp205;
+    TNode<Int32T> tmp206;
+    TNode<BuiltinPtr> tmp207;
+    TNode<JSArray> tmp208;
+    TNode<NumberDictionary> tmp209;
+    TNode<Smi> tmp210;
+    TNode<Number> tmp211;
+    ca_.Bind(&block29, &tmp199, &tmp200, &tmp201, &tmp202, &tmp203, &tmp204, &tmp205, &tmp206, &tmp207, &tmp208, &tmp209, &tmp210, &tmp211);
+    ca_.Goto(&block27, tmp199, tmp200, tmp201, tmp202, tmp203, tmp204, tmp205, tmp206, tmp207, tmp208, tmp209, tmp210);
+  }
+
+  if (block28.is_used()) {
+    TNode<Context> tmp212;
+    TNode<JSReceiver> tmp213;
+    TNode<String> tmp214;
+    TNode<Number> tmp215;
+    TNode<Object> tmp216;
+    TNode<Object> tmp217;
+    TNode<Map> tmp218;
+    TNode<Int32T> tmp219;
+    TNode<BuiltinPtr> tmp220;
+    TNode<JSArray> tmp221;
+    TNode<NumberDictionary> tmp222;
+    TNode<Smi> tmp223;
+    TNode<Number> tmp224;
+    TNode<Smi> tmp225;
+    ca_.Bind(&block28, &tmp212, &tmp213, &tmp214, &tmp215, &tmp216, &tmp217, &tmp218, &tmp219, &tmp220, &tmp221, &tmp222, &tmp223, &tmp224, &tmp225);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 351);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 353);
+    TNode<String> tmp226;
+    tmp226 = TORQUE_CAST(CodeStubAssembler(state_).CallBuiltin(Builtins::kStringRepeat, tmp212, tmp214, tmp225));
+    USE(tmp226);
+    ca_.Goto(&block1, tmp212, tmp213, tmp214, tmp215, tmp216, tmp217, tmp226);
+  }
+
+  if (block27.is_used()) {
+    TNode<Context> tmp227;
+    TNode<JSReceiver> tmp228;
+    TNode<String> tmp229;
+    TNode<Number> tmp230;
+    TNode<Object> tmp231;
+    TNode<Object> tmp232;
+    TNode<Map> tmp233;
+    TNode<Int32T> tmp234;
+    TNode<BuiltinPtr> tmp235;
+    TNode<JSArray> tmp236;
+    TNode<NumberDictionary> tmp237;
+    TNode<Smi> tmp238;
+    ca_.Bind(&block27, &tmp227, &tmp228, &tmp229, &tmp230, &tmp231, &tmp232, &tmp233, &tmp234, &tmp235, &tmp236, &tmp237, &tmp238);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 356);
+    CodeStubAssembler(state_).CallRuntime(Runtime::kThrowInvalidStringLength, tmp227);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block22.is_used()) {
+    TNode<Context> tmp240;
+    TNode<JSReceiver> tmp241;
+    TNode<String> tmp242;
+    TNode<Number> tmp243;
+    TNode<Object> tmp244;
+    TNode<Object> tmp245;
+    TNode<Map> tmp246;
+    TNode<Int32T> tmp247;
+    TNode<BuiltinPtr> tmp248;
+    TNode<JSArray> tmp249;
+    TNode<NumberDictionary> tmp250;
+    TNode<Smi> tmp251;
+    ca_.Bind(&block22, &tmp240, &tmp241, &tmp242, &tmp243, &tmp244, &tmp245, &tmp246, &tmp247, &tmp248, &tmp249, &tmp250, &tmp251);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 359);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 348);
+    ca_.Goto(&block23, tmp240, tmp241, tmp242, tmp243, tmp244, tmp245, tmp246, tmp247, ca_.UncheckedCast<BuiltinPtr>(ca_.SmiConstant(Builtins::kLoadJoinElement20ATDictionaryElements)), tmp249, tmp250, tmp251);
+  }
+
+  if (block23.is_used()) {
+    TNode<Context> tmp252;
+    TNode<JSReceiver> tmp253;
+    TNode<String> tmp254;
+    TNode<Number> tmp255;
+    TNode<Object> tmp256;
+    TNode<Object> tmp257;
+    TNode<Map> tmp258;
+    TNode<Int32T> tmp259;
+    TNode<BuiltinPtr> tmp260;
+    TNode<JSArray> tmp261;
+    TNode<NumberDictionary> tmp262;
+    TNode<Smi> tmp263;
+    ca_.Bind(&block23, &tmp252, &tmp253, &tmp254, &tmp255, &tmp256, &tmp257, &tmp258, &tmp259, &tmp260, &tmp261, &tmp262, &tmp263);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 344);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 343);
+    ca_.Goto(&block20, tmp252, tmp253, tmp254, tmp255, tmp256, tmp257, tmp258, tmp259, tmp260, tmp261);
+  }
+
+  if (block19.is_used()) {
+    TNode<Context> tmp264;
+    TNode<JSReceiver> tmp265;
+    TNode<String> tmp266;
+    TNode<Number> tmp267;
+    TNode<Object> tmp268;
+    TNode<Object> tmp269;
+    TNode<Map> tmp270;
+    TNode<Int32T> tmp271;
+    TNode<BuiltinPtr> tmp272;
+    TNode<JSArray> tmp273;
+    ca_.Bind(&block19, &tmp264, &tmp265, &tmp266, &tmp267, &tmp268, &tmp269, &tmp270, &tmp271, &tmp272, &tmp273);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 363);
+    ca_.Goto(&block3, tmp264, tmp265, tmp266, tmp267, tmp268, tmp269, tmp270, tmp271, tmp272);
+  }
+
+  if (block20.is_used()) {
+    TNode<Context> tmp274;
+    TNode<JSReceiver> tmp275;
+    TNode<String> tmp276;
+    TNode<Number> tmp277;
+    TNode<Object> tmp278;
+    TNode<Object> tmp279;
+    TNode<Map> tmp280;
+    TNode<Int32T> tmp281;
+    TNode<BuiltinPtr> tmp282;
+    TNode<JSArray> tmp283;
+    ca_.Bind(&block20, &tmp274, &tmp275, &tmp276, &tmp277, &tmp278, &tmp279, &tmp280, &tmp281, &tmp282, &tmp283);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 341);
+    ca_.Goto(&block17, tmp274, tmp275, tmp276, tmp277, tmp278, tmp279, tmp280, tmp281, tmp282, tmp283);
+  }
+
+  if (block17.is_used()) {
+    TNode<Context> tmp284;
+    TNode<JSReceiver> tmp285;
+    TNode<String> tmp286;
+    TNode<Number> tmp287;
+    TNode<Object> tmp288;
+    TNode<Object> tmp289;
+    TNode<Map> tmp290;
+    TNode<Int32T> tmp291;
+    TNode<BuiltinPtr> tmp292;
+    TNode<JSArray> tmp293;
+    ca_.Bind(&block17, &tmp284, &tmp285, &tmp286, &tmp287, &tmp288, &tmp289, &tmp290, &tmp291, &tmp292, &tmp293);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 339);
+    ca_.Goto(&block14, tmp284, tmp285, tmp286, tmp287, tmp288, tmp289, tmp290, tmp291, tmp292, tmp293);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp294;
+    TNode<JSReceiver> tmp295;
+    TNode<String> tmp296;
+    TNode<Number> tmp297;
+    TNode<Object> tmp298;
+    TNode<Object> tmp299;
+    TNode<Map> tmp300;
+    TNode<Int32T> tmp301;
+    TNode<BuiltinPtr> tmp302;
+    TNode<JSArray> tmp303;
+    ca_.Bind(&block14, &tmp294, &tmp295, &tmp296, &tmp297, &tmp298, &tmp299, &tmp300, &tmp301, &tmp302, &tmp303);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 333);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 366);
+    ca_.Goto(&block2, tmp294, tmp295, tmp296, tmp297, tmp298, tmp299, tmp300, tmp301, tmp302);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp304;
+    TNode<JSReceiver> tmp305;
+    TNode<String> tmp306;
+    TNode<Number> tmp307;
+    TNode<Object> tmp308;
+    TNode<Object> tmp309;
+    TNode<Map> tmp310;
+    TNode<Int32T> tmp311;
+    TNode<BuiltinPtr> tmp312;
+    ca_.Bind(&block3, &tmp304, &tmp305, &tmp306, &tmp307, &tmp308, &tmp309, &tmp310, &tmp311, &tmp312);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 367);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 333);
+    ca_.Goto(&block2, tmp304, tmp305, tmp306, tmp307, tmp308, tmp309, tmp310, tmp311, ca_.UncheckedCast<BuiltinPtr>(ca_.SmiConstant(Builtins::kLoadJoinElement25ATGenericElementsAccessor)));
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp313;
+    TNode<JSReceiver> tmp314;
+    TNode<String> tmp315;
+    TNode<Number> tmp316;
+    TNode<Object> tmp317;
+    TNode<Object> tmp318;
+    TNode<Map> tmp319;
+    TNode<Int32T> tmp320;
+    TNode<BuiltinPtr> tmp321;
+    ca_.Bind(&block2, &tmp313, &tmp314, &tmp315, &tmp316, &tmp317, &tmp318, &tmp319, &tmp320, &tmp321);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 370);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 369);
+    TNode<String> tmp322;
+    USE(tmp322);
+    tmp322 = ArrayJoinImpl7JSArray_1378(state_, TNode<Context>{tmp313}, TNode<JSReceiver>{tmp314}, TNode<String>{tmp315}, TNode<Number>{tmp316}, p_useToLocaleString, TNode<Object>{tmp317}, TNode<Object>{tmp318}, TNode<BuiltinPtr>{tmp321});
+    ca_.Goto(&block1, tmp313, tmp314, tmp315, tmp316, tmp317, tmp318, tmp322);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp323;
+    TNode<JSReceiver> tmp324;
+    TNode<String> tmp325;
+    TNode<Number> tmp326;
+    TNode<Object> tmp327;
+    TNode<Object> tmp328;
+    TNode<Object> tmp329;
+    ca_.Bind(&block1, &tmp323, &tmp324, &tmp325, &tmp326, &tmp327, &tmp328, &tmp329);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 326);
+    ca_.Goto(&block30, tmp323, tmp324, tmp325, tmp326, tmp327, tmp328, tmp329);
+  }
+
+    TNode<Context> tmp330;
+    TNode<JSReceiver> tmp331;
+    TNode<String> tmp332;
+    TNode<Number> tmp333;
+    TNode<Object> tmp334;
+    TNode<Object> tmp335;
+    TNode<Object> tmp336;
+    ca_.Bind(&block30, &tmp330, &tmp331, &tmp332, &tmp333, &tmp334, &tmp335, &tmp336);
+  return TNode<Object>{tmp336};
+}
+
+TNode<Object> ArrayJoin12JSTypedArray_14(compiler::CodeAssemblerState* state_, TNode<Context> p_context, bool p_useToLocaleString, TNode<JSReceiver> p_receiver, TNode<String> p_sep, TNode<Number> p_lenNumber, TNode<Object> p_locales, TNode<Object> p_options) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block22(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block23(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block24(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block26(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block27(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block29(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block30(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block32(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block33(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block35(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block36(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block37(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block34(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block31(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block28(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block25(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Map, Int32T, BuiltinPtr> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Object> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, Object> block38(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_receiver, p_sep, p_lenNumber, p_locales, p_options);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<String> tmp2;
+    TNode<Number> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4, &tmp5);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 376);
+    TNode<IntPtrT> tmp6 = ca_.IntPtrConstant(HeapObject::kMapOffset);
+    USE(tmp6);
+    TNode<Map>tmp7 = CodeStubAssembler(state_).LoadReference<Map>(CodeStubAssembler::Reference{tmp1, tmp6});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 377);
+    TNode<Int32T> tmp8;
+    USE(tmp8);
+    tmp8 = CodeStubAssembler(state_).LoadMapElementsKind(TNode<Map>{tmp7});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 378);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 380);
+    TNode<BoolT> tmp9;
+    USE(tmp9);
+    tmp9 = CodeStubAssembler(state_).IsElementsKindGreaterThan(TNode<Int32T>{tmp8}, UINT32_ELEMENTS);
+    ca_.Branch(tmp9, &block2, &block3, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp7, tmp8, ca_.Uninitialized<BuiltinPtr>());
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp10;
+    TNode<JSReceiver> tmp11;
+    TNode<String> tmp12;
+    TNode<Number> tmp13;
+    TNode<Object> tmp14;
+    TNode<Object> tmp15;
+    TNode<Map> tmp16;
+    TNode<Int32T> tmp17;
+    TNode<BuiltinPtr> tmp18;
+    ca_.Bind(&block2, &tmp10, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 381);
+    TNode<Int32T> tmp19;
+    USE(tmp19);
+    tmp19 = FromConstexpr14ATElementsKind24ATconstexpr_ElementsKind_170(state_, INT32_ELEMENTS);
+    TNode<BoolT> tmp20;
+    USE(tmp20);
+    tmp20 = CodeStubAssembler(state_).ElementsKindEqual(TNode<Int32T>{tmp17}, TNode<Int32T>{tmp19});
+    ca_.Branch(tmp20, &block5, &block6, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15, tmp16, tmp17, tmp18);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp21;
+    TNode<JSReceiver> tmp22;
+    TNode<String> tmp23;
+    TNode<Number> tmp24;
+    TNode<Object> tmp25;
+    TNode<Object> tmp26;
+    TNode<Map> tmp27;
+    TNode<Int32T> tmp28;
+    TNode<BuiltinPtr> tmp29;
+    ca_.Bind(&block5, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27, &tmp28, &tmp29);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 382);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 381);
+    ca_.Goto(&block7, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27, tmp28, ca_.UncheckedCast<BuiltinPtr>(ca_.SmiConstant(Builtins::kLoadJoinTypedElement15ATInt32Elements)));
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp30;
+    TNode<JSReceiver> tmp31;
+    TNode<String> tmp32;
+    TNode<Number> tmp33;
+    TNode<Object> tmp34;
+    TNode<Object> tmp35;
+    TNode<Map> tmp36;
+    TNode<Int32T> tmp37;
+    TNode<BuiltinPtr> tmp38;
+    ca_.Bind(&block6, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34, &tmp35, &tmp36, &tmp37, &tmp38);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 383);
+    TNode<Int32T> tmp39;
+    USE(tmp39);
+    tmp39 = FromConstexpr14ATElementsKind24ATconstexpr_ElementsKind_170(state_, FLOAT32_ELEMENTS);
+    TNode<BoolT> tmp40;
+    USE(tmp40);
+    tmp40 = CodeStubAssembler(state_).ElementsKindEqual(TNode<Int32T>{tmp37}, TNode<Int32T>{tmp39});
+    ca_.Branch(tmp40, &block8, &block9, tmp30, tmp31, tmp32, tmp33, tmp34, tmp35, tmp36, tmp37, tmp38);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp41;
+    TNode<JSReceiver> tmp42;
+    TNode<String> tmp43;
+    TNode<Number> tmp44;
+    TNode<Object> tmp45;
+    TNode<Object> tmp46;
+    TNode<Map> tmp47;
+    TNode<Int32T> tmp48;
+    TNode<BuiltinPtr> tmp49;
+    ca_.Bind(&block8, &tmp41, &tmp42, &tmp43, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 384);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 383);
+    ca_.Goto(&block10, tmp41, tmp42, tmp43, tmp44, tmp45, tmp46, tmp47, tmp48, ca_.UncheckedCast<BuiltinPtr>(ca_.SmiConstant(Builtins::kLoadJoinTypedElement17ATFloat32Elements)));
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp50;
+    TNode<JSReceiver> tmp51;
+    TNode<String> tmp52;
+    TNode<Number> tmp53;
+    TNode<Object> tmp54;
+    TNode<Object> tmp55;
+    TNode<Map> tmp56;
+    TNode<Int32T> tmp57;
+    TNode<BuiltinPtr> tmp58;
+    ca_.Bind(&block9, &tmp50, &tmp51, &tmp52, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 385);
+    TNode<Int32T> tmp59;
+    USE(tmp59);
+    tmp59 = FromConstexpr14ATElementsKind24ATconstexpr_ElementsKind_170(state_, FLOAT64_ELEMENTS);
+    TNode<BoolT> tmp60;
+    USE(tmp60);
+    tmp60 = CodeStubAssembler(state_).ElementsKindEqual(TNode<Int32T>{tmp57}, TNode<Int32T>{tmp59});
+    ca_.Branch(tmp60, &block11, &block12, tmp50, tmp51, tmp52, tmp53, tmp54, tmp55, tmp56, tmp57, tmp58);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp61;
+    TNode<JSReceiver> tmp62;
+    TNode<String> tmp63;
+    TNode<Number> tmp64;
+    TNode<Object> tmp65;
+    TNode<Object> tmp66;
+    TNode<Map> tmp67;
+    TNode<Int32T> tmp68;
+    TNode<BuiltinPtr> tmp69;
+    ca_.Bind(&block11, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 386);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 385);
+    ca_.Goto(&block13, tmp61, tmp62, tmp63, tmp64, tmp65, tmp66, tmp67, tmp68, ca_.UncheckedCast<BuiltinPtr>(ca_.SmiConstant(Builtins::kLoadJoinTypedElement17ATFloat64Elements)));
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp70;
+    TNode<JSReceiver> tmp71;
+    TNode<String> tmp72;
+    TNode<Number> tmp73;
+    TNode<Object> tmp74;
+    TNode<Object> tmp75;
+    TNode<Map> tmp76;
+    TNode<Int32T> tmp77;
+    TNode<BuiltinPtr> tmp78;
+    ca_.Bind(&block12, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 387);
+    TNode<Int32T> tmp79;
+    USE(tmp79);
+    tmp79 = FromConstexpr14ATElementsKind24ATconstexpr_ElementsKind_170(state_, UINT8_CLAMPED_ELEMENTS);
+    TNode<BoolT> tmp80;
+    USE(tmp80);
+    tmp80 = CodeStubAssembler(state_).ElementsKindEqual(TNode<Int32T>{tmp77}, TNode<Int32T>{tmp79});
+    ca_.Branch(tmp80, &block14, &block15, tmp70, tmp71, tmp72, tmp73, tmp74, tmp75, tmp76, tmp77, tmp78);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp81;
+    TNode<JSReceiver> tmp82;
+    TNode<String> tmp83;
+    TNode<Number> tmp84;
+    TNode<Object> tmp85;
+    TNode<Object> tmp86;
+    TNode<Map> tmp87;
+    TNode<Int32T> tmp88;
+    TNode<BuiltinPtr> tmp89;
+    ca_.Bind(&block14, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 388);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 387);
+    ca_.Goto(&block16, tmp81, tmp82, tmp83, tmp84, tmp85, tmp86, tmp87, tmp88, ca_.UncheckedCast<BuiltinPtr>(ca_.SmiConstant(Builtins::kLoadJoinTypedElement22ATUint8ClampedElements)));
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp90;
+    TNode<JSReceiver> tmp91;
+    TNode<String> tmp92;
+    TNode<Number> tmp93;
+    TNode<Object> tmp94;
+    TNode<Object> tmp95;
+    TNode<Map> tmp96;
+    TNode<Int32T> tmp97;
+    TNode<BuiltinPtr> tmp98;
+    ca_.Bind(&block15, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96, &tmp97, &tmp98);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 389);
+    TNode<Int32T> tmp99;
+    USE(tmp99);
+    tmp99 = FromConstexpr14ATElementsKind24ATconstexpr_ElementsKind_170(state_, BIGUINT64_ELEMENTS);
+    TNode<BoolT> tmp100;
+    USE(tmp100);
+    tmp100 = CodeStubAssembler(state_).ElementsKindEqual(TNode<Int32T>{tmp97}, TNode<Int32T>{tmp99});
+    ca_.Branch(tmp100, &block17, &block18, tmp90, tmp91, tmp92, tmp93, tmp94, tmp95, tmp96, tmp97, tmp98);
+  }
+
+  if (block17.is_used()) {
+    TNode<Context> tmp101;
+    TNode<JSReceiver> tmp102;
+    TNode<String> tmp103;
+    TNode<Number> tmp104;
+    TNode<Object> tmp105;
+    TNode<Object> tmp106;
+    TNode<Map> tmp107;
+    TNode<Int32T> tmp108;
+    TNode<BuiltinPtr> tmp109;
+    ca_.Bind(&block17, &tmp101, &tmp102, &tmp103, &tmp104, &tmp105, &tmp106, &tmp107, &tmp108, &tmp109);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 390);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 389);
+    ca_.Goto(&block19, tmp101, tmp102, tmp103, tmp104, tmp105, tmp106, tmp107, tmp108, ca_.UncheckedCast<BuiltinPtr>(ca_.SmiConstant(Builtins::kLoadJoinTypedElement19ATBigUint64Elements)));
+  }
+
+  if (block18.is_used()) {
+    TNode<Context> tmp110;
+    TNode<JSReceiver> tmp111;
+    TNode<String> tmp112;
+    TNode<Number> tmp113;
+    TNode<Object> tmp114;
+    TNode<Object> tmp115;
+    TNode<Map> tmp116;
+    TNode<Int32T> tmp117;
+    TNode<BuiltinPtr> tmp118;
+    ca_.Bind(&block18, &tmp110, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115, &tmp116, &tmp117, &tmp118);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 391);
+    TNode<Int32T> tmp119;
+    USE(tmp119);
+    tmp119 = FromConstexpr14ATElementsKind24ATconstexpr_ElementsKind_170(state_, BIGINT64_ELEMENTS);
+    TNode<BoolT> tmp120;
+    USE(tmp120);
+    tmp120 = CodeStubAssembler(state_).ElementsKindEqual(TNode<Int32T>{tmp117}, TNode<Int32T>{tmp119});
+    ca_.Branch(tmp120, &block20, &block21, tmp110, tmp111, tmp112, tmp113, tmp114, tmp115, tmp116, tmp117, tmp118);
+  }
+
+  if (block20.is_used()) {
+    TNode<Context> tmp121;
+    TNode<JSReceiver> tmp122;
+    TNode<String> tmp123;
+    TNode<Number> tmp124;
+    TNode<Object> tmp125;
+    TNode<Object> tmp126;
+    TNode<Map> tmp127;
+    TNode<Int32T> tmp128;
+    TNode<BuiltinPtr> tmp129;
+    ca_.Bind(&block20, &tmp121, &tmp122, &tmp123, &tmp124, &tmp125, &tmp126, &tmp127, &tmp128, &tmp129);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 392);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 391);
+    ca_.Goto(&block22, tmp121, tmp122, tmp123, tmp124, tmp125, tmp126, tmp127, tmp128, ca_.UncheckedCast<BuiltinPtr>(ca_.SmiConstant(Builtins::kLoadJoinTypedElement18ATBigInt64Elements)));
+  }
+
+  if (block21.is_used()) {
+    TNode<Context> tmp130;
+    TNode<JSReceiver> tmp131;
+    TNode<String> tmp132;
+    TNode<Number> tmp133;
+    TNode<Object> tmp134;
+    TNode<Object> tmp135;
+    TNode<Map> tmp136;
+    TNode<Int32T> tmp137;
+    TNode<BuiltinPtr> tmp138;
+    ca_.Bind(&block21, &tmp130, &tmp131, &tmp132, &tmp133, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 394);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block22.is_used()) {
+    TNode<Context> tmp139;
+    TNode<JSReceiver> tmp140;
+    TNode<String> tmp141;
+    TNode<Number> tmp142;
+    TNode<Object> tmp143;
+    TNode<Object> tmp144;
+    TNode<Map> tmp145;
+    TNode<Int32T> tmp146;
+    TNode<BuiltinPtr> tmp147;
+    ca_.Bind(&block22, &tmp139, &tmp140, &tmp141, &tmp142, &tmp143, &tmp144, &tmp145, &tmp146, &tmp147);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 389);
+    ca_.Goto(&block19, tmp139, tmp140, tmp141, tmp142, tmp143, tmp144, tmp145, tmp146, tmp147);
+  }
+
+  if (block19.is_used()) {
+    TNode<Context> tmp148;
+    TNode<JSReceiver> tmp149;
+    TNode<String> tmp150;
+    TNode<Number> tmp151;
+    TNode<Object> tmp152;
+    TNode<Object> tmp153;
+    TNode<Map> tmp154;
+    TNode<Int32T> tmp155;
+    TNode<BuiltinPtr> tmp156;
+    ca_.Bind(&block19, &tmp148, &tmp149, &tmp150, &tmp151, &tmp152, &tmp153, &tmp154, &tmp155, &tmp156);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 387);
+    ca_.Goto(&block16, tmp148, tmp149, tmp150, tmp151, tmp152, tmp153, tmp154, tmp155, tmp156);
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp157;
+    TNode<JSReceiver> tmp158;
+    TNode<String> tmp159;
+    TNode<Number> tmp160;
+    TNode<Object> tmp161;
+    TNode<Object> tmp162;
+    TNode<Map> tmp163;
+    TNode<Int32T> tmp164;
+    TNode<BuiltinPtr> tmp165;
+    ca_.Bind(&block16, &tmp157, &tmp158, &tmp159, &tmp160, &tmp161, &tmp162, &tmp163, &tmp164, &tmp165);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 385);
+    ca_.Goto(&block13, tmp157, tmp158, tmp159, tmp160, tmp161, tmp162, tmp163, tmp164, tmp165);
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp166;
+    TNode<JSReceiver> tmp167;
+    TNode<String> tmp168;
+    TNode<Number> tmp169;
+    TNode<Object> tmp170;
+    TNode<Object> tmp171;
+    TNode<Map> tmp172;
+    TNode<Int32T> tmp173;
+    TNode<BuiltinPtr> tmp174;
+    ca_.Bind(&block13, &tmp166, &tmp167, &tmp168, &tmp169, &tmp170, &tmp171, &tmp172, &tmp173, &tmp174);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 383);
+    ca_.Goto(&block10, tmp166, tmp167, tmp168, tmp169, tmp170, tmp171, tmp172, tmp173, tmp174);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp175;
+    TNode<JSReceiver> tmp176;
+    TNode<String> tmp177;
+    TNode<Number> tmp178;
+    TNode<Object> tmp179;
+    TNode<Object> tmp180;
+    TNode<Map> tmp181;
+    TNode<Int32T> tmp182;
+    TNode<BuiltinPtr> tmp183;
+    ca_.Bind(&block10, &tmp175, &tmp176, &tmp177, &tmp178, &tmp179, &tmp180, &tmp181, &tmp182, &tmp183);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 381);
+    ca_.Goto(&block7, tmp175, tmp176, tmp177, tmp178, tmp179, tmp180, tmp181, tmp182, tmp183);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp184;
+    TNode<JSReceiver> tmp185;
+    TNode<String> tmp186;
+    TNode<Number> tmp187;
+    TNode<Object> tmp188;
+    TNode<Object> tmp189;
+    TNode<Map> tmp190;
+    TNode<Int32T> tmp191;
+    TNode<BuiltinPtr> tmp192;
+    ca_.Bind(&block7, &tmp184, &tmp185, &tmp186, &tmp187, &tmp188, &tmp189, &tmp190, &tmp191, &tmp192);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 380);
+    ca_.Goto(&block4, tmp184, tmp185, tmp186, tmp187, tmp188, tmp189, tmp190, tmp191, tmp192);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp193;
+    TNode<JSReceiver> tmp194;
+    TNode<String> tmp195;
+    TNode<Number> tmp196;
+    TNode<Object> tmp197;
+    TNode<Object> tmp198;
+    TNode<Map> tmp199;
+    TNode<Int32T> tmp200;
+    TNode<BuiltinPtr> tmp201;
+    ca_.Bind(&block3, &tmp193, &tmp194, &tmp195, &tmp196, &tmp197, &tmp198, &tmp199, &tmp200, &tmp201);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 397);
+    TNode<Int32T> tmp202;
+    USE(tmp202);
+    tmp202 = FromConstexpr14ATElementsKind24ATconstexpr_ElementsKind_170(state_, UINT8_ELEMENTS);
+    TNode<BoolT> tmp203;
+    USE(tmp203);
+    tmp203 = CodeStubAssembler(state_).ElementsKindEqual(TNode<Int32T>{tmp200}, TNode<Int32T>{tmp202});
+    ca_.Branch(tmp203, &block23, &block24, tmp193, tmp194, tmp195, tmp196, tmp197, tmp198, tmp199, tmp200, tmp201);
+  }
+
+  if (block23.is_used()) {
+    TNode<Context> tmp204;
+    TNode<JSReceiver> tmp205;
+    TNode<String> tmp206;
+    TNode<Number> tmp207;
+    TNode<Object> tmp208;
+    TNode<Object> tmp209;
+    TNode<Map> tmp210;
+    TNode<Int32T> tmp211;
+    TNode<BuiltinPtr> tmp212;
+    ca_.Bind(&block23, &tmp204, &tmp205, &tmp206, &tmp207, &tmp208, &tmp209, &tmp210, &tmp211, &tmp212);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 398);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 397);
+    ca_.Goto(&block25, tmp204, tmp205, tmp206, tmp207, tmp208, tmp209, tmp210, tmp211, ca_.UncheckedCast<BuiltinPtr>(ca_.SmiConstant(Builtins::kLoadJoinTypedElement15ATUint8Elements)));
+  }
+
+  if (block24.is_used()) {
+    TNode<Context> tmp213;
+    TNode<JSReceiver> tmp214;
+    TNode<String> tmp215;
+    TNode<Number> tmp216;
+    TNode<Object> tmp217;
+    TNode<Object> tmp218;
+    TNode<Map> tmp219;
+    TNode<Int32T> tmp220;
+    TNode<BuiltinPtr> tmp221;
+    ca_.Bind(&block24, &tmp213, &tmp214, &tmp215, &tmp216, &tmp217, &tmp218, &tmp219, &tmp220, &tmp221);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 399);
+    TNode<Int32T> tmp222;
+    USE(tmp222);
+    tmp222 = FromConstexpr14ATElementsKind24ATconstexpr_ElementsKind_170(state_, INT8_ELEMENTS);
+    TNode<BoolT> tmp223;
+    USE(tmp223);
+    tmp223 = CodeStubAssembler(state_).ElementsKindEqual(TNode<Int32T>{tmp220}, TNode<Int32T>{tmp222});
+    ca_.Branch(tmp223, &block26, &block27, tmp213, tmp214, tmp215, tmp216, tmp217, tmp218, tmp219, tmp220, tmp221);
+  }
+
+  if (block26.is_used()) {
+    TNode<Context> tmp224;
+    TNode<JSReceiver> tmp225;
+    TNode<String> tmp226;
+    TNode<Number> tmp227;
+    TNode<Object> tmp228;
+    TNode<Object> tmp229;
+    TNode<Map> tmp230;
+    TNode<Int32T> tmp231;
+    TNode<BuiltinPtr> tmp232;
+    ca_.Bind(&block26, &tmp224, &tmp225, &tmp226, &tmp227, &tmp228, &tmp229, &tmp230, &tmp231, &tmp232);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 400);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 399);
+    ca_.Goto(&block28, tmp224, tmp225, tmp226, tmp227, tmp228, tmp229, tmp230, tmp231, ca_.UncheckedCast<BuiltinPtr>(ca_.SmiConstant(Builtins::kLoadJoinTypedElement14ATInt8Elements)));
+  }
+
+  if (block27.is_used()) {
+    TNode<Context> tmp233;
+    TNode<JSReceiver> tmp234;
+    TNode<String> tmp235;
+    TNode<Number> tmp236;
+    TNode<Object> tmp237;
+    TNode<Object> tmp238;
+    TNode<Map> tmp239;
+    TNode<Int32T> tmp240;
+    TNode<BuiltinPtr> tmp241;
+    ca_.Bind(&block27, &tmp233, &tmp234, &tmp235, &tmp236, &tmp237, &tmp238, &tmp239, &tmp240, &tmp241);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 401);
+    TNode<Int32T> tmp242;
+    USE(tmp242);
+    tmp242 = FromConstexpr14ATElementsKind24ATconstexpr_ElementsKind_170(state_, UINT16_ELEMENTS);
+    TNode<BoolT> tmp243;
+    USE(tmp243);
+    tmp243 = CodeStubAssembler(state_).ElementsKindEqual(TNode<Int32T>{tmp240}, TNode<Int32T>{tmp242});
+    ca_.Branch(tmp243, &block29, &block30, tmp233, tmp234, tmp235, tmp236, tmp237, tmp238, tmp239, tmp240, tmp241);
+  }
+
+  if (block29.is_used()) {
+    TNode<Context> tmp244;
+    TNode<JSReceiver> tmp245;
+    TNode<String> tmp246;
+    TNode<Number> tmp247;
+    TNode<Object> tmp248;
+    TNode<Object> tmp249;
+    TNode<Map> tmp250;
+    TNode<Int32T> tmp251;
+    TNode<BuiltinPtr> tmp252;
+    ca_.Bind(&block29, &tmp244, &tmp245, &tmp246, &tmp247, &tmp248, &tmp249, &tmp250, &tmp251, &tmp252);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 402);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 401);
+    ca_.Goto(&block31, tmp244, tmp245, tmp246, tmp247, tmp248, tmp249, tmp250, tmp251, ca_.UncheckedCast<BuiltinPtr>(ca_.SmiConstant(Builtins::kLoadJoinTypedElement16ATUint16Elements)));
+  }
+
+  if (block30.is_used()) {
+    TNode<Context> tmp253;
+    TNode<JSReceiver> tmp254;
+    TNode<String> tmp255;
+    TNode<Number> tmp256;
+    TNode<Object> tmp257;
+    TNode<Object> tmp258;
+    TNode<Map> tmp259;
+    TNode<Int32T> tmp260;
+    TNode<BuiltinPtr> tmp261;
+    ca_.Bind(&block30, &tmp253, &tmp254, &tmp255, &tmp256, &tmp257, &tmp258, &tmp259, &tmp260, &tmp261);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 403);
+    TNode<Int32T> tmp262;
+    USE(tmp262);
+    tmp262 = FromConstexpr14ATElementsKind24ATconstexpr_ElementsKind_170(state_, INT16_ELEMENTS);
+    TNode<BoolT> tmp263;
+    USE(tmp263);
+    tmp263 = CodeStubAssembler(state_).ElementsKindEqual(TNode<Int32T>{tmp260}, TNode<Int32T>{tmp262});
+    ca_.Branch(tmp263, &block32, &block33, tmp253, tmp254, tmp255, tmp256, tmp257, tmp258, tmp259, tmp260, tmp261);
+  }
+
+  if (block32.is_used()) {
+    TNode<Context> tmp264;
+    TNode<JSReceiver> tmp265;
+    TNode<String> tmp266;
+    TNode<Number> tmp267;
+    TNode<Object> tmp268;
+    TNode<Object> tmp269;
+    TNode<Map> tmp270;
+    TNode<Int32T> tmp271;
+    TNode<BuiltinPtr> tmp272;
+    ca_.Bind(&block32, &tmp264, &tmp265, &tmp266, &tmp267, &tmp268, &tmp269, &tmp270, &tmp271, &tmp272);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 404);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 403);
+    ca_.Goto(&block34, tmp264, tmp265, tmp266, tmp267, tmp268, tmp269, tmp270, tmp271, ca_.UncheckedCast<BuiltinPtr>(ca_.SmiConstant(Builtins::kLoadJoinTypedElement15ATInt16Elements)));
+  }
+
+  if (block33.is_used()) {
+    TNode<Context> tmp273;
+    TNode<JSReceiver> tmp274;
+    TNode<String> tmp275;
+    TNode<Number> tmp276;
+    TNode<Object> tmp277;
+    TNode<Object> tmp278;
+    TNode<Map> tmp279;
+    TNode<Int32T> tmp280;
+    TNode<BuiltinPtr> tmp281;
+    ca_.Bind(&block33, &tmp273, &tmp274, &tmp275, &tmp276, &tmp277, &tmp278, &tmp279, &tmp280, &tmp281);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 405);
+    TNode<Int32T> tmp282;
+    USE(tmp282);
+    tmp282 = FromConstexpr14ATElementsKind24ATconstexpr_ElementsKind_170(state_, UINT32_ELEMENTS);
+    TNode<BoolT> tmp283;
+    USE(tmp283);
+    tmp283 = CodeStubAssembler(state_).ElementsKindEqual(TNode<Int32T>{tmp280}, TNode<Int32T>{tmp282});
+    ca_.Branch(tmp283, &block35, &block36, tmp273, tmp274, tmp275, tmp276, tmp277, tmp278, tmp279, tmp280, tmp281);
+  }
+
+  if (block35.is_used()) {
+    TNode<Context> tmp284;
+    TNode<JSReceiver> tmp285;
+    TNode<String> tmp286;
+    TNode<Number> tmp287;
+    TNode<Object> tmp288;
+    TNode<Object> tmp289;
+    TNode<Map> tmp290;
+    TNode<Int32T> tmp291;
+    TNode<BuiltinPtr> tmp292;
+    ca_.Bind(&block35, &tmp284, &tmp285, &tmp286, &tmp287, &tmp288, &tmp289, &tmp290, &tmp291, &tmp292);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 406);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 405);
+    ca_.Goto(&block37, tmp284, tmp285, tmp286, tmp287, tmp288, tmp289, tmp290, tmp291, ca_.UncheckedCast<BuiltinPtr>(ca_.SmiConstant(Builtins::kLoadJoinTypedElement16ATUint32Elements)));
+  }
+
+  if (block36.is_used()) {
+    TNode<Context> tmp293;
+    TNode<JSReceiver> tmp294;
+    TNode<String> tmp295;
+    TNode<Number> tmp296;
+    TNode<Object> tmp297;
+    TNode<Object> tmp298;
+    TNode<Map> tmp299;
+    TNode<Int32T> tmp300;
+    TNode<BuiltinPtr> tmp301;
+    ca_.Bind(&block36, &tmp293, &tmp294, &tmp295, &tmp296, &tmp297, &tmp298, &tmp299, &tmp300, &tmp301);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 408);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block37.is_used()) {
+    TNode<Context> tmp302;
+    TNode<JSReceiver> tmp303;
+    TNode<String> tmp304;
+    TNode<Number> tmp305;
+    TNode<Object> tmp306;
+    TNode<Object> tmp307;
+    TNode<Map> tmp308;
+    TNode<Int32T> tmp309;
+    TNode<BuiltinPtr> tmp310;
+    ca_.Bind(&block37, &tmp302, &tmp303, &tmp304, &tmp305, &tmp306, &tmp307, &tmp308, &tmp309, &tmp310);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 403);
+    ca_.Goto(&block34, tmp302, tmp303, tmp304, tmp305, tmp306, tmp307, tmp308, tmp309, tmp310);
+  }
+
+  if (block34.is_used()) {
+    TNode<Context> tmp311;
+    TNode<JSReceiver> tmp312;
+    TNode<String> tmp313;
+    TNode<Number> tmp314;
+    TNode<Object> tmp315;
+    TNode<Object> tmp316;
+    TNode<Map> tmp317;
+    TNode<Int32T> tmp318;
+    TNode<BuiltinPtr> tmp319;
+    ca_.Bind(&block34, &tmp311, &tmp312, &tmp313, &tmp314, &tmp315, &tmp316, &tmp317, &tmp318, &tmp319);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 401);
+    ca_.Goto(&block31, tmp311, tmp312, tmp313, tmp314, tmp315, tmp316, tmp317, tmp318, tmp319);
+  }
+
+  if (block31.is_used()) {
+    TNode<Context> tmp320;
+    TNode<JSReceiver> tmp321;
+    TNode<String> tmp322;
+    TNode<Number> tmp323;
+    TNode<Object> tmp324;
+    TNode<Object> tmp325;
+    TNode<Map> tmp326;
+    TNode<Int32T> tmp327;
+    TNode<BuiltinPtr> tmp328;
+    ca_.Bind(&block31, &tmp320, &tmp321, &tmp322, &tmp323, &tmp324, &tmp325, &tmp326, &tmp327, &tmp328);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 399);
+    ca_.Goto(&block28, tmp320, tmp321, tmp322, tmp323, tmp324, tmp325, tmp326, tmp327, tmp328);
+  }
+
+  if (block28.is_used()) {
+    TNode<Context> tmp329;
+    TNode<JSReceiver> tmp330;
+    TNode<String> tmp331;
+    TNode<Number> tmp332;
+    TNode<Object> tmp333;
+    TNode<Object> tmp334;
+    TNode<Map> tmp335;
+    TNode<Int32T> tmp336;
+    TNode<BuiltinPtr> tmp337;
+    ca_.Bind(&block28, &tmp329, &tmp330, &tmp331, &tmp332, &tmp333, &tmp334, &tmp335, &tmp336, &tmp337);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 397);
+    ca_.Goto(&block25, tmp329, tmp330, tmp331, tmp332, tmp333, tmp334, tmp335, tmp336, tmp337);
+  }
+
+  if (block25.is_used()) {
+    TNode<Context> tmp338;
+    TNode<JSReceiver> tmp339;
+    TNode<String> tmp340;
+    TNode<Number> tmp341;
+    TNode<Object> tmp342;
+    TNode<Object> tmp343;
+    TNode<Map> tmp344;
+    TNode<Int32T> tmp345;
+    TNode<BuiltinPtr> tmp346;
+    ca_.Bind(&block25, &tmp338, &tmp339, &tmp340, &tmp341, &tmp342, &tmp343, &tmp344, &tmp345, &tmp346);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 380);
+    ca_.Goto(&block4, tmp338, tmp339, tmp340, tmp341, tmp342, tmp343, tmp344, tmp345, tmp346);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp347;
+    TNode<JSReceiver> tmp348;
+    TNode<String> tmp349;
+    TNode<Number> tmp350;
+    TNode<Object> tmp351;
+    TNode<Object> tmp352;
+    TNode<Map> tmp353;
+    TNode<Int32T> tmp354;
+    TNode<BuiltinPtr> tmp355;
+    ca_.Bind(&block4, &tmp347, &tmp348, &tmp349, &tmp350, &tmp351, &tmp352, &tmp353, &tmp354, &tmp355);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 412);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 411);
+    TNode<String> tmp356;
+    USE(tmp356);
+    tmp356 = ArrayJoinImpl12JSTypedArray_1379(state_, TNode<Context>{tmp347}, TNode<JSReceiver>{tmp348}, TNode<String>{tmp349}, TNode<Number>{tmp350}, p_useToLocaleString, TNode<Object>{tmp351}, TNode<Object>{tmp352}, TNode<BuiltinPtr>{tmp355});
+    ca_.Goto(&block1, tmp347, tmp348, tmp349, tmp350, tmp351, tmp352, tmp356);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp357;
+    TNode<JSReceiver> tmp358;
+    TNode<String> tmp359;
+    TNode<Number> tmp360;
+    TNode<Object> tmp361;
+    TNode<Object> tmp362;
+    TNode<Object> tmp363;
+    ca_.Bind(&block1, &tmp357, &tmp358, &tmp359, &tmp360, &tmp361, &tmp362, &tmp363);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 373);
+    ca_.Goto(&block38, tmp357, tmp358, tmp359, tmp360, tmp361, tmp362, tmp363);
+  }
+
+    TNode<Context> tmp364;
+    TNode<JSReceiver> tmp365;
+    TNode<String> tmp366;
+    TNode<Number> tmp367;
+    TNode<Object> tmp368;
+    TNode<Object> tmp369;
+    TNode<Object> tmp370;
+    ca_.Bind(&block38, &tmp364, &tmp365, &tmp366, &tmp367, &tmp368, &tmp369, &tmp370);
+  return TNode<Object>{tmp370};
+}
+
+TNode<FixedArray> LoadJoinStack_15(compiler::CodeAssemblerState* state_, TNode<Context> p_context, compiler::CodeAssemblerLabel* label_IfUninitialized) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, NativeContext, HeapObject> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, NativeContext, HeapObject> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, NativeContext, HeapObject> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, NativeContext, HeapObject> block8(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, NativeContext, HeapObject> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, NativeContext, HeapObject> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    ca_.Bind(&block0, &tmp0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 424);
+    TNode<NativeContext> tmp1;
+    USE(tmp1);
+    tmp1 = CodeStubAssembler(state_).LoadNativeContext(TNode<Context>{tmp0});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 426);
+    TNode<IntPtrT> tmp2;
+    USE(tmp2);
+    tmp2 = FromConstexpr19ATNativeContextSlot29ATconstexpr_NativeContextSlot_173(state_, Context::ARRAY_JOIN_STACK_INDEX);
+    TNode<Object> tmp3;
+    USE(tmp3);
+    tmp3 = CodeStubAssembler(state_).LoadContextElement(TNode<NativeContext>{tmp1}, TNode<IntPtrT>{tmp2});
+    TNode<HeapObject> tmp4;
+    USE(tmp4);
+    tmp4 = UnsafeCast10HeapObject_1380(state_, TNode<Context>{tmp0}, TNode<Object>{tmp3});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 425);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 427);
+    TNode<Oddball> tmp5;
+    USE(tmp5);
+    tmp5 = Undefined_64(state_);
+    TNode<BoolT> tmp6;
+    USE(tmp6);
+    tmp6 = CodeStubAssembler(state_).TaggedEqual(TNode<Object>{tmp4}, TNode<HeapObject>{tmp5});
+    ca_.Branch(tmp6, &block3, &block4, tmp0, tmp1, tmp4);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp7;
+    TNode<NativeContext> tmp8;
+    TNode<HeapObject> tmp9;
+    ca_.Bind(&block3, &tmp7, &tmp8, &tmp9);
+    ca_.Goto(&block1);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp10;
+    TNode<NativeContext> tmp11;
+    TNode<HeapObject> tmp12;
+    ca_.Bind(&block4, &tmp10, &tmp11, &tmp12);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 428);
+    ca_.Goto(&block6, tmp10, tmp11, tmp12);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp13;
+    TNode<NativeContext> tmp14;
+    TNode<HeapObject> tmp15;
+    ca_.Bind(&block5, &tmp13, &tmp14, &tmp15);
+    TNode<BoolT> tmp16;
+    USE(tmp16);
+    tmp16 = CodeStubAssembler(state_).IsFixedArray(TNode<HeapObject>{tmp15});
+    ca_.Branch(tmp16, &block7, &block8, tmp13, tmp14, tmp15);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp17;
+    TNode<NativeContext> tmp18;
+    TNode<HeapObject> tmp19;
+    ca_.Bind(&block8, &tmp17, &tmp18, &tmp19);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'IsFixedArray(stack)' failed", "../../deps/v8/src/builtins/array-join.tq", 428);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp20;
+    TNode<NativeContext> tmp21;
+    TNode<HeapObject> tmp22;
+    ca_.Bind(&block7, &tmp20, &tmp21, &tmp22);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp23;
+    TNode<NativeContext> tmp24;
+    TNode<HeapObject> tmp25;
+    ca_.Bind(&block6, &tmp23, &tmp24, &tmp25);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 429);
+    TNode<FixedArray> tmp26;
+    USE(tmp26);
+    tmp26 = UnsafeCast10FixedArray_1370(state_, TNode<Context>{tmp23}, TNode<Object>{tmp25});
+    ca_.Goto(&block2, tmp23, tmp26);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp27;
+    TNode<FixedArray> tmp28;
+    ca_.Bind(&block2, &tmp27, &tmp28);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 422);
+    ca_.Goto(&block9, tmp27, tmp28);
+  }
+
+  if (block1.is_used()) {
+    ca_.Bind(&block1);
+    ca_.Goto(label_IfUninitialized);
+  }
+
+    TNode<Context> tmp29;
+    TNode<FixedArray> tmp30;
+    ca_.Bind(&block9, &tmp29, &tmp30);
+  return TNode<FixedArray>{tmp30};
+}
+
+void SetJoinStack_16(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<FixedArray> p_stack) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_stack);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<FixedArray> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 433);
+    TNode<NativeContext> tmp2;
+    USE(tmp2);
+    tmp2 = CodeStubAssembler(state_).LoadNativeContext(TNode<Context>{tmp0});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 434);
+    TNode<IntPtrT> tmp3;
+    USE(tmp3);
+    tmp3 = FromConstexpr19ATNativeContextSlot29ATconstexpr_NativeContextSlot_173(state_, Context::ARRAY_JOIN_STACK_INDEX);
+    CodeStubAssembler(state_).StoreContextElement(TNode<NativeContext>{tmp2}, TNode<IntPtrT>{tmp3}, TNode<Object>{tmp1});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 432);
+    ca_.Goto(&block1, tmp0, tmp1);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp4;
+    TNode<FixedArray> tmp5;
+    ca_.Bind(&block1, &tmp4, &tmp5);
+    ca_.Goto(&block2, tmp4, tmp5);
+  }
+
+    TNode<Context> tmp6;
+    TNode<FixedArray> tmp7;
+    ca_.Bind(&block2, &tmp6, &tmp7);
+}
+
+TF_BUILTIN(JoinStackPush, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<FixedArray> parameter1 = UncheckedCast<FixedArray>(Parameter(Descriptor::ParameterIndex<0>()));
+  USE(parameter1);
+  TNode<JSReceiver> parameter2 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<1>()));
+  USE(parameter2);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, Object> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, Object, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, Object, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, Object, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, Object, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, Object, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, Object, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, Object> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, Object> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, Object> block22(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<FixedArray> tmp1;
+    TNode<JSReceiver> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 442);
+    TNode<IntPtrT> tmp3;
+    USE(tmp3);
+    tmp3 = CodeStubAssembler(state_).LoadAndUntagFixedArrayBaseLength(TNode<FixedArrayBase>{tmp1});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 443);
+    TNode<IntPtrT> tmp4;
+    USE(tmp4);
+    tmp4 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp2, tmp3, tmp4);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp5;
+    TNode<FixedArray> tmp6;
+    TNode<JSReceiver> tmp7;
+    TNode<IntPtrT> tmp8;
+    TNode<IntPtrT> tmp9;
+    ca_.Bind(&block3, &tmp5, &tmp6, &tmp7, &tmp8, &tmp9);
+    TNode<BoolT> tmp10;
+    USE(tmp10);
+    tmp10 = CodeStubAssembler(state_).IntPtrLessThan(TNode<IntPtrT>{tmp9}, TNode<IntPtrT>{tmp8});
+    ca_.Branch(tmp10, &block1, &block2, tmp5, tmp6, tmp7, tmp8, tmp9);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp11;
+    TNode<FixedArray> tmp12;
+    TNode<JSReceiver> tmp13;
+    TNode<IntPtrT> tmp14;
+    TNode<IntPtrT> tmp15;
+    ca_.Bind(&block1, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 444);
+    TNode<IntPtrT> tmp16 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp16);
+    TNode<IntPtrT> tmp17 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp17);
+    TNode<Smi>tmp18 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp12, tmp17});
+    TNode<IntPtrT> tmp19;
+    USE(tmp19);
+    tmp19 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp18});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 46);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp20;
+    USE(tmp20);
+    tmp20 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp15});
+    TNode<UintPtrT> tmp21;
+    USE(tmp21);
+    tmp21 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp19});
+    TNode<BoolT> tmp22;
+    USE(tmp22);
+    tmp22 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp20}, TNode<UintPtrT>{tmp21});
+    ca_.Branch(tmp22, &block9, &block10, tmp11, tmp12, tmp13, tmp14, tmp15, tmp12, tmp16, tmp19, tmp15, tmp15, tmp12, tmp16, tmp19, tmp15, tmp15);
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp23;
+    TNode<FixedArray> tmp24;
+    TNode<JSReceiver> tmp25;
+    TNode<IntPtrT> tmp26;
+    TNode<IntPtrT> tmp27;
+    TNode<FixedArray> tmp28;
+    TNode<IntPtrT> tmp29;
+    TNode<IntPtrT> tmp30;
+    TNode<IntPtrT> tmp31;
+    TNode<IntPtrT> tmp32;
+    TNode<HeapObject> tmp33;
+    TNode<IntPtrT> tmp34;
+    TNode<IntPtrT> tmp35;
+    TNode<IntPtrT> tmp36;
+    TNode<IntPtrT> tmp37;
+    ca_.Bind(&block9, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34, &tmp35, &tmp36, &tmp37);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp38;
+    USE(tmp38);
+    tmp38 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp39;
+    USE(tmp39);
+    tmp39 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp37}, TNode<IntPtrT>{tmp38});
+    TNode<IntPtrT> tmp40;
+    USE(tmp40);
+    tmp40 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp34}, TNode<IntPtrT>{tmp39});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp41;
+    USE(tmp41);
+    TNode<IntPtrT> tmp42;
+    USE(tmp42);
+    std::tie(tmp41, tmp42) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp33}, TNode<IntPtrT>{tmp40}).Flatten();
+    ca_.Goto(&block8, tmp23, tmp24, tmp25, tmp26, tmp27, tmp28, tmp29, tmp30, tmp31, tmp32, tmp33, tmp34, tmp35, tmp36, tmp37, tmp41, tmp42);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp43;
+    TNode<FixedArray> tmp44;
+    TNode<JSReceiver> tmp45;
+    TNode<IntPtrT> tmp46;
+    TNode<IntPtrT> tmp47;
+    TNode<FixedArray> tmp48;
+    TNode<IntPtrT> tmp49;
+    TNode<IntPtrT> tmp50;
+    TNode<IntPtrT> tmp51;
+    TNode<IntPtrT> tmp52;
+    TNode<HeapObject> tmp53;
+    TNode<IntPtrT> tmp54;
+    TNode<IntPtrT> tmp55;
+    TNode<IntPtrT> tmp56;
+    TNode<IntPtrT> tmp57;
+    ca_.Bind(&block10, &tmp43, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block7, tmp43, tmp44, tmp45, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51, tmp52);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp58;
+    TNode<FixedArray> tmp59;
+    TNode<JSReceiver> tmp60;
+    TNode<IntPtrT> tmp61;
+    TNode<IntPtrT> tmp62;
+    TNode<FixedArray> tmp63;
+    TNode<IntPtrT> tmp64;
+    TNode<IntPtrT> tmp65;
+    TNode<IntPtrT> tmp66;
+    TNode<IntPtrT> tmp67;
+    TNode<HeapObject> tmp68;
+    TNode<IntPtrT> tmp69;
+    TNode<IntPtrT> tmp70;
+    TNode<IntPtrT> tmp71;
+    TNode<IntPtrT> tmp72;
+    TNode<HeapObject> tmp73;
+    TNode<IntPtrT> tmp74;
+    ca_.Bind(&block8, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 46);
+    ca_.Goto(&block6, tmp58, tmp59, tmp60, tmp61, tmp62, tmp63, tmp64, tmp65, tmp66, tmp67, tmp73, tmp74);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp75;
+    TNode<FixedArray> tmp76;
+    TNode<JSReceiver> tmp77;
+    TNode<IntPtrT> tmp78;
+    TNode<IntPtrT> tmp79;
+    TNode<FixedArray> tmp80;
+    TNode<IntPtrT> tmp81;
+    TNode<IntPtrT> tmp82;
+    TNode<IntPtrT> tmp83;
+    TNode<IntPtrT> tmp84;
+    ca_.Bind(&block7, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp85;
+    TNode<FixedArray> tmp86;
+    TNode<JSReceiver> tmp87;
+    TNode<IntPtrT> tmp88;
+    TNode<IntPtrT> tmp89;
+    TNode<FixedArray> tmp90;
+    TNode<IntPtrT> tmp91;
+    TNode<IntPtrT> tmp92;
+    TNode<IntPtrT> tmp93;
+    TNode<IntPtrT> tmp94;
+    TNode<HeapObject> tmp95;
+    TNode<IntPtrT> tmp96;
+    ca_.Bind(&block6, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96);
+    ca_.Goto(&block5, tmp85, tmp86, tmp87, tmp88, tmp89, tmp90, tmp91, tmp92, tmp93, tmp94, tmp95, tmp96);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp97;
+    TNode<FixedArray> tmp98;
+    TNode<JSReceiver> tmp99;
+    TNode<IntPtrT> tmp100;
+    TNode<IntPtrT> tmp101;
+    TNode<FixedArray> tmp102;
+    TNode<IntPtrT> tmp103;
+    TNode<IntPtrT> tmp104;
+    TNode<IntPtrT> tmp105;
+    TNode<IntPtrT> tmp106;
+    TNode<HeapObject> tmp107;
+    TNode<IntPtrT> tmp108;
+    ca_.Bind(&block5, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104, &tmp105, &tmp106, &tmp107, &tmp108);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 444);
+    TNode<Object>tmp109 = CodeStubAssembler(state_).LoadReference<Object>(CodeStubAssembler::Reference{tmp107, tmp108});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 447);
+    TNode<Oddball> tmp110;
+    USE(tmp110);
+    tmp110 = TheHole_62(state_);
+    TNode<BoolT> tmp111;
+    USE(tmp111);
+    tmp111 = CodeStubAssembler(state_).TaggedEqual(TNode<Object>{tmp109}, TNode<HeapObject>{tmp110});
+    ca_.Branch(tmp111, &block12, &block13, tmp97, tmp98, tmp99, tmp100, tmp101, tmp109);
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp112;
+    TNode<FixedArray> tmp113;
+    TNode<JSReceiver> tmp114;
+    TNode<IntPtrT> tmp115;
+    TNode<IntPtrT> tmp116;
+    TNode<Object> tmp117;
+    ca_.Bind(&block12, &tmp112, &tmp113, &tmp114, &tmp115, &tmp116, &tmp117);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 448);
+    TNode<IntPtrT> tmp118 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp118);
+    TNode<IntPtrT> tmp119 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp119);
+    TNode<Smi>tmp120 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp113, tmp119});
+    TNode<IntPtrT> tmp121;
+    USE(tmp121);
+    tmp121 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp120});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 46);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp122;
+    USE(tmp122);
+    tmp122 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp116});
+    TNode<UintPtrT> tmp123;
+    USE(tmp123);
+    tmp123 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp121});
+    TNode<BoolT> tmp124;
+    USE(tmp124);
+    tmp124 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp122}, TNode<UintPtrT>{tmp123});
+    ca_.Branch(tmp124, &block18, &block19, tmp112, tmp113, tmp114, tmp115, tmp116, tmp117, tmp113, tmp118, tmp121, tmp116, tmp116, tmp113, tmp118, tmp121, tmp116, tmp116);
+  }
+
+  if (block18.is_used()) {
+    TNode<Context> tmp125;
+    TNode<FixedArray> tmp126;
+    TNode<JSReceiver> tmp127;
+    TNode<IntPtrT> tmp128;
+    TNode<IntPtrT> tmp129;
+    TNode<Object> tmp130;
+    TNode<FixedArray> tmp131;
+    TNode<IntPtrT> tmp132;
+    TNode<IntPtrT> tmp133;
+    TNode<IntPtrT> tmp134;
+    TNode<IntPtrT> tmp135;
+    TNode<HeapObject> tmp136;
+    TNode<IntPtrT> tmp137;
+    TNode<IntPtrT> tmp138;
+    TNode<IntPtrT> tmp139;
+    TNode<IntPtrT> tmp140;
+    ca_.Bind(&block18, &tmp125, &tmp126, &tmp127, &tmp128, &tmp129, &tmp130, &tmp131, &tmp132, &tmp133, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138, &tmp139, &tmp140);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp141;
+    USE(tmp141);
+    tmp141 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp142;
+    USE(tmp142);
+    tmp142 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp140}, TNode<IntPtrT>{tmp141});
+    TNode<IntPtrT> tmp143;
+    USE(tmp143);
+    tmp143 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp137}, TNode<IntPtrT>{tmp142});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp144;
+    USE(tmp144);
+    TNode<IntPtrT> tmp145;
+    USE(tmp145);
+    std::tie(tmp144, tmp145) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp136}, TNode<IntPtrT>{tmp143}).Flatten();
+    ca_.Goto(&block17, tmp125, tmp126, tmp127, tmp128, tmp129, tmp130, tmp131, tmp132, tmp133, tmp134, tmp135, tmp136, tmp137, tmp138, tmp139, tmp140, tmp144, tmp145);
+  }
+
+  if (block19.is_used()) {
+    TNode<Context> tmp146;
+    TNode<FixedArray> tmp147;
+    TNode<JSReceiver> tmp148;
+    TNode<IntPtrT> tmp149;
+    TNode<IntPtrT> tmp150;
+    TNode<Object> tmp151;
+    TNode<FixedArray> tmp152;
+    TNode<IntPtrT> tmp153;
+    TNode<IntPtrT> tmp154;
+    TNode<IntPtrT> tmp155;
+    TNode<IntPtrT> tmp156;
+    TNode<HeapObject> tmp157;
+    TNode<IntPtrT> tmp158;
+    TNode<IntPtrT> tmp159;
+    TNode<IntPtrT> tmp160;
+    TNode<IntPtrT> tmp161;
+    ca_.Bind(&block19, &tmp146, &tmp147, &tmp148, &tmp149, &tmp150, &tmp151, &tmp152, &tmp153, &tmp154, &tmp155, &tmp156, &tmp157, &tmp158, &tmp159, &tmp160, &tmp161);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block16, tmp146, tmp147, tmp148, tmp149, tmp150, tmp151, tmp152, tmp153, tmp154, tmp155, tmp156);
+  }
+
+  if (block17.is_used()) {
+    TNode<Context> tmp162;
+    TNode<FixedArray> tmp163;
+    TNode<JSReceiver> tmp164;
+    TNode<IntPtrT> tmp165;
+    TNode<IntPtrT> tmp166;
+    TNode<Object> tmp167;
+    TNode<FixedArray> tmp168;
+    TNode<IntPtrT> tmp169;
+    TNode<IntPtrT> tmp170;
+    TNode<IntPtrT> tmp171;
+    TNode<IntPtrT> tmp172;
+    TNode<HeapObject> tmp173;
+    TNode<IntPtrT> tmp174;
+    TNode<IntPtrT> tmp175;
+    TNode<IntPtrT> tmp176;
+    TNode<IntPtrT> tmp177;
+    TNode<HeapObject> tmp178;
+    TNode<IntPtrT> tmp179;
+    ca_.Bind(&block17, &tmp162, &tmp163, &tmp164, &tmp165, &tmp166, &tmp167, &tmp168, &tmp169, &tmp170, &tmp171, &tmp172, &tmp173, &tmp174, &tmp175, &tmp176, &tmp177, &tmp178, &tmp179);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 46);
+    ca_.Goto(&block15, tmp162, tmp163, tmp164, tmp165, tmp166, tmp167, tmp168, tmp169, tmp170, tmp171, tmp172, tmp178, tmp179);
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp180;
+    TNode<FixedArray> tmp181;
+    TNode<JSReceiver> tmp182;
+    TNode<IntPtrT> tmp183;
+    TNode<IntPtrT> tmp184;
+    TNode<Object> tmp185;
+    TNode<FixedArray> tmp186;
+    TNode<IntPtrT> tmp187;
+    TNode<IntPtrT> tmp188;
+    TNode<IntPtrT> tmp189;
+    TNode<IntPtrT> tmp190;
+    ca_.Bind(&block16, &tmp180, &tmp181, &tmp182, &tmp183, &tmp184, &tmp185, &tmp186, &tmp187, &tmp188, &tmp189, &tmp190);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp191;
+    TNode<FixedArray> tmp192;
+    TNode<JSReceiver> tmp193;
+    TNode<IntPtrT> tmp194;
+    TNode<IntPtrT> tmp195;
+    TNode<Object> tmp196;
+    TNode<FixedArray> tmp197;
+    TNode<IntPtrT> tmp198;
+    TNode<IntPtrT> tmp199;
+    TNode<IntPtrT> tmp200;
+    TNode<IntPtrT> tmp201;
+    TNode<HeapObject> tmp202;
+    TNode<IntPtrT> tmp203;
+    ca_.Bind(&block15, &tmp191, &tmp192, &tmp193, &tmp194, &tmp195, &tmp196, &tmp197, &tmp198, &tmp199, &tmp200, &tmp201, &tmp202, &tmp203);
+    ca_.Goto(&block14, tmp191, tmp192, tmp193, tmp194, tmp195, tmp196, tmp197, tmp198, tmp199, tmp200, tmp201, tmp202, tmp203);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp204;
+    TNode<FixedArray> tmp205;
+    TNode<JSReceiver> tmp206;
+    TNode<IntPtrT> tmp207;
+    TNode<IntPtrT> tmp208;
+    TNode<Object> tmp209;
+    TNode<FixedArray> tmp210;
+    TNode<IntPtrT> tmp211;
+    TNode<IntPtrT> tmp212;
+    TNode<IntPtrT> tmp213;
+    TNode<IntPtrT> tmp214;
+    TNode<HeapObject> tmp215;
+    TNode<IntPtrT> tmp216;
+    ca_.Bind(&block14, &tmp204, &tmp205, &tmp206, &tmp207, &tmp208, &tmp209, &tmp210, &tmp211, &tmp212, &tmp213, &tmp214, &tmp215, &tmp216);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 448);
+    CodeStubAssembler(state_).StoreReference(CodeStubAssembler::Reference{tmp215, tmp216}, tmp206);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 449);
+    TNode<Oddball> tmp217;
+    USE(tmp217);
+    tmp217 = True_65(state_);
+    CodeStubAssembler(state_).Return(tmp217);
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp218;
+    TNode<FixedArray> tmp219;
+    TNode<JSReceiver> tmp220;
+    TNode<IntPtrT> tmp221;
+    TNode<IntPtrT> tmp222;
+    TNode<Object> tmp223;
+    ca_.Bind(&block13, &tmp218, &tmp219, &tmp220, &tmp221, &tmp222, &tmp223);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 453);
+    TNode<BoolT> tmp224;
+    USE(tmp224);
+    tmp224 = CodeStubAssembler(state_).TaggedEqual(TNode<HeapObject>{tmp220}, TNode<Object>{tmp223});
+    ca_.Branch(tmp224, &block21, &block22, tmp218, tmp219, tmp220, tmp221, tmp222, tmp223);
+  }
+
+  if (block21.is_used()) {
+    TNode<Context> tmp225;
+    TNode<FixedArray> tmp226;
+    TNode<JSReceiver> tmp227;
+    TNode<IntPtrT> tmp228;
+    TNode<IntPtrT> tmp229;
+    TNode<Object> tmp230;
+    ca_.Bind(&block21, &tmp225, &tmp226, &tmp227, &tmp228, &tmp229, &tmp230);
+    TNode<Oddball> tmp231;
+    USE(tmp231);
+    tmp231 = False_66(state_);
+    CodeStubAssembler(state_).Return(tmp231);
+  }
+
+  if (block22.is_used()) {
+    TNode<Context> tmp232;
+    TNode<FixedArray> tmp233;
+    TNode<JSReceiver> tmp234;
+    TNode<IntPtrT> tmp235;
+    TNode<IntPtrT> tmp236;
+    TNode<Object> tmp237;
+    ca_.Bind(&block22, &tmp232, &tmp233, &tmp234, &tmp235, &tmp236, &tmp237);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 443);
+    ca_.Goto(&block4, tmp232, tmp233, tmp234, tmp235, tmp236);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp238;
+    TNode<FixedArray> tmp239;
+    TNode<JSReceiver> tmp240;
+    TNode<IntPtrT> tmp241;
+    TNode<IntPtrT> tmp242;
+    ca_.Bind(&block4, &tmp238, &tmp239, &tmp240, &tmp241, &tmp242);
+    TNode<IntPtrT> tmp243;
+    USE(tmp243);
+    tmp243 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<IntPtrT> tmp244;
+    USE(tmp244);
+    tmp244 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp242}, TNode<IntPtrT>{tmp243});
+    ca_.Goto(&block3, tmp238, tmp239, tmp240, tmp241, tmp244);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp245;
+    TNode<FixedArray> tmp246;
+    TNode<JSReceiver> tmp247;
+    TNode<IntPtrT> tmp248;
+    TNode<IntPtrT> tmp249;
+    ca_.Bind(&block2, &tmp245, &tmp246, &tmp247, &tmp248, &tmp249);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 458);
+    TNode<FixedArray> tmp250;
+    USE(tmp250);
+    tmp250 = StoreAndGrowFixedArray10JSReceiver_1381(state_, TNode<FixedArray>{tmp246}, TNode<IntPtrT>{tmp248}, TNode<JSReceiver>{tmp247});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 457);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 459);
+    SetJoinStack_16(state_, TNode<Context>{tmp245}, TNode<FixedArray>{tmp250});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 460);
+    TNode<Oddball> tmp251;
+    USE(tmp251);
+    tmp251 = True_65(state_);
+    CodeStubAssembler(state_).Return(tmp251);
+  }
+}
+
+TNode<BoolT> JoinStackPushInline_17(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<JSReceiver> p_receiver) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, FixedArray, IntPtrT, IntPtrT, HeapObject, IntPtrT> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, FixedArray, IntPtrT, IntPtrT, HeapObject, IntPtrT> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray> block23(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray> block24(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block29(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block30(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block28(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT> block27(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block26(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, FixedArray, IntPtrT, IntPtrT, HeapObject, IntPtrT> block25(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, BoolT> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, BoolT> block32(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_receiver);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 468);
+    TNode<FixedArray> tmp2;
+    USE(tmp2);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp2 = LoadJoinStack_15(state_, TNode<Context>{tmp0}, &label0);
+    ca_.Goto(&block4, tmp0, tmp1, tmp2);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block5, tmp0, tmp1);
+    }
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp3;
+    TNode<JSReceiver> tmp4;
+    ca_.Bind(&block5, &tmp3, &tmp4);
+    ca_.Goto(&block3, tmp3, tmp4);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp5;
+    TNode<JSReceiver> tmp6;
+    TNode<FixedArray> tmp7;
+    ca_.Bind(&block4, &tmp5, &tmp6, &tmp7);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 470);
+    TNode<IntPtrT> tmp8 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp8);
+    TNode<IntPtrT> tmp9 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp9);
+    TNode<Smi>tmp10 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp7, tmp9});
+    TNode<IntPtrT> tmp11;
+    USE(tmp11);
+    tmp11 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp10});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 50);
+    TNode<IntPtrT> tmp12;
+    USE(tmp12);
+    tmp12 = Convert8ATintptr17ATconstexpr_int31_1376(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 51);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp13;
+    USE(tmp13);
+    tmp13 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp12});
+    TNode<UintPtrT> tmp14;
+    USE(tmp14);
+    tmp14 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp11});
+    TNode<BoolT> tmp15;
+    USE(tmp15);
+    tmp15 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp13}, TNode<UintPtrT>{tmp14});
+    ca_.Branch(tmp15, &block12, &block13, tmp5, tmp6, tmp7, tmp7, tmp8, tmp11, tmp12, tmp7, tmp8, tmp11, tmp12, tmp12);
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp16;
+    TNode<JSReceiver> tmp17;
+    TNode<FixedArray> tmp18;
+    TNode<FixedArray> tmp19;
+    TNode<IntPtrT> tmp20;
+    TNode<IntPtrT> tmp21;
+    TNode<IntPtrT> tmp22;
+    TNode<HeapObject> tmp23;
+    TNode<IntPtrT> tmp24;
+    TNode<IntPtrT> tmp25;
+    TNode<IntPtrT> tmp26;
+    TNode<IntPtrT> tmp27;
+    ca_.Bind(&block12, &tmp16, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp28;
+    USE(tmp28);
+    tmp28 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp29;
+    USE(tmp29);
+    tmp29 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp27}, TNode<IntPtrT>{tmp28});
+    TNode<IntPtrT> tmp30;
+    USE(tmp30);
+    tmp30 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp24}, TNode<IntPtrT>{tmp29});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp31;
+    USE(tmp31);
+    TNode<IntPtrT> tmp32;
+    USE(tmp32);
+    std::tie(tmp31, tmp32) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp23}, TNode<IntPtrT>{tmp30}).Flatten();
+    ca_.Goto(&block11, tmp16, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27, tmp31, tmp32);
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp33;
+    TNode<JSReceiver> tmp34;
+    TNode<FixedArray> tmp35;
+    TNode<FixedArray> tmp36;
+    TNode<IntPtrT> tmp37;
+    TNode<IntPtrT> tmp38;
+    TNode<IntPtrT> tmp39;
+    TNode<HeapObject> tmp40;
+    TNode<IntPtrT> tmp41;
+    TNode<IntPtrT> tmp42;
+    TNode<IntPtrT> tmp43;
+    TNode<IntPtrT> tmp44;
+    ca_.Bind(&block13, &tmp33, &tmp34, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block10, tmp33, tmp34, tmp35, tmp36, tmp37, tmp38, tmp39);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp45;
+    TNode<JSReceiver> tmp46;
+    TNode<FixedArray> tmp47;
+    TNode<FixedArray> tmp48;
+    TNode<IntPtrT> tmp49;
+    TNode<IntPtrT> tmp50;
+    TNode<IntPtrT> tmp51;
+    TNode<HeapObject> tmp52;
+    TNode<IntPtrT> tmp53;
+    TNode<IntPtrT> tmp54;
+    TNode<IntPtrT> tmp55;
+    TNode<IntPtrT> tmp56;
+    TNode<HeapObject> tmp57;
+    TNode<IntPtrT> tmp58;
+    ca_.Bind(&block11, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 51);
+    ca_.Goto(&block9, tmp45, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51, tmp57, tmp58);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp59;
+    TNode<JSReceiver> tmp60;
+    TNode<FixedArray> tmp61;
+    TNode<FixedArray> tmp62;
+    TNode<IntPtrT> tmp63;
+    TNode<IntPtrT> tmp64;
+    TNode<IntPtrT> tmp65;
+    ca_.Bind(&block10, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp66;
+    TNode<JSReceiver> tmp67;
+    TNode<FixedArray> tmp68;
+    TNode<FixedArray> tmp69;
+    TNode<IntPtrT> tmp70;
+    TNode<IntPtrT> tmp71;
+    TNode<IntPtrT> tmp72;
+    TNode<HeapObject> tmp73;
+    TNode<IntPtrT> tmp74;
+    ca_.Bind(&block9, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74);
+    ca_.Goto(&block8, tmp66, tmp67, tmp68, tmp69, tmp70, tmp71, tmp73, tmp74);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp75;
+    TNode<JSReceiver> tmp76;
+    TNode<FixedArray> tmp77;
+    TNode<FixedArray> tmp78;
+    TNode<IntPtrT> tmp79;
+    TNode<IntPtrT> tmp80;
+    TNode<HeapObject> tmp81;
+    TNode<IntPtrT> tmp82;
+    ca_.Bind(&block8, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 470);
+    TNode<Object>tmp83 = CodeStubAssembler(state_).LoadReference<Object>(CodeStubAssembler::Reference{tmp81, tmp82});
+    TNode<Oddball> tmp84;
+    USE(tmp84);
+    tmp84 = TheHole_62(state_);
+    TNode<BoolT> tmp85;
+    USE(tmp85);
+    tmp85 = CodeStubAssembler(state_).TaggedEqual(TNode<Object>{tmp83}, TNode<HeapObject>{tmp84});
+    ca_.Branch(tmp85, &block6, &block7, tmp75, tmp76, tmp77);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp86;
+    TNode<JSReceiver> tmp87;
+    TNode<FixedArray> tmp88;
+    ca_.Bind(&block6, &tmp86, &tmp87, &tmp88);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 471);
+    TNode<IntPtrT> tmp89 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp89);
+    TNode<IntPtrT> tmp90 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp90);
+    TNode<Smi>tmp91 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp88, tmp90});
+    TNode<IntPtrT> tmp92;
+    USE(tmp92);
+    tmp92 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp91});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 50);
+    TNode<IntPtrT> tmp93;
+    USE(tmp93);
+    tmp93 = Convert8ATintptr17ATconstexpr_int31_1376(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 51);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp94;
+    USE(tmp94);
+    tmp94 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp93});
+    TNode<UintPtrT> tmp95;
+    USE(tmp95);
+    tmp95 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp92});
+    TNode<BoolT> tmp96;
+    USE(tmp96);
+    tmp96 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp94}, TNode<UintPtrT>{tmp95});
+    ca_.Branch(tmp96, &block20, &block21, tmp86, tmp87, tmp88, tmp88, tmp89, tmp92, tmp93, tmp88, tmp89, tmp92, tmp93, tmp93);
+  }
+
+  if (block20.is_used()) {
+    TNode<Context> tmp97;
+    TNode<JSReceiver> tmp98;
+    TNode<FixedArray> tmp99;
+    TNode<FixedArray> tmp100;
+    TNode<IntPtrT> tmp101;
+    TNode<IntPtrT> tmp102;
+    TNode<IntPtrT> tmp103;
+    TNode<HeapObject> tmp104;
+    TNode<IntPtrT> tmp105;
+    TNode<IntPtrT> tmp106;
+    TNode<IntPtrT> tmp107;
+    TNode<IntPtrT> tmp108;
+    ca_.Bind(&block20, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104, &tmp105, &tmp106, &tmp107, &tmp108);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp109;
+    USE(tmp109);
+    tmp109 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp110;
+    USE(tmp110);
+    tmp110 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp108}, TNode<IntPtrT>{tmp109});
+    TNode<IntPtrT> tmp111;
+    USE(tmp111);
+    tmp111 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp105}, TNode<IntPtrT>{tmp110});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp112;
+    USE(tmp112);
+    TNode<IntPtrT> tmp113;
+    USE(tmp113);
+    std::tie(tmp112, tmp113) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp104}, TNode<IntPtrT>{tmp111}).Flatten();
+    ca_.Goto(&block19, tmp97, tmp98, tmp99, tmp100, tmp101, tmp102, tmp103, tmp104, tmp105, tmp106, tmp107, tmp108, tmp112, tmp113);
+  }
+
+  if (block21.is_used()) {
+    TNode<Context> tmp114;
+    TNode<JSReceiver> tmp115;
+    TNode<FixedArray> tmp116;
+    TNode<FixedArray> tmp117;
+    TNode<IntPtrT> tmp118;
+    TNode<IntPtrT> tmp119;
+    TNode<IntPtrT> tmp120;
+    TNode<HeapObject> tmp121;
+    TNode<IntPtrT> tmp122;
+    TNode<IntPtrT> tmp123;
+    TNode<IntPtrT> tmp124;
+    TNode<IntPtrT> tmp125;
+    ca_.Bind(&block21, &tmp114, &tmp115, &tmp116, &tmp117, &tmp118, &tmp119, &tmp120, &tmp121, &tmp122, &tmp123, &tmp124, &tmp125);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block18, tmp114, tmp115, tmp116, tmp117, tmp118, tmp119, tmp120);
+  }
+
+  if (block19.is_used()) {
+    TNode<Context> tmp126;
+    TNode<JSReceiver> tmp127;
+    TNode<FixedArray> tmp128;
+    TNode<FixedArray> tmp129;
+    TNode<IntPtrT> tmp130;
+    TNode<IntPtrT> tmp131;
+    TNode<IntPtrT> tmp132;
+    TNode<HeapObject> tmp133;
+    TNode<IntPtrT> tmp134;
+    TNode<IntPtrT> tmp135;
+    TNode<IntPtrT> tmp136;
+    TNode<IntPtrT> tmp137;
+    TNode<HeapObject> tmp138;
+    TNode<IntPtrT> tmp139;
+    ca_.Bind(&block19, &tmp126, &tmp127, &tmp128, &tmp129, &tmp130, &tmp131, &tmp132, &tmp133, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138, &tmp139);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 51);
+    ca_.Goto(&block17, tmp126, tmp127, tmp128, tmp129, tmp130, tmp131, tmp132, tmp138, tmp139);
+  }
+
+  if (block18.is_used()) {
+    TNode<Context> tmp140;
+    TNode<JSReceiver> tmp141;
+    TNode<FixedArray> tmp142;
+    TNode<FixedArray> tmp143;
+    TNode<IntPtrT> tmp144;
+    TNode<IntPtrT> tmp145;
+    TNode<IntPtrT> tmp146;
+    ca_.Bind(&block18, &tmp140, &tmp141, &tmp142, &tmp143, &tmp144, &tmp145, &tmp146);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block17.is_used()) {
+    TNode<Context> tmp147;
+    TNode<JSReceiver> tmp148;
+    TNode<FixedArray> tmp149;
+    TNode<FixedArray> tmp150;
+    TNode<IntPtrT> tmp151;
+    TNode<IntPtrT> tmp152;
+    TNode<IntPtrT> tmp153;
+    TNode<HeapObject> tmp154;
+    TNode<IntPtrT> tmp155;
+    ca_.Bind(&block17, &tmp147, &tmp148, &tmp149, &tmp150, &tmp151, &tmp152, &tmp153, &tmp154, &tmp155);
+    ca_.Goto(&block16, tmp147, tmp148, tmp149, tmp150, tmp151, tmp152, tmp154, tmp155);
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp156;
+    TNode<JSReceiver> tmp157;
+    TNode<FixedArray> tmp158;
+    TNode<FixedArray> tmp159;
+    TNode<IntPtrT> tmp160;
+    TNode<IntPtrT> tmp161;
+    TNode<HeapObject> tmp162;
+    TNode<IntPtrT> tmp163;
+    ca_.Bind(&block16, &tmp156, &tmp157, &tmp158, &tmp159, &tmp160, &tmp161, &tmp162, &tmp163);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 471);
+    CodeStubAssembler(state_).StoreReference(CodeStubAssembler::Reference{tmp162, tmp163}, tmp157);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 470);
+    ca_.Goto(&block15, tmp156, tmp157, tmp158);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp164;
+    TNode<JSReceiver> tmp165;
+    TNode<FixedArray> tmp166;
+    ca_.Bind(&block7, &tmp164, &tmp165, &tmp166);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 472);
+    TNode<Oddball> tmp167;
+    tmp167 = TORQUE_CAST(CodeStubAssembler(state_).CallBuiltin(Builtins::kJoinStackPush, tmp164, tmp166, tmp165));
+    USE(tmp167);
+    TNode<Oddball> tmp168;
+    USE(tmp168);
+    tmp168 = False_66(state_);
+    TNode<BoolT> tmp169;
+    USE(tmp169);
+    tmp169 = CodeStubAssembler(state_).TaggedEqual(TNode<HeapObject>{tmp167}, TNode<HeapObject>{tmp168});
+    ca_.Branch(tmp169, &block23, &block24, tmp164, tmp165, tmp166);
+  }
+
+  if (block23.is_used()) {
+    TNode<Context> tmp170;
+    TNode<JSReceiver> tmp171;
+    TNode<FixedArray> tmp172;
+    ca_.Bind(&block23, &tmp170, &tmp171, &tmp172);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 474);
+    TNode<BoolT> tmp173;
+    USE(tmp173);
+    tmp173 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, false);
+    ca_.Goto(&block1, tmp170, tmp171, tmp173);
+  }
+
+  if (block24.is_used()) {
+    TNode<Context> tmp174;
+    TNode<JSReceiver> tmp175;
+    TNode<FixedArray> tmp176;
+    ca_.Bind(&block24, &tmp174, &tmp175, &tmp176);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 470);
+    ca_.Goto(&block15, tmp174, tmp175, tmp176);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp177;
+    TNode<JSReceiver> tmp178;
+    TNode<FixedArray> tmp179;
+    ca_.Bind(&block15, &tmp177, &tmp178, &tmp179);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 467);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 477);
+    ca_.Goto(&block2, tmp177, tmp178);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp180;
+    TNode<JSReceiver> tmp181;
+    ca_.Bind(&block3, &tmp180, &tmp181);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 479);
+    TNode<IntPtrT> tmp182;
+    USE(tmp182);
+    tmp182 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, JSArray::kMinJoinStackSize);
+    TNode<FixedArray> tmp183;
+    USE(tmp183);
+    tmp183 = CodeStubAssembler(state_).AllocateFixedArrayWithHoles(TNode<IntPtrT>{tmp182}, CodeStubAssembler::kNone);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 478);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 480);
+    TNode<IntPtrT> tmp184 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp184);
+    TNode<IntPtrT> tmp185 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp185);
+    TNode<Smi>tmp186 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp183, tmp185});
+    TNode<IntPtrT> tmp187;
+    USE(tmp187);
+    tmp187 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp186});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 50);
+    TNode<IntPtrT> tmp188;
+    USE(tmp188);
+    tmp188 = Convert8ATintptr17ATconstexpr_int31_1376(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 51);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp189;
+    USE(tmp189);
+    tmp189 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp188});
+    TNode<UintPtrT> tmp190;
+    USE(tmp190);
+    tmp190 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp187});
+    TNode<BoolT> tmp191;
+    USE(tmp191);
+    tmp191 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp189}, TNode<UintPtrT>{tmp190});
+    ca_.Branch(tmp191, &block29, &block30, tmp180, tmp181, tmp183, tmp183, tmp184, tmp187, tmp188, tmp183, tmp184, tmp187, tmp188, tmp188);
+  }
+
+  if (block29.is_used()) {
+    TNode<Context> tmp192;
+    TNode<JSReceiver> tmp193;
+    TNode<FixedArray> tmp194;
+    TNode<FixedArray> tmp195;
+    TNode<IntPtrT> tmp196;
+    TNode<IntPtrT> tmp197;
+    TNode<IntPtrT> tmp198;
+    TNode<HeapObject> tmp199;
+    TNode<IntPtrT> tmp200;
+    TNode<IntPtrT> tmp201;
+    TNode<IntPtrT> tmp202;
+    TNode<IntPtrT> tmp203;
+    ca_.Bind(&block29, &tmp192, &tmp193, &tmp194, &tmp195, &tmp196, &tmp197, &tmp198, &tmp199, &tmp200, &tmp201, &tmp202, &tmp203);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp204;
+    USE(tmp204);
+    tmp204 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp205;
+    USE(tmp205);
+    tmp205 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp203}, TNode<IntPtrT>{tmp204});
+    TNode<IntPtrT> tmp206;
+    USE(tmp206);
+    tmp206 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp200}, TNode<IntPtrT>{tmp205});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp207;
+    USE(tmp207);
+    TNode<IntPtrT> tmp208;
+    USE(tmp208);
+    std::tie(tmp207, tmp208) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp199}, TNode<IntPtrT>{tmp206}).Flatten();
+    ca_.Goto(&block28, tmp192, tmp193, tmp194, tmp195, tmp196, tmp197, tmp198, tmp199, tmp200, tmp201, tmp202, tmp203, tmp207, tmp208);
+  }
+
+  if (block30.is_used()) {
+    TNode<Context> tmp209;
+    TNode<JSReceiver> tmp210;
+    TNode<FixedArray> tmp211;
+    TNode<FixedArray> tmp212;
+    TNode<IntPtrT> tmp213;
+    TNode<IntPtrT> tmp214;
+    TNode<IntPtrT> tmp215;
+    TNode<HeapObject> tmp216;
+    TNode<IntPtrT> tmp217;
+    TNode<IntPtrT> tmp218;
+    TNode<IntPtrT> tmp219;
+    TNode<IntPtrT> tmp220;
+    ca_.Bind(&block30, &tmp209, &tmp210, &tmp211, &tmp212, &tmp213, &tmp214, &tmp215, &tmp216, &tmp217, &tmp218, &tmp219, &tmp220);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block27, tmp209, tmp210, tmp211, tmp212, tmp213, tmp214, tmp215);
+  }
+
+  if (block28.is_used()) {
+    TNode<Context> tmp221;
+    TNode<JSReceiver> tmp222;
+    TNode<FixedArray> tmp223;
+    TNode<FixedArray> tmp224;
+    TNode<IntPtrT> tmp225;
+    TNode<IntPtrT> tmp226;
+    TNode<IntPtrT> tmp227;
+    TNode<HeapObject> tmp228;
+    TNode<IntPtrT> tmp229;
+    TNode<IntPtrT> tmp230;
+    TNode<IntPtrT> tmp231;
+    TNode<IntPtrT> tmp232;
+    TNode<HeapObject> tmp233;
+    TNode<IntPtrT> tmp234;
+    ca_.Bind(&block28, &tmp221, &tmp222, &tmp223, &tmp224, &tmp225, &tmp226, &tmp227, &tmp228, &tmp229, &tmp230, &tmp231, &tmp232, &tmp233, &tmp234);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 51);
+    ca_.Goto(&block26, tmp221, tmp222, tmp223, tmp224, tmp225, tmp226, tmp227, tmp233, tmp234);
+  }
+
+  if (block27.is_used()) {
+    TNode<Context> tmp235;
+    TNode<JSReceiver> tmp236;
+    TNode<FixedArray> tmp237;
+    TNode<FixedArray> tmp238;
+    TNode<IntPtrT> tmp239;
+    TNode<IntPtrT> tmp240;
+    TNode<IntPtrT> tmp241;
+    ca_.Bind(&block27, &tmp235, &tmp236, &tmp237, &tmp238, &tmp239, &tmp240, &tmp241);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block26.is_used()) {
+    TNode<Context> tmp242;
+    TNode<JSReceiver> tmp243;
+    TNode<FixedArray> tmp244;
+    TNode<FixedArray> tmp245;
+    TNode<IntPtrT> tmp246;
+    TNode<IntPtrT> tmp247;
+    TNode<IntPtrT> tmp248;
+    TNode<HeapObject> tmp249;
+    TNode<IntPtrT> tmp250;
+    ca_.Bind(&block26, &tmp242, &tmp243, &tmp244, &tmp245, &tmp246, &tmp247, &tmp248, &tmp249, &tmp250);
+    ca_.Goto(&block25, tmp242, tmp243, tmp244, tmp245, tmp246, tmp247, tmp249, tmp250);
+  }
+
+  if (block25.is_used()) {
+    TNode<Context> tmp251;
+    TNode<JSReceiver> tmp252;
+    TNode<FixedArray> tmp253;
+    TNode<FixedArray> tmp254;
+    TNode<IntPtrT> tmp255;
+    TNode<IntPtrT> tmp256;
+    TNode<HeapObject> tmp257;
+    TNode<IntPtrT> tmp258;
+    ca_.Bind(&block25, &tmp251, &tmp252, &tmp253, &tmp254, &tmp255, &tmp256, &tmp257, &tmp258);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 480);
+    CodeStubAssembler(state_).StoreReference(CodeStubAssembler::Reference{tmp257, tmp258}, tmp252);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 481);
+    SetJoinStack_16(state_, TNode<Context>{tmp251}, TNode<FixedArray>{tmp253});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 477);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 467);
+    ca_.Goto(&block2, tmp251, tmp252);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp259;
+    TNode<JSReceiver> tmp260;
+    ca_.Bind(&block2, &tmp259, &tmp260);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 483);
+    TNode<BoolT> tmp261;
+    USE(tmp261);
+    tmp261 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, true);
+    ca_.Goto(&block1, tmp259, tmp260, tmp261);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp262;
+    TNode<JSReceiver> tmp263;
+    TNode<BoolT> tmp264;
+    ca_.Bind(&block1, &tmp262, &tmp263, &tmp264);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 465);
+    ca_.Goto(&block32, tmp262, tmp263, tmp264);
+  }
+
+    TNode<Context> tmp265;
+    TNode<JSReceiver> tmp266;
+    TNode<BoolT> tmp267;
+    ca_.Bind(&block32, &tmp265, &tmp266, &tmp267);
+  return TNode<BoolT>{tmp267};
+}
+
+TF_BUILTIN(JoinStackPop, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<FixedArray> parameter1 = UncheckedCast<FixedArray>(Parameter(Descriptor::ParameterIndex<0>()));
+  USE(parameter1);
+  TNode<JSReceiver> parameter2 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<1>()));
+  USE(parameter2);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, BoolT> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, BoolT> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, BoolT, BoolT> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT> block14(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block24(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block25(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block23(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block22(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArray, JSReceiver, IntPtrT, IntPtrT> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<FixedArray> tmp1;
+    TNode<JSReceiver> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 490);
+    TNode<IntPtrT> tmp3;
+    USE(tmp3);
+    tmp3 = CodeStubAssembler(state_).LoadAndUntagFixedArrayBaseLength(TNode<FixedArrayBase>{tmp1});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 491);
+    TNode<IntPtrT> tmp4;
+    USE(tmp4);
+    tmp4 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp2, tmp3, tmp4);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp5;
+    TNode<FixedArray> tmp6;
+    TNode<JSReceiver> tmp7;
+    TNode<IntPtrT> tmp8;
+    TNode<IntPtrT> tmp9;
+    ca_.Bind(&block3, &tmp5, &tmp6, &tmp7, &tmp8, &tmp9);
+    TNode<BoolT> tmp10;
+    USE(tmp10);
+    tmp10 = CodeStubAssembler(state_).IntPtrLessThan(TNode<IntPtrT>{tmp9}, TNode<IntPtrT>{tmp8});
+    ca_.Branch(tmp10, &block1, &block2, tmp5, tmp6, tmp7, tmp8, tmp9);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp11;
+    TNode<FixedArray> tmp12;
+    TNode<JSReceiver> tmp13;
+    TNode<IntPtrT> tmp14;
+    TNode<IntPtrT> tmp15;
+    ca_.Bind(&block1, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 492);
+    TNode<IntPtrT> tmp16 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp16);
+    TNode<IntPtrT> tmp17 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp17);
+    TNode<Smi>tmp18 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp12, tmp17});
+    TNode<IntPtrT> tmp19;
+    USE(tmp19);
+    tmp19 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp18});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 46);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp20;
+    USE(tmp20);
+    tmp20 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp15});
+    TNode<UintPtrT> tmp21;
+    USE(tmp21);
+    tmp21 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp19});
+    TNode<BoolT> tmp22;
+    USE(tmp22);
+    tmp22 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp20}, TNode<UintPtrT>{tmp21});
+    ca_.Branch(tmp22, &block11, &block12, tmp11, tmp12, tmp13, tmp14, tmp15, tmp12, tmp16, tmp19, tmp15, tmp15, tmp12, tmp16, tmp19, tmp15, tmp15);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp23;
+    TNode<FixedArray> tmp24;
+    TNode<JSReceiver> tmp25;
+    TNode<IntPtrT> tmp26;
+    TNode<IntPtrT> tmp27;
+    TNode<FixedArray> tmp28;
+    TNode<IntPtrT> tmp29;
+    TNode<IntPtrT> tmp30;
+    TNode<IntPtrT> tmp31;
+    TNode<IntPtrT> tmp32;
+    TNode<HeapObject> tmp33;
+    TNode<IntPtrT> tmp34;
+    TNode<IntPtrT> tmp35;
+    TNode<IntPtrT> tmp36;
+    TNode<IntPtrT> tmp37;
+    ca_.Bind(&block11, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34, &tmp35, &tmp36, &tmp37);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp38;
+    USE(tmp38);
+    tmp38 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp39;
+    USE(tmp39);
+    tmp39 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp37}, TNode<IntPtrT>{tmp38});
+    TNode<IntPtrT> tmp40;
+    USE(tmp40);
+    tmp40 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp34}, TNode<IntPtrT>{tmp39});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp41;
+    USE(tmp41);
+    TNode<IntPtrT> tmp42;
+    USE(tmp42);
+    std::tie(tmp41, tmp42) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp33}, TNode<IntPtrT>{tmp40}).Flatten();
+    ca_.Goto(&block10, tmp23, tmp24, tmp25, tmp26, tmp27, tmp28, tmp29, tmp30, tmp31, tmp32, tmp33, tmp34, tmp35, tmp36, tmp37, tmp41, tmp42);
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp43;
+    TNode<FixedArray> tmp44;
+    TNode<JSReceiver> tmp45;
+    TNode<IntPtrT> tmp46;
+    TNode<IntPtrT> tmp47;
+    TNode<FixedArray> tmp48;
+    TNode<IntPtrT> tmp49;
+    TNode<IntPtrT> tmp50;
+    TNode<IntPtrT> tmp51;
+    TNode<IntPtrT> tmp52;
+    TNode<HeapObject> tmp53;
+    TNode<IntPtrT> tmp54;
+    TNode<IntPtrT> tmp55;
+    TNode<IntPtrT> tmp56;
+    TNode<IntPtrT> tmp57;
+    ca_.Bind(&block12, &tmp43, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block9, tmp43, tmp44, tmp45, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51, tmp52);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp58;
+    TNode<FixedArray> tmp59;
+    TNode<JSReceiver> tmp60;
+    TNode<IntPtrT> tmp61;
+    TNode<IntPtrT> tmp62;
+    TNode<FixedArray> tmp63;
+    TNode<IntPtrT> tmp64;
+    TNode<IntPtrT> tmp65;
+    TNode<IntPtrT> tmp66;
+    TNode<IntPtrT> tmp67;
+    TNode<HeapObject> tmp68;
+    TNode<IntPtrT> tmp69;
+    TNode<IntPtrT> tmp70;
+    TNode<IntPtrT> tmp71;
+    TNode<IntPtrT> tmp72;
+    TNode<HeapObject> tmp73;
+    TNode<IntPtrT> tmp74;
+    ca_.Bind(&block10, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 46);
+    ca_.Goto(&block8, tmp58, tmp59, tmp60, tmp61, tmp62, tmp63, tmp64, tmp65, tmp66, tmp67, tmp73, tmp74);
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp75;
+    TNode<FixedArray> tmp76;
+    TNode<JSReceiver> tmp77;
+    TNode<IntPtrT> tmp78;
+    TNode<IntPtrT> tmp79;
+    TNode<FixedArray> tmp80;
+    TNode<IntPtrT> tmp81;
+    TNode<IntPtrT> tmp82;
+    TNode<IntPtrT> tmp83;
+    TNode<IntPtrT> tmp84;
+    ca_.Bind(&block9, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp85;
+    TNode<FixedArray> tmp86;
+    TNode<JSReceiver> tmp87;
+    TNode<IntPtrT> tmp88;
+    TNode<IntPtrT> tmp89;
+    TNode<FixedArray> tmp90;
+    TNode<IntPtrT> tmp91;
+    TNode<IntPtrT> tmp92;
+    TNode<IntPtrT> tmp93;
+    TNode<IntPtrT> tmp94;
+    TNode<HeapObject> tmp95;
+    TNode<IntPtrT> tmp96;
+    ca_.Bind(&block8, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96);
+    ca_.Goto(&block7, tmp85, tmp86, tmp87, tmp88, tmp89, tmp90, tmp91, tmp92, tmp93, tmp94, tmp95, tmp96);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp97;
+    TNode<FixedArray> tmp98;
+    TNode<JSReceiver> tmp99;
+    TNode<IntPtrT> tmp100;
+    TNode<IntPtrT> tmp101;
+    TNode<FixedArray> tmp102;
+    TNode<IntPtrT> tmp103;
+    TNode<IntPtrT> tmp104;
+    TNode<IntPtrT> tmp105;
+    TNode<IntPtrT> tmp106;
+    TNode<HeapObject> tmp107;
+    TNode<IntPtrT> tmp108;
+    ca_.Bind(&block7, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104, &tmp105, &tmp106, &tmp107, &tmp108);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 492);
+    TNode<Object>tmp109 = CodeStubAssembler(state_).LoadReference<Object>(CodeStubAssembler::Reference{tmp107, tmp108});
+    TNode<BoolT> tmp110;
+    USE(tmp110);
+    tmp110 = CodeStubAssembler(state_).TaggedEqual(TNode<Object>{tmp109}, TNode<HeapObject>{tmp99});
+    ca_.Branch(tmp110, &block5, &block6, tmp97, tmp98, tmp99, tmp100, tmp101);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp111;
+    TNode<FixedArray> tmp112;
+    TNode<JSReceiver> tmp113;
+    TNode<IntPtrT> tmp114;
+    TNode<IntPtrT> tmp115;
+    ca_.Bind(&block5, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 495);
+    TNode<IntPtrT> tmp116;
+    USE(tmp116);
+    tmp116 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<BoolT> tmp117;
+    USE(tmp117);
+    tmp117 = CodeStubAssembler(state_).WordEqual(TNode<IntPtrT>{tmp115}, TNode<IntPtrT>{tmp116});
+    ca_.Branch(tmp117, &block16, &block17, tmp111, tmp112, tmp113, tmp114, tmp115, tmp117);
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp118;
+    TNode<FixedArray> tmp119;
+    TNode<JSReceiver> tmp120;
+    TNode<IntPtrT> tmp121;
+    TNode<IntPtrT> tmp122;
+    TNode<BoolT> tmp123;
+    ca_.Bind(&block16, &tmp118, &tmp119, &tmp120, &tmp121, &tmp122, &tmp123);
+    TNode<IntPtrT> tmp124;
+    USE(tmp124);
+    tmp124 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, JSArray::kMinJoinStackSize);
+    TNode<BoolT> tmp125;
+    USE(tmp125);
+    tmp125 = CodeStubAssembler(state_).IntPtrGreaterThan(TNode<IntPtrT>{tmp121}, TNode<IntPtrT>{tmp124});
+    ca_.Goto(&block18, tmp118, tmp119, tmp120, tmp121, tmp122, tmp123, tmp125);
+  }
+
+  if (block17.is_used()) {
+    TNode<Context> tmp126;
+    TNode<FixedArray> tmp127;
+    TNode<JSReceiver> tmp128;
+    TNode<IntPtrT> tmp129;
+    TNode<IntPtrT> tmp130;
+    TNode<BoolT> tmp131;
+    ca_.Bind(&block17, &tmp126, &tmp127, &tmp128, &tmp129, &tmp130, &tmp131);
+    TNode<BoolT> tmp132;
+    USE(tmp132);
+    tmp132 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, false);
+    ca_.Goto(&block18, tmp126, tmp127, tmp128, tmp129, tmp130, tmp131, tmp132);
+  }
+
+  if (block18.is_used()) {
+    TNode<Context> tmp133;
+    TNode<FixedArray> tmp134;
+    TNode<JSReceiver> tmp135;
+    TNode<IntPtrT> tmp136;
+    TNode<IntPtrT> tmp137;
+    TNode<BoolT> tmp138;
+    TNode<BoolT> tmp139;
+    ca_.Bind(&block18, &tmp133, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138, &tmp139);
+    ca_.Branch(tmp139, &block14, &block15, tmp133, tmp134, tmp135, tmp136, tmp137);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp140;
+    TNode<FixedArray> tmp141;
+    TNode<JSReceiver> tmp142;
+    TNode<IntPtrT> tmp143;
+    TNode<IntPtrT> tmp144;
+    ca_.Bind(&block14, &tmp140, &tmp141, &tmp142, &tmp143, &tmp144);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 497);
+    TNode<IntPtrT> tmp145;
+    USE(tmp145);
+    tmp145 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, JSArray::kMinJoinStackSize);
+    TNode<FixedArray> tmp146;
+    USE(tmp146);
+    tmp146 = CodeStubAssembler(state_).AllocateFixedArrayWithHoles(TNode<IntPtrT>{tmp145}, CodeStubAssembler::kNone);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 496);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 498);
+    SetJoinStack_16(state_, TNode<Context>{tmp140}, TNode<FixedArray>{tmp146});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 495);
+    ca_.Goto(&block19, tmp140, tmp141, tmp142, tmp143, tmp144);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp147;
+    TNode<FixedArray> tmp148;
+    TNode<JSReceiver> tmp149;
+    TNode<IntPtrT> tmp150;
+    TNode<IntPtrT> tmp151;
+    ca_.Bind(&block15, &tmp147, &tmp148, &tmp149, &tmp150, &tmp151);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 501);
+    TNode<IntPtrT> tmp152 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp152);
+    TNode<IntPtrT> tmp153 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp153);
+    TNode<Smi>tmp154 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp148, tmp153});
+    TNode<IntPtrT> tmp155;
+    USE(tmp155);
+    tmp155 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp154});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 46);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp156;
+    USE(tmp156);
+    tmp156 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp151});
+    TNode<UintPtrT> tmp157;
+    USE(tmp157);
+    tmp157 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp155});
+    TNode<BoolT> tmp158;
+    USE(tmp158);
+    tmp158 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp156}, TNode<UintPtrT>{tmp157});
+    ca_.Branch(tmp158, &block24, &block25, tmp147, tmp148, tmp149, tmp150, tmp151, tmp148, tmp152, tmp155, tmp151, tmp151, tmp148, tmp152, tmp155, tmp151, tmp151);
+  }
+
+  if (block24.is_used()) {
+    TNode<Context> tmp159;
+    TNode<FixedArray> tmp160;
+    TNode<JSReceiver> tmp161;
+    TNode<IntPtrT> tmp162;
+    TNode<IntPtrT> tmp163;
+    TNode<FixedArray> tmp164;
+    TNode<IntPtrT> tmp165;
+    TNode<IntPtrT> tmp166;
+    TNode<IntPtrT> tmp167;
+    TNode<IntPtrT> tmp168;
+    TNode<HeapObject> tmp169;
+    TNode<IntPtrT> tmp170;
+    TNode<IntPtrT> tmp171;
+    TNode<IntPtrT> tmp172;
+    TNode<IntPtrT> tmp173;
+    ca_.Bind(&block24, &tmp159, &tmp160, &tmp161, &tmp162, &tmp163, &tmp164, &tmp165, &tmp166, &tmp167, &tmp168, &tmp169, &tmp170, &tmp171, &tmp172, &tmp173);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp174;
+    USE(tmp174);
+    tmp174 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp175;
+    USE(tmp175);
+    tmp175 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp173}, TNode<IntPtrT>{tmp174});
+    TNode<IntPtrT> tmp176;
+    USE(tmp176);
+    tmp176 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp170}, TNode<IntPtrT>{tmp175});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp177;
+    USE(tmp177);
+    TNode<IntPtrT> tmp178;
+    USE(tmp178);
+    std::tie(tmp177, tmp178) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp169}, TNode<IntPtrT>{tmp176}).Flatten();
+    ca_.Goto(&block23, tmp159, tmp160, tmp161, tmp162, tmp163, tmp164, tmp165, tmp166, tmp167, tmp168, tmp169, tmp170, tmp171, tmp172, tmp173, tmp177, tmp178);
+  }
+
+  if (block25.is_used()) {
+    TNode<Context> tmp179;
+    TNode<FixedArray> tmp180;
+    TNode<JSReceiver> tmp181;
+    TNode<IntPtrT> tmp182;
+    TNode<IntPtrT> tmp183;
+    TNode<FixedArray> tmp184;
+    TNode<IntPtrT> tmp185;
+    TNode<IntPtrT> tmp186;
+    TNode<IntPtrT> tmp187;
+    TNode<IntPtrT> tmp188;
+    TNode<HeapObject> tmp189;
+    TNode<IntPtrT> tmp190;
+    TNode<IntPtrT> tmp191;
+    TNode<IntPtrT> tmp192;
+    TNode<IntPtrT> tmp193;
+    ca_.Bind(&block25, &tmp179, &tmp180, &tmp181, &tmp182, &tmp183, &tmp184, &tmp185, &tmp186, &tmp187, &tmp188, &tmp189, &tmp190, &tmp191, &tmp192, &tmp193);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block22, tmp179, tmp180, tmp181, tmp182, tmp183, tmp184, tmp185, tmp186, tmp187, tmp188);
+  }
+
+  if (block23.is_used()) {
+    TNode<Context> tmp194;
+    TNode<FixedArray> tmp195;
+    TNode<JSReceiver> tmp196;
+    TNode<IntPtrT> tmp197;
+    TNode<IntPtrT> tmp198;
+    TNode<FixedArray> tmp199;
+    TNode<IntPtrT> tmp200;
+    TNode<IntPtrT> tmp201;
+    TNode<IntPtrT> tmp202;
+    TNode<IntPtrT> tmp203;
+    TNode<HeapObject> tmp204;
+    TNode<IntPtrT> tmp205;
+    TNode<IntPtrT> tmp206;
+    TNode<IntPtrT> tmp207;
+    TNode<IntPtrT> tmp208;
+    TNode<HeapObject> tmp209;
+    TNode<IntPtrT> tmp210;
+    ca_.Bind(&block23, &tmp194, &tmp195, &tmp196, &tmp197, &tmp198, &tmp199, &tmp200, &tmp201, &tmp202, &tmp203, &tmp204, &tmp205, &tmp206, &tmp207, &tmp208, &tmp209, &tmp210);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 46);
+    ca_.Goto(&block21, tmp194, tmp195, tmp196, tmp197, tmp198, tmp199, tmp200, tmp201, tmp202, tmp203, tmp209, tmp210);
+  }
+
+  if (block22.is_used()) {
+    TNode<Context> tmp211;
+    TNode<FixedArray> tmp212;
+    TNode<JSReceiver> tmp213;
+    TNode<IntPtrT> tmp214;
+    TNode<IntPtrT> tmp215;
+    TNode<FixedArray> tmp216;
+    TNode<IntPtrT> tmp217;
+    TNode<IntPtrT> tmp218;
+    TNode<IntPtrT> tmp219;
+    TNode<IntPtrT> tmp220;
+    ca_.Bind(&block22, &tmp211, &tmp212, &tmp213, &tmp214, &tmp215, &tmp216, &tmp217, &tmp218, &tmp219, &tmp220);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block21.is_used()) {
+    TNode<Context> tmp221;
+    TNode<FixedArray> tmp222;
+    TNode<JSReceiver> tmp223;
+    TNode<IntPtrT> tmp224;
+    TNode<IntPtrT> tmp225;
+    TNode<FixedArray> tmp226;
+    TNode<IntPtrT> tmp227;
+    TNode<IntPtrT> tmp228;
+    TNode<IntPtrT> tmp229;
+    TNode<IntPtrT> tmp230;
+    TNode<HeapObject> tmp231;
+    TNode<IntPtrT> tmp232;
+    ca_.Bind(&block21, &tmp221, &tmp222, &tmp223, &tmp224, &tmp225, &tmp226, &tmp227, &tmp228, &tmp229, &tmp230, &tmp231, &tmp232);
+    ca_.Goto(&block20, tmp221, tmp222, tmp223, tmp224, tmp225, tmp226, tmp227, tmp228, tmp229, tmp230, tmp231, tmp232);
+  }
+
+  if (block20.is_used()) {
+    TNode<Context> tmp233;
+    TNode<FixedArray> tmp234;
+    TNode<JSReceiver> tmp235;
+    TNode<IntPtrT> tmp236;
+    TNode<IntPtrT> tmp237;
+    TNode<FixedArray> tmp238;
+    TNode<IntPtrT> tmp239;
+    TNode<IntPtrT> tmp240;
+    TNode<IntPtrT> tmp241;
+    TNode<IntPtrT> tmp242;
+    TNode<HeapObject> tmp243;
+    TNode<IntPtrT> tmp244;
+    ca_.Bind(&block20, &tmp233, &tmp234, &tmp235, &tmp236, &tmp237, &tmp238, &tmp239, &tmp240, &tmp241, &tmp242, &tmp243, &tmp244);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 501);
+    TNode<Oddball> tmp245;
+    USE(tmp245);
+    tmp245 = TheHole_62(state_);
+    CodeStubAssembler(state_).StoreReference(CodeStubAssembler::Reference{tmp243, tmp244}, tmp245);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 495);
+    ca_.Goto(&block19, tmp233, tmp234, tmp235, tmp236, tmp237);
+  }
+
+  if (block19.is_used()) {
+    TNode<Context> tmp246;
+    TNode<FixedArray> tmp247;
+    TNode<JSReceiver> tmp248;
+    TNode<IntPtrT> tmp249;
+    TNode<IntPtrT> tmp250;
+    ca_.Bind(&block19, &tmp246, &tmp247, &tmp248, &tmp249, &tmp250);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 503);
+    TNode<Oddball> tmp251;
+    USE(tmp251);
+    tmp251 = Undefined_64(state_);
+    CodeStubAssembler(state_).Return(tmp251);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp252;
+    TNode<FixedArray> tmp253;
+    TNode<JSReceiver> tmp254;
+    TNode<IntPtrT> tmp255;
+    TNode<IntPtrT> tmp256;
+    ca_.Bind(&block6, &tmp252, &tmp253, &tmp254, &tmp255, &tmp256);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 491);
+    ca_.Goto(&block4, tmp252, tmp253, tmp254, tmp255, tmp256);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp257;
+    TNode<FixedArray> tmp258;
+    TNode<JSReceiver> tmp259;
+    TNode<IntPtrT> tmp260;
+    TNode<IntPtrT> tmp261;
+    ca_.Bind(&block4, &tmp257, &tmp258, &tmp259, &tmp260, &tmp261);
+    TNode<IntPtrT> tmp262;
+    USE(tmp262);
+    tmp262 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<IntPtrT> tmp263;
+    USE(tmp263);
+    tmp263 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp261}, TNode<IntPtrT>{tmp262});
+    ca_.Goto(&block3, tmp257, tmp258, tmp259, tmp260, tmp263);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp264;
+    TNode<FixedArray> tmp265;
+    TNode<JSReceiver> tmp266;
+    TNode<IntPtrT> tmp267;
+    TNode<IntPtrT> tmp268;
+    ca_.Bind(&block2, &tmp264, &tmp265, &tmp266, &tmp267, &tmp268);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 506);
+    CodeStubAssembler(state_).Unreachable();
+  }
+}
+
+void JoinStackPopInline_18(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<JSReceiver> p_receiver) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, IntPtrT, FixedArray, IntPtrT, IntPtrT, HeapObject, IntPtrT> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, IntPtrT, BoolT> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, IntPtrT, BoolT> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, IntPtrT, BoolT, BoolT> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, IntPtrT> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, IntPtrT> block7(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, FixedArray, IntPtrT> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_receiver);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 511);
+    TNode<FixedArray> tmp2;
+    USE(tmp2);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp2 = LoadJoinStack_15(state_, TNode<Context>{tmp0}, &label0);
+    ca_.Goto(&block4, tmp0, tmp1, tmp2);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block5, tmp0, tmp1);
+    }
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp3;
+    TNode<JSReceiver> tmp4;
+    ca_.Bind(&block5, &tmp3, &tmp4);
+    ca_.Goto(&block3, tmp3, tmp4);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp5;
+    TNode<JSReceiver> tmp6;
+    TNode<FixedArray> tmp7;
+    ca_.Bind(&block4, &tmp5, &tmp6, &tmp7);
+    ca_.Goto(&block2, tmp5, tmp6, tmp7);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp8;
+    TNode<JSReceiver> tmp9;
+    ca_.Bind(&block3, &tmp8, &tmp9);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 512);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp10;
+    TNode<JSReceiver> tmp11;
+    TNode<FixedArray> tmp12;
+    ca_.Bind(&block2, &tmp10, &tmp11, &tmp12);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 511);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 513);
+    TNode<IntPtrT> tmp13;
+    USE(tmp13);
+    tmp13 = CodeStubAssembler(state_).LoadAndUntagFixedArrayBaseLength(TNode<FixedArrayBase>{tmp12});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 517);
+    TNode<IntPtrT> tmp14 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp14);
+    TNode<IntPtrT> tmp15 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp15);
+    TNode<Smi>tmp16 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp12, tmp15});
+    TNode<IntPtrT> tmp17;
+    USE(tmp17);
+    tmp17 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp16});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 50);
+    TNode<IntPtrT> tmp18;
+    USE(tmp18);
+    tmp18 = Convert8ATintptr17ATconstexpr_int31_1376(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 51);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp19;
+    USE(tmp19);
+    tmp19 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp18});
+    TNode<UintPtrT> tmp20;
+    USE(tmp20);
+    tmp20 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp17});
+    TNode<BoolT> tmp21;
+    USE(tmp21);
+    tmp21 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp19}, TNode<UintPtrT>{tmp20});
+    ca_.Branch(tmp21, &block12, &block13, tmp10, tmp11, tmp12, tmp13, tmp12, tmp14, tmp17, tmp18, tmp12, tmp14, tmp17, tmp18, tmp18);
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp22;
+    TNode<JSReceiver> tmp23;
+    TNode<FixedArray> tmp24;
+    TNode<IntPtrT> tmp25;
+    TNode<FixedArray> tmp26;
+    TNode<IntPtrT> tmp27;
+    TNode<IntPtrT> tmp28;
+    TNode<IntPtrT> tmp29;
+    TNode<HeapObject> tmp30;
+    TNode<IntPtrT> tmp31;
+    TNode<IntPtrT> tmp32;
+    TNode<IntPtrT> tmp33;
+    TNode<IntPtrT> tmp34;
+    ca_.Bind(&block12, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp35;
+    USE(tmp35);
+    tmp35 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp36;
+    USE(tmp36);
+    tmp36 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp34}, TNode<IntPtrT>{tmp35});
+    TNode<IntPtrT> tmp37;
+    USE(tmp37);
+    tmp37 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp31}, TNode<IntPtrT>{tmp36});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp38;
+    USE(tmp38);
+    TNode<IntPtrT> tmp39;
+    USE(tmp39);
+    std::tie(tmp38, tmp39) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp30}, TNode<IntPtrT>{tmp37}).Flatten();
+    ca_.Goto(&block11, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27, tmp28, tmp29, tmp30, tmp31, tmp32, tmp33, tmp34, tmp38, tmp39);
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp40;
+    TNode<JSReceiver> tmp41;
+    TNode<FixedArray> tmp42;
+    TNode<IntPtrT> tmp43;
+    TNode<FixedArray> tmp44;
+    TNode<IntPtrT> tmp45;
+    TNode<IntPtrT> tmp46;
+    TNode<IntPtrT> tmp47;
+    TNode<HeapObject> tmp48;
+    TNode<IntPtrT> tmp49;
+    TNode<IntPtrT> tmp50;
+    TNode<IntPtrT> tmp51;
+    TNode<IntPtrT> tmp52;
+    ca_.Bind(&block13, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block10, tmp40, tmp41, tmp42, tmp43, tmp44, tmp45, tmp46, tmp47);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp53;
+    TNode<JSReceiver> tmp54;
+    TNode<FixedArray> tmp55;
+    TNode<IntPtrT> tmp56;
+    TNode<FixedArray> tmp57;
+    TNode<IntPtrT> tmp58;
+    TNode<IntPtrT> tmp59;
+    TNode<IntPtrT> tmp60;
+    TNode<HeapObject> tmp61;
+    TNode<IntPtrT> tmp62;
+    TNode<IntPtrT> tmp63;
+    TNode<IntPtrT> tmp64;
+    TNode<IntPtrT> tmp65;
+    TNode<HeapObject> tmp66;
+    TNode<IntPtrT> tmp67;
+    ca_.Bind(&block11, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66, &tmp67);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 51);
+    ca_.Goto(&block9, tmp53, tmp54, tmp55, tmp56, tmp57, tmp58, tmp59, tmp60, tmp66, tmp67);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp68;
+    TNode<JSReceiver> tmp69;
+    TNode<FixedArray> tmp70;
+    TNode<IntPtrT> tmp71;
+    TNode<FixedArray> tmp72;
+    TNode<IntPtrT> tmp73;
+    TNode<IntPtrT> tmp74;
+    TNode<IntPtrT> tmp75;
+    ca_.Bind(&block10, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp76;
+    TNode<JSReceiver> tmp77;
+    TNode<FixedArray> tmp78;
+    TNode<IntPtrT> tmp79;
+    TNode<FixedArray> tmp80;
+    TNode<IntPtrT> tmp81;
+    TNode<IntPtrT> tmp82;
+    TNode<IntPtrT> tmp83;
+    TNode<HeapObject> tmp84;
+    TNode<IntPtrT> tmp85;
+    ca_.Bind(&block9, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85);
+    ca_.Goto(&block8, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, tmp84, tmp85);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp86;
+    TNode<JSReceiver> tmp87;
+    TNode<FixedArray> tmp88;
+    TNode<IntPtrT> tmp89;
+    TNode<FixedArray> tmp90;
+    TNode<IntPtrT> tmp91;
+    TNode<IntPtrT> tmp92;
+    TNode<HeapObject> tmp93;
+    TNode<IntPtrT> tmp94;
+    ca_.Bind(&block8, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 517);
+    TNode<Object>tmp95 = CodeStubAssembler(state_).LoadReference<Object>(CodeStubAssembler::Reference{tmp93, tmp94});
+    TNode<BoolT> tmp96;
+    USE(tmp96);
+    tmp96 = CodeStubAssembler(state_).TaggedEqual(TNode<Object>{tmp95}, TNode<HeapObject>{tmp87});
+    ca_.Branch(tmp96, &block15, &block16, tmp86, tmp87, tmp88, tmp89, tmp96);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp97;
+    TNode<JSReceiver> tmp98;
+    TNode<FixedArray> tmp99;
+    TNode<IntPtrT> tmp100;
+    TNode<BoolT> tmp101;
+    ca_.Bind(&block15, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101);
+    TNode<IntPtrT> tmp102;
+    USE(tmp102);
+    tmp102 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, JSArray::kMinJoinStackSize);
+    TNode<BoolT> tmp103;
+    USE(tmp103);
+    tmp103 = CodeStubAssembler(state_).WordEqual(TNode<IntPtrT>{tmp100}, TNode<IntPtrT>{tmp102});
+    ca_.Goto(&block17, tmp97, tmp98, tmp99, tmp100, tmp101, tmp103);
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp104;
+    TNode<JSReceiver> tmp105;
+    TNode<FixedArray> tmp106;
+    TNode<IntPtrT> tmp107;
+    TNode<BoolT> tmp108;
+    ca_.Bind(&block16, &tmp104, &tmp105, &tmp106, &tmp107, &tmp108);
+    TNode<BoolT> tmp109;
+    USE(tmp109);
+    tmp109 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, false);
+    ca_.Goto(&block17, tmp104, tmp105, tmp106, tmp107, tmp108, tmp109);
+  }
+
+  if (block17.is_used()) {
+    TNode<Context> tmp110;
+    TNode<JSReceiver> tmp111;
+    TNode<FixedArray> tmp112;
+    TNode<IntPtrT> tmp113;
+    TNode<BoolT> tmp114;
+    TNode<BoolT> tmp115;
+    ca_.Bind(&block17, &tmp110, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115);
+    ca_.Branch(tmp115, &block6, &block7, tmp110, tmp111, tmp112, tmp113);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp116;
+    TNode<JSReceiver> tmp117;
+    TNode<FixedArray> tmp118;
+    TNode<IntPtrT> tmp119;
+    ca_.Bind(&block6, &tmp116, &tmp117, &tmp118, &tmp119);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 518);
+    TNode<Oddball> tmp120;
+    USE(tmp120);
+    tmp120 = TheHole_62(state_);
+    CodeStubAssembler(state_).StoreFixedArrayElement(TNode<FixedArray>{tmp118}, 0, TNode<Object>{tmp120}, SKIP_WRITE_BARRIER);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 517);
+    ca_.Goto(&block18, tmp116, tmp117, tmp118, tmp119);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp121;
+    TNode<JSReceiver> tmp122;
+    TNode<FixedArray> tmp123;
+    TNode<IntPtrT> tmp124;
+    ca_.Bind(&block7, &tmp121, &tmp122, &tmp123, &tmp124);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 521);
+    TNode<Object> tmp125;
+    tmp125 = CodeStubAssembler(state_).CallBuiltin(Builtins::kJoinStackPop, tmp121, tmp123, tmp122);
+    USE(tmp125);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 517);
+    ca_.Goto(&block18, tmp121, tmp122, tmp123, tmp124);
+  }
+
+  if (block18.is_used()) {
+    TNode<Context> tmp126;
+    TNode<JSReceiver> tmp127;
+    TNode<FixedArray> tmp128;
+    TNode<IntPtrT> tmp129;
+    ca_.Bind(&block18, &tmp126, &tmp127, &tmp128, &tmp129);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 510);
+    ca_.Goto(&block1, tmp126, tmp127);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp130;
+    TNode<JSReceiver> tmp131;
+    ca_.Bind(&block1, &tmp130, &tmp131);
+    ca_.Goto(&block19, tmp130, tmp131);
+  }
+
+    TNode<Context> tmp132;
+    TNode<JSReceiver> tmp133;
+    ca_.Bind(&block19, &tmp132, &tmp133);
+}
+
+TF_BUILTIN(ArrayPrototypeJoin, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  Node* argc = Parameter(Descriptor::kJSActualArgumentsCount);
+  TNode<IntPtrT> arguments_length(ChangeInt32ToIntPtr(argc));
+  TNode<RawPtrT> arguments_frame = UncheckedCast<RawPtrT>(LoadFramePointer());
+  TorqueStructArguments torque_arguments(GetFrameArguments(arguments_frame, arguments_length));
+  CodeStubArguments arguments(this, torque_arguments);
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = arguments.GetReceiver();
+USE(parameter1);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, JSReceiver, Number> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, JSReceiver, Number> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, torque_arguments.frame, torque_arguments.base, torque_arguments.length, parameter0, parameter1);
+
+  if (block0.is_used()) {
+    TNode<RawPtrT> tmp0;
+    TNode<RawPtrT> tmp1;
+    TNode<IntPtrT> tmp2;
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 556);
+    TNode<IntPtrT> tmp5;
+    USE(tmp5);
+    tmp5 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<Object> tmp6;
+    USE(tmp6);
+    tmp6 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp0}, TNode<RawPtrT>{tmp1}, TNode<IntPtrT>{tmp2}}, TNode<IntPtrT>{tmp5});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 559);
+    TNode<JSReceiver> tmp7;
+    USE(tmp7);
+    tmp7 = CodeStubAssembler(state_).ToObject_Inline(TNode<Context>{tmp3}, TNode<Object>{tmp4});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 562);
+    TNode<Number> tmp8;
+    USE(tmp8);
+    tmp8 = GetLengthProperty_247(state_, TNode<Context>{tmp3}, TNode<Object>{tmp7});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 566);
+    TNode<Number> tmp9;
+    USE(tmp9);
+    tmp9 = FromConstexpr20UT5ATSmi10HeapNumber18ATconstexpr_uint32_158(state_, (CodeStubAssembler(state_).ConstexprUint32Add(JSArray::kMaxArrayIndex, 1)));
+    TNode<BoolT> tmp10;
+    USE(tmp10);
+    tmp10 = NumberIsGreaterThan_77(state_, TNode<Number>{tmp8}, TNode<Number>{tmp9});
+    ca_.Branch(tmp10, &block1, &block2, tmp0, tmp1, tmp2, tmp3, tmp4, tmp6, tmp7, tmp8);
+  }
+
+  if (block1.is_used()) {
+    TNode<RawPtrT> tmp11;
+    TNode<RawPtrT> tmp12;
+    TNode<IntPtrT> tmp13;
+    TNode<Context> tmp14;
+    TNode<Object> tmp15;
+    TNode<Object> tmp16;
+    TNode<JSReceiver> tmp17;
+    TNode<Number> tmp18;
+    ca_.Bind(&block1, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18);
+    CodeStubAssembler(state_).ThrowTypeError(TNode<Context>{tmp14}, MessageTemplate::kInvalidArrayLength);
+  }
+
+  if (block2.is_used()) {
+    TNode<RawPtrT> tmp19;
+    TNode<RawPtrT> tmp20;
+    TNode<IntPtrT> tmp21;
+    TNode<Context> tmp22;
+    TNode<Object> tmp23;
+    TNode<Object> tmp24;
+    TNode<JSReceiver> tmp25;
+    TNode<Number> tmp26;
+    ca_.Bind(&block2, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 569);
+    TNode<Oddball> tmp27;
+    USE(tmp27);
+    tmp27 = Undefined_64(state_);
+    TNode<Oddball> tmp28;
+    USE(tmp28);
+    tmp28 = Undefined_64(state_);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 568);
+    TNode<Object> tmp29;
+    USE(tmp29);
+    tmp29 = CycleProtectedArrayJoin7JSArray_1382(state_, TNode<Context>{tmp22}, false, TNode<JSReceiver>{tmp25}, TNode<Number>{tmp26}, TNode<Object>{tmp24}, TNode<Object>{tmp27}, TNode<Object>{tmp28});
+    arguments.PopAndReturn(tmp29);
+  }
+}
+
+TF_BUILTIN(ArrayPrototypeToLocaleString, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  Node* argc = Parameter(Descriptor::kJSActualArgumentsCount);
+  TNode<IntPtrT> arguments_length(ChangeInt32ToIntPtr(argc));
+  TNode<RawPtrT> arguments_frame = UncheckedCast<RawPtrT>(LoadFramePointer());
+  TorqueStructArguments torque_arguments(GetFrameArguments(arguments_frame, arguments_length));
+  CodeStubArguments arguments(this, torque_arguments);
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = arguments.GetReceiver();
+USE(parameter1);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, Object, JSReceiver, Number> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, Object, JSReceiver, Number> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, torque_arguments.frame, torque_arguments.base, torque_arguments.length, parameter0, parameter1);
+
+  if (block0.is_used()) {
+    TNode<RawPtrT> tmp0;
+    TNode<RawPtrT> tmp1;
+    TNode<IntPtrT> tmp2;
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 575);
+    TNode<IntPtrT> tmp5;
+    USE(tmp5);
+    tmp5 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<Object> tmp6;
+    USE(tmp6);
+    tmp6 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp0}, TNode<RawPtrT>{tmp1}, TNode<IntPtrT>{tmp2}}, TNode<IntPtrT>{tmp5});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 576);
+    TNode<IntPtrT> tmp7;
+    USE(tmp7);
+    tmp7 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<Object> tmp8;
+    USE(tmp8);
+    tmp8 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp0}, TNode<RawPtrT>{tmp1}, TNode<IntPtrT>{tmp2}}, TNode<IntPtrT>{tmp7});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 579);
+    TNode<JSReceiver> tmp9;
+    USE(tmp9);
+    tmp9 = CodeStubAssembler(state_).ToObject_Inline(TNode<Context>{tmp3}, TNode<Object>{tmp4});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 582);
+    TNode<Number> tmp10;
+    USE(tmp10);
+    tmp10 = GetLengthProperty_247(state_, TNode<Context>{tmp3}, TNode<Object>{tmp9});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 586);
+    TNode<Number> tmp11;
+    USE(tmp11);
+    tmp11 = FromConstexpr20UT5ATSmi10HeapNumber18ATconstexpr_uint32_158(state_, (CodeStubAssembler(state_).ConstexprUint32Add(JSArray::kMaxArrayIndex, 1)));
+    TNode<BoolT> tmp12;
+    USE(tmp12);
+    tmp12 = NumberIsGreaterThan_77(state_, TNode<Number>{tmp10}, TNode<Number>{tmp11});
+    ca_.Branch(tmp12, &block1, &block2, tmp0, tmp1, tmp2, tmp3, tmp4, tmp6, tmp8, tmp9, tmp10);
+  }
+
+  if (block1.is_used()) {
+    TNode<RawPtrT> tmp13;
+    TNode<RawPtrT> tmp14;
+    TNode<IntPtrT> tmp15;
+    TNode<Context> tmp16;
+    TNode<Object> tmp17;
+    TNode<Object> tmp18;
+    TNode<Object> tmp19;
+    TNode<JSReceiver> tmp20;
+    TNode<Number> tmp21;
+    ca_.Bind(&block1, &tmp13, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21);
+    CodeStubAssembler(state_).ThrowTypeError(TNode<Context>{tmp16}, MessageTemplate::kInvalidArrayLength);
+  }
+
+  if (block2.is_used()) {
+    TNode<RawPtrT> tmp22;
+    TNode<RawPtrT> tmp23;
+    TNode<IntPtrT> tmp24;
+    TNode<Context> tmp25;
+    TNode<Object> tmp26;
+    TNode<Object> tmp27;
+    TNode<Object> tmp28;
+    TNode<JSReceiver> tmp29;
+    TNode<Number> tmp30;
+    ca_.Bind(&block2, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27, &tmp28, &tmp29, &tmp30);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 589);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 588);
+    TNode<Object> tmp31;
+    USE(tmp31);
+    tmp31 = FromConstexpr90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol18ATconstexpr_string_172(state_, ",");
+    TNode<Object> tmp32;
+    USE(tmp32);
+    tmp32 = CycleProtectedArrayJoin7JSArray_1382(state_, TNode<Context>{tmp25}, true, TNode<JSReceiver>{tmp29}, TNode<Number>{tmp30}, TNode<Object>{tmp31}, TNode<Object>{tmp27}, TNode<Object>{tmp28});
+    arguments.PopAndReturn(tmp32);
+  }
+}
+
+TF_BUILTIN(ArrayPrototypeToString, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  Node* argc = Parameter(Descriptor::kJSActualArgumentsCount);
+  TNode<IntPtrT> arguments_length(ChangeInt32ToIntPtr(argc));
+  TNode<RawPtrT> arguments_frame = UncheckedCast<RawPtrT>(LoadFramePointer());
+  TorqueStructArguments torque_arguments(GetFrameArguments(arguments_frame, arguments_length));
+  CodeStubArguments arguments(this, torque_arguments);
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = arguments.GetReceiver();
+USE(parameter1);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Object, Object, JSReceiver> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, torque_arguments.frame, torque_arguments.base, torque_arguments.length, parameter0, parameter1);
+
+  if (block0.is_used()) {
+    TNode<RawPtrT> tmp0;
+    TNode<RawPtrT> tmp1;
+    TNode<IntPtrT> tmp2;
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 596);
+    TNode<JSReceiver> tmp5;
+    USE(tmp5);
+    tmp5 = CodeStubAssembler(state_).ToObject_Inline(TNode<Context>{tmp3}, TNode<Object>{tmp4});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 599);
+    TNode<Object> tmp6;
+    USE(tmp6);
+    tmp6 = FromConstexpr90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol18ATconstexpr_string_172(state_, "join");
+    TNode<Object> tmp7;
+    USE(tmp7);
+    tmp7 = CodeStubAssembler(state_).GetProperty(TNode<Context>{tmp3}, TNode<Object>{tmp5}, TNode<Object>{tmp6});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 603);
+    TNode<JSReceiver> tmp8;
+    USE(tmp8);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp8 = Cast71UT19ATCallableApiObject17ATCallableJSProxy15JSBoundFunction10JSFunction_1366(state_, TNode<Context>{tmp3}, TNode<Object>{tmp7}, &label0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp7, tmp7, tmp8);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block4, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp7, tmp7);
+    }
+  }
+
+  if (block4.is_used()) {
+    TNode<RawPtrT> tmp9;
+    TNode<RawPtrT> tmp10;
+    TNode<IntPtrT> tmp11;
+    TNode<Context> tmp12;
+    TNode<Object> tmp13;
+    TNode<JSReceiver> tmp14;
+    TNode<Object> tmp15;
+    TNode<Object> tmp16;
+    ca_.Bind(&block4, &tmp9, &tmp10, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16);
+    ca_.Goto(&block2, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15);
+  }
+
+  if (block3.is_used()) {
+    TNode<RawPtrT> tmp17;
+    TNode<RawPtrT> tmp18;
+    TNode<IntPtrT> tmp19;
+    TNode<Context> tmp20;
+    TNode<Object> tmp21;
+    TNode<JSReceiver> tmp22;
+    TNode<Object> tmp23;
+    TNode<Object> tmp24;
+    TNode<JSReceiver> tmp25;
+    ca_.Bind(&block3, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 606);
+    TNode<Object> tmp26;
+    USE(tmp26);
+    tmp26 = CodeStubAssembler(state_).Call(TNode<Context>{tmp20}, TNode<JSReceiver>{tmp25}, TNode<Object>{tmp22});
+    arguments.PopAndReturn(tmp26);
+  }
+
+  if (block2.is_used()) {
+    TNode<RawPtrT> tmp27;
+    TNode<RawPtrT> tmp28;
+    TNode<IntPtrT> tmp29;
+    TNode<Context> tmp30;
+    TNode<Object> tmp31;
+    TNode<JSReceiver> tmp32;
+    TNode<Object> tmp33;
+    ca_.Bind(&block2, &tmp27, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 609);
+    TNode<Object> tmp34;
+    tmp34 = CodeStubAssembler(state_).CallBuiltin(Builtins::kObjectToString, tmp30, tmp32);
+    USE(tmp34);
+    arguments.PopAndReturn(tmp34);
+  }
+}
+
+TF_BUILTIN(TypedArrayPrototypeJoin, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  Node* argc = Parameter(Descriptor::kJSActualArgumentsCount);
+  TNode<IntPtrT> arguments_length(ChangeInt32ToIntPtr(argc));
+  TNode<RawPtrT> arguments_frame = UncheckedCast<RawPtrT>(LoadFramePointer());
+  TorqueStructArguments torque_arguments(GetFrameArguments(arguments_frame, arguments_length));
+  CodeStubArguments arguments(this, torque_arguments);
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = arguments.GetReceiver();
+USE(parameter1);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, torque_arguments.frame, torque_arguments.base, torque_arguments.length, parameter0, parameter1);
+
+  if (block0.is_used()) {
+    TNode<RawPtrT> tmp0;
+    TNode<RawPtrT> tmp1;
+    TNode<IntPtrT> tmp2;
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 616);
+    TNode<IntPtrT> tmp5;
+    USE(tmp5);
+    tmp5 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<Object> tmp6;
+    USE(tmp6);
+    tmp6 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp0}, TNode<RawPtrT>{tmp1}, TNode<IntPtrT>{tmp2}}, TNode<IntPtrT>{tmp5});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 621);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 620);
+    TNode<JSTypedArray> tmp7;
+    USE(tmp7);
+    tmp7 = TypedArrayBuiltinsAssembler(state_).ValidateTypedArray(TNode<Context>{tmp3}, TNode<Object>{tmp4}, "%TypedArray%.prototype.join");
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 622);
+    TNode<IntPtrT> tmp8 = ca_.IntPtrConstant(JSTypedArray::kLengthOffset);
+    USE(tmp8);
+    TNode<UintPtrT>tmp9 = CodeStubAssembler(state_).LoadReference<UintPtrT>(CodeStubAssembler::Reference{tmp7, tmp8});
+    TNode<Number> tmp10;
+    USE(tmp10);
+    tmp10 = Convert20UT5ATSmi10HeapNumber9ATuintptr_204(state_, TNode<UintPtrT>{tmp9});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 625);
+    TNode<Oddball> tmp11;
+    USE(tmp11);
+    tmp11 = Undefined_64(state_);
+    TNode<Oddball> tmp12;
+    USE(tmp12);
+    tmp12 = Undefined_64(state_);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 624);
+    TNode<Object> tmp13;
+    USE(tmp13);
+    tmp13 = CycleProtectedArrayJoin12JSTypedArray_1383(state_, TNode<Context>{tmp3}, false, TNode<JSReceiver>{tmp7}, TNode<Number>{tmp10}, TNode<Object>{tmp6}, TNode<Object>{tmp11}, TNode<Object>{tmp12});
+    arguments.PopAndReturn(tmp13);
+  }
+}
+
+TF_BUILTIN(TypedArrayPrototypeToLocaleString, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  Node* argc = Parameter(Descriptor::kJSActualArgumentsCount);
+  TNode<IntPtrT> arguments_length(ChangeInt32ToIntPtr(argc));
+  TNode<RawPtrT> arguments_frame = UncheckedCast<RawPtrT>(LoadFramePointer());
+  TorqueStructArguments torque_arguments(GetFrameArguments(arguments_frame, arguments_length));
+  CodeStubArguments arguments(this, torque_arguments);
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = arguments.GetReceiver();
+USE(parameter1);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, torque_arguments.frame, torque_arguments.base, torque_arguments.length, parameter0, parameter1);
+
+  if (block0.is_used()) {
+    TNode<RawPtrT> tmp0;
+    TNode<RawPtrT> tmp1;
+    TNode<IntPtrT> tmp2;
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 631);
+    TNode<IntPtrT> tmp5;
+    USE(tmp5);
+    tmp5 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<Object> tmp6;
+    USE(tmp6);
+    tmp6 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp0}, TNode<RawPtrT>{tmp1}, TNode<IntPtrT>{tmp2}}, TNode<IntPtrT>{tmp5});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 632);
+    TNode<IntPtrT> tmp7;
+    USE(tmp7);
+    tmp7 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<Object> tmp8;
+    USE(tmp8);
+    tmp8 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp0}, TNode<RawPtrT>{tmp1}, TNode<IntPtrT>{tmp2}}, TNode<IntPtrT>{tmp7});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 637);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 636);
+    TNode<JSTypedArray> tmp9;
+    USE(tmp9);
+    tmp9 = TypedArrayBuiltinsAssembler(state_).ValidateTypedArray(TNode<Context>{tmp3}, TNode<Object>{tmp4}, "%TypedArray%.prototype.toLocaleString");
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 638);
+    TNode<IntPtrT> tmp10 = ca_.IntPtrConstant(JSTypedArray::kLengthOffset);
+    USE(tmp10);
+    TNode<UintPtrT>tmp11 = CodeStubAssembler(state_).LoadReference<UintPtrT>(CodeStubAssembler::Reference{tmp9, tmp10});
+    TNode<Number> tmp12;
+    USE(tmp12);
+    tmp12 = Convert20UT5ATSmi10HeapNumber9ATuintptr_204(state_, TNode<UintPtrT>{tmp11});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 641);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 640);
+    TNode<Object> tmp13;
+    USE(tmp13);
+    tmp13 = FromConstexpr90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol18ATconstexpr_string_172(state_, ",");
+    TNode<Object> tmp14;
+    USE(tmp14);
+    tmp14 = CycleProtectedArrayJoin12JSTypedArray_1383(state_, TNode<Context>{tmp3}, true, TNode<JSReceiver>{tmp9}, TNode<Number>{tmp12}, TNode<Object>{tmp13}, TNode<Object>{tmp6}, TNode<Object>{tmp8});
+    arguments.PopAndReturn(tmp14);
+  }
+}
+
+TNode<JSArray> UnsafeCast7JSArray_1368(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block5(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSArray> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSArray> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3001);
+    ca_.Goto(&block3, tmp0, tmp1);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp2;
+    TNode<Object> tmp3;
+    ca_.Bind(&block2, &tmp2, &tmp3);
+    TNode<BoolT> tmp4;
+    USE(tmp4);
+    tmp4 = Is7JSArray20UT5ATSmi10HeapObject_1458(state_, TNode<Context>{tmp2}, TNode<Object>{tmp3});
+    ca_.Branch(tmp4, &block4, &block5, tmp2, tmp3);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp5;
+    TNode<Object> tmp6;
+    ca_.Bind(&block5, &tmp5, &tmp6);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'Is<A>(o)' failed", "../../deps/v8/src/builtins/base.tq", 3001);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp7;
+    TNode<Object> tmp8;
+    ca_.Bind(&block4, &tmp7, &tmp8);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp9;
+    TNode<Object> tmp10;
+    ca_.Bind(&block3, &tmp9, &tmp10);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3002);
+    TNode<JSArray> tmp11;
+    USE(tmp11);
+    tmp11 = TORQUE_CAST(TNode<Object>{tmp10});
+    ca_.Goto(&block1, tmp9, tmp10, tmp11);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp12;
+    TNode<Object> tmp13;
+    TNode<JSArray> tmp14;
+    ca_.Bind(&block1, &tmp12, &tmp13, &tmp14);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 21);
+    ca_.Goto(&block6, tmp12, tmp13, tmp14);
+  }
+
+    TNode<Context> tmp15;
+    TNode<Object> tmp16;
+    TNode<JSArray> tmp17;
+    ca_.Bind(&block6, &tmp15, &tmp16, &tmp17);
+  return TNode<JSArray>{tmp17};
+}
+
+TNode<NumberDictionary> UnsafeCast16NumberDictionary_1369(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block5(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, NumberDictionary> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, NumberDictionary> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3001);
+    ca_.Goto(&block3, tmp0, tmp1);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp2;
+    TNode<Object> tmp3;
+    ca_.Bind(&block2, &tmp2, &tmp3);
+    TNode<BoolT> tmp4;
+    USE(tmp4);
+    tmp4 = Is16NumberDictionary20UT5ATSmi10HeapObject_1459(state_, TNode<Context>{tmp2}, TNode<Object>{tmp3});
+    ca_.Branch(tmp4, &block4, &block5, tmp2, tmp3);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp5;
+    TNode<Object> tmp6;
+    ca_.Bind(&block5, &tmp5, &tmp6);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'Is<A>(o)' failed", "../../deps/v8/src/builtins/base.tq", 3001);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp7;
+    TNode<Object> tmp8;
+    ca_.Bind(&block4, &tmp7, &tmp8);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp9;
+    TNode<Object> tmp10;
+    ca_.Bind(&block3, &tmp9, &tmp10);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3002);
+    TNode<NumberDictionary> tmp11;
+    USE(tmp11);
+    tmp11 = TORQUE_CAST(TNode<Object>{tmp10});
+    ca_.Goto(&block1, tmp9, tmp10, tmp11);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp12;
+    TNode<Object> tmp13;
+    TNode<NumberDictionary> tmp14;
+    ca_.Bind(&block1, &tmp12, &tmp13, &tmp14);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 22);
+    ca_.Goto(&block6, tmp12, tmp13, tmp14);
+  }
+
+    TNode<Context> tmp15;
+    TNode<Object> tmp16;
+    TNode<NumberDictionary> tmp17;
+    ca_.Bind(&block6, &tmp15, &tmp16, &tmp17);
+  return TNode<NumberDictionary>{tmp17};
+}
+
+TNode<FixedArray> UnsafeCast10FixedArray_1370(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block5(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, FixedArray> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, FixedArray> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3001);
+    ca_.Goto(&block3, tmp0, tmp1);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp2;
+    TNode<Object> tmp3;
+    ca_.Bind(&block2, &tmp2, &tmp3);
+    TNode<BoolT> tmp4;
+    USE(tmp4);
+    tmp4 = Is10FixedArray20UT5ATSmi10HeapObject_1460(state_, TNode<Context>{tmp2}, TNode<Object>{tmp3});
+    ca_.Branch(tmp4, &block4, &block5, tmp2, tmp3);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp5;
+    TNode<Object> tmp6;
+    ca_.Bind(&block5, &tmp5, &tmp6);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'Is<A>(o)' failed", "../../deps/v8/src/builtins/base.tq", 3001);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp7;
+    TNode<Object> tmp8;
+    ca_.Bind(&block4, &tmp7, &tmp8);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp9;
+    TNode<Object> tmp10;
+    ca_.Bind(&block3, &tmp9, &tmp10);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3002);
+    TNode<FixedArray> tmp11;
+    USE(tmp11);
+    tmp11 = TORQUE_CAST(TNode<Object>{tmp10});
+    ca_.Goto(&block1, tmp9, tmp10, tmp11);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp12;
+    TNode<Object> tmp13;
+    TNode<FixedArray> tmp14;
+    ca_.Bind(&block1, &tmp12, &tmp13, &tmp14);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 38);
+    ca_.Goto(&block6, tmp12, tmp13, tmp14);
+  }
+
+    TNode<Context> tmp15;
+    TNode<Object> tmp16;
+    TNode<FixedArray> tmp17;
+    ca_.Bind(&block6, &tmp15, &tmp16, &tmp17);
+  return TNode<FixedArray>{tmp17};
+}
+
+TNode<Smi> UnsafeCast5ATSmi_1371(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block5(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Smi> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Smi> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3001);
+    ca_.Goto(&block3, tmp0, tmp1);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp2;
+    TNode<Object> tmp3;
+    ca_.Bind(&block2, &tmp2, &tmp3);
+    TNode<BoolT> tmp4;
+    USE(tmp4);
+    tmp4 = Is5ATSmi20UT5ATSmi10HeapObject_1461(state_, TNode<Context>{tmp2}, TNode<Object>{tmp3});
+    ca_.Branch(tmp4, &block4, &block5, tmp2, tmp3);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp5;
+    TNode<Object> tmp6;
+    ca_.Bind(&block5, &tmp5, &tmp6);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'Is<A>(o)' failed", "../../deps/v8/src/builtins/base.tq", 3001);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp7;
+    TNode<Object> tmp8;
+    ca_.Bind(&block4, &tmp7, &tmp8);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp9;
+    TNode<Object> tmp10;
+    ca_.Bind(&block3, &tmp9, &tmp10);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3002);
+    TNode<Smi> tmp11;
+    USE(tmp11);
+    tmp11 = TORQUE_CAST(TNode<Object>{tmp10});
+    ca_.Goto(&block1, tmp9, tmp10, tmp11);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp12;
+    TNode<Object> tmp13;
+    TNode<Smi> tmp14;
+    ca_.Bind(&block1, &tmp12, &tmp13, &tmp14);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 39);
+    ca_.Goto(&block6, tmp12, tmp13, tmp14);
+  }
+
+    TNode<Context> tmp15;
+    TNode<Object> tmp16;
+    TNode<Smi> tmp17;
+    ca_.Bind(&block6, &tmp15, &tmp16, &tmp17);
+  return TNode<Smi>{tmp17};
+}
+
+TNode<Object> UnsafeCast90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol_1373(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block5(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3001);
+    ca_.Goto(&block3, tmp0, tmp1);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp2;
+    TNode<Object> tmp3;
+    ca_.Bind(&block2, &tmp2, &tmp3);
+    TNode<BoolT> tmp4;
+    USE(tmp4);
+    tmp4 = Is90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol20UT5ATSmi10HeapObject_1462(state_, TNode<Context>{tmp2}, TNode<Object>{tmp3});
+    ca_.Branch(tmp4, &block4, &block5, tmp2, tmp3);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp5;
+    TNode<Object> tmp6;
+    ca_.Bind(&block5, &tmp5, &tmp6);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'Is<A>(o)' failed", "../../deps/v8/src/builtins/base.tq", 3001);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp7;
+    TNode<Object> tmp8;
+    ca_.Bind(&block4, &tmp7, &tmp8);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp9;
+    TNode<Object> tmp10;
+    ca_.Bind(&block3, &tmp9, &tmp10);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3002);
+    TNode<Object> tmp11;
+    USE(tmp11);
+    tmp11 = (TNode<Object>{tmp10});
+    ca_.Goto(&block1, tmp9, tmp10, tmp11);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp12;
+    TNode<Object> tmp13;
+    TNode<Object> tmp14;
+    ca_.Bind(&block1, &tmp12, &tmp13, &tmp14);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 40);
+    ca_.Goto(&block6, tmp12, tmp13, tmp14);
+  }
+
+    TNode<Context> tmp15;
+    TNode<Object> tmp16;
+    TNode<Object> tmp17;
+    ca_.Bind(&block6, &tmp15, &tmp16, &tmp17);
+  return TNode<Object>{tmp17};
+}
+
+TNode<FixedDoubleArray> UnsafeCast16FixedDoubleArray_1374(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block5(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, FixedDoubleArray> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, FixedDoubleArray> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3001);
+    ca_.Goto(&block3, tmp0, tmp1);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp2;
+    TNode<Object> tmp3;
+    ca_.Bind(&block2, &tmp2, &tmp3);
+    TNode<BoolT> tmp4;
+    USE(tmp4);
+    tmp4 = Is16FixedDoubleArray20UT5ATSmi10HeapObject_1463(state_, TNode<Context>{tmp2}, TNode<Object>{tmp3});
+    ca_.Branch(tmp4, &block4, &block5, tmp2, tmp3);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp5;
+    TNode<Object> tmp6;
+    ca_.Bind(&block5, &tmp5, &tmp6);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'Is<A>(o)' failed", "../../deps/v8/src/builtins/base.tq", 3001);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp7;
+    TNode<Object> tmp8;
+    ca_.Bind(&block4, &tmp7, &tmp8);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp9;
+    TNode<Object> tmp10;
+    ca_.Bind(&block3, &tmp9, &tmp10);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3002);
+    TNode<FixedDoubleArray> tmp11;
+    USE(tmp11);
+    tmp11 = TORQUE_CAST(TNode<Object>{tmp10});
+    ca_.Goto(&block1, tmp9, tmp10, tmp11);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp12;
+    TNode<Object> tmp13;
+    TNode<FixedDoubleArray> tmp14;
+    ca_.Bind(&block1, &tmp12, &tmp13, &tmp14);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 47);
+    ca_.Goto(&block6, tmp12, tmp13, tmp14);
+  }
+
+    TNode<Context> tmp15;
+    TNode<Object> tmp16;
+    TNode<FixedDoubleArray> tmp17;
+    ca_.Bind(&block6, &tmp15, &tmp16, &tmp17);
+  return TNode<FixedDoubleArray>{tmp17};
+}
+
+TF_BUILTIN(LoadJoinElement25ATGenericElementsAccessor, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<JSReceiver> parameter1 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<0>()));
+  USE(parameter1);
+  TNode<Number> parameter2 = UncheckedCast<Number>(Parameter(Descriptor::ParameterIndex<1>()));
+  USE(parameter2);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<Number> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 16);
+    TNode<Object> tmp3;
+    USE(tmp3);
+    tmp3 = CodeStubAssembler(state_).GetProperty(TNode<Context>{tmp0}, TNode<Object>{tmp1}, TNode<Object>{tmp2});
+    CodeStubAssembler(state_).Return(tmp3);
+  }
+}
+
+TNode<JSTypedArray> UnsafeCast12JSTypedArray_1375(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block5(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSTypedArray> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSTypedArray> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3001);
+    ca_.Goto(&block3, tmp0, tmp1);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp2;
+    TNode<Object> tmp3;
+    ca_.Bind(&block2, &tmp2, &tmp3);
+    TNode<BoolT> tmp4;
+    USE(tmp4);
+    tmp4 = Is12JSTypedArray20UT5ATSmi10HeapObject_1464(state_, TNode<Context>{tmp2}, TNode<Object>{tmp3});
+    ca_.Branch(tmp4, &block4, &block5, tmp2, tmp3);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp5;
+    TNode<Object> tmp6;
+    ca_.Bind(&block5, &tmp5, &tmp6);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'Is<A>(o)' failed", "../../deps/v8/src/builtins/base.tq", 3001);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp7;
+    TNode<Object> tmp8;
+    ca_.Bind(&block4, &tmp7, &tmp8);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp9;
+    TNode<Object> tmp10;
+    ca_.Bind(&block3, &tmp9, &tmp10);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3002);
+    TNode<JSTypedArray> tmp11;
+    USE(tmp11);
+    tmp11 = TORQUE_CAST(TNode<Object>{tmp10});
+    ca_.Goto(&block1, tmp9, tmp10, tmp11);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp12;
+    TNode<Object> tmp13;
+    TNode<JSTypedArray> tmp14;
+    ca_.Bind(&block1, &tmp12, &tmp13, &tmp14);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 106);
+    ca_.Goto(&block6, tmp12, tmp13, tmp14);
+  }
+
+    TNode<Context> tmp15;
+    TNode<Object> tmp16;
+    TNode<JSTypedArray> tmp17;
+    ca_.Bind(&block6, &tmp15, &tmp16, &tmp17);
+  return TNode<JSTypedArray>{tmp17};
+}
+
+TNode<String> Cast6String_1377(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o, compiler::CodeAssemblerLabel* label_CastError) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, HeapObject> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, HeapObject> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, HeapObject, String> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, String> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, String> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 2215);
+    TNode<HeapObject> tmp2;
+    USE(tmp2);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp2 = CodeStubAssembler(state_).TaggedToHeapObject(TNode<Object>{tmp1}, &label0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp1, tmp2);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block4, tmp0, tmp1, tmp1);
+    }
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    ca_.Bind(&block4, &tmp3, &tmp4, &tmp5);
+    ca_.Goto(&block1);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp6;
+    TNode<Object> tmp7;
+    TNode<Object> tmp8;
+    TNode<HeapObject> tmp9;
+    ca_.Bind(&block3, &tmp6, &tmp7, &tmp8, &tmp9);
+    TNode<String> tmp10;
+    USE(tmp10);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp10 = Cast6String_120(state_, TNode<HeapObject>{tmp9}, &label0);
+    ca_.Goto(&block5, tmp6, tmp7, tmp9, tmp10);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block6, tmp6, tmp7, tmp9);
+    }
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp11;
+    TNode<Object> tmp12;
+    TNode<HeapObject> tmp13;
+    ca_.Bind(&block6, &tmp11, &tmp12, &tmp13);
+    ca_.Goto(&block1);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp14;
+    TNode<Object> tmp15;
+    TNode<HeapObject> tmp16;
+    TNode<String> tmp17;
+    ca_.Bind(&block5, &tmp14, &tmp15, &tmp16, &tmp17);
+    ca_.Goto(&block2, tmp14, tmp15, tmp17);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp18;
+    TNode<Object> tmp19;
+    TNode<String> tmp20;
+    ca_.Bind(&block2, &tmp18, &tmp19, &tmp20);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 236);
+    ca_.Goto(&block7, tmp18, tmp19, tmp20);
+  }
+
+  if (block1.is_used()) {
+    ca_.Bind(&block1);
+    ca_.Goto(label_CastError);
+  }
+
+    TNode<Context> tmp21;
+    TNode<Object> tmp22;
+    TNode<String> tmp23;
+    ca_.Bind(&block7, &tmp21, &tmp22, &tmp23);
+  return TNode<String>{tmp23};
+}
+
+TNode<String> ArrayJoinImpl7JSArray_1378(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<JSReceiver> p_receiver, TNode<String> p_sep, TNode<Number> p_lengthNumber, bool p_useToLocaleString, TNode<Object> p_locales, TNode<Object> p_options, TNode<BuiltinPtr> p_initialLoadFn) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT> block5(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, Object, Object> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, Object, Object, String> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, Object, String> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, Object, String> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, Object> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, Object, Object> block23(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, Object, Object, Number> block22(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, Object> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, Object, Object> block24(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, Object, Object> block25(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, Object> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, Object> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, String, IntPtrT, IntPtrT, Context, String, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT, BoolT, Context, IntPtrT, IntPtrT, BoolT, BoolT> block30(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, String, IntPtrT, IntPtrT, Context, String, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT, BoolT, Context, IntPtrT, IntPtrT, BoolT, BoolT> block31(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, String, IntPtrT, IntPtrT, Context, String, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT, BoolT, Context, IntPtrT, IntPtrT, BoolT, BoolT, BoolT> block32(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, String, IntPtrT, IntPtrT, Context, String, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT, BoolT, Context, IntPtrT, IntPtrT, BoolT> block28(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, String, IntPtrT, IntPtrT, Context, String, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT, BoolT, Context, IntPtrT, IntPtrT, BoolT> block29(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, String, IntPtrT, IntPtrT, Context, String, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT, BoolT, Context, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT> block33(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, String, IntPtrT, IntPtrT, Context, String, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT, BoolT, Context, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT> block34(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, String, IntPtrT, IntPtrT, Context, String, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT, BoolT, Context, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT> block35(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, String, IntPtrT, IntPtrT, Context, String, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT, BoolT, Context, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT> block36(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, String, IntPtrT, IntPtrT, Context, String, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT, BoolT, Context, IntPtrT, IntPtrT, BoolT> block27(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, String, IntPtrT, IntPtrT, Context, String, IntPtrT, IntPtrT> block26(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, IntPtrT, IntPtrT, Context, IntPtrT, IntPtrT, BoolT, BoolT> block40(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, IntPtrT, IntPtrT, Context, IntPtrT, IntPtrT, BoolT, BoolT> block41(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, IntPtrT, IntPtrT, Context, IntPtrT, IntPtrT, BoolT, BoolT, BoolT> block42(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, IntPtrT, IntPtrT, Context, IntPtrT, IntPtrT, BoolT> block38(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, IntPtrT, IntPtrT, Context, IntPtrT, IntPtrT, BoolT> block39(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, IntPtrT, IntPtrT, Context, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT> block43(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, IntPtrT, IntPtrT, Context, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT> block44(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, IntPtrT, IntPtrT, Context, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT> block45(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, IntPtrT, IntPtrT, Context, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT> block46(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, IntPtrT, IntPtrT, Context, IntPtrT, IntPtrT, BoolT> block37(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, String> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, String> block47(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_receiver, p_sep, p_lengthNumber, p_locales, p_options, p_initialLoadFn);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<String> tmp2;
+    TNode<Number> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    TNode<BuiltinPtr> tmp6;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4, &tmp5, &tmp6);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 262);
+    TNode<IntPtrT> tmp7 = ca_.IntPtrConstant(HeapObject::kMapOffset);
+    USE(tmp7);
+    TNode<Map>tmp8 = CodeStubAssembler(state_).LoadReference<Map>(CodeStubAssembler::Reference{tmp1, tmp7});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 263);
+    TNode<UintPtrT> tmp9;
+    USE(tmp9);
+    tmp9 = Convert9ATuintptr20UT5ATSmi10HeapNumber_198(state_, TNode<Number>{tmp3});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 264);
+    TNode<IntPtrT> tmp10;
+    USE(tmp10);
+    tmp10 = CodeStubAssembler(state_).LoadStringLengthAsWord(TNode<String>{tmp2});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 265);
+    TNode<IntPtrT> tmp11;
+    USE(tmp11);
+    tmp11 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 266);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 267);
+    TNode<FixedArray> tmp12;
+    USE(tmp12);
+    TNode<IntPtrT> tmp13;
+    USE(tmp13);
+    TNode<IntPtrT> tmp14;
+    USE(tmp14);
+    TNode<BoolT> tmp15;
+    USE(tmp15);
+    std::tie(tmp12, tmp13, tmp14, tmp15) = NewBuffer_11(state_, TNode<UintPtrT>{tmp9}, TNode<String>{tmp2}).Flatten();
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 270);
+    TNode<UintPtrT> tmp16;
+    USE(tmp16);
+    tmp16 = FromConstexpr9ATuintptr17ATconstexpr_int31_165(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 273);
+    ca_.Goto(&block4, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp8, tmp9, tmp10, tmp11, tmp6, tmp12, tmp13, tmp14, tmp15, tmp16);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp17;
+    TNode<JSReceiver> tmp18;
+    TNode<String> tmp19;
+    TNode<Number> tmp20;
+    TNode<Object> tmp21;
+    TNode<Object> tmp22;
+    TNode<BuiltinPtr> tmp23;
+    TNode<Map> tmp24;
+    TNode<UintPtrT> tmp25;
+    TNode<IntPtrT> tmp26;
+    TNode<IntPtrT> tmp27;
+    TNode<BuiltinPtr> tmp28;
+    TNode<FixedArray> tmp29;
+    TNode<IntPtrT> tmp30;
+    TNode<IntPtrT> tmp31;
+    TNode<BoolT> tmp32;
+    TNode<UintPtrT> tmp33;
+    ca_.Bind(&block4, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33);
+    TNode<BoolT> tmp34;
+    USE(tmp34);
+    tmp34 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp33}, TNode<UintPtrT>{tmp25});
+    ca_.Branch(tmp34, &block2, &block3, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27, tmp28, tmp29, tmp30, tmp31, tmp32, tmp33);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp35;
+    TNode<JSReceiver> tmp36;
+    TNode<String> tmp37;
+    TNode<Number> tmp38;
+    TNode<Object> tmp39;
+    TNode<Object> tmp40;
+    TNode<BuiltinPtr> tmp41;
+    TNode<Map> tmp42;
+    TNode<UintPtrT> tmp43;
+    TNode<IntPtrT> tmp44;
+    TNode<IntPtrT> tmp45;
+    TNode<BuiltinPtr> tmp46;
+    TNode<FixedArray> tmp47;
+    TNode<IntPtrT> tmp48;
+    TNode<IntPtrT> tmp49;
+    TNode<BoolT> tmp50;
+    TNode<UintPtrT> tmp51;
+    ca_.Bind(&block2, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 275);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 274);
+    TNode<BoolT> tmp52;
+    USE(tmp52);
+    tmp52 = CannotUseSameArrayAccessor7JSArray_8(state_, TNode<Context>{tmp35}, TNode<BuiltinPtr>{tmp46}, TNode<JSReceiver>{tmp36}, TNode<Map>{tmp42}, TNode<Number>{tmp38});
+    ca_.Branch(tmp52, &block5, &block6, tmp35, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42, tmp43, tmp44, tmp45, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp53;
+    TNode<JSReceiver> tmp54;
+    TNode<String> tmp55;
+    TNode<Number> tmp56;
+    TNode<Object> tmp57;
+    TNode<Object> tmp58;
+    TNode<BuiltinPtr> tmp59;
+    TNode<Map> tmp60;
+    TNode<UintPtrT> tmp61;
+    TNode<IntPtrT> tmp62;
+    TNode<IntPtrT> tmp63;
+    TNode<BuiltinPtr> tmp64;
+    TNode<FixedArray> tmp65;
+    TNode<IntPtrT> tmp66;
+    TNode<IntPtrT> tmp67;
+    TNode<BoolT> tmp68;
+    TNode<UintPtrT> tmp69;
+    ca_.Bind(&block5, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 277);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 274);
+    ca_.Goto(&block6, tmp53, tmp54, tmp55, tmp56, tmp57, tmp58, tmp59, tmp60, tmp61, tmp62, tmp63, ca_.UncheckedCast<BuiltinPtr>(ca_.SmiConstant(Builtins::kLoadJoinElement25ATGenericElementsAccessor)), tmp65, tmp66, tmp67, tmp68, tmp69);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp70;
+    TNode<JSReceiver> tmp71;
+    TNode<String> tmp72;
+    TNode<Number> tmp73;
+    TNode<Object> tmp74;
+    TNode<Object> tmp75;
+    TNode<BuiltinPtr> tmp76;
+    TNode<Map> tmp77;
+    TNode<UintPtrT> tmp78;
+    TNode<IntPtrT> tmp79;
+    TNode<IntPtrT> tmp80;
+    TNode<BuiltinPtr> tmp81;
+    TNode<FixedArray> tmp82;
+    TNode<IntPtrT> tmp83;
+    TNode<IntPtrT> tmp84;
+    TNode<BoolT> tmp85;
+    TNode<UintPtrT> tmp86;
+    ca_.Bind(&block6, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 280);
+    TNode<UintPtrT> tmp87;
+    USE(tmp87);
+    tmp87 = FromConstexpr9ATuintptr17ATconstexpr_int31_165(state_, 0);
+    TNode<BoolT> tmp88;
+    USE(tmp88);
+    tmp88 = CodeStubAssembler(state_).UintPtrGreaterThan(TNode<UintPtrT>{tmp86}, TNode<UintPtrT>{tmp87});
+    ca_.Branch(tmp88, &block7, &block8, tmp70, tmp71, tmp72, tmp73, tmp74, tmp75, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, tmp83, tmp84, tmp85, tmp86);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp89;
+    TNode<JSReceiver> tmp90;
+    TNode<String> tmp91;
+    TNode<Number> tmp92;
+    TNode<Object> tmp93;
+    TNode<Object> tmp94;
+    TNode<BuiltinPtr> tmp95;
+    TNode<Map> tmp96;
+    TNode<UintPtrT> tmp97;
+    TNode<IntPtrT> tmp98;
+    TNode<IntPtrT> tmp99;
+    TNode<BuiltinPtr> tmp100;
+    TNode<FixedArray> tmp101;
+    TNode<IntPtrT> tmp102;
+    TNode<IntPtrT> tmp103;
+    TNode<BoolT> tmp104;
+    TNode<UintPtrT> tmp105;
+    ca_.Bind(&block7, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104, &tmp105);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 282);
+    TNode<IntPtrT> tmp106;
+    USE(tmp106);
+    tmp106 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<IntPtrT> tmp107;
+    USE(tmp107);
+    tmp107 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp99}, TNode<IntPtrT>{tmp106});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 280);
+    ca_.Goto(&block8, tmp89, tmp90, tmp91, tmp92, tmp93, tmp94, tmp95, tmp96, tmp97, tmp98, tmp107, tmp100, tmp101, tmp102, tmp103, tmp104, tmp105);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp108;
+    TNode<JSReceiver> tmp109;
+    TNode<String> tmp110;
+    TNode<Number> tmp111;
+    TNode<Object> tmp112;
+    TNode<Object> tmp113;
+    TNode<BuiltinPtr> tmp114;
+    TNode<Map> tmp115;
+    TNode<UintPtrT> tmp116;
+    TNode<IntPtrT> tmp117;
+    TNode<IntPtrT> tmp118;
+    TNode<BuiltinPtr> tmp119;
+    TNode<FixedArray> tmp120;
+    TNode<IntPtrT> tmp121;
+    TNode<IntPtrT> tmp122;
+    TNode<BoolT> tmp123;
+    TNode<UintPtrT> tmp124;
+    ca_.Bind(&block8, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115, &tmp116, &tmp117, &tmp118, &tmp119, &tmp120, &tmp121, &tmp122, &tmp123, &tmp124);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 286);
+    TNode<UintPtrT> tmp125;
+    USE(tmp125);
+    tmp125 = FromConstexpr9ATuintptr17ATconstexpr_int31_165(state_, 1);
+    TNode<UintPtrT> tmp126;
+    USE(tmp126);
+    tmp126 = CodeStubAssembler(state_).UintPtrAdd(TNode<UintPtrT>{tmp124}, TNode<UintPtrT>{tmp125});
+    TNode<Number> tmp127;
+    USE(tmp127);
+    tmp127 = Convert20UT5ATSmi10HeapNumber9ATuintptr_204(state_, TNode<UintPtrT>{tmp124});
+    TNode<Object> tmp128 = CodeStubAssembler(state_).CallBuiltinPointer(Builtins::CallableFor(ca_.isolate(),ExampleBuiltinForTorqueFunctionPointerType(0)).descriptor(), tmp119, tmp108, tmp109, tmp127); 
+    USE(tmp128);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 290);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 291);
+    if ((p_useToLocaleString)) {
+      ca_.Goto(&block9, tmp108, tmp109, tmp110, tmp111, tmp112, tmp113, tmp114, tmp115, tmp116, tmp117, tmp118, tmp119, tmp120, tmp121, tmp122, tmp123, tmp126, tmp128, ca_.Uninitialized<String>());
+    } else {
+      ca_.Goto(&block10, tmp108, tmp109, tmp110, tmp111, tmp112, tmp113, tmp114, tmp115, tmp116, tmp117, tmp118, tmp119, tmp120, tmp121, tmp122, tmp123, tmp126, tmp128, ca_.Uninitialized<String>());
+    }
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp129;
+    TNode<JSReceiver> tmp130;
+    TNode<String> tmp131;
+    TNode<Number> tmp132;
+    TNode<Object> tmp133;
+    TNode<Object> tmp134;
+    TNode<BuiltinPtr> tmp135;
+    TNode<Map> tmp136;
+    TNode<UintPtrT> tmp137;
+    TNode<IntPtrT> tmp138;
+    TNode<IntPtrT> tmp139;
+    TNode<BuiltinPtr> tmp140;
+    TNode<FixedArray> tmp141;
+    TNode<IntPtrT> tmp142;
+    TNode<IntPtrT> tmp143;
+    TNode<BoolT> tmp144;
+    TNode<UintPtrT> tmp145;
+    TNode<Object> tmp146;
+    TNode<String> tmp147;
+    ca_.Bind(&block9, &tmp129, &tmp130, &tmp131, &tmp132, &tmp133, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138, &tmp139, &tmp140, &tmp141, &tmp142, &tmp143, &tmp144, &tmp145, &tmp146, &tmp147);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 292);
+    TNode<String> tmp148;
+    tmp148 = TORQUE_CAST(CodeStubAssembler(state_).CallBuiltin(Builtins::kConvertToLocaleString, tmp129, tmp146, tmp133, tmp134));
+    USE(tmp148);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 293);
+    TNode<String> tmp149;
+    USE(tmp149);
+    tmp149 = kEmptyString_67(state_);
+    TNode<BoolT> tmp150;
+    USE(tmp150);
+    tmp150 = CodeStubAssembler(state_).TaggedEqual(TNode<Object>{tmp148}, TNode<HeapObject>{tmp149});
+    ca_.Branch(tmp150, &block12, &block13, tmp129, tmp130, tmp131, tmp132, tmp133, tmp134, tmp135, tmp136, tmp137, tmp138, tmp139, tmp140, tmp141, tmp142, tmp143, tmp144, tmp145, tmp146, tmp148);
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp151;
+    TNode<JSReceiver> tmp152;
+    TNode<String> tmp153;
+    TNode<Number> tmp154;
+    TNode<Object> tmp155;
+    TNode<Object> tmp156;
+    TNode<BuiltinPtr> tmp157;
+    TNode<Map> tmp158;
+    TNode<UintPtrT> tmp159;
+    TNode<IntPtrT> tmp160;
+    TNode<IntPtrT> tmp161;
+    TNode<BuiltinPtr> tmp162;
+    TNode<FixedArray> tmp163;
+    TNode<IntPtrT> tmp164;
+    TNode<IntPtrT> tmp165;
+    TNode<BoolT> tmp166;
+    TNode<UintPtrT> tmp167;
+    TNode<Object> tmp168;
+    TNode<String> tmp169;
+    ca_.Bind(&block12, &tmp151, &tmp152, &tmp153, &tmp154, &tmp155, &tmp156, &tmp157, &tmp158, &tmp159, &tmp160, &tmp161, &tmp162, &tmp163, &tmp164, &tmp165, &tmp166, &tmp167, &tmp168, &tmp169);
+    ca_.Goto(&block4, tmp151, tmp152, tmp153, tmp154, tmp155, tmp156, tmp157, tmp158, tmp159, tmp160, tmp161, tmp162, tmp163, tmp164, tmp165, tmp166, tmp167);
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp170;
+    TNode<JSReceiver> tmp171;
+    TNode<String> tmp172;
+    TNode<Number> tmp173;
+    TNode<Object> tmp174;
+    TNode<Object> tmp175;
+    TNode<BuiltinPtr> tmp176;
+    TNode<Map> tmp177;
+    TNode<UintPtrT> tmp178;
+    TNode<IntPtrT> tmp179;
+    TNode<IntPtrT> tmp180;
+    TNode<BuiltinPtr> tmp181;
+    TNode<FixedArray> tmp182;
+    TNode<IntPtrT> tmp183;
+    TNode<IntPtrT> tmp184;
+    TNode<BoolT> tmp185;
+    TNode<UintPtrT> tmp186;
+    TNode<Object> tmp187;
+    TNode<String> tmp188;
+    ca_.Bind(&block13, &tmp170, &tmp171, &tmp172, &tmp173, &tmp174, &tmp175, &tmp176, &tmp177, &tmp178, &tmp179, &tmp180, &tmp181, &tmp182, &tmp183, &tmp184, &tmp185, &tmp186, &tmp187, &tmp188);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 291);
+    ca_.Goto(&block11, tmp170, tmp171, tmp172, tmp173, tmp174, tmp175, tmp176, tmp177, tmp178, tmp179, tmp180, tmp181, tmp182, tmp183, tmp184, tmp185, tmp186, tmp187, tmp188);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp189;
+    TNode<JSReceiver> tmp190;
+    TNode<String> tmp191;
+    TNode<Number> tmp192;
+    TNode<Object> tmp193;
+    TNode<Object> tmp194;
+    TNode<BuiltinPtr> tmp195;
+    TNode<Map> tmp196;
+    TNode<UintPtrT> tmp197;
+    TNode<IntPtrT> tmp198;
+    TNode<IntPtrT> tmp199;
+    TNode<BuiltinPtr> tmp200;
+    TNode<FixedArray> tmp201;
+    TNode<IntPtrT> tmp202;
+    TNode<IntPtrT> tmp203;
+    TNode<BoolT> tmp204;
+    TNode<UintPtrT> tmp205;
+    TNode<Object> tmp206;
+    TNode<String> tmp207;
+    ca_.Bind(&block10, &tmp189, &tmp190, &tmp191, &tmp192, &tmp193, &tmp194, &tmp195, &tmp196, &tmp197, &tmp198, &tmp199, &tmp200, &tmp201, &tmp202, &tmp203, &tmp204, &tmp205, &tmp206, &tmp207);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 295);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 296);
+    TNode<String> tmp208;
+    USE(tmp208);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp208 = Cast6String_1377(state_, TNode<Context>{tmp189}, TNode<Object>{tmp206}, &label0);
+    ca_.Goto(&block16, tmp189, tmp190, tmp191, tmp192, tmp193, tmp194, tmp195, tmp196, tmp197, tmp198, tmp199, tmp200, tmp201, tmp202, tmp203, tmp204, tmp205, tmp206, tmp207, tmp206, tmp206, tmp208);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block17, tmp189, tmp190, tmp191, tmp192, tmp193, tmp194, tmp195, tmp196, tmp197, tmp198, tmp199, tmp200, tmp201, tmp202, tmp203, tmp204, tmp205, tmp206, tmp207, tmp206, tmp206);
+    }
+  }
+
+  if (block17.is_used()) {
+    TNode<Context> tmp209;
+    TNode<JSReceiver> tmp210;
+    TNode<String> tmp211;
+    TNode<Number> tmp212;
+    TNode<Object> tmp213;
+    TNode<Object> tmp214;
+    TNode<BuiltinPtr> tmp215;
+    TNode<Map> tmp216;
+    TNode<UintPtrT> tmp217;
+    TNode<IntPtrT> tmp218;
+    TNode<IntPtrT> tmp219;
+    TNode<BuiltinPtr> tmp220;
+    TNode<FixedArray> tmp221;
+    TNode<IntPtrT> tmp222;
+    TNode<IntPtrT> tmp223;
+    TNode<BoolT> tmp224;
+    TNode<UintPtrT> tmp225;
+    TNode<Object> tmp226;
+    TNode<String> tmp227;
+    TNode<Object> tmp228;
+    TNode<Object> tmp229;
+    ca_.Bind(&block17, &tmp209, &tmp210, &tmp211, &tmp212, &tmp213, &tmp214, &tmp215, &tmp216, &tmp217, &tmp218, &tmp219, &tmp220, &tmp221, &tmp222, &tmp223, &tmp224, &tmp225, &tmp226, &tmp227, &tmp228, &tmp229);
+    ca_.Goto(&block15, tmp209, tmp210, tmp211, tmp212, tmp213, tmp214, tmp215, tmp216, tmp217, tmp218, tmp219, tmp220, tmp221, tmp222, tmp223, tmp224, tmp225, tmp226, tmp227, tmp228);
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp230;
+    TNode<JSReceiver> tmp231;
+    TNode<String> tmp232;
+    TNode<Number> tmp233;
+    TNode<Object> tmp234;
+    TNode<Object> tmp235;
+    TNode<BuiltinPtr> tmp236;
+    TNode<Map> tmp237;
+    TNode<UintPtrT> tmp238;
+    TNode<IntPtrT> tmp239;
+    TNode<IntPtrT> tmp240;
+    TNode<BuiltinPtr> tmp241;
+    TNode<FixedArray> tmp242;
+    TNode<IntPtrT> tmp243;
+    TNode<IntPtrT> tmp244;
+    TNode<BoolT> tmp245;
+    TNode<UintPtrT> tmp246;
+    TNode<Object> tmp247;
+    TNode<String> tmp248;
+    TNode<Object> tmp249;
+    TNode<Object> tmp250;
+    TNode<String> tmp251;
+    ca_.Bind(&block16, &tmp230, &tmp231, &tmp232, &tmp233, &tmp234, &tmp235, &tmp236, &tmp237, &tmp238, &tmp239, &tmp240, &tmp241, &tmp242, &tmp243, &tmp244, &tmp245, &tmp246, &tmp247, &tmp248, &tmp249, &tmp250, &tmp251);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 297);
+    TNode<String> tmp252;
+    USE(tmp252);
+    tmp252 = kEmptyString_67(state_);
+    TNode<BoolT> tmp253;
+    USE(tmp253);
+    tmp253 = CodeStubAssembler(state_).TaggedEqual(TNode<Object>{tmp251}, TNode<HeapObject>{tmp252});
+    ca_.Branch(tmp253, &block18, &block19, tmp230, tmp231, tmp232, tmp233, tmp234, tmp235, tmp236, tmp237, tmp238, tmp239, tmp240, tmp241, tmp242, tmp243, tmp244, tmp245, tmp246, tmp247, tmp248, tmp249, tmp251);
+  }
+
+  if (block18.is_used()) {
+    TNode<Context> tmp254;
+    TNode<JSReceiver> tmp255;
+    TNode<String> tmp256;
+    TNode<Number> tmp257;
+    TNode<Object> tmp258;
+    TNode<Object> tmp259;
+    TNode<BuiltinPtr> tmp260;
+    TNode<Map> tmp261;
+    TNode<UintPtrT> tmp262;
+    TNode<IntPtrT> tmp263;
+    TNode<IntPtrT> tmp264;
+    TNode<BuiltinPtr> tmp265;
+    TNode<FixedArray> tmp266;
+    TNode<IntPtrT> tmp267;
+    TNode<IntPtrT> tmp268;
+    TNode<BoolT> tmp269;
+    TNode<UintPtrT> tmp270;
+    TNode<Object> tmp271;
+    TNode<String> tmp272;
+    TNode<Object> tmp273;
+    TNode<String> tmp274;
+    ca_.Bind(&block18, &tmp254, &tmp255, &tmp256, &tmp257, &tmp258, &tmp259, &tmp260, &tmp261, &tmp262, &tmp263, &tmp264, &tmp265, &tmp266, &tmp267, &tmp268, &tmp269, &tmp270, &tmp271, &tmp272, &tmp273, &tmp274);
+    ca_.Goto(&block4, tmp254, tmp255, tmp256, tmp257, tmp258, tmp259, tmp260, tmp261, tmp262, tmp263, tmp264, tmp265, tmp266, tmp267, tmp268, tmp269, tmp270);
+  }
+
+  if (block19.is_used()) {
+    TNode<Context> tmp275;
+    TNode<JSReceiver> tmp276;
+    TNode<String> tmp277;
+    TNode<Number> tmp278;
+    TNode<Object> tmp279;
+    TNode<Object> tmp280;
+    TNode<BuiltinPtr> tmp281;
+    TNode<Map> tmp282;
+    TNode<UintPtrT> tmp283;
+    TNode<IntPtrT> tmp284;
+    TNode<IntPtrT> tmp285;
+    TNode<BuiltinPtr> tmp286;
+    TNode<FixedArray> tmp287;
+    TNode<IntPtrT> tmp288;
+    TNode<IntPtrT> tmp289;
+    TNode<BoolT> tmp290;
+    TNode<UintPtrT> tmp291;
+    TNode<Object> tmp292;
+    TNode<String> tmp293;
+    TNode<Object> tmp294;
+    TNode<String> tmp295;
+    ca_.Bind(&block19, &tmp275, &tmp276, &tmp277, &tmp278, &tmp279, &tmp280, &tmp281, &tmp282, &tmp283, &tmp284, &tmp285, &tmp286, &tmp287, &tmp288, &tmp289, &tmp290, &tmp291, &tmp292, &tmp293, &tmp294, &tmp295);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 298);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 296);
+    ca_.Goto(&block14, tmp275, tmp276, tmp277, tmp278, tmp279, tmp280, tmp281, tmp282, tmp283, tmp284, tmp285, tmp286, tmp287, tmp288, tmp289, tmp290, tmp291, tmp292, tmp295, tmp294);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp296;
+    TNode<JSReceiver> tmp297;
+    TNode<String> tmp298;
+    TNode<Number> tmp299;
+    TNode<Object> tmp300;
+    TNode<Object> tmp301;
+    TNode<BuiltinPtr> tmp302;
+    TNode<Map> tmp303;
+    TNode<UintPtrT> tmp304;
+    TNode<IntPtrT> tmp305;
+    TNode<IntPtrT> tmp306;
+    TNode<BuiltinPtr> tmp307;
+    TNode<FixedArray> tmp308;
+    TNode<IntPtrT> tmp309;
+    TNode<IntPtrT> tmp310;
+    TNode<BoolT> tmp311;
+    TNode<UintPtrT> tmp312;
+    TNode<Object> tmp313;
+    TNode<String> tmp314;
+    TNode<Object> tmp315;
+    ca_.Bind(&block15, &tmp296, &tmp297, &tmp298, &tmp299, &tmp300, &tmp301, &tmp302, &tmp303, &tmp304, &tmp305, &tmp306, &tmp307, &tmp308, &tmp309, &tmp310, &tmp311, &tmp312, &tmp313, &tmp314, &tmp315);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 300);
+    TNode<Number> tmp316;
+    USE(tmp316);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp316 = Cast20UT5ATSmi10HeapNumber_85(state_, TNode<Object>{ca_.UncheckedCast<Object>(tmp315)}, &label0);
+    ca_.Goto(&block22, tmp296, tmp297, tmp298, tmp299, tmp300, tmp301, tmp302, tmp303, tmp304, tmp305, tmp306, tmp307, tmp308, tmp309, tmp310, tmp311, tmp312, tmp313, tmp314, tmp315, ca_.UncheckedCast<Object>(tmp315), tmp316);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block23, tmp296, tmp297, tmp298, tmp299, tmp300, tmp301, tmp302, tmp303, tmp304, tmp305, tmp306, tmp307, tmp308, tmp309, tmp310, tmp311, tmp312, tmp313, tmp314, tmp315, ca_.UncheckedCast<Object>(tmp315));
+    }
+  }
+
+  if (block23.is_used()) {
+    TNode<Context> tmp317;
+    TNode<JSReceiver> tmp318;
+    TNode<String> tmp319;
+    TNode<Number> tmp320;
+    TNode<Object> tmp321;
+    TNode<Object> tmp322;
+    TNode<BuiltinPtr> tmp323;
+    TNode<Map> tmp324;
+    TNode<UintPtrT> tmp325;
+    TNode<IntPtrT> tmp326;
+    TNode<IntPtrT> tmp327;
+    TNode<BuiltinPtr> tmp328;
+    TNode<FixedArray> tmp329;
+    TNode<IntPtrT> tmp330;
+    TNode<IntPtrT> tmp331;
+    TNode<BoolT> tmp332;
+    TNode<UintPtrT> tmp333;
+    TNode<Object> tmp334;
+    TNode<String> tmp335;
+    TNode<Object> tmp336;
+    TNode<Object> tmp337;
+    ca_.Bind(&block23, &tmp317, &tmp318, &tmp319, &tmp320, &tmp321, &tmp322, &tmp323, &tmp324, &tmp325, &tmp326, &tmp327, &tmp328, &tmp329, &tmp330, &tmp331, &tmp332, &tmp333, &tmp334, &tmp335, &tmp336, &tmp337);
+    ca_.Goto(&block21, tmp317, tmp318, tmp319, tmp320, tmp321, tmp322, tmp323, tmp324, tmp325, tmp326, tmp327, tmp328, tmp329, tmp330, tmp331, tmp332, tmp333, tmp334, tmp335, tmp336);
+  }
+
+  if (block22.is_used()) {
+    TNode<Context> tmp338;
+    TNode<JSReceiver> tmp339;
+    TNode<String> tmp340;
+    TNode<Number> tmp341;
+    TNode<Object> tmp342;
+    TNode<Object> tmp343;
+    TNode<BuiltinPtr> tmp344;
+    TNode<Map> tmp345;
+    TNode<UintPtrT> tmp346;
+    TNode<IntPtrT> tmp347;
+    TNode<IntPtrT> tmp348;
+    TNode<BuiltinPtr> tmp349;
+    TNode<FixedArray> tmp350;
+    TNode<IntPtrT> tmp351;
+    TNode<IntPtrT> tmp352;
+    TNode<BoolT> tmp353;
+    TNode<UintPtrT> tmp354;
+    TNode<Object> tmp355;
+    TNode<String> tmp356;
+    TNode<Object> tmp357;
+    TNode<Object> tmp358;
+    TNode<Number> tmp359;
+    ca_.Bind(&block22, &tmp338, &tmp339, &tmp340, &tmp341, &tmp342, &tmp343, &tmp344, &tmp345, &tmp346, &tmp347, &tmp348, &tmp349, &tmp350, &tmp351, &tmp352, &tmp353, &tmp354, &tmp355, &tmp356, &tmp357, &tmp358, &tmp359);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 301);
+    TNode<String> tmp360;
+    USE(tmp360);
+    tmp360 = CodeStubAssembler(state_).NumberToString(TNode<Number>{tmp359});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 300);
+    ca_.Goto(&block20, tmp338, tmp339, tmp340, tmp341, tmp342, tmp343, tmp344, tmp345, tmp346, tmp347, tmp348, tmp349, tmp350, tmp351, tmp352, tmp353, tmp354, tmp355, tmp360, tmp357);
+  }
+
+  if (block21.is_used()) {
+    TNode<Context> tmp361;
+    TNode<JSReceiver> tmp362;
+    TNode<String> tmp363;
+    TNode<Number> tmp364;
+    TNode<Object> tmp365;
+    TNode<Object> tmp366;
+    TNode<BuiltinPtr> tmp367;
+    TNode<Map> tmp368;
+    TNode<UintPtrT> tmp369;
+    TNode<IntPtrT> tmp370;
+    TNode<IntPtrT> tmp371;
+    TNode<BuiltinPtr> tmp372;
+    TNode<FixedArray> tmp373;
+    TNode<IntPtrT> tmp374;
+    TNode<IntPtrT> tmp375;
+    TNode<BoolT> tmp376;
+    TNode<UintPtrT> tmp377;
+    TNode<Object> tmp378;
+    TNode<String> tmp379;
+    TNode<Object> tmp380;
+    ca_.Bind(&block21, &tmp361, &tmp362, &tmp363, &tmp364, &tmp365, &tmp366, &tmp367, &tmp368, &tmp369, &tmp370, &tmp371, &tmp372, &tmp373, &tmp374, &tmp375, &tmp376, &tmp377, &tmp378, &tmp379, &tmp380);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 303);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 304);
+    TNode<BoolT> tmp381;
+    USE(tmp381);
+    tmp381 = CodeStubAssembler(state_).IsNullOrUndefined(TNode<Object>{ca_.UncheckedCast<HeapObject>(tmp380)});
+    ca_.Branch(tmp381, &block24, &block25, tmp361, tmp362, tmp363, tmp364, tmp365, tmp366, tmp367, tmp368, tmp369, tmp370, tmp371, tmp372, tmp373, tmp374, tmp375, tmp376, tmp377, tmp378, tmp379, tmp380, ca_.UncheckedCast<HeapObject>(tmp380));
+  }
+
+  if (block24.is_used()) {
+    TNode<Context> tmp382;
+    TNode<JSReceiver> tmp383;
+    TNode<String> tmp384;
+    TNode<Number> tmp385;
+    TNode<Object> tmp386;
+    TNode<Object> tmp387;
+    TNode<BuiltinPtr> tmp388;
+    TNode<Map> tmp389;
+    TNode<UintPtrT> tmp390;
+    TNode<IntPtrT> tmp391;
+    TNode<IntPtrT> tmp392;
+    TNode<BuiltinPtr> tmp393;
+    TNode<FixedArray> tmp394;
+    TNode<IntPtrT> tmp395;
+    TNode<IntPtrT> tmp396;
+    TNode<BoolT> tmp397;
+    TNode<UintPtrT> tmp398;
+    TNode<Object> tmp399;
+    TNode<String> tmp400;
+    TNode<Object> tmp401;
+    TNode<Object> tmp402;
+    ca_.Bind(&block24, &tmp382, &tmp383, &tmp384, &tmp385, &tmp386, &tmp387, &tmp388, &tmp389, &tmp390, &tmp391, &tmp392, &tmp393, &tmp394, &tmp395, &tmp396, &tmp397, &tmp398, &tmp399, &tmp400, &tmp401, &tmp402);
+    ca_.Goto(&block4, tmp382, tmp383, tmp384, tmp385, tmp386, tmp387, tmp388, tmp389, tmp390, tmp391, tmp392, tmp393, tmp394, tmp395, tmp396, tmp397, tmp398);
+  }
+
+  if (block25.is_used()) {
+    TNode<Context> tmp403;
+    TNode<JSReceiver> tmp404;
+    TNode<String> tmp405;
+    TNode<Number> tmp406;
+    TNode<Object> tmp407;
+    TNode<Object> tmp408;
+    TNode<BuiltinPtr> tmp409;
+    TNode<Map> tmp410;
+    TNode<UintPtrT> tmp411;
+    TNode<IntPtrT> tmp412;
+    TNode<IntPtrT> tmp413;
+    TNode<BuiltinPtr> tmp414;
+    TNode<FixedArray> tmp415;
+    TNode<IntPtrT> tmp416;
+    TNode<IntPtrT> tmp417;
+    TNode<BoolT> tmp418;
+    TNode<UintPtrT> tmp419;
+    TNode<Object> tmp420;
+    TNode<String> tmp421;
+    TNode<Object> tmp422;
+    TNode<Object> tmp423;
+    ca_.Bind(&block25, &tmp403, &tmp404, &tmp405, &tmp406, &tmp407, &tmp408, &tmp409, &tmp410, &tmp411, &tmp412, &tmp413, &tmp414, &tmp415, &tmp416, &tmp417, &tmp418, &tmp419, &tmp420, &tmp421, &tmp422, &tmp423);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 305);
+    TNode<String> tmp424;
+    tmp424 = TORQUE_CAST(CodeStubAssembler(state_).CallBuiltin(Builtins::kToString, tmp403, tmp423));
+    USE(tmp424);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 300);
+    ca_.Goto(&block20, tmp403, tmp404, tmp405, tmp406, tmp407, tmp408, tmp409, tmp410, tmp411, tmp412, tmp413, tmp414, tmp415, tmp416, tmp417, tmp418, tmp419, tmp420, tmp424, tmp422);
+  }
+
+  if (block20.is_used()) {
+    TNode<Context> tmp425;
+    TNode<JSReceiver> tmp426;
+    TNode<String> tmp427;
+    TNode<Number> tmp428;
+    TNode<Object> tmp429;
+    TNode<Object> tmp430;
+    TNode<BuiltinPtr> tmp431;
+    TNode<Map> tmp432;
+    TNode<UintPtrT> tmp433;
+    TNode<IntPtrT> tmp434;
+    TNode<IntPtrT> tmp435;
+    TNode<BuiltinPtr> tmp436;
+    TNode<FixedArray> tmp437;
+    TNode<IntPtrT> tmp438;
+    TNode<IntPtrT> tmp439;
+    TNode<BoolT> tmp440;
+    TNode<UintPtrT> tmp441;
+    TNode<Object> tmp442;
+    TNode<String> tmp443;
+    TNode<Object> tmp444;
+    ca_.Bind(&block20, &tmp425, &tmp426, &tmp427, &tmp428, &tmp429, &tmp430, &tmp431, &tmp432, &tmp433, &tmp434, &tmp435, &tmp436, &tmp437, &tmp438, &tmp439, &tmp440, &tmp441, &tmp442, &tmp443, &tmp444);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 296);
+    ca_.Goto(&block14, tmp425, tmp426, tmp427, tmp428, tmp429, tmp430, tmp431, tmp432, tmp433, tmp434, tmp435, tmp436, tmp437, tmp438, tmp439, tmp440, tmp441, tmp442, tmp443, tmp444);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp445;
+    TNode<JSReceiver> tmp446;
+    TNode<String> tmp447;
+    TNode<Number> tmp448;
+    TNode<Object> tmp449;
+    TNode<Object> tmp450;
+    TNode<BuiltinPtr> tmp451;
+    TNode<Map> tmp452;
+    TNode<UintPtrT> tmp453;
+    TNode<IntPtrT> tmp454;
+    TNode<IntPtrT> tmp455;
+    TNode<BuiltinPtr> tmp456;
+    TNode<FixedArray> tmp457;
+    TNode<IntPtrT> tmp458;
+    TNode<IntPtrT> tmp459;
+    TNode<BoolT> tmp460;
+    TNode<UintPtrT> tmp461;
+    TNode<Object> tmp462;
+    TNode<String> tmp463;
+    TNode<Object> tmp464;
+    ca_.Bind(&block14, &tmp445, &tmp446, &tmp447, &tmp448, &tmp449, &tmp450, &tmp451, &tmp452, &tmp453, &tmp454, &tmp455, &tmp456, &tmp457, &tmp458, &tmp459, &tmp460, &tmp461, &tmp462, &tmp463, &tmp464);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 295);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 291);
+    ca_.Goto(&block11, tmp445, tmp446, tmp447, tmp448, tmp449, tmp450, tmp451, tmp452, tmp453, tmp454, tmp455, tmp456, tmp457, tmp458, tmp459, tmp460, tmp461, tmp462, tmp463);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp465;
+    TNode<JSReceiver> tmp466;
+    TNode<String> tmp467;
+    TNode<Number> tmp468;
+    TNode<Object> tmp469;
+    TNode<Object> tmp470;
+    TNode<BuiltinPtr> tmp471;
+    TNode<Map> tmp472;
+    TNode<UintPtrT> tmp473;
+    TNode<IntPtrT> tmp474;
+    TNode<IntPtrT> tmp475;
+    TNode<BuiltinPtr> tmp476;
+    TNode<FixedArray> tmp477;
+    TNode<IntPtrT> tmp478;
+    TNode<IntPtrT> tmp479;
+    TNode<BoolT> tmp480;
+    TNode<UintPtrT> tmp481;
+    TNode<Object> tmp482;
+    TNode<String> tmp483;
+    ca_.Bind(&block11, &tmp465, &tmp466, &tmp467, &tmp468, &tmp469, &tmp470, &tmp471, &tmp472, &tmp473, &tmp474, &tmp475, &tmp476, &tmp477, &tmp478, &tmp479, &tmp480, &tmp481, &tmp482, &tmp483);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 311);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 154);
+    TNode<IntPtrT> tmp484;
+    USE(tmp484);
+    tmp484 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<BoolT> tmp485;
+    USE(tmp485);
+    tmp485 = CodeStubAssembler(state_).WordEqual(TNode<IntPtrT>{tmp478}, TNode<IntPtrT>{tmp484});
+    TNode<IntPtrT> tmp486;
+    USE(tmp486);
+    tmp486 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<BoolT> tmp487;
+    USE(tmp487);
+    tmp487 = CodeStubAssembler(state_).IntPtrGreaterThan(TNode<IntPtrT>{tmp475}, TNode<IntPtrT>{tmp486});
+    TNode<BoolT> tmp488;
+    USE(tmp488);
+    tmp488 = CodeStubAssembler(state_).Word32Or(TNode<BoolT>{tmp485}, TNode<BoolT>{tmp487});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 155);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 167);
+    TNode<IntPtrT> tmp489;
+    USE(tmp489);
+    tmp489 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<BoolT> tmp490;
+    USE(tmp490);
+    tmp490 = CodeStubAssembler(state_).WordEqual(TNode<IntPtrT>{tmp475}, TNode<IntPtrT>{tmp489});
+    ca_.Branch(tmp490, &block30, &block31, tmp465, tmp466, tmp467, tmp468, tmp469, tmp470, tmp471, tmp472, tmp473, tmp474, tmp475, tmp476, tmp477, tmp478, tmp479, tmp480, tmp481, tmp482, tmp483, tmp483, tmp475, tmp474, tmp465, tmp483, tmp475, tmp474, tmp488, tmp475, tmp474, tmp488, tmp465, tmp475, tmp474, tmp488, tmp490);
+  }
+
+  if (block30.is_used()) {
+    TNode<Context> tmp491;
+    TNode<JSReceiver> tmp492;
+    TNode<String> tmp493;
+    TNode<Number> tmp494;
+    TNode<Object> tmp495;
+    TNode<Object> tmp496;
+    TNode<BuiltinPtr> tmp497;
+    TNode<Map> tmp498;
+    TNode<UintPtrT> tmp499;
+    TNode<IntPtrT> tmp500;
+    TNode<IntPtrT> tmp501;
+    TNode<BuiltinPtr> tmp502;
+    TNode<FixedArray> tmp503;
+    TNode<IntPtrT> tmp504;
+    TNode<IntPtrT> tmp505;
+    TNode<BoolT> tmp506;
+    TNode<UintPtrT> tmp507;
+    TNode<Object> tmp508;
+    TNode<String> tmp509;
+    TNode<String> tmp510;
+    TNode<IntPtrT> tmp511;
+    TNode<IntPtrT> tmp512;
+    TNode<Context> tmp513;
+    TNode<String> tmp514;
+    TNode<IntPtrT> tmp515;
+    TNode<IntPtrT> tmp516;
+    TNode<BoolT> tmp517;
+    TNode<IntPtrT> tmp518;
+    TNode<IntPtrT> tmp519;
+    TNode<BoolT> tmp520;
+    TNode<Context> tmp521;
+    TNode<IntPtrT> tmp522;
+    TNode<IntPtrT> tmp523;
+    TNode<BoolT> tmp524;
+    TNode<BoolT> tmp525;
+    ca_.Bind(&block30, &tmp491, &tmp492, &tmp493, &tmp494, &tmp495, &tmp496, &tmp497, &tmp498, &tmp499, &tmp500, &tmp501, &tmp502, &tmp503, &tmp504, &tmp505, &tmp506, &tmp507, &tmp508, &tmp509, &tmp510, &tmp511, &tmp512, &tmp513, &tmp514, &tmp515, &tmp516, &tmp517, &tmp518, &tmp519, &tmp520, &tmp521, &tmp522, &tmp523, &tmp524, &tmp525);
+    TNode<BoolT> tmp526;
+    USE(tmp526);
+    tmp526 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, true);
+    ca_.Goto(&block32, tmp491, tmp492, tmp493, tmp494, tmp495, tmp496, tmp497, tmp498, tmp499, tmp500, tmp501, tmp502, tmp503, tmp504, tmp505, tmp506, tmp507, tmp508, tmp509, tmp510, tmp511, tmp512, tmp513, tmp514, tmp515, tmp516, tmp517, tmp518, tmp519, tmp520, tmp521, tmp522, tmp523, tmp524, tmp525, tmp526);
+  }
+
+  if (block31.is_used()) {
+    TNode<Context> tmp527;
+    TNode<JSReceiver> tmp528;
+    TNode<String> tmp529;
+    TNode<Number> tmp530;
+    TNode<Object> tmp531;
+    TNode<Object> tmp532;
+    TNode<BuiltinPtr> tmp533;
+    TNode<Map> tmp534;
+    TNode<UintPtrT> tmp535;
+    TNode<IntPtrT> tmp536;
+    TNode<IntPtrT> tmp537;
+    TNode<BuiltinPtr> tmp538;
+    TNode<FixedArray> tmp539;
+    TNode<IntPtrT> tmp540;
+    TNode<IntPtrT> tmp541;
+    TNode<BoolT> tmp542;
+    TNode<UintPtrT> tmp543;
+    TNode<Object> tmp544;
+    TNode<String> tmp545;
+    TNode<String> tmp546;
+    TNode<IntPtrT> tmp547;
+    TNode<IntPtrT> tmp548;
+    TNode<Context> tmp549;
+    TNode<String> tmp550;
+    TNode<IntPtrT> tmp551;
+    TNode<IntPtrT> tmp552;
+    TNode<BoolT> tmp553;
+    TNode<IntPtrT> tmp554;
+    TNode<IntPtrT> tmp555;
+    TNode<BoolT> tmp556;
+    TNode<Context> tmp557;
+    TNode<IntPtrT> tmp558;
+    TNode<IntPtrT> tmp559;
+    TNode<BoolT> tmp560;
+    TNode<BoolT> tmp561;
+    ca_.Bind(&block31, &tmp527, &tmp528, &tmp529, &tmp530, &tmp531, &tmp532, &tmp533, &tmp534, &tmp535, &tmp536, &tmp537, &tmp538, &tmp539, &tmp540, &tmp541, &tmp542, &tmp543, &tmp544, &tmp545, &tmp546, &tmp547, &tmp548, &tmp549, &tmp550, &tmp551, &tmp552, &tmp553, &tmp554, &tmp555, &tmp556, &tmp557, &tmp558, &tmp559, &tmp560, &tmp561);
+    TNode<IntPtrT> tmp562;
+    USE(tmp562);
+    tmp562 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<BoolT> tmp563;
+    USE(tmp563);
+    tmp563 = CodeStubAssembler(state_).WordEqual(TNode<IntPtrT>{tmp559}, TNode<IntPtrT>{tmp562});
+    ca_.Goto(&block32, tmp527, tmp528, tmp529, tmp530, tmp531, tmp532, tmp533, tmp534, tmp535, tmp536, tmp537, tmp538, tmp539, tmp540, tmp541, tmp542, tmp543, tmp544, tmp545, tmp546, tmp547, tmp548, tmp549, tmp550, tmp551, tmp552, tmp553, tmp554, tmp555, tmp556, tmp557, tmp558, tmp559, tmp560, tmp561, tmp563);
+  }
+
+  if (block32.is_used()) {
+    TNode<Context> tmp564;
+    TNode<JSReceiver> tmp565;
+    TNode<String> tmp566;
+    TNode<Number> tmp567;
+    TNode<Object> tmp568;
+    TNode<Object> tmp569;
+    TNode<BuiltinPtr> tmp570;
+    TNode<Map> tmp571;
+    TNode<UintPtrT> tmp572;
+    TNode<IntPtrT> tmp573;
+    TNode<IntPtrT> tmp574;
+    TNode<BuiltinPtr> tmp575;
+    TNode<FixedArray> tmp576;
+    TNode<IntPtrT> tmp577;
+    TNode<IntPtrT> tmp578;
+    TNode<BoolT> tmp579;
+    TNode<UintPtrT> tmp580;
+    TNode<Object> tmp581;
+    TNode<String> tmp582;
+    TNode<String> tmp583;
+    TNode<IntPtrT> tmp584;
+    TNode<IntPtrT> tmp585;
+    TNode<Context> tmp586;
+    TNode<String> tmp587;
+    TNode<IntPtrT> tmp588;
+    TNode<IntPtrT> tmp589;
+    TNode<BoolT> tmp590;
+    TNode<IntPtrT> tmp591;
+    TNode<IntPtrT> tmp592;
+    TNode<BoolT> tmp593;
+    TNode<Context> tmp594;
+    TNode<IntPtrT> tmp595;
+    TNode<IntPtrT> tmp596;
+    TNode<BoolT> tmp597;
+    TNode<BoolT> tmp598;
+    TNode<BoolT> tmp599;
+    ca_.Bind(&block32, &tmp564, &tmp565, &tmp566, &tmp567, &tmp568, &tmp569, &tmp570, &tmp571, &tmp572, &tmp573, &tmp574, &tmp575, &tmp576, &tmp577, &tmp578, &tmp579, &tmp580, &tmp581, &tmp582, &tmp583, &tmp584, &tmp585, &tmp586, &tmp587, &tmp588, &tmp589, &tmp590, &tmp591, &tmp592, &tmp593, &tmp594, &tmp595, &tmp596, &tmp597, &tmp598, &tmp599);
+    ca_.Branch(tmp599, &block28, &block29, tmp564, tmp565, tmp566, tmp567, tmp568, tmp569, tmp570, tmp571, tmp572, tmp573, tmp574, tmp575, tmp576, tmp577, tmp578, tmp579, tmp580, tmp581, tmp582, tmp583, tmp584, tmp585, tmp586, tmp587, tmp588, tmp589, tmp590, tmp591, tmp592, tmp593, tmp594, tmp595, tmp596, tmp597);
+  }
+
+  if (block28.is_used()) {
+    TNode<Context> tmp600;
+    TNode<JSReceiver> tmp601;
+    TNode<String> tmp602;
+    TNode<Number> tmp603;
+    TNode<Object> tmp604;
+    TNode<Object> tmp605;
+    TNode<BuiltinPtr> tmp606;
+    TNode<Map> tmp607;
+    TNode<UintPtrT> tmp608;
+    TNode<IntPtrT> tmp609;
+    TNode<IntPtrT> tmp610;
+    TNode<BuiltinPtr> tmp611;
+    TNode<FixedArray> tmp612;
+    TNode<IntPtrT> tmp613;
+    TNode<IntPtrT> tmp614;
+    TNode<BoolT> tmp615;
+    TNode<UintPtrT> tmp616;
+    TNode<Object> tmp617;
+    TNode<String> tmp618;
+    TNode<String> tmp619;
+    TNode<IntPtrT> tmp620;
+    TNode<IntPtrT> tmp621;
+    TNode<Context> tmp622;
+    TNode<String> tmp623;
+    TNode<IntPtrT> tmp624;
+    TNode<IntPtrT> tmp625;
+    TNode<BoolT> tmp626;
+    TNode<IntPtrT> tmp627;
+    TNode<IntPtrT> tmp628;
+    TNode<BoolT> tmp629;
+    TNode<Context> tmp630;
+    TNode<IntPtrT> tmp631;
+    TNode<IntPtrT> tmp632;
+    TNode<BoolT> tmp633;
+    ca_.Bind(&block28, &tmp600, &tmp601, &tmp602, &tmp603, &tmp604, &tmp605, &tmp606, &tmp607, &tmp608, &tmp609, &tmp610, &tmp611, &tmp612, &tmp613, &tmp614, &tmp615, &tmp616, &tmp617, &tmp618, &tmp619, &tmp620, &tmp621, &tmp622, &tmp623, &tmp624, &tmp625, &tmp626, &tmp627, &tmp628, &tmp629, &tmp630, &tmp631, &tmp632, &tmp633);
+    ca_.Goto(&block27, tmp600, tmp601, tmp602, tmp603, tmp604, tmp605, tmp606, tmp607, tmp608, tmp609, tmp610, tmp611, tmp612, tmp613, tmp614, tmp615, tmp616, tmp617, tmp618, tmp619, tmp620, tmp621, tmp622, tmp623, tmp624, tmp625, tmp626, tmp627, tmp628, tmp629, tmp630, tmp631, tmp632, tmp633);
+  }
+
+  if (block29.is_used()) {
+    TNode<Context> tmp634;
+    TNode<JSReceiver> tmp635;
+    TNode<String> tmp636;
+    TNode<Number> tmp637;
+    TNode<Object> tmp638;
+    TNode<Object> tmp639;
+    TNode<BuiltinPtr> tmp640;
+    TNode<Map> tmp641;
+    TNode<UintPtrT> tmp642;
+    TNode<IntPtrT> tmp643;
+    TNode<IntPtrT> tmp644;
+    TNode<BuiltinPtr> tmp645;
+    TNode<FixedArray> tmp646;
+    TNode<IntPtrT> tmp647;
+    TNode<IntPtrT> tmp648;
+    TNode<BoolT> tmp649;
+    TNode<UintPtrT> tmp650;
+    TNode<Object> tmp651;
+    TNode<String> tmp652;
+    TNode<String> tmp653;
+    TNode<IntPtrT> tmp654;
+    TNode<IntPtrT> tmp655;
+    TNode<Context> tmp656;
+    TNode<String> tmp657;
+    TNode<IntPtrT> tmp658;
+    TNode<IntPtrT> tmp659;
+    TNode<BoolT> tmp660;
+    TNode<IntPtrT> tmp661;
+    TNode<IntPtrT> tmp662;
+    TNode<BoolT> tmp663;
+    TNode<Context> tmp664;
+    TNode<IntPtrT> tmp665;
+    TNode<IntPtrT> tmp666;
+    TNode<BoolT> tmp667;
+    ca_.Bind(&block29, &tmp634, &tmp635, &tmp636, &tmp637, &tmp638, &tmp639, &tmp640, &tmp641, &tmp642, &tmp643, &tmp644, &tmp645, &tmp646, &tmp647, &tmp648, &tmp649, &tmp650, &tmp651, &tmp652, &tmp653, &tmp654, &tmp655, &tmp656, &tmp657, &tmp658, &tmp659, &tmp660, &tmp661, &tmp662, &tmp663, &tmp664, &tmp665, &tmp666, &tmp667);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 169);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 170);
+    TNode<IntPtrT> tmp668;
+    USE(tmp668);
+    tmp668 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp666}, TNode<IntPtrT>{tmp665});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 173);
+    TNode<IntPtrT> tmp669;
+    USE(tmp669);
+    tmp669 = CodeStubAssembler(state_).IntPtrDiv(TNode<IntPtrT>{tmp668}, TNode<IntPtrT>{tmp666});
+    TNode<BoolT> tmp670;
+    USE(tmp670);
+    tmp670 = CodeStubAssembler(state_).WordNotEqual(TNode<IntPtrT>{tmp669}, TNode<IntPtrT>{tmp665});
+    ca_.Branch(tmp670, &block33, &block34, tmp634, tmp635, tmp636, tmp637, tmp638, tmp639, tmp640, tmp641, tmp642, tmp643, tmp644, tmp645, tmp646, tmp647, tmp648, tmp649, tmp650, tmp651, tmp652, tmp653, tmp654, tmp655, tmp656, tmp657, tmp658, tmp659, tmp660, tmp661, tmp662, tmp663, tmp664, tmp665, tmp666, tmp667, tmp665, tmp668);
+  }
+
+  if (block33.is_used()) {
+    TNode<Context> tmp671;
+    TNode<JSReceiver> tmp672;
+    TNode<String> tmp673;
+    TNode<Number> tmp674;
+    TNode<Object> tmp675;
+    TNode<Object> tmp676;
+    TNode<BuiltinPtr> tmp677;
+    TNode<Map> tmp678;
+    TNode<UintPtrT> tmp679;
+    TNode<IntPtrT> tmp680;
+    TNode<IntPtrT> tmp681;
+    TNode<BuiltinPtr> tmp682;
+    TNode<FixedArray> tmp683;
+    TNode<IntPtrT> tmp684;
+    TNode<IntPtrT> tmp685;
+    TNode<BoolT> tmp686;
+    TNode<UintPtrT> tmp687;
+    TNode<Object> tmp688;
+    TNode<String> tmp689;
+    TNode<String> tmp690;
+    TNode<IntPtrT> tmp691;
+    TNode<IntPtrT> tmp692;
+    TNode<Context> tmp693;
+    TNode<String> tmp694;
+    TNode<IntPtrT> tmp695;
+    TNode<IntPtrT> tmp696;
+    TNode<BoolT> tmp697;
+    TNode<IntPtrT> tmp698;
+    TNode<IntPtrT> tmp699;
+    TNode<BoolT> tmp700;
+    TNode<Context> tmp701;
+    TNode<IntPtrT> tmp702;
+    TNode<IntPtrT> tmp703;
+    TNode<BoolT> tmp704;
+    TNode<IntPtrT> tmp705;
+    TNode<IntPtrT> tmp706;
+    ca_.Bind(&block33, &tmp671, &tmp672, &tmp673, &tmp674, &tmp675, &tmp676, &tmp677, &tmp678, &tmp679, &tmp680, &tmp681, &tmp682, &tmp683, &tmp684, &tmp685, &tmp686, &tmp687, &tmp688, &tmp689, &tmp690, &tmp691, &tmp692, &tmp693, &tmp694, &tmp695, &tmp696, &tmp697, &tmp698, &tmp699, &tmp700, &tmp701, &tmp702, &tmp703, &tmp704, &tmp705, &tmp706);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 174);
+    CodeStubAssembler(state_).CallRuntime(Runtime::kThrowInvalidStringLength, tmp701);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block34.is_used()) {
+    TNode<Context> tmp708;
+    TNode<JSReceiver> tmp709;
+    TNode<String> tmp710;
+    TNode<Number> tmp711;
+    TNode<Object> tmp712;
+    TNode<Object> tmp713;
+    TNode<BuiltinPtr> tmp714;
+    TNode<Map> tmp715;
+    TNode<UintPtrT> tmp716;
+    TNode<IntPtrT> tmp717;
+    TNode<IntPtrT> tmp718;
+    TNode<BuiltinPtr> tmp719;
+    TNode<FixedArray> tmp720;
+    TNode<IntPtrT> tmp721;
+    TNode<IntPtrT> tmp722;
+    TNode<BoolT> tmp723;
+    TNode<UintPtrT> tmp724;
+    TNode<Object> tmp725;
+    TNode<String> tmp726;
+    TNode<String> tmp727;
+    TNode<IntPtrT> tmp728;
+    TNode<IntPtrT> tmp729;
+    TNode<Context> tmp730;
+    TNode<String> tmp731;
+    TNode<IntPtrT> tmp732;
+    TNode<IntPtrT> tmp733;
+    TNode<BoolT> tmp734;
+    TNode<IntPtrT> tmp735;
+    TNode<IntPtrT> tmp736;
+    TNode<BoolT> tmp737;
+    TNode<Context> tmp738;
+    TNode<IntPtrT> tmp739;
+    TNode<IntPtrT> tmp740;
+    TNode<BoolT> tmp741;
+    TNode<IntPtrT> tmp742;
+    TNode<IntPtrT> tmp743;
+    ca_.Bind(&block34, &tmp708, &tmp709, &tmp710, &tmp711, &tmp712, &tmp713, &tmp714, &tmp715, &tmp716, &tmp717, &tmp718, &tmp719, &tmp720, &tmp721, &tmp722, &tmp723, &tmp724, &tmp725, &tmp726, &tmp727, &tmp728, &tmp729, &tmp730, &tmp731, &tmp732, &tmp733, &tmp734, &tmp735, &tmp736, &tmp737, &tmp738, &tmp739, &tmp740, &tmp741, &tmp742, &tmp743);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 177);
+    TNode<IntPtrT> tmp744;
+    USE(tmp744);
+    tmp744 = AddStringLength_10(state_, TNode<Context>{tmp738}, TNode<IntPtrT>{tmp722}, TNode<IntPtrT>{tmp743});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 178);
+    ca_.Branch(tmp741, &block35, &block36, tmp708, tmp709, tmp710, tmp711, tmp712, tmp713, tmp714, tmp715, tmp716, tmp717, tmp718, tmp719, tmp720, tmp721, tmp744, tmp723, tmp724, tmp725, tmp726, tmp727, tmp728, tmp729, tmp730, tmp731, tmp732, tmp733, tmp734, tmp735, tmp736, tmp737, tmp738, tmp739, tmp740, tmp741, tmp742, tmp743);
+  }
+
+  if (block35.is_used()) {
+    TNode<Context> tmp745;
+    TNode<JSReceiver> tmp746;
+    TNode<String> tmp747;
+    TNode<Number> tmp748;
+    TNode<Object> tmp749;
+    TNode<Object> tmp750;
+    TNode<BuiltinPtr> tmp751;
+    TNode<Map> tmp752;
+    TNode<UintPtrT> tmp753;
+    TNode<IntPtrT> tmp754;
+    TNode<IntPtrT> tmp755;
+    TNode<BuiltinPtr> tmp756;
+    TNode<FixedArray> tmp757;
+    TNode<IntPtrT> tmp758;
+    TNode<IntPtrT> tmp759;
+    TNode<BoolT> tmp760;
+    TNode<UintPtrT> tmp761;
+    TNode<Object> tmp762;
+    TNode<String> tmp763;
+    TNode<String> tmp764;
+    TNode<IntPtrT> tmp765;
+    TNode<IntPtrT> tmp766;
+    TNode<Context> tmp767;
+    TNode<String> tmp768;
+    TNode<IntPtrT> tmp769;
+    TNode<IntPtrT> tmp770;
+    TNode<BoolT> tmp771;
+    TNode<IntPtrT> tmp772;
+    TNode<IntPtrT> tmp773;
+    TNode<BoolT> tmp774;
+    TNode<Context> tmp775;
+    TNode<IntPtrT> tmp776;
+    TNode<IntPtrT> tmp777;
+    TNode<BoolT> tmp778;
+    TNode<IntPtrT> tmp779;
+    TNode<IntPtrT> tmp780;
+    ca_.Bind(&block35, &tmp745, &tmp746, &tmp747, &tmp748, &tmp749, &tmp750, &tmp751, &tmp752, &tmp753, &tmp754, &tmp755, &tmp756, &tmp757, &tmp758, &tmp759, &tmp760, &tmp761, &tmp762, &tmp763, &tmp764, &tmp765, &tmp766, &tmp767, &tmp768, &tmp769, &tmp770, &tmp771, &tmp772, &tmp773, &tmp774, &tmp775, &tmp776, &tmp777, &tmp778, &tmp779, &tmp780);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 180);
+    TNode<IntPtrT> tmp781;
+    USE(tmp781);
+    tmp781 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<IntPtrT> tmp782;
+    USE(tmp782);
+    tmp782 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp758}, TNode<IntPtrT>{tmp781});
+    TNode<Smi> tmp783;
+    USE(tmp783);
+    tmp783 = Convert5ATSmi8ATintptr_187(state_, TNode<IntPtrT>{tmp779});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 179);
+    TNode<FixedArray> tmp784;
+    USE(tmp784);
+    tmp784 = StoreAndGrowFixedArray5ATSmi_1456(state_, TNode<FixedArray>{tmp757}, TNode<IntPtrT>{tmp758}, TNode<Smi>{tmp783});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 178);
+    ca_.Goto(&block36, tmp745, tmp746, tmp747, tmp748, tmp749, tmp750, tmp751, tmp752, tmp753, tmp754, tmp755, tmp756, tmp784, tmp782, tmp759, tmp760, tmp761, tmp762, tmp763, tmp764, tmp765, tmp766, tmp767, tmp768, tmp769, tmp770, tmp771, tmp772, tmp773, tmp774, tmp775, tmp776, tmp777, tmp778, tmp779, tmp780);
+  }
+
+  if (block36.is_used()) {
+    TNode<Context> tmp785;
+    TNode<JSReceiver> tmp786;
+    TNode<String> tmp787;
+    TNode<Number> tmp788;
+    TNode<Object> tmp789;
+    TNode<Object> tmp790;
+    TNode<BuiltinPtr> tmp791;
+    TNode<Map> tmp792;
+    TNode<UintPtrT> tmp793;
+    TNode<IntPtrT> tmp794;
+    TNode<IntPtrT> tmp795;
+    TNode<BuiltinPtr> tmp796;
+    TNode<FixedArray> tmp797;
+    TNode<IntPtrT> tmp798;
+    TNode<IntPtrT> tmp799;
+    TNode<BoolT> tmp800;
+    TNode<UintPtrT> tmp801;
+    TNode<Object> tmp802;
+    TNode<String> tmp803;
+    TNode<String> tmp804;
+    TNode<IntPtrT> tmp805;
+    TNode<IntPtrT> tmp806;
+    TNode<Context> tmp807;
+    TNode<String> tmp808;
+    TNode<IntPtrT> tmp809;
+    TNode<IntPtrT> tmp810;
+    TNode<BoolT> tmp811;
+    TNode<IntPtrT> tmp812;
+    TNode<IntPtrT> tmp813;
+    TNode<BoolT> tmp814;
+    TNode<Context> tmp815;
+    TNode<IntPtrT> tmp816;
+    TNode<IntPtrT> tmp817;
+    TNode<BoolT> tmp818;
+    TNode<IntPtrT> tmp819;
+    TNode<IntPtrT> tmp820;
+    ca_.Bind(&block36, &tmp785, &tmp786, &tmp787, &tmp788, &tmp789, &tmp790, &tmp791, &tmp792, &tmp793, &tmp794, &tmp795, &tmp796, &tmp797, &tmp798, &tmp799, &tmp800, &tmp801, &tmp802, &tmp803, &tmp804, &tmp805, &tmp806, &tmp807, &tmp808, &tmp809, &tmp810, &tmp811, &tmp812, &tmp813, &tmp814, &tmp815, &tmp816, &tmp817, &tmp818, &tmp819, &tmp820);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 166);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 155);
+    ca_.Goto(&block27, tmp785, tmp786, tmp787, tmp788, tmp789, tmp790, tmp791, tmp792, tmp793, tmp794, tmp795, tmp796, tmp797, tmp798, tmp799, tmp800, tmp801, tmp802, tmp803, tmp804, tmp805, tmp806, tmp807, tmp808, tmp809, tmp810, tmp811, tmp812, tmp813, tmp814, tmp815, tmp816, tmp817, tmp818);
+  }
+
+  if (block27.is_used()) {
+    TNode<Context> tmp821;
+    TNode<JSReceiver> tmp822;
+    TNode<String> tmp823;
+    TNode<Number> tmp824;
+    TNode<Object> tmp825;
+    TNode<Object> tmp826;
+    TNode<BuiltinPtr> tmp827;
+    TNode<Map> tmp828;
+    TNode<UintPtrT> tmp829;
+    TNode<IntPtrT> tmp830;
+    TNode<IntPtrT> tmp831;
+    TNode<BuiltinPtr> tmp832;
+    TNode<FixedArray> tmp833;
+    TNode<IntPtrT> tmp834;
+    TNode<IntPtrT> tmp835;
+    TNode<BoolT> tmp836;
+    TNode<UintPtrT> tmp837;
+    TNode<Object> tmp838;
+    TNode<String> tmp839;
+    TNode<String> tmp840;
+    TNode<IntPtrT> tmp841;
+    TNode<IntPtrT> tmp842;
+    TNode<Context> tmp843;
+    TNode<String> tmp844;
+    TNode<IntPtrT> tmp845;
+    TNode<IntPtrT> tmp846;
+    TNode<BoolT> tmp847;
+    TNode<IntPtrT> tmp848;
+    TNode<IntPtrT> tmp849;
+    TNode<BoolT> tmp850;
+    TNode<Context> tmp851;
+    TNode<IntPtrT> tmp852;
+    TNode<IntPtrT> tmp853;
+    TNode<BoolT> tmp854;
+    ca_.Bind(&block27, &tmp821, &tmp822, &tmp823, &tmp824, &tmp825, &tmp826, &tmp827, &tmp828, &tmp829, &tmp830, &tmp831, &tmp832, &tmp833, &tmp834, &tmp835, &tmp836, &tmp837, &tmp838, &tmp839, &tmp840, &tmp841, &tmp842, &tmp843, &tmp844, &tmp845, &tmp846, &tmp847, &tmp848, &tmp849, &tmp850, &tmp851, &tmp852, &tmp853, &tmp854);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 158);
+    TNode<IntPtrT> tmp855;
+    USE(tmp855);
+    tmp855 = CodeStubAssembler(state_).LoadStringLengthAsWord(TNode<String>{tmp844});
+    TNode<IntPtrT> tmp856;
+    USE(tmp856);
+    tmp856 = AddStringLength_10(state_, TNode<Context>{tmp843}, TNode<IntPtrT>{tmp835}, TNode<IntPtrT>{tmp855});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 157);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 160);
+    TNode<IntPtrT> tmp857;
+    USE(tmp857);
+    tmp857 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<IntPtrT> tmp858;
+    USE(tmp858);
+    tmp858 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp834}, TNode<IntPtrT>{tmp857});
+    TNode<FixedArray> tmp859;
+    USE(tmp859);
+    tmp859 = StoreAndGrowFixedArray6String_1457(state_, TNode<FixedArray>{tmp833}, TNode<IntPtrT>{tmp834}, TNode<String>{tmp844});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 159);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 162);
+    TNode<Uint16T> tmp860;
+    USE(tmp860);
+    tmp860 = CodeStubAssembler(state_).LoadInstanceType(TNode<HeapObject>{tmp844});
+    TNode<BoolT> tmp861;
+    USE(tmp861);
+    tmp861 = CodeStubAssembler(state_).IsOneByteStringInstanceType(TNode<Uint16T>{tmp860});
+    TNode<BoolT> tmp862;
+    USE(tmp862);
+    tmp862 = CodeStubAssembler(state_).Word32And(TNode<BoolT>{tmp861}, TNode<BoolT>{tmp836});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 161);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 152);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 311);
+    ca_.Goto(&block26, tmp821, tmp822, tmp823, tmp824, tmp825, tmp826, tmp827, tmp828, tmp829, tmp830, tmp831, tmp832, tmp859, tmp858, tmp856, tmp862, tmp837, tmp838, tmp839, tmp840, tmp841, tmp842, tmp843, tmp844, tmp845, tmp846);
+  }
+
+  if (block26.is_used()) {
+    TNode<Context> tmp863;
+    TNode<JSReceiver> tmp864;
+    TNode<String> tmp865;
+    TNode<Number> tmp866;
+    TNode<Object> tmp867;
+    TNode<Object> tmp868;
+    TNode<BuiltinPtr> tmp869;
+    TNode<Map> tmp870;
+    TNode<UintPtrT> tmp871;
+    TNode<IntPtrT> tmp872;
+    TNode<IntPtrT> tmp873;
+    TNode<BuiltinPtr> tmp874;
+    TNode<FixedArray> tmp875;
+    TNode<IntPtrT> tmp876;
+    TNode<IntPtrT> tmp877;
+    TNode<BoolT> tmp878;
+    TNode<UintPtrT> tmp879;
+    TNode<Object> tmp880;
+    TNode<String> tmp881;
+    TNode<String> tmp882;
+    TNode<IntPtrT> tmp883;
+    TNode<IntPtrT> tmp884;
+    TNode<Context> tmp885;
+    TNode<String> tmp886;
+    TNode<IntPtrT> tmp887;
+    TNode<IntPtrT> tmp888;
+    ca_.Bind(&block26, &tmp863, &tmp864, &tmp865, &tmp866, &tmp867, &tmp868, &tmp869, &tmp870, &tmp871, &tmp872, &tmp873, &tmp874, &tmp875, &tmp876, &tmp877, &tmp878, &tmp879, &tmp880, &tmp881, &tmp882, &tmp883, &tmp884, &tmp885, &tmp886, &tmp887, &tmp888);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 312);
+    TNode<IntPtrT> tmp889;
+    USE(tmp889);
+    tmp889 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 273);
+    ca_.Goto(&block4, tmp863, tmp864, tmp865, tmp866, tmp867, tmp868, tmp869, tmp870, tmp871, tmp872, tmp889, tmp874, tmp875, tmp876, tmp877, tmp878, tmp879);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp890;
+    TNode<JSReceiver> tmp891;
+    TNode<String> tmp892;
+    TNode<Number> tmp893;
+    TNode<Object> tmp894;
+    TNode<Object> tmp895;
+    TNode<BuiltinPtr> tmp896;
+    TNode<Map> tmp897;
+    TNode<UintPtrT> tmp898;
+    TNode<IntPtrT> tmp899;
+    TNode<IntPtrT> tmp900;
+    TNode<BuiltinPtr> tmp901;
+    TNode<FixedArray> tmp902;
+    TNode<IntPtrT> tmp903;
+    TNode<IntPtrT> tmp904;
+    TNode<BoolT> tmp905;
+    TNode<UintPtrT> tmp906;
+    ca_.Bind(&block3, &tmp890, &tmp891, &tmp892, &tmp893, &tmp894, &tmp895, &tmp896, &tmp897, &tmp898, &tmp899, &tmp900, &tmp901, &tmp902, &tmp903, &tmp904, &tmp905, &tmp906);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 316);
+    TNode<BoolT> tmp907;
+    USE(tmp907);
+    tmp907 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, true);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 167);
+    TNode<IntPtrT> tmp908;
+    USE(tmp908);
+    tmp908 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<BoolT> tmp909;
+    USE(tmp909);
+    tmp909 = CodeStubAssembler(state_).WordEqual(TNode<IntPtrT>{tmp900}, TNode<IntPtrT>{tmp908});
+    ca_.Branch(tmp909, &block40, &block41, tmp890, tmp891, tmp892, tmp893, tmp894, tmp895, tmp896, tmp897, tmp898, tmp899, tmp900, tmp901, tmp902, tmp903, tmp904, tmp905, tmp906, tmp900, tmp899, tmp890, tmp900, tmp899, tmp907, tmp909);
+  }
+
+  if (block40.is_used()) {
+    TNode<Context> tmp910;
+    TNode<JSReceiver> tmp911;
+    TNode<String> tmp912;
+    TNode<Number> tmp913;
+    TNode<Object> tmp914;
+    TNode<Object> tmp915;
+    TNode<BuiltinPtr> tmp916;
+    TNode<Map> tmp917;
+    TNode<UintPtrT> tmp918;
+    TNode<IntPtrT> tmp919;
+    TNode<IntPtrT> tmp920;
+    TNode<BuiltinPtr> tmp921;
+    TNode<FixedArray> tmp922;
+    TNode<IntPtrT> tmp923;
+    TNode<IntPtrT> tmp924;
+    TNode<BoolT> tmp925;
+    TNode<UintPtrT> tmp926;
+    TNode<IntPtrT> tmp927;
+    TNode<IntPtrT> tmp928;
+    TNode<Context> tmp929;
+    TNode<IntPtrT> tmp930;
+    TNode<IntPtrT> tmp931;
+    TNode<BoolT> tmp932;
+    TNode<BoolT> tmp933;
+    ca_.Bind(&block40, &tmp910, &tmp911, &tmp912, &tmp913, &tmp914, &tmp915, &tmp916, &tmp917, &tmp918, &tmp919, &tmp920, &tmp921, &tmp922, &tmp923, &tmp924, &tmp925, &tmp926, &tmp927, &tmp928, &tmp929, &tmp930, &tmp931, &tmp932, &tmp933);
+    TNode<BoolT> tmp934;
+    USE(tmp934);
+    tmp934 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, true);
+    ca_.Goto(&block42, tmp910, tmp911, tmp912, tmp913, tmp914, tmp915, tmp916, tmp917, tmp918, tmp919, tmp920, tmp921, tmp922, tmp923, tmp924, tmp925, tmp926, tmp927, tmp928, tmp929, tmp930, tmp931, tmp932, tmp933, tmp934);
+  }
+
+  if (block41.is_used()) {
+    TNode<Context> tmp935;
+    TNode<JSReceiver> tmp936;
+    TNode<String> tmp937;
+    TNode<Number> tmp938;
+    TNode<Object> tmp939;
+    TNode<Object> tmp940;
+    TNode<BuiltinPtr> tmp941;
+    TNode<Map> tmp942;
+    TNode<UintPtrT> tmp943;
+    TNode<IntPtrT> tmp944;
+    TNode<IntPtrT> tmp945;
+    TNode<BuiltinPtr> tmp946;
+    TNode<FixedArray> tmp947;
+    TNode<IntPtrT> tmp948;
+    TNode<IntPtrT> tmp949;
+    TNode<BoolT> tmp950;
+    TNode<UintPtrT> tmp951;
+    TNode<IntPtrT> tmp952;
+    TNode<IntPtrT> tmp953;
+    TNode<Context> tmp954;
+    TNode<IntPtrT> tmp955;
+    TNode<IntPtrT> tmp956;
+    TNode<BoolT> tmp957;
+    TNode<BoolT> tmp958;
+    ca_.Bind(&block41, &tmp935, &tmp936, &tmp937, &tmp938, &tmp939, &tmp940, &tmp941, &tmp942, &tmp943, &tmp944, &tmp945, &tmp946, &tmp947, &tmp948, &tmp949, &tmp950, &tmp951, &tmp952, &tmp953, &tmp954, &tmp955, &tmp956, &tmp957, &tmp958);
+    TNode<IntPtrT> tmp959;
+    USE(tmp959);
+    tmp959 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<BoolT> tmp960;
+    USE(tmp960);
+    tmp960 = CodeStubAssembler(state_).WordEqual(TNode<IntPtrT>{tmp956}, TNode<IntPtrT>{tmp959});
+    ca_.Goto(&block42, tmp935, tmp936, tmp937, tmp938, tmp939, tmp940, tmp941, tmp942, tmp943, tmp944, tmp945, tmp946, tmp947, tmp948, tmp949, tmp950, tmp951, tmp952, tmp953, tmp954, tmp955, tmp956, tmp957, tmp958, tmp960);
+  }
+
+  if (block42.is_used()) {
+    TNode<Context> tmp961;
+    TNode<JSReceiver> tmp962;
+    TNode<String> tmp963;
+    TNode<Number> tmp964;
+    TNode<Object> tmp965;
+    TNode<Object> tmp966;
+    TNode<BuiltinPtr> tmp967;
+    TNode<Map> tmp968;
+    TNode<UintPtrT> tmp969;
+    TNode<IntPtrT> tmp970;
+    TNode<IntPtrT> tmp971;
+    TNode<BuiltinPtr> tmp972;
+    TNode<FixedArray> tmp973;
+    TNode<IntPtrT> tmp974;
+    TNode<IntPtrT> tmp975;
+    TNode<BoolT> tmp976;
+    TNode<UintPtrT> tmp977;
+    TNode<IntPtrT> tmp978;
+    TNode<IntPtrT> tmp979;
+    TNode<Context> tmp980;
+    TNode<IntPtrT> tmp981;
+    TNode<IntPtrT> tmp982;
+    TNode<BoolT> tmp983;
+    TNode<BoolT> tmp984;
+    TNode<BoolT> tmp985;
+    ca_.Bind(&block42, &tmp961, &tmp962, &tmp963, &tmp964, &tmp965, &tmp966, &tmp967, &tmp968, &tmp969, &tmp970, &tmp971, &tmp972, &tmp973, &tmp974, &tmp975, &tmp976, &tmp977, &tmp978, &tmp979, &tmp980, &tmp981, &tmp982, &tmp983, &tmp984, &tmp985);
+    ca_.Branch(tmp985, &block38, &block39, tmp961, tmp962, tmp963, tmp964, tmp965, tmp966, tmp967, tmp968, tmp969, tmp970, tmp971, tmp972, tmp973, tmp974, tmp975, tmp976, tmp977, tmp978, tmp979, tmp980, tmp981, tmp982, tmp983);
+  }
+
+  if (block38.is_used()) {
+    TNode<Context> tmp986;
+    TNode<JSReceiver> tmp987;
+    TNode<String> tmp988;
+    TNode<Number> tmp989;
+    TNode<Object> tmp990;
+    TNode<Object> tmp991;
+    TNode<BuiltinPtr> tmp992;
+    TNode<Map> tmp993;
+    TNode<UintPtrT> tmp994;
+    TNode<IntPtrT> tmp995;
+    TNode<IntPtrT> tmp996;
+    TNode<BuiltinPtr> tmp997;
+    TNode<FixedArray> tmp998;
+    TNode<IntPtrT> tmp999;
+    TNode<IntPtrT> tmp1000;
+    TNode<BoolT> tmp1001;
+    TNode<UintPtrT> tmp1002;
+    TNode<IntPtrT> tmp1003;
+    TNode<IntPtrT> tmp1004;
+    TNode<Context> tmp1005;
+    TNode<IntPtrT> tmp1006;
+    TNode<IntPtrT> tmp1007;
+    TNode<BoolT> tmp1008;
+    ca_.Bind(&block38, &tmp986, &tmp987, &tmp988, &tmp989, &tmp990, &tmp991, &tmp992, &tmp993, &tmp994, &tmp995, &tmp996, &tmp997, &tmp998, &tmp999, &tmp1000, &tmp1001, &tmp1002, &tmp1003, &tmp1004, &tmp1005, &tmp1006, &tmp1007, &tmp1008);
+    ca_.Goto(&block37, tmp986, tmp987, tmp988, tmp989, tmp990, tmp991, tmp992, tmp993, tmp994, tmp995, tmp996, tmp997, tmp998, tmp999, tmp1000, tmp1001, tmp1002, tmp1003, tmp1004, tmp1005, tmp1006, tmp1007, tmp1008);
+  }
+
+  if (block39.is_used()) {
+    TNode<Context> tmp1009;
+    TNode<JSReceiver> tmp1010;
+    TNode<String> tmp1011;
+    TNode<Number> tmp1012;
+    TNode<Object> tmp1013;
+    TNode<Object> tmp1014;
+    TNode<BuiltinPtr> tmp1015;
+    TNode<Map> tmp1016;
+    TNode<UintPtrT> tmp1017;
+    TNode<IntPtrT> tmp1018;
+    TNode<IntPtrT> tmp1019;
+    TNode<BuiltinPtr> tmp1020;
+    TNode<FixedArray> tmp1021;
+    TNode<IntPtrT> tmp1022;
+    TNode<IntPtrT> tmp1023;
+    TNode<BoolT> tmp1024;
+    TNode<UintPtrT> tmp1025;
+    TNode<IntPtrT> tmp1026;
+    TNode<IntPtrT> tmp1027;
+    TNode<Context> tmp1028;
+    TNode<IntPtrT> tmp1029;
+    TNode<IntPtrT> tmp1030;
+    TNode<BoolT> tmp1031;
+    ca_.Bind(&block39, &tmp1009, &tmp1010, &tmp1011, &tmp1012, &tmp1013, &tmp1014, &tmp1015, &tmp1016, &tmp1017, &tmp1018, &tmp1019, &tmp1020, &tmp1021, &tmp1022, &tmp1023, &tmp1024, &tmp1025, &tmp1026, &tmp1027, &tmp1028, &tmp1029, &tmp1030, &tmp1031);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 169);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 170);
+    TNode<IntPtrT> tmp1032;
+    USE(tmp1032);
+    tmp1032 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp1030}, TNode<IntPtrT>{tmp1029});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 173);
+    TNode<IntPtrT> tmp1033;
+    USE(tmp1033);
+    tmp1033 = CodeStubAssembler(state_).IntPtrDiv(TNode<IntPtrT>{tmp1032}, TNode<IntPtrT>{tmp1030});
+    TNode<BoolT> tmp1034;
+    USE(tmp1034);
+    tmp1034 = CodeStubAssembler(state_).WordNotEqual(TNode<IntPtrT>{tmp1033}, TNode<IntPtrT>{tmp1029});
+    ca_.Branch(tmp1034, &block43, &block44, tmp1009, tmp1010, tmp1011, tmp1012, tmp1013, tmp1014, tmp1015, tmp1016, tmp1017, tmp1018, tmp1019, tmp1020, tmp1021, tmp1022, tmp1023, tmp1024, tmp1025, tmp1026, tmp1027, tmp1028, tmp1029, tmp1030, tmp1031, tmp1029, tmp1032);
+  }
+
+  if (block43.is_used()) {
+    TNode<Context> tmp1035;
+    TNode<JSReceiver> tmp1036;
+    TNode<String> tmp1037;
+    TNode<Number> tmp1038;
+    TNode<Object> tmp1039;
+    TNode<Object> tmp1040;
+    TNode<BuiltinPtr> tmp1041;
+    TNode<Map> tmp1042;
+    TNode<UintPtrT> tmp1043;
+    TNode<IntPtrT> tmp1044;
+    TNode<IntPtrT> tmp1045;
+    TNode<BuiltinPtr> tmp1046;
+    TNode<FixedArray> tmp1047;
+    TNode<IntPtrT> tmp1048;
+    TNode<IntPtrT> tmp1049;
+    TNode<BoolT> tmp1050;
+    TNode<UintPtrT> tmp1051;
+    TNode<IntPtrT> tmp1052;
+    TNode<IntPtrT> tmp1053;
+    TNode<Context> tmp1054;
+    TNode<IntPtrT> tmp1055;
+    TNode<IntPtrT> tmp1056;
+    TNode<BoolT> tmp1057;
+    TNode<IntPtrT> tmp1058;
+    TNode<IntPtrT> tmp1059;
+    ca_.Bind(&block43, &tmp1035, &tmp1036, &tmp1037, &tmp1038, &tmp1039, &tmp1040, &tmp1041, &tmp1042, &tmp1043, &tmp1044, &tmp1045, &tmp1046, &tmp1047, &tmp1048, &tmp1049, &tmp1050, &tmp1051, &tmp1052, &tmp1053, &tmp1054, &tmp1055, &tmp1056, &tmp1057, &tmp1058, &tmp1059);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 174);
+    CodeStubAssembler(state_).CallRuntime(Runtime::kThrowInvalidStringLength, tmp1054);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block44.is_used()) {
+    TNode<Context> tmp1061;
+    TNode<JSReceiver> tmp1062;
+    TNode<String> tmp1063;
+    TNode<Number> tmp1064;
+    TNode<Object> tmp1065;
+    TNode<Object> tmp1066;
+    TNode<BuiltinPtr> tmp1067;
+    TNode<Map> tmp1068;
+    TNode<UintPtrT> tmp1069;
+    TNode<IntPtrT> tmp1070;
+    TNode<IntPtrT> tmp1071;
+    TNode<BuiltinPtr> tmp1072;
+    TNode<FixedArray> tmp1073;
+    TNode<IntPtrT> tmp1074;
+    TNode<IntPtrT> tmp1075;
+    TNode<BoolT> tmp1076;
+    TNode<UintPtrT> tmp1077;
+    TNode<IntPtrT> tmp1078;
+    TNode<IntPtrT> tmp1079;
+    TNode<Context> tmp1080;
+    TNode<IntPtrT> tmp1081;
+    TNode<IntPtrT> tmp1082;
+    TNode<BoolT> tmp1083;
+    TNode<IntPtrT> tmp1084;
+    TNode<IntPtrT> tmp1085;
+    ca_.Bind(&block44, &tmp1061, &tmp1062, &tmp1063, &tmp1064, &tmp1065, &tmp1066, &tmp1067, &tmp1068, &tmp1069, &tmp1070, &tmp1071, &tmp1072, &tmp1073, &tmp1074, &tmp1075, &tmp1076, &tmp1077, &tmp1078, &tmp1079, &tmp1080, &tmp1081, &tmp1082, &tmp1083, &tmp1084, &tmp1085);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 177);
+    TNode<IntPtrT> tmp1086;
+    USE(tmp1086);
+    tmp1086 = AddStringLength_10(state_, TNode<Context>{tmp1080}, TNode<IntPtrT>{tmp1075}, TNode<IntPtrT>{tmp1085});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 178);
+    ca_.Branch(tmp1083, &block45, &block46, tmp1061, tmp1062, tmp1063, tmp1064, tmp1065, tmp1066, tmp1067, tmp1068, tmp1069, tmp1070, tmp1071, tmp1072, tmp1073, tmp1074, tmp1086, tmp1076, tmp1077, tmp1078, tmp1079, tmp1080, tmp1081, tmp1082, tmp1083, tmp1084, tmp1085);
+  }
+
+  if (block45.is_used()) {
+    TNode<Context> tmp1087;
+    TNode<JSReceiver> tmp1088;
+    TNode<String> tmp1089;
+    TNode<Number> tmp1090;
+    TNode<Object> tmp1091;
+    TNode<Object> tmp1092;
+    TNode<BuiltinPtr> tmp1093;
+    TNode<Map> tmp1094;
+    TNode<UintPtrT> tmp1095;
+    TNode<IntPtrT> tmp1096;
+    TNode<IntPtrT> tmp1097;
+    TNode<BuiltinPtr> tmp1098;
+    TNode<FixedArray> tmp1099;
+    TNode<IntPtrT> tmp1100;
+    TNode<IntPtrT> tmp1101;
+    TNode<BoolT> tmp1102;
+    TNode<UintPtrT> tmp1103;
+    TNode<IntPtrT> tmp1104;
+    TNode<IntPtrT> tmp1105;
+    TNode<Context> tmp1106;
+    TNode<IntPtrT> tmp1107;
+    TNode<IntPtrT> tmp1108;
+    TNode<BoolT> tmp1109;
+    TNode<IntPtrT> tmp1110;
+    TNode<IntPtrT> tmp1111;
+    ca_.Bind(&block45, &tmp1087, &tmp1088, &tmp1089, &tmp1090, &tmp1091, &tmp1092, &tmp1093, &tmp1094, &tmp1095, &tmp1096, &tmp1097, &tmp1098, &tmp1099, &tmp1100, &tmp1101, &tmp1102, &tmp1103, &tmp1104, &tmp1105, &tmp1106, &tmp1107, &tmp1108, &tmp1109, &tmp1110, &tmp1111);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 180);
+    TNode<IntPtrT> tmp1112;
+    USE(tmp1112);
+    tmp1112 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<IntPtrT> tmp1113;
+    USE(tmp1113);
+    tmp1113 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp1100}, TNode<IntPtrT>{tmp1112});
+    TNode<Smi> tmp1114;
+    USE(tmp1114);
+    tmp1114 = Convert5ATSmi8ATintptr_187(state_, TNode<IntPtrT>{tmp1110});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 179);
+    TNode<FixedArray> tmp1115;
+    USE(tmp1115);
+    tmp1115 = StoreAndGrowFixedArray5ATSmi_1456(state_, TNode<FixedArray>{tmp1099}, TNode<IntPtrT>{tmp1100}, TNode<Smi>{tmp1114});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 178);
+    ca_.Goto(&block46, tmp1087, tmp1088, tmp1089, tmp1090, tmp1091, tmp1092, tmp1093, tmp1094, tmp1095, tmp1096, tmp1097, tmp1098, tmp1115, tmp1113, tmp1101, tmp1102, tmp1103, tmp1104, tmp1105, tmp1106, tmp1107, tmp1108, tmp1109, tmp1110, tmp1111);
+  }
+
+  if (block46.is_used()) {
+    TNode<Context> tmp1116;
+    TNode<JSReceiver> tmp1117;
+    TNode<String> tmp1118;
+    TNode<Number> tmp1119;
+    TNode<Object> tmp1120;
+    TNode<Object> tmp1121;
+    TNode<BuiltinPtr> tmp1122;
+    TNode<Map> tmp1123;
+    TNode<UintPtrT> tmp1124;
+    TNode<IntPtrT> tmp1125;
+    TNode<IntPtrT> tmp1126;
+    TNode<BuiltinPtr> tmp1127;
+    TNode<FixedArray> tmp1128;
+    TNode<IntPtrT> tmp1129;
+    TNode<IntPtrT> tmp1130;
+    TNode<BoolT> tmp1131;
+    TNode<UintPtrT> tmp1132;
+    TNode<IntPtrT> tmp1133;
+    TNode<IntPtrT> tmp1134;
+    TNode<Context> tmp1135;
+    TNode<IntPtrT> tmp1136;
+    TNode<IntPtrT> tmp1137;
+    TNode<BoolT> tmp1138;
+    TNode<IntPtrT> tmp1139;
+    TNode<IntPtrT> tmp1140;
+    ca_.Bind(&block46, &tmp1116, &tmp1117, &tmp1118, &tmp1119, &tmp1120, &tmp1121, &tmp1122, &tmp1123, &tmp1124, &tmp1125, &tmp1126, &tmp1127, &tmp1128, &tmp1129, &tmp1130, &tmp1131, &tmp1132, &tmp1133, &tmp1134, &tmp1135, &tmp1136, &tmp1137, &tmp1138, &tmp1139, &tmp1140);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 166);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 316);
+    ca_.Goto(&block37, tmp1116, tmp1117, tmp1118, tmp1119, tmp1120, tmp1121, tmp1122, tmp1123, tmp1124, tmp1125, tmp1126, tmp1127, tmp1128, tmp1129, tmp1130, tmp1131, tmp1132, tmp1133, tmp1134, tmp1135, tmp1136, tmp1137, tmp1138);
+  }
+
+  if (block37.is_used()) {
+    TNode<Context> tmp1141;
+    TNode<JSReceiver> tmp1142;
+    TNode<String> tmp1143;
+    TNode<Number> tmp1144;
+    TNode<Object> tmp1145;
+    TNode<Object> tmp1146;
+    TNode<BuiltinPtr> tmp1147;
+    TNode<Map> tmp1148;
+    TNode<UintPtrT> tmp1149;
+    TNode<IntPtrT> tmp1150;
+    TNode<IntPtrT> tmp1151;
+    TNode<BuiltinPtr> tmp1152;
+    TNode<FixedArray> tmp1153;
+    TNode<IntPtrT> tmp1154;
+    TNode<IntPtrT> tmp1155;
+    TNode<BoolT> tmp1156;
+    TNode<UintPtrT> tmp1157;
+    TNode<IntPtrT> tmp1158;
+    TNode<IntPtrT> tmp1159;
+    TNode<Context> tmp1160;
+    TNode<IntPtrT> tmp1161;
+    TNode<IntPtrT> tmp1162;
+    TNode<BoolT> tmp1163;
+    ca_.Bind(&block37, &tmp1141, &tmp1142, &tmp1143, &tmp1144, &tmp1145, &tmp1146, &tmp1147, &tmp1148, &tmp1149, &tmp1150, &tmp1151, &tmp1152, &tmp1153, &tmp1154, &tmp1155, &tmp1156, &tmp1157, &tmp1158, &tmp1159, &tmp1160, &tmp1161, &tmp1162, &tmp1163);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 319);
+    TNode<String> tmp1164;
+    USE(tmp1164);
+    tmp1164 = BufferJoin_12(state_, TNode<Context>{tmp1141}, TorqueStructBuffer{TNode<FixedArray>{tmp1153}, TNode<IntPtrT>{tmp1154}, TNode<IntPtrT>{tmp1155}, TNode<BoolT>{tmp1156}}, TNode<String>{tmp1143});
+    ca_.Goto(&block1, tmp1141, tmp1142, tmp1143, tmp1144, tmp1145, tmp1146, tmp1147, tmp1164);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp1165;
+    TNode<JSReceiver> tmp1166;
+    TNode<String> tmp1167;
+    TNode<Number> tmp1168;
+    TNode<Object> tmp1169;
+    TNode<Object> tmp1170;
+    TNode<BuiltinPtr> tmp1171;
+    TNode<String> tmp1172;
+    ca_.Bind(&block1, &tmp1165, &tmp1166, &tmp1167, &tmp1168, &tmp1169, &tmp1170, &tmp1171, &tmp1172);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 369);
+    ca_.Goto(&block47, tmp1165, tmp1166, tmp1167, tmp1168, tmp1169, tmp1170, tmp1171, tmp1172);
+  }
+
+    TNode<Context> tmp1173;
+    TNode<JSReceiver> tmp1174;
+    TNode<String> tmp1175;
+    TNode<Number> tmp1176;
+    TNode<Object> tmp1177;
+    TNode<Object> tmp1178;
+    TNode<BuiltinPtr> tmp1179;
+    TNode<String> tmp1180;
+    ca_.Bind(&block47, &tmp1173, &tmp1174, &tmp1175, &tmp1176, &tmp1177, &tmp1178, &tmp1179, &tmp1180);
+  return TNode<String>{tmp1180};
+}
+
+TF_BUILTIN(LoadJoinTypedElement15ATInt32Elements, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<JSReceiver> parameter1 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<0>()));
+  USE(parameter1);
+  TNode<Number> parameter2 = UncheckedCast<Number>(Parameter(Descriptor::ParameterIndex<1>()));
+  USE(parameter2);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block4(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<Number> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 55);
+    TNode<JSTypedArray> tmp3;
+    USE(tmp3);
+    tmp3 = UnsafeCast12JSTypedArray_1375(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 56);
+    ca_.Goto(&block2, tmp0, tmp1, tmp2, tmp3);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp4;
+    TNode<JSReceiver> tmp5;
+    TNode<Number> tmp6;
+    TNode<JSTypedArray> tmp7;
+    ca_.Bind(&block1, &tmp4, &tmp5, &tmp6, &tmp7);
+    TNode<IntPtrT> tmp8 = ca_.IntPtrConstant(JSArrayBufferView::kBufferOffset);
+    USE(tmp8);
+    TNode<JSArrayBuffer>tmp9 = CodeStubAssembler(state_).LoadReference<JSArrayBuffer>(CodeStubAssembler::Reference{tmp7, tmp8});
+    TNode<BoolT> tmp10;
+    USE(tmp10);
+    tmp10 = CodeStubAssembler(state_).IsDetachedBuffer(TNode<JSArrayBuffer>{tmp9});
+    TNode<BoolT> tmp11;
+    USE(tmp11);
+    tmp11 = CodeStubAssembler(state_).Word32BinaryNot(TNode<BoolT>{tmp10});
+    ca_.Branch(tmp11, &block3, &block4, tmp4, tmp5, tmp6, tmp7);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp12;
+    TNode<JSReceiver> tmp13;
+    TNode<Number> tmp14;
+    TNode<JSTypedArray> tmp15;
+    ca_.Bind(&block4, &tmp12, &tmp13, &tmp14, &tmp15);
+    CodeStubAssembler(state_).FailAssert("Torque assert '!IsDetachedBuffer(typedArray.buffer)' failed", "../../deps/v8/src/builtins/array-join.tq", 56);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp16;
+    TNode<JSReceiver> tmp17;
+    TNode<Number> tmp18;
+    TNode<JSTypedArray> tmp19;
+    ca_.Bind(&block3, &tmp16, &tmp17, &tmp18, &tmp19);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp20;
+    TNode<JSReceiver> tmp21;
+    TNode<Number> tmp22;
+    TNode<JSTypedArray> tmp23;
+    ca_.Bind(&block2, &tmp20, &tmp21, &tmp22, &tmp23);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 58);
+    TNode<RawPtrT> tmp24;
+    USE(tmp24);
+    tmp24 = CodeStubAssembler(state_).LoadJSTypedArrayDataPtr(TNode<JSTypedArray>{tmp23});
+    TNode<Smi> tmp25;
+    USE(tmp25);
+    tmp25 = UnsafeCast5ATSmi_1371(state_, TNode<Context>{tmp20}, TNode<Object>{tmp22});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 57);
+    TNode<Numeric> tmp26;
+    USE(tmp26);
+    tmp26 = CodeStubAssembler(state_).LoadFixedTypedArrayElementAsTagged(TNode<RawPtrT>{tmp24}, TNode<Smi>{tmp25}, (KindForArrayType15ATInt32Elements_392(state_)));
+    CodeStubAssembler(state_).Return(tmp26);
+  }
+}
+
+TF_BUILTIN(LoadJoinTypedElement17ATFloat32Elements, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<JSReceiver> parameter1 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<0>()));
+  USE(parameter1);
+  TNode<Number> parameter2 = UncheckedCast<Number>(Parameter(Descriptor::ParameterIndex<1>()));
+  USE(parameter2);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block4(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<Number> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 55);
+    TNode<JSTypedArray> tmp3;
+    USE(tmp3);
+    tmp3 = UnsafeCast12JSTypedArray_1375(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 56);
+    ca_.Goto(&block2, tmp0, tmp1, tmp2, tmp3);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp4;
+    TNode<JSReceiver> tmp5;
+    TNode<Number> tmp6;
+    TNode<JSTypedArray> tmp7;
+    ca_.Bind(&block1, &tmp4, &tmp5, &tmp6, &tmp7);
+    TNode<IntPtrT> tmp8 = ca_.IntPtrConstant(JSArrayBufferView::kBufferOffset);
+    USE(tmp8);
+    TNode<JSArrayBuffer>tmp9 = CodeStubAssembler(state_).LoadReference<JSArrayBuffer>(CodeStubAssembler::Reference{tmp7, tmp8});
+    TNode<BoolT> tmp10;
+    USE(tmp10);
+    tmp10 = CodeStubAssembler(state_).IsDetachedBuffer(TNode<JSArrayBuffer>{tmp9});
+    TNode<BoolT> tmp11;
+    USE(tmp11);
+    tmp11 = CodeStubAssembler(state_).Word32BinaryNot(TNode<BoolT>{tmp10});
+    ca_.Branch(tmp11, &block3, &block4, tmp4, tmp5, tmp6, tmp7);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp12;
+    TNode<JSReceiver> tmp13;
+    TNode<Number> tmp14;
+    TNode<JSTypedArray> tmp15;
+    ca_.Bind(&block4, &tmp12, &tmp13, &tmp14, &tmp15);
+    CodeStubAssembler(state_).FailAssert("Torque assert '!IsDetachedBuffer(typedArray.buffer)' failed", "../../deps/v8/src/builtins/array-join.tq", 56);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp16;
+    TNode<JSReceiver> tmp17;
+    TNode<Number> tmp18;
+    TNode<JSTypedArray> tmp19;
+    ca_.Bind(&block3, &tmp16, &tmp17, &tmp18, &tmp19);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp20;
+    TNode<JSReceiver> tmp21;
+    TNode<Number> tmp22;
+    TNode<JSTypedArray> tmp23;
+    ca_.Bind(&block2, &tmp20, &tmp21, &tmp22, &tmp23);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 58);
+    TNode<RawPtrT> tmp24;
+    USE(tmp24);
+    tmp24 = CodeStubAssembler(state_).LoadJSTypedArrayDataPtr(TNode<JSTypedArray>{tmp23});
+    TNode<Smi> tmp25;
+    USE(tmp25);
+    tmp25 = UnsafeCast5ATSmi_1371(state_, TNode<Context>{tmp20}, TNode<Object>{tmp22});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 57);
+    TNode<Numeric> tmp26;
+    USE(tmp26);
+    tmp26 = CodeStubAssembler(state_).LoadFixedTypedArrayElementAsTagged(TNode<RawPtrT>{tmp24}, TNode<Smi>{tmp25}, (KindForArrayType17ATFloat32Elements_393(state_)));
+    CodeStubAssembler(state_).Return(tmp26);
+  }
+}
+
+TF_BUILTIN(LoadJoinTypedElement17ATFloat64Elements, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<JSReceiver> parameter1 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<0>()));
+  USE(parameter1);
+  TNode<Number> parameter2 = UncheckedCast<Number>(Parameter(Descriptor::ParameterIndex<1>()));
+  USE(parameter2);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block4(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<Number> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 55);
+    TNode<JSTypedArray> tmp3;
+    USE(tmp3);
+    tmp3 = UnsafeCast12JSTypedArray_1375(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 56);
+    ca_.Goto(&block2, tmp0, tmp1, tmp2, tmp3);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp4;
+    TNode<JSReceiver> tmp5;
+    TNode<Number> tmp6;
+    TNode<JSTypedArray> tmp7;
+    ca_.Bind(&block1, &tmp4, &tmp5, &tmp6, &tmp7);
+    TNode<IntPtrT> tmp8 = ca_.IntPtrConstant(JSArrayBufferView::kBufferOffset);
+    USE(tmp8);
+    TNode<JSArrayBuffer>tmp9 = CodeStubAssembler(state_).LoadReference<JSArrayBuffer>(CodeStubAssembler::Reference{tmp7, tmp8});
+    TNode<BoolT> tmp10;
+    USE(tmp10);
+    tmp10 = CodeStubAssembler(state_).IsDetachedBuffer(TNode<JSArrayBuffer>{tmp9});
+    TNode<BoolT> tmp11;
+    USE(tmp11);
+    tmp11 = CodeStubAssembler(state_).Word32BinaryNot(TNode<BoolT>{tmp10});
+    ca_.Branch(tmp11, &block3, &block4, tmp4, tmp5, tmp6, tmp7);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp12;
+    TNode<JSReceiver> tmp13;
+    TNode<Number> tmp14;
+    TNode<JSTypedArray> tmp15;
+    ca_.Bind(&block4, &tmp12, &tmp13, &tmp14, &tmp15);
+    CodeStubAssembler(state_).FailAssert("Torque assert '!IsDetachedBuffer(typedArray.buffer)' failed", "../../deps/v8/src/builtins/array-join.tq", 56);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp16;
+    TNode<JSReceiver> tmp17;
+    TNode<Number> tmp18;
+    TNode<JSTypedArray> tmp19;
+    ca_.Bind(&block3, &tmp16, &tmp17, &tmp18, &tmp19);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp20;
+    TNode<JSReceiver> tmp21;
+    TNode<Number> tmp22;
+    TNode<JSTypedArray> tmp23;
+    ca_.Bind(&block2, &tmp20, &tmp21, &tmp22, &tmp23);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 58);
+    TNode<RawPtrT> tmp24;
+    USE(tmp24);
+    tmp24 = CodeStubAssembler(state_).LoadJSTypedArrayDataPtr(TNode<JSTypedArray>{tmp23});
+    TNode<Smi> tmp25;
+    USE(tmp25);
+    tmp25 = UnsafeCast5ATSmi_1371(state_, TNode<Context>{tmp20}, TNode<Object>{tmp22});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 57);
+    TNode<Numeric> tmp26;
+    USE(tmp26);
+    tmp26 = CodeStubAssembler(state_).LoadFixedTypedArrayElementAsTagged(TNode<RawPtrT>{tmp24}, TNode<Smi>{tmp25}, (KindForArrayType17ATFloat64Elements_394(state_)));
+    CodeStubAssembler(state_).Return(tmp26);
+  }
+}
+
+TF_BUILTIN(LoadJoinTypedElement22ATUint8ClampedElements, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<JSReceiver> parameter1 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<0>()));
+  USE(parameter1);
+  TNode<Number> parameter2 = UncheckedCast<Number>(Parameter(Descriptor::ParameterIndex<1>()));
+  USE(parameter2);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block4(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<Number> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 55);
+    TNode<JSTypedArray> tmp3;
+    USE(tmp3);
+    tmp3 = UnsafeCast12JSTypedArray_1375(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 56);
+    ca_.Goto(&block2, tmp0, tmp1, tmp2, tmp3);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp4;
+    TNode<JSReceiver> tmp5;
+    TNode<Number> tmp6;
+    TNode<JSTypedArray> tmp7;
+    ca_.Bind(&block1, &tmp4, &tmp5, &tmp6, &tmp7);
+    TNode<IntPtrT> tmp8 = ca_.IntPtrConstant(JSArrayBufferView::kBufferOffset);
+    USE(tmp8);
+    TNode<JSArrayBuffer>tmp9 = CodeStubAssembler(state_).LoadReference<JSArrayBuffer>(CodeStubAssembler::Reference{tmp7, tmp8});
+    TNode<BoolT> tmp10;
+    USE(tmp10);
+    tmp10 = CodeStubAssembler(state_).IsDetachedBuffer(TNode<JSArrayBuffer>{tmp9});
+    TNode<BoolT> tmp11;
+    USE(tmp11);
+    tmp11 = CodeStubAssembler(state_).Word32BinaryNot(TNode<BoolT>{tmp10});
+    ca_.Branch(tmp11, &block3, &block4, tmp4, tmp5, tmp6, tmp7);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp12;
+    TNode<JSReceiver> tmp13;
+    TNode<Number> tmp14;
+    TNode<JSTypedArray> tmp15;
+    ca_.Bind(&block4, &tmp12, &tmp13, &tmp14, &tmp15);
+    CodeStubAssembler(state_).FailAssert("Torque assert '!IsDetachedBuffer(typedArray.buffer)' failed", "../../deps/v8/src/builtins/array-join.tq", 56);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp16;
+    TNode<JSReceiver> tmp17;
+    TNode<Number> tmp18;
+    TNode<JSTypedArray> tmp19;
+    ca_.Bind(&block3, &tmp16, &tmp17, &tmp18, &tmp19);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp20;
+    TNode<JSReceiver> tmp21;
+    TNode<Number> tmp22;
+    TNode<JSTypedArray> tmp23;
+    ca_.Bind(&block2, &tmp20, &tmp21, &tmp22, &tmp23);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 58);
+    TNode<RawPtrT> tmp24;
+    USE(tmp24);
+    tmp24 = CodeStubAssembler(state_).LoadJSTypedArrayDataPtr(TNode<JSTypedArray>{tmp23});
+    TNode<Smi> tmp25;
+    USE(tmp25);
+    tmp25 = UnsafeCast5ATSmi_1371(state_, TNode<Context>{tmp20}, TNode<Object>{tmp22});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 57);
+    TNode<Numeric> tmp26;
+    USE(tmp26);
+    tmp26 = CodeStubAssembler(state_).LoadFixedTypedArrayElementAsTagged(TNode<RawPtrT>{tmp24}, TNode<Smi>{tmp25}, (KindForArrayType22ATUint8ClampedElements_395(state_)));
+    CodeStubAssembler(state_).Return(tmp26);
+  }
+}
+
+TF_BUILTIN(LoadJoinTypedElement19ATBigUint64Elements, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<JSReceiver> parameter1 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<0>()));
+  USE(parameter1);
+  TNode<Number> parameter2 = UncheckedCast<Number>(Parameter(Descriptor::ParameterIndex<1>()));
+  USE(parameter2);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block4(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<Number> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 55);
+    TNode<JSTypedArray> tmp3;
+    USE(tmp3);
+    tmp3 = UnsafeCast12JSTypedArray_1375(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 56);
+    ca_.Goto(&block2, tmp0, tmp1, tmp2, tmp3);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp4;
+    TNode<JSReceiver> tmp5;
+    TNode<Number> tmp6;
+    TNode<JSTypedArray> tmp7;
+    ca_.Bind(&block1, &tmp4, &tmp5, &tmp6, &tmp7);
+    TNode<IntPtrT> tmp8 = ca_.IntPtrConstant(JSArrayBufferView::kBufferOffset);
+    USE(tmp8);
+    TNode<JSArrayBuffer>tmp9 = CodeStubAssembler(state_).LoadReference<JSArrayBuffer>(CodeStubAssembler::Reference{tmp7, tmp8});
+    TNode<BoolT> tmp10;
+    USE(tmp10);
+    tmp10 = CodeStubAssembler(state_).IsDetachedBuffer(TNode<JSArrayBuffer>{tmp9});
+    TNode<BoolT> tmp11;
+    USE(tmp11);
+    tmp11 = CodeStubAssembler(state_).Word32BinaryNot(TNode<BoolT>{tmp10});
+    ca_.Branch(tmp11, &block3, &block4, tmp4, tmp5, tmp6, tmp7);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp12;
+    TNode<JSReceiver> tmp13;
+    TNode<Number> tmp14;
+    TNode<JSTypedArray> tmp15;
+    ca_.Bind(&block4, &tmp12, &tmp13, &tmp14, &tmp15);
+    CodeStubAssembler(state_).FailAssert("Torque assert '!IsDetachedBuffer(typedArray.buffer)' failed", "../../deps/v8/src/builtins/array-join.tq", 56);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp16;
+    TNode<JSReceiver> tmp17;
+    TNode<Number> tmp18;
+    TNode<JSTypedArray> tmp19;
+    ca_.Bind(&block3, &tmp16, &tmp17, &tmp18, &tmp19);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp20;
+    TNode<JSReceiver> tmp21;
+    TNode<Number> tmp22;
+    TNode<JSTypedArray> tmp23;
+    ca_.Bind(&block2, &tmp20, &tmp21, &tmp22, &tmp23);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 58);
+    TNode<RawPtrT> tmp24;
+    USE(tmp24);
+    tmp24 = CodeStubAssembler(state_).LoadJSTypedArrayDataPtr(TNode<JSTypedArray>{tmp23});
+    TNode<Smi> tmp25;
+    USE(tmp25);
+    tmp25 = UnsafeCast5ATSmi_1371(state_, TNode<Context>{tmp20}, TNode<Object>{tmp22});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 57);
+    TNode<Numeric> tmp26;
+    USE(tmp26);
+    tmp26 = CodeStubAssembler(state_).LoadFixedTypedArrayElementAsTagged(TNode<RawPtrT>{tmp24}, TNode<Smi>{tmp25}, (KindForArrayType19ATBigUint64Elements_396(state_)));
+    CodeStubAssembler(state_).Return(tmp26);
+  }
+}
+
+TF_BUILTIN(LoadJoinTypedElement18ATBigInt64Elements, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<JSReceiver> parameter1 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<0>()));
+  USE(parameter1);
+  TNode<Number> parameter2 = UncheckedCast<Number>(Parameter(Descriptor::ParameterIndex<1>()));
+  USE(parameter2);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block4(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<Number> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 55);
+    TNode<JSTypedArray> tmp3;
+    USE(tmp3);
+    tmp3 = UnsafeCast12JSTypedArray_1375(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 56);
+    ca_.Goto(&block2, tmp0, tmp1, tmp2, tmp3);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp4;
+    TNode<JSReceiver> tmp5;
+    TNode<Number> tmp6;
+    TNode<JSTypedArray> tmp7;
+    ca_.Bind(&block1, &tmp4, &tmp5, &tmp6, &tmp7);
+    TNode<IntPtrT> tmp8 = ca_.IntPtrConstant(JSArrayBufferView::kBufferOffset);
+    USE(tmp8);
+    TNode<JSArrayBuffer>tmp9 = CodeStubAssembler(state_).LoadReference<JSArrayBuffer>(CodeStubAssembler::Reference{tmp7, tmp8});
+    TNode<BoolT> tmp10;
+    USE(tmp10);
+    tmp10 = CodeStubAssembler(state_).IsDetachedBuffer(TNode<JSArrayBuffer>{tmp9});
+    TNode<BoolT> tmp11;
+    USE(tmp11);
+    tmp11 = CodeStubAssembler(state_).Word32BinaryNot(TNode<BoolT>{tmp10});
+    ca_.Branch(tmp11, &block3, &block4, tmp4, tmp5, tmp6, tmp7);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp12;
+    TNode<JSReceiver> tmp13;
+    TNode<Number> tmp14;
+    TNode<JSTypedArray> tmp15;
+    ca_.Bind(&block4, &tmp12, &tmp13, &tmp14, &tmp15);
+    CodeStubAssembler(state_).FailAssert("Torque assert '!IsDetachedBuffer(typedArray.buffer)' failed", "../../deps/v8/src/builtins/array-join.tq", 56);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp16;
+    TNode<JSReceiver> tmp17;
+    TNode<Number> tmp18;
+    TNode<JSTypedArray> tmp19;
+    ca_.Bind(&block3, &tmp16, &tmp17, &tmp18, &tmp19);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp20;
+    TNode<JSReceiver> tmp21;
+    TNode<Number> tmp22;
+    TNode<JSTypedArray> tmp23;
+    ca_.Bind(&block2, &tmp20, &tmp21, &tmp22, &tmp23);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 58);
+    TNode<RawPtrT> tmp24;
+    USE(tmp24);
+    tmp24 = CodeStubAssembler(state_).LoadJSTypedArrayDataPtr(TNode<JSTypedArray>{tmp23});
+    TNode<Smi> tmp25;
+    USE(tmp25);
+    tmp25 = UnsafeCast5ATSmi_1371(state_, TNode<Context>{tmp20}, TNode<Object>{tmp22});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 57);
+    TNode<Numeric> tmp26;
+    USE(tmp26);
+    tmp26 = CodeStubAssembler(state_).LoadFixedTypedArrayElementAsTagged(TNode<RawPtrT>{tmp24}, TNode<Smi>{tmp25}, (KindForArrayType18ATBigInt64Elements_397(state_)));
+    CodeStubAssembler(state_).Return(tmp26);
+  }
+}
+
+TF_BUILTIN(LoadJoinTypedElement15ATUint8Elements, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<JSReceiver> parameter1 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<0>()));
+  USE(parameter1);
+  TNode<Number> parameter2 = UncheckedCast<Number>(Parameter(Descriptor::ParameterIndex<1>()));
+  USE(parameter2);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block4(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<Number> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 55);
+    TNode<JSTypedArray> tmp3;
+    USE(tmp3);
+    tmp3 = UnsafeCast12JSTypedArray_1375(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 56);
+    ca_.Goto(&block2, tmp0, tmp1, tmp2, tmp3);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp4;
+    TNode<JSReceiver> tmp5;
+    TNode<Number> tmp6;
+    TNode<JSTypedArray> tmp7;
+    ca_.Bind(&block1, &tmp4, &tmp5, &tmp6, &tmp7);
+    TNode<IntPtrT> tmp8 = ca_.IntPtrConstant(JSArrayBufferView::kBufferOffset);
+    USE(tmp8);
+    TNode<JSArrayBuffer>tmp9 = CodeStubAssembler(state_).LoadReference<JSArrayBuffer>(CodeStubAssembler::Reference{tmp7, tmp8});
+    TNode<BoolT> tmp10;
+    USE(tmp10);
+    tmp10 = CodeStubAssembler(state_).IsDetachedBuffer(TNode<JSArrayBuffer>{tmp9});
+    TNode<BoolT> tmp11;
+    USE(tmp11);
+    tmp11 = CodeStubAssembler(state_).Word32BinaryNot(TNode<BoolT>{tmp10});
+    ca_.Branch(tmp11, &block3, &block4, tmp4, tmp5, tmp6, tmp7);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp12;
+    TNode<JSReceiver> tmp13;
+    TNode<Number> tmp14;
+    TNode<JSTypedArray> tmp15;
+    ca_.Bind(&block4, &tmp12, &tmp13, &tmp14, &tmp15);
+    CodeStubAssembler(state_).FailAssert("Torque assert '!IsDetachedBuffer(typedArray.buffer)' failed", "../../deps/v8/src/builtins/array-join.tq", 56);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp16;
+    TNode<JSReceiver> tmp17;
+    TNode<Number> tmp18;
+    TNode<JSTypedArray> tmp19;
+    ca_.Bind(&block3, &tmp16, &tmp17, &tmp18, &tmp19);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp20;
+    TNode<JSReceiver> tmp21;
+    TNode<Number> tmp22;
+    TNode<JSTypedArray> tmp23;
+    ca_.Bind(&block2, &tmp20, &tmp21, &tmp22, &tmp23);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 58);
+    TNode<RawPtrT> tmp24;
+    USE(tmp24);
+    tmp24 = CodeStubAssembler(state_).LoadJSTypedArrayDataPtr(TNode<JSTypedArray>{tmp23});
+    TNode<Smi> tmp25;
+    USE(tmp25);
+    tmp25 = UnsafeCast5ATSmi_1371(state_, TNode<Context>{tmp20}, TNode<Object>{tmp22});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 57);
+    TNode<Numeric> tmp26;
+    USE(tmp26);
+    tmp26 = CodeStubAssembler(state_).LoadFixedTypedArrayElementAsTagged(TNode<RawPtrT>{tmp24}, TNode<Smi>{tmp25}, (KindForArrayType15ATUint8Elements_387(state_)));
+    CodeStubAssembler(state_).Return(tmp26);
+  }
+}
+
+TF_BUILTIN(LoadJoinTypedElement14ATInt8Elements, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<JSReceiver> parameter1 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<0>()));
+  USE(parameter1);
+  TNode<Number> parameter2 = UncheckedCast<Number>(Parameter(Descriptor::ParameterIndex<1>()));
+  USE(parameter2);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block4(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<Number> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 55);
+    TNode<JSTypedArray> tmp3;
+    USE(tmp3);
+    tmp3 = UnsafeCast12JSTypedArray_1375(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 56);
+    ca_.Goto(&block2, tmp0, tmp1, tmp2, tmp3);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp4;
+    TNode<JSReceiver> tmp5;
+    TNode<Number> tmp6;
+    TNode<JSTypedArray> tmp7;
+    ca_.Bind(&block1, &tmp4, &tmp5, &tmp6, &tmp7);
+    TNode<IntPtrT> tmp8 = ca_.IntPtrConstant(JSArrayBufferView::kBufferOffset);
+    USE(tmp8);
+    TNode<JSArrayBuffer>tmp9 = CodeStubAssembler(state_).LoadReference<JSArrayBuffer>(CodeStubAssembler::Reference{tmp7, tmp8});
+    TNode<BoolT> tmp10;
+    USE(tmp10);
+    tmp10 = CodeStubAssembler(state_).IsDetachedBuffer(TNode<JSArrayBuffer>{tmp9});
+    TNode<BoolT> tmp11;
+    USE(tmp11);
+    tmp11 = CodeStubAssembler(state_).Word32BinaryNot(TNode<BoolT>{tmp10});
+    ca_.Branch(tmp11, &block3, &block4, tmp4, tmp5, tmp6, tmp7);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp12;
+    TNode<JSReceiver> tmp13;
+    TNode<Number> tmp14;
+    TNode<JSTypedArray> tmp15;
+    ca_.Bind(&block4, &tmp12, &tmp13, &tmp14, &tmp15);
+    CodeStubAssembler(state_).FailAssert("Torque assert '!IsDetachedBuffer(typedArray.buffer)' failed", "../../deps/v8/src/builtins/array-join.tq", 56);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp16;
+    TNode<JSReceiver> tmp17;
+    TNode<Number> tmp18;
+    TNode<JSTypedArray> tmp19;
+    ca_.Bind(&block3, &tmp16, &tmp17, &tmp18, &tmp19);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp20;
+    TNode<JSReceiver> tmp21;
+    TNode<Number> tmp22;
+    TNode<JSTypedArray> tmp23;
+    ca_.Bind(&block2, &tmp20, &tmp21, &tmp22, &tmp23);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 58);
+    TNode<RawPtrT> tmp24;
+    USE(tmp24);
+    tmp24 = CodeStubAssembler(state_).LoadJSTypedArrayDataPtr(TNode<JSTypedArray>{tmp23});
+    TNode<Smi> tmp25;
+    USE(tmp25);
+    tmp25 = UnsafeCast5ATSmi_1371(state_, TNode<Context>{tmp20}, TNode<Object>{tmp22});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 57);
+    TNode<Numeric> tmp26;
+    USE(tmp26);
+    tmp26 = CodeStubAssembler(state_).LoadFixedTypedArrayElementAsTagged(TNode<RawPtrT>{tmp24}, TNode<Smi>{tmp25}, (KindForArrayType14ATInt8Elements_388(state_)));
+    CodeStubAssembler(state_).Return(tmp26);
+  }
+}
+
+TF_BUILTIN(LoadJoinTypedElement16ATUint16Elements, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<JSReceiver> parameter1 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<0>()));
+  USE(parameter1);
+  TNode<Number> parameter2 = UncheckedCast<Number>(Parameter(Descriptor::ParameterIndex<1>()));
+  USE(parameter2);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block4(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<Number> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 55);
+    TNode<JSTypedArray> tmp3;
+    USE(tmp3);
+    tmp3 = UnsafeCast12JSTypedArray_1375(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 56);
+    ca_.Goto(&block2, tmp0, tmp1, tmp2, tmp3);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp4;
+    TNode<JSReceiver> tmp5;
+    TNode<Number> tmp6;
+    TNode<JSTypedArray> tmp7;
+    ca_.Bind(&block1, &tmp4, &tmp5, &tmp6, &tmp7);
+    TNode<IntPtrT> tmp8 = ca_.IntPtrConstant(JSArrayBufferView::kBufferOffset);
+    USE(tmp8);
+    TNode<JSArrayBuffer>tmp9 = CodeStubAssembler(state_).LoadReference<JSArrayBuffer>(CodeStubAssembler::Reference{tmp7, tmp8});
+    TNode<BoolT> tmp10;
+    USE(tmp10);
+    tmp10 = CodeStubAssembler(state_).IsDetachedBuffer(TNode<JSArrayBuffer>{tmp9});
+    TNode<BoolT> tmp11;
+    USE(tmp11);
+    tmp11 = CodeStubAssembler(state_).Word32BinaryNot(TNode<BoolT>{tmp10});
+    ca_.Branch(tmp11, &block3, &block4, tmp4, tmp5, tmp6, tmp7);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp12;
+    TNode<JSReceiver> tmp13;
+    TNode<Number> tmp14;
+    TNode<JSTypedArray> tmp15;
+    ca_.Bind(&block4, &tmp12, &tmp13, &tmp14, &tmp15);
+    CodeStubAssembler(state_).FailAssert("Torque assert '!IsDetachedBuffer(typedArray.buffer)' failed", "../../deps/v8/src/builtins/array-join.tq", 56);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp16;
+    TNode<JSReceiver> tmp17;
+    TNode<Number> tmp18;
+    TNode<JSTypedArray> tmp19;
+    ca_.Bind(&block3, &tmp16, &tmp17, &tmp18, &tmp19);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp20;
+    TNode<JSReceiver> tmp21;
+    TNode<Number> tmp22;
+    TNode<JSTypedArray> tmp23;
+    ca_.Bind(&block2, &tmp20, &tmp21, &tmp22, &tmp23);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 58);
+    TNode<RawPtrT> tmp24;
+    USE(tmp24);
+    tmp24 = CodeStubAssembler(state_).LoadJSTypedArrayDataPtr(TNode<JSTypedArray>{tmp23});
+    TNode<Smi> tmp25;
+    USE(tmp25);
+    tmp25 = UnsafeCast5ATSmi_1371(state_, TNode<Context>{tmp20}, TNode<Object>{tmp22});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 57);
+    TNode<Numeric> tmp26;
+    USE(tmp26);
+    tmp26 = CodeStubAssembler(state_).LoadFixedTypedArrayElementAsTagged(TNode<RawPtrT>{tmp24}, TNode<Smi>{tmp25}, (KindForArrayType16ATUint16Elements_389(state_)));
+    CodeStubAssembler(state_).Return(tmp26);
+  }
+}
+
+TF_BUILTIN(LoadJoinTypedElement15ATInt16Elements, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<JSReceiver> parameter1 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<0>()));
+  USE(parameter1);
+  TNode<Number> parameter2 = UncheckedCast<Number>(Parameter(Descriptor::ParameterIndex<1>()));
+  USE(parameter2);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block4(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<Number> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 55);
+    TNode<JSTypedArray> tmp3;
+    USE(tmp3);
+    tmp3 = UnsafeCast12JSTypedArray_1375(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 56);
+    ca_.Goto(&block2, tmp0, tmp1, tmp2, tmp3);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp4;
+    TNode<JSReceiver> tmp5;
+    TNode<Number> tmp6;
+    TNode<JSTypedArray> tmp7;
+    ca_.Bind(&block1, &tmp4, &tmp5, &tmp6, &tmp7);
+    TNode<IntPtrT> tmp8 = ca_.IntPtrConstant(JSArrayBufferView::kBufferOffset);
+    USE(tmp8);
+    TNode<JSArrayBuffer>tmp9 = CodeStubAssembler(state_).LoadReference<JSArrayBuffer>(CodeStubAssembler::Reference{tmp7, tmp8});
+    TNode<BoolT> tmp10;
+    USE(tmp10);
+    tmp10 = CodeStubAssembler(state_).IsDetachedBuffer(TNode<JSArrayBuffer>{tmp9});
+    TNode<BoolT> tmp11;
+    USE(tmp11);
+    tmp11 = CodeStubAssembler(state_).Word32BinaryNot(TNode<BoolT>{tmp10});
+    ca_.Branch(tmp11, &block3, &block4, tmp4, tmp5, tmp6, tmp7);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp12;
+    TNode<JSReceiver> tmp13;
+    TNode<Number> tmp14;
+    TNode<JSTypedArray> tmp15;
+    ca_.Bind(&block4, &tmp12, &tmp13, &tmp14, &tmp15);
+    CodeStubAssembler(state_).FailAssert("Torque assert '!IsDetachedBuffer(typedArray.buffer)' failed", "../../deps/v8/src/builtins/array-join.tq", 56);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp16;
+    TNode<JSReceiver> tmp17;
+    TNode<Number> tmp18;
+    TNode<JSTypedArray> tmp19;
+    ca_.Bind(&block3, &tmp16, &tmp17, &tmp18, &tmp19);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp20;
+    TNode<JSReceiver> tmp21;
+    TNode<Number> tmp22;
+    TNode<JSTypedArray> tmp23;
+    ca_.Bind(&block2, &tmp20, &tmp21, &tmp22, &tmp23);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 58);
+    TNode<RawPtrT> tmp24;
+    USE(tmp24);
+    tmp24 = CodeStubAssembler(state_).LoadJSTypedArrayDataPtr(TNode<JSTypedArray>{tmp23});
+    TNode<Smi> tmp25;
+    USE(tmp25);
+    tmp25 = UnsafeCast5ATSmi_1371(state_, TNode<Context>{tmp20}, TNode<Object>{tmp22});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 57);
+    TNode<Numeric> tmp26;
+    USE(tmp26);
+    tmp26 = CodeStubAssembler(state_).LoadFixedTypedArrayElementAsTagged(TNode<RawPtrT>{tmp24}, TNode<Smi>{tmp25}, (KindForArrayType15ATInt16Elements_390(state_)));
+    CodeStubAssembler(state_).Return(tmp26);
+  }
+}
+
+TF_BUILTIN(LoadJoinTypedElement16ATUint32Elements, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<JSReceiver> parameter1 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<0>()));
+  USE(parameter1);
+  TNode<Number> parameter2 = UncheckedCast<Number>(Parameter(Descriptor::ParameterIndex<1>()));
+  USE(parameter2);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block4(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSTypedArray> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<Number> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 55);
+    TNode<JSTypedArray> tmp3;
+    USE(tmp3);
+    tmp3 = UnsafeCast12JSTypedArray_1375(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 56);
+    ca_.Goto(&block2, tmp0, tmp1, tmp2, tmp3);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp4;
+    TNode<JSReceiver> tmp5;
+    TNode<Number> tmp6;
+    TNode<JSTypedArray> tmp7;
+    ca_.Bind(&block1, &tmp4, &tmp5, &tmp6, &tmp7);
+    TNode<IntPtrT> tmp8 = ca_.IntPtrConstant(JSArrayBufferView::kBufferOffset);
+    USE(tmp8);
+    TNode<JSArrayBuffer>tmp9 = CodeStubAssembler(state_).LoadReference<JSArrayBuffer>(CodeStubAssembler::Reference{tmp7, tmp8});
+    TNode<BoolT> tmp10;
+    USE(tmp10);
+    tmp10 = CodeStubAssembler(state_).IsDetachedBuffer(TNode<JSArrayBuffer>{tmp9});
+    TNode<BoolT> tmp11;
+    USE(tmp11);
+    tmp11 = CodeStubAssembler(state_).Word32BinaryNot(TNode<BoolT>{tmp10});
+    ca_.Branch(tmp11, &block3, &block4, tmp4, tmp5, tmp6, tmp7);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp12;
+    TNode<JSReceiver> tmp13;
+    TNode<Number> tmp14;
+    TNode<JSTypedArray> tmp15;
+    ca_.Bind(&block4, &tmp12, &tmp13, &tmp14, &tmp15);
+    CodeStubAssembler(state_).FailAssert("Torque assert '!IsDetachedBuffer(typedArray.buffer)' failed", "../../deps/v8/src/builtins/array-join.tq", 56);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp16;
+    TNode<JSReceiver> tmp17;
+    TNode<Number> tmp18;
+    TNode<JSTypedArray> tmp19;
+    ca_.Bind(&block3, &tmp16, &tmp17, &tmp18, &tmp19);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp20;
+    TNode<JSReceiver> tmp21;
+    TNode<Number> tmp22;
+    TNode<JSTypedArray> tmp23;
+    ca_.Bind(&block2, &tmp20, &tmp21, &tmp22, &tmp23);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 58);
+    TNode<RawPtrT> tmp24;
+    USE(tmp24);
+    tmp24 = CodeStubAssembler(state_).LoadJSTypedArrayDataPtr(TNode<JSTypedArray>{tmp23});
+    TNode<Smi> tmp25;
+    USE(tmp25);
+    tmp25 = UnsafeCast5ATSmi_1371(state_, TNode<Context>{tmp20}, TNode<Object>{tmp22});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 57);
+    TNode<Numeric> tmp26;
+    USE(tmp26);
+    tmp26 = CodeStubAssembler(state_).LoadFixedTypedArrayElementAsTagged(TNode<RawPtrT>{tmp24}, TNode<Smi>{tmp25}, (KindForArrayType16ATUint32Elements_391(state_)));
+    CodeStubAssembler(state_).Return(tmp26);
+  }
+}
+
+TNode<String> ArrayJoinImpl12JSTypedArray_1379(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<JSReceiver> p_receiver, TNode<String> p_sep, TNode<Number> p_lengthNumber, bool p_useToLocaleString, TNode<Object> p_locales, TNode<Object> p_options, TNode<BuiltinPtr> p_initialLoadFn) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT> block5(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, Object, Object> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, Object, Object, String> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, Object, String> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, Object, String> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, Object> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, Object, Object> block23(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, Object, Object, Number> block22(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, Object> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, Object, Object> block24(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, Object, Object> block25(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, Object> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, Object> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, String, IntPtrT, IntPtrT, Context, String, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT, BoolT, Context, IntPtrT, IntPtrT, BoolT, BoolT> block30(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, String, IntPtrT, IntPtrT, Context, String, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT, BoolT, Context, IntPtrT, IntPtrT, BoolT, BoolT> block31(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, String, IntPtrT, IntPtrT, Context, String, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT, BoolT, Context, IntPtrT, IntPtrT, BoolT, BoolT, BoolT> block32(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, String, IntPtrT, IntPtrT, Context, String, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT, BoolT, Context, IntPtrT, IntPtrT, BoolT> block28(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, String, IntPtrT, IntPtrT, Context, String, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT, BoolT, Context, IntPtrT, IntPtrT, BoolT> block29(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, String, IntPtrT, IntPtrT, Context, String, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT, BoolT, Context, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT> block33(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, String, IntPtrT, IntPtrT, Context, String, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT, BoolT, Context, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT> block34(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, String, IntPtrT, IntPtrT, Context, String, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT, BoolT, Context, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT> block35(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, String, IntPtrT, IntPtrT, Context, String, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT, BoolT, Context, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT> block36(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, String, IntPtrT, IntPtrT, Context, String, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT, BoolT, Context, IntPtrT, IntPtrT, BoolT> block27(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, Object, String, String, IntPtrT, IntPtrT, Context, String, IntPtrT, IntPtrT> block26(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, IntPtrT, IntPtrT, Context, IntPtrT, IntPtrT, BoolT, BoolT> block40(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, IntPtrT, IntPtrT, Context, IntPtrT, IntPtrT, BoolT, BoolT> block41(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, IntPtrT, IntPtrT, Context, IntPtrT, IntPtrT, BoolT, BoolT, BoolT> block42(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, IntPtrT, IntPtrT, Context, IntPtrT, IntPtrT, BoolT> block38(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, IntPtrT, IntPtrT, Context, IntPtrT, IntPtrT, BoolT> block39(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, IntPtrT, IntPtrT, Context, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT> block43(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, IntPtrT, IntPtrT, Context, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT> block44(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, IntPtrT, IntPtrT, Context, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT> block45(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, IntPtrT, IntPtrT, Context, IntPtrT, IntPtrT, BoolT, IntPtrT, IntPtrT> block46(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, Map, UintPtrT, IntPtrT, IntPtrT, BuiltinPtr, FixedArray, IntPtrT, IntPtrT, BoolT, UintPtrT, IntPtrT, IntPtrT, Context, IntPtrT, IntPtrT, BoolT> block37(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, String> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Number, Object, Object, BuiltinPtr, String> block47(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_receiver, p_sep, p_lengthNumber, p_locales, p_options, p_initialLoadFn);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<String> tmp2;
+    TNode<Number> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    TNode<BuiltinPtr> tmp6;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4, &tmp5, &tmp6);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 262);
+    TNode<IntPtrT> tmp7 = ca_.IntPtrConstant(HeapObject::kMapOffset);
+    USE(tmp7);
+    TNode<Map>tmp8 = CodeStubAssembler(state_).LoadReference<Map>(CodeStubAssembler::Reference{tmp1, tmp7});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 263);
+    TNode<UintPtrT> tmp9;
+    USE(tmp9);
+    tmp9 = Convert9ATuintptr20UT5ATSmi10HeapNumber_198(state_, TNode<Number>{tmp3});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 264);
+    TNode<IntPtrT> tmp10;
+    USE(tmp10);
+    tmp10 = CodeStubAssembler(state_).LoadStringLengthAsWord(TNode<String>{tmp2});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 265);
+    TNode<IntPtrT> tmp11;
+    USE(tmp11);
+    tmp11 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 266);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 267);
+    TNode<FixedArray> tmp12;
+    USE(tmp12);
+    TNode<IntPtrT> tmp13;
+    USE(tmp13);
+    TNode<IntPtrT> tmp14;
+    USE(tmp14);
+    TNode<BoolT> tmp15;
+    USE(tmp15);
+    std::tie(tmp12, tmp13, tmp14, tmp15) = NewBuffer_11(state_, TNode<UintPtrT>{tmp9}, TNode<String>{tmp2}).Flatten();
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 270);
+    TNode<UintPtrT> tmp16;
+    USE(tmp16);
+    tmp16 = FromConstexpr9ATuintptr17ATconstexpr_int31_165(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 273);
+    ca_.Goto(&block4, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp8, tmp9, tmp10, tmp11, tmp6, tmp12, tmp13, tmp14, tmp15, tmp16);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp17;
+    TNode<JSReceiver> tmp18;
+    TNode<String> tmp19;
+    TNode<Number> tmp20;
+    TNode<Object> tmp21;
+    TNode<Object> tmp22;
+    TNode<BuiltinPtr> tmp23;
+    TNode<Map> tmp24;
+    TNode<UintPtrT> tmp25;
+    TNode<IntPtrT> tmp26;
+    TNode<IntPtrT> tmp27;
+    TNode<BuiltinPtr> tmp28;
+    TNode<FixedArray> tmp29;
+    TNode<IntPtrT> tmp30;
+    TNode<IntPtrT> tmp31;
+    TNode<BoolT> tmp32;
+    TNode<UintPtrT> tmp33;
+    ca_.Bind(&block4, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33);
+    TNode<BoolT> tmp34;
+    USE(tmp34);
+    tmp34 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp33}, TNode<UintPtrT>{tmp25});
+    ca_.Branch(tmp34, &block2, &block3, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27, tmp28, tmp29, tmp30, tmp31, tmp32, tmp33);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp35;
+    TNode<JSReceiver> tmp36;
+    TNode<String> tmp37;
+    TNode<Number> tmp38;
+    TNode<Object> tmp39;
+    TNode<Object> tmp40;
+    TNode<BuiltinPtr> tmp41;
+    TNode<Map> tmp42;
+    TNode<UintPtrT> tmp43;
+    TNode<IntPtrT> tmp44;
+    TNode<IntPtrT> tmp45;
+    TNode<BuiltinPtr> tmp46;
+    TNode<FixedArray> tmp47;
+    TNode<IntPtrT> tmp48;
+    TNode<IntPtrT> tmp49;
+    TNode<BoolT> tmp50;
+    TNode<UintPtrT> tmp51;
+    ca_.Bind(&block2, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 275);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 274);
+    TNode<BoolT> tmp52;
+    USE(tmp52);
+    tmp52 = CannotUseSameArrayAccessor12JSTypedArray_9(state_, TNode<Context>{tmp35}, TNode<BuiltinPtr>{tmp46}, TNode<JSReceiver>{tmp36}, TNode<Map>{tmp42}, TNode<Number>{tmp38});
+    ca_.Branch(tmp52, &block5, &block6, tmp35, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42, tmp43, tmp44, tmp45, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp53;
+    TNode<JSReceiver> tmp54;
+    TNode<String> tmp55;
+    TNode<Number> tmp56;
+    TNode<Object> tmp57;
+    TNode<Object> tmp58;
+    TNode<BuiltinPtr> tmp59;
+    TNode<Map> tmp60;
+    TNode<UintPtrT> tmp61;
+    TNode<IntPtrT> tmp62;
+    TNode<IntPtrT> tmp63;
+    TNode<BuiltinPtr> tmp64;
+    TNode<FixedArray> tmp65;
+    TNode<IntPtrT> tmp66;
+    TNode<IntPtrT> tmp67;
+    TNode<BoolT> tmp68;
+    TNode<UintPtrT> tmp69;
+    ca_.Bind(&block5, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 277);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 274);
+    ca_.Goto(&block6, tmp53, tmp54, tmp55, tmp56, tmp57, tmp58, tmp59, tmp60, tmp61, tmp62, tmp63, ca_.UncheckedCast<BuiltinPtr>(ca_.SmiConstant(Builtins::kLoadJoinElement25ATGenericElementsAccessor)), tmp65, tmp66, tmp67, tmp68, tmp69);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp70;
+    TNode<JSReceiver> tmp71;
+    TNode<String> tmp72;
+    TNode<Number> tmp73;
+    TNode<Object> tmp74;
+    TNode<Object> tmp75;
+    TNode<BuiltinPtr> tmp76;
+    TNode<Map> tmp77;
+    TNode<UintPtrT> tmp78;
+    TNode<IntPtrT> tmp79;
+    TNode<IntPtrT> tmp80;
+    TNode<BuiltinPtr> tmp81;
+    TNode<FixedArray> tmp82;
+    TNode<IntPtrT> tmp83;
+    TNode<IntPtrT> tmp84;
+    TNode<BoolT> tmp85;
+    TNode<UintPtrT> tmp86;
+    ca_.Bind(&block6, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 280);
+    TNode<UintPtrT> tmp87;
+    USE(tmp87);
+    tmp87 = FromConstexpr9ATuintptr17ATconstexpr_int31_165(state_, 0);
+    TNode<BoolT> tmp88;
+    USE(tmp88);
+    tmp88 = CodeStubAssembler(state_).UintPtrGreaterThan(TNode<UintPtrT>{tmp86}, TNode<UintPtrT>{tmp87});
+    ca_.Branch(tmp88, &block7, &block8, tmp70, tmp71, tmp72, tmp73, tmp74, tmp75, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, tmp83, tmp84, tmp85, tmp86);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp89;
+    TNode<JSReceiver> tmp90;
+    TNode<String> tmp91;
+    TNode<Number> tmp92;
+    TNode<Object> tmp93;
+    TNode<Object> tmp94;
+    TNode<BuiltinPtr> tmp95;
+    TNode<Map> tmp96;
+    TNode<UintPtrT> tmp97;
+    TNode<IntPtrT> tmp98;
+    TNode<IntPtrT> tmp99;
+    TNode<BuiltinPtr> tmp100;
+    TNode<FixedArray> tmp101;
+    TNode<IntPtrT> tmp102;
+    TNode<IntPtrT> tmp103;
+    TNode<BoolT> tmp104;
+    TNode<UintPtrT> tmp105;
+    ca_.Bind(&block7, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104, &tmp105);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 282);
+    TNode<IntPtrT> tmp106;
+    USE(tmp106);
+    tmp106 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<IntPtrT> tmp107;
+    USE(tmp107);
+    tmp107 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp99}, TNode<IntPtrT>{tmp106});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 280);
+    ca_.Goto(&block8, tmp89, tmp90, tmp91, tmp92, tmp93, tmp94, tmp95, tmp96, tmp97, tmp98, tmp107, tmp100, tmp101, tmp102, tmp103, tmp104, tmp105);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp108;
+    TNode<JSReceiver> tmp109;
+    TNode<String> tmp110;
+    TNode<Number> tmp111;
+    TNode<Object> tmp112;
+    TNode<Object> tmp113;
+    TNode<BuiltinPtr> tmp114;
+    TNode<Map> tmp115;
+    TNode<UintPtrT> tmp116;
+    TNode<IntPtrT> tmp117;
+    TNode<IntPtrT> tmp118;
+    TNode<BuiltinPtr> tmp119;
+    TNode<FixedArray> tmp120;
+    TNode<IntPtrT> tmp121;
+    TNode<IntPtrT> tmp122;
+    TNode<BoolT> tmp123;
+    TNode<UintPtrT> tmp124;
+    ca_.Bind(&block8, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115, &tmp116, &tmp117, &tmp118, &tmp119, &tmp120, &tmp121, &tmp122, &tmp123, &tmp124);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 286);
+    TNode<UintPtrT> tmp125;
+    USE(tmp125);
+    tmp125 = FromConstexpr9ATuintptr17ATconstexpr_int31_165(state_, 1);
+    TNode<UintPtrT> tmp126;
+    USE(tmp126);
+    tmp126 = CodeStubAssembler(state_).UintPtrAdd(TNode<UintPtrT>{tmp124}, TNode<UintPtrT>{tmp125});
+    TNode<Number> tmp127;
+    USE(tmp127);
+    tmp127 = Convert20UT5ATSmi10HeapNumber9ATuintptr_204(state_, TNode<UintPtrT>{tmp124});
+    TNode<Object> tmp128 = CodeStubAssembler(state_).CallBuiltinPointer(Builtins::CallableFor(ca_.isolate(),ExampleBuiltinForTorqueFunctionPointerType(0)).descriptor(), tmp119, tmp108, tmp109, tmp127); 
+    USE(tmp128);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 290);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 291);
+    if ((p_useToLocaleString)) {
+      ca_.Goto(&block9, tmp108, tmp109, tmp110, tmp111, tmp112, tmp113, tmp114, tmp115, tmp116, tmp117, tmp118, tmp119, tmp120, tmp121, tmp122, tmp123, tmp126, tmp128, ca_.Uninitialized<String>());
+    } else {
+      ca_.Goto(&block10, tmp108, tmp109, tmp110, tmp111, tmp112, tmp113, tmp114, tmp115, tmp116, tmp117, tmp118, tmp119, tmp120, tmp121, tmp122, tmp123, tmp126, tmp128, ca_.Uninitialized<String>());
+    }
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp129;
+    TNode<JSReceiver> tmp130;
+    TNode<String> tmp131;
+    TNode<Number> tmp132;
+    TNode<Object> tmp133;
+    TNode<Object> tmp134;
+    TNode<BuiltinPtr> tmp135;
+    TNode<Map> tmp136;
+    TNode<UintPtrT> tmp137;
+    TNode<IntPtrT> tmp138;
+    TNode<IntPtrT> tmp139;
+    TNode<BuiltinPtr> tmp140;
+    TNode<FixedArray> tmp141;
+    TNode<IntPtrT> tmp142;
+    TNode<IntPtrT> tmp143;
+    TNode<BoolT> tmp144;
+    TNode<UintPtrT> tmp145;
+    TNode<Object> tmp146;
+    TNode<String> tmp147;
+    ca_.Bind(&block9, &tmp129, &tmp130, &tmp131, &tmp132, &tmp133, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138, &tmp139, &tmp140, &tmp141, &tmp142, &tmp143, &tmp144, &tmp145, &tmp146, &tmp147);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 292);
+    TNode<String> tmp148;
+    tmp148 = TORQUE_CAST(CodeStubAssembler(state_).CallBuiltin(Builtins::kConvertToLocaleString, tmp129, tmp146, tmp133, tmp134));
+    USE(tmp148);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 293);
+    TNode<String> tmp149;
+    USE(tmp149);
+    tmp149 = kEmptyString_67(state_);
+    TNode<BoolT> tmp150;
+    USE(tmp150);
+    tmp150 = CodeStubAssembler(state_).TaggedEqual(TNode<Object>{tmp148}, TNode<HeapObject>{tmp149});
+    ca_.Branch(tmp150, &block12, &block13, tmp129, tmp130, tmp131, tmp132, tmp133, tmp134, tmp135, tmp136, tmp137, tmp138, tmp139, tmp140, tmp141, tmp142, tmp143, tmp144, tmp145, tmp146, tmp148);
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp151;
+    TNode<JSReceiver> tmp152;
+    TNode<String> tmp153;
+    TNode<Number> tmp154;
+    TNode<Object> tmp155;
+    TNode<Object> tmp156;
+    TNode<BuiltinPtr> tmp157;
+    TNode<Map> tmp158;
+    TNode<UintPtrT> tmp159;
+    TNode<IntPtrT> tmp160;
+    TNode<IntPtrT> tmp161;
+    TNode<BuiltinPtr> tmp162;
+    TNode<FixedArray> tmp163;
+    TNode<IntPtrT> tmp164;
+    TNode<IntPtrT> tmp165;
+    TNode<BoolT> tmp166;
+    TNode<UintPtrT> tmp167;
+    TNode<Object> tmp168;
+    TNode<String> tmp169;
+    ca_.Bind(&block12, &tmp151, &tmp152, &tmp153, &tmp154, &tmp155, &tmp156, &tmp157, &tmp158, &tmp159, &tmp160, &tmp161, &tmp162, &tmp163, &tmp164, &tmp165, &tmp166, &tmp167, &tmp168, &tmp169);
+    ca_.Goto(&block4, tmp151, tmp152, tmp153, tmp154, tmp155, tmp156, tmp157, tmp158, tmp159, tmp160, tmp161, tmp162, tmp163, tmp164, tmp165, tmp166, tmp167);
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp170;
+    TNode<JSReceiver> tmp171;
+    TNode<String> tmp172;
+    TNode<Number> tmp173;
+    TNode<Object> tmp174;
+    TNode<Object> tmp175;
+    TNode<BuiltinPtr> tmp176;
+    TNode<Map> tmp177;
+    TNode<UintPtrT> tmp178;
+    TNode<IntPtrT> tmp179;
+    TNode<IntPtrT> tmp180;
+    TNode<BuiltinPtr> tmp181;
+    TNode<FixedArray> tmp182;
+    TNode<IntPtrT> tmp183;
+    TNode<IntPtrT> tmp184;
+    TNode<BoolT> tmp185;
+    TNode<UintPtrT> tmp186;
+    TNode<Object> tmp187;
+    TNode<String> tmp188;
+    ca_.Bind(&block13, &tmp170, &tmp171, &tmp172, &tmp173, &tmp174, &tmp175, &tmp176, &tmp177, &tmp178, &tmp179, &tmp180, &tmp181, &tmp182, &tmp183, &tmp184, &tmp185, &tmp186, &tmp187, &tmp188);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 291);
+    ca_.Goto(&block11, tmp170, tmp171, tmp172, tmp173, tmp174, tmp175, tmp176, tmp177, tmp178, tmp179, tmp180, tmp181, tmp182, tmp183, tmp184, tmp185, tmp186, tmp187, tmp188);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp189;
+    TNode<JSReceiver> tmp190;
+    TNode<String> tmp191;
+    TNode<Number> tmp192;
+    TNode<Object> tmp193;
+    TNode<Object> tmp194;
+    TNode<BuiltinPtr> tmp195;
+    TNode<Map> tmp196;
+    TNode<UintPtrT> tmp197;
+    TNode<IntPtrT> tmp198;
+    TNode<IntPtrT> tmp199;
+    TNode<BuiltinPtr> tmp200;
+    TNode<FixedArray> tmp201;
+    TNode<IntPtrT> tmp202;
+    TNode<IntPtrT> tmp203;
+    TNode<BoolT> tmp204;
+    TNode<UintPtrT> tmp205;
+    TNode<Object> tmp206;
+    TNode<String> tmp207;
+    ca_.Bind(&block10, &tmp189, &tmp190, &tmp191, &tmp192, &tmp193, &tmp194, &tmp195, &tmp196, &tmp197, &tmp198, &tmp199, &tmp200, &tmp201, &tmp202, &tmp203, &tmp204, &tmp205, &tmp206, &tmp207);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 295);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 296);
+    TNode<String> tmp208;
+    USE(tmp208);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp208 = Cast6String_1377(state_, TNode<Context>{tmp189}, TNode<Object>{tmp206}, &label0);
+    ca_.Goto(&block16, tmp189, tmp190, tmp191, tmp192, tmp193, tmp194, tmp195, tmp196, tmp197, tmp198, tmp199, tmp200, tmp201, tmp202, tmp203, tmp204, tmp205, tmp206, tmp207, tmp206, tmp206, tmp208);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block17, tmp189, tmp190, tmp191, tmp192, tmp193, tmp194, tmp195, tmp196, tmp197, tmp198, tmp199, tmp200, tmp201, tmp202, tmp203, tmp204, tmp205, tmp206, tmp207, tmp206, tmp206);
+    }
+  }
+
+  if (block17.is_used()) {
+    TNode<Context> tmp209;
+    TNode<JSReceiver> tmp210;
+    TNode<String> tmp211;
+    TNode<Number> tmp212;
+    TNode<Object> tmp213;
+    TNode<Object> tmp214;
+    TNode<BuiltinPtr> tmp215;
+    TNode<Map> tmp216;
+    TNode<UintPtrT> tmp217;
+    TNode<IntPtrT> tmp218;
+    TNode<IntPtrT> tmp219;
+    TNode<BuiltinPtr> tmp220;
+    TNode<FixedArray> tmp221;
+    TNode<IntPtrT> tmp222;
+    TNode<IntPtrT> tmp223;
+    TNode<BoolT> tmp224;
+    TNode<UintPtrT> tmp225;
+    TNode<Object> tmp226;
+    TNode<String> tmp227;
+    TNode<Object> tmp228;
+    TNode<Object> tmp229;
+    ca_.Bind(&block17, &tmp209, &tmp210, &tmp211, &tmp212, &tmp213, &tmp214, &tmp215, &tmp216, &tmp217, &tmp218, &tmp219, &tmp220, &tmp221, &tmp222, &tmp223, &tmp224, &tmp225, &tmp226, &tmp227, &tmp228, &tmp229);
+    ca_.Goto(&block15, tmp209, tmp210, tmp211, tmp212, tmp213, tmp214, tmp215, tmp216, tmp217, tmp218, tmp219, tmp220, tmp221, tmp222, tmp223, tmp224, tmp225, tmp226, tmp227, tmp228);
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp230;
+    TNode<JSReceiver> tmp231;
+    TNode<String> tmp232;
+    TNode<Number> tmp233;
+    TNode<Object> tmp234;
+    TNode<Object> tmp235;
+    TNode<BuiltinPtr> tmp236;
+    TNode<Map> tmp237;
+    TNode<UintPtrT> tmp238;
+    TNode<IntPtrT> tmp239;
+    TNode<IntPtrT> tmp240;
+    TNode<BuiltinPtr> tmp241;
+    TNode<FixedArray> tmp242;
+    TNode<IntPtrT> tmp243;
+    TNode<IntPtrT> tmp244;
+    TNode<BoolT> tmp245;
+    TNode<UintPtrT> tmp246;
+    TNode<Object> tmp247;
+    TNode<String> tmp248;
+    TNode<Object> tmp249;
+    TNode<Object> tmp250;
+    TNode<String> tmp251;
+    ca_.Bind(&block16, &tmp230, &tmp231, &tmp232, &tmp233, &tmp234, &tmp235, &tmp236, &tmp237, &tmp238, &tmp239, &tmp240, &tmp241, &tmp242, &tmp243, &tmp244, &tmp245, &tmp246, &tmp247, &tmp248, &tmp249, &tmp250, &tmp251);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 297);
+    TNode<String> tmp252;
+    USE(tmp252);
+    tmp252 = kEmptyString_67(state_);
+    TNode<BoolT> tmp253;
+    USE(tmp253);
+    tmp253 = CodeStubAssembler(state_).TaggedEqual(TNode<Object>{tmp251}, TNode<HeapObject>{tmp252});
+    ca_.Branch(tmp253, &block18, &block19, tmp230, tmp231, tmp232, tmp233, tmp234, tmp235, tmp236, tmp237, tmp238, tmp239, tmp240, tmp241, tmp242, tmp243, tmp244, tmp245, tmp246, tmp247, tmp248, tmp249, tmp251);
+  }
+
+  if (block18.is_used()) {
+    TNode<Context> tmp254;
+    TNode<JSReceiver> tmp255;
+    TNode<String> tmp256;
+    TNode<Number> tmp257;
+    TNode<Object> tmp258;
+    TNode<Object> tmp259;
+    TNode<BuiltinPtr> tmp260;
+    TNode<Map> tmp261;
+    TNode<UintPtrT> tmp262;
+    TNode<IntPtrT> tmp263;
+    TNode<IntPtrT> tmp264;
+    TNode<BuiltinPtr> tmp265;
+    TNode<FixedArray> tmp266;
+    TNode<IntPtrT> tmp267;
+    TNode<IntPtrT> tmp268;
+    TNode<BoolT> tmp269;
+    TNode<UintPtrT> tmp270;
+    TNode<Object> tmp271;
+    TNode<String> tmp272;
+    TNode<Object> tmp273;
+    TNode<String> tmp274;
+    ca_.Bind(&block18, &tmp254, &tmp255, &tmp256, &tmp257, &tmp258, &tmp259, &tmp260, &tmp261, &tmp262, &tmp263, &tmp264, &tmp265, &tmp266, &tmp267, &tmp268, &tmp269, &tmp270, &tmp271, &tmp272, &tmp273, &tmp274);
+    ca_.Goto(&block4, tmp254, tmp255, tmp256, tmp257, tmp258, tmp259, tmp260, tmp261, tmp262, tmp263, tmp264, tmp265, tmp266, tmp267, tmp268, tmp269, tmp270);
+  }
+
+  if (block19.is_used()) {
+    TNode<Context> tmp275;
+    TNode<JSReceiver> tmp276;
+    TNode<String> tmp277;
+    TNode<Number> tmp278;
+    TNode<Object> tmp279;
+    TNode<Object> tmp280;
+    TNode<BuiltinPtr> tmp281;
+    TNode<Map> tmp282;
+    TNode<UintPtrT> tmp283;
+    TNode<IntPtrT> tmp284;
+    TNode<IntPtrT> tmp285;
+    TNode<BuiltinPtr> tmp286;
+    TNode<FixedArray> tmp287;
+    TNode<IntPtrT> tmp288;
+    TNode<IntPtrT> tmp289;
+    TNode<BoolT> tmp290;
+    TNode<UintPtrT> tmp291;
+    TNode<Object> tmp292;
+    TNode<String> tmp293;
+    TNode<Object> tmp294;
+    TNode<String> tmp295;
+    ca_.Bind(&block19, &tmp275, &tmp276, &tmp277, &tmp278, &tmp279, &tmp280, &tmp281, &tmp282, &tmp283, &tmp284, &tmp285, &tmp286, &tmp287, &tmp288, &tmp289, &tmp290, &tmp291, &tmp292, &tmp293, &tmp294, &tmp295);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 298);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 296);
+    ca_.Goto(&block14, tmp275, tmp276, tmp277, tmp278, tmp279, tmp280, tmp281, tmp282, tmp283, tmp284, tmp285, tmp286, tmp287, tmp288, tmp289, tmp290, tmp291, tmp292, tmp295, tmp294);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp296;
+    TNode<JSReceiver> tmp297;
+    TNode<String> tmp298;
+    TNode<Number> tmp299;
+    TNode<Object> tmp300;
+    TNode<Object> tmp301;
+    TNode<BuiltinPtr> tmp302;
+    TNode<Map> tmp303;
+    TNode<UintPtrT> tmp304;
+    TNode<IntPtrT> tmp305;
+    TNode<IntPtrT> tmp306;
+    TNode<BuiltinPtr> tmp307;
+    TNode<FixedArray> tmp308;
+    TNode<IntPtrT> tmp309;
+    TNode<IntPtrT> tmp310;
+    TNode<BoolT> tmp311;
+    TNode<UintPtrT> tmp312;
+    TNode<Object> tmp313;
+    TNode<String> tmp314;
+    TNode<Object> tmp315;
+    ca_.Bind(&block15, &tmp296, &tmp297, &tmp298, &tmp299, &tmp300, &tmp301, &tmp302, &tmp303, &tmp304, &tmp305, &tmp306, &tmp307, &tmp308, &tmp309, &tmp310, &tmp311, &tmp312, &tmp313, &tmp314, &tmp315);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 300);
+    TNode<Number> tmp316;
+    USE(tmp316);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp316 = Cast20UT5ATSmi10HeapNumber_85(state_, TNode<Object>{ca_.UncheckedCast<Object>(tmp315)}, &label0);
+    ca_.Goto(&block22, tmp296, tmp297, tmp298, tmp299, tmp300, tmp301, tmp302, tmp303, tmp304, tmp305, tmp306, tmp307, tmp308, tmp309, tmp310, tmp311, tmp312, tmp313, tmp314, tmp315, ca_.UncheckedCast<Object>(tmp315), tmp316);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block23, tmp296, tmp297, tmp298, tmp299, tmp300, tmp301, tmp302, tmp303, tmp304, tmp305, tmp306, tmp307, tmp308, tmp309, tmp310, tmp311, tmp312, tmp313, tmp314, tmp315, ca_.UncheckedCast<Object>(tmp315));
+    }
+  }
+
+  if (block23.is_used()) {
+    TNode<Context> tmp317;
+    TNode<JSReceiver> tmp318;
+    TNode<String> tmp319;
+    TNode<Number> tmp320;
+    TNode<Object> tmp321;
+    TNode<Object> tmp322;
+    TNode<BuiltinPtr> tmp323;
+    TNode<Map> tmp324;
+    TNode<UintPtrT> tmp325;
+    TNode<IntPtrT> tmp326;
+    TNode<IntPtrT> tmp327;
+    TNode<BuiltinPtr> tmp328;
+    TNode<FixedArray> tmp329;
+    TNode<IntPtrT> tmp330;
+    TNode<IntPtrT> tmp331;
+    TNode<BoolT> tmp332;
+    TNode<UintPtrT> tmp333;
+    TNode<Object> tmp334;
+    TNode<String> tmp335;
+    TNode<Object> tmp336;
+    TNode<Object> tmp337;
+    ca_.Bind(&block23, &tmp317, &tmp318, &tmp319, &tmp320, &tmp321, &tmp322, &tmp323, &tmp324, &tmp325, &tmp326, &tmp327, &tmp328, &tmp329, &tmp330, &tmp331, &tmp332, &tmp333, &tmp334, &tmp335, &tmp336, &tmp337);
+    ca_.Goto(&block21, tmp317, tmp318, tmp319, tmp320, tmp321, tmp322, tmp323, tmp324, tmp325, tmp326, tmp327, tmp328, tmp329, tmp330, tmp331, tmp332, tmp333, tmp334, tmp335, tmp336);
+  }
+
+  if (block22.is_used()) {
+    TNode<Context> tmp338;
+    TNode<JSReceiver> tmp339;
+    TNode<String> tmp340;
+    TNode<Number> tmp341;
+    TNode<Object> tmp342;
+    TNode<Object> tmp343;
+    TNode<BuiltinPtr> tmp344;
+    TNode<Map> tmp345;
+    TNode<UintPtrT> tmp346;
+    TNode<IntPtrT> tmp347;
+    TNode<IntPtrT> tmp348;
+    TNode<BuiltinPtr> tmp349;
+    TNode<FixedArray> tmp350;
+    TNode<IntPtrT> tmp351;
+    TNode<IntPtrT> tmp352;
+    TNode<BoolT> tmp353;
+    TNode<UintPtrT> tmp354;
+    TNode<Object> tmp355;
+    TNode<String> tmp356;
+    TNode<Object> tmp357;
+    TNode<Object> tmp358;
+    TNode<Number> tmp359;
+    ca_.Bind(&block22, &tmp338, &tmp339, &tmp340, &tmp341, &tmp342, &tmp343, &tmp344, &tmp345, &tmp346, &tmp347, &tmp348, &tmp349, &tmp350, &tmp351, &tmp352, &tmp353, &tmp354, &tmp355, &tmp356, &tmp357, &tmp358, &tmp359);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 301);
+    TNode<String> tmp360;
+    USE(tmp360);
+    tmp360 = CodeStubAssembler(state_).NumberToString(TNode<Number>{tmp359});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 300);
+    ca_.Goto(&block20, tmp338, tmp339, tmp340, tmp341, tmp342, tmp343, tmp344, tmp345, tmp346, tmp347, tmp348, tmp349, tmp350, tmp351, tmp352, tmp353, tmp354, tmp355, tmp360, tmp357);
+  }
+
+  if (block21.is_used()) {
+    TNode<Context> tmp361;
+    TNode<JSReceiver> tmp362;
+    TNode<String> tmp363;
+    TNode<Number> tmp364;
+    TNode<Object> tmp365;
+    TNode<Object> tmp366;
+    TNode<BuiltinPtr> tmp367;
+    TNode<Map> tmp368;
+    TNode<UintPtrT> tmp369;
+    TNode<IntPtrT> tmp370;
+    TNode<IntPtrT> tmp371;
+    TNode<BuiltinPtr> tmp372;
+    TNode<FixedArray> tmp373;
+    TNode<IntPtrT> tmp374;
+    TNode<IntPtrT> tmp375;
+    TNode<BoolT> tmp376;
+    TNode<UintPtrT> tmp377;
+    TNode<Object> tmp378;
+    TNode<String> tmp379;
+    TNode<Object> tmp380;
+    ca_.Bind(&block21, &tmp361, &tmp362, &tmp363, &tmp364, &tmp365, &tmp366, &tmp367, &tmp368, &tmp369, &tmp370, &tmp371, &tmp372, &tmp373, &tmp374, &tmp375, &tmp376, &tmp377, &tmp378, &tmp379, &tmp380);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 303);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 304);
+    TNode<BoolT> tmp381;
+    USE(tmp381);
+    tmp381 = CodeStubAssembler(state_).IsNullOrUndefined(TNode<Object>{ca_.UncheckedCast<HeapObject>(tmp380)});
+    ca_.Branch(tmp381, &block24, &block25, tmp361, tmp362, tmp363, tmp364, tmp365, tmp366, tmp367, tmp368, tmp369, tmp370, tmp371, tmp372, tmp373, tmp374, tmp375, tmp376, tmp377, tmp378, tmp379, tmp380, ca_.UncheckedCast<HeapObject>(tmp380));
+  }
+
+  if (block24.is_used()) {
+    TNode<Context> tmp382;
+    TNode<JSReceiver> tmp383;
+    TNode<String> tmp384;
+    TNode<Number> tmp385;
+    TNode<Object> tmp386;
+    TNode<Object> tmp387;
+    TNode<BuiltinPtr> tmp388;
+    TNode<Map> tmp389;
+    TNode<UintPtrT> tmp390;
+    TNode<IntPtrT> tmp391;
+    TNode<IntPtrT> tmp392;
+    TNode<BuiltinPtr> tmp393;
+    TNode<FixedArray> tmp394;
+    TNode<IntPtrT> tmp395;
+    TNode<IntPtrT> tmp396;
+    TNode<BoolT> tmp397;
+    TNode<UintPtrT> tmp398;
+    TNode<Object> tmp399;
+    TNode<String> tmp400;
+    TNode<Object> tmp401;
+    TNode<Object> tmp402;
+    ca_.Bind(&block24, &tmp382, &tmp383, &tmp384, &tmp385, &tmp386, &tmp387, &tmp388, &tmp389, &tmp390, &tmp391, &tmp392, &tmp393, &tmp394, &tmp395, &tmp396, &tmp397, &tmp398, &tmp399, &tmp400, &tmp401, &tmp402);
+    ca_.Goto(&block4, tmp382, tmp383, tmp384, tmp385, tmp386, tmp387, tmp388, tmp389, tmp390, tmp391, tmp392, tmp393, tmp394, tmp395, tmp396, tmp397, tmp398);
+  }
+
+  if (block25.is_used()) {
+    TNode<Context> tmp403;
+    TNode<JSReceiver> tmp404;
+    TNode<String> tmp405;
+    TNode<Number> tmp406;
+    TNode<Object> tmp407;
+    TNode<Object> tmp408;
+    TNode<BuiltinPtr> tmp409;
+    TNode<Map> tmp410;
+    TNode<UintPtrT> tmp411;
+    TNode<IntPtrT> tmp412;
+    TNode<IntPtrT> tmp413;
+    TNode<BuiltinPtr> tmp414;
+    TNode<FixedArray> tmp415;
+    TNode<IntPtrT> tmp416;
+    TNode<IntPtrT> tmp417;
+    TNode<BoolT> tmp418;
+    TNode<UintPtrT> tmp419;
+    TNode<Object> tmp420;
+    TNode<String> tmp421;
+    TNode<Object> tmp422;
+    TNode<Object> tmp423;
+    ca_.Bind(&block25, &tmp403, &tmp404, &tmp405, &tmp406, &tmp407, &tmp408, &tmp409, &tmp410, &tmp411, &tmp412, &tmp413, &tmp414, &tmp415, &tmp416, &tmp417, &tmp418, &tmp419, &tmp420, &tmp421, &tmp422, &tmp423);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 305);
+    TNode<String> tmp424;
+    tmp424 = TORQUE_CAST(CodeStubAssembler(state_).CallBuiltin(Builtins::kToString, tmp403, tmp423));
+    USE(tmp424);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 300);
+    ca_.Goto(&block20, tmp403, tmp404, tmp405, tmp406, tmp407, tmp408, tmp409, tmp410, tmp411, tmp412, tmp413, tmp414, tmp415, tmp416, tmp417, tmp418, tmp419, tmp420, tmp424, tmp422);
+  }
+
+  if (block20.is_used()) {
+    TNode<Context> tmp425;
+    TNode<JSReceiver> tmp426;
+    TNode<String> tmp427;
+    TNode<Number> tmp428;
+    TNode<Object> tmp429;
+    TNode<Object> tmp430;
+    TNode<BuiltinPtr> tmp431;
+    TNode<Map> tmp432;
+    TNode<UintPtrT> tmp433;
+    TNode<IntPtrT> tmp434;
+    TNode<IntPtrT> tmp435;
+    TNode<BuiltinPtr> tmp436;
+    TNode<FixedArray> tmp437;
+    TNode<IntPtrT> tmp438;
+    TNode<IntPtrT> tmp439;
+    TNode<BoolT> tmp440;
+    TNode<UintPtrT> tmp441;
+    TNode<Object> tmp442;
+    TNode<String> tmp443;
+    TNode<Object> tmp444;
+    ca_.Bind(&block20, &tmp425, &tmp426, &tmp427, &tmp428, &tmp429, &tmp430, &tmp431, &tmp432, &tmp433, &tmp434, &tmp435, &tmp436, &tmp437, &tmp438, &tmp439, &tmp440, &tmp441, &tmp442, &tmp443, &tmp444);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 296);
+    ca_.Goto(&block14, tmp425, tmp426, tmp427, tmp428, tmp429, tmp430, tmp431, tmp432, tmp433, tmp434, tmp435, tmp436, tmp437, tmp438, tmp439, tmp440, tmp441, tmp442, tmp443, tmp444);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp445;
+    TNode<JSReceiver> tmp446;
+    TNode<String> tmp447;
+    TNode<Number> tmp448;
+    TNode<Object> tmp449;
+    TNode<Object> tmp450;
+    TNode<BuiltinPtr> tmp451;
+    TNode<Map> tmp452;
+    TNode<UintPtrT> tmp453;
+    TNode<IntPtrT> tmp454;
+    TNode<IntPtrT> tmp455;
+    TNode<BuiltinPtr> tmp456;
+    TNode<FixedArray> tmp457;
+    TNode<IntPtrT> tmp458;
+    TNode<IntPtrT> tmp459;
+    TNode<BoolT> tmp460;
+    TNode<UintPtrT> tmp461;
+    TNode<Object> tmp462;
+    TNode<String> tmp463;
+    TNode<Object> tmp464;
+    ca_.Bind(&block14, &tmp445, &tmp446, &tmp447, &tmp448, &tmp449, &tmp450, &tmp451, &tmp452, &tmp453, &tmp454, &tmp455, &tmp456, &tmp457, &tmp458, &tmp459, &tmp460, &tmp461, &tmp462, &tmp463, &tmp464);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 295);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 291);
+    ca_.Goto(&block11, tmp445, tmp446, tmp447, tmp448, tmp449, tmp450, tmp451, tmp452, tmp453, tmp454, tmp455, tmp456, tmp457, tmp458, tmp459, tmp460, tmp461, tmp462, tmp463);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp465;
+    TNode<JSReceiver> tmp466;
+    TNode<String> tmp467;
+    TNode<Number> tmp468;
+    TNode<Object> tmp469;
+    TNode<Object> tmp470;
+    TNode<BuiltinPtr> tmp471;
+    TNode<Map> tmp472;
+    TNode<UintPtrT> tmp473;
+    TNode<IntPtrT> tmp474;
+    TNode<IntPtrT> tmp475;
+    TNode<BuiltinPtr> tmp476;
+    TNode<FixedArray> tmp477;
+    TNode<IntPtrT> tmp478;
+    TNode<IntPtrT> tmp479;
+    TNode<BoolT> tmp480;
+    TNode<UintPtrT> tmp481;
+    TNode<Object> tmp482;
+    TNode<String> tmp483;
+    ca_.Bind(&block11, &tmp465, &tmp466, &tmp467, &tmp468, &tmp469, &tmp470, &tmp471, &tmp472, &tmp473, &tmp474, &tmp475, &tmp476, &tmp477, &tmp478, &tmp479, &tmp480, &tmp481, &tmp482, &tmp483);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 311);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 154);
+    TNode<IntPtrT> tmp484;
+    USE(tmp484);
+    tmp484 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<BoolT> tmp485;
+    USE(tmp485);
+    tmp485 = CodeStubAssembler(state_).WordEqual(TNode<IntPtrT>{tmp478}, TNode<IntPtrT>{tmp484});
+    TNode<IntPtrT> tmp486;
+    USE(tmp486);
+    tmp486 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<BoolT> tmp487;
+    USE(tmp487);
+    tmp487 = CodeStubAssembler(state_).IntPtrGreaterThan(TNode<IntPtrT>{tmp475}, TNode<IntPtrT>{tmp486});
+    TNode<BoolT> tmp488;
+    USE(tmp488);
+    tmp488 = CodeStubAssembler(state_).Word32Or(TNode<BoolT>{tmp485}, TNode<BoolT>{tmp487});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 155);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 167);
+    TNode<IntPtrT> tmp489;
+    USE(tmp489);
+    tmp489 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<BoolT> tmp490;
+    USE(tmp490);
+    tmp490 = CodeStubAssembler(state_).WordEqual(TNode<IntPtrT>{tmp475}, TNode<IntPtrT>{tmp489});
+    ca_.Branch(tmp490, &block30, &block31, tmp465, tmp466, tmp467, tmp468, tmp469, tmp470, tmp471, tmp472, tmp473, tmp474, tmp475, tmp476, tmp477, tmp478, tmp479, tmp480, tmp481, tmp482, tmp483, tmp483, tmp475, tmp474, tmp465, tmp483, tmp475, tmp474, tmp488, tmp475, tmp474, tmp488, tmp465, tmp475, tmp474, tmp488, tmp490);
+  }
+
+  if (block30.is_used()) {
+    TNode<Context> tmp491;
+    TNode<JSReceiver> tmp492;
+    TNode<String> tmp493;
+    TNode<Number> tmp494;
+    TNode<Object> tmp495;
+    TNode<Object> tmp496;
+    TNode<BuiltinPtr> tmp497;
+    TNode<Map> tmp498;
+    TNode<UintPtrT> tmp499;
+    TNode<IntPtrT> tmp500;
+    TNode<IntPtrT> tmp501;
+    TNode<BuiltinPtr> tmp502;
+    TNode<FixedArray> tmp503;
+    TNode<IntPtrT> tmp504;
+    TNode<IntPtrT> tmp505;
+    TNode<BoolT> tmp506;
+    TNode<UintPtrT> tmp507;
+    TNode<Object> tmp508;
+    TNode<String> tmp509;
+    TNode<String> tmp510;
+    TNode<IntPtrT> tmp511;
+    TNode<IntPtrT> tmp512;
+    TNode<Context> tmp513;
+    TNode<String> tmp514;
+    TNode<IntPtrT> tmp515;
+    TNode<IntPtrT> tmp516;
+    TNode<BoolT> tmp517;
+    TNode<IntPtrT> tmp518;
+    TNode<IntPtrT> tmp519;
+    TNode<BoolT> tmp520;
+    TNode<Context> tmp521;
+    TNode<IntPtrT> tmp522;
+    TNode<IntPtrT> tmp523;
+    TNode<BoolT> tmp524;
+    TNode<BoolT> tmp525;
+    ca_.Bind(&block30, &tmp491, &tmp492, &tmp493, &tmp494, &tmp495, &tmp496, &tmp497, &tmp498, &tmp499, &tmp500, &tmp501, &tmp502, &tmp503, &tmp504, &tmp505, &tmp506, &tmp507, &tmp508, &tmp509, &tmp510, &tmp511, &tmp512, &tmp513, &tmp514, &tmp515, &tmp516, &tmp517, &tmp518, &tmp519, &tmp520, &tmp521, &tmp522, &tmp523, &tmp524, &tmp525);
+    TNode<BoolT> tmp526;
+    USE(tmp526);
+    tmp526 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, true);
+    ca_.Goto(&block32, tmp491, tmp492, tmp493, tmp494, tmp495, tmp496, tmp497, tmp498, tmp499, tmp500, tmp501, tmp502, tmp503, tmp504, tmp505, tmp506, tmp507, tmp508, tmp509, tmp510, tmp511, tmp512, tmp513, tmp514, tmp515, tmp516, tmp517, tmp518, tmp519, tmp520, tmp521, tmp522, tmp523, tmp524, tmp525, tmp526);
+  }
+
+  if (block31.is_used()) {
+    TNode<Context> tmp527;
+    TNode<JSReceiver> tmp528;
+    TNode<String> tmp529;
+    TNode<Number> tmp530;
+    TNode<Object> tmp531;
+    TNode<Object> tmp532;
+    TNode<BuiltinPtr> tmp533;
+    TNode<Map> tmp534;
+    TNode<UintPtrT> tmp535;
+    TNode<IntPtrT> tmp536;
+    TNode<IntPtrT> tmp537;
+    TNode<BuiltinPtr> tmp538;
+    TNode<FixedArray> tmp539;
+    TNode<IntPtrT> tmp540;
+    TNode<IntPtrT> tmp541;
+    TNode<BoolT> tmp542;
+    TNode<UintPtrT> tmp543;
+    TNode<Object> tmp544;
+    TNode<String> tmp545;
+    TNode<String> tmp546;
+    TNode<IntPtrT> tmp547;
+    TNode<IntPtrT> tmp548;
+    TNode<Context> tmp549;
+    TNode<String> tmp550;
+    TNode<IntPtrT> tmp551;
+    TNode<IntPtrT> tmp552;
+    TNode<BoolT> tmp553;
+    TNode<IntPtrT> tmp554;
+    TNode<IntPtrT> tmp555;
+    TNode<BoolT> tmp556;
+    TNode<Context> tmp557;
+    TNode<IntPtrT> tmp558;
+    TNode<IntPtrT> tmp559;
+    TNode<BoolT> tmp560;
+    TNode<BoolT> tmp561;
+    ca_.Bind(&block31, &tmp527, &tmp528, &tmp529, &tmp530, &tmp531, &tmp532, &tmp533, &tmp534, &tmp535, &tmp536, &tmp537, &tmp538, &tmp539, &tmp540, &tmp541, &tmp542, &tmp543, &tmp544, &tmp545, &tmp546, &tmp547, &tmp548, &tmp549, &tmp550, &tmp551, &tmp552, &tmp553, &tmp554, &tmp555, &tmp556, &tmp557, &tmp558, &tmp559, &tmp560, &tmp561);
+    TNode<IntPtrT> tmp562;
+    USE(tmp562);
+    tmp562 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<BoolT> tmp563;
+    USE(tmp563);
+    tmp563 = CodeStubAssembler(state_).WordEqual(TNode<IntPtrT>{tmp559}, TNode<IntPtrT>{tmp562});
+    ca_.Goto(&block32, tmp527, tmp528, tmp529, tmp530, tmp531, tmp532, tmp533, tmp534, tmp535, tmp536, tmp537, tmp538, tmp539, tmp540, tmp541, tmp542, tmp543, tmp544, tmp545, tmp546, tmp547, tmp548, tmp549, tmp550, tmp551, tmp552, tmp553, tmp554, tmp555, tmp556, tmp557, tmp558, tmp559, tmp560, tmp561, tmp563);
+  }
+
+  if (block32.is_used()) {
+    TNode<Context> tmp564;
+    TNode<JSReceiver> tmp565;
+    TNode<String> tmp566;
+    TNode<Number> tmp567;
+    TNode<Object> tmp568;
+    TNode<Object> tmp569;
+    TNode<BuiltinPtr> tmp570;
+    TNode<Map> tmp571;
+    TNode<UintPtrT> tmp572;
+    TNode<IntPtrT> tmp573;
+    TNode<IntPtrT> tmp574;
+    TNode<BuiltinPtr> tmp575;
+    TNode<FixedArray> tmp576;
+    TNode<IntPtrT> tmp577;
+    TNode<IntPtrT> tmp578;
+    TNode<BoolT> tmp579;
+    TNode<UintPtrT> tmp580;
+    TNode<Object> tmp581;
+    TNode<String> tmp582;
+    TNode<String> tmp583;
+    TNode<IntPtrT> tmp584;
+    TNode<IntPtrT> tmp585;
+    TNode<Context> tmp586;
+    TNode<String> tmp587;
+    TNode<IntPtrT> tmp588;
+    TNode<IntPtrT> tmp589;
+    TNode<BoolT> tmp590;
+    TNode<IntPtrT> tmp591;
+    TNode<IntPtrT> tmp592;
+    TNode<BoolT> tmp593;
+    TNode<Context> tmp594;
+    TNode<IntPtrT> tmp595;
+    TNode<IntPtrT> tmp596;
+    TNode<BoolT> tmp597;
+    TNode<BoolT> tmp598;
+    TNode<BoolT> tmp599;
+    ca_.Bind(&block32, &tmp564, &tmp565, &tmp566, &tmp567, &tmp568, &tmp569, &tmp570, &tmp571, &tmp572, &tmp573, &tmp574, &tmp575, &tmp576, &tmp577, &tmp578, &tmp579, &tmp580, &tmp581, &tmp582, &tmp583, &tmp584, &tmp585, &tmp586, &tmp587, &tmp588, &tmp589, &tmp590, &tmp591, &tmp592, &tmp593, &tmp594, &tmp595, &tmp596, &tmp597, &tmp598, &tmp599);
+    ca_.Branch(tmp599, &block28, &block29, tmp564, tmp565, tmp566, tmp567, tmp568, tmp569, tmp570, tmp571, tmp572, tmp573, tmp574, tmp575, tmp576, tmp577, tmp578, tmp579, tmp580, tmp581, tmp582, tmp583, tmp584, tmp585, tmp586, tmp587, tmp588, tmp589, tmp590, tmp591, tmp592, tmp593, tmp594, tmp595, tmp596, tmp597);
+  }
+
+  if (block28.is_used()) {
+    TNode<Context> tmp600;
+    TNode<JSReceiver> tmp601;
+    TNode<String> tmp602;
+    TNode<Number> tmp603;
+    TNode<Object> tmp604;
+    TNode<Object> tmp605;
+    TNode<BuiltinPtr> tmp606;
+    TNode<Map> tmp607;
+    TNode<UintPtrT> tmp608;
+    TNode<IntPtrT> tmp609;
+    TNode<IntPtrT> tmp610;
+    TNode<BuiltinPtr> tmp611;
+    TNode<FixedArray> tmp612;
+    TNode<IntPtrT> tmp613;
+    TNode<IntPtrT> tmp614;
+    TNode<BoolT> tmp615;
+    TNode<UintPtrT> tmp616;
+    TNode<Object> tmp617;
+    TNode<String> tmp618;
+    TNode<String> tmp619;
+    TNode<IntPtrT> tmp620;
+    TNode<IntPtrT> tmp621;
+    TNode<Context> tmp622;
+    TNode<String> tmp623;
+    TNode<IntPtrT> tmp624;
+    TNode<IntPtrT> tmp625;
+    TNode<BoolT> tmp626;
+    TNode<IntPtrT> tmp627;
+    TNode<IntPtrT> tmp628;
+    TNode<BoolT> tmp629;
+    TNode<Context> tmp630;
+    TNode<IntPtrT> tmp631;
+    TNode<IntPtrT> tmp632;
+    TNode<BoolT> tmp633;
+    ca_.Bind(&block28, &tmp600, &tmp601, &tmp602, &tmp603, &tmp604, &tmp605, &tmp606, &tmp607, &tmp608, &tmp609, &tmp610, &tmp611, &tmp612, &tmp613, &tmp614, &tmp615, &tmp616, &tmp617, &tmp618, &tmp619, &tmp620, &tmp621, &tmp622, &tmp623, &tmp624, &tmp625, &tmp626, &tmp627, &tmp628, &tmp629, &tmp630, &tmp631, &tmp632, &tmp633);
+    ca_.Goto(&block27, tmp600, tmp601, tmp602, tmp603, tmp604, tmp605, tmp606, tmp607, tmp608, tmp609, tmp610, tmp611, tmp612, tmp613, tmp614, tmp615, tmp616, tmp617, tmp618, tmp619, tmp620, tmp621, tmp622, tmp623, tmp624, tmp625, tmp626, tmp627, tmp628, tmp629, tmp630, tmp631, tmp632, tmp633);
+  }
+
+  if (block29.is_used()) {
+    TNode<Context> tmp634;
+    TNode<JSReceiver> tmp635;
+    TNode<String> tmp636;
+    TNode<Number> tmp637;
+    TNode<Object> tmp638;
+    TNode<Object> tmp639;
+    TNode<BuiltinPtr> tmp640;
+    TNode<Map> tmp641;
+    TNode<UintPtrT> tmp642;
+    TNode<IntPtrT> tmp643;
+    TNode<IntPtrT> tmp644;
+    TNode<BuiltinPtr> tmp645;
+    TNode<FixedArray> tmp646;
+    TNode<IntPtrT> tmp647;
+    TNode<IntPtrT> tmp648;
+    TNode<BoolT> tmp649;
+    TNode<UintPtrT> tmp650;
+    TNode<Object> tmp651;
+    TNode<String> tmp652;
+    TNode<String> tmp653;
+    TNode<IntPtrT> tmp654;
+    TNode<IntPtrT> tmp655;
+    TNode<Context> tmp656;
+    TNode<String> tmp657;
+    TNode<IntPtrT> tmp658;
+    TNode<IntPtrT> tmp659;
+    TNode<BoolT> tmp660;
+    TNode<IntPtrT> tmp661;
+    TNode<IntPtrT> tmp662;
+    TNode<BoolT> tmp663;
+    TNode<Context> tmp664;
+    TNode<IntPtrT> tmp665;
+    TNode<IntPtrT> tmp666;
+    TNode<BoolT> tmp667;
+    ca_.Bind(&block29, &tmp634, &tmp635, &tmp636, &tmp637, &tmp638, &tmp639, &tmp640, &tmp641, &tmp642, &tmp643, &tmp644, &tmp645, &tmp646, &tmp647, &tmp648, &tmp649, &tmp650, &tmp651, &tmp652, &tmp653, &tmp654, &tmp655, &tmp656, &tmp657, &tmp658, &tmp659, &tmp660, &tmp661, &tmp662, &tmp663, &tmp664, &tmp665, &tmp666, &tmp667);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 169);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 170);
+    TNode<IntPtrT> tmp668;
+    USE(tmp668);
+    tmp668 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp666}, TNode<IntPtrT>{tmp665});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 173);
+    TNode<IntPtrT> tmp669;
+    USE(tmp669);
+    tmp669 = CodeStubAssembler(state_).IntPtrDiv(TNode<IntPtrT>{tmp668}, TNode<IntPtrT>{tmp666});
+    TNode<BoolT> tmp670;
+    USE(tmp670);
+    tmp670 = CodeStubAssembler(state_).WordNotEqual(TNode<IntPtrT>{tmp669}, TNode<IntPtrT>{tmp665});
+    ca_.Branch(tmp670, &block33, &block34, tmp634, tmp635, tmp636, tmp637, tmp638, tmp639, tmp640, tmp641, tmp642, tmp643, tmp644, tmp645, tmp646, tmp647, tmp648, tmp649, tmp650, tmp651, tmp652, tmp653, tmp654, tmp655, tmp656, tmp657, tmp658, tmp659, tmp660, tmp661, tmp662, tmp663, tmp664, tmp665, tmp666, tmp667, tmp665, tmp668);
+  }
+
+  if (block33.is_used()) {
+    TNode<Context> tmp671;
+    TNode<JSReceiver> tmp672;
+    TNode<String> tmp673;
+    TNode<Number> tmp674;
+    TNode<Object> tmp675;
+    TNode<Object> tmp676;
+    TNode<BuiltinPtr> tmp677;
+    TNode<Map> tmp678;
+    TNode<UintPtrT> tmp679;
+    TNode<IntPtrT> tmp680;
+    TNode<IntPtrT> tmp681;
+    TNode<BuiltinPtr> tmp682;
+    TNode<FixedArray> tmp683;
+    TNode<IntPtrT> tmp684;
+    TNode<IntPtrT> tmp685;
+    TNode<BoolT> tmp686;
+    TNode<UintPtrT> tmp687;
+    TNode<Object> tmp688;
+    TNode<String> tmp689;
+    TNode<String> tmp690;
+    TNode<IntPtrT> tmp691;
+    TNode<IntPtrT> tmp692;
+    TNode<Context> tmp693;
+    TNode<String> tmp694;
+    TNode<IntPtrT> tmp695;
+    TNode<IntPtrT> tmp696;
+    TNode<BoolT> tmp697;
+    TNode<IntPtrT> tmp698;
+    TNode<IntPtrT> tmp699;
+    TNode<BoolT> tmp700;
+    TNode<Context> tmp701;
+    TNode<IntPtrT> tmp702;
+    TNode<IntPtrT> tmp703;
+    TNode<BoolT> tmp704;
+    TNode<IntPtrT> tmp705;
+    TNode<IntPtrT> tmp706;
+    ca_.Bind(&block33, &tmp671, &tmp672, &tmp673, &tmp674, &tmp675, &tmp676, &tmp677, &tmp678, &tmp679, &tmp680, &tmp681, &tmp682, &tmp683, &tmp684, &tmp685, &tmp686, &tmp687, &tmp688, &tmp689, &tmp690, &tmp691, &tmp692, &tmp693, &tmp694, &tmp695, &tmp696, &tmp697, &tmp698, &tmp699, &tmp700, &tmp701, &tmp702, &tmp703, &tmp704, &tmp705, &tmp706);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 174);
+    CodeStubAssembler(state_).CallRuntime(Runtime::kThrowInvalidStringLength, tmp701);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block34.is_used()) {
+    TNode<Context> tmp708;
+    TNode<JSReceiver> tmp709;
+    TNode<String> tmp710;
+    TNode<Number> tmp711;
+    TNode<Object> tmp712;
+    TNode<Object> tmp713;
+    TNode<BuiltinPtr> tmp714;
+    TNode<Map> tmp715;
+    TNode<UintPtrT> tmp716;
+    TNode<IntPtrT> tmp717;
+    TNode<IntPtrT> tmp718;
+    TNode<BuiltinPtr> tmp719;
+    TNode<FixedArray> tmp720;
+    TNode<IntPtrT> tmp721;
+    TNode<IntPtrT> tmp722;
+    TNode<BoolT> tmp723;
+    TNode<UintPtrT> tmp724;
+    TNode<Object> tmp725;
+    TNode<String> tmp726;
+    TNode<String> tmp727;
+    TNode<IntPtrT> tmp728;
+    TNode<IntPtrT> tmp729;
+    TNode<Context> tmp730;
+    TNode<String> tmp731;
+    TNode<IntPtrT> tmp732;
+    TNode<IntPtrT> tmp733;
+    TNode<BoolT> tmp734;
+    TNode<IntPtrT> tmp735;
+    TNode<IntPtrT> tmp736;
+    TNode<BoolT> tmp737;
+    TNode<Context> tmp738;
+    TNode<IntPtrT> tmp739;
+    TNode<IntPtrT> tmp740;
+    TNode<BoolT> tmp741;
+    TNode<IntPtrT> tmp742;
+    TNode<IntPtrT> tmp743;
+    ca_.Bind(&block34, &tmp708, &tmp709, &tmp710, &tmp711, &tmp712, &tmp713, &tmp714, &tmp715, &tmp716, &tmp717, &tmp718, &tmp719, &tmp720, &tmp721, &tmp722, &tmp723, &tmp724, &tmp725, &tmp726, &tmp727, &tmp728, &tmp729, &tmp730, &tmp731, &tmp732, &tmp733, &tmp734, &tmp735, &tmp736, &tmp737, &tmp738, &tmp739, &tmp740, &tmp741, &tmp742, &tmp743);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 177);
+    TNode<IntPtrT> tmp744;
+    USE(tmp744);
+    tmp744 = AddStringLength_10(state_, TNode<Context>{tmp738}, TNode<IntPtrT>{tmp722}, TNode<IntPtrT>{tmp743});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 178);
+    ca_.Branch(tmp741, &block35, &block36, tmp708, tmp709, tmp710, tmp711, tmp712, tmp713, tmp714, tmp715, tmp716, tmp717, tmp718, tmp719, tmp720, tmp721, tmp744, tmp723, tmp724, tmp725, tmp726, tmp727, tmp728, tmp729, tmp730, tmp731, tmp732, tmp733, tmp734, tmp735, tmp736, tmp737, tmp738, tmp739, tmp740, tmp741, tmp742, tmp743);
+  }
+
+  if (block35.is_used()) {
+    TNode<Context> tmp745;
+    TNode<JSReceiver> tmp746;
+    TNode<String> tmp747;
+    TNode<Number> tmp748;
+    TNode<Object> tmp749;
+    TNode<Object> tmp750;
+    TNode<BuiltinPtr> tmp751;
+    TNode<Map> tmp752;
+    TNode<UintPtrT> tmp753;
+    TNode<IntPtrT> tmp754;
+    TNode<IntPtrT> tmp755;
+    TNode<BuiltinPtr> tmp756;
+    TNode<FixedArray> tmp757;
+    TNode<IntPtrT> tmp758;
+    TNode<IntPtrT> tmp759;
+    TNode<BoolT> tmp760;
+    TNode<UintPtrT> tmp761;
+    TNode<Object> tmp762;
+    TNode<String> tmp763;
+    TNode<String> tmp764;
+    TNode<IntPtrT> tmp765;
+    TNode<IntPtrT> tmp766;
+    TNode<Context> tmp767;
+    TNode<String> tmp768;
+    TNode<IntPtrT> tmp769;
+    TNode<IntPtrT> tmp770;
+    TNode<BoolT> tmp771;
+    TNode<IntPtrT> tmp772;
+    TNode<IntPtrT> tmp773;
+    TNode<BoolT> tmp774;
+    TNode<Context> tmp775;
+    TNode<IntPtrT> tmp776;
+    TNode<IntPtrT> tmp777;
+    TNode<BoolT> tmp778;
+    TNode<IntPtrT> tmp779;
+    TNode<IntPtrT> tmp780;
+    ca_.Bind(&block35, &tmp745, &tmp746, &tmp747, &tmp748, &tmp749, &tmp750, &tmp751, &tmp752, &tmp753, &tmp754, &tmp755, &tmp756, &tmp757, &tmp758, &tmp759, &tmp760, &tmp761, &tmp762, &tmp763, &tmp764, &tmp765, &tmp766, &tmp767, &tmp768, &tmp769, &tmp770, &tmp771, &tmp772, &tmp773, &tmp774, &tmp775, &tmp776, &tmp777, &tmp778, &tmp779, &tmp780);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 180);
+    TNode<IntPtrT> tmp781;
+    USE(tmp781);
+    tmp781 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<IntPtrT> tmp782;
+    USE(tmp782);
+    tmp782 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp758}, TNode<IntPtrT>{tmp781});
+    TNode<Smi> tmp783;
+    USE(tmp783);
+    tmp783 = Convert5ATSmi8ATintptr_187(state_, TNode<IntPtrT>{tmp779});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 179);
+    TNode<FixedArray> tmp784;
+    USE(tmp784);
+    tmp784 = StoreAndGrowFixedArray5ATSmi_1456(state_, TNode<FixedArray>{tmp757}, TNode<IntPtrT>{tmp758}, TNode<Smi>{tmp783});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 178);
+    ca_.Goto(&block36, tmp745, tmp746, tmp747, tmp748, tmp749, tmp750, tmp751, tmp752, tmp753, tmp754, tmp755, tmp756, tmp784, tmp782, tmp759, tmp760, tmp761, tmp762, tmp763, tmp764, tmp765, tmp766, tmp767, tmp768, tmp769, tmp770, tmp771, tmp772, tmp773, tmp774, tmp775, tmp776, tmp777, tmp778, tmp779, tmp780);
+  }
+
+  if (block36.is_used()) {
+    TNode<Context> tmp785;
+    TNode<JSReceiver> tmp786;
+    TNode<String> tmp787;
+    TNode<Number> tmp788;
+    TNode<Object> tmp789;
+    TNode<Object> tmp790;
+    TNode<BuiltinPtr> tmp791;
+    TNode<Map> tmp792;
+    TNode<UintPtrT> tmp793;
+    TNode<IntPtrT> tmp794;
+    TNode<IntPtrT> tmp795;
+    TNode<BuiltinPtr> tmp796;
+    TNode<FixedArray> tmp797;
+    TNode<IntPtrT> tmp798;
+    TNode<IntPtrT> tmp799;
+    TNode<BoolT> tmp800;
+    TNode<UintPtrT> tmp801;
+    TNode<Object> tmp802;
+    TNode<String> tmp803;
+    TNode<String> tmp804;
+    TNode<IntPtrT> tmp805;
+    TNode<IntPtrT> tmp806;
+    TNode<Context> tmp807;
+    TNode<String> tmp808;
+    TNode<IntPtrT> tmp809;
+    TNode<IntPtrT> tmp810;
+    TNode<BoolT> tmp811;
+    TNode<IntPtrT> tmp812;
+    TNode<IntPtrT> tmp813;
+    TNode<BoolT> tmp814;
+    TNode<Context> tmp815;
+    TNode<IntPtrT> tmp816;
+    TNode<IntPtrT> tmp817;
+    TNode<BoolT> tmp818;
+    TNode<IntPtrT> tmp819;
+    TNode<IntPtrT> tmp820;
+    ca_.Bind(&block36, &tmp785, &tmp786, &tmp787, &tmp788, &tmp789, &tmp790, &tmp791, &tmp792, &tmp793, &tmp794, &tmp795, &tmp796, &tmp797, &tmp798, &tmp799, &tmp800, &tmp801, &tmp802, &tmp803, &tmp804, &tmp805, &tmp806, &tmp807, &tmp808, &tmp809, &tmp810, &tmp811, &tmp812, &tmp813, &tmp814, &tmp815, &tmp816, &tmp817, &tmp818, &tmp819, &tmp820);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 166);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 155);
+    ca_.Goto(&block27, tmp785, tmp786, tmp787, tmp788, tmp789, tmp790, tmp791, tmp792, tmp793, tmp794, tmp795, tmp796, tmp797, tmp798, tmp799, tmp800, tmp801, tmp802, tmp803, tmp804, tmp805, tmp806, tmp807, tmp808, tmp809, tmp810, tmp811, tmp812, tmp813, tmp814, tmp815, tmp816, tmp817, tmp818);
+  }
+
+  if (block27.is_used()) {
+    TNode<Context> tmp821;
+    TNode<JSReceiver> tmp822;
+    TNode<String> tmp823;
+    TNode<Number> tmp824;
+    TNode<Object> tmp825;
+    TNode<Object> tmp826;
+    TNode<BuiltinPtr> tmp827;
+    TNode<Map> tmp828;
+    TNode<UintPtrT> tmp829;
+    TNode<IntPtrT> tmp830;
+    TNode<IntPtrT> tmp831;
+    TNode<BuiltinPtr> tmp832;
+    TNode<FixedArray> tmp833;
+    TNode<IntPtrT> tmp834;
+    TNode<IntPtrT> tmp835;
+    TNode<BoolT> tmp836;
+    TNode<UintPtrT> tmp837;
+    TNode<Object> tmp838;
+    TNode<String> tmp839;
+    TNode<String> tmp840;
+    TNode<IntPtrT> tmp841;
+    TNode<IntPtrT> tmp842;
+    TNode<Context> tmp843;
+    TNode<String> tmp844;
+    TNode<IntPtrT> tmp845;
+    TNode<IntPtrT> tmp846;
+    TNode<BoolT> tmp847;
+    TNode<IntPtrT> tmp848;
+    TNode<IntPtrT> tmp849;
+    TNode<BoolT> tmp850;
+    TNode<Context> tmp851;
+    TNode<IntPtrT> tmp852;
+    TNode<IntPtrT> tmp853;
+    TNode<BoolT> tmp854;
+    ca_.Bind(&block27, &tmp821, &tmp822, &tmp823, &tmp824, &tmp825, &tmp826, &tmp827, &tmp828, &tmp829, &tmp830, &tmp831, &tmp832, &tmp833, &tmp834, &tmp835, &tmp836, &tmp837, &tmp838, &tmp839, &tmp840, &tmp841, &tmp842, &tmp843, &tmp844, &tmp845, &tmp846, &tmp847, &tmp848, &tmp849, &tmp850, &tmp851, &tmp852, &tmp853, &tmp854);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 158);
+    TNode<IntPtrT> tmp855;
+    USE(tmp855);
+    tmp855 = CodeStubAssembler(state_).LoadStringLengthAsWord(TNode<String>{tmp844});
+    TNode<IntPtrT> tmp856;
+    USE(tmp856);
+    tmp856 = AddStringLength_10(state_, TNode<Context>{tmp843}, TNode<IntPtrT>{tmp835}, TNode<IntPtrT>{tmp855});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 157);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 160);
+    TNode<IntPtrT> tmp857;
+    USE(tmp857);
+    tmp857 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<IntPtrT> tmp858;
+    USE(tmp858);
+    tmp858 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp834}, TNode<IntPtrT>{tmp857});
+    TNode<FixedArray> tmp859;
+    USE(tmp859);
+    tmp859 = StoreAndGrowFixedArray6String_1457(state_, TNode<FixedArray>{tmp833}, TNode<IntPtrT>{tmp834}, TNode<String>{tmp844});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 159);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 162);
+    TNode<Uint16T> tmp860;
+    USE(tmp860);
+    tmp860 = CodeStubAssembler(state_).LoadInstanceType(TNode<HeapObject>{tmp844});
+    TNode<BoolT> tmp861;
+    USE(tmp861);
+    tmp861 = CodeStubAssembler(state_).IsOneByteStringInstanceType(TNode<Uint16T>{tmp860});
+    TNode<BoolT> tmp862;
+    USE(tmp862);
+    tmp862 = CodeStubAssembler(state_).Word32And(TNode<BoolT>{tmp861}, TNode<BoolT>{tmp836});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 161);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 152);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 311);
+    ca_.Goto(&block26, tmp821, tmp822, tmp823, tmp824, tmp825, tmp826, tmp827, tmp828, tmp829, tmp830, tmp831, tmp832, tmp859, tmp858, tmp856, tmp862, tmp837, tmp838, tmp839, tmp840, tmp841, tmp842, tmp843, tmp844, tmp845, tmp846);
+  }
+
+  if (block26.is_used()) {
+    TNode<Context> tmp863;
+    TNode<JSReceiver> tmp864;
+    TNode<String> tmp865;
+    TNode<Number> tmp866;
+    TNode<Object> tmp867;
+    TNode<Object> tmp868;
+    TNode<BuiltinPtr> tmp869;
+    TNode<Map> tmp870;
+    TNode<UintPtrT> tmp871;
+    TNode<IntPtrT> tmp872;
+    TNode<IntPtrT> tmp873;
+    TNode<BuiltinPtr> tmp874;
+    TNode<FixedArray> tmp875;
+    TNode<IntPtrT> tmp876;
+    TNode<IntPtrT> tmp877;
+    TNode<BoolT> tmp878;
+    TNode<UintPtrT> tmp879;
+    TNode<Object> tmp880;
+    TNode<String> tmp881;
+    TNode<String> tmp882;
+    TNode<IntPtrT> tmp883;
+    TNode<IntPtrT> tmp884;
+    TNode<Context> tmp885;
+    TNode<String> tmp886;
+    TNode<IntPtrT> tmp887;
+    TNode<IntPtrT> tmp888;
+    ca_.Bind(&block26, &tmp863, &tmp864, &tmp865, &tmp866, &tmp867, &tmp868, &tmp869, &tmp870, &tmp871, &tmp872, &tmp873, &tmp874, &tmp875, &tmp876, &tmp877, &tmp878, &tmp879, &tmp880, &tmp881, &tmp882, &tmp883, &tmp884, &tmp885, &tmp886, &tmp887, &tmp888);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 312);
+    TNode<IntPtrT> tmp889;
+    USE(tmp889);
+    tmp889 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 273);
+    ca_.Goto(&block4, tmp863, tmp864, tmp865, tmp866, tmp867, tmp868, tmp869, tmp870, tmp871, tmp872, tmp889, tmp874, tmp875, tmp876, tmp877, tmp878, tmp879);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp890;
+    TNode<JSReceiver> tmp891;
+    TNode<String> tmp892;
+    TNode<Number> tmp893;
+    TNode<Object> tmp894;
+    TNode<Object> tmp895;
+    TNode<BuiltinPtr> tmp896;
+    TNode<Map> tmp897;
+    TNode<UintPtrT> tmp898;
+    TNode<IntPtrT> tmp899;
+    TNode<IntPtrT> tmp900;
+    TNode<BuiltinPtr> tmp901;
+    TNode<FixedArray> tmp902;
+    TNode<IntPtrT> tmp903;
+    TNode<IntPtrT> tmp904;
+    TNode<BoolT> tmp905;
+    TNode<UintPtrT> tmp906;
+    ca_.Bind(&block3, &tmp890, &tmp891, &tmp892, &tmp893, &tmp894, &tmp895, &tmp896, &tmp897, &tmp898, &tmp899, &tmp900, &tmp901, &tmp902, &tmp903, &tmp904, &tmp905, &tmp906);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 316);
+    TNode<BoolT> tmp907;
+    USE(tmp907);
+    tmp907 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, true);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 167);
+    TNode<IntPtrT> tmp908;
+    USE(tmp908);
+    tmp908 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<BoolT> tmp909;
+    USE(tmp909);
+    tmp909 = CodeStubAssembler(state_).WordEqual(TNode<IntPtrT>{tmp900}, TNode<IntPtrT>{tmp908});
+    ca_.Branch(tmp909, &block40, &block41, tmp890, tmp891, tmp892, tmp893, tmp894, tmp895, tmp896, tmp897, tmp898, tmp899, tmp900, tmp901, tmp902, tmp903, tmp904, tmp905, tmp906, tmp900, tmp899, tmp890, tmp900, tmp899, tmp907, tmp909);
+  }
+
+  if (block40.is_used()) {
+    TNode<Context> tmp910;
+    TNode<JSReceiver> tmp911;
+    TNode<String> tmp912;
+    TNode<Number> tmp913;
+    TNode<Object> tmp914;
+    TNode<Object> tmp915;
+    TNode<BuiltinPtr> tmp916;
+    TNode<Map> tmp917;
+    TNode<UintPtrT> tmp918;
+    TNode<IntPtrT> tmp919;
+    TNode<IntPtrT> tmp920;
+    TNode<BuiltinPtr> tmp921;
+    TNode<FixedArray> tmp922;
+    TNode<IntPtrT> tmp923;
+    TNode<IntPtrT> tmp924;
+    TNode<BoolT> tmp925;
+    TNode<UintPtrT> tmp926;
+    TNode<IntPtrT> tmp927;
+    TNode<IntPtrT> tmp928;
+    TNode<Context> tmp929;
+    TNode<IntPtrT> tmp930;
+    TNode<IntPtrT> tmp931;
+    TNode<BoolT> tmp932;
+    TNode<BoolT> tmp933;
+    ca_.Bind(&block40, &tmp910, &tmp911, &tmp912, &tmp913, &tmp914, &tmp915, &tmp916, &tmp917, &tmp918, &tmp919, &tmp920, &tmp921, &tmp922, &tmp923, &tmp924, &tmp925, &tmp926, &tmp927, &tmp928, &tmp929, &tmp930, &tmp931, &tmp932, &tmp933);
+    TNode<BoolT> tmp934;
+    USE(tmp934);
+    tmp934 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, true);
+    ca_.Goto(&block42, tmp910, tmp911, tmp912, tmp913, tmp914, tmp915, tmp916, tmp917, tmp918, tmp919, tmp920, tmp921, tmp922, tmp923, tmp924, tmp925, tmp926, tmp927, tmp928, tmp929, tmp930, tmp931, tmp932, tmp933, tmp934);
+  }
+
+  if (block41.is_used()) {
+    TNode<Context> tmp935;
+    TNode<JSReceiver> tmp936;
+    TNode<String> tmp937;
+    TNode<Number> tmp938;
+    TNode<Object> tmp939;
+    TNode<Object> tmp940;
+    TNode<BuiltinPtr> tmp941;
+    TNode<Map> tmp942;
+    TNode<UintPtrT> tmp943;
+    TNode<IntPtrT> tmp944;
+    TNode<IntPtrT> tmp945;
+    TNode<BuiltinPtr> tmp946;
+    TNode<FixedArray> tmp947;
+    TNode<IntPtrT> tmp948;
+    TNode<IntPtrT> tmp949;
+    TNode<BoolT> tmp950;
+    TNode<UintPtrT> tmp951;
+    TNode<IntPtrT> tmp952;
+    TNode<IntPtrT> tmp953;
+    TNode<Context> tmp954;
+    TNode<IntPtrT> tmp955;
+    TNode<IntPtrT> tmp956;
+    TNode<BoolT> tmp957;
+    TNode<BoolT> tmp958;
+    ca_.Bind(&block41, &tmp935, &tmp936, &tmp937, &tmp938, &tmp939, &tmp940, &tmp941, &tmp942, &tmp943, &tmp944, &tmp945, &tmp946, &tmp947, &tmp948, &tmp949, &tmp950, &tmp951, &tmp952, &tmp953, &tmp954, &tmp955, &tmp956, &tmp957, &tmp958);
+    TNode<IntPtrT> tmp959;
+    USE(tmp959);
+    tmp959 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<BoolT> tmp960;
+    USE(tmp960);
+    tmp960 = CodeStubAssembler(state_).WordEqual(TNode<IntPtrT>{tmp956}, TNode<IntPtrT>{tmp959});
+    ca_.Goto(&block42, tmp935, tmp936, tmp937, tmp938, tmp939, tmp940, tmp941, tmp942, tmp943, tmp944, tmp945, tmp946, tmp947, tmp948, tmp949, tmp950, tmp951, tmp952, tmp953, tmp954, tmp955, tmp956, tmp957, tmp958, tmp960);
+  }
+
+  if (block42.is_used()) {
+    TNode<Context> tmp961;
+    TNode<JSReceiver> tmp962;
+    TNode<String> tmp963;
+    TNode<Number> tmp964;
+    TNode<Object> tmp965;
+    TNode<Object> tmp966;
+    TNode<BuiltinPtr> tmp967;
+    TNode<Map> tmp968;
+    TNode<UintPtrT> tmp969;
+    TNode<IntPtrT> tmp970;
+    TNode<IntPtrT> tmp971;
+    TNode<BuiltinPtr> tmp972;
+    TNode<FixedArray> tmp973;
+    TNode<IntPtrT> tmp974;
+    TNode<IntPtrT> tmp975;
+    TNode<BoolT> tmp976;
+    TNode<UintPtrT> tmp977;
+    TNode<IntPtrT> tmp978;
+    TNode<IntPtrT> tmp979;
+    TNode<Context> tmp980;
+    TNode<IntPtrT> tmp981;
+    TNode<IntPtrT> tmp982;
+    TNode<BoolT> tmp983;
+    TNode<BoolT> tmp984;
+    TNode<BoolT> tmp985;
+    ca_.Bind(&block42, &tmp961, &tmp962, &tmp963, &tmp964, &tmp965, &tmp966, &tmp967, &tmp968, &tmp969, &tmp970, &tmp971, &tmp972, &tmp973, &tmp974, &tmp975, &tmp976, &tmp977, &tmp978, &tmp979, &tmp980, &tmp981, &tmp982, &tmp983, &tmp984, &tmp985);
+    ca_.Branch(tmp985, &block38, &block39, tmp961, tmp962, tmp963, tmp964, tmp965, tmp966, tmp967, tmp968, tmp969, tmp970, tmp971, tmp972, tmp973, tmp974, tmp975, tmp976, tmp977, tmp978, tmp979, tmp980, tmp981, tmp982, tmp983);
+  }
+
+  if (block38.is_used()) {
+    TNode<Context> tmp986;
+    TNode<JSReceiver> tmp987;
+    TNode<String> tmp988;
+    TNode<Number> tmp989;
+    TNode<Object> tmp990;
+    TNode<Object> tmp991;
+    TNode<BuiltinPtr> tmp992;
+    TNode<Map> tmp993;
+    TNode<UintPtrT> tmp994;
+    TNode<IntPtrT> tmp995;
+    TNode<IntPtrT> tmp996;
+    TNode<BuiltinPtr> tmp997;
+    TNode<FixedArray> tmp998;
+    TNode<IntPtrT> tmp999;
+    TNode<IntPtrT> tmp1000;
+    TNode<BoolT> tmp1001;
+    TNode<UintPtrT> tmp1002;
+    TNode<IntPtrT> tmp1003;
+    TNode<IntPtrT> tmp1004;
+    TNode<Context> tmp1005;
+    TNode<IntPtrT> tmp1006;
+    TNode<IntPtrT> tmp1007;
+    TNode<BoolT> tmp1008;
+    ca_.Bind(&block38, &tmp986, &tmp987, &tmp988, &tmp989, &tmp990, &tmp991, &tmp992, &tmp993, &tmp994, &tmp995, &tmp996, &tmp997, &tmp998, &tmp999, &tmp1000, &tmp1001, &tmp1002, &tmp1003, &tmp1004, &tmp1005, &tmp1006, &tmp1007, &tmp1008);
+    ca_.Goto(&block37, tmp986, tmp987, tmp988, tmp989, tmp990, tmp991, tmp992, tmp993, tmp994, tmp995, tmp996, tmp997, tmp998, tmp999, tmp1000, tmp1001, tmp1002, tmp1003, tmp1004, tmp1005, tmp1006, tmp1007, tmp1008);
+  }
+
+  if (block39.is_used()) {
+    TNode<Context> tmp1009;
+    TNode<JSReceiver> tmp1010;
+    TNode<String> tmp1011;
+    TNode<Number> tmp1012;
+    TNode<Object> tmp1013;
+    TNode<Object> tmp1014;
+    TNode<BuiltinPtr> tmp1015;
+    TNode<Map> tmp1016;
+    TNode<UintPtrT> tmp1017;
+    TNode<IntPtrT> tmp1018;
+    TNode<IntPtrT> tmp1019;
+    TNode<BuiltinPtr> tmp1020;
+    TNode<FixedArray> tmp1021;
+    TNode<IntPtrT> tmp1022;
+    TNode<IntPtrT> tmp1023;
+    TNode<BoolT> tmp1024;
+    TNode<UintPtrT> tmp1025;
+    TNode<IntPtrT> tmp1026;
+    TNode<IntPtrT> tmp1027;
+    TNode<Context> tmp1028;
+    TNode<IntPtrT> tmp1029;
+    TNode<IntPtrT> tmp1030;
+    TNode<BoolT> tmp1031;
+    ca_.Bind(&block39, &tmp1009, &tmp1010, &tmp1011, &tmp1012, &tmp1013, &tmp1014, &tmp1015, &tmp1016, &tmp1017, &tmp1018, &tmp1019, &tmp1020, &tmp1021, &tmp1022, &tmp1023, &tmp1024, &tmp1025, &tmp1026, &tmp1027, &tmp1028, &tmp1029, &tmp1030, &tmp1031);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 169);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 170);
+    TNode<IntPtrT> tmp1032;
+    USE(tmp1032);
+    tmp1032 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp1030}, TNode<IntPtrT>{tmp1029});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 173);
+    TNode<IntPtrT> tmp1033;
+    USE(tmp1033);
+    tmp1033 = CodeStubAssembler(state_).IntPtrDiv(TNode<IntPtrT>{tmp1032}, TNode<IntPtrT>{tmp1030});
+    TNode<BoolT> tmp1034;
+    USE(tmp1034);
+    tmp1034 = CodeStubAssembler(state_).WordNotEqual(TNode<IntPtrT>{tmp1033}, TNode<IntPtrT>{tmp1029});
+    ca_.Branch(tmp1034, &block43, &block44, tmp1009, tmp1010, tmp1011, tmp1012, tmp1013, tmp1014, tmp1015, tmp1016, tmp1017, tmp1018, tmp1019, tmp1020, tmp1021, tmp1022, tmp1023, tmp1024, tmp1025, tmp1026, tmp1027, tmp1028, tmp1029, tmp1030, tmp1031, tmp1029, tmp1032);
+  }
+
+  if (block43.is_used()) {
+    TNode<Context> tmp1035;
+    TNode<JSReceiver> tmp1036;
+    TNode<String> tmp1037;
+    TNode<Number> tmp1038;
+    TNode<Object> tmp1039;
+    TNode<Object> tmp1040;
+    TNode<BuiltinPtr> tmp1041;
+    TNode<Map> tmp1042;
+    TNode<UintPtrT> tmp1043;
+    TNode<IntPtrT> tmp1044;
+    TNode<IntPtrT> tmp1045;
+    TNode<BuiltinPtr> tmp1046;
+    TNode<FixedArray> tmp1047;
+    TNode<IntPtrT> tmp1048;
+    TNode<IntPtrT> tmp1049;
+    TNode<BoolT> tmp1050;
+    TNode<UintPtrT> tmp1051;
+    TNode<IntPtrT> tmp1052;
+    TNode<IntPtrT> tmp1053;
+    TNode<Context> tmp1054;
+    TNode<IntPtrT> tmp1055;
+    TNode<IntPtrT> tmp1056;
+    TNode<BoolT> tmp1057;
+    TNode<IntPtrT> tmp1058;
+    TNode<IntPtrT> tmp1059;
+    ca_.Bind(&block43, &tmp1035, &tmp1036, &tmp1037, &tmp1038, &tmp1039, &tmp1040, &tmp1041, &tmp1042, &tmp1043, &tmp1044, &tmp1045, &tmp1046, &tmp1047, &tmp1048, &tmp1049, &tmp1050, &tmp1051, &tmp1052, &tmp1053, &tmp1054, &tmp1055, &tmp1056, &tmp1057, &tmp1058, &tmp1059);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 174);
+    CodeStubAssembler(state_).CallRuntime(Runtime::kThrowInvalidStringLength, tmp1054);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block44.is_used()) {
+    TNode<Context> tmp1061;
+    TNode<JSReceiver> tmp1062;
+    TNode<String> tmp1063;
+    TNode<Number> tmp1064;
+    TNode<Object> tmp1065;
+    TNode<Object> tmp1066;
+    TNode<BuiltinPtr> tmp1067;
+    TNode<Map> tmp1068;
+    TNode<UintPtrT> tmp1069;
+    TNode<IntPtrT> tmp1070;
+    TNode<IntPtrT> tmp1071;
+    TNode<BuiltinPtr> tmp1072;
+    TNode<FixedArray> tmp1073;
+    TNode<IntPtrT> tmp1074;
+    TNode<IntPtrT> tmp1075;
+    TNode<BoolT> tmp1076;
+    TNode<UintPtrT> tmp1077;
+    TNode<IntPtrT> tmp1078;
+    TNode<IntPtrT> tmp1079;
+    TNode<Context> tmp1080;
+    TNode<IntPtrT> tmp1081;
+    TNode<IntPtrT> tmp1082;
+    TNode<BoolT> tmp1083;
+    TNode<IntPtrT> tmp1084;
+    TNode<IntPtrT> tmp1085;
+    ca_.Bind(&block44, &tmp1061, &tmp1062, &tmp1063, &tmp1064, &tmp1065, &tmp1066, &tmp1067, &tmp1068, &tmp1069, &tmp1070, &tmp1071, &tmp1072, &tmp1073, &tmp1074, &tmp1075, &tmp1076, &tmp1077, &tmp1078, &tmp1079, &tmp1080, &tmp1081, &tmp1082, &tmp1083, &tmp1084, &tmp1085);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 177);
+    TNode<IntPtrT> tmp1086;
+    USE(tmp1086);
+    tmp1086 = AddStringLength_10(state_, TNode<Context>{tmp1080}, TNode<IntPtrT>{tmp1075}, TNode<IntPtrT>{tmp1085});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 178);
+    ca_.Branch(tmp1083, &block45, &block46, tmp1061, tmp1062, tmp1063, tmp1064, tmp1065, tmp1066, tmp1067, tmp1068, tmp1069, tmp1070, tmp1071, tmp1072, tmp1073, tmp1074, tmp1086, tmp1076, tmp1077, tmp1078, tmp1079, tmp1080, tmp1081, tmp1082, tmp1083, tmp1084, tmp1085);
+  }
+
+  if (block45.is_used()) {
+    TNode<Context> tmp1087;
+    TNode<JSReceiver> tmp1088;
+    TNode<String> tmp1089;
+    TNode<Number> tmp1090;
+    TNode<Object> tmp1091;
+    TNode<Object> tmp1092;
+    TNode<BuiltinPtr> tmp1093;
+    TNode<Map> tmp1094;
+    TNode<UintPtrT> tmp1095;
+    TNode<IntPtrT> tmp1096;
+    TNode<IntPtrT> tmp1097;
+    TNode<BuiltinPtr> tmp1098;
+    TNode<FixedArray> tmp1099;
+    TNode<IntPtrT> tmp1100;
+    TNode<IntPtrT> tmp1101;
+    TNode<BoolT> tmp1102;
+    TNode<UintPtrT> tmp1103;
+    TNode<IntPtrT> tmp1104;
+    TNode<IntPtrT> tmp1105;
+    TNode<Context> tmp1106;
+    TNode<IntPtrT> tmp1107;
+    TNode<IntPtrT> tmp1108;
+    TNode<BoolT> tmp1109;
+    TNode<IntPtrT> tmp1110;
+    TNode<IntPtrT> tmp1111;
+    ca_.Bind(&block45, &tmp1087, &tmp1088, &tmp1089, &tmp1090, &tmp1091, &tmp1092, &tmp1093, &tmp1094, &tmp1095, &tmp1096, &tmp1097, &tmp1098, &tmp1099, &tmp1100, &tmp1101, &tmp1102, &tmp1103, &tmp1104, &tmp1105, &tmp1106, &tmp1107, &tmp1108, &tmp1109, &tmp1110, &tmp1111);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 180);
+    TNode<IntPtrT> tmp1112;
+    USE(tmp1112);
+    tmp1112 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<IntPtrT> tmp1113;
+    USE(tmp1113);
+    tmp1113 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp1100}, TNode<IntPtrT>{tmp1112});
+    TNode<Smi> tmp1114;
+    USE(tmp1114);
+    tmp1114 = Convert5ATSmi8ATintptr_187(state_, TNode<IntPtrT>{tmp1110});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 179);
+    TNode<FixedArray> tmp1115;
+    USE(tmp1115);
+    tmp1115 = StoreAndGrowFixedArray5ATSmi_1456(state_, TNode<FixedArray>{tmp1099}, TNode<IntPtrT>{tmp1100}, TNode<Smi>{tmp1114});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 178);
+    ca_.Goto(&block46, tmp1087, tmp1088, tmp1089, tmp1090, tmp1091, tmp1092, tmp1093, tmp1094, tmp1095, tmp1096, tmp1097, tmp1098, tmp1115, tmp1113, tmp1101, tmp1102, tmp1103, tmp1104, tmp1105, tmp1106, tmp1107, tmp1108, tmp1109, tmp1110, tmp1111);
+  }
+
+  if (block46.is_used()) {
+    TNode<Context> tmp1116;
+    TNode<JSReceiver> tmp1117;
+    TNode<String> tmp1118;
+    TNode<Number> tmp1119;
+    TNode<Object> tmp1120;
+    TNode<Object> tmp1121;
+    TNode<BuiltinPtr> tmp1122;
+    TNode<Map> tmp1123;
+    TNode<UintPtrT> tmp1124;
+    TNode<IntPtrT> tmp1125;
+    TNode<IntPtrT> tmp1126;
+    TNode<BuiltinPtr> tmp1127;
+    TNode<FixedArray> tmp1128;
+    TNode<IntPtrT> tmp1129;
+    TNode<IntPtrT> tmp1130;
+    TNode<BoolT> tmp1131;
+    TNode<UintPtrT> tmp1132;
+    TNode<IntPtrT> tmp1133;
+    TNode<IntPtrT> tmp1134;
+    TNode<Context> tmp1135;
+    TNode<IntPtrT> tmp1136;
+    TNode<IntPtrT> tmp1137;
+    TNode<BoolT> tmp1138;
+    TNode<IntPtrT> tmp1139;
+    TNode<IntPtrT> tmp1140;
+    ca_.Bind(&block46, &tmp1116, &tmp1117, &tmp1118, &tmp1119, &tmp1120, &tmp1121, &tmp1122, &tmp1123, &tmp1124, &tmp1125, &tmp1126, &tmp1127, &tmp1128, &tmp1129, &tmp1130, &tmp1131, &tmp1132, &tmp1133, &tmp1134, &tmp1135, &tmp1136, &tmp1137, &tmp1138, &tmp1139, &tmp1140);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 166);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 316);
+    ca_.Goto(&block37, tmp1116, tmp1117, tmp1118, tmp1119, tmp1120, tmp1121, tmp1122, tmp1123, tmp1124, tmp1125, tmp1126, tmp1127, tmp1128, tmp1129, tmp1130, tmp1131, tmp1132, tmp1133, tmp1134, tmp1135, tmp1136, tmp1137, tmp1138);
+  }
+
+  if (block37.is_used()) {
+    TNode<Context> tmp1141;
+    TNode<JSReceiver> tmp1142;
+    TNode<String> tmp1143;
+    TNode<Number> tmp1144;
+    TNode<Object> tmp1145;
+    TNode<Object> tmp1146;
+    TNode<BuiltinPtr> tmp1147;
+    TNode<Map> tmp1148;
+    TNode<UintPtrT> tmp1149;
+    TNode<IntPtrT> tmp1150;
+    TNode<IntPtrT> tmp1151;
+    TNode<BuiltinPtr> tmp1152;
+    TNode<FixedArray> tmp1153;
+    TNode<IntPtrT> tmp1154;
+    TNode<IntPtrT> tmp1155;
+    TNode<BoolT> tmp1156;
+    TNode<UintPtrT> tmp1157;
+    TNode<IntPtrT> tmp1158;
+    TNode<IntPtrT> tmp1159;
+    TNode<Context> tmp1160;
+    TNode<IntPtrT> tmp1161;
+    TNode<IntPtrT> tmp1162;
+    TNode<BoolT> tmp1163;
+    ca_.Bind(&block37, &tmp1141, &tmp1142, &tmp1143, &tmp1144, &tmp1145, &tmp1146, &tmp1147, &tmp1148, &tmp1149, &tmp1150, &tmp1151, &tmp1152, &tmp1153, &tmp1154, &tmp1155, &tmp1156, &tmp1157, &tmp1158, &tmp1159, &tmp1160, &tmp1161, &tmp1162, &tmp1163);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 319);
+    TNode<String> tmp1164;
+    USE(tmp1164);
+    tmp1164 = BufferJoin_12(state_, TNode<Context>{tmp1141}, TorqueStructBuffer{TNode<FixedArray>{tmp1153}, TNode<IntPtrT>{tmp1154}, TNode<IntPtrT>{tmp1155}, TNode<BoolT>{tmp1156}}, TNode<String>{tmp1143});
+    ca_.Goto(&block1, tmp1141, tmp1142, tmp1143, tmp1144, tmp1145, tmp1146, tmp1147, tmp1164);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp1165;
+    TNode<JSReceiver> tmp1166;
+    TNode<String> tmp1167;
+    TNode<Number> tmp1168;
+    TNode<Object> tmp1169;
+    TNode<Object> tmp1170;
+    TNode<BuiltinPtr> tmp1171;
+    TNode<String> tmp1172;
+    ca_.Bind(&block1, &tmp1165, &tmp1166, &tmp1167, &tmp1168, &tmp1169, &tmp1170, &tmp1171, &tmp1172);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 411);
+    ca_.Goto(&block47, tmp1165, tmp1166, tmp1167, tmp1168, tmp1169, tmp1170, tmp1171, tmp1172);
+  }
+
+    TNode<Context> tmp1173;
+    TNode<JSReceiver> tmp1174;
+    TNode<String> tmp1175;
+    TNode<Number> tmp1176;
+    TNode<Object> tmp1177;
+    TNode<Object> tmp1178;
+    TNode<BuiltinPtr> tmp1179;
+    TNode<String> tmp1180;
+    ca_.Bind(&block47, &tmp1173, &tmp1174, &tmp1175, &tmp1176, &tmp1177, &tmp1178, &tmp1179, &tmp1180);
+  return TNode<String>{tmp1180};
+}
+
+TNode<HeapObject> UnsafeCast10HeapObject_1380(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block5(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, HeapObject> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, HeapObject> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3001);
+    ca_.Goto(&block3, tmp0, tmp1);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp2;
+    TNode<Object> tmp3;
+    ca_.Bind(&block2, &tmp2, &tmp3);
+    TNode<BoolT> tmp4;
+    USE(tmp4);
+    tmp4 = Is10HeapObject20UT5ATSmi10HeapObject_1465(state_, TNode<Context>{tmp2}, TNode<Object>{tmp3});
+    ca_.Branch(tmp4, &block4, &block5, tmp2, tmp3);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp5;
+    TNode<Object> tmp6;
+    ca_.Bind(&block5, &tmp5, &tmp6);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'Is<A>(o)' failed", "../../deps/v8/src/builtins/base.tq", 3001);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp7;
+    TNode<Object> tmp8;
+    ca_.Bind(&block4, &tmp7, &tmp8);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp9;
+    TNode<Object> tmp10;
+    ca_.Bind(&block3, &tmp9, &tmp10);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3002);
+    TNode<HeapObject> tmp11;
+    USE(tmp11);
+    tmp11 = TORQUE_CAST(TNode<Object>{tmp10});
+    ca_.Goto(&block1, tmp9, tmp10, tmp11);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp12;
+    TNode<Object> tmp13;
+    TNode<HeapObject> tmp14;
+    ca_.Bind(&block1, &tmp12, &tmp13, &tmp14);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 426);
+    ca_.Goto(&block6, tmp12, tmp13, tmp14);
+  }
+
+    TNode<Context> tmp15;
+    TNode<Object> tmp16;
+    TNode<HeapObject> tmp17;
+    ca_.Bind(&block6, &tmp15, &tmp16, &tmp17);
+  return TNode<HeapObject>{tmp17};
+}
+
+TNode<FixedArray> StoreAndGrowFixedArray10JSReceiver_1381(compiler::CodeAssemblerState* state_, TNode<FixedArray> p_fixedArray, TNode<IntPtrT> p_index, TNode<JSReceiver> p_element) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver, IntPtrT> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver, IntPtrT> block5(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver, IntPtrT> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver, IntPtrT> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver, IntPtrT> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver, IntPtrT> block7(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver, IntPtrT, IntPtrT> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver, IntPtrT, IntPtrT> block19(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver, IntPtrT, IntPtrT> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver, IntPtrT, IntPtrT> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver, IntPtrT, IntPtrT, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block24(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver, IntPtrT, IntPtrT, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block25(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver, IntPtrT, IntPtrT, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block23(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver, IntPtrT, IntPtrT, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block22(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver, IntPtrT, IntPtrT, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver, IntPtrT, IntPtrT, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver, FixedArray> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, JSReceiver, FixedArray> block27(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_fixedArray, p_index, p_element);
+
+  if (block0.is_used()) {
+    TNode<FixedArray> tmp0;
+    TNode<IntPtrT> tmp1;
+    TNode<JSReceiver> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 130);
+    TNode<IntPtrT> tmp3;
+    USE(tmp3);
+    tmp3 = CodeStubAssembler(state_).LoadAndUntagFixedArrayBaseLength(TNode<FixedArrayBase>{tmp0});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 131);
+    ca_.Goto(&block3, tmp0, tmp1, tmp2, tmp3);
+  }
+
+  if (block2.is_used()) {
+    TNode<FixedArray> tmp4;
+    TNode<IntPtrT> tmp5;
+    TNode<JSReceiver> tmp6;
+    TNode<IntPtrT> tmp7;
+    ca_.Bind(&block2, &tmp4, &tmp5, &tmp6, &tmp7);
+    TNode<BoolT> tmp8;
+    USE(tmp8);
+    tmp8 = CodeStubAssembler(state_).IntPtrLessThanOrEqual(TNode<IntPtrT>{tmp5}, TNode<IntPtrT>{tmp7});
+    ca_.Branch(tmp8, &block4, &block5, tmp4, tmp5, tmp6, tmp7);
+  }
+
+  if (block5.is_used()) {
+    TNode<FixedArray> tmp9;
+    TNode<IntPtrT> tmp10;
+    TNode<JSReceiver> tmp11;
+    TNode<IntPtrT> tmp12;
+    ca_.Bind(&block5, &tmp9, &tmp10, &tmp11, &tmp12);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'index <= length' failed", "../../deps/v8/src/builtins/array-join.tq", 131);
+  }
+
+  if (block4.is_used()) {
+    TNode<FixedArray> tmp13;
+    TNode<IntPtrT> tmp14;
+    TNode<JSReceiver> tmp15;
+    TNode<IntPtrT> tmp16;
+    ca_.Bind(&block4, &tmp13, &tmp14, &tmp15, &tmp16);
+  }
+
+  if (block3.is_used()) {
+    TNode<FixedArray> tmp17;
+    TNode<IntPtrT> tmp18;
+    TNode<JSReceiver> tmp19;
+    TNode<IntPtrT> tmp20;
+    ca_.Bind(&block3, &tmp17, &tmp18, &tmp19, &tmp20);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 132);
+    TNode<BoolT> tmp21;
+    USE(tmp21);
+    tmp21 = CodeStubAssembler(state_).IntPtrLessThan(TNode<IntPtrT>{tmp18}, TNode<IntPtrT>{tmp20});
+    ca_.Branch(tmp21, &block6, &block7, tmp17, tmp18, tmp19, tmp20);
+  }
+
+  if (block6.is_used()) {
+    TNode<FixedArray> tmp22;
+    TNode<IntPtrT> tmp23;
+    TNode<JSReceiver> tmp24;
+    TNode<IntPtrT> tmp25;
+    ca_.Bind(&block6, &tmp22, &tmp23, &tmp24, &tmp25);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 133);
+    TNode<IntPtrT> tmp26 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp26);
+    TNode<IntPtrT> tmp27 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp27);
+    TNode<Smi>tmp28 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp22, tmp27});
+    TNode<IntPtrT> tmp29;
+    USE(tmp29);
+    tmp29 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp28});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 46);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp30;
+    USE(tmp30);
+    tmp30 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp23});
+    TNode<UintPtrT> tmp31;
+    USE(tmp31);
+    tmp31 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp29});
+    TNode<BoolT> tmp32;
+    USE(tmp32);
+    tmp32 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp30}, TNode<UintPtrT>{tmp31});
+    ca_.Branch(tmp32, &block13, &block14, tmp22, tmp23, tmp24, tmp25, tmp22, tmp26, tmp29, tmp23, tmp23, tmp22, tmp26, tmp29, tmp23, tmp23);
+  }
+
+  if (block13.is_used()) {
+    TNode<FixedArray> tmp33;
+    TNode<IntPtrT> tmp34;
+    TNode<JSReceiver> tmp35;
+    TNode<IntPtrT> tmp36;
+    TNode<FixedArray> tmp37;
+    TNode<IntPtrT> tmp38;
+    TNode<IntPtrT> tmp39;
+    TNode<IntPtrT> tmp40;
+    TNode<IntPtrT> tmp41;
+    TNode<HeapObject> tmp42;
+    TNode<IntPtrT> tmp43;
+    TNode<IntPtrT> tmp44;
+    TNode<IntPtrT> tmp45;
+    TNode<IntPtrT> tmp46;
+    ca_.Bind(&block13, &tmp33, &tmp34, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44, &tmp45, &tmp46);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp47;
+    USE(tmp47);
+    tmp47 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp48;
+    USE(tmp48);
+    tmp48 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp46}, TNode<IntPtrT>{tmp47});
+    TNode<IntPtrT> tmp49;
+    USE(tmp49);
+    tmp49 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp43}, TNode<IntPtrT>{tmp48});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp50;
+    USE(tmp50);
+    TNode<IntPtrT> tmp51;
+    USE(tmp51);
+    std::tie(tmp50, tmp51) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp42}, TNode<IntPtrT>{tmp49}).Flatten();
+    ca_.Goto(&block12, tmp33, tmp34, tmp35, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42, tmp43, tmp44, tmp45, tmp46, tmp50, tmp51);
+  }
+
+  if (block14.is_used()) {
+    TNode<FixedArray> tmp52;
+    TNode<IntPtrT> tmp53;
+    TNode<JSReceiver> tmp54;
+    TNode<IntPtrT> tmp55;
+    TNode<FixedArray> tmp56;
+    TNode<IntPtrT> tmp57;
+    TNode<IntPtrT> tmp58;
+    TNode<IntPtrT> tmp59;
+    TNode<IntPtrT> tmp60;
+    TNode<HeapObject> tmp61;
+    TNode<IntPtrT> tmp62;
+    TNode<IntPtrT> tmp63;
+    TNode<IntPtrT> tmp64;
+    TNode<IntPtrT> tmp65;
+    ca_.Bind(&block14, &tmp52, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block11, tmp52, tmp53, tmp54, tmp55, tmp56, tmp57, tmp58, tmp59, tmp60);
+  }
+
+  if (block12.is_used()) {
+    TNode<FixedArray> tmp66;
+    TNode<IntPtrT> tmp67;
+    TNode<JSReceiver> tmp68;
+    TNode<IntPtrT> tmp69;
+    TNode<FixedArray> tmp70;
+    TNode<IntPtrT> tmp71;
+    TNode<IntPtrT> tmp72;
+    TNode<IntPtrT> tmp73;
+    TNode<IntPtrT> tmp74;
+    TNode<HeapObject> tmp75;
+    TNode<IntPtrT> tmp76;
+    TNode<IntPtrT> tmp77;
+    TNode<IntPtrT> tmp78;
+    TNode<IntPtrT> tmp79;
+    TNode<HeapObject> tmp80;
+    TNode<IntPtrT> tmp81;
+    ca_.Bind(&block12, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 46);
+    ca_.Goto(&block10, tmp66, tmp67, tmp68, tmp69, tmp70, tmp71, tmp72, tmp73, tmp74, tmp80, tmp81);
+  }
+
+  if (block11.is_used()) {
+    TNode<FixedArray> tmp82;
+    TNode<IntPtrT> tmp83;
+    TNode<JSReceiver> tmp84;
+    TNode<IntPtrT> tmp85;
+    TNode<FixedArray> tmp86;
+    TNode<IntPtrT> tmp87;
+    TNode<IntPtrT> tmp88;
+    TNode<IntPtrT> tmp89;
+    TNode<IntPtrT> tmp90;
+    ca_.Bind(&block11, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block10.is_used()) {
+    TNode<FixedArray> tmp91;
+    TNode<IntPtrT> tmp92;
+    TNode<JSReceiver> tmp93;
+    TNode<IntPtrT> tmp94;
+    TNode<FixedArray> tmp95;
+    TNode<IntPtrT> tmp96;
+    TNode<IntPtrT> tmp97;
+    TNode<IntPtrT> tmp98;
+    TNode<IntPtrT> tmp99;
+    TNode<HeapObject> tmp100;
+    TNode<IntPtrT> tmp101;
+    ca_.Bind(&block10, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101);
+    ca_.Goto(&block9, tmp91, tmp92, tmp93, tmp94, tmp95, tmp96, tmp97, tmp98, tmp99, tmp100, tmp101);
+  }
+
+  if (block9.is_used()) {
+    TNode<FixedArray> tmp102;
+    TNode<IntPtrT> tmp103;
+    TNode<JSReceiver> tmp104;
+    TNode<IntPtrT> tmp105;
+    TNode<FixedArray> tmp106;
+    TNode<IntPtrT> tmp107;
+    TNode<IntPtrT> tmp108;
+    TNode<IntPtrT> tmp109;
+    TNode<IntPtrT> tmp110;
+    TNode<HeapObject> tmp111;
+    TNode<IntPtrT> tmp112;
+    ca_.Bind(&block9, &tmp102, &tmp103, &tmp104, &tmp105, &tmp106, &tmp107, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 133);
+    CodeStubAssembler(state_).StoreReference(CodeStubAssembler::Reference{tmp111, tmp112}, tmp104);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 134);
+    ca_.Goto(&block1, tmp102, tmp103, tmp104, tmp102);
+  }
+
+  if (block7.is_used()) {
+    TNode<FixedArray> tmp113;
+    TNode<IntPtrT> tmp114;
+    TNode<JSReceiver> tmp115;
+    TNode<IntPtrT> tmp116;
+    ca_.Bind(&block7, &tmp113, &tmp114, &tmp115, &tmp116);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 137);
+    TNode<IntPtrT> tmp117;
+    USE(tmp117);
+    tmp117 = CodeStubAssembler(state_).CalculateNewElementsCapacity(TNode<IntPtrT>{tmp116});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 138);
+    ca_.Goto(&block17, tmp113, tmp114, tmp115, tmp116, tmp117);
+  }
+
+  if (block16.is_used()) {
+    TNode<FixedArray> tmp118;
+    TNode<IntPtrT> tmp119;
+    TNode<JSReceiver> tmp120;
+    TNode<IntPtrT> tmp121;
+    TNode<IntPtrT> tmp122;
+    ca_.Bind(&block16, &tmp118, &tmp119, &tmp120, &tmp121, &tmp122);
+    TNode<BoolT> tmp123;
+    USE(tmp123);
+    tmp123 = CodeStubAssembler(state_).IntPtrLessThan(TNode<IntPtrT>{tmp119}, TNode<IntPtrT>{tmp122});
+    ca_.Branch(tmp123, &block18, &block19, tmp118, tmp119, tmp120, tmp121, tmp122);
+  }
+
+  if (block19.is_used()) {
+    TNode<FixedArray> tmp124;
+    TNode<IntPtrT> tmp125;
+    TNode<JSReceiver> tmp126;
+    TNode<IntPtrT> tmp127;
+    TNode<IntPtrT> tmp128;
+    ca_.Bind(&block19, &tmp124, &tmp125, &tmp126, &tmp127, &tmp128);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'index < newLength' failed", "../../deps/v8/src/builtins/array-join.tq", 138);
+  }
+
+  if (block18.is_used()) {
+    TNode<FixedArray> tmp129;
+    TNode<IntPtrT> tmp130;
+    TNode<JSReceiver> tmp131;
+    TNode<IntPtrT> tmp132;
+    TNode<IntPtrT> tmp133;
+    ca_.Bind(&block18, &tmp129, &tmp130, &tmp131, &tmp132, &tmp133);
+  }
+
+  if (block17.is_used()) {
+    TNode<FixedArray> tmp134;
+    TNode<IntPtrT> tmp135;
+    TNode<JSReceiver> tmp136;
+    TNode<IntPtrT> tmp137;
+    TNode<IntPtrT> tmp138;
+    ca_.Bind(&block17, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 140);
+    TNode<IntPtrT> tmp139;
+    USE(tmp139);
+    tmp139 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<FixedArray> tmp140;
+    USE(tmp140);
+    tmp140 = CodeStubAssembler(state_).ExtractFixedArray(TNode<FixedArray>{tmp134}, TNode<IntPtrT>{tmp139}, TNode<IntPtrT>{tmp137}, TNode<IntPtrT>{tmp138}, CodeStubAssembler::ExtractFixedArrayFlag::kFixedArrays);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 139);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 141);
+    TNode<IntPtrT> tmp141 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp141);
+    TNode<IntPtrT> tmp142 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp142);
+    TNode<Smi>tmp143 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp140, tmp142});
+    TNode<IntPtrT> tmp144;
+    USE(tmp144);
+    tmp144 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp143});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 46);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp145;
+    USE(tmp145);
+    tmp145 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp135});
+    TNode<UintPtrT> tmp146;
+    USE(tmp146);
+    tmp146 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp144});
+    TNode<BoolT> tmp147;
+    USE(tmp147);
+    tmp147 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp145}, TNode<UintPtrT>{tmp146});
+    ca_.Branch(tmp147, &block24, &block25, tmp134, tmp135, tmp136, tmp137, tmp138, tmp140, tmp140, tmp141, tmp144, tmp135, tmp135, tmp140, tmp141, tmp144, tmp135, tmp135);
+  }
+
+  if (block24.is_used()) {
+    TNode<FixedArray> tmp148;
+    TNode<IntPtrT> tmp149;
+    TNode<JSReceiver> tmp150;
+    TNode<IntPtrT> tmp151;
+    TNode<IntPtrT> tmp152;
+    TNode<FixedArray> tmp153;
+    TNode<FixedArray> tmp154;
+    TNode<IntPtrT> tmp155;
+    TNode<IntPtrT> tmp156;
+    TNode<IntPtrT> tmp157;
+    TNode<IntPtrT> tmp158;
+    TNode<HeapObject> tmp159;
+    TNode<IntPtrT> tmp160;
+    TNode<IntPtrT> tmp161;
+    TNode<IntPtrT> tmp162;
+    TNode<IntPtrT> tmp163;
+    ca_.Bind(&block24, &tmp148, &tmp149, &tmp150, &tmp151, &tmp152, &tmp153, &tmp154, &tmp155, &tmp156, &tmp157, &tmp158, &tmp159, &tmp160, &tmp161, &tmp162, &tmp163);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp164;
+    USE(tmp164);
+    tmp164 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp165;
+    USE(tmp165);
+    tmp165 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp163}, TNode<IntPtrT>{tmp164});
+    TNode<IntPtrT> tmp166;
+    USE(tmp166);
+    tmp166 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp160}, TNode<IntPtrT>{tmp165});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp167;
+    USE(tmp167);
+    TNode<IntPtrT> tmp168;
+    USE(tmp168);
+    std::tie(tmp167, tmp168) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp159}, TNode<IntPtrT>{tmp166}).Flatten();
+    ca_.Goto(&block23, tmp148, tmp149, tmp150, tmp151, tmp152, tmp153, tmp154, tmp155, tmp156, tmp157, tmp158, tmp159, tmp160, tmp161, tmp162, tmp163, tmp167, tmp168);
+  }
+
+  if (block25.is_used()) {
+    TNode<FixedArray> tmp169;
+    TNode<IntPtrT> tmp170;
+    TNode<JSReceiver> tmp171;
+    TNode<IntPtrT> tmp172;
+    TNode<IntPtrT> tmp173;
+    TNode<FixedArray> tmp174;
+    TNode<FixedArray> tmp175;
+    TNode<IntPtrT> tmp176;
+    TNode<IntPtrT> tmp177;
+    TNode<IntPtrT> tmp178;
+    TNode<IntPtrT> tmp179;
+    TNode<HeapObject> tmp180;
+    TNode<IntPtrT> tmp181;
+    TNode<IntPtrT> tmp182;
+    TNode<IntPtrT> tmp183;
+    TNode<IntPtrT> tmp184;
+    ca_.Bind(&block25, &tmp169, &tmp170, &tmp171, &tmp172, &tmp173, &tmp174, &tmp175, &tmp176, &tmp177, &tmp178, &tmp179, &tmp180, &tmp181, &tmp182, &tmp183, &tmp184);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block22, tmp169, tmp170, tmp171, tmp172, tmp173, tmp174, tmp175, tmp176, tmp177, tmp178, tmp179);
+  }
+
+  if (block23.is_used()) {
+    TNode<FixedArray> tmp185;
+    TNode<IntPtrT> tmp186;
+    TNode<JSReceiver> tmp187;
+    TNode<IntPtrT> tmp188;
+    TNode<IntPtrT> tmp189;
+    TNode<FixedArray> tmp190;
+    TNode<FixedArray> tmp191;
+    TNode<IntPtrT> tmp192;
+    TNode<IntPtrT> tmp193;
+    TNode<IntPtrT> tmp194;
+    TNode<IntPtrT> tmp195;
+    TNode<HeapObject> tmp196;
+    TNode<IntPtrT> tmp197;
+    TNode<IntPtrT> tmp198;
+    TNode<IntPtrT> tmp199;
+    TNode<IntPtrT> tmp200;
+    TNode<HeapObject> tmp201;
+    TNode<IntPtrT> tmp202;
+    ca_.Bind(&block23, &tmp185, &tmp186, &tmp187, &tmp188, &tmp189, &tmp190, &tmp191, &tmp192, &tmp193, &tmp194, &tmp195, &tmp196, &tmp197, &tmp198, &tmp199, &tmp200, &tmp201, &tmp202);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 46);
+    ca_.Goto(&block21, tmp185, tmp186, tmp187, tmp188, tmp189, tmp190, tmp191, tmp192, tmp193, tmp194, tmp195, tmp201, tmp202);
+  }
+
+  if (block22.is_used()) {
+    TNode<FixedArray> tmp203;
+    TNode<IntPtrT> tmp204;
+    TNode<JSReceiver> tmp205;
+    TNode<IntPtrT> tmp206;
+    TNode<IntPtrT> tmp207;
+    TNode<FixedArray> tmp208;
+    TNode<FixedArray> tmp209;
+    TNode<IntPtrT> tmp210;
+    TNode<IntPtrT> tmp211;
+    TNode<IntPtrT> tmp212;
+    TNode<IntPtrT> tmp213;
+    ca_.Bind(&block22, &tmp203, &tmp204, &tmp205, &tmp206, &tmp207, &tmp208, &tmp209, &tmp210, &tmp211, &tmp212, &tmp213);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block21.is_used()) {
+    TNode<FixedArray> tmp214;
+    TNode<IntPtrT> tmp215;
+    TNode<JSReceiver> tmp216;
+    TNode<IntPtrT> tmp217;
+    TNode<IntPtrT> tmp218;
+    TNode<FixedArray> tmp219;
+    TNode<FixedArray> tmp220;
+    TNode<IntPtrT> tmp221;
+    TNode<IntPtrT> tmp222;
+    TNode<IntPtrT> tmp223;
+    TNode<IntPtrT> tmp224;
+    TNode<HeapObject> tmp225;
+    TNode<IntPtrT> tmp226;
+    ca_.Bind(&block21, &tmp214, &tmp215, &tmp216, &tmp217, &tmp218, &tmp219, &tmp220, &tmp221, &tmp222, &tmp223, &tmp224, &tmp225, &tmp226);
+    ca_.Goto(&block20, tmp214, tmp215, tmp216, tmp217, tmp218, tmp219, tmp220, tmp221, tmp222, tmp223, tmp224, tmp225, tmp226);
+  }
+
+  if (block20.is_used()) {
+    TNode<FixedArray> tmp227;
+    TNode<IntPtrT> tmp228;
+    TNode<JSReceiver> tmp229;
+    TNode<IntPtrT> tmp230;
+    TNode<IntPtrT> tmp231;
+    TNode<FixedArray> tmp232;
+    TNode<FixedArray> tmp233;
+    TNode<IntPtrT> tmp234;
+    TNode<IntPtrT> tmp235;
+    TNode<IntPtrT> tmp236;
+    TNode<IntPtrT> tmp237;
+    TNode<HeapObject> tmp238;
+    TNode<IntPtrT> tmp239;
+    ca_.Bind(&block20, &tmp227, &tmp228, &tmp229, &tmp230, &tmp231, &tmp232, &tmp233, &tmp234, &tmp235, &tmp236, &tmp237, &tmp238, &tmp239);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 141);
+    CodeStubAssembler(state_).StoreReference(CodeStubAssembler::Reference{tmp238, tmp239}, tmp229);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 142);
+    ca_.Goto(&block1, tmp227, tmp228, tmp229, tmp232);
+  }
+
+  if (block1.is_used()) {
+    TNode<FixedArray> tmp240;
+    TNode<IntPtrT> tmp241;
+    TNode<JSReceiver> tmp242;
+    TNode<FixedArray> tmp243;
+    ca_.Bind(&block1, &tmp240, &tmp241, &tmp242, &tmp243);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 458);
+    ca_.Goto(&block27, tmp240, tmp241, tmp242, tmp243);
+  }
+
+    TNode<FixedArray> tmp244;
+    TNode<IntPtrT> tmp245;
+    TNode<JSReceiver> tmp246;
+    TNode<FixedArray> tmp247;
+    ca_.Bind(&block27, &tmp244, &tmp245, &tmp246, &tmp247);
+  return TNode<FixedArray>{tmp247};
+}
+
+TNode<Object> CycleProtectedArrayJoin7JSArray_1382(compiler::CodeAssemblerState* state_, TNode<Context> p_context, bool p_useToLocaleString, TNode<JSReceiver> p_o, TNode<Number> p_len, TNode<Object> p_sepObj, TNode<Object> p_locales, TNode<Object> p_options) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object, String> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object, String, BoolT> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object, String, BoolT> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object, String, BoolT, BoolT> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object, String> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object, String, JSReceiver, String, Number, Object, Object, Object> block14(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object, String, Object, JSReceiver, Object> block15(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object, String, Object> block13(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object, String> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object, Object> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object, Object> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o, p_len, p_sepObj, p_locales, p_options);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<Number> tmp2;
+    TNode<Object> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4, &tmp5);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 533);
+    TNode<Oddball> tmp6;
+    USE(tmp6);
+    tmp6 = Undefined_64(state_);
+    TNode<BoolT> tmp7;
+    USE(tmp7);
+    tmp7 = CodeStubAssembler(state_).TaggedEqual(TNode<Object>{tmp3}, TNode<HeapObject>{tmp6});
+    ca_.Branch(tmp7, &block2, &block3, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp8;
+    TNode<JSReceiver> tmp9;
+    TNode<Number> tmp10;
+    TNode<Object> tmp11;
+    TNode<Object> tmp12;
+    TNode<Object> tmp13;
+    ca_.Bind(&block2, &tmp8, &tmp9, &tmp10, &tmp11, &tmp12, &tmp13);
+    ca_.Goto(&block5, tmp8, tmp9, tmp10, tmp11, tmp12, tmp13);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp14;
+    TNode<JSReceiver> tmp15;
+    TNode<Number> tmp16;
+    TNode<Object> tmp17;
+    TNode<Object> tmp18;
+    TNode<Object> tmp19;
+    ca_.Bind(&block3, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18, &tmp19);
+    TNode<String> tmp20;
+    USE(tmp20);
+    tmp20 = CodeStubAssembler(state_).ToString_Inline(TNode<Context>{tmp14}, TNode<Object>{tmp17});
+    ca_.Goto(&block4, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19, tmp20);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp21;
+    TNode<JSReceiver> tmp22;
+    TNode<Number> tmp23;
+    TNode<Object> tmp24;
+    TNode<Object> tmp25;
+    TNode<Object> tmp26;
+    ca_.Bind(&block5, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26);
+    TNode<String> tmp27;
+    USE(tmp27);
+    tmp27 = FromConstexpr6String18ATconstexpr_string_157(state_, ",");
+    ca_.Goto(&block4, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp28;
+    TNode<JSReceiver> tmp29;
+    TNode<Number> tmp30;
+    TNode<Object> tmp31;
+    TNode<Object> tmp32;
+    TNode<Object> tmp33;
+    TNode<String> tmp34;
+    ca_.Bind(&block4, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 532);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 537);
+    TNode<Number> tmp35;
+    USE(tmp35);
+    tmp35 = FromConstexpr20UT5ATSmi10HeapNumber17ATconstexpr_int31_161(state_, 0);
+    TNode<BoolT> tmp36;
+    USE(tmp36);
+    tmp36 = NumberIsGreaterThan_77(state_, TNode<Number>{tmp30}, TNode<Number>{tmp35});
+    ca_.Branch(tmp36, &block8, &block9, tmp28, tmp29, tmp30, tmp31, tmp32, tmp33, tmp34, tmp36);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp37;
+    TNode<JSReceiver> tmp38;
+    TNode<Number> tmp39;
+    TNode<Object> tmp40;
+    TNode<Object> tmp41;
+    TNode<Object> tmp42;
+    TNode<String> tmp43;
+    TNode<BoolT> tmp44;
+    ca_.Bind(&block8, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44);
+    TNode<BoolT> tmp45;
+    USE(tmp45);
+    tmp45 = JoinStackPushInline_17(state_, TNode<Context>{tmp37}, TNode<JSReceiver>{tmp38});
+    ca_.Goto(&block10, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42, tmp43, tmp44, tmp45);
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp46;
+    TNode<JSReceiver> tmp47;
+    TNode<Number> tmp48;
+    TNode<Object> tmp49;
+    TNode<Object> tmp50;
+    TNode<Object> tmp51;
+    TNode<String> tmp52;
+    TNode<BoolT> tmp53;
+    ca_.Bind(&block9, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53);
+    TNode<BoolT> tmp54;
+    USE(tmp54);
+    tmp54 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, false);
+    ca_.Goto(&block10, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51, tmp52, tmp53, tmp54);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp55;
+    TNode<JSReceiver> tmp56;
+    TNode<Number> tmp57;
+    TNode<Object> tmp58;
+    TNode<Object> tmp59;
+    TNode<Object> tmp60;
+    TNode<String> tmp61;
+    TNode<BoolT> tmp62;
+    TNode<BoolT> tmp63;
+    ca_.Bind(&block10, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63);
+    ca_.Branch(tmp63, &block6, &block7, tmp55, tmp56, tmp57, tmp58, tmp59, tmp60, tmp61);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp64;
+    TNode<JSReceiver> tmp65;
+    TNode<Number> tmp66;
+    TNode<Object> tmp67;
+    TNode<Object> tmp68;
+    TNode<Object> tmp69;
+    TNode<String> tmp70;
+    ca_.Bind(&block6, &tmp64, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 540);
+    TNode<Object> tmp71;
+    USE(tmp71);
+    compiler::CodeAssemblerExceptionHandlerLabel catch72__label(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+    { compiler::CodeAssemblerScopedExceptionHandler s(&ca_, &catch72__label);
+    tmp71 = ArrayJoin7JSArray_13(state_, TNode<Context>{tmp64}, p_useToLocaleString, TNode<JSReceiver>{tmp65}, TNode<String>{tmp70}, TNode<Number>{tmp66}, TNode<Object>{tmp68}, TNode<Object>{tmp69});
+    }
+    if (catch72__label.is_used()) {
+      compiler::CodeAssemblerLabel catch72_skip(&ca_);
+      ca_.Goto(&catch72_skip);
+      TNode<Object> catch72_exception_object;
+      ca_.Bind(&catch72__label, &catch72_exception_object);
+      ca_.Goto(&block14, tmp64, tmp65, tmp66, tmp67, tmp68, tmp69, tmp70, tmp65, tmp70, tmp66, tmp68, tmp69, catch72_exception_object);
+      ca_.Bind(&catch72_skip);
+    }
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 539);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 541);
+    compiler::CodeAssemblerExceptionHandlerLabel catch73__label(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+    { compiler::CodeAssemblerScopedExceptionHandler s(&ca_, &catch73__label);
+    JoinStackPopInline_18(state_, TNode<Context>{tmp64}, TNode<JSReceiver>{tmp65});
+    }
+    if (catch73__label.is_used()) {
+      compiler::CodeAssemblerLabel catch73_skip(&ca_);
+      ca_.Goto(&catch73_skip);
+      TNode<Object> catch73_exception_object;
+      ca_.Bind(&catch73__label, &catch73_exception_object);
+      ca_.Goto(&block15, tmp64, tmp65, tmp66, tmp67, tmp68, tmp69, tmp70, tmp71, tmp65, catch73_exception_object);
+      ca_.Bind(&catch73_skip);
+    }
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 542);
+    ca_.Goto(&block1, tmp64, tmp65, tmp66, tmp67, tmp68, tmp69, tmp71);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp74;
+    TNode<JSReceiver> tmp75;
+    TNode<Number> tmp76;
+    TNode<Object> tmp77;
+    TNode<Object> tmp78;
+    TNode<Object> tmp79;
+    TNode<String> tmp80;
+    TNode<JSReceiver> tmp81;
+    TNode<String> tmp82;
+    TNode<Number> tmp83;
+    TNode<Object> tmp84;
+    TNode<Object> tmp85;
+    TNode<Object> tmp86;
+    ca_.Bind(&block14, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 540);
+    ca_.Goto(&block13, tmp74, tmp75, tmp76, tmp77, tmp78, tmp79, tmp80, tmp86);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp87;
+    TNode<JSReceiver> tmp88;
+    TNode<Number> tmp89;
+    TNode<Object> tmp90;
+    TNode<Object> tmp91;
+    TNode<Object> tmp92;
+    TNode<String> tmp93;
+    TNode<Object> tmp94;
+    TNode<JSReceiver> tmp95;
+    TNode<Object> tmp96;
+    ca_.Bind(&block15, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 541);
+    ca_.Goto(&block13, tmp87, tmp88, tmp89, tmp90, tmp91, tmp92, tmp93, tmp96);
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp97;
+    TNode<JSReceiver> tmp98;
+    TNode<Number> tmp99;
+    TNode<Object> tmp100;
+    TNode<Object> tmp101;
+    TNode<Object> tmp102;
+    TNode<String> tmp103;
+    TNode<Object> tmp104;
+    ca_.Bind(&block13, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 544);
+    JoinStackPopInline_18(state_, TNode<Context>{tmp97}, TNode<JSReceiver>{tmp98});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 545);
+    CodeStubAssembler(state_).CallRuntime(Runtime::kReThrow, tmp97, tmp104);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp106;
+    TNode<JSReceiver> tmp107;
+    TNode<Number> tmp108;
+    TNode<Object> tmp109;
+    TNode<Object> tmp110;
+    TNode<Object> tmp111;
+    TNode<String> tmp112;
+    ca_.Bind(&block7, &tmp106, &tmp107, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 548);
+    TNode<String> tmp113;
+    USE(tmp113);
+    tmp113 = kEmptyString_67(state_);
+    ca_.Goto(&block1, tmp106, tmp107, tmp108, tmp109, tmp110, tmp111, tmp113);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp114;
+    TNode<JSReceiver> tmp115;
+    TNode<Number> tmp116;
+    TNode<Object> tmp117;
+    TNode<Object> tmp118;
+    TNode<Object> tmp119;
+    TNode<Object> tmp120;
+    ca_.Bind(&block1, &tmp114, &tmp115, &tmp116, &tmp117, &tmp118, &tmp119, &tmp120);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 568);
+    ca_.Goto(&block16, tmp114, tmp115, tmp116, tmp117, tmp118, tmp119, tmp120);
+  }
+
+    TNode<Context> tmp121;
+    TNode<JSReceiver> tmp122;
+    TNode<Number> tmp123;
+    TNode<Object> tmp124;
+    TNode<Object> tmp125;
+    TNode<Object> tmp126;
+    TNode<Object> tmp127;
+    ca_.Bind(&block16, &tmp121, &tmp122, &tmp123, &tmp124, &tmp125, &tmp126, &tmp127);
+  return TNode<Object>{tmp127};
+}
+
+TNode<Object> CycleProtectedArrayJoin12JSTypedArray_1383(compiler::CodeAssemblerState* state_, TNode<Context> p_context, bool p_useToLocaleString, TNode<JSReceiver> p_o, TNode<Number> p_len, TNode<Object> p_sepObj, TNode<Object> p_locales, TNode<Object> p_options) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object, String> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object, String, BoolT> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object, String, BoolT> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object, String, BoolT, BoolT> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object, String> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object, String, JSReceiver, String, Number, Object, Object, Object> block14(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object, String, Object, JSReceiver, Object> block15(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object, String, Object> block13(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object, String> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object, Object> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, Object, Object, Object, Object> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o, p_len, p_sepObj, p_locales, p_options);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<Number> tmp2;
+    TNode<Object> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4, &tmp5);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 533);
+    TNode<Oddball> tmp6;
+    USE(tmp6);
+    tmp6 = Undefined_64(state_);
+    TNode<BoolT> tmp7;
+    USE(tmp7);
+    tmp7 = CodeStubAssembler(state_).TaggedEqual(TNode<Object>{tmp3}, TNode<HeapObject>{tmp6});
+    ca_.Branch(tmp7, &block2, &block3, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp8;
+    TNode<JSReceiver> tmp9;
+    TNode<Number> tmp10;
+    TNode<Object> tmp11;
+    TNode<Object> tmp12;
+    TNode<Object> tmp13;
+    ca_.Bind(&block2, &tmp8, &tmp9, &tmp10, &tmp11, &tmp12, &tmp13);
+    ca_.Goto(&block5, tmp8, tmp9, tmp10, tmp11, tmp12, tmp13);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp14;
+    TNode<JSReceiver> tmp15;
+    TNode<Number> tmp16;
+    TNode<Object> tmp17;
+    TNode<Object> tmp18;
+    TNode<Object> tmp19;
+    ca_.Bind(&block3, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18, &tmp19);
+    TNode<String> tmp20;
+    USE(tmp20);
+    tmp20 = CodeStubAssembler(state_).ToString_Inline(TNode<Context>{tmp14}, TNode<Object>{tmp17});
+    ca_.Goto(&block4, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19, tmp20);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp21;
+    TNode<JSReceiver> tmp22;
+    TNode<Number> tmp23;
+    TNode<Object> tmp24;
+    TNode<Object> tmp25;
+    TNode<Object> tmp26;
+    ca_.Bind(&block5, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26);
+    TNode<String> tmp27;
+    USE(tmp27);
+    tmp27 = FromConstexpr6String18ATconstexpr_string_157(state_, ",");
+    ca_.Goto(&block4, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp28;
+    TNode<JSReceiver> tmp29;
+    TNode<Number> tmp30;
+    TNode<Object> tmp31;
+    TNode<Object> tmp32;
+    TNode<Object> tmp33;
+    TNode<String> tmp34;
+    ca_.Bind(&block4, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 532);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 537);
+    TNode<Number> tmp35;
+    USE(tmp35);
+    tmp35 = FromConstexpr20UT5ATSmi10HeapNumber17ATconstexpr_int31_161(state_, 0);
+    TNode<BoolT> tmp36;
+    USE(tmp36);
+    tmp36 = NumberIsGreaterThan_77(state_, TNode<Number>{tmp30}, TNode<Number>{tmp35});
+    ca_.Branch(tmp36, &block8, &block9, tmp28, tmp29, tmp30, tmp31, tmp32, tmp33, tmp34, tmp36);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp37;
+    TNode<JSReceiver> tmp38;
+    TNode<Number> tmp39;
+    TNode<Object> tmp40;
+    TNode<Object> tmp41;
+    TNode<Object> tmp42;
+    TNode<String> tmp43;
+    TNode<BoolT> tmp44;
+    ca_.Bind(&block8, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44);
+    TNode<BoolT> tmp45;
+    USE(tmp45);
+    tmp45 = JoinStackPushInline_17(state_, TNode<Context>{tmp37}, TNode<JSReceiver>{tmp38});
+    ca_.Goto(&block10, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42, tmp43, tmp44, tmp45);
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp46;
+    TNode<JSReceiver> tmp47;
+    TNode<Number> tmp48;
+    TNode<Object> tmp49;
+    TNode<Object> tmp50;
+    TNode<Object> tmp51;
+    TNode<String> tmp52;
+    TNode<BoolT> tmp53;
+    ca_.Bind(&block9, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53);
+    TNode<BoolT> tmp54;
+    USE(tmp54);
+    tmp54 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, false);
+    ca_.Goto(&block10, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51, tmp52, tmp53, tmp54);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp55;
+    TNode<JSReceiver> tmp56;
+    TNode<Number> tmp57;
+    TNode<Object> tmp58;
+    TNode<Object> tmp59;
+    TNode<Object> tmp60;
+    TNode<String> tmp61;
+    TNode<BoolT> tmp62;
+    TNode<BoolT> tmp63;
+    ca_.Bind(&block10, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63);
+    ca_.Branch(tmp63, &block6, &block7, tmp55, tmp56, tmp57, tmp58, tmp59, tmp60, tmp61);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp64;
+    TNode<JSReceiver> tmp65;
+    TNode<Number> tmp66;
+    TNode<Object> tmp67;
+    TNode<Object> tmp68;
+    TNode<Object> tmp69;
+    TNode<String> tmp70;
+    ca_.Bind(&block6, &tmp64, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 540);
+    TNode<Object> tmp71;
+    USE(tmp71);
+    compiler::CodeAssemblerExceptionHandlerLabel catch72__label(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+    { compiler::CodeAssemblerScopedExceptionHandler s(&ca_, &catch72__label);
+    tmp71 = ArrayJoin12JSTypedArray_14(state_, TNode<Context>{tmp64}, p_useToLocaleString, TNode<JSReceiver>{tmp65}, TNode<String>{tmp70}, TNode<Number>{tmp66}, TNode<Object>{tmp68}, TNode<Object>{tmp69});
+    }
+    if (catch72__label.is_used()) {
+      compiler::CodeAssemblerLabel catch72_skip(&ca_);
+      ca_.Goto(&catch72_skip);
+      TNode<Object> catch72_exception_object;
+      ca_.Bind(&catch72__label, &catch72_exception_object);
+      ca_.Goto(&block14, tmp64, tmp65, tmp66, tmp67, tmp68, tmp69, tmp70, tmp65, tmp70, tmp66, tmp68, tmp69, catch72_exception_object);
+      ca_.Bind(&catch72_skip);
+    }
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 539);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 541);
+    compiler::CodeAssemblerExceptionHandlerLabel catch73__label(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+    { compiler::CodeAssemblerScopedExceptionHandler s(&ca_, &catch73__label);
+    JoinStackPopInline_18(state_, TNode<Context>{tmp64}, TNode<JSReceiver>{tmp65});
+    }
+    if (catch73__label.is_used()) {
+      compiler::CodeAssemblerLabel catch73_skip(&ca_);
+      ca_.Goto(&catch73_skip);
+      TNode<Object> catch73_exception_object;
+      ca_.Bind(&catch73__label, &catch73_exception_object);
+      ca_.Goto(&block15, tmp64, tmp65, tmp66, tmp67, tmp68, tmp69, tmp70, tmp71, tmp65, catch73_exception_object);
+      ca_.Bind(&catch73_skip);
+    }
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 542);
+    ca_.Goto(&block1, tmp64, tmp65, tmp66, tmp67, tmp68, tmp69, tmp71);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp74;
+    TNode<JSReceiver> tmp75;
+    TNode<Number> tmp76;
+    TNode<Object> tmp77;
+    TNode<Object> tmp78;
+    TNode<Object> tmp79;
+    TNode<String> tmp80;
+    TNode<JSReceiver> tmp81;
+    TNode<String> tmp82;
+    TNode<Number> tmp83;
+    TNode<Object> tmp84;
+    TNode<Object> tmp85;
+    TNode<Object> tmp86;
+    ca_.Bind(&block14, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 540);
+    ca_.Goto(&block13, tmp74, tmp75, tmp76, tmp77, tmp78, tmp79, tmp80, tmp86);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp87;
+    TNode<JSReceiver> tmp88;
+    TNode<Number> tmp89;
+    TNode<Object> tmp90;
+    TNode<Object> tmp91;
+    TNode<Object> tmp92;
+    TNode<String> tmp93;
+    TNode<Object> tmp94;
+    TNode<JSReceiver> tmp95;
+    TNode<Object> tmp96;
+    ca_.Bind(&block15, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 541);
+    ca_.Goto(&block13, tmp87, tmp88, tmp89, tmp90, tmp91, tmp92, tmp93, tmp96);
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp97;
+    TNode<JSReceiver> tmp98;
+    TNode<Number> tmp99;
+    TNode<Object> tmp100;
+    TNode<Object> tmp101;
+    TNode<Object> tmp102;
+    TNode<String> tmp103;
+    TNode<Object> tmp104;
+    ca_.Bind(&block13, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 544);
+    JoinStackPopInline_18(state_, TNode<Context>{tmp97}, TNode<JSReceiver>{tmp98});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 545);
+    CodeStubAssembler(state_).CallRuntime(Runtime::kReThrow, tmp97, tmp104);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp106;
+    TNode<JSReceiver> tmp107;
+    TNode<Number> tmp108;
+    TNode<Object> tmp109;
+    TNode<Object> tmp110;
+    TNode<Object> tmp111;
+    TNode<String> tmp112;
+    ca_.Bind(&block7, &tmp106, &tmp107, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 548);
+    TNode<String> tmp113;
+    USE(tmp113);
+    tmp113 = kEmptyString_67(state_);
+    ca_.Goto(&block1, tmp106, tmp107, tmp108, tmp109, tmp110, tmp111, tmp113);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp114;
+    TNode<JSReceiver> tmp115;
+    TNode<Number> tmp116;
+    TNode<Object> tmp117;
+    TNode<Object> tmp118;
+    TNode<Object> tmp119;
+    TNode<Object> tmp120;
+    ca_.Bind(&block1, &tmp114, &tmp115, &tmp116, &tmp117, &tmp118, &tmp119, &tmp120);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 624);
+    ca_.Goto(&block16, tmp114, tmp115, tmp116, tmp117, tmp118, tmp119, tmp120);
+  }
+
+    TNode<Context> tmp121;
+    TNode<JSReceiver> tmp122;
+    TNode<Number> tmp123;
+    TNode<Object> tmp124;
+    TNode<Object> tmp125;
+    TNode<Object> tmp126;
+    TNode<Object> tmp127;
+    ca_.Bind(&block16, &tmp121, &tmp122, &tmp123, &tmp124, &tmp125, &tmp126, &tmp127);
+  return TNode<Object>{tmp127};
+}
+
+TNode<FixedArray> StoreAndGrowFixedArray5ATSmi_1456(compiler::CodeAssemblerState* state_, TNode<FixedArray> p_fixedArray, TNode<IntPtrT> p_index, TNode<Smi> p_element) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi, IntPtrT> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi, IntPtrT> block5(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi, IntPtrT> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi, IntPtrT> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi, IntPtrT> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi, IntPtrT> block7(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi, IntPtrT, IntPtrT> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi, IntPtrT, IntPtrT> block19(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi, IntPtrT, IntPtrT> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi, IntPtrT, IntPtrT> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi, IntPtrT, IntPtrT, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block24(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi, IntPtrT, IntPtrT, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block25(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi, IntPtrT, IntPtrT, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block23(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi, IntPtrT, IntPtrT, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block22(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi, IntPtrT, IntPtrT, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi, IntPtrT, IntPtrT, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi, FixedArray> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, Smi, FixedArray> block27(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_fixedArray, p_index, p_element);
+
+  if (block0.is_used()) {
+    TNode<FixedArray> tmp0;
+    TNode<IntPtrT> tmp1;
+    TNode<Smi> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 130);
+    TNode<IntPtrT> tmp3;
+    USE(tmp3);
+    tmp3 = CodeStubAssembler(state_).LoadAndUntagFixedArrayBaseLength(TNode<FixedArrayBase>{tmp0});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 131);
+    ca_.Goto(&block3, tmp0, tmp1, tmp2, tmp3);
+  }
+
+  if (block2.is_used()) {
+    TNode<FixedArray> tmp4;
+    TNode<IntPtrT> tmp5;
+    TNode<Smi> tmp6;
+    TNode<IntPtrT> tmp7;
+    ca_.Bind(&block2, &tmp4, &tmp5, &tmp6, &tmp7);
+    TNode<BoolT> tmp8;
+    USE(tmp8);
+    tmp8 = CodeStubAssembler(state_).IntPtrLessThanOrEqual(TNode<IntPtrT>{tmp5}, TNode<IntPtrT>{tmp7});
+    ca_.Branch(tmp8, &block4, &block5, tmp4, tmp5, tmp6, tmp7);
+  }
+
+  if (block5.is_used()) {
+    TNode<FixedArray> tmp9;
+    TNode<IntPtrT> tmp10;
+    TNode<Smi> tmp11;
+    TNode<IntPtrT> tmp12;
+    ca_.Bind(&block5, &tmp9, &tmp10, &tmp11, &tmp12);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'index <= length' failed", "../../deps/v8/src/builtins/array-join.tq", 131);
+  }
+
+  if (block4.is_used()) {
+    TNode<FixedArray> tmp13;
+    TNode<IntPtrT> tmp14;
+    TNode<Smi> tmp15;
+    TNode<IntPtrT> tmp16;
+    ca_.Bind(&block4, &tmp13, &tmp14, &tmp15, &tmp16);
+  }
+
+  if (block3.is_used()) {
+    TNode<FixedArray> tmp17;
+    TNode<IntPtrT> tmp18;
+    TNode<Smi> tmp19;
+    TNode<IntPtrT> tmp20;
+    ca_.Bind(&block3, &tmp17, &tmp18, &tmp19, &tmp20);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 132);
+    TNode<BoolT> tmp21;
+    USE(tmp21);
+    tmp21 = CodeStubAssembler(state_).IntPtrLessThan(TNode<IntPtrT>{tmp18}, TNode<IntPtrT>{tmp20});
+    ca_.Branch(tmp21, &block6, &block7, tmp17, tmp18, tmp19, tmp20);
+  }
+
+  if (block6.is_used()) {
+    TNode<FixedArray> tmp22;
+    TNode<IntPtrT> tmp23;
+    TNode<Smi> tmp24;
+    TNode<IntPtrT> tmp25;
+    ca_.Bind(&block6, &tmp22, &tmp23, &tmp24, &tmp25);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 133);
+    TNode<IntPtrT> tmp26 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp26);
+    TNode<IntPtrT> tmp27 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp27);
+    TNode<Smi>tmp28 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp22, tmp27});
+    TNode<IntPtrT> tmp29;
+    USE(tmp29);
+    tmp29 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp28});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 46);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp30;
+    USE(tmp30);
+    tmp30 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp23});
+    TNode<UintPtrT> tmp31;
+    USE(tmp31);
+    tmp31 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp29});
+    TNode<BoolT> tmp32;
+    USE(tmp32);
+    tmp32 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp30}, TNode<UintPtrT>{tmp31});
+    ca_.Branch(tmp32, &block13, &block14, tmp22, tmp23, tmp24, tmp25, tmp22, tmp26, tmp29, tmp23, tmp23, tmp22, tmp26, tmp29, tmp23, tmp23);
+  }
+
+  if (block13.is_used()) {
+    TNode<FixedArray> tmp33;
+    TNode<IntPtrT> tmp34;
+    TNode<Smi> tmp35;
+    TNode<IntPtrT> tmp36;
+    TNode<FixedArray> tmp37;
+    TNode<IntPtrT> tmp38;
+    TNode<IntPtrT> tmp39;
+    TNode<IntPtrT> tmp40;
+    TNode<IntPtrT> tmp41;
+    TNode<HeapObject> tmp42;
+    TNode<IntPtrT> tmp43;
+    TNode<IntPtrT> tmp44;
+    TNode<IntPtrT> tmp45;
+    TNode<IntPtrT> tmp46;
+    ca_.Bind(&block13, &tmp33, &tmp34, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44, &tmp45, &tmp46);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp47;
+    USE(tmp47);
+    tmp47 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp48;
+    USE(tmp48);
+    tmp48 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp46}, TNode<IntPtrT>{tmp47});
+    TNode<IntPtrT> tmp49;
+    USE(tmp49);
+    tmp49 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp43}, TNode<IntPtrT>{tmp48});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp50;
+    USE(tmp50);
+    TNode<IntPtrT> tmp51;
+    USE(tmp51);
+    std::tie(tmp50, tmp51) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp42}, TNode<IntPtrT>{tmp49}).Flatten();
+    ca_.Goto(&block12, tmp33, tmp34, tmp35, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42, tmp43, tmp44, tmp45, tmp46, tmp50, tmp51);
+  }
+
+  if (block14.is_used()) {
+    TNode<FixedArray> tmp52;
+    TNode<IntPtrT> tmp53;
+    TNode<Smi> tmp54;
+    TNode<IntPtrT> tmp55;
+    TNode<FixedArray> tmp56;
+    TNode<IntPtrT> tmp57;
+    TNode<IntPtrT> tmp58;
+    TNode<IntPtrT> tmp59;
+    TNode<IntPtrT> tmp60;
+    TNode<HeapObject> tmp61;
+    TNode<IntPtrT> tmp62;
+    TNode<IntPtrT> tmp63;
+    TNode<IntPtrT> tmp64;
+    TNode<IntPtrT> tmp65;
+    ca_.Bind(&block14, &tmp52, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block11, tmp52, tmp53, tmp54, tmp55, tmp56, tmp57, tmp58, tmp59, tmp60);
+  }
+
+  if (block12.is_used()) {
+    TNode<FixedArray> tmp66;
+    TNode<IntPtrT> tmp67;
+    TNode<Smi> tmp68;
+    TNode<IntPtrT> tmp69;
+    TNode<FixedArray> tmp70;
+    TNode<IntPtrT> tmp71;
+    TNode<IntPtrT> tmp72;
+    TNode<IntPtrT> tmp73;
+    TNode<IntPtrT> tmp74;
+    TNode<HeapObject> tmp75;
+    TNode<IntPtrT> tmp76;
+    TNode<IntPtrT> tmp77;
+    TNode<IntPtrT> tmp78;
+    TNode<IntPtrT> tmp79;
+    TNode<HeapObject> tmp80;
+    TNode<IntPtrT> tmp81;
+    ca_.Bind(&block12, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 46);
+    ca_.Goto(&block10, tmp66, tmp67, tmp68, tmp69, tmp70, tmp71, tmp72, tmp73, tmp74, tmp80, tmp81);
+  }
+
+  if (block11.is_used()) {
+    TNode<FixedArray> tmp82;
+    TNode<IntPtrT> tmp83;
+    TNode<Smi> tmp84;
+    TNode<IntPtrT> tmp85;
+    TNode<FixedArray> tmp86;
+    TNode<IntPtrT> tmp87;
+    TNode<IntPtrT> tmp88;
+    TNode<IntPtrT> tmp89;
+    TNode<IntPtrT> tmp90;
+    ca_.Bind(&block11, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block10.is_used()) {
+    TNode<FixedArray> tmp91;
+    TNode<IntPtrT> tmp92;
+    TNode<Smi> tmp93;
+    TNode<IntPtrT> tmp94;
+    TNode<FixedArray> tmp95;
+    TNode<IntPtrT> tmp96;
+    TNode<IntPtrT> tmp97;
+    TNode<IntPtrT> tmp98;
+    TNode<IntPtrT> tmp99;
+    TNode<HeapObject> tmp100;
+    TNode<IntPtrT> tmp101;
+    ca_.Bind(&block10, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101);
+    ca_.Goto(&block9, tmp91, tmp92, tmp93, tmp94, tmp95, tmp96, tmp97, tmp98, tmp99, tmp100, tmp101);
+  }
+
+  if (block9.is_used()) {
+    TNode<FixedArray> tmp102;
+    TNode<IntPtrT> tmp103;
+    TNode<Smi> tmp104;
+    TNode<IntPtrT> tmp105;
+    TNode<FixedArray> tmp106;
+    TNode<IntPtrT> tmp107;
+    TNode<IntPtrT> tmp108;
+    TNode<IntPtrT> tmp109;
+    TNode<IntPtrT> tmp110;
+    TNode<HeapObject> tmp111;
+    TNode<IntPtrT> tmp112;
+    ca_.Bind(&block9, &tmp102, &tmp103, &tmp104, &tmp105, &tmp106, &tmp107, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 133);
+    CodeStubAssembler(state_).StoreReference(CodeStubAssembler::Reference{tmp111, tmp112}, tmp104);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 134);
+    ca_.Goto(&block1, tmp102, tmp103, tmp104, tmp102);
+  }
+
+  if (block7.is_used()) {
+    TNode<FixedArray> tmp113;
+    TNode<IntPtrT> tmp114;
+    TNode<Smi> tmp115;
+    TNode<IntPtrT> tmp116;
+    ca_.Bind(&block7, &tmp113, &tmp114, &tmp115, &tmp116);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 137);
+    TNode<IntPtrT> tmp117;
+    USE(tmp117);
+    tmp117 = CodeStubAssembler(state_).CalculateNewElementsCapacity(TNode<IntPtrT>{tmp116});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 138);
+    ca_.Goto(&block17, tmp113, tmp114, tmp115, tmp116, tmp117);
+  }
+
+  if (block16.is_used()) {
+    TNode<FixedArray> tmp118;
+    TNode<IntPtrT> tmp119;
+    TNode<Smi> tmp120;
+    TNode<IntPtrT> tmp121;
+    TNode<IntPtrT> tmp122;
+    ca_.Bind(&block16, &tmp118, &tmp119, &tmp120, &tmp121, &tmp122);
+    TNode<BoolT> tmp123;
+    USE(tmp123);
+    tmp123 = CodeStubAssembler(state_).IntPtrLessThan(TNode<IntPtrT>{tmp119}, TNode<IntPtrT>{tmp122});
+    ca_.Branch(tmp123, &block18, &block19, tmp118, tmp119, tmp120, tmp121, tmp122);
+  }
+
+  if (block19.is_used()) {
+    TNode<FixedArray> tmp124;
+    TNode<IntPtrT> tmp125;
+    TNode<Smi> tmp126;
+    TNode<IntPtrT> tmp127;
+    TNode<IntPtrT> tmp128;
+    ca_.Bind(&block19, &tmp124, &tmp125, &tmp126, &tmp127, &tmp128);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'index < newLength' failed", "../../deps/v8/src/builtins/array-join.tq", 138);
+  }
+
+  if (block18.is_used()) {
+    TNode<FixedArray> tmp129;
+    TNode<IntPtrT> tmp130;
+    TNode<Smi> tmp131;
+    TNode<IntPtrT> tmp132;
+    TNode<IntPtrT> tmp133;
+    ca_.Bind(&block18, &tmp129, &tmp130, &tmp131, &tmp132, &tmp133);
+  }
+
+  if (block17.is_used()) {
+    TNode<FixedArray> tmp134;
+    TNode<IntPtrT> tmp135;
+    TNode<Smi> tmp136;
+    TNode<IntPtrT> tmp137;
+    TNode<IntPtrT> tmp138;
+    ca_.Bind(&block17, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 140);
+    TNode<IntPtrT> tmp139;
+    USE(tmp139);
+    tmp139 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<FixedArray> tmp140;
+    USE(tmp140);
+    tmp140 = CodeStubAssembler(state_).ExtractFixedArray(TNode<FixedArray>{tmp134}, TNode<IntPtrT>{tmp139}, TNode<IntPtrT>{tmp137}, TNode<IntPtrT>{tmp138}, CodeStubAssembler::ExtractFixedArrayFlag::kFixedArrays);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 139);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 141);
+    TNode<IntPtrT> tmp141 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp141);
+    TNode<IntPtrT> tmp142 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp142);
+    TNode<Smi>tmp143 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp140, tmp142});
+    TNode<IntPtrT> tmp144;
+    USE(tmp144);
+    tmp144 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp143});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 46);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp145;
+    USE(tmp145);
+    tmp145 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp135});
+    TNode<UintPtrT> tmp146;
+    USE(tmp146);
+    tmp146 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp144});
+    TNode<BoolT> tmp147;
+    USE(tmp147);
+    tmp147 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp145}, TNode<UintPtrT>{tmp146});
+    ca_.Branch(tmp147, &block24, &block25, tmp134, tmp135, tmp136, tmp137, tmp138, tmp140, tmp140, tmp141, tmp144, tmp135, tmp135, tmp140, tmp141, tmp144, tmp135, tmp135);
+  }
+
+  if (block24.is_used()) {
+    TNode<FixedArray> tmp148;
+    TNode<IntPtrT> tmp149;
+    TNode<Smi> tmp150;
+    TNode<IntPtrT> tmp151;
+    TNode<IntPtrT> tmp152;
+    TNode<FixedArray> tmp153;
+    TNode<FixedArray> tmp154;
+    TNode<IntPtrT> tmp155;
+    TNode<IntPtrT> tmp156;
+    TNode<IntPtrT> tmp157;
+    TNode<IntPtrT> tmp158;
+    TNode<HeapObject> tmp159;
+    TNode<IntPtrT> tmp160;
+    TNode<IntPtrT> tmp161;
+    TNode<IntPtrT> tmp162;
+    TNode<IntPtrT> tmp163;
+    ca_.Bind(&block24, &tmp148, &tmp149, &tmp150, &tmp151, &tmp152, &tmp153, &tmp154, &tmp155, &tmp156, &tmp157, &tmp158, &tmp159, &tmp160, &tmp161, &tmp162, &tmp163);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp164;
+    USE(tmp164);
+    tmp164 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp165;
+    USE(tmp165);
+    tmp165 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp163}, TNode<IntPtrT>{tmp164});
+    TNode<IntPtrT> tmp166;
+    USE(tmp166);
+    tmp166 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp160}, TNode<IntPtrT>{tmp165});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp167;
+    USE(tmp167);
+    TNode<IntPtrT> tmp168;
+    USE(tmp168);
+    std::tie(tmp167, tmp168) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp159}, TNode<IntPtrT>{tmp166}).Flatten();
+    ca_.Goto(&block23, tmp148, tmp149, tmp150, tmp151, tmp152, tmp153, tmp154, tmp155, tmp156, tmp157, tmp158, tmp159, tmp160, tmp161, tmp162, tmp163, tmp167, tmp168);
+  }
+
+  if (block25.is_used()) {
+    TNode<FixedArray> tmp169;
+    TNode<IntPtrT> tmp170;
+    TNode<Smi> tmp171;
+    TNode<IntPtrT> tmp172;
+    TNode<IntPtrT> tmp173;
+    TNode<FixedArray> tmp174;
+    TNode<FixedArray> tmp175;
+    TNode<IntPtrT> tmp176;
+    TNode<IntPtrT> tmp177;
+    TNode<IntPtrT> tmp178;
+    TNode<IntPtrT> tmp179;
+    TNode<HeapObject> tmp180;
+    TNode<IntPtrT> tmp181;
+    TNode<IntPtrT> tmp182;
+    TNode<IntPtrT> tmp183;
+    TNode<IntPtrT> tmp184;
+    ca_.Bind(&block25, &tmp169, &tmp170, &tmp171, &tmp172, &tmp173, &tmp174, &tmp175, &tmp176, &tmp177, &tmp178, &tmp179, &tmp180, &tmp181, &tmp182, &tmp183, &tmp184);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block22, tmp169, tmp170, tmp171, tmp172, tmp173, tmp174, tmp175, tmp176, tmp177, tmp178, tmp179);
+  }
+
+  if (block23.is_used()) {
+    TNode<FixedArray> tmp185;
+    TNode<IntPtrT> tmp186;
+    TNode<Smi> tmp187;
+    TNode<IntPtrT> tmp188;
+    TNode<IntPtrT> tmp189;
+    TNode<FixedArray> tmp190;
+    TNode<FixedArray> tmp191;
+    TNode<IntPtrT> tmp192;
+    TNode<IntPtrT> tmp193;
+    TNode<IntPtrT> tmp194;
+    TNode<IntPtrT> tmp195;
+    TNode<HeapObject> tmp196;
+    TNode<IntPtrT> tmp197;
+    TNode<IntPtrT> tmp198;
+    TNode<IntPtrT> tmp199;
+    TNode<IntPtrT> tmp200;
+    TNode<HeapObject> tmp201;
+    TNode<IntPtrT> tmp202;
+    ca_.Bind(&block23, &tmp185, &tmp186, &tmp187, &tmp188, &tmp189, &tmp190, &tmp191, &tmp192, &tmp193, &tmp194, &tmp195, &tmp196, &tmp197, &tmp198, &tmp199, &tmp200, &tmp201, &tmp202);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 46);
+    ca_.Goto(&block21, tmp185, tmp186, tmp187, tmp188, tmp189, tmp190, tmp191, tmp192, tmp193, tmp194, tmp195, tmp201, tmp202);
+  }
+
+  if (block22.is_used()) {
+    TNode<FixedArray> tmp203;
+    TNode<IntPtrT> tmp204;
+    TNode<Smi> tmp205;
+    TNode<IntPtrT> tmp206;
+    TNode<IntPtrT> tmp207;
+    TNode<FixedArray> tmp208;
+    TNode<FixedArray> tmp209;
+    TNode<IntPtrT> tmp210;
+    TNode<IntPtrT> tmp211;
+    TNode<IntPtrT> tmp212;
+    TNode<IntPtrT> tmp213;
+    ca_.Bind(&block22, &tmp203, &tmp204, &tmp205, &tmp206, &tmp207, &tmp208, &tmp209, &tmp210, &tmp211, &tmp212, &tmp213);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block21.is_used()) {
+    TNode<FixedArray> tmp214;
+    TNode<IntPtrT> tmp215;
+    TNode<Smi> tmp216;
+    TNode<IntPtrT> tmp217;
+    TNode<IntPtrT> tmp218;
+    TNode<FixedArray> tmp219;
+    TNode<FixedArray> tmp220;
+    TNode<IntPtrT> tmp221;
+    TNode<IntPtrT> tmp222;
+    TNode<IntPtrT> tmp223;
+    TNode<IntPtrT> tmp224;
+    TNode<HeapObject> tmp225;
+    TNode<IntPtrT> tmp226;
+    ca_.Bind(&block21, &tmp214, &tmp215, &tmp216, &tmp217, &tmp218, &tmp219, &tmp220, &tmp221, &tmp222, &tmp223, &tmp224, &tmp225, &tmp226);
+    ca_.Goto(&block20, tmp214, tmp215, tmp216, tmp217, tmp218, tmp219, tmp220, tmp221, tmp222, tmp223, tmp224, tmp225, tmp226);
+  }
+
+  if (block20.is_used()) {
+    TNode<FixedArray> tmp227;
+    TNode<IntPtrT> tmp228;
+    TNode<Smi> tmp229;
+    TNode<IntPtrT> tmp230;
+    TNode<IntPtrT> tmp231;
+    TNode<FixedArray> tmp232;
+    TNode<FixedArray> tmp233;
+    TNode<IntPtrT> tmp234;
+    TNode<IntPtrT> tmp235;
+    TNode<IntPtrT> tmp236;
+    TNode<IntPtrT> tmp237;
+    TNode<HeapObject> tmp238;
+    TNode<IntPtrT> tmp239;
+    ca_.Bind(&block20, &tmp227, &tmp228, &tmp229, &tmp230, &tmp231, &tmp232, &tmp233, &tmp234, &tmp235, &tmp236, &tmp237, &tmp238, &tmp239);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 141);
+    CodeStubAssembler(state_).StoreReference(CodeStubAssembler::Reference{tmp238, tmp239}, tmp229);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 142);
+    ca_.Goto(&block1, tmp227, tmp228, tmp229, tmp232);
+  }
+
+  if (block1.is_used()) {
+    TNode<FixedArray> tmp240;
+    TNode<IntPtrT> tmp241;
+    TNode<Smi> tmp242;
+    TNode<FixedArray> tmp243;
+    ca_.Bind(&block1, &tmp240, &tmp241, &tmp242, &tmp243);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 179);
+    ca_.Goto(&block27, tmp240, tmp241, tmp242, tmp243);
+  }
+
+    TNode<FixedArray> tmp244;
+    TNode<IntPtrT> tmp245;
+    TNode<Smi> tmp246;
+    TNode<FixedArray> tmp247;
+    ca_.Bind(&block27, &tmp244, &tmp245, &tmp246, &tmp247);
+  return TNode<FixedArray>{tmp247};
+}
+
+TNode<FixedArray> StoreAndGrowFixedArray6String_1457(compiler::CodeAssemblerState* state_, TNode<FixedArray> p_fixedArray, TNode<IntPtrT> p_index, TNode<String> p_element) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String, IntPtrT> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String, IntPtrT> block5(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String, IntPtrT> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String, IntPtrT> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String, IntPtrT> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String, IntPtrT, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String, IntPtrT> block7(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String, IntPtrT, IntPtrT> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String, IntPtrT, IntPtrT> block19(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String, IntPtrT, IntPtrT> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String, IntPtrT, IntPtrT> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String, IntPtrT, IntPtrT, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block24(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String, IntPtrT, IntPtrT, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block25(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String, IntPtrT, IntPtrT, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block23(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String, IntPtrT, IntPtrT, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block22(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String, IntPtrT, IntPtrT, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String, IntPtrT, IntPtrT, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String, FixedArray> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<FixedArray, IntPtrT, String, FixedArray> block27(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_fixedArray, p_index, p_element);
+
+  if (block0.is_used()) {
+    TNode<FixedArray> tmp0;
+    TNode<IntPtrT> tmp1;
+    TNode<String> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 130);
+    TNode<IntPtrT> tmp3;
+    USE(tmp3);
+    tmp3 = CodeStubAssembler(state_).LoadAndUntagFixedArrayBaseLength(TNode<FixedArrayBase>{tmp0});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 131);
+    ca_.Goto(&block3, tmp0, tmp1, tmp2, tmp3);
+  }
+
+  if (block2.is_used()) {
+    TNode<FixedArray> tmp4;
+    TNode<IntPtrT> tmp5;
+    TNode<String> tmp6;
+    TNode<IntPtrT> tmp7;
+    ca_.Bind(&block2, &tmp4, &tmp5, &tmp6, &tmp7);
+    TNode<BoolT> tmp8;
+    USE(tmp8);
+    tmp8 = CodeStubAssembler(state_).IntPtrLessThanOrEqual(TNode<IntPtrT>{tmp5}, TNode<IntPtrT>{tmp7});
+    ca_.Branch(tmp8, &block4, &block5, tmp4, tmp5, tmp6, tmp7);
+  }
+
+  if (block5.is_used()) {
+    TNode<FixedArray> tmp9;
+    TNode<IntPtrT> tmp10;
+    TNode<String> tmp11;
+    TNode<IntPtrT> tmp12;
+    ca_.Bind(&block5, &tmp9, &tmp10, &tmp11, &tmp12);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'index <= length' failed", "../../deps/v8/src/builtins/array-join.tq", 131);
+  }
+
+  if (block4.is_used()) {
+    TNode<FixedArray> tmp13;
+    TNode<IntPtrT> tmp14;
+    TNode<String> tmp15;
+    TNode<IntPtrT> tmp16;
+    ca_.Bind(&block4, &tmp13, &tmp14, &tmp15, &tmp16);
+  }
+
+  if (block3.is_used()) {
+    TNode<FixedArray> tmp17;
+    TNode<IntPtrT> tmp18;
+    TNode<String> tmp19;
+    TNode<IntPtrT> tmp20;
+    ca_.Bind(&block3, &tmp17, &tmp18, &tmp19, &tmp20);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 132);
+    TNode<BoolT> tmp21;
+    USE(tmp21);
+    tmp21 = CodeStubAssembler(state_).IntPtrLessThan(TNode<IntPtrT>{tmp18}, TNode<IntPtrT>{tmp20});
+    ca_.Branch(tmp21, &block6, &block7, tmp17, tmp18, tmp19, tmp20);
+  }
+
+  if (block6.is_used()) {
+    TNode<FixedArray> tmp22;
+    TNode<IntPtrT> tmp23;
+    TNode<String> tmp24;
+    TNode<IntPtrT> tmp25;
+    ca_.Bind(&block6, &tmp22, &tmp23, &tmp24, &tmp25);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 133);
+    TNode<IntPtrT> tmp26 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp26);
+    TNode<IntPtrT> tmp27 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp27);
+    TNode<Smi>tmp28 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp22, tmp27});
+    TNode<IntPtrT> tmp29;
+    USE(tmp29);
+    tmp29 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp28});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 46);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp30;
+    USE(tmp30);
+    tmp30 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp23});
+    TNode<UintPtrT> tmp31;
+    USE(tmp31);
+    tmp31 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp29});
+    TNode<BoolT> tmp32;
+    USE(tmp32);
+    tmp32 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp30}, TNode<UintPtrT>{tmp31});
+    ca_.Branch(tmp32, &block13, &block14, tmp22, tmp23, tmp24, tmp25, tmp22, tmp26, tmp29, tmp23, tmp23, tmp22, tmp26, tmp29, tmp23, tmp23);
+  }
+
+  if (block13.is_used()) {
+    TNode<FixedArray> tmp33;
+    TNode<IntPtrT> tmp34;
+    TNode<String> tmp35;
+    TNode<IntPtrT> tmp36;
+    TNode<FixedArray> tmp37;
+    TNode<IntPtrT> tmp38;
+    TNode<IntPtrT> tmp39;
+    TNode<IntPtrT> tmp40;
+    TNode<IntPtrT> tmp41;
+    TNode<HeapObject> tmp42;
+    TNode<IntPtrT> tmp43;
+    TNode<IntPtrT> tmp44;
+    TNode<IntPtrT> tmp45;
+    TNode<IntPtrT> tmp46;
+    ca_.Bind(&block13, &tmp33, &tmp34, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44, &tmp45, &tmp46);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp47;
+    USE(tmp47);
+    tmp47 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp48;
+    USE(tmp48);
+    tmp48 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp46}, TNode<IntPtrT>{tmp47});
+    TNode<IntPtrT> tmp49;
+    USE(tmp49);
+    tmp49 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp43}, TNode<IntPtrT>{tmp48});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp50;
+    USE(tmp50);
+    TNode<IntPtrT> tmp51;
+    USE(tmp51);
+    std::tie(tmp50, tmp51) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp42}, TNode<IntPtrT>{tmp49}).Flatten();
+    ca_.Goto(&block12, tmp33, tmp34, tmp35, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42, tmp43, tmp44, tmp45, tmp46, tmp50, tmp51);
+  }
+
+  if (block14.is_used()) {
+    TNode<FixedArray> tmp52;
+    TNode<IntPtrT> tmp53;
+    TNode<String> tmp54;
+    TNode<IntPtrT> tmp55;
+    TNode<FixedArray> tmp56;
+    TNode<IntPtrT> tmp57;
+    TNode<IntPtrT> tmp58;
+    TNode<IntPtrT> tmp59;
+    TNode<IntPtrT> tmp60;
+    TNode<HeapObject> tmp61;
+    TNode<IntPtrT> tmp62;
+    TNode<IntPtrT> tmp63;
+    TNode<IntPtrT> tmp64;
+    TNode<IntPtrT> tmp65;
+    ca_.Bind(&block14, &tmp52, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block11, tmp52, tmp53, tmp54, tmp55, tmp56, tmp57, tmp58, tmp59, tmp60);
+  }
+
+  if (block12.is_used()) {
+    TNode<FixedArray> tmp66;
+    TNode<IntPtrT> tmp67;
+    TNode<String> tmp68;
+    TNode<IntPtrT> tmp69;
+    TNode<FixedArray> tmp70;
+    TNode<IntPtrT> tmp71;
+    TNode<IntPtrT> tmp72;
+    TNode<IntPtrT> tmp73;
+    TNode<IntPtrT> tmp74;
+    TNode<HeapObject> tmp75;
+    TNode<IntPtrT> tmp76;
+    TNode<IntPtrT> tmp77;
+    TNode<IntPtrT> tmp78;
+    TNode<IntPtrT> tmp79;
+    TNode<HeapObject> tmp80;
+    TNode<IntPtrT> tmp81;
+    ca_.Bind(&block12, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 46);
+    ca_.Goto(&block10, tmp66, tmp67, tmp68, tmp69, tmp70, tmp71, tmp72, tmp73, tmp74, tmp80, tmp81);
+  }
+
+  if (block11.is_used()) {
+    TNode<FixedArray> tmp82;
+    TNode<IntPtrT> tmp83;
+    TNode<String> tmp84;
+    TNode<IntPtrT> tmp85;
+    TNode<FixedArray> tmp86;
+    TNode<IntPtrT> tmp87;
+    TNode<IntPtrT> tmp88;
+    TNode<IntPtrT> tmp89;
+    TNode<IntPtrT> tmp90;
+    ca_.Bind(&block11, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block10.is_used()) {
+    TNode<FixedArray> tmp91;
+    TNode<IntPtrT> tmp92;
+    TNode<String> tmp93;
+    TNode<IntPtrT> tmp94;
+    TNode<FixedArray> tmp95;
+    TNode<IntPtrT> tmp96;
+    TNode<IntPtrT> tmp97;
+    TNode<IntPtrT> tmp98;
+    TNode<IntPtrT> tmp99;
+    TNode<HeapObject> tmp100;
+    TNode<IntPtrT> tmp101;
+    ca_.Bind(&block10, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101);
+    ca_.Goto(&block9, tmp91, tmp92, tmp93, tmp94, tmp95, tmp96, tmp97, tmp98, tmp99, tmp100, tmp101);
+  }
+
+  if (block9.is_used()) {
+    TNode<FixedArray> tmp102;
+    TNode<IntPtrT> tmp103;
+    TNode<String> tmp104;
+    TNode<IntPtrT> tmp105;
+    TNode<FixedArray> tmp106;
+    TNode<IntPtrT> tmp107;
+    TNode<IntPtrT> tmp108;
+    TNode<IntPtrT> tmp109;
+    TNode<IntPtrT> tmp110;
+    TNode<HeapObject> tmp111;
+    TNode<IntPtrT> tmp112;
+    ca_.Bind(&block9, &tmp102, &tmp103, &tmp104, &tmp105, &tmp106, &tmp107, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 133);
+    CodeStubAssembler(state_).StoreReference(CodeStubAssembler::Reference{tmp111, tmp112}, tmp104);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 134);
+    ca_.Goto(&block1, tmp102, tmp103, tmp104, tmp102);
+  }
+
+  if (block7.is_used()) {
+    TNode<FixedArray> tmp113;
+    TNode<IntPtrT> tmp114;
+    TNode<String> tmp115;
+    TNode<IntPtrT> tmp116;
+    ca_.Bind(&block7, &tmp113, &tmp114, &tmp115, &tmp116);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 137);
+    TNode<IntPtrT> tmp117;
+    USE(tmp117);
+    tmp117 = CodeStubAssembler(state_).CalculateNewElementsCapacity(TNode<IntPtrT>{tmp116});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 138);
+    ca_.Goto(&block17, tmp113, tmp114, tmp115, tmp116, tmp117);
+  }
+
+  if (block16.is_used()) {
+    TNode<FixedArray> tmp118;
+    TNode<IntPtrT> tmp119;
+    TNode<String> tmp120;
+    TNode<IntPtrT> tmp121;
+    TNode<IntPtrT> tmp122;
+    ca_.Bind(&block16, &tmp118, &tmp119, &tmp120, &tmp121, &tmp122);
+    TNode<BoolT> tmp123;
+    USE(tmp123);
+    tmp123 = CodeStubAssembler(state_).IntPtrLessThan(TNode<IntPtrT>{tmp119}, TNode<IntPtrT>{tmp122});
+    ca_.Branch(tmp123, &block18, &block19, tmp118, tmp119, tmp120, tmp121, tmp122);
+  }
+
+  if (block19.is_used()) {
+    TNode<FixedArray> tmp124;
+    TNode<IntPtrT> tmp125;
+    TNode<String> tmp126;
+    TNode<IntPtrT> tmp127;
+    TNode<IntPtrT> tmp128;
+    ca_.Bind(&block19, &tmp124, &tmp125, &tmp126, &tmp127, &tmp128);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'index < newLength' failed", "../../deps/v8/src/builtins/array-join.tq", 138);
+  }
+
+  if (block18.is_used()) {
+    TNode<FixedArray> tmp129;
+    TNode<IntPtrT> tmp130;
+    TNode<String> tmp131;
+    TNode<IntPtrT> tmp132;
+    TNode<IntPtrT> tmp133;
+    ca_.Bind(&block18, &tmp129, &tmp130, &tmp131, &tmp132, &tmp133);
+  }
+
+  if (block17.is_used()) {
+    TNode<FixedArray> tmp134;
+    TNode<IntPtrT> tmp135;
+    TNode<String> tmp136;
+    TNode<IntPtrT> tmp137;
+    TNode<IntPtrT> tmp138;
+    ca_.Bind(&block17, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 140);
+    TNode<IntPtrT> tmp139;
+    USE(tmp139);
+    tmp139 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<FixedArray> tmp140;
+    USE(tmp140);
+    tmp140 = CodeStubAssembler(state_).ExtractFixedArray(TNode<FixedArray>{tmp134}, TNode<IntPtrT>{tmp139}, TNode<IntPtrT>{tmp137}, TNode<IntPtrT>{tmp138}, CodeStubAssembler::ExtractFixedArrayFlag::kFixedArrays);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 139);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 141);
+    TNode<IntPtrT> tmp141 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp141);
+    TNode<IntPtrT> tmp142 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp142);
+    TNode<Smi>tmp143 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp140, tmp142});
+    TNode<IntPtrT> tmp144;
+    USE(tmp144);
+    tmp144 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp143});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 46);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp145;
+    USE(tmp145);
+    tmp145 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp135});
+    TNode<UintPtrT> tmp146;
+    USE(tmp146);
+    tmp146 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp144});
+    TNode<BoolT> tmp147;
+    USE(tmp147);
+    tmp147 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp145}, TNode<UintPtrT>{tmp146});
+    ca_.Branch(tmp147, &block24, &block25, tmp134, tmp135, tmp136, tmp137, tmp138, tmp140, tmp140, tmp141, tmp144, tmp135, tmp135, tmp140, tmp141, tmp144, tmp135, tmp135);
+  }
+
+  if (block24.is_used()) {
+    TNode<FixedArray> tmp148;
+    TNode<IntPtrT> tmp149;
+    TNode<String> tmp150;
+    TNode<IntPtrT> tmp151;
+    TNode<IntPtrT> tmp152;
+    TNode<FixedArray> tmp153;
+    TNode<FixedArray> tmp154;
+    TNode<IntPtrT> tmp155;
+    TNode<IntPtrT> tmp156;
+    TNode<IntPtrT> tmp157;
+    TNode<IntPtrT> tmp158;
+    TNode<HeapObject> tmp159;
+    TNode<IntPtrT> tmp160;
+    TNode<IntPtrT> tmp161;
+    TNode<IntPtrT> tmp162;
+    TNode<IntPtrT> tmp163;
+    ca_.Bind(&block24, &tmp148, &tmp149, &tmp150, &tmp151, &tmp152, &tmp153, &tmp154, &tmp155, &tmp156, &tmp157, &tmp158, &tmp159, &tmp160, &tmp161, &tmp162, &tmp163);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp164;
+    USE(tmp164);
+    tmp164 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp165;
+    USE(tmp165);
+    tmp165 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp163}, TNode<IntPtrT>{tmp164});
+    TNode<IntPtrT> tmp166;
+    USE(tmp166);
+    tmp166 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp160}, TNode<IntPtrT>{tmp165});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp167;
+    USE(tmp167);
+    TNode<IntPtrT> tmp168;
+    USE(tmp168);
+    std::tie(tmp167, tmp168) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp159}, TNode<IntPtrT>{tmp166}).Flatten();
+    ca_.Goto(&block23, tmp148, tmp149, tmp150, tmp151, tmp152, tmp153, tmp154, tmp155, tmp156, tmp157, tmp158, tmp159, tmp160, tmp161, tmp162, tmp163, tmp167, tmp168);
+  }
+
+  if (block25.is_used()) {
+    TNode<FixedArray> tmp169;
+    TNode<IntPtrT> tmp170;
+    TNode<String> tmp171;
+    TNode<IntPtrT> tmp172;
+    TNode<IntPtrT> tmp173;
+    TNode<FixedArray> tmp174;
+    TNode<FixedArray> tmp175;
+    TNode<IntPtrT> tmp176;
+    TNode<IntPtrT> tmp177;
+    TNode<IntPtrT> tmp178;
+    TNode<IntPtrT> tmp179;
+    TNode<HeapObject> tmp180;
+    TNode<IntPtrT> tmp181;
+    TNode<IntPtrT> tmp182;
+    TNode<IntPtrT> tmp183;
+    TNode<IntPtrT> tmp184;
+    ca_.Bind(&block25, &tmp169, &tmp170, &tmp171, &tmp172, &tmp173, &tmp174, &tmp175, &tmp176, &tmp177, &tmp178, &tmp179, &tmp180, &tmp181, &tmp182, &tmp183, &tmp184);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block22, tmp169, tmp170, tmp171, tmp172, tmp173, tmp174, tmp175, tmp176, tmp177, tmp178, tmp179);
+  }
+
+  if (block23.is_used()) {
+    TNode<FixedArray> tmp185;
+    TNode<IntPtrT> tmp186;
+    TNode<String> tmp187;
+    TNode<IntPtrT> tmp188;
+    TNode<IntPtrT> tmp189;
+    TNode<FixedArray> tmp190;
+    TNode<FixedArray> tmp191;
+    TNode<IntPtrT> tmp192;
+    TNode<IntPtrT> tmp193;
+    TNode<IntPtrT> tmp194;
+    TNode<IntPtrT> tmp195;
+    TNode<HeapObject> tmp196;
+    TNode<IntPtrT> tmp197;
+    TNode<IntPtrT> tmp198;
+    TNode<IntPtrT> tmp199;
+    TNode<IntPtrT> tmp200;
+    TNode<HeapObject> tmp201;
+    TNode<IntPtrT> tmp202;
+    ca_.Bind(&block23, &tmp185, &tmp186, &tmp187, &tmp188, &tmp189, &tmp190, &tmp191, &tmp192, &tmp193, &tmp194, &tmp195, &tmp196, &tmp197, &tmp198, &tmp199, &tmp200, &tmp201, &tmp202);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 46);
+    ca_.Goto(&block21, tmp185, tmp186, tmp187, tmp188, tmp189, tmp190, tmp191, tmp192, tmp193, tmp194, tmp195, tmp201, tmp202);
+  }
+
+  if (block22.is_used()) {
+    TNode<FixedArray> tmp203;
+    TNode<IntPtrT> tmp204;
+    TNode<String> tmp205;
+    TNode<IntPtrT> tmp206;
+    TNode<IntPtrT> tmp207;
+    TNode<FixedArray> tmp208;
+    TNode<FixedArray> tmp209;
+    TNode<IntPtrT> tmp210;
+    TNode<IntPtrT> tmp211;
+    TNode<IntPtrT> tmp212;
+    TNode<IntPtrT> tmp213;
+    ca_.Bind(&block22, &tmp203, &tmp204, &tmp205, &tmp206, &tmp207, &tmp208, &tmp209, &tmp210, &tmp211, &tmp212, &tmp213);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block21.is_used()) {
+    TNode<FixedArray> tmp214;
+    TNode<IntPtrT> tmp215;
+    TNode<String> tmp216;
+    TNode<IntPtrT> tmp217;
+    TNode<IntPtrT> tmp218;
+    TNode<FixedArray> tmp219;
+    TNode<FixedArray> tmp220;
+    TNode<IntPtrT> tmp221;
+    TNode<IntPtrT> tmp222;
+    TNode<IntPtrT> tmp223;
+    TNode<IntPtrT> tmp224;
+    TNode<HeapObject> tmp225;
+    TNode<IntPtrT> tmp226;
+    ca_.Bind(&block21, &tmp214, &tmp215, &tmp216, &tmp217, &tmp218, &tmp219, &tmp220, &tmp221, &tmp222, &tmp223, &tmp224, &tmp225, &tmp226);
+    ca_.Goto(&block20, tmp214, tmp215, tmp216, tmp217, tmp218, tmp219, tmp220, tmp221, tmp222, tmp223, tmp224, tmp225, tmp226);
+  }
+
+  if (block20.is_used()) {
+    TNode<FixedArray> tmp227;
+    TNode<IntPtrT> tmp228;
+    TNode<String> tmp229;
+    TNode<IntPtrT> tmp230;
+    TNode<IntPtrT> tmp231;
+    TNode<FixedArray> tmp232;
+    TNode<FixedArray> tmp233;
+    TNode<IntPtrT> tmp234;
+    TNode<IntPtrT> tmp235;
+    TNode<IntPtrT> tmp236;
+    TNode<IntPtrT> tmp237;
+    TNode<HeapObject> tmp238;
+    TNode<IntPtrT> tmp239;
+    ca_.Bind(&block20, &tmp227, &tmp228, &tmp229, &tmp230, &tmp231, &tmp232, &tmp233, &tmp234, &tmp235, &tmp236, &tmp237, &tmp238, &tmp239);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 141);
+    CodeStubAssembler(state_).StoreReference(CodeStubAssembler::Reference{tmp238, tmp239}, tmp229);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 142);
+    ca_.Goto(&block1, tmp227, tmp228, tmp229, tmp232);
+  }
+
+  if (block1.is_used()) {
+    TNode<FixedArray> tmp240;
+    TNode<IntPtrT> tmp241;
+    TNode<String> tmp242;
+    TNode<FixedArray> tmp243;
+    ca_.Bind(&block1, &tmp240, &tmp241, &tmp242, &tmp243);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-join.tq", 160);
+    ca_.Goto(&block27, tmp240, tmp241, tmp242, tmp243);
+  }
+
+    TNode<FixedArray> tmp244;
+    TNode<IntPtrT> tmp245;
+    TNode<String> tmp246;
+    TNode<FixedArray> tmp247;
+    ca_.Bind(&block27, &tmp244, &tmp245, &tmp246, &tmp247);
+  return TNode<FixedArray>{tmp247};
+}
+
+}  // namespace internal
+}  // namespace v8
+
@@ -0,0 +1,6520 @@
+#include "src/builtins/builtins-array-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-utils-gen.h"
+#include "src/builtins/builtins.h"
+#include "src/codegen/code-factory.h"
+#include "src/heap/factory-inl.h"
+#include "src/objects/arguments.h"
+#include "src/objects/bigint.h"
+#include "src/objects/elements-kind.h"
+#include "src/objects/free-space.h"
+#include "src/objects/js-generator.h"
+#include "src/objects/js-promise.h"
+#include "src/objects/js-regexp-string-iterator.h"
+#include "src/objects/js-weak-refs.h"
+#include "src/objects/objects.h"
+#include "src/objects/source-text-module.h"
+#include "src/objects/stack-frame-info.h"
+#include "src/objects/synthetic-module.h"
+#include "src/objects/template-objects.h"
+#include "src/builtins/builtins-bigint-gen.h"
+#include "src/builtins/builtins-collections-gen.h"
+#include "src/builtins/builtins-data-view-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-iterator-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-string-gen.h"
+#include "src/builtins/builtins-string-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-constructor-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "torque-generated/../../deps/v8/src/builtins/arguments-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-copywithin-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-join-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-lastindexof-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-map-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-right-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reverse-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-shift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-splice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-unshift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/base-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/bigint-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/boolean-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/collections-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/data-view-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/extras-utils-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/frames-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/growable-fixed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/internal-coverage-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/math-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-fromentries-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-constructor-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-delete-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-has-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-is-extensible-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-prevent-extensions-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revocable-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revoke-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/reflect-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-exec-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-all-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-replace-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-search-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-source-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-split-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-test-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-endswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-html-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-pad-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-repeat-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-startswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-substring-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/torque-internal-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-createtypedarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduceright-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-subarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/third_party/v8/builtins/array-sort-tq-csa.h"
+#include "torque-generated/../../deps/v8/test/torque/test-torque-tq-csa.h"
+
+namespace v8 {
+namespace internal {
+
+TF_BUILTIN(ArrayMapLoopEagerDeoptContinuation, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = UncheckedCast<Object>(Parameter(Descriptor::kReceiver));
+USE(parameter1);
+  TNode<Object> parameter2 = UncheckedCast<Object>(Parameter(Descriptor::kCallback));
+  USE(parameter2);
+  TNode<Object> parameter3 = UncheckedCast<Object>(Parameter(Descriptor::kThisArg));
+  USE(parameter3);
+  TNode<Object> parameter4 = UncheckedCast<Object>(Parameter(Descriptor::kArray));
+  USE(parameter4);
+  TNode<Object> parameter5 = UncheckedCast<Object>(Parameter(Descriptor::kInitialK));
+  USE(parameter5);
+  TNode<Object> parameter6 = UncheckedCast<Object>(Parameter(Descriptor::kLength));
+  USE(parameter6);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, Object> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, Object, JSReceiver> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Object> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Object, JSReceiver> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Object> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Object, Number> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number, Object> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number, Object, Number> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number, Number> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2, parameter3, parameter4, parameter5, parameter6);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    TNode<Object> tmp2;
+    TNode<Object> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    TNode<Object> tmp6;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4, &tmp5, &tmp6);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 18);
+    TNode<JSReceiver> tmp7;
+    USE(tmp7);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp7 = Cast10JSReceiver_1365(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1}, &label0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp1, tmp7);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block4, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp1);
+    }
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp8;
+    TNode<Object> tmp9;
+    TNode<Object> tmp10;
+    TNode<Object> tmp11;
+    TNode<Object> tmp12;
+    TNode<Object> tmp13;
+    TNode<Object> tmp14;
+    TNode<Object> tmp15;
+    ca_.Bind(&block4, &tmp8, &tmp9, &tmp10, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15);
+    ca_.Goto(&block2, tmp8, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp16;
+    TNode<Object> tmp17;
+    TNode<Object> tmp18;
+    TNode<Object> tmp19;
+    TNode<Object> tmp20;
+    TNode<Object> tmp21;
+    TNode<Object> tmp22;
+    TNode<Object> tmp23;
+    TNode<JSReceiver> tmp24;
+    ca_.Bind(&block3, &tmp16, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24);
+    ca_.Goto(&block1, tmp16, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22, tmp24);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp25;
+    TNode<Object> tmp26;
+    TNode<Object> tmp27;
+    TNode<Object> tmp28;
+    TNode<Object> tmp29;
+    TNode<Object> tmp30;
+    TNode<Object> tmp31;
+    ca_.Bind(&block2, &tmp25, &tmp26, &tmp27, &tmp28, &tmp29, &tmp30, &tmp31);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp32;
+    TNode<Object> tmp33;
+    TNode<Object> tmp34;
+    TNode<Object> tmp35;
+    TNode<Object> tmp36;
+    TNode<Object> tmp37;
+    TNode<Object> tmp38;
+    TNode<JSReceiver> tmp39;
+    ca_.Bind(&block1, &tmp32, &tmp33, &tmp34, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 19);
+    TNode<JSReceiver> tmp40;
+    USE(tmp40);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp40 = Cast71UT19ATCallableApiObject17ATCallableJSProxy15JSBoundFunction10JSFunction_1366(state_, TNode<Context>{tmp32}, TNode<Object>{tmp34}, &label0);
+    ca_.Goto(&block7, tmp32, tmp33, tmp34, tmp35, tmp36, tmp37, tmp38, tmp39, tmp34, tmp40);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block8, tmp32, tmp33, tmp34, tmp35, tmp36, tmp37, tmp38, tmp39, tmp34);
+    }
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp41;
+    TNode<Object> tmp42;
+    TNode<Object> tmp43;
+    TNode<Object> tmp44;
+    TNode<Object> tmp45;
+    TNode<Object> tmp46;
+    TNode<Object> tmp47;
+    TNode<JSReceiver> tmp48;
+    TNode<Object> tmp49;
+    ca_.Bind(&block8, &tmp41, &tmp42, &tmp43, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49);
+    ca_.Goto(&block6, tmp41, tmp42, tmp43, tmp44, tmp45, tmp46, tmp47, tmp48);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp50;
+    TNode<Object> tmp51;
+    TNode<Object> tmp52;
+    TNode<Object> tmp53;
+    TNode<Object> tmp54;
+    TNode<Object> tmp55;
+    TNode<Object> tmp56;
+    TNode<JSReceiver> tmp57;
+    TNode<Object> tmp58;
+    TNode<JSReceiver> tmp59;
+    ca_.Bind(&block7, &tmp50, &tmp51, &tmp52, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59);
+    ca_.Goto(&block5, tmp50, tmp51, tmp52, tmp53, tmp54, tmp55, tmp56, tmp57, tmp59);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp60;
+    TNode<Object> tmp61;
+    TNode<Object> tmp62;
+    TNode<Object> tmp63;
+    TNode<Object> tmp64;
+    TNode<Object> tmp65;
+    TNode<Object> tmp66;
+    TNode<JSReceiver> tmp67;
+    ca_.Bind(&block6, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66, &tmp67);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp68;
+    TNode<Object> tmp69;
+    TNode<Object> tmp70;
+    TNode<Object> tmp71;
+    TNode<Object> tmp72;
+    TNode<Object> tmp73;
+    TNode<Object> tmp74;
+    TNode<JSReceiver> tmp75;
+    TNode<JSReceiver> tmp76;
+    ca_.Bind(&block5, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 20);
+    TNode<JSReceiver> tmp77;
+    USE(tmp77);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp77 = Cast10JSReceiver_1365(state_, TNode<Context>{tmp68}, TNode<Object>{tmp72}, &label0);
+    ca_.Goto(&block11, tmp68, tmp69, tmp70, tmp71, tmp72, tmp73, tmp74, tmp75, tmp76, tmp72, tmp77);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block12, tmp68, tmp69, tmp70, tmp71, tmp72, tmp73, tmp74, tmp75, tmp76, tmp72);
+    }
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp78;
+    TNode<Object> tmp79;
+    TNode<Object> tmp80;
+    TNode<Object> tmp81;
+    TNode<Object> tmp82;
+    TNode<Object> tmp83;
+    TNode<Object> tmp84;
+    TNode<JSReceiver> tmp85;
+    TNode<JSReceiver> tmp86;
+    TNode<Object> tmp87;
+    ca_.Bind(&block12, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86, &tmp87);
+    ca_.Goto(&block10, tmp78, tmp79, tmp80, tmp81, tmp82, tmp83, tmp84, tmp85, tmp86);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp88;
+    TNode<Object> tmp89;
+    TNode<Object> tmp90;
+    TNode<Object> tmp91;
+    TNode<Object> tmp92;
+    TNode<Object> tmp93;
+    TNode<Object> tmp94;
+    TNode<JSReceiver> tmp95;
+    TNode<JSReceiver> tmp96;
+    TNode<Object> tmp97;
+    TNode<JSReceiver> tmp98;
+    ca_.Bind(&block11, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96, &tmp97, &tmp98);
+    ca_.Goto(&block9, tmp88, tmp89, tmp90, tmp91, tmp92, tmp93, tmp94, tmp95, tmp96, tmp98);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp99;
+    TNode<Object> tmp100;
+    TNode<Object> tmp101;
+    TNode<Object> tmp102;
+    TNode<Object> tmp103;
+    TNode<Object> tmp104;
+    TNode<Object> tmp105;
+    TNode<JSReceiver> tmp106;
+    TNode<JSReceiver> tmp107;
+    ca_.Bind(&block10, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104, &tmp105, &tmp106, &tmp107);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp108;
+    TNode<Object> tmp109;
+    TNode<Object> tmp110;
+    TNode<Object> tmp111;
+    TNode<Object> tmp112;
+    TNode<Object> tmp113;
+    TNode<Object> tmp114;
+    TNode<JSReceiver> tmp115;
+    TNode<JSReceiver> tmp116;
+    TNode<JSReceiver> tmp117;
+    ca_.Bind(&block9, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115, &tmp116, &tmp117);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 21);
+    TNode<Number> tmp118;
+    USE(tmp118);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp118 = Cast20UT5ATSmi10HeapNumber_85(state_, TNode<Object>{tmp113}, &label0);
+    ca_.Goto(&block15, tmp108, tmp109, tmp110, tmp111, tmp112, tmp113, tmp114, tmp115, tmp116, tmp117, tmp113, tmp118);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block16, tmp108, tmp109, tmp110, tmp111, tmp112, tmp113, tmp114, tmp115, tmp116, tmp117, tmp113);
+    }
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp119;
+    TNode<Object> tmp120;
+    TNode<Object> tmp121;
+    TNode<Object> tmp122;
+    TNode<Object> tmp123;
+    TNode<Object> tmp124;
+    TNode<Object> tmp125;
+    TNode<JSReceiver> tmp126;
+    TNode<JSReceiver> tmp127;
+    TNode<JSReceiver> tmp128;
+    TNode<Object> tmp129;
+    ca_.Bind(&block16, &tmp119, &tmp120, &tmp121, &tmp122, &tmp123, &tmp124, &tmp125, &tmp126, &tmp127, &tmp128, &tmp129);
+    ca_.Goto(&block14, tmp119, tmp120, tmp121, tmp122, tmp123, tmp124, tmp125, tmp126, tmp127, tmp128);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp130;
+    TNode<Object> tmp131;
+    TNode<Object> tmp132;
+    TNode<Object> tmp133;
+    TNode<Object> tmp134;
+    TNode<Object> tmp135;
+    TNode<Object> tmp136;
+    TNode<JSReceiver> tmp137;
+    TNode<JSReceiver> tmp138;
+    TNode<JSReceiver> tmp139;
+    TNode<Object> tmp140;
+    TNode<Number> tmp141;
+    ca_.Bind(&block15, &tmp130, &tmp131, &tmp132, &tmp133, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138, &tmp139, &tmp140, &tmp141);
+    ca_.Goto(&block13, tmp130, tmp131, tmp132, tmp133, tmp134, tmp135, tmp136, tmp137, tmp138, tmp139, tmp141);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp142;
+    TNode<Object> tmp143;
+    TNode<Object> tmp144;
+    TNode<Object> tmp145;
+    TNode<Object> tmp146;
+    TNode<Object> tmp147;
+    TNode<Object> tmp148;
+    TNode<JSReceiver> tmp149;
+    TNode<JSReceiver> tmp150;
+    TNode<JSReceiver> tmp151;
+    ca_.Bind(&block14, &tmp142, &tmp143, &tmp144, &tmp145, &tmp146, &tmp147, &tmp148, &tmp149, &tmp150, &tmp151);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp152;
+    TNode<Object> tmp153;
+    TNode<Object> tmp154;
+    TNode<Object> tmp155;
+    TNode<Object> tmp156;
+    TNode<Object> tmp157;
+    TNode<Object> tmp158;
+    TNode<JSReceiver> tmp159;
+    TNode<JSReceiver> tmp160;
+    TNode<JSReceiver> tmp161;
+    TNode<Number> tmp162;
+    ca_.Bind(&block13, &tmp152, &tmp153, &tmp154, &tmp155, &tmp156, &tmp157, &tmp158, &tmp159, &tmp160, &tmp161, &tmp162);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 22);
+    TNode<Number> tmp163;
+    USE(tmp163);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp163 = Cast20UT5ATSmi10HeapNumber_85(state_, TNode<Object>{tmp158}, &label0);
+    ca_.Goto(&block19, tmp152, tmp153, tmp154, tmp155, tmp156, tmp157, tmp158, tmp159, tmp160, tmp161, tmp162, tmp158, tmp163);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block20, tmp152, tmp153, tmp154, tmp155, tmp156, tmp157, tmp158, tmp159, tmp160, tmp161, tmp162, tmp158);
+    }
+  }
+
+  if (block20.is_used()) {
+    TNode<Context> tmp164;
+    TNode<Object> tmp165;
+    TNode<Object> tmp166;
+    TNode<Object> tmp167;
+    TNode<Object> tmp168;
+    TNode<Object> tmp169;
+    TNode<Object> tmp170;
+    TNode<JSReceiver> tmp171;
+    TNode<JSReceiver> tmp172;
+    TNode<JSReceiver> tmp173;
+    TNode<Number> tmp174;
+    TNode<Object> tmp175;
+    ca_.Bind(&block20, &tmp164, &tmp165, &tmp166, &tmp167, &tmp168, &tmp169, &tmp170, &tmp171, &tmp172, &tmp173, &tmp174, &tmp175);
+    ca_.Goto(&block18, tmp164, tmp165, tmp166, tmp167, tmp168, tmp169, tmp170, tmp171, tmp172, tmp173, tmp174);
+  }
+
+  if (block19.is_used()) {
+    TNode<Context> tmp176;
+    TNode<Object> tmp177;
+    TNode<Object> tmp178;
+    TNode<Object> tmp179;
+    TNode<Object> tmp180;
+    TNode<Object> tmp181;
+    TNode<Object> tmp182;
+    TNode<JSReceiver> tmp183;
+    TNode<JSReceiver> tmp184;
+    TNode<JSReceiver> tmp185;
+    TNode<Number> tmp186;
+    TNode<Object> tmp187;
+    TNode<Number> tmp188;
+    ca_.Bind(&block19, &tmp176, &tmp177, &tmp178, &tmp179, &tmp180, &tmp181, &tmp182, &tmp183, &tmp184, &tmp185, &tmp186, &tmp187, &tmp188);
+    ca_.Goto(&block17, tmp176, tmp177, tmp178, tmp179, tmp180, tmp181, tmp182, tmp183, tmp184, tmp185, tmp186, tmp188);
+  }
+
+  if (block18.is_used()) {
+    TNode<Context> tmp189;
+    TNode<Object> tmp190;
+    TNode<Object> tmp191;
+    TNode<Object> tmp192;
+    TNode<Object> tmp193;
+    TNode<Object> tmp194;
+    TNode<Object> tmp195;
+    TNode<JSReceiver> tmp196;
+    TNode<JSReceiver> tmp197;
+    TNode<JSReceiver> tmp198;
+    TNode<Number> tmp199;
+    ca_.Bind(&block18, &tmp189, &tmp190, &tmp191, &tmp192, &tmp193, &tmp194, &tmp195, &tmp196, &tmp197, &tmp198, &tmp199);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block17.is_used()) {
+    TNode<Context> tmp200;
+    TNode<Object> tmp201;
+    TNode<Object> tmp202;
+    TNode<Object> tmp203;
+    TNode<Object> tmp204;
+    TNode<Object> tmp205;
+    TNode<Object> tmp206;
+    TNode<JSReceiver> tmp207;
+    TNode<JSReceiver> tmp208;
+    TNode<JSReceiver> tmp209;
+    TNode<Number> tmp210;
+    TNode<Number> tmp211;
+    ca_.Bind(&block17, &tmp200, &tmp201, &tmp202, &tmp203, &tmp204, &tmp205, &tmp206, &tmp207, &tmp208, &tmp209, &tmp210, &tmp211);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 25);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 26);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 24);
+    TNode<Object> tmp212;
+    tmp212 = CodeStubAssembler(state_).CallBuiltin(Builtins::kArrayMapLoopContinuation, tmp200, tmp207, tmp208, tmp203, tmp209, tmp207, tmp210, tmp211);
+    USE(tmp212);
+    CodeStubAssembler(state_).Return(tmp212);
+  }
+}
+
+TF_BUILTIN(ArrayMapLoopLazyDeoptContinuation, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = UncheckedCast<Object>(Parameter(Descriptor::kReceiver));
+USE(parameter1);
+  TNode<Object> parameter2 = UncheckedCast<Object>(Parameter(Descriptor::kCallback));
+  USE(parameter2);
+  TNode<Object> parameter3 = UncheckedCast<Object>(Parameter(Descriptor::kThisArg));
+  USE(parameter3);
+  TNode<Object> parameter4 = UncheckedCast<Object>(Parameter(Descriptor::kArray));
+  USE(parameter4);
+  TNode<Object> parameter5 = UncheckedCast<Object>(Parameter(Descriptor::kInitialK));
+  USE(parameter5);
+  TNode<Object> parameter6 = UncheckedCast<Object>(Parameter(Descriptor::kLength));
+  USE(parameter6);
+  TNode<Object> parameter7 = UncheckedCast<Object>(Parameter(Descriptor::kResult));
+  USE(parameter7);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, Object, JSReceiver> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, Object> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, Object, JSReceiver> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Object> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Object, JSReceiver> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Object> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Object, Number> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number, Object> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number, Object, Number> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, JSReceiver, Number, Number> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2, parameter3, parameter4, parameter5, parameter6, parameter7);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    TNode<Object> tmp2;
+    TNode<Object> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    TNode<Object> tmp6;
+    TNode<Object> tmp7;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4, &tmp5, &tmp6, &tmp7);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 37);
+    TNode<JSReceiver> tmp8;
+    USE(tmp8);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp8 = Cast10JSReceiver_1365(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1}, &label0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp1, tmp8);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block4, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp1);
+    }
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp9;
+    TNode<Object> tmp10;
+    TNode<Object> tmp11;
+    TNode<Object> tmp12;
+    TNode<Object> tmp13;
+    TNode<Object> tmp14;
+    TNode<Object> tmp15;
+    TNode<Object> tmp16;
+    TNode<Object> tmp17;
+    ca_.Bind(&block4, &tmp9, &tmp10, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16, &tmp17);
+    ca_.Goto(&block2, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15, tmp16);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp18;
+    TNode<Object> tmp19;
+    TNode<Object> tmp20;
+    TNode<Object> tmp21;
+    TNode<Object> tmp22;
+    TNode<Object> tmp23;
+    TNode<Object> tmp24;
+    TNode<Object> tmp25;
+    TNode<Object> tmp26;
+    TNode<JSReceiver> tmp27;
+    ca_.Bind(&block3, &tmp18, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27);
+    ca_.Goto(&block1, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp24, tmp25, tmp27);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp28;
+    TNode<Object> tmp29;
+    TNode<Object> tmp30;
+    TNode<Object> tmp31;
+    TNode<Object> tmp32;
+    TNode<Object> tmp33;
+    TNode<Object> tmp34;
+    TNode<Object> tmp35;
+    ca_.Bind(&block2, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34, &tmp35);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp36;
+    TNode<Object> tmp37;
+    TNode<Object> tmp38;
+    TNode<Object> tmp39;
+    TNode<Object> tmp40;
+    TNode<Object> tmp41;
+    TNode<Object> tmp42;
+    TNode<Object> tmp43;
+    TNode<JSReceiver> tmp44;
+    ca_.Bind(&block1, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 38);
+    TNode<JSReceiver> tmp45;
+    USE(tmp45);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp45 = Cast71UT19ATCallableApiObject17ATCallableJSProxy15JSBoundFunction10JSFunction_1366(state_, TNode<Context>{tmp36}, TNode<Object>{tmp38}, &label0);
+    ca_.Goto(&block7, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42, tmp43, tmp44, tmp38, tmp45);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block8, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42, tmp43, tmp44, tmp38);
+    }
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp46;
+    TNode<Object> tmp47;
+    TNode<Object> tmp48;
+    TNode<Object> tmp49;
+    TNode<Object> tmp50;
+    TNode<Object> tmp51;
+    TNode<Object> tmp52;
+    TNode<Object> tmp53;
+    TNode<JSReceiver> tmp54;
+    TNode<Object> tmp55;
+    ca_.Bind(&block8, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53, &tmp54, &tmp55);
+    ca_.Goto(&block6, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51, tmp52, tmp53, tmp54);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp56;
+    TNode<Object> tmp57;
+    TNode<Object> tmp58;
+    TNode<Object> tmp59;
+    TNode<Object> tmp60;
+    TNode<Object> tmp61;
+    TNode<Object> tmp62;
+    TNode<Object> tmp63;
+    TNode<JSReceiver> tmp64;
+    TNode<Object> tmp65;
+    TNode<JSReceiver> tmp66;
+    ca_.Bind(&block7, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66);
+    ca_.Goto(&block5, tmp56, tmp57, tmp58, tmp59, tmp60, tmp61, tmp62, tmp63, tmp64, tmp66);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp67;
+    TNode<Object> tmp68;
+    TNode<Object> tmp69;
+    TNode<Object> tmp70;
+    TNode<Object> tmp71;
+    TNode<Object> tmp72;
+    TNode<Object> tmp73;
+    TNode<Object> tmp74;
+    TNode<JSReceiver> tmp75;
+    ca_.Bind(&block6, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp76;
+    TNode<Object> tmp77;
+    TNode<Object> tmp78;
+    TNode<Object> tmp79;
+    TNode<Object> tmp80;
+    TNode<Object> tmp81;
+    TNode<Object> tmp82;
+    TNode<Object> tmp83;
+    TNode<JSReceiver> tmp84;
+    TNode<JSReceiver> tmp85;
+    ca_.Bind(&block5, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 39);
+    TNode<JSReceiver> tmp86;
+    USE(tmp86);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp86 = Cast10JSReceiver_1365(state_, TNode<Context>{tmp76}, TNode<Object>{tmp80}, &label0);
+    ca_.Goto(&block11, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, tmp83, tmp84, tmp85, tmp80, tmp86);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block12, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, tmp83, tmp84, tmp85, tmp80);
+    }
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp87;
+    TNode<Object> tmp88;
+    TNode<Object> tmp89;
+    TNode<Object> tmp90;
+    TNode<Object> tmp91;
+    TNode<Object> tmp92;
+    TNode<Object> tmp93;
+    TNode<Object> tmp94;
+    TNode<JSReceiver> tmp95;
+    TNode<JSReceiver> tmp96;
+    TNode<Object> tmp97;
+    ca_.Bind(&block12, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96, &tmp97);
+    ca_.Goto(&block10, tmp87, tmp88, tmp89, tmp90, tmp91, tmp92, tmp93, tmp94, tmp95, tmp96);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp98;
+    TNode<Object> tmp99;
+    TNode<Object> tmp100;
+    TNode<Object> tmp101;
+    TNode<Object> tmp102;
+    TNode<Object> tmp103;
+    TNode<Object> tmp104;
+    TNode<Object> tmp105;
+    TNode<JSReceiver> tmp106;
+    TNode<JSReceiver> tmp107;
+    TNode<Object> tmp108;
+    TNode<JSReceiver> tmp109;
+    ca_.Bind(&block11, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104, &tmp105, &tmp106, &tmp107, &tmp108, &tmp109);
+    ca_.Goto(&block9, tmp98, tmp99, tmp100, tmp101, tmp102, tmp103, tmp104, tmp105, tmp106, tmp107, tmp109);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp110;
+    TNode<Object> tmp111;
+    TNode<Object> tmp112;
+    TNode<Object> tmp113;
+    TNode<Object> tmp114;
+    TNode<Object> tmp115;
+    TNode<Object> tmp116;
+    TNode<Object> tmp117;
+    TNode<JSReceiver> tmp118;
+    TNode<JSReceiver> tmp119;
+    ca_.Bind(&block10, &tmp110, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115, &tmp116, &tmp117, &tmp118, &tmp119);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp120;
+    TNode<Object> tmp121;
+    TNode<Object> tmp122;
+    TNode<Object> tmp123;
+    TNode<Object> tmp124;
+    TNode<Object> tmp125;
+    TNode<Object> tmp126;
+    TNode<Object> tmp127;
+    TNode<JSReceiver> tmp128;
+    TNode<JSReceiver> tmp129;
+    TNode<JSReceiver> tmp130;
+    ca_.Bind(&block9, &tmp120, &tmp121, &tmp122, &tmp123, &tmp124, &tmp125, &tmp126, &tmp127, &tmp128, &tmp129, &tmp130);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 40);
+    TNode<Number> tmp131;
+    USE(tmp131);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp131 = Cast20UT5ATSmi10HeapNumber_85(state_, TNode<Object>{tmp125}, &label0);
+    ca_.Goto(&block15, tmp120, tmp121, tmp122, tmp123, tmp124, tmp125, tmp126, tmp127, tmp128, tmp129, tmp130, tmp125, tmp131);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block16, tmp120, tmp121, tmp122, tmp123, tmp124, tmp125, tmp126, tmp127, tmp128, tmp129, tmp130, tmp125);
+    }
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp132;
+    TNode<Object> tmp133;
+    TNode<Object> tmp134;
+    TNode<Object> tmp135;
+    TNode<Object> tmp136;
+    TNode<Object> tmp137;
+    TNode<Object> tmp138;
+    TNode<Object> tmp139;
+    TNode<JSReceiver> tmp140;
+    TNode<JSReceiver> tmp141;
+    TNode<JSReceiver> tmp142;
+    TNode<Object> tmp143;
+    ca_.Bind(&block16, &tmp132, &tmp133, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138, &tmp139, &tmp140, &tmp141, &tmp142, &tmp143);
+    ca_.Goto(&block14, tmp132, tmp133, tmp134, tmp135, tmp136, tmp137, tmp138, tmp139, tmp140, tmp141, tmp142);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp144;
+    TNode<Object> tmp145;
+    TNode<Object> tmp146;
+    TNode<Object> tmp147;
+    TNode<Object> tmp148;
+    TNode<Object> tmp149;
+    TNode<Object> tmp150;
+    TNode<Object> tmp151;
+    TNode<JSReceiver> tmp152;
+    TNode<JSReceiver> tmp153;
+    TNode<JSReceiver> tmp154;
+    TNode<Object> tmp155;
+    TNode<Number> tmp156;
+    ca_.Bind(&block15, &tmp144, &tmp145, &tmp146, &tmp147, &tmp148, &tmp149, &tmp150, &tmp151, &tmp152, &tmp153, &tmp154, &tmp155, &tmp156);
+    ca_.Goto(&block13, tmp144, tmp145, tmp146, tmp147, tmp148, tmp149, tmp150, tmp151, tmp152, tmp153, tmp154, tmp156);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp157;
+    TNode<Object> tmp158;
+    TNode<Object> tmp159;
+    TNode<Object> tmp160;
+    TNode<Object> tmp161;
+    TNode<Object> tmp162;
+    TNode<Object> tmp163;
+    TNode<Object> tmp164;
+    TNode<JSReceiver> tmp165;
+    TNode<JSReceiver> tmp166;
+    TNode<JSReceiver> tmp167;
+    ca_.Bind(&block14, &tmp157, &tmp158, &tmp159, &tmp160, &tmp161, &tmp162, &tmp163, &tmp164, &tmp165, &tmp166, &tmp167);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp168;
+    TNode<Object> tmp169;
+    TNode<Object> tmp170;
+    TNode<Object> tmp171;
+    TNode<Object> tmp172;
+    TNode<Object> tmp173;
+    TNode<Object> tmp174;
+    TNode<Object> tmp175;
+    TNode<JSReceiver> tmp176;
+    TNode<JSReceiver> tmp177;
+    TNode<JSReceiver> tmp178;
+    TNode<Number> tmp179;
+    ca_.Bind(&block13, &tmp168, &tmp169, &tmp170, &tmp171, &tmp172, &tmp173, &tmp174, &tmp175, &tmp176, &tmp177, &tmp178, &tmp179);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 41);
+    TNode<Number> tmp180;
+    USE(tmp180);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp180 = Cast20UT5ATSmi10HeapNumber_85(state_, TNode<Object>{tmp174}, &label0);
+    ca_.Goto(&block19, tmp168, tmp169, tmp170, tmp171, tmp172, tmp173, tmp174, tmp175, tmp176, tmp177, tmp178, tmp179, tmp174, tmp180);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block20, tmp168, tmp169, tmp170, tmp171, tmp172, tmp173, tmp174, tmp175, tmp176, tmp177, tmp178, tmp179, tmp174);
+    }
+  }
+
+  if (block20.is_used()) {
+    TNode<Context> tmp181;
+    TNode<Object> tmp182;
+    TNode<Object> tmp183;
+    TNode<Object> tmp184;
+    TNode<Object> tmp185;
+    TNode<Object> tmp186;
+    TNode<Object> tmp187;
+    TNode<Object> tmp188;
+    TNode<JSReceiver> tmp189;
+    TNode<JSReceiver> tmp190;
+    TNode<JSReceiver> tmp191;
+    TNode<Number> tmp192;
+    TNode<Object> tmp193;
+    ca_.Bind(&block20, &tmp181, &tmp182, &tmp183, &tmp184, &tmp185, &tmp186, &tmp187, &tmp188, &tmp189, &tmp190, &tmp191, &tmp192, &tmp193);
+    ca_.Goto(&block18, tmp181, tmp182, tmp183, tmp184, tmp185, tmp186, tmp187, tmp188, tmp189, tmp190, tmp191, tmp192);
+  }
+
+  if (block19.is_used()) {
+    TNode<Context> tmp194;
+    TNode<Object> tmp195;
+    TNode<Object> tmp196;
+    TNode<Object> tmp197;
+    TNode<Object> tmp198;
+    TNode<Object> tmp199;
+    TNode<Object> tmp200;
+    TNode<Object> tmp201;
+    TNode<JSReceiver> tmp202;
+    TNode<JSReceiver> tmp203;
+    TNode<JSReceiver> tmp204;
+    TNode<Number> tmp205;
+    TNode<Object> tmp206;
+    TNode<Number> tmp207;
+    ca_.Bind(&block19, &tmp194, &tmp195, &tmp196, &tmp197, &tmp198, &tmp199, &tmp200, &tmp201, &tmp202, &tmp203, &tmp204, &tmp205, &tmp206, &tmp207);
+    ca_.Goto(&block17, tmp194, tmp195, tmp196, tmp197, tmp198, tmp199, tmp200, tmp201, tmp202, tmp203, tmp204, tmp205, tmp207);
+  }
+
+  if (block18.is_used()) {
+    TNode<Context> tmp208;
+    TNode<Object> tmp209;
+    TNode<Object> tmp210;
+    TNode<Object> tmp211;
+    TNode<Object> tmp212;
+    TNode<Object> tmp213;
+    TNode<Object> tmp214;
+    TNode<Object> tmp215;
+    TNode<JSReceiver> tmp216;
+    TNode<JSReceiver> tmp217;
+    TNode<JSReceiver> tmp218;
+    TNode<Number> tmp219;
+    ca_.Bind(&block18, &tmp208, &tmp209, &tmp210, &tmp211, &tmp212, &tmp213, &tmp214, &tmp215, &tmp216, &tmp217, &tmp218, &tmp219);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block17.is_used()) {
+    TNode<Context> tmp220;
+    TNode<Object> tmp221;
+    TNode<Object> tmp222;
+    TNode<Object> tmp223;
+    TNode<Object> tmp224;
+    TNode<Object> tmp225;
+    TNode<Object> tmp226;
+    TNode<Object> tmp227;
+    TNode<JSReceiver> tmp228;
+    TNode<JSReceiver> tmp229;
+    TNode<JSReceiver> tmp230;
+    TNode<Number> tmp231;
+    TNode<Number> tmp232;
+    ca_.Bind(&block17, &tmp220, &tmp221, &tmp222, &tmp223, &tmp224, &tmp225, &tmp226, &tmp227, &tmp228, &tmp229, &tmp230, &tmp231, &tmp232);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 49);
+    TNode<Object> tmp233;
+    tmp233 = CodeStubAssembler(state_).CallBuiltin(Builtins::kFastCreateDataProperty, tmp220, tmp230, tmp231, tmp227);
+    USE(tmp233);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 52);
+    TNode<Number> tmp234;
+    USE(tmp234);
+    tmp234 = FromConstexpr20UT5ATSmi10HeapNumber17ATconstexpr_int31_161(state_, 1);
+    TNode<Number> tmp235;
+    USE(tmp235);
+    tmp235 = CodeStubAssembler(state_).NumberAdd(TNode<Number>{tmp231}, TNode<Number>{tmp234});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 55);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 56);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 54);
+    TNode<Object> tmp236;
+    tmp236 = CodeStubAssembler(state_).CallBuiltin(Builtins::kArrayMapLoopContinuation, tmp220, tmp228, tmp229, tmp223, tmp230, tmp228, tmp235, tmp232);
+    USE(tmp236);
+    CodeStubAssembler(state_).Return(tmp236);
+  }
+}
+
+TF_BUILTIN(ArrayMapLoopContinuation, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<JSReceiver> parameter1 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<0>()));
+  USE(parameter1);
+  TNode<JSReceiver> parameter2 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<1>()));
+  USE(parameter2);
+  TNode<Object> parameter3 = UncheckedCast<Object>(Parameter(Descriptor::ParameterIndex<2>()));
+  USE(parameter3);
+  TNode<JSReceiver> parameter4 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<3>()));
+  USE(parameter4);
+  TNode<JSReceiver> parameter5 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<4>()));
+  USE(parameter5);
+  TNode<Number> parameter6 = UncheckedCast<Number>(Parameter(Descriptor::ParameterIndex<5>()));
+  USE(parameter6);
+  TNode<Number> parameter7 = UncheckedCast<Number>(Parameter(Descriptor::ParameterIndex<6>()));
+  USE(parameter7);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, JSReceiver, Number, Number> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, JSReceiver, Number, Number, Number> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, JSReceiver, Number, Number, Number> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, JSReceiver, Number, Number, Number, Oddball> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, JSReceiver, Number, Number, Number, Oddball> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, JSReceiver, Number, Number, Number> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, JSReceiver, Number, Number, Number> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2, parameter3, parameter4, parameter5, parameter6, parameter7);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<JSReceiver> tmp2;
+    TNode<Object> tmp3;
+    TNode<JSReceiver> tmp4;
+    TNode<JSReceiver> tmp5;
+    TNode<Number> tmp6;
+    TNode<Number> tmp7;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4, &tmp5, &tmp6, &tmp7);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 65);
+    ca_.Goto(&block3, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp6);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp8;
+    TNode<JSReceiver> tmp9;
+    TNode<JSReceiver> tmp10;
+    TNode<Object> tmp11;
+    TNode<JSReceiver> tmp12;
+    TNode<JSReceiver> tmp13;
+    TNode<Number> tmp14;
+    TNode<Number> tmp15;
+    TNode<Number> tmp16;
+    ca_.Bind(&block3, &tmp8, &tmp9, &tmp10, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16);
+    TNode<BoolT> tmp17;
+    USE(tmp17);
+    tmp17 = NumberIsLessThan_75(state_, TNode<Number>{tmp16}, TNode<Number>{tmp15});
+    ca_.Branch(tmp17, &block1, &block2, tmp8, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15, tmp16);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp18;
+    TNode<JSReceiver> tmp19;
+    TNode<JSReceiver> tmp20;
+    TNode<Object> tmp21;
+    TNode<JSReceiver> tmp22;
+    TNode<JSReceiver> tmp23;
+    TNode<Number> tmp24;
+    TNode<Number> tmp25;
+    TNode<Number> tmp26;
+    ca_.Bind(&block1, &tmp18, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 71);
+    TNode<Oddball> tmp27;
+    USE(tmp27);
+    tmp27 = CodeStubAssembler(state_).HasProperty_Inline(TNode<Context>{tmp18}, TNode<JSReceiver>{tmp23}, TNode<Object>{tmp26});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 74);
+    TNode<Oddball> tmp28;
+    USE(tmp28);
+    tmp28 = True_65(state_);
+    TNode<BoolT> tmp29;
+    USE(tmp29);
+    tmp29 = CodeStubAssembler(state_).TaggedEqual(TNode<HeapObject>{tmp27}, TNode<HeapObject>{tmp28});
+    ca_.Branch(tmp29, &block5, &block6, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp30;
+    TNode<JSReceiver> tmp31;
+    TNode<JSReceiver> tmp32;
+    TNode<Object> tmp33;
+    TNode<JSReceiver> tmp34;
+    TNode<JSReceiver> tmp35;
+    TNode<Number> tmp36;
+    TNode<Number> tmp37;
+    TNode<Number> tmp38;
+    TNode<Oddball> tmp39;
+    ca_.Bind(&block5, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 76);
+    TNode<Object> tmp40;
+    USE(tmp40);
+    tmp40 = CodeStubAssembler(state_).GetProperty(TNode<Context>{tmp30}, TNode<Object>{tmp35}, TNode<Object>{tmp38});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 80);
+    TNode<Object> tmp41;
+    USE(tmp41);
+    tmp41 = CodeStubAssembler(state_).Call(TNode<Context>{tmp30}, TNode<JSReceiver>{tmp32}, TNode<Object>{tmp33}, TNode<Object>{tmp40}, TNode<Object>{tmp38}, TNode<Object>{tmp35});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 79);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 83);
+    TNode<Object> tmp42;
+    tmp42 = CodeStubAssembler(state_).CallBuiltin(Builtins::kFastCreateDataProperty, tmp30, tmp34, tmp38, tmp41);
+    USE(tmp42);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 74);
+    ca_.Goto(&block6, tmp30, tmp31, tmp32, tmp33, tmp34, tmp35, tmp36, tmp37, tmp38, tmp39);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp43;
+    TNode<JSReceiver> tmp44;
+    TNode<JSReceiver> tmp45;
+    TNode<Object> tmp46;
+    TNode<JSReceiver> tmp47;
+    TNode<JSReceiver> tmp48;
+    TNode<Number> tmp49;
+    TNode<Number> tmp50;
+    TNode<Number> tmp51;
+    TNode<Oddball> tmp52;
+    ca_.Bind(&block6, &tmp43, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 65);
+    ca_.Goto(&block4, tmp43, tmp44, tmp45, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp53;
+    TNode<JSReceiver> tmp54;
+    TNode<JSReceiver> tmp55;
+    TNode<Object> tmp56;
+    TNode<JSReceiver> tmp57;
+    TNode<JSReceiver> tmp58;
+    TNode<Number> tmp59;
+    TNode<Number> tmp60;
+    TNode<Number> tmp61;
+    ca_.Bind(&block4, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61);
+    TNode<Number> tmp62;
+    USE(tmp62);
+    tmp62 = FromConstexpr20UT5ATSmi10HeapNumber17ATconstexpr_int31_161(state_, 1);
+    TNode<Number> tmp63;
+    USE(tmp63);
+    tmp63 = CodeStubAssembler(state_).NumberAdd(TNode<Number>{tmp61}, TNode<Number>{tmp62});
+    ca_.Goto(&block3, tmp53, tmp54, tmp55, tmp56, tmp57, tmp58, tmp59, tmp60, tmp63);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp64;
+    TNode<JSReceiver> tmp65;
+    TNode<JSReceiver> tmp66;
+    TNode<Object> tmp67;
+    TNode<JSReceiver> tmp68;
+    TNode<JSReceiver> tmp69;
+    TNode<Number> tmp70;
+    TNode<Number> tmp71;
+    TNode<Number> tmp72;
+    ca_.Bind(&block2, &tmp64, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 90);
+    CodeStubAssembler(state_).Return(tmp68);
+  }
+}
+
+TorqueStructVector NewVector_24(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Smi> p_length) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Smi> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Smi> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Smi> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Smi, FixedArray> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Smi, FixedArray> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Smi, FixedArray, BoolT, BoolT, BoolT> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Smi, FixedArray, BoolT, BoolT, BoolT> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_length);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Smi> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 174);
+    TNode<Smi> tmp2;
+    USE(tmp2);
+    tmp2 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 0);
+    TNode<BoolT> tmp3;
+    USE(tmp3);
+    tmp3 = CodeStubAssembler(state_).SmiGreaterThan(TNode<Smi>{tmp1}, TNode<Smi>{tmp2});
+    ca_.Branch(tmp3, &block2, &block3, tmp0, tmp1);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp4;
+    TNode<Smi> tmp5;
+    ca_.Bind(&block2, &tmp4, &tmp5);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 176);
+    TNode<IntPtrT> tmp6;
+    USE(tmp6);
+    tmp6 = CodeStubAssembler(state_).SmiUntag(TNode<Smi>{tmp5});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 175);
+    TNode<FixedArray> tmp7;
+    USE(tmp7);
+    tmp7 = CodeStubAssembler(state_).AllocateFixedArrayWithHoles(TNode<IntPtrT>{tmp6}, CodeStubAssembler::kAllowLargeObjectAllocation);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 174);
+    ca_.Goto(&block5, tmp4, tmp5, tmp7);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp8;
+    TNode<Smi> tmp9;
+    ca_.Bind(&block3, &tmp8, &tmp9);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 177);
+    TNode<FixedArray> tmp10;
+    USE(tmp10);
+    tmp10 = kEmptyFixedArray_215(state_);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 174);
+    ca_.Goto(&block4, tmp8, tmp9, tmp10);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp11;
+    TNode<Smi> tmp12;
+    TNode<FixedArray> tmp13;
+    ca_.Bind(&block5, &tmp11, &tmp12, &tmp13);
+    ca_.Goto(&block4, tmp11, tmp12, tmp13);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp14;
+    TNode<Smi> tmp15;
+    TNode<FixedArray> tmp16;
+    ca_.Bind(&block4, &tmp14, &tmp15, &tmp16);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 179);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 178);
+    TNode<BoolT> tmp17;
+    USE(tmp17);
+    tmp17 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, true);
+    TNode<BoolT> tmp18;
+    USE(tmp18);
+    tmp18 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, true);
+    TNode<BoolT> tmp19;
+    USE(tmp19);
+    tmp19 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, false);
+    ca_.Goto(&block1, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp20;
+    TNode<Smi> tmp21;
+    TNode<FixedArray> tmp22;
+    TNode<BoolT> tmp23;
+    TNode<BoolT> tmp24;
+    TNode<BoolT> tmp25;
+    ca_.Bind(&block1, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 173);
+    ca_.Goto(&block6, tmp20, tmp21, tmp22, tmp23, tmp24, tmp25);
+  }
+
+    TNode<Context> tmp26;
+    TNode<Smi> tmp27;
+    TNode<FixedArray> tmp28;
+    TNode<BoolT> tmp29;
+    TNode<BoolT> tmp30;
+    TNode<BoolT> tmp31;
+    ca_.Bind(&block6, &tmp26, &tmp27, &tmp28, &tmp29, &tmp30, &tmp31);
+  return TorqueStructVector{TNode<FixedArray>{tmp28}, TNode<BoolT>{tmp29}, TNode<BoolT>{tmp30}, TNode<BoolT>{tmp31}};
+}
+
+TNode<JSArray> FastArrayMap_25(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<JSArray> p_fastO, TNode<Smi> p_len, TNode<JSReceiver> p_callbackfn, TNode<Object> p_thisArg, compiler::CodeAssemblerLabel* label_Bailout, compiler::TypedCodeAssemblerVariable<JSArray>* label_Bailout_parameter_0, compiler::TypedCodeAssemblerVariable<Smi>* label_Bailout_parameter_1) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, JSArray> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi> block22(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, JSArray, Smi> block26(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, JSArray, Smi, Object> block25(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi> block23(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, JSArray, Smi> block28(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, JSArray, Smi, Object> block27(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Object> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Context, JSReceiver, Object, Object, Smi, JSArray> block29(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object, Object> block34(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object, Object, Smi> block33(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object, Smi, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block39(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object, Smi, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block40(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object, Smi, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block38(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object, Smi, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT> block37(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object, Smi, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT> block36(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object, Smi, FixedArray, IntPtrT, IntPtrT, Smi, Smi, HeapObject, IntPtrT> block35(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object> block32(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object, HeapObject> block45(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object, HeapObject, HeapNumber> block44(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object, HeapNumber, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block50(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object, HeapNumber, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block51(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object, HeapNumber, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block49(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object, HeapNumber, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT> block48(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object, HeapNumber, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT> block47(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object, HeapNumber, FixedArray, IntPtrT, IntPtrT, Smi, Smi, HeapObject, IntPtrT> block46(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object> block43(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object, HeapObject, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block57(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object, HeapObject, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block58(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object, HeapObject, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block56(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object, HeapObject, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT> block55(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object, HeapObject, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT> block54(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object, HeapObject, FixedArray, IntPtrT, IntPtrT, Smi, Smi, HeapObject, IntPtrT> block53(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object> block42(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object, Object> block31(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Object, Object, Smi, Object, Context, Smi, Object> block30(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT> block60(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi> block4(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi> block62(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi> block65(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi> block64(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi> block63(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T> block66(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T> block68(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T> block69(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T> block70(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T> block67(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, BoolT> block73(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, BoolT> block74(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, BoolT, BoolT> block75(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T> block71(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T> block72(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, Map, JSArray> block76(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi> block81(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi> block79(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block87(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block88(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block86(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT> block85(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT> block84(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, FixedArray, IntPtrT, IntPtrT, Smi, Smi, HeapObject, IntPtrT> block83(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, Object, Object> block93(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, Object, Object, Number> block92(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, Object, Number, FixedDoubleArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block98(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, Object, Number, FixedDoubleArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block99(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, Object, Number, FixedDoubleArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block97(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, Object, Number, FixedDoubleArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT> block96(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, Object, Number, FixedDoubleArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT> block95(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, Object, Number, FixedDoubleArray, IntPtrT, IntPtrT, Smi, Smi, HeapObject, IntPtrT> block94(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, Object> block91(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, Object> block90(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi> block82(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi> block80(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, Map, JSArray> block77(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, Smi, Int32T, Map, JSArray> block78(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Smi, Context, Smi, JSArray> block61(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi> block102(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi> block105(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi> block104(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi> block103(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T> block106(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T> block108(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T> block109(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T> block110(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T> block107(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, BoolT> block113(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, BoolT> block114(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, BoolT, BoolT> block115(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T> block111(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T> block112(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, Map, JSArray> block116(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi> block121(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi> block119(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block127(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block128(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block126(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT> block125(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT> block124(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, FixedArray, IntPtrT, IntPtrT, Smi, Smi, HeapObject, IntPtrT> block123(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, Object, Object> block133(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, Object, Object, Number> block132(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, Object, Number, FixedDoubleArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block138(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, Object, Number, FixedDoubleArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block139(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, Object, Number, FixedDoubleArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block137(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, Object, Number, FixedDoubleArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT> block136(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, Object, Number, FixedDoubleArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT> block135(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, Object, Number, FixedDoubleArray, IntPtrT, IntPtrT, Smi, Smi, HeapObject, IntPtrT> block134(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, Object> block131(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi, Object> block130(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi> block122(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, Map, JSArray, FixedDoubleArray, Smi> block120(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, Map, JSArray> block117(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, Smi, Int32T, Map, JSArray> block118(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, Smi, JSArray, JSArray, Map, BoolT, FixedArray, BoolT, BoolT, BoolT, Smi, Context, Smi, JSArray> block101(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSArray, Smi> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSArray, Smi, JSReceiver, Object, JSArray> block141(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_fastO, p_len, p_callbackfn, p_thisArg);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSArray> tmp1;
+    TNode<Smi> tmp2;
+    TNode<JSReceiver> tmp3;
+    TNode<Object> tmp4;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 190);
+    TNode<Smi> tmp5;
+    USE(tmp5);
+    tmp5 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 191);
+    TNode<JSArray> tmp6;
+    USE(tmp6);
+    TNode<JSArray> tmp7;
+    USE(tmp7);
+    TNode<Map> tmp8;
+    USE(tmp8);
+    TNode<BoolT> tmp9;
+    USE(tmp9);
+    std::tie(tmp6, tmp7, tmp8, tmp9) = NewFastJSArrayForReadWitness_240(state_, TNode<JSArray>{tmp1}).Flatten();
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 192);
+    TNode<FixedArray> tmp10;
+    USE(tmp10);
+    TNode<BoolT> tmp11;
+    USE(tmp11);
+    TNode<BoolT> tmp12;
+    USE(tmp12);
+    TNode<BoolT> tmp13;
+    USE(tmp13);
+    std::tie(tmp10, tmp11, tmp12, tmp13) = NewVector_24(state_, TNode<Context>{tmp0}, TNode<Smi>{tmp2}).Flatten();
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 197);
+    ca_.Goto(&block7, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp10, tmp11, tmp12, tmp13);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp14;
+    TNode<JSArray> tmp15;
+    TNode<Smi> tmp16;
+    TNode<JSReceiver> tmp17;
+    TNode<Object> tmp18;
+    TNode<Smi> tmp19;
+    TNode<JSArray> tmp20;
+    TNode<JSArray> tmp21;
+    TNode<Map> tmp22;
+    TNode<BoolT> tmp23;
+    TNode<FixedArray> tmp24;
+    TNode<BoolT> tmp25;
+    TNode<BoolT> tmp26;
+    TNode<BoolT> tmp27;
+    ca_.Bind(&block7, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27);
+    TNode<BoolT> tmp28;
+    USE(tmp28);
+    tmp28 = CodeStubAssembler(state_).SmiLessThan(TNode<Smi>{tmp19}, TNode<Smi>{tmp16});
+    ca_.Branch(tmp28, &block5, &block6, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp29;
+    TNode<JSArray> tmp30;
+    TNode<Smi> tmp31;
+    TNode<JSReceiver> tmp32;
+    TNode<Object> tmp33;
+    TNode<Smi> tmp34;
+    TNode<JSArray> tmp35;
+    TNode<JSArray> tmp36;
+    TNode<Map> tmp37;
+    TNode<BoolT> tmp38;
+    TNode<FixedArray> tmp39;
+    TNode<BoolT> tmp40;
+    TNode<BoolT> tmp41;
+    TNode<BoolT> tmp42;
+    ca_.Bind(&block5, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3421);
+    TNode<IntPtrT> tmp43 = ca_.IntPtrConstant(HeapObject::kMapOffset);
+    USE(tmp43);
+    TNode<Map>tmp44 = CodeStubAssembler(state_).LoadReference<Map>(CodeStubAssembler::Reference{tmp35, tmp43});
+    TNode<BoolT> tmp45;
+    USE(tmp45);
+    tmp45 = CodeStubAssembler(state_).TaggedNotEqual(TNode<HeapObject>{tmp44}, TNode<HeapObject>{tmp37});
+    ca_.Branch(tmp45, &block12, &block13, tmp29, tmp30, tmp31, tmp32, tmp33, tmp34, tmp35, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42);
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp46;
+    TNode<JSArray> tmp47;
+    TNode<Smi> tmp48;
+    TNode<JSReceiver> tmp49;
+    TNode<Object> tmp50;
+    TNode<Smi> tmp51;
+    TNode<JSArray> tmp52;
+    TNode<JSArray> tmp53;
+    TNode<Map> tmp54;
+    TNode<BoolT> tmp55;
+    TNode<FixedArray> tmp56;
+    TNode<BoolT> tmp57;
+    TNode<BoolT> tmp58;
+    TNode<BoolT> tmp59;
+    ca_.Bind(&block12, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59);
+    ca_.Goto(&block10, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51, tmp52, tmp53, tmp54, tmp55, tmp56, tmp57, tmp58, tmp59);
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp60;
+    TNode<JSArray> tmp61;
+    TNode<Smi> tmp62;
+    TNode<JSReceiver> tmp63;
+    TNode<Object> tmp64;
+    TNode<Smi> tmp65;
+    TNode<JSArray> tmp66;
+    TNode<JSArray> tmp67;
+    TNode<Map> tmp68;
+    TNode<BoolT> tmp69;
+    TNode<FixedArray> tmp70;
+    TNode<BoolT> tmp71;
+    TNode<BoolT> tmp72;
+    TNode<BoolT> tmp73;
+    ca_.Bind(&block13, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3428);
+    TNode<BoolT> tmp74;
+    USE(tmp74);
+    tmp74 = CodeStubAssembler(state_).IsNoElementsProtectorCellInvalid();
+    ca_.Branch(tmp74, &block14, &block15, tmp60, tmp61, tmp62, tmp63, tmp64, tmp65, tmp66, tmp67, tmp68, tmp69, tmp70, tmp71, tmp72, tmp73);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp75;
+    TNode<JSArray> tmp76;
+    TNode<Smi> tmp77;
+    TNode<JSReceiver> tmp78;
+    TNode<Object> tmp79;
+    TNode<Smi> tmp80;
+    TNode<JSArray> tmp81;
+    TNode<JSArray> tmp82;
+    TNode<Map> tmp83;
+    TNode<BoolT> tmp84;
+    TNode<FixedArray> tmp85;
+    TNode<BoolT> tmp86;
+    TNode<BoolT> tmp87;
+    TNode<BoolT> tmp88;
+    ca_.Bind(&block14, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86, &tmp87, &tmp88);
+    ca_.Goto(&block10, tmp75, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, tmp83, tmp84, tmp85, tmp86, tmp87, tmp88);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp89;
+    TNode<JSArray> tmp90;
+    TNode<Smi> tmp91;
+    TNode<JSReceiver> tmp92;
+    TNode<Object> tmp93;
+    TNode<Smi> tmp94;
+    TNode<JSArray> tmp95;
+    TNode<JSArray> tmp96;
+    TNode<Map> tmp97;
+    TNode<BoolT> tmp98;
+    TNode<FixedArray> tmp99;
+    TNode<BoolT> tmp100;
+    TNode<BoolT> tmp101;
+    TNode<BoolT> tmp102;
+    ca_.Bind(&block15, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3429);
+    TNode<JSArray> tmp103;
+    USE(tmp103);
+    tmp103 = (TNode<JSArray>{tmp95});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 198);
+    ca_.Goto(&block11, tmp89, tmp90, tmp91, tmp92, tmp93, tmp94, tmp95, tmp103, tmp97, tmp98, tmp99, tmp100, tmp101, tmp102);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp104;
+    TNode<JSArray> tmp105;
+    TNode<Smi> tmp106;
+    TNode<JSReceiver> tmp107;
+    TNode<Object> tmp108;
+    TNode<Smi> tmp109;
+    TNode<JSArray> tmp110;
+    TNode<JSArray> tmp111;
+    TNode<Map> tmp112;
+    TNode<BoolT> tmp113;
+    TNode<FixedArray> tmp114;
+    TNode<BoolT> tmp115;
+    TNode<BoolT> tmp116;
+    TNode<BoolT> tmp117;
+    ca_.Bind(&block11, &tmp104, &tmp105, &tmp106, &tmp107, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115, &tmp116, &tmp117);
+    ca_.Goto(&block9, tmp104, tmp105, tmp106, tmp107, tmp108, tmp109, tmp110, tmp111, tmp112, tmp113, tmp114, tmp115, tmp116, tmp117);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp118;
+    TNode<JSArray> tmp119;
+    TNode<Smi> tmp120;
+    TNode<JSReceiver> tmp121;
+    TNode<Object> tmp122;
+    TNode<Smi> tmp123;
+    TNode<JSArray> tmp124;
+    TNode<JSArray> tmp125;
+    TNode<Map> tmp126;
+    TNode<BoolT> tmp127;
+    TNode<FixedArray> tmp128;
+    TNode<BoolT> tmp129;
+    TNode<BoolT> tmp130;
+    TNode<BoolT> tmp131;
+    ca_.Bind(&block10, &tmp118, &tmp119, &tmp120, &tmp121, &tmp122, &tmp123, &tmp124, &tmp125, &tmp126, &tmp127, &tmp128, &tmp129, &tmp130, &tmp131);
+    ca_.Goto(&block4, tmp118, tmp119, tmp120, tmp121, tmp122, tmp123, tmp124, tmp125, tmp126, tmp127, tmp128, tmp129, tmp130, tmp131, tmp123);
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp132;
+    TNode<JSArray> tmp133;
+    TNode<Smi> tmp134;
+    TNode<JSReceiver> tmp135;
+    TNode<Object> tmp136;
+    TNode<Smi> tmp137;
+    TNode<JSArray> tmp138;
+    TNode<JSArray> tmp139;
+    TNode<Map> tmp140;
+    TNode<BoolT> tmp141;
+    TNode<FixedArray> tmp142;
+    TNode<BoolT> tmp143;
+    TNode<BoolT> tmp144;
+    TNode<BoolT> tmp145;
+    ca_.Bind(&block9, &tmp132, &tmp133, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138, &tmp139, &tmp140, &tmp141, &tmp142, &tmp143, &tmp144, &tmp145);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 201);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3417);
+    ca_.Goto(&block18, tmp132, tmp133, tmp134, tmp135, tmp136, tmp137, tmp138, tmp139, tmp140, tmp141, tmp142, tmp143, tmp144, tmp145, tmp137, tmp139);
+  }
+
+  if (block18.is_used()) {
+    TNode<Context> tmp146;
+    TNode<JSArray> tmp147;
+    TNode<Smi> tmp148;
+    TNode<JSReceiver> tmp149;
+    TNode<Object> tmp150;
+    TNode<Smi> tmp151;
+    TNode<JSArray> tmp152;
+    TNode<JSArray> tmp153;
+    TNode<Map> tmp154;
+    TNode<BoolT> tmp155;
+    TNode<FixedArray> tmp156;
+    TNode<BoolT> tmp157;
+    TNode<BoolT> tmp158;
+    TNode<BoolT> tmp159;
+    TNode<Smi> tmp160;
+    TNode<JSArray> tmp161;
+    ca_.Bind(&block18, &tmp146, &tmp147, &tmp148, &tmp149, &tmp150, &tmp151, &tmp152, &tmp153, &tmp154, &tmp155, &tmp156, &tmp157, &tmp158, &tmp159, &tmp160, &tmp161);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 201);
+    TNode<IntPtrT> tmp162 = ca_.IntPtrConstant(JSArray::kLengthOffset);
+    USE(tmp162);
+    TNode<Number>tmp163 = CodeStubAssembler(state_).LoadReference<Number>(CodeStubAssembler::Reference{tmp161, tmp162});
+    TNode<BoolT> tmp164;
+    USE(tmp164);
+    tmp164 = NumberIsGreaterThanOrEqual_78(state_, TNode<Number>{tmp160}, TNode<Number>{tmp163});
+    ca_.Branch(tmp164, &block16, &block17, tmp146, tmp147, tmp148, tmp149, tmp150, tmp151, tmp152, tmp153, tmp154, tmp155, tmp156, tmp157, tmp158, tmp159);
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp165;
+    TNode<JSArray> tmp166;
+    TNode<Smi> tmp167;
+    TNode<JSReceiver> tmp168;
+    TNode<Object> tmp169;
+    TNode<Smi> tmp170;
+    TNode<JSArray> tmp171;
+    TNode<JSArray> tmp172;
+    TNode<Map> tmp173;
+    TNode<BoolT> tmp174;
+    TNode<FixedArray> tmp175;
+    TNode<BoolT> tmp176;
+    TNode<BoolT> tmp177;
+    TNode<BoolT> tmp178;
+    ca_.Bind(&block16, &tmp165, &tmp166, &tmp167, &tmp168, &tmp169, &tmp170, &tmp171, &tmp172, &tmp173, &tmp174, &tmp175, &tmp176, &tmp177, &tmp178);
+    ca_.Goto(&block4, tmp165, tmp166, tmp167, tmp168, tmp169, tmp170, tmp171, tmp172, tmp173, tmp174, tmp175, tmp176, tmp177, tmp178, tmp170);
+  }
+
+  if (block17.is_used()) {
+    TNode<Context> tmp179;
+    TNode<JSArray> tmp180;
+    TNode<Smi> tmp181;
+    TNode<JSReceiver> tmp182;
+    TNode<Object> tmp183;
+    TNode<Smi> tmp184;
+    TNode<JSArray> tmp185;
+    TNode<JSArray> tmp186;
+    TNode<Map> tmp187;
+    TNode<BoolT> tmp188;
+    TNode<FixedArray> tmp189;
+    TNode<BoolT> tmp190;
+    TNode<BoolT> tmp191;
+    TNode<BoolT> tmp192;
+    ca_.Bind(&block17, &tmp179, &tmp180, &tmp181, &tmp182, &tmp183, &tmp184, &tmp185, &tmp186, &tmp187, &tmp188, &tmp189, &tmp190, &tmp191, &tmp192);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 204);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3434);
+    ca_.Branch(tmp188, &block22, &block23, tmp179, tmp180, tmp181, tmp182, tmp183, tmp184, tmp185, tmp186, tmp187, tmp188, tmp189, tmp190, tmp191, tmp192, tmp184, tmp179, tmp184);
+  }
+
+  if (block22.is_used()) {
+    TNode<Context> tmp193;
+    TNode<JSArray> tmp194;
+    TNode<Smi> tmp195;
+    TNode<JSReceiver> tmp196;
+    TNode<Object> tmp197;
+    TNode<Smi> tmp198;
+    TNode<JSArray> tmp199;
+    TNode<JSArray> tmp200;
+    TNode<Map> tmp201;
+    TNode<BoolT> tmp202;
+    TNode<FixedArray> tmp203;
+    TNode<BoolT> tmp204;
+    TNode<BoolT> tmp205;
+    TNode<BoolT> tmp206;
+    TNode<Smi> tmp207;
+    TNode<Context> tmp208;
+    TNode<Smi> tmp209;
+    ca_.Bind(&block22, &tmp193, &tmp194, &tmp195, &tmp196, &tmp197, &tmp198, &tmp199, &tmp200, &tmp201, &tmp202, &tmp203, &tmp204, &tmp205, &tmp206, &tmp207, &tmp208, &tmp209);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3435);
+    TNode<Object> tmp210;
+    USE(tmp210);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp210 = LoadElementNoHole16FixedDoubleArray_238(state_, TNode<Context>{tmp208}, TNode<JSArray>{tmp200}, TNode<Smi>{tmp209}, &label0);
+    ca_.Goto(&block25, tmp193, tmp194, tmp195, tmp196, tmp197, tmp198, tmp199, tmp200, tmp201, tmp202, tmp203, tmp204, tmp205, tmp206, tmp207, tmp208, tmp209, tmp200, tmp209, tmp210);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block26, tmp193, tmp194, tmp195, tmp196, tmp197, tmp198, tmp199, tmp200, tmp201, tmp202, tmp203, tmp204, tmp205, tmp206, tmp207, tmp208, tmp209, tmp200, tmp209);
+    }
+  }
+
+  if (block26.is_used()) {
+    TNode<Context> tmp211;
+    TNode<JSArray> tmp212;
+    TNode<Smi> tmp213;
+    TNode<JSReceiver> tmp214;
+    TNode<Object> tmp215;
+    TNode<Smi> tmp216;
+    TNode<JSArray> tmp217;
+    TNode<JSArray> tmp218;
+    TNode<Map> tmp219;
+    TNode<BoolT> tmp220;
+    TNode<FixedArray> tmp221;
+    TNode<BoolT> tmp222;
+    TNode<BoolT> tmp223;
+    TNode<BoolT> tmp224;
+    TNode<Smi> tmp225;
+    TNode<Context> tmp226;
+    TNode<Smi> tmp227;
+    TNode<JSArray> tmp228;
+    TNode<Smi> tmp229;
+    ca_.Bind(&block26, &tmp211, &tmp212, &tmp213, &tmp214, &tmp215, &tmp216, &tmp217, &tmp218, &tmp219, &tmp220, &tmp221, &tmp222, &tmp223, &tmp224, &tmp225, &tmp226, &tmp227, &tmp228, &tmp229);
+    ca_.Goto(&block20, tmp211, tmp212, tmp213, tmp214, tmp215, tmp216, tmp217, tmp218, tmp219, tmp220, tmp221, tmp222, tmp223, tmp224);
+  }
+
+  if (block25.is_used()) {
+    TNode<Context> tmp230;
+    TNode<JSArray> tmp231;
+    TNode<Smi> tmp232;
+    TNode<JSReceiver> tmp233;
+    TNode<Object> tmp234;
+    TNode<Smi> tmp235;
+    TNode<JSArray> tmp236;
+    TNode<JSArray> tmp237;
+    TNode<Map> tmp238;
+    TNode<BoolT> tmp239;
+    TNode<FixedArray> tmp240;
+    TNode<BoolT> tmp241;
+    TNode<BoolT> tmp242;
+    TNode<BoolT> tmp243;
+    TNode<Smi> tmp244;
+    TNode<Context> tmp245;
+    TNode<Smi> tmp246;
+    TNode<JSArray> tmp247;
+    TNode<Smi> tmp248;
+    TNode<Object> tmp249;
+    ca_.Bind(&block25, &tmp230, &tmp231, &tmp232, &tmp233, &tmp234, &tmp235, &tmp236, &tmp237, &tmp238, &tmp239, &tmp240, &tmp241, &tmp242, &tmp243, &tmp244, &tmp245, &tmp246, &tmp247, &tmp248, &tmp249);
+    ca_.Goto(&block21, tmp230, tmp231, tmp232, tmp233, tmp234, tmp235, tmp236, tmp237, tmp238, tmp239, tmp240, tmp241, tmp242, tmp243, tmp244, tmp245, tmp246, tmp249);
+  }
+
+  if (block23.is_used()) {
+    TNode<Context> tmp250;
+    TNode<JSArray> tmp251;
+    TNode<Smi> tmp252;
+    TNode<JSReceiver> tmp253;
+    TNode<Object> tmp254;
+    TNode<Smi> tmp255;
+    TNode<JSArray> tmp256;
+    TNode<JSArray> tmp257;
+    TNode<Map> tmp258;
+    TNode<BoolT> tmp259;
+    TNode<FixedArray> tmp260;
+    TNode<BoolT> tmp261;
+    TNode<BoolT> tmp262;
+    TNode<BoolT> tmp263;
+    TNode<Smi> tmp264;
+    TNode<Context> tmp265;
+    TNode<Smi> tmp266;
+    ca_.Bind(&block23, &tmp250, &tmp251, &tmp252, &tmp253, &tmp254, &tmp255, &tmp256, &tmp257, &tmp258, &tmp259, &tmp260, &tmp261, &tmp262, &tmp263, &tmp264, &tmp265, &tmp266);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3438);
+    TNode<Object> tmp267;
+    USE(tmp267);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp267 = LoadElementNoHole10FixedArray_237(state_, TNode<Context>{tmp265}, TNode<JSArray>{tmp257}, TNode<Smi>{tmp266}, &label0);
+    ca_.Goto(&block27, tmp250, tmp251, tmp252, tmp253, tmp254, tmp255, tmp256, tmp257, tmp258, tmp259, tmp260, tmp261, tmp262, tmp263, tmp264, tmp265, tmp266, tmp257, tmp266, tmp267);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block28, tmp250, tmp251, tmp252, tmp253, tmp254, tmp255, tmp256, tmp257, tmp258, tmp259, tmp260, tmp261, tmp262, tmp263, tmp264, tmp265, tmp266, tmp257, tmp266);
+    }
+  }
+
+  if (block28.is_used()) {
+    TNode<Context> tmp268;
+    TNode<JSArray> tmp269;
+    TNode<Smi> tmp270;
+    TNode<JSReceiver> tmp271;
+    TNode<Object> tmp272;
+    TNode<Smi> tmp273;
+    TNode<JSArray> tmp274;
+    TNode<JSArray> tmp275;
+    TNode<Map> tmp276;
+    TNode<BoolT> tmp277;
+    TNode<FixedArray> tmp278;
+    TNode<BoolT> tmp279;
+    TNode<BoolT> tmp280;
+    TNode<BoolT> tmp281;
+    TNode<Smi> tmp282;
+    TNode<Context> tmp283;
+    TNode<Smi> tmp284;
+    TNode<JSArray> tmp285;
+    TNode<Smi> tmp286;
+    ca_.Bind(&block28, &tmp268, &tmp269, &tmp270, &tmp271, &tmp272, &tmp273, &tmp274, &tmp275, &tmp276, &tmp277, &tmp278, &tmp279, &tmp280, &tmp281, &tmp282, &tmp283, &tmp284, &tmp285, &tmp286);
+    ca_.Goto(&block20, tmp268, tmp269, tmp270, tmp271, tmp272, tmp273, tmp274, tmp275, tmp276, tmp277, tmp278, tmp279, tmp280, tmp281);
+  }
+
+  if (block27.is_used()) {
+    TNode<Context> tmp287;
+    TNode<JSArray> tmp288;
+    TNode<Smi> tmp289;
+    TNode<JSReceiver> tmp290;
+    TNode<Object> tmp291;
+    TNode<Smi> tmp292;
+    TNode<JSArray> tmp293;
+    TNode<JSArray> tmp294;
+    TNode<Map> tmp295;
+    TNode<BoolT> tmp296;
+    TNode<FixedArray> tmp297;
+    TNode<BoolT> tmp298;
+    TNode<BoolT> tmp299;
+    TNode<BoolT> tmp300;
+    TNode<Smi> tmp301;
+    TNode<Context> tmp302;
+    TNode<Smi> tmp303;
+    TNode<JSArray> tmp304;
+    TNode<Smi> tmp305;
+    TNode<Object> tmp306;
+    ca_.Bind(&block27, &tmp287, &tmp288, &tmp289, &tmp290, &tmp291, &tmp292, &tmp293, &tmp294, &tmp295, &tmp296, &tmp297, &tmp298, &tmp299, &tmp300, &tmp301, &tmp302, &tmp303, &tmp304, &tmp305, &tmp306);
+    ca_.Goto(&block21, tmp287, tmp288, tmp289, tmp290, tmp291, tmp292, tmp293, tmp294, tmp295, tmp296, tmp297, tmp298, tmp299, tmp300, tmp301, tmp302, tmp303, tmp306);
+  }
+
+  if (block21.is_used()) {
+    TNode<Context> tmp307;
+    TNode<JSArray> tmp308;
+    TNode<Smi> tmp309;
+    TNode<JSReceiver> tmp310;
+    TNode<Object> tmp311;
+    TNode<Smi> tmp312;
+    TNode<JSArray> tmp313;
+    TNode<JSArray> tmp314;
+    TNode<Map> tmp315;
+    TNode<BoolT> tmp316;
+    TNode<FixedArray> tmp317;
+    TNode<BoolT> tmp318;
+    TNode<BoolT> tmp319;
+    TNode<BoolT> tmp320;
+    TNode<Smi> tmp321;
+    TNode<Context> tmp322;
+    TNode<Smi> tmp323;
+    TNode<Object> tmp324;
+    ca_.Bind(&block21, &tmp307, &tmp308, &tmp309, &tmp310, &tmp311, &tmp312, &tmp313, &tmp314, &tmp315, &tmp316, &tmp317, &tmp318, &tmp319, &tmp320, &tmp321, &tmp322, &tmp323, &tmp324);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 204);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 207);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3417);
+    ca_.Goto(&block29, tmp307, tmp308, tmp309, tmp310, tmp311, tmp312, tmp313, tmp314, tmp315, tmp316, tmp317, tmp318, tmp319, tmp320, tmp324, tmp307, tmp310, tmp311, tmp324, tmp312, tmp314);
+  }
+
+  if (block29.is_used()) {
+    TNode<Context> tmp325;
+    TNode<JSArray> tmp326;
+    TNode<Smi> tmp327;
+    TNode<JSReceiver> tmp328;
+    TNode<Object> tmp329;
+    TNode<Smi> tmp330;
+    TNode<JSArray> tmp331;
+    TNode<JSArray> tmp332;
+    TNode<Map> tmp333;
+    TNode<BoolT> tmp334;
+    TNode<FixedArray> tmp335;
+    TNode<BoolT> tmp336;
+    TNode<BoolT> tmp337;
+    TNode<BoolT> tmp338;
+    TNode<Object> tmp339;
+    TNode<Context> tmp340;
+    TNode<JSReceiver> tmp341;
+    TNode<Object> tmp342;
+    TNode<Object> tmp343;
+    TNode<Smi> tmp344;
+    TNode<JSArray> tmp345;
+    ca_.Bind(&block29, &tmp325, &tmp326, &tmp327, &tmp328, &tmp329, &tmp330, &tmp331, &tmp332, &tmp333, &tmp334, &tmp335, &tmp336, &tmp337, &tmp338, &tmp339, &tmp340, &tmp341, &tmp342, &tmp343, &tmp344, &tmp345);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 207);
+    TNode<Object> tmp346;
+    USE(tmp346);
+    tmp346 = CodeStubAssembler(state_).Call(TNode<Context>{tmp340}, TNode<JSReceiver>{tmp341}, TNode<Object>{tmp342}, TNode<Object>{tmp343}, TNode<Object>{tmp344}, TNode<Object>{tmp345});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 206);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 208);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 151);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 152);
+    TNode<Smi> tmp347;
+    USE(tmp347);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp347 = Cast5ATSmi_83(state_, TNode<Object>{tmp346}, &label0);
+    ca_.Goto(&block33, tmp325, tmp326, tmp327, tmp328, tmp329, tmp330, tmp331, tmp332, tmp333, tmp334, tmp335, tmp336, tmp337, tmp338, tmp339, tmp346, tmp330, tmp346, tmp325, tmp330, tmp346, tmp346, tmp346, tmp347);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block34, tmp325, tmp326, tmp327, tmp328, tmp329, tmp330, tmp331, tmp332, tmp333, tmp334, tmp335, tmp336, tmp337, tmp338, tmp339, tmp346, tmp330, tmp346, tmp325, tmp330, tmp346, tmp346, tmp346);
+    }
+  }
+
+  if (block34.is_used()) {
+    TNode<Context> tmp348;
+    TNode<JSArray> tmp349;
+    TNode<Smi> tmp350;
+    TNode<JSReceiver> tmp351;
+    TNode<Object> tmp352;
+    TNode<Smi> tmp353;
+    TNode<JSArray> tmp354;
+    TNode<JSArray> tmp355;
+    TNode<Map> tmp356;
+    TNode<BoolT> tmp357;
+    TNode<FixedArray> tmp358;
+    TNode<BoolT> tmp359;
+    TNode<BoolT> tmp360;
+    TNode<BoolT> tmp361;
+    TNode<Object> tmp362;
+    TNode<Object> tmp363;
+    TNode<Smi> tmp364;
+    TNode<Object> tmp365;
+    TNode<Context> tmp366;
+    TNode<Smi> tmp367;
+    TNode<Object> tmp368;
+    TNode<Object> tmp369;
+    TNode<Object> tmp370;
+    ca_.Bind(&block34, &tmp348, &tmp349, &tmp350, &tmp351, &tmp352, &tmp353, &tmp354, &tmp355, &tmp356, &tmp357, &tmp358, &tmp359, &tmp360, &tmp361, &tmp362, &tmp363, &tmp364, &tmp365, &tmp366, &tmp367, &tmp368, &tmp369, &tmp370);
+    ca_.Goto(&block32, tmp348, tmp349, tmp350, tmp351, tmp352, tmp353, tmp354, tmp355, tmp356, tmp357, tmp358, tmp359, tmp360, tmp361, tmp362, tmp363, tmp364, tmp365, tmp366, tmp367, tmp368, tmp369);
+  }
+
+  if (block33.is_used()) {
+    TNode<Context> tmp371;
+    TNode<JSArray> tmp372;
+    TNode<Smi> tmp373;
+    TNode<JSReceiver> tmp374;
+    TNode<Object> tmp375;
+    TNode<Smi> tmp376;
+    TNode<JSArray> tmp377;
+    TNode<JSArray> tmp378;
+    TNode<Map> tmp379;
+    TNode<BoolT> tmp380;
+    TNode<FixedArray> tmp381;
+    TNode<BoolT> tmp382;
+    TNode<BoolT> tmp383;
+    TNode<BoolT> tmp384;
+    TNode<Object> tmp385;
+    TNode<Object> tmp386;
+    TNode<Smi> tmp387;
+    TNode<Object> tmp388;
+    TNode<Context> tmp389;
+    TNode<Smi> tmp390;
+    TNode<Object> tmp391;
+    TNode<Object> tmp392;
+    TNode<Object> tmp393;
+    TNode<Smi> tmp394;
+    ca_.Bind(&block33, &tmp371, &tmp372, &tmp373, &tmp374, &tmp375, &tmp376, &tmp377, &tmp378, &tmp379, &tmp380, &tmp381, &tmp382, &tmp383, &tmp384, &tmp385, &tmp386, &tmp387, &tmp388, &tmp389, &tmp390, &tmp391, &tmp392, &tmp393, &tmp394);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 153);
+    TNode<IntPtrT> tmp395 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp395);
+    TNode<IntPtrT> tmp396 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp396);
+    TNode<Smi>tmp397 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp381, tmp396});
+    TNode<IntPtrT> tmp398;
+    USE(tmp398);
+    tmp398 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp397});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 55);
+    TNode<IntPtrT> tmp399;
+    USE(tmp399);
+    tmp399 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp390});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 56);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp400;
+    USE(tmp400);
+    tmp400 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp399});
+    TNode<UintPtrT> tmp401;
+    USE(tmp401);
+    tmp401 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp398});
+    TNode<BoolT> tmp402;
+    USE(tmp402);
+    tmp402 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp400}, TNode<UintPtrT>{tmp401});
+    ca_.Branch(tmp402, &block39, &block40, tmp371, tmp372, tmp373, tmp374, tmp375, tmp376, tmp377, tmp378, tmp379, tmp380, tmp381, tmp382, tmp383, tmp384, tmp385, tmp386, tmp387, tmp388, tmp389, tmp390, tmp391, tmp392, tmp394, tmp381, tmp395, tmp398, tmp390, tmp390, tmp399, tmp381, tmp395, tmp398, tmp399, tmp399);
+  }
+
+  if (block39.is_used()) {
+    TNode<Context> tmp403;
+    TNode<JSArray> tmp404;
+    TNode<Smi> tmp405;
+    TNode<JSReceiver> tmp406;
+    TNode<Object> tmp407;
+    TNode<Smi> tmp408;
+    TNode<JSArray> tmp409;
+    TNode<JSArray> tmp410;
+    TNode<Map> tmp411;
+    TNode<BoolT> tmp412;
+    TNode<FixedArray> tmp413;
+    TNode<BoolT> tmp414;
+    TNode<BoolT> tmp415;
+    TNode<BoolT> tmp416;
+    TNode<Object> tmp417;
+    TNode<Object> tmp418;
+    TNode<Smi> tmp419;
+    TNode<Object> tmp420;
+    TNode<Context> tmp421;
+    TNode<Smi> tmp422;
+    TNode<Object> tmp423;
+    TNode<Object> tmp424;
+    TNode<Smi> tmp425;
+    TNode<FixedArray> tmp426;
+    TNode<IntPtrT> tmp427;
+    TNode<IntPtrT> tmp428;
+    TNode<Smi> tmp429;
+    TNode<Smi> tmp430;
+    TNode<IntPtrT> tmp431;
+    TNode<HeapObject> tmp432;
+    TNode<IntPtrT> tmp433;
+    TNode<IntPtrT> tmp434;
+    TNode<IntPtrT> tmp435;
+    TNode<IntPtrT> tmp436;
+    ca_.Bind(&block39, &tmp403, &tmp404, &tmp405, &tmp406, &tmp407, &tmp408, &tmp409, &tmp410, &tmp411, &tmp412, &tmp413, &tmp414, &tmp415, &tmp416, &tmp417, &tmp418, &tmp419, &tmp420, &tmp421, &tmp422, &tmp423, &tmp424, &tmp425, &tmp426, &tmp427, &tmp428, &tmp429, &tmp430, &tmp431, &tmp432, &tmp433, &tmp434, &tmp435, &tmp436);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp437;
+    USE(tmp437);
+    tmp437 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp438;
+    USE(tmp438);
+    tmp438 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp436}, TNode<IntPtrT>{tmp437});
+    TNode<IntPtrT> tmp439;
+    USE(tmp439);
+    tmp439 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp433}, TNode<IntPtrT>{tmp438});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp440;
+    USE(tmp440);
+    TNode<IntPtrT> tmp441;
+    USE(tmp441);
+    std::tie(tmp440, tmp441) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp432}, TNode<IntPtrT>{tmp439}).Flatten();
+    ca_.Goto(&block38, tmp403, tmp404, tmp405, tmp406, tmp407, tmp408, tmp409, tmp410, tmp411, tmp412, tmp413, tmp414, tmp415, tmp416, tmp417, tmp418, tmp419, tmp420, tmp421, tmp422, tmp423, tmp424, tmp425, tmp426, tmp427, tmp428, tmp429, tmp430, tmp431, tmp432, tmp433, tmp434, tmp435, tmp436, tmp440, tmp441);
+  }
+
+  if (block40.is_used()) {
+    TNode<Context> tmp442;
+    TNode<JSArray> tmp443;
+    TNode<Smi> tmp444;
+    TNode<JSReceiver> tmp445;
+    TNode<Object> tmp446;
+    TNode<Smi> tmp447;
+    TNode<JSArray> tmp448;
+    TNode<JSArray> tmp449;
+    TNode<Map> tmp450;
+    TNode<BoolT> tmp451;
+    TNode<FixedArray> tmp452;
+    TNode<BoolT> tmp453;
+    TNode<BoolT> tmp454;
+    TNode<BoolT> tmp455;
+    TNode<Object> tmp456;
+    TNode<Object> tmp457;
+    TNode<Smi> tmp458;
+    TNode<Object> tmp459;
+    TNode<Context> tmp460;
+    TNode<Smi> tmp461;
+    TNode<Object> tmp462;
+    TNode<Object> tmp463;
+    TNode<Smi> tmp464;
+    TNode<FixedArray> tmp465;
+    TNode<IntPtrT> tmp466;
+    TNode<IntPtrT> tmp467;
+    TNode<Smi> tmp468;
+    TNode<Smi> tmp469;
+    TNode<IntPtrT> tmp470;
+    TNode<HeapObject> tmp471;
+    TNode<IntPtrT> tmp472;
+    TNode<IntPtrT> tmp473;
+    TNode<IntPtrT> tmp474;
+    TNode<IntPtrT> tmp475;
+    ca_.Bind(&block40, &tmp442, &tmp443, &tmp444, &tmp445, &tmp446, &tmp447, &tmp448, &tmp449, &tmp450, &tmp451, &tmp452, &tmp453, &tmp454, &tmp455, &tmp456, &tmp457, &tmp458, &tmp459, &tmp460, &tmp461, &tmp462, &tmp463, &tmp464, &tmp465, &tmp466, &tmp467, &tmp468, &tmp469, &tmp470, &tmp471, &tmp472, &tmp473, &tmp474, &tmp475);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block37, tmp442, tmp443, tmp444, tmp445, tmp446, tmp447, tmp448, tmp449, tmp450, tmp451, tmp452, tmp453, tmp454, tmp455, tmp456, tmp457, tmp458, tmp459, tmp460, tmp461, tmp462, tmp463, tmp464, tmp465, tmp466, tmp467, tmp468, tmp469, tmp470);
+  }
+
+  if (block38.is_used()) {
+    TNode<Context> tmp476;
+    TNode<JSArray> tmp477;
+    TNode<Smi> tmp478;
+    TNode<JSReceiver> tmp479;
+    TNode<Object> tmp480;
+    TNode<Smi> tmp481;
+    TNode<JSArray> tmp482;
+    TNode<JSArray> tmp483;
+    TNode<Map> tmp484;
+    TNode<BoolT> tmp485;
+    TNode<FixedArray> tmp486;
+    TNode<BoolT> tmp487;
+    TNode<BoolT> tmp488;
+    TNode<BoolT> tmp489;
+    TNode<Object> tmp490;
+    TNode<Object> tmp491;
+    TNode<Smi> tmp492;
+    TNode<Object> tmp493;
+    TNode<Context> tmp494;
+    TNode<Smi> tmp495;
+    TNode<Object> tmp496;
+    TNode<Object> tmp497;
+    TNode<Smi> tmp498;
+    TNode<FixedArray> tmp499;
+    TNode<IntPtrT> tmp500;
+    TNode<IntPtrT> tmp501;
+    TNode<Smi> tmp502;
+    TNode<Smi> tmp503;
+    TNode<IntPtrT> tmp504;
+    TNode<HeapObject> tmp505;
+    TNode<IntPtrT> tmp506;
+    TNode<IntPtrT> tmp507;
+    TNode<IntPtrT> tmp508;
+    TNode<IntPtrT> tmp509;
+    TNode<HeapObject> tmp510;
+    TNode<IntPtrT> tmp511;
+    ca_.Bind(&block38, &tmp476, &tmp477, &tmp478, &tmp479, &tmp480, &tmp481, &tmp482, &tmp483, &tmp484, &tmp485, &tmp486, &tmp487, &tmp488, &tmp489, &tmp490, &tmp491, &tmp492, &tmp493, &tmp494, &tmp495, &tmp496, &tmp497, &tmp498, &tmp499, &tmp500, &tmp501, &tmp502, &tmp503, &tmp504, &tmp505, &tmp506, &tmp507, &tmp508, &tmp509, &tmp510, &tmp511);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 56);
+    ca_.Goto(&block36, tmp476, tmp477, tmp478, tmp479, tmp480, tmp481, tmp482, tmp483, tmp484, tmp485, tmp486, tmp487, tmp488, tmp489, tmp490, tmp491, tmp492, tmp493, tmp494, tmp495, tmp496, tmp497, tmp498, tmp499, tmp500, tmp501, tmp502, tmp503, tmp504, tmp510, tmp511);
+  }
+
+  if (block37.is_used()) {
+    TNode<Context> tmp512;
+    TNode<JSArray> tmp513;
+    TNode<Smi> tmp514;
+    TNode<JSReceiver> tmp515;
+    TNode<Object> tmp516;
+    TNode<Smi> tmp517;
+    TNode<JSArray> tmp518;
+    TNode<JSArray> tmp519;
+    TNode<Map> tmp520;
+    TNode<BoolT> tmp521;
+    TNode<FixedArray> tmp522;
+    TNode<BoolT> tmp523;
+    TNode<BoolT> tmp524;
+    TNode<BoolT> tmp525;
+    TNode<Object> tmp526;
+    TNode<Object> tmp527;
+    TNode<Smi> tmp528;
+    TNode<Object> tmp529;
+    TNode<Context> tmp530;
+    TNode<Smi> tmp531;
+    TNode<Object> tmp532;
+    TNode<Object> tmp533;
+    TNode<Smi> tmp534;
+    TNode<FixedArray> tmp535;
+    TNode<IntPtrT> tmp536;
+    TNode<IntPtrT> tmp537;
+    TNode<Smi> tmp538;
+    TNode<Smi> tmp539;
+    TNode<IntPtrT> tmp540;
+    ca_.Bind(&block37, &tmp512, &tmp513, &tmp514, &tmp515, &tmp516, &tmp517, &tmp518, &tmp519, &tmp520, &tmp521, &tmp522, &tmp523, &tmp524, &tmp525, &tmp526, &tmp527, &tmp528, &tmp529, &tmp530, &tmp531, &tmp532, &tmp533, &tmp534, &tmp535, &tmp536, &tmp537, &tmp538, &tmp539, &tmp540);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block36.is_used()) {
+    TNode<Context> tmp541;
+    TNode<JSArray> tmp542;
+    TNode<Smi> tmp543;
+    TNode<JSReceiver> tmp544;
+    TNode<Object> tmp545;
+    TNode<Smi> tmp546;
+    TNode<JSArray> tmp547;
+    TNode<JSArray> tmp548;
+    TNode<Map> tmp549;
+    TNode<BoolT> tmp550;
+    TNode<FixedArray> tmp551;
+    TNode<BoolT> tmp552;
+    TNode<BoolT> tmp553;
+    TNode<BoolT> tmp554;
+    TNode<Object> tmp555;
+    TNode<Object> tmp556;
+    TNode<Smi> tmp557;
+    TNode<Object> tmp558;
+    TNode<Context> tmp559;
+    TNode<Smi> tmp560;
+    TNode<Object> tmp561;
+    TNode<Object> tmp562;
+    TNode<Smi> tmp563;
+    TNode<FixedArray> tmp564;
+    TNode<IntPtrT> tmp565;
+    TNode<IntPtrT> tmp566;
+    TNode<Smi> tmp567;
+    TNode<Smi> tmp568;
+    TNode<IntPtrT> tmp569;
+    TNode<HeapObject> tmp570;
+    TNode<IntPtrT> tmp571;
+    ca_.Bind(&block36, &tmp541, &tmp542, &tmp543, &tmp544, &tmp545, &tmp546, &tmp547, &tmp548, &tmp549, &tmp550, &tmp551, &tmp552, &tmp553, &tmp554, &tmp555, &tmp556, &tmp557, &tmp558, &tmp559, &tmp560, &tmp561, &tmp562, &tmp563, &tmp564, &tmp565, &tmp566, &tmp567, &tmp568, &tmp569, &tmp570, &tmp571);
+    ca_.Goto(&block35, tmp541, tmp542, tmp543, tmp544, tmp545, tmp546, tmp547, tmp548, tmp549, tmp550, tmp551, tmp552, tmp553, tmp554, tmp555, tmp556, tmp557, tmp558, tmp559, tmp560, tmp561, tmp562, tmp563, tmp564, tmp565, tmp566, tmp567, tmp568, tmp570, tmp571);
+  }
+
+  if (block35.is_used()) {
+    TNode<Context> tmp572;
+    TNode<JSArray> tmp573;
+    TNode<Smi> tmp574;
+    TNode<JSReceiver> tmp575;
+    TNode<Object> tmp576;
+    TNode<Smi> tmp577;
+    TNode<JSArray> tmp578;
+    TNode<JSArray> tmp579;
+    TNode<Map> tmp580;
+    TNode<BoolT> tmp581;
+    TNode<FixedArray> tmp582;
+    TNode<BoolT> tmp583;
+    TNode<BoolT> tmp584;
+    TNode<BoolT> tmp585;
+    TNode<Object> tmp586;
+    TNode<Object> tmp587;
+    TNode<Smi> tmp588;
+    TNode<Object> tmp589;
+    TNode<Context> tmp590;
+    TNode<Smi> tmp591;
+    TNode<Object> tmp592;
+    TNode<Object> tmp593;
+    TNode<Smi> tmp594;
+    TNode<FixedArray> tmp595;
+    TNode<IntPtrT> tmp596;
+    TNode<IntPtrT> tmp597;
+    TNode<Smi> tmp598;
+    TNode<Smi> tmp599;
+    TNode<HeapObject> tmp600;
+    TNode<IntPtrT> tmp601;
+    ca_.Bind(&block35, &tmp572, &tmp573, &tmp574, &tmp575, &tmp576, &tmp577, &tmp578, &tmp579, &tmp580, &tmp581, &tmp582, &tmp583, &tmp584, &tmp585, &tmp586, &tmp587, &tmp588, &tmp589, &tmp590, &tmp591, &tmp592, &tmp593, &tmp594, &tmp595, &tmp596, &tmp597, &tmp598, &tmp599, &tmp600, &tmp601);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 153);
+    CodeStubAssembler(state_).StoreReference(CodeStubAssembler::Reference{tmp600, tmp601}, tmp594);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 152);
+    ca_.Goto(&block31, tmp572, tmp573, tmp574, tmp575, tmp576, tmp577, tmp578, tmp579, tmp580, tmp581, tmp582, tmp583, tmp584, tmp585, tmp586, tmp587, tmp588, tmp589, tmp590, tmp591, tmp592, tmp593);
+  }
+
+  if (block32.is_used()) {
+    TNode<Context> tmp602;
+    TNode<JSArray> tmp603;
+    TNode<Smi> tmp604;
+    TNode<JSReceiver> tmp605;
+    TNode<Object> tmp606;
+    TNode<Smi> tmp607;
+    TNode<JSArray> tmp608;
+    TNode<JSArray> tmp609;
+    TNode<Map> tmp610;
+    TNode<BoolT> tmp611;
+    TNode<FixedArray> tmp612;
+    TNode<BoolT> tmp613;
+    TNode<BoolT> tmp614;
+    TNode<BoolT> tmp615;
+    TNode<Object> tmp616;
+    TNode<Object> tmp617;
+    TNode<Smi> tmp618;
+    TNode<Object> tmp619;
+    TNode<Context> tmp620;
+    TNode<Smi> tmp621;
+    TNode<Object> tmp622;
+    TNode<Object> tmp623;
+    ca_.Bind(&block32, &tmp602, &tmp603, &tmp604, &tmp605, &tmp606, &tmp607, &tmp608, &tmp609, &tmp610, &tmp611, &tmp612, &tmp613, &tmp614, &tmp615, &tmp616, &tmp617, &tmp618, &tmp619, &tmp620, &tmp621, &tmp622, &tmp623);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 155);
+    TNode<HeapNumber> tmp624;
+    USE(tmp624);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp624 = Cast10HeapNumber_129(state_, TNode<HeapObject>{ca_.UncheckedCast<HeapObject>(tmp623)}, &label0);
+    ca_.Goto(&block44, tmp602, tmp603, tmp604, tmp605, tmp606, tmp607, tmp608, tmp609, tmp610, tmp611, tmp612, tmp613, tmp614, tmp615, tmp616, tmp617, tmp618, tmp619, tmp620, tmp621, tmp622, tmp623, ca_.UncheckedCast<HeapObject>(tmp623), tmp624);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block45, tmp602, tmp603, tmp604, tmp605, tmp606, tmp607, tmp608, tmp609, tmp610, tmp611, tmp612, tmp613, tmp614, tmp615, tmp616, tmp617, tmp618, tmp619, tmp620, tmp621, tmp622, tmp623, ca_.UncheckedCast<HeapObject>(tmp623));
+    }
+  }
+
+  if (block45.is_used()) {
+    TNode<Context> tmp625;
+    TNode<JSArray> tmp626;
+    TNode<Smi> tmp627;
+    TNode<JSReceiver> tmp628;
+    TNode<Object> tmp629;
+    TNode<Smi> tmp630;
+    TNode<JSArray> tmp631;
+    TNode<JSArray> tmp632;
+    TNode<Map> tmp633;
+    TNode<BoolT> tmp634;
+    TNode<FixedArray> tmp635;
+    TNode<BoolT> tmp636;
+    TNode<BoolT> tmp637;
+    TNode<BoolT> tmp638;
+    TNode<Object> tmp639;
+    TNode<Object> tmp640;
+    TNode<Smi> tmp641;
+    TNode<Object> tmp642;
+    TNode<Context> tmp643;
+    TNode<Smi> tmp644;
+    TNode<Object> tmp645;
+    TNode<Object> tmp646;
+    TNode<HeapObject> tmp647;
+    ca_.Bind(&block45, &tmp625, &tmp626, &tmp627, &tmp628, &tmp629, &tmp630, &tmp631, &tmp632, &tmp633, &tmp634, &tmp635, &tmp636, &tmp637, &tmp638, &tmp639, &tmp640, &tmp641, &tmp642, &tmp643, &tmp644, &tmp645, &tmp646, &tmp647);
+    ca_.Goto(&block43, tmp625, tmp626, tmp627, tmp628, tmp629, tmp630, tmp631, tmp632, tmp633, tmp634, tmp635, tmp636, tmp637, tmp638, tmp639, tmp640, tmp641, tmp642, tmp643, tmp644, tmp645, tmp646);
+  }
+
+  if (block44.is_used()) {
+    TNode<Context> tmp648;
+    TNode<JSArray> tmp649;
+    TNode<Smi> tmp650;
+    TNode<JSReceiver> tmp651;
+    TNode<Object> tmp652;
+    TNode<Smi> tmp653;
+    TNode<JSArray> tmp654;
+    TNode<JSArray> tmp655;
+    TNode<Map> tmp656;
+    TNode<BoolT> tmp657;
+    TNode<FixedArray> tmp658;
+    TNode<BoolT> tmp659;
+    TNode<BoolT> tmp660;
+    TNode<BoolT> tmp661;
+    TNode<Object> tmp662;
+    TNode<Object> tmp663;
+    TNode<Smi> tmp664;
+    TNode<Object> tmp665;
+    TNode<Context> tmp666;
+    TNode<Smi> tmp667;
+    TNode<Object> tmp668;
+    TNode<Object> tmp669;
+    TNode<HeapObject> tmp670;
+    TNode<HeapNumber> tmp671;
+    ca_.Bind(&block44, &tmp648, &tmp649, &tmp650, &tmp651, &tmp652, &tmp653, &tmp654, &tmp655, &tmp656, &tmp657, &tmp658, &tmp659, &tmp660, &tmp661, &tmp662, &tmp663, &tmp664, &tmp665, &tmp666, &tmp667, &tmp668, &tmp669, &tmp670, &tmp671);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 156);
+    TNode<BoolT> tmp672;
+    USE(tmp672);
+    tmp672 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, false);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 157);
+    TNode<IntPtrT> tmp673 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp673);
+    TNode<IntPtrT> tmp674 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp674);
+    TNode<Smi>tmp675 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp658, tmp674});
+    TNode<IntPtrT> tmp676;
+    USE(tmp676);
+    tmp676 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp675});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 55);
+    TNode<IntPtrT> tmp677;
+    USE(tmp677);
+    tmp677 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp667});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 56);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp678;
+    USE(tmp678);
+    tmp678 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp677});
+    TNode<UintPtrT> tmp679;
+    USE(tmp679);
+    tmp679 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp676});
+    TNode<BoolT> tmp680;
+    USE(tmp680);
+    tmp680 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp678}, TNode<UintPtrT>{tmp679});
+    ca_.Branch(tmp680, &block50, &block51, tmp648, tmp649, tmp650, tmp651, tmp652, tmp653, tmp654, tmp655, tmp656, tmp657, tmp658, tmp672, tmp660, tmp661, tmp662, tmp663, tmp664, tmp665, tmp666, tmp667, tmp668, tmp669, tmp671, tmp658, tmp673, tmp676, tmp667, tmp667, tmp677, tmp658, tmp673, tmp676, tmp677, tmp677);
+  }
+
+  if (block50.is_used()) {
+    TNode<Context> tmp681;
+    TNode<JSArray> tmp682;
+    TNode<Smi> tmp683;
+    TNode<JSReceiver> tmp684;
+    TNode<Object> tmp685;
+    TNode<Smi> tmp686;
+    TNode<JSArray> tmp687;
+    TNode<JSArray> tmp688;
+    TNode<Map> tmp689;
+    TNode<BoolT> tmp690;
+    TNode<FixedArray> tmp691;
+    TNode<BoolT> tmp692;
+    TNode<BoolT> tmp693;
+    TNode<BoolT> tmp694;
+    TNode<Object> tmp695;
+    TNode<Object> tmp696;
+    TNode<Smi> tmp697;
+    TNode<Object> tmp698;
+    TNode<Context> tmp699;
+    TNode<Smi> tmp700;
+    TNode<Object> tmp701;
+    TNode<Object> tmp702;
+    TNode<HeapNumber> tmp703;
+    TNode<FixedArray> tmp704;
+    TNode<IntPtrT> tmp705;
+    TNode<IntPtrT> tmp706;
+    TNode<Smi> tmp707;
+    TNode<Smi> tmp708;
+    TNode<IntPtrT> tmp709;
+    TNode<HeapObject> tmp710;
+    TNode<IntPtrT> tmp711;
+    TNode<IntPtrT> tmp712;
+    TNode<IntPtrT> tmp713;
+    TNode<IntPtrT> tmp714;
+    ca_.Bind(&block50, &tmp681, &tmp682, &tmp683, &tmp684, &tmp685, &tmp686, &tmp687, &tmp688, &tmp689, &tmp690, &tmp691, &tmp692, &tmp693, &tmp694, &tmp695, &tmp696, &tmp697, &tmp698, &tmp699, &tmp700, &tmp701, &tmp702, &tmp703, &tmp704, &tmp705, &tmp706, &tmp707, &tmp708, &tmp709, &tmp710, &tmp711, &tmp712, &tmp713, &tmp714);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp715;
+    USE(tmp715);
+    tmp715 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp716;
+    USE(tmp716);
+    tmp716 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp714}, TNode<IntPtrT>{tmp715});
+    TNode<IntPtrT> tmp717;
+    USE(tmp717);
+    tmp717 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp711}, TNode<IntPtrT>{tmp716});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp718;
+    USE(tmp718);
+    TNode<IntPtrT> tmp719;
+    USE(tmp719);
+    std::tie(tmp718, tmp719) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp710}, TNode<IntPtrT>{tmp717}).Flatten();
+    ca_.Goto(&block49, tmp681, tmp682, tmp683, tmp684, tmp685, tmp686, tmp687, tmp688, tmp689, tmp690, tmp691, tmp692, tmp693, tmp694, tmp695, tmp696, tmp697, tmp698, tmp699, tmp700, tmp701, tmp702, tmp703, tmp704, tmp705, tmp706, tmp707, tmp708, tmp709, tmp710, tmp711, tmp712, tmp713, tmp714, tmp718, tmp719);
+  }
+
+  if (block51.is_used()) {
+    TNode<Context> tmp720;
+    TNode<JSArray> tmp721;
+    TNode<Smi> tmp722;
+    TNode<JSReceiver> tmp723;
+    TNode<Object> tmp724;
+    TNode<Smi> tmp725;
+    TNode<JSArray> tmp726;
+    TNode<JSArray> tmp727;
+    TNode<Map> tmp728;
+    TNode<BoolT> tmp729;
+    TNode<FixedArray> tmp730;
+    TNode<BoolT> tmp731;
+    TNode<BoolT> tmp732;
+    TNode<BoolT> tmp733;
+    TNode<Object> tmp734;
+    TNode<Object> tmp735;
+    TNode<Smi> tmp736;
+    TNode<Object> tmp737;
+    TNode<Context> tmp738;
+    TNode<Smi> tmp739;
+    TNode<Object> tmp740;
+    TNode<Object> tmp741;
+    TNode<HeapNumber> tmp742;
+    TNode<FixedArray> tmp743;
+    TNode<IntPtrT> tmp744;
+    TNode<IntPtrT> tmp745;
+    TNode<Smi> tmp746;
+    TNode<Smi> tmp747;
+    TNode<IntPtrT> tmp748;
+    TNode<HeapObject> tmp749;
+    TNode<IntPtrT> tmp750;
+    TNode<IntPtrT> tmp751;
+    TNode<IntPtrT> tmp752;
+    TNode<IntPtrT> tmp753;
+    ca_.Bind(&block51, &tmp720, &tmp721, &tmp722, &tmp723, &tmp724, &tmp725, &tmp726, &tmp727, &tmp728, &tmp729, &tmp730, &tmp731, &tmp732, &tmp733, &tmp734, &tmp735, &tmp736, &tmp737, &tmp738, &tmp739, &tmp740, &tmp741, &tmp742, &tmp743, &tmp744, &tmp745, &tmp746, &tmp747, &tmp748, &tmp749, &tmp750, &tmp751, &tmp752, &tmp753);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block48, tmp720, tmp721, tmp722, tmp723, tmp724, tmp725, tmp726, tmp727, tmp728, tmp729, tmp730, tmp731, tmp732, tmp733, tmp734, tmp735, tmp736, tmp737, tmp738, tmp739, tmp740, tmp741, tmp742, tmp743, tmp744, tmp745, tmp746, tmp747, tmp748);
+  }
+
+  if (block49.is_used()) {
+    TNode<Context> tmp754;
+    TNode<JSArray> tmp755;
+    TNode<Smi> tmp756;
+    TNode<JSReceiver> tmp757;
+    TNode<Object> tmp758;
+    TNode<Smi> tmp759;
+    TNode<JSArray> tmp760;
+    TNode<JSArray> tmp761;
+    TNode<Map> tmp762;
+    TNode<BoolT> tmp763;
+    TNode<FixedArray> tmp764;
+    TNode<BoolT> tmp765;
+    TNode<BoolT> tmp766;
+    TNode<BoolT> tmp767;
+    TNode<Object> tmp768;
+    TNode<Object> tmp769;
+    TNode<Smi> tmp770;
+    TNode<Object> tmp771;
+    TNode<Context> tmp772;
+    TNode<Smi> tmp773;
+    TNode<Object> tmp774;
+    TNode<Object> tmp775;
+    TNode<HeapNumber> tmp776;
+    TNode<FixedArray> tmp777;
+    TNode<IntPtrT> tmp778;
+    TNode<IntPtrT> tmp779;
+    TNode<Smi> tmp780;
+    TNode<Smi> tmp781;
+    TNode<IntPtrT> tmp782;
+    TNode<HeapObject> tmp783;
+    TNode<IntPtrT> tmp784;
+    TNode<IntPtrT> tmp785;
+    TNode<IntPtrT> tmp786;
+    TNode<IntPtrT> tmp787;
+    TNode<HeapObject> tmp788;
+    TNode<IntPtrT> tmp789;
+    ca_.Bind(&block49, &tmp754, &tmp755, &tmp756, &tmp757, &tmp758, &tmp759, &tmp760, &tmp761, &tmp762, &tmp763, &tmp764, &tmp765, &tmp766, &tmp767, &tmp768, &tmp769, &tmp770, &tmp771, &tmp772, &tmp773, &tmp774, &tmp775, &tmp776, &tmp777, &tmp778, &tmp779, &tmp780, &tmp781, &tmp782, &tmp783, &tmp784, &tmp785, &tmp786, &tmp787, &tmp788, &tmp789);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 56);
+    ca_.Goto(&block47, tmp754, tmp755, tmp756, tmp757, tmp758, tmp759, tmp760, tmp761, tmp762, tmp763, tmp764, tmp765, tmp766, tmp767, tmp768, tmp769, tmp770, tmp771, tmp772, tmp773, tmp774, tmp775, tmp776, tmp777, tmp778, tmp779, tmp780, tmp781, tmp782, tmp788, tmp789);
+  }
+
+  if (block48.is_used()) {
+    TNode<Context> tmp790;
+    TNode<JSArray> tmp791;
+    TNode<Smi> tmp792;
+    TNode<JSReceiver> tmp793;
+    TNode<Object> tmp794;
+    TNode<Smi> tmp795;
+    TNode<JSArray> tmp796;
+    TNode<JSArray> tmp797;
+    TNode<Map> tmp798;
+    TNode<BoolT> tmp799;
+    TNode<FixedArray> tmp800;
+    TNode<BoolT> tmp801;
+    TNode<BoolT> tmp802;
+    TNode<BoolT> tmp803;
+    TNode<Object> tmp804;
+    TNode<Object> tmp805;
+    TNode<Smi> tmp806;
+    TNode<Object> tmp807;
+    TNode<Context> tmp808;
+    TNode<Smi> tmp809;
+    TNode<Object> tmp810;
+    TNode<Object> tmp811;
+    TNode<HeapNumber> tmp812;
+    TNode<FixedArray> tmp813;
+    TNode<IntPtrT> tmp814;
+    TNode<IntPtrT> tmp815;
+    TNode<Smi> tmp816;
+    TNode<Smi> tmp817;
+    TNode<IntPtrT> tmp818;
+    ca_.Bind(&block48, &tmp790, &tmp791, &tmp792, &tmp793, &tmp794, &tmp795, &tmp796, &tmp797, &tmp798, &tmp799, &tmp800, &tmp801, &tmp802, &tmp803, &tmp804, &tmp805, &tmp806, &tmp807, &tmp808, &tmp809, &tmp810, &tmp811, &tmp812, &tmp813, &tmp814, &tmp815, &tmp816, &tmp817, &tmp818);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block47.is_used()) {
+    TNode<Context> tmp819;
+    TNode<JSArray> tmp820;
+    TNode<Smi> tmp821;
+    TNode<JSReceiver> tmp822;
+    TNode<Object> tmp823;
+    TNode<Smi> tmp824;
+    TNode<JSArray> tmp825;
+    TNode<JSArray> tmp826;
+    TNode<Map> tmp827;
+    TNode<BoolT> tmp828;
+    TNode<FixedArray> tmp829;
+    TNode<BoolT> tmp830;
+    TNode<BoolT> tmp831;
+    TNode<BoolT> tmp832;
+    TNode<Object> tmp833;
+    TNode<Object> tmp834;
+    TNode<Smi> tmp835;
+    TNode<Object> tmp836;
+    TNode<Context> tmp837;
+    TNode<Smi> tmp838;
+    TNode<Object> tmp839;
+    TNode<Object> tmp840;
+    TNode<HeapNumber> tmp841;
+    TNode<FixedArray> tmp842;
+    TNode<IntPtrT> tmp843;
+    TNode<IntPtrT> tmp844;
+    TNode<Smi> tmp845;
+    TNode<Smi> tmp846;
+    TNode<IntPtrT> tmp847;
+    TNode<HeapObject> tmp848;
+    TNode<IntPtrT> tmp849;
+    ca_.Bind(&block47, &tmp819, &tmp820, &tmp821, &tmp822, &tmp823, &tmp824, &tmp825, &tmp826, &tmp827, &tmp828, &tmp829, &tmp830, &tmp831, &tmp832, &tmp833, &tmp834, &tmp835, &tmp836, &tmp837, &tmp838, &tmp839, &tmp840, &tmp841, &tmp842, &tmp843, &tmp844, &tmp845, &tmp846, &tmp847, &tmp848, &tmp849);
+    ca_.Goto(&block46, tmp819, tmp820, tmp821, tmp822, tmp823, tmp824, tmp825, tmp826, tmp827, tmp828, tmp829, tmp830, tmp831, tmp832, tmp833, tmp834, tmp835, tmp836, tmp837, tmp838, tmp839, tmp840, tmp841, tmp842, tmp843, tmp844, tmp845, tmp846, tmp848, tmp849);
+  }
+
+  if (block46.is_used()) {
+    TNode<Context> tmp850;
+    TNode<JSArray> tmp851;
+    TNode<Smi> tmp852;
+    TNode<JSReceiver> tmp853;
+    TNode<Object> tmp854;
+    TNode<Smi> tmp855;
+    TNode<JSArray> tmp856;
+    TNode<JSArray> tmp857;
+    TNode<Map> tmp858;
+    TNode<BoolT> tmp859;
+    TNode<FixedArray> tmp860;
+    TNode<BoolT> tmp861;
+    TNode<BoolT> tmp862;
+    TNode<BoolT> tmp863;
+    TNode<Object> tmp864;
+    TNode<Object> tmp865;
+    TNode<Smi> tmp866;
+    TNode<Object> tmp867;
+    TNode<Context> tmp868;
+    TNode<Smi> tmp869;
+    TNode<Object> tmp870;
+    TNode<Object> tmp871;
+    TNode<HeapNumber> tmp872;
+    TNode<FixedArray> tmp873;
+    TNode<IntPtrT> tmp874;
+    TNode<IntPtrT> tmp875;
+    TNode<Smi> tmp876;
+    TNode<Smi> tmp877;
+    TNode<HeapObject> tmp878;
+    TNode<IntPtrT> tmp879;
+    ca_.Bind(&block46, &tmp850, &tmp851, &tmp852, &tmp853, &tmp854, &tmp855, &tmp856, &tmp857, &tmp858, &tmp859, &tmp860, &tmp861, &tmp862, &tmp863, &tmp864, &tmp865, &tmp866, &tmp867, &tmp868, &tmp869, &tmp870, &tmp871, &tmp872, &tmp873, &tmp874, &tmp875, &tmp876, &tmp877, &tmp878, &tmp879);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 157);
+    CodeStubAssembler(state_).StoreReference(CodeStubAssembler::Reference{tmp878, tmp879}, tmp872);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 155);
+    ca_.Goto(&block42, tmp850, tmp851, tmp852, tmp853, tmp854, tmp855, tmp856, tmp857, tmp858, tmp859, tmp860, tmp861, tmp862, tmp863, tmp864, tmp865, tmp866, tmp867, tmp868, tmp869, tmp870, tmp871);
+  }
+
+  if (block43.is_used()) {
+    TNode<Context> tmp880;
+    TNode<JSArray> tmp881;
+    TNode<Smi> tmp882;
+    TNode<JSReceiver> tmp883;
+    TNode<Object> tmp884;
+    TNode<Smi> tmp885;
+    TNode<JSArray> tmp886;
+    TNode<JSArray> tmp887;
+    TNode<Map> tmp888;
+    TNode<BoolT> tmp889;
+    TNode<FixedArray> tmp890;
+    TNode<BoolT> tmp891;
+    TNode<BoolT> tmp892;
+    TNode<BoolT> tmp893;
+    TNode<Object> tmp894;
+    TNode<Object> tmp895;
+    TNode<Smi> tmp896;
+    TNode<Object> tmp897;
+    TNode<Context> tmp898;
+    TNode<Smi> tmp899;
+    TNode<Object> tmp900;
+    TNode<Object> tmp901;
+    ca_.Bind(&block43, &tmp880, &tmp881, &tmp882, &tmp883, &tmp884, &tmp885, &tmp886, &tmp887, &tmp888, &tmp889, &tmp890, &tmp891, &tmp892, &tmp893, &tmp894, &tmp895, &tmp896, &tmp897, &tmp898, &tmp899, &tmp900, &tmp901);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 159);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 160);
+    TNode<BoolT> tmp902;
+    USE(tmp902);
+    tmp902 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, false);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 161);
+    TNode<BoolT> tmp903;
+    USE(tmp903);
+    tmp903 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, false);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 162);
+    TNode<IntPtrT> tmp904 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp904);
+    TNode<IntPtrT> tmp905 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp905);
+    TNode<Smi>tmp906 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp890, tmp905});
+    TNode<IntPtrT> tmp907;
+    USE(tmp907);
+    tmp907 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp906});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 55);
+    TNode<IntPtrT> tmp908;
+    USE(tmp908);
+    tmp908 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp899});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 56);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp909;
+    USE(tmp909);
+    tmp909 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp908});
+    TNode<UintPtrT> tmp910;
+    USE(tmp910);
+    tmp910 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp907});
+    TNode<BoolT> tmp911;
+    USE(tmp911);
+    tmp911 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp909}, TNode<UintPtrT>{tmp910});
+    ca_.Branch(tmp911, &block57, &block58, tmp880, tmp881, tmp882, tmp883, tmp884, tmp885, tmp886, tmp887, tmp888, tmp889, tmp890, tmp902, tmp903, tmp893, tmp894, tmp895, tmp896, tmp897, tmp898, tmp899, tmp900, tmp901, ca_.UncheckedCast<HeapObject>(tmp901), tmp890, tmp904, tmp907, tmp899, tmp899, tmp908, tmp890, tmp904, tmp907, tmp908, tmp908);
+  }
+
+  if (block57.is_used()) {
+    TNode<Context> tmp912;
+    TNode<JSArray> tmp913;
+    TNode<Smi> tmp914;
+    TNode<JSReceiver> tmp915;
+    TNode<Object> tmp916;
+    TNode<Smi> tmp917;
+    TNode<JSArray> tmp918;
+    TNode<JSArray> tmp919;
+    TNode<Map> tmp920;
+    TNode<BoolT> tmp921;
+    TNode<FixedArray> tmp922;
+    TNode<BoolT> tmp923;
+    TNode<BoolT> tmp924;
+    TNode<BoolT> tmp925;
+    TNode<Object> tmp926;
+    TNode<Object> tmp927;
+    TNode<Smi> tmp928;
+    TNode<Object> tmp929;
+    TNode<Context> tmp930;
+    TNode<Smi> tmp931;
+    TNode<Object> tmp932;
+    TNode<Object> tmp933;
+    TNode<HeapObject> tmp934;
+    TNode<FixedArray> tmp935;
+    TNode<IntPtrT> tmp936;
+    TNode<IntPtrT> tmp937;
+    TNode<Smi> tmp938;
+    TNode<Smi> tmp939;
+    TNode<IntPtrT> tmp940;
+    TNode<HeapObject> tmp941;
+    TNode<IntPtrT> tmp942;
+    TNode<IntPtrT> tmp943;
+    TNode<IntPtrT> tmp944;
+    TNode<IntPtrT> tmp945;
+    ca_.Bind(&block57, &tmp912, &tmp913, &tmp914, &tmp915, &tmp916, &tmp917, &tmp918, &tmp919, &tmp920, &tmp921, &tmp922, &tmp923, &tmp924, &tmp925, &tmp926, &tmp927, &tmp928, &tmp929, &tmp930, &tmp931, &tmp932, &tmp933, &tmp934, &tmp935, &tmp936, &tmp937, &tmp938, &tmp939, &tmp940, &tmp941, &tmp942, &tmp943, &tmp944, &tmp945);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp946;
+    USE(tmp946);
+    tmp946 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp947;
+    USE(tmp947);
+    tmp947 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp945}, TNode<IntPtrT>{tmp946});
+    TNode<IntPtrT> tmp948;
+    USE(tmp948);
+    tmp948 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp942}, TNode<IntPtrT>{tmp947});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp949;
+    USE(tmp949);
+    TNode<IntPtrT> tmp950;
+    USE(tmp950);
+    std::tie(tmp949, tmp950) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp941}, TNode<IntPtrT>{tmp948}).Flatten();
+    ca_.Goto(&block56, tmp912, tmp913, tmp914, tmp915, tmp916, tmp917, tmp918, tmp919, tmp920, tmp921, tmp922, tmp923, tmp924, tmp925, tmp926, tmp927, tmp928, tmp929, tmp930, tmp931, tmp932, tmp933, tmp934, tmp935, tmp936, tmp937, tmp938, tmp939, tmp940, tmp941, tmp942, tmp943, tmp944, tmp945, tmp949, tmp950);
+  }
+
+  if (block58.is_used()) {
+    TNode<Context> tmp951;
+    TNode<JSArray> tmp952;
+    TNode<Smi> tmp953;
+    TNode<JSReceiver> tmp954;
+    TNode<Object> tmp955;
+    TNode<Smi> tmp956;
+    TNode<JSArray> tmp957;
+    TNode<JSArray> tmp958;
+    TNode<Map> tmp959;
+    TNode<BoolT> tmp960;
+    TNode<FixedArray> tmp961;
+    TNode<BoolT> tmp962;
+    TNode<BoolT> tmp963;
+    TNode<BoolT> tmp964;
+    TNode<Object> tmp965;
+    TNode<Object> tmp966;
+    TNode<Smi> tmp967;
+    TNode<Object> tmp968;
+    TNode<Context> tmp969;
+    TNode<Smi> tmp970;
+    TNode<Object> tmp971;
+    TNode<Object> tmp972;
+    TNode<HeapObject> tmp973;
+    TNode<FixedArray> tmp974;
+    TNode<IntPtrT> tmp975;
+    TNode<IntPtrT> tmp976;
+    TNode<Smi> tmp977;
+    TNode<Smi> tmp978;
+    TNode<IntPtrT> tmp979;
+    TNode<HeapObject> tmp980;
+    TNode<IntPtrT> tmp981;
+    TNode<IntPtrT> tmp982;
+    TNode<IntPtrT> tmp983;
+    TNode<IntPtrT> tmp984;
+    ca_.Bind(&block58, &tmp951, &tmp952, &tmp953, &tmp954, &tmp955, &tmp956, &tmp957, &tmp958, &tmp959, &tmp960, &tmp961, &tmp962, &tmp963, &tmp964, &tmp965, &tmp966, &tmp967, &tmp968, &tmp969, &tmp970, &tmp971, &tmp972, &tmp973, &tmp974, &tmp975, &tmp976, &tmp977, &tmp978, &tmp979, &tmp980, &tmp981, &tmp982, &tmp983, &tmp984);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block55, tmp951, tmp952, tmp953, tmp954, tmp955, tmp956, tmp957, tmp958, tmp959, tmp960, tmp961, tmp962, tmp963, tmp964, tmp965, tmp966, tmp967, tmp968, tmp969, tmp970, tmp971, tmp972, tmp973, tmp974, tmp975, tmp976, tmp977, tmp978, tmp979);
+  }
+
+  if (block56.is_used()) {
+    TNode<Context> tmp985;
+    TNode<JSArray> tmp986;
+    TNode<Smi> tmp987;
+    TNode<JSReceiver> tmp988;
+    TNode<Object> tmp989;
+    TNode<Smi> tmp990;
+    TNode<JSArray> tmp991;
+    TNode<JSArray> tmp992;
+    TNode<Map> tmp993;
+    TNode<BoolT> tmp994;
+    TNode<FixedArray> tmp995;
+    TNode<BoolT> tmp996;
+    TNode<BoolT> tmp997;
+    TNode<BoolT> tmp998;
+    TNode<Object> tmp999;
+    TNode<Object> tmp1000;
+    TNode<Smi> tmp1001;
+    TNode<Object> tmp1002;
+    TNode<Context> tmp1003;
+    TNode<Smi> tmp1004;
+    TNode<Object> tmp1005;
+    TNode<Object> tmp1006;
+    TNode<HeapObject> tmp1007;
+    TNode<FixedArray> tmp1008;
+    TNode<IntPtrT> tmp1009;
+    TNode<IntPtrT> tmp1010;
+    TNode<Smi> tmp1011;
+    TNode<Smi> tmp1012;
+    TNode<IntPtrT> tmp1013;
+    TNode<HeapObject> tmp1014;
+    TNode<IntPtrT> tmp1015;
+    TNode<IntPtrT> tmp1016;
+    TNode<IntPtrT> tmp1017;
+    TNode<IntPtrT> tmp1018;
+    TNode<HeapObject> tmp1019;
+    TNode<IntPtrT> tmp1020;
+    ca_.Bind(&block56, &tmp985, &tmp986, &tmp987, &tmp988, &tmp989, &tmp990, &tmp991, &tmp992, &tmp993, &tmp994, &tmp995, &tmp996, &tmp997, &tmp998, &tmp999, &tmp1000, &tmp1001, &tmp1002, &tmp1003, &tmp1004, &tmp1005, &tmp1006, &tmp1007, &tmp1008, &tmp1009, &tmp1010, &tmp1011, &tmp1012, &tmp1013, &tmp1014, &tmp1015, &tmp1016, &tmp1017, &tmp1018, &tmp1019, &tmp1020);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 56);
+    ca_.Goto(&block54, tmp985, tmp986, tmp987, tmp988, tmp989, tmp990, tmp991, tmp992, tmp993, tmp994, tmp995, tmp996, tmp997, tmp998, tmp999, tmp1000, tmp1001, tmp1002, tmp1003, tmp1004, tmp1005, tmp1006, tmp1007, tmp1008, tmp1009, tmp1010, tmp1011, tmp1012, tmp1013, tmp1019, tmp1020);
+  }
+
+  if (block55.is_used()) {
+    TNode<Context> tmp1021;
+    TNode<JSArray> tmp1022;
+    TNode<Smi> tmp1023;
+    TNode<JSReceiver> tmp1024;
+    TNode<Object> tmp1025;
+    TNode<Smi> tmp1026;
+    TNode<JSArray> tmp1027;
+    TNode<JSArray> tmp1028;
+    TNode<Map> tmp1029;
+    TNode<BoolT> tmp1030;
+    TNode<FixedArray> tmp1031;
+    TNode<BoolT> tmp1032;
+    TNode<BoolT> tmp1033;
+    TNode<BoolT> tmp1034;
+    TNode<Object> tmp1035;
+    TNode<Object> tmp1036;
+    TNode<Smi> tmp1037;
+    TNode<Object> tmp1038;
+    TNode<Context> tmp1039;
+    TNode<Smi> tmp1040;
+    TNode<Object> tmp1041;
+    TNode<Object> tmp1042;
+    TNode<HeapObject> tmp1043;
+    TNode<FixedArray> tmp1044;
+    TNode<IntPtrT> tmp1045;
+    TNode<IntPtrT> tmp1046;
+    TNode<Smi> tmp1047;
+    TNode<Smi> tmp1048;
+    TNode<IntPtrT> tmp1049;
+    ca_.Bind(&block55, &tmp1021, &tmp1022, &tmp1023, &tmp1024, &tmp1025, &tmp1026, &tmp1027, &tmp1028, &tmp1029, &tmp1030, &tmp1031, &tmp1032, &tmp1033, &tmp1034, &tmp1035, &tmp1036, &tmp1037, &tmp1038, &tmp1039, &tmp1040, &tmp1041, &tmp1042, &tmp1043, &tmp1044, &tmp1045, &tmp1046, &tmp1047, &tmp1048, &tmp1049);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block54.is_used()) {
+    TNode<Context> tmp1050;
+    TNode<JSArray> tmp1051;
+    TNode<Smi> tmp1052;
+    TNode<JSReceiver> tmp1053;
+    TNode<Object> tmp1054;
+    TNode<Smi> tmp1055;
+    TNode<JSArray> tmp1056;
+    TNode<JSArray> tmp1057;
+    TNode<Map> tmp1058;
+    TNode<BoolT> tmp1059;
+    TNode<FixedArray> tmp1060;
+    TNode<BoolT> tmp1061;
+    TNode<BoolT> tmp1062;
+    TNode<BoolT> tmp1063;
+    TNode<Object> tmp1064;
+    TNode<Object> tmp1065;
+    TNode<Smi> tmp1066;
+    TNode<Object> tmp1067;
+    TNode<Context> tmp1068;
+    TNode<Smi> tmp1069;
+    TNode<Object> tmp1070;
+    TNode<Object> tmp1071;
+    TNode<HeapObject> tmp1072;
+    TNode<FixedArray> tmp1073;
+    TNode<IntPtrT> tmp1074;
+    TNode<IntPtrT> tmp1075;
+    TNode<Smi> tmp1076;
+    TNode<Smi> tmp1077;
+    TNode<IntPtrT> tmp1078;
+    TNode<HeapObject> tmp1079;
+    TNode<IntPtrT> tmp1080;
+    ca_.Bind(&block54, &tmp1050, &tmp1051, &tmp1052, &tmp1053, &tmp1054, &tmp1055, &tmp1056, &tmp1057, &tmp1058, &tmp1059, &tmp1060, &tmp1061, &tmp1062, &tmp1063, &tmp1064, &tmp1065, &tmp1066, &tmp1067, &tmp1068, &tmp1069, &tmp1070, &tmp1071, &tmp1072, &tmp1073, &tmp1074, &tmp1075, &tmp1076, &tmp1077, &tmp1078, &tmp1079, &tmp1080);
+    ca_.Goto(&block53, tmp1050, tmp1051, tmp1052, tmp1053, tmp1054, tmp1055, tmp1056, tmp1057, tmp1058, tmp1059, tmp1060, tmp1061, tmp1062, tmp1063, tmp1064, tmp1065, tmp1066, tmp1067, tmp1068, tmp1069, tmp1070, tmp1071, tmp1072, tmp1073, tmp1074, tmp1075, tmp1076, tmp1077, tmp1079, tmp1080);
+  }
+
+  if (block53.is_used()) {
+    TNode<Context> tmp1081;
+    TNode<JSArray> tmp1082;
+    TNode<Smi> tmp1083;
+    TNode<JSReceiver> tmp1084;
+    TNode<Object> tmp1085;
+    TNode<Smi> tmp1086;
+    TNode<JSArray> tmp1087;
+    TNode<JSArray> tmp1088;
+    TNode<Map> tmp1089;
+    TNode<BoolT> tmp1090;
+    TNode<FixedArray> tmp1091;
+    TNode<BoolT> tmp1092;
+    TNode<BoolT> tmp1093;
+    TNode<BoolT> tmp1094;
+    TNode<Object> tmp1095;
+    TNode<Object> tmp1096;
+    TNode<Smi> tmp1097;
+    TNode<Object> tmp1098;
+    TNode<Context> tmp1099;
+    TNode<Smi> tmp1100;
+    TNode<Object> tmp1101;
+    TNode<Object> tmp1102;
+    TNode<HeapObject> tmp1103;
+    TNode<FixedArray> tmp1104;
+    TNode<IntPtrT> tmp1105;
+    TNode<IntPtrT> tmp1106;
+    TNode<Smi> tmp1107;
+    TNode<Smi> tmp1108;
+    TNode<HeapObject> tmp1109;
+    TNode<IntPtrT> tmp1110;
+    ca_.Bind(&block53, &tmp1081, &tmp1082, &tmp1083, &tmp1084, &tmp1085, &tmp1086, &tmp1087, &tmp1088, &tmp1089, &tmp1090, &tmp1091, &tmp1092, &tmp1093, &tmp1094, &tmp1095, &tmp1096, &tmp1097, &tmp1098, &tmp1099, &tmp1100, &tmp1101, &tmp1102, &tmp1103, &tmp1104, &tmp1105, &tmp1106, &tmp1107, &tmp1108, &tmp1109, &tmp1110);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 162);
+    CodeStubAssembler(state_).StoreReference(CodeStubAssembler::Reference{tmp1109, tmp1110}, tmp1103);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 155);
+    ca_.Goto(&block42, tmp1081, tmp1082, tmp1083, tmp1084, tmp1085, tmp1086, tmp1087, tmp1088, tmp1089, tmp1090, tmp1091, tmp1092, tmp1093, tmp1094, tmp1095, tmp1096, tmp1097, tmp1098, tmp1099, tmp1100, tmp1101, tmp1102);
+  }
+
+  if (block42.is_used()) {
+    TNode<Context> tmp1111;
+    TNode<JSArray> tmp1112;
+    TNode<Smi> tmp1113;
+    TNode<JSReceiver> tmp1114;
+    TNode<Object> tmp1115;
+    TNode<Smi> tmp1116;
+    TNode<JSArray> tmp1117;
+    TNode<JSArray> tmp1118;
+    TNode<Map> tmp1119;
+    TNode<BoolT> tmp1120;
+    TNode<FixedArray> tmp1121;
+    TNode<BoolT> tmp1122;
+    TNode<BoolT> tmp1123;
+    TNode<BoolT> tmp1124;
+    TNode<Object> tmp1125;
+    TNode<Object> tmp1126;
+    TNode<Smi> tmp1127;
+    TNode<Object> tmp1128;
+    TNode<Context> tmp1129;
+    TNode<Smi> tmp1130;
+    TNode<Object> tmp1131;
+    TNode<Object> tmp1132;
+    ca_.Bind(&block42, &tmp1111, &tmp1112, &tmp1113, &tmp1114, &tmp1115, &tmp1116, &tmp1117, &tmp1118, &tmp1119, &tmp1120, &tmp1121, &tmp1122, &tmp1123, &tmp1124, &tmp1125, &tmp1126, &tmp1127, &tmp1128, &tmp1129, &tmp1130, &tmp1131, &tmp1132);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 152);
+    ca_.Goto(&block31, tmp1111, tmp1112, tmp1113, tmp1114, tmp1115, tmp1116, tmp1117, tmp1118, tmp1119, tmp1120, tmp1121, tmp1122, tmp1123, tmp1124, tmp1125, tmp1126, tmp1127, tmp1128, tmp1129, tmp1130, tmp1131, tmp1132);
+  }
+
+  if (block31.is_used()) {
+    TNode<Context> tmp1133;
+    TNode<JSArray> tmp1134;
+    TNode<Smi> tmp1135;
+    TNode<JSReceiver> tmp1136;
+    TNode<Object> tmp1137;
+    TNode<Smi> tmp1138;
+    TNode<JSArray> tmp1139;
+    TNode<JSArray> tmp1140;
+    TNode<Map> tmp1141;
+    TNode<BoolT> tmp1142;
+    TNode<FixedArray> tmp1143;
+    TNode<BoolT> tmp1144;
+    TNode<BoolT> tmp1145;
+    TNode<BoolT> tmp1146;
+    TNode<Object> tmp1147;
+    TNode<Object> tmp1148;
+    TNode<Smi> tmp1149;
+    TNode<Object> tmp1150;
+    TNode<Context> tmp1151;
+    TNode<Smi> tmp1152;
+    TNode<Object> tmp1153;
+    TNode<Object> tmp1154;
+    ca_.Bind(&block31, &tmp1133, &tmp1134, &tmp1135, &tmp1136, &tmp1137, &tmp1138, &tmp1139, &tmp1140, &tmp1141, &tmp1142, &tmp1143, &tmp1144, &tmp1145, &tmp1146, &tmp1147, &tmp1148, &tmp1149, &tmp1150, &tmp1151, &tmp1152, &tmp1153, &tmp1154);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 151);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 208);
+    ca_.Goto(&block30, tmp1133, tmp1134, tmp1135, tmp1136, tmp1137, tmp1138, tmp1139, tmp1140, tmp1141, tmp1142, tmp1143, tmp1144, tmp1145, tmp1146, tmp1147, tmp1148, tmp1149, tmp1150, tmp1151, tmp1152, tmp1153);
+  }
+
+  if (block30.is_used()) {
+    TNode<Context> tmp1155;
+    TNode<JSArray> tmp1156;
+    TNode<Smi> tmp1157;
+    TNode<JSReceiver> tmp1158;
+    TNode<Object> tmp1159;
+    TNode<Smi> tmp1160;
+    TNode<JSArray> tmp1161;
+    TNode<JSArray> tmp1162;
+    TNode<Map> tmp1163;
+    TNode<BoolT> tmp1164;
+    TNode<FixedArray> tmp1165;
+    TNode<BoolT> tmp1166;
+    TNode<BoolT> tmp1167;
+    TNode<BoolT> tmp1168;
+    TNode<Object> tmp1169;
+    TNode<Object> tmp1170;
+    TNode<Smi> tmp1171;
+    TNode<Object> tmp1172;
+    TNode<Context> tmp1173;
+    TNode<Smi> tmp1174;
+    TNode<Object> tmp1175;
+    ca_.Bind(&block30, &tmp1155, &tmp1156, &tmp1157, &tmp1158, &tmp1159, &tmp1160, &tmp1161, &tmp1162, &tmp1163, &tmp1164, &tmp1165, &tmp1166, &tmp1167, &tmp1168, &tmp1169, &tmp1170, &tmp1171, &tmp1172, &tmp1173, &tmp1174, &tmp1175);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 203);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 210);
+    ca_.Goto(&block19, tmp1155, tmp1156, tmp1157, tmp1158, tmp1159, tmp1160, tmp1161, tmp1162, tmp1163, tmp1164, tmp1165, tmp1166, tmp1167, tmp1168);
+  }
+
+  if (block20.is_used()) {
+    TNode<Context> tmp1176;
+    TNode<JSArray> tmp1177;
+    TNode<Smi> tmp1178;
+    TNode<JSReceiver> tmp1179;
+    TNode<Object> tmp1180;
+    TNode<Smi> tmp1181;
+    TNode<JSArray> tmp1182;
+    TNode<JSArray> tmp1183;
+    TNode<Map> tmp1184;
+    TNode<BoolT> tmp1185;
+    TNode<FixedArray> tmp1186;
+    TNode<BoolT> tmp1187;
+    TNode<BoolT> tmp1188;
+    TNode<BoolT> tmp1189;
+    ca_.Bind(&block20, &tmp1176, &tmp1177, &tmp1178, &tmp1179, &tmp1180, &tmp1181, &tmp1182, &tmp1183, &tmp1184, &tmp1185, &tmp1186, &tmp1187, &tmp1188, &tmp1189);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 95);
+    TNode<BoolT> tmp1190;
+    USE(tmp1190);
+    tmp1190 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, true);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 213);
+    ca_.Goto(&block60, tmp1176, tmp1177, tmp1178, tmp1179, tmp1180, tmp1181, tmp1182, tmp1183, tmp1184, tmp1185, tmp1186, tmp1187, tmp1188, tmp1190);
+  }
+
+  if (block60.is_used()) {
+    TNode<Context> tmp1191;
+    TNode<JSArray> tmp1192;
+    TNode<Smi> tmp1193;
+    TNode<JSReceiver> tmp1194;
+    TNode<Object> tmp1195;
+    TNode<Smi> tmp1196;
+    TNode<JSArray> tmp1197;
+    TNode<JSArray> tmp1198;
+    TNode<Map> tmp1199;
+    TNode<BoolT> tmp1200;
+    TNode<FixedArray> tmp1201;
+    TNode<BoolT> tmp1202;
+    TNode<BoolT> tmp1203;
+    TNode<BoolT> tmp1204;
+    ca_.Bind(&block60, &tmp1191, &tmp1192, &tmp1193, &tmp1194, &tmp1195, &tmp1196, &tmp1197, &tmp1198, &tmp1199, &tmp1200, &tmp1201, &tmp1202, &tmp1203, &tmp1204);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 203);
+    ca_.Goto(&block19, tmp1191, tmp1192, tmp1193, tmp1194, tmp1195, tmp1196, tmp1197, tmp1198, tmp1199, tmp1200, tmp1201, tmp1202, tmp1203, tmp1204);
+  }
+
+  if (block19.is_used()) {
+    TNode<Context> tmp1205;
+    TNode<JSArray> tmp1206;
+    TNode<Smi> tmp1207;
+    TNode<JSReceiver> tmp1208;
+    TNode<Object> tmp1209;
+    TNode<Smi> tmp1210;
+    TNode<JSArray> tmp1211;
+    TNode<JSArray> tmp1212;
+    TNode<Map> tmp1213;
+    TNode<BoolT> tmp1214;
+    TNode<FixedArray> tmp1215;
+    TNode<BoolT> tmp1216;
+    TNode<BoolT> tmp1217;
+    TNode<BoolT> tmp1218;
+    ca_.Bind(&block19, &tmp1205, &tmp1206, &tmp1207, &tmp1208, &tmp1209, &tmp1210, &tmp1211, &tmp1212, &tmp1213, &tmp1214, &tmp1215, &tmp1216, &tmp1217, &tmp1218);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 197);
+    ca_.Goto(&block8, tmp1205, tmp1206, tmp1207, tmp1208, tmp1209, tmp1210, tmp1211, tmp1212, tmp1213, tmp1214, tmp1215, tmp1216, tmp1217, tmp1218);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp1219;
+    TNode<JSArray> tmp1220;
+    TNode<Smi> tmp1221;
+    TNode<JSReceiver> tmp1222;
+    TNode<Object> tmp1223;
+    TNode<Smi> tmp1224;
+    TNode<JSArray> tmp1225;
+    TNode<JSArray> tmp1226;
+    TNode<Map> tmp1227;
+    TNode<BoolT> tmp1228;
+    TNode<FixedArray> tmp1229;
+    TNode<BoolT> tmp1230;
+    TNode<BoolT> tmp1231;
+    TNode<BoolT> tmp1232;
+    ca_.Bind(&block8, &tmp1219, &tmp1220, &tmp1221, &tmp1222, &tmp1223, &tmp1224, &tmp1225, &tmp1226, &tmp1227, &tmp1228, &tmp1229, &tmp1230, &tmp1231, &tmp1232);
+    TNode<Smi> tmp1233;
+    USE(tmp1233);
+    tmp1233 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 1);
+    TNode<Smi> tmp1234;
+    USE(tmp1234);
+    tmp1234 = CodeStubAssembler(state_).SmiAdd(TNode<Smi>{tmp1224}, TNode<Smi>{tmp1233});
+    ca_.Goto(&block7, tmp1219, tmp1220, tmp1221, tmp1222, tmp1223, tmp1234, tmp1225, tmp1226, tmp1227, tmp1228, tmp1229, tmp1230, tmp1231, tmp1232);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp1235;
+    TNode<JSArray> tmp1236;
+    TNode<Smi> tmp1237;
+    TNode<JSReceiver> tmp1238;
+    TNode<Object> tmp1239;
+    TNode<Smi> tmp1240;
+    TNode<JSArray> tmp1241;
+    TNode<JSArray> tmp1242;
+    TNode<Map> tmp1243;
+    TNode<BoolT> tmp1244;
+    TNode<FixedArray> tmp1245;
+    TNode<BoolT> tmp1246;
+    TNode<BoolT> tmp1247;
+    TNode<BoolT> tmp1248;
+    ca_.Bind(&block6, &tmp1235, &tmp1236, &tmp1237, &tmp1238, &tmp1239, &tmp1240, &tmp1241, &tmp1242, &tmp1243, &tmp1244, &tmp1245, &tmp1246, &tmp1247, &tmp1248);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 217);
+    ca_.Goto(&block3, tmp1235, tmp1236, tmp1237, tmp1238, tmp1239, tmp1240, tmp1241, tmp1242, tmp1243, tmp1244, tmp1245, tmp1246, tmp1247, tmp1248);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp1249;
+    TNode<JSArray> tmp1250;
+    TNode<Smi> tmp1251;
+    TNode<JSReceiver> tmp1252;
+    TNode<Object> tmp1253;
+    TNode<Smi> tmp1254;
+    TNode<JSArray> tmp1255;
+    TNode<JSArray> tmp1256;
+    TNode<Map> tmp1257;
+    TNode<BoolT> tmp1258;
+    TNode<FixedArray> tmp1259;
+    TNode<BoolT> tmp1260;
+    TNode<BoolT> tmp1261;
+    TNode<BoolT> tmp1262;
+    TNode<Smi> tmp1263;
+    ca_.Bind(&block4, &tmp1249, &tmp1250, &tmp1251, &tmp1252, &tmp1253, &tmp1254, &tmp1255, &tmp1256, &tmp1257, &tmp1258, &tmp1259, &tmp1260, &tmp1261, &tmp1262, &tmp1263);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 219);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 99);
+    TNode<IntPtrT> tmp1264 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp1264);
+    TNode<Smi>tmp1265 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp1259, tmp1264});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 100);
+    ca_.Goto(&block63, tmp1249, tmp1250, tmp1251, tmp1252, tmp1253, tmp1254, tmp1255, tmp1256, tmp1257, tmp1258, tmp1259, tmp1260, tmp1261, tmp1262, tmp1263, tmp1263, tmp1249, tmp1263, tmp1265);
+  }
+
+  if (block62.is_used()) {
+    TNode<Context> tmp1266;
+    TNode<JSArray> tmp1267;
+    TNode<Smi> tmp1268;
+    TNode<JSReceiver> tmp1269;
+    TNode<Object> tmp1270;
+    TNode<Smi> tmp1271;
+    TNode<JSArray> tmp1272;
+    TNode<JSArray> tmp1273;
+    TNode<Map> tmp1274;
+    TNode<BoolT> tmp1275;
+    TNode<FixedArray> tmp1276;
+    TNode<BoolT> tmp1277;
+    TNode<BoolT> tmp1278;
+    TNode<BoolT> tmp1279;
+    TNode<Smi> tmp1280;
+    TNode<Smi> tmp1281;
+    TNode<Context> tmp1282;
+    TNode<Smi> tmp1283;
+    TNode<Smi> tmp1284;
+    ca_.Bind(&block62, &tmp1266, &tmp1267, &tmp1268, &tmp1269, &tmp1270, &tmp1271, &tmp1272, &tmp1273, &tmp1274, &tmp1275, &tmp1276, &tmp1277, &tmp1278, &tmp1279, &tmp1280, &tmp1281, &tmp1282, &tmp1283, &tmp1284);
+    TNode<BoolT> tmp1285;
+    USE(tmp1285);
+    tmp1285 = CodeStubAssembler(state_).SmiLessThanOrEqual(TNode<Smi>{tmp1283}, TNode<Smi>{tmp1284});
+    ca_.Branch(tmp1285, &block64, &block65, tmp1266, tmp1267, tmp1268, tmp1269, tmp1270, tmp1271, tmp1272, tmp1273, tmp1274, tmp1275, tmp1276, tmp1277, tmp1278, tmp1279, tmp1280, tmp1281, tmp1282, tmp1283, tmp1284);
+  }
+
+  if (block65.is_used()) {
+    TNode<Context> tmp1286;
+    TNode<JSArray> tmp1287;
+    TNode<Smi> tmp1288;
+    TNode<JSReceiver> tmp1289;
+    TNode<Object> tmp1290;
+    TNode<Smi> tmp1291;
+    TNode<JSArray> tmp1292;
+    TNode<JSArray> tmp1293;
+    TNode<Map> tmp1294;
+    TNode<BoolT> tmp1295;
+    TNode<FixedArray> tmp1296;
+    TNode<BoolT> tmp1297;
+    TNode<BoolT> tmp1298;
+    TNode<BoolT> tmp1299;
+    TNode<Smi> tmp1300;
+    TNode<Smi> tmp1301;
+    TNode<Context> tmp1302;
+    TNode<Smi> tmp1303;
+    TNode<Smi> tmp1304;
+    ca_.Bind(&block65, &tmp1286, &tmp1287, &tmp1288, &tmp1289, &tmp1290, &tmp1291, &tmp1292, &tmp1293, &tmp1294, &tmp1295, &tmp1296, &tmp1297, &tmp1298, &tmp1299, &tmp1300, &tmp1301, &tmp1302, &tmp1303, &tmp1304);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'validLength <= length' failed", "../../deps/v8/src/builtins/array-map.tq", 100);
+  }
+
+  if (block64.is_used()) {
+    TNode<Context> tmp1305;
+    TNode<JSArray> tmp1306;
+    TNode<Smi> tmp1307;
+    TNode<JSReceiver> tmp1308;
+    TNode<Object> tmp1309;
+    TNode<Smi> tmp1310;
+    TNode<JSArray> tmp1311;
+    TNode<JSArray> tmp1312;
+    TNode<Map> tmp1313;
+    TNode<BoolT> tmp1314;
+    TNode<FixedArray> tmp1315;
+    TNode<BoolT> tmp1316;
+    TNode<BoolT> tmp1317;
+    TNode<BoolT> tmp1318;
+    TNode<Smi> tmp1319;
+    TNode<Smi> tmp1320;
+    TNode<Context> tmp1321;
+    TNode<Smi> tmp1322;
+    TNode<Smi> tmp1323;
+    ca_.Bind(&block64, &tmp1305, &tmp1306, &tmp1307, &tmp1308, &tmp1309, &tmp1310, &tmp1311, &tmp1312, &tmp1313, &tmp1314, &tmp1315, &tmp1316, &tmp1317, &tmp1318, &tmp1319, &tmp1320, &tmp1321, &tmp1322, &tmp1323);
+  }
+
+  if (block63.is_used()) {
+    TNode<Context> tmp1324;
+    TNode<JSArray> tmp1325;
+    TNode<Smi> tmp1326;
+    TNode<JSReceiver> tmp1327;
+    TNode<Object> tmp1328;
+    TNode<Smi> tmp1329;
+    TNode<JSArray> tmp1330;
+    TNode<JSArray> tmp1331;
+    TNode<Map> tmp1332;
+    TNode<BoolT> tmp1333;
+    TNode<FixedArray> tmp1334;
+    TNode<BoolT> tmp1335;
+    TNode<BoolT> tmp1336;
+    TNode<BoolT> tmp1337;
+    TNode<Smi> tmp1338;
+    TNode<Smi> tmp1339;
+    TNode<Context> tmp1340;
+    TNode<Smi> tmp1341;
+    TNode<Smi> tmp1342;
+    ca_.Bind(&block63, &tmp1324, &tmp1325, &tmp1326, &tmp1327, &tmp1328, &tmp1329, &tmp1330, &tmp1331, &tmp1332, &tmp1333, &tmp1334, &tmp1335, &tmp1336, &tmp1337, &tmp1338, &tmp1339, &tmp1340, &tmp1341, &tmp1342);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 101);
+    TNode<Int32T> tmp1343;
+    USE(tmp1343);
+    tmp1343 = FromConstexpr14ATElementsKind24ATconstexpr_ElementsKind_170(state_, PACKED_SMI_ELEMENTS);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 102);
+    TNode<BoolT> tmp1344;
+    USE(tmp1344);
+    tmp1344 = CodeStubAssembler(state_).Word32BinaryNot(TNode<BoolT>{tmp1335});
+    ca_.Branch(tmp1344, &block66, &block67, tmp1324, tmp1325, tmp1326, tmp1327, tmp1328, tmp1329, tmp1330, tmp1331, tmp1332, tmp1333, tmp1334, tmp1335, tmp1336, tmp1337, tmp1338, tmp1339, tmp1340, tmp1341, tmp1342, tmp1343);
+  }
+
+  if (block66.is_used()) {
+    TNode<Context> tmp1345;
+    TNode<JSArray> tmp1346;
+    TNode<Smi> tmp1347;
+    TNode<JSReceiver> tmp1348;
+    TNode<Object> tmp1349;
+    TNode<Smi> tmp1350;
+    TNode<JSArray> tmp1351;
+    TNode<JSArray> tmp1352;
+    TNode<Map> tmp1353;
+    TNode<BoolT> tmp1354;
+    TNode<FixedArray> tmp1355;
+    TNode<BoolT> tmp1356;
+    TNode<BoolT> tmp1357;
+    TNode<BoolT> tmp1358;
+    TNode<Smi> tmp1359;
+    TNode<Smi> tmp1360;
+    TNode<Context> tmp1361;
+    TNode<Smi> tmp1362;
+    TNode<Smi> tmp1363;
+    TNode<Int32T> tmp1364;
+    ca_.Bind(&block66, &tmp1345, &tmp1346, &tmp1347, &tmp1348, &tmp1349, &tmp1350, &tmp1351, &tmp1352, &tmp1353, &tmp1354, &tmp1355, &tmp1356, &tmp1357, &tmp1358, &tmp1359, &tmp1360, &tmp1361, &tmp1362, &tmp1363, &tmp1364);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 103);
+    ca_.Branch(tmp1357, &block68, &block69, tmp1345, tmp1346, tmp1347, tmp1348, tmp1349, tmp1350, tmp1351, tmp1352, tmp1353, tmp1354, tmp1355, tmp1356, tmp1357, tmp1358, tmp1359, tmp1360, tmp1361, tmp1362, tmp1363, tmp1364);
+  }
+
+  if (block68.is_used()) {
+    TNode<Context> tmp1365;
+    TNode<JSArray> tmp1366;
+    TNode<Smi> tmp1367;
+    TNode<JSReceiver> tmp1368;
+    TNode<Object> tmp1369;
+    TNode<Smi> tmp1370;
+    TNode<JSArray> tmp1371;
+    TNode<JSArray> tmp1372;
+    TNode<Map> tmp1373;
+    TNode<BoolT> tmp1374;
+    TNode<FixedArray> tmp1375;
+    TNode<BoolT> tmp1376;
+    TNode<BoolT> tmp1377;
+    TNode<BoolT> tmp1378;
+    TNode<Smi> tmp1379;
+    TNode<Smi> tmp1380;
+    TNode<Context> tmp1381;
+    TNode<Smi> tmp1382;
+    TNode<Smi> tmp1383;
+    TNode<Int32T> tmp1384;
+    ca_.Bind(&block68, &tmp1365, &tmp1366, &tmp1367, &tmp1368, &tmp1369, &tmp1370, &tmp1371, &tmp1372, &tmp1373, &tmp1374, &tmp1375, &tmp1376, &tmp1377, &tmp1378, &tmp1379, &tmp1380, &tmp1381, &tmp1382, &tmp1383, &tmp1384);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 104);
+    TNode<Int32T> tmp1385;
+    USE(tmp1385);
+    tmp1385 = FromConstexpr14ATElementsKind24ATconstexpr_ElementsKind_170(state_, PACKED_DOUBLE_ELEMENTS);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 103);
+    ca_.Goto(&block70, tmp1365, tmp1366, tmp1367, tmp1368, tmp1369, tmp1370, tmp1371, tmp1372, tmp1373, tmp1374, tmp1375, tmp1376, tmp1377, tmp1378, tmp1379, tmp1380, tmp1381, tmp1382, tmp1383, tmp1385);
+  }
+
+  if (block69.is_used()) {
+    TNode<Context> tmp1386;
+    TNode<JSArray> tmp1387;
+    TNode<Smi> tmp1388;
+    TNode<JSReceiver> tmp1389;
+    TNode<Object> tmp1390;
+    TNode<Smi> tmp1391;
+    TNode<JSArray> tmp1392;
+    TNode<JSArray> tmp1393;
+    TNode<Map> tmp1394;
+    TNode<BoolT> tmp1395;
+    TNode<FixedArray> tmp1396;
+    TNode<BoolT> tmp1397;
+    TNode<BoolT> tmp1398;
+    TNode<BoolT> tmp1399;
+    TNode<Smi> tmp1400;
+    TNode<Smi> tmp1401;
+    TNode<Context> tmp1402;
+    TNode<Smi> tmp1403;
+    TNode<Smi> tmp1404;
+    TNode<Int32T> tmp1405;
+    ca_.Bind(&block69, &tmp1386, &tmp1387, &tmp1388, &tmp1389, &tmp1390, &tmp1391, &tmp1392, &tmp1393, &tmp1394, &tmp1395, &tmp1396, &tmp1397, &tmp1398, &tmp1399, &tmp1400, &tmp1401, &tmp1402, &tmp1403, &tmp1404, &tmp1405);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 106);
+    TNode<Int32T> tmp1406;
+    USE(tmp1406);
+    tmp1406 = FromConstexpr14ATElementsKind24ATconstexpr_ElementsKind_170(state_, PACKED_ELEMENTS);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 103);
+    ca_.Goto(&block70, tmp1386, tmp1387, tmp1388, tmp1389, tmp1390, tmp1391, tmp1392, tmp1393, tmp1394, tmp1395, tmp1396, tmp1397, tmp1398, tmp1399, tmp1400, tmp1401, tmp1402, tmp1403, tmp1404, tmp1406);
+  }
+
+  if (block70.is_used()) {
+    TNode<Context> tmp1407;
+    TNode<JSArray> tmp1408;
+    TNode<Smi> tmp1409;
+    TNode<JSReceiver> tmp1410;
+    TNode<Object> tmp1411;
+    TNode<Smi> tmp1412;
+    TNode<JSArray> tmp1413;
+    TNode<JSArray> tmp1414;
+    TNode<Map> tmp1415;
+    TNode<BoolT> tmp1416;
+    TNode<FixedArray> tmp1417;
+    TNode<BoolT> tmp1418;
+    TNode<BoolT> tmp1419;
+    TNode<BoolT> tmp1420;
+    TNode<Smi> tmp1421;
+    TNode<Smi> tmp1422;
+    TNode<Context> tmp1423;
+    TNode<Smi> tmp1424;
+    TNode<Smi> tmp1425;
+    TNode<Int32T> tmp1426;
+    ca_.Bind(&block70, &tmp1407, &tmp1408, &tmp1409, &tmp1410, &tmp1411, &tmp1412, &tmp1413, &tmp1414, &tmp1415, &tmp1416, &tmp1417, &tmp1418, &tmp1419, &tmp1420, &tmp1421, &tmp1422, &tmp1423, &tmp1424, &tmp1425, &tmp1426);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 102);
+    ca_.Goto(&block67, tmp1407, tmp1408, tmp1409, tmp1410, tmp1411, tmp1412, tmp1413, tmp1414, tmp1415, tmp1416, tmp1417, tmp1418, tmp1419, tmp1420, tmp1421, tmp1422, tmp1423, tmp1424, tmp1425, tmp1426);
+  }
+
+  if (block67.is_used()) {
+    TNode<Context> tmp1427;
+    TNode<JSArray> tmp1428;
+    TNode<Smi> tmp1429;
+    TNode<JSReceiver> tmp1430;
+    TNode<Object> tmp1431;
+    TNode<Smi> tmp1432;
+    TNode<JSArray> tmp1433;
+    TNode<JSArray> tmp1434;
+    TNode<Map> tmp1435;
+    TNode<BoolT> tmp1436;
+    TNode<FixedArray> tmp1437;
+    TNode<BoolT> tmp1438;
+    TNode<BoolT> tmp1439;
+    TNode<BoolT> tmp1440;
+    TNode<Smi> tmp1441;
+    TNode<Smi> tmp1442;
+    TNode<Context> tmp1443;
+    TNode<Smi> tmp1444;
+    TNode<Smi> tmp1445;
+    TNode<Int32T> tmp1446;
+    ca_.Bind(&block67, &tmp1427, &tmp1428, &tmp1429, &tmp1430, &tmp1431, &tmp1432, &tmp1433, &tmp1434, &tmp1435, &tmp1436, &tmp1437, &tmp1438, &tmp1439, &tmp1440, &tmp1441, &tmp1442, &tmp1443, &tmp1444, &tmp1445, &tmp1446);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 110);
+    ca_.Branch(tmp1440, &block73, &block74, tmp1427, tmp1428, tmp1429, tmp1430, tmp1431, tmp1432, tmp1433, tmp1434, tmp1435, tmp1436, tmp1437, tmp1438, tmp1439, tmp1440, tmp1441, tmp1442, tmp1443, tmp1444, tmp1445, tmp1446, tmp1440);
+  }
+
+  if (block73.is_used()) {
+    TNode<Context> tmp1447;
+    TNode<JSArray> tmp1448;
+    TNode<Smi> tmp1449;
+    TNode<JSReceiver> tmp1450;
+    TNode<Object> tmp1451;
+    TNode<Smi> tmp1452;
+    TNode<JSArray> tmp1453;
+    TNode<JSArray> tmp1454;
+    TNode<Map> tmp1455;
+    TNode<BoolT> tmp1456;
+    TNode<FixedArray> tmp1457;
+    TNode<BoolT> tmp1458;
+    TNode<BoolT> tmp1459;
+    TNode<BoolT> tmp1460;
+    TNode<Smi> tmp1461;
+    TNode<Smi> tmp1462;
+    TNode<Context> tmp1463;
+    TNode<Smi> tmp1464;
+    TNode<Smi> tmp1465;
+    TNode<Int32T> tmp1466;
+    TNode<BoolT> tmp1467;
+    ca_.Bind(&block73, &tmp1447, &tmp1448, &tmp1449, &tmp1450, &tmp1451, &tmp1452, &tmp1453, &tmp1454, &tmp1455, &tmp1456, &tmp1457, &tmp1458, &tmp1459, &tmp1460, &tmp1461, &tmp1462, &tmp1463, &tmp1464, &tmp1465, &tmp1466, &tmp1467);
+    TNode<BoolT> tmp1468;
+    USE(tmp1468);
+    tmp1468 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, true);
+    ca_.Goto(&block75, tmp1447, tmp1448, tmp1449, tmp1450, tmp1451, tmp1452, tmp1453, tmp1454, tmp1455, tmp1456, tmp1457, tmp1458, tmp1459, tmp1460, tmp1461, tmp1462, tmp1463, tmp1464, tmp1465, tmp1466, tmp1467, tmp1468);
+  }
+
+  if (block74.is_used()) {
+    TNode<Context> tmp1469;
+    TNode<JSArray> tmp1470;
+    TNode<Smi> tmp1471;
+    TNode<JSReceiver> tmp1472;
+    TNode<Object> tmp1473;
+    TNode<Smi> tmp1474;
+    TNode<JSArray> tmp1475;
+    TNode<JSArray> tmp1476;
+    TNode<Map> tmp1477;
+    TNode<BoolT> tmp1478;
+    TNode<FixedArray> tmp1479;
+    TNode<BoolT> tmp1480;
+    TNode<BoolT> tmp1481;
+    TNode<BoolT> tmp1482;
+    TNode<Smi> tmp1483;
+    TNode<Smi> tmp1484;
+    TNode<Context> tmp1485;
+    TNode<Smi> tmp1486;
+    TNode<Smi> tmp1487;
+    TNode<Int32T> tmp1488;
+    TNode<BoolT> tmp1489;
+    ca_.Bind(&block74, &tmp1469, &tmp1470, &tmp1471, &tmp1472, &tmp1473, &tmp1474, &tmp1475, &tmp1476, &tmp1477, &tmp1478, &tmp1479, &tmp1480, &tmp1481, &tmp1482, &tmp1483, &tmp1484, &tmp1485, &tmp1486, &tmp1487, &tmp1488, &tmp1489);
+    TNode<BoolT> tmp1490;
+    USE(tmp1490);
+    tmp1490 = CodeStubAssembler(state_).SmiLessThan(TNode<Smi>{tmp1486}, TNode<Smi>{tmp1487});
+    ca_.Goto(&block75, tmp1469, tmp1470, tmp1471, tmp1472, tmp1473, tmp1474, tmp1475, tmp1476, tmp1477, tmp1478, tmp1479, tmp1480, tmp1481, tmp1482, tmp1483, tmp1484, tmp1485, tmp1486, tmp1487, tmp1488, tmp1489, tmp1490);
+  }
+
+  if (block75.is_used()) {
+    TNode<Context> tmp1491;
+    TNode<JSArray> tmp1492;
+    TNode<Smi> tmp1493;
+    TNode<JSReceiver> tmp1494;
+    TNode<Object> tmp1495;
+    TNode<Smi> tmp1496;
+    TNode<JSArray> tmp1497;
+    TNode<JSArray> tmp1498;
+    TNode<Map> tmp1499;
+    TNode<BoolT> tmp1500;
+    TNode<FixedArray> tmp1501;
+    TNode<BoolT> tmp1502;
+    TNode<BoolT> tmp1503;
+    TNode<BoolT> tmp1504;
+    TNode<Smi> tmp1505;
+    TNode<Smi> tmp1506;
+    TNode<Context> tmp1507;
+    TNode<Smi> tmp1508;
+    TNode<Smi> tmp1509;
+    TNode<Int32T> tmp1510;
+    TNode<BoolT> tmp1511;
+    TNode<BoolT> tmp1512;
+    ca_.Bind(&block75, &tmp1491, &tmp1492, &tmp1493, &tmp1494, &tmp1495, &tmp1496, &tmp1497, &tmp1498, &tmp1499, &tmp1500, &tmp1501, &tmp1502, &tmp1503, &tmp1504, &tmp1505, &tmp1506, &tmp1507, &tmp1508, &tmp1509, &tmp1510, &tmp1511, &tmp1512);
+    ca_.Branch(tmp1512, &block71, &block72, tmp1491, tmp1492, tmp1493, tmp1494, tmp1495, tmp1496, tmp1497, tmp1498, tmp1499, tmp1500, tmp1501, tmp1502, tmp1503, tmp1504, tmp1505, tmp1506, tmp1507, tmp1508, tmp1509, tmp1510);
+  }
+
+  if (block71.is_used()) {
+    TNode<Context> tmp1513;
+    TNode<JSArray> tmp1514;
+    TNode<Smi> tmp1515;
+    TNode<JSReceiver> tmp1516;
+    TNode<Object> tmp1517;
+    TNode<Smi> tmp1518;
+    TNode<JSArray> tmp1519;
+    TNode<JSArray> tmp1520;
+    TNode<Map> tmp1521;
+    TNode<BoolT> tmp1522;
+    TNode<FixedArray> tmp1523;
+    TNode<BoolT> tmp1524;
+    TNode<BoolT> tmp1525;
+    TNode<BoolT> tmp1526;
+    TNode<Smi> tmp1527;
+    TNode<Smi> tmp1528;
+    TNode<Context> tmp1529;
+    TNode<Smi> tmp1530;
+    TNode<Smi> tmp1531;
+    TNode<Int32T> tmp1532;
+    ca_.Bind(&block71, &tmp1513, &tmp1514, &tmp1515, &tmp1516, &tmp1517, &tmp1518, &tmp1519, &tmp1520, &tmp1521, &tmp1522, &tmp1523, &tmp1524, &tmp1525, &tmp1526, &tmp1527, &tmp1528, &tmp1529, &tmp1530, &tmp1531, &tmp1532);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 116);
+    TNode<Int32T> tmp1533;
+    USE(tmp1533);
+    tmp1533 = FastHoleyElementsKind_219(state_, TNode<Int32T>{tmp1532});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 110);
+    ca_.Goto(&block72, tmp1513, tmp1514, tmp1515, tmp1516, tmp1517, tmp1518, tmp1519, tmp1520, tmp1521, tmp1522, tmp1523, tmp1524, tmp1525, tmp1526, tmp1527, tmp1528, tmp1529, tmp1530, tmp1531, tmp1533);
+  }
+
+  if (block72.is_used()) {
+    TNode<Context> tmp1534;
+    TNode<JSArray> tmp1535;
+    TNode<Smi> tmp1536;
+    TNode<JSReceiver> tmp1537;
+    TNode<Object> tmp1538;
+    TNode<Smi> tmp1539;
+    TNode<JSArray> tmp1540;
+    TNode<JSArray> tmp1541;
+    TNode<Map> tmp1542;
+    TNode<BoolT> tmp1543;
+    TNode<FixedArray> tmp1544;
+    TNode<BoolT> tmp1545;
+    TNode<BoolT> tmp1546;
+    TNode<BoolT> tmp1547;
+    TNode<Smi> tmp1548;
+    TNode<Smi> tmp1549;
+    TNode<Context> tmp1550;
+    TNode<Smi> tmp1551;
+    TNode<Smi> tmp1552;
+    TNode<Int32T> tmp1553;
+    ca_.Bind(&block72, &tmp1534, &tmp1535, &tmp1536, &tmp1537, &tmp1538, &tmp1539, &tmp1540, &tmp1541, &tmp1542, &tmp1543, &tmp1544, &tmp1545, &tmp1546, &tmp1547, &tmp1548, &tmp1549, &tmp1550, &tmp1551, &tmp1552, &tmp1553);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 119);
+    TNode<NativeContext> tmp1554;
+    USE(tmp1554);
+    tmp1554 = CodeStubAssembler(state_).LoadNativeContext(TNode<Context>{tmp1550});
+    TNode<Map> tmp1555;
+    USE(tmp1555);
+    tmp1555 = CodeStubAssembler(state_).LoadJSArrayElementsMap(TNode<Int32T>{tmp1553}, TNode<NativeContext>{tmp1554});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 120);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 122);
+    TNode<BoolT> tmp1556;
+    USE(tmp1556);
+    tmp1556 = CodeStubAssembler(state_).IsDoubleElementsKind(TNode<Int32T>{tmp1553});
+    ca_.Branch(tmp1556, &block76, &block77, tmp1534, tmp1535, tmp1536, tmp1537, tmp1538, tmp1539, tmp1540, tmp1541, tmp1542, tmp1543, tmp1544, tmp1545, tmp1546, tmp1547, tmp1548, tmp1549, tmp1550, tmp1551, tmp1552, tmp1553, tmp1555, ca_.Uninitialized<JSArray>());
+  }
+
+  if (block76.is_used()) {
+    TNode<Context> tmp1557;
+    TNode<JSArray> tmp1558;
+    TNode<Smi> tmp1559;
+    TNode<JSReceiver> tmp1560;
+    TNode<Object> tmp1561;
+    TNode<Smi> tmp1562;
+    TNode<JSArray> tmp1563;
+    TNode<JSArray> tmp1564;
+    TNode<Map> tmp1565;
+    TNode<BoolT> tmp1566;
+    TNode<FixedArray> tmp1567;
+    TNode<BoolT> tmp1568;
+    TNode<BoolT> tmp1569;
+    TNode<BoolT> tmp1570;
+    TNode<Smi> tmp1571;
+    TNode<Smi> tmp1572;
+    TNode<Context> tmp1573;
+    TNode<Smi> tmp1574;
+    TNode<Smi> tmp1575;
+    TNode<Int32T> tmp1576;
+    TNode<Map> tmp1577;
+    TNode<JSArray> tmp1578;
+    ca_.Bind(&block76, &tmp1557, &tmp1558, &tmp1559, &tmp1560, &tmp1561, &tmp1562, &tmp1563, &tmp1564, &tmp1565, &tmp1566, &tmp1567, &tmp1568, &tmp1569, &tmp1570, &tmp1571, &tmp1572, &tmp1573, &tmp1574, &tmp1575, &tmp1576, &tmp1577, &tmp1578);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 127);
+    TNode<IntPtrT> tmp1579;
+    USE(tmp1579);
+    tmp1579 = CodeStubAssembler(state_).SmiUntag(TNode<Smi>{tmp1575});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 126);
+    TNode<FixedDoubleArray> tmp1580;
+    USE(tmp1580);
+    tmp1580 = CodeStubAssembler(state_).AllocateFixedDoubleArrayWithHoles(TNode<IntPtrT>{tmp1579}, CodeStubAssembler::kAllowLargeObjectAllocation);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 128);
+    TNode<JSArray> tmp1581;
+    USE(tmp1581);
+    tmp1581 = NewJSArray_59(state_, TNode<Context>{tmp1573}, TNode<Map>{tmp1577}, TNode<FixedArrayBase>{tmp1567});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 129);
+    TNode<Smi> tmp1582;
+    USE(tmp1582);
+    tmp1582 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 0);
+    ca_.Goto(&block81, tmp1557, tmp1558, tmp1559, tmp1560, tmp1561, tmp1562, tmp1563, tmp1564, tmp1565, tmp1566, tmp1567, tmp1568, tmp1569, tmp1570, tmp1571, tmp1572, tmp1573, tmp1574, tmp1575, tmp1576, tmp1577, tmp1581, tmp1580, tmp1582);
+  }
+
+  if (block81.is_used()) {
+    TNode<Context> tmp1583;
+    TNode<JSArray> tmp1584;
+    TNode<Smi> tmp1585;
+    TNode<JSReceiver> tmp1586;
+    TNode<Object> tmp1587;
+    TNode<Smi> tmp1588;
+    TNode<JSArray> tmp1589;
+    TNode<JSArray> tmp1590;
+    TNode<Map> tmp1591;
+    TNode<BoolT> tmp1592;
+    TNode<FixedArray> tmp1593;
+    TNode<BoolT> tmp1594;
+    TNode<BoolT> tmp1595;
+    TNode<BoolT> tmp1596;
+    TNode<Smi> tmp1597;
+    TNode<Smi> tmp1598;
+    TNode<Context> tmp1599;
+    TNode<Smi> tmp1600;
+    TNode<Smi> tmp1601;
+    TNode<Int32T> tmp1602;
+    TNode<Map> tmp1603;
+    TNode<JSArray> tmp1604;
+    TNode<FixedDoubleArray> tmp1605;
+    TNode<Smi> tmp1606;
+    ca_.Bind(&block81, &tmp1583, &tmp1584, &tmp1585, &tmp1586, &tmp1587, &tmp1588, &tmp1589, &tmp1590, &tmp1591, &tmp1592, &tmp1593, &tmp1594, &tmp1595, &tmp1596, &tmp1597, &tmp1598, &tmp1599, &tmp1600, &tmp1601, &tmp1602, &tmp1603, &tmp1604, &tmp1605, &tmp1606);
+    TNode<BoolT> tmp1607;
+    USE(tmp1607);
+    tmp1607 = CodeStubAssembler(state_).SmiLessThan(TNode<Smi>{tmp1606}, TNode<Smi>{tmp1600});
+    ca_.Branch(tmp1607, &block79, &block80, tmp1583, tmp1584, tmp1585, tmp1586, tmp1587, tmp1588, tmp1589, tmp1590, tmp1591, tmp1592, tmp1593, tmp1594, tmp1595, tmp1596, tmp1597, tmp1598, tmp1599, tmp1600, tmp1601, tmp1602, tmp1603, tmp1604, tmp1605, tmp1606);
+  }
+
+  if (block79.is_used()) {
+    TNode<Context> tmp1608;
+    TNode<JSArray> tmp1609;
+    TNode<Smi> tmp1610;
+    TNode<JSReceiver> tmp1611;
+    TNode<Object> tmp1612;
+    TNode<Smi> tmp1613;
+    TNode<JSArray> tmp1614;
+    TNode<JSArray> tmp1615;
+    TNode<Map> tmp1616;
+    TNode<BoolT> tmp1617;
+    TNode<FixedArray> tmp1618;
+    TNode<BoolT> tmp1619;
+    TNode<BoolT> tmp1620;
+    TNode<BoolT> tmp1621;
+    TNode<Smi> tmp1622;
+    TNode<Smi> tmp1623;
+    TNode<Context> tmp1624;
+    TNode<Smi> tmp1625;
+    TNode<Smi> tmp1626;
+    TNode<Int32T> tmp1627;
+    TNode<Map> tmp1628;
+    TNode<JSArray> tmp1629;
+    TNode<FixedDoubleArray> tmp1630;
+    TNode<Smi> tmp1631;
+    ca_.Bind(&block79, &tmp1608, &tmp1609, &tmp1610, &tmp1611, &tmp1612, &tmp1613, &tmp1614, &tmp1615, &tmp1616, &tmp1617, &tmp1618, &tmp1619, &tmp1620, &tmp1621, &tmp1622, &tmp1623, &tmp1624, &tmp1625, &tmp1626, &tmp1627, &tmp1628, &tmp1629, &tmp1630, &tmp1631);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 131);
+    TNode<IntPtrT> tmp1632 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp1632);
+    TNode<IntPtrT> tmp1633 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp1633);
+    TNode<Smi>tmp1634 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp1618, tmp1633});
+    TNode<IntPtrT> tmp1635;
+    USE(tmp1635);
+    tmp1635 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp1634});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 55);
+    TNode<IntPtrT> tmp1636;
+    USE(tmp1636);
+    tmp1636 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp1631});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 56);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp1637;
+    USE(tmp1637);
+    tmp1637 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp1636});
+    TNode<UintPtrT> tmp1638;
+    USE(tmp1638);
+    tmp1638 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp1635});
+    TNode<BoolT> tmp1639;
+    USE(tmp1639);
+    tmp1639 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp1637}, TNode<UintPtrT>{tmp1638});
+    ca_.Branch(tmp1639, &block87, &block88, tmp1608, tmp1609, tmp1610, tmp1611, tmp1612, tmp1613, tmp1614, tmp1615, tmp1616, tmp1617, tmp1618, tmp1619, tmp1620, tmp1621, tmp1622, tmp1623, tmp1624, tmp1625, tmp1626, tmp1627, tmp1628, tmp1629, tmp1630, tmp1631, tmp1618, tmp1632, tmp1635, tmp1631, tmp1631, tmp1636, tmp1618, tmp1632, tmp1635, tmp1636, tmp1636);
+  }
+
+  if (block87.is_used()) {
+    TNode<Context> tmp1640;
+    TNode<JSArray> tmp1641;
+    TNode<Smi> tmp1642;
+    TNode<JSReceiver> tmp1643;
+    TNode<Object> tmp1644;
+    TNode<Smi> tmp1645;
+    TNode<JSArray> tmp1646;
+    TNode<JSArray> tmp1647;
+    TNode<Map> tmp1648;
+    TNode<BoolT> tmp1649;
+    TNode<FixedArray> tmp1650;
+    TNode<BoolT> tmp1651;
+    TNode<BoolT> tmp1652;
+    TNode<BoolT> tmp1653;
+    TNode<Smi> tmp1654;
+    TNode<Smi> tmp1655;
+    TNode<Context> tmp1656;
+    TNode<Smi> tmp1657;
+    TNode<Smi> tmp1658;
+    TNode<Int32T> tmp1659;
+    TNode<Map> tmp1660;
+    TNode<JSArray> tmp1661;
+    TNode<FixedDoubleArray> tmp1662;
+    TNode<Smi> tmp1663;
+    TNode<FixedArray> tmp1664;
+    TNode<IntPtrT> tmp1665;
+    TNode<IntPtrT> tmp1666;
+    TNode<Smi> tmp1667;
+    TNode<Smi> tmp1668;
+    TNode<IntPtrT> tmp1669;
+    TNode<HeapObject> tmp1670;
+    TNode<IntPtrT> tmp1671;
+    TNode<IntPtrT> tmp1672;
+    TNode<IntPtrT> tmp1673;
+    TNode<IntPtrT> tmp1674;
+    ca_.Bind(&block87, &tmp1640, &tmp1641, &tmp1642, &tmp1643, &tmp1644, &tmp1645, &tmp1646, &tmp1647, &tmp1648, &tmp1649, &tmp1650, &tmp1651, &tmp1652, &tmp1653, &tmp1654, &tmp1655, &tmp1656, &tmp1657, &tmp1658, &tmp1659, &tmp1660, &tmp1661, &tmp1662, &tmp1663, &tmp1664, &tmp1665, &tmp1666, &tmp1667, &tmp1668, &tmp1669, &tmp1670, &tmp1671, &tmp1672, &tmp1673, &tmp1674);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp1675;
+    USE(tmp1675);
+    tmp1675 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp1676;
+    USE(tmp1676);
+    tmp1676 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp1674}, TNode<IntPtrT>{tmp1675});
+    TNode<IntPtrT> tmp1677;
+    USE(tmp1677);
+    tmp1677 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp1671}, TNode<IntPtrT>{tmp1676});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp1678;
+    USE(tmp1678);
+    TNode<IntPtrT> tmp1679;
+    USE(tmp1679);
+    std::tie(tmp1678, tmp1679) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp1670}, TNode<IntPtrT>{tmp1677}).Flatten();
+    ca_.Goto(&block86, tmp1640, tmp1641, tmp1642, tmp1643, tmp1644, tmp1645, tmp1646, tmp1647, tmp1648, tmp1649, tmp1650, tmp1651, tmp1652, tmp1653, tmp1654, tmp1655, tmp1656, tmp1657, tmp1658, tmp1659, tmp1660, tmp1661, tmp1662, tmp1663, tmp1664, tmp1665, tmp1666, tmp1667, tmp1668, tmp1669, tmp1670, tmp1671, tmp1672, tmp1673, tmp1674, tmp1678, tmp1679);
+  }
+
+  if (block88.is_used()) {
+    TNode<Context> tmp1680;
+    TNode<JSArray> tmp1681;
+    TNode<Smi> tmp1682;
+    TNode<JSReceiver> tmp1683;
+    TNode<Object> tmp1684;
+    TNode<Smi> tmp1685;
+    TNode<JSArray> tmp1686;
+    TNode<JSArray> tmp1687;
+    TNode<Map> tmp1688;
+    TNode<BoolT> tmp1689;
+    TNode<FixedArray> tmp1690;
+    TNode<BoolT> tmp1691;
+    TNode<BoolT> tmp1692;
+    TNode<BoolT> tmp1693;
+    TNode<Smi> tmp1694;
+    TNode<Smi> tmp1695;
+    TNode<Context> tmp1696;
+    TNode<Smi> tmp1697;
+    TNode<Smi> tmp1698;
+    TNode<Int32T> tmp1699;
+    TNode<Map> tmp1700;
+    TNode<JSArray> tmp1701;
+    TNode<FixedDoubleArray> tmp1702;
+    TNode<Smi> tmp1703;
+    TNode<FixedArray> tmp1704;
+    TNode<IntPtrT> tmp1705;
+    TNode<IntPtrT> tmp1706;
+    TNode<Smi> tmp1707;
+    TNode<Smi> tmp1708;
+    TNode<IntPtrT> tmp1709;
+    TNode<HeapObject> tmp1710;
+    TNode<IntPtrT> tmp1711;
+    TNode<IntPtrT> tmp1712;
+    TNode<IntPtrT> tmp1713;
+    TNode<IntPtrT> tmp1714;
+    ca_.Bind(&block88, &tmp1680, &tmp1681, &tmp1682, &tmp1683, &tmp1684, &tmp1685, &tmp1686, &tmp1687, &tmp1688, &tmp1689, &tmp1690, &tmp1691, &tmp1692, &tmp1693, &tmp1694, &tmp1695, &tmp1696, &tmp1697, &tmp1698, &tmp1699, &tmp1700, &tmp1701, &tmp1702, &tmp1703, &tmp1704, &tmp1705, &tmp1706, &tmp1707, &tmp1708, &tmp1709, &tmp1710, &tmp1711, &tmp1712, &tmp1713, &tmp1714);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block85, tmp1680, tmp1681, tmp1682, tmp1683, tmp1684, tmp1685, tmp1686, tmp1687, tmp1688, tmp1689, tmp1690, tmp1691, tmp1692, tmp1693, tmp1694, tmp1695, tmp1696, tmp1697, tmp1698, tmp1699, tmp1700, tmp1701, tmp1702, tmp1703, tmp1704, tmp1705, tmp1706, tmp1707, tmp1708, tmp1709);
+  }
+
+  if (block86.is_used()) {
+    TNode<Context> tmp1715;
+    TNode<JSArray> tmp1716;
+    TNode<Smi> tmp1717;
+    TNode<JSReceiver> tmp1718;
+    TNode<Object> tmp1719;
+    TNode<Smi> tmp1720;
+    TNode<JSArray> tmp1721;
+    TNode<JSArray> tmp1722;
+    TNode<Map> tmp1723;
+    TNode<BoolT> tmp1724;
+    TNode<FixedArray> tmp1725;
+    TNode<BoolT> tmp1726;
+    TNode<BoolT> tmp1727;
+    TNode<BoolT> tmp1728;
+    TNode<Smi> tmp1729;
+    TNode<Smi> tmp1730;
+    TNode<Context> tmp1731;
+    TNode<Smi> tmp1732;
+    TNode<Smi> tmp1733;
+    TNode<Int32T> tmp1734;
+    TNode<Map> tmp1735;
+    TNode<JSArray> tmp1736;
+    TNode<FixedDoubleArray> tmp1737;
+    TNode<Smi> tmp1738;
+    TNode<FixedArray> tmp1739;
+    TNode<IntPtrT> tmp1740;
+    TNode<IntPtrT> tmp1741;
+    TNode<Smi> tmp1742;
+    TNode<Smi> tmp1743;
+    TNode<IntPtrT> tmp1744;
+    TNode<HeapObject> tmp1745;
+    TNode<IntPtrT> tmp1746;
+    TNode<IntPtrT> tmp1747;
+    TNode<IntPtrT> tmp1748;
+    TNode<IntPtrT> tmp1749;
+    TNode<HeapObject> tmp1750;
+    TNode<IntPtrT> tmp1751;
+    ca_.Bind(&block86, &tmp1715, &tmp1716, &tmp1717, &tmp1718, &tmp1719, &tmp1720, &tmp1721, &tmp1722, &tmp1723, &tmp1724, &tmp1725, &tmp1726, &tmp1727, &tmp1728, &tmp1729, &tmp1730, &tmp1731, &tmp1732, &tmp1733, &tmp1734, &tmp1735, &tmp1736, &tmp1737, &tmp1738, &tmp1739, &tmp1740, &tmp1741, &tmp1742, &tmp1743, &tmp1744, &tmp1745, &tmp1746, &tmp1747, &tmp1748, &tmp1749, &tmp1750, &tmp1751);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 56);
+    ca_.Goto(&block84, tmp1715, tmp1716, tmp1717, tmp1718, tmp1719, tmp1720, tmp1721, tmp1722, tmp1723, tmp1724, tmp1725, tmp1726, tmp1727, tmp1728, tmp1729, tmp1730, tmp1731, tmp1732, tmp1733, tmp1734, tmp1735, tmp1736, tmp1737, tmp1738, tmp1739, tmp1740, tmp1741, tmp1742, tmp1743, tmp1744, tmp1750, tmp1751);
+  }
+
+  if (block85.is_used()) {
+    TNode<Context> tmp1752;
+    TNode<JSArray> tmp1753;
+    TNode<Smi> tmp1754;
+    TNode<JSReceiver> tmp1755;
+    TNode<Object> tmp1756;
+    TNode<Smi> tmp1757;
+    TNode<JSArray> tmp1758;
+    TNode<JSArray> tmp1759;
+    TNode<Map> tmp1760;
+    TNode<BoolT> tmp1761;
+    TNode<FixedArray> tmp1762;
+    TNode<BoolT> tmp1763;
+    TNode<BoolT> tmp1764;
+    TNode<BoolT> tmp1765;
+    TNode<Smi> tmp1766;
+    TNode<Smi> tmp1767;
+    TNode<Context> tmp1768;
+    TNode<Smi> tmp1769;
+    TNode<Smi> tmp1770;
+    TNode<Int32T> tmp1771;
+    TNode<Map> tmp1772;
+    TNode<JSArray> tmp1773;
+    TNode<FixedDoubleArray> tmp1774;
+    TNode<Smi> tmp1775;
+    TNode<FixedArray> tmp1776;
+    TNode<IntPtrT> tmp1777;
+    TNode<IntPtrT> tmp1778;
+    TNode<Smi> tmp1779;
+    TNode<Smi> tmp1780;
+    TNode<IntPtrT> tmp1781;
+    ca_.Bind(&block85, &tmp1752, &tmp1753, &tmp1754, &tmp1755, &tmp1756, &tmp1757, &tmp1758, &tmp1759, &tmp1760, &tmp1761, &tmp1762, &tmp1763, &tmp1764, &tmp1765, &tmp1766, &tmp1767, &tmp1768, &tmp1769, &tmp1770, &tmp1771, &tmp1772, &tmp1773, &tmp1774, &tmp1775, &tmp1776, &tmp1777, &tmp1778, &tmp1779, &tmp1780, &tmp1781);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block84.is_used()) {
+    TNode<Context> tmp1782;
+    TNode<JSArray> tmp1783;
+    TNode<Smi> tmp1784;
+    TNode<JSReceiver> tmp1785;
+    TNode<Object> tmp1786;
+    TNode<Smi> tmp1787;
+    TNode<JSArray> tmp1788;
+    TNode<JSArray> tmp1789;
+    TNode<Map> tmp1790;
+    TNode<BoolT> tmp1791;
+    TNode<FixedArray> tmp1792;
+    TNode<BoolT> tmp1793;
+    TNode<BoolT> tmp1794;
+    TNode<BoolT> tmp1795;
+    TNode<Smi> tmp1796;
+    TNode<Smi> tmp1797;
+    TNode<Context> tmp1798;
+    TNode<Smi> tmp1799;
+    TNode<Smi> tmp1800;
+    TNode<Int32T> tmp1801;
+    TNode<Map> tmp1802;
+    TNode<JSArray> tmp1803;
+    TNode<FixedDoubleArray> tmp1804;
+    TNode<Smi> tmp1805;
+    TNode<FixedArray> tmp1806;
+    TNode<IntPtrT> tmp1807;
+    TNode<IntPtrT> tmp1808;
+    TNode<Smi> tmp1809;
+    TNode<Smi> tmp1810;
+    TNode<IntPtrT> tmp1811;
+    TNode<HeapObject> tmp1812;
+    TNode<IntPtrT> tmp1813;
+    ca_.Bind(&block84, &tmp1782, &tmp1783, &tmp1784, &tmp1785, &tmp1786, &tmp1787, &tmp1788, &tmp1789, &tmp1790, &tmp1791, &tmp1792, &tmp1793, &tmp1794, &tmp1795, &tmp1796, &tmp1797, &tmp1798, &tmp1799, &tmp1800, &tmp1801, &tmp1802, &tmp1803, &tmp1804, &tmp1805, &tmp1806, &tmp1807, &tmp1808, &tmp1809, &tmp1810, &tmp1811, &tmp1812, &tmp1813);
+    ca_.Goto(&block83, tmp1782, tmp1783, tmp1784, tmp1785, tmp1786, tmp1787, tmp1788, tmp1789, tmp1790, tmp1791, tmp1792, tmp1793, tmp1794, tmp1795, tmp1796, tmp1797, tmp1798, tmp1799, tmp1800, tmp1801, tmp1802, tmp1803, tmp1804, tmp1805, tmp1806, tmp1807, tmp1808, tmp1809, tmp1810, tmp1812, tmp1813);
+  }
+
+  if (block83.is_used()) {
+    TNode<Context> tmp1814;
+    TNode<JSArray> tmp1815;
+    TNode<Smi> tmp1816;
+    TNode<JSReceiver> tmp1817;
+    TNode<Object> tmp1818;
+    TNode<Smi> tmp1819;
+    TNode<JSArray> tmp1820;
+    TNode<JSArray> tmp1821;
+    TNode<Map> tmp1822;
+    TNode<BoolT> tmp1823;
+    TNode<FixedArray> tmp1824;
+    TNode<BoolT> tmp1825;
+    TNode<BoolT> tmp1826;
+    TNode<BoolT> tmp1827;
+    TNode<Smi> tmp1828;
+    TNode<Smi> tmp1829;
+    TNode<Context> tmp1830;
+    TNode<Smi> tmp1831;
+    TNode<Smi> tmp1832;
+    TNode<Int32T> tmp1833;
+    TNode<Map> tmp1834;
+    TNode<JSArray> tmp1835;
+    TNode<FixedDoubleArray> tmp1836;
+    TNode<Smi> tmp1837;
+    TNode<FixedArray> tmp1838;
+    TNode<IntPtrT> tmp1839;
+    TNode<IntPtrT> tmp1840;
+    TNode<Smi> tmp1841;
+    TNode<Smi> tmp1842;
+    TNode<HeapObject> tmp1843;
+    TNode<IntPtrT> tmp1844;
+    ca_.Bind(&block83, &tmp1814, &tmp1815, &tmp1816, &tmp1817, &tmp1818, &tmp1819, &tmp1820, &tmp1821, &tmp1822, &tmp1823, &tmp1824, &tmp1825, &tmp1826, &tmp1827, &tmp1828, &tmp1829, &tmp1830, &tmp1831, &tmp1832, &tmp1833, &tmp1834, &tmp1835, &tmp1836, &tmp1837, &tmp1838, &tmp1839, &tmp1840, &tmp1841, &tmp1842, &tmp1843, &tmp1844);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 131);
+    TNode<Object>tmp1845 = CodeStubAssembler(state_).LoadReference<Object>(CodeStubAssembler::Reference{tmp1843, tmp1844});
+    TNode<Object> tmp1846;
+    USE(tmp1846);
+    tmp1846 = UnsafeCast30UT5ATSmi9ATTheHole10HeapNumber_1386(state_, TNode<Context>{tmp1830}, TNode<Object>{tmp1845});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 132);
+    TNode<Number> tmp1847;
+    USE(tmp1847);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp1847 = Cast20UT5ATSmi10HeapNumber_85(state_, TNode<Object>{tmp1846}, &label0);
+    ca_.Goto(&block92, tmp1814, tmp1815, tmp1816, tmp1817, tmp1818, tmp1819, tmp1820, tmp1821, tmp1822, tmp1823, tmp1824, tmp1825, tmp1826, tmp1827, tmp1828, tmp1829, tmp1830, tmp1831, tmp1832, tmp1833, tmp1834, tmp1835, tmp1836, tmp1837, tmp1846, tmp1846, tmp1847);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block93, tmp1814, tmp1815, tmp1816, tmp1817, tmp1818, tmp1819, tmp1820, tmp1821, tmp1822, tmp1823, tmp1824, tmp1825, tmp1826, tmp1827, tmp1828, tmp1829, tmp1830, tmp1831, tmp1832, tmp1833, tmp1834, tmp1835, tmp1836, tmp1837, tmp1846, tmp1846);
+    }
+  }
+
+  if (block93.is_used()) {
+    TNode<Context> tmp1848;
+    TNode<JSArray> tmp1849;
+    TNode<Smi> tmp1850;
+    TNode<JSReceiver> tmp1851;
+    TNode<Object> tmp1852;
+    TNode<Smi> tmp1853;
+    TNode<JSArray> tmp1854;
+    TNode<JSArray> tmp1855;
+    TNode<Map> tmp1856;
+    TNode<BoolT> tmp1857;
+    TNode<FixedArray> tmp1858;
+    TNode<BoolT> tmp1859;
+    TNode<BoolT> tmp1860;
+    TNode<BoolT> tmp1861;
+    TNode<Smi> tmp1862;
+    TNode<Smi> tmp1863;
+    TNode<Context> tmp1864;
+    TNode<Smi> tmp1865;
+    TNode<Smi> tmp1866;
+    TNode<Int32T> tmp1867;
+    TNode<Map> tmp1868;
+    TNode<JSArray> tmp1869;
+    TNode<FixedDoubleArray> tmp1870;
+    TNode<Smi> tmp1871;
+    TNode<Object> tmp1872;
+    TNode<Object> tmp1873;
+    ca_.Bind(&block93, &tmp1848, &tmp1849, &tmp1850, &tmp1851, &tmp1852, &tmp1853, &tmp1854, &tmp1855, &tmp1856, &tmp1857, &tmp1858, &tmp1859, &tmp1860, &tmp1861, &tmp1862, &tmp1863, &tmp1864, &tmp1865, &tmp1866, &tmp1867, &tmp1868, &tmp1869, &tmp1870, &tmp1871, &tmp1872, &tmp1873);
+    ca_.Goto(&block91, tmp1848, tmp1849, tmp1850, tmp1851, tmp1852, tmp1853, tmp1854, tmp1855, tmp1856, tmp1857, tmp1858, tmp1859, tmp1860, tmp1861, tmp1862, tmp1863, tmp1864, tmp1865, tmp1866, tmp1867, tmp1868, tmp1869, tmp1870, tmp1871, tmp1872);
+  }
+
+  if (block92.is_used()) {
+    TNode<Context> tmp1874;
+    TNode<JSArray> tmp1875;
+    TNode<Smi> tmp1876;
+    TNode<JSReceiver> tmp1877;
+    TNode<Object> tmp1878;
+    TNode<Smi> tmp1879;
+    TNode<JSArray> tmp1880;
+    TNode<JSArray> tmp1881;
+    TNode<Map> tmp1882;
+    TNode<BoolT> tmp1883;
+    TNode<FixedArray> tmp1884;
+    TNode<BoolT> tmp1885;
+    TNode<BoolT> tmp1886;
+    TNode<BoolT> tmp1887;
+    TNode<Smi> tmp1888;
+    TNode<Smi> tmp1889;
+    TNode<Context> tmp1890;
+    TNode<Smi> tmp1891;
+    TNode<Smi> tmp1892;
+    TNode<Int32T> tmp1893;
+    TNode<Map> tmp1894;
+    TNode<JSArray> tmp1895;
+    TNode<FixedDoubleArray> tmp1896;
+    TNode<Smi> tmp1897;
+    TNode<Object> tmp1898;
+    TNode<Object> tmp1899;
+    TNode<Number> tmp1900;
+    ca_.Bind(&block92, &tmp1874, &tmp1875, &tmp1876, &tmp1877, &tmp1878, &tmp1879, &tmp1880, &tmp1881, &tmp1882, &tmp1883, &tmp1884, &tmp1885, &tmp1886, &tmp1887, &tmp1888, &tmp1889, &tmp1890, &tmp1891, &tmp1892, &tmp1893, &tmp1894, &tmp1895, &tmp1896, &tmp1897, &tmp1898, &tmp1899, &tmp1900);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 133);
+    TNode<IntPtrT> tmp1901 = ca_.IntPtrConstant(FixedDoubleArray::kFloatsOffset);
+    USE(tmp1901);
+    TNode<IntPtrT> tmp1902 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp1902);
+    TNode<Smi>tmp1903 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp1896, tmp1902});
+    TNode<IntPtrT> tmp1904;
+    USE(tmp1904);
+    tmp1904 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp1903});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 55);
+    TNode<IntPtrT> tmp1905;
+    USE(tmp1905);
+    tmp1905 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp1897});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 56);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp1906;
+    USE(tmp1906);
+    tmp1906 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp1905});
+    TNode<UintPtrT> tmp1907;
+    USE(tmp1907);
+    tmp1907 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp1904});
+    TNode<BoolT> tmp1908;
+    USE(tmp1908);
+    tmp1908 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp1906}, TNode<UintPtrT>{tmp1907});
+    ca_.Branch(tmp1908, &block98, &block99, tmp1874, tmp1875, tmp1876, tmp1877, tmp1878, tmp1879, tmp1880, tmp1881, tmp1882, tmp1883, tmp1884, tmp1885, tmp1886, tmp1887, tmp1888, tmp1889, tmp1890, tmp1891, tmp1892, tmp1893, tmp1894, tmp1895, tmp1896, tmp1897, tmp1898, tmp1900, tmp1896, tmp1901, tmp1904, tmp1897, tmp1897, tmp1905, tmp1896, tmp1901, tmp1904, tmp1905, tmp1905);
+  }
+
+  if (block98.is_used()) {
+    TNode<Context> tmp1909;
+    TNode<JSArray> tmp1910;
+    TNode<Smi> tmp1911;
+    TNode<JSReceiver> tmp1912;
+    TNode<Object> tmp1913;
+    TNode<Smi> tmp1914;
+    TNode<JSArray> tmp1915;
+    TNode<JSArray> tmp1916;
+    TNode<Map> tmp1917;
+    TNode<BoolT> tmp1918;
+    TNode<FixedArray> tmp1919;
+    TNode<BoolT> tmp1920;
+    TNode<BoolT> tmp1921;
+    TNode<BoolT> tmp1922;
+    TNode<Smi> tmp1923;
+    TNode<Smi> tmp1924;
+    TNode<Context> tmp1925;
+    TNode<Smi> tmp1926;
+    TNode<Smi> tmp1927;
+    TNode<Int32T> tmp1928;
+    TNode<Map> tmp1929;
+    TNode<JSArray> tmp1930;
+    TNode<FixedDoubleArray> tmp1931;
+    TNode<Smi> tmp1932;
+    TNode<Object> tmp1933;
+    TNode<Number> tmp1934;
+    TNode<FixedDoubleArray> tmp1935;
+    TNode<IntPtrT> tmp1936;
+    TNode<IntPtrT> tmp1937;
+    TNode<Smi> tmp1938;
+    TNode<Smi> tmp1939;
+    TNode<IntPtrT> tmp1940;
+    TNode<HeapObject> tmp1941;
+    TNode<IntPtrT> tmp1942;
+    TNode<IntPtrT> tmp1943;
+    TNode<IntPtrT> tmp1944;
+    TNode<IntPtrT> tmp1945;
+    ca_.Bind(&block98, &tmp1909, &tmp1910, &tmp1911, &tmp1912, &tmp1913, &tmp1914, &tmp1915, &tmp1916, &tmp1917, &tmp1918, &tmp1919, &tmp1920, &tmp1921, &tmp1922, &tmp1923, &tmp1924, &tmp1925, &tmp1926, &tmp1927, &tmp1928, &tmp1929, &tmp1930, &tmp1931, &tmp1932, &tmp1933, &tmp1934, &tmp1935, &tmp1936, &tmp1937, &tmp1938, &tmp1939, &tmp1940, &tmp1941, &tmp1942, &tmp1943, &tmp1944, &tmp1945);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp1946;
+    USE(tmp1946);
+    tmp1946 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf9ATfloat64_355(state_)));
+    TNode<IntPtrT> tmp1947;
+    USE(tmp1947);
+    tmp1947 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp1945}, TNode<IntPtrT>{tmp1946});
+    TNode<IntPtrT> tmp1948;
+    USE(tmp1948);
+    tmp1948 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp1942}, TNode<IntPtrT>{tmp1947});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp1949;
+    USE(tmp1949);
+    TNode<IntPtrT> tmp1950;
+    USE(tmp1950);
+    std::tie(tmp1949, tmp1950) = UnsafeNewReference9ATfloat64_1387(state_, TNode<HeapObject>{tmp1941}, TNode<IntPtrT>{tmp1948}).Flatten();
+    ca_.Goto(&block97, tmp1909, tmp1910, tmp1911, tmp1912, tmp1913, tmp1914, tmp1915, tmp1916, tmp1917, tmp1918, tmp1919, tmp1920, tmp1921, tmp1922, tmp1923, tmp1924, tmp1925, tmp1926, tmp1927, tmp1928, tmp1929, tmp1930, tmp1931, tmp1932, tmp1933, tmp1934, tmp1935, tmp1936, tmp1937, tmp1938, tmp1939, tmp1940, tmp1941, tmp1942, tmp1943, tmp1944, tmp1945, tmp1949, tmp1950);
+  }
+
+  if (block99.is_used()) {
+    TNode<Context> tmp1951;
+    TNode<JSArray> tmp1952;
+    TNode<Smi> tmp1953;
+    TNode<JSReceiver> tmp1954;
+    TNode<Object> tmp1955;
+    TNode<Smi> tmp1956;
+    TNode<JSArray> tmp1957;
+    TNode<JSArray> tmp1958;
+    TNode<Map> tmp1959;
+    TNode<BoolT> tmp1960;
+    TNode<FixedArray> tmp1961;
+    TNode<BoolT> tmp1962;
+    TNode<BoolT> tmp1963;
+    TNode<BoolT> tmp1964;
+    TNode<Smi> tmp1965;
+    TNode<Smi> tmp1966;
+    TNode<Context> tmp1967;
+    TNode<Smi> tmp1968;
+    TNode<Smi> tmp1969;
+    TNode<Int32T> tmp1970;
+    TNode<Map> tmp1971;
+    TNode<JSArray> tmp1972;
+    TNode<FixedDoubleArray> tmp1973;
+    TNode<Smi> tmp1974;
+    TNode<Object> tmp1975;
+    TNode<Number> tmp1976;
+    TNode<FixedDoubleArray> tmp1977;
+    TNode<IntPtrT> tmp1978;
+    TNode<IntPtrT> tmp1979;
+    TNode<Smi> tmp1980;
+    TNode<Smi> tmp1981;
+    TNode<IntPtrT> tmp1982;
+    TNode<HeapObject> tmp1983;
+    TNode<IntPtrT> tmp1984;
+    TNode<IntPtrT> tmp1985;
+    TNode<IntPtrT> tmp1986;
+    TNode<IntPtrT> tmp1987;
+    ca_.Bind(&block99, &tmp1951, &tmp1952, &tmp1953, &tmp1954, &tmp1955, &tmp1956, &tmp1957, &tmp1958, &tmp1959, &tmp1960, &tmp1961, &tmp1962, &tmp1963, &tmp1964, &tmp1965, &tmp1966, &tmp1967, &tmp1968, &tmp1969, &tmp1970, &tmp1971, &tmp1972, &tmp1973, &tmp1974, &tmp1975, &tmp1976, &tmp1977, &tmp1978, &tmp1979, &tmp1980, &tmp1981, &tmp1982, &tmp1983, &tmp1984, &tmp1985, &tmp1986, &tmp1987);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block96, tmp1951, tmp1952, tmp1953, tmp1954, tmp1955, tmp1956, tmp1957, tmp1958, tmp1959, tmp1960, tmp1961, tmp1962, tmp1963, tmp1964, tmp1965, tmp1966, tmp1967, tmp1968, tmp1969, tmp1970, tmp1971, tmp1972, tmp1973, tmp1974, tmp1975, tmp1976, tmp1977, tmp1978, tmp1979, tmp1980, tmp1981, tmp1982);
+  }
+
+  if (block97.is_used()) {
+    TNode<Context> tmp1988;
+    TNode<JSArray> tmp1989;
+    TNode<Smi> tmp1990;
+    TNode<JSReceiver> tmp1991;
+    TNode<Object> tmp1992;
+    TNode<Smi> tmp1993;
+    TNode<JSArray> tmp1994;
+    TNode<JSArray> tmp1995;
+    TNode<Map> tmp1996;
+    TNode<BoolT> tmp1997;
+    TNode<FixedArray> tmp1998;
+    TNode<BoolT> tmp1999;
+    TNode<BoolT> tmp2000;
+    TNode<BoolT> tmp2001;
+    TNode<Smi> tmp2002;
+    TNode<Smi> tmp2003;
+    TNode<Context> tmp2004;
+    TNode<Smi> tmp2005;
+    TNode<Smi> tmp2006;
+    TNode<Int32T> tmp2007;
+    TNode<Map> tmp2008;
+    TNode<JSArray> tmp2009;
+    TNode<FixedDoubleArray> tmp2010;
+    TNode<Smi> tmp2011;
+    TNode<Object> tmp2012;
+    TNode<Number> tmp2013;
+    TNode<FixedDoubleArray> tmp2014;
+    TNode<IntPtrT> tmp2015;
+    TNode<IntPtrT> tmp2016;
+    TNode<Smi> tmp2017;
+    TNode<Smi> tmp2018;
+    TNode<IntPtrT> tmp2019;
+    TNode<HeapObject> tmp2020;
+    TNode<IntPtrT> tmp2021;
+    TNode<IntPtrT> tmp2022;
+    TNode<IntPtrT> tmp2023;
+    TNode<IntPtrT> tmp2024;
+    TNode<HeapObject> tmp2025;
+    TNode<IntPtrT> tmp2026;
+    ca_.Bind(&block97, &tmp1988, &tmp1989, &tmp1990, &tmp1991, &tmp1992, &tmp1993, &tmp1994, &tmp1995, &tmp1996, &tmp1997, &tmp1998, &tmp1999, &tmp2000, &tmp2001, &tmp2002, &tmp2003, &tmp2004, &tmp2005, &tmp2006, &tmp2007, &tmp2008, &tmp2009, &tmp2010, &tmp2011, &tmp2012, &tmp2013, &tmp2014, &tmp2015, &tmp2016, &tmp2017, &tmp2018, &tmp2019, &tmp2020, &tmp2021, &tmp2022, &tmp2023, &tmp2024, &tmp2025, &tmp2026);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 56);
+    ca_.Goto(&block95, tmp1988, tmp1989, tmp1990, tmp1991, tmp1992, tmp1993, tmp1994, tmp1995, tmp1996, tmp1997, tmp1998, tmp1999, tmp2000, tmp2001, tmp2002, tmp2003, tmp2004, tmp2005, tmp2006, tmp2007, tmp2008, tmp2009, tmp2010, tmp2011, tmp2012, tmp2013, tmp2014, tmp2015, tmp2016, tmp2017, tmp2018, tmp2019, tmp2025, tmp2026);
+  }
+
+  if (block96.is_used()) {
+    TNode<Context> tmp2027;
+    TNode<JSArray> tmp2028;
+    TNode<Smi> tmp2029;
+    TNode<JSReceiver> tmp2030;
+    TNode<Object> tmp2031;
+    TNode<Smi> tmp2032;
+    TNode<JSArray> tmp2033;
+    TNode<JSArray> tmp2034;
+    TNode<Map> tmp2035;
+    TNode<BoolT> tmp2036;
+    TNode<FixedArray> tmp2037;
+    TNode<BoolT> tmp2038;
+    TNode<BoolT> tmp2039;
+    TNode<BoolT> tmp2040;
+    TNode<Smi> tmp2041;
+    TNode<Smi> tmp2042;
+    TNode<Context> tmp2043;
+    TNode<Smi> tmp2044;
+    TNode<Smi> tmp2045;
+    TNode<Int32T> tmp2046;
+    TNode<Map> tmp2047;
+    TNode<JSArray> tmp2048;
+    TNode<FixedDoubleArray> tmp2049;
+    TNode<Smi> tmp2050;
+    TNode<Object> tmp2051;
+    TNode<Number> tmp2052;
+    TNode<FixedDoubleArray> tmp2053;
+    TNode<IntPtrT> tmp2054;
+    TNode<IntPtrT> tmp2055;
+    TNode<Smi> tmp2056;
+    TNode<Smi> tmp2057;
+    TNode<IntPtrT> tmp2058;
+    ca_.Bind(&block96, &tmp2027, &tmp2028, &tmp2029, &tmp2030, &tmp2031, &tmp2032, &tmp2033, &tmp2034, &tmp2035, &tmp2036, &tmp2037, &tmp2038, &tmp2039, &tmp2040, &tmp2041, &tmp2042, &tmp2043, &tmp2044, &tmp2045, &tmp2046, &tmp2047, &tmp2048, &tmp2049, &tmp2050, &tmp2051, &tmp2052, &tmp2053, &tmp2054, &tmp2055, &tmp2056, &tmp2057, &tmp2058);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block95.is_used()) {
+    TNode<Context> tmp2059;
+    TNode<JSArray> tmp2060;
+    TNode<Smi> tmp2061;
+    TNode<JSReceiver> tmp2062;
+    TNode<Object> tmp2063;
+    TNode<Smi> tmp2064;
+    TNode<JSArray> tmp2065;
+    TNode<JSArray> tmp2066;
+    TNode<Map> tmp2067;
+    TNode<BoolT> tmp2068;
+    TNode<FixedArray> tmp2069;
+    TNode<BoolT> tmp2070;
+    TNode<BoolT> tmp2071;
+    TNode<BoolT> tmp2072;
+    TNode<Smi> tmp2073;
+    TNode<Smi> tmp2074;
+    TNode<Context> tmp2075;
+    TNode<Smi> tmp2076;
+    TNode<Smi> tmp2077;
+    TNode<Int32T> tmp2078;
+    TNode<Map> tmp2079;
+    TNode<JSArray> tmp2080;
+    TNode<FixedDoubleArray> tmp2081;
+    TNode<Smi> tmp2082;
+    TNode<Object> tmp2083;
+    TNode<Number> tmp2084;
+    TNode<FixedDoubleArray> tmp2085;
+    TNode<IntPtrT> tmp2086;
+    TNode<IntPtrT> tmp2087;
+    TNode<Smi> tmp2088;
+    TNode<Smi> tmp2089;
+    TNode<IntPtrT> tmp2090;
+    TNode<HeapObject> tmp2091;
+    TNode<IntPtrT> tmp2092;
+    ca_.Bind(&block95, &tmp2059, &tmp2060, &tmp2061, &tmp2062, &tmp2063, &tmp2064, &tmp2065, &tmp2066, &tmp2067, &tmp2068, &tmp2069, &tmp2070, &tmp2071, &tmp2072, &tmp2073, &tmp2074, &tmp2075, &tmp2076, &tmp2077, &tmp2078, &tmp2079, &tmp2080, &tmp2081, &tmp2082, &tmp2083, &tmp2084, &tmp2085, &tmp2086, &tmp2087, &tmp2088, &tmp2089, &tmp2090, &tmp2091, &tmp2092);
+    ca_.Goto(&block94, tmp2059, tmp2060, tmp2061, tmp2062, tmp2063, tmp2064, tmp2065, tmp2066, tmp2067, tmp2068, tmp2069, tmp2070, tmp2071, tmp2072, tmp2073, tmp2074, tmp2075, tmp2076, tmp2077, tmp2078, tmp2079, tmp2080, tmp2081, tmp2082, tmp2083, tmp2084, tmp2085, tmp2086, tmp2087, tmp2088, tmp2089, tmp2091, tmp2092);
+  }
+
+  if (block94.is_used()) {
+    TNode<Context> tmp2093;
+    TNode<JSArray> tmp2094;
+    TNode<Smi> tmp2095;
+    TNode<JSReceiver> tmp2096;
+    TNode<Object> tmp2097;
+    TNode<Smi> tmp2098;
+    TNode<JSArray> tmp2099;
+    TNode<JSArray> tmp2100;
+    TNode<Map> tmp2101;
+    TNode<BoolT> tmp2102;
+    TNode<FixedArray> tmp2103;
+    TNode<BoolT> tmp2104;
+    TNode<BoolT> tmp2105;
+    TNode<BoolT> tmp2106;
+    TNode<Smi> tmp2107;
+    TNode<Smi> tmp2108;
+    TNode<Context> tmp2109;
+    TNode<Smi> tmp2110;
+    TNode<Smi> tmp2111;
+    TNode<Int32T> tmp2112;
+    TNode<Map> tmp2113;
+    TNode<JSArray> tmp2114;
+    TNode<FixedDoubleArray> tmp2115;
+    TNode<Smi> tmp2116;
+    TNode<Object> tmp2117;
+    TNode<Number> tmp2118;
+    TNode<FixedDoubleArray> tmp2119;
+    TNode<IntPtrT> tmp2120;
+    TNode<IntPtrT> tmp2121;
+    TNode<Smi> tmp2122;
+    TNode<Smi> tmp2123;
+    TNode<HeapObject> tmp2124;
+    TNode<IntPtrT> tmp2125;
+    ca_.Bind(&block94, &tmp2093, &tmp2094, &tmp2095, &tmp2096, &tmp2097, &tmp2098, &tmp2099, &tmp2100, &tmp2101, &tmp2102, &tmp2103, &tmp2104, &tmp2105, &tmp2106, &tmp2107, &tmp2108, &tmp2109, &tmp2110, &tmp2111, &tmp2112, &tmp2113, &tmp2114, &tmp2115, &tmp2116, &tmp2117, &tmp2118, &tmp2119, &tmp2120, &tmp2121, &tmp2122, &tmp2123, &tmp2124, &tmp2125);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 133);
+    TNode<Float64T> tmp2126;
+    USE(tmp2126);
+    tmp2126 = Convert9ATfloat6420UT5ATSmi10HeapNumber_197(state_, TNode<Number>{tmp2118});
+    TNode<Float64T> tmp2127;
+    USE(tmp2127);
+    tmp2127 = CodeStubAssembler(state_).Float64SilenceNaN(TNode<Float64T>{tmp2126});
+    CodeStubAssembler(state_).StoreReference(CodeStubAssembler::Reference{tmp2124, tmp2125}, tmp2127);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 132);
+    ca_.Goto(&block90, tmp2093, tmp2094, tmp2095, tmp2096, tmp2097, tmp2098, tmp2099, tmp2100, tmp2101, tmp2102, tmp2103, tmp2104, tmp2105, tmp2106, tmp2107, tmp2108, tmp2109, tmp2110, tmp2111, tmp2112, tmp2113, tmp2114, tmp2115, tmp2116, tmp2117);
+  }
+
+  if (block91.is_used()) {
+    TNode<Context> tmp2128;
+    TNode<JSArray> tmp2129;
+    TNode<Smi> tmp2130;
+    TNode<JSReceiver> tmp2131;
+    TNode<Object> tmp2132;
+    TNode<Smi> tmp2133;
+    TNode<JSArray> tmp2134;
+    TNode<JSArray> tmp2135;
+    TNode<Map> tmp2136;
+    TNode<BoolT> tmp2137;
+    TNode<FixedArray> tmp2138;
+    TNode<BoolT> tmp2139;
+    TNode<BoolT> tmp2140;
+    TNode<BoolT> tmp2141;
+    TNode<Smi> tmp2142;
+    TNode<Smi> tmp2143;
+    TNode<Context> tmp2144;
+    TNode<Smi> tmp2145;
+    TNode<Smi> tmp2146;
+    TNode<Int32T> tmp2147;
+    TNode<Map> tmp2148;
+    TNode<JSArray> tmp2149;
+    TNode<FixedDoubleArray> tmp2150;
+    TNode<Smi> tmp2151;
+    TNode<Object> tmp2152;
+    ca_.Bind(&block91, &tmp2128, &tmp2129, &tmp2130, &tmp2131, &tmp2132, &tmp2133, &tmp2134, &tmp2135, &tmp2136, &tmp2137, &tmp2138, &tmp2139, &tmp2140, &tmp2141, &tmp2142, &tmp2143, &tmp2144, &tmp2145, &tmp2146, &tmp2147, &tmp2148, &tmp2149, &tmp2150, &tmp2151, &tmp2152);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 135);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 132);
+    ca_.Goto(&block90, tmp2128, tmp2129, tmp2130, tmp2131, tmp2132, tmp2133, tmp2134, tmp2135, tmp2136, tmp2137, tmp2138, tmp2139, tmp2140, tmp2141, tmp2142, tmp2143, tmp2144, tmp2145, tmp2146, tmp2147, tmp2148, tmp2149, tmp2150, tmp2151, tmp2152);
+  }
+
+  if (block90.is_used()) {
+    TNode<Context> tmp2153;
+    TNode<JSArray> tmp2154;
+    TNode<Smi> tmp2155;
+    TNode<JSReceiver> tmp2156;
+    TNode<Object> tmp2157;
+    TNode<Smi> tmp2158;
+    TNode<JSArray> tmp2159;
+    TNode<JSArray> tmp2160;
+    TNode<Map> tmp2161;
+    TNode<BoolT> tmp2162;
+    TNode<FixedArray> tmp2163;
+    TNode<BoolT> tmp2164;
+    TNode<BoolT> tmp2165;
+    TNode<BoolT> tmp2166;
+    TNode<Smi> tmp2167;
+    TNode<Smi> tmp2168;
+    TNode<Context> tmp2169;
+    TNode<Smi> tmp2170;
+    TNode<Smi> tmp2171;
+    TNode<Int32T> tmp2172;
+    TNode<Map> tmp2173;
+    TNode<JSArray> tmp2174;
+    TNode<FixedDoubleArray> tmp2175;
+    TNode<Smi> tmp2176;
+    TNode<Object> tmp2177;
+    ca_.Bind(&block90, &tmp2153, &tmp2154, &tmp2155, &tmp2156, &tmp2157, &tmp2158, &tmp2159, &tmp2160, &tmp2161, &tmp2162, &tmp2163, &tmp2164, &tmp2165, &tmp2166, &tmp2167, &tmp2168, &tmp2169, &tmp2170, &tmp2171, &tmp2172, &tmp2173, &tmp2174, &tmp2175, &tmp2176, &tmp2177);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 130);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 129);
+    ca_.Goto(&block82, tmp2153, tmp2154, tmp2155, tmp2156, tmp2157, tmp2158, tmp2159, tmp2160, tmp2161, tmp2162, tmp2163, tmp2164, tmp2165, tmp2166, tmp2167, tmp2168, tmp2169, tmp2170, tmp2171, tmp2172, tmp2173, tmp2174, tmp2175, tmp2176);
+  }
+
+  if (block82.is_used()) {
+    TNode<Context> tmp2178;
+    TNode<JSArray> tmp2179;
+    TNode<Smi> tmp2180;
+    TNode<JSReceiver> tmp2181;
+    TNode<Object> tmp2182;
+    TNode<Smi> tmp2183;
+    TNode<JSArray> tmp2184;
+    TNode<JSArray> tmp2185;
+    TNode<Map> tmp2186;
+    TNode<BoolT> tmp2187;
+    TNode<FixedArray> tmp2188;
+    TNode<BoolT> tmp2189;
+    TNode<BoolT> tmp2190;
+    TNode<BoolT> tmp2191;
+    TNode<Smi> tmp2192;
+    TNode<Smi> tmp2193;
+    TNode<Context> tmp2194;
+    TNode<Smi> tmp2195;
+    TNode<Smi> tmp2196;
+    TNode<Int32T> tmp2197;
+    TNode<Map> tmp2198;
+    TNode<JSArray> tmp2199;
+    TNode<FixedDoubleArray> tmp2200;
+    TNode<Smi> tmp2201;
+    ca_.Bind(&block82, &tmp2178, &tmp2179, &tmp2180, &tmp2181, &tmp2182, &tmp2183, &tmp2184, &tmp2185, &tmp2186, &tmp2187, &tmp2188, &tmp2189, &tmp2190, &tmp2191, &tmp2192, &tmp2193, &tmp2194, &tmp2195, &tmp2196, &tmp2197, &tmp2198, &tmp2199, &tmp2200, &tmp2201);
+    TNode<Smi> tmp2202;
+    USE(tmp2202);
+    tmp2202 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 1);
+    TNode<Smi> tmp2203;
+    USE(tmp2203);
+    tmp2203 = CodeStubAssembler(state_).SmiAdd(TNode<Smi>{tmp2201}, TNode<Smi>{tmp2202});
+    ca_.Goto(&block81, tmp2178, tmp2179, tmp2180, tmp2181, tmp2182, tmp2183, tmp2184, tmp2185, tmp2186, tmp2187, tmp2188, tmp2189, tmp2190, tmp2191, tmp2192, tmp2193, tmp2194, tmp2195, tmp2196, tmp2197, tmp2198, tmp2199, tmp2200, tmp2203);
+  }
+
+  if (block80.is_used()) {
+    TNode<Context> tmp2204;
+    TNode<JSArray> tmp2205;
+    TNode<Smi> tmp2206;
+    TNode<JSReceiver> tmp2207;
+    TNode<Object> tmp2208;
+    TNode<Smi> tmp2209;
+    TNode<JSArray> tmp2210;
+    TNode<JSArray> tmp2211;
+    TNode<Map> tmp2212;
+    TNode<BoolT> tmp2213;
+    TNode<FixedArray> tmp2214;
+    TNode<BoolT> tmp2215;
+    TNode<BoolT> tmp2216;
+    TNode<BoolT> tmp2217;
+    TNode<Smi> tmp2218;
+    TNode<Smi> tmp2219;
+    TNode<Context> tmp2220;
+    TNode<Smi> tmp2221;
+    TNode<Smi> tmp2222;
+    TNode<Int32T> tmp2223;
+    TNode<Map> tmp2224;
+    TNode<JSArray> tmp2225;
+    TNode<FixedDoubleArray> tmp2226;
+    TNode<Smi> tmp2227;
+    ca_.Bind(&block80, &tmp2204, &tmp2205, &tmp2206, &tmp2207, &tmp2208, &tmp2209, &tmp2210, &tmp2211, &tmp2212, &tmp2213, &tmp2214, &tmp2215, &tmp2216, &tmp2217, &tmp2218, &tmp2219, &tmp2220, &tmp2221, &tmp2222, &tmp2223, &tmp2224, &tmp2225, &tmp2226, &tmp2227);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 139);
+    TNode<IntPtrT> tmp2228 = ca_.IntPtrConstant(JSObject::kElementsOffset);
+    USE(tmp2228);
+    CodeStubAssembler(state_).StoreReference(CodeStubAssembler::Reference{tmp2225, tmp2228}, tmp2226);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 122);
+    ca_.Goto(&block78, tmp2204, tmp2205, tmp2206, tmp2207, tmp2208, tmp2209, tmp2210, tmp2211, tmp2212, tmp2213, tmp2214, tmp2215, tmp2216, tmp2217, tmp2218, tmp2219, tmp2220, tmp2221, tmp2222, tmp2223, tmp2224, tmp2225);
+  }
+
+  if (block77.is_used()) {
+    TNode<Context> tmp2229;
+    TNode<JSArray> tmp2230;
+    TNode<Smi> tmp2231;
+    TNode<JSReceiver> tmp2232;
+    TNode<Object> tmp2233;
+    TNode<Smi> tmp2234;
+    TNode<JSArray> tmp2235;
+    TNode<JSArray> tmp2236;
+    TNode<Map> tmp2237;
+    TNode<BoolT> tmp2238;
+    TNode<FixedArray> tmp2239;
+    TNode<BoolT> tmp2240;
+    TNode<BoolT> tmp2241;
+    TNode<BoolT> tmp2242;
+    TNode<Smi> tmp2243;
+    TNode<Smi> tmp2244;
+    TNode<Context> tmp2245;
+    TNode<Smi> tmp2246;
+    TNode<Smi> tmp2247;
+    TNode<Int32T> tmp2248;
+    TNode<Map> tmp2249;
+    TNode<JSArray> tmp2250;
+    ca_.Bind(&block77, &tmp2229, &tmp2230, &tmp2231, &tmp2232, &tmp2233, &tmp2234, &tmp2235, &tmp2236, &tmp2237, &tmp2238, &tmp2239, &tmp2240, &tmp2241, &tmp2242, &tmp2243, &tmp2244, &tmp2245, &tmp2246, &tmp2247, &tmp2248, &tmp2249, &tmp2250);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 142);
+    TNode<JSArray> tmp2251;
+    USE(tmp2251);
+    tmp2251 = NewJSArray_59(state_, TNode<Context>{tmp2245}, TNode<Map>{tmp2249}, TNode<FixedArrayBase>{tmp2239});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 122);
+    ca_.Goto(&block78, tmp2229, tmp2230, tmp2231, tmp2232, tmp2233, tmp2234, tmp2235, tmp2236, tmp2237, tmp2238, tmp2239, tmp2240, tmp2241, tmp2242, tmp2243, tmp2244, tmp2245, tmp2246, tmp2247, tmp2248, tmp2249, tmp2251);
+  }
+
+  if (block78.is_used()) {
+    TNode<Context> tmp2252;
+    TNode<JSArray> tmp2253;
+    TNode<Smi> tmp2254;
+    TNode<JSReceiver> tmp2255;
+    TNode<Object> tmp2256;
+    TNode<Smi> tmp2257;
+    TNode<JSArray> tmp2258;
+    TNode<JSArray> tmp2259;
+    TNode<Map> tmp2260;
+    TNode<BoolT> tmp2261;
+    TNode<FixedArray> tmp2262;
+    TNode<BoolT> tmp2263;
+    TNode<BoolT> tmp2264;
+    TNode<BoolT> tmp2265;
+    TNode<Smi> tmp2266;
+    TNode<Smi> tmp2267;
+    TNode<Context> tmp2268;
+    TNode<Smi> tmp2269;
+    TNode<Smi> tmp2270;
+    TNode<Int32T> tmp2271;
+    TNode<Map> tmp2272;
+    TNode<JSArray> tmp2273;
+    ca_.Bind(&block78, &tmp2252, &tmp2253, &tmp2254, &tmp2255, &tmp2256, &tmp2257, &tmp2258, &tmp2259, &tmp2260, &tmp2261, &tmp2262, &tmp2263, &tmp2264, &tmp2265, &tmp2266, &tmp2267, &tmp2268, &tmp2269, &tmp2270, &tmp2271, &tmp2272, &tmp2273);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 146);
+    TNode<FixedArray> tmp2274;
+    USE(tmp2274);
+    tmp2274 = kEmptyFixedArray_215(state_);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 147);
+    ca_.Goto(&block61, tmp2252, tmp2253, tmp2254, tmp2255, tmp2256, tmp2257, tmp2258, tmp2259, tmp2260, tmp2261, tmp2274, tmp2263, tmp2264, tmp2265, tmp2266, tmp2267, tmp2268, tmp2269, tmp2273);
+  }
+
+  if (block61.is_used()) {
+    TNode<Context> tmp2275;
+    TNode<JSArray> tmp2276;
+    TNode<Smi> tmp2277;
+    TNode<JSReceiver> tmp2278;
+    TNode<Object> tmp2279;
+    TNode<Smi> tmp2280;
+    TNode<JSArray> tmp2281;
+    TNode<JSArray> tmp2282;
+    TNode<Map> tmp2283;
+    TNode<BoolT> tmp2284;
+    TNode<FixedArray> tmp2285;
+    TNode<BoolT> tmp2286;
+    TNode<BoolT> tmp2287;
+    TNode<BoolT> tmp2288;
+    TNode<Smi> tmp2289;
+    TNode<Smi> tmp2290;
+    TNode<Context> tmp2291;
+    TNode<Smi> tmp2292;
+    TNode<JSArray> tmp2293;
+    ca_.Bind(&block61, &tmp2275, &tmp2276, &tmp2277, &tmp2278, &tmp2279, &tmp2280, &tmp2281, &tmp2282, &tmp2283, &tmp2284, &tmp2285, &tmp2286, &tmp2287, &tmp2288, &tmp2289, &tmp2290, &tmp2291, &tmp2292, &tmp2293);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 219);
+    ca_.Goto(&block1, tmp2293, tmp2289);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp2294;
+    TNode<JSArray> tmp2295;
+    TNode<Smi> tmp2296;
+    TNode<JSReceiver> tmp2297;
+    TNode<Object> tmp2298;
+    TNode<Smi> tmp2299;
+    TNode<JSArray> tmp2300;
+    TNode<JSArray> tmp2301;
+    TNode<Map> tmp2302;
+    TNode<BoolT> tmp2303;
+    TNode<FixedArray> tmp2304;
+    TNode<BoolT> tmp2305;
+    TNode<BoolT> tmp2306;
+    TNode<BoolT> tmp2307;
+    ca_.Bind(&block3, &tmp2294, &tmp2295, &tmp2296, &tmp2297, &tmp2298, &tmp2299, &tmp2300, &tmp2301, &tmp2302, &tmp2303, &tmp2304, &tmp2305, &tmp2306, &tmp2307);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 222);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 99);
+    TNode<IntPtrT> tmp2308 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp2308);
+    TNode<Smi>tmp2309 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp2304, tmp2308});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 100);
+    ca_.Goto(&block103, tmp2294, tmp2295, tmp2296, tmp2297, tmp2298, tmp2299, tmp2300, tmp2301, tmp2302, tmp2303, tmp2304, tmp2305, tmp2306, tmp2307, tmp2296, tmp2294, tmp2296, tmp2309);
+  }
+
+  if (block102.is_used()) {
+    TNode<Context> tmp2310;
+    TNode<JSArray> tmp2311;
+    TNode<Smi> tmp2312;
+    TNode<JSReceiver> tmp2313;
+    TNode<Object> tmp2314;
+    TNode<Smi> tmp2315;
+    TNode<JSArray> tmp2316;
+    TNode<JSArray> tmp2317;
+    TNode<Map> tmp2318;
+    TNode<BoolT> tmp2319;
+    TNode<FixedArray> tmp2320;
+    TNode<BoolT> tmp2321;
+    TNode<BoolT> tmp2322;
+    TNode<BoolT> tmp2323;
+    TNode<Smi> tmp2324;
+    TNode<Context> tmp2325;
+    TNode<Smi> tmp2326;
+    TNode<Smi> tmp2327;
+    ca_.Bind(&block102, &tmp2310, &tmp2311, &tmp2312, &tmp2313, &tmp2314, &tmp2315, &tmp2316, &tmp2317, &tmp2318, &tmp2319, &tmp2320, &tmp2321, &tmp2322, &tmp2323, &tmp2324, &tmp2325, &tmp2326, &tmp2327);
+    TNode<BoolT> tmp2328;
+    USE(tmp2328);
+    tmp2328 = CodeStubAssembler(state_).SmiLessThanOrEqual(TNode<Smi>{tmp2326}, TNode<Smi>{tmp2327});
+    ca_.Branch(tmp2328, &block104, &block105, tmp2310, tmp2311, tmp2312, tmp2313, tmp2314, tmp2315, tmp2316, tmp2317, tmp2318, tmp2319, tmp2320, tmp2321, tmp2322, tmp2323, tmp2324, tmp2325, tmp2326, tmp2327);
+  }
+
+  if (block105.is_used()) {
+    TNode<Context> tmp2329;
+    TNode<JSArray> tmp2330;
+    TNode<Smi> tmp2331;
+    TNode<JSReceiver> tmp2332;
+    TNode<Object> tmp2333;
+    TNode<Smi> tmp2334;
+    TNode<JSArray> tmp2335;
+    TNode<JSArray> tmp2336;
+    TNode<Map> tmp2337;
+    TNode<BoolT> tmp2338;
+    TNode<FixedArray> tmp2339;
+    TNode<BoolT> tmp2340;
+    TNode<BoolT> tmp2341;
+    TNode<BoolT> tmp2342;
+    TNode<Smi> tmp2343;
+    TNode<Context> tmp2344;
+    TNode<Smi> tmp2345;
+    TNode<Smi> tmp2346;
+    ca_.Bind(&block105, &tmp2329, &tmp2330, &tmp2331, &tmp2332, &tmp2333, &tmp2334, &tmp2335, &tmp2336, &tmp2337, &tmp2338, &tmp2339, &tmp2340, &tmp2341, &tmp2342, &tmp2343, &tmp2344, &tmp2345, &tmp2346);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'validLength <= length' failed", "../../deps/v8/src/builtins/array-map.tq", 100);
+  }
+
+  if (block104.is_used()) {
+    TNode<Context> tmp2347;
+    TNode<JSArray> tmp2348;
+    TNode<Smi> tmp2349;
+    TNode<JSReceiver> tmp2350;
+    TNode<Object> tmp2351;
+    TNode<Smi> tmp2352;
+    TNode<JSArray> tmp2353;
+    TNode<JSArray> tmp2354;
+    TNode<Map> tmp2355;
+    TNode<BoolT> tmp2356;
+    TNode<FixedArray> tmp2357;
+    TNode<BoolT> tmp2358;
+    TNode<BoolT> tmp2359;
+    TNode<BoolT> tmp2360;
+    TNode<Smi> tmp2361;
+    TNode<Context> tmp2362;
+    TNode<Smi> tmp2363;
+    TNode<Smi> tmp2364;
+    ca_.Bind(&block104, &tmp2347, &tmp2348, &tmp2349, &tmp2350, &tmp2351, &tmp2352, &tmp2353, &tmp2354, &tmp2355, &tmp2356, &tmp2357, &tmp2358, &tmp2359, &tmp2360, &tmp2361, &tmp2362, &tmp2363, &tmp2364);
+  }
+
+  if (block103.is_used()) {
+    TNode<Context> tmp2365;
+    TNode<JSArray> tmp2366;
+    TNode<Smi> tmp2367;
+    TNode<JSReceiver> tmp2368;
+    TNode<Object> tmp2369;
+    TNode<Smi> tmp2370;
+    TNode<JSArray> tmp2371;
+    TNode<JSArray> tmp2372;
+    TNode<Map> tmp2373;
+    TNode<BoolT> tmp2374;
+    TNode<FixedArray> tmp2375;
+    TNode<BoolT> tmp2376;
+    TNode<BoolT> tmp2377;
+    TNode<BoolT> tmp2378;
+    TNode<Smi> tmp2379;
+    TNode<Context> tmp2380;
+    TNode<Smi> tmp2381;
+    TNode<Smi> tmp2382;
+    ca_.Bind(&block103, &tmp2365, &tmp2366, &tmp2367, &tmp2368, &tmp2369, &tmp2370, &tmp2371, &tmp2372, &tmp2373, &tmp2374, &tmp2375, &tmp2376, &tmp2377, &tmp2378, &tmp2379, &tmp2380, &tmp2381, &tmp2382);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 101);
+    TNode<Int32T> tmp2383;
+    USE(tmp2383);
+    tmp2383 = FromConstexpr14ATElementsKind24ATconstexpr_ElementsKind_170(state_, PACKED_SMI_ELEMENTS);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 102);
+    TNode<BoolT> tmp2384;
+    USE(tmp2384);
+    tmp2384 = CodeStubAssembler(state_).Word32BinaryNot(TNode<BoolT>{tmp2376});
+    ca_.Branch(tmp2384, &block106, &block107, tmp2365, tmp2366, tmp2367, tmp2368, tmp2369, tmp2370, tmp2371, tmp2372, tmp2373, tmp2374, tmp2375, tmp2376, tmp2377, tmp2378, tmp2379, tmp2380, tmp2381, tmp2382, tmp2383);
+  }
+
+  if (block106.is_used()) {
+    TNode<Context> tmp2385;
+    TNode<JSArray> tmp2386;
+    TNode<Smi> tmp2387;
+    TNode<JSReceiver> tmp2388;
+    TNode<Object> tmp2389;
+    TNode<Smi> tmp2390;
+    TNode<JSArray> tmp2391;
+    TNode<JSArray> tmp2392;
+    TNode<Map> tmp2393;
+    TNode<BoolT> tmp2394;
+    TNode<FixedArray> tmp2395;
+    TNode<BoolT> tmp2396;
+    TNode<BoolT> tmp2397;
+    TNode<BoolT> tmp2398;
+    TNode<Smi> tmp2399;
+    TNode<Context> tmp2400;
+    TNode<Smi> tmp2401;
+    TNode<Smi> tmp2402;
+    TNode<Int32T> tmp2403;
+    ca_.Bind(&block106, &tmp2385, &tmp2386, &tmp2387, &tmp2388, &tmp2389, &tmp2390, &tmp2391, &tmp2392, &tmp2393, &tmp2394, &tmp2395, &tmp2396, &tmp2397, &tmp2398, &tmp2399, &tmp2400, &tmp2401, &tmp2402, &tmp2403);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 103);
+    ca_.Branch(tmp2397, &block108, &block109, tmp2385, tmp2386, tmp2387, tmp2388, tmp2389, tmp2390, tmp2391, tmp2392, tmp2393, tmp2394, tmp2395, tmp2396, tmp2397, tmp2398, tmp2399, tmp2400, tmp2401, tmp2402, tmp2403);
+  }
+
+  if (block108.is_used()) {
+    TNode<Context> tmp2404;
+    TNode<JSArray> tmp2405;
+    TNode<Smi> tmp2406;
+    TNode<JSReceiver> tmp2407;
+    TNode<Object> tmp2408;
+    TNode<Smi> tmp2409;
+    TNode<JSArray> tmp2410;
+    TNode<JSArray> tmp2411;
+    TNode<Map> tmp2412;
+    TNode<BoolT> tmp2413;
+    TNode<FixedArray> tmp2414;
+    TNode<BoolT> tmp2415;
+    TNode<BoolT> tmp2416;
+    TNode<BoolT> tmp2417;
+    TNode<Smi> tmp2418;
+    TNode<Context> tmp2419;
+    TNode<Smi> tmp2420;
+    TNode<Smi> tmp2421;
+    TNode<Int32T> tmp2422;
+    ca_.Bind(&block108, &tmp2404, &tmp2405, &tmp2406, &tmp2407, &tmp2408, &tmp2409, &tmp2410, &tmp2411, &tmp2412, &tmp2413, &tmp2414, &tmp2415, &tmp2416, &tmp2417, &tmp2418, &tmp2419, &tmp2420, &tmp2421, &tmp2422);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 104);
+    TNode<Int32T> tmp2423;
+    USE(tmp2423);
+    tmp2423 = FromConstexpr14ATElementsKind24ATconstexpr_ElementsKind_170(state_, PACKED_DOUBLE_ELEMENTS);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 103);
+    ca_.Goto(&block110, tmp2404, tmp2405, tmp2406, tmp2407, tmp2408, tmp2409, tmp2410, tmp2411, tmp2412, tmp2413, tmp2414, tmp2415, tmp2416, tmp2417, tmp2418, tmp2419, tmp2420, tmp2421, tmp2423);
+  }
+
+  if (block109.is_used()) {
+    TNode<Context> tmp2424;
+    TNode<JSArray> tmp2425;
+    TNode<Smi> tmp2426;
+    TNode<JSReceiver> tmp2427;
+    TNode<Object> tmp2428;
+    TNode<Smi> tmp2429;
+    TNode<JSArray> tmp2430;
+    TNode<JSArray> tmp2431;
+    TNode<Map> tmp2432;
+    TNode<BoolT> tmp2433;
+    TNode<FixedArray> tmp2434;
+    TNode<BoolT> tmp2435;
+    TNode<BoolT> tmp2436;
+    TNode<BoolT> tmp2437;
+    TNode<Smi> tmp2438;
+    TNode<Context> tmp2439;
+    TNode<Smi> tmp2440;
+    TNode<Smi> tmp2441;
+    TNode<Int32T> tmp2442;
+    ca_.Bind(&block109, &tmp2424, &tmp2425, &tmp2426, &tmp2427, &tmp2428, &tmp2429, &tmp2430, &tmp2431, &tmp2432, &tmp2433, &tmp2434, &tmp2435, &tmp2436, &tmp2437, &tmp2438, &tmp2439, &tmp2440, &tmp2441, &tmp2442);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 106);
+    TNode<Int32T> tmp2443;
+    USE(tmp2443);
+    tmp2443 = FromConstexpr14ATElementsKind24ATconstexpr_ElementsKind_170(state_, PACKED_ELEMENTS);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 103);
+    ca_.Goto(&block110, tmp2424, tmp2425, tmp2426, tmp2427, tmp2428, tmp2429, tmp2430, tmp2431, tmp2432, tmp2433, tmp2434, tmp2435, tmp2436, tmp2437, tmp2438, tmp2439, tmp2440, tmp2441, tmp2443);
+  }
+
+  if (block110.is_used()) {
+    TNode<Context> tmp2444;
+    TNode<JSArray> tmp2445;
+    TNode<Smi> tmp2446;
+    TNode<JSReceiver> tmp2447;
+    TNode<Object> tmp2448;
+    TNode<Smi> tmp2449;
+    TNode<JSArray> tmp2450;
+    TNode<JSArray> tmp2451;
+    TNode<Map> tmp2452;
+    TNode<BoolT> tmp2453;
+    TNode<FixedArray> tmp2454;
+    TNode<BoolT> tmp2455;
+    TNode<BoolT> tmp2456;
+    TNode<BoolT> tmp2457;
+    TNode<Smi> tmp2458;
+    TNode<Context> tmp2459;
+    TNode<Smi> tmp2460;
+    TNode<Smi> tmp2461;
+    TNode<Int32T> tmp2462;
+    ca_.Bind(&block110, &tmp2444, &tmp2445, &tmp2446, &tmp2447, &tmp2448, &tmp2449, &tmp2450, &tmp2451, &tmp2452, &tmp2453, &tmp2454, &tmp2455, &tmp2456, &tmp2457, &tmp2458, &tmp2459, &tmp2460, &tmp2461, &tmp2462);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 102);
+    ca_.Goto(&block107, tmp2444, tmp2445, tmp2446, tmp2447, tmp2448, tmp2449, tmp2450, tmp2451, tmp2452, tmp2453, tmp2454, tmp2455, tmp2456, tmp2457, tmp2458, tmp2459, tmp2460, tmp2461, tmp2462);
+  }
+
+  if (block107.is_used()) {
+    TNode<Context> tmp2463;
+    TNode<JSArray> tmp2464;
+    TNode<Smi> tmp2465;
+    TNode<JSReceiver> tmp2466;
+    TNode<Object> tmp2467;
+    TNode<Smi> tmp2468;
+    TNode<JSArray> tmp2469;
+    TNode<JSArray> tmp2470;
+    TNode<Map> tmp2471;
+    TNode<BoolT> tmp2472;
+    TNode<FixedArray> tmp2473;
+    TNode<BoolT> tmp2474;
+    TNode<BoolT> tmp2475;
+    TNode<BoolT> tmp2476;
+    TNode<Smi> tmp2477;
+    TNode<Context> tmp2478;
+    TNode<Smi> tmp2479;
+    TNode<Smi> tmp2480;
+    TNode<Int32T> tmp2481;
+    ca_.Bind(&block107, &tmp2463, &tmp2464, &tmp2465, &tmp2466, &tmp2467, &tmp2468, &tmp2469, &tmp2470, &tmp2471, &tmp2472, &tmp2473, &tmp2474, &tmp2475, &tmp2476, &tmp2477, &tmp2478, &tmp2479, &tmp2480, &tmp2481);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 110);
+    ca_.Branch(tmp2476, &block113, &block114, tmp2463, tmp2464, tmp2465, tmp2466, tmp2467, tmp2468, tmp2469, tmp2470, tmp2471, tmp2472, tmp2473, tmp2474, tmp2475, tmp2476, tmp2477, tmp2478, tmp2479, tmp2480, tmp2481, tmp2476);
+  }
+
+  if (block113.is_used()) {
+    TNode<Context> tmp2482;
+    TNode<JSArray> tmp2483;
+    TNode<Smi> tmp2484;
+    TNode<JSReceiver> tmp2485;
+    TNode<Object> tmp2486;
+    TNode<Smi> tmp2487;
+    TNode<JSArray> tmp2488;
+    TNode<JSArray> tmp2489;
+    TNode<Map> tmp2490;
+    TNode<BoolT> tmp2491;
+    TNode<FixedArray> tmp2492;
+    TNode<BoolT> tmp2493;
+    TNode<BoolT> tmp2494;
+    TNode<BoolT> tmp2495;
+    TNode<Smi> tmp2496;
+    TNode<Context> tmp2497;
+    TNode<Smi> tmp2498;
+    TNode<Smi> tmp2499;
+    TNode<Int32T> tmp2500;
+    TNode<BoolT> tmp2501;
+    ca_.Bind(&block113, &tmp2482, &tmp2483, &tmp2484, &tmp2485, &tmp2486, &tmp2487, &tmp2488, &tmp2489, &tmp2490, &tmp2491, &tmp2492, &tmp2493, &tmp2494, &tmp2495, &tmp2496, &tmp2497, &tmp2498, &tmp2499, &tmp2500, &tmp2501);
+    TNode<BoolT> tmp2502;
+    USE(tmp2502);
+    tmp2502 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, true);
+    ca_.Goto(&block115, tmp2482, tmp2483, tmp2484, tmp2485, tmp2486, tmp2487, tmp2488, tmp2489, tmp2490, tmp2491, tmp2492, tmp2493, tmp2494, tmp2495, tmp2496, tmp2497, tmp2498, tmp2499, tmp2500, tmp2501, tmp2502);
+  }
+
+  if (block114.is_used()) {
+    TNode<Context> tmp2503;
+    TNode<JSArray> tmp2504;
+    TNode<Smi> tmp2505;
+    TNode<JSReceiver> tmp2506;
+    TNode<Object> tmp2507;
+    TNode<Smi> tmp2508;
+    TNode<JSArray> tmp2509;
+    TNode<JSArray> tmp2510;
+    TNode<Map> tmp2511;
+    TNode<BoolT> tmp2512;
+    TNode<FixedArray> tmp2513;
+    TNode<BoolT> tmp2514;
+    TNode<BoolT> tmp2515;
+    TNode<BoolT> tmp2516;
+    TNode<Smi> tmp2517;
+    TNode<Context> tmp2518;
+    TNode<Smi> tmp2519;
+    TNode<Smi> tmp2520;
+    TNode<Int32T> tmp2521;
+    TNode<BoolT> tmp2522;
+    ca_.Bind(&block114, &tmp2503, &tmp2504, &tmp2505, &tmp2506, &tmp2507, &tmp2508, &tmp2509, &tmp2510, &tmp2511, &tmp2512, &tmp2513, &tmp2514, &tmp2515, &tmp2516, &tmp2517, &tmp2518, &tmp2519, &tmp2520, &tmp2521, &tmp2522);
+    TNode<BoolT> tmp2523;
+    USE(tmp2523);
+    tmp2523 = CodeStubAssembler(state_).SmiLessThan(TNode<Smi>{tmp2519}, TNode<Smi>{tmp2520});
+    ca_.Goto(&block115, tmp2503, tmp2504, tmp2505, tmp2506, tmp2507, tmp2508, tmp2509, tmp2510, tmp2511, tmp2512, tmp2513, tmp2514, tmp2515, tmp2516, tmp2517, tmp2518, tmp2519, tmp2520, tmp2521, tmp2522, tmp2523);
+  }
+
+  if (block115.is_used()) {
+    TNode<Context> tmp2524;
+    TNode<JSArray> tmp2525;
+    TNode<Smi> tmp2526;
+    TNode<JSReceiver> tmp2527;
+    TNode<Object> tmp2528;
+    TNode<Smi> tmp2529;
+    TNode<JSArray> tmp2530;
+    TNode<JSArray> tmp2531;
+    TNode<Map> tmp2532;
+    TNode<BoolT> tmp2533;
+    TNode<FixedArray> tmp2534;
+    TNode<BoolT> tmp2535;
+    TNode<BoolT> tmp2536;
+    TNode<BoolT> tmp2537;
+    TNode<Smi> tmp2538;
+    TNode<Context> tmp2539;
+    TNode<Smi> tmp2540;
+    TNode<Smi> tmp2541;
+    TNode<Int32T> tmp2542;
+    TNode<BoolT> tmp2543;
+    TNode<BoolT> tmp2544;
+    ca_.Bind(&block115, &tmp2524, &tmp2525, &tmp2526, &tmp2527, &tmp2528, &tmp2529, &tmp2530, &tmp2531, &tmp2532, &tmp2533, &tmp2534, &tmp2535, &tmp2536, &tmp2537, &tmp2538, &tmp2539, &tmp2540, &tmp2541, &tmp2542, &tmp2543, &tmp2544);
+    ca_.Branch(tmp2544, &block111, &block112, tmp2524, tmp2525, tmp2526, tmp2527, tmp2528, tmp2529, tmp2530, tmp2531, tmp2532, tmp2533, tmp2534, tmp2535, tmp2536, tmp2537, tmp2538, tmp2539, tmp2540, tmp2541, tmp2542);
+  }
+
+  if (block111.is_used()) {
+    TNode<Context> tmp2545;
+    TNode<JSArray> tmp2546;
+    TNode<Smi> tmp2547;
+    TNode<JSReceiver> tmp2548;
+    TNode<Object> tmp2549;
+    TNode<Smi> tmp2550;
+    TNode<JSArray> tmp2551;
+    TNode<JSArray> tmp2552;
+    TNode<Map> tmp2553;
+    TNode<BoolT> tmp2554;
+    TNode<FixedArray> tmp2555;
+    TNode<BoolT> tmp2556;
+    TNode<BoolT> tmp2557;
+    TNode<BoolT> tmp2558;
+    TNode<Smi> tmp2559;
+    TNode<Context> tmp2560;
+    TNode<Smi> tmp2561;
+    TNode<Smi> tmp2562;
+    TNode<Int32T> tmp2563;
+    ca_.Bind(&block111, &tmp2545, &tmp2546, &tmp2547, &tmp2548, &tmp2549, &tmp2550, &tmp2551, &tmp2552, &tmp2553, &tmp2554, &tmp2555, &tmp2556, &tmp2557, &tmp2558, &tmp2559, &tmp2560, &tmp2561, &tmp2562, &tmp2563);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 116);
+    TNode<Int32T> tmp2564;
+    USE(tmp2564);
+    tmp2564 = FastHoleyElementsKind_219(state_, TNode<Int32T>{tmp2563});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 110);
+    ca_.Goto(&block112, tmp2545, tmp2546, tmp2547, tmp2548, tmp2549, tmp2550, tmp2551, tmp2552, tmp2553, tmp2554, tmp2555, tmp2556, tmp2557, tmp2558, tmp2559, tmp2560, tmp2561, tmp2562, tmp2564);
+  }
+
+  if (block112.is_used()) {
+    TNode<Context> tmp2565;
+    TNode<JSArray> tmp2566;
+    TNode<Smi> tmp2567;
+    TNode<JSReceiver> tmp2568;
+    TNode<Object> tmp2569;
+    TNode<Smi> tmp2570;
+    TNode<JSArray> tmp2571;
+    TNode<JSArray> tmp2572;
+    TNode<Map> tmp2573;
+    TNode<BoolT> tmp2574;
+    TNode<FixedArray> tmp2575;
+    TNode<BoolT> tmp2576;
+    TNode<BoolT> tmp2577;
+    TNode<BoolT> tmp2578;
+    TNode<Smi> tmp2579;
+    TNode<Context> tmp2580;
+    TNode<Smi> tmp2581;
+    TNode<Smi> tmp2582;
+    TNode<Int32T> tmp2583;
+    ca_.Bind(&block112, &tmp2565, &tmp2566, &tmp2567, &tmp2568, &tmp2569, &tmp2570, &tmp2571, &tmp2572, &tmp2573, &tmp2574, &tmp2575, &tmp2576, &tmp2577, &tmp2578, &tmp2579, &tmp2580, &tmp2581, &tmp2582, &tmp2583);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 119);
+    TNode<NativeContext> tmp2584;
+    USE(tmp2584);
+    tmp2584 = CodeStubAssembler(state_).LoadNativeContext(TNode<Context>{tmp2580});
+    TNode<Map> tmp2585;
+    USE(tmp2585);
+    tmp2585 = CodeStubAssembler(state_).LoadJSArrayElementsMap(TNode<Int32T>{tmp2583}, TNode<NativeContext>{tmp2584});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 120);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 122);
+    TNode<BoolT> tmp2586;
+    USE(tmp2586);
+    tmp2586 = CodeStubAssembler(state_).IsDoubleElementsKind(TNode<Int32T>{tmp2583});
+    ca_.Branch(tmp2586, &block116, &block117, tmp2565, tmp2566, tmp2567, tmp2568, tmp2569, tmp2570, tmp2571, tmp2572, tmp2573, tmp2574, tmp2575, tmp2576, tmp2577, tmp2578, tmp2579, tmp2580, tmp2581, tmp2582, tmp2583, tmp2585, ca_.Uninitialized<JSArray>());
+  }
+
+  if (block116.is_used()) {
+    TNode<Context> tmp2587;
+    TNode<JSArray> tmp2588;
+    TNode<Smi> tmp2589;
+    TNode<JSReceiver> tmp2590;
+    TNode<Object> tmp2591;
+    TNode<Smi> tmp2592;
+    TNode<JSArray> tmp2593;
+    TNode<JSArray> tmp2594;
+    TNode<Map> tmp2595;
+    TNode<BoolT> tmp2596;
+    TNode<FixedArray> tmp2597;
+    TNode<BoolT> tmp2598;
+    TNode<BoolT> tmp2599;
+    TNode<BoolT> tmp2600;
+    TNode<Smi> tmp2601;
+    TNode<Context> tmp2602;
+    TNode<Smi> tmp2603;
+    TNode<Smi> tmp2604;
+    TNode<Int32T> tmp2605;
+    TNode<Map> tmp2606;
+    TNode<JSArray> tmp2607;
+    ca_.Bind(&block116, &tmp2587, &tmp2588, &tmp2589, &tmp2590, &tmp2591, &tmp2592, &tmp2593, &tmp2594, &tmp2595, &tmp2596, &tmp2597, &tmp2598, &tmp2599, &tmp2600, &tmp2601, &tmp2602, &tmp2603, &tmp2604, &tmp2605, &tmp2606, &tmp2607);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 127);
+    TNode<IntPtrT> tmp2608;
+    USE(tmp2608);
+    tmp2608 = CodeStubAssembler(state_).SmiUntag(TNode<Smi>{tmp2604});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 126);
+    TNode<FixedDoubleArray> tmp2609;
+    USE(tmp2609);
+    tmp2609 = CodeStubAssembler(state_).AllocateFixedDoubleArrayWithHoles(TNode<IntPtrT>{tmp2608}, CodeStubAssembler::kAllowLargeObjectAllocation);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 128);
+    TNode<JSArray> tmp2610;
+    USE(tmp2610);
+    tmp2610 = NewJSArray_59(state_, TNode<Context>{tmp2602}, TNode<Map>{tmp2606}, TNode<FixedArrayBase>{tmp2597});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 129);
+    TNode<Smi> tmp2611;
+    USE(tmp2611);
+    tmp2611 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 0);
+    ca_.Goto(&block121, tmp2587, tmp2588, tmp2589, tmp2590, tmp2591, tmp2592, tmp2593, tmp2594, tmp2595, tmp2596, tmp2597, tmp2598, tmp2599, tmp2600, tmp2601, tmp2602, tmp2603, tmp2604, tmp2605, tmp2606, tmp2610, tmp2609, tmp2611);
+  }
+
+  if (block121.is_used()) {
+    TNode<Context> tmp2612;
+    TNode<JSArray> tmp2613;
+    TNode<Smi> tmp2614;
+    TNode<JSReceiver> tmp2615;
+    TNode<Object> tmp2616;
+    TNode<Smi> tmp2617;
+    TNode<JSArray> tmp2618;
+    TNode<JSArray> tmp2619;
+    TNode<Map> tmp2620;
+    TNode<BoolT> tmp2621;
+    TNode<FixedArray> tmp2622;
+    TNode<BoolT> tmp2623;
+    TNode<BoolT> tmp2624;
+    TNode<BoolT> tmp2625;
+    TNode<Smi> tmp2626;
+    TNode<Context> tmp2627;
+    TNode<Smi> tmp2628;
+    TNode<Smi> tmp2629;
+    TNode<Int32T> tmp2630;
+    TNode<Map> tmp2631;
+    TNode<JSArray> tmp2632;
+    TNode<FixedDoubleArray> tmp2633;
+    TNode<Smi> tmp2634;
+    ca_.Bind(&block121, &tmp2612, &tmp2613, &tmp2614, &tmp2615, &tmp2616, &tmp2617, &tmp2618, &tmp2619, &tmp2620, &tmp2621, &tmp2622, &tmp2623, &tmp2624, &tmp2625, &tmp2626, &tmp2627, &tmp2628, &tmp2629, &tmp2630, &tmp2631, &tmp2632, &tmp2633, &tmp2634);
+    TNode<BoolT> tmp2635;
+    USE(tmp2635);
+    tmp2635 = CodeStubAssembler(state_).SmiLessThan(TNode<Smi>{tmp2634}, TNode<Smi>{tmp2628});
+    ca_.Branch(tmp2635, &block119, &block120, tmp2612, tmp2613, tmp2614, tmp2615, tmp2616, tmp2617, tmp2618, tmp2619, tmp2620, tmp2621, tmp2622, tmp2623, tmp2624, tmp2625, tmp2626, tmp2627, tmp2628, tmp2629, tmp2630, tmp2631, tmp2632, tmp2633, tmp2634);
+  }
+
+  if (block119.is_used()) {
+    TNode<Context> tmp2636;
+    TNode<JSArray> tmp2637;
+    TNode<Smi> tmp2638;
+    TNode<JSReceiver> tmp2639;
+    TNode<Object> tmp2640;
+    TNode<Smi> tmp2641;
+    TNode<JSArray> tmp2642;
+    TNode<JSArray> tmp2643;
+    TNode<Map> tmp2644;
+    TNode<BoolT> tmp2645;
+    TNode<FixedArray> tmp2646;
+    TNode<BoolT> tmp2647;
+    TNode<BoolT> tmp2648;
+    TNode<BoolT> tmp2649;
+    TNode<Smi> tmp2650;
+    TNode<Context> tmp2651;
+    TNode<Smi> tmp2652;
+    TNode<Smi> tmp2653;
+    TNode<Int32T> tmp2654;
+    TNode<Map> tmp2655;
+    TNode<JSArray> tmp2656;
+    TNode<FixedDoubleArray> tmp2657;
+    TNode<Smi> tmp2658;
+    ca_.Bind(&block119, &tmp2636, &tmp2637, &tmp2638, &tmp2639, &tmp2640, &tmp2641, &tmp2642, &tmp2643, &tmp2644, &tmp2645, &tmp2646, &tmp2647, &tmp2648, &tmp2649, &tmp2650, &tmp2651, &tmp2652, &tmp2653, &tmp2654, &tmp2655, &tmp2656, &tmp2657, &tmp2658);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 131);
+    TNode<IntPtrT> tmp2659 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp2659);
+    TNode<IntPtrT> tmp2660 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp2660);
+    TNode<Smi>tmp2661 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp2646, tmp2660});
+    TNode<IntPtrT> tmp2662;
+    USE(tmp2662);
+    tmp2662 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp2661});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 55);
+    TNode<IntPtrT> tmp2663;
+    USE(tmp2663);
+    tmp2663 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp2658});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 56);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp2664;
+    USE(tmp2664);
+    tmp2664 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp2663});
+    TNode<UintPtrT> tmp2665;
+    USE(tmp2665);
+    tmp2665 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp2662});
+    TNode<BoolT> tmp2666;
+    USE(tmp2666);
+    tmp2666 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp2664}, TNode<UintPtrT>{tmp2665});
+    ca_.Branch(tmp2666, &block127, &block128, tmp2636, tmp2637, tmp2638, tmp2639, tmp2640, tmp2641, tmp2642, tmp2643, tmp2644, tmp2645, tmp2646, tmp2647, tmp2648, tmp2649, tmp2650, tmp2651, tmp2652, tmp2653, tmp2654, tmp2655, tmp2656, tmp2657, tmp2658, tmp2646, tmp2659, tmp2662, tmp2658, tmp2658, tmp2663, tmp2646, tmp2659, tmp2662, tmp2663, tmp2663);
+  }
+
+  if (block127.is_used()) {
+    TNode<Context> tmp2667;
+    TNode<JSArray> tmp2668;
+    TNode<Smi> tmp2669;
+    TNode<JSReceiver> tmp2670;
+    TNode<Object> tmp2671;
+    TNode<Smi> tmp2672;
+    TNode<JSArray> tmp2673;
+    TNode<JSArray> tmp2674;
+    TNode<Map> tmp2675;
+    TNode<BoolT> tmp2676;
+    TNode<FixedArray> tmp2677;
+    TNode<BoolT> tmp2678;
+    TNode<BoolT> tmp2679;
+    TNode<BoolT> tmp2680;
+    TNode<Smi> tmp2681;
+    TNode<Context> tmp2682;
+    TNode<Smi> tmp2683;
+    TNode<Smi> tmp2684;
+    TNode<Int32T> tmp2685;
+    TNode<Map> tmp2686;
+    TNode<JSArray> tmp2687;
+    TNode<FixedDoubleArray> tmp2688;
+    TNode<Smi> tmp2689;
+    TNode<FixedArray> tmp2690;
+    TNode<IntPtrT> tmp2691;
+    TNode<IntPtrT> tmp2692;
+    TNode<Smi> tmp2693;
+    TNode<Smi> tmp2694;
+    TNode<IntPtrT> tmp2695;
+    TNode<HeapObject> tmp2696;
+    TNode<IntPtrT> tmp2697;
+    TNode<IntPtrT> tmp2698;
+    TNode<IntPtrT> tmp2699;
+    TNode<IntPtrT> tmp2700;
+    ca_.Bind(&block127, &tmp2667, &tmp2668, &tmp2669, &tmp2670, &tmp2671, &tmp2672, &tmp2673, &tmp2674, &tmp2675, &tmp2676, &tmp2677, &tmp2678, &tmp2679, &tmp2680, &tmp2681, &tmp2682, &tmp2683, &tmp2684, &tmp2685, &tmp2686, &tmp2687, &tmp2688, &tmp2689, &tmp2690, &tmp2691, &tmp2692, &tmp2693, &tmp2694, &tmp2695, &tmp2696, &tmp2697, &tmp2698, &tmp2699, &tmp2700);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp2701;
+    USE(tmp2701);
+    tmp2701 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp2702;
+    USE(tmp2702);
+    tmp2702 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp2700}, TNode<IntPtrT>{tmp2701});
+    TNode<IntPtrT> tmp2703;
+    USE(tmp2703);
+    tmp2703 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp2697}, TNode<IntPtrT>{tmp2702});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp2704;
+    USE(tmp2704);
+    TNode<IntPtrT> tmp2705;
+    USE(tmp2705);
+    std::tie(tmp2704, tmp2705) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp2696}, TNode<IntPtrT>{tmp2703}).Flatten();
+    ca_.Goto(&block126, tmp2667, tmp2668, tmp2669, tmp2670, tmp2671, tmp2672, tmp2673, tmp2674, tmp2675, tmp2676, tmp2677, tmp2678, tmp2679, tmp2680, tmp2681, tmp2682, tmp2683, tmp2684, tmp2685, tmp2686, tmp2687, tmp2688, tmp2689, tmp2690, tmp2691, tmp2692, tmp2693, tmp2694, tmp2695, tmp2696, tmp2697, tmp2698, tmp2699, tmp2700, tmp2704, tmp2705);
+  }
+
+  if (block128.is_used()) {
+    TNode<Context> tmp2706;
+    TNode<JSArray> tmp2707;
+    TNode<Smi> tmp2708;
+    TNode<JSReceiver> tmp2709;
+    TNode<Object> tmp2710;
+    TNode<Smi> tmp2711;
+    TNode<JSArray> tmp2712;
+    TNode<JSArray> tmp2713;
+    TNode<Map> tmp2714;
+    TNode<BoolT> tmp2715;
+    TNode<FixedArray> tmp2716;
+    TNode<BoolT> tmp2717;
+    TNode<BoolT> tmp2718;
+    TNode<BoolT> tmp2719;
+    TNode<Smi> tmp2720;
+    TNode<Context> tmp2721;
+    TNode<Smi> tmp2722;
+    TNode<Smi> tmp2723;
+    TNode<Int32T> tmp2724;
+    TNode<Map> tmp2725;
+    TNode<JSArray> tmp2726;
+    TNode<FixedDoubleArray> tmp2727;
+    TNode<Smi> tmp2728;
+    TNode<FixedArray> tmp2729;
+    TNode<IntPtrT> tmp2730;
+    TNode<IntPtrT> tmp2731;
+    TNode<Smi> tmp2732;
+    TNode<Smi> tmp2733;
+    TNode<IntPtrT> tmp2734;
+    TNode<HeapObject> tmp2735;
+    TNode<IntPtrT> tmp2736;
+    TNode<IntPtrT> tmp2737;
+    TNode<IntPtrT> tmp2738;
+    TNode<IntPtrT> tmp2739;
+    ca_.Bind(&block128, &tmp2706, &tmp2707, &tmp2708, &tmp2709, &tmp2710, &tmp2711, &tmp2712, &tmp2713, &tmp2714, &tmp2715, &tmp2716, &tmp2717, &tmp2718, &tmp2719, &tmp2720, &tmp2721, &tmp2722, &tmp2723, &tmp2724, &tmp2725, &tmp2726, &tmp2727, &tmp2728, &tmp2729, &tmp2730, &tmp2731, &tmp2732, &tmp2733, &tmp2734, &tmp2735, &tmp2736, &tmp2737, &tmp2738, &tmp2739);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block125, tmp2706, tmp2707, tmp2708, tmp2709, tmp2710, tmp2711, tmp2712, tmp2713, tmp2714, tmp2715, tmp2716, tmp2717, tmp2718, tmp2719, tmp2720, tmp2721, tmp2722, tmp2723, tmp2724, tmp2725, tmp2726, tmp2727, tmp2728, tmp2729, tmp2730, tmp2731, tmp2732, tmp2733, tmp2734);
+  }
+
+  if (block126.is_used()) {
+    TNode<Context> tmp2740;
+    TNode<JSArray> tmp2741;
+    TNode<Smi> tmp2742;
+    TNode<JSReceiver> tmp2743;
+    TNode<Object> tmp2744;
+    TNode<Smi> tmp2745;
+    TNode<JSArray> tmp2746;
+    TNode<JSArray> tmp2747;
+    TNode<Map> tmp2748;
+    TNode<BoolT> tmp2749;
+    TNode<FixedArray> tmp2750;
+    TNode<BoolT> tmp2751;
+    TNode<BoolT> tmp2752;
+    TNode<BoolT> tmp2753;
+    TNode<Smi> tmp2754;
+    TNode<Context> tmp2755;
+    TNode<Smi> tmp2756;
+    TNode<Smi> tmp2757;
+    TNode<Int32T> tmp2758;
+    TNode<Map> tmp2759;
+    TNode<JSArray> tmp2760;
+    TNode<FixedDoubleArray> tmp2761;
+    TNode<Smi> tmp2762;
+    TNode<FixedArray> tmp2763;
+    TNode<IntPtrT> tmp2764;
+    TNode<IntPtrT> tmp2765;
+    TNode<Smi> tmp2766;
+    TNode<Smi> tmp2767;
+    TNode<IntPtrT> tmp2768;
+    TNode<HeapObject> tmp2769;
+    TNode<IntPtrT> tmp2770;
+    TNode<IntPtrT> tmp2771;
+    TNode<IntPtrT> tmp2772;
+    TNode<IntPtrT> tmp2773;
+    TNode<HeapObject> tmp2774;
+    TNode<IntPtrT> tmp2775;
+    ca_.Bind(&block126, &tmp2740, &tmp2741, &tmp2742, &tmp2743, &tmp2744, &tmp2745, &tmp2746, &tmp2747, &tmp2748, &tmp2749, &tmp2750, &tmp2751, &tmp2752, &tmp2753, &tmp2754, &tmp2755, &tmp2756, &tmp2757, &tmp2758, &tmp2759, &tmp2760, &tmp2761, &tmp2762, &tmp2763, &tmp2764, &tmp2765, &tmp2766, &tmp2767, &tmp2768, &tmp2769, &tmp2770, &tmp2771, &tmp2772, &tmp2773, &tmp2774, &tmp2775);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 56);
+    ca_.Goto(&block124, tmp2740, tmp2741, tmp2742, tmp2743, tmp2744, tmp2745, tmp2746, tmp2747, tmp2748, tmp2749, tmp2750, tmp2751, tmp2752, tmp2753, tmp2754, tmp2755, tmp2756, tmp2757, tmp2758, tmp2759, tmp2760, tmp2761, tmp2762, tmp2763, tmp2764, tmp2765, tmp2766, tmp2767, tmp2768, tmp2774, tmp2775);
+  }
+
+  if (block125.is_used()) {
+    TNode<Context> tmp2776;
+    TNode<JSArray> tmp2777;
+    TNode<Smi> tmp2778;
+    TNode<JSReceiver> tmp2779;
+    TNode<Object> tmp2780;
+    TNode<Smi> tmp2781;
+    TNode<JSArray> tmp2782;
+    TNode<JSArray> tmp2783;
+    TNode<Map> tmp2784;
+    TNode<BoolT> tmp2785;
+    TNode<FixedArray> tmp2786;
+    TNode<BoolT> tmp2787;
+    TNode<BoolT> tmp2788;
+    TNode<BoolT> tmp2789;
+    TNode<Smi> tmp2790;
+    TNode<Context> tmp2791;
+    TNode<Smi> tmp2792;
+    TNode<Smi> tmp2793;
+    TNode<Int32T> tmp2794;
+    TNode<Map> tmp2795;
+    TNode<JSArray> tmp2796;
+    TNode<FixedDoubleArray> tmp2797;
+    TNode<Smi> tmp2798;
+    TNode<FixedArray> tmp2799;
+    TNode<IntPtrT> tmp2800;
+    TNode<IntPtrT> tmp2801;
+    TNode<Smi> tmp2802;
+    TNode<Smi> tmp2803;
+    TNode<IntPtrT> tmp2804;
+    ca_.Bind(&block125, &tmp2776, &tmp2777, &tmp2778, &tmp2779, &tmp2780, &tmp2781, &tmp2782, &tmp2783, &tmp2784, &tmp2785, &tmp2786, &tmp2787, &tmp2788, &tmp2789, &tmp2790, &tmp2791, &tmp2792, &tmp2793, &tmp2794, &tmp2795, &tmp2796, &tmp2797, &tmp2798, &tmp2799, &tmp2800, &tmp2801, &tmp2802, &tmp2803, &tmp2804);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block124.is_used()) {
+    TNode<Context> tmp2805;
+    TNode<JSArray> tmp2806;
+    TNode<Smi> tmp2807;
+    TNode<JSReceiver> tmp2808;
+    TNode<Object> tmp2809;
+    TNode<Smi> tmp2810;
+    TNode<JSArray> tmp2811;
+    TNode<JSArray> tmp2812;
+    TNode<Map> tmp2813;
+    TNode<BoolT> tmp2814;
+    TNode<FixedArray> tmp2815;
+    TNode<BoolT> tmp2816;
+    TNode<BoolT> tmp2817;
+    TNode<BoolT> tmp2818;
+    TNode<Smi> tmp2819;
+    TNode<Context> tmp2820;
+    TNode<Smi> tmp2821;
+    TNode<Smi> tmp2822;
+    TNode<Int32T> tmp2823;
+    TNode<Map> tmp2824;
+    TNode<JSArray> tmp2825;
+    TNode<FixedDoubleArray> tmp2826;
+    TNode<Smi> tmp2827;
+    TNode<FixedArray> tmp2828;
+    TNode<IntPtrT> tmp2829;
+    TNode<IntPtrT> tmp2830;
+    TNode<Smi> tmp2831;
+    TNode<Smi> tmp2832;
+    TNode<IntPtrT> tmp2833;
+    TNode<HeapObject> tmp2834;
+    TNode<IntPtrT> tmp2835;
+    ca_.Bind(&block124, &tmp2805, &tmp2806, &tmp2807, &tmp2808, &tmp2809, &tmp2810, &tmp2811, &tmp2812, &tmp2813, &tmp2814, &tmp2815, &tmp2816, &tmp2817, &tmp2818, &tmp2819, &tmp2820, &tmp2821, &tmp2822, &tmp2823, &tmp2824, &tmp2825, &tmp2826, &tmp2827, &tmp2828, &tmp2829, &tmp2830, &tmp2831, &tmp2832, &tmp2833, &tmp2834, &tmp2835);
+    ca_.Goto(&block123, tmp2805, tmp2806, tmp2807, tmp2808, tmp2809, tmp2810, tmp2811, tmp2812, tmp2813, tmp2814, tmp2815, tmp2816, tmp2817, tmp2818, tmp2819, tmp2820, tmp2821, tmp2822, tmp2823, tmp2824, tmp2825, tmp2826, tmp2827, tmp2828, tmp2829, tmp2830, tmp2831, tmp2832, tmp2834, tmp2835);
+  }
+
+  if (block123.is_used()) {
+    TNode<Context> tmp2836;
+    TNode<JSArray> tmp2837;
+    TNode<Smi> tmp2838;
+    TNode<JSReceiver> tmp2839;
+    TNode<Object> tmp2840;
+    TNode<Smi> tmp2841;
+    TNode<JSArray> tmp2842;
+    TNode<JSArray> tmp2843;
+    TNode<Map> tmp2844;
+    TNode<BoolT> tmp2845;
+    TNode<FixedArray> tmp2846;
+    TNode<BoolT> tmp2847;
+    TNode<BoolT> tmp2848;
+    TNode<BoolT> tmp2849;
+    TNode<Smi> tmp2850;
+    TNode<Context> tmp2851;
+    TNode<Smi> tmp2852;
+    TNode<Smi> tmp2853;
+    TNode<Int32T> tmp2854;
+    TNode<Map> tmp2855;
+    TNode<JSArray> tmp2856;
+    TNode<FixedDoubleArray> tmp2857;
+    TNode<Smi> tmp2858;
+    TNode<FixedArray> tmp2859;
+    TNode<IntPtrT> tmp2860;
+    TNode<IntPtrT> tmp2861;
+    TNode<Smi> tmp2862;
+    TNode<Smi> tmp2863;
+    TNode<HeapObject> tmp2864;
+    TNode<IntPtrT> tmp2865;
+    ca_.Bind(&block123, &tmp2836, &tmp2837, &tmp2838, &tmp2839, &tmp2840, &tmp2841, &tmp2842, &tmp2843, &tmp2844, &tmp2845, &tmp2846, &tmp2847, &tmp2848, &tmp2849, &tmp2850, &tmp2851, &tmp2852, &tmp2853, &tmp2854, &tmp2855, &tmp2856, &tmp2857, &tmp2858, &tmp2859, &tmp2860, &tmp2861, &tmp2862, &tmp2863, &tmp2864, &tmp2865);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 131);
+    TNode<Object>tmp2866 = CodeStubAssembler(state_).LoadReference<Object>(CodeStubAssembler::Reference{tmp2864, tmp2865});
+    TNode<Object> tmp2867;
+    USE(tmp2867);
+    tmp2867 = UnsafeCast30UT5ATSmi9ATTheHole10HeapNumber_1386(state_, TNode<Context>{tmp2851}, TNode<Object>{tmp2866});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 132);
+    TNode<Number> tmp2868;
+    USE(tmp2868);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp2868 = Cast20UT5ATSmi10HeapNumber_85(state_, TNode<Object>{tmp2867}, &label0);
+    ca_.Goto(&block132, tmp2836, tmp2837, tmp2838, tmp2839, tmp2840, tmp2841, tmp2842, tmp2843, tmp2844, tmp2845, tmp2846, tmp2847, tmp2848, tmp2849, tmp2850, tmp2851, tmp2852, tmp2853, tmp2854, tmp2855, tmp2856, tmp2857, tmp2858, tmp2867, tmp2867, tmp2868);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block133, tmp2836, tmp2837, tmp2838, tmp2839, tmp2840, tmp2841, tmp2842, tmp2843, tmp2844, tmp2845, tmp2846, tmp2847, tmp2848, tmp2849, tmp2850, tmp2851, tmp2852, tmp2853, tmp2854, tmp2855, tmp2856, tmp2857, tmp2858, tmp2867, tmp2867);
+    }
+  }
+
+  if (block133.is_used()) {
+    TNode<Context> tmp2869;
+    TNode<JSArray> tmp2870;
+    TNode<Smi> tmp2871;
+    TNode<JSReceiver> tmp2872;
+    TNode<Object> tmp2873;
+    TNode<Smi> tmp2874;
+    TNode<JSArray> tmp2875;
+    TNode<JSArray> tmp2876;
+    TNode<Map> tmp2877;
+    TNode<BoolT> tmp2878;
+    TNode<FixedArray> tmp2879;
+    TNode<BoolT> tmp2880;
+    TNode<BoolT> tmp2881;
+    TNode<BoolT> tmp2882;
+    TNode<Smi> tmp2883;
+    TNode<Context> tmp2884;
+    TNode<Smi> tmp2885;
+    TNode<Smi> tmp2886;
+    TNode<Int32T> tmp2887;
+    TNode<Map> tmp2888;
+    TNode<JSArray> tmp2889;
+    TNode<FixedDoubleArray> tmp2890;
+    TNode<Smi> tmp2891;
+    TNode<Object> tmp2892;
+    TNode<Object> tmp2893;
+    ca_.Bind(&block133, &tmp2869, &tmp2870, &tmp2871, &tmp2872, &tmp2873, &tmp2874, &tmp2875, &tmp2876, &tmp2877, &tmp2878, &tmp2879, &tmp2880, &tmp2881, &tmp2882, &tmp2883, &tmp2884, &tmp2885, &tmp2886, &tmp2887, &tmp2888, &tmp2889, &tmp2890, &tmp2891, &tmp2892, &tmp2893);
+    ca_.Goto(&block131, tmp2869, tmp2870, tmp2871, tmp2872, tmp2873, tmp2874, tmp2875, tmp2876, tmp2877, tmp2878, tmp2879, tmp2880, tmp2881, tmp2882, tmp2883, tmp2884, tmp2885, tmp2886, tmp2887, tmp2888, tmp2889, tmp2890, tmp2891, tmp2892);
+  }
+
+  if (block132.is_used()) {
+    TNode<Context> tmp2894;
+    TNode<JSArray> tmp2895;
+    TNode<Smi> tmp2896;
+    TNode<JSReceiver> tmp2897;
+    TNode<Object> tmp2898;
+    TNode<Smi> tmp2899;
+    TNode<JSArray> tmp2900;
+    TNode<JSArray> tmp2901;
+    TNode<Map> tmp2902;
+    TNode<BoolT> tmp2903;
+    TNode<FixedArray> tmp2904;
+    TNode<BoolT> tmp2905;
+    TNode<BoolT> tmp2906;
+    TNode<BoolT> tmp2907;
+    TNode<Smi> tmp2908;
+    TNode<Context> tmp2909;
+    TNode<Smi> tmp2910;
+    TNode<Smi> tmp2911;
+    TNode<Int32T> tmp2912;
+    TNode<Map> tmp2913;
+    TNode<JSArray> tmp2914;
+    TNode<FixedDoubleArray> tmp2915;
+    TNode<Smi> tmp2916;
+    TNode<Object> tmp2917;
+    TNode<Object> tmp2918;
+    TNode<Number> tmp2919;
+    ca_.Bind(&block132, &tmp2894, &tmp2895, &tmp2896, &tmp2897, &tmp2898, &tmp2899, &tmp2900, &tmp2901, &tmp2902, &tmp2903, &tmp2904, &tmp2905, &tmp2906, &tmp2907, &tmp2908, &tmp2909, &tmp2910, &tmp2911, &tmp2912, &tmp2913, &tmp2914, &tmp2915, &tmp2916, &tmp2917, &tmp2918, &tmp2919);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 133);
+    TNode<IntPtrT> tmp2920 = ca_.IntPtrConstant(FixedDoubleArray::kFloatsOffset);
+    USE(tmp2920);
+    TNode<IntPtrT> tmp2921 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp2921);
+    TNode<Smi>tmp2922 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp2915, tmp2921});
+    TNode<IntPtrT> tmp2923;
+    USE(tmp2923);
+    tmp2923 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp2922});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 55);
+    TNode<IntPtrT> tmp2924;
+    USE(tmp2924);
+    tmp2924 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp2916});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 56);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp2925;
+    USE(tmp2925);
+    tmp2925 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp2924});
+    TNode<UintPtrT> tmp2926;
+    USE(tmp2926);
+    tmp2926 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp2923});
+    TNode<BoolT> tmp2927;
+    USE(tmp2927);
+    tmp2927 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp2925}, TNode<UintPtrT>{tmp2926});
+    ca_.Branch(tmp2927, &block138, &block139, tmp2894, tmp2895, tmp2896, tmp2897, tmp2898, tmp2899, tmp2900, tmp2901, tmp2902, tmp2903, tmp2904, tmp2905, tmp2906, tmp2907, tmp2908, tmp2909, tmp2910, tmp2911, tmp2912, tmp2913, tmp2914, tmp2915, tmp2916, tmp2917, tmp2919, tmp2915, tmp2920, tmp2923, tmp2916, tmp2916, tmp2924, tmp2915, tmp2920, tmp2923, tmp2924, tmp2924);
+  }
+
+  if (block138.is_used()) {
+    TNode<Context> tmp2928;
+    TNode<JSArray> tmp2929;
+    TNode<Smi> tmp2930;
+    TNode<JSReceiver> tmp2931;
+    TNode<Object> tmp2932;
+    TNode<Smi> tmp2933;
+    TNode<JSArray> tmp2934;
+    TNode<JSArray> tmp2935;
+    TNode<Map> tmp2936;
+    TNode<BoolT> tmp2937;
+    TNode<FixedArray> tmp2938;
+    TNode<BoolT> tmp2939;
+    TNode<BoolT> tmp2940;
+    TNode<BoolT> tmp2941;
+    TNode<Smi> tmp2942;
+    TNode<Context> tmp2943;
+    TNode<Smi> tmp2944;
+    TNode<Smi> tmp2945;
+    TNode<Int32T> tmp2946;
+    TNode<Map> tmp2947;
+    TNode<JSArray> tmp2948;
+    TNode<FixedDoubleArray> tmp2949;
+    TNode<Smi> tmp2950;
+    TNode<Object> tmp2951;
+    TNode<Number> tmp2952;
+    TNode<FixedDoubleArray> tmp2953;
+    TNode<IntPtrT> tmp2954;
+    TNode<IntPtrT> tmp2955;
+    TNode<Smi> tmp2956;
+    TNode<Smi> tmp2957;
+    TNode<IntPtrT> tmp2958;
+    TNode<HeapObject> tmp2959;
+    TNode<IntPtrT> tmp2960;
+    TNode<IntPtrT> tmp2961;
+    TNode<IntPtrT> tmp2962;
+    TNode<IntPtrT> tmp2963;
+    ca_.Bind(&block138, &tmp2928, &tmp2929, &tmp2930, &tmp2931, &tmp2932, &tmp2933, &tmp2934, &tmp2935, &tmp2936, &tmp2937, &tmp2938, &tmp2939, &tmp2940, &tmp2941, &tmp2942, &tmp2943, &tmp2944, &tmp2945, &tmp2946, &tmp2947, &tmp2948, &tmp2949, &tmp2950, &tmp2951, &tmp2952, &tmp2953, &tmp2954, &tmp2955, &tmp2956, &tmp2957, &tmp2958, &tmp2959, &tmp2960, &tmp2961, &tmp2962, &tmp2963);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp2964;
+    USE(tmp2964);
+    tmp2964 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf9ATfloat64_355(state_)));
+    TNode<IntPtrT> tmp2965;
+    USE(tmp2965);
+    tmp2965 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp2963}, TNode<IntPtrT>{tmp2964});
+    TNode<IntPtrT> tmp2966;
+    USE(tmp2966);
+    tmp2966 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp2960}, TNode<IntPtrT>{tmp2965});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp2967;
+    USE(tmp2967);
+    TNode<IntPtrT> tmp2968;
+    USE(tmp2968);
+    std::tie(tmp2967, tmp2968) = UnsafeNewReference9ATfloat64_1387(state_, TNode<HeapObject>{tmp2959}, TNode<IntPtrT>{tmp2966}).Flatten();
+    ca_.Goto(&block137, tmp2928, tmp2929, tmp2930, tmp2931, tmp2932, tmp2933, tmp2934, tmp2935, tmp2936, tmp2937, tmp2938, tmp2939, tmp2940, tmp2941, tmp2942, tmp2943, tmp2944, tmp2945, tmp2946, tmp2947, tmp2948, tmp2949, tmp2950, tmp2951, tmp2952, tmp2953, tmp2954, tmp2955, tmp2956, tmp2957, tmp2958, tmp2959, tmp2960, tmp2961, tmp2962, tmp2963, tmp2967, tmp2968);
+  }
+
+  if (block139.is_used()) {
+    TNode<Context> tmp2969;
+    TNode<JSArray> tmp2970;
+    TNode<Smi> tmp2971;
+    TNode<JSReceiver> tmp2972;
+    TNode<Object> tmp2973;
+    TNode<Smi> tmp2974;
+    TNode<JSArray> tmp2975;
+    TNode<JSArray> tmp2976;
+    TNode<Map> tmp2977;
+    TNode<BoolT> tmp2978;
+    TNode<FixedArray> tmp2979;
+    TNode<BoolT> tmp2980;
+    TNode<BoolT> tmp2981;
+    TNode<BoolT> tmp2982;
+    TNode<Smi> tmp2983;
+    TNode<Context> tmp2984;
+    TNode<Smi> tmp2985;
+    TNode<Smi> tmp2986;
+    TNode<Int32T> tmp2987;
+    TNode<Map> tmp2988;
+    TNode<JSArray> tmp2989;
+    TNode<FixedDoubleArray> tmp2990;
+    TNode<Smi> tmp2991;
+    TNode<Object> tmp2992;
+    TNode<Number> tmp2993;
+    TNode<FixedDoubleArray> tmp2994;
+    TNode<IntPtrT> tmp2995;
+    TNode<IntPtrT> tmp2996;
+    TNode<Smi> tmp2997;
+    TNode<Smi> tmp2998;
+    TNode<IntPtrT> tmp2999;
+    TNode<HeapObject> tmp3000;
+    TNode<IntPtrT> tmp3001;
+    TNode<IntPtrT> tmp3002;
+    TNode<IntPtrT> tmp3003;
+    TNode<IntPtrT> tmp3004;
+    ca_.Bind(&block139, &tmp2969, &tmp2970, &tmp2971, &tmp2972, &tmp2973, &tmp2974, &tmp2975, &tmp2976, &tmp2977, &tmp2978, &tmp2979, &tmp2980, &tmp2981, &tmp2982, &tmp2983, &tmp2984, &tmp2985, &tmp2986, &tmp2987, &tmp2988, &tmp2989, &tmp2990, &tmp2991, &tmp2992, &tmp2993, &tmp2994, &tmp2995, &tmp2996, &tmp2997, &tmp2998, &tmp2999, &tmp3000, &tmp3001, &tmp3002, &tmp3003, &tmp3004);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block136, tmp2969, tmp2970, tmp2971, tmp2972, tmp2973, tmp2974, tmp2975, tmp2976, tmp2977, tmp2978, tmp2979, tmp2980, tmp2981, tmp2982, tmp2983, tmp2984, tmp2985, tmp2986, tmp2987, tmp2988, tmp2989, tmp2990, tmp2991, tmp2992, tmp2993, tmp2994, tmp2995, tmp2996, tmp2997, tmp2998, tmp2999);
+  }
+
+  if (block137.is_used()) {
+    TNode<Context> tmp3005;
+    TNode<JSArray> tmp3006;
+    TNode<Smi> tmp3007;
+    TNode<JSReceiver> tmp3008;
+    TNode<Object> tmp3009;
+    TNode<Smi> tmp3010;
+    TNode<JSArray> tmp3011;
+    TNode<JSArray> tmp3012;
+    TNode<Map> tmp3013;
+    TNode<BoolT> tmp3014;
+    TNode<FixedArray> tmp3015;
+    TNode<BoolT> tmp3016;
+    TNode<BoolT> tmp3017;
+    TNode<BoolT> tmp3018;
+    TNode<Smi> tmp3019;
+    TNode<Context> tmp3020;
+    TNode<Smi> tmp3021;
+    TNode<Smi> tmp3022;
+    TNode<Int32T> tmp3023;
+    TNode<Map> tmp3024;
+    TNode<JSArray> tmp3025;
+    TNode<FixedDoubleArray> tmp3026;
+    TNode<Smi> tmp3027;
+    TNode<Object> tmp3028;
+    TNode<Number> tmp3029;
+    TNode<FixedDoubleArray> tmp3030;
+    TNode<IntPtrT> tmp3031;
+    TNode<IntPtrT> tmp3032;
+    TNode<Smi> tmp3033;
+    TNode<Smi> tmp3034;
+    TNode<IntPtrT> tmp3035;
+    TNode<HeapObject> tmp3036;
+    TNode<IntPtrT> tmp3037;
+    TNode<IntPtrT> tmp3038;
+    TNode<IntPtrT> tmp3039;
+    TNode<IntPtrT> tmp3040;
+    TNode<HeapObject> tmp3041;
+    TNode<IntPtrT> tmp3042;
+    ca_.Bind(&block137, &tmp3005, &tmp3006, &tmp3007, &tmp3008, &tmp3009, &tmp3010, &tmp3011, &tmp3012, &tmp3013, &tmp3014, &tmp3015, &tmp3016, &tmp3017, &tmp3018, &tmp3019, &tmp3020, &tmp3021, &tmp3022, &tmp3023, &tmp3024, &tmp3025, &tmp3026, &tmp3027, &tmp3028, &tmp3029, &tmp3030, &tmp3031, &tmp3032, &tmp3033, &tmp3034, &tmp3035, &tmp3036, &tmp3037, &tmp3038, &tmp3039, &tmp3040, &tmp3041, &tmp3042);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 56);
+    ca_.Goto(&block135, tmp3005, tmp3006, tmp3007, tmp3008, tmp3009, tmp3010, tmp3011, tmp3012, tmp3013, tmp3014, tmp3015, tmp3016, tmp3017, tmp3018, tmp3019, tmp3020, tmp3021, tmp3022, tmp3023, tmp3024, tmp3025, tmp3026, tmp3027, tmp3028, tmp3029, tmp3030, tmp3031, tmp3032, tmp3033, tmp3034, tmp3035, tmp3041, tmp3042);
+  }
+
+  if (block136.is_used()) {
+    TNode<Context> tmp3043;
+    TNode<JSArray> tmp3044;
+    TNode<Smi> tmp3045;
+    TNode<JSReceiver> tmp3046;
+    TNode<Object> tmp3047;
+    TNode<Smi> tmp3048;
+    TNode<JSArray> tmp3049;
+    TNode<JSArray> tmp3050;
+    TNode<Map> tmp3051;
+    TNode<BoolT> tmp3052;
+    TNode<FixedArray> tmp3053;
+    TNode<BoolT> tmp3054;
+    TNode<BoolT> tmp3055;
+    TNode<BoolT> tmp3056;
+    TNode<Smi> tmp3057;
+    TNode<Context> tmp3058;
+    TNode<Smi> tmp3059;
+    TNode<Smi> tmp3060;
+    TNode<Int32T> tmp3061;
+    TNode<Map> tmp3062;
+    TNode<JSArray> tmp3063;
+    TNode<FixedDoubleArray> tmp3064;
+    TNode<Smi> tmp3065;
+    TNode<Object> tmp3066;
+    TNode<Number> tmp3067;
+    TNode<FixedDoubleArray> tmp3068;
+    TNode<IntPtrT> tmp3069;
+    TNode<IntPtrT> tmp3070;
+    TNode<Smi> tmp3071;
+    TNode<Smi> tmp3072;
+    TNode<IntPtrT> tmp3073;
+    ca_.Bind(&block136, &tmp3043, &tmp3044, &tmp3045, &tmp3046, &tmp3047, &tmp3048, &tmp3049, &tmp3050, &tmp3051, &tmp3052, &tmp3053, &tmp3054, &tmp3055, &tmp3056, &tmp3057, &tmp3058, &tmp3059, &tmp3060, &tmp3061, &tmp3062, &tmp3063, &tmp3064, &tmp3065, &tmp3066, &tmp3067, &tmp3068, &tmp3069, &tmp3070, &tmp3071, &tmp3072, &tmp3073);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block135.is_used()) {
+    TNode<Context> tmp3074;
+    TNode<JSArray> tmp3075;
+    TNode<Smi> tmp3076;
+    TNode<JSReceiver> tmp3077;
+    TNode<Object> tmp3078;
+    TNode<Smi> tmp3079;
+    TNode<JSArray> tmp3080;
+    TNode<JSArray> tmp3081;
+    TNode<Map> tmp3082;
+    TNode<BoolT> tmp3083;
+    TNode<FixedArray> tmp3084;
+    TNode<BoolT> tmp3085;
+    TNode<BoolT> tmp3086;
+    TNode<BoolT> tmp3087;
+    TNode<Smi> tmp3088;
+    TNode<Context> tmp3089;
+    TNode<Smi> tmp3090;
+    TNode<Smi> tmp3091;
+    TNode<Int32T> tmp3092;
+    TNode<Map> tmp3093;
+    TNode<JSArray> tmp3094;
+    TNode<FixedDoubleArray> tmp3095;
+    TNode<Smi> tmp3096;
+    TNode<Object> tmp3097;
+    TNode<Number> tmp3098;
+    TNode<FixedDoubleArray> tmp3099;
+    TNode<IntPtrT> tmp3100;
+    TNode<IntPtrT> tmp3101;
+    TNode<Smi> tmp3102;
+    TNode<Smi> tmp3103;
+    TNode<IntPtrT> tmp3104;
+    TNode<HeapObject> tmp3105;
+    TNode<IntPtrT> tmp3106;
+    ca_.Bind(&block135, &tmp3074, &tmp3075, &tmp3076, &tmp3077, &tmp3078, &tmp3079, &tmp3080, &tmp3081, &tmp3082, &tmp3083, &tmp3084, &tmp3085, &tmp3086, &tmp3087, &tmp3088, &tmp3089, &tmp3090, &tmp3091, &tmp3092, &tmp3093, &tmp3094, &tmp3095, &tmp3096, &tmp3097, &tmp3098, &tmp3099, &tmp3100, &tmp3101, &tmp3102, &tmp3103, &tmp3104, &tmp3105, &tmp3106);
+    ca_.Goto(&block134, tmp3074, tmp3075, tmp3076, tmp3077, tmp3078, tmp3079, tmp3080, tmp3081, tmp3082, tmp3083, tmp3084, tmp3085, tmp3086, tmp3087, tmp3088, tmp3089, tmp3090, tmp3091, tmp3092, tmp3093, tmp3094, tmp3095, tmp3096, tmp3097, tmp3098, tmp3099, tmp3100, tmp3101, tmp3102, tmp3103, tmp3105, tmp3106);
+  }
+
+  if (block134.is_used()) {
+    TNode<Context> tmp3107;
+    TNode<JSArray> tmp3108;
+    TNode<Smi> tmp3109;
+    TNode<JSReceiver> tmp3110;
+    TNode<Object> tmp3111;
+    TNode<Smi> tmp3112;
+    TNode<JSArray> tmp3113;
+    TNode<JSArray> tmp3114;
+    TNode<Map> tmp3115;
+    TNode<BoolT> tmp3116;
+    TNode<FixedArray> tmp3117;
+    TNode<BoolT> tmp3118;
+    TNode<BoolT> tmp3119;
+    TNode<BoolT> tmp3120;
+    TNode<Smi> tmp3121;
+    TNode<Context> tmp3122;
+    TNode<Smi> tmp3123;
+    TNode<Smi> tmp3124;
+    TNode<Int32T> tmp3125;
+    TNode<Map> tmp3126;
+    TNode<JSArray> tmp3127;
+    TNode<FixedDoubleArray> tmp3128;
+    TNode<Smi> tmp3129;
+    TNode<Object> tmp3130;
+    TNode<Number> tmp3131;
+    TNode<FixedDoubleArray> tmp3132;
+    TNode<IntPtrT> tmp3133;
+    TNode<IntPtrT> tmp3134;
+    TNode<Smi> tmp3135;
+    TNode<Smi> tmp3136;
+    TNode<HeapObject> tmp3137;
+    TNode<IntPtrT> tmp3138;
+    ca_.Bind(&block134, &tmp3107, &tmp3108, &tmp3109, &tmp3110, &tmp3111, &tmp3112, &tmp3113, &tmp3114, &tmp3115, &tmp3116, &tmp3117, &tmp3118, &tmp3119, &tmp3120, &tmp3121, &tmp3122, &tmp3123, &tmp3124, &tmp3125, &tmp3126, &tmp3127, &tmp3128, &tmp3129, &tmp3130, &tmp3131, &tmp3132, &tmp3133, &tmp3134, &tmp3135, &tmp3136, &tmp3137, &tmp3138);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 133);
+    TNode<Float64T> tmp3139;
+    USE(tmp3139);
+    tmp3139 = Convert9ATfloat6420UT5ATSmi10HeapNumber_197(state_, TNode<Number>{tmp3131});
+    TNode<Float64T> tmp3140;
+    USE(tmp3140);
+    tmp3140 = CodeStubAssembler(state_).Float64SilenceNaN(TNode<Float64T>{tmp3139});
+    CodeStubAssembler(state_).StoreReference(CodeStubAssembler::Reference{tmp3137, tmp3138}, tmp3140);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 132);
+    ca_.Goto(&block130, tmp3107, tmp3108, tmp3109, tmp3110, tmp3111, tmp3112, tmp3113, tmp3114, tmp3115, tmp3116, tmp3117, tmp3118, tmp3119, tmp3120, tmp3121, tmp3122, tmp3123, tmp3124, tmp3125, tmp3126, tmp3127, tmp3128, tmp3129, tmp3130);
+  }
+
+  if (block131.is_used()) {
+    TNode<Context> tmp3141;
+    TNode<JSArray> tmp3142;
+    TNode<Smi> tmp3143;
+    TNode<JSReceiver> tmp3144;
+    TNode<Object> tmp3145;
+    TNode<Smi> tmp3146;
+    TNode<JSArray> tmp3147;
+    TNode<JSArray> tmp3148;
+    TNode<Map> tmp3149;
+    TNode<BoolT> tmp3150;
+    TNode<FixedArray> tmp3151;
+    TNode<BoolT> tmp3152;
+    TNode<BoolT> tmp3153;
+    TNode<BoolT> tmp3154;
+    TNode<Smi> tmp3155;
+    TNode<Context> tmp3156;
+    TNode<Smi> tmp3157;
+    TNode<Smi> tmp3158;
+    TNode<Int32T> tmp3159;
+    TNode<Map> tmp3160;
+    TNode<JSArray> tmp3161;
+    TNode<FixedDoubleArray> tmp3162;
+    TNode<Smi> tmp3163;
+    TNode<Object> tmp3164;
+    ca_.Bind(&block131, &tmp3141, &tmp3142, &tmp3143, &tmp3144, &tmp3145, &tmp3146, &tmp3147, &tmp3148, &tmp3149, &tmp3150, &tmp3151, &tmp3152, &tmp3153, &tmp3154, &tmp3155, &tmp3156, &tmp3157, &tmp3158, &tmp3159, &tmp3160, &tmp3161, &tmp3162, &tmp3163, &tmp3164);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 135);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 132);
+    ca_.Goto(&block130, tmp3141, tmp3142, tmp3143, tmp3144, tmp3145, tmp3146, tmp3147, tmp3148, tmp3149, tmp3150, tmp3151, tmp3152, tmp3153, tmp3154, tmp3155, tmp3156, tmp3157, tmp3158, tmp3159, tmp3160, tmp3161, tmp3162, tmp3163, tmp3164);
+  }
+
+  if (block130.is_used()) {
+    TNode<Context> tmp3165;
+    TNode<JSArray> tmp3166;
+    TNode<Smi> tmp3167;
+    TNode<JSReceiver> tmp3168;
+    TNode<Object> tmp3169;
+    TNode<Smi> tmp3170;
+    TNode<JSArray> tmp3171;
+    TNode<JSArray> tmp3172;
+    TNode<Map> tmp3173;
+    TNode<BoolT> tmp3174;
+    TNode<FixedArray> tmp3175;
+    TNode<BoolT> tmp3176;
+    TNode<BoolT> tmp3177;
+    TNode<BoolT> tmp3178;
+    TNode<Smi> tmp3179;
+    TNode<Context> tmp3180;
+    TNode<Smi> tmp3181;
+    TNode<Smi> tmp3182;
+    TNode<Int32T> tmp3183;
+    TNode<Map> tmp3184;
+    TNode<JSArray> tmp3185;
+    TNode<FixedDoubleArray> tmp3186;
+    TNode<Smi> tmp3187;
+    TNode<Object> tmp3188;
+    ca_.Bind(&block130, &tmp3165, &tmp3166, &tmp3167, &tmp3168, &tmp3169, &tmp3170, &tmp3171, &tmp3172, &tmp3173, &tmp3174, &tmp3175, &tmp3176, &tmp3177, &tmp3178, &tmp3179, &tmp3180, &tmp3181, &tmp3182, &tmp3183, &tmp3184, &tmp3185, &tmp3186, &tmp3187, &tmp3188);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 130);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 129);
+    ca_.Goto(&block122, tmp3165, tmp3166, tmp3167, tmp3168, tmp3169, tmp3170, tmp3171, tmp3172, tmp3173, tmp3174, tmp3175, tmp3176, tmp3177, tmp3178, tmp3179, tmp3180, tmp3181, tmp3182, tmp3183, tmp3184, tmp3185, tmp3186, tmp3187);
+  }
+
+  if (block122.is_used()) {
+    TNode<Context> tmp3189;
+    TNode<JSArray> tmp3190;
+    TNode<Smi> tmp3191;
+    TNode<JSReceiver> tmp3192;
+    TNode<Object> tmp3193;
+    TNode<Smi> tmp3194;
+    TNode<JSArray> tmp3195;
+    TNode<JSArray> tmp3196;
+    TNode<Map> tmp3197;
+    TNode<BoolT> tmp3198;
+    TNode<FixedArray> tmp3199;
+    TNode<BoolT> tmp3200;
+    TNode<BoolT> tmp3201;
+    TNode<BoolT> tmp3202;
+    TNode<Smi> tmp3203;
+    TNode<Context> tmp3204;
+    TNode<Smi> tmp3205;
+    TNode<Smi> tmp3206;
+    TNode<Int32T> tmp3207;
+    TNode<Map> tmp3208;
+    TNode<JSArray> tmp3209;
+    TNode<FixedDoubleArray> tmp3210;
+    TNode<Smi> tmp3211;
+    ca_.Bind(&block122, &tmp3189, &tmp3190, &tmp3191, &tmp3192, &tmp3193, &tmp3194, &tmp3195, &tmp3196, &tmp3197, &tmp3198, &tmp3199, &tmp3200, &tmp3201, &tmp3202, &tmp3203, &tmp3204, &tmp3205, &tmp3206, &tmp3207, &tmp3208, &tmp3209, &tmp3210, &tmp3211);
+    TNode<Smi> tmp3212;
+    USE(tmp3212);
+    tmp3212 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 1);
+    TNode<Smi> tmp3213;
+    USE(tmp3213);
+    tmp3213 = CodeStubAssembler(state_).SmiAdd(TNode<Smi>{tmp3211}, TNode<Smi>{tmp3212});
+    ca_.Goto(&block121, tmp3189, tmp3190, tmp3191, tmp3192, tmp3193, tmp3194, tmp3195, tmp3196, tmp3197, tmp3198, tmp3199, tmp3200, tmp3201, tmp3202, tmp3203, tmp3204, tmp3205, tmp3206, tmp3207, tmp3208, tmp3209, tmp3210, tmp3213);
+  }
+
+  if (block120.is_used()) {
+    TNode<Context> tmp3214;
+    TNode<JSArray> tmp3215;
+    TNode<Smi> tmp3216;
+    TNode<JSReceiver> tmp3217;
+    TNode<Object> tmp3218;
+    TNode<Smi> tmp3219;
+    TNode<JSArray> tmp3220;
+    TNode<JSArray> tmp3221;
+    TNode<Map> tmp3222;
+    TNode<BoolT> tmp3223;
+    TNode<FixedArray> tmp3224;
+    TNode<BoolT> tmp3225;
+    TNode<BoolT> tmp3226;
+    TNode<BoolT> tmp3227;
+    TNode<Smi> tmp3228;
+    TNode<Context> tmp3229;
+    TNode<Smi> tmp3230;
+    TNode<Smi> tmp3231;
+    TNode<Int32T> tmp3232;
+    TNode<Map> tmp3233;
+    TNode<JSArray> tmp3234;
+    TNode<FixedDoubleArray> tmp3235;
+    TNode<Smi> tmp3236;
+    ca_.Bind(&block120, &tmp3214, &tmp3215, &tmp3216, &tmp3217, &tmp3218, &tmp3219, &tmp3220, &tmp3221, &tmp3222, &tmp3223, &tmp3224, &tmp3225, &tmp3226, &tmp3227, &tmp3228, &tmp3229, &tmp3230, &tmp3231, &tmp3232, &tmp3233, &tmp3234, &tmp3235, &tmp3236);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 139);
+    TNode<IntPtrT> tmp3237 = ca_.IntPtrConstant(JSObject::kElementsOffset);
+    USE(tmp3237);
+    CodeStubAssembler(state_).StoreReference(CodeStubAssembler::Reference{tmp3234, tmp3237}, tmp3235);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 122);
+    ca_.Goto(&block118, tmp3214, tmp3215, tmp3216, tmp3217, tmp3218, tmp3219, tmp3220, tmp3221, tmp3222, tmp3223, tmp3224, tmp3225, tmp3226, tmp3227, tmp3228, tmp3229, tmp3230, tmp3231, tmp3232, tmp3233, tmp3234);
+  }
+
+  if (block117.is_used()) {
+    TNode<Context> tmp3238;
+    TNode<JSArray> tmp3239;
+    TNode<Smi> tmp3240;
+    TNode<JSReceiver> tmp3241;
+    TNode<Object> tmp3242;
+    TNode<Smi> tmp3243;
+    TNode<JSArray> tmp3244;
+    TNode<JSArray> tmp3245;
+    TNode<Map> tmp3246;
+    TNode<BoolT> tmp3247;
+    TNode<FixedArray> tmp3248;
+    TNode<BoolT> tmp3249;
+    TNode<BoolT> tmp3250;
+    TNode<BoolT> tmp3251;
+    TNode<Smi> tmp3252;
+    TNode<Context> tmp3253;
+    TNode<Smi> tmp3254;
+    TNode<Smi> tmp3255;
+    TNode<Int32T> tmp3256;
+    TNode<Map> tmp3257;
+    TNode<JSArray> tmp3258;
+    ca_.Bind(&block117, &tmp3238, &tmp3239, &tmp3240, &tmp3241, &tmp3242, &tmp3243, &tmp3244, &tmp3245, &tmp3246, &tmp3247, &tmp3248, &tmp3249, &tmp3250, &tmp3251, &tmp3252, &tmp3253, &tmp3254, &tmp3255, &tmp3256, &tmp3257, &tmp3258);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 142);
+    TNode<JSArray> tmp3259;
+    USE(tmp3259);
+    tmp3259 = NewJSArray_59(state_, TNode<Context>{tmp3253}, TNode<Map>{tmp3257}, TNode<FixedArrayBase>{tmp3248});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 122);
+    ca_.Goto(&block118, tmp3238, tmp3239, tmp3240, tmp3241, tmp3242, tmp3243, tmp3244, tmp3245, tmp3246, tmp3247, tmp3248, tmp3249, tmp3250, tmp3251, tmp3252, tmp3253, tmp3254, tmp3255, tmp3256, tmp3257, tmp3259);
+  }
+
+  if (block118.is_used()) {
+    TNode<Context> tmp3260;
+    TNode<JSArray> tmp3261;
+    TNode<Smi> tmp3262;
+    TNode<JSReceiver> tmp3263;
+    TNode<Object> tmp3264;
+    TNode<Smi> tmp3265;
+    TNode<JSArray> tmp3266;
+    TNode<JSArray> tmp3267;
+    TNode<Map> tmp3268;
+    TNode<BoolT> tmp3269;
+    TNode<FixedArray> tmp3270;
+    TNode<BoolT> tmp3271;
+    TNode<BoolT> tmp3272;
+    TNode<BoolT> tmp3273;
+    TNode<Smi> tmp3274;
+    TNode<Context> tmp3275;
+    TNode<Smi> tmp3276;
+    TNode<Smi> tmp3277;
+    TNode<Int32T> tmp3278;
+    TNode<Map> tmp3279;
+    TNode<JSArray> tmp3280;
+    ca_.Bind(&block118, &tmp3260, &tmp3261, &tmp3262, &tmp3263, &tmp3264, &tmp3265, &tmp3266, &tmp3267, &tmp3268, &tmp3269, &tmp3270, &tmp3271, &tmp3272, &tmp3273, &tmp3274, &tmp3275, &tmp3276, &tmp3277, &tmp3278, &tmp3279, &tmp3280);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 146);
+    TNode<FixedArray> tmp3281;
+    USE(tmp3281);
+    tmp3281 = kEmptyFixedArray_215(state_);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 147);
+    ca_.Goto(&block101, tmp3260, tmp3261, tmp3262, tmp3263, tmp3264, tmp3265, tmp3266, tmp3267, tmp3268, tmp3269, tmp3281, tmp3271, tmp3272, tmp3273, tmp3274, tmp3275, tmp3276, tmp3280);
+  }
+
+  if (block101.is_used()) {
+    TNode<Context> tmp3282;
+    TNode<JSArray> tmp3283;
+    TNode<Smi> tmp3284;
+    TNode<JSReceiver> tmp3285;
+    TNode<Object> tmp3286;
+    TNode<Smi> tmp3287;
+    TNode<JSArray> tmp3288;
+    TNode<JSArray> tmp3289;
+    TNode<Map> tmp3290;
+    TNode<BoolT> tmp3291;
+    TNode<FixedArray> tmp3292;
+    TNode<BoolT> tmp3293;
+    TNode<BoolT> tmp3294;
+    TNode<BoolT> tmp3295;
+    TNode<Smi> tmp3296;
+    TNode<Context> tmp3297;
+    TNode<Smi> tmp3298;
+    TNode<JSArray> tmp3299;
+    ca_.Bind(&block101, &tmp3282, &tmp3283, &tmp3284, &tmp3285, &tmp3286, &tmp3287, &tmp3288, &tmp3289, &tmp3290, &tmp3291, &tmp3292, &tmp3293, &tmp3294, &tmp3295, &tmp3296, &tmp3297, &tmp3298, &tmp3299);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 222);
+    ca_.Goto(&block2, tmp3282, tmp3283, tmp3284, tmp3285, tmp3286, tmp3299);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp3300;
+    TNode<JSArray> tmp3301;
+    TNode<Smi> tmp3302;
+    TNode<JSReceiver> tmp3303;
+    TNode<Object> tmp3304;
+    TNode<JSArray> tmp3305;
+    ca_.Bind(&block2, &tmp3300, &tmp3301, &tmp3302, &tmp3303, &tmp3304, &tmp3305);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 186);
+    ca_.Goto(&block141, tmp3300, tmp3301, tmp3302, tmp3303, tmp3304, tmp3305);
+  }
+
+  if (block1.is_used()) {
+    TNode<JSArray> tmp3306;
+    TNode<Smi> tmp3307;
+    ca_.Bind(&block1, &tmp3306, &tmp3307);
+    *label_Bailout_parameter_1 = tmp3307;
+    *label_Bailout_parameter_0 = tmp3306;
+    ca_.Goto(label_Bailout);
+  }
+
+    TNode<Context> tmp3308;
+    TNode<JSArray> tmp3309;
+    TNode<Smi> tmp3310;
+    TNode<JSReceiver> tmp3311;
+    TNode<Object> tmp3312;
+    TNode<JSArray> tmp3313;
+    ca_.Bind(&block141, &tmp3308, &tmp3309, &tmp3310, &tmp3311, &tmp3312, &tmp3313);
+  return TNode<JSArray>{tmp3313};
+}
+
+TF_BUILTIN(ArrayMap, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  Node* argc = Parameter(Descriptor::kJSActualArgumentsCount);
+  TNode<IntPtrT> arguments_length(ChangeInt32ToIntPtr(argc));
+  TNode<RawPtrT> arguments_frame = UncheckedCast<RawPtrT>(LoadFramePointer());
+  TorqueStructArguments torque_arguments(GetFrameArguments(arguments_frame, arguments_length));
+  CodeStubArguments arguments(this, torque_arguments);
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = arguments.GetReceiver();
+USE(parameter1);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, Object> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, Object, JSReceiver> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, Object> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, Object, JSArray> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, JSArray, Number> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, JSArray, Number, Smi> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, JSArray, Smi, JSArray, Smi, JSReceiver, Object, JSArray, Smi> block22(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, JSArray, Smi, JSArray, Smi, JSReceiver, Object, JSArray> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, JSArray, Smi> block12(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object> block2(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+    ca_.Goto(&block0, torque_arguments.frame, torque_arguments.base, torque_arguments.length, parameter0, parameter1);
+
+  if (block0.is_used()) {
+    TNode<RawPtrT> tmp0;
+    TNode<RawPtrT> tmp1;
+    TNode<IntPtrT> tmp2;
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 229);
+    TNode<Object> tmp5;
+    USE(tmp5);
+    tmp5 = RequireObjectCoercible_244(state_, TNode<Context>{tmp3}, TNode<Object>{tmp4}, "Array.prototype.map");
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 232);
+    TNode<JSReceiver> tmp6;
+    USE(tmp6);
+    tmp6 = CodeStubAssembler(state_).ToObject_Inline(TNode<Context>{tmp3}, TNode<Object>{tmp4});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 235);
+    TNode<Number> tmp7;
+    USE(tmp7);
+    tmp7 = GetLengthProperty_247(state_, TNode<Context>{tmp3}, TNode<Object>{tmp6});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 238);
+    TNode<IntPtrT> tmp8;
+    USE(tmp8);
+    tmp8 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<BoolT> tmp9;
+    USE(tmp9);
+    tmp9 = CodeStubAssembler(state_).WordEqual(TNode<IntPtrT>{tmp2}, TNode<IntPtrT>{tmp8});
+    ca_.Branch(tmp9, &block3, &block4, tmp0, tmp1, tmp2, tmp3, tmp4, tmp6, tmp7);
+  }
+
+  if (block3.is_used()) {
+    TNode<RawPtrT> tmp10;
+    TNode<RawPtrT> tmp11;
+    TNode<IntPtrT> tmp12;
+    TNode<Context> tmp13;
+    TNode<Object> tmp14;
+    TNode<JSReceiver> tmp15;
+    TNode<Number> tmp16;
+    ca_.Bind(&block3, &tmp10, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16);
+    ca_.Goto(&block2, tmp10, tmp11, tmp12, tmp13, tmp14);
+  }
+
+  if (block4.is_used()) {
+    TNode<RawPtrT> tmp17;
+    TNode<RawPtrT> tmp18;
+    TNode<IntPtrT> tmp19;
+    TNode<Context> tmp20;
+    TNode<Object> tmp21;
+    TNode<JSReceiver> tmp22;
+    TNode<Number> tmp23;
+    ca_.Bind(&block4, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 240);
+    TNode<IntPtrT> tmp24;
+    USE(tmp24);
+    tmp24 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<Object> tmp25;
+    USE(tmp25);
+    tmp25 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp17}, TNode<RawPtrT>{tmp18}, TNode<IntPtrT>{tmp19}}, TNode<IntPtrT>{tmp24});
+    TNode<JSReceiver> tmp26;
+    USE(tmp26);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp26 = Cast71UT19ATCallableApiObject17ATCallableJSProxy15JSBoundFunction10JSFunction_1366(state_, TNode<Context>{tmp20}, TNode<Object>{tmp25}, &label0);
+    ca_.Goto(&block5, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp25, tmp26);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block6, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp25);
+    }
+  }
+
+  if (block6.is_used()) {
+    TNode<RawPtrT> tmp27;
+    TNode<RawPtrT> tmp28;
+    TNode<IntPtrT> tmp29;
+    TNode<Context> tmp30;
+    TNode<Object> tmp31;
+    TNode<JSReceiver> tmp32;
+    TNode<Number> tmp33;
+    TNode<Object> tmp34;
+    ca_.Bind(&block6, &tmp27, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34);
+    ca_.Goto(&block2, tmp27, tmp28, tmp29, tmp30, tmp31);
+  }
+
+  if (block5.is_used()) {
+    TNode<RawPtrT> tmp35;
+    TNode<RawPtrT> tmp36;
+    TNode<IntPtrT> tmp37;
+    TNode<Context> tmp38;
+    TNode<Object> tmp39;
+    TNode<JSReceiver> tmp40;
+    TNode<Number> tmp41;
+    TNode<Object> tmp42;
+    TNode<JSReceiver> tmp43;
+    ca_.Bind(&block5, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 243);
+    TNode<IntPtrT> tmp44;
+    USE(tmp44);
+    tmp44 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<BoolT> tmp45;
+    USE(tmp45);
+    tmp45 = CodeStubAssembler(state_).IntPtrGreaterThan(TNode<IntPtrT>{tmp37}, TNode<IntPtrT>{tmp44});
+    ca_.Branch(tmp45, &block7, &block8, tmp35, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp43);
+  }
+
+  if (block7.is_used()) {
+    TNode<RawPtrT> tmp46;
+    TNode<RawPtrT> tmp47;
+    TNode<IntPtrT> tmp48;
+    TNode<Context> tmp49;
+    TNode<Object> tmp50;
+    TNode<JSReceiver> tmp51;
+    TNode<Number> tmp52;
+    TNode<JSReceiver> tmp53;
+    ca_.Bind(&block7, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53);
+    TNode<IntPtrT> tmp54;
+    USE(tmp54);
+    tmp54 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<Object> tmp55;
+    USE(tmp55);
+    tmp55 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp46}, TNode<RawPtrT>{tmp47}, TNode<IntPtrT>{tmp48}}, TNode<IntPtrT>{tmp54});
+    ca_.Goto(&block10, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51, tmp52, tmp53, tmp55);
+  }
+
+  if (block8.is_used()) {
+    TNode<RawPtrT> tmp56;
+    TNode<RawPtrT> tmp57;
+    TNode<IntPtrT> tmp58;
+    TNode<Context> tmp59;
+    TNode<Object> tmp60;
+    TNode<JSReceiver> tmp61;
+    TNode<Number> tmp62;
+    TNode<JSReceiver> tmp63;
+    ca_.Bind(&block8, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63);
+    TNode<Oddball> tmp64;
+    USE(tmp64);
+    tmp64 = Undefined_64(state_);
+    ca_.Goto(&block9, tmp56, tmp57, tmp58, tmp59, tmp60, tmp61, tmp62, tmp63, tmp64);
+  }
+
+  if (block10.is_used()) {
+    TNode<RawPtrT> tmp65;
+    TNode<RawPtrT> tmp66;
+    TNode<IntPtrT> tmp67;
+    TNode<Context> tmp68;
+    TNode<Object> tmp69;
+    TNode<JSReceiver> tmp70;
+    TNode<Number> tmp71;
+    TNode<JSReceiver> tmp72;
+    TNode<Object> tmp73;
+    ca_.Bind(&block10, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73);
+    ca_.Goto(&block9, tmp65, tmp66, tmp67, tmp68, tmp69, tmp70, tmp71, tmp72, tmp73);
+  }
+
+  if (block9.is_used()) {
+    TNode<RawPtrT> tmp74;
+    TNode<RawPtrT> tmp75;
+    TNode<IntPtrT> tmp76;
+    TNode<Context> tmp77;
+    TNode<Object> tmp78;
+    TNode<JSReceiver> tmp79;
+    TNode<Number> tmp80;
+    TNode<JSReceiver> tmp81;
+    TNode<Object> tmp82;
+    ca_.Bind(&block9, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 245);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 246);
+    TNode<Number> tmp83;
+    USE(tmp83);
+    tmp83 = FromConstexpr20UT5ATSmi10HeapNumber17ATconstexpr_int31_161(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 249);
+    TNode<BoolT> tmp84;
+    USE(tmp84);
+    tmp84 = CodeStubAssembler(state_).IsArraySpeciesProtectorCellInvalid();
+    ca_.Branch(tmp84, &block15, &block16, tmp74, tmp75, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, ca_.Uninitialized<JSReceiver>(), tmp83);
+  }
+
+  if (block15.is_used()) {
+    TNode<RawPtrT> tmp85;
+    TNode<RawPtrT> tmp86;
+    TNode<IntPtrT> tmp87;
+    TNode<Context> tmp88;
+    TNode<Object> tmp89;
+    TNode<JSReceiver> tmp90;
+    TNode<Number> tmp91;
+    TNode<JSReceiver> tmp92;
+    TNode<Object> tmp93;
+    TNode<JSReceiver> tmp94;
+    TNode<Number> tmp95;
+    ca_.Bind(&block15, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95);
+    ca_.Goto(&block14, tmp85, tmp86, tmp87, tmp88, tmp89, tmp90, tmp91, tmp92, tmp93, tmp94, tmp95);
+  }
+
+  if (block16.is_used()) {
+    TNode<RawPtrT> tmp96;
+    TNode<RawPtrT> tmp97;
+    TNode<IntPtrT> tmp98;
+    TNode<Context> tmp99;
+    TNode<Object> tmp100;
+    TNode<JSReceiver> tmp101;
+    TNode<Number> tmp102;
+    TNode<JSReceiver> tmp103;
+    TNode<Object> tmp104;
+    TNode<JSReceiver> tmp105;
+    TNode<Number> tmp106;
+    ca_.Bind(&block16, &tmp96, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104, &tmp105, &tmp106);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 250);
+    TNode<JSArray> tmp107;
+    USE(tmp107);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp107 = Cast20ATFastJSArrayForRead_1388(state_, TNode<Context>{tmp99}, TNode<Object>{tmp100}, &label0);
+    ca_.Goto(&block17, tmp96, tmp97, tmp98, tmp99, tmp100, tmp101, tmp102, tmp103, tmp104, tmp105, tmp106, tmp100, tmp107);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block18, tmp96, tmp97, tmp98, tmp99, tmp100, tmp101, tmp102, tmp103, tmp104, tmp105, tmp106, tmp100);
+    }
+  }
+
+  if (block18.is_used()) {
+    TNode<RawPtrT> tmp108;
+    TNode<RawPtrT> tmp109;
+    TNode<IntPtrT> tmp110;
+    TNode<Context> tmp111;
+    TNode<Object> tmp112;
+    TNode<JSReceiver> tmp113;
+    TNode<Number> tmp114;
+    TNode<JSReceiver> tmp115;
+    TNode<Object> tmp116;
+    TNode<JSReceiver> tmp117;
+    TNode<Number> tmp118;
+    TNode<Object> tmp119;
+    ca_.Bind(&block18, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115, &tmp116, &tmp117, &tmp118, &tmp119);
+    ca_.Goto(&block14, tmp108, tmp109, tmp110, tmp111, tmp112, tmp113, tmp114, tmp115, tmp116, tmp117, tmp118);
+  }
+
+  if (block17.is_used()) {
+    TNode<RawPtrT> tmp120;
+    TNode<RawPtrT> tmp121;
+    TNode<IntPtrT> tmp122;
+    TNode<Context> tmp123;
+    TNode<Object> tmp124;
+    TNode<JSReceiver> tmp125;
+    TNode<Number> tmp126;
+    TNode<JSReceiver> tmp127;
+    TNode<Object> tmp128;
+    TNode<JSReceiver> tmp129;
+    TNode<Number> tmp130;
+    TNode<Object> tmp131;
+    TNode<JSArray> tmp132;
+    ca_.Bind(&block17, &tmp120, &tmp121, &tmp122, &tmp123, &tmp124, &tmp125, &tmp126, &tmp127, &tmp128, &tmp129, &tmp130, &tmp131, &tmp132);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 252);
+    TNode<Smi> tmp133;
+    USE(tmp133);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp133 = Cast5ATSmi_83(state_, TNode<Object>{tmp126}, &label0);
+    ca_.Goto(&block19, tmp120, tmp121, tmp122, tmp123, tmp124, tmp125, tmp126, tmp127, tmp128, tmp129, tmp130, tmp132, tmp126, tmp133);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block20, tmp120, tmp121, tmp122, tmp123, tmp124, tmp125, tmp126, tmp127, tmp128, tmp129, tmp130, tmp132, tmp126);
+    }
+  }
+
+  if (block20.is_used()) {
+    TNode<RawPtrT> tmp134;
+    TNode<RawPtrT> tmp135;
+    TNode<IntPtrT> tmp136;
+    TNode<Context> tmp137;
+    TNode<Object> tmp138;
+    TNode<JSReceiver> tmp139;
+    TNode<Number> tmp140;
+    TNode<JSReceiver> tmp141;
+    TNode<Object> tmp142;
+    TNode<JSReceiver> tmp143;
+    TNode<Number> tmp144;
+    TNode<JSArray> tmp145;
+    TNode<Number> tmp146;
+    ca_.Bind(&block20, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138, &tmp139, &tmp140, &tmp141, &tmp142, &tmp143, &tmp144, &tmp145, &tmp146);
+    ca_.Goto(&block14, tmp134, tmp135, tmp136, tmp137, tmp138, tmp139, tmp140, tmp141, tmp142, tmp143, tmp144);
+  }
+
+  if (block19.is_used()) {
+    TNode<RawPtrT> tmp147;
+    TNode<RawPtrT> tmp148;
+    TNode<IntPtrT> tmp149;
+    TNode<Context> tmp150;
+    TNode<Object> tmp151;
+    TNode<JSReceiver> tmp152;
+    TNode<Number> tmp153;
+    TNode<JSReceiver> tmp154;
+    TNode<Object> tmp155;
+    TNode<JSReceiver> tmp156;
+    TNode<Number> tmp157;
+    TNode<JSArray> tmp158;
+    TNode<Number> tmp159;
+    TNode<Smi> tmp160;
+    ca_.Bind(&block19, &tmp147, &tmp148, &tmp149, &tmp150, &tmp151, &tmp152, &tmp153, &tmp154, &tmp155, &tmp156, &tmp157, &tmp158, &tmp159, &tmp160);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 255);
+    TNode<JSArray> tmp161;
+    USE(tmp161);
+    compiler::TypedCodeAssemblerVariable<JSArray> result_0_0(&ca_);
+    compiler::TypedCodeAssemblerVariable<Smi> result_0_1(&ca_);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp161 = FastArrayMap_25(state_, TNode<Context>{tmp150}, TNode<JSArray>{tmp158}, TNode<Smi>{tmp160}, TNode<JSReceiver>{tmp154}, TNode<Object>{tmp155}, &label0, &result_0_0, &result_0_1);
+    ca_.Goto(&block21, tmp147, tmp148, tmp149, tmp150, tmp151, tmp152, tmp153, tmp154, tmp155, tmp156, tmp157, tmp158, tmp160, tmp158, tmp160, tmp154, tmp155, tmp161);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block22, tmp147, tmp148, tmp149, tmp150, tmp151, tmp152, tmp153, tmp154, tmp155, tmp156, tmp157, tmp158, tmp160, tmp158, tmp160, tmp154, tmp155, result_0_0.value(), result_0_1.value());
+    }
+  }
+
+  if (block22.is_used()) {
+    TNode<RawPtrT> tmp162;
+    TNode<RawPtrT> tmp163;
+    TNode<IntPtrT> tmp164;
+    TNode<Context> tmp165;
+    TNode<Object> tmp166;
+    TNode<JSReceiver> tmp167;
+    TNode<Number> tmp168;
+    TNode<JSReceiver> tmp169;
+    TNode<Object> tmp170;
+    TNode<JSReceiver> tmp171;
+    TNode<Number> tmp172;
+    TNode<JSArray> tmp173;
+    TNode<Smi> tmp174;
+    TNode<JSArray> tmp175;
+    TNode<Smi> tmp176;
+    TNode<JSReceiver> tmp177;
+    TNode<Object> tmp178;
+    TNode<JSArray> tmp179;
+    TNode<Smi> tmp180;
+    ca_.Bind(&block22, &tmp162, &tmp163, &tmp164, &tmp165, &tmp166, &tmp167, &tmp168, &tmp169, &tmp170, &tmp171, &tmp172, &tmp173, &tmp174, &tmp175, &tmp176, &tmp177, &tmp178, &tmp179, &tmp180);
+    ca_.Goto(&block12, tmp162, tmp163, tmp164, tmp165, tmp166, tmp167, tmp168, tmp169, tmp170, tmp171, tmp172, tmp179, tmp180);
+  }
+
+  if (block21.is_used()) {
+    TNode<RawPtrT> tmp181;
+    TNode<RawPtrT> tmp182;
+    TNode<IntPtrT> tmp183;
+    TNode<Context> tmp184;
+    TNode<Object> tmp185;
+    TNode<JSReceiver> tmp186;
+    TNode<Number> tmp187;
+    TNode<JSReceiver> tmp188;
+    TNode<Object> tmp189;
+    TNode<JSReceiver> tmp190;
+    TNode<Number> tmp191;
+    TNode<JSArray> tmp192;
+    TNode<Smi> tmp193;
+    TNode<JSArray> tmp194;
+    TNode<Smi> tmp195;
+    TNode<JSReceiver> tmp196;
+    TNode<Object> tmp197;
+    TNode<JSArray> tmp198;
+    ca_.Bind(&block21, &tmp181, &tmp182, &tmp183, &tmp184, &tmp185, &tmp186, &tmp187, &tmp188, &tmp189, &tmp190, &tmp191, &tmp192, &tmp193, &tmp194, &tmp195, &tmp196, &tmp197, &tmp198);
+    arguments.PopAndReturn(tmp198);
+  }
+
+  if (block14.is_used()) {
+    TNode<RawPtrT> tmp199;
+    TNode<RawPtrT> tmp200;
+    TNode<IntPtrT> tmp201;
+    TNode<Context> tmp202;
+    TNode<Object> tmp203;
+    TNode<JSReceiver> tmp204;
+    TNode<Number> tmp205;
+    TNode<JSReceiver> tmp206;
+    TNode<Object> tmp207;
+    TNode<JSReceiver> tmp208;
+    TNode<Number> tmp209;
+    ca_.Bind(&block14, &tmp199, &tmp200, &tmp201, &tmp202, &tmp203, &tmp204, &tmp205, &tmp206, &tmp207, &tmp208, &tmp209);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 259);
+    TNode<JSReceiver> tmp210;
+    USE(tmp210);
+    tmp210 = CodeStubAssembler(state_).ArraySpeciesCreate(TNode<Context>{tmp202}, TNode<Object>{tmp203}, TNode<Number>{tmp205});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 247);
+    ca_.Goto(&block13, tmp199, tmp200, tmp201, tmp202, tmp203, tmp204, tmp205, tmp206, tmp207, tmp210, tmp209);
+  }
+
+  if (block13.is_used()) {
+    TNode<RawPtrT> tmp211;
+    TNode<RawPtrT> tmp212;
+    TNode<IntPtrT> tmp213;
+    TNode<Context> tmp214;
+    TNode<Object> tmp215;
+    TNode<JSReceiver> tmp216;
+    TNode<Number> tmp217;
+    TNode<JSReceiver> tmp218;
+    TNode<Object> tmp219;
+    TNode<JSReceiver> tmp220;
+    TNode<Number> tmp221;
+    ca_.Bind(&block13, &tmp211, &tmp212, &tmp213, &tmp214, &tmp215, &tmp216, &tmp217, &tmp218, &tmp219, &tmp220, &tmp221);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 261);
+    ca_.Goto(&block11, tmp211, tmp212, tmp213, tmp214, tmp215, tmp216, tmp217, tmp218, tmp219, tmp220, tmp221);
+  }
+
+  if (block12.is_used()) {
+    TNode<RawPtrT> tmp222;
+    TNode<RawPtrT> tmp223;
+    TNode<IntPtrT> tmp224;
+    TNode<Context> tmp225;
+    TNode<Object> tmp226;
+    TNode<JSReceiver> tmp227;
+    TNode<Number> tmp228;
+    TNode<JSReceiver> tmp229;
+    TNode<Object> tmp230;
+    TNode<JSReceiver> tmp231;
+    TNode<Number> tmp232;
+    TNode<JSArray> tmp233;
+    TNode<Smi> tmp234;
+    ca_.Bind(&block12, &tmp222, &tmp223, &tmp224, &tmp225, &tmp226, &tmp227, &tmp228, &tmp229, &tmp230, &tmp231, &tmp232, &tmp233, &tmp234);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 262);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 263);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 247);
+    ca_.Goto(&block11, tmp222, tmp223, tmp224, tmp225, tmp226, tmp227, tmp228, tmp229, tmp230, tmp233, tmp234);
+  }
+
+  if (block11.is_used()) {
+    TNode<RawPtrT> tmp235;
+    TNode<RawPtrT> tmp236;
+    TNode<IntPtrT> tmp237;
+    TNode<Context> tmp238;
+    TNode<Object> tmp239;
+    TNode<JSReceiver> tmp240;
+    TNode<Number> tmp241;
+    TNode<JSReceiver> tmp242;
+    TNode<Object> tmp243;
+    TNode<JSReceiver> tmp244;
+    TNode<Number> tmp245;
+    ca_.Bind(&block11, &tmp235, &tmp236, &tmp237, &tmp238, &tmp239, &tmp240, &tmp241, &tmp242, &tmp243, &tmp244, &tmp245);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 266);
+    TNode<Object> tmp246;
+    tmp246 = CodeStubAssembler(state_).CallBuiltin(Builtins::kArrayMapLoopContinuation, tmp238, tmp240, tmp242, tmp243, tmp244, tmp240, tmp245, tmp241);
+    USE(tmp246);
+    arguments.PopAndReturn(tmp246);
+  }
+
+  if (block2.is_used()) {
+    TNode<RawPtrT> tmp247;
+    TNode<RawPtrT> tmp248;
+    TNode<IntPtrT> tmp249;
+    TNode<Context> tmp250;
+    TNode<Object> tmp251;
+    ca_.Bind(&block2, &tmp247, &tmp248, &tmp249, &tmp250, &tmp251);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 269);
+    TNode<IntPtrT> tmp252;
+    USE(tmp252);
+    tmp252 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<Object> tmp253;
+    USE(tmp253);
+    tmp253 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp247}, TNode<RawPtrT>{tmp248}, TNode<IntPtrT>{tmp249}}, TNode<IntPtrT>{tmp252});
+    CodeStubAssembler(state_).ThrowTypeError(TNode<Context>{tmp250}, MessageTemplate::kCalledNonCallable, TNode<Object>{tmp253});
+  }
+}
+
+TNode<Object> UnsafeCast30UT5ATSmi9ATTheHole10HeapNumber_1386(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block5(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3001);
+    ca_.Goto(&block3, tmp0, tmp1);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp2;
+    TNode<Object> tmp3;
+    ca_.Bind(&block2, &tmp2, &tmp3);
+    TNode<BoolT> tmp4;
+    USE(tmp4);
+    tmp4 = Is30UT5ATSmi9ATTheHole10HeapNumber20UT5ATSmi10HeapObject_1467(state_, TNode<Context>{tmp2}, TNode<Object>{tmp3});
+    ca_.Branch(tmp4, &block4, &block5, tmp2, tmp3);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp5;
+    TNode<Object> tmp6;
+    ca_.Bind(&block5, &tmp5, &tmp6);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'Is<A>(o)' failed", "../../deps/v8/src/builtins/base.tq", 3001);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp7;
+    TNode<Object> tmp8;
+    ca_.Bind(&block4, &tmp7, &tmp8);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp9;
+    TNode<Object> tmp10;
+    ca_.Bind(&block3, &tmp9, &tmp10);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3002);
+    TNode<Object> tmp11;
+    USE(tmp11);
+    tmp11 = (TNode<Object>{tmp10});
+    ca_.Goto(&block1, tmp9, tmp10, tmp11);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp12;
+    TNode<Object> tmp13;
+    TNode<Object> tmp14;
+    ca_.Bind(&block1, &tmp12, &tmp13, &tmp14);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 131);
+    ca_.Goto(&block6, tmp12, tmp13, tmp14);
+  }
+
+    TNode<Context> tmp15;
+    TNode<Object> tmp16;
+    TNode<Object> tmp17;
+    ca_.Bind(&block6, &tmp15, &tmp16, &tmp17);
+  return TNode<Object>{tmp17};
+}
+
+TNode<JSArray> Cast20ATFastJSArrayForRead_1388(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o, compiler::CodeAssemblerLabel* label_CastError) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, HeapObject> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, HeapObject> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, HeapObject, JSArray> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSArray> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSArray> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 2215);
+    TNode<HeapObject> tmp2;
+    USE(tmp2);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp2 = CodeStubAssembler(state_).TaggedToHeapObject(TNode<Object>{tmp1}, &label0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp1, tmp2);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block4, tmp0, tmp1, tmp1);
+    }
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    ca_.Bind(&block4, &tmp3, &tmp4, &tmp5);
+    ca_.Goto(&block1);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp6;
+    TNode<Object> tmp7;
+    TNode<Object> tmp8;
+    TNode<HeapObject> tmp9;
+    ca_.Bind(&block3, &tmp6, &tmp7, &tmp8, &tmp9);
+    TNode<JSArray> tmp10;
+    USE(tmp10);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp10 = Cast20ATFastJSArrayForRead_139(state_, TNode<Context>{tmp6}, TNode<HeapObject>{tmp9}, &label0);
+    ca_.Goto(&block5, tmp6, tmp7, tmp9, tmp10);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block6, tmp6, tmp7, tmp9);
+    }
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp11;
+    TNode<Object> tmp12;
+    TNode<HeapObject> tmp13;
+    ca_.Bind(&block6, &tmp11, &tmp12, &tmp13);
+    ca_.Goto(&block1);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp14;
+    TNode<Object> tmp15;
+    TNode<HeapObject> tmp16;
+    TNode<JSArray> tmp17;
+    ca_.Bind(&block5, &tmp14, &tmp15, &tmp16, &tmp17);
+    ca_.Goto(&block2, tmp14, tmp15, tmp17);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp18;
+    TNode<Object> tmp19;
+    TNode<JSArray> tmp20;
+    ca_.Bind(&block2, &tmp18, &tmp19, &tmp20);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-map.tq", 250);
+    ca_.Goto(&block7, tmp18, tmp19, tmp20);
+  }
+
+  if (block1.is_used()) {
+    ca_.Bind(&block1);
+    ca_.Goto(label_CastError);
+  }
+
+    TNode<Context> tmp21;
+    TNode<Object> tmp22;
+    TNode<JSArray> tmp23;
+    ca_.Bind(&block7, &tmp21, &tmp22, &tmp23);
+  return TNode<JSArray>{tmp23};
+}
+
+}  // namespace internal
+}  // namespace v8
+
@@ -0,0 +1,2501 @@
+#include "src/builtins/builtins-array-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-utils-gen.h"
+#include "src/builtins/builtins.h"
+#include "src/codegen/code-factory.h"
+#include "src/heap/factory-inl.h"
+#include "src/objects/arguments.h"
+#include "src/objects/bigint.h"
+#include "src/objects/elements-kind.h"
+#include "src/objects/free-space.h"
+#include "src/objects/js-generator.h"
+#include "src/objects/js-promise.h"
+#include "src/objects/js-regexp-string-iterator.h"
+#include "src/objects/js-weak-refs.h"
+#include "src/objects/objects.h"
+#include "src/objects/source-text-module.h"
+#include "src/objects/stack-frame-info.h"
+#include "src/objects/synthetic-module.h"
+#include "src/objects/template-objects.h"
+#include "src/builtins/builtins-bigint-gen.h"
+#include "src/builtins/builtins-collections-gen.h"
+#include "src/builtins/builtins-data-view-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-iterator-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-string-gen.h"
+#include "src/builtins/builtins-string-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-constructor-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "torque-generated/../../deps/v8/src/builtins/arguments-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-copywithin-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-join-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-lastindexof-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-map-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-right-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reverse-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-shift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-splice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-unshift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/base-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/bigint-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/boolean-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/collections-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/data-view-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/extras-utils-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/frames-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/growable-fixed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/internal-coverage-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/math-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-fromentries-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-constructor-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-delete-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-has-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-is-extensible-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-prevent-extensions-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revocable-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revoke-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/reflect-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-exec-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-all-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-replace-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-search-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-source-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-split-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-test-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-endswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-html-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-pad-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-repeat-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-startswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-substring-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/torque-internal-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-createtypedarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduceright-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-subarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/third_party/v8/builtins/array-sort-tq-csa.h"
+#include "torque-generated/../../deps/v8/test/torque/test-torque-tq-csa.h"
+
+namespace v8 {
+namespace internal {
+
+TF_BUILTIN(ArrayReduceRightPreLoopEagerDeoptContinuation, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = UncheckedCast<Object>(Parameter(Descriptor::kReceiver));
+USE(parameter1);
+  TNode<Object> parameter2 = UncheckedCast<Object>(Parameter(Descriptor::kCallback));
+  USE(parameter2);
+  TNode<Object> parameter3 = UncheckedCast<Object>(Parameter(Descriptor::kLength));
+  USE(parameter3);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, JSReceiver> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, JSReceiver> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, JSReceiver, Object> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, JSReceiver, Object, JSReceiver> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, JSReceiver> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, JSReceiver, JSReceiver> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, JSReceiver, JSReceiver, Object> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, JSReceiver, JSReceiver, Object, Number> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, JSReceiver, JSReceiver> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, JSReceiver, JSReceiver, Number> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2, parameter3);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    TNode<Object> tmp2;
+    TNode<Object> tmp3;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 17);
+    TNode<JSReceiver> tmp4;
+    USE(tmp4);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp4 = Cast10JSReceiver_1365(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1}, &label0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp2, tmp3, tmp1, tmp4);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block4, tmp0, tmp1, tmp2, tmp3, tmp1);
+    }
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp5;
+    TNode<Object> tmp6;
+    TNode<Object> tmp7;
+    TNode<Object> tmp8;
+    TNode<Object> tmp9;
+    ca_.Bind(&block4, &tmp5, &tmp6, &tmp7, &tmp8, &tmp9);
+    ca_.Goto(&block2, tmp5, tmp6, tmp7, tmp8);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp10;
+    TNode<Object> tmp11;
+    TNode<Object> tmp12;
+    TNode<Object> tmp13;
+    TNode<Object> tmp14;
+    TNode<JSReceiver> tmp15;
+    ca_.Bind(&block3, &tmp10, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15);
+    ca_.Goto(&block1, tmp10, tmp11, tmp12, tmp13, tmp15);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp16;
+    TNode<Object> tmp17;
+    TNode<Object> tmp18;
+    TNode<Object> tmp19;
+    ca_.Bind(&block2, &tmp16, &tmp17, &tmp18, &tmp19);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp20;
+    TNode<Object> tmp21;
+    TNode<Object> tmp22;
+    TNode<Object> tmp23;
+    TNode<JSReceiver> tmp24;
+    ca_.Bind(&block1, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 18);
+    TNode<JSReceiver> tmp25;
+    USE(tmp25);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp25 = Cast71UT19ATCallableApiObject17ATCallableJSProxy15JSBoundFunction10JSFunction_1366(state_, TNode<Context>{tmp20}, TNode<Object>{tmp22}, &label0);
+    ca_.Goto(&block7, tmp20, tmp21, tmp22, tmp23, tmp24, tmp22, tmp25);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block8, tmp20, tmp21, tmp22, tmp23, tmp24, tmp22);
+    }
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp26;
+    TNode<Object> tmp27;
+    TNode<Object> tmp28;
+    TNode<Object> tmp29;
+    TNode<JSReceiver> tmp30;
+    TNode<Object> tmp31;
+    ca_.Bind(&block8, &tmp26, &tmp27, &tmp28, &tmp29, &tmp30, &tmp31);
+    ca_.Goto(&block6, tmp26, tmp27, tmp28, tmp29, tmp30);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp32;
+    TNode<Object> tmp33;
+    TNode<Object> tmp34;
+    TNode<Object> tmp35;
+    TNode<JSReceiver> tmp36;
+    TNode<Object> tmp37;
+    TNode<JSReceiver> tmp38;
+    ca_.Bind(&block7, &tmp32, &tmp33, &tmp34, &tmp35, &tmp36, &tmp37, &tmp38);
+    ca_.Goto(&block5, tmp32, tmp33, tmp34, tmp35, tmp36, tmp38);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp39;
+    TNode<Object> tmp40;
+    TNode<Object> tmp41;
+    TNode<Object> tmp42;
+    TNode<JSReceiver> tmp43;
+    ca_.Bind(&block6, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp44;
+    TNode<Object> tmp45;
+    TNode<Object> tmp46;
+    TNode<Object> tmp47;
+    TNode<JSReceiver> tmp48;
+    TNode<JSReceiver> tmp49;
+    ca_.Bind(&block5, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 19);
+    TNode<Number> tmp50;
+    USE(tmp50);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp50 = Cast20UT5ATSmi10HeapNumber_85(state_, TNode<Object>{tmp47}, &label0);
+    ca_.Goto(&block11, tmp44, tmp45, tmp46, tmp47, tmp48, tmp49, tmp47, tmp50);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block12, tmp44, tmp45, tmp46, tmp47, tmp48, tmp49, tmp47);
+    }
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp51;
+    TNode<Object> tmp52;
+    TNode<Object> tmp53;
+    TNode<Object> tmp54;
+    TNode<JSReceiver> tmp55;
+    TNode<JSReceiver> tmp56;
+    TNode<Object> tmp57;
+    ca_.Bind(&block12, &tmp51, &tmp52, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57);
+    ca_.Goto(&block10, tmp51, tmp52, tmp53, tmp54, tmp55, tmp56);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp58;
+    TNode<Object> tmp59;
+    TNode<Object> tmp60;
+    TNode<Object> tmp61;
+    TNode<JSReceiver> tmp62;
+    TNode<JSReceiver> tmp63;
+    TNode<Object> tmp64;
+    TNode<Number> tmp65;
+    ca_.Bind(&block11, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65);
+    ca_.Goto(&block9, tmp58, tmp59, tmp60, tmp61, tmp62, tmp63, tmp65);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp66;
+    TNode<Object> tmp67;
+    TNode<Object> tmp68;
+    TNode<Object> tmp69;
+    TNode<JSReceiver> tmp70;
+    TNode<JSReceiver> tmp71;
+    ca_.Bind(&block10, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp72;
+    TNode<Object> tmp73;
+    TNode<Object> tmp74;
+    TNode<Object> tmp75;
+    TNode<JSReceiver> tmp76;
+    TNode<JSReceiver> tmp77;
+    TNode<Number> tmp78;
+    ca_.Bind(&block9, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 25);
+    TNode<Oddball> tmp79;
+    USE(tmp79);
+    tmp79 = TheHole_62(state_);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 24);
+    TNode<Number> tmp80;
+    USE(tmp80);
+    tmp80 = FromConstexpr20UT5ATSmi10HeapNumber17ATconstexpr_int31_161(state_, 0);
+    TNode<Object> tmp81;
+    tmp81 = CodeStubAssembler(state_).CallBuiltin(Builtins::kArrayReduceRightLoopContinuation, tmp72, tmp76, tmp77, tmp79, tmp76, tmp80, tmp78);
+    USE(tmp81);
+    CodeStubAssembler(state_).Return(tmp81);
+  }
+}
+
+TF_BUILTIN(ArrayReduceRightLoopEagerDeoptContinuation, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = UncheckedCast<Object>(Parameter(Descriptor::kReceiver));
+USE(parameter1);
+  TNode<Object> parameter2 = UncheckedCast<Object>(Parameter(Descriptor::kCallback));
+  USE(parameter2);
+  TNode<Object> parameter3 = UncheckedCast<Object>(Parameter(Descriptor::kInitialK));
+  USE(parameter3);
+  TNode<Object> parameter4 = UncheckedCast<Object>(Parameter(Descriptor::kLength));
+  USE(parameter4);
+  TNode<Object> parameter5 = UncheckedCast<Object>(Parameter(Descriptor::kAccumulator));
+  USE(parameter5);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, Object> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, Object, JSReceiver> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Object> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Object, Number> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Number> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Number, Object> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Number, Object, Number> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Number> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Number, Number> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2, parameter3, parameter4, parameter5);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    TNode<Object> tmp2;
+    TNode<Object> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4, &tmp5);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 40);
+    TNode<JSReceiver> tmp6;
+    USE(tmp6);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp6 = Cast10JSReceiver_1365(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1}, &label0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp1, tmp6);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block4, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp1);
+    }
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp7;
+    TNode<Object> tmp8;
+    TNode<Object> tmp9;
+    TNode<Object> tmp10;
+    TNode<Object> tmp11;
+    TNode<Object> tmp12;
+    TNode<Object> tmp13;
+    ca_.Bind(&block4, &tmp7, &tmp8, &tmp9, &tmp10, &tmp11, &tmp12, &tmp13);
+    ca_.Goto(&block2, tmp7, tmp8, tmp9, tmp10, tmp11, tmp12);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp14;
+    TNode<Object> tmp15;
+    TNode<Object> tmp16;
+    TNode<Object> tmp17;
+    TNode<Object> tmp18;
+    TNode<Object> tmp19;
+    TNode<Object> tmp20;
+    TNode<JSReceiver> tmp21;
+    ca_.Bind(&block3, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21);
+    ca_.Goto(&block1, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19, tmp21);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp22;
+    TNode<Object> tmp23;
+    TNode<Object> tmp24;
+    TNode<Object> tmp25;
+    TNode<Object> tmp26;
+    TNode<Object> tmp27;
+    ca_.Bind(&block2, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp28;
+    TNode<Object> tmp29;
+    TNode<Object> tmp30;
+    TNode<Object> tmp31;
+    TNode<Object> tmp32;
+    TNode<Object> tmp33;
+    TNode<JSReceiver> tmp34;
+    ca_.Bind(&block1, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 41);
+    TNode<JSReceiver> tmp35;
+    USE(tmp35);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp35 = Cast71UT19ATCallableApiObject17ATCallableJSProxy15JSBoundFunction10JSFunction_1366(state_, TNode<Context>{tmp28}, TNode<Object>{tmp30}, &label0);
+    ca_.Goto(&block7, tmp28, tmp29, tmp30, tmp31, tmp32, tmp33, tmp34, tmp30, tmp35);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block8, tmp28, tmp29, tmp30, tmp31, tmp32, tmp33, tmp34, tmp30);
+    }
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp36;
+    TNode<Object> tmp37;
+    TNode<Object> tmp38;
+    TNode<Object> tmp39;
+    TNode<Object> tmp40;
+    TNode<Object> tmp41;
+    TNode<JSReceiver> tmp42;
+    TNode<Object> tmp43;
+    ca_.Bind(&block8, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43);
+    ca_.Goto(&block6, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp44;
+    TNode<Object> tmp45;
+    TNode<Object> tmp46;
+    TNode<Object> tmp47;
+    TNode<Object> tmp48;
+    TNode<Object> tmp49;
+    TNode<JSReceiver> tmp50;
+    TNode<Object> tmp51;
+    TNode<JSReceiver> tmp52;
+    ca_.Bind(&block7, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52);
+    ca_.Goto(&block5, tmp44, tmp45, tmp46, tmp47, tmp48, tmp49, tmp50, tmp52);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp53;
+    TNode<Object> tmp54;
+    TNode<Object> tmp55;
+    TNode<Object> tmp56;
+    TNode<Object> tmp57;
+    TNode<Object> tmp58;
+    TNode<JSReceiver> tmp59;
+    ca_.Bind(&block6, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp60;
+    TNode<Object> tmp61;
+    TNode<Object> tmp62;
+    TNode<Object> tmp63;
+    TNode<Object> tmp64;
+    TNode<Object> tmp65;
+    TNode<JSReceiver> tmp66;
+    TNode<JSReceiver> tmp67;
+    ca_.Bind(&block5, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66, &tmp67);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 42);
+    TNode<Number> tmp68;
+    USE(tmp68);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp68 = Cast20UT5ATSmi10HeapNumber_85(state_, TNode<Object>{tmp63}, &label0);
+    ca_.Goto(&block11, tmp60, tmp61, tmp62, tmp63, tmp64, tmp65, tmp66, tmp67, tmp63, tmp68);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block12, tmp60, tmp61, tmp62, tmp63, tmp64, tmp65, tmp66, tmp67, tmp63);
+    }
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp69;
+    TNode<Object> tmp70;
+    TNode<Object> tmp71;
+    TNode<Object> tmp72;
+    TNode<Object> tmp73;
+    TNode<Object> tmp74;
+    TNode<JSReceiver> tmp75;
+    TNode<JSReceiver> tmp76;
+    TNode<Object> tmp77;
+    ca_.Bind(&block12, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76, &tmp77);
+    ca_.Goto(&block10, tmp69, tmp70, tmp71, tmp72, tmp73, tmp74, tmp75, tmp76);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp78;
+    TNode<Object> tmp79;
+    TNode<Object> tmp80;
+    TNode<Object> tmp81;
+    TNode<Object> tmp82;
+    TNode<Object> tmp83;
+    TNode<JSReceiver> tmp84;
+    TNode<JSReceiver> tmp85;
+    TNode<Object> tmp86;
+    TNode<Number> tmp87;
+    ca_.Bind(&block11, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86, &tmp87);
+    ca_.Goto(&block9, tmp78, tmp79, tmp80, tmp81, tmp82, tmp83, tmp84, tmp85, tmp87);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp88;
+    TNode<Object> tmp89;
+    TNode<Object> tmp90;
+    TNode<Object> tmp91;
+    TNode<Object> tmp92;
+    TNode<Object> tmp93;
+    TNode<JSReceiver> tmp94;
+    TNode<JSReceiver> tmp95;
+    ca_.Bind(&block10, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp96;
+    TNode<Object> tmp97;
+    TNode<Object> tmp98;
+    TNode<Object> tmp99;
+    TNode<Object> tmp100;
+    TNode<Object> tmp101;
+    TNode<JSReceiver> tmp102;
+    TNode<JSReceiver> tmp103;
+    TNode<Number> tmp104;
+    ca_.Bind(&block9, &tmp96, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 43);
+    TNode<Number> tmp105;
+    USE(tmp105);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp105 = Cast20UT5ATSmi10HeapNumber_85(state_, TNode<Object>{tmp100}, &label0);
+    ca_.Goto(&block15, tmp96, tmp97, tmp98, tmp99, tmp100, tmp101, tmp102, tmp103, tmp104, tmp100, tmp105);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block16, tmp96, tmp97, tmp98, tmp99, tmp100, tmp101, tmp102, tmp103, tmp104, tmp100);
+    }
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp106;
+    TNode<Object> tmp107;
+    TNode<Object> tmp108;
+    TNode<Object> tmp109;
+    TNode<Object> tmp110;
+    TNode<Object> tmp111;
+    TNode<JSReceiver> tmp112;
+    TNode<JSReceiver> tmp113;
+    TNode<Number> tmp114;
+    TNode<Object> tmp115;
+    ca_.Bind(&block16, &tmp106, &tmp107, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115);
+    ca_.Goto(&block14, tmp106, tmp107, tmp108, tmp109, tmp110, tmp111, tmp112, tmp113, tmp114);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp116;
+    TNode<Object> tmp117;
+    TNode<Object> tmp118;
+    TNode<Object> tmp119;
+    TNode<Object> tmp120;
+    TNode<Object> tmp121;
+    TNode<JSReceiver> tmp122;
+    TNode<JSReceiver> tmp123;
+    TNode<Number> tmp124;
+    TNode<Object> tmp125;
+    TNode<Number> tmp126;
+    ca_.Bind(&block15, &tmp116, &tmp117, &tmp118, &tmp119, &tmp120, &tmp121, &tmp122, &tmp123, &tmp124, &tmp125, &tmp126);
+    ca_.Goto(&block13, tmp116, tmp117, tmp118, tmp119, tmp120, tmp121, tmp122, tmp123, tmp124, tmp126);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp127;
+    TNode<Object> tmp128;
+    TNode<Object> tmp129;
+    TNode<Object> tmp130;
+    TNode<Object> tmp131;
+    TNode<Object> tmp132;
+    TNode<JSReceiver> tmp133;
+    TNode<JSReceiver> tmp134;
+    TNode<Number> tmp135;
+    ca_.Bind(&block14, &tmp127, &tmp128, &tmp129, &tmp130, &tmp131, &tmp132, &tmp133, &tmp134, &tmp135);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp136;
+    TNode<Object> tmp137;
+    TNode<Object> tmp138;
+    TNode<Object> tmp139;
+    TNode<Object> tmp140;
+    TNode<Object> tmp141;
+    TNode<JSReceiver> tmp142;
+    TNode<JSReceiver> tmp143;
+    TNode<Number> tmp144;
+    TNode<Number> tmp145;
+    ca_.Bind(&block13, &tmp136, &tmp137, &tmp138, &tmp139, &tmp140, &tmp141, &tmp142, &tmp143, &tmp144, &tmp145);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 46);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 45);
+    TNode<Object> tmp146;
+    tmp146 = CodeStubAssembler(state_).CallBuiltin(Builtins::kArrayReduceRightLoopContinuation, tmp136, tmp142, tmp143, tmp141, tmp142, tmp144, tmp145);
+    USE(tmp146);
+    CodeStubAssembler(state_).Return(tmp146);
+  }
+}
+
+TF_BUILTIN(ArrayReduceRightLoopLazyDeoptContinuation, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = UncheckedCast<Object>(Parameter(Descriptor::kReceiver));
+USE(parameter1);
+  TNode<Object> parameter2 = UncheckedCast<Object>(Parameter(Descriptor::kCallback));
+  USE(parameter2);
+  TNode<Object> parameter3 = UncheckedCast<Object>(Parameter(Descriptor::kInitialK));
+  USE(parameter3);
+  TNode<Object> parameter4 = UncheckedCast<Object>(Parameter(Descriptor::kLength));
+  USE(parameter4);
+  TNode<Object> parameter5 = UncheckedCast<Object>(Parameter(Descriptor::kResult));
+  USE(parameter5);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, Object, JSReceiver> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, Object> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, Object, JSReceiver> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Object> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Object, Number> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Number> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Number, Object> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Number, Object, Number> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Number> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, Object, Object, JSReceiver, JSReceiver, Number, Number> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2, parameter3, parameter4, parameter5);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    TNode<Object> tmp2;
+    TNode<Object> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4, &tmp5);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 56);
+    TNode<JSReceiver> tmp6;
+    USE(tmp6);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp6 = Cast10JSReceiver_1365(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1}, &label0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp1, tmp6);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block4, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp1);
+    }
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp7;
+    TNode<Object> tmp8;
+    TNode<Object> tmp9;
+    TNode<Object> tmp10;
+    TNode<Object> tmp11;
+    TNode<Object> tmp12;
+    TNode<Object> tmp13;
+    ca_.Bind(&block4, &tmp7, &tmp8, &tmp9, &tmp10, &tmp11, &tmp12, &tmp13);
+    ca_.Goto(&block2, tmp7, tmp8, tmp9, tmp10, tmp11, tmp12);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp14;
+    TNode<Object> tmp15;
+    TNode<Object> tmp16;
+    TNode<Object> tmp17;
+    TNode<Object> tmp18;
+    TNode<Object> tmp19;
+    TNode<Object> tmp20;
+    TNode<JSReceiver> tmp21;
+    ca_.Bind(&block3, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21);
+    ca_.Goto(&block1, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19, tmp21);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp22;
+    TNode<Object> tmp23;
+    TNode<Object> tmp24;
+    TNode<Object> tmp25;
+    TNode<Object> tmp26;
+    TNode<Object> tmp27;
+    ca_.Bind(&block2, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp28;
+    TNode<Object> tmp29;
+    TNode<Object> tmp30;
+    TNode<Object> tmp31;
+    TNode<Object> tmp32;
+    TNode<Object> tmp33;
+    TNode<JSReceiver> tmp34;
+    ca_.Bind(&block1, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 57);
+    TNode<JSReceiver> tmp35;
+    USE(tmp35);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp35 = Cast71UT19ATCallableApiObject17ATCallableJSProxy15JSBoundFunction10JSFunction_1366(state_, TNode<Context>{tmp28}, TNode<Object>{tmp30}, &label0);
+    ca_.Goto(&block7, tmp28, tmp29, tmp30, tmp31, tmp32, tmp33, tmp34, tmp30, tmp35);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block8, tmp28, tmp29, tmp30, tmp31, tmp32, tmp33, tmp34, tmp30);
+    }
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp36;
+    TNode<Object> tmp37;
+    TNode<Object> tmp38;
+    TNode<Object> tmp39;
+    TNode<Object> tmp40;
+    TNode<Object> tmp41;
+    TNode<JSReceiver> tmp42;
+    TNode<Object> tmp43;
+    ca_.Bind(&block8, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43);
+    ca_.Goto(&block6, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp44;
+    TNode<Object> tmp45;
+    TNode<Object> tmp46;
+    TNode<Object> tmp47;
+    TNode<Object> tmp48;
+    TNode<Object> tmp49;
+    TNode<JSReceiver> tmp50;
+    TNode<Object> tmp51;
+    TNode<JSReceiver> tmp52;
+    ca_.Bind(&block7, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52);
+    ca_.Goto(&block5, tmp44, tmp45, tmp46, tmp47, tmp48, tmp49, tmp50, tmp52);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp53;
+    TNode<Object> tmp54;
+    TNode<Object> tmp55;
+    TNode<Object> tmp56;
+    TNode<Object> tmp57;
+    TNode<Object> tmp58;
+    TNode<JSReceiver> tmp59;
+    ca_.Bind(&block6, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp60;
+    TNode<Object> tmp61;
+    TNode<Object> tmp62;
+    TNode<Object> tmp63;
+    TNode<Object> tmp64;
+    TNode<Object> tmp65;
+    TNode<JSReceiver> tmp66;
+    TNode<JSReceiver> tmp67;
+    ca_.Bind(&block5, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66, &tmp67);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 58);
+    TNode<Number> tmp68;
+    USE(tmp68);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp68 = Cast20UT5ATSmi10HeapNumber_85(state_, TNode<Object>{tmp63}, &label0);
+    ca_.Goto(&block11, tmp60, tmp61, tmp62, tmp63, tmp64, tmp65, tmp66, tmp67, tmp63, tmp68);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block12, tmp60, tmp61, tmp62, tmp63, tmp64, tmp65, tmp66, tmp67, tmp63);
+    }
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp69;
+    TNode<Object> tmp70;
+    TNode<Object> tmp71;
+    TNode<Object> tmp72;
+    TNode<Object> tmp73;
+    TNode<Object> tmp74;
+    TNode<JSReceiver> tmp75;
+    TNode<JSReceiver> tmp76;
+    TNode<Object> tmp77;
+    ca_.Bind(&block12, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76, &tmp77);
+    ca_.Goto(&block10, tmp69, tmp70, tmp71, tmp72, tmp73, tmp74, tmp75, tmp76);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp78;
+    TNode<Object> tmp79;
+    TNode<Object> tmp80;
+    TNode<Object> tmp81;
+    TNode<Object> tmp82;
+    TNode<Object> tmp83;
+    TNode<JSReceiver> tmp84;
+    TNode<JSReceiver> tmp85;
+    TNode<Object> tmp86;
+    TNode<Number> tmp87;
+    ca_.Bind(&block11, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86, &tmp87);
+    ca_.Goto(&block9, tmp78, tmp79, tmp80, tmp81, tmp82, tmp83, tmp84, tmp85, tmp87);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp88;
+    TNode<Object> tmp89;
+    TNode<Object> tmp90;
+    TNode<Object> tmp91;
+    TNode<Object> tmp92;
+    TNode<Object> tmp93;
+    TNode<JSReceiver> tmp94;
+    TNode<JSReceiver> tmp95;
+    ca_.Bind(&block10, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp96;
+    TNode<Object> tmp97;
+    TNode<Object> tmp98;
+    TNode<Object> tmp99;
+    TNode<Object> tmp100;
+    TNode<Object> tmp101;
+    TNode<JSReceiver> tmp102;
+    TNode<JSReceiver> tmp103;
+    TNode<Number> tmp104;
+    ca_.Bind(&block9, &tmp96, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 59);
+    TNode<Number> tmp105;
+    USE(tmp105);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp105 = Cast20UT5ATSmi10HeapNumber_85(state_, TNode<Object>{tmp100}, &label0);
+    ca_.Goto(&block15, tmp96, tmp97, tmp98, tmp99, tmp100, tmp101, tmp102, tmp103, tmp104, tmp100, tmp105);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block16, tmp96, tmp97, tmp98, tmp99, tmp100, tmp101, tmp102, tmp103, tmp104, tmp100);
+    }
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp106;
+    TNode<Object> tmp107;
+    TNode<Object> tmp108;
+    TNode<Object> tmp109;
+    TNode<Object> tmp110;
+    TNode<Object> tmp111;
+    TNode<JSReceiver> tmp112;
+    TNode<JSReceiver> tmp113;
+    TNode<Number> tmp114;
+    TNode<Object> tmp115;
+    ca_.Bind(&block16, &tmp106, &tmp107, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115);
+    ca_.Goto(&block14, tmp106, tmp107, tmp108, tmp109, tmp110, tmp111, tmp112, tmp113, tmp114);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp116;
+    TNode<Object> tmp117;
+    TNode<Object> tmp118;
+    TNode<Object> tmp119;
+    TNode<Object> tmp120;
+    TNode<Object> tmp121;
+    TNode<JSReceiver> tmp122;
+    TNode<JSReceiver> tmp123;
+    TNode<Number> tmp124;
+    TNode<Object> tmp125;
+    TNode<Number> tmp126;
+    ca_.Bind(&block15, &tmp116, &tmp117, &tmp118, &tmp119, &tmp120, &tmp121, &tmp122, &tmp123, &tmp124, &tmp125, &tmp126);
+    ca_.Goto(&block13, tmp116, tmp117, tmp118, tmp119, tmp120, tmp121, tmp122, tmp123, tmp124, tmp126);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp127;
+    TNode<Object> tmp128;
+    TNode<Object> tmp129;
+    TNode<Object> tmp130;
+    TNode<Object> tmp131;
+    TNode<Object> tmp132;
+    TNode<JSReceiver> tmp133;
+    TNode<JSReceiver> tmp134;
+    TNode<Number> tmp135;
+    ca_.Bind(&block14, &tmp127, &tmp128, &tmp129, &tmp130, &tmp131, &tmp132, &tmp133, &tmp134, &tmp135);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp136;
+    TNode<Object> tmp137;
+    TNode<Object> tmp138;
+    TNode<Object> tmp139;
+    TNode<Object> tmp140;
+    TNode<Object> tmp141;
+    TNode<JSReceiver> tmp142;
+    TNode<JSReceiver> tmp143;
+    TNode<Number> tmp144;
+    TNode<Number> tmp145;
+    ca_.Bind(&block13, &tmp136, &tmp137, &tmp138, &tmp139, &tmp140, &tmp141, &tmp142, &tmp143, &tmp144, &tmp145);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 63);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 62);
+    TNode<Object> tmp146;
+    tmp146 = CodeStubAssembler(state_).CallBuiltin(Builtins::kArrayReduceRightLoopContinuation, tmp136, tmp142, tmp143, tmp141, tmp142, tmp144, tmp145);
+    USE(tmp146);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 64);
+    CodeStubAssembler(state_).Return(tmp146);
+  }
+}
+
+TF_BUILTIN(ArrayReduceRightLoopContinuation, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<JSReceiver> parameter1 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<0>()));
+  USE(parameter1);
+  TNode<JSReceiver> parameter2 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<1>()));
+  USE(parameter2);
+  TNode<Object> parameter3 = UncheckedCast<Object>(Parameter(Descriptor::ParameterIndex<2>()));
+  USE(parameter3);
+  TNode<JSReceiver> parameter4 = UncheckedCast<JSReceiver>(Parameter(Descriptor::ParameterIndex<3>()));
+  USE(parameter4);
+  TNode<Number> parameter5 = UncheckedCast<Number>(Parameter(Descriptor::ParameterIndex<4>()));
+  USE(parameter5);
+  TNode<Number> parameter6 = UncheckedCast<Number>(Parameter(Descriptor::ParameterIndex<5>()));
+  USE(parameter6);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, Number, Number> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, Number, Number, Object, Number> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, Number, Number, Object, Number> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, Number, Number, Object, Number, Oddball> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, Number, Number, Object, Number, Oddball, Object, Object, Object> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, Number, Number, Object, Number, Oddball, Object, Object, Object, Oddball> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, Number, Number, Object, Number, Oddball, Object, Object> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, Number, Number, Object, Number, Oddball, Object, Object> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, Number, Number, Object, Number, Oddball> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, Number, Number, Object, Number> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, Number, Number, Object, Number> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, Number, Number, Object, Object, Object> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, Number, Number, Object, Object, Object, Oddball> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, Object, JSReceiver, Number, Number, Object, Object> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2, parameter3, parameter4, parameter5, parameter6);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<JSReceiver> tmp2;
+    TNode<Object> tmp3;
+    TNode<JSReceiver> tmp4;
+    TNode<Number> tmp5;
+    TNode<Number> tmp6;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4, &tmp5, &tmp6);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 72);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 75);
+    ca_.Goto(&block3, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp3, tmp5);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp7;
+    TNode<JSReceiver> tmp8;
+    TNode<JSReceiver> tmp9;
+    TNode<Object> tmp10;
+    TNode<JSReceiver> tmp11;
+    TNode<Number> tmp12;
+    TNode<Number> tmp13;
+    TNode<Object> tmp14;
+    TNode<Number> tmp15;
+    ca_.Bind(&block3, &tmp7, &tmp8, &tmp9, &tmp10, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15);
+    TNode<Number> tmp16;
+    USE(tmp16);
+    tmp16 = FromConstexpr20UT5ATSmi10HeapNumber17ATconstexpr_int31_161(state_, 0);
+    TNode<BoolT> tmp17;
+    USE(tmp17);
+    tmp17 = NumberIsGreaterThanOrEqual_78(state_, TNode<Number>{tmp15}, TNode<Number>{tmp16});
+    ca_.Branch(tmp17, &block1, &block2, tmp7, tmp8, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp18;
+    TNode<JSReceiver> tmp19;
+    TNode<JSReceiver> tmp20;
+    TNode<Object> tmp21;
+    TNode<JSReceiver> tmp22;
+    TNode<Number> tmp23;
+    TNode<Number> tmp24;
+    TNode<Object> tmp25;
+    TNode<Number> tmp26;
+    ca_.Bind(&block1, &tmp18, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 81);
+    TNode<Oddball> tmp27;
+    USE(tmp27);
+    tmp27 = CodeStubAssembler(state_).HasProperty_Inline(TNode<Context>{tmp18}, TNode<JSReceiver>{tmp22}, TNode<Object>{tmp26});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 84);
+    TNode<Oddball> tmp28;
+    USE(tmp28);
+    tmp28 = True_65(state_);
+    TNode<BoolT> tmp29;
+    USE(tmp29);
+    tmp29 = CodeStubAssembler(state_).TaggedEqual(TNode<HeapObject>{tmp27}, TNode<HeapObject>{tmp28});
+    ca_.Branch(tmp29, &block5, &block6, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp30;
+    TNode<JSReceiver> tmp31;
+    TNode<JSReceiver> tmp32;
+    TNode<Object> tmp33;
+    TNode<JSReceiver> tmp34;
+    TNode<Number> tmp35;
+    TNode<Number> tmp36;
+    TNode<Object> tmp37;
+    TNode<Number> tmp38;
+    TNode<Oddball> tmp39;
+    ca_.Bind(&block5, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 86);
+    TNode<Object> tmp40;
+    USE(tmp40);
+    tmp40 = CodeStubAssembler(state_).GetProperty(TNode<Context>{tmp30}, TNode<Object>{tmp34}, TNode<Object>{tmp38});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 88);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 89);
+    TNode<Oddball> tmp41;
+    USE(tmp41);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp41 = Cast9ATTheHole_88(state_, TNode<Object>{tmp37}, &label0);
+    ca_.Goto(&block9, tmp30, tmp31, tmp32, tmp33, tmp34, tmp35, tmp36, tmp37, tmp38, tmp39, tmp40, tmp37, tmp37, tmp41);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block10, tmp30, tmp31, tmp32, tmp33, tmp34, tmp35, tmp36, tmp37, tmp38, tmp39, tmp40, tmp37, tmp37);
+    }
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp42;
+    TNode<JSReceiver> tmp43;
+    TNode<JSReceiver> tmp44;
+    TNode<Object> tmp45;
+    TNode<JSReceiver> tmp46;
+    TNode<Number> tmp47;
+    TNode<Number> tmp48;
+    TNode<Object> tmp49;
+    TNode<Number> tmp50;
+    TNode<Oddball> tmp51;
+    TNode<Object> tmp52;
+    TNode<Object> tmp53;
+    TNode<Object> tmp54;
+    ca_.Bind(&block10, &tmp42, &tmp43, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53, &tmp54);
+    ca_.Goto(&block8, tmp42, tmp43, tmp44, tmp45, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51, tmp52, tmp53);
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp55;
+    TNode<JSReceiver> tmp56;
+    TNode<JSReceiver> tmp57;
+    TNode<Object> tmp58;
+    TNode<JSReceiver> tmp59;
+    TNode<Number> tmp60;
+    TNode<Number> tmp61;
+    TNode<Object> tmp62;
+    TNode<Number> tmp63;
+    TNode<Oddball> tmp64;
+    TNode<Object> tmp65;
+    TNode<Object> tmp66;
+    TNode<Object> tmp67;
+    TNode<Oddball> tmp68;
+    ca_.Bind(&block9, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66, &tmp67, &tmp68);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 91);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 89);
+    ca_.Goto(&block7, tmp55, tmp56, tmp57, tmp58, tmp59, tmp60, tmp61, tmp65, tmp63, tmp64, tmp65, tmp66);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp69;
+    TNode<JSReceiver> tmp70;
+    TNode<JSReceiver> tmp71;
+    TNode<Object> tmp72;
+    TNode<JSReceiver> tmp73;
+    TNode<Number> tmp74;
+    TNode<Number> tmp75;
+    TNode<Object> tmp76;
+    TNode<Number> tmp77;
+    TNode<Oddball> tmp78;
+    TNode<Object> tmp79;
+    TNode<Object> tmp80;
+    ca_.Bind(&block8, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 93);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 97);
+    TNode<Oddball> tmp81;
+    USE(tmp81);
+    tmp81 = Undefined_64(state_);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 98);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 96);
+    TNode<Object> tmp82;
+    USE(tmp82);
+    tmp82 = CodeStubAssembler(state_).Call(TNode<Context>{tmp69}, TNode<JSReceiver>{tmp71}, TNode<Object>{tmp81}, TNode<Object>{ca_.UncheckedCast<Object>(tmp80)}, TNode<Object>{tmp79}, TNode<Object>{tmp77}, TNode<Object>{tmp73});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 89);
+    ca_.Goto(&block7, tmp69, tmp70, tmp71, tmp72, tmp73, tmp74, tmp75, tmp82, tmp77, tmp78, tmp79, tmp80);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp83;
+    TNode<JSReceiver> tmp84;
+    TNode<JSReceiver> tmp85;
+    TNode<Object> tmp86;
+    TNode<JSReceiver> tmp87;
+    TNode<Number> tmp88;
+    TNode<Number> tmp89;
+    TNode<Object> tmp90;
+    TNode<Number> tmp91;
+    TNode<Oddball> tmp92;
+    TNode<Object> tmp93;
+    TNode<Object> tmp94;
+    ca_.Bind(&block7, &tmp83, &tmp84, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 88);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 84);
+    ca_.Goto(&block6, tmp83, tmp84, tmp85, tmp86, tmp87, tmp88, tmp89, tmp90, tmp91, tmp92);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp95;
+    TNode<JSReceiver> tmp96;
+    TNode<JSReceiver> tmp97;
+    TNode<Object> tmp98;
+    TNode<JSReceiver> tmp99;
+    TNode<Number> tmp100;
+    TNode<Number> tmp101;
+    TNode<Object> tmp102;
+    TNode<Number> tmp103;
+    TNode<Oddball> tmp104;
+    ca_.Bind(&block6, &tmp95, &tmp96, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 75);
+    ca_.Goto(&block4, tmp95, tmp96, tmp97, tmp98, tmp99, tmp100, tmp101, tmp102, tmp103);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp105;
+    TNode<JSReceiver> tmp106;
+    TNode<JSReceiver> tmp107;
+    TNode<Object> tmp108;
+    TNode<JSReceiver> tmp109;
+    TNode<Number> tmp110;
+    TNode<Number> tmp111;
+    TNode<Object> tmp112;
+    TNode<Number> tmp113;
+    ca_.Bind(&block4, &tmp105, &tmp106, &tmp107, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112, &tmp113);
+    TNode<Number> tmp114;
+    USE(tmp114);
+    tmp114 = FromConstexpr20UT5ATSmi10HeapNumber17ATconstexpr_int31_161(state_, 1);
+    TNode<Number> tmp115;
+    USE(tmp115);
+    tmp115 = CodeStubAssembler(state_).NumberSub(TNode<Number>{tmp113}, TNode<Number>{tmp114});
+    ca_.Goto(&block3, tmp105, tmp106, tmp107, tmp108, tmp109, tmp110, tmp111, tmp112, tmp115);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp116;
+    TNode<JSReceiver> tmp117;
+    TNode<JSReceiver> tmp118;
+    TNode<Object> tmp119;
+    TNode<JSReceiver> tmp120;
+    TNode<Number> tmp121;
+    TNode<Number> tmp122;
+    TNode<Object> tmp123;
+    TNode<Number> tmp124;
+    ca_.Bind(&block2, &tmp116, &tmp117, &tmp118, &tmp119, &tmp120, &tmp121, &tmp122, &tmp123, &tmp124);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 109);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 110);
+    TNode<Oddball> tmp125;
+    USE(tmp125);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp125 = Cast9ATTheHole_88(state_, TNode<Object>{tmp123}, &label0);
+    ca_.Goto(&block13, tmp116, tmp117, tmp118, tmp119, tmp120, tmp121, tmp122, tmp123, tmp123, tmp123, tmp125);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block14, tmp116, tmp117, tmp118, tmp119, tmp120, tmp121, tmp122, tmp123, tmp123, tmp123);
+    }
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp126;
+    TNode<JSReceiver> tmp127;
+    TNode<JSReceiver> tmp128;
+    TNode<Object> tmp129;
+    TNode<JSReceiver> tmp130;
+    TNode<Number> tmp131;
+    TNode<Number> tmp132;
+    TNode<Object> tmp133;
+    TNode<Object> tmp134;
+    TNode<Object> tmp135;
+    ca_.Bind(&block14, &tmp126, &tmp127, &tmp128, &tmp129, &tmp130, &tmp131, &tmp132, &tmp133, &tmp134, &tmp135);
+    ca_.Goto(&block12, tmp126, tmp127, tmp128, tmp129, tmp130, tmp131, tmp132, tmp133, tmp134);
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp136;
+    TNode<JSReceiver> tmp137;
+    TNode<JSReceiver> tmp138;
+    TNode<Object> tmp139;
+    TNode<JSReceiver> tmp140;
+    TNode<Number> tmp141;
+    TNode<Number> tmp142;
+    TNode<Object> tmp143;
+    TNode<Object> tmp144;
+    TNode<Object> tmp145;
+    TNode<Oddball> tmp146;
+    ca_.Bind(&block13, &tmp136, &tmp137, &tmp138, &tmp139, &tmp140, &tmp141, &tmp142, &tmp143, &tmp144, &tmp145, &tmp146);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 111);
+    CodeStubAssembler(state_).ThrowTypeError(TNode<Context>{tmp136}, MessageTemplate::kReduceNoInitial, "Array.prototype.reduceRight");
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp147;
+    TNode<JSReceiver> tmp148;
+    TNode<JSReceiver> tmp149;
+    TNode<Object> tmp150;
+    TNode<JSReceiver> tmp151;
+    TNode<Number> tmp152;
+    TNode<Number> tmp153;
+    TNode<Object> tmp154;
+    TNode<Object> tmp155;
+    ca_.Bind(&block12, &tmp147, &tmp148, &tmp149, &tmp150, &tmp151, &tmp152, &tmp153, &tmp154, &tmp155);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 113);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 114);
+    CodeStubAssembler(state_).Return(ca_.UncheckedCast<Object>(tmp155));
+  }
+}
+
+TNode<Object> FastArrayReduceRight_26(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<JSReceiver> p_o, TNode<Number> p_len, TNode<JSReceiver> p_callbackfn, TNode<Object> p_initialAccumulator, compiler::CodeAssemblerLabel* label_Bailout, compiler::TypedCodeAssemblerVariable<Number>* label_Bailout_parameter_0, compiler::TypedCodeAssemblerVariable<Object>* label_Bailout_parameter_1) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Number> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Number, Smi> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSReceiver> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSReceiver, JSArray> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi, Smi, JSArray> block24(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi> block22(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi> block23(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi, Smi, Context, Smi> block28(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi, Smi, Context, Smi, JSArray, Smi> block32(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi, Smi, Context, Smi, JSArray, Smi, Object> block31(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi, Smi, Context, Smi> block29(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi, Smi, Context, Smi, JSArray, Smi> block34(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi, Smi, Context, Smi, JSArray, Smi, Object> block33(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi, Smi, Context, Smi, Object> block27(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi> block26(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi, Object> block25(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi, Object, Object, Object> block38(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi, Object, Object, Object, Oddball> block37(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi, Object, Object> block36(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi, Object, Object, Object, Context, JSReceiver, Oddball, Object, Object, Smi, JSArray> block39(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi, Object, Object> block35(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Smi> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Object, Object> block43(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Object, Object, Oddball> block42(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object, Smi, JSArray, JSArray, JSArray, Map, BoolT, Object> block41(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Number, Object> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, Number, JSReceiver, Object, Object> block44(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o, p_len, p_callbackfn, p_initialAccumulator);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<Number> tmp2;
+    TNode<JSReceiver> tmp3;
+    TNode<Object> tmp4;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 123);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 124);
+    TNode<Smi> tmp5;
+    USE(tmp5);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp5 = Cast5ATSmi_83(state_, TNode<Object>{tmp2}, &label0);
+    ca_.Goto(&block5, tmp0, tmp1, tmp2, tmp3, tmp4, tmp4, tmp2, tmp5);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block6, tmp0, tmp1, tmp2, tmp3, tmp4, tmp4, tmp2);
+    }
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp6;
+    TNode<JSReceiver> tmp7;
+    TNode<Number> tmp8;
+    TNode<JSReceiver> tmp9;
+    TNode<Object> tmp10;
+    TNode<Object> tmp11;
+    TNode<Number> tmp12;
+    ca_.Bind(&block6, &tmp6, &tmp7, &tmp8, &tmp9, &tmp10, &tmp11, &tmp12);
+    ca_.Goto(&block4, tmp6, tmp7, tmp8, tmp9, tmp10, tmp11);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp13;
+    TNode<JSReceiver> tmp14;
+    TNode<Number> tmp15;
+    TNode<JSReceiver> tmp16;
+    TNode<Object> tmp17;
+    TNode<Object> tmp18;
+    TNode<Number> tmp19;
+    TNode<Smi> tmp20;
+    ca_.Bind(&block5, &tmp13, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18, &tmp19, &tmp20);
+    ca_.Goto(&block3, tmp13, tmp14, tmp15, tmp16, tmp17, tmp18, tmp20);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp21;
+    TNode<JSReceiver> tmp22;
+    TNode<Number> tmp23;
+    TNode<JSReceiver> tmp24;
+    TNode<Object> tmp25;
+    TNode<Object> tmp26;
+    ca_.Bind(&block4, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26);
+    TNode<Number> tmp27;
+    USE(tmp27);
+    tmp27 = FromConstexpr20UT5ATSmi10HeapNumber17ATconstexpr_int31_161(state_, 1);
+    TNode<Number> tmp28;
+    USE(tmp28);
+    tmp28 = CodeStubAssembler(state_).NumberSub(TNode<Number>{tmp23}, TNode<Number>{tmp27});
+    ca_.Goto(&block1, tmp28, tmp26);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp29;
+    TNode<JSReceiver> tmp30;
+    TNode<Number> tmp31;
+    TNode<JSReceiver> tmp32;
+    TNode<Object> tmp33;
+    TNode<Object> tmp34;
+    TNode<Smi> tmp35;
+    ca_.Bind(&block3, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34, &tmp35);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 125);
+    TNode<JSArray> tmp36;
+    USE(tmp36);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp36 = Cast20ATFastJSArrayForRead_139(state_, TNode<Context>{tmp29}, TNode<HeapObject>{tmp30}, &label0);
+    ca_.Goto(&block9, tmp29, tmp30, tmp31, tmp32, tmp33, tmp34, tmp35, tmp30, tmp36);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block10, tmp29, tmp30, tmp31, tmp32, tmp33, tmp34, tmp35, tmp30);
+    }
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp37;
+    TNode<JSReceiver> tmp38;
+    TNode<Number> tmp39;
+    TNode<JSReceiver> tmp40;
+    TNode<Object> tmp41;
+    TNode<Object> tmp42;
+    TNode<Smi> tmp43;
+    TNode<JSReceiver> tmp44;
+    ca_.Bind(&block10, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44);
+    ca_.Goto(&block8, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42, tmp43);
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp45;
+    TNode<JSReceiver> tmp46;
+    TNode<Number> tmp47;
+    TNode<JSReceiver> tmp48;
+    TNode<Object> tmp49;
+    TNode<Object> tmp50;
+    TNode<Smi> tmp51;
+    TNode<JSReceiver> tmp52;
+    TNode<JSArray> tmp53;
+    ca_.Bind(&block9, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53);
+    ca_.Goto(&block7, tmp45, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51, tmp53);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp54;
+    TNode<JSReceiver> tmp55;
+    TNode<Number> tmp56;
+    TNode<JSReceiver> tmp57;
+    TNode<Object> tmp58;
+    TNode<Object> tmp59;
+    TNode<Smi> tmp60;
+    ca_.Bind(&block8, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 126);
+    TNode<Number> tmp61;
+    USE(tmp61);
+    tmp61 = FromConstexpr20UT5ATSmi10HeapNumber17ATconstexpr_int31_161(state_, 1);
+    TNode<Number> tmp62;
+    USE(tmp62);
+    tmp62 = CodeStubAssembler(state_).NumberSub(TNode<Number>{tmp56}, TNode<Number>{tmp61});
+    ca_.Goto(&block1, tmp62, tmp59);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp63;
+    TNode<JSReceiver> tmp64;
+    TNode<Number> tmp65;
+    TNode<JSReceiver> tmp66;
+    TNode<Object> tmp67;
+    TNode<Object> tmp68;
+    TNode<Smi> tmp69;
+    TNode<JSArray> tmp70;
+    ca_.Bind(&block7, &tmp63, &tmp64, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 127);
+    TNode<JSArray> tmp71;
+    USE(tmp71);
+    TNode<JSArray> tmp72;
+    USE(tmp72);
+    TNode<Map> tmp73;
+    USE(tmp73);
+    TNode<BoolT> tmp74;
+    USE(tmp74);
+    std::tie(tmp71, tmp72, tmp73, tmp74) = NewFastJSArrayForReadWitness_240(state_, TNode<JSArray>{tmp70}).Flatten();
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 130);
+    TNode<Smi> tmp75;
+    USE(tmp75);
+    tmp75 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 1);
+    TNode<Smi> tmp76;
+    USE(tmp76);
+    tmp76 = CodeStubAssembler(state_).SmiSub(TNode<Smi>{tmp69}, TNode<Smi>{tmp75});
+    ca_.Goto(&block13, tmp63, tmp64, tmp65, tmp66, tmp67, tmp68, tmp69, tmp70, tmp71, tmp72, tmp73, tmp74, tmp76);
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp77;
+    TNode<JSReceiver> tmp78;
+    TNode<Number> tmp79;
+    TNode<JSReceiver> tmp80;
+    TNode<Object> tmp81;
+    TNode<Object> tmp82;
+    TNode<Smi> tmp83;
+    TNode<JSArray> tmp84;
+    TNode<JSArray> tmp85;
+    TNode<JSArray> tmp86;
+    TNode<Map> tmp87;
+    TNode<BoolT> tmp88;
+    TNode<Smi> tmp89;
+    ca_.Bind(&block13, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89);
+    TNode<Smi> tmp90;
+    USE(tmp90);
+    tmp90 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 0);
+    TNode<BoolT> tmp91;
+    USE(tmp91);
+    tmp91 = CodeStubAssembler(state_).SmiGreaterThanOrEqual(TNode<Smi>{tmp89}, TNode<Smi>{tmp90});
+    ca_.Branch(tmp91, &block11, &block12, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, tmp83, tmp84, tmp85, tmp86, tmp87, tmp88, tmp89);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp92;
+    TNode<JSReceiver> tmp93;
+    TNode<Number> tmp94;
+    TNode<JSReceiver> tmp95;
+    TNode<Object> tmp96;
+    TNode<Object> tmp97;
+    TNode<Smi> tmp98;
+    TNode<JSArray> tmp99;
+    TNode<JSArray> tmp100;
+    TNode<JSArray> tmp101;
+    TNode<Map> tmp102;
+    TNode<BoolT> tmp103;
+    TNode<Smi> tmp104;
+    ca_.Bind(&block11, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3421);
+    TNode<IntPtrT> tmp105 = ca_.IntPtrConstant(HeapObject::kMapOffset);
+    USE(tmp105);
+    TNode<Map>tmp106 = CodeStubAssembler(state_).LoadReference<Map>(CodeStubAssembler::Reference{tmp100, tmp105});
+    TNode<BoolT> tmp107;
+    USE(tmp107);
+    tmp107 = CodeStubAssembler(state_).TaggedNotEqual(TNode<HeapObject>{tmp106}, TNode<HeapObject>{tmp102});
+    ca_.Branch(tmp107, &block18, &block19, tmp92, tmp93, tmp94, tmp95, tmp96, tmp97, tmp98, tmp99, tmp100, tmp101, tmp102, tmp103, tmp104);
+  }
+
+  if (block18.is_used()) {
+    TNode<Context> tmp108;
+    TNode<JSReceiver> tmp109;
+    TNode<Number> tmp110;
+    TNode<JSReceiver> tmp111;
+    TNode<Object> tmp112;
+    TNode<Object> tmp113;
+    TNode<Smi> tmp114;
+    TNode<JSArray> tmp115;
+    TNode<JSArray> tmp116;
+    TNode<JSArray> tmp117;
+    TNode<Map> tmp118;
+    TNode<BoolT> tmp119;
+    TNode<Smi> tmp120;
+    ca_.Bind(&block18, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115, &tmp116, &tmp117, &tmp118, &tmp119, &tmp120);
+    ca_.Goto(&block16, tmp108, tmp109, tmp110, tmp111, tmp112, tmp113, tmp114, tmp115, tmp116, tmp117, tmp118, tmp119, tmp120);
+  }
+
+  if (block19.is_used()) {
+    TNode<Context> tmp121;
+    TNode<JSReceiver> tmp122;
+    TNode<Number> tmp123;
+    TNode<JSReceiver> tmp124;
+    TNode<Object> tmp125;
+    TNode<Object> tmp126;
+    TNode<Smi> tmp127;
+    TNode<JSArray> tmp128;
+    TNode<JSArray> tmp129;
+    TNode<JSArray> tmp130;
+    TNode<Map> tmp131;
+    TNode<BoolT> tmp132;
+    TNode<Smi> tmp133;
+    ca_.Bind(&block19, &tmp121, &tmp122, &tmp123, &tmp124, &tmp125, &tmp126, &tmp127, &tmp128, &tmp129, &tmp130, &tmp131, &tmp132, &tmp133);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3428);
+    TNode<BoolT> tmp134;
+    USE(tmp134);
+    tmp134 = CodeStubAssembler(state_).IsNoElementsProtectorCellInvalid();
+    ca_.Branch(tmp134, &block20, &block21, tmp121, tmp122, tmp123, tmp124, tmp125, tmp126, tmp127, tmp128, tmp129, tmp130, tmp131, tmp132, tmp133);
+  }
+
+  if (block20.is_used()) {
+    TNode<Context> tmp135;
+    TNode<JSReceiver> tmp136;
+    TNode<Number> tmp137;
+    TNode<JSReceiver> tmp138;
+    TNode<Object> tmp139;
+    TNode<Object> tmp140;
+    TNode<Smi> tmp141;
+    TNode<JSArray> tmp142;
+    TNode<JSArray> tmp143;
+    TNode<JSArray> tmp144;
+    TNode<Map> tmp145;
+    TNode<BoolT> tmp146;
+    TNode<Smi> tmp147;
+    ca_.Bind(&block20, &tmp135, &tmp136, &tmp137, &tmp138, &tmp139, &tmp140, &tmp141, &tmp142, &tmp143, &tmp144, &tmp145, &tmp146, &tmp147);
+    ca_.Goto(&block16, tmp135, tmp136, tmp137, tmp138, tmp139, tmp140, tmp141, tmp142, tmp143, tmp144, tmp145, tmp146, tmp147);
+  }
+
+  if (block21.is_used()) {
+    TNode<Context> tmp148;
+    TNode<JSReceiver> tmp149;
+    TNode<Number> tmp150;
+    TNode<JSReceiver> tmp151;
+    TNode<Object> tmp152;
+    TNode<Object> tmp153;
+    TNode<Smi> tmp154;
+    TNode<JSArray> tmp155;
+    TNode<JSArray> tmp156;
+    TNode<JSArray> tmp157;
+    TNode<Map> tmp158;
+    TNode<BoolT> tmp159;
+    TNode<Smi> tmp160;
+    ca_.Bind(&block21, &tmp148, &tmp149, &tmp150, &tmp151, &tmp152, &tmp153, &tmp154, &tmp155, &tmp156, &tmp157, &tmp158, &tmp159, &tmp160);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3429);
+    TNode<JSArray> tmp161;
+    USE(tmp161);
+    tmp161 = (TNode<JSArray>{tmp156});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 131);
+    ca_.Goto(&block17, tmp148, tmp149, tmp150, tmp151, tmp152, tmp153, tmp154, tmp155, tmp156, tmp161, tmp158, tmp159, tmp160);
+  }
+
+  if (block17.is_used()) {
+    TNode<Context> tmp162;
+    TNode<JSReceiver> tmp163;
+    TNode<Number> tmp164;
+    TNode<JSReceiver> tmp165;
+    TNode<Object> tmp166;
+    TNode<Object> tmp167;
+    TNode<Smi> tmp168;
+    TNode<JSArray> tmp169;
+    TNode<JSArray> tmp170;
+    TNode<JSArray> tmp171;
+    TNode<Map> tmp172;
+    TNode<BoolT> tmp173;
+    TNode<Smi> tmp174;
+    ca_.Bind(&block17, &tmp162, &tmp163, &tmp164, &tmp165, &tmp166, &tmp167, &tmp168, &tmp169, &tmp170, &tmp171, &tmp172, &tmp173, &tmp174);
+    ca_.Goto(&block15, tmp162, tmp163, tmp164, tmp165, tmp166, tmp167, tmp168, tmp169, tmp170, tmp171, tmp172, tmp173, tmp174);
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp175;
+    TNode<JSReceiver> tmp176;
+    TNode<Number> tmp177;
+    TNode<JSReceiver> tmp178;
+    TNode<Object> tmp179;
+    TNode<Object> tmp180;
+    TNode<Smi> tmp181;
+    TNode<JSArray> tmp182;
+    TNode<JSArray> tmp183;
+    TNode<JSArray> tmp184;
+    TNode<Map> tmp185;
+    TNode<BoolT> tmp186;
+    TNode<Smi> tmp187;
+    ca_.Bind(&block16, &tmp175, &tmp176, &tmp177, &tmp178, &tmp179, &tmp180, &tmp181, &tmp182, &tmp183, &tmp184, &tmp185, &tmp186, &tmp187);
+    ca_.Goto(&block1, tmp187, tmp180);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp188;
+    TNode<JSReceiver> tmp189;
+    TNode<Number> tmp190;
+    TNode<JSReceiver> tmp191;
+    TNode<Object> tmp192;
+    TNode<Object> tmp193;
+    TNode<Smi> tmp194;
+    TNode<JSArray> tmp195;
+    TNode<JSArray> tmp196;
+    TNode<JSArray> tmp197;
+    TNode<Map> tmp198;
+    TNode<BoolT> tmp199;
+    TNode<Smi> tmp200;
+    ca_.Bind(&block15, &tmp188, &tmp189, &tmp190, &tmp191, &tmp192, &tmp193, &tmp194, &tmp195, &tmp196, &tmp197, &tmp198, &tmp199, &tmp200);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 134);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3417);
+    ca_.Goto(&block24, tmp188, tmp189, tmp190, tmp191, tmp192, tmp193, tmp194, tmp195, tmp196, tmp197, tmp198, tmp199, tmp200, tmp200, tmp197);
+  }
+
+  if (block24.is_used()) {
+    TNode<Context> tmp201;
+    TNode<JSReceiver> tmp202;
+    TNode<Number> tmp203;
+    TNode<JSReceiver> tmp204;
+    TNode<Object> tmp205;
+    TNode<Object> tmp206;
+    TNode<Smi> tmp207;
+    TNode<JSArray> tmp208;
+    TNode<JSArray> tmp209;
+    TNode<JSArray> tmp210;
+    TNode<Map> tmp211;
+    TNode<BoolT> tmp212;
+    TNode<Smi> tmp213;
+    TNode<Smi> tmp214;
+    TNode<JSArray> tmp215;
+    ca_.Bind(&block24, &tmp201, &tmp202, &tmp203, &tmp204, &tmp205, &tmp206, &tmp207, &tmp208, &tmp209, &tmp210, &tmp211, &tmp212, &tmp213, &tmp214, &tmp215);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 134);
+    TNode<IntPtrT> tmp216 = ca_.IntPtrConstant(JSArray::kLengthOffset);
+    USE(tmp216);
+    TNode<Number>tmp217 = CodeStubAssembler(state_).LoadReference<Number>(CodeStubAssembler::Reference{tmp215, tmp216});
+    TNode<BoolT> tmp218;
+    USE(tmp218);
+    tmp218 = NumberIsGreaterThanOrEqual_78(state_, TNode<Number>{tmp214}, TNode<Number>{tmp217});
+    ca_.Branch(tmp218, &block22, &block23, tmp201, tmp202, tmp203, tmp204, tmp205, tmp206, tmp207, tmp208, tmp209, tmp210, tmp211, tmp212, tmp213);
+  }
+
+  if (block22.is_used()) {
+    TNode<Context> tmp219;
+    TNode<JSReceiver> tmp220;
+    TNode<Number> tmp221;
+    TNode<JSReceiver> tmp222;
+    TNode<Object> tmp223;
+    TNode<Object> tmp224;
+    TNode<Smi> tmp225;
+    TNode<JSArray> tmp226;
+    TNode<JSArray> tmp227;
+    TNode<JSArray> tmp228;
+    TNode<Map> tmp229;
+    TNode<BoolT> tmp230;
+    TNode<Smi> tmp231;
+    ca_.Bind(&block22, &tmp219, &tmp220, &tmp221, &tmp222, &tmp223, &tmp224, &tmp225, &tmp226, &tmp227, &tmp228, &tmp229, &tmp230, &tmp231);
+    ca_.Goto(&block1, tmp231, tmp224);
+  }
+
+  if (block23.is_used()) {
+    TNode<Context> tmp232;
+    TNode<JSReceiver> tmp233;
+    TNode<Number> tmp234;
+    TNode<JSReceiver> tmp235;
+    TNode<Object> tmp236;
+    TNode<Object> tmp237;
+    TNode<Smi> tmp238;
+    TNode<JSArray> tmp239;
+    TNode<JSArray> tmp240;
+    TNode<JSArray> tmp241;
+    TNode<Map> tmp242;
+    TNode<BoolT> tmp243;
+    TNode<Smi> tmp244;
+    ca_.Bind(&block23, &tmp232, &tmp233, &tmp234, &tmp235, &tmp236, &tmp237, &tmp238, &tmp239, &tmp240, &tmp241, &tmp242, &tmp243, &tmp244);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 136);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3434);
+    ca_.Branch(tmp243, &block28, &block29, tmp232, tmp233, tmp234, tmp235, tmp236, tmp237, tmp238, tmp239, tmp240, tmp241, tmp242, tmp243, tmp244, tmp244, tmp232, tmp244);
+  }
+
+  if (block28.is_used()) {
+    TNode<Context> tmp245;
+    TNode<JSReceiver> tmp246;
+    TNode<Number> tmp247;
+    TNode<JSReceiver> tmp248;
+    TNode<Object> tmp249;
+    TNode<Object> tmp250;
+    TNode<Smi> tmp251;
+    TNode<JSArray> tmp252;
+    TNode<JSArray> tmp253;
+    TNode<JSArray> tmp254;
+    TNode<Map> tmp255;
+    TNode<BoolT> tmp256;
+    TNode<Smi> tmp257;
+    TNode<Smi> tmp258;
+    TNode<Context> tmp259;
+    TNode<Smi> tmp260;
+    ca_.Bind(&block28, &tmp245, &tmp246, &tmp247, &tmp248, &tmp249, &tmp250, &tmp251, &tmp252, &tmp253, &tmp254, &tmp255, &tmp256, &tmp257, &tmp258, &tmp259, &tmp260);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3435);
+    TNode<Object> tmp261;
+    USE(tmp261);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp261 = LoadElementNoHole16FixedDoubleArray_238(state_, TNode<Context>{tmp259}, TNode<JSArray>{tmp254}, TNode<Smi>{tmp260}, &label0);
+    ca_.Goto(&block31, tmp245, tmp246, tmp247, tmp248, tmp249, tmp250, tmp251, tmp252, tmp253, tmp254, tmp255, tmp256, tmp257, tmp258, tmp259, tmp260, tmp254, tmp260, tmp261);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block32, tmp245, tmp246, tmp247, tmp248, tmp249, tmp250, tmp251, tmp252, tmp253, tmp254, tmp255, tmp256, tmp257, tmp258, tmp259, tmp260, tmp254, tmp260);
+    }
+  }
+
+  if (block32.is_used()) {
+    TNode<Context> tmp262;
+    TNode<JSReceiver> tmp263;
+    TNode<Number> tmp264;
+    TNode<JSReceiver> tmp265;
+    TNode<Object> tmp266;
+    TNode<Object> tmp267;
+    TNode<Smi> tmp268;
+    TNode<JSArray> tmp269;
+    TNode<JSArray> tmp270;
+    TNode<JSArray> tmp271;
+    TNode<Map> tmp272;
+    TNode<BoolT> tmp273;
+    TNode<Smi> tmp274;
+    TNode<Smi> tmp275;
+    TNode<Context> tmp276;
+    TNode<Smi> tmp277;
+    TNode<JSArray> tmp278;
+    TNode<Smi> tmp279;
+    ca_.Bind(&block32, &tmp262, &tmp263, &tmp264, &tmp265, &tmp266, &tmp267, &tmp268, &tmp269, &tmp270, &tmp271, &tmp272, &tmp273, &tmp274, &tmp275, &tmp276, &tmp277, &tmp278, &tmp279);
+    ca_.Goto(&block26, tmp262, tmp263, tmp264, tmp265, tmp266, tmp267, tmp268, tmp269, tmp270, tmp271, tmp272, tmp273, tmp274);
+  }
+
+  if (block31.is_used()) {
+    TNode<Context> tmp280;
+    TNode<JSReceiver> tmp281;
+    TNode<Number> tmp282;
+    TNode<JSReceiver> tmp283;
+    TNode<Object> tmp284;
+    TNode<Object> tmp285;
+    TNode<Smi> tmp286;
+    TNode<JSArray> tmp287;
+    TNode<JSArray> tmp288;
+    TNode<JSArray> tmp289;
+    TNode<Map> tmp290;
+    TNode<BoolT> tmp291;
+    TNode<Smi> tmp292;
+    TNode<Smi> tmp293;
+    TNode<Context> tmp294;
+    TNode<Smi> tmp295;
+    TNode<JSArray> tmp296;
+    TNode<Smi> tmp297;
+    TNode<Object> tmp298;
+    ca_.Bind(&block31, &tmp280, &tmp281, &tmp282, &tmp283, &tmp284, &tmp285, &tmp286, &tmp287, &tmp288, &tmp289, &tmp290, &tmp291, &tmp292, &tmp293, &tmp294, &tmp295, &tmp296, &tmp297, &tmp298);
+    ca_.Goto(&block27, tmp280, tmp281, tmp282, tmp283, tmp284, tmp285, tmp286, tmp287, tmp288, tmp289, tmp290, tmp291, tmp292, tmp293, tmp294, tmp295, tmp298);
+  }
+
+  if (block29.is_used()) {
+    TNode<Context> tmp299;
+    TNode<JSReceiver> tmp300;
+    TNode<Number> tmp301;
+    TNode<JSReceiver> tmp302;
+    TNode<Object> tmp303;
+    TNode<Object> tmp304;
+    TNode<Smi> tmp305;
+    TNode<JSArray> tmp306;
+    TNode<JSArray> tmp307;
+    TNode<JSArray> tmp308;
+    TNode<Map> tmp309;
+    TNode<BoolT> tmp310;
+    TNode<Smi> tmp311;
+    TNode<Smi> tmp312;
+    TNode<Context> tmp313;
+    TNode<Smi> tmp314;
+    ca_.Bind(&block29, &tmp299, &tmp300, &tmp301, &tmp302, &tmp303, &tmp304, &tmp305, &tmp306, &tmp307, &tmp308, &tmp309, &tmp310, &tmp311, &tmp312, &tmp313, &tmp314);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3438);
+    TNode<Object> tmp315;
+    USE(tmp315);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp315 = LoadElementNoHole10FixedArray_237(state_, TNode<Context>{tmp313}, TNode<JSArray>{tmp308}, TNode<Smi>{tmp314}, &label0);
+    ca_.Goto(&block33, tmp299, tmp300, tmp301, tmp302, tmp303, tmp304, tmp305, tmp306, tmp307, tmp308, tmp309, tmp310, tmp311, tmp312, tmp313, tmp314, tmp308, tmp314, tmp315);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block34, tmp299, tmp300, tmp301, tmp302, tmp303, tmp304, tmp305, tmp306, tmp307, tmp308, tmp309, tmp310, tmp311, tmp312, tmp313, tmp314, tmp308, tmp314);
+    }
+  }
+
+  if (block34.is_used()) {
+    TNode<Context> tmp316;
+    TNode<JSReceiver> tmp317;
+    TNode<Number> tmp318;
+    TNode<JSReceiver> tmp319;
+    TNode<Object> tmp320;
+    TNode<Object> tmp321;
+    TNode<Smi> tmp322;
+    TNode<JSArray> tmp323;
+    TNode<JSArray> tmp324;
+    TNode<JSArray> tmp325;
+    TNode<Map> tmp326;
+    TNode<BoolT> tmp327;
+    TNode<Smi> tmp328;
+    TNode<Smi> tmp329;
+    TNode<Context> tmp330;
+    TNode<Smi> tmp331;
+    TNode<JSArray> tmp332;
+    TNode<Smi> tmp333;
+    ca_.Bind(&block34, &tmp316, &tmp317, &tmp318, &tmp319, &tmp320, &tmp321, &tmp322, &tmp323, &tmp324, &tmp325, &tmp326, &tmp327, &tmp328, &tmp329, &tmp330, &tmp331, &tmp332, &tmp333);
+    ca_.Goto(&block26, tmp316, tmp317, tmp318, tmp319, tmp320, tmp321, tmp322, tmp323, tmp324, tmp325, tmp326, tmp327, tmp328);
+  }
+
+  if (block33.is_used()) {
+    TNode<Context> tmp334;
+    TNode<JSReceiver> tmp335;
+    TNode<Number> tmp336;
+    TNode<JSReceiver> tmp337;
+    TNode<Object> tmp338;
+    TNode<Object> tmp339;
+    TNode<Smi> tmp340;
+    TNode<JSArray> tmp341;
+    TNode<JSArray> tmp342;
+    TNode<JSArray> tmp343;
+    TNode<Map> tmp344;
+    TNode<BoolT> tmp345;
+    TNode<Smi> tmp346;
+    TNode<Smi> tmp347;
+    TNode<Context> tmp348;
+    TNode<Smi> tmp349;
+    TNode<JSArray> tmp350;
+    TNode<Smi> tmp351;
+    TNode<Object> tmp352;
+    ca_.Bind(&block33, &tmp334, &tmp335, &tmp336, &tmp337, &tmp338, &tmp339, &tmp340, &tmp341, &tmp342, &tmp343, &tmp344, &tmp345, &tmp346, &tmp347, &tmp348, &tmp349, &tmp350, &tmp351, &tmp352);
+    ca_.Goto(&block27, tmp334, tmp335, tmp336, tmp337, tmp338, tmp339, tmp340, tmp341, tmp342, tmp343, tmp344, tmp345, tmp346, tmp347, tmp348, tmp349, tmp352);
+  }
+
+  if (block27.is_used()) {
+    TNode<Context> tmp353;
+    TNode<JSReceiver> tmp354;
+    TNode<Number> tmp355;
+    TNode<JSReceiver> tmp356;
+    TNode<Object> tmp357;
+    TNode<Object> tmp358;
+    TNode<Smi> tmp359;
+    TNode<JSArray> tmp360;
+    TNode<JSArray> tmp361;
+    TNode<JSArray> tmp362;
+    TNode<Map> tmp363;
+    TNode<BoolT> tmp364;
+    TNode<Smi> tmp365;
+    TNode<Smi> tmp366;
+    TNode<Context> tmp367;
+    TNode<Smi> tmp368;
+    TNode<Object> tmp369;
+    ca_.Bind(&block27, &tmp353, &tmp354, &tmp355, &tmp356, &tmp357, &tmp358, &tmp359, &tmp360, &tmp361, &tmp362, &tmp363, &tmp364, &tmp365, &tmp366, &tmp367, &tmp368, &tmp369);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 136);
+    ca_.Goto(&block25, tmp353, tmp354, tmp355, tmp356, tmp357, tmp358, tmp359, tmp360, tmp361, tmp362, tmp363, tmp364, tmp365, tmp369);
+  }
+
+  if (block26.is_used()) {
+    TNode<Context> tmp370;
+    TNode<JSReceiver> tmp371;
+    TNode<Number> tmp372;
+    TNode<JSReceiver> tmp373;
+    TNode<Object> tmp374;
+    TNode<Object> tmp375;
+    TNode<Smi> tmp376;
+    TNode<JSArray> tmp377;
+    TNode<JSArray> tmp378;
+    TNode<JSArray> tmp379;
+    TNode<Map> tmp380;
+    TNode<BoolT> tmp381;
+    TNode<Smi> tmp382;
+    ca_.Bind(&block26, &tmp370, &tmp371, &tmp372, &tmp373, &tmp374, &tmp375, &tmp376, &tmp377, &tmp378, &tmp379, &tmp380, &tmp381, &tmp382);
+    ca_.Goto(&block14, tmp370, tmp371, tmp372, tmp373, tmp374, tmp375, tmp376, tmp377, tmp378, tmp379, tmp380, tmp381, tmp382);
+  }
+
+  if (block25.is_used()) {
+    TNode<Context> tmp383;
+    TNode<JSReceiver> tmp384;
+    TNode<Number> tmp385;
+    TNode<JSReceiver> tmp386;
+    TNode<Object> tmp387;
+    TNode<Object> tmp388;
+    TNode<Smi> tmp389;
+    TNode<JSArray> tmp390;
+    TNode<JSArray> tmp391;
+    TNode<JSArray> tmp392;
+    TNode<Map> tmp393;
+    TNode<BoolT> tmp394;
+    TNode<Smi> tmp395;
+    TNode<Object> tmp396;
+    ca_.Bind(&block25, &tmp383, &tmp384, &tmp385, &tmp386, &tmp387, &tmp388, &tmp389, &tmp390, &tmp391, &tmp392, &tmp393, &tmp394, &tmp395, &tmp396);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 137);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 138);
+    TNode<Oddball> tmp397;
+    USE(tmp397);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp397 = Cast9ATTheHole_88(state_, TNode<Object>{tmp388}, &label0);
+    ca_.Goto(&block37, tmp383, tmp384, tmp385, tmp386, tmp387, tmp388, tmp389, tmp390, tmp391, tmp392, tmp393, tmp394, tmp395, tmp396, tmp388, tmp388, tmp397);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block38, tmp383, tmp384, tmp385, tmp386, tmp387, tmp388, tmp389, tmp390, tmp391, tmp392, tmp393, tmp394, tmp395, tmp396, tmp388, tmp388);
+    }
+  }
+
+  if (block38.is_used()) {
+    TNode<Context> tmp398;
+    TNode<JSReceiver> tmp399;
+    TNode<Number> tmp400;
+    TNode<JSReceiver> tmp401;
+    TNode<Object> tmp402;
+    TNode<Object> tmp403;
+    TNode<Smi> tmp404;
+    TNode<JSArray> tmp405;
+    TNode<JSArray> tmp406;
+    TNode<JSArray> tmp407;
+    TNode<Map> tmp408;
+    TNode<BoolT> tmp409;
+    TNode<Smi> tmp410;
+    TNode<Object> tmp411;
+    TNode<Object> tmp412;
+    TNode<Object> tmp413;
+    ca_.Bind(&block38, &tmp398, &tmp399, &tmp400, &tmp401, &tmp402, &tmp403, &tmp404, &tmp405, &tmp406, &tmp407, &tmp408, &tmp409, &tmp410, &tmp411, &tmp412, &tmp413);
+    ca_.Goto(&block36, tmp398, tmp399, tmp400, tmp401, tmp402, tmp403, tmp404, tmp405, tmp406, tmp407, tmp408, tmp409, tmp410, tmp411, tmp412);
+  }
+
+  if (block37.is_used()) {
+    TNode<Context> tmp414;
+    TNode<JSReceiver> tmp415;
+    TNode<Number> tmp416;
+    TNode<JSReceiver> tmp417;
+    TNode<Object> tmp418;
+    TNode<Object> tmp419;
+    TNode<Smi> tmp420;
+    TNode<JSArray> tmp421;
+    TNode<JSArray> tmp422;
+    TNode<JSArray> tmp423;
+    TNode<Map> tmp424;
+    TNode<BoolT> tmp425;
+    TNode<Smi> tmp426;
+    TNode<Object> tmp427;
+    TNode<Object> tmp428;
+    TNode<Object> tmp429;
+    TNode<Oddball> tmp430;
+    ca_.Bind(&block37, &tmp414, &tmp415, &tmp416, &tmp417, &tmp418, &tmp419, &tmp420, &tmp421, &tmp422, &tmp423, &tmp424, &tmp425, &tmp426, &tmp427, &tmp428, &tmp429, &tmp430);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 139);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 138);
+    ca_.Goto(&block35, tmp414, tmp415, tmp416, tmp417, tmp418, tmp427, tmp420, tmp421, tmp422, tmp423, tmp424, tmp425, tmp426, tmp427, tmp428);
+  }
+
+  if (block36.is_used()) {
+    TNode<Context> tmp431;
+    TNode<JSReceiver> tmp432;
+    TNode<Number> tmp433;
+    TNode<JSReceiver> tmp434;
+    TNode<Object> tmp435;
+    TNode<Object> tmp436;
+    TNode<Smi> tmp437;
+    TNode<JSArray> tmp438;
+    TNode<JSArray> tmp439;
+    TNode<JSArray> tmp440;
+    TNode<Map> tmp441;
+    TNode<BoolT> tmp442;
+    TNode<Smi> tmp443;
+    TNode<Object> tmp444;
+    TNode<Object> tmp445;
+    ca_.Bind(&block36, &tmp431, &tmp432, &tmp433, &tmp434, &tmp435, &tmp436, &tmp437, &tmp438, &tmp439, &tmp440, &tmp441, &tmp442, &tmp443, &tmp444, &tmp445);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 141);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 143);
+    TNode<Oddball> tmp446;
+    USE(tmp446);
+    tmp446 = Undefined_64(state_);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3417);
+    ca_.Goto(&block39, tmp431, tmp432, tmp433, tmp434, tmp435, tmp436, tmp437, tmp438, tmp439, tmp440, tmp441, tmp442, tmp443, tmp444, tmp445, ca_.UncheckedCast<Object>(tmp445), tmp431, tmp434, tmp446, ca_.UncheckedCast<Object>(tmp445), tmp444, tmp443, tmp440);
+  }
+
+  if (block39.is_used()) {
+    TNode<Context> tmp447;
+    TNode<JSReceiver> tmp448;
+    TNode<Number> tmp449;
+    TNode<JSReceiver> tmp450;
+    TNode<Object> tmp451;
+    TNode<Object> tmp452;
+    TNode<Smi> tmp453;
+    TNode<JSArray> tmp454;
+    TNode<JSArray> tmp455;
+    TNode<JSArray> tmp456;
+    TNode<Map> tmp457;
+    TNode<BoolT> tmp458;
+    TNode<Smi> tmp459;
+    TNode<Object> tmp460;
+    TNode<Object> tmp461;
+    TNode<Object> tmp462;
+    TNode<Context> tmp463;
+    TNode<JSReceiver> tmp464;
+    TNode<Oddball> tmp465;
+    TNode<Object> tmp466;
+    TNode<Object> tmp467;
+    TNode<Smi> tmp468;
+    TNode<JSArray> tmp469;
+    ca_.Bind(&block39, &tmp447, &tmp448, &tmp449, &tmp450, &tmp451, &tmp452, &tmp453, &tmp454, &tmp455, &tmp456, &tmp457, &tmp458, &tmp459, &tmp460, &tmp461, &tmp462, &tmp463, &tmp464, &tmp465, &tmp466, &tmp467, &tmp468, &tmp469);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 142);
+    TNode<Object> tmp470;
+    USE(tmp470);
+    tmp470 = CodeStubAssembler(state_).Call(TNode<Context>{tmp463}, TNode<JSReceiver>{tmp464}, TNode<Object>{tmp465}, TNode<Object>{tmp466}, TNode<Object>{tmp467}, TNode<Object>{tmp468}, TNode<Object>{tmp469});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 138);
+    ca_.Goto(&block35, tmp447, tmp448, tmp449, tmp450, tmp451, tmp470, tmp453, tmp454, tmp455, tmp456, tmp457, tmp458, tmp459, tmp460, tmp461);
+  }
+
+  if (block35.is_used()) {
+    TNode<Context> tmp471;
+    TNode<JSReceiver> tmp472;
+    TNode<Number> tmp473;
+    TNode<JSReceiver> tmp474;
+    TNode<Object> tmp475;
+    TNode<Object> tmp476;
+    TNode<Smi> tmp477;
+    TNode<JSArray> tmp478;
+    TNode<JSArray> tmp479;
+    TNode<JSArray> tmp480;
+    TNode<Map> tmp481;
+    TNode<BoolT> tmp482;
+    TNode<Smi> tmp483;
+    TNode<Object> tmp484;
+    TNode<Object> tmp485;
+    ca_.Bind(&block35, &tmp471, &tmp472, &tmp473, &tmp474, &tmp475, &tmp476, &tmp477, &tmp478, &tmp479, &tmp480, &tmp481, &tmp482, &tmp483, &tmp484, &tmp485);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 137);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 130);
+    ca_.Goto(&block14, tmp471, tmp472, tmp473, tmp474, tmp475, tmp476, tmp477, tmp478, tmp479, tmp480, tmp481, tmp482, tmp483);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp486;
+    TNode<JSReceiver> tmp487;
+    TNode<Number> tmp488;
+    TNode<JSReceiver> tmp489;
+    TNode<Object> tmp490;
+    TNode<Object> tmp491;
+    TNode<Smi> tmp492;
+    TNode<JSArray> tmp493;
+    TNode<JSArray> tmp494;
+    TNode<JSArray> tmp495;
+    TNode<Map> tmp496;
+    TNode<BoolT> tmp497;
+    TNode<Smi> tmp498;
+    ca_.Bind(&block14, &tmp486, &tmp487, &tmp488, &tmp489, &tmp490, &tmp491, &tmp492, &tmp493, &tmp494, &tmp495, &tmp496, &tmp497, &tmp498);
+    TNode<Smi> tmp499;
+    USE(tmp499);
+    tmp499 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 1);
+    TNode<Smi> tmp500;
+    USE(tmp500);
+    tmp500 = CodeStubAssembler(state_).SmiSub(TNode<Smi>{tmp498}, TNode<Smi>{tmp499});
+    ca_.Goto(&block13, tmp486, tmp487, tmp488, tmp489, tmp490, tmp491, tmp492, tmp493, tmp494, tmp495, tmp496, tmp497, tmp500);
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp501;
+    TNode<JSReceiver> tmp502;
+    TNode<Number> tmp503;
+    TNode<JSReceiver> tmp504;
+    TNode<Object> tmp505;
+    TNode<Object> tmp506;
+    TNode<Smi> tmp507;
+    TNode<JSArray> tmp508;
+    TNode<JSArray> tmp509;
+    TNode<JSArray> tmp510;
+    TNode<Map> tmp511;
+    TNode<BoolT> tmp512;
+    TNode<Smi> tmp513;
+    ca_.Bind(&block12, &tmp501, &tmp502, &tmp503, &tmp504, &tmp505, &tmp506, &tmp507, &tmp508, &tmp509, &tmp510, &tmp511, &tmp512, &tmp513);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 148);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 149);
+    TNode<Oddball> tmp514;
+    USE(tmp514);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp514 = Cast9ATTheHole_88(state_, TNode<Object>{tmp506}, &label0);
+    ca_.Goto(&block42, tmp501, tmp502, tmp503, tmp504, tmp505, tmp506, tmp507, tmp508, tmp509, tmp510, tmp511, tmp512, tmp506, tmp506, tmp514);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block43, tmp501, tmp502, tmp503, tmp504, tmp505, tmp506, tmp507, tmp508, tmp509, tmp510, tmp511, tmp512, tmp506, tmp506);
+    }
+  }
+
+  if (block43.is_used()) {
+    TNode<Context> tmp515;
+    TNode<JSReceiver> tmp516;
+    TNode<Number> tmp517;
+    TNode<JSReceiver> tmp518;
+    TNode<Object> tmp519;
+    TNode<Object> tmp520;
+    TNode<Smi> tmp521;
+    TNode<JSArray> tmp522;
+    TNode<JSArray> tmp523;
+    TNode<JSArray> tmp524;
+    TNode<Map> tmp525;
+    TNode<BoolT> tmp526;
+    TNode<Object> tmp527;
+    TNode<Object> tmp528;
+    ca_.Bind(&block43, &tmp515, &tmp516, &tmp517, &tmp518, &tmp519, &tmp520, &tmp521, &tmp522, &tmp523, &tmp524, &tmp525, &tmp526, &tmp527, &tmp528);
+    ca_.Goto(&block41, tmp515, tmp516, tmp517, tmp518, tmp519, tmp520, tmp521, tmp522, tmp523, tmp524, tmp525, tmp526, tmp527);
+  }
+
+  if (block42.is_used()) {
+    TNode<Context> tmp529;
+    TNode<JSReceiver> tmp530;
+    TNode<Number> tmp531;
+    TNode<JSReceiver> tmp532;
+    TNode<Object> tmp533;
+    TNode<Object> tmp534;
+    TNode<Smi> tmp535;
+    TNode<JSArray> tmp536;
+    TNode<JSArray> tmp537;
+    TNode<JSArray> tmp538;
+    TNode<Map> tmp539;
+    TNode<BoolT> tmp540;
+    TNode<Object> tmp541;
+    TNode<Object> tmp542;
+    TNode<Oddball> tmp543;
+    ca_.Bind(&block42, &tmp529, &tmp530, &tmp531, &tmp532, &tmp533, &tmp534, &tmp535, &tmp536, &tmp537, &tmp538, &tmp539, &tmp540, &tmp541, &tmp542, &tmp543);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 150);
+    CodeStubAssembler(state_).ThrowTypeError(TNode<Context>{tmp529}, MessageTemplate::kReduceNoInitial, "Array.prototype.reduceRight");
+  }
+
+  if (block41.is_used()) {
+    TNode<Context> tmp544;
+    TNode<JSReceiver> tmp545;
+    TNode<Number> tmp546;
+    TNode<JSReceiver> tmp547;
+    TNode<Object> tmp548;
+    TNode<Object> tmp549;
+    TNode<Smi> tmp550;
+    TNode<JSArray> tmp551;
+    TNode<JSArray> tmp552;
+    TNode<JSArray> tmp553;
+    TNode<Map> tmp554;
+    TNode<BoolT> tmp555;
+    TNode<Object> tmp556;
+    ca_.Bind(&block41, &tmp544, &tmp545, &tmp546, &tmp547, &tmp548, &tmp549, &tmp550, &tmp551, &tmp552, &tmp553, &tmp554, &tmp555, &tmp556);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 152);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 153);
+    ca_.Goto(&block2, tmp544, tmp545, tmp546, tmp547, tmp548, ca_.UncheckedCast<Object>(tmp556));
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp557;
+    TNode<JSReceiver> tmp558;
+    TNode<Number> tmp559;
+    TNode<JSReceiver> tmp560;
+    TNode<Object> tmp561;
+    TNode<Object> tmp562;
+    ca_.Bind(&block2, &tmp557, &tmp558, &tmp559, &tmp560, &tmp561, &tmp562);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 119);
+    ca_.Goto(&block44, tmp557, tmp558, tmp559, tmp560, tmp561, tmp562);
+  }
+
+  if (block1.is_used()) {
+    TNode<Number> tmp563;
+    TNode<Object> tmp564;
+    ca_.Bind(&block1, &tmp563, &tmp564);
+    *label_Bailout_parameter_1 = tmp564;
+    *label_Bailout_parameter_0 = tmp563;
+    ca_.Goto(label_Bailout);
+  }
+
+    TNode<Context> tmp565;
+    TNode<JSReceiver> tmp566;
+    TNode<Number> tmp567;
+    TNode<JSReceiver> tmp568;
+    TNode<Object> tmp569;
+    TNode<Object> tmp570;
+    ca_.Bind(&block44, &tmp565, &tmp566, &tmp567, &tmp568, &tmp569, &tmp570);
+  return TNode<Object>{tmp570};
+}
+
+TF_BUILTIN(ArrayReduceRight, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  Node* argc = Parameter(Descriptor::kJSActualArgumentsCount);
+  TNode<IntPtrT> arguments_length(ChangeInt32ToIntPtr(argc));
+  TNode<RawPtrT> arguments_frame = UncheckedCast<RawPtrT>(LoadFramePointer());
+  TorqueStructArguments torque_arguments(GetFrameArguments(arguments_frame, arguments_length));
+  CodeStubArguments arguments(this, torque_arguments);
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = arguments.GetReceiver();
+USE(parameter1);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, Object> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, Object, JSReceiver> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, JSReceiver, Object, Number, Object> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, JSReceiver, Number, JSReceiver, Object, Object> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSReceiver, Number, JSReceiver, Object, Number, Object> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object> block2(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+    ca_.Goto(&block0, torque_arguments.frame, torque_arguments.base, torque_arguments.length, parameter0, parameter1);
+
+  if (block0.is_used()) {
+    TNode<RawPtrT> tmp0;
+    TNode<RawPtrT> tmp1;
+    TNode<IntPtrT> tmp2;
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 163);
+    TNode<Object> tmp5;
+    USE(tmp5);
+    tmp5 = RequireObjectCoercible_244(state_, TNode<Context>{tmp3}, TNode<Object>{tmp4}, "Array.prototype.reduceRight");
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 166);
+    TNode<JSReceiver> tmp6;
+    USE(tmp6);
+    tmp6 = CodeStubAssembler(state_).ToObject_Inline(TNode<Context>{tmp3}, TNode<Object>{tmp4});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 169);
+    TNode<Number> tmp7;
+    USE(tmp7);
+    tmp7 = GetLengthProperty_247(state_, TNode<Context>{tmp3}, TNode<Object>{tmp6});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 172);
+    TNode<IntPtrT> tmp8;
+    USE(tmp8);
+    tmp8 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<BoolT> tmp9;
+    USE(tmp9);
+    tmp9 = CodeStubAssembler(state_).WordEqual(TNode<IntPtrT>{tmp2}, TNode<IntPtrT>{tmp8});
+    ca_.Branch(tmp9, &block3, &block4, tmp0, tmp1, tmp2, tmp3, tmp4, tmp6, tmp7);
+  }
+
+  if (block3.is_used()) {
+    TNode<RawPtrT> tmp10;
+    TNode<RawPtrT> tmp11;
+    TNode<IntPtrT> tmp12;
+    TNode<Context> tmp13;
+    TNode<Object> tmp14;
+    TNode<JSReceiver> tmp15;
+    TNode<Number> tmp16;
+    ca_.Bind(&block3, &tmp10, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 173);
+    ca_.Goto(&block2, tmp10, tmp11, tmp12, tmp13, tmp14);
+  }
+
+  if (block4.is_used()) {
+    TNode<RawPtrT> tmp17;
+    TNode<RawPtrT> tmp18;
+    TNode<IntPtrT> tmp19;
+    TNode<Context> tmp20;
+    TNode<Object> tmp21;
+    TNode<JSReceiver> tmp22;
+    TNode<Number> tmp23;
+    ca_.Bind(&block4, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 175);
+    TNode<IntPtrT> tmp24;
+    USE(tmp24);
+    tmp24 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<Object> tmp25;
+    USE(tmp25);
+    tmp25 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp17}, TNode<RawPtrT>{tmp18}, TNode<IntPtrT>{tmp19}}, TNode<IntPtrT>{tmp24});
+    TNode<JSReceiver> tmp26;
+    USE(tmp26);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp26 = Cast71UT19ATCallableApiObject17ATCallableJSProxy15JSBoundFunction10JSFunction_1366(state_, TNode<Context>{tmp20}, TNode<Object>{tmp25}, &label0);
+    ca_.Goto(&block5, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp25, tmp26);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block6, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp25);
+    }
+  }
+
+  if (block6.is_used()) {
+    TNode<RawPtrT> tmp27;
+    TNode<RawPtrT> tmp28;
+    TNode<IntPtrT> tmp29;
+    TNode<Context> tmp30;
+    TNode<Object> tmp31;
+    TNode<JSReceiver> tmp32;
+    TNode<Number> tmp33;
+    TNode<Object> tmp34;
+    ca_.Bind(&block6, &tmp27, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34);
+    ca_.Goto(&block2, tmp27, tmp28, tmp29, tmp30, tmp31);
+  }
+
+  if (block5.is_used()) {
+    TNode<RawPtrT> tmp35;
+    TNode<RawPtrT> tmp36;
+    TNode<IntPtrT> tmp37;
+    TNode<Context> tmp38;
+    TNode<Object> tmp39;
+    TNode<JSReceiver> tmp40;
+    TNode<Number> tmp41;
+    TNode<Object> tmp42;
+    TNode<JSReceiver> tmp43;
+    ca_.Bind(&block5, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 182);
+    TNode<IntPtrT> tmp44;
+    USE(tmp44);
+    tmp44 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<BoolT> tmp45;
+    USE(tmp45);
+    tmp45 = CodeStubAssembler(state_).IntPtrGreaterThan(TNode<IntPtrT>{tmp37}, TNode<IntPtrT>{tmp44});
+    ca_.Branch(tmp45, &block7, &block8, tmp35, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp43);
+  }
+
+  if (block7.is_used()) {
+    TNode<RawPtrT> tmp46;
+    TNode<RawPtrT> tmp47;
+    TNode<IntPtrT> tmp48;
+    TNode<Context> tmp49;
+    TNode<Object> tmp50;
+    TNode<JSReceiver> tmp51;
+    TNode<Number> tmp52;
+    TNode<JSReceiver> tmp53;
+    ca_.Bind(&block7, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53);
+    TNode<IntPtrT> tmp54;
+    USE(tmp54);
+    tmp54 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<Object> tmp55;
+    USE(tmp55);
+    tmp55 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp46}, TNode<RawPtrT>{tmp47}, TNode<IntPtrT>{tmp48}}, TNode<IntPtrT>{tmp54});
+    ca_.Goto(&block10, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51, tmp52, tmp53, tmp55);
+  }
+
+  if (block8.is_used()) {
+    TNode<RawPtrT> tmp56;
+    TNode<RawPtrT> tmp57;
+    TNode<IntPtrT> tmp58;
+    TNode<Context> tmp59;
+    TNode<Object> tmp60;
+    TNode<JSReceiver> tmp61;
+    TNode<Number> tmp62;
+    TNode<JSReceiver> tmp63;
+    ca_.Bind(&block8, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63);
+    TNode<Oddball> tmp64;
+    USE(tmp64);
+    tmp64 = TheHole_62(state_);
+    ca_.Goto(&block9, tmp56, tmp57, tmp58, tmp59, tmp60, tmp61, tmp62, tmp63, tmp64);
+  }
+
+  if (block10.is_used()) {
+    TNode<RawPtrT> tmp65;
+    TNode<RawPtrT> tmp66;
+    TNode<IntPtrT> tmp67;
+    TNode<Context> tmp68;
+    TNode<Object> tmp69;
+    TNode<JSReceiver> tmp70;
+    TNode<Number> tmp71;
+    TNode<JSReceiver> tmp72;
+    TNode<Object> tmp73;
+    ca_.Bind(&block10, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73);
+    ca_.Goto(&block9, tmp65, tmp66, tmp67, tmp68, tmp69, tmp70, tmp71, tmp72, tmp73);
+  }
+
+  if (block9.is_used()) {
+    TNode<RawPtrT> tmp74;
+    TNode<RawPtrT> tmp75;
+    TNode<IntPtrT> tmp76;
+    TNode<Context> tmp77;
+    TNode<Object> tmp78;
+    TNode<JSReceiver> tmp79;
+    TNode<Number> tmp80;
+    TNode<JSReceiver> tmp81;
+    TNode<Object> tmp82;
+    ca_.Bind(&block9, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 181);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 185);
+    TNode<Object> tmp83;
+    USE(tmp83);
+    compiler::TypedCodeAssemblerVariable<Number> result_0_0(&ca_);
+    compiler::TypedCodeAssemblerVariable<Object> result_0_1(&ca_);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp83 = FastArrayReduceRight_26(state_, TNode<Context>{tmp77}, TNode<JSReceiver>{tmp79}, TNode<Number>{tmp80}, TNode<JSReceiver>{tmp81}, TNode<Object>{tmp82}, &label0, &result_0_0, &result_0_1);
+    ca_.Goto(&block13, tmp74, tmp75, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, tmp79, tmp80, tmp81, tmp82, tmp83);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block14, tmp74, tmp75, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, tmp79, tmp80, tmp81, tmp82, result_0_0.value(), result_0_1.value());
+    }
+  }
+
+  if (block14.is_used()) {
+    TNode<RawPtrT> tmp84;
+    TNode<RawPtrT> tmp85;
+    TNode<IntPtrT> tmp86;
+    TNode<Context> tmp87;
+    TNode<Object> tmp88;
+    TNode<JSReceiver> tmp89;
+    TNode<Number> tmp90;
+    TNode<JSReceiver> tmp91;
+    TNode<Object> tmp92;
+    TNode<JSReceiver> tmp93;
+    TNode<Number> tmp94;
+    TNode<JSReceiver> tmp95;
+    TNode<Object> tmp96;
+    TNode<Number> tmp97;
+    TNode<Object> tmp98;
+    ca_.Bind(&block14, &tmp84, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96, &tmp97, &tmp98);
+    ca_.Goto(&block12, tmp84, tmp85, tmp86, tmp87, tmp88, tmp89, tmp90, tmp91, tmp92, tmp97, tmp98);
+  }
+
+  if (block13.is_used()) {
+    TNode<RawPtrT> tmp99;
+    TNode<RawPtrT> tmp100;
+    TNode<IntPtrT> tmp101;
+    TNode<Context> tmp102;
+    TNode<Object> tmp103;
+    TNode<JSReceiver> tmp104;
+    TNode<Number> tmp105;
+    TNode<JSReceiver> tmp106;
+    TNode<Object> tmp107;
+    TNode<JSReceiver> tmp108;
+    TNode<Number> tmp109;
+    TNode<JSReceiver> tmp110;
+    TNode<Object> tmp111;
+    TNode<Object> tmp112;
+    ca_.Bind(&block13, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104, &tmp105, &tmp106, &tmp107, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112);
+    arguments.PopAndReturn(tmp112);
+  }
+
+  if (block12.is_used()) {
+    TNode<RawPtrT> tmp113;
+    TNode<RawPtrT> tmp114;
+    TNode<IntPtrT> tmp115;
+    TNode<Context> tmp116;
+    TNode<Object> tmp117;
+    TNode<JSReceiver> tmp118;
+    TNode<Number> tmp119;
+    TNode<JSReceiver> tmp120;
+    TNode<Object> tmp121;
+    TNode<Number> tmp122;
+    TNode<Object> tmp123;
+    ca_.Bind(&block12, &tmp113, &tmp114, &tmp115, &tmp116, &tmp117, &tmp118, &tmp119, &tmp120, &tmp121, &tmp122, &tmp123);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 190);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 189);
+    TNode<Object> tmp124;
+    tmp124 = CodeStubAssembler(state_).CallBuiltin(Builtins::kArrayReduceRightLoopContinuation, tmp116, tmp118, tmp120, tmp123, tmp118, tmp122, tmp119);
+    USE(tmp124);
+    arguments.PopAndReturn(tmp124);
+  }
+
+  if (block2.is_used()) {
+    TNode<RawPtrT> tmp125;
+    TNode<RawPtrT> tmp126;
+    TNode<IntPtrT> tmp127;
+    TNode<Context> tmp128;
+    TNode<Object> tmp129;
+    ca_.Bind(&block2, &tmp125, &tmp126, &tmp127, &tmp128, &tmp129);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reduce-right.tq", 194);
+    TNode<IntPtrT> tmp130;
+    USE(tmp130);
+    tmp130 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<Object> tmp131;
+    USE(tmp131);
+    tmp131 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp125}, TNode<RawPtrT>{tmp126}, TNode<IntPtrT>{tmp127}}, TNode<IntPtrT>{tmp130});
+    CodeStubAssembler(state_).ThrowTypeError(TNode<Context>{tmp128}, MessageTemplate::kCalledNonCallable, TNode<Object>{tmp131});
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
+
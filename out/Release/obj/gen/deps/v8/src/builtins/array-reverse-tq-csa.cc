@@ -0,0 +1,2186 @@
+#include "src/builtins/builtins-array-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-utils-gen.h"
+#include "src/builtins/builtins.h"
+#include "src/codegen/code-factory.h"
+#include "src/heap/factory-inl.h"
+#include "src/objects/arguments.h"
+#include "src/objects/bigint.h"
+#include "src/objects/elements-kind.h"
+#include "src/objects/free-space.h"
+#include "src/objects/js-generator.h"
+#include "src/objects/js-promise.h"
+#include "src/objects/js-regexp-string-iterator.h"
+#include "src/objects/js-weak-refs.h"
+#include "src/objects/objects.h"
+#include "src/objects/source-text-module.h"
+#include "src/objects/stack-frame-info.h"
+#include "src/objects/synthetic-module.h"
+#include "src/objects/template-objects.h"
+#include "src/builtins/builtins-bigint-gen.h"
+#include "src/builtins/builtins-collections-gen.h"
+#include "src/builtins/builtins-data-view-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-iterator-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-string-gen.h"
+#include "src/builtins/builtins-string-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-constructor-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "torque-generated/../../deps/v8/src/builtins/arguments-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-copywithin-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-join-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-lastindexof-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-map-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-right-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reverse-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-shift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-splice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-unshift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/base-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/bigint-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/boolean-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/collections-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/data-view-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/extras-utils-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/frames-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/growable-fixed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/internal-coverage-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/math-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-fromentries-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-constructor-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-delete-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-has-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-is-extensible-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-prevent-extensions-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revocable-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revoke-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/reflect-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-exec-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-all-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-replace-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-search-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-source-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-split-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-test-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-endswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-html-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-pad-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-repeat-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-startswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-substring-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/torque-internal-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-createtypedarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduceright-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-subarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/third_party/v8/builtins/array-sort-tq-csa.h"
+#include "torque-generated/../../deps/v8/test/torque/test-torque-tq-csa.h"
+
+namespace v8 {
+namespace internal {
+
+TNode<Smi> LoadElement23ATFastPackedSmiElements5ATSmi_28(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<FixedArrayBase> p_elements, TNode<Smi> p_index) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, FixedArray, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, FixedArray, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, FixedArray, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, FixedArray, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, FixedArray, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, FixedArray, FixedArray, IntPtrT, IntPtrT, Smi, Smi, HeapObject, IntPtrT> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Smi> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Smi> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_elements, p_index);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<FixedArrayBase> tmp1;
+    TNode<Smi> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 11);
+    TNode<FixedArray> tmp3;
+    USE(tmp3);
+    tmp3 = UnsafeCast10FixedArray_1370(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 12);
+    TNode<IntPtrT> tmp4 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp4);
+    TNode<IntPtrT> tmp5 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp5);
+    TNode<Smi>tmp6 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp3, tmp5});
+    TNode<IntPtrT> tmp7;
+    USE(tmp7);
+    tmp7 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp6});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 55);
+    TNode<IntPtrT> tmp8;
+    USE(tmp8);
+    tmp8 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp2});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 56);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp9;
+    USE(tmp9);
+    tmp9 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp8});
+    TNode<UintPtrT> tmp10;
+    USE(tmp10);
+    tmp10 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp7});
+    TNode<BoolT> tmp11;
+    USE(tmp11);
+    tmp11 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp9}, TNode<UintPtrT>{tmp10});
+    ca_.Branch(tmp11, &block6, &block7, tmp0, tmp1, tmp2, tmp3, tmp3, tmp4, tmp7, tmp2, tmp2, tmp8, tmp3, tmp4, tmp7, tmp8, tmp8);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp12;
+    TNode<FixedArrayBase> tmp13;
+    TNode<Smi> tmp14;
+    TNode<FixedArray> tmp15;
+    TNode<FixedArray> tmp16;
+    TNode<IntPtrT> tmp17;
+    TNode<IntPtrT> tmp18;
+    TNode<Smi> tmp19;
+    TNode<Smi> tmp20;
+    TNode<IntPtrT> tmp21;
+    TNode<HeapObject> tmp22;
+    TNode<IntPtrT> tmp23;
+    TNode<IntPtrT> tmp24;
+    TNode<IntPtrT> tmp25;
+    TNode<IntPtrT> tmp26;
+    ca_.Bind(&block6, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp27;
+    USE(tmp27);
+    tmp27 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp28;
+    USE(tmp28);
+    tmp28 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp26}, TNode<IntPtrT>{tmp27});
+    TNode<IntPtrT> tmp29;
+    USE(tmp29);
+    tmp29 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp23}, TNode<IntPtrT>{tmp28});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp30;
+    USE(tmp30);
+    TNode<IntPtrT> tmp31;
+    USE(tmp31);
+    std::tie(tmp30, tmp31) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp22}, TNode<IntPtrT>{tmp29}).Flatten();
+    ca_.Goto(&block5, tmp12, tmp13, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26, tmp30, tmp31);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp32;
+    TNode<FixedArrayBase> tmp33;
+    TNode<Smi> tmp34;
+    TNode<FixedArray> tmp35;
+    TNode<FixedArray> tmp36;
+    TNode<IntPtrT> tmp37;
+    TNode<IntPtrT> tmp38;
+    TNode<Smi> tmp39;
+    TNode<Smi> tmp40;
+    TNode<IntPtrT> tmp41;
+    TNode<HeapObject> tmp42;
+    TNode<IntPtrT> tmp43;
+    TNode<IntPtrT> tmp44;
+    TNode<IntPtrT> tmp45;
+    TNode<IntPtrT> tmp46;
+    ca_.Bind(&block7, &tmp32, &tmp33, &tmp34, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44, &tmp45, &tmp46);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block4, tmp32, tmp33, tmp34, tmp35, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp47;
+    TNode<FixedArrayBase> tmp48;
+    TNode<Smi> tmp49;
+    TNode<FixedArray> tmp50;
+    TNode<FixedArray> tmp51;
+    TNode<IntPtrT> tmp52;
+    TNode<IntPtrT> tmp53;
+    TNode<Smi> tmp54;
+    TNode<Smi> tmp55;
+    TNode<IntPtrT> tmp56;
+    TNode<HeapObject> tmp57;
+    TNode<IntPtrT> tmp58;
+    TNode<IntPtrT> tmp59;
+    TNode<IntPtrT> tmp60;
+    TNode<IntPtrT> tmp61;
+    TNode<HeapObject> tmp62;
+    TNode<IntPtrT> tmp63;
+    ca_.Bind(&block5, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 56);
+    ca_.Goto(&block3, tmp47, tmp48, tmp49, tmp50, tmp51, tmp52, tmp53, tmp54, tmp55, tmp56, tmp62, tmp63);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp64;
+    TNode<FixedArrayBase> tmp65;
+    TNode<Smi> tmp66;
+    TNode<FixedArray> tmp67;
+    TNode<FixedArray> tmp68;
+    TNode<IntPtrT> tmp69;
+    TNode<IntPtrT> tmp70;
+    TNode<Smi> tmp71;
+    TNode<Smi> tmp72;
+    TNode<IntPtrT> tmp73;
+    ca_.Bind(&block4, &tmp64, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp74;
+    TNode<FixedArrayBase> tmp75;
+    TNode<Smi> tmp76;
+    TNode<FixedArray> tmp77;
+    TNode<FixedArray> tmp78;
+    TNode<IntPtrT> tmp79;
+    TNode<IntPtrT> tmp80;
+    TNode<Smi> tmp81;
+    TNode<Smi> tmp82;
+    TNode<IntPtrT> tmp83;
+    TNode<HeapObject> tmp84;
+    TNode<IntPtrT> tmp85;
+    ca_.Bind(&block3, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85);
+    ca_.Goto(&block2, tmp74, tmp75, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, tmp84, tmp85);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp86;
+    TNode<FixedArrayBase> tmp87;
+    TNode<Smi> tmp88;
+    TNode<FixedArray> tmp89;
+    TNode<FixedArray> tmp90;
+    TNode<IntPtrT> tmp91;
+    TNode<IntPtrT> tmp92;
+    TNode<Smi> tmp93;
+    TNode<Smi> tmp94;
+    TNode<HeapObject> tmp95;
+    TNode<IntPtrT> tmp96;
+    ca_.Bind(&block2, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 12);
+    TNode<Object>tmp97 = CodeStubAssembler(state_).LoadReference<Object>(CodeStubAssembler::Reference{tmp95, tmp96});
+    TNode<Smi> tmp98;
+    USE(tmp98);
+    tmp98 = UnsafeCast5ATSmi_1371(state_, TNode<Context>{tmp86}, TNode<Object>{tmp97});
+    ca_.Goto(&block1, tmp86, tmp87, tmp88, tmp98);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp99;
+    TNode<FixedArrayBase> tmp100;
+    TNode<Smi> tmp101;
+    TNode<Smi> tmp102;
+    ca_.Bind(&block1, &tmp99, &tmp100, &tmp101, &tmp102);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 9);
+    ca_.Goto(&block9, tmp99, tmp100, tmp101, tmp102);
+  }
+
+    TNode<Context> tmp103;
+    TNode<FixedArrayBase> tmp104;
+    TNode<Smi> tmp105;
+    TNode<Smi> tmp106;
+    ca_.Bind(&block9, &tmp103, &tmp104, &tmp105, &tmp106);
+  return TNode<Smi>{tmp106};
+}
+
+TNode<Object> LoadElement26ATFastPackedObjectElements90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol_29(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<FixedArrayBase> p_elements, TNode<Smi> p_index) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, FixedArray, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, FixedArray, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, FixedArray, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, FixedArray, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, FixedArray, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, FixedArray, FixedArray, IntPtrT, IntPtrT, Smi, Smi, HeapObject, IntPtrT> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Object> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Object> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_elements, p_index);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<FixedArrayBase> tmp1;
+    TNode<Smi> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 17);
+    TNode<FixedArray> tmp3;
+    USE(tmp3);
+    tmp3 = UnsafeCast10FixedArray_1370(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 18);
+    TNode<IntPtrT> tmp4 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp4);
+    TNode<IntPtrT> tmp5 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp5);
+    TNode<Smi>tmp6 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp3, tmp5});
+    TNode<IntPtrT> tmp7;
+    USE(tmp7);
+    tmp7 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp6});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 55);
+    TNode<IntPtrT> tmp8;
+    USE(tmp8);
+    tmp8 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp2});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 56);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp9;
+    USE(tmp9);
+    tmp9 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp8});
+    TNode<UintPtrT> tmp10;
+    USE(tmp10);
+    tmp10 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp7});
+    TNode<BoolT> tmp11;
+    USE(tmp11);
+    tmp11 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp9}, TNode<UintPtrT>{tmp10});
+    ca_.Branch(tmp11, &block6, &block7, tmp0, tmp1, tmp2, tmp3, tmp3, tmp4, tmp7, tmp2, tmp2, tmp8, tmp3, tmp4, tmp7, tmp8, tmp8);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp12;
+    TNode<FixedArrayBase> tmp13;
+    TNode<Smi> tmp14;
+    TNode<FixedArray> tmp15;
+    TNode<FixedArray> tmp16;
+    TNode<IntPtrT> tmp17;
+    TNode<IntPtrT> tmp18;
+    TNode<Smi> tmp19;
+    TNode<Smi> tmp20;
+    TNode<IntPtrT> tmp21;
+    TNode<HeapObject> tmp22;
+    TNode<IntPtrT> tmp23;
+    TNode<IntPtrT> tmp24;
+    TNode<IntPtrT> tmp25;
+    TNode<IntPtrT> tmp26;
+    ca_.Bind(&block6, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp27;
+    USE(tmp27);
+    tmp27 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp28;
+    USE(tmp28);
+    tmp28 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp26}, TNode<IntPtrT>{tmp27});
+    TNode<IntPtrT> tmp29;
+    USE(tmp29);
+    tmp29 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp23}, TNode<IntPtrT>{tmp28});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp30;
+    USE(tmp30);
+    TNode<IntPtrT> tmp31;
+    USE(tmp31);
+    std::tie(tmp30, tmp31) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp22}, TNode<IntPtrT>{tmp29}).Flatten();
+    ca_.Goto(&block5, tmp12, tmp13, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26, tmp30, tmp31);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp32;
+    TNode<FixedArrayBase> tmp33;
+    TNode<Smi> tmp34;
+    TNode<FixedArray> tmp35;
+    TNode<FixedArray> tmp36;
+    TNode<IntPtrT> tmp37;
+    TNode<IntPtrT> tmp38;
+    TNode<Smi> tmp39;
+    TNode<Smi> tmp40;
+    TNode<IntPtrT> tmp41;
+    TNode<HeapObject> tmp42;
+    TNode<IntPtrT> tmp43;
+    TNode<IntPtrT> tmp44;
+    TNode<IntPtrT> tmp45;
+    TNode<IntPtrT> tmp46;
+    ca_.Bind(&block7, &tmp32, &tmp33, &tmp34, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44, &tmp45, &tmp46);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block4, tmp32, tmp33, tmp34, tmp35, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp47;
+    TNode<FixedArrayBase> tmp48;
+    TNode<Smi> tmp49;
+    TNode<FixedArray> tmp50;
+    TNode<FixedArray> tmp51;
+    TNode<IntPtrT> tmp52;
+    TNode<IntPtrT> tmp53;
+    TNode<Smi> tmp54;
+    TNode<Smi> tmp55;
+    TNode<IntPtrT> tmp56;
+    TNode<HeapObject> tmp57;
+    TNode<IntPtrT> tmp58;
+    TNode<IntPtrT> tmp59;
+    TNode<IntPtrT> tmp60;
+    TNode<IntPtrT> tmp61;
+    TNode<HeapObject> tmp62;
+    TNode<IntPtrT> tmp63;
+    ca_.Bind(&block5, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 56);
+    ca_.Goto(&block3, tmp47, tmp48, tmp49, tmp50, tmp51, tmp52, tmp53, tmp54, tmp55, tmp56, tmp62, tmp63);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp64;
+    TNode<FixedArrayBase> tmp65;
+    TNode<Smi> tmp66;
+    TNode<FixedArray> tmp67;
+    TNode<FixedArray> tmp68;
+    TNode<IntPtrT> tmp69;
+    TNode<IntPtrT> tmp70;
+    TNode<Smi> tmp71;
+    TNode<Smi> tmp72;
+    TNode<IntPtrT> tmp73;
+    ca_.Bind(&block4, &tmp64, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp74;
+    TNode<FixedArrayBase> tmp75;
+    TNode<Smi> tmp76;
+    TNode<FixedArray> tmp77;
+    TNode<FixedArray> tmp78;
+    TNode<IntPtrT> tmp79;
+    TNode<IntPtrT> tmp80;
+    TNode<Smi> tmp81;
+    TNode<Smi> tmp82;
+    TNode<IntPtrT> tmp83;
+    TNode<HeapObject> tmp84;
+    TNode<IntPtrT> tmp85;
+    ca_.Bind(&block3, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85);
+    ca_.Goto(&block2, tmp74, tmp75, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, tmp84, tmp85);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp86;
+    TNode<FixedArrayBase> tmp87;
+    TNode<Smi> tmp88;
+    TNode<FixedArray> tmp89;
+    TNode<FixedArray> tmp90;
+    TNode<IntPtrT> tmp91;
+    TNode<IntPtrT> tmp92;
+    TNode<Smi> tmp93;
+    TNode<Smi> tmp94;
+    TNode<HeapObject> tmp95;
+    TNode<IntPtrT> tmp96;
+    ca_.Bind(&block2, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 18);
+    TNode<Object>tmp97 = CodeStubAssembler(state_).LoadReference<Object>(CodeStubAssembler::Reference{tmp95, tmp96});
+    TNode<Object> tmp98;
+    USE(tmp98);
+    tmp98 = UnsafeCast90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol_1373(state_, TNode<Context>{tmp86}, TNode<Object>{tmp97});
+    ca_.Goto(&block1, tmp86, tmp87, tmp88, tmp98);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp99;
+    TNode<FixedArrayBase> tmp100;
+    TNode<Smi> tmp101;
+    TNode<Object> tmp102;
+    ca_.Bind(&block1, &tmp99, &tmp100, &tmp101, &tmp102);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 15);
+    ca_.Goto(&block9, tmp99, tmp100, tmp101, tmp102);
+  }
+
+    TNode<Context> tmp103;
+    TNode<FixedArrayBase> tmp104;
+    TNode<Smi> tmp105;
+    TNode<Object> tmp106;
+    ca_.Bind(&block9, &tmp103, &tmp104, &tmp105, &tmp106);
+  return TNode<Object>{tmp106};
+}
+
+TNode<Float64T> LoadElement26ATFastPackedDoubleElements9ATfloat64_30(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<FixedArrayBase> p_elements, TNode<Smi> p_index) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, FixedDoubleArray, FixedDoubleArray, Smi> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, FixedDoubleArray, FixedDoubleArray, Smi, Float64T> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, FixedDoubleArray> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, FixedDoubleArray, Float64T> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Float64T> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Float64T> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_elements, p_index);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<FixedArrayBase> tmp1;
+    TNode<Smi> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 24);
+    TNode<FixedDoubleArray> tmp3;
+    USE(tmp3);
+    tmp3 = UnsafeCast16FixedDoubleArray_1374(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 27);
+    TNode<Float64T> tmp4;
+    USE(tmp4);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp4 = CodeStubAssembler(state_).LoadDoubleWithHoleCheck(TNode<FixedDoubleArray>{tmp3}, TNode<Smi>{tmp2}, &label0);
+    ca_.Goto(&block4, tmp0, tmp1, tmp2, tmp3, tmp3, tmp2, tmp4);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block5, tmp0, tmp1, tmp2, tmp3, tmp3, tmp2);
+    }
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp5;
+    TNode<FixedArrayBase> tmp6;
+    TNode<Smi> tmp7;
+    TNode<FixedDoubleArray> tmp8;
+    TNode<FixedDoubleArray> tmp9;
+    TNode<Smi> tmp10;
+    ca_.Bind(&block5, &tmp5, &tmp6, &tmp7, &tmp8, &tmp9, &tmp10);
+    ca_.Goto(&block3, tmp5, tmp6, tmp7, tmp8);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp11;
+    TNode<FixedArrayBase> tmp12;
+    TNode<Smi> tmp13;
+    TNode<FixedDoubleArray> tmp14;
+    TNode<FixedDoubleArray> tmp15;
+    TNode<Smi> tmp16;
+    TNode<Float64T> tmp17;
+    ca_.Bind(&block4, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16, &tmp17);
+    ca_.Goto(&block2, tmp11, tmp12, tmp13, tmp14, tmp17);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp18;
+    TNode<FixedArrayBase> tmp19;
+    TNode<Smi> tmp20;
+    TNode<FixedDoubleArray> tmp21;
+    ca_.Bind(&block3, &tmp18, &tmp19, &tmp20, &tmp21);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 28);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp22;
+    TNode<FixedArrayBase> tmp23;
+    TNode<Smi> tmp24;
+    TNode<FixedDoubleArray> tmp25;
+    TNode<Float64T> tmp26;
+    ca_.Bind(&block2, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 27);
+    ca_.Goto(&block1, tmp22, tmp23, tmp24, tmp26);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp27;
+    TNode<FixedArrayBase> tmp28;
+    TNode<Smi> tmp29;
+    TNode<Float64T> tmp30;
+    ca_.Bind(&block1, &tmp27, &tmp28, &tmp29, &tmp30);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 21);
+    ca_.Goto(&block6, tmp27, tmp28, tmp29, tmp30);
+  }
+
+    TNode<Context> tmp31;
+    TNode<FixedArrayBase> tmp32;
+    TNode<Smi> tmp33;
+    TNode<Float64T> tmp34;
+    ca_.Bind(&block6, &tmp31, &tmp32, &tmp33, &tmp34);
+  return TNode<Float64T>{tmp34};
+}
+
+void StoreElement23ATFastPackedSmiElements5ATSmi_31(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<FixedArrayBase> p_elements, TNode<Smi> p_index, TNode<Smi> p_value) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Smi> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Smi> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Smi> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_elements, p_index, p_value);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<FixedArrayBase> tmp1;
+    TNode<Smi> tmp2;
+    TNode<Smi> tmp3;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 37);
+    TNode<FixedArray> tmp4;
+    USE(tmp4);
+    tmp4 = UnsafeCast10FixedArray_1370(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 38);
+    CodeStubAssembler(state_).StoreFixedArrayElement(TNode<FixedArray>{tmp4}, TNode<Smi>{tmp2}, TNode<Smi>{tmp3}, SKIP_WRITE_BARRIER);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 36);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 35);
+    ca_.Goto(&block1, tmp0, tmp1, tmp2, tmp3);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp5;
+    TNode<FixedArrayBase> tmp6;
+    TNode<Smi> tmp7;
+    TNode<Smi> tmp8;
+    ca_.Bind(&block1, &tmp5, &tmp6, &tmp7, &tmp8);
+    ca_.Goto(&block2, tmp5, tmp6, tmp7, tmp8);
+  }
+
+    TNode<Context> tmp9;
+    TNode<FixedArrayBase> tmp10;
+    TNode<Smi> tmp11;
+    TNode<Smi> tmp12;
+    ca_.Bind(&block2, &tmp9, &tmp10, &tmp11, &tmp12);
+}
+
+void StoreElement26ATFastPackedObjectElements90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol_32(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<FixedArrayBase> p_elements, TNode<Smi> p_index, TNode<Object> p_value) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Object, FixedArray, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Object, FixedArray, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Object, FixedArray, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Object, FixedArray, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Object, FixedArray, FixedArray, IntPtrT, IntPtrT, Smi, Smi, IntPtrT, HeapObject, IntPtrT> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Object, FixedArray, FixedArray, IntPtrT, IntPtrT, Smi, Smi, HeapObject, IntPtrT> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Object> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Object> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_elements, p_index, p_value);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<FixedArrayBase> tmp1;
+    TNode<Smi> tmp2;
+    TNode<Object> tmp3;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 44);
+    TNode<FixedArray> tmp4;
+    USE(tmp4);
+    tmp4 = UnsafeCast10FixedArray_1370(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 45);
+    TNode<IntPtrT> tmp5 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp5);
+    TNode<IntPtrT> tmp6 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp6);
+    TNode<Smi>tmp7 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp4, tmp6});
+    TNode<IntPtrT> tmp8;
+    USE(tmp8);
+    tmp8 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp7});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 55);
+    TNode<IntPtrT> tmp9;
+    USE(tmp9);
+    tmp9 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp2});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 56);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp10;
+    USE(tmp10);
+    tmp10 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp9});
+    TNode<UintPtrT> tmp11;
+    USE(tmp11);
+    tmp11 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp8});
+    TNode<BoolT> tmp12;
+    USE(tmp12);
+    tmp12 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp10}, TNode<UintPtrT>{tmp11});
+    ca_.Branch(tmp12, &block6, &block7, tmp0, tmp1, tmp2, tmp3, tmp4, tmp4, tmp5, tmp8, tmp2, tmp2, tmp9, tmp4, tmp5, tmp8, tmp9, tmp9);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp13;
+    TNode<FixedArrayBase> tmp14;
+    TNode<Smi> tmp15;
+    TNode<Object> tmp16;
+    TNode<FixedArray> tmp17;
+    TNode<FixedArray> tmp18;
+    TNode<IntPtrT> tmp19;
+    TNode<IntPtrT> tmp20;
+    TNode<Smi> tmp21;
+    TNode<Smi> tmp22;
+    TNode<IntPtrT> tmp23;
+    TNode<HeapObject> tmp24;
+    TNode<IntPtrT> tmp25;
+    TNode<IntPtrT> tmp26;
+    TNode<IntPtrT> tmp27;
+    TNode<IntPtrT> tmp28;
+    ca_.Bind(&block6, &tmp13, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27, &tmp28);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp29;
+    USE(tmp29);
+    tmp29 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp30;
+    USE(tmp30);
+    tmp30 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp28}, TNode<IntPtrT>{tmp29});
+    TNode<IntPtrT> tmp31;
+    USE(tmp31);
+    tmp31 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp25}, TNode<IntPtrT>{tmp30});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp32;
+    USE(tmp32);
+    TNode<IntPtrT> tmp33;
+    USE(tmp33);
+    std::tie(tmp32, tmp33) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp24}, TNode<IntPtrT>{tmp31}).Flatten();
+    ca_.Goto(&block5, tmp13, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27, tmp28, tmp32, tmp33);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp34;
+    TNode<FixedArrayBase> tmp35;
+    TNode<Smi> tmp36;
+    TNode<Object> tmp37;
+    TNode<FixedArray> tmp38;
+    TNode<FixedArray> tmp39;
+    TNode<IntPtrT> tmp40;
+    TNode<IntPtrT> tmp41;
+    TNode<Smi> tmp42;
+    TNode<Smi> tmp43;
+    TNode<IntPtrT> tmp44;
+    TNode<HeapObject> tmp45;
+    TNode<IntPtrT> tmp46;
+    TNode<IntPtrT> tmp47;
+    TNode<IntPtrT> tmp48;
+    TNode<IntPtrT> tmp49;
+    ca_.Bind(&block7, &tmp34, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block4, tmp34, tmp35, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42, tmp43, tmp44);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp50;
+    TNode<FixedArrayBase> tmp51;
+    TNode<Smi> tmp52;
+    TNode<Object> tmp53;
+    TNode<FixedArray> tmp54;
+    TNode<FixedArray> tmp55;
+    TNode<IntPtrT> tmp56;
+    TNode<IntPtrT> tmp57;
+    TNode<Smi> tmp58;
+    TNode<Smi> tmp59;
+    TNode<IntPtrT> tmp60;
+    TNode<HeapObject> tmp61;
+    TNode<IntPtrT> tmp62;
+    TNode<IntPtrT> tmp63;
+    TNode<IntPtrT> tmp64;
+    TNode<IntPtrT> tmp65;
+    TNode<HeapObject> tmp66;
+    TNode<IntPtrT> tmp67;
+    ca_.Bind(&block5, &tmp50, &tmp51, &tmp52, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66, &tmp67);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 56);
+    ca_.Goto(&block3, tmp50, tmp51, tmp52, tmp53, tmp54, tmp55, tmp56, tmp57, tmp58, tmp59, tmp60, tmp66, tmp67);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp68;
+    TNode<FixedArrayBase> tmp69;
+    TNode<Smi> tmp70;
+    TNode<Object> tmp71;
+    TNode<FixedArray> tmp72;
+    TNode<FixedArray> tmp73;
+    TNode<IntPtrT> tmp74;
+    TNode<IntPtrT> tmp75;
+    TNode<Smi> tmp76;
+    TNode<Smi> tmp77;
+    TNode<IntPtrT> tmp78;
+    ca_.Bind(&block4, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp79;
+    TNode<FixedArrayBase> tmp80;
+    TNode<Smi> tmp81;
+    TNode<Object> tmp82;
+    TNode<FixedArray> tmp83;
+    TNode<FixedArray> tmp84;
+    TNode<IntPtrT> tmp85;
+    TNode<IntPtrT> tmp86;
+    TNode<Smi> tmp87;
+    TNode<Smi> tmp88;
+    TNode<IntPtrT> tmp89;
+    TNode<HeapObject> tmp90;
+    TNode<IntPtrT> tmp91;
+    ca_.Bind(&block3, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91);
+    ca_.Goto(&block2, tmp79, tmp80, tmp81, tmp82, tmp83, tmp84, tmp85, tmp86, tmp87, tmp88, tmp90, tmp91);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp92;
+    TNode<FixedArrayBase> tmp93;
+    TNode<Smi> tmp94;
+    TNode<Object> tmp95;
+    TNode<FixedArray> tmp96;
+    TNode<FixedArray> tmp97;
+    TNode<IntPtrT> tmp98;
+    TNode<IntPtrT> tmp99;
+    TNode<Smi> tmp100;
+    TNode<Smi> tmp101;
+    TNode<HeapObject> tmp102;
+    TNode<IntPtrT> tmp103;
+    ca_.Bind(&block2, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 45);
+    CodeStubAssembler(state_).StoreReference(CodeStubAssembler::Reference{tmp102, tmp103}, tmp95);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 43);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 41);
+    ca_.Goto(&block1, tmp92, tmp93, tmp94, tmp95);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp104;
+    TNode<FixedArrayBase> tmp105;
+    TNode<Smi> tmp106;
+    TNode<Object> tmp107;
+    ca_.Bind(&block1, &tmp104, &tmp105, &tmp106, &tmp107);
+    ca_.Goto(&block9, tmp104, tmp105, tmp106, tmp107);
+  }
+
+    TNode<Context> tmp108;
+    TNode<FixedArrayBase> tmp109;
+    TNode<Smi> tmp110;
+    TNode<Object> tmp111;
+    ca_.Bind(&block9, &tmp108, &tmp109, &tmp110, &tmp111);
+}
+
+void StoreElement26ATFastPackedDoubleElements9ATfloat64_33(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<FixedArrayBase> p_elements, TNode<Smi> p_index, TNode<Float64T> p_value) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Float64T> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Float64T> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Float64T> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_elements, p_index, p_value);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<FixedArrayBase> tmp1;
+    TNode<Smi> tmp2;
+    TNode<Float64T> tmp3;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 51);
+    TNode<FixedDoubleArray> tmp4;
+    USE(tmp4);
+    tmp4 = UnsafeCast16FixedDoubleArray_1374(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 52);
+    CodeStubAssembler(state_).StoreFixedDoubleArrayElementSmi(TNode<FixedDoubleArray>{tmp4}, TNode<Smi>{tmp2}, TNode<Float64T>{tmp3});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 50);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 48);
+    ca_.Goto(&block1, tmp0, tmp1, tmp2, tmp3);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp5;
+    TNode<FixedArrayBase> tmp6;
+    TNode<Smi> tmp7;
+    TNode<Float64T> tmp8;
+    ca_.Bind(&block1, &tmp5, &tmp6, &tmp7, &tmp8);
+    ca_.Goto(&block2, tmp5, tmp6, tmp7, tmp8);
+  }
+
+    TNode<Context> tmp9;
+    TNode<FixedArrayBase> tmp10;
+    TNode<Smi> tmp11;
+    TNode<Float64T> tmp12;
+    ca_.Bind(&block2, &tmp9, &tmp10, &tmp11, &tmp12);
+}
+
+TNode<Object> GenericArrayReverse_34(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_receiver) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Number, Number, Number> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Number, Number, Number> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Number, Number, Number, Object, Object, Oddball> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Number, Number, Number, Object, Object, Oddball> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Number, Number, Number, Object, Object, Oddball, Oddball> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Number, Number, Number, Object, Object, Oddball, Oddball> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Number, Number, Number, Object, Object, Oddball, Oddball, BoolT> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Number, Number, Number, Object, Object, Oddball, Oddball, BoolT> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Number, Number, Number, Object, Object, Oddball, Oddball, BoolT, BoolT> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Number, Number, Number, Object, Object, Oddball, Oddball> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Number, Number, Number, Object, Object, Oddball, Oddball> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Number, Number, Number, Object, Object, Oddball, Oddball, BoolT> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Number, Number, Number, Object, Object, Oddball, Oddball, BoolT> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Number, Number, Number, Object, Object, Oddball, Oddball, BoolT, BoolT> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Number, Number, Number, Object, Object, Oddball, Oddball> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Number, Number, Number, Object, Object, Oddball, Oddball> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Number, Number, Number, Object, Object, Oddball, Oddball, BoolT> block23(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Number, Number, Number, Object, Object, Oddball, Oddball, BoolT> block24(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Number, Number, Number, Object, Object, Oddball, Oddball, BoolT, BoolT> block25(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Number, Number, Number, Object, Object, Oddball, Oddball> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Number, Number, Number, Object, Object, Oddball, Oddball> block22(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Number, Number, Number, Object, Object, Oddball, Oddball> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Number, Number, Number, Object, Object, Oddball, Oddball> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Number, Number, Number> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block26(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_receiver);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 76);
+    TNode<JSReceiver> tmp2;
+    USE(tmp2);
+    tmp2 = CodeStubAssembler(state_).ToObject_Inline(TNode<Context>{tmp0}, TNode<Object>{tmp1});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 79);
+    TNode<Number> tmp3;
+    USE(tmp3);
+    tmp3 = GetLengthProperty_247(state_, TNode<Context>{tmp0}, TNode<Object>{tmp2});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 88);
+    TNode<Number> tmp4;
+    USE(tmp4);
+    tmp4 = FromConstexpr20UT5ATSmi10HeapNumber17ATconstexpr_int31_161(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 89);
+    TNode<Number> tmp5;
+    USE(tmp5);
+    tmp5 = FromConstexpr20UT5ATSmi10HeapNumber17ATconstexpr_int31_161(state_, 1);
+    TNode<Number> tmp6;
+    USE(tmp6);
+    tmp6 = CodeStubAssembler(state_).NumberSub(TNode<Number>{tmp3}, TNode<Number>{tmp5});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 91);
+    ca_.Goto(&block4, tmp0, tmp1, tmp2, tmp3, tmp4, tmp6);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp7;
+    TNode<Object> tmp8;
+    TNode<JSReceiver> tmp9;
+    TNode<Number> tmp10;
+    TNode<Number> tmp11;
+    TNode<Number> tmp12;
+    ca_.Bind(&block4, &tmp7, &tmp8, &tmp9, &tmp10, &tmp11, &tmp12);
+    TNode<BoolT> tmp13;
+    USE(tmp13);
+    tmp13 = NumberIsLessThan_75(state_, TNode<Number>{tmp11}, TNode<Number>{tmp12});
+    ca_.Branch(tmp13, &block2, &block3, tmp7, tmp8, tmp9, tmp10, tmp11, tmp12);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp14;
+    TNode<Object> tmp15;
+    TNode<JSReceiver> tmp16;
+    TNode<Number> tmp17;
+    TNode<Number> tmp18;
+    TNode<Number> tmp19;
+    ca_.Bind(&block2, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18, &tmp19);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 92);
+    TNode<Oddball> tmp20;
+    USE(tmp20);
+    tmp20 = Undefined_64(state_);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 93);
+    TNode<Oddball> tmp21;
+    USE(tmp21);
+    tmp21 = Undefined_64(state_);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 98);
+    TNode<Oddball> tmp22;
+    tmp22 = TORQUE_CAST(CodeStubAssembler(state_).CallBuiltin(Builtins::kHasProperty, tmp14, tmp16, tmp18));
+    USE(tmp22);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 101);
+    TNode<Oddball> tmp23;
+    USE(tmp23);
+    tmp23 = True_65(state_);
+    TNode<BoolT> tmp24;
+    USE(tmp24);
+    tmp24 = CodeStubAssembler(state_).TaggedEqual(TNode<HeapObject>{tmp22}, TNode<HeapObject>{tmp23});
+    ca_.Branch(tmp24, &block5, &block6, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp25;
+    TNode<Object> tmp26;
+    TNode<JSReceiver> tmp27;
+    TNode<Number> tmp28;
+    TNode<Number> tmp29;
+    TNode<Number> tmp30;
+    TNode<Object> tmp31;
+    TNode<Object> tmp32;
+    TNode<Oddball> tmp33;
+    ca_.Bind(&block5, &tmp25, &tmp26, &tmp27, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 103);
+    TNode<Object> tmp34;
+    USE(tmp34);
+    tmp34 = CodeStubAssembler(state_).GetProperty(TNode<Context>{tmp25}, TNode<Object>{tmp27}, TNode<Object>{tmp29});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 101);
+    ca_.Goto(&block6, tmp25, tmp26, tmp27, tmp28, tmp29, tmp30, tmp34, tmp32, tmp33);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp35;
+    TNode<Object> tmp36;
+    TNode<JSReceiver> tmp37;
+    TNode<Number> tmp38;
+    TNode<Number> tmp39;
+    TNode<Number> tmp40;
+    TNode<Object> tmp41;
+    TNode<Object> tmp42;
+    TNode<Oddball> tmp43;
+    ca_.Bind(&block6, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 107);
+    TNode<Oddball> tmp44;
+    tmp44 = TORQUE_CAST(CodeStubAssembler(state_).CallBuiltin(Builtins::kHasProperty, tmp35, tmp37, tmp40));
+    USE(tmp44);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 110);
+    TNode<Oddball> tmp45;
+    USE(tmp45);
+    tmp45 = True_65(state_);
+    TNode<BoolT> tmp46;
+    USE(tmp46);
+    tmp46 = CodeStubAssembler(state_).TaggedEqual(TNode<HeapObject>{tmp44}, TNode<HeapObject>{tmp45});
+    ca_.Branch(tmp46, &block7, &block8, tmp35, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42, tmp43, tmp44);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp47;
+    TNode<Object> tmp48;
+    TNode<JSReceiver> tmp49;
+    TNode<Number> tmp50;
+    TNode<Number> tmp51;
+    TNode<Number> tmp52;
+    TNode<Object> tmp53;
+    TNode<Object> tmp54;
+    TNode<Oddball> tmp55;
+    TNode<Oddball> tmp56;
+    ca_.Bind(&block7, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53, &tmp54, &tmp55, &tmp56);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 112);
+    TNode<Object> tmp57;
+    USE(tmp57);
+    tmp57 = CodeStubAssembler(state_).GetProperty(TNode<Context>{tmp47}, TNode<Object>{tmp49}, TNode<Object>{tmp52});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 110);
+    ca_.Goto(&block8, tmp47, tmp48, tmp49, tmp50, tmp51, tmp52, tmp53, tmp57, tmp55, tmp56);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp58;
+    TNode<Object> tmp59;
+    TNode<JSReceiver> tmp60;
+    TNode<Number> tmp61;
+    TNode<Number> tmp62;
+    TNode<Number> tmp63;
+    TNode<Object> tmp64;
+    TNode<Object> tmp65;
+    TNode<Oddball> tmp66;
+    TNode<Oddball> tmp67;
+    ca_.Bind(&block8, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66, &tmp67);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 116);
+    TNode<Oddball> tmp68;
+    USE(tmp68);
+    tmp68 = True_65(state_);
+    TNode<BoolT> tmp69;
+    USE(tmp69);
+    tmp69 = CodeStubAssembler(state_).TaggedEqual(TNode<HeapObject>{tmp66}, TNode<HeapObject>{tmp68});
+    ca_.Branch(tmp69, &block11, &block12, tmp58, tmp59, tmp60, tmp61, tmp62, tmp63, tmp64, tmp65, tmp66, tmp67, tmp69);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp70;
+    TNode<Object> tmp71;
+    TNode<JSReceiver> tmp72;
+    TNode<Number> tmp73;
+    TNode<Number> tmp74;
+    TNode<Number> tmp75;
+    TNode<Object> tmp76;
+    TNode<Object> tmp77;
+    TNode<Oddball> tmp78;
+    TNode<Oddball> tmp79;
+    TNode<BoolT> tmp80;
+    ca_.Bind(&block11, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80);
+    TNode<Oddball> tmp81;
+    USE(tmp81);
+    tmp81 = True_65(state_);
+    TNode<BoolT> tmp82;
+    USE(tmp82);
+    tmp82 = CodeStubAssembler(state_).TaggedEqual(TNode<HeapObject>{tmp79}, TNode<HeapObject>{tmp81});
+    ca_.Goto(&block13, tmp70, tmp71, tmp72, tmp73, tmp74, tmp75, tmp76, tmp77, tmp78, tmp79, tmp80, tmp82);
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp83;
+    TNode<Object> tmp84;
+    TNode<JSReceiver> tmp85;
+    TNode<Number> tmp86;
+    TNode<Number> tmp87;
+    TNode<Number> tmp88;
+    TNode<Object> tmp89;
+    TNode<Object> tmp90;
+    TNode<Oddball> tmp91;
+    TNode<Oddball> tmp92;
+    TNode<BoolT> tmp93;
+    ca_.Bind(&block12, &tmp83, &tmp84, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93);
+    TNode<BoolT> tmp94;
+    USE(tmp94);
+    tmp94 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, false);
+    ca_.Goto(&block13, tmp83, tmp84, tmp85, tmp86, tmp87, tmp88, tmp89, tmp90, tmp91, tmp92, tmp93, tmp94);
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp95;
+    TNode<Object> tmp96;
+    TNode<JSReceiver> tmp97;
+    TNode<Number> tmp98;
+    TNode<Number> tmp99;
+    TNode<Number> tmp100;
+    TNode<Object> tmp101;
+    TNode<Object> tmp102;
+    TNode<Oddball> tmp103;
+    TNode<Oddball> tmp104;
+    TNode<BoolT> tmp105;
+    TNode<BoolT> tmp106;
+    ca_.Bind(&block13, &tmp95, &tmp96, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104, &tmp105, &tmp106);
+    ca_.Branch(tmp106, &block9, &block10, tmp95, tmp96, tmp97, tmp98, tmp99, tmp100, tmp101, tmp102, tmp103, tmp104);
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp107;
+    TNode<Object> tmp108;
+    TNode<JSReceiver> tmp109;
+    TNode<Number> tmp110;
+    TNode<Number> tmp111;
+    TNode<Number> tmp112;
+    TNode<Object> tmp113;
+    TNode<Object> tmp114;
+    TNode<Oddball> tmp115;
+    TNode<Oddball> tmp116;
+    ca_.Bind(&block9, &tmp107, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115, &tmp116);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 118);
+    CodeStubAssembler(state_).CallBuiltin(Builtins::kSetProperty, tmp107, tmp109, tmp111, tmp114);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 121);
+    CodeStubAssembler(state_).CallBuiltin(Builtins::kSetProperty, tmp107, tmp109, tmp112, tmp113);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 116);
+    ca_.Goto(&block14, tmp107, tmp108, tmp109, tmp110, tmp111, tmp112, tmp113, tmp114, tmp115, tmp116);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp119;
+    TNode<Object> tmp120;
+    TNode<JSReceiver> tmp121;
+    TNode<Number> tmp122;
+    TNode<Number> tmp123;
+    TNode<Number> tmp124;
+    TNode<Object> tmp125;
+    TNode<Object> tmp126;
+    TNode<Oddball> tmp127;
+    TNode<Oddball> tmp128;
+    ca_.Bind(&block10, &tmp119, &tmp120, &tmp121, &tmp122, &tmp123, &tmp124, &tmp125, &tmp126, &tmp127, &tmp128);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 122);
+    TNode<Oddball> tmp129;
+    USE(tmp129);
+    tmp129 = False_66(state_);
+    TNode<BoolT> tmp130;
+    USE(tmp130);
+    tmp130 = CodeStubAssembler(state_).TaggedEqual(TNode<HeapObject>{tmp127}, TNode<HeapObject>{tmp129});
+    ca_.Branch(tmp130, &block17, &block18, tmp119, tmp120, tmp121, tmp122, tmp123, tmp124, tmp125, tmp126, tmp127, tmp128, tmp130);
+  }
+
+  if (block17.is_used()) {
+    TNode<Context> tmp131;
+    TNode<Object> tmp132;
+    TNode<JSReceiver> tmp133;
+    TNode<Number> tmp134;
+    TNode<Number> tmp135;
+    TNode<Number> tmp136;
+    TNode<Object> tmp137;
+    TNode<Object> tmp138;
+    TNode<Oddball> tmp139;
+    TNode<Oddball> tmp140;
+    TNode<BoolT> tmp141;
+    ca_.Bind(&block17, &tmp131, &tmp132, &tmp133, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138, &tmp139, &tmp140, &tmp141);
+    TNode<Oddball> tmp142;
+    USE(tmp142);
+    tmp142 = True_65(state_);
+    TNode<BoolT> tmp143;
+    USE(tmp143);
+    tmp143 = CodeStubAssembler(state_).TaggedEqual(TNode<HeapObject>{tmp140}, TNode<HeapObject>{tmp142});
+    ca_.Goto(&block19, tmp131, tmp132, tmp133, tmp134, tmp135, tmp136, tmp137, tmp138, tmp139, tmp140, tmp141, tmp143);
+  }
+
+  if (block18.is_used()) {
+    TNode<Context> tmp144;
+    TNode<Object> tmp145;
+    TNode<JSReceiver> tmp146;
+    TNode<Number> tmp147;
+    TNode<Number> tmp148;
+    TNode<Number> tmp149;
+    TNode<Object> tmp150;
+    TNode<Object> tmp151;
+    TNode<Oddball> tmp152;
+    TNode<Oddball> tmp153;
+    TNode<BoolT> tmp154;
+    ca_.Bind(&block18, &tmp144, &tmp145, &tmp146, &tmp147, &tmp148, &tmp149, &tmp150, &tmp151, &tmp152, &tmp153, &tmp154);
+    TNode<BoolT> tmp155;
+    USE(tmp155);
+    tmp155 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, false);
+    ca_.Goto(&block19, tmp144, tmp145, tmp146, tmp147, tmp148, tmp149, tmp150, tmp151, tmp152, tmp153, tmp154, tmp155);
+  }
+
+  if (block19.is_used()) {
+    TNode<Context> tmp156;
+    TNode<Object> tmp157;
+    TNode<JSReceiver> tmp158;
+    TNode<Number> tmp159;
+    TNode<Number> tmp160;
+    TNode<Number> tmp161;
+    TNode<Object> tmp162;
+    TNode<Object> tmp163;
+    TNode<Oddball> tmp164;
+    TNode<Oddball> tmp165;
+    TNode<BoolT> tmp166;
+    TNode<BoolT> tmp167;
+    ca_.Bind(&block19, &tmp156, &tmp157, &tmp158, &tmp159, &tmp160, &tmp161, &tmp162, &tmp163, &tmp164, &tmp165, &tmp166, &tmp167);
+    ca_.Branch(tmp167, &block15, &block16, tmp156, tmp157, tmp158, tmp159, tmp160, tmp161, tmp162, tmp163, tmp164, tmp165);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp168;
+    TNode<Object> tmp169;
+    TNode<JSReceiver> tmp170;
+    TNode<Number> tmp171;
+    TNode<Number> tmp172;
+    TNode<Number> tmp173;
+    TNode<Object> tmp174;
+    TNode<Object> tmp175;
+    TNode<Oddball> tmp176;
+    TNode<Oddball> tmp177;
+    ca_.Bind(&block15, &tmp168, &tmp169, &tmp170, &tmp171, &tmp172, &tmp173, &tmp174, &tmp175, &tmp176, &tmp177);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 124);
+    CodeStubAssembler(state_).CallBuiltin(Builtins::kSetProperty, tmp168, tmp170, tmp172, tmp175);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 127);
+    TNode<Smi> tmp179;
+    USE(tmp179);
+    tmp179 = FromConstexpr14ATLanguageMode24ATconstexpr_LanguageMode_169(state_, LanguageMode::kStrict);
+    TNode<Oddball> tmp180;
+    tmp180 = TORQUE_CAST(CodeStubAssembler(state_).CallBuiltin(Builtins::kDeleteProperty, tmp168, tmp170, tmp173, tmp179));
+    USE(tmp180);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 122);
+    ca_.Goto(&block20, tmp168, tmp169, tmp170, tmp171, tmp172, tmp173, tmp174, tmp175, tmp176, tmp177);
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp181;
+    TNode<Object> tmp182;
+    TNode<JSReceiver> tmp183;
+    TNode<Number> tmp184;
+    TNode<Number> tmp185;
+    TNode<Number> tmp186;
+    TNode<Object> tmp187;
+    TNode<Object> tmp188;
+    TNode<Oddball> tmp189;
+    TNode<Oddball> tmp190;
+    ca_.Bind(&block16, &tmp181, &tmp182, &tmp183, &tmp184, &tmp185, &tmp186, &tmp187, &tmp188, &tmp189, &tmp190);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 128);
+    TNode<Oddball> tmp191;
+    USE(tmp191);
+    tmp191 = True_65(state_);
+    TNode<BoolT> tmp192;
+    USE(tmp192);
+    tmp192 = CodeStubAssembler(state_).TaggedEqual(TNode<HeapObject>{tmp189}, TNode<HeapObject>{tmp191});
+    ca_.Branch(tmp192, &block23, &block24, tmp181, tmp182, tmp183, tmp184, tmp185, tmp186, tmp187, tmp188, tmp189, tmp190, tmp192);
+  }
+
+  if (block23.is_used()) {
+    TNode<Context> tmp193;
+    TNode<Object> tmp194;
+    TNode<JSReceiver> tmp195;
+    TNode<Number> tmp196;
+    TNode<Number> tmp197;
+    TNode<Number> tmp198;
+    TNode<Object> tmp199;
+    TNode<Object> tmp200;
+    TNode<Oddball> tmp201;
+    TNode<Oddball> tmp202;
+    TNode<BoolT> tmp203;
+    ca_.Bind(&block23, &tmp193, &tmp194, &tmp195, &tmp196, &tmp197, &tmp198, &tmp199, &tmp200, &tmp201, &tmp202, &tmp203);
+    TNode<Oddball> tmp204;
+    USE(tmp204);
+    tmp204 = False_66(state_);
+    TNode<BoolT> tmp205;
+    USE(tmp205);
+    tmp205 = CodeStubAssembler(state_).TaggedEqual(TNode<HeapObject>{tmp202}, TNode<HeapObject>{tmp204});
+    ca_.Goto(&block25, tmp193, tmp194, tmp195, tmp196, tmp197, tmp198, tmp199, tmp200, tmp201, tmp202, tmp203, tmp205);
+  }
+
+  if (block24.is_used()) {
+    TNode<Context> tmp206;
+    TNode<Object> tmp207;
+    TNode<JSReceiver> tmp208;
+    TNode<Number> tmp209;
+    TNode<Number> tmp210;
+    TNode<Number> tmp211;
+    TNode<Object> tmp212;
+    TNode<Object> tmp213;
+    TNode<Oddball> tmp214;
+    TNode<Oddball> tmp215;
+    TNode<BoolT> tmp216;
+    ca_.Bind(&block24, &tmp206, &tmp207, &tmp208, &tmp209, &tmp210, &tmp211, &tmp212, &tmp213, &tmp214, &tmp215, &tmp216);
+    TNode<BoolT> tmp217;
+    USE(tmp217);
+    tmp217 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, false);
+    ca_.Goto(&block25, tmp206, tmp207, tmp208, tmp209, tmp210, tmp211, tmp212, tmp213, tmp214, tmp215, tmp216, tmp217);
+  }
+
+  if (block25.is_used()) {
+    TNode<Context> tmp218;
+    TNode<Object> tmp219;
+    TNode<JSReceiver> tmp220;
+    TNode<Number> tmp221;
+    TNode<Number> tmp222;
+    TNode<Number> tmp223;
+    TNode<Object> tmp224;
+    TNode<Object> tmp225;
+    TNode<Oddball> tmp226;
+    TNode<Oddball> tmp227;
+    TNode<BoolT> tmp228;
+    TNode<BoolT> tmp229;
+    ca_.Bind(&block25, &tmp218, &tmp219, &tmp220, &tmp221, &tmp222, &tmp223, &tmp224, &tmp225, &tmp226, &tmp227, &tmp228, &tmp229);
+    ca_.Branch(tmp229, &block21, &block22, tmp218, tmp219, tmp220, tmp221, tmp222, tmp223, tmp224, tmp225, tmp226, tmp227);
+  }
+
+  if (block21.is_used()) {
+    TNode<Context> tmp230;
+    TNode<Object> tmp231;
+    TNode<JSReceiver> tmp232;
+    TNode<Number> tmp233;
+    TNode<Number> tmp234;
+    TNode<Number> tmp235;
+    TNode<Object> tmp236;
+    TNode<Object> tmp237;
+    TNode<Oddball> tmp238;
+    TNode<Oddball> tmp239;
+    ca_.Bind(&block21, &tmp230, &tmp231, &tmp232, &tmp233, &tmp234, &tmp235, &tmp236, &tmp237, &tmp238, &tmp239);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 130);
+    TNode<Smi> tmp240;
+    USE(tmp240);
+    tmp240 = FromConstexpr14ATLanguageMode24ATconstexpr_LanguageMode_169(state_, LanguageMode::kStrict);
+    TNode<Oddball> tmp241;
+    tmp241 = TORQUE_CAST(CodeStubAssembler(state_).CallBuiltin(Builtins::kDeleteProperty, tmp230, tmp232, tmp234, tmp240));
+    USE(tmp241);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 133);
+    CodeStubAssembler(state_).CallBuiltin(Builtins::kSetProperty, tmp230, tmp232, tmp235, tmp236);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 128);
+    ca_.Goto(&block22, tmp230, tmp231, tmp232, tmp233, tmp234, tmp235, tmp236, tmp237, tmp238, tmp239);
+  }
+
+  if (block22.is_used()) {
+    TNode<Context> tmp243;
+    TNode<Object> tmp244;
+    TNode<JSReceiver> tmp245;
+    TNode<Number> tmp246;
+    TNode<Number> tmp247;
+    TNode<Number> tmp248;
+    TNode<Object> tmp249;
+    TNode<Object> tmp250;
+    TNode<Oddball> tmp251;
+    TNode<Oddball> tmp252;
+    ca_.Bind(&block22, &tmp243, &tmp244, &tmp245, &tmp246, &tmp247, &tmp248, &tmp249, &tmp250, &tmp251, &tmp252);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 122);
+    ca_.Goto(&block20, tmp243, tmp244, tmp245, tmp246, tmp247, tmp248, tmp249, tmp250, tmp251, tmp252);
+  }
+
+  if (block20.is_used()) {
+    TNode<Context> tmp253;
+    TNode<Object> tmp254;
+    TNode<JSReceiver> tmp255;
+    TNode<Number> tmp256;
+    TNode<Number> tmp257;
+    TNode<Number> tmp258;
+    TNode<Object> tmp259;
+    TNode<Object> tmp260;
+    TNode<Oddball> tmp261;
+    TNode<Oddball> tmp262;
+    ca_.Bind(&block20, &tmp253, &tmp254, &tmp255, &tmp256, &tmp257, &tmp258, &tmp259, &tmp260, &tmp261, &tmp262);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 116);
+    ca_.Goto(&block14, tmp253, tmp254, tmp255, tmp256, tmp257, tmp258, tmp259, tmp260, tmp261, tmp262);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp263;
+    TNode<Object> tmp264;
+    TNode<JSReceiver> tmp265;
+    TNode<Number> tmp266;
+    TNode<Number> tmp267;
+    TNode<Number> tmp268;
+    TNode<Object> tmp269;
+    TNode<Object> tmp270;
+    TNode<Oddball> tmp271;
+    TNode<Oddball> tmp272;
+    ca_.Bind(&block14, &tmp263, &tmp264, &tmp265, &tmp266, &tmp267, &tmp268, &tmp269, &tmp270, &tmp271, &tmp272);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 137);
+    TNode<Number> tmp273;
+    USE(tmp273);
+    tmp273 = FromConstexpr20UT5ATSmi10HeapNumber17ATconstexpr_int31_161(state_, 1);
+    TNode<Number> tmp274;
+    USE(tmp274);
+    tmp274 = CodeStubAssembler(state_).NumberAdd(TNode<Number>{tmp267}, TNode<Number>{tmp273});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 138);
+    TNode<Number> tmp275;
+    USE(tmp275);
+    tmp275 = FromConstexpr20UT5ATSmi10HeapNumber17ATconstexpr_int31_161(state_, 1);
+    TNode<Number> tmp276;
+    USE(tmp276);
+    tmp276 = CodeStubAssembler(state_).NumberSub(TNode<Number>{tmp268}, TNode<Number>{tmp275});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 91);
+    ca_.Goto(&block4, tmp263, tmp264, tmp265, tmp266, tmp274, tmp276);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp277;
+    TNode<Object> tmp278;
+    TNode<JSReceiver> tmp279;
+    TNode<Number> tmp280;
+    TNode<Number> tmp281;
+    TNode<Number> tmp282;
+    ca_.Bind(&block3, &tmp277, &tmp278, &tmp279, &tmp280, &tmp281, &tmp282);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 142);
+    ca_.Goto(&block1, tmp277, tmp278, tmp279);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp283;
+    TNode<Object> tmp284;
+    TNode<Object> tmp285;
+    ca_.Bind(&block1, &tmp283, &tmp284, &tmp285);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 73);
+    ca_.Goto(&block26, tmp283, tmp284, tmp285);
+  }
+
+    TNode<Context> tmp286;
+    TNode<Object> tmp287;
+    TNode<Object> tmp288;
+    ca_.Bind(&block26, &tmp286, &tmp287, &tmp288);
+  return TNode<Object>{tmp288};
+}
+
+void TryFastPackedArrayReverse_35(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_receiver, compiler::CodeAssemblerLabel* label_Slow) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, JSArray> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSArray, Int32T> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSArray, Int32T> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSArray, Int32T> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSArray, Int32T> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSArray, Int32T> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSArray, Int32T> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSArray, Int32T> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSArray, Int32T> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSArray, Int32T> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_receiver);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 147);
+    TNode<JSArray> tmp2;
+    USE(tmp2);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp2 = Cast13ATFastJSArray_1390(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1}, &label0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp1, tmp2);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block4, tmp0, tmp1, tmp1);
+    }
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    ca_.Bind(&block4, &tmp3, &tmp4, &tmp5);
+    ca_.Goto(&block1);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp6;
+    TNode<Object> tmp7;
+    TNode<Object> tmp8;
+    TNode<JSArray> tmp9;
+    ca_.Bind(&block3, &tmp6, &tmp7, &tmp8, &tmp9);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 149);
+    TNode<IntPtrT> tmp10 = ca_.IntPtrConstant(HeapObject::kMapOffset);
+    USE(tmp10);
+    TNode<Map>tmp11 = CodeStubAssembler(state_).LoadReference<Map>(CodeStubAssembler::Reference{tmp9, tmp10});
+    TNode<Int32T> tmp12;
+    USE(tmp12);
+    tmp12 = CodeStubAssembler(state_).LoadMapElementsKind(TNode<Map>{tmp11});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 150);
+    TNode<Int32T> tmp13;
+    USE(tmp13);
+    tmp13 = FromConstexpr14ATElementsKind24ATconstexpr_ElementsKind_170(state_, PACKED_SMI_ELEMENTS);
+    TNode<BoolT> tmp14;
+    USE(tmp14);
+    tmp14 = CodeStubAssembler(state_).ElementsKindEqual(TNode<Int32T>{tmp12}, TNode<Int32T>{tmp13});
+    ca_.Branch(tmp14, &block5, &block6, tmp6, tmp7, tmp9, tmp12);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp15;
+    TNode<Object> tmp16;
+    TNode<JSArray> tmp17;
+    TNode<Int32T> tmp18;
+    ca_.Bind(&block5, &tmp15, &tmp16, &tmp17, &tmp18);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 151);
+    EnsureWriteableFastElements_50(state_, TNode<Context>{tmp15}, TNode<JSArray>{tmp17});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 153);
+    TNode<IntPtrT> tmp19 = ca_.IntPtrConstant(JSObject::kElementsOffset);
+    USE(tmp19);
+    TNode<FixedArrayBase>tmp20 = CodeStubAssembler(state_).LoadReference<FixedArrayBase>(CodeStubAssembler::Reference{tmp17, tmp19});
+    TNode<Smi> tmp21;
+    USE(tmp21);
+    tmp21 = CodeStubAssembler(state_).LoadFastJSArrayLength(TNode<JSArray>{tmp17});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 152);
+    FastPackedArrayReverse23ATFastPackedSmiElements5ATSmi_1391(state_, TNode<Context>{tmp15}, TNode<FixedArrayBase>{tmp20}, TNode<Smi>{tmp21});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 150);
+    ca_.Goto(&block7, tmp15, tmp16, tmp17, tmp18);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp22;
+    TNode<Object> tmp23;
+    TNode<JSArray> tmp24;
+    TNode<Int32T> tmp25;
+    ca_.Bind(&block6, &tmp22, &tmp23, &tmp24, &tmp25);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 154);
+    TNode<Int32T> tmp26;
+    USE(tmp26);
+    tmp26 = FromConstexpr14ATElementsKind24ATconstexpr_ElementsKind_170(state_, PACKED_ELEMENTS);
+    TNode<BoolT> tmp27;
+    USE(tmp27);
+    tmp27 = CodeStubAssembler(state_).ElementsKindEqual(TNode<Int32T>{tmp25}, TNode<Int32T>{tmp26});
+    ca_.Branch(tmp27, &block8, &block9, tmp22, tmp23, tmp24, tmp25);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp28;
+    TNode<Object> tmp29;
+    TNode<JSArray> tmp30;
+    TNode<Int32T> tmp31;
+    ca_.Bind(&block8, &tmp28, &tmp29, &tmp30, &tmp31);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 155);
+    EnsureWriteableFastElements_50(state_, TNode<Context>{tmp28}, TNode<JSArray>{tmp30});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 157);
+    TNode<IntPtrT> tmp32 = ca_.IntPtrConstant(JSObject::kElementsOffset);
+    USE(tmp32);
+    TNode<FixedArrayBase>tmp33 = CodeStubAssembler(state_).LoadReference<FixedArrayBase>(CodeStubAssembler::Reference{tmp30, tmp32});
+    TNode<Smi> tmp34;
+    USE(tmp34);
+    tmp34 = CodeStubAssembler(state_).LoadFastJSArrayLength(TNode<JSArray>{tmp30});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 156);
+    FastPackedArrayReverse26ATFastPackedObjectElements90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol_1392(state_, TNode<Context>{tmp28}, TNode<FixedArrayBase>{tmp33}, TNode<Smi>{tmp34});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 154);
+    ca_.Goto(&block10, tmp28, tmp29, tmp30, tmp31);
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp35;
+    TNode<Object> tmp36;
+    TNode<JSArray> tmp37;
+    TNode<Int32T> tmp38;
+    ca_.Bind(&block9, &tmp35, &tmp36, &tmp37, &tmp38);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 158);
+    TNode<Int32T> tmp39;
+    USE(tmp39);
+    tmp39 = FromConstexpr14ATElementsKind24ATconstexpr_ElementsKind_170(state_, PACKED_DOUBLE_ELEMENTS);
+    TNode<BoolT> tmp40;
+    USE(tmp40);
+    tmp40 = CodeStubAssembler(state_).ElementsKindEqual(TNode<Int32T>{tmp38}, TNode<Int32T>{tmp39});
+    ca_.Branch(tmp40, &block11, &block12, tmp35, tmp36, tmp37, tmp38);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp41;
+    TNode<Object> tmp42;
+    TNode<JSArray> tmp43;
+    TNode<Int32T> tmp44;
+    ca_.Bind(&block11, &tmp41, &tmp42, &tmp43, &tmp44);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 160);
+    TNode<IntPtrT> tmp45 = ca_.IntPtrConstant(JSObject::kElementsOffset);
+    USE(tmp45);
+    TNode<FixedArrayBase>tmp46 = CodeStubAssembler(state_).LoadReference<FixedArrayBase>(CodeStubAssembler::Reference{tmp43, tmp45});
+    TNode<Smi> tmp47;
+    USE(tmp47);
+    tmp47 = CodeStubAssembler(state_).LoadFastJSArrayLength(TNode<JSArray>{tmp43});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 159);
+    FastPackedArrayReverse26ATFastPackedDoubleElements9ATfloat64_1393(state_, TNode<Context>{tmp41}, TNode<FixedArrayBase>{tmp46}, TNode<Smi>{tmp47});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 158);
+    ca_.Goto(&block13, tmp41, tmp42, tmp43, tmp44);
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp48;
+    TNode<Object> tmp49;
+    TNode<JSArray> tmp50;
+    TNode<Int32T> tmp51;
+    ca_.Bind(&block12, &tmp48, &tmp49, &tmp50, &tmp51);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 162);
+    ca_.Goto(&block1);
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp52;
+    TNode<Object> tmp53;
+    TNode<JSArray> tmp54;
+    TNode<Int32T> tmp55;
+    ca_.Bind(&block13, &tmp52, &tmp53, &tmp54, &tmp55);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 154);
+    ca_.Goto(&block10, tmp52, tmp53, tmp54, tmp55);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp56;
+    TNode<Object> tmp57;
+    TNode<JSArray> tmp58;
+    TNode<Int32T> tmp59;
+    ca_.Bind(&block10, &tmp56, &tmp57, &tmp58, &tmp59);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 150);
+    ca_.Goto(&block7, tmp56, tmp57, tmp58, tmp59);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp60;
+    TNode<Object> tmp61;
+    TNode<JSArray> tmp62;
+    TNode<Int32T> tmp63;
+    ca_.Bind(&block7, &tmp60, &tmp61, &tmp62, &tmp63);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 146);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 145);
+    ca_.Goto(&block2, tmp60, tmp61);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp64;
+    TNode<Object> tmp65;
+    ca_.Bind(&block2, &tmp64, &tmp65);
+    ca_.Goto(&block14, tmp64, tmp65);
+  }
+
+  if (block1.is_used()) {
+    ca_.Bind(&block1);
+    ca_.Goto(label_Slow);
+  }
+
+    TNode<Context> tmp66;
+    TNode<Object> tmp67;
+    ca_.Bind(&block14, &tmp66, &tmp67);
+}
+
+TF_BUILTIN(ArrayPrototypeReverse, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  Node* argc = Parameter(Descriptor::kJSActualArgumentsCount);
+  TNode<IntPtrT> arguments_length(ChangeInt32ToIntPtr(argc));
+  TNode<RawPtrT> arguments_frame = UncheckedCast<RawPtrT>(LoadFramePointer());
+  TorqueStructArguments torque_arguments(GetFrameArguments(arguments_frame, arguments_length));
+  CodeStubArguments arguments(this, torque_arguments);
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = arguments.GetReceiver();
+USE(parameter1);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, torque_arguments.frame, torque_arguments.base, torque_arguments.length, parameter0, parameter1);
+
+  if (block0.is_used()) {
+    TNode<RawPtrT> tmp0;
+    TNode<RawPtrT> tmp1;
+    TNode<IntPtrT> tmp2;
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 170);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    TryFastPackedArrayReverse_35(state_, TNode<Context>{tmp3}, TNode<Object>{tmp4}, &label0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp2, tmp3, tmp4, tmp4);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block4, tmp0, tmp1, tmp2, tmp3, tmp4, tmp4);
+    }
+  }
+
+  if (block4.is_used()) {
+    TNode<RawPtrT> tmp5;
+    TNode<RawPtrT> tmp6;
+    TNode<IntPtrT> tmp7;
+    TNode<Context> tmp8;
+    TNode<Object> tmp9;
+    TNode<Object> tmp10;
+    ca_.Bind(&block4, &tmp5, &tmp6, &tmp7, &tmp8, &tmp9, &tmp10);
+    ca_.Goto(&block2, tmp5, tmp6, tmp7, tmp8, tmp9);
+  }
+
+  if (block3.is_used()) {
+    TNode<RawPtrT> tmp11;
+    TNode<RawPtrT> tmp12;
+    TNode<IntPtrT> tmp13;
+    TNode<Context> tmp14;
+    TNode<Object> tmp15;
+    TNode<Object> tmp16;
+    ca_.Bind(&block3, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 171);
+    arguments.PopAndReturn(tmp15);
+  }
+
+  if (block2.is_used()) {
+    TNode<RawPtrT> tmp17;
+    TNode<RawPtrT> tmp18;
+    TNode<IntPtrT> tmp19;
+    TNode<Context> tmp20;
+    TNode<Object> tmp21;
+    ca_.Bind(&block2, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 174);
+    TNode<Object> tmp22;
+    USE(tmp22);
+    tmp22 = GenericArrayReverse_34(state_, TNode<Context>{tmp20}, TNode<Object>{tmp21});
+    arguments.PopAndReturn(tmp22);
+  }
+}
+
+TNode<JSArray> Cast13ATFastJSArray_1390(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o, compiler::CodeAssemblerLabel* label_CastError) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, HeapObject> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, HeapObject> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, HeapObject, JSArray> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSArray> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSArray> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 2215);
+    TNode<HeapObject> tmp2;
+    USE(tmp2);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp2 = CodeStubAssembler(state_).TaggedToHeapObject(TNode<Object>{tmp1}, &label0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp1, tmp2);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block4, tmp0, tmp1, tmp1);
+    }
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    ca_.Bind(&block4, &tmp3, &tmp4, &tmp5);
+    ca_.Goto(&block1);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp6;
+    TNode<Object> tmp7;
+    TNode<Object> tmp8;
+    TNode<HeapObject> tmp9;
+    ca_.Bind(&block3, &tmp6, &tmp7, &tmp8, &tmp9);
+    TNode<JSArray> tmp10;
+    USE(tmp10);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp10 = Cast13ATFastJSArray_138(state_, TNode<Context>{tmp6}, TNode<HeapObject>{tmp9}, &label0);
+    ca_.Goto(&block5, tmp6, tmp7, tmp9, tmp10);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block6, tmp6, tmp7, tmp9);
+    }
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp11;
+    TNode<Object> tmp12;
+    TNode<HeapObject> tmp13;
+    ca_.Bind(&block6, &tmp11, &tmp12, &tmp13);
+    ca_.Goto(&block1);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp14;
+    TNode<Object> tmp15;
+    TNode<HeapObject> tmp16;
+    TNode<JSArray> tmp17;
+    ca_.Bind(&block5, &tmp14, &tmp15, &tmp16, &tmp17);
+    ca_.Goto(&block2, tmp14, tmp15, tmp17);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp18;
+    TNode<Object> tmp19;
+    TNode<JSArray> tmp20;
+    ca_.Bind(&block2, &tmp18, &tmp19, &tmp20);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 147);
+    ca_.Goto(&block7, tmp18, tmp19, tmp20);
+  }
+
+  if (block1.is_used()) {
+    ca_.Bind(&block1);
+    ca_.Goto(label_CastError);
+  }
+
+    TNode<Context> tmp21;
+    TNode<Object> tmp22;
+    TNode<JSArray> tmp23;
+    ca_.Bind(&block7, &tmp21, &tmp22, &tmp23);
+  return TNode<JSArray>{tmp23};
+}
+
+void FastPackedArrayReverse23ATFastPackedSmiElements5ATSmi_1391(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<FixedArrayBase> p_elements, TNode<Smi> p_length) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Smi, Smi> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Smi, Smi> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Smi, Smi> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_elements, p_length);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<FixedArrayBase> tmp1;
+    TNode<Smi> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 60);
+    TNode<Smi> tmp3;
+    USE(tmp3);
+    tmp3 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 61);
+    TNode<Smi> tmp4;
+    USE(tmp4);
+    tmp4 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 1);
+    TNode<Smi> tmp5;
+    USE(tmp5);
+    tmp5 = CodeStubAssembler(state_).SmiSub(TNode<Smi>{tmp2}, TNode<Smi>{tmp4});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 63);
+    ca_.Goto(&block4, tmp0, tmp1, tmp2, tmp3, tmp5);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp6;
+    TNode<FixedArrayBase> tmp7;
+    TNode<Smi> tmp8;
+    TNode<Smi> tmp9;
+    TNode<Smi> tmp10;
+    ca_.Bind(&block4, &tmp6, &tmp7, &tmp8, &tmp9, &tmp10);
+    TNode<BoolT> tmp11;
+    USE(tmp11);
+    tmp11 = CodeStubAssembler(state_).SmiLessThan(TNode<Smi>{tmp9}, TNode<Smi>{tmp10});
+    ca_.Branch(tmp11, &block2, &block3, tmp6, tmp7, tmp8, tmp9, tmp10);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp12;
+    TNode<FixedArrayBase> tmp13;
+    TNode<Smi> tmp14;
+    TNode<Smi> tmp15;
+    TNode<Smi> tmp16;
+    ca_.Bind(&block2, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 64);
+    TNode<Smi> tmp17;
+    USE(tmp17);
+    tmp17 = LoadElement23ATFastPackedSmiElements5ATSmi_28(state_, TNode<Context>{tmp12}, TNode<FixedArrayBase>{tmp13}, TNode<Smi>{tmp15});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 65);
+    TNode<Smi> tmp18;
+    USE(tmp18);
+    tmp18 = LoadElement23ATFastPackedSmiElements5ATSmi_28(state_, TNode<Context>{tmp12}, TNode<FixedArrayBase>{tmp13}, TNode<Smi>{tmp16});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 66);
+    StoreElement23ATFastPackedSmiElements5ATSmi_31(state_, TNode<Context>{tmp12}, TNode<FixedArrayBase>{tmp13}, TNode<Smi>{tmp15}, TNode<Smi>{tmp18});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 67);
+    StoreElement23ATFastPackedSmiElements5ATSmi_31(state_, TNode<Context>{tmp12}, TNode<FixedArrayBase>{tmp13}, TNode<Smi>{tmp16}, TNode<Smi>{tmp17});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 68);
+    TNode<Smi> tmp19;
+    USE(tmp19);
+    tmp19 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 1);
+    TNode<Smi> tmp20;
+    USE(tmp20);
+    tmp20 = CodeStubAssembler(state_).SmiAdd(TNode<Smi>{tmp15}, TNode<Smi>{tmp19});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 69);
+    TNode<Smi> tmp21;
+    USE(tmp21);
+    tmp21 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 1);
+    TNode<Smi> tmp22;
+    USE(tmp22);
+    tmp22 = CodeStubAssembler(state_).SmiSub(TNode<Smi>{tmp16}, TNode<Smi>{tmp21});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 63);
+    ca_.Goto(&block4, tmp12, tmp13, tmp14, tmp20, tmp22);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp23;
+    TNode<FixedArrayBase> tmp24;
+    TNode<Smi> tmp25;
+    TNode<Smi> tmp26;
+    TNode<Smi> tmp27;
+    ca_.Bind(&block3, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 59);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 152);
+    ca_.Goto(&block1, tmp23, tmp24, tmp25);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp28;
+    TNode<FixedArrayBase> tmp29;
+    TNode<Smi> tmp30;
+    ca_.Bind(&block1, &tmp28, &tmp29, &tmp30);
+    ca_.Goto(&block5, tmp28, tmp29, tmp30);
+  }
+
+    TNode<Context> tmp31;
+    TNode<FixedArrayBase> tmp32;
+    TNode<Smi> tmp33;
+    ca_.Bind(&block5, &tmp31, &tmp32, &tmp33);
+}
+
+void FastPackedArrayReverse26ATFastPackedObjectElements90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol_1392(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<FixedArrayBase> p_elements, TNode<Smi> p_length) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Smi, Smi> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Smi, Smi> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Smi, Smi> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_elements, p_length);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<FixedArrayBase> tmp1;
+    TNode<Smi> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 60);
+    TNode<Smi> tmp3;
+    USE(tmp3);
+    tmp3 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 61);
+    TNode<Smi> tmp4;
+    USE(tmp4);
+    tmp4 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 1);
+    TNode<Smi> tmp5;
+    USE(tmp5);
+    tmp5 = CodeStubAssembler(state_).SmiSub(TNode<Smi>{tmp2}, TNode<Smi>{tmp4});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 63);
+    ca_.Goto(&block4, tmp0, tmp1, tmp2, tmp3, tmp5);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp6;
+    TNode<FixedArrayBase> tmp7;
+    TNode<Smi> tmp8;
+    TNode<Smi> tmp9;
+    TNode<Smi> tmp10;
+    ca_.Bind(&block4, &tmp6, &tmp7, &tmp8, &tmp9, &tmp10);
+    TNode<BoolT> tmp11;
+    USE(tmp11);
+    tmp11 = CodeStubAssembler(state_).SmiLessThan(TNode<Smi>{tmp9}, TNode<Smi>{tmp10});
+    ca_.Branch(tmp11, &block2, &block3, tmp6, tmp7, tmp8, tmp9, tmp10);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp12;
+    TNode<FixedArrayBase> tmp13;
+    TNode<Smi> tmp14;
+    TNode<Smi> tmp15;
+    TNode<Smi> tmp16;
+    ca_.Bind(&block2, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 64);
+    TNode<Object> tmp17;
+    USE(tmp17);
+    tmp17 = LoadElement26ATFastPackedObjectElements90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol_29(state_, TNode<Context>{tmp12}, TNode<FixedArrayBase>{tmp13}, TNode<Smi>{tmp15});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 65);
+    TNode<Object> tmp18;
+    USE(tmp18);
+    tmp18 = LoadElement26ATFastPackedObjectElements90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol_29(state_, TNode<Context>{tmp12}, TNode<FixedArrayBase>{tmp13}, TNode<Smi>{tmp16});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 66);
+    StoreElement26ATFastPackedObjectElements90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol_32(state_, TNode<Context>{tmp12}, TNode<FixedArrayBase>{tmp13}, TNode<Smi>{tmp15}, TNode<Object>{tmp18});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 67);
+    StoreElement26ATFastPackedObjectElements90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol_32(state_, TNode<Context>{tmp12}, TNode<FixedArrayBase>{tmp13}, TNode<Smi>{tmp16}, TNode<Object>{tmp17});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 68);
+    TNode<Smi> tmp19;
+    USE(tmp19);
+    tmp19 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 1);
+    TNode<Smi> tmp20;
+    USE(tmp20);
+    tmp20 = CodeStubAssembler(state_).SmiAdd(TNode<Smi>{tmp15}, TNode<Smi>{tmp19});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 69);
+    TNode<Smi> tmp21;
+    USE(tmp21);
+    tmp21 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 1);
+    TNode<Smi> tmp22;
+    USE(tmp22);
+    tmp22 = CodeStubAssembler(state_).SmiSub(TNode<Smi>{tmp16}, TNode<Smi>{tmp21});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 63);
+    ca_.Goto(&block4, tmp12, tmp13, tmp14, tmp20, tmp22);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp23;
+    TNode<FixedArrayBase> tmp24;
+    TNode<Smi> tmp25;
+    TNode<Smi> tmp26;
+    TNode<Smi> tmp27;
+    ca_.Bind(&block3, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 59);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 156);
+    ca_.Goto(&block1, tmp23, tmp24, tmp25);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp28;
+    TNode<FixedArrayBase> tmp29;
+    TNode<Smi> tmp30;
+    ca_.Bind(&block1, &tmp28, &tmp29, &tmp30);
+    ca_.Goto(&block5, tmp28, tmp29, tmp30);
+  }
+
+    TNode<Context> tmp31;
+    TNode<FixedArrayBase> tmp32;
+    TNode<Smi> tmp33;
+    ca_.Bind(&block5, &tmp31, &tmp32, &tmp33);
+}
+
+void FastPackedArrayReverse26ATFastPackedDoubleElements9ATfloat64_1393(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<FixedArrayBase> p_elements, TNode<Smi> p_length) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Smi, Smi> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Smi, Smi> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi, Smi, Smi> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, FixedArrayBase, Smi> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_elements, p_length);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<FixedArrayBase> tmp1;
+    TNode<Smi> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 60);
+    TNode<Smi> tmp3;
+    USE(tmp3);
+    tmp3 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 61);
+    TNode<Smi> tmp4;
+    USE(tmp4);
+    tmp4 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 1);
+    TNode<Smi> tmp5;
+    USE(tmp5);
+    tmp5 = CodeStubAssembler(state_).SmiSub(TNode<Smi>{tmp2}, TNode<Smi>{tmp4});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 63);
+    ca_.Goto(&block4, tmp0, tmp1, tmp2, tmp3, tmp5);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp6;
+    TNode<FixedArrayBase> tmp7;
+    TNode<Smi> tmp8;
+    TNode<Smi> tmp9;
+    TNode<Smi> tmp10;
+    ca_.Bind(&block4, &tmp6, &tmp7, &tmp8, &tmp9, &tmp10);
+    TNode<BoolT> tmp11;
+    USE(tmp11);
+    tmp11 = CodeStubAssembler(state_).SmiLessThan(TNode<Smi>{tmp9}, TNode<Smi>{tmp10});
+    ca_.Branch(tmp11, &block2, &block3, tmp6, tmp7, tmp8, tmp9, tmp10);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp12;
+    TNode<FixedArrayBase> tmp13;
+    TNode<Smi> tmp14;
+    TNode<Smi> tmp15;
+    TNode<Smi> tmp16;
+    ca_.Bind(&block2, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 64);
+    TNode<Float64T> tmp17;
+    USE(tmp17);
+    tmp17 = LoadElement26ATFastPackedDoubleElements9ATfloat64_30(state_, TNode<Context>{tmp12}, TNode<FixedArrayBase>{tmp13}, TNode<Smi>{tmp15});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 65);
+    TNode<Float64T> tmp18;
+    USE(tmp18);
+    tmp18 = LoadElement26ATFastPackedDoubleElements9ATfloat64_30(state_, TNode<Context>{tmp12}, TNode<FixedArrayBase>{tmp13}, TNode<Smi>{tmp16});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 66);
+    StoreElement26ATFastPackedDoubleElements9ATfloat64_33(state_, TNode<Context>{tmp12}, TNode<FixedArrayBase>{tmp13}, TNode<Smi>{tmp15}, TNode<Float64T>{tmp18});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 67);
+    StoreElement26ATFastPackedDoubleElements9ATfloat64_33(state_, TNode<Context>{tmp12}, TNode<FixedArrayBase>{tmp13}, TNode<Smi>{tmp16}, TNode<Float64T>{tmp17});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 68);
+    TNode<Smi> tmp19;
+    USE(tmp19);
+    tmp19 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 1);
+    TNode<Smi> tmp20;
+    USE(tmp20);
+    tmp20 = CodeStubAssembler(state_).SmiAdd(TNode<Smi>{tmp15}, TNode<Smi>{tmp19});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 69);
+    TNode<Smi> tmp21;
+    USE(tmp21);
+    tmp21 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 1);
+    TNode<Smi> tmp22;
+    USE(tmp22);
+    tmp22 = CodeStubAssembler(state_).SmiSub(TNode<Smi>{tmp16}, TNode<Smi>{tmp21});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 63);
+    ca_.Goto(&block4, tmp12, tmp13, tmp14, tmp20, tmp22);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp23;
+    TNode<FixedArrayBase> tmp24;
+    TNode<Smi> tmp25;
+    TNode<Smi> tmp26;
+    TNode<Smi> tmp27;
+    ca_.Bind(&block3, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 59);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/array-reverse.tq", 159);
+    ca_.Goto(&block1, tmp23, tmp24, tmp25);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp28;
+    TNode<FixedArrayBase> tmp29;
+    TNode<Smi> tmp30;
+    ca_.Bind(&block1, &tmp28, &tmp29, &tmp30);
+    ca_.Goto(&block5, tmp28, tmp29, tmp30);
+  }
+
+    TNode<Context> tmp31;
+    TNode<FixedArrayBase> tmp32;
+    TNode<Smi> tmp33;
+    ca_.Bind(&block5, &tmp31, &tmp32, &tmp33);
+}
+
+}  // namespace internal
+}  // namespace v8
+
@@ -0,0 +1,21 @@
+#ifndef V8_GEN_TORQUE_GENERATED_______DEPS_V8_SRC_BUILTINS_INTERNAL_COVERAGE_TQ_H_
+#define V8_GEN_TORQUE_GENERATED_______DEPS_V8_SRC_BUILTINS_INTERNAL_COVERAGE_TQ_H_
+
+#include "src/compiler/code-assembler.h"
+#include "src/codegen/code-stub-assembler.h"
+#include "src/utils/utils.h"
+#include "torque-generated/field-offsets-tq.h"
+#include "torque-generated/csa-types-tq.h"
+
+namespace v8 {
+namespace internal {
+
+TNode<FixedArray> GetCoverageInfo_309(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<JSFunction> p_function, compiler::CodeAssemblerLabel* label_IfNoCoverageInfo);
+TNode<Smi> SlotCount_310(compiler::CodeAssemblerState* state_, TNode<FixedArray> p_coverageInfo);
+TNode<Smi> FirstIndexForSlot_311(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Smi> p_slot);
+void IncrementBlockCount_312(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<FixedArray> p_coverageInfo, TNode<Smi> p_slot);
+TNode<FixedArray> UnsafeCast14ATCoverageInfo_1423(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o);
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_GEN_TORQUE_GENERATED_______DEPS_V8_SRC_BUILTINS_INTERNAL_COVERAGE_TQ_H_
@@ -0,0 +1,1195 @@
+#include "src/builtins/builtins-array-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-utils-gen.h"
+#include "src/builtins/builtins.h"
+#include "src/codegen/code-factory.h"
+#include "src/heap/factory-inl.h"
+#include "src/objects/arguments.h"
+#include "src/objects/bigint.h"
+#include "src/objects/elements-kind.h"
+#include "src/objects/free-space.h"
+#include "src/objects/js-generator.h"
+#include "src/objects/js-promise.h"
+#include "src/objects/js-regexp-string-iterator.h"
+#include "src/objects/js-weak-refs.h"
+#include "src/objects/objects.h"
+#include "src/objects/source-text-module.h"
+#include "src/objects/stack-frame-info.h"
+#include "src/objects/synthetic-module.h"
+#include "src/objects/template-objects.h"
+#include "src/builtins/builtins-bigint-gen.h"
+#include "src/builtins/builtins-collections-gen.h"
+#include "src/builtins/builtins-data-view-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-iterator-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-string-gen.h"
+#include "src/builtins/builtins-string-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-constructor-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "torque-generated/../../deps/v8/src/builtins/arguments-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-copywithin-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-join-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-lastindexof-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-map-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-right-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reverse-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-shift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-splice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-unshift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/base-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/bigint-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/boolean-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/collections-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/data-view-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/extras-utils-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/frames-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/growable-fixed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/internal-coverage-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/math-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-fromentries-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-constructor-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-delete-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-has-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-is-extensible-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-prevent-extensions-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revocable-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revoke-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/reflect-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-exec-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-all-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-replace-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-search-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-source-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-split-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-test-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-endswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-html-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-pad-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-repeat-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-startswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-substring-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/torque-internal-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-createtypedarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduceright-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-subarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/third_party/v8/builtins/array-sort-tq-csa.h"
+#include "torque-generated/../../deps/v8/test/torque/test-torque-tq-csa.h"
+
+namespace v8 {
+namespace internal {
+
+TNode<JSObject> ObjectFromEntriesFastCase_313(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_iterable, compiler::CodeAssemblerLabel* label_IfSlow) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, JSArray> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, JSArray, FixedArrayBase> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, JSArray, FixedArrayBase, FixedArray> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, JSArray, FixedArray, Smi, JSObject, Smi> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, JSArray, FixedArray, Smi, JSObject, Smi> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, JSArray, FixedArray, Smi, JSObject, Smi, Object, Object> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, JSArray, FixedArray, Smi, JSObject, Smi, Object, Object, Object, Object> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, JSArray, FixedArray, Smi, JSObject, Smi, Object, Object, Object> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, JSArray, FixedArray, Smi, JSObject, Smi, Object, Object, Object> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, JSArray, FixedArray, Smi, JSObject, Smi> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, JSArray, FixedArray, Smi, JSObject, Smi> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSObject> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSObject> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_iterable);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 9);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 10);
+    TNode<JSArray> tmp2;
+    USE(tmp2);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp2 = Cast34ATFastJSArrayWithNoCustomIteration_1424(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1}, &label0);
+    ca_.Goto(&block5, tmp0, tmp1, tmp1, tmp1, tmp2);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block6, tmp0, tmp1, tmp1, tmp1);
+    }
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    TNode<Object> tmp6;
+    ca_.Bind(&block6, &tmp3, &tmp4, &tmp5, &tmp6);
+    ca_.Goto(&block4, tmp3, tmp4, tmp5);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp7;
+    TNode<Object> tmp8;
+    TNode<Object> tmp9;
+    TNode<Object> tmp10;
+    TNode<JSArray> tmp11;
+    ca_.Bind(&block5, &tmp7, &tmp8, &tmp9, &tmp10, &tmp11);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 12);
+    TNode<IntPtrT> tmp12 = ca_.IntPtrConstant(JSObject::kElementsOffset);
+    USE(tmp12);
+    TNode<FixedArrayBase>tmp13 = CodeStubAssembler(state_).LoadReference<FixedArrayBase>(CodeStubAssembler::Reference{tmp11, tmp12});
+    TNode<FixedArray> tmp14;
+    USE(tmp14);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp14 = Cast10FixedArray_103(state_, TNode<HeapObject>{tmp13}, &label0);
+    ca_.Goto(&block7, tmp7, tmp8, tmp9, tmp11, tmp13, tmp14);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block8, tmp7, tmp8, tmp9, tmp11, tmp13);
+    }
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp15;
+    TNode<Object> tmp16;
+    TNode<Object> tmp17;
+    TNode<JSArray> tmp18;
+    TNode<FixedArrayBase> tmp19;
+    ca_.Bind(&block8, &tmp15, &tmp16, &tmp17, &tmp18, &tmp19);
+    ca_.Goto(&block1);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp20;
+    TNode<Object> tmp21;
+    TNode<Object> tmp22;
+    TNode<JSArray> tmp23;
+    TNode<FixedArrayBase> tmp24;
+    TNode<FixedArray> tmp25;
+    ca_.Bind(&block7, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 11);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 13);
+    TNode<Smi> tmp26;
+    USE(tmp26);
+    tmp26 = CodeStubAssembler(state_).LoadFastJSArrayLength(TNode<JSArray>{tmp23});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 14);
+    TNode<JSObject> tmp27;
+    USE(tmp27);
+    tmp27 = NewJSObject_55(state_, TNode<Context>{tmp20});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 16);
+    TNode<Smi> tmp28;
+    USE(tmp28);
+    tmp28 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 0);
+    ca_.Goto(&block11, tmp20, tmp21, tmp22, tmp23, tmp25, tmp26, tmp27, tmp28);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp29;
+    TNode<Object> tmp30;
+    TNode<Object> tmp31;
+    TNode<JSArray> tmp32;
+    TNode<FixedArray> tmp33;
+    TNode<Smi> tmp34;
+    TNode<JSObject> tmp35;
+    TNode<Smi> tmp36;
+    ca_.Bind(&block11, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34, &tmp35, &tmp36);
+    TNode<BoolT> tmp37;
+    USE(tmp37);
+    tmp37 = CodeStubAssembler(state_).SmiLessThan(TNode<Smi>{tmp36}, TNode<Smi>{tmp34});
+    ca_.Branch(tmp37, &block9, &block10, tmp29, tmp30, tmp31, tmp32, tmp33, tmp34, tmp35, tmp36);
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp38;
+    TNode<Object> tmp39;
+    TNode<Object> tmp40;
+    TNode<JSArray> tmp41;
+    TNode<FixedArray> tmp42;
+    TNode<Smi> tmp43;
+    TNode<JSObject> tmp44;
+    TNode<Smi> tmp45;
+    ca_.Bind(&block9, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44, &tmp45);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 17);
+    TNode<Object> tmp46;
+    USE(tmp46);
+    tmp46 = LoadElementOrUndefined_51(state_, TNode<Context>{tmp38}, TNode<FixedArray>{tmp42}, TNode<Smi>{tmp45});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 19);
+    TNode<Object> tmp47;
+    USE(tmp47);
+    TNode<Object> tmp48;
+    USE(tmp48);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    std::tie(tmp47, tmp48) = LoadKeyValuePairNoSideEffects_270(state_, TNode<Context>{tmp38}, TNode<Object>{tmp46}, &label0).Flatten();
+    ca_.Goto(&block13, tmp38, tmp39, tmp40, tmp41, tmp42, tmp43, tmp44, tmp45, tmp46, tmp46, tmp47, tmp48);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block14, tmp38, tmp39, tmp40, tmp41, tmp42, tmp43, tmp44, tmp45, tmp46, tmp46);
+    }
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp49;
+    TNode<Object> tmp50;
+    TNode<Object> tmp51;
+    TNode<JSArray> tmp52;
+    TNode<FixedArray> tmp53;
+    TNode<Smi> tmp54;
+    TNode<JSObject> tmp55;
+    TNode<Smi> tmp56;
+    TNode<Object> tmp57;
+    TNode<Object> tmp58;
+    ca_.Bind(&block14, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58);
+    ca_.Goto(&block1);
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp59;
+    TNode<Object> tmp60;
+    TNode<Object> tmp61;
+    TNode<JSArray> tmp62;
+    TNode<FixedArray> tmp63;
+    TNode<Smi> tmp64;
+    TNode<JSObject> tmp65;
+    TNode<Smi> tmp66;
+    TNode<Object> tmp67;
+    TNode<Object> tmp68;
+    TNode<Object> tmp69;
+    TNode<Object> tmp70;
+    ca_.Bind(&block13, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 18);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 24);
+    TNode<BoolT> tmp71;
+    USE(tmp71);
+    tmp71 = Is10JSReceiver90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol_1425(state_, TNode<Context>{tmp59}, TNode<Object>{tmp69});
+    ca_.Branch(tmp71, &block15, &block16, tmp59, tmp60, tmp61, tmp62, tmp63, tmp64, tmp65, tmp66, tmp67, tmp69, tmp70);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp72;
+    TNode<Object> tmp73;
+    TNode<Object> tmp74;
+    TNode<JSArray> tmp75;
+    TNode<FixedArray> tmp76;
+    TNode<Smi> tmp77;
+    TNode<JSObject> tmp78;
+    TNode<Smi> tmp79;
+    TNode<Object> tmp80;
+    TNode<Object> tmp81;
+    TNode<Object> tmp82;
+    ca_.Bind(&block15, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82);
+    ca_.Goto(&block1);
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp83;
+    TNode<Object> tmp84;
+    TNode<Object> tmp85;
+    TNode<JSArray> tmp86;
+    TNode<FixedArray> tmp87;
+    TNode<Smi> tmp88;
+    TNode<JSObject> tmp89;
+    TNode<Smi> tmp90;
+    TNode<Object> tmp91;
+    TNode<Object> tmp92;
+    TNode<Object> tmp93;
+    ca_.Bind(&block16, &tmp83, &tmp84, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 25);
+    TNode<Object> tmp94;
+    tmp94 = CodeStubAssembler(state_).CallBuiltin(Builtins::kFastCreateDataProperty, tmp83, tmp89, tmp92, tmp93);
+    USE(tmp94);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 16);
+    ca_.Goto(&block12, tmp83, tmp84, tmp85, tmp86, tmp87, tmp88, tmp89, tmp90);
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp95;
+    TNode<Object> tmp96;
+    TNode<Object> tmp97;
+    TNode<JSArray> tmp98;
+    TNode<FixedArray> tmp99;
+    TNode<Smi> tmp100;
+    TNode<JSObject> tmp101;
+    TNode<Smi> tmp102;
+    ca_.Bind(&block12, &tmp95, &tmp96, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102);
+    TNode<Smi> tmp103;
+    USE(tmp103);
+    tmp103 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 1);
+    TNode<Smi> tmp104;
+    USE(tmp104);
+    tmp104 = CodeStubAssembler(state_).SmiAdd(TNode<Smi>{tmp102}, TNode<Smi>{tmp103});
+    ca_.Goto(&block11, tmp95, tmp96, tmp97, tmp98, tmp99, tmp100, tmp101, tmp104);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp105;
+    TNode<Object> tmp106;
+    TNode<Object> tmp107;
+    TNode<JSArray> tmp108;
+    TNode<FixedArray> tmp109;
+    TNode<Smi> tmp110;
+    TNode<JSObject> tmp111;
+    TNode<Smi> tmp112;
+    ca_.Bind(&block10, &tmp105, &tmp106, &tmp107, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 27);
+    ca_.Goto(&block2, tmp105, tmp106, tmp111);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp113;
+    TNode<Object> tmp114;
+    TNode<Object> tmp115;
+    ca_.Bind(&block4, &tmp113, &tmp114, &tmp115);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 29);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 30);
+    ca_.Goto(&block1);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp116;
+    TNode<Object> tmp117;
+    TNode<JSObject> tmp118;
+    ca_.Bind(&block2, &tmp116, &tmp117, &tmp118);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 7);
+    ca_.Goto(&block17, tmp116, tmp117, tmp118);
+  }
+
+  if (block1.is_used()) {
+    ca_.Bind(&block1);
+    ca_.Goto(label_IfSlow);
+  }
+
+    TNode<Context> tmp119;
+    TNode<Object> tmp120;
+    TNode<JSObject> tmp121;
+    ca_.Bind(&block17, &tmp119, &tmp120, &tmp121);
+  return TNode<JSObject>{tmp121};
+}
+
+TF_BUILTIN(ObjectFromEntries, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  Node* argc = Parameter(Descriptor::kJSActualArgumentsCount);
+  TNode<IntPtrT> arguments_length(ChangeInt32ToIntPtr(argc));
+  TNode<RawPtrT> arguments_frame = UncheckedCast<RawPtrT>(LoadFramePointer());
+  TorqueStructArguments torque_arguments(GetFrameArguments(arguments_frame, arguments_length));
+  CodeStubArguments arguments(this, torque_arguments);
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = arguments.GetReceiver();
+USE(parameter1);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, Object> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, Object, JSObject> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, JSObject, Map, JSReceiver, Object> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, JSObject, Map, JSReceiver, Object, JSReceiver, Object> block15(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, JSObject, Map, JSReceiver, Object, BoolT, Object> block16(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, JSObject, Map, JSReceiver, Object> block14(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, JSObject, Map, JSReceiver, Object> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, JSObject, Map, JSReceiver, Object> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, JSObject, Map, JSReceiver, Object> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, JSObject, Map, JSReceiver, Object, Object> block20(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, JSObject, Map, JSReceiver, Object> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, JSObject, Map, JSReceiver, Object, JSReceiver, Object, Map, Object> block25(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, JSObject, Map, JSReceiver, Object, JSReceiver, Object, Map> block24(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, JSObject, Map, JSReceiver, Object, JSReceiver, Object, Map, JSReceiver> block23(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, JSObject, Map, JSReceiver, Object> block22(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, JSObject, Map, JSReceiver, Object, JSReceiver> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, JSObject, Map, JSReceiver, Object, JSReceiver, JSReceiver, Map, Object> block26(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, JSObject, Map, JSReceiver, Object, JSReceiver, Object, Object, Object> block27(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, JSObject, Map, JSReceiver, Object, JSReceiver, Object, Object, Object, JSObject, Object, Object, Object> block28(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, JSObject, Map, JSReceiver, Object> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, JSObject, Map, JSReceiver, Object, Object> block10(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object> block2(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+    ca_.Goto(&block0, torque_arguments.frame, torque_arguments.base, torque_arguments.length, parameter0, parameter1);
+
+  if (block0.is_used()) {
+    TNode<RawPtrT> tmp0;
+    TNode<RawPtrT> tmp1;
+    TNode<IntPtrT> tmp2;
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 38);
+    TNode<IntPtrT> tmp5;
+    USE(tmp5);
+    tmp5 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<Object> tmp6;
+    USE(tmp6);
+    tmp6 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp0}, TNode<RawPtrT>{tmp1}, TNode<IntPtrT>{tmp2}}, TNode<IntPtrT>{tmp5});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 40);
+    TNode<BoolT> tmp7;
+    USE(tmp7);
+    tmp7 = CodeStubAssembler(state_).IsNullOrUndefined(TNode<Object>{tmp6});
+    ca_.Branch(tmp7, &block5, &block6, tmp0, tmp1, tmp2, tmp3, tmp4, tmp6);
+  }
+
+  if (block5.is_used()) {
+    TNode<RawPtrT> tmp8;
+    TNode<RawPtrT> tmp9;
+    TNode<IntPtrT> tmp10;
+    TNode<Context> tmp11;
+    TNode<Object> tmp12;
+    TNode<Object> tmp13;
+    ca_.Bind(&block5, &tmp8, &tmp9, &tmp10, &tmp11, &tmp12, &tmp13);
+    ca_.Goto(&block2, tmp8, tmp9, tmp10, tmp11, tmp12, tmp13);
+  }
+
+  if (block6.is_used()) {
+    TNode<RawPtrT> tmp14;
+    TNode<RawPtrT> tmp15;
+    TNode<IntPtrT> tmp16;
+    TNode<Context> tmp17;
+    TNode<Object> tmp18;
+    TNode<Object> tmp19;
+    ca_.Bind(&block6, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18, &tmp19);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 41);
+    TNode<JSObject> tmp20;
+    USE(tmp20);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp20 = ObjectFromEntriesFastCase_313(state_, TNode<Context>{tmp17}, TNode<Object>{tmp19}, &label0);
+    ca_.Goto(&block7, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19, tmp19, tmp20);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block8, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19, tmp19);
+    }
+  }
+
+  if (block8.is_used()) {
+    TNode<RawPtrT> tmp21;
+    TNode<RawPtrT> tmp22;
+    TNode<IntPtrT> tmp23;
+    TNode<Context> tmp24;
+    TNode<Object> tmp25;
+    TNode<Object> tmp26;
+    TNode<Object> tmp27;
+    ca_.Bind(&block8, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27);
+    ca_.Goto(&block4, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26);
+  }
+
+  if (block7.is_used()) {
+    TNode<RawPtrT> tmp28;
+    TNode<RawPtrT> tmp29;
+    TNode<IntPtrT> tmp30;
+    TNode<Context> tmp31;
+    TNode<Object> tmp32;
+    TNode<Object> tmp33;
+    TNode<Object> tmp34;
+    TNode<JSObject> tmp35;
+    ca_.Bind(&block7, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34, &tmp35);
+    arguments.PopAndReturn(tmp35);
+  }
+
+  if (block4.is_used()) {
+    TNode<RawPtrT> tmp36;
+    TNode<RawPtrT> tmp37;
+    TNode<IntPtrT> tmp38;
+    TNode<Context> tmp39;
+    TNode<Object> tmp40;
+    TNode<Object> tmp41;
+    ca_.Bind(&block4, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 44);
+    TNode<JSObject> tmp42;
+    USE(tmp42);
+    tmp42 = NewJSObject_55(state_, TNode<Context>{tmp39});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 45);
+    TNode<Map> tmp43;
+    USE(tmp43);
+    tmp43 = GetIteratorResultMap_228(state_, TNode<Context>{tmp39});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 46);
+    TNode<JSReceiver> tmp44;
+    USE(tmp44);
+    TNode<Object> tmp45;
+    USE(tmp45);
+    std::tie(tmp44, tmp45) = IteratorBuiltinsAssembler(state_).GetIterator(TNode<Context>{tmp39}, TNode<Object>{tmp41}).Flatten();
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 48);
+    ca_.Goto(&block12, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42, tmp43, tmp44, tmp45);
+  }
+
+  if (block11.is_used()) {
+    TNode<RawPtrT> tmp46;
+    TNode<RawPtrT> tmp47;
+    TNode<IntPtrT> tmp48;
+    TNode<Context> tmp49;
+    TNode<Object> tmp50;
+    TNode<Object> tmp51;
+    TNode<JSObject> tmp52;
+    TNode<Map> tmp53;
+    TNode<JSReceiver> tmp54;
+    TNode<Object> tmp55;
+    ca_.Bind(&block11, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53, &tmp54, &tmp55);
+    TNode<BoolT> tmp56;
+    USE(tmp56);
+    compiler::CodeAssemblerExceptionHandlerLabel catch57__label(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+    { compiler::CodeAssemblerScopedExceptionHandler s(&ca_, &catch57__label);
+    tmp56 = CodeStubAssembler(state_).IsNullOrUndefined(TNode<Object>{tmp54});
+    }
+    if (catch57__label.is_used()) {
+      compiler::CodeAssemblerLabel catch57_skip(&ca_);
+      ca_.Goto(&catch57_skip);
+      TNode<Object> catch57_exception_object;
+      ca_.Bind(&catch57__label, &catch57_exception_object);
+      ca_.Goto(&block15, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51, tmp52, tmp53, tmp54, tmp55, tmp54, catch57_exception_object);
+      ca_.Bind(&catch57_skip);
+    }
+    TNode<BoolT> tmp58;
+    USE(tmp58);
+    compiler::CodeAssemblerExceptionHandlerLabel catch59__label(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+    { compiler::CodeAssemblerScopedExceptionHandler s(&ca_, &catch59__label);
+    tmp58 = CodeStubAssembler(state_).Word32BinaryNot(TNode<BoolT>{tmp56});
+    }
+    if (catch59__label.is_used()) {
+      compiler::CodeAssemblerLabel catch59_skip(&ca_);
+      ca_.Goto(&catch59_skip);
+      TNode<Object> catch59_exception_object;
+      ca_.Bind(&catch59__label, &catch59_exception_object);
+      ca_.Goto(&block16, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51, tmp52, tmp53, tmp54, tmp55, tmp56, catch59_exception_object);
+      ca_.Bind(&catch59_skip);
+    }
+    ca_.Branch(tmp58, &block13, &block14, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51, tmp52, tmp53, tmp54, tmp55);
+  }
+
+  if (block15.is_used()) {
+    TNode<RawPtrT> tmp60;
+    TNode<RawPtrT> tmp61;
+    TNode<IntPtrT> tmp62;
+    TNode<Context> tmp63;
+    TNode<Object> tmp64;
+    TNode<Object> tmp65;
+    TNode<JSObject> tmp66;
+    TNode<Map> tmp67;
+    TNode<JSReceiver> tmp68;
+    TNode<Object> tmp69;
+    TNode<JSReceiver> tmp70;
+    TNode<Object> tmp71;
+    ca_.Bind(&block15, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71);
+    ca_.Goto(&block10, tmp60, tmp61, tmp62, tmp63, tmp64, tmp65, tmp66, tmp67, tmp68, tmp69, tmp71);
+  }
+
+  if (block16.is_used()) {
+    TNode<RawPtrT> tmp72;
+    TNode<RawPtrT> tmp73;
+    TNode<IntPtrT> tmp74;
+    TNode<Context> tmp75;
+    TNode<Object> tmp76;
+    TNode<Object> tmp77;
+    TNode<JSObject> tmp78;
+    TNode<Map> tmp79;
+    TNode<JSReceiver> tmp80;
+    TNode<Object> tmp81;
+    TNode<BoolT> tmp82;
+    TNode<Object> tmp83;
+    ca_.Bind(&block16, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83);
+    ca_.Goto(&block10, tmp72, tmp73, tmp74, tmp75, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp83);
+  }
+
+  if (block14.is_used()) {
+    TNode<RawPtrT> tmp84;
+    TNode<RawPtrT> tmp85;
+    TNode<IntPtrT> tmp86;
+    TNode<Context> tmp87;
+    TNode<Object> tmp88;
+    TNode<Object> tmp89;
+    TNode<JSObject> tmp90;
+    TNode<Map> tmp91;
+    TNode<JSReceiver> tmp92;
+    TNode<Object> tmp93;
+    ca_.Bind(&block14, &tmp84, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93);
+    CodeStubAssembler(state_).FailAssert("Torque assert '!IsNullOrUndefined(i.object)' failed", "../../deps/v8/src/builtins/object-fromentries.tq", 48);
+  }
+
+  if (block13.is_used()) {
+    TNode<RawPtrT> tmp94;
+    TNode<RawPtrT> tmp95;
+    TNode<IntPtrT> tmp96;
+    TNode<Context> tmp97;
+    TNode<Object> tmp98;
+    TNode<Object> tmp99;
+    TNode<JSObject> tmp100;
+    TNode<Map> tmp101;
+    TNode<JSReceiver> tmp102;
+    TNode<Object> tmp103;
+    ca_.Bind(&block13, &tmp94, &tmp95, &tmp96, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103);
+  }
+
+  if (block12.is_used()) {
+    TNode<RawPtrT> tmp104;
+    TNode<RawPtrT> tmp105;
+    TNode<IntPtrT> tmp106;
+    TNode<Context> tmp107;
+    TNode<Object> tmp108;
+    TNode<Object> tmp109;
+    TNode<JSObject> tmp110;
+    TNode<Map> tmp111;
+    TNode<JSReceiver> tmp112;
+    TNode<Object> tmp113;
+    ca_.Bind(&block12, &tmp104, &tmp105, &tmp106, &tmp107, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112, &tmp113);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 49);
+    ca_.Goto(&block19, tmp104, tmp105, tmp106, tmp107, tmp108, tmp109, tmp110, tmp111, tmp112, tmp113);
+  }
+
+  if (block19.is_used()) {
+    TNode<RawPtrT> tmp114;
+    TNode<RawPtrT> tmp115;
+    TNode<IntPtrT> tmp116;
+    TNode<Context> tmp117;
+    TNode<Object> tmp118;
+    TNode<Object> tmp119;
+    TNode<JSObject> tmp120;
+    TNode<Map> tmp121;
+    TNode<JSReceiver> tmp122;
+    TNode<Object> tmp123;
+    ca_.Bind(&block19, &tmp114, &tmp115, &tmp116, &tmp117, &tmp118, &tmp119, &tmp120, &tmp121, &tmp122, &tmp123);
+    TNode<BoolT> tmp124;
+    USE(tmp124);
+    compiler::CodeAssemblerExceptionHandlerLabel catch125__label(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+    { compiler::CodeAssemblerScopedExceptionHandler s(&ca_, &catch125__label);
+    tmp124 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, true);
+    }
+    if (catch125__label.is_used()) {
+      compiler::CodeAssemblerLabel catch125_skip(&ca_);
+      ca_.Goto(&catch125_skip);
+      TNode<Object> catch125_exception_object;
+      ca_.Bind(&catch125__label, &catch125_exception_object);
+      ca_.Goto(&block20, tmp114, tmp115, tmp116, tmp117, tmp118, tmp119, tmp120, tmp121, tmp122, tmp123, catch125_exception_object);
+      ca_.Bind(&catch125_skip);
+    }
+    ca_.Branch(tmp124, &block17, &block18, tmp114, tmp115, tmp116, tmp117, tmp118, tmp119, tmp120, tmp121, tmp122, tmp123);
+  }
+
+  if (block20.is_used()) {
+    TNode<RawPtrT> tmp126;
+    TNode<RawPtrT> tmp127;
+    TNode<IntPtrT> tmp128;
+    TNode<Context> tmp129;
+    TNode<Object> tmp130;
+    TNode<Object> tmp131;
+    TNode<JSObject> tmp132;
+    TNode<Map> tmp133;
+    TNode<JSReceiver> tmp134;
+    TNode<Object> tmp135;
+    TNode<Object> tmp136;
+    ca_.Bind(&block20, &tmp126, &tmp127, &tmp128, &tmp129, &tmp130, &tmp131, &tmp132, &tmp133, &tmp134, &tmp135, &tmp136);
+    ca_.Goto(&block10, tmp126, tmp127, tmp128, tmp129, tmp130, tmp131, tmp132, tmp133, tmp134, tmp135, tmp136);
+  }
+
+  if (block17.is_used()) {
+    TNode<RawPtrT> tmp137;
+    TNode<RawPtrT> tmp138;
+    TNode<IntPtrT> tmp139;
+    TNode<Context> tmp140;
+    TNode<Object> tmp141;
+    TNode<Object> tmp142;
+    TNode<JSObject> tmp143;
+    TNode<Map> tmp144;
+    TNode<JSReceiver> tmp145;
+    TNode<Object> tmp146;
+    ca_.Bind(&block17, &tmp137, &tmp138, &tmp139, &tmp140, &tmp141, &tmp142, &tmp143, &tmp144, &tmp145, &tmp146);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 51);
+    TNode<JSReceiver> tmp147;
+    USE(tmp147);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    compiler::CodeAssemblerExceptionHandlerLabel catch148__label(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+    { compiler::CodeAssemblerScopedExceptionHandler s(&ca_, &catch148__label);
+    tmp147 = IteratorBuiltinsAssembler(state_).IteratorStep(TNode<Context>{tmp140}, TorqueStructIteratorRecord{TNode<JSReceiver>{tmp145}, TNode<Object>{tmp146}}, TNode<Map>{tmp144}, &label0);
+    }
+    if (catch148__label.is_used()) {
+      compiler::CodeAssemblerLabel catch148_skip(&ca_);
+      ca_.Goto(&catch148_skip);
+      TNode<Object> catch148_exception_object;
+      ca_.Bind(&catch148__label, &catch148_exception_object);
+      ca_.Goto(&block25, tmp137, tmp138, tmp139, tmp140, tmp141, tmp142, tmp143, tmp144, tmp145, tmp146, tmp145, tmp146, tmp144, catch148_exception_object);
+      ca_.Bind(&catch148_skip);
+    }
+    ca_.Goto(&block23, tmp137, tmp138, tmp139, tmp140, tmp141, tmp142, tmp143, tmp144, tmp145, tmp146, tmp145, tmp146, tmp144, tmp147);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block24, tmp137, tmp138, tmp139, tmp140, tmp141, tmp142, tmp143, tmp144, tmp145, tmp146, tmp145, tmp146, tmp144);
+    }
+  }
+
+  if (block25.is_used()) {
+    TNode<RawPtrT> tmp149;
+    TNode<RawPtrT> tmp150;
+    TNode<IntPtrT> tmp151;
+    TNode<Context> tmp152;
+    TNode<Object> tmp153;
+    TNode<Object> tmp154;
+    TNode<JSObject> tmp155;
+    TNode<Map> tmp156;
+    TNode<JSReceiver> tmp157;
+    TNode<Object> tmp158;
+    TNode<JSReceiver> tmp159;
+    TNode<Object> tmp160;
+    TNode<Map> tmp161;
+    TNode<Object> tmp162;
+    ca_.Bind(&block25, &tmp149, &tmp150, &tmp151, &tmp152, &tmp153, &tmp154, &tmp155, &tmp156, &tmp157, &tmp158, &tmp159, &tmp160, &tmp161, &tmp162);
+    ca_.Goto(&block10, tmp149, tmp150, tmp151, tmp152, tmp153, tmp154, tmp155, tmp156, tmp157, tmp158, tmp162);
+  }
+
+  if (block24.is_used()) {
+    TNode<RawPtrT> tmp163;
+    TNode<RawPtrT> tmp164;
+    TNode<IntPtrT> tmp165;
+    TNode<Context> tmp166;
+    TNode<Object> tmp167;
+    TNode<Object> tmp168;
+    TNode<JSObject> tmp169;
+    TNode<Map> tmp170;
+    TNode<JSReceiver> tmp171;
+    TNode<Object> tmp172;
+    TNode<JSReceiver> tmp173;
+    TNode<Object> tmp174;
+    TNode<Map> tmp175;
+    ca_.Bind(&block24, &tmp163, &tmp164, &tmp165, &tmp166, &tmp167, &tmp168, &tmp169, &tmp170, &tmp171, &tmp172, &tmp173, &tmp174, &tmp175);
+    ca_.Goto(&block22, tmp163, tmp164, tmp165, tmp166, tmp167, tmp168, tmp169, tmp170, tmp171, tmp172);
+  }
+
+  if (block23.is_used()) {
+    TNode<RawPtrT> tmp176;
+    TNode<RawPtrT> tmp177;
+    TNode<IntPtrT> tmp178;
+    TNode<Context> tmp179;
+    TNode<Object> tmp180;
+    TNode<Object> tmp181;
+    TNode<JSObject> tmp182;
+    TNode<Map> tmp183;
+    TNode<JSReceiver> tmp184;
+    TNode<Object> tmp185;
+    TNode<JSReceiver> tmp186;
+    TNode<Object> tmp187;
+    TNode<Map> tmp188;
+    TNode<JSReceiver> tmp189;
+    ca_.Bind(&block23, &tmp176, &tmp177, &tmp178, &tmp179, &tmp180, &tmp181, &tmp182, &tmp183, &tmp184, &tmp185, &tmp186, &tmp187, &tmp188, &tmp189);
+    ca_.Goto(&block21, tmp176, tmp177, tmp178, tmp179, tmp180, tmp181, tmp182, tmp183, tmp184, tmp185, tmp189);
+  }
+
+  if (block22.is_used()) {
+    TNode<RawPtrT> tmp190;
+    TNode<RawPtrT> tmp191;
+    TNode<IntPtrT> tmp192;
+    TNode<Context> tmp193;
+    TNode<Object> tmp194;
+    TNode<Object> tmp195;
+    TNode<JSObject> tmp196;
+    TNode<Map> tmp197;
+    TNode<JSReceiver> tmp198;
+    TNode<Object> tmp199;
+    ca_.Bind(&block22, &tmp190, &tmp191, &tmp192, &tmp193, &tmp194, &tmp195, &tmp196, &tmp197, &tmp198, &tmp199);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 52);
+    arguments.PopAndReturn(tmp196);
+  }
+
+  if (block21.is_used()) {
+    TNode<RawPtrT> tmp200;
+    TNode<RawPtrT> tmp201;
+    TNode<IntPtrT> tmp202;
+    TNode<Context> tmp203;
+    TNode<Object> tmp204;
+    TNode<Object> tmp205;
+    TNode<JSObject> tmp206;
+    TNode<Map> tmp207;
+    TNode<JSReceiver> tmp208;
+    TNode<Object> tmp209;
+    TNode<JSReceiver> tmp210;
+    ca_.Bind(&block21, &tmp200, &tmp201, &tmp202, &tmp203, &tmp204, &tmp205, &tmp206, &tmp207, &tmp208, &tmp209, &tmp210);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 50);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 54);
+    TNode<Object> tmp211;
+    USE(tmp211);
+    compiler::CodeAssemblerExceptionHandlerLabel catch212__label(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+    { compiler::CodeAssemblerScopedExceptionHandler s(&ca_, &catch212__label);
+    tmp211 = IteratorBuiltinsAssembler(state_).IteratorValue(TNode<Context>{tmp203}, TNode<JSReceiver>{tmp210}, TNode<Map>{tmp207});
+    }
+    if (catch212__label.is_used()) {
+      compiler::CodeAssemblerLabel catch212_skip(&ca_);
+      ca_.Goto(&catch212_skip);
+      TNode<Object> catch212_exception_object;
+      ca_.Bind(&catch212__label, &catch212_exception_object);
+      ca_.Goto(&block26, tmp200, tmp201, tmp202, tmp203, tmp204, tmp205, tmp206, tmp207, tmp208, tmp209, tmp210, tmp210, tmp207, catch212_exception_object);
+      ca_.Bind(&catch212_skip);
+    }
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 53);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 56);
+    TNode<Object> tmp213;
+    USE(tmp213);
+    TNode<Object> tmp214;
+    USE(tmp214);
+    compiler::CodeAssemblerExceptionHandlerLabel catch215__label(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+    { compiler::CodeAssemblerScopedExceptionHandler s(&ca_, &catch215__label);
+    std::tie(tmp213, tmp214) = LoadKeyValuePair_271(state_, TNode<Context>{tmp203}, TNode<Object>{tmp211}).Flatten();
+    }
+    if (catch215__label.is_used()) {
+      compiler::CodeAssemblerLabel catch215_skip(&ca_);
+      ca_.Goto(&catch215_skip);
+      TNode<Object> catch215_exception_object;
+      ca_.Bind(&catch215__label, &catch215_exception_object);
+      ca_.Goto(&block27, tmp200, tmp201, tmp202, tmp203, tmp204, tmp205, tmp206, tmp207, tmp208, tmp209, tmp210, tmp211, tmp211, catch215_exception_object);
+      ca_.Bind(&catch215_skip);
+    }
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 55);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 57);
+    TNode<Object> tmp216;
+    compiler::CodeAssemblerExceptionHandlerLabel catch217__label(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+    { compiler::CodeAssemblerScopedExceptionHandler s(&ca_, &catch217__label);
+    tmp216 = CodeStubAssembler(state_).CallBuiltin(Builtins::kFastCreateDataProperty, tmp203, tmp206, tmp213, tmp214);
+    USE(tmp216);
+    }
+    if (catch217__label.is_used()) {
+      compiler::CodeAssemblerLabel catch217_skip(&ca_);
+      ca_.Goto(&catch217_skip);
+      TNode<Object> catch217_exception_object;
+      ca_.Bind(&catch217__label, &catch217_exception_object);
+      ca_.Goto(&block28, tmp200, tmp201, tmp202, tmp203, tmp204, tmp205, tmp206, tmp207, tmp208, tmp209, tmp210, tmp211, tmp213, tmp214, tmp206, tmp213, tmp214, catch217_exception_object);
+      ca_.Bind(&catch217_skip);
+    }
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 49);
+    ca_.Goto(&block19, tmp200, tmp201, tmp202, tmp203, tmp204, tmp205, tmp206, tmp207, tmp208, tmp209);
+  }
+
+  if (block26.is_used()) {
+    TNode<RawPtrT> tmp218;
+    TNode<RawPtrT> tmp219;
+    TNode<IntPtrT> tmp220;
+    TNode<Context> tmp221;
+    TNode<Object> tmp222;
+    TNode<Object> tmp223;
+    TNode<JSObject> tmp224;
+    TNode<Map> tmp225;
+    TNode<JSReceiver> tmp226;
+    TNode<Object> tmp227;
+    TNode<JSReceiver> tmp228;
+    TNode<JSReceiver> tmp229;
+    TNode<Map> tmp230;
+    TNode<Object> tmp231;
+    ca_.Bind(&block26, &tmp218, &tmp219, &tmp220, &tmp221, &tmp222, &tmp223, &tmp224, &tmp225, &tmp226, &tmp227, &tmp228, &tmp229, &tmp230, &tmp231);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 54);
+    ca_.Goto(&block10, tmp218, tmp219, tmp220, tmp221, tmp222, tmp223, tmp224, tmp225, tmp226, tmp227, tmp231);
+  }
+
+  if (block27.is_used()) {
+    TNode<RawPtrT> tmp232;
+    TNode<RawPtrT> tmp233;
+    TNode<IntPtrT> tmp234;
+    TNode<Context> tmp235;
+    TNode<Object> tmp236;
+    TNode<Object> tmp237;
+    TNode<JSObject> tmp238;
+    TNode<Map> tmp239;
+    TNode<JSReceiver> tmp240;
+    TNode<Object> tmp241;
+    TNode<JSReceiver> tmp242;
+    TNode<Object> tmp243;
+    TNode<Object> tmp244;
+    TNode<Object> tmp245;
+    ca_.Bind(&block27, &tmp232, &tmp233, &tmp234, &tmp235, &tmp236, &tmp237, &tmp238, &tmp239, &tmp240, &tmp241, &tmp242, &tmp243, &tmp244, &tmp245);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 56);
+    ca_.Goto(&block10, tmp232, tmp233, tmp234, tmp235, tmp236, tmp237, tmp238, tmp239, tmp240, tmp241, tmp245);
+  }
+
+  if (block28.is_used()) {
+    TNode<RawPtrT> tmp246;
+    TNode<RawPtrT> tmp247;
+    TNode<IntPtrT> tmp248;
+    TNode<Context> tmp249;
+    TNode<Object> tmp250;
+    TNode<Object> tmp251;
+    TNode<JSObject> tmp252;
+    TNode<Map> tmp253;
+    TNode<JSReceiver> tmp254;
+    TNode<Object> tmp255;
+    TNode<JSReceiver> tmp256;
+    TNode<Object> tmp257;
+    TNode<Object> tmp258;
+    TNode<Object> tmp259;
+    TNode<JSObject> tmp260;
+    TNode<Object> tmp261;
+    TNode<Object> tmp262;
+    TNode<Object> tmp263;
+    ca_.Bind(&block28, &tmp246, &tmp247, &tmp248, &tmp249, &tmp250, &tmp251, &tmp252, &tmp253, &tmp254, &tmp255, &tmp256, &tmp257, &tmp258, &tmp259, &tmp260, &tmp261, &tmp262, &tmp263);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 57);
+    ca_.Goto(&block10, tmp246, tmp247, tmp248, tmp249, tmp250, tmp251, tmp252, tmp253, tmp254, tmp255, tmp263);
+  }
+
+  if (block18.is_used()) {
+    TNode<RawPtrT> tmp264;
+    TNode<RawPtrT> tmp265;
+    TNode<IntPtrT> tmp266;
+    TNode<Context> tmp267;
+    TNode<Object> tmp268;
+    TNode<Object> tmp269;
+    TNode<JSObject> tmp270;
+    TNode<Map> tmp271;
+    TNode<JSReceiver> tmp272;
+    TNode<Object> tmp273;
+    ca_.Bind(&block18, &tmp264, &tmp265, &tmp266, &tmp267, &tmp268, &tmp269, &tmp270, &tmp271, &tmp272, &tmp273);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 59);
+    arguments.PopAndReturn(tmp270);
+  }
+
+  if (block10.is_used()) {
+    TNode<RawPtrT> tmp274;
+    TNode<RawPtrT> tmp275;
+    TNode<IntPtrT> tmp276;
+    TNode<Context> tmp277;
+    TNode<Object> tmp278;
+    TNode<Object> tmp279;
+    TNode<JSObject> tmp280;
+    TNode<Map> tmp281;
+    TNode<JSReceiver> tmp282;
+    TNode<Object> tmp283;
+    TNode<Object> tmp284;
+    ca_.Bind(&block10, &tmp274, &tmp275, &tmp276, &tmp277, &tmp278, &tmp279, &tmp280, &tmp281, &tmp282, &tmp283, &tmp284);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 61);
+    IteratorBuiltinsAssembler(state_).IteratorCloseOnException(TNode<Context>{tmp277}, TorqueStructIteratorRecord{TNode<JSReceiver>{tmp282}, TNode<Object>{tmp283}}, TNode<Object>{tmp284});
+  }
+
+  if (block2.is_used()) {
+    TNode<RawPtrT> tmp285;
+    TNode<RawPtrT> tmp286;
+    TNode<IntPtrT> tmp287;
+    TNode<Context> tmp288;
+    TNode<Object> tmp289;
+    TNode<Object> tmp290;
+    ca_.Bind(&block2, &tmp285, &tmp286, &tmp287, &tmp288, &tmp289, &tmp290);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 65);
+    CodeStubAssembler(state_).ThrowTypeError(TNode<Context>{tmp288}, MessageTemplate::kNotIterable);
+  }
+}
+
+TNode<JSArray> Cast34ATFastJSArrayWithNoCustomIteration_1424(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o, compiler::CodeAssemblerLabel* label_CastError) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, HeapObject> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, HeapObject> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, HeapObject, JSArray> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSArray> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSArray> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 2215);
+    TNode<HeapObject> tmp2;
+    USE(tmp2);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp2 = CodeStubAssembler(state_).TaggedToHeapObject(TNode<Object>{tmp1}, &label0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp1, tmp2);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block4, tmp0, tmp1, tmp1);
+    }
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    ca_.Bind(&block4, &tmp3, &tmp4, &tmp5);
+    ca_.Goto(&block1);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp6;
+    TNode<Object> tmp7;
+    TNode<Object> tmp8;
+    TNode<HeapObject> tmp9;
+    ca_.Bind(&block3, &tmp6, &tmp7, &tmp8, &tmp9);
+    TNode<JSArray> tmp10;
+    USE(tmp10);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp10 = Cast34ATFastJSArrayWithNoCustomIteration_141(state_, TNode<Context>{tmp6}, TNode<HeapObject>{tmp9}, &label0);
+    ca_.Goto(&block5, tmp6, tmp7, tmp9, tmp10);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block6, tmp6, tmp7, tmp9);
+    }
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp11;
+    TNode<Object> tmp12;
+    TNode<HeapObject> tmp13;
+    ca_.Bind(&block6, &tmp11, &tmp12, &tmp13);
+    ca_.Goto(&block1);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp14;
+    TNode<Object> tmp15;
+    TNode<HeapObject> tmp16;
+    TNode<JSArray> tmp17;
+    ca_.Bind(&block5, &tmp14, &tmp15, &tmp16, &tmp17);
+    ca_.Goto(&block2, tmp14, tmp15, tmp17);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp18;
+    TNode<Object> tmp19;
+    TNode<JSArray> tmp20;
+    ca_.Bind(&block2, &tmp18, &tmp19, &tmp20);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 10);
+    ca_.Goto(&block7, tmp18, tmp19, tmp20);
+  }
+
+  if (block1.is_used()) {
+    ca_.Bind(&block1);
+    ca_.Goto(label_CastError);
+  }
+
+    TNode<Context> tmp21;
+    TNode<Object> tmp22;
+    TNode<JSArray> tmp23;
+    ca_.Bind(&block7, &tmp21, &tmp22, &tmp23);
+  return TNode<JSArray>{tmp23};
+}
+
+TNode<BoolT> Is10JSReceiver90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol_1425(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, JSReceiver> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, BoolT> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, BoolT> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 2996);
+    TNode<JSReceiver> tmp2;
+    USE(tmp2);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp2 = Cast10JSReceiver_1365(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1}, &label0);
+    ca_.Goto(&block4, tmp0, tmp1, tmp1, tmp2);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block5, tmp0, tmp1, tmp1);
+    }
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    ca_.Bind(&block5, &tmp3, &tmp4, &tmp5);
+    ca_.Goto(&block3, tmp3, tmp4);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp6;
+    TNode<Object> tmp7;
+    TNode<Object> tmp8;
+    TNode<JSReceiver> tmp9;
+    ca_.Bind(&block4, &tmp6, &tmp7, &tmp8, &tmp9);
+    ca_.Goto(&block2, tmp6, tmp7, tmp9);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp10;
+    TNode<Object> tmp11;
+    ca_.Bind(&block3, &tmp10, &tmp11);
+    TNode<BoolT> tmp12;
+    USE(tmp12);
+    tmp12 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, false);
+    ca_.Goto(&block1, tmp10, tmp11, tmp12);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp13;
+    TNode<Object> tmp14;
+    TNode<JSReceiver> tmp15;
+    ca_.Bind(&block2, &tmp13, &tmp14, &tmp15);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 2997);
+    TNode<BoolT> tmp16;
+    USE(tmp16);
+    tmp16 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, true);
+    ca_.Goto(&block1, tmp13, tmp14, tmp16);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp17;
+    TNode<Object> tmp18;
+    TNode<BoolT> tmp19;
+    ca_.Bind(&block1, &tmp17, &tmp18, &tmp19);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/object-fromentries.tq", 24);
+    ca_.Goto(&block6, tmp17, tmp18, tmp19);
+  }
+
+    TNode<Context> tmp20;
+    TNode<Object> tmp21;
+    TNode<BoolT> tmp22;
+    ca_.Bind(&block6, &tmp20, &tmp21, &tmp22);
+  return TNode<BoolT>{tmp22};
+}
+
+}  // namespace internal
+}  // namespace v8
+
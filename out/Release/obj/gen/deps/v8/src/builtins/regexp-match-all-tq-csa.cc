@@ -0,0 +1,1904 @@
+#include "src/builtins/builtins-array-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-utils-gen.h"
+#include "src/builtins/builtins.h"
+#include "src/codegen/code-factory.h"
+#include "src/heap/factory-inl.h"
+#include "src/objects/arguments.h"
+#include "src/objects/bigint.h"
+#include "src/objects/elements-kind.h"
+#include "src/objects/free-space.h"
+#include "src/objects/js-generator.h"
+#include "src/objects/js-promise.h"
+#include "src/objects/js-regexp-string-iterator.h"
+#include "src/objects/js-weak-refs.h"
+#include "src/objects/objects.h"
+#include "src/objects/source-text-module.h"
+#include "src/objects/stack-frame-info.h"
+#include "src/objects/synthetic-module.h"
+#include "src/objects/template-objects.h"
+#include "src/builtins/builtins-bigint-gen.h"
+#include "src/builtins/builtins-collections-gen.h"
+#include "src/builtins/builtins-data-view-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-iterator-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-string-gen.h"
+#include "src/builtins/builtins-string-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-constructor-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "torque-generated/../../deps/v8/src/builtins/arguments-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-copywithin-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-join-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-lastindexof-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-map-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-right-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reverse-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-shift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-splice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-unshift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/base-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/bigint-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/boolean-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/collections-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/data-view-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/extras-utils-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/frames-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/growable-fixed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/internal-coverage-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/math-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-fromentries-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-constructor-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-delete-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-has-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-is-extensible-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-prevent-extensions-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revocable-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revoke-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/reflect-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-exec-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-all-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-replace-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-search-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-source-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-split-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-test-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-endswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-html-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-pad-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-repeat-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-startswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-substring-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/torque-internal-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-createtypedarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduceright-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-subarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/third_party/v8/builtins/array-sort-tq-csa.h"
+#include "torque-generated/../../deps/v8/test/torque/test-torque-tq-csa.h"
+
+namespace v8 {
+namespace internal {
+
+TNode<Object> RegExpPrototypeMatchAllImpl_325(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<NativeContext> p_nativeContext, TNode<Object> p_receiver, TNode<Object> p_string) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, NativeContext, Object, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, NativeContext, Object, Object, JSReceiver, String, Object, BoolT, BoolT, JSReceiver, JSReceiver> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, NativeContext, Object, Object, JSReceiver, String, Object, BoolT, BoolT, JSReceiver, JSReceiver, JSRegExp> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, NativeContext, Object, Object, JSReceiver, String, Object, BoolT, BoolT, JSReceiver, JSRegExp, PrimitiveHeapObject, String, JSRegExp> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, NativeContext, Object, Object, JSReceiver, String, Object, BoolT, BoolT, JSReceiver, JSRegExp, PrimitiveHeapObject, String, JSRegExp> block9(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, NativeContext, Object, Object, JSReceiver, String, Object, BoolT, BoolT, JSReceiver, JSRegExp, PrimitiveHeapObject, String, JSRegExp> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, NativeContext, Object, Object, JSReceiver, String, Object, BoolT, BoolT, JSReceiver, JSRegExp, PrimitiveHeapObject, String, JSRegExp> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, NativeContext, Object, Object, JSReceiver, String, Object, BoolT, BoolT, JSReceiver> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, NativeContext, Object, Object, JSReceiver, String, Object, BoolT, BoolT, JSReceiver> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, NativeContext, Object, Object, Object> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, NativeContext, Object, Object, Object> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_nativeContext, p_receiver, p_string);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<NativeContext> tmp1;
+    TNode<Object> tmp2;
+    TNode<Object> tmp3;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 22);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 21);
+    CodeStubAssembler(state_).ThrowIfNotJSReceiver(TNode<Context>{tmp0}, TNode<Object>{tmp2}, MessageTemplate::kIncompatibleMethodReceiver, "RegExp.prototype.@@matchAll");
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 23);
+    TNode<JSReceiver> tmp4;
+    USE(tmp4);
+    tmp4 = UnsafeCast10JSReceiver_1418(state_, TNode<Context>{tmp0}, TNode<Object>{tmp2});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 26);
+    TNode<String> tmp5;
+    USE(tmp5);
+    tmp5 = CodeStubAssembler(state_).ToString_Inline(TNode<Context>{tmp0}, TNode<Object>{tmp3});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 28);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 29);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 30);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 36);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 37);
+    TNode<JSRegExp> tmp6;
+    USE(tmp6);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp6 = Cast14ATFastJSRegExp_137(state_, TNode<Context>{tmp0}, TNode<HeapObject>{tmp4}, &label0);
+    ca_.Goto(&block4, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, ca_.Uninitialized<Object>(), ca_.Uninitialized<BoolT>(), ca_.Uninitialized<BoolT>(), tmp4, tmp4, tmp6);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block5, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, ca_.Uninitialized<Object>(), ca_.Uninitialized<BoolT>(), ca_.Uninitialized<BoolT>(), tmp4, tmp4);
+    }
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp7;
+    TNode<NativeContext> tmp8;
+    TNode<Object> tmp9;
+    TNode<Object> tmp10;
+    TNode<JSReceiver> tmp11;
+    TNode<String> tmp12;
+    TNode<Object> tmp13;
+    TNode<BoolT> tmp14;
+    TNode<BoolT> tmp15;
+    TNode<JSReceiver> tmp16;
+    TNode<JSReceiver> tmp17;
+    ca_.Bind(&block5, &tmp7, &tmp8, &tmp9, &tmp10, &tmp11, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16, &tmp17);
+    ca_.Goto(&block3, tmp7, tmp8, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15, tmp16);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp18;
+    TNode<NativeContext> tmp19;
+    TNode<Object> tmp20;
+    TNode<Object> tmp21;
+    TNode<JSReceiver> tmp22;
+    TNode<String> tmp23;
+    TNode<Object> tmp24;
+    TNode<BoolT> tmp25;
+    TNode<BoolT> tmp26;
+    TNode<JSReceiver> tmp27;
+    TNode<JSReceiver> tmp28;
+    TNode<JSRegExp> tmp29;
+    ca_.Bind(&block4, &tmp18, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27, &tmp28, &tmp29);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 38);
+    TNode<IntPtrT> tmp30 = ca_.IntPtrConstant(JSRegExp::kSourceOffset);
+    USE(tmp30);
+    TNode<PrimitiveHeapObject>tmp31 = CodeStubAssembler(state_).LoadReference<PrimitiveHeapObject>(CodeStubAssembler::Reference{tmp29, tmp30});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 43);
+    TNode<String> tmp32;
+    USE(tmp32);
+    tmp32 = FastFlagsGetter_343(state_, TNode<Context>{tmp18}, TNode<JSRegExp>{tmp29});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 44);
+    TNode<Object> tmp33;
+    USE(tmp33);
+    tmp33 = RegExpBuiltinsAssembler(state_).RegExpCreate(TNode<Context>{tmp18}, TNode<Context>{tmp19}, TNode<Object>{tmp31}, TNode<String>{tmp32});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 45);
+    TNode<JSRegExp> tmp34;
+    USE(tmp34);
+    tmp34 = UnsafeCast8JSRegExp_1430(state_, TNode<Context>{tmp18}, TNode<Object>{tmp33});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 46);
+    ca_.Goto(&block7, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp33, tmp25, tmp26, tmp27, tmp29, tmp31, tmp32, tmp34);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp35;
+    TNode<NativeContext> tmp36;
+    TNode<Object> tmp37;
+    TNode<Object> tmp38;
+    TNode<JSReceiver> tmp39;
+    TNode<String> tmp40;
+    TNode<Object> tmp41;
+    TNode<BoolT> tmp42;
+    TNode<BoolT> tmp43;
+    TNode<JSReceiver> tmp44;
+    TNode<JSRegExp> tmp45;
+    TNode<PrimitiveHeapObject> tmp46;
+    TNode<String> tmp47;
+    TNode<JSRegExp> tmp48;
+    ca_.Bind(&block6, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48);
+    TNode<BoolT> tmp49;
+    USE(tmp49);
+    tmp49 = IsFastRegExpPermissive_340(state_, TNode<Context>{tmp35}, TNode<HeapObject>{tmp48});
+    ca_.Branch(tmp49, &block8, &block9, tmp35, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp42, tmp43, tmp44, tmp45, tmp46, tmp47, tmp48);
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp50;
+    TNode<NativeContext> tmp51;
+    TNode<Object> tmp52;
+    TNode<Object> tmp53;
+    TNode<JSReceiver> tmp54;
+    TNode<String> tmp55;
+    TNode<Object> tmp56;
+    TNode<BoolT> tmp57;
+    TNode<BoolT> tmp58;
+    TNode<JSReceiver> tmp59;
+    TNode<JSRegExp> tmp60;
+    TNode<PrimitiveHeapObject> tmp61;
+    TNode<String> tmp62;
+    TNode<JSRegExp> tmp63;
+    ca_.Bind(&block9, &tmp50, &tmp51, &tmp52, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'IsFastRegExpPermissive(matcherRegExp)' failed", "../../deps/v8/src/builtins/regexp-match-all.tq", 46);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp64;
+    TNode<NativeContext> tmp65;
+    TNode<Object> tmp66;
+    TNode<Object> tmp67;
+    TNode<JSReceiver> tmp68;
+    TNode<String> tmp69;
+    TNode<Object> tmp70;
+    TNode<BoolT> tmp71;
+    TNode<BoolT> tmp72;
+    TNode<JSReceiver> tmp73;
+    TNode<JSRegExp> tmp74;
+    TNode<PrimitiveHeapObject> tmp75;
+    TNode<String> tmp76;
+    TNode<JSRegExp> tmp77;
+    ca_.Bind(&block8, &tmp64, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76, &tmp77);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp78;
+    TNode<NativeContext> tmp79;
+    TNode<Object> tmp80;
+    TNode<Object> tmp81;
+    TNode<JSReceiver> tmp82;
+    TNode<String> tmp83;
+    TNode<Object> tmp84;
+    TNode<BoolT> tmp85;
+    TNode<BoolT> tmp86;
+    TNode<JSReceiver> tmp87;
+    TNode<JSRegExp> tmp88;
+    TNode<PrimitiveHeapObject> tmp89;
+    TNode<String> tmp90;
+    TNode<JSRegExp> tmp91;
+    ca_.Bind(&block7, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 50);
+    TNode<JSRegExp> tmp92;
+    USE(tmp92);
+    tmp92 = UnsafeCast14ATFastJSRegExp_1431(state_, TNode<Context>{tmp78}, TNode<Object>{tmp82});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 51);
+    TNode<Smi> tmp93;
+    USE(tmp93);
+    tmp93 = RegExpBuiltinsAssembler(state_).FastLoadLastIndex(TNode<JSRegExp>{tmp92});
+    RegExpBuiltinsAssembler(state_).FastStoreLastIndex(TNode<JSRegExp>{tmp91}, TNode<Smi>{tmp93});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 55);
+    TNode<BoolT> tmp94;
+    USE(tmp94);
+    tmp94 = RegExpBuiltinsAssembler(state_).FastFlagGetter(TNode<JSRegExp>{tmp91}, JSRegExp::kGlobal);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 59);
+    TNode<BoolT> tmp95;
+    USE(tmp95);
+    tmp95 = RegExpBuiltinsAssembler(state_).FastFlagGetter(TNode<JSRegExp>{tmp91}, JSRegExp::kUnicode);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 37);
+    ca_.Goto(&block2, tmp78, tmp79, tmp80, tmp81, tmp82, tmp83, tmp84, tmp94, tmp95, tmp87);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp96;
+    TNode<NativeContext> tmp97;
+    TNode<Object> tmp98;
+    TNode<Object> tmp99;
+    TNode<JSReceiver> tmp100;
+    TNode<String> tmp101;
+    TNode<Object> tmp102;
+    TNode<BoolT> tmp103;
+    TNode<BoolT> tmp104;
+    TNode<JSReceiver> tmp105;
+    ca_.Bind(&block3, &tmp96, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104, &tmp105);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 61);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 64);
+    TNode<IntPtrT> tmp106;
+    USE(tmp106);
+    tmp106 = FromConstexpr19ATNativeContextSlot29ATconstexpr_NativeContextSlot_173(state_, Context::REGEXP_FUNCTION_INDEX);
+    TNode<Object> tmp107;
+    USE(tmp107);
+    tmp107 = CodeStubAssembler(state_).LoadContextElement(TNode<NativeContext>{tmp97}, TNode<IntPtrT>{tmp106});
+    TNode<JSFunction> tmp108;
+    USE(tmp108);
+    tmp108 = UnsafeCast10JSFunction_1406(state_, TNode<Context>{tmp96}, TNode<Object>{tmp107});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 66);
+    TNode<JSReceiver> tmp109;
+    USE(tmp109);
+    tmp109 = CodeStubAssembler(state_).SpeciesConstructor(TNode<Context>{tmp96}, TNode<Object>{tmp100}, TNode<JSReceiver>{tmp108});
+    TNode<JSReceiver> tmp110;
+    USE(tmp110);
+    tmp110 = UnsafeCast13ATConstructor_1407(state_, TNode<Context>{tmp96}, TNode<Object>{tmp109});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 69);
+    TNode<Object> tmp111;
+    USE(tmp111);
+    tmp111 = FromConstexpr90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol18ATconstexpr_string_172(state_, "flags");
+    TNode<Object> tmp112;
+    USE(tmp112);
+    tmp112 = CodeStubAssembler(state_).GetProperty(TNode<Context>{tmp96}, TNode<Object>{tmp100}, TNode<Object>{tmp111});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 70);
+    TNode<String> tmp113;
+    USE(tmp113);
+    tmp113 = CodeStubAssembler(state_).ToString_Inline(TNode<Context>{tmp96}, TNode<Object>{tmp112});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 73);
+    TNode<JSReceiver> tmp114;
+    USE(tmp114);
+    tmp114 = CodeStubAssembler(state_).Construct(TNode<Context>{tmp96}, TNode<JSReceiver>{tmp110}, TNode<Object>{tmp100}, TNode<Object>{tmp113});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 77);
+    TNode<Object> tmp115;
+    USE(tmp115);
+    tmp115 = RegExpBuiltinsAssembler(state_).SlowLoadLastIndex(TNode<Context>{tmp96}, TNode<Object>{tmp100});
+    TNode<Number> tmp116;
+    USE(tmp116);
+    tmp116 = CodeStubAssembler(state_).ToLength_Inline(TNode<Context>{tmp96}, TNode<Object>{tmp115});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 76);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 80);
+    TNode<JSReceiver> tmp117;
+    USE(tmp117);
+    tmp117 = UnsafeCast10JSReceiver_1418(state_, TNode<Context>{tmp96}, TNode<Object>{tmp114});
+    RegExpBuiltinsAssembler(state_).SlowStoreLastIndex(TNode<Context>{tmp96}, TNode<Object>{tmp117}, TNode<Object>{tmp116});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 84);
+    TNode<String> tmp118;
+    USE(tmp118);
+    tmp118 = CodeStubAssembler(state_).StringConstant("g");
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 86);
+    TNode<Smi> tmp119;
+    USE(tmp119);
+    tmp119 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 0);
+    TNode<Smi> tmp120;
+    tmp120 = TORQUE_CAST(CodeStubAssembler(state_).CallBuiltin(Builtins::kStringIndexOf, tmp96, tmp113, tmp118, tmp119));
+    USE(tmp120);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 85);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 87);
+    TNode<Smi> tmp121;
+    USE(tmp121);
+    tmp121 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, -1);
+    TNode<BoolT> tmp122;
+    USE(tmp122);
+    tmp122 = CodeStubAssembler(state_).SmiNotEqual(TNode<Smi>{tmp120}, TNode<Smi>{tmp121});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 91);
+    TNode<String> tmp123;
+    USE(tmp123);
+    tmp123 = CodeStubAssembler(state_).StringConstant("u");
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 93);
+    TNode<Smi> tmp124;
+    USE(tmp124);
+    tmp124 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 0);
+    TNode<Smi> tmp125;
+    tmp125 = TORQUE_CAST(CodeStubAssembler(state_).CallBuiltin(Builtins::kStringIndexOf, tmp96, tmp113, tmp123, tmp124));
+    USE(tmp125);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 92);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 94);
+    TNode<Smi> tmp126;
+    USE(tmp126);
+    tmp126 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, -1);
+    TNode<BoolT> tmp127;
+    USE(tmp127);
+    tmp127 = CodeStubAssembler(state_).SmiNotEqual(TNode<Smi>{tmp125}, TNode<Smi>{tmp126});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 61);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 37);
+    ca_.Goto(&block2, tmp96, tmp97, tmp98, tmp99, tmp100, tmp101, tmp114, tmp122, tmp127, tmp105);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp128;
+    TNode<NativeContext> tmp129;
+    TNode<Object> tmp130;
+    TNode<Object> tmp131;
+    TNode<JSReceiver> tmp132;
+    TNode<String> tmp133;
+    TNode<Object> tmp134;
+    TNode<BoolT> tmp135;
+    TNode<BoolT> tmp136;
+    TNode<JSReceiver> tmp137;
+    ca_.Bind(&block2, &tmp128, &tmp129, &tmp130, &tmp131, &tmp132, &tmp133, &tmp134, &tmp135, &tmp136, &tmp137);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 36);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 100);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 99);
+    TNode<Object> tmp138;
+    USE(tmp138);
+    tmp138 = RegExpMatchAllAssembler(state_).CreateRegExpStringIterator(TNode<NativeContext>{tmp129}, TNode<Object>{tmp134}, TNode<String>{tmp133}, TNode<BoolT>{tmp135}, TNode<BoolT>{tmp136});
+    ca_.Goto(&block1, tmp128, tmp129, tmp130, tmp131, tmp138);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp139;
+    TNode<NativeContext> tmp140;
+    TNode<Object> tmp141;
+    TNode<Object> tmp142;
+    TNode<Object> tmp143;
+    ca_.Bind(&block1, &tmp139, &tmp140, &tmp141, &tmp142, &tmp143);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 16);
+    ca_.Goto(&block10, tmp139, tmp140, tmp141, tmp142, tmp143);
+  }
+
+    TNode<Context> tmp144;
+    TNode<NativeContext> tmp145;
+    TNode<Object> tmp146;
+    TNode<Object> tmp147;
+    TNode<Object> tmp148;
+    ca_.Bind(&block10, &tmp144, &tmp145, &tmp146, &tmp147, &tmp148);
+  return TNode<Object>{tmp148};
+}
+
+TF_BUILTIN(RegExpPrototypeMatchAll, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = UncheckedCast<Object>(Parameter(Descriptor::kReceiver));
+USE(parameter1);
+  TNode<Object> parameter2 = UncheckedCast<Object>(Parameter(Descriptor::kString));
+  USE(parameter2);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1, parameter2);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    TNode<Object> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 107);
+    TNode<NativeContext> tmp3;
+    USE(tmp3);
+    tmp3 = CodeStubAssembler(state_).LoadNativeContext(TNode<Context>{tmp0});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 108);
+    TNode<Object> tmp4;
+    USE(tmp4);
+    tmp4 = RegExpPrototypeMatchAllImpl_325(state_, TNode<Context>{tmp0}, TNode<NativeContext>{tmp3}, TNode<Object>{tmp1}, TNode<Object>{tmp2});
+    CodeStubAssembler(state_).Return(tmp4);
+  }
+}
+
+TNode<BoolT> HasDoneFlag_326(compiler::CodeAssemblerState* state_, TNode<Smi> p_flags) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Smi> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Smi, BoolT> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Smi, BoolT> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_flags);
+
+  if (block0.is_used()) {
+    TNode<Smi> tmp0;
+    ca_.Bind(&block0, &tmp0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 121);
+    TNode<BoolT> tmp1;
+    USE(tmp1);
+    tmp1 = CodeStubAssembler(state_).IsSetSmi(TNode<Smi>{tmp0}, 1 << JSRegExpStringIterator::kDoneBit);
+    ca_.Goto(&block1, tmp0, tmp1);
+  }
+
+  if (block1.is_used()) {
+    TNode<Smi> tmp2;
+    TNode<BoolT> tmp3;
+    ca_.Bind(&block1, &tmp2, &tmp3);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 120);
+    ca_.Goto(&block2, tmp2, tmp3);
+  }
+
+    TNode<Smi> tmp4;
+    TNode<BoolT> tmp5;
+    ca_.Bind(&block2, &tmp4, &tmp5);
+  return TNode<BoolT>{tmp5};
+}
+
+TNode<BoolT> HasGlobalFlag_327(compiler::CodeAssemblerState* state_, TNode<Smi> p_flags) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Smi> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Smi, BoolT> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Smi, BoolT> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_flags);
+
+  if (block0.is_used()) {
+    TNode<Smi> tmp0;
+    ca_.Bind(&block0, &tmp0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 125);
+    TNode<BoolT> tmp1;
+    USE(tmp1);
+    tmp1 = CodeStubAssembler(state_).IsSetSmi(TNode<Smi>{tmp0}, 1 << JSRegExpStringIterator::kGlobalBit);
+    ca_.Goto(&block1, tmp0, tmp1);
+  }
+
+  if (block1.is_used()) {
+    TNode<Smi> tmp2;
+    TNode<BoolT> tmp3;
+    ca_.Bind(&block1, &tmp2, &tmp3);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 124);
+    ca_.Goto(&block2, tmp2, tmp3);
+  }
+
+    TNode<Smi> tmp4;
+    TNode<BoolT> tmp5;
+    ca_.Bind(&block2, &tmp4, &tmp5);
+  return TNode<BoolT>{tmp5};
+}
+
+TNode<BoolT> HasUnicodeFlag_328(compiler::CodeAssemblerState* state_, TNode<Smi> p_flags) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Smi> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Smi, BoolT> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Smi, BoolT> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_flags);
+
+  if (block0.is_used()) {
+    TNode<Smi> tmp0;
+    ca_.Bind(&block0, &tmp0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 129);
+    TNode<BoolT> tmp1;
+    USE(tmp1);
+    tmp1 = CodeStubAssembler(state_).IsSetSmi(TNode<Smi>{tmp0}, 1 << JSRegExpStringIterator::kUnicodeBit);
+    ca_.Goto(&block1, tmp0, tmp1);
+  }
+
+  if (block1.is_used()) {
+    TNode<Smi> tmp2;
+    TNode<BoolT> tmp3;
+    ca_.Bind(&block1, &tmp2, &tmp3);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 128);
+    ca_.Goto(&block2, tmp2, tmp3);
+  }
+
+    TNode<Smi> tmp4;
+    TNode<BoolT> tmp5;
+    ca_.Bind(&block2, &tmp4, &tmp5);
+  return TNode<BoolT>{tmp5};
+}
+
+void SetDoneFlag_329(compiler::CodeAssemblerState* state_, TNode<JSRegExpStringIterator> p_iterator, TNode<Smi> p_flags) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<JSRegExpStringIterator, Smi> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSRegExpStringIterator, Smi> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSRegExpStringIterator, Smi> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_iterator, p_flags);
+
+  if (block0.is_used()) {
+    TNode<JSRegExpStringIterator> tmp0;
+    TNode<Smi> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 133);
+    TNode<Smi> tmp2;
+    USE(tmp2);
+    tmp2 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 1 << JSRegExpStringIterator::kDoneBit);
+    TNode<Smi> tmp3;
+    USE(tmp3);
+    tmp3 = CodeStubAssembler(state_).SmiOr(TNode<Smi>{tmp1}, TNode<Smi>{tmp2});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 134);
+    TNode<IntPtrT> tmp4 = ca_.IntPtrConstant(JSRegExpStringIterator::kFlagsOffset);
+    USE(tmp4);
+    CodeStubAssembler(state_).StoreReference(CodeStubAssembler::Reference{tmp0, tmp4}, tmp3);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 132);
+    ca_.Goto(&block1, tmp0, tmp1);
+  }
+
+  if (block1.is_used()) {
+    TNode<JSRegExpStringIterator> tmp5;
+    TNode<Smi> tmp6;
+    ca_.Bind(&block1, &tmp5, &tmp6);
+    ca_.Goto(&block2, tmp5, tmp6);
+  }
+
+    TNode<JSRegExpStringIterator> tmp7;
+    TNode<Smi> tmp8;
+    ca_.Bind(&block2, &tmp7, &tmp8);
+}
+
+TF_BUILTIN(RegExpStringIteratorPrototypeNext, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = UncheckedCast<Object>(Parameter(Descriptor::kReceiver));
+USE(parameter1);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, JSRegExpStringIterator> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT, JSRegExp, String> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT, JSRegExp, String, RegExpMatchInfo> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT> block23(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT> block22(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT> block24(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT, JSRegExpResult, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block30(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT, JSRegExpResult, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block31(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT, JSRegExpResult, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block29(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT, JSRegExpResult, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT> block28(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT, JSRegExpResult, FixedArray, FixedArray, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block27(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT, JSRegExpResult, FixedArray, FixedArray, IntPtrT, IntPtrT, HeapObject, IntPtrT> block26(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT, JSRegExpResult, FixedArray, String> block33(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT, JSRegExpResult, FixedArray, String> block36(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT, JSRegExpResult, FixedArray, String> block35(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT, JSRegExpResult, FixedArray, String> block34(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT, JSRegExpResult, FixedArray, String, JSRegExp> block37(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT, JSRegExpResult, FixedArray, String, JSRegExp> block38(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT> block25(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT> block39(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT> block42(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT> block41(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT> block40(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT, Object, String> block43(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT, Object, String> block44(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator, Smi, JSReceiver, String, Object, BoolT> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 151);
+    TNode<JSRegExpStringIterator> tmp2;
+    USE(tmp2);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp2 = Cast22JSRegExpStringIterator_1432(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1}, &label0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp1, tmp2);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block4, tmp0, tmp1, tmp1);
+    }
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    ca_.Bind(&block4, &tmp3, &tmp4, &tmp5);
+    ca_.Goto(&block2, tmp3, tmp4);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp6;
+    TNode<Object> tmp7;
+    TNode<Object> tmp8;
+    TNode<JSRegExpStringIterator> tmp9;
+    ca_.Bind(&block3, &tmp6, &tmp7, &tmp8, &tmp9);
+    ca_.Goto(&block1, tmp6, tmp7, tmp9);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp10;
+    TNode<Object> tmp11;
+    ca_.Bind(&block2, &tmp10, &tmp11);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 152);
+    TNode<Object> tmp12;
+    USE(tmp12);
+    tmp12 = FromConstexpr20UT5ATSmi10HeapObject18ATconstexpr_string_171(state_, "%RegExpStringIterator%.prototype.next");
+    CodeStubAssembler(state_).ThrowTypeError(TNode<Context>{tmp10}, MessageTemplate::kIncompatibleMethodReceiver, TNode<Object>{tmp12}, TNode<Object>{tmp11});
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp13;
+    TNode<Object> tmp14;
+    TNode<JSRegExpStringIterator> tmp15;
+    ca_.Bind(&block1, &tmp13, &tmp14, &tmp15);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 157);
+    TNode<IntPtrT> tmp16 = ca_.IntPtrConstant(JSRegExpStringIterator::kFlagsOffset);
+    USE(tmp16);
+    TNode<Smi>tmp17 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp15, tmp16});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 158);
+    TNode<BoolT> tmp18;
+    USE(tmp18);
+    tmp18 = HasDoneFlag_326(state_, TNode<Smi>{tmp17});
+    ca_.Branch(tmp18, &block7, &block8, tmp13, tmp14, tmp15, tmp17);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp19;
+    TNode<Object> tmp20;
+    TNode<JSRegExpStringIterator> tmp21;
+    TNode<Smi> tmp22;
+    ca_.Bind(&block7, &tmp19, &tmp20, &tmp21, &tmp22);
+    ca_.Goto(&block6, tmp19, tmp20, tmp21);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp23;
+    TNode<Object> tmp24;
+    TNode<JSRegExpStringIterator> tmp25;
+    TNode<Smi> tmp26;
+    ca_.Bind(&block8, &tmp23, &tmp24, &tmp25, &tmp26);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 161);
+    TNode<IntPtrT> tmp27 = ca_.IntPtrConstant(JSRegExpStringIterator::kIteratingRegExpOffset);
+    USE(tmp27);
+    TNode<JSReceiver>tmp28 = CodeStubAssembler(state_).LoadReference<JSReceiver>(CodeStubAssembler::Reference{tmp25, tmp27});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 164);
+    TNode<IntPtrT> tmp29 = ca_.IntPtrConstant(JSRegExpStringIterator::kIteratedStringOffset);
+    USE(tmp29);
+    TNode<String>tmp30 = CodeStubAssembler(state_).LoadReference<String>(CodeStubAssembler::Reference{tmp25, tmp29});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 169);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 170);
+    TNode<BoolT> tmp31;
+    USE(tmp31);
+    tmp31 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, false);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 172);
+    TNode<BoolT> tmp32;
+    USE(tmp32);
+    tmp32 = IsFastRegExpPermissive_340(state_, TNode<Context>{tmp23}, TNode<HeapObject>{tmp28});
+    ca_.Branch(tmp32, &block11, &block12, tmp23, tmp24, tmp25, tmp26, tmp28, tmp30, ca_.Uninitialized<Object>(), tmp31);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp33;
+    TNode<Object> tmp34;
+    TNode<JSRegExpStringIterator> tmp35;
+    TNode<Smi> tmp36;
+    TNode<JSReceiver> tmp37;
+    TNode<String> tmp38;
+    TNode<Object> tmp39;
+    TNode<BoolT> tmp40;
+    ca_.Bind(&block11, &tmp33, &tmp34, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 175);
+    TNode<JSRegExp> tmp41;
+    USE(tmp41);
+    tmp41 = UnsafeCast8JSRegExp_1430(state_, TNode<Context>{tmp33}, TNode<Object>{tmp37});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 174);
+    TNode<RegExpMatchInfo> tmp42;
+    USE(tmp42);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp42 = RegExpBuiltinsAssembler(state_).RegExpPrototypeExecBodyWithoutResultFast(TNode<Context>{tmp33}, TNode<JSRegExp>{tmp41}, TNode<String>{tmp38}, &label0);
+    ca_.Goto(&block14, tmp33, tmp34, tmp35, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp38, tmp42);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block15, tmp33, tmp34, tmp35, tmp36, tmp37, tmp38, tmp39, tmp40, tmp41, tmp38);
+    }
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp43;
+    TNode<Object> tmp44;
+    TNode<JSRegExpStringIterator> tmp45;
+    TNode<Smi> tmp46;
+    TNode<JSReceiver> tmp47;
+    TNode<String> tmp48;
+    TNode<Object> tmp49;
+    TNode<BoolT> tmp50;
+    TNode<JSRegExp> tmp51;
+    TNode<String> tmp52;
+    ca_.Bind(&block15, &tmp43, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52);
+    ca_.Goto(&block10, tmp43, tmp44, tmp45, tmp46, tmp47, tmp48, tmp49, tmp50);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp53;
+    TNode<Object> tmp54;
+    TNode<JSRegExpStringIterator> tmp55;
+    TNode<Smi> tmp56;
+    TNode<JSReceiver> tmp57;
+    TNode<String> tmp58;
+    TNode<Object> tmp59;
+    TNode<BoolT> tmp60;
+    TNode<JSRegExp> tmp61;
+    TNode<String> tmp62;
+    TNode<RegExpMatchInfo> tmp63;
+    ca_.Bind(&block14, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 173);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 178);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 177);
+    TNode<JSRegExpResult> tmp64;
+    USE(tmp64);
+    tmp64 = RegExpBuiltinsAssembler(state_).ConstructNewResultFromMatchInfo(TNode<Context>{tmp53}, TNode<JSReceiver>{tmp57}, TNode<RegExpMatchInfo>{tmp63}, TNode<String>{tmp58});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 179);
+    TNode<BoolT> tmp65;
+    USE(tmp65);
+    tmp65 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, true);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 172);
+    ca_.Goto(&block13, tmp53, tmp54, tmp55, tmp56, tmp57, tmp58, tmp64, tmp65);
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp66;
+    TNode<Object> tmp67;
+    TNode<JSRegExpStringIterator> tmp68;
+    TNode<Smi> tmp69;
+    TNode<JSReceiver> tmp70;
+    TNode<String> tmp71;
+    TNode<Object> tmp72;
+    TNode<BoolT> tmp73;
+    ca_.Bind(&block12, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 181);
+    TNode<Object> tmp74;
+    USE(tmp74);
+    tmp74 = RegExpExec_341(state_, TNode<Context>{tmp66}, TNode<JSReceiver>{tmp70}, TNode<String>{tmp71});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 182);
+    TNode<Oddball> tmp75;
+    USE(tmp75);
+    tmp75 = Null_63(state_);
+    TNode<BoolT> tmp76;
+    USE(tmp76);
+    tmp76 = CodeStubAssembler(state_).TaggedEqual(TNode<Object>{tmp74}, TNode<HeapObject>{tmp75});
+    ca_.Branch(tmp76, &block16, &block17, tmp66, tmp67, tmp68, tmp69, tmp70, tmp71, tmp74, tmp73);
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp77;
+    TNode<Object> tmp78;
+    TNode<JSRegExpStringIterator> tmp79;
+    TNode<Smi> tmp80;
+    TNode<JSReceiver> tmp81;
+    TNode<String> tmp82;
+    TNode<Object> tmp83;
+    TNode<BoolT> tmp84;
+    ca_.Bind(&block16, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 183);
+    ca_.Goto(&block10, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, tmp83, tmp84);
+  }
+
+  if (block17.is_used()) {
+    TNode<Context> tmp85;
+    TNode<Object> tmp86;
+    TNode<JSRegExpStringIterator> tmp87;
+    TNode<Smi> tmp88;
+    TNode<JSReceiver> tmp89;
+    TNode<String> tmp90;
+    TNode<Object> tmp91;
+    TNode<BoolT> tmp92;
+    ca_.Bind(&block17, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 172);
+    ca_.Goto(&block13, tmp85, tmp86, tmp87, tmp88, tmp89, tmp90, tmp91, tmp92);
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp93;
+    TNode<Object> tmp94;
+    TNode<JSRegExpStringIterator> tmp95;
+    TNode<Smi> tmp96;
+    TNode<JSReceiver> tmp97;
+    TNode<String> tmp98;
+    TNode<Object> tmp99;
+    TNode<BoolT> tmp100;
+    ca_.Bind(&block13, &tmp93, &tmp94, &tmp95, &tmp96, &tmp97, &tmp98, &tmp99, &tmp100);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 188);
+    TNode<BoolT> tmp101;
+    USE(tmp101);
+    tmp101 = HasGlobalFlag_327(state_, TNode<Smi>{tmp96});
+    TNode<BoolT> tmp102;
+    USE(tmp102);
+    tmp102 = CodeStubAssembler(state_).Word32BinaryNot(TNode<BoolT>{tmp101});
+    ca_.Branch(tmp102, &block18, &block19, tmp93, tmp94, tmp95, tmp96, tmp97, tmp98, tmp99, tmp100);
+  }
+
+  if (block18.is_used()) {
+    TNode<Context> tmp103;
+    TNode<Object> tmp104;
+    TNode<JSRegExpStringIterator> tmp105;
+    TNode<Smi> tmp106;
+    TNode<JSReceiver> tmp107;
+    TNode<String> tmp108;
+    TNode<Object> tmp109;
+    TNode<BoolT> tmp110;
+    ca_.Bind(&block18, &tmp103, &tmp104, &tmp105, &tmp106, &tmp107, &tmp108, &tmp109, &tmp110);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 190);
+    SetDoneFlag_329(state_, TNode<JSRegExpStringIterator>{tmp105}, TNode<Smi>{tmp106});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 193);
+    TNode<Object> tmp111;
+    USE(tmp111);
+    tmp111 = UnsafeCast90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol_1373(state_, TNode<Context>{tmp103}, TNode<Object>{tmp109});
+    TNode<Oddball> tmp112;
+    USE(tmp112);
+    tmp112 = False_66(state_);
+    TNode<JSObject> tmp113;
+    USE(tmp113);
+    tmp113 = CodeStubAssembler(state_).AllocateJSIteratorResult(TNode<Context>{tmp103}, TNode<Object>{tmp111}, TNode<Oddball>{tmp112});
+    CodeStubAssembler(state_).Return(tmp113);
+  }
+
+  if (block19.is_used()) {
+    TNode<Context> tmp114;
+    TNode<Object> tmp115;
+    TNode<JSRegExpStringIterator> tmp116;
+    TNode<Smi> tmp117;
+    TNode<JSReceiver> tmp118;
+    TNode<String> tmp119;
+    TNode<Object> tmp120;
+    TNode<BoolT> tmp121;
+    ca_.Bind(&block19, &tmp114, &tmp115, &tmp116, &tmp117, &tmp118, &tmp119, &tmp120, &tmp121);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 196);
+    ca_.Goto(&block21, tmp114, tmp115, tmp116, tmp117, tmp118, tmp119, tmp120, tmp121);
+  }
+
+  if (block20.is_used()) {
+    TNode<Context> tmp122;
+    TNode<Object> tmp123;
+    TNode<JSRegExpStringIterator> tmp124;
+    TNode<Smi> tmp125;
+    TNode<JSReceiver> tmp126;
+    TNode<String> tmp127;
+    TNode<Object> tmp128;
+    TNode<BoolT> tmp129;
+    ca_.Bind(&block20, &tmp122, &tmp123, &tmp124, &tmp125, &tmp126, &tmp127, &tmp128, &tmp129);
+    TNode<BoolT> tmp130;
+    USE(tmp130);
+    tmp130 = HasGlobalFlag_327(state_, TNode<Smi>{tmp125});
+    ca_.Branch(tmp130, &block22, &block23, tmp122, tmp123, tmp124, tmp125, tmp126, tmp127, tmp128, tmp129);
+  }
+
+  if (block23.is_used()) {
+    TNode<Context> tmp131;
+    TNode<Object> tmp132;
+    TNode<JSRegExpStringIterator> tmp133;
+    TNode<Smi> tmp134;
+    TNode<JSReceiver> tmp135;
+    TNode<String> tmp136;
+    TNode<Object> tmp137;
+    TNode<BoolT> tmp138;
+    ca_.Bind(&block23, &tmp131, &tmp132, &tmp133, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'HasGlobalFlag(flags)' failed", "../../deps/v8/src/builtins/regexp-match-all.tq", 196);
+  }
+
+  if (block22.is_used()) {
+    TNode<Context> tmp139;
+    TNode<Object> tmp140;
+    TNode<JSRegExpStringIterator> tmp141;
+    TNode<Smi> tmp142;
+    TNode<JSReceiver> tmp143;
+    TNode<String> tmp144;
+    TNode<Object> tmp145;
+    TNode<BoolT> tmp146;
+    ca_.Bind(&block22, &tmp139, &tmp140, &tmp141, &tmp142, &tmp143, &tmp144, &tmp145, &tmp146);
+  }
+
+  if (block21.is_used()) {
+    TNode<Context> tmp147;
+    TNode<Object> tmp148;
+    TNode<JSRegExpStringIterator> tmp149;
+    TNode<Smi> tmp150;
+    TNode<JSReceiver> tmp151;
+    TNode<String> tmp152;
+    TNode<Object> tmp153;
+    TNode<BoolT> tmp154;
+    ca_.Bind(&block21, &tmp147, &tmp148, &tmp149, &tmp150, &tmp151, &tmp152, &tmp153, &tmp154);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 197);
+    ca_.Branch(tmp154, &block24, &block25, tmp147, tmp148, tmp149, tmp150, tmp151, tmp152, tmp153, tmp154);
+  }
+
+  if (block24.is_used()) {
+    TNode<Context> tmp155;
+    TNode<Object> tmp156;
+    TNode<JSRegExpStringIterator> tmp157;
+    TNode<Smi> tmp158;
+    TNode<JSReceiver> tmp159;
+    TNode<String> tmp160;
+    TNode<Object> tmp161;
+    TNode<BoolT> tmp162;
+    ca_.Bind(&block24, &tmp155, &tmp156, &tmp157, &tmp158, &tmp159, &tmp160, &tmp161, &tmp162);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 199);
+    TNode<JSRegExpResult> tmp163;
+    USE(tmp163);
+    tmp163 = UnsafeCast20ATFastJSRegExpResult_1433(state_, TNode<Context>{tmp155}, TNode<Object>{tmp161});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 200);
+    TNode<IntPtrT> tmp164 = ca_.IntPtrConstant(JSObject::kElementsOffset);
+    USE(tmp164);
+    TNode<FixedArrayBase>tmp165 = CodeStubAssembler(state_).LoadReference<FixedArrayBase>(CodeStubAssembler::Reference{tmp163, tmp164});
+    TNode<FixedArray> tmp166;
+    USE(tmp166);
+    tmp166 = UnsafeCast10FixedArray_1370(state_, TNode<Context>{tmp155}, TNode<Object>{tmp165});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 201);
+    TNode<IntPtrT> tmp167 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp167);
+    TNode<IntPtrT> tmp168 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp168);
+    TNode<Smi>tmp169 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp166, tmp168});
+    TNode<IntPtrT> tmp170;
+    USE(tmp170);
+    tmp170 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp169});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 50);
+    TNode<IntPtrT> tmp171;
+    USE(tmp171);
+    tmp171 = Convert8ATintptr17ATconstexpr_int31_1376(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 51);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp172;
+    USE(tmp172);
+    tmp172 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp171});
+    TNode<UintPtrT> tmp173;
+    USE(tmp173);
+    tmp173 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp170});
+    TNode<BoolT> tmp174;
+    USE(tmp174);
+    tmp174 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp172}, TNode<UintPtrT>{tmp173});
+    ca_.Branch(tmp174, &block30, &block31, tmp155, tmp156, tmp157, tmp158, tmp159, tmp160, tmp161, tmp162, tmp163, tmp166, tmp166, tmp167, tmp170, tmp171, tmp166, tmp167, tmp170, tmp171, tmp171);
+  }
+
+  if (block30.is_used()) {
+    TNode<Context> tmp175;
+    TNode<Object> tmp176;
+    TNode<JSRegExpStringIterator> tmp177;
+    TNode<Smi> tmp178;
+    TNode<JSReceiver> tmp179;
+    TNode<String> tmp180;
+    TNode<Object> tmp181;
+    TNode<BoolT> tmp182;
+    TNode<JSRegExpResult> tmp183;
+    TNode<FixedArray> tmp184;
+    TNode<FixedArray> tmp185;
+    TNode<IntPtrT> tmp186;
+    TNode<IntPtrT> tmp187;
+    TNode<IntPtrT> tmp188;
+    TNode<HeapObject> tmp189;
+    TNode<IntPtrT> tmp190;
+    TNode<IntPtrT> tmp191;
+    TNode<IntPtrT> tmp192;
+    TNode<IntPtrT> tmp193;
+    ca_.Bind(&block30, &tmp175, &tmp176, &tmp177, &tmp178, &tmp179, &tmp180, &tmp181, &tmp182, &tmp183, &tmp184, &tmp185, &tmp186, &tmp187, &tmp188, &tmp189, &tmp190, &tmp191, &tmp192, &tmp193);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp194;
+    USE(tmp194);
+    tmp194 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp195;
+    USE(tmp195);
+    tmp195 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp193}, TNode<IntPtrT>{tmp194});
+    TNode<IntPtrT> tmp196;
+    USE(tmp196);
+    tmp196 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp190}, TNode<IntPtrT>{tmp195});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp197;
+    USE(tmp197);
+    TNode<IntPtrT> tmp198;
+    USE(tmp198);
+    std::tie(tmp197, tmp198) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp189}, TNode<IntPtrT>{tmp196}).Flatten();
+    ca_.Goto(&block29, tmp175, tmp176, tmp177, tmp178, tmp179, tmp180, tmp181, tmp182, tmp183, tmp184, tmp185, tmp186, tmp187, tmp188, tmp189, tmp190, tmp191, tmp192, tmp193, tmp197, tmp198);
+  }
+
+  if (block31.is_used()) {
+    TNode<Context> tmp199;
+    TNode<Object> tmp200;
+    TNode<JSRegExpStringIterator> tmp201;
+    TNode<Smi> tmp202;
+    TNode<JSReceiver> tmp203;
+    TNode<String> tmp204;
+    TNode<Object> tmp205;
+    TNode<BoolT> tmp206;
+    TNode<JSRegExpResult> tmp207;
+    TNode<FixedArray> tmp208;
+    TNode<FixedArray> tmp209;
+    TNode<IntPtrT> tmp210;
+    TNode<IntPtrT> tmp211;
+    TNode<IntPtrT> tmp212;
+    TNode<HeapObject> tmp213;
+    TNode<IntPtrT> tmp214;
+    TNode<IntPtrT> tmp215;
+    TNode<IntPtrT> tmp216;
+    TNode<IntPtrT> tmp217;
+    ca_.Bind(&block31, &tmp199, &tmp200, &tmp201, &tmp202, &tmp203, &tmp204, &tmp205, &tmp206, &tmp207, &tmp208, &tmp209, &tmp210, &tmp211, &tmp212, &tmp213, &tmp214, &tmp215, &tmp216, &tmp217);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block28, tmp199, tmp200, tmp201, tmp202, tmp203, tmp204, tmp205, tmp206, tmp207, tmp208, tmp209, tmp210, tmp211, tmp212);
+  }
+
+  if (block29.is_used()) {
+    TNode<Context> tmp218;
+    TNode<Object> tmp219;
+    TNode<JSRegExpStringIterator> tmp220;
+    TNode<Smi> tmp221;
+    TNode<JSReceiver> tmp222;
+    TNode<String> tmp223;
+    TNode<Object> tmp224;
+    TNode<BoolT> tmp225;
+    TNode<JSRegExpResult> tmp226;
+    TNode<FixedArray> tmp227;
+    TNode<FixedArray> tmp228;
+    TNode<IntPtrT> tmp229;
+    TNode<IntPtrT> tmp230;
+    TNode<IntPtrT> tmp231;
+    TNode<HeapObject> tmp232;
+    TNode<IntPtrT> tmp233;
+    TNode<IntPtrT> tmp234;
+    TNode<IntPtrT> tmp235;
+    TNode<IntPtrT> tmp236;
+    TNode<HeapObject> tmp237;
+    TNode<IntPtrT> tmp238;
+    ca_.Bind(&block29, &tmp218, &tmp219, &tmp220, &tmp221, &tmp222, &tmp223, &tmp224, &tmp225, &tmp226, &tmp227, &tmp228, &tmp229, &tmp230, &tmp231, &tmp232, &tmp233, &tmp234, &tmp235, &tmp236, &tmp237, &tmp238);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 51);
+    ca_.Goto(&block27, tmp218, tmp219, tmp220, tmp221, tmp222, tmp223, tmp224, tmp225, tmp226, tmp227, tmp228, tmp229, tmp230, tmp231, tmp237, tmp238);
+  }
+
+  if (block28.is_used()) {
+    TNode<Context> tmp239;
+    TNode<Object> tmp240;
+    TNode<JSRegExpStringIterator> tmp241;
+    TNode<Smi> tmp242;
+    TNode<JSReceiver> tmp243;
+    TNode<String> tmp244;
+    TNode<Object> tmp245;
+    TNode<BoolT> tmp246;
+    TNode<JSRegExpResult> tmp247;
+    TNode<FixedArray> tmp248;
+    TNode<FixedArray> tmp249;
+    TNode<IntPtrT> tmp250;
+    TNode<IntPtrT> tmp251;
+    TNode<IntPtrT> tmp252;
+    ca_.Bind(&block28, &tmp239, &tmp240, &tmp241, &tmp242, &tmp243, &tmp244, &tmp245, &tmp246, &tmp247, &tmp248, &tmp249, &tmp250, &tmp251, &tmp252);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block27.is_used()) {
+    TNode<Context> tmp253;
+    TNode<Object> tmp254;
+    TNode<JSRegExpStringIterator> tmp255;
+    TNode<Smi> tmp256;
+    TNode<JSReceiver> tmp257;
+    TNode<String> tmp258;
+    TNode<Object> tmp259;
+    TNode<BoolT> tmp260;
+    TNode<JSRegExpResult> tmp261;
+    TNode<FixedArray> tmp262;
+    TNode<FixedArray> tmp263;
+    TNode<IntPtrT> tmp264;
+    TNode<IntPtrT> tmp265;
+    TNode<IntPtrT> tmp266;
+    TNode<HeapObject> tmp267;
+    TNode<IntPtrT> tmp268;
+    ca_.Bind(&block27, &tmp253, &tmp254, &tmp255, &tmp256, &tmp257, &tmp258, &tmp259, &tmp260, &tmp261, &tmp262, &tmp263, &tmp264, &tmp265, &tmp266, &tmp267, &tmp268);
+    ca_.Goto(&block26, tmp253, tmp254, tmp255, tmp256, tmp257, tmp258, tmp259, tmp260, tmp261, tmp262, tmp263, tmp264, tmp265, tmp267, tmp268);
+  }
+
+  if (block26.is_used()) {
+    TNode<Context> tmp269;
+    TNode<Object> tmp270;
+    TNode<JSRegExpStringIterator> tmp271;
+    TNode<Smi> tmp272;
+    TNode<JSReceiver> tmp273;
+    TNode<String> tmp274;
+    TNode<Object> tmp275;
+    TNode<BoolT> tmp276;
+    TNode<JSRegExpResult> tmp277;
+    TNode<FixedArray> tmp278;
+    TNode<FixedArray> tmp279;
+    TNode<IntPtrT> tmp280;
+    TNode<IntPtrT> tmp281;
+    TNode<HeapObject> tmp282;
+    TNode<IntPtrT> tmp283;
+    ca_.Bind(&block26, &tmp269, &tmp270, &tmp271, &tmp272, &tmp273, &tmp274, &tmp275, &tmp276, &tmp277, &tmp278, &tmp279, &tmp280, &tmp281, &tmp282, &tmp283);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 201);
+    TNode<Object>tmp284 = CodeStubAssembler(state_).LoadReference<Object>(CodeStubAssembler::Reference{tmp282, tmp283});
+    TNode<String> tmp285;
+    USE(tmp285);
+    tmp285 = UnsafeCast6String_1434(state_, TNode<Context>{tmp269}, TNode<Object>{tmp284});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 205);
+    ca_.Goto(&block34, tmp269, tmp270, tmp271, tmp272, tmp273, tmp274, tmp275, tmp276, tmp277, tmp278, tmp285);
+  }
+
+  if (block33.is_used()) {
+    TNode<Context> tmp286;
+    TNode<Object> tmp287;
+    TNode<JSRegExpStringIterator> tmp288;
+    TNode<Smi> tmp289;
+    TNode<JSReceiver> tmp290;
+    TNode<String> tmp291;
+    TNode<Object> tmp292;
+    TNode<BoolT> tmp293;
+    TNode<JSRegExpResult> tmp294;
+    TNode<FixedArray> tmp295;
+    TNode<String> tmp296;
+    ca_.Bind(&block33, &tmp286, &tmp287, &tmp288, &tmp289, &tmp290, &tmp291, &tmp292, &tmp293, &tmp294, &tmp295, &tmp296);
+    TNode<BoolT> tmp297;
+    USE(tmp297);
+    tmp297 = IsFastRegExpPermissive_340(state_, TNode<Context>{tmp286}, TNode<HeapObject>{tmp290});
+    ca_.Branch(tmp297, &block35, &block36, tmp286, tmp287, tmp288, tmp289, tmp290, tmp291, tmp292, tmp293, tmp294, tmp295, tmp296);
+  }
+
+  if (block36.is_used()) {
+    TNode<Context> tmp298;
+    TNode<Object> tmp299;
+    TNode<JSRegExpStringIterator> tmp300;
+    TNode<Smi> tmp301;
+    TNode<JSReceiver> tmp302;
+    TNode<String> tmp303;
+    TNode<Object> tmp304;
+    TNode<BoolT> tmp305;
+    TNode<JSRegExpResult> tmp306;
+    TNode<FixedArray> tmp307;
+    TNode<String> tmp308;
+    ca_.Bind(&block36, &tmp298, &tmp299, &tmp300, &tmp301, &tmp302, &tmp303, &tmp304, &tmp305, &tmp306, &tmp307, &tmp308);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'IsFastRegExpPermissive(iteratingRegExp)' failed", "../../deps/v8/src/builtins/regexp-match-all.tq", 205);
+  }
+
+  if (block35.is_used()) {
+    TNode<Context> tmp309;
+    TNode<Object> tmp310;
+    TNode<JSRegExpStringIterator> tmp311;
+    TNode<Smi> tmp312;
+    TNode<JSReceiver> tmp313;
+    TNode<String> tmp314;
+    TNode<Object> tmp315;
+    TNode<BoolT> tmp316;
+    TNode<JSRegExpResult> tmp317;
+    TNode<FixedArray> tmp318;
+    TNode<String> tmp319;
+    ca_.Bind(&block35, &tmp309, &tmp310, &tmp311, &tmp312, &tmp313, &tmp314, &tmp315, &tmp316, &tmp317, &tmp318, &tmp319);
+  }
+
+  if (block34.is_used()) {
+    TNode<Context> tmp320;
+    TNode<Object> tmp321;
+    TNode<JSRegExpStringIterator> tmp322;
+    TNode<Smi> tmp323;
+    TNode<JSReceiver> tmp324;
+    TNode<String> tmp325;
+    TNode<Object> tmp326;
+    TNode<BoolT> tmp327;
+    TNode<JSRegExpResult> tmp328;
+    TNode<FixedArray> tmp329;
+    TNode<String> tmp330;
+    ca_.Bind(&block34, &tmp320, &tmp321, &tmp322, &tmp323, &tmp324, &tmp325, &tmp326, &tmp327, &tmp328, &tmp329, &tmp330);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 206);
+    TNode<JSRegExp> tmp331;
+    USE(tmp331);
+    tmp331 = UnsafeCast8JSRegExp_1430(state_, TNode<Context>{tmp320}, TNode<Object>{tmp324});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 207);
+    TNode<String> tmp332;
+    USE(tmp332);
+    tmp332 = kEmptyString_67(state_);
+    TNode<BoolT> tmp333;
+    USE(tmp333);
+    tmp333 = CodeStubAssembler(state_).TaggedEqual(TNode<Object>{tmp330}, TNode<HeapObject>{tmp332});
+    ca_.Branch(tmp333, &block37, &block38, tmp320, tmp321, tmp322, tmp323, tmp324, tmp325, tmp326, tmp327, tmp328, tmp329, tmp330, tmp331);
+  }
+
+  if (block37.is_used()) {
+    TNode<Context> tmp334;
+    TNode<Object> tmp335;
+    TNode<JSRegExpStringIterator> tmp336;
+    TNode<Smi> tmp337;
+    TNode<JSReceiver> tmp338;
+    TNode<String> tmp339;
+    TNode<Object> tmp340;
+    TNode<BoolT> tmp341;
+    TNode<JSRegExpResult> tmp342;
+    TNode<FixedArray> tmp343;
+    TNode<String> tmp344;
+    TNode<JSRegExp> tmp345;
+    ca_.Bind(&block37, &tmp334, &tmp335, &tmp336, &tmp337, &tmp338, &tmp339, &tmp340, &tmp341, &tmp342, &tmp343, &tmp344, &tmp345);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 209);
+    TNode<Smi> tmp346;
+    USE(tmp346);
+    tmp346 = RegExpBuiltinsAssembler(state_).FastLoadLastIndex(TNode<JSRegExp>{tmp345});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 214);
+    TNode<BoolT> tmp347;
+    USE(tmp347);
+    tmp347 = HasUnicodeFlag_328(state_, TNode<Smi>{tmp337});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 213);
+    TNode<Smi> tmp348;
+    USE(tmp348);
+    tmp348 = RegExpBuiltinsAssembler(state_).AdvanceStringIndexFast(TNode<String>{tmp339}, TNode<Smi>{tmp346}, TNode<BoolT>{tmp347});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 217);
+    RegExpBuiltinsAssembler(state_).FastStoreLastIndex(TNode<JSRegExp>{tmp345}, TNode<Smi>{tmp348});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 207);
+    ca_.Goto(&block38, tmp334, tmp335, tmp336, tmp337, tmp338, tmp339, tmp340, tmp341, tmp342, tmp343, tmp344, tmp345);
+  }
+
+  if (block38.is_used()) {
+    TNode<Context> tmp349;
+    TNode<Object> tmp350;
+    TNode<JSRegExpStringIterator> tmp351;
+    TNode<Smi> tmp352;
+    TNode<JSReceiver> tmp353;
+    TNode<String> tmp354;
+    TNode<Object> tmp355;
+    TNode<BoolT> tmp356;
+    TNode<JSRegExpResult> tmp357;
+    TNode<FixedArray> tmp358;
+    TNode<String> tmp359;
+    TNode<JSRegExp> tmp360;
+    ca_.Bind(&block38, &tmp349, &tmp350, &tmp351, &tmp352, &tmp353, &tmp354, &tmp355, &tmp356, &tmp357, &tmp358, &tmp359, &tmp360);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 221);
+    TNode<Oddball> tmp361;
+    USE(tmp361);
+    tmp361 = False_66(state_);
+    TNode<JSObject> tmp362;
+    USE(tmp362);
+    tmp362 = CodeStubAssembler(state_).AllocateJSIteratorResult(TNode<Context>{tmp349}, TNode<Object>{tmp357}, TNode<Oddball>{tmp361});
+    CodeStubAssembler(state_).Return(tmp362);
+  }
+
+  if (block25.is_used()) {
+    TNode<Context> tmp363;
+    TNode<Object> tmp364;
+    TNode<JSRegExpStringIterator> tmp365;
+    TNode<Smi> tmp366;
+    TNode<JSReceiver> tmp367;
+    TNode<String> tmp368;
+    TNode<Object> tmp369;
+    TNode<BoolT> tmp370;
+    ca_.Bind(&block25, &tmp363, &tmp364, &tmp365, &tmp366, &tmp367, &tmp368, &tmp369, &tmp370);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 223);
+    ca_.Goto(&block40, tmp363, tmp364, tmp365, tmp366, tmp367, tmp368, tmp369, tmp370);
+  }
+
+  if (block39.is_used()) {
+    TNode<Context> tmp371;
+    TNode<Object> tmp372;
+    TNode<JSRegExpStringIterator> tmp373;
+    TNode<Smi> tmp374;
+    TNode<JSReceiver> tmp375;
+    TNode<String> tmp376;
+    TNode<Object> tmp377;
+    TNode<BoolT> tmp378;
+    ca_.Bind(&block39, &tmp371, &tmp372, &tmp373, &tmp374, &tmp375, &tmp376, &tmp377, &tmp378);
+    TNode<BoolT> tmp379;
+    USE(tmp379);
+    tmp379 = CodeStubAssembler(state_).Word32BinaryNot(TNode<BoolT>{tmp378});
+    ca_.Branch(tmp379, &block41, &block42, tmp371, tmp372, tmp373, tmp374, tmp375, tmp376, tmp377, tmp378);
+  }
+
+  if (block42.is_used()) {
+    TNode<Context> tmp380;
+    TNode<Object> tmp381;
+    TNode<JSRegExpStringIterator> tmp382;
+    TNode<Smi> tmp383;
+    TNode<JSReceiver> tmp384;
+    TNode<String> tmp385;
+    TNode<Object> tmp386;
+    TNode<BoolT> tmp387;
+    ca_.Bind(&block42, &tmp380, &tmp381, &tmp382, &tmp383, &tmp384, &tmp385, &tmp386, &tmp387);
+    CodeStubAssembler(state_).FailAssert("Torque assert '!isFastRegExp' failed", "../../deps/v8/src/builtins/regexp-match-all.tq", 223);
+  }
+
+  if (block41.is_used()) {
+    TNode<Context> tmp388;
+    TNode<Object> tmp389;
+    TNode<JSRegExpStringIterator> tmp390;
+    TNode<Smi> tmp391;
+    TNode<JSReceiver> tmp392;
+    TNode<String> tmp393;
+    TNode<Object> tmp394;
+    TNode<BoolT> tmp395;
+    ca_.Bind(&block41, &tmp388, &tmp389, &tmp390, &tmp391, &tmp392, &tmp393, &tmp394, &tmp395);
+  }
+
+  if (block40.is_used()) {
+    TNode<Context> tmp396;
+    TNode<Object> tmp397;
+    TNode<JSRegExpStringIterator> tmp398;
+    TNode<Smi> tmp399;
+    TNode<JSReceiver> tmp400;
+    TNode<String> tmp401;
+    TNode<Object> tmp402;
+    TNode<BoolT> tmp403;
+    ca_.Bind(&block40, &tmp396, &tmp397, &tmp398, &tmp399, &tmp400, &tmp401, &tmp402, &tmp403);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 225);
+    TNode<Object> tmp404;
+    USE(tmp404);
+    tmp404 = UnsafeCast90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol_1373(state_, TNode<Context>{tmp396}, TNode<Object>{tmp402});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 227);
+    TNode<Smi> tmp405;
+    USE(tmp405);
+    tmp405 = CodeStubAssembler(state_).SmiConstant(0);
+    TNode<Object> tmp406;
+    USE(tmp406);
+    tmp406 = CodeStubAssembler(state_).GetProperty(TNode<Context>{tmp396}, TNode<Object>{tmp404}, TNode<Object>{tmp405});
+    TNode<String> tmp407;
+    USE(tmp407);
+    tmp407 = CodeStubAssembler(state_).ToString_Inline(TNode<Context>{tmp396}, TNode<Object>{tmp406});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 229);
+    TNode<String> tmp408;
+    USE(tmp408);
+    tmp408 = kEmptyString_67(state_);
+    TNode<BoolT> tmp409;
+    USE(tmp409);
+    tmp409 = CodeStubAssembler(state_).TaggedEqual(TNode<Object>{tmp407}, TNode<HeapObject>{tmp408});
+    ca_.Branch(tmp409, &block43, &block44, tmp396, tmp397, tmp398, tmp399, tmp400, tmp401, tmp402, tmp403, tmp404, tmp407);
+  }
+
+  if (block43.is_used()) {
+    TNode<Context> tmp410;
+    TNode<Object> tmp411;
+    TNode<JSRegExpStringIterator> tmp412;
+    TNode<Smi> tmp413;
+    TNode<JSReceiver> tmp414;
+    TNode<String> tmp415;
+    TNode<Object> tmp416;
+    TNode<BoolT> tmp417;
+    TNode<Object> tmp418;
+    TNode<String> tmp419;
+    ca_.Bind(&block43, &tmp410, &tmp411, &tmp412, &tmp413, &tmp414, &tmp415, &tmp416, &tmp417, &tmp418, &tmp419);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 231);
+    TNode<Object> tmp420;
+    USE(tmp420);
+    tmp420 = RegExpBuiltinsAssembler(state_).SlowLoadLastIndex(TNode<Context>{tmp410}, TNode<Object>{tmp414});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 232);
+    TNode<Number> tmp421;
+    USE(tmp421);
+    tmp421 = CodeStubAssembler(state_).ToLength_Inline(TNode<Context>{tmp410}, TNode<Object>{tmp420});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 237);
+    TNode<BoolT> tmp422;
+    USE(tmp422);
+    tmp422 = HasUnicodeFlag_328(state_, TNode<Smi>{tmp413});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 236);
+    TNode<Smi> tmp423;
+    USE(tmp423);
+    tmp423 = RegExpBuiltinsAssembler(state_).AdvanceStringIndexSlow(TNode<String>{tmp415}, TNode<Number>{tmp421}, TNode<BoolT>{tmp422});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 240);
+    RegExpBuiltinsAssembler(state_).SlowStoreLastIndex(TNode<Context>{tmp410}, TNode<Object>{tmp414}, TNode<Object>{tmp423});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 229);
+    ca_.Goto(&block44, tmp410, tmp411, tmp412, tmp413, tmp414, tmp415, tmp416, tmp417, tmp418, tmp419);
+  }
+
+  if (block44.is_used()) {
+    TNode<Context> tmp424;
+    TNode<Object> tmp425;
+    TNode<JSRegExpStringIterator> tmp426;
+    TNode<Smi> tmp427;
+    TNode<JSReceiver> tmp428;
+    TNode<String> tmp429;
+    TNode<Object> tmp430;
+    TNode<BoolT> tmp431;
+    TNode<Object> tmp432;
+    TNode<String> tmp433;
+    ca_.Bind(&block44, &tmp424, &tmp425, &tmp426, &tmp427, &tmp428, &tmp429, &tmp430, &tmp431, &tmp432, &tmp433);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 243);
+    TNode<Oddball> tmp434;
+    USE(tmp434);
+    tmp434 = False_66(state_);
+    TNode<JSObject> tmp435;
+    USE(tmp435);
+    tmp435 = CodeStubAssembler(state_).AllocateJSIteratorResult(TNode<Context>{tmp424}, TNode<Object>{tmp432}, TNode<Oddball>{tmp434});
+    CodeStubAssembler(state_).Return(tmp435);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp436;
+    TNode<Object> tmp437;
+    TNode<JSRegExpStringIterator> tmp438;
+    TNode<Smi> tmp439;
+    TNode<JSReceiver> tmp440;
+    TNode<String> tmp441;
+    TNode<Object> tmp442;
+    TNode<BoolT> tmp443;
+    ca_.Bind(&block10, &tmp436, &tmp437, &tmp438, &tmp439, &tmp440, &tmp441, &tmp442, &tmp443);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 248);
+    SetDoneFlag_329(state_, TNode<JSRegExpStringIterator>{tmp438}, TNode<Smi>{tmp439});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 251);
+    ca_.Goto(&block6, tmp436, tmp437, tmp438);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp444;
+    TNode<Object> tmp445;
+    TNode<JSRegExpStringIterator> tmp446;
+    ca_.Bind(&block6, &tmp444, &tmp445, &tmp446);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 255);
+    TNode<Oddball> tmp447;
+    USE(tmp447);
+    tmp447 = Undefined_64(state_);
+    TNode<Oddball> tmp448;
+    USE(tmp448);
+    tmp448 = True_65(state_);
+    TNode<JSObject> tmp449;
+    USE(tmp449);
+    tmp449 = CodeStubAssembler(state_).AllocateJSIteratorResult(TNode<Context>{tmp444}, TNode<Object>{tmp447}, TNode<Oddball>{tmp448});
+    CodeStubAssembler(state_).Return(tmp449);
+  }
+}
+
+TNode<JSRegExp> UnsafeCast8JSRegExp_1430(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block5(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExp> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExp> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3001);
+    ca_.Goto(&block3, tmp0, tmp1);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp2;
+    TNode<Object> tmp3;
+    ca_.Bind(&block2, &tmp2, &tmp3);
+    TNode<BoolT> tmp4;
+    USE(tmp4);
+    tmp4 = Is8JSRegExp20UT5ATSmi10HeapObject_1488(state_, TNode<Context>{tmp2}, TNode<Object>{tmp3});
+    ca_.Branch(tmp4, &block4, &block5, tmp2, tmp3);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp5;
+    TNode<Object> tmp6;
+    ca_.Bind(&block5, &tmp5, &tmp6);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'Is<A>(o)' failed", "../../deps/v8/src/builtins/base.tq", 3001);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp7;
+    TNode<Object> tmp8;
+    ca_.Bind(&block4, &tmp7, &tmp8);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp9;
+    TNode<Object> tmp10;
+    ca_.Bind(&block3, &tmp9, &tmp10);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3002);
+    TNode<JSRegExp> tmp11;
+    USE(tmp11);
+    tmp11 = TORQUE_CAST(TNode<Object>{tmp10});
+    ca_.Goto(&block1, tmp9, tmp10, tmp11);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp12;
+    TNode<Object> tmp13;
+    TNode<JSRegExp> tmp14;
+    ca_.Bind(&block1, &tmp12, &tmp13, &tmp14);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 45);
+    ca_.Goto(&block6, tmp12, tmp13, tmp14);
+  }
+
+    TNode<Context> tmp15;
+    TNode<Object> tmp16;
+    TNode<JSRegExp> tmp17;
+    ca_.Bind(&block6, &tmp15, &tmp16, &tmp17);
+  return TNode<JSRegExp>{tmp17};
+}
+
+TNode<JSRegExp> UnsafeCast14ATFastJSRegExp_1431(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block5(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExp> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExp> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3001);
+    ca_.Goto(&block3, tmp0, tmp1);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp2;
+    TNode<Object> tmp3;
+    ca_.Bind(&block2, &tmp2, &tmp3);
+    TNode<BoolT> tmp4;
+    USE(tmp4);
+    tmp4 = Is14ATFastJSRegExp20UT5ATSmi10HeapObject_1489(state_, TNode<Context>{tmp2}, TNode<Object>{tmp3});
+    ca_.Branch(tmp4, &block4, &block5, tmp2, tmp3);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp5;
+    TNode<Object> tmp6;
+    ca_.Bind(&block5, &tmp5, &tmp6);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'Is<A>(o)' failed", "../../deps/v8/src/builtins/base.tq", 3001);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp7;
+    TNode<Object> tmp8;
+    ca_.Bind(&block4, &tmp7, &tmp8);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp9;
+    TNode<Object> tmp10;
+    ca_.Bind(&block3, &tmp9, &tmp10);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3002);
+    TNode<JSRegExp> tmp11;
+    USE(tmp11);
+    tmp11 = TORQUE_CAST(TNode<Object>{tmp10});
+    ca_.Goto(&block1, tmp9, tmp10, tmp11);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp12;
+    TNode<Object> tmp13;
+    TNode<JSRegExp> tmp14;
+    ca_.Bind(&block1, &tmp12, &tmp13, &tmp14);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 50);
+    ca_.Goto(&block6, tmp12, tmp13, tmp14);
+  }
+
+    TNode<Context> tmp15;
+    TNode<Object> tmp16;
+    TNode<JSRegExp> tmp17;
+    ca_.Bind(&block6, &tmp15, &tmp16, &tmp17);
+  return TNode<JSRegExp>{tmp17};
+}
+
+TNode<JSRegExpStringIterator> Cast22JSRegExpStringIterator_1432(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o, compiler::CodeAssemblerLabel* label_CastError) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, HeapObject> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, HeapObject> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, HeapObject, JSRegExpStringIterator> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpStringIterator> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 2215);
+    TNode<HeapObject> tmp2;
+    USE(tmp2);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp2 = CodeStubAssembler(state_).TaggedToHeapObject(TNode<Object>{tmp1}, &label0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp1, tmp2);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block4, tmp0, tmp1, tmp1);
+    }
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    ca_.Bind(&block4, &tmp3, &tmp4, &tmp5);
+    ca_.Goto(&block1);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp6;
+    TNode<Object> tmp7;
+    TNode<Object> tmp8;
+    TNode<HeapObject> tmp9;
+    ca_.Bind(&block3, &tmp6, &tmp7, &tmp8, &tmp9);
+    TNode<JSRegExpStringIterator> tmp10;
+    USE(tmp10);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp10 = Cast22JSRegExpStringIterator_109(state_, TNode<HeapObject>{tmp9}, &label0);
+    ca_.Goto(&block5, tmp6, tmp7, tmp9, tmp10);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block6, tmp6, tmp7, tmp9);
+    }
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp11;
+    TNode<Object> tmp12;
+    TNode<HeapObject> tmp13;
+    ca_.Bind(&block6, &tmp11, &tmp12, &tmp13);
+    ca_.Goto(&block1);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp14;
+    TNode<Object> tmp15;
+    TNode<HeapObject> tmp16;
+    TNode<JSRegExpStringIterator> tmp17;
+    ca_.Bind(&block5, &tmp14, &tmp15, &tmp16, &tmp17);
+    ca_.Goto(&block2, tmp14, tmp15, tmp17);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp18;
+    TNode<Object> tmp19;
+    TNode<JSRegExpStringIterator> tmp20;
+    ca_.Bind(&block2, &tmp18, &tmp19, &tmp20);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 151);
+    ca_.Goto(&block7, tmp18, tmp19, tmp20);
+  }
+
+  if (block1.is_used()) {
+    ca_.Bind(&block1);
+    ca_.Goto(label_CastError);
+  }
+
+    TNode<Context> tmp21;
+    TNode<Object> tmp22;
+    TNode<JSRegExpStringIterator> tmp23;
+    ca_.Bind(&block7, &tmp21, &tmp22, &tmp23);
+  return TNode<JSRegExpStringIterator>{tmp23};
+}
+
+TNode<JSRegExpResult> UnsafeCast20ATFastJSRegExpResult_1433(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block5(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpResult> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExpResult> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3001);
+    ca_.Goto(&block3, tmp0, tmp1);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp2;
+    TNode<Object> tmp3;
+    ca_.Bind(&block2, &tmp2, &tmp3);
+    TNode<BoolT> tmp4;
+    USE(tmp4);
+    tmp4 = Is20ATFastJSRegExpResult20UT5ATSmi10HeapObject_1490(state_, TNode<Context>{tmp2}, TNode<Object>{tmp3});
+    ca_.Branch(tmp4, &block4, &block5, tmp2, tmp3);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp5;
+    TNode<Object> tmp6;
+    ca_.Bind(&block5, &tmp5, &tmp6);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'Is<A>(o)' failed", "../../deps/v8/src/builtins/base.tq", 3001);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp7;
+    TNode<Object> tmp8;
+    ca_.Bind(&block4, &tmp7, &tmp8);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp9;
+    TNode<Object> tmp10;
+    ca_.Bind(&block3, &tmp9, &tmp10);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3002);
+    TNode<JSRegExpResult> tmp11;
+    USE(tmp11);
+    tmp11 = TORQUE_CAST(TNode<Object>{tmp10});
+    ca_.Goto(&block1, tmp9, tmp10, tmp11);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp12;
+    TNode<Object> tmp13;
+    TNode<JSRegExpResult> tmp14;
+    ca_.Bind(&block1, &tmp12, &tmp13, &tmp14);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 199);
+    ca_.Goto(&block6, tmp12, tmp13, tmp14);
+  }
+
+    TNode<Context> tmp15;
+    TNode<Object> tmp16;
+    TNode<JSRegExpResult> tmp17;
+    ca_.Bind(&block6, &tmp15, &tmp16, &tmp17);
+  return TNode<JSRegExpResult>{tmp17};
+}
+
+TNode<String> UnsafeCast6String_1434(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block5(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, String> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, String> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3001);
+    ca_.Goto(&block3, tmp0, tmp1);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp2;
+    TNode<Object> tmp3;
+    ca_.Bind(&block2, &tmp2, &tmp3);
+    TNode<BoolT> tmp4;
+    USE(tmp4);
+    tmp4 = Is6String20UT5ATSmi10HeapObject_1491(state_, TNode<Context>{tmp2}, TNode<Object>{tmp3});
+    ca_.Branch(tmp4, &block4, &block5, tmp2, tmp3);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp5;
+    TNode<Object> tmp6;
+    ca_.Bind(&block5, &tmp5, &tmp6);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'Is<A>(o)' failed", "../../deps/v8/src/builtins/base.tq", 3001);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp7;
+    TNode<Object> tmp8;
+    ca_.Bind(&block4, &tmp7, &tmp8);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp9;
+    TNode<Object> tmp10;
+    ca_.Bind(&block3, &tmp9, &tmp10);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 3002);
+    TNode<String> tmp11;
+    USE(tmp11);
+    tmp11 = TORQUE_CAST(TNode<Object>{tmp10});
+    ca_.Goto(&block1, tmp9, tmp10, tmp11);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp12;
+    TNode<Object> tmp13;
+    TNode<String> tmp14;
+    ca_.Bind(&block1, &tmp12, &tmp13, &tmp14);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp-match-all.tq", 201);
+    ca_.Goto(&block6, tmp12, tmp13, tmp14);
+  }
+
+    TNode<Context> tmp15;
+    TNode<Object> tmp16;
+    TNode<String> tmp17;
+    ca_.Bind(&block6, &tmp15, &tmp16, &tmp17);
+  return TNode<String>{tmp17};
+}
+
+}  // namespace internal
+}  // namespace v8
+
@@ -0,0 +1,26 @@
+#ifndef V8_GEN_TORQUE_GENERATED_______DEPS_V8_SRC_BUILTINS_REGEXP_MATCH_ALL_TQ_H_
+#define V8_GEN_TORQUE_GENERATED_______DEPS_V8_SRC_BUILTINS_REGEXP_MATCH_ALL_TQ_H_
+
+#include "src/compiler/code-assembler.h"
+#include "src/codegen/code-stub-assembler.h"
+#include "src/utils/utils.h"
+#include "torque-generated/field-offsets-tq.h"
+#include "torque-generated/csa-types-tq.h"
+
+namespace v8 {
+namespace internal {
+
+TNode<Object> RegExpPrototypeMatchAllImpl_325(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<NativeContext> p_nativeContext, TNode<Object> p_receiver, TNode<Object> p_string);
+TNode<BoolT> HasDoneFlag_326(compiler::CodeAssemblerState* state_, TNode<Smi> p_flags);
+TNode<BoolT> HasGlobalFlag_327(compiler::CodeAssemblerState* state_, TNode<Smi> p_flags);
+TNode<BoolT> HasUnicodeFlag_328(compiler::CodeAssemblerState* state_, TNode<Smi> p_flags);
+void SetDoneFlag_329(compiler::CodeAssemblerState* state_, TNode<JSRegExpStringIterator> p_iterator, TNode<Smi> p_flags);
+TNode<JSRegExp> UnsafeCast8JSRegExp_1430(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o);
+TNode<JSRegExp> UnsafeCast14ATFastJSRegExp_1431(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o);
+TNode<JSRegExpStringIterator> Cast22JSRegExpStringIterator_1432(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o, compiler::CodeAssemblerLabel* label_CastError);
+TNode<JSRegExpResult> UnsafeCast20ATFastJSRegExpResult_1433(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o);
+TNode<String> UnsafeCast6String_1434(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o);
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_GEN_TORQUE_GENERATED_______DEPS_V8_SRC_BUILTINS_REGEXP_MATCH_ALL_TQ_H_
@@ -0,0 +1,1405 @@
+#include "src/builtins/builtins-array-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-utils-gen.h"
+#include "src/builtins/builtins.h"
+#include "src/codegen/code-factory.h"
+#include "src/heap/factory-inl.h"
+#include "src/objects/arguments.h"
+#include "src/objects/bigint.h"
+#include "src/objects/elements-kind.h"
+#include "src/objects/free-space.h"
+#include "src/objects/js-generator.h"
+#include "src/objects/js-promise.h"
+#include "src/objects/js-regexp-string-iterator.h"
+#include "src/objects/js-weak-refs.h"
+#include "src/objects/objects.h"
+#include "src/objects/source-text-module.h"
+#include "src/objects/stack-frame-info.h"
+#include "src/objects/synthetic-module.h"
+#include "src/objects/template-objects.h"
+#include "src/builtins/builtins-bigint-gen.h"
+#include "src/builtins/builtins-collections-gen.h"
+#include "src/builtins/builtins-data-view-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-iterator-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-string-gen.h"
+#include "src/builtins/builtins-string-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-constructor-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "torque-generated/../../deps/v8/src/builtins/arguments-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-copywithin-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-join-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-lastindexof-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-map-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-right-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reverse-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-shift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-splice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-unshift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/base-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/bigint-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/boolean-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/collections-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/data-view-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/extras-utils-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/frames-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/growable-fixed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/internal-coverage-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/math-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-fromentries-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-constructor-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-delete-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-has-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-is-extensible-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-prevent-extensions-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revocable-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revoke-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/reflect-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-exec-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-all-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-replace-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-search-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-source-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-split-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-test-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-endswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-html-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-pad-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-repeat-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-startswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-substring-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/torque-internal-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-createtypedarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduceright-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-subarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/third_party/v8/builtins/array-sort-tq-csa.h"
+#include "torque-generated/../../deps/v8/test/torque/test-torque-tq-csa.h"
+
+namespace v8 {
+namespace internal {
+
+TNode<BoolT> IsFastRegExpStrict_339(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<HeapObject> p_o) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, HeapObject> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, HeapObject, HeapObject> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, HeapObject, HeapObject> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, HeapObject> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, HeapObject> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, HeapObject, BoolT> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, HeapObject, BoolT> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<HeapObject> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 13);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    compiler::CodeAssemblerLabel label1(&ca_);
+    RegExpBuiltinsAssembler(state_).BranchIfFastRegExp_Strict(TNode<Context>{tmp0}, TNode<HeapObject>{tmp1}, &label0, &label1);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block6, tmp0, tmp1, tmp1);
+    }
+    if (label1.is_used()) {
+      ca_.Bind(&label1);
+      ca_.Goto(&block7, tmp0, tmp1, tmp1);
+    }
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp2;
+    TNode<HeapObject> tmp3;
+    TNode<HeapObject> tmp4;
+    ca_.Bind(&block6, &tmp2, &tmp3, &tmp4);
+    ca_.Goto(&block5, tmp2, tmp3);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp5;
+    TNode<HeapObject> tmp6;
+    TNode<HeapObject> tmp7;
+    ca_.Bind(&block7, &tmp5, &tmp6, &tmp7);
+    ca_.Goto(&block3, tmp5, tmp6);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp8;
+    TNode<HeapObject> tmp9;
+    ca_.Bind(&block5, &tmp8, &tmp9);
+    TNode<BoolT> tmp10;
+    USE(tmp10);
+    tmp10 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, true);
+    ca_.Goto(&block1, tmp8, tmp9, tmp10);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp11;
+    TNode<HeapObject> tmp12;
+    ca_.Bind(&block3, &tmp11, &tmp12);
+    TNode<BoolT> tmp13;
+    USE(tmp13);
+    tmp13 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, false);
+    ca_.Goto(&block1, tmp11, tmp12, tmp13);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp14;
+    TNode<HeapObject> tmp15;
+    TNode<BoolT> tmp16;
+    ca_.Bind(&block1, &tmp14, &tmp15, &tmp16);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 12);
+    ca_.Goto(&block8, tmp14, tmp15, tmp16);
+  }
+
+    TNode<Context> tmp17;
+    TNode<HeapObject> tmp18;
+    TNode<BoolT> tmp19;
+    ca_.Bind(&block8, &tmp17, &tmp18, &tmp19);
+  return TNode<BoolT>{tmp19};
+}
+
+TNode<BoolT> IsFastRegExpPermissive_340(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<HeapObject> p_o) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, HeapObject> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, HeapObject, HeapObject> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, HeapObject, HeapObject> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, HeapObject> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, HeapObject> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, HeapObject, BoolT> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, HeapObject, BoolT> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<HeapObject> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 22);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    compiler::CodeAssemblerLabel label1(&ca_);
+    RegExpBuiltinsAssembler(state_).BranchIfFastRegExp_Permissive(TNode<Context>{tmp0}, TNode<HeapObject>{tmp1}, &label0, &label1);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block6, tmp0, tmp1, tmp1);
+    }
+    if (label1.is_used()) {
+      ca_.Bind(&label1);
+      ca_.Goto(&block7, tmp0, tmp1, tmp1);
+    }
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp2;
+    TNode<HeapObject> tmp3;
+    TNode<HeapObject> tmp4;
+    ca_.Bind(&block6, &tmp2, &tmp3, &tmp4);
+    ca_.Goto(&block5, tmp2, tmp3);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp5;
+    TNode<HeapObject> tmp6;
+    TNode<HeapObject> tmp7;
+    ca_.Bind(&block7, &tmp5, &tmp6, &tmp7);
+    ca_.Goto(&block3, tmp5, tmp6);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp8;
+    TNode<HeapObject> tmp9;
+    ca_.Bind(&block5, &tmp8, &tmp9);
+    TNode<BoolT> tmp10;
+    USE(tmp10);
+    tmp10 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, true);
+    ca_.Goto(&block1, tmp8, tmp9, tmp10);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp11;
+    TNode<HeapObject> tmp12;
+    ca_.Bind(&block3, &tmp11, &tmp12);
+    TNode<BoolT> tmp13;
+    USE(tmp13);
+    tmp13 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, false);
+    ca_.Goto(&block1, tmp11, tmp12, tmp13);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp14;
+    TNode<HeapObject> tmp15;
+    TNode<BoolT> tmp16;
+    ca_.Bind(&block1, &tmp14, &tmp15, &tmp16);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 20);
+    ca_.Goto(&block8, tmp14, tmp15, tmp16);
+  }
+
+    TNode<Context> tmp17;
+    TNode<HeapObject> tmp18;
+    TNode<BoolT> tmp19;
+    ca_.Bind(&block8, &tmp17, &tmp18, &tmp19);
+  return TNode<BoolT>{tmp19};
+}
+
+TNode<Object> RegExpExec_341(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<JSReceiver> p_receiver, TNode<String> p_string) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Object, Object, Object> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Object, Object, Object, JSReceiver> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Object, Object, JSReceiver, Object> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Object, Object, JSReceiver, Object> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Object, Object> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Object, Object, Object, JSReceiver> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Object, Object, Object, JSReceiver, JSRegExp> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Object, Object, Object> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Object, Object, Object, JSRegExp> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Object> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, String, Object> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_receiver, p_string);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    TNode<String> tmp2;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 35);
+    TNode<Object> tmp3;
+    USE(tmp3);
+    tmp3 = FromConstexpr90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol18ATconstexpr_string_172(state_, "exec");
+    TNode<Object> tmp4;
+    USE(tmp4);
+    tmp4 = CodeStubAssembler(state_).GetProperty(TNode<Context>{tmp0}, TNode<Object>{tmp1}, TNode<Object>{tmp3});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 38);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 39);
+    TNode<JSReceiver> tmp5;
+    USE(tmp5);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp5 = Cast71UT19ATCallableApiObject17ATCallableJSProxy15JSBoundFunction10JSFunction_1366(state_, TNode<Context>{tmp0}, TNode<Object>{tmp4}, &label0);
+    ca_.Goto(&block4, tmp0, tmp1, tmp2, tmp4, tmp4, tmp4, tmp5);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block5, tmp0, tmp1, tmp2, tmp4, tmp4, tmp4);
+    }
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp6;
+    TNode<JSReceiver> tmp7;
+    TNode<String> tmp8;
+    TNode<Object> tmp9;
+    TNode<Object> tmp10;
+    TNode<Object> tmp11;
+    ca_.Bind(&block5, &tmp6, &tmp7, &tmp8, &tmp9, &tmp10, &tmp11);
+    ca_.Goto(&block3, tmp6, tmp7, tmp8, tmp9, tmp10);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp12;
+    TNode<JSReceiver> tmp13;
+    TNode<String> tmp14;
+    TNode<Object> tmp15;
+    TNode<Object> tmp16;
+    TNode<Object> tmp17;
+    TNode<JSReceiver> tmp18;
+    ca_.Bind(&block4, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 40);
+    TNode<Object> tmp19;
+    USE(tmp19);
+    tmp19 = CodeStubAssembler(state_).Call(TNode<Context>{tmp12}, TNode<JSReceiver>{tmp18}, TNode<Object>{tmp13}, TNode<Object>{tmp14});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 41);
+    TNode<Oddball> tmp20;
+    USE(tmp20);
+    tmp20 = Null_63(state_);
+    TNode<BoolT> tmp21;
+    USE(tmp21);
+    tmp21 = CodeStubAssembler(state_).TaggedNotEqual(TNode<Object>{tmp19}, TNode<HeapObject>{tmp20});
+    ca_.Branch(tmp21, &block6, &block7, tmp12, tmp13, tmp14, tmp15, tmp16, tmp18, tmp19);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp22;
+    TNode<JSReceiver> tmp23;
+    TNode<String> tmp24;
+    TNode<Object> tmp25;
+    TNode<Object> tmp26;
+    TNode<JSReceiver> tmp27;
+    TNode<Object> tmp28;
+    ca_.Bind(&block6, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27, &tmp28);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 42);
+    CodeStubAssembler(state_).ThrowIfNotJSReceiver(TNode<Context>{tmp22}, TNode<Object>{tmp28}, MessageTemplate::kInvalidRegExpExecResult, "");
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 41);
+    ca_.Goto(&block7, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27, tmp28);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp29;
+    TNode<JSReceiver> tmp30;
+    TNode<String> tmp31;
+    TNode<Object> tmp32;
+    TNode<Object> tmp33;
+    TNode<JSReceiver> tmp34;
+    TNode<Object> tmp35;
+    ca_.Bind(&block7, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34, &tmp35);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 44);
+    ca_.Goto(&block1, tmp29, tmp30, tmp31, tmp35);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp36;
+    TNode<JSReceiver> tmp37;
+    TNode<String> tmp38;
+    TNode<Object> tmp39;
+    TNode<Object> tmp40;
+    ca_.Bind(&block3, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 46);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 47);
+    TNode<JSRegExp> tmp41;
+    USE(tmp41);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp41 = Cast8JSRegExp_131(state_, TNode<HeapObject>{tmp37}, &label0);
+    ca_.Goto(&block10, tmp36, tmp37, tmp38, tmp39, tmp40, ca_.UncheckedCast<Object>(tmp40), tmp37, tmp41);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block11, tmp36, tmp37, tmp38, tmp39, tmp40, ca_.UncheckedCast<Object>(tmp40), tmp37);
+    }
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp42;
+    TNode<JSReceiver> tmp43;
+    TNode<String> tmp44;
+    TNode<Object> tmp45;
+    TNode<Object> tmp46;
+    TNode<Object> tmp47;
+    TNode<JSReceiver> tmp48;
+    ca_.Bind(&block11, &tmp42, &tmp43, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48);
+    ca_.Goto(&block9, tmp42, tmp43, tmp44, tmp45, tmp46, tmp47);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp49;
+    TNode<JSReceiver> tmp50;
+    TNode<String> tmp51;
+    TNode<Object> tmp52;
+    TNode<Object> tmp53;
+    TNode<Object> tmp54;
+    TNode<JSReceiver> tmp55;
+    TNode<JSRegExp> tmp56;
+    ca_.Bind(&block10, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53, &tmp54, &tmp55, &tmp56);
+    ca_.Goto(&block8, tmp49, tmp50, tmp51, tmp52, tmp53, tmp54, tmp56);
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp57;
+    TNode<JSReceiver> tmp58;
+    TNode<String> tmp59;
+    TNode<Object> tmp60;
+    TNode<Object> tmp61;
+    TNode<Object> tmp62;
+    ca_.Bind(&block9, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 48);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 47);
+    TNode<Object> tmp63;
+    USE(tmp63);
+    tmp63 = FromConstexpr20UT5ATSmi10HeapObject18ATconstexpr_string_171(state_, "RegExp.prototype.exec");
+    CodeStubAssembler(state_).ThrowTypeError(TNode<Context>{tmp57}, MessageTemplate::kIncompatibleMethodReceiver, TNode<Object>{tmp63}, TNode<Object>{tmp58});
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp64;
+    TNode<JSReceiver> tmp65;
+    TNode<String> tmp66;
+    TNode<Object> tmp67;
+    TNode<Object> tmp68;
+    TNode<Object> tmp69;
+    TNode<JSRegExp> tmp70;
+    ca_.Bind(&block8, &tmp64, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 49);
+    TNode<Object> tmp71;
+    tmp71 = CodeStubAssembler(state_).CallBuiltin(Builtins::kRegExpPrototypeExecSlow, tmp64, tmp70, tmp66);
+    USE(tmp71);
+    ca_.Goto(&block1, tmp64, tmp65, tmp66, tmp71);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp72;
+    TNode<JSReceiver> tmp73;
+    TNode<String> tmp74;
+    TNode<Object> tmp75;
+    ca_.Bind(&block1, &tmp72, &tmp73, &tmp74, &tmp75);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 29);
+    ca_.Goto(&block12, tmp72, tmp73, tmp74, tmp75);
+  }
+
+    TNode<Context> tmp76;
+    TNode<JSReceiver> tmp77;
+    TNode<String> tmp78;
+    TNode<Object> tmp79;
+    ca_.Bind(&block12, &tmp76, &tmp77, &tmp78, &tmp79);
+  return TNode<Object>{tmp79};
+}
+
+TNode<Object> FlagGetter_342(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_receiver, JSRegExp::Flag p_flag, int31_t p_counter, const char* p_methodName) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, Object, JSRegExp> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_receiver);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 92);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 93);
+    TNode<JSRegExp> tmp2;
+    USE(tmp2);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp2 = Cast8JSRegExp_1429(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1}, &label0);
+    ca_.Goto(&block4, tmp0, tmp1, tmp1, tmp1, tmp2);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block5, tmp0, tmp1, tmp1, tmp1);
+    }
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    TNode<Object> tmp6;
+    ca_.Bind(&block5, &tmp3, &tmp4, &tmp5, &tmp6);
+    ca_.Goto(&block3, tmp3, tmp4, tmp5);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp7;
+    TNode<Object> tmp8;
+    TNode<Object> tmp9;
+    TNode<Object> tmp10;
+    TNode<JSRegExp> tmp11;
+    ca_.Bind(&block4, &tmp7, &tmp8, &tmp9, &tmp10, &tmp11);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 94);
+    TNode<BoolT> tmp12;
+    USE(tmp12);
+    tmp12 = RegExpBuiltinsAssembler(state_).FastFlagGetter(TNode<JSRegExp>{tmp11}, p_flag);
+    TNode<Oddball> tmp13;
+    USE(tmp13);
+    tmp13 = CodeStubAssembler(state_).SelectBooleanConstant(TNode<BoolT>{tmp12});
+    ca_.Goto(&block1, tmp7, tmp8, tmp13);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp14;
+    TNode<Object> tmp15;
+    TNode<Object> tmp16;
+    ca_.Bind(&block3, &tmp14, &tmp15, &tmp16);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 96);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 93);
+    ca_.Goto(&block2, tmp14, tmp15, tmp16);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp17;
+    TNode<Object> tmp18;
+    TNode<Object> tmp19;
+    ca_.Bind(&block2, &tmp17, &tmp18, &tmp19);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 92);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 99);
+    TNode<BoolT> tmp20;
+    USE(tmp20);
+    tmp20 = RegExpBuiltinsAssembler(state_).IsReceiverInitialRegExpPrototype(TNode<Context>{tmp17}, TNode<Object>{tmp18});
+    TNode<BoolT> tmp21;
+    USE(tmp21);
+    tmp21 = CodeStubAssembler(state_).Word32BinaryNot(TNode<BoolT>{tmp20});
+    ca_.Branch(tmp21, &block6, &block7, tmp17, tmp18);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp22;
+    TNode<Object> tmp23;
+    ca_.Bind(&block6, &tmp22, &tmp23);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 100);
+    CodeStubAssembler(state_).ThrowTypeError(TNode<Context>{tmp22}, MessageTemplate::kRegExpNonRegExp, p_methodName);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp24;
+    TNode<Object> tmp25;
+    ca_.Bind(&block7, &tmp24, &tmp25);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 102);
+    if (((CodeStubAssembler(state_).ConstexprInt31NotEqual(p_counter, -1)))) {
+      ca_.Goto(&block8, tmp24, tmp25);
+    } else {
+      ca_.Goto(&block9, tmp24, tmp25);
+    }
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp26;
+    TNode<Object> tmp27;
+    ca_.Bind(&block8, &tmp26, &tmp27);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 103);
+    TNode<Smi> tmp28;
+    USE(tmp28);
+    tmp28 = CodeStubAssembler(state_).SmiConstant(p_counter);
+    CodeStubAssembler(state_).CallRuntime(Runtime::kIncrementUseCounter, tmp26, tmp28);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 102);
+    ca_.Goto(&block10, tmp26, tmp27);
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp30;
+    TNode<Object> tmp31;
+    ca_.Bind(&block9, &tmp30, &tmp31);
+    ca_.Goto(&block10, tmp30, tmp31);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp32;
+    TNode<Object> tmp33;
+    ca_.Bind(&block10, &tmp32, &tmp33);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 105);
+    TNode<Oddball> tmp34;
+    USE(tmp34);
+    tmp34 = Undefined_64(state_);
+    ca_.Goto(&block1, tmp32, tmp33, tmp34);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp35;
+    TNode<Object> tmp36;
+    TNode<Object> tmp37;
+    ca_.Bind(&block1, &tmp35, &tmp36, &tmp37);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 89);
+    ca_.Goto(&block11, tmp35, tmp36, tmp37);
+  }
+
+    TNode<Context> tmp38;
+    TNode<Object> tmp39;
+    TNode<Object> tmp40;
+    ca_.Bind(&block11, &tmp38, &tmp39, &tmp40);
+  return TNode<Object>{tmp40};
+}
+
+TF_BUILTIN(RegExpPrototypeGlobalGetter, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = UncheckedCast<Object>(Parameter(Descriptor::kReceiver));
+USE(parameter1);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 113);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 112);
+    TNode<Object> tmp2;
+    USE(tmp2);
+    tmp2 = FlagGetter_342(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1}, JSRegExp::kGlobal, v8::Isolate::kRegExpPrototypeOldFlagGetter, "RegExp.prototype.global");
+    CodeStubAssembler(state_).Return(tmp2);
+  }
+}
+
+TF_BUILTIN(RegExpPrototypeIgnoreCaseGetter, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = UncheckedCast<Object>(Parameter(Descriptor::kReceiver));
+USE(parameter1);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 122);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 121);
+    TNode<Object> tmp2;
+    USE(tmp2);
+    tmp2 = FlagGetter_342(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1}, JSRegExp::kIgnoreCase, v8::Isolate::kRegExpPrototypeOldFlagGetter, "RegExp.prototype.ignoreCase");
+    CodeStubAssembler(state_).Return(tmp2);
+  }
+}
+
+TF_BUILTIN(RegExpPrototypeMultilineGetter, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = UncheckedCast<Object>(Parameter(Descriptor::kReceiver));
+USE(parameter1);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 131);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 130);
+    TNode<Object> tmp2;
+    USE(tmp2);
+    tmp2 = FlagGetter_342(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1}, JSRegExp::kMultiline, v8::Isolate::kRegExpPrototypeOldFlagGetter, "RegExp.prototype.multiline");
+    CodeStubAssembler(state_).Return(tmp2);
+  }
+}
+
+TF_BUILTIN(RegExpPrototypeDotAllGetter, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = UncheckedCast<Object>(Parameter(Descriptor::kReceiver));
+USE(parameter1);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 139);
+    TNode<Object> tmp2;
+    USE(tmp2);
+    tmp2 = FlagGetter_342(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1}, JSRegExp::kDotAll, -1, "RegExp.prototype.dotAll");
+    CodeStubAssembler(state_).Return(tmp2);
+  }
+}
+
+TF_BUILTIN(RegExpPrototypeStickyGetter, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = UncheckedCast<Object>(Parameter(Descriptor::kReceiver));
+USE(parameter1);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 147);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 146);
+    TNode<Object> tmp2;
+    USE(tmp2);
+    tmp2 = FlagGetter_342(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1}, JSRegExp::kSticky, v8::Isolate::kRegExpPrototypeStickyGetter, "RegExp.prototype.sticky");
+    CodeStubAssembler(state_).Return(tmp2);
+  }
+}
+
+TF_BUILTIN(RegExpPrototypeUnicodeGetter, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = UncheckedCast<Object>(Parameter(Descriptor::kReceiver));
+USE(parameter1);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 156);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 155);
+    TNode<Object> tmp2;
+    USE(tmp2);
+    tmp2 = FlagGetter_342(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1}, JSRegExp::kUnicode, v8::Isolate::kRegExpPrototypeUnicodeGetter, "RegExp.prototype.unicode");
+    CodeStubAssembler(state_).Return(tmp2);
+  }
+}
+
+TNode<String> FastFlagsGetter_343(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<JSRegExp> p_receiver) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSRegExp> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSRegExp, String> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSRegExp, String> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_receiver);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSRegExp> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 166);
+    TNode<String> tmp2;
+    USE(tmp2);
+    tmp2 = RegExpBuiltinsAssembler(state_).FlagsGetter(TNode<Context>{tmp0}, TNode<Object>{tmp1}, true);
+    ca_.Goto(&block1, tmp0, tmp1, tmp2);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp3;
+    TNode<JSRegExp> tmp4;
+    TNode<String> tmp5;
+    ca_.Bind(&block1, &tmp3, &tmp4, &tmp5);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 164);
+    ca_.Goto(&block2, tmp3, tmp4, tmp5);
+  }
+
+    TNode<Context> tmp6;
+    TNode<JSRegExp> tmp7;
+    TNode<String> tmp8;
+    ca_.Bind(&block2, &tmp6, &tmp7, &tmp8);
+  return TNode<String>{tmp8};
+}
+
+TNode<String> SlowFlagsGetter_344(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_receiver) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, String> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, String> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_receiver);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 171);
+    TNode<String> tmp2;
+    USE(tmp2);
+    tmp2 = RegExpBuiltinsAssembler(state_).FlagsGetter(TNode<Context>{tmp0}, TNode<Object>{tmp1}, false);
+    ca_.Goto(&block1, tmp0, tmp1, tmp2);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    TNode<String> tmp5;
+    ca_.Bind(&block1, &tmp3, &tmp4, &tmp5);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 169);
+    ca_.Goto(&block2, tmp3, tmp4, tmp5);
+  }
+
+    TNode<Context> tmp6;
+    TNode<Object> tmp7;
+    TNode<String> tmp8;
+    ca_.Bind(&block2, &tmp6, &tmp7, &tmp8);
+  return TNode<String>{tmp8};
+}
+
+TF_BUILTIN(RegExpPrototypeFlagsGetter, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = UncheckedCast<Object>(Parameter(Descriptor::kReceiver));
+USE(parameter1);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, JSRegExp> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExp> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, parameter0, parameter1);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 181);
+    CodeStubAssembler(state_).ThrowIfNotJSReceiver(TNode<Context>{tmp0}, TNode<Object>{tmp1}, MessageTemplate::kRegExpNonObject, "RegExp.prototype.flags");
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 186);
+    TNode<JSRegExp> tmp2;
+    USE(tmp2);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp2 = Cast14ATFastJSRegExp_1437(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1}, &label0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp1, tmp2);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block4, tmp0, tmp1, tmp1);
+    }
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    ca_.Bind(&block4, &tmp3, &tmp4, &tmp5);
+    ca_.Goto(&block2, tmp3, tmp4);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp6;
+    TNode<Object> tmp7;
+    TNode<Object> tmp8;
+    TNode<JSRegExp> tmp9;
+    ca_.Bind(&block3, &tmp6, &tmp7, &tmp8, &tmp9);
+    ca_.Goto(&block1, tmp6, tmp7, tmp9);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp10;
+    TNode<Object> tmp11;
+    ca_.Bind(&block2, &tmp10, &tmp11);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 187);
+    TNode<String> tmp12;
+    USE(tmp12);
+    tmp12 = SlowFlagsGetter_344(state_, TNode<Context>{tmp10}, TNode<Object>{tmp11});
+    CodeStubAssembler(state_).Return(tmp12);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp13;
+    TNode<Object> tmp14;
+    TNode<JSRegExp> tmp15;
+    ca_.Bind(&block1, &tmp13, &tmp14, &tmp15);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 188);
+    TNode<String> tmp16;
+    USE(tmp16);
+    tmp16 = FastFlagsGetter_343(state_, TNode<Context>{tmp13}, TNode<JSRegExp>{tmp15});
+    CodeStubAssembler(state_).Return(tmp16);
+  }
+}
+
+TNode<BoolT> IsRegExp_345(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_obj) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, JSReceiver> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Object> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Object> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Object> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Object> block11(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Object> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Object> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Object> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Object> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Object> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Object> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Object> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Object> block19(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Object> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Object> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Object> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSReceiver, Object> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, BoolT> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, BoolT> block22(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_obj);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 219);
+    TNode<JSReceiver> tmp2;
+    USE(tmp2);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp2 = Cast10JSReceiver_1365(state_, TNode<Context>{tmp0}, TNode<Object>{tmp1}, &label0);
+    ca_.Goto(&block4, tmp0, tmp1, tmp1, tmp2);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block5, tmp0, tmp1, tmp1);
+    }
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    ca_.Bind(&block5, &tmp3, &tmp4, &tmp5);
+    ca_.Goto(&block3, tmp3, tmp4);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp6;
+    TNode<Object> tmp7;
+    TNode<Object> tmp8;
+    TNode<JSReceiver> tmp9;
+    ca_.Bind(&block4, &tmp6, &tmp7, &tmp8, &tmp9);
+    ca_.Goto(&block2, tmp6, tmp7, tmp9);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp10;
+    TNode<Object> tmp11;
+    ca_.Bind(&block3, &tmp10, &tmp11);
+    TNode<BoolT> tmp12;
+    USE(tmp12);
+    tmp12 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, false);
+    ca_.Goto(&block1, tmp10, tmp11, tmp12);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp13;
+    TNode<Object> tmp14;
+    TNode<JSReceiver> tmp15;
+    ca_.Bind(&block2, &tmp13, &tmp14, &tmp15);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 222);
+    TNode<Symbol> tmp16;
+    USE(tmp16);
+    tmp16 = CodeStubAssembler(state_).MatchSymbolConstant();
+    TNode<Object> tmp17;
+    USE(tmp17);
+    tmp17 = CodeStubAssembler(state_).GetProperty(TNode<Context>{tmp13}, TNode<Object>{tmp15}, TNode<Object>{tmp16});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 223);
+    TNode<Oddball> tmp18;
+    USE(tmp18);
+    tmp18 = Undefined_64(state_);
+    TNode<BoolT> tmp19;
+    USE(tmp19);
+    tmp19 = CodeStubAssembler(state_).TaggedEqual(TNode<Object>{tmp17}, TNode<HeapObject>{tmp18});
+    ca_.Branch(tmp19, &block6, &block7, tmp13, tmp14, tmp15, tmp17);
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp20;
+    TNode<Object> tmp21;
+    TNode<JSReceiver> tmp22;
+    TNode<Object> tmp23;
+    ca_.Bind(&block6, &tmp20, &tmp21, &tmp22, &tmp23);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 224);
+    TNode<BoolT> tmp24;
+    USE(tmp24);
+    tmp24 = Is8JSRegExp10JSReceiver_1438(state_, TNode<Context>{tmp20}, TNode<JSReceiver>{tmp22});
+    ca_.Goto(&block1, tmp20, tmp21, tmp24);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp25;
+    TNode<Object> tmp26;
+    TNode<JSReceiver> tmp27;
+    TNode<Object> tmp28;
+    ca_.Bind(&block7, &tmp25, &tmp26, &tmp27, &tmp28);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 227);
+    ca_.Goto(&block9, tmp25, tmp26, tmp27, tmp28);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp29;
+    TNode<Object> tmp30;
+    TNode<JSReceiver> tmp31;
+    TNode<Object> tmp32;
+    ca_.Bind(&block8, &tmp29, &tmp30, &tmp31, &tmp32);
+    TNode<Oddball> tmp33;
+    USE(tmp33);
+    tmp33 = Undefined_64(state_);
+    TNode<BoolT> tmp34;
+    USE(tmp34);
+    tmp34 = CodeStubAssembler(state_).TaggedNotEqual(TNode<Object>{tmp32}, TNode<HeapObject>{tmp33});
+    ca_.Branch(tmp34, &block10, &block11, tmp29, tmp30, tmp31, tmp32);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp35;
+    TNode<Object> tmp36;
+    TNode<JSReceiver> tmp37;
+    TNode<Object> tmp38;
+    ca_.Bind(&block11, &tmp35, &tmp36, &tmp37, &tmp38);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'value != Undefined' failed", "../../deps/v8/src/builtins/regexp.tq", 227);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp39;
+    TNode<Object> tmp40;
+    TNode<JSReceiver> tmp41;
+    TNode<Object> tmp42;
+    ca_.Bind(&block10, &tmp39, &tmp40, &tmp41, &tmp42);
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp43;
+    TNode<Object> tmp44;
+    TNode<JSReceiver> tmp45;
+    TNode<Object> tmp46;
+    ca_.Bind(&block9, &tmp43, &tmp44, &tmp45, &tmp46);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 230);
+    TNode<BoolT> tmp47;
+    USE(tmp47);
+    tmp47 = ToBoolean_243(state_, TNode<Object>{tmp46});
+    ca_.Branch(tmp47, &block12, &block13, tmp43, tmp44, tmp45, tmp46);
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp48;
+    TNode<Object> tmp49;
+    TNode<JSReceiver> tmp50;
+    TNode<Object> tmp51;
+    ca_.Bind(&block12, &tmp48, &tmp49, &tmp50, &tmp51);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 231);
+    TNode<BoolT> tmp52;
+    USE(tmp52);
+    tmp52 = Is8JSRegExp10JSReceiver_1438(state_, TNode<Context>{tmp48}, TNode<JSReceiver>{tmp50});
+    TNode<BoolT> tmp53;
+    USE(tmp53);
+    tmp53 = CodeStubAssembler(state_).Word32BinaryNot(TNode<BoolT>{tmp52});
+    ca_.Branch(tmp53, &block14, &block15, tmp48, tmp49, tmp50, tmp51);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp54;
+    TNode<Object> tmp55;
+    TNode<JSReceiver> tmp56;
+    TNode<Object> tmp57;
+    ca_.Bind(&block14, &tmp54, &tmp55, &tmp56, &tmp57);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 233);
+    TNode<Smi> tmp58;
+    USE(tmp58);
+    tmp58 = CodeStubAssembler(state_).SmiConstant(v8::Isolate::kRegExpMatchIsTrueishOnNonJSRegExp);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 232);
+    CodeStubAssembler(state_).CallRuntime(Runtime::kIncrementUseCounter, tmp54, tmp58);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 231);
+    ca_.Goto(&block15, tmp54, tmp55, tmp56, tmp57);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp60;
+    TNode<Object> tmp61;
+    TNode<JSReceiver> tmp62;
+    TNode<Object> tmp63;
+    ca_.Bind(&block15, &tmp60, &tmp61, &tmp62, &tmp63);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 235);
+    TNode<BoolT> tmp64;
+    USE(tmp64);
+    tmp64 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, true);
+    ca_.Goto(&block1, tmp60, tmp61, tmp64);
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp65;
+    TNode<Object> tmp66;
+    TNode<JSReceiver> tmp67;
+    TNode<Object> tmp68;
+    ca_.Bind(&block13, &tmp65, &tmp66, &tmp67, &tmp68);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 238);
+    ca_.Goto(&block17, tmp65, tmp66, tmp67, tmp68);
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp69;
+    TNode<Object> tmp70;
+    TNode<JSReceiver> tmp71;
+    TNode<Object> tmp72;
+    ca_.Bind(&block16, &tmp69, &tmp70, &tmp71, &tmp72);
+    TNode<BoolT> tmp73;
+    USE(tmp73);
+    tmp73 = ToBoolean_243(state_, TNode<Object>{tmp72});
+    TNode<BoolT> tmp74;
+    USE(tmp74);
+    tmp74 = CodeStubAssembler(state_).Word32BinaryNot(TNode<BoolT>{tmp73});
+    ca_.Branch(tmp74, &block18, &block19, tmp69, tmp70, tmp71, tmp72);
+  }
+
+  if (block19.is_used()) {
+    TNode<Context> tmp75;
+    TNode<Object> tmp76;
+    TNode<JSReceiver> tmp77;
+    TNode<Object> tmp78;
+    ca_.Bind(&block19, &tmp75, &tmp76, &tmp77, &tmp78);
+    CodeStubAssembler(state_).FailAssert("Torque assert '!ToBoolean(value)' failed", "../../deps/v8/src/builtins/regexp.tq", 238);
+  }
+
+  if (block18.is_used()) {
+    TNode<Context> tmp79;
+    TNode<Object> tmp80;
+    TNode<JSReceiver> tmp81;
+    TNode<Object> tmp82;
+    ca_.Bind(&block18, &tmp79, &tmp80, &tmp81, &tmp82);
+  }
+
+  if (block17.is_used()) {
+    TNode<Context> tmp83;
+    TNode<Object> tmp84;
+    TNode<JSReceiver> tmp85;
+    TNode<Object> tmp86;
+    ca_.Bind(&block17, &tmp83, &tmp84, &tmp85, &tmp86);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 239);
+    TNode<BoolT> tmp87;
+    USE(tmp87);
+    tmp87 = Is8JSRegExp10JSReceiver_1438(state_, TNode<Context>{tmp83}, TNode<JSReceiver>{tmp85});
+    ca_.Branch(tmp87, &block20, &block21, tmp83, tmp84, tmp85, tmp86);
+  }
+
+  if (block20.is_used()) {
+    TNode<Context> tmp88;
+    TNode<Object> tmp89;
+    TNode<JSReceiver> tmp90;
+    TNode<Object> tmp91;
+    ca_.Bind(&block20, &tmp88, &tmp89, &tmp90, &tmp91);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 241);
+    TNode<Smi> tmp92;
+    USE(tmp92);
+    tmp92 = CodeStubAssembler(state_).SmiConstant(v8::Isolate::kRegExpMatchIsFalseishOnJSRegExp);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 240);
+    CodeStubAssembler(state_).CallRuntime(Runtime::kIncrementUseCounter, tmp88, tmp92);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 239);
+    ca_.Goto(&block21, tmp88, tmp89, tmp90, tmp91);
+  }
+
+  if (block21.is_used()) {
+    TNode<Context> tmp94;
+    TNode<Object> tmp95;
+    TNode<JSReceiver> tmp96;
+    TNode<Object> tmp97;
+    ca_.Bind(&block21, &tmp94, &tmp95, &tmp96, &tmp97);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 243);
+    TNode<BoolT> tmp98;
+    USE(tmp98);
+    tmp98 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, false);
+    ca_.Goto(&block1, tmp94, tmp95, tmp98);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp99;
+    TNode<Object> tmp100;
+    TNode<BoolT> tmp101;
+    ca_.Bind(&block1, &tmp99, &tmp100, &tmp101);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 217);
+    ca_.Goto(&block22, tmp99, tmp100, tmp101);
+  }
+
+    TNode<Context> tmp102;
+    TNode<Object> tmp103;
+    TNode<BoolT> tmp104;
+    ca_.Bind(&block22, &tmp102, &tmp103, &tmp104);
+  return TNode<BoolT>{tmp104};
+}
+
+TNode<JSRegExp> Cast14ATFastJSRegExp_1437(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o, compiler::CodeAssemblerLabel* label_CastError) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, Object, HeapObject> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, HeapObject> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, HeapObject, JSRegExp> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExp> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, Object, JSRegExp> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<Object> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 2215);
+    TNode<HeapObject> tmp2;
+    USE(tmp2);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp2 = CodeStubAssembler(state_).TaggedToHeapObject(TNode<Object>{tmp1}, &label0);
+    ca_.Goto(&block3, tmp0, tmp1, tmp1, tmp2);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block4, tmp0, tmp1, tmp1);
+    }
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    TNode<Object> tmp5;
+    ca_.Bind(&block4, &tmp3, &tmp4, &tmp5);
+    ca_.Goto(&block1);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp6;
+    TNode<Object> tmp7;
+    TNode<Object> tmp8;
+    TNode<HeapObject> tmp9;
+    ca_.Bind(&block3, &tmp6, &tmp7, &tmp8, &tmp9);
+    TNode<JSRegExp> tmp10;
+    USE(tmp10);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp10 = Cast14ATFastJSRegExp_137(state_, TNode<Context>{tmp6}, TNode<HeapObject>{tmp9}, &label0);
+    ca_.Goto(&block5, tmp6, tmp7, tmp9, tmp10);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block6, tmp6, tmp7, tmp9);
+    }
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp11;
+    TNode<Object> tmp12;
+    TNode<HeapObject> tmp13;
+    ca_.Bind(&block6, &tmp11, &tmp12, &tmp13);
+    ca_.Goto(&block1);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp14;
+    TNode<Object> tmp15;
+    TNode<HeapObject> tmp16;
+    TNode<JSRegExp> tmp17;
+    ca_.Bind(&block5, &tmp14, &tmp15, &tmp16, &tmp17);
+    ca_.Goto(&block2, tmp14, tmp15, tmp17);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp18;
+    TNode<Object> tmp19;
+    TNode<JSRegExp> tmp20;
+    ca_.Bind(&block2, &tmp18, &tmp19, &tmp20);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 186);
+    ca_.Goto(&block7, tmp18, tmp19, tmp20);
+  }
+
+  if (block1.is_used()) {
+    ca_.Bind(&block1);
+    ca_.Goto(label_CastError);
+  }
+
+    TNode<Context> tmp21;
+    TNode<Object> tmp22;
+    TNode<JSRegExp> tmp23;
+    ca_.Bind(&block7, &tmp21, &tmp22, &tmp23);
+  return TNode<JSRegExp>{tmp23};
+}
+
+TNode<BoolT> Is8JSRegExp10JSReceiver_1438(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<JSReceiver> p_o) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSReceiver, JSRegExp> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, JSRegExp> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, BoolT> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSReceiver, BoolT> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_o);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSReceiver> tmp1;
+    ca_.Bind(&block0, &tmp0, &tmp1);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 2996);
+    TNode<JSRegExp> tmp2;
+    USE(tmp2);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp2 = Cast8JSRegExp_131(state_, TNode<HeapObject>{tmp1}, &label0);
+    ca_.Goto(&block4, tmp0, tmp1, tmp1, tmp2);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block5, tmp0, tmp1, tmp1);
+    }
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp3;
+    TNode<JSReceiver> tmp4;
+    TNode<JSReceiver> tmp5;
+    ca_.Bind(&block5, &tmp3, &tmp4, &tmp5);
+    ca_.Goto(&block3, tmp3, tmp4);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp6;
+    TNode<JSReceiver> tmp7;
+    TNode<JSReceiver> tmp8;
+    TNode<JSRegExp> tmp9;
+    ca_.Bind(&block4, &tmp6, &tmp7, &tmp8, &tmp9);
+    ca_.Goto(&block2, tmp6, tmp7, tmp9);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp10;
+    TNode<JSReceiver> tmp11;
+    ca_.Bind(&block3, &tmp10, &tmp11);
+    TNode<BoolT> tmp12;
+    USE(tmp12);
+    tmp12 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, false);
+    ca_.Goto(&block1, tmp10, tmp11, tmp12);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp13;
+    TNode<JSReceiver> tmp14;
+    TNode<JSRegExp> tmp15;
+    ca_.Bind(&block2, &tmp13, &tmp14, &tmp15);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/base.tq", 2997);
+    TNode<BoolT> tmp16;
+    USE(tmp16);
+    tmp16 = FromConstexpr6ATbool16ATconstexpr_bool_168(state_, true);
+    ca_.Goto(&block1, tmp13, tmp14, tmp16);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp17;
+    TNode<JSReceiver> tmp18;
+    TNode<BoolT> tmp19;
+    ca_.Bind(&block1, &tmp17, &tmp18, &tmp19);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/regexp.tq", 224);
+    ca_.Goto(&block6, tmp17, tmp18, tmp19);
+  }
+
+    TNode<Context> tmp20;
+    TNode<JSReceiver> tmp21;
+    TNode<BoolT> tmp22;
+    ca_.Bind(&block6, &tmp20, &tmp21, &tmp22);
+  return TNode<BoolT>{tmp22};
+}
+
+}  // namespace internal
+}  // namespace v8
+
@@ -0,0 +1,21 @@
+#ifndef V8_GEN_TORQUE_GENERATED_______DEPS_V8_SRC_BUILTINS_TORQUE_INTERNAL_TQ_H_
+#define V8_GEN_TORQUE_GENERATED_______DEPS_V8_SRC_BUILTINS_TORQUE_INTERNAL_TQ_H_
+
+#include "src/compiler/code-assembler.h"
+#include "src/codegen/code-stub-assembler.h"
+#include "src/utils/utils.h"
+#include "torque-generated/field-offsets-tq.h"
+#include "torque-generated/csa-types-tq.h"
+
+namespace v8 {
+namespace internal {
+
+int31_t SizeOf20UT5ATSmi10HeapObject_354(compiler::CodeAssemblerState* state_);
+int31_t SizeOf9ATfloat64_355(compiler::CodeAssemblerState* state_);
+TorqueStructReference20UT5ATSmi10HeapObject UnsafeNewReference20UT5ATSmi10HeapObject_1372(compiler::CodeAssemblerState* state_, TNode<HeapObject> p_object, TNode<IntPtrT> p_offset);
+TNode<IntPtrT> Convert8ATintptr17ATconstexpr_int31_1376(compiler::CodeAssemblerState* state_, int31_t p_i);
+TorqueStructReference9ATfloat64 UnsafeNewReference9ATfloat64_1387(compiler::CodeAssemblerState* state_, TNode<HeapObject> p_object, TNode<IntPtrT> p_offset);
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_GEN_TORQUE_GENERATED_______DEPS_V8_SRC_BUILTINS_TORQUE_INTERNAL_TQ_H_
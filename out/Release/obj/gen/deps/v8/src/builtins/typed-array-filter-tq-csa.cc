@@ -0,0 +1,2165 @@
+#include "src/builtins/builtins-array-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-utils-gen.h"
+#include "src/builtins/builtins.h"
+#include "src/codegen/code-factory.h"
+#include "src/heap/factory-inl.h"
+#include "src/objects/arguments.h"
+#include "src/objects/bigint.h"
+#include "src/objects/elements-kind.h"
+#include "src/objects/free-space.h"
+#include "src/objects/js-generator.h"
+#include "src/objects/js-promise.h"
+#include "src/objects/js-regexp-string-iterator.h"
+#include "src/objects/js-weak-refs.h"
+#include "src/objects/objects.h"
+#include "src/objects/source-text-module.h"
+#include "src/objects/stack-frame-info.h"
+#include "src/objects/synthetic-module.h"
+#include "src/objects/template-objects.h"
+#include "src/builtins/builtins-bigint-gen.h"
+#include "src/builtins/builtins-collections-gen.h"
+#include "src/builtins/builtins-data-view-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-iterator-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-string-gen.h"
+#include "src/builtins/builtins-string-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-constructor-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "torque-generated/../../deps/v8/src/builtins/arguments-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-copywithin-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-join-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-lastindexof-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-map-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-right-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reverse-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-shift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-splice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-unshift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/base-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/bigint-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/boolean-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/collections-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/data-view-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/extras-utils-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/frames-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/growable-fixed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/internal-coverage-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/math-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-fromentries-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-constructor-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-delete-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-has-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-is-extensible-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-prevent-extensions-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revocable-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revoke-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/reflect-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-exec-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-all-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-replace-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-search-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-source-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-split-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-test-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-endswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-html-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-pad-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-repeat-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-startswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-substring-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/torque-internal-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-createtypedarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduceright-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-subarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/third_party/v8/builtins/array-sort-tq-csa.h"
+#include "torque-generated/../../deps/v8/test/torque/test-torque-tq-csa.h"
+
+namespace v8 {
+namespace internal {
+
+const char* kBuiltinName_368(compiler::CodeAssemblerState* state_) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0);
+
+    ca_.Bind(&block0);
+return "%TypedArray%.prototype.filter";
+}
+
+TF_BUILTIN(TypedArrayPrototypeFilter, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  Node* argc = Parameter(Descriptor::kJSActualArgumentsCount);
+  TNode<IntPtrT> arguments_length(ChangeInt32ToIntPtr(argc));
+  TNode<RawPtrT> arguments_frame = UncheckedCast<RawPtrT>(LoadFramePointer());
+  TorqueStructArguments torque_arguments(GetFrameArguments(arguments_frame, arguments_length));
+  CodeStubArguments arguments(this, torque_arguments);
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = arguments.GetReceiver();
+USE(parameter1);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, JSTypedArray> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, JSTypedArray> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Number> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Number, Smi> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, Object> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, Object, JSReceiver> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi> block22(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi> block23(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Smi, Context, Smi, Object> block24(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Context, JSReceiver, Object, Object, Smi, JSTypedArray> block25(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object> block26(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object> block30(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object> block33(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object> block32(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object> block31(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object> block34(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object, IntPtrT, IntPtrT> block37(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object, IntPtrT, IntPtrT> block40(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object, IntPtrT, IntPtrT> block39(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object, IntPtrT, IntPtrT> block38(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object, IntPtrT, IntPtrT> block41(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object, IntPtrT, IntPtrT> block44(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object, IntPtrT, IntPtrT> block43(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object, IntPtrT, IntPtrT> block42(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object, IntPtrT, IntPtrT> block45(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object, IntPtrT, IntPtrT> block48(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object, IntPtrT, IntPtrT> block47(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object, IntPtrT, IntPtrT> block46(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object, IntPtrT, IntPtrT, FixedArray> block36(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object> block35(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object> block29(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block53(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block54(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block52(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT> block51(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block50(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object, FixedArray, IntPtrT, IntPtrT, IntPtrT, IntPtrT, HeapObject, IntPtrT> block49(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Object> block28(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object> block27(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, JSTypedArray, Context, JSTypedArray, Context, NativeContext, Map, IntPtrT, IntPtrT> block58(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, JSTypedArray, Context, JSTypedArray, Context, NativeContext, Map, IntPtrT, IntPtrT> block61(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, JSTypedArray, Context, JSTypedArray, Context, NativeContext, Map, IntPtrT, IntPtrT> block60(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, JSTypedArray, Context, JSTypedArray, Context, NativeContext, Map, IntPtrT, IntPtrT> block59(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, JSTypedArray, Context, JSTypedArray, Context, NativeContext, Map, IntPtrT, IntPtrT> block62(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, JSTypedArray, Context, JSTypedArray, Context, NativeContext, Map, IntPtrT, IntPtrT> block65(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, JSTypedArray, Context, JSTypedArray, Context, NativeContext, Map, IntPtrT, IntPtrT> block64(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, JSTypedArray, Context, JSTypedArray, Context, NativeContext, Map, IntPtrT, IntPtrT> block63(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, JSTypedArray, Context, JSTypedArray, Context, NativeContext, Map, IntPtrT, IntPtrT> block66(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, JSTypedArray, Context, JSTypedArray, Context, NativeContext, Map, IntPtrT, IntPtrT> block69(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, JSTypedArray, Context, JSTypedArray, Context, NativeContext, Map, IntPtrT, IntPtrT> block68(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, JSTypedArray, Context, JSTypedArray, Context, NativeContext, Map, IntPtrT, IntPtrT> block67(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, JSTypedArray, Context, JSTypedArray, Context, NativeContext, Map, IntPtrT, IntPtrT, FixedArray> block57(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Smi, JSReceiver, Object, FixedArray, IntPtrT, IntPtrT, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, JSTypedArray, Context, JSTypedArray, Context, JSArray> block56(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object> block2(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+    ca_.Goto(&block0, torque_arguments.frame, torque_arguments.base, torque_arguments.length, parameter0, parameter1);
+
+  if (block0.is_used()) {
+    TNode<RawPtrT> tmp0;
+    TNode<RawPtrT> tmp1;
+    TNode<IntPtrT> tmp2;
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 19);
+    TNode<JSTypedArray> tmp5;
+    USE(tmp5);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp5 = Cast12JSTypedArray_111(state_, TNode<Context>{tmp3}, TNode<Object>{tmp4}, &label0);
+    ca_.Goto(&block5, tmp0, tmp1, tmp2, tmp3, tmp4, tmp4, tmp5);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block6, tmp0, tmp1, tmp2, tmp3, tmp4, tmp4);
+    }
+  }
+
+  if (block6.is_used()) {
+    TNode<RawPtrT> tmp6;
+    TNode<RawPtrT> tmp7;
+    TNode<IntPtrT> tmp8;
+    TNode<Context> tmp9;
+    TNode<Object> tmp10;
+    TNode<Object> tmp11;
+    ca_.Bind(&block6, &tmp6, &tmp7, &tmp8, &tmp9, &tmp10, &tmp11);
+    ca_.Goto(&block4, tmp6, tmp7, tmp8, tmp9, tmp10);
+  }
+
+  if (block5.is_used()) {
+    TNode<RawPtrT> tmp12;
+    TNode<RawPtrT> tmp13;
+    TNode<IntPtrT> tmp14;
+    TNode<Context> tmp15;
+    TNode<Object> tmp16;
+    TNode<Object> tmp17;
+    TNode<JSTypedArray> tmp18;
+    ca_.Bind(&block5, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18);
+    ca_.Goto(&block3, tmp12, tmp13, tmp14, tmp15, tmp16, tmp18);
+  }
+
+  if (block4.is_used()) {
+    TNode<RawPtrT> tmp19;
+    TNode<RawPtrT> tmp20;
+    TNode<IntPtrT> tmp21;
+    TNode<Context> tmp22;
+    TNode<Object> tmp23;
+    ca_.Bind(&block4, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 20);
+    CodeStubAssembler(state_).ThrowTypeError(TNode<Context>{tmp22}, MessageTemplate::kNotTypedArray, kBuiltinName_368(state_));
+  }
+
+  if (block3.is_used()) {
+    TNode<RawPtrT> tmp24;
+    TNode<RawPtrT> tmp25;
+    TNode<IntPtrT> tmp26;
+    TNode<Context> tmp27;
+    TNode<Object> tmp28;
+    TNode<JSTypedArray> tmp29;
+    ca_.Bind(&block3, &tmp24, &tmp25, &tmp26, &tmp27, &tmp28, &tmp29);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 19);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 21);
+    TNode<JSTypedArray> tmp30;
+    USE(tmp30);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp30 = EnsureAttached_384(state_, TNode<JSTypedArray>{tmp29}, &label0);
+    ca_.Goto(&block7, tmp24, tmp25, tmp26, tmp27, tmp28, tmp29, tmp29, tmp30);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block8, tmp24, tmp25, tmp26, tmp27, tmp28, tmp29, tmp29);
+    }
+  }
+
+  if (block8.is_used()) {
+    TNode<RawPtrT> tmp31;
+    TNode<RawPtrT> tmp32;
+    TNode<IntPtrT> tmp33;
+    TNode<Context> tmp34;
+    TNode<Object> tmp35;
+    TNode<JSTypedArray> tmp36;
+    TNode<JSTypedArray> tmp37;
+    ca_.Bind(&block8, &tmp31, &tmp32, &tmp33, &tmp34, &tmp35, &tmp36, &tmp37);
+    ca_.Goto(&block2, tmp31, tmp32, tmp33, tmp34, tmp35);
+  }
+
+  if (block7.is_used()) {
+    TNode<RawPtrT> tmp38;
+    TNode<RawPtrT> tmp39;
+    TNode<IntPtrT> tmp40;
+    TNode<Context> tmp41;
+    TNode<Object> tmp42;
+    TNode<JSTypedArray> tmp43;
+    TNode<JSTypedArray> tmp44;
+    TNode<JSTypedArray> tmp45;
+    ca_.Bind(&block7, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44, &tmp45);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 25);
+    TNode<IntPtrT> tmp46 = ca_.IntPtrConstant(JSTypedArray::kLengthOffset);
+    USE(tmp46);
+    TNode<UintPtrT>tmp47 = CodeStubAssembler(state_).LoadReference<UintPtrT>(CodeStubAssembler::Reference{tmp45, tmp46});
+    TNode<Number> tmp48;
+    USE(tmp48);
+    tmp48 = Convert20UT5ATSmi10HeapNumber9ATuintptr_204(state_, TNode<UintPtrT>{tmp47});
+    TNode<Smi> tmp49;
+    USE(tmp49);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp49 = Cast5ATSmi_83(state_, TNode<Object>{tmp48}, &label0);
+    ca_.Goto(&block11, tmp38, tmp39, tmp40, tmp41, tmp42, tmp43, tmp45, tmp48, tmp49);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block12, tmp38, tmp39, tmp40, tmp41, tmp42, tmp43, tmp45, tmp48);
+    }
+  }
+
+  if (block12.is_used()) {
+    TNode<RawPtrT> tmp50;
+    TNode<RawPtrT> tmp51;
+    TNode<IntPtrT> tmp52;
+    TNode<Context> tmp53;
+    TNode<Object> tmp54;
+    TNode<JSTypedArray> tmp55;
+    TNode<JSTypedArray> tmp56;
+    TNode<Number> tmp57;
+    ca_.Bind(&block12, &tmp50, &tmp51, &tmp52, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57);
+    ca_.Goto(&block10, tmp50, tmp51, tmp52, tmp53, tmp54, tmp55, tmp56);
+  }
+
+  if (block11.is_used()) {
+    TNode<RawPtrT> tmp58;
+    TNode<RawPtrT> tmp59;
+    TNode<IntPtrT> tmp60;
+    TNode<Context> tmp61;
+    TNode<Object> tmp62;
+    TNode<JSTypedArray> tmp63;
+    TNode<JSTypedArray> tmp64;
+    TNode<Number> tmp65;
+    TNode<Smi> tmp66;
+    ca_.Bind(&block11, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66);
+    ca_.Goto(&block9, tmp58, tmp59, tmp60, tmp61, tmp62, tmp63, tmp64, tmp66);
+  }
+
+  if (block10.is_used()) {
+    TNode<RawPtrT> tmp67;
+    TNode<RawPtrT> tmp68;
+    TNode<IntPtrT> tmp69;
+    TNode<Context> tmp70;
+    TNode<Object> tmp71;
+    TNode<JSTypedArray> tmp72;
+    TNode<JSTypedArray> tmp73;
+    ca_.Bind(&block10, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block9.is_used()) {
+    TNode<RawPtrT> tmp74;
+    TNode<RawPtrT> tmp75;
+    TNode<IntPtrT> tmp76;
+    TNode<Context> tmp77;
+    TNode<Object> tmp78;
+    TNode<JSTypedArray> tmp79;
+    TNode<JSTypedArray> tmp80;
+    TNode<Smi> tmp81;
+    ca_.Bind(&block9, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 28);
+    TNode<IntPtrT> tmp82;
+    USE(tmp82);
+    tmp82 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<Object> tmp83;
+    USE(tmp83);
+    tmp83 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp74}, TNode<RawPtrT>{tmp75}, TNode<IntPtrT>{tmp76}}, TNode<IntPtrT>{tmp82});
+    TNode<JSReceiver> tmp84;
+    USE(tmp84);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp84 = Cast71UT19ATCallableApiObject17ATCallableJSProxy15JSBoundFunction10JSFunction_1366(state_, TNode<Context>{tmp77}, TNode<Object>{tmp83}, &label0);
+    ca_.Goto(&block15, tmp74, tmp75, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp83, tmp84);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block16, tmp74, tmp75, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp83);
+    }
+  }
+
+  if (block16.is_used()) {
+    TNode<RawPtrT> tmp85;
+    TNode<RawPtrT> tmp86;
+    TNode<IntPtrT> tmp87;
+    TNode<Context> tmp88;
+    TNode<Object> tmp89;
+    TNode<JSTypedArray> tmp90;
+    TNode<JSTypedArray> tmp91;
+    TNode<Smi> tmp92;
+    TNode<Object> tmp93;
+    ca_.Bind(&block16, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93);
+    ca_.Goto(&block14, tmp85, tmp86, tmp87, tmp88, tmp89, tmp90, tmp91, tmp92);
+  }
+
+  if (block15.is_used()) {
+    TNode<RawPtrT> tmp94;
+    TNode<RawPtrT> tmp95;
+    TNode<IntPtrT> tmp96;
+    TNode<Context> tmp97;
+    TNode<Object> tmp98;
+    TNode<JSTypedArray> tmp99;
+    TNode<JSTypedArray> tmp100;
+    TNode<Smi> tmp101;
+    TNode<Object> tmp102;
+    TNode<JSReceiver> tmp103;
+    ca_.Bind(&block15, &tmp94, &tmp95, &tmp96, &tmp97, &tmp98, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103);
+    ca_.Goto(&block13, tmp94, tmp95, tmp96, tmp97, tmp98, tmp99, tmp100, tmp101, tmp103);
+  }
+
+  if (block14.is_used()) {
+    TNode<RawPtrT> tmp104;
+    TNode<RawPtrT> tmp105;
+    TNode<IntPtrT> tmp106;
+    TNode<Context> tmp107;
+    TNode<Object> tmp108;
+    TNode<JSTypedArray> tmp109;
+    TNode<JSTypedArray> tmp110;
+    TNode<Smi> tmp111;
+    ca_.Bind(&block14, &tmp104, &tmp105, &tmp106, &tmp107, &tmp108, &tmp109, &tmp110, &tmp111);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 29);
+    TNode<IntPtrT> tmp112;
+    USE(tmp112);
+    tmp112 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<Object> tmp113;
+    USE(tmp113);
+    tmp113 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp104}, TNode<RawPtrT>{tmp105}, TNode<IntPtrT>{tmp106}}, TNode<IntPtrT>{tmp112});
+    CodeStubAssembler(state_).ThrowTypeError(TNode<Context>{tmp107}, MessageTemplate::kCalledNonCallable, TNode<Object>{tmp113});
+  }
+
+  if (block13.is_used()) {
+    TNode<RawPtrT> tmp114;
+    TNode<RawPtrT> tmp115;
+    TNode<IntPtrT> tmp116;
+    TNode<Context> tmp117;
+    TNode<Object> tmp118;
+    TNode<JSTypedArray> tmp119;
+    TNode<JSTypedArray> tmp120;
+    TNode<Smi> tmp121;
+    TNode<JSReceiver> tmp122;
+    ca_.Bind(&block13, &tmp114, &tmp115, &tmp116, &tmp117, &tmp118, &tmp119, &tmp120, &tmp121, &tmp122);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 32);
+    TNode<IntPtrT> tmp123;
+    USE(tmp123);
+    tmp123 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<Object> tmp124;
+    USE(tmp124);
+    tmp124 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp114}, TNode<RawPtrT>{tmp115}, TNode<IntPtrT>{tmp116}}, TNode<IntPtrT>{tmp123});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 35);
+    TNode<FixedArray> tmp125;
+    USE(tmp125);
+    TNode<IntPtrT> tmp126;
+    USE(tmp126);
+    TNode<IntPtrT> tmp127;
+    USE(tmp127);
+    std::tie(tmp125, tmp126, tmp127) = NewGrowableFixedArray_308(state_).Flatten();
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 36);
+    TNode<JSTypedArray> tmp128;
+    USE(tmp128);
+    TNode<JSTypedArray> tmp129;
+    USE(tmp129);
+    TNode<BuiltinPtr> tmp130;
+    USE(tmp130);
+    std::tie(tmp128, tmp129, tmp130) = NewAttachedJSTypedArrayWitness_385(state_, TNode<JSTypedArray>{tmp120}).Flatten();
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 41);
+    TNode<Smi> tmp131;
+    USE(tmp131);
+    tmp131 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 0);
+    ca_.Goto(&block19, tmp114, tmp115, tmp116, tmp117, tmp118, tmp119, tmp120, tmp121, tmp122, tmp124, tmp125, tmp126, tmp127, tmp128, tmp129, tmp130, tmp131);
+  }
+
+  if (block19.is_used()) {
+    TNode<RawPtrT> tmp132;
+    TNode<RawPtrT> tmp133;
+    TNode<IntPtrT> tmp134;
+    TNode<Context> tmp135;
+    TNode<Object> tmp136;
+    TNode<JSTypedArray> tmp137;
+    TNode<JSTypedArray> tmp138;
+    TNode<Smi> tmp139;
+    TNode<JSReceiver> tmp140;
+    TNode<Object> tmp141;
+    TNode<FixedArray> tmp142;
+    TNode<IntPtrT> tmp143;
+    TNode<IntPtrT> tmp144;
+    TNode<JSTypedArray> tmp145;
+    TNode<JSTypedArray> tmp146;
+    TNode<BuiltinPtr> tmp147;
+    TNode<Smi> tmp148;
+    ca_.Bind(&block19, &tmp132, &tmp133, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138, &tmp139, &tmp140, &tmp141, &tmp142, &tmp143, &tmp144, &tmp145, &tmp146, &tmp147, &tmp148);
+    TNode<BoolT> tmp149;
+    USE(tmp149);
+    tmp149 = CodeStubAssembler(state_).SmiLessThan(TNode<Smi>{tmp148}, TNode<Smi>{tmp139});
+    ca_.Branch(tmp149, &block17, &block18, tmp132, tmp133, tmp134, tmp135, tmp136, tmp137, tmp138, tmp139, tmp140, tmp141, tmp142, tmp143, tmp144, tmp145, tmp146, tmp147, tmp148);
+  }
+
+  if (block17.is_used()) {
+    TNode<RawPtrT> tmp150;
+    TNode<RawPtrT> tmp151;
+    TNode<IntPtrT> tmp152;
+    TNode<Context> tmp153;
+    TNode<Object> tmp154;
+    TNode<JSTypedArray> tmp155;
+    TNode<JSTypedArray> tmp156;
+    TNode<Smi> tmp157;
+    TNode<JSReceiver> tmp158;
+    TNode<Object> tmp159;
+    TNode<FixedArray> tmp160;
+    TNode<IntPtrT> tmp161;
+    TNode<IntPtrT> tmp162;
+    TNode<JSTypedArray> tmp163;
+    TNode<JSTypedArray> tmp164;
+    TNode<BuiltinPtr> tmp165;
+    TNode<Smi> tmp166;
+    ca_.Bind(&block17, &tmp150, &tmp151, &tmp152, &tmp153, &tmp154, &tmp155, &tmp156, &tmp157, &tmp158, &tmp159, &tmp160, &tmp161, &tmp162, &tmp163, &tmp164, &tmp165, &tmp166);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array.tq", 104);
+    TNode<IntPtrT> tmp167 = ca_.IntPtrConstant(JSArrayBufferView::kBufferOffset);
+    USE(tmp167);
+    TNode<JSArrayBuffer>tmp168 = CodeStubAssembler(state_).LoadReference<JSArrayBuffer>(CodeStubAssembler::Reference{tmp163, tmp167});
+    TNode<BoolT> tmp169;
+    USE(tmp169);
+    tmp169 = CodeStubAssembler(state_).IsDetachedBuffer(TNode<JSArrayBuffer>{tmp168});
+    ca_.Branch(tmp169, &block22, &block23, tmp150, tmp151, tmp152, tmp153, tmp154, tmp155, tmp156, tmp157, tmp158, tmp159, tmp160, tmp161, tmp162, tmp163, tmp164, tmp165, tmp166);
+  }
+
+  if (block22.is_used()) {
+    TNode<RawPtrT> tmp170;
+    TNode<RawPtrT> tmp171;
+    TNode<IntPtrT> tmp172;
+    TNode<Context> tmp173;
+    TNode<Object> tmp174;
+    TNode<JSTypedArray> tmp175;
+    TNode<JSTypedArray> tmp176;
+    TNode<Smi> tmp177;
+    TNode<JSReceiver> tmp178;
+    TNode<Object> tmp179;
+    TNode<FixedArray> tmp180;
+    TNode<IntPtrT> tmp181;
+    TNode<IntPtrT> tmp182;
+    TNode<JSTypedArray> tmp183;
+    TNode<JSTypedArray> tmp184;
+    TNode<BuiltinPtr> tmp185;
+    TNode<Smi> tmp186;
+    ca_.Bind(&block22, &tmp170, &tmp171, &tmp172, &tmp173, &tmp174, &tmp175, &tmp176, &tmp177, &tmp178, &tmp179, &tmp180, &tmp181, &tmp182, &tmp183, &tmp184, &tmp185, &tmp186);
+    ca_.Goto(&block2, tmp170, tmp171, tmp172, tmp173, tmp174);
+  }
+
+  if (block23.is_used()) {
+    TNode<RawPtrT> tmp187;
+    TNode<RawPtrT> tmp188;
+    TNode<IntPtrT> tmp189;
+    TNode<Context> tmp190;
+    TNode<Object> tmp191;
+    TNode<JSTypedArray> tmp192;
+    TNode<JSTypedArray> tmp193;
+    TNode<Smi> tmp194;
+    TNode<JSReceiver> tmp195;
+    TNode<Object> tmp196;
+    TNode<FixedArray> tmp197;
+    TNode<IntPtrT> tmp198;
+    TNode<IntPtrT> tmp199;
+    TNode<JSTypedArray> tmp200;
+    TNode<JSTypedArray> tmp201;
+    TNode<BuiltinPtr> tmp202;
+    TNode<Smi> tmp203;
+    ca_.Bind(&block23, &tmp187, &tmp188, &tmp189, &tmp190, &tmp191, &tmp192, &tmp193, &tmp194, &tmp195, &tmp196, &tmp197, &tmp198, &tmp199, &tmp200, &tmp201, &tmp202, &tmp203);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array.tq", 105);
+    TNode<JSTypedArray> tmp204;
+    USE(tmp204);
+    tmp204 = (TNode<JSTypedArray>{tmp200});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 42);
+    ca_.Goto(&block21, tmp187, tmp188, tmp189, tmp190, tmp191, tmp192, tmp193, tmp194, tmp195, tmp196, tmp197, tmp198, tmp199, tmp200, tmp204, tmp202, tmp203);
+  }
+
+  if (block21.is_used()) {
+    TNode<RawPtrT> tmp205;
+    TNode<RawPtrT> tmp206;
+    TNode<IntPtrT> tmp207;
+    TNode<Context> tmp208;
+    TNode<Object> tmp209;
+    TNode<JSTypedArray> tmp210;
+    TNode<JSTypedArray> tmp211;
+    TNode<Smi> tmp212;
+    TNode<JSReceiver> tmp213;
+    TNode<Object> tmp214;
+    TNode<FixedArray> tmp215;
+    TNode<IntPtrT> tmp216;
+    TNode<IntPtrT> tmp217;
+    TNode<JSTypedArray> tmp218;
+    TNode<JSTypedArray> tmp219;
+    TNode<BuiltinPtr> tmp220;
+    TNode<Smi> tmp221;
+    ca_.Bind(&block21, &tmp205, &tmp206, &tmp207, &tmp208, &tmp209, &tmp210, &tmp211, &tmp212, &tmp213, &tmp214, &tmp215, &tmp216, &tmp217, &tmp218, &tmp219, &tmp220, &tmp221);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 46);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array.tq", 109);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array.tq", 110);
+    TNode<Object> tmp222 = CodeStubAssembler(state_).CallBuiltinPointer(Builtins::CallableFor(ca_.isolate(),ExampleBuiltinForTorqueFunctionPointerType(1)).descriptor(), tmp220, tmp208, tmp219, tmp221); 
+    USE(tmp222);
+    ca_.Goto(&block24, tmp205, tmp206, tmp207, tmp208, tmp209, tmp210, tmp211, tmp212, tmp213, tmp214, tmp215, tmp216, tmp217, tmp218, tmp219, tmp220, tmp221, tmp221, tmp208, tmp221, tmp222);
+  }
+
+  if (block24.is_used()) {
+    TNode<RawPtrT> tmp223;
+    TNode<RawPtrT> tmp224;
+    TNode<IntPtrT> tmp225;
+    TNode<Context> tmp226;
+    TNode<Object> tmp227;
+    TNode<JSTypedArray> tmp228;
+    TNode<JSTypedArray> tmp229;
+    TNode<Smi> tmp230;
+    TNode<JSReceiver> tmp231;
+    TNode<Object> tmp232;
+    TNode<FixedArray> tmp233;
+    TNode<IntPtrT> tmp234;
+    TNode<IntPtrT> tmp235;
+    TNode<JSTypedArray> tmp236;
+    TNode<JSTypedArray> tmp237;
+    TNode<BuiltinPtr> tmp238;
+    TNode<Smi> tmp239;
+    TNode<Smi> tmp240;
+    TNode<Context> tmp241;
+    TNode<Smi> tmp242;
+    TNode<Object> tmp243;
+    ca_.Bind(&block24, &tmp223, &tmp224, &tmp225, &tmp226, &tmp227, &tmp228, &tmp229, &tmp230, &tmp231, &tmp232, &tmp233, &tmp234, &tmp235, &tmp236, &tmp237, &tmp238, &tmp239, &tmp240, &tmp241, &tmp242, &tmp243);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 46);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 51);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array.tq", 100);
+    ca_.Goto(&block25, tmp223, tmp224, tmp225, tmp226, tmp227, tmp228, tmp229, tmp230, tmp231, tmp232, tmp233, tmp234, tmp235, tmp236, tmp237, tmp238, tmp239, tmp243, tmp226, tmp231, tmp232, tmp243, tmp239, tmp236);
+  }
+
+  if (block25.is_used()) {
+    TNode<RawPtrT> tmp244;
+    TNode<RawPtrT> tmp245;
+    TNode<IntPtrT> tmp246;
+    TNode<Context> tmp247;
+    TNode<Object> tmp248;
+    TNode<JSTypedArray> tmp249;
+    TNode<JSTypedArray> tmp250;
+    TNode<Smi> tmp251;
+    TNode<JSReceiver> tmp252;
+    TNode<Object> tmp253;
+    TNode<FixedArray> tmp254;
+    TNode<IntPtrT> tmp255;
+    TNode<IntPtrT> tmp256;
+    TNode<JSTypedArray> tmp257;
+    TNode<JSTypedArray> tmp258;
+    TNode<BuiltinPtr> tmp259;
+    TNode<Smi> tmp260;
+    TNode<Object> tmp261;
+    TNode<Context> tmp262;
+    TNode<JSReceiver> tmp263;
+    TNode<Object> tmp264;
+    TNode<Object> tmp265;
+    TNode<Smi> tmp266;
+    TNode<JSTypedArray> tmp267;
+    ca_.Bind(&block25, &tmp244, &tmp245, &tmp246, &tmp247, &tmp248, &tmp249, &tmp250, &tmp251, &tmp252, &tmp253, &tmp254, &tmp255, &tmp256, &tmp257, &tmp258, &tmp259, &tmp260, &tmp261, &tmp262, &tmp263, &tmp264, &tmp265, &tmp266, &tmp267);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 51);
+    TNode<Object> tmp268;
+    USE(tmp268);
+    tmp268 = CodeStubAssembler(state_).Call(TNode<Context>{tmp262}, TNode<JSReceiver>{tmp263}, TNode<Object>{tmp264}, TNode<Object>{tmp265}, TNode<Object>{tmp266}, TNode<Object>{tmp267});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 50);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 56);
+    TNode<BoolT> tmp269;
+    USE(tmp269);
+    tmp269 = ToBoolean_243(state_, TNode<Object>{tmp268});
+    ca_.Branch(tmp269, &block26, &block27, tmp244, tmp245, tmp246, tmp247, tmp248, tmp249, tmp250, tmp251, tmp252, tmp253, tmp254, tmp255, tmp256, tmp257, tmp258, tmp259, tmp260, tmp261, tmp268);
+  }
+
+  if (block26.is_used()) {
+    TNode<RawPtrT> tmp270;
+    TNode<RawPtrT> tmp271;
+    TNode<IntPtrT> tmp272;
+    TNode<Context> tmp273;
+    TNode<Object> tmp274;
+    TNode<JSTypedArray> tmp275;
+    TNode<JSTypedArray> tmp276;
+    TNode<Smi> tmp277;
+    TNode<JSReceiver> tmp278;
+    TNode<Object> tmp279;
+    TNode<FixedArray> tmp280;
+    TNode<IntPtrT> tmp281;
+    TNode<IntPtrT> tmp282;
+    TNode<JSTypedArray> tmp283;
+    TNode<JSTypedArray> tmp284;
+    TNode<BuiltinPtr> tmp285;
+    TNode<Smi> tmp286;
+    TNode<Object> tmp287;
+    TNode<Object> tmp288;
+    ca_.Bind(&block26, &tmp270, &tmp271, &tmp272, &tmp273, &tmp274, &tmp275, &tmp276, &tmp277, &tmp278, &tmp279, &tmp280, &tmp281, &tmp282, &tmp283, &tmp284, &tmp285, &tmp286, &tmp287, &tmp288);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 21);
+    ca_.Goto(&block31, tmp270, tmp271, tmp272, tmp273, tmp274, tmp275, tmp276, tmp277, tmp278, tmp279, tmp280, tmp281, tmp282, tmp283, tmp284, tmp285, tmp286, tmp287, tmp288, tmp287, tmp287);
+  }
+
+  if (block30.is_used()) {
+    TNode<RawPtrT> tmp289;
+    TNode<RawPtrT> tmp290;
+    TNode<IntPtrT> tmp291;
+    TNode<Context> tmp292;
+    TNode<Object> tmp293;
+    TNode<JSTypedArray> tmp294;
+    TNode<JSTypedArray> tmp295;
+    TNode<Smi> tmp296;
+    TNode<JSReceiver> tmp297;
+    TNode<Object> tmp298;
+    TNode<FixedArray> tmp299;
+    TNode<IntPtrT> tmp300;
+    TNode<IntPtrT> tmp301;
+    TNode<JSTypedArray> tmp302;
+    TNode<JSTypedArray> tmp303;
+    TNode<BuiltinPtr> tmp304;
+    TNode<Smi> tmp305;
+    TNode<Object> tmp306;
+    TNode<Object> tmp307;
+    TNode<Object> tmp308;
+    TNode<Object> tmp309;
+    ca_.Bind(&block30, &tmp289, &tmp290, &tmp291, &tmp292, &tmp293, &tmp294, &tmp295, &tmp296, &tmp297, &tmp298, &tmp299, &tmp300, &tmp301, &tmp302, &tmp303, &tmp304, &tmp305, &tmp306, &tmp307, &tmp308, &tmp309);
+    TNode<BoolT> tmp310;
+    USE(tmp310);
+    tmp310 = CodeStubAssembler(state_).IntPtrLessThanOrEqual(TNode<IntPtrT>{tmp301}, TNode<IntPtrT>{tmp300});
+    ca_.Branch(tmp310, &block32, &block33, tmp289, tmp290, tmp291, tmp292, tmp293, tmp294, tmp295, tmp296, tmp297, tmp298, tmp299, tmp300, tmp301, tmp302, tmp303, tmp304, tmp305, tmp306, tmp307, tmp308, tmp309);
+  }
+
+  if (block33.is_used()) {
+    TNode<RawPtrT> tmp311;
+    TNode<RawPtrT> tmp312;
+    TNode<IntPtrT> tmp313;
+    TNode<Context> tmp314;
+    TNode<Object> tmp315;
+    TNode<JSTypedArray> tmp316;
+    TNode<JSTypedArray> tmp317;
+    TNode<Smi> tmp318;
+    TNode<JSReceiver> tmp319;
+    TNode<Object> tmp320;
+    TNode<FixedArray> tmp321;
+    TNode<IntPtrT> tmp322;
+    TNode<IntPtrT> tmp323;
+    TNode<JSTypedArray> tmp324;
+    TNode<JSTypedArray> tmp325;
+    TNode<BuiltinPtr> tmp326;
+    TNode<Smi> tmp327;
+    TNode<Object> tmp328;
+    TNode<Object> tmp329;
+    TNode<Object> tmp330;
+    TNode<Object> tmp331;
+    ca_.Bind(&block33, &tmp311, &tmp312, &tmp313, &tmp314, &tmp315, &tmp316, &tmp317, &tmp318, &tmp319, &tmp320, &tmp321, &tmp322, &tmp323, &tmp324, &tmp325, &tmp326, &tmp327, &tmp328, &tmp329, &tmp330, &tmp331);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'this.length <= this.capacity' failed", "../../deps/v8/src/builtins/growable-fixed-array.tq", 21);
+  }
+
+  if (block32.is_used()) {
+    TNode<RawPtrT> tmp332;
+    TNode<RawPtrT> tmp333;
+    TNode<IntPtrT> tmp334;
+    TNode<Context> tmp335;
+    TNode<Object> tmp336;
+    TNode<JSTypedArray> tmp337;
+    TNode<JSTypedArray> tmp338;
+    TNode<Smi> tmp339;
+    TNode<JSReceiver> tmp340;
+    TNode<Object> tmp341;
+    TNode<FixedArray> tmp342;
+    TNode<IntPtrT> tmp343;
+    TNode<IntPtrT> tmp344;
+    TNode<JSTypedArray> tmp345;
+    TNode<JSTypedArray> tmp346;
+    TNode<BuiltinPtr> tmp347;
+    TNode<Smi> tmp348;
+    TNode<Object> tmp349;
+    TNode<Object> tmp350;
+    TNode<Object> tmp351;
+    TNode<Object> tmp352;
+    ca_.Bind(&block32, &tmp332, &tmp333, &tmp334, &tmp335, &tmp336, &tmp337, &tmp338, &tmp339, &tmp340, &tmp341, &tmp342, &tmp343, &tmp344, &tmp345, &tmp346, &tmp347, &tmp348, &tmp349, &tmp350, &tmp351, &tmp352);
+  }
+
+  if (block31.is_used()) {
+    TNode<RawPtrT> tmp353;
+    TNode<RawPtrT> tmp354;
+    TNode<IntPtrT> tmp355;
+    TNode<Context> tmp356;
+    TNode<Object> tmp357;
+    TNode<JSTypedArray> tmp358;
+    TNode<JSTypedArray> tmp359;
+    TNode<Smi> tmp360;
+    TNode<JSReceiver> tmp361;
+    TNode<Object> tmp362;
+    TNode<FixedArray> tmp363;
+    TNode<IntPtrT> tmp364;
+    TNode<IntPtrT> tmp365;
+    TNode<JSTypedArray> tmp366;
+    TNode<JSTypedArray> tmp367;
+    TNode<BuiltinPtr> tmp368;
+    TNode<Smi> tmp369;
+    TNode<Object> tmp370;
+    TNode<Object> tmp371;
+    TNode<Object> tmp372;
+    TNode<Object> tmp373;
+    ca_.Bind(&block31, &tmp353, &tmp354, &tmp355, &tmp356, &tmp357, &tmp358, &tmp359, &tmp360, &tmp361, &tmp362, &tmp363, &tmp364, &tmp365, &tmp366, &tmp367, &tmp368, &tmp369, &tmp370, &tmp371, &tmp372, &tmp373);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 22);
+    TNode<BoolT> tmp374;
+    USE(tmp374);
+    tmp374 = CodeStubAssembler(state_).WordEqual(TNode<IntPtrT>{tmp364}, TNode<IntPtrT>{tmp365});
+    ca_.Branch(tmp374, &block34, &block35, tmp353, tmp354, tmp355, tmp356, tmp357, tmp358, tmp359, tmp360, tmp361, tmp362, tmp363, tmp364, tmp365, tmp366, tmp367, tmp368, tmp369, tmp370, tmp371, tmp372, tmp373);
+  }
+
+  if (block34.is_used()) {
+    TNode<RawPtrT> tmp375;
+    TNode<RawPtrT> tmp376;
+    TNode<IntPtrT> tmp377;
+    TNode<Context> tmp378;
+    TNode<Object> tmp379;
+    TNode<JSTypedArray> tmp380;
+    TNode<JSTypedArray> tmp381;
+    TNode<Smi> tmp382;
+    TNode<JSReceiver> tmp383;
+    TNode<Object> tmp384;
+    TNode<FixedArray> tmp385;
+    TNode<IntPtrT> tmp386;
+    TNode<IntPtrT> tmp387;
+    TNode<JSTypedArray> tmp388;
+    TNode<JSTypedArray> tmp389;
+    TNode<BuiltinPtr> tmp390;
+    TNode<Smi> tmp391;
+    TNode<Object> tmp392;
+    TNode<Object> tmp393;
+    TNode<Object> tmp394;
+    TNode<Object> tmp395;
+    ca_.Bind(&block34, &tmp375, &tmp376, &tmp377, &tmp378, &tmp379, &tmp380, &tmp381, &tmp382, &tmp383, &tmp384, &tmp385, &tmp386, &tmp387, &tmp388, &tmp389, &tmp390, &tmp391, &tmp392, &tmp393, &tmp394, &tmp395);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 25);
+    TNode<IntPtrT> tmp396;
+    USE(tmp396);
+    tmp396 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<IntPtrT> tmp397;
+    USE(tmp397);
+    tmp397 = CodeStubAssembler(state_).WordSar(TNode<IntPtrT>{tmp386}, TNode<IntPtrT>{tmp396});
+    TNode<IntPtrT> tmp398;
+    USE(tmp398);
+    tmp398 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp386}, TNode<IntPtrT>{tmp397});
+    TNode<IntPtrT> tmp399;
+    USE(tmp399);
+    tmp399 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 16);
+    TNode<IntPtrT> tmp400;
+    USE(tmp400);
+    tmp400 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp398}, TNode<IntPtrT>{tmp399});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 26);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 13);
+    ca_.Goto(&block38, tmp375, tmp376, tmp377, tmp378, tmp379, tmp380, tmp381, tmp382, tmp383, tmp384, tmp385, tmp400, tmp387, tmp388, tmp389, tmp390, tmp391, tmp392, tmp393, tmp394, tmp395, tmp400, tmp400);
+  }
+
+  if (block37.is_used()) {
+    TNode<RawPtrT> tmp401;
+    TNode<RawPtrT> tmp402;
+    TNode<IntPtrT> tmp403;
+    TNode<Context> tmp404;
+    TNode<Object> tmp405;
+    TNode<JSTypedArray> tmp406;
+    TNode<JSTypedArray> tmp407;
+    TNode<Smi> tmp408;
+    TNode<JSReceiver> tmp409;
+    TNode<Object> tmp410;
+    TNode<FixedArray> tmp411;
+    TNode<IntPtrT> tmp412;
+    TNode<IntPtrT> tmp413;
+    TNode<JSTypedArray> tmp414;
+    TNode<JSTypedArray> tmp415;
+    TNode<BuiltinPtr> tmp416;
+    TNode<Smi> tmp417;
+    TNode<Object> tmp418;
+    TNode<Object> tmp419;
+    TNode<Object> tmp420;
+    TNode<Object> tmp421;
+    TNode<IntPtrT> tmp422;
+    TNode<IntPtrT> tmp423;
+    ca_.Bind(&block37, &tmp401, &tmp402, &tmp403, &tmp404, &tmp405, &tmp406, &tmp407, &tmp408, &tmp409, &tmp410, &tmp411, &tmp412, &tmp413, &tmp414, &tmp415, &tmp416, &tmp417, &tmp418, &tmp419, &tmp420, &tmp421, &tmp422, &tmp423);
+    TNode<IntPtrT> tmp424;
+    USE(tmp424);
+    tmp424 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<BoolT> tmp425;
+    USE(tmp425);
+    tmp425 = CodeStubAssembler(state_).IntPtrGreaterThanOrEqual(TNode<IntPtrT>{tmp413}, TNode<IntPtrT>{tmp424});
+    ca_.Branch(tmp425, &block39, &block40, tmp401, tmp402, tmp403, tmp404, tmp405, tmp406, tmp407, tmp408, tmp409, tmp410, tmp411, tmp412, tmp413, tmp414, tmp415, tmp416, tmp417, tmp418, tmp419, tmp420, tmp421, tmp422, tmp423);
+  }
+
+  if (block40.is_used()) {
+    TNode<RawPtrT> tmp426;
+    TNode<RawPtrT> tmp427;
+    TNode<IntPtrT> tmp428;
+    TNode<Context> tmp429;
+    TNode<Object> tmp430;
+    TNode<JSTypedArray> tmp431;
+    TNode<JSTypedArray> tmp432;
+    TNode<Smi> tmp433;
+    TNode<JSReceiver> tmp434;
+    TNode<Object> tmp435;
+    TNode<FixedArray> tmp436;
+    TNode<IntPtrT> tmp437;
+    TNode<IntPtrT> tmp438;
+    TNode<JSTypedArray> tmp439;
+    TNode<JSTypedArray> tmp440;
+    TNode<BuiltinPtr> tmp441;
+    TNode<Smi> tmp442;
+    TNode<Object> tmp443;
+    TNode<Object> tmp444;
+    TNode<Object> tmp445;
+    TNode<Object> tmp446;
+    TNode<IntPtrT> tmp447;
+    TNode<IntPtrT> tmp448;
+    ca_.Bind(&block40, &tmp426, &tmp427, &tmp428, &tmp429, &tmp430, &tmp431, &tmp432, &tmp433, &tmp434, &tmp435, &tmp436, &tmp437, &tmp438, &tmp439, &tmp440, &tmp441, &tmp442, &tmp443, &tmp444, &tmp445, &tmp446, &tmp447, &tmp448);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'this.length >= 0' failed", "../../deps/v8/src/builtins/growable-fixed-array.tq", 13);
+  }
+
+  if (block39.is_used()) {
+    TNode<RawPtrT> tmp449;
+    TNode<RawPtrT> tmp450;
+    TNode<IntPtrT> tmp451;
+    TNode<Context> tmp452;
+    TNode<Object> tmp453;
+    TNode<JSTypedArray> tmp454;
+    TNode<JSTypedArray> tmp455;
+    TNode<Smi> tmp456;
+    TNode<JSReceiver> tmp457;
+    TNode<Object> tmp458;
+    TNode<FixedArray> tmp459;
+    TNode<IntPtrT> tmp460;
+    TNode<IntPtrT> tmp461;
+    TNode<JSTypedArray> tmp462;
+    TNode<JSTypedArray> tmp463;
+    TNode<BuiltinPtr> tmp464;
+    TNode<Smi> tmp465;
+    TNode<Object> tmp466;
+    TNode<Object> tmp467;
+    TNode<Object> tmp468;
+    TNode<Object> tmp469;
+    TNode<IntPtrT> tmp470;
+    TNode<IntPtrT> tmp471;
+    ca_.Bind(&block39, &tmp449, &tmp450, &tmp451, &tmp452, &tmp453, &tmp454, &tmp455, &tmp456, &tmp457, &tmp458, &tmp459, &tmp460, &tmp461, &tmp462, &tmp463, &tmp464, &tmp465, &tmp466, &tmp467, &tmp468, &tmp469, &tmp470, &tmp471);
+  }
+
+  if (block38.is_used()) {
+    TNode<RawPtrT> tmp472;
+    TNode<RawPtrT> tmp473;
+    TNode<IntPtrT> tmp474;
+    TNode<Context> tmp475;
+    TNode<Object> tmp476;
+    TNode<JSTypedArray> tmp477;
+    TNode<JSTypedArray> tmp478;
+    TNode<Smi> tmp479;
+    TNode<JSReceiver> tmp480;
+    TNode<Object> tmp481;
+    TNode<FixedArray> tmp482;
+    TNode<IntPtrT> tmp483;
+    TNode<IntPtrT> tmp484;
+    TNode<JSTypedArray> tmp485;
+    TNode<JSTypedArray> tmp486;
+    TNode<BuiltinPtr> tmp487;
+    TNode<Smi> tmp488;
+    TNode<Object> tmp489;
+    TNode<Object> tmp490;
+    TNode<Object> tmp491;
+    TNode<Object> tmp492;
+    TNode<IntPtrT> tmp493;
+    TNode<IntPtrT> tmp494;
+    ca_.Bind(&block38, &tmp472, &tmp473, &tmp474, &tmp475, &tmp476, &tmp477, &tmp478, &tmp479, &tmp480, &tmp481, &tmp482, &tmp483, &tmp484, &tmp485, &tmp486, &tmp487, &tmp488, &tmp489, &tmp490, &tmp491, &tmp492, &tmp493, &tmp494);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 14);
+    ca_.Goto(&block42, tmp472, tmp473, tmp474, tmp475, tmp476, tmp477, tmp478, tmp479, tmp480, tmp481, tmp482, tmp483, tmp484, tmp485, tmp486, tmp487, tmp488, tmp489, tmp490, tmp491, tmp492, tmp493, tmp494);
+  }
+
+  if (block41.is_used()) {
+    TNode<RawPtrT> tmp495;
+    TNode<RawPtrT> tmp496;
+    TNode<IntPtrT> tmp497;
+    TNode<Context> tmp498;
+    TNode<Object> tmp499;
+    TNode<JSTypedArray> tmp500;
+    TNode<JSTypedArray> tmp501;
+    TNode<Smi> tmp502;
+    TNode<JSReceiver> tmp503;
+    TNode<Object> tmp504;
+    TNode<FixedArray> tmp505;
+    TNode<IntPtrT> tmp506;
+    TNode<IntPtrT> tmp507;
+    TNode<JSTypedArray> tmp508;
+    TNode<JSTypedArray> tmp509;
+    TNode<BuiltinPtr> tmp510;
+    TNode<Smi> tmp511;
+    TNode<Object> tmp512;
+    TNode<Object> tmp513;
+    TNode<Object> tmp514;
+    TNode<Object> tmp515;
+    TNode<IntPtrT> tmp516;
+    TNode<IntPtrT> tmp517;
+    ca_.Bind(&block41, &tmp495, &tmp496, &tmp497, &tmp498, &tmp499, &tmp500, &tmp501, &tmp502, &tmp503, &tmp504, &tmp505, &tmp506, &tmp507, &tmp508, &tmp509, &tmp510, &tmp511, &tmp512, &tmp513, &tmp514, &tmp515, &tmp516, &tmp517);
+    TNode<IntPtrT> tmp518;
+    USE(tmp518);
+    tmp518 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<BoolT> tmp519;
+    USE(tmp519);
+    tmp519 = CodeStubAssembler(state_).IntPtrGreaterThanOrEqual(TNode<IntPtrT>{tmp517}, TNode<IntPtrT>{tmp518});
+    ca_.Branch(tmp519, &block43, &block44, tmp495, tmp496, tmp497, tmp498, tmp499, tmp500, tmp501, tmp502, tmp503, tmp504, tmp505, tmp506, tmp507, tmp508, tmp509, tmp510, tmp511, tmp512, tmp513, tmp514, tmp515, tmp516, tmp517);
+  }
+
+  if (block44.is_used()) {
+    TNode<RawPtrT> tmp520;
+    TNode<RawPtrT> tmp521;
+    TNode<IntPtrT> tmp522;
+    TNode<Context> tmp523;
+    TNode<Object> tmp524;
+    TNode<JSTypedArray> tmp525;
+    TNode<JSTypedArray> tmp526;
+    TNode<Smi> tmp527;
+    TNode<JSReceiver> tmp528;
+    TNode<Object> tmp529;
+    TNode<FixedArray> tmp530;
+    TNode<IntPtrT> tmp531;
+    TNode<IntPtrT> tmp532;
+    TNode<JSTypedArray> tmp533;
+    TNode<JSTypedArray> tmp534;
+    TNode<BuiltinPtr> tmp535;
+    TNode<Smi> tmp536;
+    TNode<Object> tmp537;
+    TNode<Object> tmp538;
+    TNode<Object> tmp539;
+    TNode<Object> tmp540;
+    TNode<IntPtrT> tmp541;
+    TNode<IntPtrT> tmp542;
+    ca_.Bind(&block44, &tmp520, &tmp521, &tmp522, &tmp523, &tmp524, &tmp525, &tmp526, &tmp527, &tmp528, &tmp529, &tmp530, &tmp531, &tmp532, &tmp533, &tmp534, &tmp535, &tmp536, &tmp537, &tmp538, &tmp539, &tmp540, &tmp541, &tmp542);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'newCapacity >= 0' failed", "../../deps/v8/src/builtins/growable-fixed-array.tq", 14);
+  }
+
+  if (block43.is_used()) {
+    TNode<RawPtrT> tmp543;
+    TNode<RawPtrT> tmp544;
+    TNode<IntPtrT> tmp545;
+    TNode<Context> tmp546;
+    TNode<Object> tmp547;
+    TNode<JSTypedArray> tmp548;
+    TNode<JSTypedArray> tmp549;
+    TNode<Smi> tmp550;
+    TNode<JSReceiver> tmp551;
+    TNode<Object> tmp552;
+    TNode<FixedArray> tmp553;
+    TNode<IntPtrT> tmp554;
+    TNode<IntPtrT> tmp555;
+    TNode<JSTypedArray> tmp556;
+    TNode<JSTypedArray> tmp557;
+    TNode<BuiltinPtr> tmp558;
+    TNode<Smi> tmp559;
+    TNode<Object> tmp560;
+    TNode<Object> tmp561;
+    TNode<Object> tmp562;
+    TNode<Object> tmp563;
+    TNode<IntPtrT> tmp564;
+    TNode<IntPtrT> tmp565;
+    ca_.Bind(&block43, &tmp543, &tmp544, &tmp545, &tmp546, &tmp547, &tmp548, &tmp549, &tmp550, &tmp551, &tmp552, &tmp553, &tmp554, &tmp555, &tmp556, &tmp557, &tmp558, &tmp559, &tmp560, &tmp561, &tmp562, &tmp563, &tmp564, &tmp565);
+  }
+
+  if (block42.is_used()) {
+    TNode<RawPtrT> tmp566;
+    TNode<RawPtrT> tmp567;
+    TNode<IntPtrT> tmp568;
+    TNode<Context> tmp569;
+    TNode<Object> tmp570;
+    TNode<JSTypedArray> tmp571;
+    TNode<JSTypedArray> tmp572;
+    TNode<Smi> tmp573;
+    TNode<JSReceiver> tmp574;
+    TNode<Object> tmp575;
+    TNode<FixedArray> tmp576;
+    TNode<IntPtrT> tmp577;
+    TNode<IntPtrT> tmp578;
+    TNode<JSTypedArray> tmp579;
+    TNode<JSTypedArray> tmp580;
+    TNode<BuiltinPtr> tmp581;
+    TNode<Smi> tmp582;
+    TNode<Object> tmp583;
+    TNode<Object> tmp584;
+    TNode<Object> tmp585;
+    TNode<Object> tmp586;
+    TNode<IntPtrT> tmp587;
+    TNode<IntPtrT> tmp588;
+    ca_.Bind(&block42, &tmp566, &tmp567, &tmp568, &tmp569, &tmp570, &tmp571, &tmp572, &tmp573, &tmp574, &tmp575, &tmp576, &tmp577, &tmp578, &tmp579, &tmp580, &tmp581, &tmp582, &tmp583, &tmp584, &tmp585, &tmp586, &tmp587, &tmp588);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 15);
+    ca_.Goto(&block46, tmp566, tmp567, tmp568, tmp569, tmp570, tmp571, tmp572, tmp573, tmp574, tmp575, tmp576, tmp577, tmp578, tmp579, tmp580, tmp581, tmp582, tmp583, tmp584, tmp585, tmp586, tmp587, tmp588);
+  }
+
+  if (block45.is_used()) {
+    TNode<RawPtrT> tmp589;
+    TNode<RawPtrT> tmp590;
+    TNode<IntPtrT> tmp591;
+    TNode<Context> tmp592;
+    TNode<Object> tmp593;
+    TNode<JSTypedArray> tmp594;
+    TNode<JSTypedArray> tmp595;
+    TNode<Smi> tmp596;
+    TNode<JSReceiver> tmp597;
+    TNode<Object> tmp598;
+    TNode<FixedArray> tmp599;
+    TNode<IntPtrT> tmp600;
+    TNode<IntPtrT> tmp601;
+    TNode<JSTypedArray> tmp602;
+    TNode<JSTypedArray> tmp603;
+    TNode<BuiltinPtr> tmp604;
+    TNode<Smi> tmp605;
+    TNode<Object> tmp606;
+    TNode<Object> tmp607;
+    TNode<Object> tmp608;
+    TNode<Object> tmp609;
+    TNode<IntPtrT> tmp610;
+    TNode<IntPtrT> tmp611;
+    ca_.Bind(&block45, &tmp589, &tmp590, &tmp591, &tmp592, &tmp593, &tmp594, &tmp595, &tmp596, &tmp597, &tmp598, &tmp599, &tmp600, &tmp601, &tmp602, &tmp603, &tmp604, &tmp605, &tmp606, &tmp607, &tmp608, &tmp609, &tmp610, &tmp611);
+    TNode<BoolT> tmp612;
+    USE(tmp612);
+    tmp612 = CodeStubAssembler(state_).IntPtrGreaterThanOrEqual(TNode<IntPtrT>{tmp611}, TNode<IntPtrT>{tmp601});
+    ca_.Branch(tmp612, &block47, &block48, tmp589, tmp590, tmp591, tmp592, tmp593, tmp594, tmp595, tmp596, tmp597, tmp598, tmp599, tmp600, tmp601, tmp602, tmp603, tmp604, tmp605, tmp606, tmp607, tmp608, tmp609, tmp610, tmp611);
+  }
+
+  if (block48.is_used()) {
+    TNode<RawPtrT> tmp613;
+    TNode<RawPtrT> tmp614;
+    TNode<IntPtrT> tmp615;
+    TNode<Context> tmp616;
+    TNode<Object> tmp617;
+    TNode<JSTypedArray> tmp618;
+    TNode<JSTypedArray> tmp619;
+    TNode<Smi> tmp620;
+    TNode<JSReceiver> tmp621;
+    TNode<Object> tmp622;
+    TNode<FixedArray> tmp623;
+    TNode<IntPtrT> tmp624;
+    TNode<IntPtrT> tmp625;
+    TNode<JSTypedArray> tmp626;
+    TNode<JSTypedArray> tmp627;
+    TNode<BuiltinPtr> tmp628;
+    TNode<Smi> tmp629;
+    TNode<Object> tmp630;
+    TNode<Object> tmp631;
+    TNode<Object> tmp632;
+    TNode<Object> tmp633;
+    TNode<IntPtrT> tmp634;
+    TNode<IntPtrT> tmp635;
+    ca_.Bind(&block48, &tmp613, &tmp614, &tmp615, &tmp616, &tmp617, &tmp618, &tmp619, &tmp620, &tmp621, &tmp622, &tmp623, &tmp624, &tmp625, &tmp626, &tmp627, &tmp628, &tmp629, &tmp630, &tmp631, &tmp632, &tmp633, &tmp634, &tmp635);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'newCapacity >= this.length' failed", "../../deps/v8/src/builtins/growable-fixed-array.tq", 15);
+  }
+
+  if (block47.is_used()) {
+    TNode<RawPtrT> tmp636;
+    TNode<RawPtrT> tmp637;
+    TNode<IntPtrT> tmp638;
+    TNode<Context> tmp639;
+    TNode<Object> tmp640;
+    TNode<JSTypedArray> tmp641;
+    TNode<JSTypedArray> tmp642;
+    TNode<Smi> tmp643;
+    TNode<JSReceiver> tmp644;
+    TNode<Object> tmp645;
+    TNode<FixedArray> tmp646;
+    TNode<IntPtrT> tmp647;
+    TNode<IntPtrT> tmp648;
+    TNode<JSTypedArray> tmp649;
+    TNode<JSTypedArray> tmp650;
+    TNode<BuiltinPtr> tmp651;
+    TNode<Smi> tmp652;
+    TNode<Object> tmp653;
+    TNode<Object> tmp654;
+    TNode<Object> tmp655;
+    TNode<Object> tmp656;
+    TNode<IntPtrT> tmp657;
+    TNode<IntPtrT> tmp658;
+    ca_.Bind(&block47, &tmp636, &tmp637, &tmp638, &tmp639, &tmp640, &tmp641, &tmp642, &tmp643, &tmp644, &tmp645, &tmp646, &tmp647, &tmp648, &tmp649, &tmp650, &tmp651, &tmp652, &tmp653, &tmp654, &tmp655, &tmp656, &tmp657, &tmp658);
+  }
+
+  if (block46.is_used()) {
+    TNode<RawPtrT> tmp659;
+    TNode<RawPtrT> tmp660;
+    TNode<IntPtrT> tmp661;
+    TNode<Context> tmp662;
+    TNode<Object> tmp663;
+    TNode<JSTypedArray> tmp664;
+    TNode<JSTypedArray> tmp665;
+    TNode<Smi> tmp666;
+    TNode<JSReceiver> tmp667;
+    TNode<Object> tmp668;
+    TNode<FixedArray> tmp669;
+    TNode<IntPtrT> tmp670;
+    TNode<IntPtrT> tmp671;
+    TNode<JSTypedArray> tmp672;
+    TNode<JSTypedArray> tmp673;
+    TNode<BuiltinPtr> tmp674;
+    TNode<Smi> tmp675;
+    TNode<Object> tmp676;
+    TNode<Object> tmp677;
+    TNode<Object> tmp678;
+    TNode<Object> tmp679;
+    TNode<IntPtrT> tmp680;
+    TNode<IntPtrT> tmp681;
+    ca_.Bind(&block46, &tmp659, &tmp660, &tmp661, &tmp662, &tmp663, &tmp664, &tmp665, &tmp666, &tmp667, &tmp668, &tmp669, &tmp670, &tmp671, &tmp672, &tmp673, &tmp674, &tmp675, &tmp676, &tmp677, &tmp678, &tmp679, &tmp680, &tmp681);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 16);
+    TNode<IntPtrT> tmp682;
+    USE(tmp682);
+    tmp682 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 18);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 17);
+    TNode<FixedArray> tmp683;
+    USE(tmp683);
+    tmp683 = CodeStubAssembler(state_).ExtractFixedArray(TNode<FixedArray>{tmp669}, TNode<IntPtrT>{tmp682}, TNode<IntPtrT>{tmp671}, TNode<IntPtrT>{tmp681}, CodeStubAssembler::ExtractFixedArrayFlag::kFixedArrays);
+    ca_.Goto(&block36, tmp659, tmp660, tmp661, tmp662, tmp663, tmp664, tmp665, tmp666, tmp667, tmp668, tmp669, tmp670, tmp671, tmp672, tmp673, tmp674, tmp675, tmp676, tmp677, tmp678, tmp679, tmp680, tmp681, tmp683);
+  }
+
+  if (block36.is_used()) {
+    TNode<RawPtrT> tmp684;
+    TNode<RawPtrT> tmp685;
+    TNode<IntPtrT> tmp686;
+    TNode<Context> tmp687;
+    TNode<Object> tmp688;
+    TNode<JSTypedArray> tmp689;
+    TNode<JSTypedArray> tmp690;
+    TNode<Smi> tmp691;
+    TNode<JSReceiver> tmp692;
+    TNode<Object> tmp693;
+    TNode<FixedArray> tmp694;
+    TNode<IntPtrT> tmp695;
+    TNode<IntPtrT> tmp696;
+    TNode<JSTypedArray> tmp697;
+    TNode<JSTypedArray> tmp698;
+    TNode<BuiltinPtr> tmp699;
+    TNode<Smi> tmp700;
+    TNode<Object> tmp701;
+    TNode<Object> tmp702;
+    TNode<Object> tmp703;
+    TNode<Object> tmp704;
+    TNode<IntPtrT> tmp705;
+    TNode<IntPtrT> tmp706;
+    TNode<FixedArray> tmp707;
+    ca_.Bind(&block36, &tmp684, &tmp685, &tmp686, &tmp687, &tmp688, &tmp689, &tmp690, &tmp691, &tmp692, &tmp693, &tmp694, &tmp695, &tmp696, &tmp697, &tmp698, &tmp699, &tmp700, &tmp701, &tmp702, &tmp703, &tmp704, &tmp705, &tmp706, &tmp707);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 26);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 22);
+    ca_.Goto(&block35, tmp684, tmp685, tmp686, tmp687, tmp688, tmp689, tmp690, tmp691, tmp692, tmp693, tmp707, tmp695, tmp696, tmp697, tmp698, tmp699, tmp700, tmp701, tmp702, tmp703, tmp704);
+  }
+
+  if (block35.is_used()) {
+    TNode<RawPtrT> tmp708;
+    TNode<RawPtrT> tmp709;
+    TNode<IntPtrT> tmp710;
+    TNode<Context> tmp711;
+    TNode<Object> tmp712;
+    TNode<JSTypedArray> tmp713;
+    TNode<JSTypedArray> tmp714;
+    TNode<Smi> tmp715;
+    TNode<JSReceiver> tmp716;
+    TNode<Object> tmp717;
+    TNode<FixedArray> tmp718;
+    TNode<IntPtrT> tmp719;
+    TNode<IntPtrT> tmp720;
+    TNode<JSTypedArray> tmp721;
+    TNode<JSTypedArray> tmp722;
+    TNode<BuiltinPtr> tmp723;
+    TNode<Smi> tmp724;
+    TNode<Object> tmp725;
+    TNode<Object> tmp726;
+    TNode<Object> tmp727;
+    TNode<Object> tmp728;
+    ca_.Bind(&block35, &tmp708, &tmp709, &tmp710, &tmp711, &tmp712, &tmp713, &tmp714, &tmp715, &tmp716, &tmp717, &tmp718, &tmp719, &tmp720, &tmp721, &tmp722, &tmp723, &tmp724, &tmp725, &tmp726, &tmp727, &tmp728);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 9);
+    ca_.Goto(&block29, tmp708, tmp709, tmp710, tmp711, tmp712, tmp713, tmp714, tmp715, tmp716, tmp717, tmp718, tmp719, tmp720, tmp721, tmp722, tmp723, tmp724, tmp725, tmp726, tmp727, tmp728);
+  }
+
+  if (block29.is_used()) {
+    TNode<RawPtrT> tmp729;
+    TNode<RawPtrT> tmp730;
+    TNode<IntPtrT> tmp731;
+    TNode<Context> tmp732;
+    TNode<Object> tmp733;
+    TNode<JSTypedArray> tmp734;
+    TNode<JSTypedArray> tmp735;
+    TNode<Smi> tmp736;
+    TNode<JSReceiver> tmp737;
+    TNode<Object> tmp738;
+    TNode<FixedArray> tmp739;
+    TNode<IntPtrT> tmp740;
+    TNode<IntPtrT> tmp741;
+    TNode<JSTypedArray> tmp742;
+    TNode<JSTypedArray> tmp743;
+    TNode<BuiltinPtr> tmp744;
+    TNode<Smi> tmp745;
+    TNode<Object> tmp746;
+    TNode<Object> tmp747;
+    TNode<Object> tmp748;
+    TNode<Object> tmp749;
+    ca_.Bind(&block29, &tmp729, &tmp730, &tmp731, &tmp732, &tmp733, &tmp734, &tmp735, &tmp736, &tmp737, &tmp738, &tmp739, &tmp740, &tmp741, &tmp742, &tmp743, &tmp744, &tmp745, &tmp746, &tmp747, &tmp748, &tmp749);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 10);
+    TNode<IntPtrT> tmp750 = ca_.IntPtrConstant(FixedArray::kObjectsOffset);
+    USE(tmp750);
+    TNode<IntPtrT> tmp751 = ca_.IntPtrConstant(FixedArrayBase::kLengthOffset);
+    USE(tmp751);
+    TNode<Smi>tmp752 = CodeStubAssembler(state_).LoadReference<Smi>(CodeStubAssembler::Reference{tmp739, tmp751});
+    TNode<IntPtrT> tmp753;
+    USE(tmp753);
+    tmp753 = Convert8ATintptr5ATSmi_189(state_, TNode<Smi>{tmp752});
+    TNode<IntPtrT> tmp754;
+    USE(tmp754);
+    tmp754 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<IntPtrT> tmp755;
+    USE(tmp755);
+    tmp755 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp741}, TNode<IntPtrT>{tmp754});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 46);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 37);
+    TNode<UintPtrT> tmp756;
+    USE(tmp756);
+    tmp756 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp741});
+    TNode<UintPtrT> tmp757;
+    USE(tmp757);
+    tmp757 = Convert9ATuintptr8ATintptr_206(state_, TNode<IntPtrT>{tmp753});
+    TNode<BoolT> tmp758;
+    USE(tmp758);
+    tmp758 = CodeStubAssembler(state_).UintPtrLessThan(TNode<UintPtrT>{tmp756}, TNode<UintPtrT>{tmp757});
+    ca_.Branch(tmp758, &block53, &block54, tmp729, tmp730, tmp731, tmp732, tmp733, tmp734, tmp735, tmp736, tmp737, tmp738, tmp739, tmp740, tmp755, tmp742, tmp743, tmp744, tmp745, tmp746, tmp747, tmp748, tmp749, tmp739, tmp750, tmp753, tmp741, tmp741, tmp739, tmp750, tmp753, tmp741, tmp741);
+  }
+
+  if (block53.is_used()) {
+    TNode<RawPtrT> tmp759;
+    TNode<RawPtrT> tmp760;
+    TNode<IntPtrT> tmp761;
+    TNode<Context> tmp762;
+    TNode<Object> tmp763;
+    TNode<JSTypedArray> tmp764;
+    TNode<JSTypedArray> tmp765;
+    TNode<Smi> tmp766;
+    TNode<JSReceiver> tmp767;
+    TNode<Object> tmp768;
+    TNode<FixedArray> tmp769;
+    TNode<IntPtrT> tmp770;
+    TNode<IntPtrT> tmp771;
+    TNode<JSTypedArray> tmp772;
+    TNode<JSTypedArray> tmp773;
+    TNode<BuiltinPtr> tmp774;
+    TNode<Smi> tmp775;
+    TNode<Object> tmp776;
+    TNode<Object> tmp777;
+    TNode<Object> tmp778;
+    TNode<Object> tmp779;
+    TNode<FixedArray> tmp780;
+    TNode<IntPtrT> tmp781;
+    TNode<IntPtrT> tmp782;
+    TNode<IntPtrT> tmp783;
+    TNode<IntPtrT> tmp784;
+    TNode<HeapObject> tmp785;
+    TNode<IntPtrT> tmp786;
+    TNode<IntPtrT> tmp787;
+    TNode<IntPtrT> tmp788;
+    TNode<IntPtrT> tmp789;
+    ca_.Bind(&block53, &tmp759, &tmp760, &tmp761, &tmp762, &tmp763, &tmp764, &tmp765, &tmp766, &tmp767, &tmp768, &tmp769, &tmp770, &tmp771, &tmp772, &tmp773, &tmp774, &tmp775, &tmp776, &tmp777, &tmp778, &tmp779, &tmp780, &tmp781, &tmp782, &tmp783, &tmp784, &tmp785, &tmp786, &tmp787, &tmp788, &tmp789);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 39);
+    TNode<IntPtrT> tmp790;
+    USE(tmp790);
+    tmp790 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, (SizeOf20UT5ATSmi10HeapObject_354(state_)));
+    TNode<IntPtrT> tmp791;
+    USE(tmp791);
+    tmp791 = CodeStubAssembler(state_).IntPtrMul(TNode<IntPtrT>{tmp789}, TNode<IntPtrT>{tmp790});
+    TNode<IntPtrT> tmp792;
+    USE(tmp792);
+    tmp792 = CodeStubAssembler(state_).IntPtrAdd(TNode<IntPtrT>{tmp786}, TNode<IntPtrT>{tmp791});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 38);
+    TNode<HeapObject> tmp793;
+    USE(tmp793);
+    TNode<IntPtrT> tmp794;
+    USE(tmp794);
+    std::tie(tmp793, tmp794) = UnsafeNewReference20UT5ATSmi10HeapObject_1372(state_, TNode<HeapObject>{tmp785}, TNode<IntPtrT>{tmp792}).Flatten();
+    ca_.Goto(&block52, tmp759, tmp760, tmp761, tmp762, tmp763, tmp764, tmp765, tmp766, tmp767, tmp768, tmp769, tmp770, tmp771, tmp772, tmp773, tmp774, tmp775, tmp776, tmp777, tmp778, tmp779, tmp780, tmp781, tmp782, tmp783, tmp784, tmp785, tmp786, tmp787, tmp788, tmp789, tmp793, tmp794);
+  }
+
+  if (block54.is_used()) {
+    TNode<RawPtrT> tmp795;
+    TNode<RawPtrT> tmp796;
+    TNode<IntPtrT> tmp797;
+    TNode<Context> tmp798;
+    TNode<Object> tmp799;
+    TNode<JSTypedArray> tmp800;
+    TNode<JSTypedArray> tmp801;
+    TNode<Smi> tmp802;
+    TNode<JSReceiver> tmp803;
+    TNode<Object> tmp804;
+    TNode<FixedArray> tmp805;
+    TNode<IntPtrT> tmp806;
+    TNode<IntPtrT> tmp807;
+    TNode<JSTypedArray> tmp808;
+    TNode<JSTypedArray> tmp809;
+    TNode<BuiltinPtr> tmp810;
+    TNode<Smi> tmp811;
+    TNode<Object> tmp812;
+    TNode<Object> tmp813;
+    TNode<Object> tmp814;
+    TNode<Object> tmp815;
+    TNode<FixedArray> tmp816;
+    TNode<IntPtrT> tmp817;
+    TNode<IntPtrT> tmp818;
+    TNode<IntPtrT> tmp819;
+    TNode<IntPtrT> tmp820;
+    TNode<HeapObject> tmp821;
+    TNode<IntPtrT> tmp822;
+    TNode<IntPtrT> tmp823;
+    TNode<IntPtrT> tmp824;
+    TNode<IntPtrT> tmp825;
+    ca_.Bind(&block54, &tmp795, &tmp796, &tmp797, &tmp798, &tmp799, &tmp800, &tmp801, &tmp802, &tmp803, &tmp804, &tmp805, &tmp806, &tmp807, &tmp808, &tmp809, &tmp810, &tmp811, &tmp812, &tmp813, &tmp814, &tmp815, &tmp816, &tmp817, &tmp818, &tmp819, &tmp820, &tmp821, &tmp822, &tmp823, &tmp824, &tmp825);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 41);
+    ca_.Goto(&block51, tmp795, tmp796, tmp797, tmp798, tmp799, tmp800, tmp801, tmp802, tmp803, tmp804, tmp805, tmp806, tmp807, tmp808, tmp809, tmp810, tmp811, tmp812, tmp813, tmp814, tmp815, tmp816, tmp817, tmp818, tmp819, tmp820);
+  }
+
+  if (block52.is_used()) {
+    TNode<RawPtrT> tmp826;
+    TNode<RawPtrT> tmp827;
+    TNode<IntPtrT> tmp828;
+    TNode<Context> tmp829;
+    TNode<Object> tmp830;
+    TNode<JSTypedArray> tmp831;
+    TNode<JSTypedArray> tmp832;
+    TNode<Smi> tmp833;
+    TNode<JSReceiver> tmp834;
+    TNode<Object> tmp835;
+    TNode<FixedArray> tmp836;
+    TNode<IntPtrT> tmp837;
+    TNode<IntPtrT> tmp838;
+    TNode<JSTypedArray> tmp839;
+    TNode<JSTypedArray> tmp840;
+    TNode<BuiltinPtr> tmp841;
+    TNode<Smi> tmp842;
+    TNode<Object> tmp843;
+    TNode<Object> tmp844;
+    TNode<Object> tmp845;
+    TNode<Object> tmp846;
+    TNode<FixedArray> tmp847;
+    TNode<IntPtrT> tmp848;
+    TNode<IntPtrT> tmp849;
+    TNode<IntPtrT> tmp850;
+    TNode<IntPtrT> tmp851;
+    TNode<HeapObject> tmp852;
+    TNode<IntPtrT> tmp853;
+    TNode<IntPtrT> tmp854;
+    TNode<IntPtrT> tmp855;
+    TNode<IntPtrT> tmp856;
+    TNode<HeapObject> tmp857;
+    TNode<IntPtrT> tmp858;
+    ca_.Bind(&block52, &tmp826, &tmp827, &tmp828, &tmp829, &tmp830, &tmp831, &tmp832, &tmp833, &tmp834, &tmp835, &tmp836, &tmp837, &tmp838, &tmp839, &tmp840, &tmp841, &tmp842, &tmp843, &tmp844, &tmp845, &tmp846, &tmp847, &tmp848, &tmp849, &tmp850, &tmp851, &tmp852, &tmp853, &tmp854, &tmp855, &tmp856, &tmp857, &tmp858);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/torque-internal.tq", 46);
+    ca_.Goto(&block50, tmp826, tmp827, tmp828, tmp829, tmp830, tmp831, tmp832, tmp833, tmp834, tmp835, tmp836, tmp837, tmp838, tmp839, tmp840, tmp841, tmp842, tmp843, tmp844, tmp845, tmp846, tmp847, tmp848, tmp849, tmp850, tmp851, tmp857, tmp858);
+  }
+
+  if (block51.is_used()) {
+    TNode<RawPtrT> tmp859;
+    TNode<RawPtrT> tmp860;
+    TNode<IntPtrT> tmp861;
+    TNode<Context> tmp862;
+    TNode<Object> tmp863;
+    TNode<JSTypedArray> tmp864;
+    TNode<JSTypedArray> tmp865;
+    TNode<Smi> tmp866;
+    TNode<JSReceiver> tmp867;
+    TNode<Object> tmp868;
+    TNode<FixedArray> tmp869;
+    TNode<IntPtrT> tmp870;
+    TNode<IntPtrT> tmp871;
+    TNode<JSTypedArray> tmp872;
+    TNode<JSTypedArray> tmp873;
+    TNode<BuiltinPtr> tmp874;
+    TNode<Smi> tmp875;
+    TNode<Object> tmp876;
+    TNode<Object> tmp877;
+    TNode<Object> tmp878;
+    TNode<Object> tmp879;
+    TNode<FixedArray> tmp880;
+    TNode<IntPtrT> tmp881;
+    TNode<IntPtrT> tmp882;
+    TNode<IntPtrT> tmp883;
+    TNode<IntPtrT> tmp884;
+    ca_.Bind(&block51, &tmp859, &tmp860, &tmp861, &tmp862, &tmp863, &tmp864, &tmp865, &tmp866, &tmp867, &tmp868, &tmp869, &tmp870, &tmp871, &tmp872, &tmp873, &tmp874, &tmp875, &tmp876, &tmp877, &tmp878, &tmp879, &tmp880, &tmp881, &tmp882, &tmp883, &tmp884);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block50.is_used()) {
+    TNode<RawPtrT> tmp885;
+    TNode<RawPtrT> tmp886;
+    TNode<IntPtrT> tmp887;
+    TNode<Context> tmp888;
+    TNode<Object> tmp889;
+    TNode<JSTypedArray> tmp890;
+    TNode<JSTypedArray> tmp891;
+    TNode<Smi> tmp892;
+    TNode<JSReceiver> tmp893;
+    TNode<Object> tmp894;
+    TNode<FixedArray> tmp895;
+    TNode<IntPtrT> tmp896;
+    TNode<IntPtrT> tmp897;
+    TNode<JSTypedArray> tmp898;
+    TNode<JSTypedArray> tmp899;
+    TNode<BuiltinPtr> tmp900;
+    TNode<Smi> tmp901;
+    TNode<Object> tmp902;
+    TNode<Object> tmp903;
+    TNode<Object> tmp904;
+    TNode<Object> tmp905;
+    TNode<FixedArray> tmp906;
+    TNode<IntPtrT> tmp907;
+    TNode<IntPtrT> tmp908;
+    TNode<IntPtrT> tmp909;
+    TNode<IntPtrT> tmp910;
+    TNode<HeapObject> tmp911;
+    TNode<IntPtrT> tmp912;
+    ca_.Bind(&block50, &tmp885, &tmp886, &tmp887, &tmp888, &tmp889, &tmp890, &tmp891, &tmp892, &tmp893, &tmp894, &tmp895, &tmp896, &tmp897, &tmp898, &tmp899, &tmp900, &tmp901, &tmp902, &tmp903, &tmp904, &tmp905, &tmp906, &tmp907, &tmp908, &tmp909, &tmp910, &tmp911, &tmp912);
+    ca_.Goto(&block49, tmp885, tmp886, tmp887, tmp888, tmp889, tmp890, tmp891, tmp892, tmp893, tmp894, tmp895, tmp896, tmp897, tmp898, tmp899, tmp900, tmp901, tmp902, tmp903, tmp904, tmp905, tmp906, tmp907, tmp908, tmp909, tmp910, tmp911, tmp912);
+  }
+
+  if (block49.is_used()) {
+    TNode<RawPtrT> tmp913;
+    TNode<RawPtrT> tmp914;
+    TNode<IntPtrT> tmp915;
+    TNode<Context> tmp916;
+    TNode<Object> tmp917;
+    TNode<JSTypedArray> tmp918;
+    TNode<JSTypedArray> tmp919;
+    TNode<Smi> tmp920;
+    TNode<JSReceiver> tmp921;
+    TNode<Object> tmp922;
+    TNode<FixedArray> tmp923;
+    TNode<IntPtrT> tmp924;
+    TNode<IntPtrT> tmp925;
+    TNode<JSTypedArray> tmp926;
+    TNode<JSTypedArray> tmp927;
+    TNode<BuiltinPtr> tmp928;
+    TNode<Smi> tmp929;
+    TNode<Object> tmp930;
+    TNode<Object> tmp931;
+    TNode<Object> tmp932;
+    TNode<Object> tmp933;
+    TNode<FixedArray> tmp934;
+    TNode<IntPtrT> tmp935;
+    TNode<IntPtrT> tmp936;
+    TNode<IntPtrT> tmp937;
+    TNode<IntPtrT> tmp938;
+    TNode<HeapObject> tmp939;
+    TNode<IntPtrT> tmp940;
+    ca_.Bind(&block49, &tmp913, &tmp914, &tmp915, &tmp916, &tmp917, &tmp918, &tmp919, &tmp920, &tmp921, &tmp922, &tmp923, &tmp924, &tmp925, &tmp926, &tmp927, &tmp928, &tmp929, &tmp930, &tmp931, &tmp932, &tmp933, &tmp934, &tmp935, &tmp936, &tmp937, &tmp938, &tmp939, &tmp940);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 10);
+    CodeStubAssembler(state_).StoreReference(CodeStubAssembler::Reference{tmp939, tmp940}, tmp933);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 56);
+    ca_.Goto(&block28, tmp913, tmp914, tmp915, tmp916, tmp917, tmp918, tmp919, tmp920, tmp921, tmp922, tmp923, tmp924, tmp925, tmp926, tmp927, tmp928, tmp929, tmp930, tmp931, tmp932, tmp933);
+  }
+
+  if (block28.is_used()) {
+    TNode<RawPtrT> tmp941;
+    TNode<RawPtrT> tmp942;
+    TNode<IntPtrT> tmp943;
+    TNode<Context> tmp944;
+    TNode<Object> tmp945;
+    TNode<JSTypedArray> tmp946;
+    TNode<JSTypedArray> tmp947;
+    TNode<Smi> tmp948;
+    TNode<JSReceiver> tmp949;
+    TNode<Object> tmp950;
+    TNode<FixedArray> tmp951;
+    TNode<IntPtrT> tmp952;
+    TNode<IntPtrT> tmp953;
+    TNode<JSTypedArray> tmp954;
+    TNode<JSTypedArray> tmp955;
+    TNode<BuiltinPtr> tmp956;
+    TNode<Smi> tmp957;
+    TNode<Object> tmp958;
+    TNode<Object> tmp959;
+    TNode<Object> tmp960;
+    TNode<Object> tmp961;
+    ca_.Bind(&block28, &tmp941, &tmp942, &tmp943, &tmp944, &tmp945, &tmp946, &tmp947, &tmp948, &tmp949, &tmp950, &tmp951, &tmp952, &tmp953, &tmp954, &tmp955, &tmp956, &tmp957, &tmp958, &tmp959, &tmp960, &tmp961);
+    ca_.Goto(&block27, tmp941, tmp942, tmp943, tmp944, tmp945, tmp946, tmp947, tmp948, tmp949, tmp950, tmp951, tmp952, tmp953, tmp954, tmp955, tmp956, tmp957, tmp958, tmp959);
+  }
+
+  if (block27.is_used()) {
+    TNode<RawPtrT> tmp962;
+    TNode<RawPtrT> tmp963;
+    TNode<IntPtrT> tmp964;
+    TNode<Context> tmp965;
+    TNode<Object> tmp966;
+    TNode<JSTypedArray> tmp967;
+    TNode<JSTypedArray> tmp968;
+    TNode<Smi> tmp969;
+    TNode<JSReceiver> tmp970;
+    TNode<Object> tmp971;
+    TNode<FixedArray> tmp972;
+    TNode<IntPtrT> tmp973;
+    TNode<IntPtrT> tmp974;
+    TNode<JSTypedArray> tmp975;
+    TNode<JSTypedArray> tmp976;
+    TNode<BuiltinPtr> tmp977;
+    TNode<Smi> tmp978;
+    TNode<Object> tmp979;
+    TNode<Object> tmp980;
+    ca_.Bind(&block27, &tmp962, &tmp963, &tmp964, &tmp965, &tmp966, &tmp967, &tmp968, &tmp969, &tmp970, &tmp971, &tmp972, &tmp973, &tmp974, &tmp975, &tmp976, &tmp977, &tmp978, &tmp979, &tmp980);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 41);
+    ca_.Goto(&block20, tmp962, tmp963, tmp964, tmp965, tmp966, tmp967, tmp968, tmp969, tmp970, tmp971, tmp972, tmp973, tmp974, tmp975, tmp976, tmp977, tmp978);
+  }
+
+  if (block20.is_used()) {
+    TNode<RawPtrT> tmp981;
+    TNode<RawPtrT> tmp982;
+    TNode<IntPtrT> tmp983;
+    TNode<Context> tmp984;
+    TNode<Object> tmp985;
+    TNode<JSTypedArray> tmp986;
+    TNode<JSTypedArray> tmp987;
+    TNode<Smi> tmp988;
+    TNode<JSReceiver> tmp989;
+    TNode<Object> tmp990;
+    TNode<FixedArray> tmp991;
+    TNode<IntPtrT> tmp992;
+    TNode<IntPtrT> tmp993;
+    TNode<JSTypedArray> tmp994;
+    TNode<JSTypedArray> tmp995;
+    TNode<BuiltinPtr> tmp996;
+    TNode<Smi> tmp997;
+    ca_.Bind(&block20, &tmp981, &tmp982, &tmp983, &tmp984, &tmp985, &tmp986, &tmp987, &tmp988, &tmp989, &tmp990, &tmp991, &tmp992, &tmp993, &tmp994, &tmp995, &tmp996, &tmp997);
+    TNode<Smi> tmp998;
+    USE(tmp998);
+    tmp998 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 1);
+    TNode<Smi> tmp999;
+    USE(tmp999);
+    tmp999 = CodeStubAssembler(state_).SmiAdd(TNode<Smi>{tmp997}, TNode<Smi>{tmp998});
+    ca_.Goto(&block19, tmp981, tmp982, tmp983, tmp984, tmp985, tmp986, tmp987, tmp988, tmp989, tmp990, tmp991, tmp992, tmp993, tmp994, tmp995, tmp996, tmp999);
+  }
+
+  if (block18.is_used()) {
+    TNode<RawPtrT> tmp1000;
+    TNode<RawPtrT> tmp1001;
+    TNode<IntPtrT> tmp1002;
+    TNode<Context> tmp1003;
+    TNode<Object> tmp1004;
+    TNode<JSTypedArray> tmp1005;
+    TNode<JSTypedArray> tmp1006;
+    TNode<Smi> tmp1007;
+    TNode<JSReceiver> tmp1008;
+    TNode<Object> tmp1009;
+    TNode<FixedArray> tmp1010;
+    TNode<IntPtrT> tmp1011;
+    TNode<IntPtrT> tmp1012;
+    TNode<JSTypedArray> tmp1013;
+    TNode<JSTypedArray> tmp1014;
+    TNode<BuiltinPtr> tmp1015;
+    TNode<Smi> tmp1016;
+    ca_.Bind(&block18, &tmp1000, &tmp1001, &tmp1002, &tmp1003, &tmp1004, &tmp1005, &tmp1006, &tmp1007, &tmp1008, &tmp1009, &tmp1010, &tmp1011, &tmp1012, &tmp1013, &tmp1014, &tmp1015, &tmp1016);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 62);
+    TNode<Smi> tmp1017;
+    USE(tmp1017);
+    tmp1017 = Convert13ATPositiveSmi8ATintptr_192(state_, TNode<IntPtrT>{tmp1012});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 65);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 64);
+    TNode<JSTypedArray> tmp1018;
+    USE(tmp1018);
+    tmp1018 = TypedArraySpeciesCreateByLength_365(state_, TNode<Context>{tmp1003}, kBuiltinName_368(state_), TNode<JSTypedArray>{tmp1005}, TNode<Smi>{tmp1017});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 63);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 71);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 30);
+    TNode<NativeContext> tmp1019;
+    USE(tmp1019);
+    tmp1019 = CodeStubAssembler(state_).LoadNativeContext(TNode<Context>{tmp1003});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 31);
+    TNode<Map> tmp1020;
+    USE(tmp1020);
+    tmp1020 = CodeStubAssembler(state_).LoadJSArrayElementsMap(PACKED_ELEMENTS, TNode<NativeContext>{tmp1019});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 32);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 13);
+    ca_.Goto(&block59, tmp1000, tmp1001, tmp1002, tmp1003, tmp1004, tmp1005, tmp1006, tmp1007, tmp1008, tmp1009, tmp1010, tmp1011, tmp1012, tmp1013, tmp1014, tmp1015, tmp1017, tmp1018, tmp1003, tmp1018, tmp1003, tmp1019, tmp1020, tmp1012, tmp1012);
+  }
+
+  if (block58.is_used()) {
+    TNode<RawPtrT> tmp1021;
+    TNode<RawPtrT> tmp1022;
+    TNode<IntPtrT> tmp1023;
+    TNode<Context> tmp1024;
+    TNode<Object> tmp1025;
+    TNode<JSTypedArray> tmp1026;
+    TNode<JSTypedArray> tmp1027;
+    TNode<Smi> tmp1028;
+    TNode<JSReceiver> tmp1029;
+    TNode<Object> tmp1030;
+    TNode<FixedArray> tmp1031;
+    TNode<IntPtrT> tmp1032;
+    TNode<IntPtrT> tmp1033;
+    TNode<JSTypedArray> tmp1034;
+    TNode<JSTypedArray> tmp1035;
+    TNode<BuiltinPtr> tmp1036;
+    TNode<Smi> tmp1037;
+    TNode<JSTypedArray> tmp1038;
+    TNode<Context> tmp1039;
+    TNode<JSTypedArray> tmp1040;
+    TNode<Context> tmp1041;
+    TNode<NativeContext> tmp1042;
+    TNode<Map> tmp1043;
+    TNode<IntPtrT> tmp1044;
+    TNode<IntPtrT> tmp1045;
+    ca_.Bind(&block58, &tmp1021, &tmp1022, &tmp1023, &tmp1024, &tmp1025, &tmp1026, &tmp1027, &tmp1028, &tmp1029, &tmp1030, &tmp1031, &tmp1032, &tmp1033, &tmp1034, &tmp1035, &tmp1036, &tmp1037, &tmp1038, &tmp1039, &tmp1040, &tmp1041, &tmp1042, &tmp1043, &tmp1044, &tmp1045);
+    TNode<IntPtrT> tmp1046;
+    USE(tmp1046);
+    tmp1046 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<BoolT> tmp1047;
+    USE(tmp1047);
+    tmp1047 = CodeStubAssembler(state_).IntPtrGreaterThanOrEqual(TNode<IntPtrT>{tmp1033}, TNode<IntPtrT>{tmp1046});
+    ca_.Branch(tmp1047, &block60, &block61, tmp1021, tmp1022, tmp1023, tmp1024, tmp1025, tmp1026, tmp1027, tmp1028, tmp1029, tmp1030, tmp1031, tmp1032, tmp1033, tmp1034, tmp1035, tmp1036, tmp1037, tmp1038, tmp1039, tmp1040, tmp1041, tmp1042, tmp1043, tmp1044, tmp1045);
+  }
+
+  if (block61.is_used()) {
+    TNode<RawPtrT> tmp1048;
+    TNode<RawPtrT> tmp1049;
+    TNode<IntPtrT> tmp1050;
+    TNode<Context> tmp1051;
+    TNode<Object> tmp1052;
+    TNode<JSTypedArray> tmp1053;
+    TNode<JSTypedArray> tmp1054;
+    TNode<Smi> tmp1055;
+    TNode<JSReceiver> tmp1056;
+    TNode<Object> tmp1057;
+    TNode<FixedArray> tmp1058;
+    TNode<IntPtrT> tmp1059;
+    TNode<IntPtrT> tmp1060;
+    TNode<JSTypedArray> tmp1061;
+    TNode<JSTypedArray> tmp1062;
+    TNode<BuiltinPtr> tmp1063;
+    TNode<Smi> tmp1064;
+    TNode<JSTypedArray> tmp1065;
+    TNode<Context> tmp1066;
+    TNode<JSTypedArray> tmp1067;
+    TNode<Context> tmp1068;
+    TNode<NativeContext> tmp1069;
+    TNode<Map> tmp1070;
+    TNode<IntPtrT> tmp1071;
+    TNode<IntPtrT> tmp1072;
+    ca_.Bind(&block61, &tmp1048, &tmp1049, &tmp1050, &tmp1051, &tmp1052, &tmp1053, &tmp1054, &tmp1055, &tmp1056, &tmp1057, &tmp1058, &tmp1059, &tmp1060, &tmp1061, &tmp1062, &tmp1063, &tmp1064, &tmp1065, &tmp1066, &tmp1067, &tmp1068, &tmp1069, &tmp1070, &tmp1071, &tmp1072);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'this.length >= 0' failed", "../../deps/v8/src/builtins/growable-fixed-array.tq", 13);
+  }
+
+  if (block60.is_used()) {
+    TNode<RawPtrT> tmp1073;
+    TNode<RawPtrT> tmp1074;
+    TNode<IntPtrT> tmp1075;
+    TNode<Context> tmp1076;
+    TNode<Object> tmp1077;
+    TNode<JSTypedArray> tmp1078;
+    TNode<JSTypedArray> tmp1079;
+    TNode<Smi> tmp1080;
+    TNode<JSReceiver> tmp1081;
+    TNode<Object> tmp1082;
+    TNode<FixedArray> tmp1083;
+    TNode<IntPtrT> tmp1084;
+    TNode<IntPtrT> tmp1085;
+    TNode<JSTypedArray> tmp1086;
+    TNode<JSTypedArray> tmp1087;
+    TNode<BuiltinPtr> tmp1088;
+    TNode<Smi> tmp1089;
+    TNode<JSTypedArray> tmp1090;
+    TNode<Context> tmp1091;
+    TNode<JSTypedArray> tmp1092;
+    TNode<Context> tmp1093;
+    TNode<NativeContext> tmp1094;
+    TNode<Map> tmp1095;
+    TNode<IntPtrT> tmp1096;
+    TNode<IntPtrT> tmp1097;
+    ca_.Bind(&block60, &tmp1073, &tmp1074, &tmp1075, &tmp1076, &tmp1077, &tmp1078, &tmp1079, &tmp1080, &tmp1081, &tmp1082, &tmp1083, &tmp1084, &tmp1085, &tmp1086, &tmp1087, &tmp1088, &tmp1089, &tmp1090, &tmp1091, &tmp1092, &tmp1093, &tmp1094, &tmp1095, &tmp1096, &tmp1097);
+  }
+
+  if (block59.is_used()) {
+    TNode<RawPtrT> tmp1098;
+    TNode<RawPtrT> tmp1099;
+    TNode<IntPtrT> tmp1100;
+    TNode<Context> tmp1101;
+    TNode<Object> tmp1102;
+    TNode<JSTypedArray> tmp1103;
+    TNode<JSTypedArray> tmp1104;
+    TNode<Smi> tmp1105;
+    TNode<JSReceiver> tmp1106;
+    TNode<Object> tmp1107;
+    TNode<FixedArray> tmp1108;
+    TNode<IntPtrT> tmp1109;
+    TNode<IntPtrT> tmp1110;
+    TNode<JSTypedArray> tmp1111;
+    TNode<JSTypedArray> tmp1112;
+    TNode<BuiltinPtr> tmp1113;
+    TNode<Smi> tmp1114;
+    TNode<JSTypedArray> tmp1115;
+    TNode<Context> tmp1116;
+    TNode<JSTypedArray> tmp1117;
+    TNode<Context> tmp1118;
+    TNode<NativeContext> tmp1119;
+    TNode<Map> tmp1120;
+    TNode<IntPtrT> tmp1121;
+    TNode<IntPtrT> tmp1122;
+    ca_.Bind(&block59, &tmp1098, &tmp1099, &tmp1100, &tmp1101, &tmp1102, &tmp1103, &tmp1104, &tmp1105, &tmp1106, &tmp1107, &tmp1108, &tmp1109, &tmp1110, &tmp1111, &tmp1112, &tmp1113, &tmp1114, &tmp1115, &tmp1116, &tmp1117, &tmp1118, &tmp1119, &tmp1120, &tmp1121, &tmp1122);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 14);
+    ca_.Goto(&block63, tmp1098, tmp1099, tmp1100, tmp1101, tmp1102, tmp1103, tmp1104, tmp1105, tmp1106, tmp1107, tmp1108, tmp1109, tmp1110, tmp1111, tmp1112, tmp1113, tmp1114, tmp1115, tmp1116, tmp1117, tmp1118, tmp1119, tmp1120, tmp1121, tmp1122);
+  }
+
+  if (block62.is_used()) {
+    TNode<RawPtrT> tmp1123;
+    TNode<RawPtrT> tmp1124;
+    TNode<IntPtrT> tmp1125;
+    TNode<Context> tmp1126;
+    TNode<Object> tmp1127;
+    TNode<JSTypedArray> tmp1128;
+    TNode<JSTypedArray> tmp1129;
+    TNode<Smi> tmp1130;
+    TNode<JSReceiver> tmp1131;
+    TNode<Object> tmp1132;
+    TNode<FixedArray> tmp1133;
+    TNode<IntPtrT> tmp1134;
+    TNode<IntPtrT> tmp1135;
+    TNode<JSTypedArray> tmp1136;
+    TNode<JSTypedArray> tmp1137;
+    TNode<BuiltinPtr> tmp1138;
+    TNode<Smi> tmp1139;
+    TNode<JSTypedArray> tmp1140;
+    TNode<Context> tmp1141;
+    TNode<JSTypedArray> tmp1142;
+    TNode<Context> tmp1143;
+    TNode<NativeContext> tmp1144;
+    TNode<Map> tmp1145;
+    TNode<IntPtrT> tmp1146;
+    TNode<IntPtrT> tmp1147;
+    ca_.Bind(&block62, &tmp1123, &tmp1124, &tmp1125, &tmp1126, &tmp1127, &tmp1128, &tmp1129, &tmp1130, &tmp1131, &tmp1132, &tmp1133, &tmp1134, &tmp1135, &tmp1136, &tmp1137, &tmp1138, &tmp1139, &tmp1140, &tmp1141, &tmp1142, &tmp1143, &tmp1144, &tmp1145, &tmp1146, &tmp1147);
+    TNode<IntPtrT> tmp1148;
+    USE(tmp1148);
+    tmp1148 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<BoolT> tmp1149;
+    USE(tmp1149);
+    tmp1149 = CodeStubAssembler(state_).IntPtrGreaterThanOrEqual(TNode<IntPtrT>{tmp1147}, TNode<IntPtrT>{tmp1148});
+    ca_.Branch(tmp1149, &block64, &block65, tmp1123, tmp1124, tmp1125, tmp1126, tmp1127, tmp1128, tmp1129, tmp1130, tmp1131, tmp1132, tmp1133, tmp1134, tmp1135, tmp1136, tmp1137, tmp1138, tmp1139, tmp1140, tmp1141, tmp1142, tmp1143, tmp1144, tmp1145, tmp1146, tmp1147);
+  }
+
+  if (block65.is_used()) {
+    TNode<RawPtrT> tmp1150;
+    TNode<RawPtrT> tmp1151;
+    TNode<IntPtrT> tmp1152;
+    TNode<Context> tmp1153;
+    TNode<Object> tmp1154;
+    TNode<JSTypedArray> tmp1155;
+    TNode<JSTypedArray> tmp1156;
+    TNode<Smi> tmp1157;
+    TNode<JSReceiver> tmp1158;
+    TNode<Object> tmp1159;
+    TNode<FixedArray> tmp1160;
+    TNode<IntPtrT> tmp1161;
+    TNode<IntPtrT> tmp1162;
+    TNode<JSTypedArray> tmp1163;
+    TNode<JSTypedArray> tmp1164;
+    TNode<BuiltinPtr> tmp1165;
+    TNode<Smi> tmp1166;
+    TNode<JSTypedArray> tmp1167;
+    TNode<Context> tmp1168;
+    TNode<JSTypedArray> tmp1169;
+    TNode<Context> tmp1170;
+    TNode<NativeContext> tmp1171;
+    TNode<Map> tmp1172;
+    TNode<IntPtrT> tmp1173;
+    TNode<IntPtrT> tmp1174;
+    ca_.Bind(&block65, &tmp1150, &tmp1151, &tmp1152, &tmp1153, &tmp1154, &tmp1155, &tmp1156, &tmp1157, &tmp1158, &tmp1159, &tmp1160, &tmp1161, &tmp1162, &tmp1163, &tmp1164, &tmp1165, &tmp1166, &tmp1167, &tmp1168, &tmp1169, &tmp1170, &tmp1171, &tmp1172, &tmp1173, &tmp1174);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'newCapacity >= 0' failed", "../../deps/v8/src/builtins/growable-fixed-array.tq", 14);
+  }
+
+  if (block64.is_used()) {
+    TNode<RawPtrT> tmp1175;
+    TNode<RawPtrT> tmp1176;
+    TNode<IntPtrT> tmp1177;
+    TNode<Context> tmp1178;
+    TNode<Object> tmp1179;
+    TNode<JSTypedArray> tmp1180;
+    TNode<JSTypedArray> tmp1181;
+    TNode<Smi> tmp1182;
+    TNode<JSReceiver> tmp1183;
+    TNode<Object> tmp1184;
+    TNode<FixedArray> tmp1185;
+    TNode<IntPtrT> tmp1186;
+    TNode<IntPtrT> tmp1187;
+    TNode<JSTypedArray> tmp1188;
+    TNode<JSTypedArray> tmp1189;
+    TNode<BuiltinPtr> tmp1190;
+    TNode<Smi> tmp1191;
+    TNode<JSTypedArray> tmp1192;
+    TNode<Context> tmp1193;
+    TNode<JSTypedArray> tmp1194;
+    TNode<Context> tmp1195;
+    TNode<NativeContext> tmp1196;
+    TNode<Map> tmp1197;
+    TNode<IntPtrT> tmp1198;
+    TNode<IntPtrT> tmp1199;
+    ca_.Bind(&block64, &tmp1175, &tmp1176, &tmp1177, &tmp1178, &tmp1179, &tmp1180, &tmp1181, &tmp1182, &tmp1183, &tmp1184, &tmp1185, &tmp1186, &tmp1187, &tmp1188, &tmp1189, &tmp1190, &tmp1191, &tmp1192, &tmp1193, &tmp1194, &tmp1195, &tmp1196, &tmp1197, &tmp1198, &tmp1199);
+  }
+
+  if (block63.is_used()) {
+    TNode<RawPtrT> tmp1200;
+    TNode<RawPtrT> tmp1201;
+    TNode<IntPtrT> tmp1202;
+    TNode<Context> tmp1203;
+    TNode<Object> tmp1204;
+    TNode<JSTypedArray> tmp1205;
+    TNode<JSTypedArray> tmp1206;
+    TNode<Smi> tmp1207;
+    TNode<JSReceiver> tmp1208;
+    TNode<Object> tmp1209;
+    TNode<FixedArray> tmp1210;
+    TNode<IntPtrT> tmp1211;
+    TNode<IntPtrT> tmp1212;
+    TNode<JSTypedArray> tmp1213;
+    TNode<JSTypedArray> tmp1214;
+    TNode<BuiltinPtr> tmp1215;
+    TNode<Smi> tmp1216;
+    TNode<JSTypedArray> tmp1217;
+    TNode<Context> tmp1218;
+    TNode<JSTypedArray> tmp1219;
+    TNode<Context> tmp1220;
+    TNode<NativeContext> tmp1221;
+    TNode<Map> tmp1222;
+    TNode<IntPtrT> tmp1223;
+    TNode<IntPtrT> tmp1224;
+    ca_.Bind(&block63, &tmp1200, &tmp1201, &tmp1202, &tmp1203, &tmp1204, &tmp1205, &tmp1206, &tmp1207, &tmp1208, &tmp1209, &tmp1210, &tmp1211, &tmp1212, &tmp1213, &tmp1214, &tmp1215, &tmp1216, &tmp1217, &tmp1218, &tmp1219, &tmp1220, &tmp1221, &tmp1222, &tmp1223, &tmp1224);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 15);
+    ca_.Goto(&block67, tmp1200, tmp1201, tmp1202, tmp1203, tmp1204, tmp1205, tmp1206, tmp1207, tmp1208, tmp1209, tmp1210, tmp1211, tmp1212, tmp1213, tmp1214, tmp1215, tmp1216, tmp1217, tmp1218, tmp1219, tmp1220, tmp1221, tmp1222, tmp1223, tmp1224);
+  }
+
+  if (block66.is_used()) {
+    TNode<RawPtrT> tmp1225;
+    TNode<RawPtrT> tmp1226;
+    TNode<IntPtrT> tmp1227;
+    TNode<Context> tmp1228;
+    TNode<Object> tmp1229;
+    TNode<JSTypedArray> tmp1230;
+    TNode<JSTypedArray> tmp1231;
+    TNode<Smi> tmp1232;
+    TNode<JSReceiver> tmp1233;
+    TNode<Object> tmp1234;
+    TNode<FixedArray> tmp1235;
+    TNode<IntPtrT> tmp1236;
+    TNode<IntPtrT> tmp1237;
+    TNode<JSTypedArray> tmp1238;
+    TNode<JSTypedArray> tmp1239;
+    TNode<BuiltinPtr> tmp1240;
+    TNode<Smi> tmp1241;
+    TNode<JSTypedArray> tmp1242;
+    TNode<Context> tmp1243;
+    TNode<JSTypedArray> tmp1244;
+    TNode<Context> tmp1245;
+    TNode<NativeContext> tmp1246;
+    TNode<Map> tmp1247;
+    TNode<IntPtrT> tmp1248;
+    TNode<IntPtrT> tmp1249;
+    ca_.Bind(&block66, &tmp1225, &tmp1226, &tmp1227, &tmp1228, &tmp1229, &tmp1230, &tmp1231, &tmp1232, &tmp1233, &tmp1234, &tmp1235, &tmp1236, &tmp1237, &tmp1238, &tmp1239, &tmp1240, &tmp1241, &tmp1242, &tmp1243, &tmp1244, &tmp1245, &tmp1246, &tmp1247, &tmp1248, &tmp1249);
+    TNode<BoolT> tmp1250;
+    USE(tmp1250);
+    tmp1250 = CodeStubAssembler(state_).IntPtrGreaterThanOrEqual(TNode<IntPtrT>{tmp1249}, TNode<IntPtrT>{tmp1237});
+    ca_.Branch(tmp1250, &block68, &block69, tmp1225, tmp1226, tmp1227, tmp1228, tmp1229, tmp1230, tmp1231, tmp1232, tmp1233, tmp1234, tmp1235, tmp1236, tmp1237, tmp1238, tmp1239, tmp1240, tmp1241, tmp1242, tmp1243, tmp1244, tmp1245, tmp1246, tmp1247, tmp1248, tmp1249);
+  }
+
+  if (block69.is_used()) {
+    TNode<RawPtrT> tmp1251;
+    TNode<RawPtrT> tmp1252;
+    TNode<IntPtrT> tmp1253;
+    TNode<Context> tmp1254;
+    TNode<Object> tmp1255;
+    TNode<JSTypedArray> tmp1256;
+    TNode<JSTypedArray> tmp1257;
+    TNode<Smi> tmp1258;
+    TNode<JSReceiver> tmp1259;
+    TNode<Object> tmp1260;
+    TNode<FixedArray> tmp1261;
+    TNode<IntPtrT> tmp1262;
+    TNode<IntPtrT> tmp1263;
+    TNode<JSTypedArray> tmp1264;
+    TNode<JSTypedArray> tmp1265;
+    TNode<BuiltinPtr> tmp1266;
+    TNode<Smi> tmp1267;
+    TNode<JSTypedArray> tmp1268;
+    TNode<Context> tmp1269;
+    TNode<JSTypedArray> tmp1270;
+    TNode<Context> tmp1271;
+    TNode<NativeContext> tmp1272;
+    TNode<Map> tmp1273;
+    TNode<IntPtrT> tmp1274;
+    TNode<IntPtrT> tmp1275;
+    ca_.Bind(&block69, &tmp1251, &tmp1252, &tmp1253, &tmp1254, &tmp1255, &tmp1256, &tmp1257, &tmp1258, &tmp1259, &tmp1260, &tmp1261, &tmp1262, &tmp1263, &tmp1264, &tmp1265, &tmp1266, &tmp1267, &tmp1268, &tmp1269, &tmp1270, &tmp1271, &tmp1272, &tmp1273, &tmp1274, &tmp1275);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'newCapacity >= this.length' failed", "../../deps/v8/src/builtins/growable-fixed-array.tq", 15);
+  }
+
+  if (block68.is_used()) {
+    TNode<RawPtrT> tmp1276;
+    TNode<RawPtrT> tmp1277;
+    TNode<IntPtrT> tmp1278;
+    TNode<Context> tmp1279;
+    TNode<Object> tmp1280;
+    TNode<JSTypedArray> tmp1281;
+    TNode<JSTypedArray> tmp1282;
+    TNode<Smi> tmp1283;
+    TNode<JSReceiver> tmp1284;
+    TNode<Object> tmp1285;
+    TNode<FixedArray> tmp1286;
+    TNode<IntPtrT> tmp1287;
+    TNode<IntPtrT> tmp1288;
+    TNode<JSTypedArray> tmp1289;
+    TNode<JSTypedArray> tmp1290;
+    TNode<BuiltinPtr> tmp1291;
+    TNode<Smi> tmp1292;
+    TNode<JSTypedArray> tmp1293;
+    TNode<Context> tmp1294;
+    TNode<JSTypedArray> tmp1295;
+    TNode<Context> tmp1296;
+    TNode<NativeContext> tmp1297;
+    TNode<Map> tmp1298;
+    TNode<IntPtrT> tmp1299;
+    TNode<IntPtrT> tmp1300;
+    ca_.Bind(&block68, &tmp1276, &tmp1277, &tmp1278, &tmp1279, &tmp1280, &tmp1281, &tmp1282, &tmp1283, &tmp1284, &tmp1285, &tmp1286, &tmp1287, &tmp1288, &tmp1289, &tmp1290, &tmp1291, &tmp1292, &tmp1293, &tmp1294, &tmp1295, &tmp1296, &tmp1297, &tmp1298, &tmp1299, &tmp1300);
+  }
+
+  if (block67.is_used()) {
+    TNode<RawPtrT> tmp1301;
+    TNode<RawPtrT> tmp1302;
+    TNode<IntPtrT> tmp1303;
+    TNode<Context> tmp1304;
+    TNode<Object> tmp1305;
+    TNode<JSTypedArray> tmp1306;
+    TNode<JSTypedArray> tmp1307;
+    TNode<Smi> tmp1308;
+    TNode<JSReceiver> tmp1309;
+    TNode<Object> tmp1310;
+    TNode<FixedArray> tmp1311;
+    TNode<IntPtrT> tmp1312;
+    TNode<IntPtrT> tmp1313;
+    TNode<JSTypedArray> tmp1314;
+    TNode<JSTypedArray> tmp1315;
+    TNode<BuiltinPtr> tmp1316;
+    TNode<Smi> tmp1317;
+    TNode<JSTypedArray> tmp1318;
+    TNode<Context> tmp1319;
+    TNode<JSTypedArray> tmp1320;
+    TNode<Context> tmp1321;
+    TNode<NativeContext> tmp1322;
+    TNode<Map> tmp1323;
+    TNode<IntPtrT> tmp1324;
+    TNode<IntPtrT> tmp1325;
+    ca_.Bind(&block67, &tmp1301, &tmp1302, &tmp1303, &tmp1304, &tmp1305, &tmp1306, &tmp1307, &tmp1308, &tmp1309, &tmp1310, &tmp1311, &tmp1312, &tmp1313, &tmp1314, &tmp1315, &tmp1316, &tmp1317, &tmp1318, &tmp1319, &tmp1320, &tmp1321, &tmp1322, &tmp1323, &tmp1324, &tmp1325);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 16);
+    TNode<IntPtrT> tmp1326;
+    USE(tmp1326);
+    tmp1326 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 18);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 17);
+    TNode<FixedArray> tmp1327;
+    USE(tmp1327);
+    tmp1327 = CodeStubAssembler(state_).ExtractFixedArray(TNode<FixedArray>{tmp1311}, TNode<IntPtrT>{tmp1326}, TNode<IntPtrT>{tmp1313}, TNode<IntPtrT>{tmp1325}, CodeStubAssembler::ExtractFixedArrayFlag::kFixedArrays);
+    ca_.Goto(&block57, tmp1301, tmp1302, tmp1303, tmp1304, tmp1305, tmp1306, tmp1307, tmp1308, tmp1309, tmp1310, tmp1311, tmp1312, tmp1313, tmp1314, tmp1315, tmp1316, tmp1317, tmp1318, tmp1319, tmp1320, tmp1321, tmp1322, tmp1323, tmp1324, tmp1325, tmp1327);
+  }
+
+  if (block57.is_used()) {
+    TNode<RawPtrT> tmp1328;
+    TNode<RawPtrT> tmp1329;
+    TNode<IntPtrT> tmp1330;
+    TNode<Context> tmp1331;
+    TNode<Object> tmp1332;
+    TNode<JSTypedArray> tmp1333;
+    TNode<JSTypedArray> tmp1334;
+    TNode<Smi> tmp1335;
+    TNode<JSReceiver> tmp1336;
+    TNode<Object> tmp1337;
+    TNode<FixedArray> tmp1338;
+    TNode<IntPtrT> tmp1339;
+    TNode<IntPtrT> tmp1340;
+    TNode<JSTypedArray> tmp1341;
+    TNode<JSTypedArray> tmp1342;
+    TNode<BuiltinPtr> tmp1343;
+    TNode<Smi> tmp1344;
+    TNode<JSTypedArray> tmp1345;
+    TNode<Context> tmp1346;
+    TNode<JSTypedArray> tmp1347;
+    TNode<Context> tmp1348;
+    TNode<NativeContext> tmp1349;
+    TNode<Map> tmp1350;
+    TNode<IntPtrT> tmp1351;
+    TNode<IntPtrT> tmp1352;
+    TNode<FixedArray> tmp1353;
+    ca_.Bind(&block57, &tmp1328, &tmp1329, &tmp1330, &tmp1331, &tmp1332, &tmp1333, &tmp1334, &tmp1335, &tmp1336, &tmp1337, &tmp1338, &tmp1339, &tmp1340, &tmp1341, &tmp1342, &tmp1343, &tmp1344, &tmp1345, &tmp1346, &tmp1347, &tmp1348, &tmp1349, &tmp1350, &tmp1351, &tmp1352, &tmp1353);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 32);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 33);
+    TNode<Smi> tmp1354;
+    USE(tmp1354);
+    tmp1354 = Convert5ATSmi8ATintptr_187(state_, TNode<IntPtrT>{tmp1340});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/growable-fixed-array.tq", 34);
+    TNode<JSArray> tmp1355;
+    USE(tmp1355);
+    tmp1355 = CodeStubAssembler(state_).AllocateJSArray(TNode<Map>{tmp1350}, TNode<FixedArrayBase>{tmp1353}, TNode<Smi>{tmp1354});
+    ca_.Goto(&block56, tmp1328, tmp1329, tmp1330, tmp1331, tmp1332, tmp1333, tmp1334, tmp1335, tmp1336, tmp1337, tmp1338, tmp1339, tmp1340, tmp1341, tmp1342, tmp1343, tmp1344, tmp1345, tmp1346, tmp1347, tmp1348, tmp1355);
+  }
+
+  if (block56.is_used()) {
+    TNode<RawPtrT> tmp1356;
+    TNode<RawPtrT> tmp1357;
+    TNode<IntPtrT> tmp1358;
+    TNode<Context> tmp1359;
+    TNode<Object> tmp1360;
+    TNode<JSTypedArray> tmp1361;
+    TNode<JSTypedArray> tmp1362;
+    TNode<Smi> tmp1363;
+    TNode<JSReceiver> tmp1364;
+    TNode<Object> tmp1365;
+    TNode<FixedArray> tmp1366;
+    TNode<IntPtrT> tmp1367;
+    TNode<IntPtrT> tmp1368;
+    TNode<JSTypedArray> tmp1369;
+    TNode<JSTypedArray> tmp1370;
+    TNode<BuiltinPtr> tmp1371;
+    TNode<Smi> tmp1372;
+    TNode<JSTypedArray> tmp1373;
+    TNode<Context> tmp1374;
+    TNode<JSTypedArray> tmp1375;
+    TNode<Context> tmp1376;
+    TNode<JSArray> tmp1377;
+    ca_.Bind(&block56, &tmp1356, &tmp1357, &tmp1358, &tmp1359, &tmp1360, &tmp1361, &tmp1362, &tmp1363, &tmp1364, &tmp1365, &tmp1366, &tmp1367, &tmp1368, &tmp1369, &tmp1370, &tmp1371, &tmp1372, &tmp1373, &tmp1374, &tmp1375, &tmp1376, &tmp1377);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 71);
+    CodeStubAssembler(state_).CallRuntime(Runtime::kTypedArrayCopyElements, tmp1374, tmp1375, tmp1377, tmp1372);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 74);
+    arguments.PopAndReturn(tmp1373);
+  }
+
+  if (block2.is_used()) {
+    TNode<RawPtrT> tmp1379;
+    TNode<RawPtrT> tmp1380;
+    TNode<IntPtrT> tmp1381;
+    TNode<Context> tmp1382;
+    TNode<Object> tmp1383;
+    ca_.Bind(&block2, &tmp1379, &tmp1380, &tmp1381, &tmp1382, &tmp1383);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-filter.tq", 77);
+    CodeStubAssembler(state_).ThrowTypeError(TNode<Context>{tmp1382}, MessageTemplate::kDetachedOperation, kBuiltinName_368(state_));
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
+
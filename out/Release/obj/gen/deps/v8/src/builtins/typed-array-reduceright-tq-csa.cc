@@ -0,0 +1,934 @@
+#include "src/builtins/builtins-array-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-utils-gen.h"
+#include "src/builtins/builtins.h"
+#include "src/codegen/code-factory.h"
+#include "src/heap/factory-inl.h"
+#include "src/objects/arguments.h"
+#include "src/objects/bigint.h"
+#include "src/objects/elements-kind.h"
+#include "src/objects/free-space.h"
+#include "src/objects/js-generator.h"
+#include "src/objects/js-promise.h"
+#include "src/objects/js-regexp-string-iterator.h"
+#include "src/objects/js-weak-refs.h"
+#include "src/objects/objects.h"
+#include "src/objects/source-text-module.h"
+#include "src/objects/stack-frame-info.h"
+#include "src/objects/synthetic-module.h"
+#include "src/objects/template-objects.h"
+#include "src/builtins/builtins-bigint-gen.h"
+#include "src/builtins/builtins-collections-gen.h"
+#include "src/builtins/builtins-data-view-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-iterator-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-string-gen.h"
+#include "src/builtins/builtins-string-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-constructor-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "torque-generated/../../deps/v8/src/builtins/arguments-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-copywithin-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-join-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-lastindexof-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-map-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-right-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reverse-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-shift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-splice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-unshift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/base-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/bigint-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/boolean-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/collections-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/data-view-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/extras-utils-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/frames-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/growable-fixed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/internal-coverage-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/math-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-fromentries-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-constructor-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-delete-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-has-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-is-extensible-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-prevent-extensions-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revocable-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revoke-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/reflect-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-exec-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-all-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-replace-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-search-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-source-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-split-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-test-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-endswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-html-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-pad-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-repeat-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-startswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-substring-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/torque-internal-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-createtypedarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduceright-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-subarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/third_party/v8/builtins/array-sort-tq-csa.h"
+#include "torque-generated/../../deps/v8/test/torque/test-torque-tq-csa.h"
+
+namespace v8 {
+namespace internal {
+
+const char* kBuiltinName_377(compiler::CodeAssemblerState* state_) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0);
+
+    ca_.Bind(&block0);
+return "%TypedArray%.prototype.reduceRight";
+}
+
+TNode<Object> ReduceRightAllElements_378(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<JSTypedArray> p_array, TNode<JSReceiver> p_callbackfn, TNode<Object> p_initialValue) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, JSTypedArray, JSTypedArray, BuiltinPtr, JSTypedArray> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, JSTypedArray, JSTypedArray, BuiltinPtr, Number> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, JSTypedArray, JSTypedArray, BuiltinPtr, Number, Smi> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, JSTypedArray, JSTypedArray, BuiltinPtr> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, JSTypedArray, JSTypedArray, BuiltinPtr, Smi> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Smi> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Smi> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Smi> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Smi> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Smi> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Smi> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Smi> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Smi, Smi, Context, Smi, Object> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Smi, Object, Object, Object> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Smi, Object, Object, Object, Oddball> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Smi, Object, Object> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Smi, Object, Object, Object, Context, JSReceiver, Oddball, Object, Object, Smi, JSTypedArray> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Smi, Object, Object> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Smi> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Smi> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object> block25(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object, Object, Oddball> block24(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, JSTypedArray, JSTypedArray, BuiltinPtr, Smi, Object, Object> block23(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, Object> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSReceiver, Object, Object> block26(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_array, p_callbackfn, p_initialValue);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSTypedArray> tmp1;
+    TNode<JSReceiver> tmp2;
+    TNode<Object> tmp3;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 13);
+    TNode<JSTypedArray> tmp4;
+    USE(tmp4);
+    TNode<JSTypedArray> tmp5;
+    USE(tmp5);
+    TNode<BuiltinPtr> tmp6;
+    USE(tmp6);
+    std::tie(tmp4, tmp5, tmp6) = NewAttachedJSTypedArrayWitness_385(state_, TNode<JSTypedArray>{tmp1}).Flatten();
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array.tq", 96);
+    ca_.Goto(&block4, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp5);
+  }
+
+  if (block4.is_used()) {
+    TNode<Context> tmp7;
+    TNode<JSTypedArray> tmp8;
+    TNode<JSReceiver> tmp9;
+    TNode<Object> tmp10;
+    TNode<JSTypedArray> tmp11;
+    TNode<JSTypedArray> tmp12;
+    TNode<BuiltinPtr> tmp13;
+    TNode<JSTypedArray> tmp14;
+    ca_.Bind(&block4, &tmp7, &tmp8, &tmp9, &tmp10, &tmp11, &tmp12, &tmp13, &tmp14);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 16);
+    TNode<IntPtrT> tmp15 = ca_.IntPtrConstant(JSTypedArray::kLengthOffset);
+    USE(tmp15);
+    TNode<UintPtrT>tmp16 = CodeStubAssembler(state_).LoadReference<UintPtrT>(CodeStubAssembler::Reference{tmp14, tmp15});
+    TNode<Number> tmp17;
+    USE(tmp17);
+    tmp17 = Convert20UT5ATSmi10HeapNumber9ATuintptr_204(state_, TNode<UintPtrT>{tmp16});
+    TNode<Smi> tmp18;
+    USE(tmp18);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp18 = Cast5ATSmi_83(state_, TNode<Object>{tmp17}, &label0);
+    ca_.Goto(&block5, tmp7, tmp8, tmp9, tmp10, tmp11, tmp12, tmp13, tmp17, tmp18);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block6, tmp7, tmp8, tmp9, tmp10, tmp11, tmp12, tmp13, tmp17);
+    }
+  }
+
+  if (block6.is_used()) {
+    TNode<Context> tmp19;
+    TNode<JSTypedArray> tmp20;
+    TNode<JSReceiver> tmp21;
+    TNode<Object> tmp22;
+    TNode<JSTypedArray> tmp23;
+    TNode<JSTypedArray> tmp24;
+    TNode<BuiltinPtr> tmp25;
+    TNode<Number> tmp26;
+    ca_.Bind(&block6, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26);
+    ca_.Goto(&block3, tmp19, tmp20, tmp21, tmp22, tmp23, tmp24, tmp25);
+  }
+
+  if (block5.is_used()) {
+    TNode<Context> tmp27;
+    TNode<JSTypedArray> tmp28;
+    TNode<JSReceiver> tmp29;
+    TNode<Object> tmp30;
+    TNode<JSTypedArray> tmp31;
+    TNode<JSTypedArray> tmp32;
+    TNode<BuiltinPtr> tmp33;
+    TNode<Number> tmp34;
+    TNode<Smi> tmp35;
+    ca_.Bind(&block5, &tmp27, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34, &tmp35);
+    ca_.Goto(&block2, tmp27, tmp28, tmp29, tmp30, tmp31, tmp32, tmp33, tmp35);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp36;
+    TNode<JSTypedArray> tmp37;
+    TNode<JSReceiver> tmp38;
+    TNode<Object> tmp39;
+    TNode<JSTypedArray> tmp40;
+    TNode<JSTypedArray> tmp41;
+    TNode<BuiltinPtr> tmp42;
+    ca_.Bind(&block3, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp43;
+    TNode<JSTypedArray> tmp44;
+    TNode<JSReceiver> tmp45;
+    TNode<Object> tmp46;
+    TNode<JSTypedArray> tmp47;
+    TNode<JSTypedArray> tmp48;
+    TNode<BuiltinPtr> tmp49;
+    TNode<Smi> tmp50;
+    ca_.Bind(&block2, &tmp43, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 17);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 18);
+    TNode<Smi> tmp51;
+    USE(tmp51);
+    tmp51 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 1);
+    TNode<Smi> tmp52;
+    USE(tmp52);
+    tmp52 = CodeStubAssembler(state_).SmiSub(TNode<Smi>{tmp50}, TNode<Smi>{tmp51});
+    ca_.Goto(&block9, tmp43, tmp44, tmp45, tmp46, tmp47, tmp48, tmp49, tmp50, tmp46, tmp52);
+  }
+
+  if (block9.is_used()) {
+    TNode<Context> tmp53;
+    TNode<JSTypedArray> tmp54;
+    TNode<JSReceiver> tmp55;
+    TNode<Object> tmp56;
+    TNode<JSTypedArray> tmp57;
+    TNode<JSTypedArray> tmp58;
+    TNode<BuiltinPtr> tmp59;
+    TNode<Smi> tmp60;
+    TNode<Object> tmp61;
+    TNode<Smi> tmp62;
+    ca_.Bind(&block9, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62);
+    TNode<Smi> tmp63;
+    USE(tmp63);
+    tmp63 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 0);
+    TNode<BoolT> tmp64;
+    USE(tmp64);
+    tmp64 = CodeStubAssembler(state_).SmiGreaterThanOrEqual(TNode<Smi>{tmp62}, TNode<Smi>{tmp63});
+    ca_.Branch(tmp64, &block7, &block8, tmp53, tmp54, tmp55, tmp56, tmp57, tmp58, tmp59, tmp60, tmp61, tmp62);
+  }
+
+  if (block7.is_used()) {
+    TNode<Context> tmp65;
+    TNode<JSTypedArray> tmp66;
+    TNode<JSReceiver> tmp67;
+    TNode<Object> tmp68;
+    TNode<JSTypedArray> tmp69;
+    TNode<JSTypedArray> tmp70;
+    TNode<BuiltinPtr> tmp71;
+    TNode<Smi> tmp72;
+    TNode<Object> tmp73;
+    TNode<Smi> tmp74;
+    ca_.Bind(&block7, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array.tq", 104);
+    TNode<IntPtrT> tmp75 = ca_.IntPtrConstant(JSArrayBufferView::kBufferOffset);
+    USE(tmp75);
+    TNode<JSArrayBuffer>tmp76 = CodeStubAssembler(state_).LoadReference<JSArrayBuffer>(CodeStubAssembler::Reference{tmp69, tmp75});
+    TNode<BoolT> tmp77;
+    USE(tmp77);
+    tmp77 = CodeStubAssembler(state_).IsDetachedBuffer(TNode<JSArrayBuffer>{tmp76});
+    ca_.Branch(tmp77, &block14, &block15, tmp65, tmp66, tmp67, tmp68, tmp69, tmp70, tmp71, tmp72, tmp73, tmp74);
+  }
+
+  if (block14.is_used()) {
+    TNode<Context> tmp78;
+    TNode<JSTypedArray> tmp79;
+    TNode<JSReceiver> tmp80;
+    TNode<Object> tmp81;
+    TNode<JSTypedArray> tmp82;
+    TNode<JSTypedArray> tmp83;
+    TNode<BuiltinPtr> tmp84;
+    TNode<Smi> tmp85;
+    TNode<Object> tmp86;
+    TNode<Smi> tmp87;
+    ca_.Bind(&block14, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86, &tmp87);
+    ca_.Goto(&block12, tmp78, tmp79, tmp80, tmp81, tmp82, tmp83, tmp84, tmp85, tmp86, tmp87);
+  }
+
+  if (block15.is_used()) {
+    TNode<Context> tmp88;
+    TNode<JSTypedArray> tmp89;
+    TNode<JSReceiver> tmp90;
+    TNode<Object> tmp91;
+    TNode<JSTypedArray> tmp92;
+    TNode<JSTypedArray> tmp93;
+    TNode<BuiltinPtr> tmp94;
+    TNode<Smi> tmp95;
+    TNode<Object> tmp96;
+    TNode<Smi> tmp97;
+    ca_.Bind(&block15, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96, &tmp97);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array.tq", 105);
+    TNode<JSTypedArray> tmp98;
+    USE(tmp98);
+    tmp98 = (TNode<JSTypedArray>{tmp92});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 20);
+    ca_.Goto(&block13, tmp88, tmp89, tmp90, tmp91, tmp92, tmp98, tmp94, tmp95, tmp96, tmp97);
+  }
+
+  if (block13.is_used()) {
+    TNode<Context> tmp99;
+    TNode<JSTypedArray> tmp100;
+    TNode<JSReceiver> tmp101;
+    TNode<Object> tmp102;
+    TNode<JSTypedArray> tmp103;
+    TNode<JSTypedArray> tmp104;
+    TNode<BuiltinPtr> tmp105;
+    TNode<Smi> tmp106;
+    TNode<Object> tmp107;
+    TNode<Smi> tmp108;
+    ca_.Bind(&block13, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104, &tmp105, &tmp106, &tmp107, &tmp108);
+    ca_.Goto(&block11, tmp99, tmp100, tmp101, tmp102, tmp103, tmp104, tmp105, tmp106, tmp107, tmp108);
+  }
+
+  if (block12.is_used()) {
+    TNode<Context> tmp109;
+    TNode<JSTypedArray> tmp110;
+    TNode<JSReceiver> tmp111;
+    TNode<Object> tmp112;
+    TNode<JSTypedArray> tmp113;
+    TNode<JSTypedArray> tmp114;
+    TNode<BuiltinPtr> tmp115;
+    TNode<Smi> tmp116;
+    TNode<Object> tmp117;
+    TNode<Smi> tmp118;
+    ca_.Bind(&block12, &tmp109, &tmp110, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115, &tmp116, &tmp117, &tmp118);
+    ca_.Goto(&block8, tmp109, tmp110, tmp111, tmp112, tmp113, tmp114, tmp115, tmp116, tmp117, tmp118);
+  }
+
+  if (block11.is_used()) {
+    TNode<Context> tmp119;
+    TNode<JSTypedArray> tmp120;
+    TNode<JSReceiver> tmp121;
+    TNode<Object> tmp122;
+    TNode<JSTypedArray> tmp123;
+    TNode<JSTypedArray> tmp124;
+    TNode<BuiltinPtr> tmp125;
+    TNode<Smi> tmp126;
+    TNode<Object> tmp127;
+    TNode<Smi> tmp128;
+    ca_.Bind(&block11, &tmp119, &tmp120, &tmp121, &tmp122, &tmp123, &tmp124, &tmp125, &tmp126, &tmp127, &tmp128);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 21);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array.tq", 109);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array.tq", 110);
+    TNode<Object> tmp129 = CodeStubAssembler(state_).CallBuiltinPointer(Builtins::CallableFor(ca_.isolate(),ExampleBuiltinForTorqueFunctionPointerType(1)).descriptor(), tmp125, tmp119, tmp124, tmp128); 
+    USE(tmp129);
+    ca_.Goto(&block16, tmp119, tmp120, tmp121, tmp122, tmp123, tmp124, tmp125, tmp126, tmp127, tmp128, tmp128, tmp119, tmp128, tmp129);
+  }
+
+  if (block16.is_used()) {
+    TNode<Context> tmp130;
+    TNode<JSTypedArray> tmp131;
+    TNode<JSReceiver> tmp132;
+    TNode<Object> tmp133;
+    TNode<JSTypedArray> tmp134;
+    TNode<JSTypedArray> tmp135;
+    TNode<BuiltinPtr> tmp136;
+    TNode<Smi> tmp137;
+    TNode<Object> tmp138;
+    TNode<Smi> tmp139;
+    TNode<Smi> tmp140;
+    TNode<Context> tmp141;
+    TNode<Smi> tmp142;
+    TNode<Object> tmp143;
+    ca_.Bind(&block16, &tmp130, &tmp131, &tmp132, &tmp133, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138, &tmp139, &tmp140, &tmp141, &tmp142, &tmp143);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 21);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 22);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 23);
+    TNode<Oddball> tmp144;
+    USE(tmp144);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp144 = Cast9ATTheHole_88(state_, TNode<Object>{tmp138}, &label0);
+    ca_.Goto(&block19, tmp130, tmp131, tmp132, tmp133, tmp134, tmp135, tmp136, tmp137, tmp138, tmp139, tmp143, tmp138, tmp138, tmp144);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block20, tmp130, tmp131, tmp132, tmp133, tmp134, tmp135, tmp136, tmp137, tmp138, tmp139, tmp143, tmp138, tmp138);
+    }
+  }
+
+  if (block20.is_used()) {
+    TNode<Context> tmp145;
+    TNode<JSTypedArray> tmp146;
+    TNode<JSReceiver> tmp147;
+    TNode<Object> tmp148;
+    TNode<JSTypedArray> tmp149;
+    TNode<JSTypedArray> tmp150;
+    TNode<BuiltinPtr> tmp151;
+    TNode<Smi> tmp152;
+    TNode<Object> tmp153;
+    TNode<Smi> tmp154;
+    TNode<Object> tmp155;
+    TNode<Object> tmp156;
+    TNode<Object> tmp157;
+    ca_.Bind(&block20, &tmp145, &tmp146, &tmp147, &tmp148, &tmp149, &tmp150, &tmp151, &tmp152, &tmp153, &tmp154, &tmp155, &tmp156, &tmp157);
+    ca_.Goto(&block18, tmp145, tmp146, tmp147, tmp148, tmp149, tmp150, tmp151, tmp152, tmp153, tmp154, tmp155, tmp156);
+  }
+
+  if (block19.is_used()) {
+    TNode<Context> tmp158;
+    TNode<JSTypedArray> tmp159;
+    TNode<JSReceiver> tmp160;
+    TNode<Object> tmp161;
+    TNode<JSTypedArray> tmp162;
+    TNode<JSTypedArray> tmp163;
+    TNode<BuiltinPtr> tmp164;
+    TNode<Smi> tmp165;
+    TNode<Object> tmp166;
+    TNode<Smi> tmp167;
+    TNode<Object> tmp168;
+    TNode<Object> tmp169;
+    TNode<Object> tmp170;
+    TNode<Oddball> tmp171;
+    ca_.Bind(&block19, &tmp158, &tmp159, &tmp160, &tmp161, &tmp162, &tmp163, &tmp164, &tmp165, &tmp166, &tmp167, &tmp168, &tmp169, &tmp170, &tmp171);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 24);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 23);
+    ca_.Goto(&block17, tmp158, tmp159, tmp160, tmp161, tmp162, tmp163, tmp164, tmp165, tmp168, tmp167, tmp168, tmp169);
+  }
+
+  if (block18.is_used()) {
+    TNode<Context> tmp172;
+    TNode<JSTypedArray> tmp173;
+    TNode<JSReceiver> tmp174;
+    TNode<Object> tmp175;
+    TNode<JSTypedArray> tmp176;
+    TNode<JSTypedArray> tmp177;
+    TNode<BuiltinPtr> tmp178;
+    TNode<Smi> tmp179;
+    TNode<Object> tmp180;
+    TNode<Smi> tmp181;
+    TNode<Object> tmp182;
+    TNode<Object> tmp183;
+    ca_.Bind(&block18, &tmp172, &tmp173, &tmp174, &tmp175, &tmp176, &tmp177, &tmp178, &tmp179, &tmp180, &tmp181, &tmp182, &tmp183);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 26);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 28);
+    TNode<Oddball> tmp184;
+    USE(tmp184);
+    tmp184 = Undefined_64(state_);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array.tq", 100);
+    ca_.Goto(&block21, tmp172, tmp173, tmp174, tmp175, tmp176, tmp177, tmp178, tmp179, tmp180, tmp181, tmp182, tmp183, ca_.UncheckedCast<Object>(tmp183), tmp172, tmp174, tmp184, ca_.UncheckedCast<Object>(tmp183), tmp182, tmp181, tmp176);
+  }
+
+  if (block21.is_used()) {
+    TNode<Context> tmp185;
+    TNode<JSTypedArray> tmp186;
+    TNode<JSReceiver> tmp187;
+    TNode<Object> tmp188;
+    TNode<JSTypedArray> tmp189;
+    TNode<JSTypedArray> tmp190;
+    TNode<BuiltinPtr> tmp191;
+    TNode<Smi> tmp192;
+    TNode<Object> tmp193;
+    TNode<Smi> tmp194;
+    TNode<Object> tmp195;
+    TNode<Object> tmp196;
+    TNode<Object> tmp197;
+    TNode<Context> tmp198;
+    TNode<JSReceiver> tmp199;
+    TNode<Oddball> tmp200;
+    TNode<Object> tmp201;
+    TNode<Object> tmp202;
+    TNode<Smi> tmp203;
+    TNode<JSTypedArray> tmp204;
+    ca_.Bind(&block21, &tmp185, &tmp186, &tmp187, &tmp188, &tmp189, &tmp190, &tmp191, &tmp192, &tmp193, &tmp194, &tmp195, &tmp196, &tmp197, &tmp198, &tmp199, &tmp200, &tmp201, &tmp202, &tmp203, &tmp204);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 27);
+    TNode<Object> tmp205;
+    USE(tmp205);
+    tmp205 = CodeStubAssembler(state_).Call(TNode<Context>{tmp198}, TNode<JSReceiver>{tmp199}, TNode<Object>{tmp200}, TNode<Object>{tmp201}, TNode<Object>{tmp202}, TNode<Object>{tmp203}, TNode<Object>{tmp204});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 23);
+    ca_.Goto(&block17, tmp185, tmp186, tmp187, tmp188, tmp189, tmp190, tmp191, tmp192, tmp205, tmp194, tmp195, tmp196);
+  }
+
+  if (block17.is_used()) {
+    TNode<Context> tmp206;
+    TNode<JSTypedArray> tmp207;
+    TNode<JSReceiver> tmp208;
+    TNode<Object> tmp209;
+    TNode<JSTypedArray> tmp210;
+    TNode<JSTypedArray> tmp211;
+    TNode<BuiltinPtr> tmp212;
+    TNode<Smi> tmp213;
+    TNode<Object> tmp214;
+    TNode<Smi> tmp215;
+    TNode<Object> tmp216;
+    TNode<Object> tmp217;
+    ca_.Bind(&block17, &tmp206, &tmp207, &tmp208, &tmp209, &tmp210, &tmp211, &tmp212, &tmp213, &tmp214, &tmp215, &tmp216, &tmp217);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 22);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 18);
+    ca_.Goto(&block10, tmp206, tmp207, tmp208, tmp209, tmp210, tmp211, tmp212, tmp213, tmp214, tmp215);
+  }
+
+  if (block10.is_used()) {
+    TNode<Context> tmp218;
+    TNode<JSTypedArray> tmp219;
+    TNode<JSReceiver> tmp220;
+    TNode<Object> tmp221;
+    TNode<JSTypedArray> tmp222;
+    TNode<JSTypedArray> tmp223;
+    TNode<BuiltinPtr> tmp224;
+    TNode<Smi> tmp225;
+    TNode<Object> tmp226;
+    TNode<Smi> tmp227;
+    ca_.Bind(&block10, &tmp218, &tmp219, &tmp220, &tmp221, &tmp222, &tmp223, &tmp224, &tmp225, &tmp226, &tmp227);
+    TNode<Smi> tmp228;
+    USE(tmp228);
+    tmp228 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 1);
+    TNode<Smi> tmp229;
+    USE(tmp229);
+    tmp229 = CodeStubAssembler(state_).SmiSub(TNode<Smi>{tmp227}, TNode<Smi>{tmp228});
+    ca_.Goto(&block9, tmp218, tmp219, tmp220, tmp221, tmp222, tmp223, tmp224, tmp225, tmp226, tmp229);
+  }
+
+  if (block8.is_used()) {
+    TNode<Context> tmp230;
+    TNode<JSTypedArray> tmp231;
+    TNode<JSReceiver> tmp232;
+    TNode<Object> tmp233;
+    TNode<JSTypedArray> tmp234;
+    TNode<JSTypedArray> tmp235;
+    TNode<BuiltinPtr> tmp236;
+    TNode<Smi> tmp237;
+    TNode<Object> tmp238;
+    TNode<Smi> tmp239;
+    ca_.Bind(&block8, &tmp230, &tmp231, &tmp232, &tmp233, &tmp234, &tmp235, &tmp236, &tmp237, &tmp238, &tmp239);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 33);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 34);
+    TNode<Oddball> tmp240;
+    USE(tmp240);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp240 = Cast9ATTheHole_88(state_, TNode<Object>{tmp238}, &label0);
+    ca_.Goto(&block24, tmp230, tmp231, tmp232, tmp233, tmp234, tmp235, tmp236, tmp237, tmp238, tmp238, tmp238, tmp240);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block25, tmp230, tmp231, tmp232, tmp233, tmp234, tmp235, tmp236, tmp237, tmp238, tmp238, tmp238);
+    }
+  }
+
+  if (block25.is_used()) {
+    TNode<Context> tmp241;
+    TNode<JSTypedArray> tmp242;
+    TNode<JSReceiver> tmp243;
+    TNode<Object> tmp244;
+    TNode<JSTypedArray> tmp245;
+    TNode<JSTypedArray> tmp246;
+    TNode<BuiltinPtr> tmp247;
+    TNode<Smi> tmp248;
+    TNode<Object> tmp249;
+    TNode<Object> tmp250;
+    TNode<Object> tmp251;
+    ca_.Bind(&block25, &tmp241, &tmp242, &tmp243, &tmp244, &tmp245, &tmp246, &tmp247, &tmp248, &tmp249, &tmp250, &tmp251);
+    ca_.Goto(&block23, tmp241, tmp242, tmp243, tmp244, tmp245, tmp246, tmp247, tmp248, tmp249, tmp250);
+  }
+
+  if (block24.is_used()) {
+    TNode<Context> tmp252;
+    TNode<JSTypedArray> tmp253;
+    TNode<JSReceiver> tmp254;
+    TNode<Object> tmp255;
+    TNode<JSTypedArray> tmp256;
+    TNode<JSTypedArray> tmp257;
+    TNode<BuiltinPtr> tmp258;
+    TNode<Smi> tmp259;
+    TNode<Object> tmp260;
+    TNode<Object> tmp261;
+    TNode<Object> tmp262;
+    TNode<Oddball> tmp263;
+    ca_.Bind(&block24, &tmp252, &tmp253, &tmp254, &tmp255, &tmp256, &tmp257, &tmp258, &tmp259, &tmp260, &tmp261, &tmp262, &tmp263);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 35);
+    CodeStubAssembler(state_).ThrowTypeError(TNode<Context>{tmp252}, MessageTemplate::kReduceNoInitial, kBuiltinName_377(state_));
+  }
+
+  if (block23.is_used()) {
+    TNode<Context> tmp264;
+    TNode<JSTypedArray> tmp265;
+    TNode<JSReceiver> tmp266;
+    TNode<Object> tmp267;
+    TNode<JSTypedArray> tmp268;
+    TNode<JSTypedArray> tmp269;
+    TNode<BuiltinPtr> tmp270;
+    TNode<Smi> tmp271;
+    TNode<Object> tmp272;
+    TNode<Object> tmp273;
+    ca_.Bind(&block23, &tmp264, &tmp265, &tmp266, &tmp267, &tmp268, &tmp269, &tmp270, &tmp271, &tmp272, &tmp273);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 37);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 38);
+    ca_.Goto(&block1, tmp264, tmp265, tmp266, tmp267, ca_.UncheckedCast<Object>(tmp273));
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp274;
+    TNode<JSTypedArray> tmp275;
+    TNode<JSReceiver> tmp276;
+    TNode<Object> tmp277;
+    TNode<Object> tmp278;
+    ca_.Bind(&block1, &tmp274, &tmp275, &tmp276, &tmp277, &tmp278);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 10);
+    ca_.Goto(&block26, tmp274, tmp275, tmp276, tmp277, tmp278);
+  }
+
+    TNode<Context> tmp279;
+    TNode<JSTypedArray> tmp280;
+    TNode<JSReceiver> tmp281;
+    TNode<Object> tmp282;
+    TNode<Object> tmp283;
+    ca_.Bind(&block26, &tmp279, &tmp280, &tmp281, &tmp282, &tmp283);
+  return TNode<Object>{tmp283};
+}
+
+TF_BUILTIN(TypedArrayPrototypeReduceRight, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  Node* argc = Parameter(Descriptor::kJSActualArgumentsCount);
+  TNode<IntPtrT> arguments_length(ChangeInt32ToIntPtr(argc));
+  TNode<RawPtrT> arguments_frame = UncheckedCast<RawPtrT>(LoadFramePointer());
+  TorqueStructArguments torque_arguments(GetFrameArguments(arguments_frame, arguments_length));
+  CodeStubArguments arguments(this, torque_arguments);
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = arguments.GetReceiver();
+USE(parameter1);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, Object, JSTypedArray> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, JSTypedArray> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Object> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, Object, JSReceiver> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, JSReceiver> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, JSReceiver> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, JSReceiver, Object> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, JSTypedArray, JSReceiver, Object> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object> block6(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object> block4(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object> block2(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+    ca_.Goto(&block0, torque_arguments.frame, torque_arguments.base, torque_arguments.length, parameter0, parameter1);
+
+  if (block0.is_used()) {
+    TNode<RawPtrT> tmp0;
+    TNode<RawPtrT> tmp1;
+    TNode<IntPtrT> tmp2;
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 50);
+    TNode<JSTypedArray> tmp5;
+    USE(tmp5);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp5 = Cast12JSTypedArray_111(state_, TNode<Context>{tmp3}, TNode<Object>{tmp4}, &label0);
+    ca_.Goto(&block7, tmp0, tmp1, tmp2, tmp3, tmp4, tmp4, tmp5);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block8, tmp0, tmp1, tmp2, tmp3, tmp4, tmp4);
+    }
+  }
+
+  if (block8.is_used()) {
+    TNode<RawPtrT> tmp6;
+    TNode<RawPtrT> tmp7;
+    TNode<IntPtrT> tmp8;
+    TNode<Context> tmp9;
+    TNode<Object> tmp10;
+    TNode<Object> tmp11;
+    ca_.Bind(&block8, &tmp6, &tmp7, &tmp8, &tmp9, &tmp10, &tmp11);
+    ca_.Goto(&block4, tmp6, tmp7, tmp8, tmp9, tmp10);
+  }
+
+  if (block7.is_used()) {
+    TNode<RawPtrT> tmp12;
+    TNode<RawPtrT> tmp13;
+    TNode<IntPtrT> tmp14;
+    TNode<Context> tmp15;
+    TNode<Object> tmp16;
+    TNode<Object> tmp17;
+    TNode<JSTypedArray> tmp18;
+    ca_.Bind(&block7, &tmp12, &tmp13, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 52);
+    TNode<JSTypedArray> tmp19;
+    USE(tmp19);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp19 = EnsureAttached_384(state_, TNode<JSTypedArray>{tmp18}, &label0);
+    ca_.Goto(&block9, tmp12, tmp13, tmp14, tmp15, tmp16, tmp18, tmp18, tmp19);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block10, tmp12, tmp13, tmp14, tmp15, tmp16, tmp18, tmp18);
+    }
+  }
+
+  if (block10.is_used()) {
+    TNode<RawPtrT> tmp20;
+    TNode<RawPtrT> tmp21;
+    TNode<IntPtrT> tmp22;
+    TNode<Context> tmp23;
+    TNode<Object> tmp24;
+    TNode<JSTypedArray> tmp25;
+    TNode<JSTypedArray> tmp26;
+    ca_.Bind(&block10, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26);
+    ca_.Goto(&block2, tmp20, tmp21, tmp22, tmp23, tmp24);
+  }
+
+  if (block9.is_used()) {
+    TNode<RawPtrT> tmp27;
+    TNode<RawPtrT> tmp28;
+    TNode<IntPtrT> tmp29;
+    TNode<Context> tmp30;
+    TNode<Object> tmp31;
+    TNode<JSTypedArray> tmp32;
+    TNode<JSTypedArray> tmp33;
+    TNode<JSTypedArray> tmp34;
+    ca_.Bind(&block9, &tmp27, &tmp28, &tmp29, &tmp30, &tmp31, &tmp32, &tmp33, &tmp34);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 54);
+    TNode<IntPtrT> tmp35;
+    USE(tmp35);
+    tmp35 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<Object> tmp36;
+    USE(tmp36);
+    tmp36 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp27}, TNode<RawPtrT>{tmp28}, TNode<IntPtrT>{tmp29}}, TNode<IntPtrT>{tmp35});
+    TNode<JSReceiver> tmp37;
+    USE(tmp37);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp37 = Cast71UT19ATCallableApiObject17ATCallableJSProxy15JSBoundFunction10JSFunction_1366(state_, TNode<Context>{tmp30}, TNode<Object>{tmp36}, &label0);
+    ca_.Goto(&block11, tmp27, tmp28, tmp29, tmp30, tmp31, tmp32, tmp34, tmp36, tmp37);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block12, tmp27, tmp28, tmp29, tmp30, tmp31, tmp32, tmp34, tmp36);
+    }
+  }
+
+  if (block12.is_used()) {
+    TNode<RawPtrT> tmp38;
+    TNode<RawPtrT> tmp39;
+    TNode<IntPtrT> tmp40;
+    TNode<Context> tmp41;
+    TNode<Object> tmp42;
+    TNode<JSTypedArray> tmp43;
+    TNode<JSTypedArray> tmp44;
+    TNode<Object> tmp45;
+    ca_.Bind(&block12, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44, &tmp45);
+    ca_.Goto(&block6, tmp38, tmp39, tmp40, tmp41, tmp42);
+  }
+
+  if (block11.is_used()) {
+    TNode<RawPtrT> tmp46;
+    TNode<RawPtrT> tmp47;
+    TNode<IntPtrT> tmp48;
+    TNode<Context> tmp49;
+    TNode<Object> tmp50;
+    TNode<JSTypedArray> tmp51;
+    TNode<JSTypedArray> tmp52;
+    TNode<Object> tmp53;
+    TNode<JSReceiver> tmp54;
+    ca_.Bind(&block11, &tmp46, &tmp47, &tmp48, &tmp49, &tmp50, &tmp51, &tmp52, &tmp53, &tmp54);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 55);
+    TNode<IntPtrT> tmp55;
+    USE(tmp55);
+    tmp55 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 2);
+    TNode<BoolT> tmp56;
+    USE(tmp56);
+    tmp56 = CodeStubAssembler(state_).IntPtrGreaterThanOrEqual(TNode<IntPtrT>{tmp48}, TNode<IntPtrT>{tmp55});
+    ca_.Branch(tmp56, &block13, &block14, tmp46, tmp47, tmp48, tmp49, tmp50, tmp51, tmp52, tmp54);
+  }
+
+  if (block13.is_used()) {
+    TNode<RawPtrT> tmp57;
+    TNode<RawPtrT> tmp58;
+    TNode<IntPtrT> tmp59;
+    TNode<Context> tmp60;
+    TNode<Object> tmp61;
+    TNode<JSTypedArray> tmp62;
+    TNode<JSTypedArray> tmp63;
+    TNode<JSReceiver> tmp64;
+    ca_.Bind(&block13, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64);
+    TNode<IntPtrT> tmp65;
+    USE(tmp65);
+    tmp65 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<Object> tmp66;
+    USE(tmp66);
+    tmp66 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp57}, TNode<RawPtrT>{tmp58}, TNode<IntPtrT>{tmp59}}, TNode<IntPtrT>{tmp65});
+    ca_.Goto(&block16, tmp57, tmp58, tmp59, tmp60, tmp61, tmp62, tmp63, tmp64, tmp66);
+  }
+
+  if (block14.is_used()) {
+    TNode<RawPtrT> tmp67;
+    TNode<RawPtrT> tmp68;
+    TNode<IntPtrT> tmp69;
+    TNode<Context> tmp70;
+    TNode<Object> tmp71;
+    TNode<JSTypedArray> tmp72;
+    TNode<JSTypedArray> tmp73;
+    TNode<JSReceiver> tmp74;
+    ca_.Bind(&block14, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74);
+    TNode<Oddball> tmp75;
+    USE(tmp75);
+    tmp75 = TheHole_62(state_);
+    ca_.Goto(&block15, tmp67, tmp68, tmp69, tmp70, tmp71, tmp72, tmp73, tmp74, tmp75);
+  }
+
+  if (block16.is_used()) {
+    TNode<RawPtrT> tmp76;
+    TNode<RawPtrT> tmp77;
+    TNode<IntPtrT> tmp78;
+    TNode<Context> tmp79;
+    TNode<Object> tmp80;
+    TNode<JSTypedArray> tmp81;
+    TNode<JSTypedArray> tmp82;
+    TNode<JSReceiver> tmp83;
+    TNode<Object> tmp84;
+    ca_.Bind(&block16, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84);
+    ca_.Goto(&block15, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, tmp83, tmp84);
+  }
+
+  if (block15.is_used()) {
+    TNode<RawPtrT> tmp85;
+    TNode<RawPtrT> tmp86;
+    TNode<IntPtrT> tmp87;
+    TNode<Context> tmp88;
+    TNode<Object> tmp89;
+    TNode<JSTypedArray> tmp90;
+    TNode<JSTypedArray> tmp91;
+    TNode<JSReceiver> tmp92;
+    TNode<Object> tmp93;
+    ca_.Bind(&block15, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 57);
+    TNode<Object> tmp94;
+    USE(tmp94);
+    tmp94 = ReduceRightAllElements_378(state_, TNode<Context>{tmp88}, TNode<JSTypedArray>{tmp91}, TNode<JSReceiver>{tmp92}, TNode<Object>{tmp93});
+    arguments.PopAndReturn(tmp94);
+  }
+
+  if (block6.is_used()) {
+    TNode<RawPtrT> tmp95;
+    TNode<RawPtrT> tmp96;
+    TNode<IntPtrT> tmp97;
+    TNode<Context> tmp98;
+    TNode<Object> tmp99;
+    ca_.Bind(&block6, &tmp95, &tmp96, &tmp97, &tmp98, &tmp99);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 60);
+    TNode<IntPtrT> tmp100;
+    USE(tmp100);
+    tmp100 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<Object> tmp101;
+    USE(tmp101);
+    tmp101 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp95}, TNode<RawPtrT>{tmp96}, TNode<IntPtrT>{tmp97}}, TNode<IntPtrT>{tmp100});
+    CodeStubAssembler(state_).ThrowTypeError(TNode<Context>{tmp98}, MessageTemplate::kCalledNonCallable, TNode<Object>{tmp101});
+  }
+
+  if (block4.is_used()) {
+    TNode<RawPtrT> tmp102;
+    TNode<RawPtrT> tmp103;
+    TNode<IntPtrT> tmp104;
+    TNode<Context> tmp105;
+    TNode<Object> tmp106;
+    ca_.Bind(&block4, &tmp102, &tmp103, &tmp104, &tmp105, &tmp106);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 63);
+    CodeStubAssembler(state_).ThrowTypeError(TNode<Context>{tmp105}, MessageTemplate::kNotTypedArray, kBuiltinName_377(state_));
+  }
+
+  if (block2.is_used()) {
+    TNode<RawPtrT> tmp107;
+    TNode<RawPtrT> tmp108;
+    TNode<IntPtrT> tmp109;
+    TNode<Context> tmp110;
+    TNode<Object> tmp111;
+    ca_.Bind(&block2, &tmp107, &tmp108, &tmp109, &tmp110, &tmp111);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-reduceright.tq", 66);
+    CodeStubAssembler(state_).ThrowTypeError(TNode<Context>{tmp110}, MessageTemplate::kDetachedOperation, kBuiltinName_377(state_));
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
+
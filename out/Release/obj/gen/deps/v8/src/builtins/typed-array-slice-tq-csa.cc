@@ -0,0 +1,1198 @@
+#include "src/builtins/builtins-array-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-utils-gen.h"
+#include "src/builtins/builtins.h"
+#include "src/codegen/code-factory.h"
+#include "src/heap/factory-inl.h"
+#include "src/objects/arguments.h"
+#include "src/objects/bigint.h"
+#include "src/objects/elements-kind.h"
+#include "src/objects/free-space.h"
+#include "src/objects/js-generator.h"
+#include "src/objects/js-promise.h"
+#include "src/objects/js-regexp-string-iterator.h"
+#include "src/objects/js-weak-refs.h"
+#include "src/objects/objects.h"
+#include "src/objects/source-text-module.h"
+#include "src/objects/stack-frame-info.h"
+#include "src/objects/synthetic-module.h"
+#include "src/objects/template-objects.h"
+#include "src/builtins/builtins-bigint-gen.h"
+#include "src/builtins/builtins-collections-gen.h"
+#include "src/builtins/builtins-data-view-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-iterator-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-proxy-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-string-gen.h"
+#include "src/builtins/builtins-string-gen.h"
+#include "src/builtins/builtins-regexp-gen.h"
+#include "src/builtins/builtins-constructor-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "src/builtins/builtins-typed-array-gen.h"
+#include "torque-generated/../../deps/v8/src/builtins/arguments-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-copywithin-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-join-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-lastindexof-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-map-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-right-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reverse-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-shift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-splice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-unshift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/base-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/bigint-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/boolean-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/collections-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/data-view-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/extras-utils-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/frames-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/growable-fixed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/internal-coverage-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/math-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-fromentries-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-constructor-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-delete-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-has-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-is-extensible-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-prevent-extensions-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revocable-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revoke-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/reflect-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-exec-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-all-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-replace-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-search-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-source-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-split-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-test-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-endswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-html-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-pad-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-repeat-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-startswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-substring-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/torque-internal-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-createtypedarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduceright-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-subarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/third_party/v8/builtins/array-sort-tq-csa.h"
+#include "torque-generated/../../deps/v8/test/torque/test-torque-tq-csa.h"
+
+namespace v8 {
+namespace internal {
+
+const char* kBuiltinName_379(compiler::CodeAssemblerState* state_) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0);
+
+    ca_.Bind(&block0);
+return "%TypedArray%.prototype.slice";
+}
+
+void FastCopy_380(compiler::CodeAssemblerState* state_, TNode<JSTypedArray> p_src, TNode<JSTypedArray> p_dest, TNode<IntPtrT> p_k, TNode<Smi> p_count, compiler::CodeAssemblerLabel* label_IfSlow) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi, Int32T, UintPtrT, Int32T> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi, Int32T, UintPtrT, Int32T> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi, Int32T, UintPtrT, Int32T> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi, Int32T, UintPtrT, Int32T> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi, Int32T, UintPtrT, Int32T, UintPtrT, Int32T, Smi, Smi, UintPtrT, UintPtrT> block12(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi, Int32T, UintPtrT, Int32T, UintPtrT, Int32T, Smi, Smi, UintPtrT, UintPtrT> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi, Int32T, UintPtrT, Int32T, UintPtrT, Int32T, Smi, Smi, UintPtrT> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi, Int32T, UintPtrT, Int32T> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi, Int32T, UintPtrT, Int32T, UintPtrT> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi, Int32T, UintPtrT, Int32T, UintPtrT, UintPtrT, Int32T, Smi, Smi, UintPtrT, UintPtrT> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi, Int32T, UintPtrT, Int32T, UintPtrT, UintPtrT, Int32T, Smi, Smi, UintPtrT, UintPtrT> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi, Int32T, UintPtrT, Int32T, UintPtrT, UintPtrT, Int32T, Smi, Smi, UintPtrT> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi, Int32T, UintPtrT, Int32T, UintPtrT> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi, Int32T, UintPtrT, Int32T, UintPtrT, UintPtrT> block14(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi, Int32T, UintPtrT, Int32T, UintPtrT, UintPtrT, RawPtrT> block19(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi, Int32T, UintPtrT, Int32T, UintPtrT, UintPtrT, RawPtrT> block22(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi, Int32T, UintPtrT, Int32T, UintPtrT, UintPtrT, RawPtrT> block21(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi, Int32T, UintPtrT, Int32T, UintPtrT, UintPtrT, RawPtrT> block20(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi, Int32T, UintPtrT, Int32T, UintPtrT, UintPtrT, RawPtrT> block23(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi, Int32T, UintPtrT, Int32T, UintPtrT, UintPtrT, RawPtrT> block26(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi, Int32T, UintPtrT, Int32T, UintPtrT, UintPtrT, RawPtrT> block25(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi, Int32T, UintPtrT, Int32T, UintPtrT, UintPtrT, RawPtrT> block24(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<JSTypedArray, JSTypedArray, IntPtrT, Smi> block27(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_src, p_dest, p_k, p_count);
+
+  if (block0.is_used()) {
+    TNode<JSTypedArray> tmp0;
+    TNode<JSTypedArray> tmp1;
+    TNode<IntPtrT> tmp2;
+    TNode<Smi> tmp3;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 16);
+    TNode<BoolT> tmp4;
+    USE(tmp4);
+    tmp4 = IsForceSlowPath_242(state_);
+    ca_.Branch(tmp4, &block3, &block4, tmp0, tmp1, tmp2, tmp3);
+  }
+
+  if (block3.is_used()) {
+    TNode<JSTypedArray> tmp5;
+    TNode<JSTypedArray> tmp6;
+    TNode<IntPtrT> tmp7;
+    TNode<Smi> tmp8;
+    ca_.Bind(&block3, &tmp5, &tmp6, &tmp7, &tmp8);
+    ca_.Goto(&block1);
+  }
+
+  if (block4.is_used()) {
+    TNode<JSTypedArray> tmp9;
+    TNode<JSTypedArray> tmp10;
+    TNode<IntPtrT> tmp11;
+    TNode<Smi> tmp12;
+    ca_.Bind(&block4, &tmp9, &tmp10, &tmp11, &tmp12);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 18);
+    TNode<Int32T> tmp13;
+    USE(tmp13);
+    tmp13 = CodeStubAssembler(state_).LoadElementsKind(TNode<JSTypedArray>{tmp9});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 19);
+    TNode<UintPtrT> tmp14;
+    USE(tmp14);
+    TNode<Int32T> tmp15;
+    USE(tmp15);
+    std::tie(tmp14, tmp15) = TypedArrayBuiltinsAssembler(state_).GetTypedArrayElementsInfo(TNode<JSTypedArray>{tmp10}).Flatten();
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 25);
+    TNode<BoolT> tmp16;
+    USE(tmp16);
+    tmp16 = ElementsKindNotEqual_72(state_, TNode<Int32T>{tmp13}, TNode<Int32T>{tmp15});
+    ca_.Branch(tmp16, &block5, &block6, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15);
+  }
+
+  if (block5.is_used()) {
+    TNode<JSTypedArray> tmp17;
+    TNode<JSTypedArray> tmp18;
+    TNode<IntPtrT> tmp19;
+    TNode<Smi> tmp20;
+    TNode<Int32T> tmp21;
+    TNode<UintPtrT> tmp22;
+    TNode<Int32T> tmp23;
+    ca_.Bind(&block5, &tmp17, &tmp18, &tmp19, &tmp20, &tmp21, &tmp22, &tmp23);
+    ca_.Goto(&block1);
+  }
+
+  if (block6.is_used()) {
+    TNode<JSTypedArray> tmp24;
+    TNode<JSTypedArray> tmp25;
+    TNode<IntPtrT> tmp26;
+    TNode<Smi> tmp27;
+    TNode<Int32T> tmp28;
+    TNode<UintPtrT> tmp29;
+    TNode<Int32T> tmp30;
+    ca_.Bind(&block6, &tmp24, &tmp25, &tmp26, &tmp27, &tmp28, &tmp29, &tmp30);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 26);
+    TNode<IntPtrT> tmp31 = ca_.IntPtrConstant(JSArrayBufferView::kBufferOffset);
+    USE(tmp31);
+    TNode<JSArrayBuffer>tmp32 = CodeStubAssembler(state_).LoadReference<JSArrayBuffer>(CodeStubAssembler::Reference{tmp25, tmp31});
+    TNode<IntPtrT> tmp33 = ca_.IntPtrConstant(JSArrayBufferView::kBufferOffset);
+    USE(tmp33);
+    TNode<JSArrayBuffer>tmp34 = CodeStubAssembler(state_).LoadReference<JSArrayBuffer>(CodeStubAssembler::Reference{tmp24, tmp33});
+    TNode<BoolT> tmp35;
+    USE(tmp35);
+    tmp35 = CodeStubAssembler(state_).TaggedEqual(TNode<HeapObject>{tmp32}, TNode<HeapObject>{tmp34});
+    ca_.Branch(tmp35, &block7, &block8, tmp24, tmp25, tmp26, tmp27, tmp28, tmp29, tmp30);
+  }
+
+  if (block7.is_used()) {
+    TNode<JSTypedArray> tmp36;
+    TNode<JSTypedArray> tmp37;
+    TNode<IntPtrT> tmp38;
+    TNode<Smi> tmp39;
+    TNode<Int32T> tmp40;
+    TNode<UintPtrT> tmp41;
+    TNode<Int32T> tmp42;
+    ca_.Bind(&block7, &tmp36, &tmp37, &tmp38, &tmp39, &tmp40, &tmp41, &tmp42);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 27);
+    ca_.Goto(&block1);
+  }
+
+  if (block8.is_used()) {
+    TNode<JSTypedArray> tmp43;
+    TNode<JSTypedArray> tmp44;
+    TNode<IntPtrT> tmp45;
+    TNode<Smi> tmp46;
+    TNode<Int32T> tmp47;
+    TNode<UintPtrT> tmp48;
+    TNode<Int32T> tmp49;
+    ca_.Bind(&block8, &tmp43, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48, &tmp49);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 31);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array.tq", 26);
+    TNode<UintPtrT> tmp50;
+    USE(tmp50);
+    tmp50 = Convert9ATuintptr13ATPositiveSmi_190(state_, TNode<Smi>{tmp46});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array.tq", 27);
+    TNode<UintPtrT> tmp51;
+    USE(tmp51);
+    tmp51 = CodeStubAssembler(state_).WordShl(TNode<UintPtrT>{tmp50}, TNode<UintPtrT>{tmp48});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array.tq", 30);
+    TNode<UintPtrT> tmp52;
+    USE(tmp52);
+    tmp52 = CodeStubAssembler(state_).WordShr(TNode<UintPtrT>{tmp51}, TNode<UintPtrT>{tmp48});
+    TNode<BoolT> tmp53;
+    USE(tmp53);
+    tmp53 = CodeStubAssembler(state_).WordNotEqual(TNode<UintPtrT>{tmp52}, TNode<UintPtrT>{tmp50});
+    ca_.Branch(tmp53, &block12, &block13, tmp43, tmp44, tmp45, tmp46, tmp47, tmp48, tmp49, tmp48, tmp49, tmp46, tmp46, tmp50, tmp51);
+  }
+
+  if (block12.is_used()) {
+    TNode<JSTypedArray> tmp54;
+    TNode<JSTypedArray> tmp55;
+    TNode<IntPtrT> tmp56;
+    TNode<Smi> tmp57;
+    TNode<Int32T> tmp58;
+    TNode<UintPtrT> tmp59;
+    TNode<Int32T> tmp60;
+    TNode<UintPtrT> tmp61;
+    TNode<Int32T> tmp62;
+    TNode<Smi> tmp63;
+    TNode<Smi> tmp64;
+    TNode<UintPtrT> tmp65;
+    TNode<UintPtrT> tmp66;
+    ca_.Bind(&block12, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62, &tmp63, &tmp64, &tmp65, &tmp66);
+    ca_.Goto(&block10, tmp54, tmp55, tmp56, tmp57, tmp58, tmp59, tmp60);
+  }
+
+  if (block13.is_used()) {
+    TNode<JSTypedArray> tmp67;
+    TNode<JSTypedArray> tmp68;
+    TNode<IntPtrT> tmp69;
+    TNode<Smi> tmp70;
+    TNode<Int32T> tmp71;
+    TNode<UintPtrT> tmp72;
+    TNode<Int32T> tmp73;
+    TNode<UintPtrT> tmp74;
+    TNode<Int32T> tmp75;
+    TNode<Smi> tmp76;
+    TNode<Smi> tmp77;
+    TNode<UintPtrT> tmp78;
+    TNode<UintPtrT> tmp79;
+    ca_.Bind(&block13, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array.tq", 31);
+    ca_.Goto(&block11, tmp67, tmp68, tmp69, tmp70, tmp71, tmp72, tmp73, tmp74, tmp75, tmp76, tmp77, tmp79);
+  }
+
+  if (block11.is_used()) {
+    TNode<JSTypedArray> tmp80;
+    TNode<JSTypedArray> tmp81;
+    TNode<IntPtrT> tmp82;
+    TNode<Smi> tmp83;
+    TNode<Int32T> tmp84;
+    TNode<UintPtrT> tmp85;
+    TNode<Int32T> tmp86;
+    TNode<UintPtrT> tmp87;
+    TNode<Int32T> tmp88;
+    TNode<Smi> tmp89;
+    TNode<Smi> tmp90;
+    TNode<UintPtrT> tmp91;
+    ca_.Bind(&block11, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 31);
+    ca_.Goto(&block9, tmp80, tmp81, tmp82, tmp83, tmp84, tmp85, tmp86, tmp91);
+  }
+
+  if (block10.is_used()) {
+    TNode<JSTypedArray> tmp92;
+    TNode<JSTypedArray> tmp93;
+    TNode<IntPtrT> tmp94;
+    TNode<Smi> tmp95;
+    TNode<Int32T> tmp96;
+    TNode<UintPtrT> tmp97;
+    TNode<Int32T> tmp98;
+    ca_.Bind(&block10, &tmp92, &tmp93, &tmp94, &tmp95, &tmp96, &tmp97, &tmp98);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block9.is_used()) {
+    TNode<JSTypedArray> tmp99;
+    TNode<JSTypedArray> tmp100;
+    TNode<IntPtrT> tmp101;
+    TNode<Smi> tmp102;
+    TNode<Int32T> tmp103;
+    TNode<UintPtrT> tmp104;
+    TNode<Int32T> tmp105;
+    TNode<UintPtrT> tmp106;
+    ca_.Bind(&block9, &tmp99, &tmp100, &tmp101, &tmp102, &tmp103, &tmp104, &tmp105, &tmp106);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 30);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 33);
+    TNode<Smi> tmp107;
+    USE(tmp107);
+    tmp107 = Convert13ATPositiveSmi8ATintptr_192(state_, TNode<IntPtrT>{tmp101});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array.tq", 26);
+    TNode<UintPtrT> tmp108;
+    USE(tmp108);
+    tmp108 = Convert9ATuintptr13ATPositiveSmi_190(state_, TNode<Smi>{tmp107});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array.tq", 27);
+    TNode<UintPtrT> tmp109;
+    USE(tmp109);
+    tmp109 = CodeStubAssembler(state_).WordShl(TNode<UintPtrT>{tmp108}, TNode<UintPtrT>{tmp104});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array.tq", 30);
+    TNode<UintPtrT> tmp110;
+    USE(tmp110);
+    tmp110 = CodeStubAssembler(state_).WordShr(TNode<UintPtrT>{tmp109}, TNode<UintPtrT>{tmp104});
+    TNode<BoolT> tmp111;
+    USE(tmp111);
+    tmp111 = CodeStubAssembler(state_).WordNotEqual(TNode<UintPtrT>{tmp110}, TNode<UintPtrT>{tmp108});
+    ca_.Branch(tmp111, &block17, &block18, tmp99, tmp100, tmp101, tmp102, tmp103, tmp104, tmp105, tmp106, tmp104, tmp105, tmp107, tmp107, tmp108, tmp109);
+  }
+
+  if (block17.is_used()) {
+    TNode<JSTypedArray> tmp112;
+    TNode<JSTypedArray> tmp113;
+    TNode<IntPtrT> tmp114;
+    TNode<Smi> tmp115;
+    TNode<Int32T> tmp116;
+    TNode<UintPtrT> tmp117;
+    TNode<Int32T> tmp118;
+    TNode<UintPtrT> tmp119;
+    TNode<UintPtrT> tmp120;
+    TNode<Int32T> tmp121;
+    TNode<Smi> tmp122;
+    TNode<Smi> tmp123;
+    TNode<UintPtrT> tmp124;
+    TNode<UintPtrT> tmp125;
+    ca_.Bind(&block17, &tmp112, &tmp113, &tmp114, &tmp115, &tmp116, &tmp117, &tmp118, &tmp119, &tmp120, &tmp121, &tmp122, &tmp123, &tmp124, &tmp125);
+    ca_.Goto(&block15, tmp112, tmp113, tmp114, tmp115, tmp116, tmp117, tmp118, tmp119);
+  }
+
+  if (block18.is_used()) {
+    TNode<JSTypedArray> tmp126;
+    TNode<JSTypedArray> tmp127;
+    TNode<IntPtrT> tmp128;
+    TNode<Smi> tmp129;
+    TNode<Int32T> tmp130;
+    TNode<UintPtrT> tmp131;
+    TNode<Int32T> tmp132;
+    TNode<UintPtrT> tmp133;
+    TNode<UintPtrT> tmp134;
+    TNode<Int32T> tmp135;
+    TNode<Smi> tmp136;
+    TNode<Smi> tmp137;
+    TNode<UintPtrT> tmp138;
+    TNode<UintPtrT> tmp139;
+    ca_.Bind(&block18, &tmp126, &tmp127, &tmp128, &tmp129, &tmp130, &tmp131, &tmp132, &tmp133, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138, &tmp139);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array.tq", 31);
+    ca_.Goto(&block16, tmp126, tmp127, tmp128, tmp129, tmp130, tmp131, tmp132, tmp133, tmp134, tmp135, tmp136, tmp137, tmp139);
+  }
+
+  if (block16.is_used()) {
+    TNode<JSTypedArray> tmp140;
+    TNode<JSTypedArray> tmp141;
+    TNode<IntPtrT> tmp142;
+    TNode<Smi> tmp143;
+    TNode<Int32T> tmp144;
+    TNode<UintPtrT> tmp145;
+    TNode<Int32T> tmp146;
+    TNode<UintPtrT> tmp147;
+    TNode<UintPtrT> tmp148;
+    TNode<Int32T> tmp149;
+    TNode<Smi> tmp150;
+    TNode<Smi> tmp151;
+    TNode<UintPtrT> tmp152;
+    ca_.Bind(&block16, &tmp140, &tmp141, &tmp142, &tmp143, &tmp144, &tmp145, &tmp146, &tmp147, &tmp148, &tmp149, &tmp150, &tmp151, &tmp152);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 33);
+    ca_.Goto(&block14, tmp140, tmp141, tmp142, tmp143, tmp144, tmp145, tmp146, tmp147, tmp152);
+  }
+
+  if (block15.is_used()) {
+    TNode<JSTypedArray> tmp153;
+    TNode<JSTypedArray> tmp154;
+    TNode<IntPtrT> tmp155;
+    TNode<Smi> tmp156;
+    TNode<Int32T> tmp157;
+    TNode<UintPtrT> tmp158;
+    TNode<Int32T> tmp159;
+    TNode<UintPtrT> tmp160;
+    ca_.Bind(&block15, &tmp153, &tmp154, &tmp155, &tmp156, &tmp157, &tmp158, &tmp159, &tmp160);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 34);
+    CodeStubAssembler(state_).Unreachable();
+  }
+
+  if (block14.is_used()) {
+    TNode<JSTypedArray> tmp161;
+    TNode<JSTypedArray> tmp162;
+    TNode<IntPtrT> tmp163;
+    TNode<Smi> tmp164;
+    TNode<Int32T> tmp165;
+    TNode<UintPtrT> tmp166;
+    TNode<Int32T> tmp167;
+    TNode<UintPtrT> tmp168;
+    TNode<UintPtrT> tmp169;
+    ca_.Bind(&block14, &tmp161, &tmp162, &tmp163, &tmp164, &tmp165, &tmp166, &tmp167, &tmp168, &tmp169);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 32);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 35);
+    TNode<RawPtrT> tmp170;
+    USE(tmp170);
+    tmp170 = CodeStubAssembler(state_).LoadJSTypedArrayDataPtr(TNode<JSTypedArray>{tmp161});
+    TNode<IntPtrT> tmp171;
+    USE(tmp171);
+    tmp171 = Convert8ATintptr9ATuintptr_191(state_, TNode<UintPtrT>{tmp169});
+    TNode<RawPtrT> tmp172;
+    USE(tmp172);
+    tmp172 = CodeStubAssembler(state_).RawPtrAdd(TNode<RawPtrT>{tmp170}, TNode<IntPtrT>{tmp171});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 37);
+    ca_.Goto(&block20, tmp161, tmp162, tmp163, tmp164, tmp165, tmp166, tmp167, tmp168, tmp169, tmp172);
+  }
+
+  if (block19.is_used()) {
+    TNode<JSTypedArray> tmp173;
+    TNode<JSTypedArray> tmp174;
+    TNode<IntPtrT> tmp175;
+    TNode<Smi> tmp176;
+    TNode<Int32T> tmp177;
+    TNode<UintPtrT> tmp178;
+    TNode<Int32T> tmp179;
+    TNode<UintPtrT> tmp180;
+    TNode<UintPtrT> tmp181;
+    TNode<RawPtrT> tmp182;
+    ca_.Bind(&block19, &tmp173, &tmp174, &tmp175, &tmp176, &tmp177, &tmp178, &tmp179, &tmp180, &tmp181, &tmp182);
+    TNode<IntPtrT> tmp183 = ca_.IntPtrConstant(JSArrayBufferView::kByteLengthOffset);
+    USE(tmp183);
+    TNode<UintPtrT>tmp184 = CodeStubAssembler(state_).LoadReference<UintPtrT>(CodeStubAssembler::Reference{tmp174, tmp183});
+    TNode<BoolT> tmp185;
+    USE(tmp185);
+    tmp185 = CodeStubAssembler(state_).UintPtrLessThanOrEqual(TNode<UintPtrT>{tmp180}, TNode<UintPtrT>{tmp184});
+    ca_.Branch(tmp185, &block21, &block22, tmp173, tmp174, tmp175, tmp176, tmp177, tmp178, tmp179, tmp180, tmp181, tmp182);
+  }
+
+  if (block22.is_used()) {
+    TNode<JSTypedArray> tmp186;
+    TNode<JSTypedArray> tmp187;
+    TNode<IntPtrT> tmp188;
+    TNode<Smi> tmp189;
+    TNode<Int32T> tmp190;
+    TNode<UintPtrT> tmp191;
+    TNode<Int32T> tmp192;
+    TNode<UintPtrT> tmp193;
+    TNode<UintPtrT> tmp194;
+    TNode<RawPtrT> tmp195;
+    ca_.Bind(&block22, &tmp186, &tmp187, &tmp188, &tmp189, &tmp190, &tmp191, &tmp192, &tmp193, &tmp194, &tmp195);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'countBytes <= dest.byte_length' failed", "../../deps/v8/src/builtins/typed-array-slice.tq", 37);
+  }
+
+  if (block21.is_used()) {
+    TNode<JSTypedArray> tmp196;
+    TNode<JSTypedArray> tmp197;
+    TNode<IntPtrT> tmp198;
+    TNode<Smi> tmp199;
+    TNode<Int32T> tmp200;
+    TNode<UintPtrT> tmp201;
+    TNode<Int32T> tmp202;
+    TNode<UintPtrT> tmp203;
+    TNode<UintPtrT> tmp204;
+    TNode<RawPtrT> tmp205;
+    ca_.Bind(&block21, &tmp196, &tmp197, &tmp198, &tmp199, &tmp200, &tmp201, &tmp202, &tmp203, &tmp204, &tmp205);
+  }
+
+  if (block20.is_used()) {
+    TNode<JSTypedArray> tmp206;
+    TNode<JSTypedArray> tmp207;
+    TNode<IntPtrT> tmp208;
+    TNode<Smi> tmp209;
+    TNode<Int32T> tmp210;
+    TNode<UintPtrT> tmp211;
+    TNode<Int32T> tmp212;
+    TNode<UintPtrT> tmp213;
+    TNode<UintPtrT> tmp214;
+    TNode<RawPtrT> tmp215;
+    ca_.Bind(&block20, &tmp206, &tmp207, &tmp208, &tmp209, &tmp210, &tmp211, &tmp212, &tmp213, &tmp214, &tmp215);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 38);
+    ca_.Goto(&block24, tmp206, tmp207, tmp208, tmp209, tmp210, tmp211, tmp212, tmp213, tmp214, tmp215);
+  }
+
+  if (block23.is_used()) {
+    TNode<JSTypedArray> tmp216;
+    TNode<JSTypedArray> tmp217;
+    TNode<IntPtrT> tmp218;
+    TNode<Smi> tmp219;
+    TNode<Int32T> tmp220;
+    TNode<UintPtrT> tmp221;
+    TNode<Int32T> tmp222;
+    TNode<UintPtrT> tmp223;
+    TNode<UintPtrT> tmp224;
+    TNode<RawPtrT> tmp225;
+    ca_.Bind(&block23, &tmp216, &tmp217, &tmp218, &tmp219, &tmp220, &tmp221, &tmp222, &tmp223, &tmp224, &tmp225);
+    TNode<IntPtrT> tmp226 = ca_.IntPtrConstant(JSArrayBufferView::kByteLengthOffset);
+    USE(tmp226);
+    TNode<UintPtrT>tmp227 = CodeStubAssembler(state_).LoadReference<UintPtrT>(CodeStubAssembler::Reference{tmp216, tmp226});
+    TNode<UintPtrT> tmp228;
+    USE(tmp228);
+    tmp228 = CodeStubAssembler(state_).UintPtrSub(TNode<UintPtrT>{tmp227}, TNode<UintPtrT>{tmp224});
+    TNode<BoolT> tmp229;
+    USE(tmp229);
+    tmp229 = CodeStubAssembler(state_).UintPtrLessThanOrEqual(TNode<UintPtrT>{tmp223}, TNode<UintPtrT>{tmp228});
+    ca_.Branch(tmp229, &block25, &block26, tmp216, tmp217, tmp218, tmp219, tmp220, tmp221, tmp222, tmp223, tmp224, tmp225);
+  }
+
+  if (block26.is_used()) {
+    TNode<JSTypedArray> tmp230;
+    TNode<JSTypedArray> tmp231;
+    TNode<IntPtrT> tmp232;
+    TNode<Smi> tmp233;
+    TNode<Int32T> tmp234;
+    TNode<UintPtrT> tmp235;
+    TNode<Int32T> tmp236;
+    TNode<UintPtrT> tmp237;
+    TNode<UintPtrT> tmp238;
+    TNode<RawPtrT> tmp239;
+    ca_.Bind(&block26, &tmp230, &tmp231, &tmp232, &tmp233, &tmp234, &tmp235, &tmp236, &tmp237, &tmp238, &tmp239);
+    CodeStubAssembler(state_).FailAssert("Torque assert 'countBytes <= src.byte_length - startOffset' failed", "../../deps/v8/src/builtins/typed-array-slice.tq", 38);
+  }
+
+  if (block25.is_used()) {
+    TNode<JSTypedArray> tmp240;
+    TNode<JSTypedArray> tmp241;
+    TNode<IntPtrT> tmp242;
+    TNode<Smi> tmp243;
+    TNode<Int32T> tmp244;
+    TNode<UintPtrT> tmp245;
+    TNode<Int32T> tmp246;
+    TNode<UintPtrT> tmp247;
+    TNode<UintPtrT> tmp248;
+    TNode<RawPtrT> tmp249;
+    ca_.Bind(&block25, &tmp240, &tmp241, &tmp242, &tmp243, &tmp244, &tmp245, &tmp246, &tmp247, &tmp248, &tmp249);
+  }
+
+  if (block24.is_used()) {
+    TNode<JSTypedArray> tmp250;
+    TNode<JSTypedArray> tmp251;
+    TNode<IntPtrT> tmp252;
+    TNode<Smi> tmp253;
+    TNode<Int32T> tmp254;
+    TNode<UintPtrT> tmp255;
+    TNode<Int32T> tmp256;
+    TNode<UintPtrT> tmp257;
+    TNode<UintPtrT> tmp258;
+    TNode<RawPtrT> tmp259;
+    ca_.Bind(&block24, &tmp250, &tmp251, &tmp252, &tmp253, &tmp254, &tmp255, &tmp256, &tmp257, &tmp258, &tmp259);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 40);
+    TNode<RawPtrT> tmp260;
+    USE(tmp260);
+    tmp260 = CodeStubAssembler(state_).LoadJSTypedArrayDataPtr(TNode<JSTypedArray>{tmp251});
+    TypedArrayBuiltinsAssembler(state_).CallCMemmove(TNode<RawPtrT>{tmp260}, TNode<RawPtrT>{tmp259}, TNode<UintPtrT>{tmp257});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 15);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 13);
+    ca_.Goto(&block2, tmp250, tmp251, tmp252, tmp253);
+  }
+
+  if (block2.is_used()) {
+    TNode<JSTypedArray> tmp261;
+    TNode<JSTypedArray> tmp262;
+    TNode<IntPtrT> tmp263;
+    TNode<Smi> tmp264;
+    ca_.Bind(&block2, &tmp261, &tmp262, &tmp263, &tmp264);
+    ca_.Goto(&block27, tmp261, tmp262, tmp263, tmp264);
+  }
+
+  if (block1.is_used()) {
+    ca_.Bind(&block1);
+    ca_.Goto(label_IfSlow);
+  }
+
+    TNode<JSTypedArray> tmp265;
+    TNode<JSTypedArray> tmp266;
+    TNode<IntPtrT> tmp267;
+    TNode<Smi> tmp268;
+    ca_.Bind(&block27, &tmp265, &tmp266, &tmp267, &tmp268);
+}
+
+void SlowCopy_381(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<JSTypedArray> p_src, TNode<JSTypedArray> p_dest, TNode<IntPtrT> p_k, TNode<IntPtrT> p_final) {
+  compiler::CodeAssembler ca_(state_);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSTypedArray, IntPtrT, IntPtrT> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSTypedArray, IntPtrT, IntPtrT> block2(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSTypedArray, IntPtrT, IntPtrT> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSTypedArray, IntPtrT, IntPtrT> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<Context, JSTypedArray, JSTypedArray, IntPtrT, IntPtrT> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, p_context, p_src, p_dest, p_k, p_final);
+
+  if (block0.is_used()) {
+    TNode<Context> tmp0;
+    TNode<JSTypedArray> tmp1;
+    TNode<JSTypedArray> tmp2;
+    TNode<IntPtrT> tmp3;
+    TNode<IntPtrT> tmp4;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 45);
+    TNode<Int32T> tmp5;
+    USE(tmp5);
+    tmp5 = CodeStubAssembler(state_).LoadElementsKind(TNode<JSTypedArray>{tmp1});
+    TNode<BoolT> tmp6;
+    USE(tmp6);
+    tmp6 = TypedArrayBuiltinsAssembler(state_).IsBigInt64ElementsKind(TNode<Int32T>{tmp5});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 46);
+    TNode<Int32T> tmp7;
+    USE(tmp7);
+    tmp7 = CodeStubAssembler(state_).LoadElementsKind(TNode<JSTypedArray>{tmp2});
+    TNode<BoolT> tmp8;
+    USE(tmp8);
+    tmp8 = TypedArrayBuiltinsAssembler(state_).IsBigInt64ElementsKind(TNode<Int32T>{tmp7});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 45);
+    TNode<BoolT> tmp9;
+    USE(tmp9);
+    tmp9 = CodeStubAssembler(state_).Word32NotEqual(TNode<BoolT>{tmp6}, TNode<BoolT>{tmp8});
+    ca_.Branch(tmp9, &block2, &block3, tmp0, tmp1, tmp2, tmp3, tmp4);
+  }
+
+  if (block2.is_used()) {
+    TNode<Context> tmp10;
+    TNode<JSTypedArray> tmp11;
+    TNode<JSTypedArray> tmp12;
+    TNode<IntPtrT> tmp13;
+    TNode<IntPtrT> tmp14;
+    ca_.Bind(&block2, &tmp10, &tmp11, &tmp12, &tmp13, &tmp14);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 48);
+    CodeStubAssembler(state_).ThrowTypeError(TNode<Context>{tmp10}, MessageTemplate::kBigIntMixedTypes);
+  }
+
+  if (block3.is_used()) {
+    TNode<Context> tmp15;
+    TNode<JSTypedArray> tmp16;
+    TNode<JSTypedArray> tmp17;
+    TNode<IntPtrT> tmp18;
+    TNode<IntPtrT> tmp19;
+    ca_.Bind(&block3, &tmp15, &tmp16, &tmp17, &tmp18, &tmp19);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 51);
+    TypedArrayBuiltinsAssembler(state_).CallCCopyTypedArrayElementsSlice(TNode<JSTypedArray>{tmp16}, TNode<JSTypedArray>{tmp17}, TNode<IntPtrT>{tmp18}, TNode<IntPtrT>{tmp19});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 43);
+    ca_.Goto(&block1, tmp15, tmp16, tmp17, tmp18, tmp19);
+  }
+
+  if (block1.is_used()) {
+    TNode<Context> tmp20;
+    TNode<JSTypedArray> tmp21;
+    TNode<JSTypedArray> tmp22;
+    TNode<IntPtrT> tmp23;
+    TNode<IntPtrT> tmp24;
+    ca_.Bind(&block1, &tmp20, &tmp21, &tmp22, &tmp23, &tmp24);
+    ca_.Goto(&block4, tmp20, tmp21, tmp22, tmp23, tmp24);
+  }
+
+    TNode<Context> tmp25;
+    TNode<JSTypedArray> tmp26;
+    TNode<JSTypedArray> tmp27;
+    TNode<IntPtrT> tmp28;
+    TNode<IntPtrT> tmp29;
+    ca_.Bind(&block4, &tmp25, &tmp26, &tmp27, &tmp28, &tmp29);
+}
+
+TF_BUILTIN(TypedArrayPrototypeSlice, CodeStubAssembler) {
+  compiler::CodeAssemblerState* state_ = state();  compiler::CodeAssembler ca_(state());
+  Node* argc = Parameter(Descriptor::kJSActualArgumentsCount);
+  TNode<IntPtrT> arguments_length(ChangeInt32ToIntPtr(argc));
+  TNode<RawPtrT> arguments_frame = UncheckedCast<RawPtrT>(LoadFramePointer());
+  TorqueStructArguments torque_arguments(GetFrameArguments(arguments_frame, arguments_length));
+  CodeStubArguments arguments(this, torque_arguments);
+  TNode<Context> parameter0 = UncheckedCast<Context>(Parameter(Descriptor::kContext));
+  USE(parameter0);
+  TNode<Object> parameter1 = arguments.GetReceiver();
+USE(parameter1);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object> block0(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, IntPtrT, Object> block1(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, IntPtrT, Object> block2(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, IntPtrT, Object, IntPtrT> block4(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, IntPtrT, Object, IntPtrT> block3(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, IntPtrT, Object, IntPtrT, Object> block5(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, IntPtrT, Object, IntPtrT, Object> block6(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, IntPtrT, Object, IntPtrT, Object, IntPtrT> block8(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, IntPtrT, Object, IntPtrT, Object, IntPtrT> block7(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, IntPtrT, Object, IntPtrT, Object, IntPtrT, Smi, JSTypedArray> block9(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, IntPtrT, Object, IntPtrT, Object, IntPtrT, Smi, JSTypedArray, JSTypedArray> block16(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, IntPtrT, Object, IntPtrT, Object, IntPtrT, Smi, JSTypedArray, JSTypedArray, JSTypedArray> block15(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, IntPtrT, Object, IntPtrT, Object, IntPtrT, Smi, JSTypedArray, JSTypedArray, JSTypedArray, JSTypedArray, IntPtrT, Smi> block18(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, IntPtrT, Object, IntPtrT, Object, IntPtrT, Smi, JSTypedArray, JSTypedArray, JSTypedArray, JSTypedArray, IntPtrT, Smi> block17(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, IntPtrT, Object, IntPtrT, Object, IntPtrT, Smi, JSTypedArray> block14(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, IntPtrT, Object, IntPtrT, Object, IntPtrT, Smi, JSTypedArray> block13(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, IntPtrT, Object, IntPtrT, Object, IntPtrT, Smi, JSTypedArray> block12(&ca_, compiler::CodeAssemblerLabel::kDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, IntPtrT, Object, IntPtrT, Object, IntPtrT, Smi, JSTypedArray> block11(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+  compiler::CodeAssemblerParameterizedLabel<RawPtrT, RawPtrT, IntPtrT, Context, Object, JSTypedArray, IntPtrT, Object, IntPtrT, Object, IntPtrT, Smi, JSTypedArray> block10(&ca_, compiler::CodeAssemblerLabel::kNonDeferred);
+    ca_.Goto(&block0, torque_arguments.frame, torque_arguments.base, torque_arguments.length, parameter0, parameter1);
+
+  if (block0.is_used()) {
+    TNode<RawPtrT> tmp0;
+    TNode<RawPtrT> tmp1;
+    TNode<IntPtrT> tmp2;
+    TNode<Context> tmp3;
+    TNode<Object> tmp4;
+    ca_.Bind(&block0, &tmp0, &tmp1, &tmp2, &tmp3, &tmp4);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 63);
+    TNode<JSTypedArray> tmp5;
+    USE(tmp5);
+    tmp5 = TypedArrayBuiltinsAssembler(state_).ValidateTypedArray(TNode<Context>{tmp3}, TNode<Object>{tmp4}, kBuiltinName_379(state_));
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 62);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 66);
+    TNode<IntPtrT> tmp6 = ca_.IntPtrConstant(JSTypedArray::kLengthOffset);
+    USE(tmp6);
+    TNode<UintPtrT>tmp7 = CodeStubAssembler(state_).LoadReference<UintPtrT>(CodeStubAssembler::Reference{tmp5, tmp6});
+    TNode<IntPtrT> tmp8;
+    USE(tmp8);
+    tmp8 = Convert8ATintptr9ATuintptr_191(state_, TNode<UintPtrT>{tmp7});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 71);
+    TNode<IntPtrT> tmp9;
+    USE(tmp9);
+    tmp9 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<Object> tmp10;
+    USE(tmp10);
+    tmp10 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp0}, TNode<RawPtrT>{tmp1}, TNode<IntPtrT>{tmp2}}, TNode<IntPtrT>{tmp9});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 73);
+    TNode<Oddball> tmp11;
+    USE(tmp11);
+    tmp11 = Undefined_64(state_);
+    TNode<BoolT> tmp12;
+    USE(tmp12);
+    tmp12 = CodeStubAssembler(state_).TaggedNotEqual(TNode<Object>{tmp10}, TNode<HeapObject>{tmp11});
+    ca_.Branch(tmp12, &block1, &block2, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp8, tmp10);
+  }
+
+  if (block1.is_used()) {
+    TNode<RawPtrT> tmp13;
+    TNode<RawPtrT> tmp14;
+    TNode<IntPtrT> tmp15;
+    TNode<Context> tmp16;
+    TNode<Object> tmp17;
+    TNode<JSTypedArray> tmp18;
+    TNode<IntPtrT> tmp19;
+    TNode<Object> tmp20;
+    ca_.Bind(&block1, &tmp13, &tmp14, &tmp15, &tmp16, &tmp17, &tmp18, &tmp19, &tmp20);
+    TNode<IntPtrT> tmp21;
+    USE(tmp21);
+    tmp21 = CodeStubAssembler(state_).ConvertToRelativeIndex(TNode<Context>{tmp16}, TNode<Object>{tmp20}, TNode<IntPtrT>{tmp19});
+    ca_.Goto(&block4, tmp13, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19, tmp20, tmp21);
+  }
+
+  if (block2.is_used()) {
+    TNode<RawPtrT> tmp22;
+    TNode<RawPtrT> tmp23;
+    TNode<IntPtrT> tmp24;
+    TNode<Context> tmp25;
+    TNode<Object> tmp26;
+    TNode<JSTypedArray> tmp27;
+    TNode<IntPtrT> tmp28;
+    TNode<Object> tmp29;
+    ca_.Bind(&block2, &tmp22, &tmp23, &tmp24, &tmp25, &tmp26, &tmp27, &tmp28, &tmp29);
+    TNode<IntPtrT> tmp30;
+    USE(tmp30);
+    tmp30 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    ca_.Goto(&block3, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27, tmp28, tmp29, tmp30);
+  }
+
+  if (block4.is_used()) {
+    TNode<RawPtrT> tmp31;
+    TNode<RawPtrT> tmp32;
+    TNode<IntPtrT> tmp33;
+    TNode<Context> tmp34;
+    TNode<Object> tmp35;
+    TNode<JSTypedArray> tmp36;
+    TNode<IntPtrT> tmp37;
+    TNode<Object> tmp38;
+    TNode<IntPtrT> tmp39;
+    ca_.Bind(&block4, &tmp31, &tmp32, &tmp33, &tmp34, &tmp35, &tmp36, &tmp37, &tmp38, &tmp39);
+    ca_.Goto(&block3, tmp31, tmp32, tmp33, tmp34, tmp35, tmp36, tmp37, tmp38, tmp39);
+  }
+
+  if (block3.is_used()) {
+    TNode<RawPtrT> tmp40;
+    TNode<RawPtrT> tmp41;
+    TNode<IntPtrT> tmp42;
+    TNode<Context> tmp43;
+    TNode<Object> tmp44;
+    TNode<JSTypedArray> tmp45;
+    TNode<IntPtrT> tmp46;
+    TNode<Object> tmp47;
+    TNode<IntPtrT> tmp48;
+    ca_.Bind(&block3, &tmp40, &tmp41, &tmp42, &tmp43, &tmp44, &tmp45, &tmp46, &tmp47, &tmp48);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 72);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 79);
+    TNode<IntPtrT> tmp49;
+    USE(tmp49);
+    tmp49 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 1);
+    TNode<Object> tmp50;
+    USE(tmp50);
+    tmp50 = CodeStubAssembler(state_).GetArgumentValue(TorqueStructArguments{TNode<RawPtrT>{tmp40}, TNode<RawPtrT>{tmp41}, TNode<IntPtrT>{tmp42}}, TNode<IntPtrT>{tmp49});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 81);
+    TNode<Oddball> tmp51;
+    USE(tmp51);
+    tmp51 = Undefined_64(state_);
+    TNode<BoolT> tmp52;
+    USE(tmp52);
+    tmp52 = CodeStubAssembler(state_).TaggedNotEqual(TNode<Object>{tmp50}, TNode<HeapObject>{tmp51});
+    ca_.Branch(tmp52, &block5, &block6, tmp40, tmp41, tmp42, tmp43, tmp44, tmp45, tmp46, tmp47, tmp48, tmp50);
+  }
+
+  if (block5.is_used()) {
+    TNode<RawPtrT> tmp53;
+    TNode<RawPtrT> tmp54;
+    TNode<IntPtrT> tmp55;
+    TNode<Context> tmp56;
+    TNode<Object> tmp57;
+    TNode<JSTypedArray> tmp58;
+    TNode<IntPtrT> tmp59;
+    TNode<Object> tmp60;
+    TNode<IntPtrT> tmp61;
+    TNode<Object> tmp62;
+    ca_.Bind(&block5, &tmp53, &tmp54, &tmp55, &tmp56, &tmp57, &tmp58, &tmp59, &tmp60, &tmp61, &tmp62);
+    TNode<IntPtrT> tmp63;
+    USE(tmp63);
+    tmp63 = CodeStubAssembler(state_).ConvertToRelativeIndex(TNode<Context>{tmp56}, TNode<Object>{tmp62}, TNode<IntPtrT>{tmp59});
+    ca_.Goto(&block8, tmp53, tmp54, tmp55, tmp56, tmp57, tmp58, tmp59, tmp60, tmp61, tmp62, tmp63);
+  }
+
+  if (block6.is_used()) {
+    TNode<RawPtrT> tmp64;
+    TNode<RawPtrT> tmp65;
+    TNode<IntPtrT> tmp66;
+    TNode<Context> tmp67;
+    TNode<Object> tmp68;
+    TNode<JSTypedArray> tmp69;
+    TNode<IntPtrT> tmp70;
+    TNode<Object> tmp71;
+    TNode<IntPtrT> tmp72;
+    TNode<Object> tmp73;
+    ca_.Bind(&block6, &tmp64, &tmp65, &tmp66, &tmp67, &tmp68, &tmp69, &tmp70, &tmp71, &tmp72, &tmp73);
+    ca_.Goto(&block7, tmp64, tmp65, tmp66, tmp67, tmp68, tmp69, tmp70, tmp71, tmp72, tmp73, tmp70);
+  }
+
+  if (block8.is_used()) {
+    TNode<RawPtrT> tmp74;
+    TNode<RawPtrT> tmp75;
+    TNode<IntPtrT> tmp76;
+    TNode<Context> tmp77;
+    TNode<Object> tmp78;
+    TNode<JSTypedArray> tmp79;
+    TNode<IntPtrT> tmp80;
+    TNode<Object> tmp81;
+    TNode<IntPtrT> tmp82;
+    TNode<Object> tmp83;
+    TNode<IntPtrT> tmp84;
+    ca_.Bind(&block8, &tmp74, &tmp75, &tmp76, &tmp77, &tmp78, &tmp79, &tmp80, &tmp81, &tmp82, &tmp83, &tmp84);
+    ca_.Goto(&block7, tmp74, tmp75, tmp76, tmp77, tmp78, tmp79, tmp80, tmp81, tmp82, tmp83, tmp84);
+  }
+
+  if (block7.is_used()) {
+    TNode<RawPtrT> tmp85;
+    TNode<RawPtrT> tmp86;
+    TNode<IntPtrT> tmp87;
+    TNode<Context> tmp88;
+    TNode<Object> tmp89;
+    TNode<JSTypedArray> tmp90;
+    TNode<IntPtrT> tmp91;
+    TNode<Object> tmp92;
+    TNode<IntPtrT> tmp93;
+    TNode<Object> tmp94;
+    TNode<IntPtrT> tmp95;
+    ca_.Bind(&block7, &tmp85, &tmp86, &tmp87, &tmp88, &tmp89, &tmp90, &tmp91, &tmp92, &tmp93, &tmp94, &tmp95);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 80);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 84);
+    TNode<IntPtrT> tmp96;
+    USE(tmp96);
+    tmp96 = CodeStubAssembler(state_).IntPtrSub(TNode<IntPtrT>{tmp95}, TNode<IntPtrT>{tmp93});
+    TNode<IntPtrT> tmp97;
+    USE(tmp97);
+    tmp97 = FromConstexpr8ATintptr17ATconstexpr_int31_151(state_, 0);
+    TNode<IntPtrT> tmp98;
+    USE(tmp98);
+    tmp98 = CodeStubAssembler(state_).IntPtrMax(TNode<IntPtrT>{tmp96}, TNode<IntPtrT>{tmp97});
+    TNode<Smi> tmp99;
+    USE(tmp99);
+    tmp99 = Convert13ATPositiveSmi8ATintptr_192(state_, TNode<IntPtrT>{tmp98});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 89);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 88);
+    TNode<JSTypedArray> tmp100;
+    USE(tmp100);
+    tmp100 = TypedArraySpeciesCreateByLength_365(state_, TNode<Context>{tmp88}, kBuiltinName_379(state_), TNode<JSTypedArray>{tmp90}, TNode<Smi>{tmp99});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 87);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 91);
+    TNode<Smi> tmp101;
+    USE(tmp101);
+    tmp101 = FromConstexpr5ATSmi17ATconstexpr_int31_155(state_, 0);
+    TNode<BoolT> tmp102;
+    USE(tmp102);
+    tmp102 = CodeStubAssembler(state_).SmiGreaterThan(TNode<Smi>{tmp99}, TNode<Smi>{tmp101});
+    ca_.Branch(tmp102, &block9, &block10, tmp85, tmp86, tmp87, tmp88, tmp89, tmp90, tmp91, tmp92, tmp93, tmp94, tmp95, tmp99, tmp100);
+  }
+
+  if (block9.is_used()) {
+    TNode<RawPtrT> tmp103;
+    TNode<RawPtrT> tmp104;
+    TNode<IntPtrT> tmp105;
+    TNode<Context> tmp106;
+    TNode<Object> tmp107;
+    TNode<JSTypedArray> tmp108;
+    TNode<IntPtrT> tmp109;
+    TNode<Object> tmp110;
+    TNode<IntPtrT> tmp111;
+    TNode<Object> tmp112;
+    TNode<IntPtrT> tmp113;
+    TNode<Smi> tmp114;
+    TNode<JSTypedArray> tmp115;
+    ca_.Bind(&block9, &tmp103, &tmp104, &tmp105, &tmp106, &tmp107, &tmp108, &tmp109, &tmp110, &tmp111, &tmp112, &tmp113, &tmp114, &tmp115);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 93);
+    TNode<JSTypedArray> tmp116;
+    USE(tmp116);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    tmp116 = EnsureAttached_384(state_, TNode<JSTypedArray>{tmp108}, &label0);
+    ca_.Goto(&block15, tmp103, tmp104, tmp105, tmp106, tmp107, tmp108, tmp109, tmp110, tmp111, tmp112, tmp113, tmp114, tmp115, tmp108, tmp116);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block16, tmp103, tmp104, tmp105, tmp106, tmp107, tmp108, tmp109, tmp110, tmp111, tmp112, tmp113, tmp114, tmp115, tmp108);
+    }
+  }
+
+  if (block16.is_used()) {
+    TNode<RawPtrT> tmp117;
+    TNode<RawPtrT> tmp118;
+    TNode<IntPtrT> tmp119;
+    TNode<Context> tmp120;
+    TNode<Object> tmp121;
+    TNode<JSTypedArray> tmp122;
+    TNode<IntPtrT> tmp123;
+    TNode<Object> tmp124;
+    TNode<IntPtrT> tmp125;
+    TNode<Object> tmp126;
+    TNode<IntPtrT> tmp127;
+    TNode<Smi> tmp128;
+    TNode<JSTypedArray> tmp129;
+    TNode<JSTypedArray> tmp130;
+    ca_.Bind(&block16, &tmp117, &tmp118, &tmp119, &tmp120, &tmp121, &tmp122, &tmp123, &tmp124, &tmp125, &tmp126, &tmp127, &tmp128, &tmp129, &tmp130);
+    ca_.Goto(&block14, tmp117, tmp118, tmp119, tmp120, tmp121, tmp122, tmp123, tmp124, tmp125, tmp126, tmp127, tmp128, tmp129);
+  }
+
+  if (block15.is_used()) {
+    TNode<RawPtrT> tmp131;
+    TNode<RawPtrT> tmp132;
+    TNode<IntPtrT> tmp133;
+    TNode<Context> tmp134;
+    TNode<Object> tmp135;
+    TNode<JSTypedArray> tmp136;
+    TNode<IntPtrT> tmp137;
+    TNode<Object> tmp138;
+    TNode<IntPtrT> tmp139;
+    TNode<Object> tmp140;
+    TNode<IntPtrT> tmp141;
+    TNode<Smi> tmp142;
+    TNode<JSTypedArray> tmp143;
+    TNode<JSTypedArray> tmp144;
+    TNode<JSTypedArray> tmp145;
+    ca_.Bind(&block15, &tmp131, &tmp132, &tmp133, &tmp134, &tmp135, &tmp136, &tmp137, &tmp138, &tmp139, &tmp140, &tmp141, &tmp142, &tmp143, &tmp144, &tmp145);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 95);
+    compiler::CodeAssemblerLabel label0(&ca_);
+    FastCopy_380(state_, TNode<JSTypedArray>{tmp145}, TNode<JSTypedArray>{tmp143}, TNode<IntPtrT>{tmp139}, TNode<Smi>{tmp142}, &label0);
+    ca_.Goto(&block17, tmp131, tmp132, tmp133, tmp134, tmp135, tmp136, tmp137, tmp138, tmp139, tmp140, tmp141, tmp142, tmp143, tmp145, tmp145, tmp143, tmp139, tmp142);
+    if (label0.is_used()) {
+      ca_.Bind(&label0);
+      ca_.Goto(&block18, tmp131, tmp132, tmp133, tmp134, tmp135, tmp136, tmp137, tmp138, tmp139, tmp140, tmp141, tmp142, tmp143, tmp145, tmp145, tmp143, tmp139, tmp142);
+    }
+  }
+
+  if (block18.is_used()) {
+    TNode<RawPtrT> tmp146;
+    TNode<RawPtrT> tmp147;
+    TNode<IntPtrT> tmp148;
+    TNode<Context> tmp149;
+    TNode<Object> tmp150;
+    TNode<JSTypedArray> tmp151;
+    TNode<IntPtrT> tmp152;
+    TNode<Object> tmp153;
+    TNode<IntPtrT> tmp154;
+    TNode<Object> tmp155;
+    TNode<IntPtrT> tmp156;
+    TNode<Smi> tmp157;
+    TNode<JSTypedArray> tmp158;
+    TNode<JSTypedArray> tmp159;
+    TNode<JSTypedArray> tmp160;
+    TNode<JSTypedArray> tmp161;
+    TNode<IntPtrT> tmp162;
+    TNode<Smi> tmp163;
+    ca_.Bind(&block18, &tmp146, &tmp147, &tmp148, &tmp149, &tmp150, &tmp151, &tmp152, &tmp153, &tmp154, &tmp155, &tmp156, &tmp157, &tmp158, &tmp159, &tmp160, &tmp161, &tmp162, &tmp163);
+    ca_.Goto(&block12, tmp146, tmp147, tmp148, tmp149, tmp150, tmp151, tmp152, tmp153, tmp154, tmp155, tmp156, tmp157, tmp158);
+  }
+
+  if (block17.is_used()) {
+    TNode<RawPtrT> tmp164;
+    TNode<RawPtrT> tmp165;
+    TNode<IntPtrT> tmp166;
+    TNode<Context> tmp167;
+    TNode<Object> tmp168;
+    TNode<JSTypedArray> tmp169;
+    TNode<IntPtrT> tmp170;
+    TNode<Object> tmp171;
+    TNode<IntPtrT> tmp172;
+    TNode<Object> tmp173;
+    TNode<IntPtrT> tmp174;
+    TNode<Smi> tmp175;
+    TNode<JSTypedArray> tmp176;
+    TNode<JSTypedArray> tmp177;
+    TNode<JSTypedArray> tmp178;
+    TNode<JSTypedArray> tmp179;
+    TNode<IntPtrT> tmp180;
+    TNode<Smi> tmp181;
+    ca_.Bind(&block17, &tmp164, &tmp165, &tmp166, &tmp167, &tmp168, &tmp169, &tmp170, &tmp171, &tmp172, &tmp173, &tmp174, &tmp175, &tmp176, &tmp177, &tmp178, &tmp179, &tmp180, &tmp181);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 92);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 97);
+    ca_.Goto(&block13, tmp164, tmp165, tmp166, tmp167, tmp168, tmp169, tmp170, tmp171, tmp172, tmp173, tmp174, tmp175, tmp176);
+  }
+
+  if (block14.is_used()) {
+    TNode<RawPtrT> tmp182;
+    TNode<RawPtrT> tmp183;
+    TNode<IntPtrT> tmp184;
+    TNode<Context> tmp185;
+    TNode<Object> tmp186;
+    TNode<JSTypedArray> tmp187;
+    TNode<IntPtrT> tmp188;
+    TNode<Object> tmp189;
+    TNode<IntPtrT> tmp190;
+    TNode<Object> tmp191;
+    TNode<IntPtrT> tmp192;
+    TNode<Smi> tmp193;
+    TNode<JSTypedArray> tmp194;
+    ca_.Bind(&block14, &tmp182, &tmp183, &tmp184, &tmp185, &tmp186, &tmp187, &tmp188, &tmp189, &tmp190, &tmp191, &tmp192, &tmp193, &tmp194);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 98);
+    CodeStubAssembler(state_).ThrowTypeError(TNode<Context>{tmp185}, MessageTemplate::kDetachedOperation, kBuiltinName_379(state_));
+  }
+
+  if (block13.is_used()) {
+    TNode<RawPtrT> tmp195;
+    TNode<RawPtrT> tmp196;
+    TNode<IntPtrT> tmp197;
+    TNode<Context> tmp198;
+    TNode<Object> tmp199;
+    TNode<JSTypedArray> tmp200;
+    TNode<IntPtrT> tmp201;
+    TNode<Object> tmp202;
+    TNode<IntPtrT> tmp203;
+    TNode<Object> tmp204;
+    TNode<IntPtrT> tmp205;
+    TNode<Smi> tmp206;
+    TNode<JSTypedArray> tmp207;
+    ca_.Bind(&block13, &tmp195, &tmp196, &tmp197, &tmp198, &tmp199, &tmp200, &tmp201, &tmp202, &tmp203, &tmp204, &tmp205, &tmp206, &tmp207);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 100);
+    ca_.Goto(&block11, tmp195, tmp196, tmp197, tmp198, tmp199, tmp200, tmp201, tmp202, tmp203, tmp204, tmp205, tmp206, tmp207);
+  }
+
+  if (block12.is_used()) {
+    TNode<RawPtrT> tmp208;
+    TNode<RawPtrT> tmp209;
+    TNode<IntPtrT> tmp210;
+    TNode<Context> tmp211;
+    TNode<Object> tmp212;
+    TNode<JSTypedArray> tmp213;
+    TNode<IntPtrT> tmp214;
+    TNode<Object> tmp215;
+    TNode<IntPtrT> tmp216;
+    TNode<Object> tmp217;
+    TNode<IntPtrT> tmp218;
+    TNode<Smi> tmp219;
+    TNode<JSTypedArray> tmp220;
+    ca_.Bind(&block12, &tmp208, &tmp209, &tmp210, &tmp211, &tmp212, &tmp213, &tmp214, &tmp215, &tmp216, &tmp217, &tmp218, &tmp219, &tmp220);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 101);
+    SlowCopy_381(state_, TNode<Context>{tmp211}, TNode<JSTypedArray>{tmp213}, TNode<JSTypedArray>{tmp220}, TNode<IntPtrT>{tmp216}, TNode<IntPtrT>{tmp218});
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 92);
+    ca_.Goto(&block11, tmp208, tmp209, tmp210, tmp211, tmp212, tmp213, tmp214, tmp215, tmp216, tmp217, tmp218, tmp219, tmp220);
+  }
+
+  if (block11.is_used()) {
+    TNode<RawPtrT> tmp221;
+    TNode<RawPtrT> tmp222;
+    TNode<IntPtrT> tmp223;
+    TNode<Context> tmp224;
+    TNode<Object> tmp225;
+    TNode<JSTypedArray> tmp226;
+    TNode<IntPtrT> tmp227;
+    TNode<Object> tmp228;
+    TNode<IntPtrT> tmp229;
+    TNode<Object> tmp230;
+    TNode<IntPtrT> tmp231;
+    TNode<Smi> tmp232;
+    TNode<JSTypedArray> tmp233;
+    ca_.Bind(&block11, &tmp221, &tmp222, &tmp223, &tmp224, &tmp225, &tmp226, &tmp227, &tmp228, &tmp229, &tmp230, &tmp231, &tmp232, &tmp233);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 91);
+    ca_.Goto(&block10, tmp221, tmp222, tmp223, tmp224, tmp225, tmp226, tmp227, tmp228, tmp229, tmp230, tmp231, tmp232, tmp233);
+  }
+
+  if (block10.is_used()) {
+    TNode<RawPtrT> tmp234;
+    TNode<RawPtrT> tmp235;
+    TNode<IntPtrT> tmp236;
+    TNode<Context> tmp237;
+    TNode<Object> tmp238;
+    TNode<JSTypedArray> tmp239;
+    TNode<IntPtrT> tmp240;
+    TNode<Object> tmp241;
+    TNode<IntPtrT> tmp242;
+    TNode<Object> tmp243;
+    TNode<IntPtrT> tmp244;
+    TNode<Smi> tmp245;
+    TNode<JSTypedArray> tmp246;
+    ca_.Bind(&block10, &tmp234, &tmp235, &tmp236, &tmp237, &tmp238, &tmp239, &tmp240, &tmp241, &tmp242, &tmp243, &tmp244, &tmp245, &tmp246);
+    ca_.SetSourcePosition("../../deps/v8/../../deps/v8/src/builtins/typed-array-slice.tq", 105);
+    arguments.PopAndReturn(tmp246);
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
+
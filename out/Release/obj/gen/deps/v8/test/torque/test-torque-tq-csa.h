@@ -0,0 +1,117 @@
+#ifndef V8_GEN_TORQUE_GENERATED_______DEPS_V8_TEST_TORQUE_TEST_TORQUE_TQ_H_
+#define V8_GEN_TORQUE_GENERATED_______DEPS_V8_TEST_TORQUE_TEST_TORQUE_TQ_H_
+
+#include "src/compiler/code-assembler.h"
+#include "src/codegen/code-stub-assembler.h"
+#include "src/utils/utils.h"
+#include "torque-generated/field-offsets-tq.h"
+#include "torque-generated/csa-types-tq.h"
+
+namespace v8 {
+namespace internal {
+
+TNode<BoolT> ElementsKindTestHelper1_425(compiler::CodeAssemblerState* state_, ElementsKind p_kind);
+bool ElementsKindTestHelper2_426(compiler::CodeAssemblerState* state_, ElementsKind p_kind);
+void LabelTestHelper1_427(compiler::CodeAssemblerState* state_, compiler::CodeAssemblerLabel* label_Label1);
+void LabelTestHelper2_428(compiler::CodeAssemblerState* state_, compiler::CodeAssemblerLabel* label_Label2, compiler::TypedCodeAssemblerVariable<Smi>* label_Label2_parameter_0);
+void LabelTestHelper3_429(compiler::CodeAssemblerState* state_, compiler::CodeAssemblerLabel* label_Label3, compiler::TypedCodeAssemblerVariable<Oddball>* label_Label3_parameter_0, compiler::TypedCodeAssemblerVariable<Smi>* label_Label3_parameter_1);
+void TestConstexpr1_430(compiler::CodeAssemblerState* state_);
+void TestConstexprIf_431(compiler::CodeAssemblerState* state_);
+void TestConstexprReturn_432(compiler::CodeAssemblerState* state_);
+TNode<Oddball> TestGotoLabel_433(compiler::CodeAssemblerState* state_);
+TNode<Oddball> TestGotoLabelWithOneParameter_434(compiler::CodeAssemblerState* state_);
+TNode<Oddball> TestGotoLabelWithTwoParameters_435(compiler::CodeAssemblerState* state_);
+void TestBuiltinSpecialization_436(compiler::CodeAssemblerState* state_, TNode<Context> p_c);
+void LabelTestHelper4_437(compiler::CodeAssemblerState* state_, bool p_flag, compiler::CodeAssemblerLabel* label_Label4, compiler::CodeAssemblerLabel* label_Label5);
+TNode<BoolT> CallLabelTestHelper4_438(compiler::CodeAssemblerState* state_, bool p_flag);
+TNode<Oddball> TestPartiallyUnusedLabel_439(compiler::CodeAssemblerState* state_);
+TNode<Object> GenericMacroTest20UT5ATSmi10HeapObject_440(compiler::CodeAssemblerState* state_, TNode<Object> p_param2);
+TNode<Object> GenericMacroTestWithLabels20UT5ATSmi10HeapObject_441(compiler::CodeAssemblerState* state_, TNode<Object> p_param2, compiler::CodeAssemblerLabel* label_Y);
+void TestMacroSpecialization_442(compiler::CodeAssemblerState* state_);
+TNode<Oddball> TestFunctionPointers_443(compiler::CodeAssemblerState* state_, TNode<Context> p_context);
+TNode<Oddball> TestVariableRedeclaration_444(compiler::CodeAssemblerState* state_, TNode<Context> p_context);
+TNode<Smi> TestTernaryOperator_445(compiler::CodeAssemblerState* state_, TNode<Smi> p_x);
+void TestFunctionPointerToGeneric_446(compiler::CodeAssemblerState* state_, TNode<Context> p_c);
+TNode<BuiltinPtr> TestTypeAlias_447(compiler::CodeAssemblerState* state_, TNode<BuiltinPtr> p_x);
+TNode<Oddball> TestUnsafeCast_448(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Number> p_n);
+void TestHexLiteral_449(compiler::CodeAssemblerState* state_);
+void TestLargeIntegerLiterals_450(compiler::CodeAssemblerState* state_, TNode<Context> p_c);
+void TestMultilineAssert_451(compiler::CodeAssemblerState* state_);
+void TestNewlineInString_452(compiler::CodeAssemblerState* state_);
+  int31_t kConstexprConst_453(compiler::CodeAssemblerState* state_);
+  TNode<IntPtrT> kIntptrConst_454(compiler::CodeAssemblerState* state_);
+  TNode<Smi> kSmiConst_455(compiler::CodeAssemblerState* state_);
+void TestModuleConstBindings_456(compiler::CodeAssemblerState* state_);
+void TestLocalConstBindings_457(compiler::CodeAssemblerState* state_);
+TNode<Smi> TestStruct1_458(compiler::CodeAssemblerState* state_, TorqueStructTestStructA p_i);
+TorqueStructTestStructA TestStruct2_459(compiler::CodeAssemblerState* state_, TNode<Context> p_context);
+TorqueStructTestStructA TestStruct3_460(compiler::CodeAssemblerState* state_, TNode<Context> p_context);
+TorqueStructTestStructC TestStruct4_461(compiler::CodeAssemblerState* state_, TNode<Context> p_context);
+void CallTestStructInLabel_463(compiler::CodeAssemblerState* state_, TNode<Context> p_context);
+void TestForLoop_464(compiler::CodeAssemblerState* state_);
+void TestSubtyping_465(compiler::CodeAssemblerState* state_, TNode<Smi> p_x);
+TNode<Int32T> TypeswitchExample_466(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_x);
+void TestTypeswitch_467(compiler::CodeAssemblerState* state_, TNode<Context> p_context);
+void TestTypeswitchAsanLsanFailure_468(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_obj);
+void TestGenericOverload_469(compiler::CodeAssemblerState* state_, TNode<Context> p_context);
+void TestEquality_470(compiler::CodeAssemblerState* state_, TNode<Context> p_context);
+TNode<BoolT> TestOrAnd_471(compiler::CodeAssemblerState* state_, TNode<BoolT> p_x, TNode<BoolT> p_y, TNode<BoolT> p_z);
+TNode<BoolT> TestAndOr_472(compiler::CodeAssemblerState* state_, TNode<BoolT> p_x, TNode<BoolT> p_y, TNode<BoolT> p_z);
+void TestLogicalOperators_473(compiler::CodeAssemblerState* state_);
+TNode<Smi> TestCall_474(compiler::CodeAssemblerState* state_, TNode<Smi> p_i, compiler::CodeAssemblerLabel* label_A);
+void TestOtherwiseWithCode1_475(compiler::CodeAssemblerState* state_);
+void TestOtherwiseWithCode2_476(compiler::CodeAssemblerState* state_);
+void TestOtherwiseWithCode3_477(compiler::CodeAssemblerState* state_);
+void TestForwardLabel_478(compiler::CodeAssemblerState* state_);
+void TestQualifiedAccess_479(compiler::CodeAssemblerState* state_, TNode<Context> p_context);
+TNode<Smi> TestCatch1_480(compiler::CodeAssemblerState* state_, TNode<Context> p_context);
+void TestCatch2Wrapper_481(compiler::CodeAssemblerState* state_, TNode<Context> p_context);
+TNode<Smi> TestCatch2_482(compiler::CodeAssemblerState* state_, TNode<Context> p_context);
+void TestCatch3WrapperWithLabel_483(compiler::CodeAssemblerState* state_, TNode<Context> p_context, compiler::CodeAssemblerLabel* label__Abort);
+TNode<Smi> TestCatch3_484(compiler::CodeAssemblerState* state_, TNode<Context> p_context);
+void TestIterator_485(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<JSReceiver> p_o, TNode<Map> p_map);
+void TestFrame1_486(compiler::CodeAssemblerState* state_, TNode<Context> p_context);
+void TestNew_487(compiler::CodeAssemblerState* state_, TNode<Context> p_context);
+void TestStructConstructor_488(compiler::CodeAssemblerState* state_, TNode<Context> p_context);
+TNode<InternalClass> NewInternalClass_489(compiler::CodeAssemblerState* state_, TNode<Smi> p_x);
+void TestInternalClass_490(compiler::CodeAssemblerState* state_, TNode<Context> p_context);
+void TestConstInStructs_491(compiler::CodeAssemblerState* state_);
+TNode<Object> TestNewFixedArrayFromSpread_492(compiler::CodeAssemblerState* state_, TNode<Context> p_context);
+void TestReferences_493(compiler::CodeAssemblerState* state_);
+void TestSlices_494(compiler::CodeAssemblerState* state_);
+TNode<Oddball> TestSliceEnumeration_495(compiler::CodeAssemblerState* state_, TNode<Context> p_context);
+void TestStaticAssert_496(compiler::CodeAssemblerState* state_);
+void TestLoadEliminationFixed_497(compiler::CodeAssemblerState* state_, TNode<Context> p_context);
+void TestLoadEliminationVariable_498(compiler::CodeAssemblerState* state_, TNode<Context> p_context);
+TNode<Smi> TestRedundantArrayElementCheck_499(compiler::CodeAssemblerState* state_, TNode<Context> p_context);
+TNode<Smi> TestRedundantSmiCheck_500(compiler::CodeAssemblerState* state_, TNode<Context> p_context);
+TNode<IntPtrT> TestGenericStruct1_501(compiler::CodeAssemblerState* state_);
+TorqueStructTestTuple24TestTuple8ATintptr5ATSmi24TestTuple5ATSmi8ATintptr TestGenericStruct2_502(compiler::CodeAssemblerState* state_);
+TNode<BoolT> BranchAndWriteResult_503(compiler::CodeAssemblerState* state_, TNode<Smi> p_x, TNode<SmiBox> p_box);
+void TestBranchOnBoolOptimization_504(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Smi> p_input);
+TNode<Smi> LoadInternalClassA_1353(compiler::CodeAssemblerState* state_, TNode<InternalClass> p_o);
+void StoreInternalClassA_1354(compiler::CodeAssemblerState* state_, TNode<InternalClass> p_o, TNode<Smi> p_v);
+TNode<Number> LoadInternalClassB_1355(compiler::CodeAssemblerState* state_, TNode<InternalClass> p_o);
+void StoreInternalClassB_1356(compiler::CodeAssemblerState* state_, TNode<InternalClass> p_o, TNode<Number> p_v);
+void _method_InternalClass_Flip(compiler::CodeAssemblerState* state_, TNode<InternalClass> p_this, compiler::CodeAssemblerLabel* label_NotASmi);
+TNode<Smi> LoadSmiPairA_1357(compiler::CodeAssemblerState* state_, TNode<SmiPair> p_o);
+void StoreSmiPairA_1358(compiler::CodeAssemblerState* state_, TNode<SmiPair> p_o, TNode<Smi> p_v);
+TNode<Smi> LoadSmiPairB_1359(compiler::CodeAssemblerState* state_, TNode<SmiPair> p_o);
+void StoreSmiPairB_1360(compiler::CodeAssemblerState* state_, TNode<SmiPair> p_o, TNode<Smi> p_v);
+TorqueStructReference5ATSmi _method_SmiPair_GetA(compiler::CodeAssemblerState* state_, TNode<SmiPair> p_this);
+TNode<Smi> LoadSmiBoxValue_1361(compiler::CodeAssemblerState* state_, TNode<SmiBox> p_o);
+void StoreSmiBoxValue_1362(compiler::CodeAssemblerState* state_, TNode<SmiBox> p_o, TNode<Smi> p_v);
+TNode<Smi> LoadSmiBoxUnrelated_1363(compiler::CodeAssemblerState* state_, TNode<SmiBox> p_o);
+void StoreSmiBoxUnrelated_1364(compiler::CodeAssemblerState* state_, TNode<SmiBox> p_o, TNode<Smi> p_v);
+TNode<Object> GenericMacroTest5ATSmi_1446(compiler::CodeAssemblerState* state_, TNode<Smi> p__param);
+TNode<Object> GenericMacroTestWithLabels5ATSmi_1447(compiler::CodeAssemblerState* state_, TNode<Smi> p__param, compiler::CodeAssemblerLabel* label__X);
+TNode<Object> IncrementIfSmi32UT5ATSmi10FixedArray10HeapNumber_1448(compiler::CodeAssemblerState* state_, TNode<Object> p_x);
+TNode<Smi> ExampleGenericOverload5ATSmi_1449(compiler::CodeAssemblerState* state_, TNode<Smi> p_o);
+TNode<Object> ExampleGenericOverload20UT5ATSmi10HeapObject_1450(compiler::CodeAssemblerState* state_, TNode<Object> p_o);
+TNode<BoolT> Is7JSArray5ATSmi_1451(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Smi> p_o);
+void Swap5ATSmi_1454(compiler::CodeAssemblerState* state_, TorqueStructReference5ATSmi p_a, TorqueStructReference5ATSmi p_b);
+TorqueStructTestTuple5ATSmi8ATintptr TupleSwap8ATintptr5ATSmi_1455(compiler::CodeAssemblerState* state_, TorqueStructTestTuple8ATintptr5ATSmi p_tuple);
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_GEN_TORQUE_GENERATED_______DEPS_V8_TEST_TORQUE_TEST_TORQUE_TQ_H_
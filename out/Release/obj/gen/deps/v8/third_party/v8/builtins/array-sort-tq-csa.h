@@ -0,0 +1,79 @@
+#ifndef V8_GEN_TORQUE_GENERATED_______DEPS_V8_THIRD_PARTY_V8_BUILTINS_ARRAY_SORT_TQ_H_
+#define V8_GEN_TORQUE_GENERATED_______DEPS_V8_THIRD_PARTY_V8_BUILTINS_ARRAY_SORT_TQ_H_
+
+#include "src/compiler/code-assembler.h"
+#include "src/codegen/code-stub-assembler.h"
+#include "src/utils/utils.h"
+#include "torque-generated/field-offsets-tq.h"
+#include "torque-generated/csa-types-tq.h"
+
+namespace v8 {
+namespace internal {
+
+TNode<IntPtrT> CalculateWorkArrayLength_400(compiler::CodeAssemblerState* state_, TNode<JSReceiver> p_receiver, TNode<Number> p_initialReceiverLength);
+TNode<SortState> NewSortState_401(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<JSReceiver> p_receiver, TNode<HeapObject> p_comparefn, TNode<Number> p_initialReceiverLength);
+  TNode<Smi> kSuccess_402(compiler::CodeAssemblerState* state_);
+  int31_t kMaxMergePending_403(compiler::CodeAssemblerState* state_);
+  int31_t kMinGallopWins_404(compiler::CodeAssemblerState* state_);
+  TNode<Smi> kSortStateTempSize_405(compiler::CodeAssemblerState* state_);
+TNode<Smi> GetPendingRunsSize_406(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<SortState> p_sortState);
+TNode<Smi> GetPendingRunBase_407(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<FixedArray> p_pendingRuns, TNode<Smi> p_run);
+void SetPendingRunBase_408(compiler::CodeAssemblerState* state_, TNode<FixedArray> p_pendingRuns, TNode<Smi> p_run, TNode<Smi> p_value);
+TNode<Smi> GetPendingRunLength_409(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<FixedArray> p_pendingRuns, TNode<Smi> p_run);
+void SetPendingRunLength_410(compiler::CodeAssemblerState* state_, TNode<FixedArray> p_pendingRuns, TNode<Smi> p_run, TNode<Smi> p_value);
+void PushRun_411(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<SortState> p_sortState, TNode<Smi> p_base, TNode<Smi> p_length);
+TNode<FixedArray> GetTempArray_412(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<SortState> p_sortState, TNode<Smi> p_requestedSize);
+void BinaryInsertionSort_413(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<SortState> p_sortState, TNode<Smi> p_low, TNode<Smi> p_startArg, TNode<Smi> p_high);
+TNode<Smi> CountAndMakeRun_414(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<SortState> p_sortState, TNode<Smi> p_lowArg, TNode<Smi> p_high);
+void ReverseRange_415(compiler::CodeAssemblerState* state_, TNode<FixedArray> p_array, TNode<Smi> p_from, TNode<Smi> p_to);
+void MergeLow_416(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<SortState> p_sortState, TNode<Smi> p_baseA, TNode<Smi> p_lengthAArg, TNode<Smi> p_baseB, TNode<Smi> p_lengthBArg);
+void MergeHigh_417(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<SortState> p_sortState, TNode<Smi> p_baseA, TNode<Smi> p_lengthAArg, TNode<Smi> p_baseB, TNode<Smi> p_lengthBArg);
+TNode<Smi> ComputeMinRunLength_418(compiler::CodeAssemblerState* state_, TNode<Smi> p_nArg);
+TNode<BoolT> RunInvariantEstablished_419(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<FixedArray> p_pendingRuns, TNode<Smi> p_n);
+void MergeCollapse_420(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<SortState> p_sortState);
+void MergeForceCollapse_421(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<SortState> p_sortState);
+void ArrayTimSortImpl_422(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<SortState> p_sortState, TNode<Smi> p_length);
+TNode<Smi> CompactReceiverElementsIntoWorkArray_423(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<SortState> p_sortState);
+void CopyWorkArrayToReceiver_424(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<SortState> p_sortState, TNode<Smi> p_numberOfNonUndefined);
+TNode<JSReceiver> LoadSortStateReceiver_1321(compiler::CodeAssemblerState* state_, TNode<SortState> p_o);
+void StoreSortStateReceiver_1322(compiler::CodeAssemblerState* state_, TNode<SortState> p_o, TNode<JSReceiver> p_v);
+TNode<Map> LoadSortStateInitialReceiverMap_1323(compiler::CodeAssemblerState* state_, TNode<SortState> p_o);
+void StoreSortStateInitialReceiverMap_1324(compiler::CodeAssemblerState* state_, TNode<SortState> p_o, TNode<Map> p_v);
+TNode<Number> LoadSortStateInitialReceiverLength_1325(compiler::CodeAssemblerState* state_, TNode<SortState> p_o);
+void StoreSortStateInitialReceiverLength_1326(compiler::CodeAssemblerState* state_, TNode<SortState> p_o, TNode<Number> p_v);
+TNode<HeapObject> LoadSortStateUserCmpFn_1327(compiler::CodeAssemblerState* state_, TNode<SortState> p_o);
+void StoreSortStateUserCmpFn_1328(compiler::CodeAssemblerState* state_, TNode<SortState> p_o, TNode<HeapObject> p_v);
+TNode<BuiltinPtr> LoadSortStateSortComparePtr_1329(compiler::CodeAssemblerState* state_, TNode<SortState> p_o);
+void StoreSortStateSortComparePtr_1330(compiler::CodeAssemblerState* state_, TNode<SortState> p_o, TNode<BuiltinPtr> p_v);
+TNode<BuiltinPtr> LoadSortStateLoadFn_1331(compiler::CodeAssemblerState* state_, TNode<SortState> p_o);
+void StoreSortStateLoadFn_1332(compiler::CodeAssemblerState* state_, TNode<SortState> p_o, TNode<BuiltinPtr> p_v);
+TNode<BuiltinPtr> LoadSortStateStoreFn_1333(compiler::CodeAssemblerState* state_, TNode<SortState> p_o);
+void StoreSortStateStoreFn_1334(compiler::CodeAssemblerState* state_, TNode<SortState> p_o, TNode<BuiltinPtr> p_v);
+TNode<BuiltinPtr> LoadSortStateDeleteFn_1335(compiler::CodeAssemblerState* state_, TNode<SortState> p_o);
+void StoreSortStateDeleteFn_1336(compiler::CodeAssemblerState* state_, TNode<SortState> p_o, TNode<BuiltinPtr> p_v);
+TNode<BuiltinPtr> LoadSortStateCanUseSameAccessorFn_1337(compiler::CodeAssemblerState* state_, TNode<SortState> p_o);
+void StoreSortStateCanUseSameAccessorFn_1338(compiler::CodeAssemblerState* state_, TNode<SortState> p_o, TNode<BuiltinPtr> p_v);
+TNode<Smi> LoadSortStateMinGallop_1339(compiler::CodeAssemblerState* state_, TNode<SortState> p_o);
+void StoreSortStateMinGallop_1340(compiler::CodeAssemblerState* state_, TNode<SortState> p_o, TNode<Smi> p_v);
+TNode<Smi> LoadSortStatePendingRunsSize_1341(compiler::CodeAssemblerState* state_, TNode<SortState> p_o);
+void StoreSortStatePendingRunsSize_1342(compiler::CodeAssemblerState* state_, TNode<SortState> p_o, TNode<Smi> p_v);
+TNode<FixedArray> LoadSortStatePendingRuns_1343(compiler::CodeAssemblerState* state_, TNode<SortState> p_o);
+void StoreSortStatePendingRuns_1344(compiler::CodeAssemblerState* state_, TNode<SortState> p_o, TNode<FixedArray> p_v);
+TNode<FixedArray> LoadSortStateWorkArray_1345(compiler::CodeAssemblerState* state_, TNode<SortState> p_o);
+void StoreSortStateWorkArray_1346(compiler::CodeAssemblerState* state_, TNode<SortState> p_o, TNode<FixedArray> p_v);
+TNode<FixedArray> LoadSortStateTempArray_1347(compiler::CodeAssemblerState* state_, TNode<SortState> p_o);
+void StoreSortStateTempArray_1348(compiler::CodeAssemblerState* state_, TNode<SortState> p_o, TNode<FixedArray> p_v);
+TNode<Smi> LoadSortStateSortLength_1349(compiler::CodeAssemblerState* state_, TNode<SortState> p_o);
+void StoreSortStateSortLength_1350(compiler::CodeAssemblerState* state_, TNode<SortState> p_o, TNode<Smi> p_v);
+TNode<Smi> LoadSortStateNumberOfUndefined_1351(compiler::CodeAssemblerState* state_, TNode<SortState> p_o);
+void StoreSortStateNumberOfUndefined_1352(compiler::CodeAssemblerState* state_, TNode<SortState> p_o, TNode<Smi> p_v);
+TNode<Number> _method_SortState_Compare(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<SortState> p_this, TNode<Object> p_x, TNode<Object> p_y);
+void _method_SortState_CheckAccessor(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<SortState> p_this, compiler::CodeAssemblerLabel* label_Bailout);
+void _method_SortState_ResetToGenericAccessor(compiler::CodeAssemblerState* state_, TNode<SortState> p_this);
+TNode<JSObject> UnsafeCast8JSObject_1443(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o);
+TNode<HeapNumber> UnsafeCast10HeapNumber_1444(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o);
+TNode<HeapObject> Cast84UT19ATCallableApiObject17ATCallableJSProxy11ATUndefined15JSBoundFunction10JSFunction_1445(compiler::CodeAssemblerState* state_, TNode<Context> p_context, TNode<Object> p_o, compiler::CodeAssemblerLabel* label_CastError);
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_GEN_TORQUE_GENERATED_______DEPS_V8_THIRD_PARTY_V8_BUILTINS_ARRAY_SORT_TQ_H_
@@ -0,0 +1,295 @@
+#ifndef V8_GEN_TORQUE_GENERATED_BUILTIN_DEFINITIONS_TQ_H_
+#define V8_GEN_TORQUE_GENERATED_BUILTIN_DEFINITIONS_TQ_H_
+
+
+#define BUILTIN_LIST_FROM_TORQUE(CPP, TFJ, TFC, TFS, TFH, ASM) \
+TFJ(ArrayPrototypeCopyWithin, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(ArrayEveryLoopEagerDeoptContinuation, 4, kReceiver, kCallback, kThisArg, kInitialK, kLength) \
+TFJ(ArrayEveryLoopLazyDeoptContinuation, 5, kReceiver, kCallback, kThisArg, kInitialK, kLength, kResult) \
+TFC(ArrayEveryLoopContinuation, ArrayEveryLoopContinuation) \
+TFJ(ArrayEvery, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(ArrayFilterLoopEagerDeoptContinuation, 6, kReceiver, kCallback, kThisArg, kArray, kInitialK, kLength, kInitialTo) \
+TFJ(ArrayFilterLoopLazyDeoptContinuation, 8, kReceiver, kCallback, kThisArg, kArray, kInitialK, kLength, kValueK, kInitialTo, kResult) \
+TFC(ArrayFilterLoopContinuation, ArrayFilterLoopContinuation) \
+TFJ(ArrayFilter, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(ArrayFindLoopEagerDeoptContinuation, 4, kReceiver, kCallback, kThisArg, kInitialK, kLength) \
+TFJ(ArrayFindLoopLazyDeoptContinuation, 5, kReceiver, kCallback, kThisArg, kInitialK, kLength, kResult) \
+TFJ(ArrayFindLoopAfterCallbackLazyDeoptContinuation, 6, kReceiver, kCallback, kThisArg, kInitialK, kLength, kFoundValue, kIsFound) \
+TFC(ArrayFindLoopContinuation, ArrayFindLoopContinuation) \
+TFJ(ArrayPrototypeFind, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(ArrayFindIndexLoopEagerDeoptContinuation, 4, kReceiver, kCallback, kThisArg, kInitialK, kLength) \
+TFJ(ArrayFindIndexLoopLazyDeoptContinuation, 5, kReceiver, kCallback, kThisArg, kInitialK, kLength, kResult) \
+TFJ(ArrayFindIndexLoopAfterCallbackLazyDeoptContinuation, 6, kReceiver, kCallback, kThisArg, kInitialK, kLength, kFoundValue, kIsFound) \
+TFC(ArrayFindIndexLoopContinuation, ArrayFindIndexLoopContinuation) \
+TFJ(ArrayPrototypeFindIndex, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(ArrayForEachLoopEagerDeoptContinuation, 4, kReceiver, kCallback, kThisArg, kInitialK, kLength) \
+TFJ(ArrayForEachLoopLazyDeoptContinuation, 5, kReceiver, kCallback, kThisArg, kInitialK, kLength, kResult) \
+TFC(ArrayForEachLoopContinuation, ArrayForEachLoopContinuation) \
+TFJ(ArrayForEach, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFC(LoadJoinElement20ATDictionaryElements, LoadJoinElement20ATDictionaryElements) \
+TFC(LoadJoinElement25ATFastSmiOrObjectElements, LoadJoinElement25ATFastSmiOrObjectElements) \
+TFC(LoadJoinElement20ATFastDoubleElements, LoadJoinElement20ATFastDoubleElements) \
+TFC(ConvertToLocaleString, ConvertToLocaleString) \
+TFC(JoinStackPush, JoinStackPush) \
+TFC(JoinStackPop, JoinStackPop) \
+TFJ(ArrayPrototypeJoin, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(ArrayPrototypeToLocaleString, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(ArrayPrototypeToString, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(TypedArrayPrototypeJoin, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(TypedArrayPrototypeToLocaleString, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(ArrayPrototypeLastIndexOf, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(ArrayMapLoopEagerDeoptContinuation, 5, kReceiver, kCallback, kThisArg, kArray, kInitialK, kLength) \
+TFJ(ArrayMapLoopLazyDeoptContinuation, 6, kReceiver, kCallback, kThisArg, kArray, kInitialK, kLength, kResult) \
+TFC(ArrayMapLoopContinuation, ArrayMapLoopContinuation) \
+TFJ(ArrayMap, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(ArrayOf, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(ArrayReduceRightPreLoopEagerDeoptContinuation, 2, kReceiver, kCallback, kLength) \
+TFJ(ArrayReduceRightLoopEagerDeoptContinuation, 4, kReceiver, kCallback, kInitialK, kLength, kAccumulator) \
+TFJ(ArrayReduceRightLoopLazyDeoptContinuation, 4, kReceiver, kCallback, kInitialK, kLength, kResult) \
+TFC(ArrayReduceRightLoopContinuation, ArrayReduceRightLoopContinuation) \
+TFJ(ArrayReduceRight, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(ArrayReducePreLoopEagerDeoptContinuation, 2, kReceiver, kCallback, kLength) \
+TFJ(ArrayReduceLoopEagerDeoptContinuation, 4, kReceiver, kCallback, kInitialK, kLength, kAccumulator) \
+TFJ(ArrayReduceLoopLazyDeoptContinuation, 4, kReceiver, kCallback, kInitialK, kLength, kResult) \
+TFC(ArrayReduceLoopContinuation, ArrayReduceLoopContinuation) \
+TFJ(ArrayReduce, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(ArrayPrototypeReverse, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(ArrayPrototypeShift, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(ArrayPrototypeSlice, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(ArraySomeLoopEagerDeoptContinuation, 4, kReceiver, kCallback, kThisArg, kInitialK, kLength) \
+TFJ(ArraySomeLoopLazyDeoptContinuation, 5, kReceiver, kCallback, kThisArg, kInitialK, kLength, kResult) \
+TFC(ArraySomeLoopContinuation, ArraySomeLoopContinuation) \
+TFJ(ArraySome, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(ArrayPrototypeSplice, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(ArrayPrototypeUnshift, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFC(ToString, ToString) \
+TFC(FastCreateDataProperty, FastCreateDataProperty) \
+TFC(CheckNumberInRange, CheckNumberInRange) \
+TFC(BigIntAddNoThrow, BigIntAddNoThrow) \
+TFC(BigIntAdd, BigIntAdd) \
+TFC(BigIntUnaryMinus, BigIntUnaryMinus) \
+TFJ(BooleanConstructor, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(DataViewPrototypeGetBuffer, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(DataViewPrototypeGetByteLength, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(DataViewPrototypeGetByteOffset, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(DataViewPrototypeGetUint8, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(DataViewPrototypeGetInt8, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(DataViewPrototypeGetUint16, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(DataViewPrototypeGetInt16, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(DataViewPrototypeGetUint32, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(DataViewPrototypeGetInt32, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(DataViewPrototypeGetFloat32, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(DataViewPrototypeGetFloat64, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(DataViewPrototypeGetBigUint64, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(DataViewPrototypeGetBigInt64, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(DataViewPrototypeSetUint8, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(DataViewPrototypeSetInt8, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(DataViewPrototypeSetUint16, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(DataViewPrototypeSetInt16, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(DataViewPrototypeSetUint32, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(DataViewPrototypeSetInt32, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(DataViewPrototypeSetFloat32, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(DataViewPrototypeSetFloat64, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(DataViewPrototypeSetBigUint64, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(DataViewPrototypeSetBigInt64, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(ExtrasUtilsCreatePrivateSymbol, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(ExtrasUtilsMarkPromiseAsHandled, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(ExtrasUtilsPromiseState, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFC(IncBlockCounter, IncBlockCounter) \
+TFC(GetIteratorWithFeedback, GetIteratorWithFeedback) \
+TFC(CallIteratorWithFeedback, CallIteratorWithFeedback) \
+TFJ(MathAcos, 1, kReceiver, kX) \
+TFJ(MathAcosh, 1, kReceiver, kX) \
+TFJ(MathAsin, 1, kReceiver, kX) \
+TFJ(MathAsinh, 1, kReceiver, kX) \
+TFJ(MathAtan, 1, kReceiver, kX) \
+TFJ(MathAtan2, 2, kReceiver, kY, kX) \
+TFJ(MathAtanh, 1, kReceiver, kX) \
+TFJ(MathCbrt, 1, kReceiver, kX) \
+TFJ(MathClz32, 1, kReceiver, kX) \
+TFJ(MathCos, 1, kReceiver, kX) \
+TFJ(MathCosh, 1, kReceiver, kX) \
+TFJ(MathExp, 1, kReceiver, kX) \
+TFJ(MathExpm1, 1, kReceiver, kX) \
+TFJ(MathFround, 1, kReceiver, kX) \
+TFJ(MathLog, 1, kReceiver, kX) \
+TFJ(MathLog1p, 1, kReceiver, kX) \
+TFJ(MathLog10, 1, kReceiver, kX) \
+TFJ(MathLog2, 1, kReceiver, kX) \
+TFJ(MathSin, 1, kReceiver, kX) \
+TFJ(MathSign, 1, kReceiver, kX) \
+TFJ(MathSinh, 1, kReceiver, kX) \
+TFJ(MathSqrt, 1, kReceiver, kX) \
+TFJ(MathTan, 1, kReceiver, kX) \
+TFJ(MathTanh, 1, kReceiver, kX) \
+TFJ(MathHypot, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(ObjectFromEntries, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(ObjectIsExtensible, 1, kReceiver, kObject) \
+TFJ(ObjectPreventExtensions, 1, kReceiver, kObject) \
+TFJ(ObjectGetPrototypeOf, 1, kReceiver, kObject) \
+TFJ(ObjectSetPrototypeOf, 2, kReceiver, kObject, kProto) \
+TFJ(ProxyConstructor, 2, kReceiver, kTarget, kHandler) \
+TFC(ProxyDeleteProperty, ProxyDeleteProperty) \
+TFC(ProxyGetProperty, ProxyGetProperty) \
+TFC(ProxyGetPrototypeOf, ProxyGetPrototypeOf) \
+TFC(ProxyHasProperty, ProxyHasProperty) \
+TFC(ProxyIsExtensible, ProxyIsExtensible) \
+TFC(ProxyPreventExtensions, ProxyPreventExtensions) \
+TFJ(ProxyRevocable, 2, kReceiver, kTarget, kHandler) \
+TFJ(ProxyRevoke, 0, kReceiver) \
+TFC(ProxySetProperty, ProxySetProperty) \
+TFC(ProxySetPrototypeOf, ProxySetPrototypeOf) \
+TFJ(ReflectIsExtensible, 1, kReceiver, kObject) \
+TFJ(ReflectPreventExtensions, 1, kReceiver, kObject) \
+TFJ(ReflectGetPrototypeOf, 1, kReceiver, kObject) \
+TFJ(ReflectSetPrototypeOf, 2, kReceiver, kObject, kProto) \
+TFJ(ReflectGet, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(ReflectDeleteProperty, 2, kReceiver, kObject, kKey) \
+TFC(RegExpPrototypeExecSlow, RegExpPrototypeExecSlow) \
+TFJ(RegExpPrototypeExec, 1, kReceiver, kString) \
+TFJ(RegExpPrototypeMatchAll, 1, kReceiver, kString) \
+TFJ(RegExpStringIteratorPrototypeNext, 0, kReceiver) \
+TFC(RegExpMatchFast, RegExpMatchFast) \
+TFJ(RegExpPrototypeMatch, 1, kReceiver, kString) \
+TFC(RegExpReplace, RegExpReplace) \
+TFJ(RegExpPrototypeReplace, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFC(RegExpSearchFast, RegExpSearchFast) \
+TFJ(RegExpPrototypeSearch, 1, kReceiver, kString) \
+TFJ(RegExpPrototypeSourceGetter, 0, kReceiver) \
+TFC(RegExpSplit, RegExpSplit) \
+TFJ(RegExpPrototypeSplit, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(RegExpPrototypeTest, 1, kReceiver, kString) \
+TFC(RegExpPrototypeTestFast, RegExpPrototypeTestFast) \
+TFJ(RegExpPrototypeGlobalGetter, 0, kReceiver) \
+TFJ(RegExpPrototypeIgnoreCaseGetter, 0, kReceiver) \
+TFJ(RegExpPrototypeMultilineGetter, 0, kReceiver) \
+TFJ(RegExpPrototypeDotAllGetter, 0, kReceiver) \
+TFJ(RegExpPrototypeStickyGetter, 0, kReceiver) \
+TFJ(RegExpPrototypeUnicodeGetter, 0, kReceiver) \
+TFJ(RegExpPrototypeFlagsGetter, 0, kReceiver) \
+TFJ(StringPrototypeToString, 0, kReceiver) \
+TFJ(StringPrototypeValueOf, 0, kReceiver) \
+TFC(StringToList, StringToList) \
+TFJ(StringPrototypeCharAt, 1, kReceiver, kPosition) \
+TFJ(StringPrototypeCharCodeAt, 1, kReceiver, kPosition) \
+TFJ(StringPrototypeCodePointAt, 1, kReceiver, kPosition) \
+TFJ(StringPrototypeConcat, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(StringConstructor, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFC(StringAddConvertLeft, StringAddConvertLeft) \
+TFC(StringAddConvertRight, StringAddConvertRight) \
+TFC(StringCharAt, StringCharAt) \
+TFJ(StringPrototypeEndsWith, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFC(CreateHTML, CreateHTML) \
+TFJ(StringPrototypeAnchor, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(StringPrototypeBig, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(StringPrototypeBlink, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(StringPrototypeBold, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(StringPrototypeFontcolor, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(StringPrototypeFontsize, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(StringPrototypeFixed, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(StringPrototypeItalics, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(StringPrototypeLink, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(StringPrototypeSmall, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(StringPrototypeStrike, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(StringPrototypeSub, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(StringPrototypeSup, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(StringPrototypeIterator, 0, kReceiver) \
+TFJ(StringIteratorPrototypeNext, 0, kReceiver) \
+TFJ(StringPrototypePadStart, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(StringPrototypePadEnd, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFC(StringRepeat, StringRepeat) \
+TFJ(StringPrototypeRepeat, 1, kReceiver, kCount) \
+TFJ(StringPrototypeSlice, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(StringPrototypeStartsWith, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(StringPrototypeSubstring, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFC(CreateTypedArray, CreateTypedArray) \
+TFJ(TypedArrayPrototypeEvery, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(TypedArrayPrototypeFilter, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(TypedArrayPrototypeFind, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(TypedArrayPrototypeFindIndex, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(TypedArrayPrototypeForEach, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(TypedArrayPrototypeReduce, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(TypedArrayPrototypeReduceRight, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(TypedArrayPrototypeSlice, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(TypedArrayPrototypeSome, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFJ(TypedArrayPrototypeSubArray, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFC(TypedArrayMergeSort, TypedArrayMergeSort) \
+TFJ(TypedArrayPrototypeSort, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFC(Load17ATFastSmiElements, Load17ATFastSmiElements) \
+TFC(Load20ATFastObjectElements, Load20ATFastObjectElements) \
+TFC(Load20ATFastDoubleElements, Load20ATFastDoubleElements) \
+TFC(Store17ATFastSmiElements, Store17ATFastSmiElements) \
+TFC(Store20ATFastObjectElements, Store20ATFastObjectElements) \
+TFC(Store20ATFastDoubleElements, Store20ATFastDoubleElements) \
+TFC(Delete17ATFastSmiElements, Delete17ATFastSmiElements) \
+TFC(Delete20ATFastObjectElements, Delete20ATFastObjectElements) \
+TFC(Delete20ATFastDoubleElements, Delete20ATFastDoubleElements) \
+TFC(SortCompareDefault, SortCompareDefault) \
+TFC(SortCompareUserFn, SortCompareUserFn) \
+TFC(CanUseSameAccessor25ATGenericElementsAccessor, CanUseSameAccessor25ATGenericElementsAccessor) \
+TFC(Copy, Copy) \
+TFC(MergeAt, MergeAt) \
+TFC(GallopLeft, GallopLeft) \
+TFC(GallopRight, GallopRight) \
+TFC(ArrayTimSort, ArrayTimSort) \
+TFJ(ArrayPrototypeSort, SharedFunctionInfo::kDontAdaptArgumentsSentinel) \
+TFC(GenericBuiltinTest90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol, GenericBuiltinTest90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol) \
+TFC(TestHelperPlus1, TestHelperPlus1) \
+TFC(TestHelperPlus2, TestHelperPlus2) \
+TFC(NewSmiBox, NewSmiBox) \
+TFC(LoadJoinElement25ATGenericElementsAccessor, LoadJoinElement25ATGenericElementsAccessor) \
+TFC(LoadJoinTypedElement15ATInt32Elements, LoadJoinTypedElement15ATInt32Elements) \
+TFC(LoadJoinTypedElement17ATFloat32Elements, LoadJoinTypedElement17ATFloat32Elements) \
+TFC(LoadJoinTypedElement17ATFloat64Elements, LoadJoinTypedElement17ATFloat64Elements) \
+TFC(LoadJoinTypedElement22ATUint8ClampedElements, LoadJoinTypedElement22ATUint8ClampedElements) \
+TFC(LoadJoinTypedElement19ATBigUint64Elements, LoadJoinTypedElement19ATBigUint64Elements) \
+TFC(LoadJoinTypedElement18ATBigInt64Elements, LoadJoinTypedElement18ATBigInt64Elements) \
+TFC(LoadJoinTypedElement15ATUint8Elements, LoadJoinTypedElement15ATUint8Elements) \
+TFC(LoadJoinTypedElement14ATInt8Elements, LoadJoinTypedElement14ATInt8Elements) \
+TFC(LoadJoinTypedElement16ATUint16Elements, LoadJoinTypedElement16ATUint16Elements) \
+TFC(LoadJoinTypedElement15ATInt16Elements, LoadJoinTypedElement15ATInt16Elements) \
+TFC(LoadJoinTypedElement16ATUint32Elements, LoadJoinTypedElement16ATUint32Elements) \
+TFC(LoadFixedElement15ATInt32Elements, LoadFixedElement15ATInt32Elements) \
+TFC(LoadFixedElement17ATFloat32Elements, LoadFixedElement17ATFloat32Elements) \
+TFC(LoadFixedElement17ATFloat64Elements, LoadFixedElement17ATFloat64Elements) \
+TFC(LoadFixedElement22ATUint8ClampedElements, LoadFixedElement22ATUint8ClampedElements) \
+TFC(LoadFixedElement19ATBigUint64Elements, LoadFixedElement19ATBigUint64Elements) \
+TFC(LoadFixedElement18ATBigInt64Elements, LoadFixedElement18ATBigInt64Elements) \
+TFC(LoadFixedElement15ATUint8Elements, LoadFixedElement15ATUint8Elements) \
+TFC(LoadFixedElement14ATInt8Elements, LoadFixedElement14ATInt8Elements) \
+TFC(LoadFixedElement16ATUint16Elements, LoadFixedElement16ATUint16Elements) \
+TFC(LoadFixedElement15ATInt16Elements, LoadFixedElement15ATInt16Elements) \
+TFC(LoadFixedElement16ATUint32Elements, LoadFixedElement16ATUint32Elements) \
+TFC(StoreFixedElement15ATInt32Elements, StoreFixedElement15ATInt32Elements) \
+TFC(StoreFixedElement17ATFloat32Elements, StoreFixedElement17ATFloat32Elements) \
+TFC(StoreFixedElement17ATFloat64Elements, StoreFixedElement17ATFloat64Elements) \
+TFC(StoreFixedElement22ATUint8ClampedElements, StoreFixedElement22ATUint8ClampedElements) \
+TFC(StoreFixedElement19ATBigUint64Elements, StoreFixedElement19ATBigUint64Elements) \
+TFC(StoreFixedElement18ATBigInt64Elements, StoreFixedElement18ATBigInt64Elements) \
+TFC(StoreFixedElement15ATUint8Elements, StoreFixedElement15ATUint8Elements) \
+TFC(StoreFixedElement14ATInt8Elements, StoreFixedElement14ATInt8Elements) \
+TFC(StoreFixedElement16ATUint16Elements, StoreFixedElement16ATUint16Elements) \
+TFC(StoreFixedElement15ATInt16Elements, StoreFixedElement15ATInt16Elements) \
+TFC(StoreFixedElement16ATUint32Elements, StoreFixedElement16ATUint32Elements) \
+TFC(CanUseSameAccessor20ATFastDoubleElements, CanUseSameAccessor20ATFastDoubleElements) \
+TFC(CanUseSameAccessor17ATFastSmiElements, CanUseSameAccessor17ATFastSmiElements) \
+TFC(CanUseSameAccessor20ATFastObjectElements, CanUseSameAccessor20ATFastObjectElements) \
+TFC(Load25ATGenericElementsAccessor, Load25ATGenericElementsAccessor) \
+TFC(Store25ATGenericElementsAccessor, Store25ATGenericElementsAccessor) \
+TFC(Delete25ATGenericElementsAccessor, Delete25ATGenericElementsAccessor) \
+TFC(GenericBuiltinTest5ATSmi, GenericBuiltinTest5ATSmi) \
+
+#define TORQUE_FUNCTION_POINTER_TYPE_TO_BUILTIN_MAP(V) \
+  V(0,LoadJoinElement20ATDictionaryElements)\
+  V(1,LoadFixedElement15ATInt32Elements)\
+  V(2,StoreFixedElement15ATInt32Elements)\
+  V(3,Load17ATFastSmiElements)\
+  V(4,Store17ATFastSmiElements)\
+  V(5,Delete17ATFastSmiElements)\
+  V(6,CanUseSameAccessor25ATGenericElementsAccessor)\
+  V(7,SortCompareDefault)\
+  V(8,GenericBuiltinTest90UT8ATBigInt7ATFalse6ATNull5ATSmi6ATTrue11ATUndefined10HeapNumber10JSReceiver6String6Symbol)\
+  V(9,TestHelperPlus1)\
+  V(10,GenericBuiltinTest5ATSmi)\
+
+#endif  // V8_GEN_TORQUE_GENERATED_BUILTIN_DEFINITIONS_TQ_H_
@@ -0,0 +1,2907 @@
+#include "torque-generated/exported-macros-assembler-tq.h"
+#include "torque-generated/../../deps/v8/src/builtins/arguments-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-copywithin-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-join-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-lastindexof-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-map-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-right-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-reverse-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-shift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-splice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-unshift-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/base-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/bigint-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/boolean-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/collections-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/data-view-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/extras-utils-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/frames-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/growable-fixed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/internal-coverage-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/math-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-fromentries-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/object-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-constructor-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-delete-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-get-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-has-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-is-extensible-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-prevent-extensions-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revocable-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-revoke-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-property-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-set-prototype-of-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/proxy-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/reflect-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-exec-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-all-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-match-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-replace-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-search-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-source-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-split-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-test-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/regexp-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-endswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-html-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-iterator-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-pad-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-repeat-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-startswith-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/string-substring-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/torque-internal-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-createtypedarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-every-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-filter-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-find-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-findindex-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-foreach-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduce-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-reduceright-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-slice-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-some-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-subarray-tq-csa.h"
+#include "torque-generated/../../deps/v8/src/builtins/typed-array-tq-csa.h"
+#include "torque-generated/../../deps/v8/third_party/v8/builtins/array-sort-tq-csa.h"
+#include "torque-generated/../../deps/v8/test/torque/test-torque-tq-csa.h"
+namespace v8 {
+namespace internal {
+TorqueStructArgumentsInfo TorqueGeneratedExportedMacrosAssembler::GetArgumentsFrameAndCount(TNode<Context> p_context, TNode<JSFunction> p_f){
+return GetArgumentsFrameAndCount_0(state_, p_context, p_f);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::RequireObjectCoercible(TNode<Context> p_context, TNode<Object> p_value, const char* p_name){
+return RequireObjectCoercible_244(state_, p_context, p_value, p_name);
+}
+TNode<BoolT> TorqueGeneratedExportedMacrosAssembler::IsFastJSArray(TNode<Object> p_o, TNode<Context> p_context){
+return IsFastJSArray_249(state_, p_o, p_context);
+}
+void TorqueGeneratedExportedMacrosAssembler::BranchIfFastJSArray(TNode<Object> p_o, TNode<Context> p_context, compiler::CodeAssemblerLabel* label_True, compiler::CodeAssemblerLabel* label_False){
+return BranchIfFastJSArray_250(state_, p_o, p_context, label_True, label_False);
+}
+void TorqueGeneratedExportedMacrosAssembler::BranchIfFastJSArrayForRead(TNode<Object> p_o, TNode<Context> p_context, compiler::CodeAssemblerLabel* label_True, compiler::CodeAssemblerLabel* label_False){
+return BranchIfFastJSArrayForRead_251(state_, p_o, p_context, label_True, label_False);
+}
+TNode<BoolT> TorqueGeneratedExportedMacrosAssembler::IsFastJSArrayWithNoCustomIteration(TNode<Context> p_context, TNode<Object> p_o){
+return IsFastJSArrayWithNoCustomIteration_252(state_, p_context, p_o);
+}
+TNode<BoolT> TorqueGeneratedExportedMacrosAssembler::IsFastJSArrayForReadWithNoCustomIteration(TNode<Context> p_context, TNode<Object> p_o){
+return IsFastJSArrayForReadWithNoCustomIteration_253(state_, p_context, p_o);
+}
+TNode<String> TorqueGeneratedExportedMacrosAssembler::ToStringImpl(TNode<Context> p_context, TNode<Object> p_o){
+return ToStringImpl_254(state_, p_context, p_o);
+}
+TNode<BoolT> TorqueGeneratedExportedMacrosAssembler::IsIntegerOrSomeInfinity(TNode<Object> p_o){
+return IsIntegerOrSomeInfinity_257(state_, p_o);
+}
+TorqueStructKeyValuePair TorqueGeneratedExportedMacrosAssembler::LoadKeyValuePairNoSideEffects(TNode<Context> p_context, TNode<Object> p_o, compiler::CodeAssemblerLabel* label_MayHaveSideEffects){
+return LoadKeyValuePairNoSideEffects_270(state_, p_context, p_o, label_MayHaveSideEffects);
+}
+TorqueStructKeyValuePair TorqueGeneratedExportedMacrosAssembler::LoadKeyValuePair(TNode<Context> p_context, TNode<Object> p_o){
+return LoadKeyValuePair_271(state_, p_context, p_o);
+}
+TNode<JSFunction> TorqueGeneratedExportedMacrosAssembler::LoadTargetFromFrame(){
+return LoadTargetFromFrame_307(state_);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::RegExpPrototypeMatchAllImpl(TNode<Context> p_context, TNode<NativeContext> p_nativeContext, TNode<Object> p_receiver, TNode<Object> p_string){
+return RegExpPrototypeMatchAllImpl_325(state_, p_context, p_nativeContext, p_receiver, p_string);
+}
+TNode<BoolT> TorqueGeneratedExportedMacrosAssembler::IsFastRegExpPermissive(TNode<Context> p_context, TNode<HeapObject> p_o){
+return IsFastRegExpPermissive_340(state_, p_context, p_o);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::RegExpExec(TNode<Context> p_context, TNode<JSReceiver> p_receiver, TNode<String> p_string){
+return RegExpExec_341(state_, p_context, p_receiver, p_string);
+}
+TNode<BoolT> TorqueGeneratedExportedMacrosAssembler::IsRegExp(TNode<Context> p_context, TNode<Object> p_obj){
+return IsRegExp_345(state_, p_context, p_obj);
+}
+TNode<JSTypedArray> TorqueGeneratedExportedMacrosAssembler::TypedArraySpeciesCreateByLength(TNode<Context> p_context, const char* p_methodName, TNode<JSTypedArray> p_exemplar, TNode<Smi> p_length){
+return TypedArraySpeciesCreateByLength_365(state_, p_context, p_methodName, p_exemplar, p_length);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestConstexpr1(){
+return TestConstexpr1_430(state_);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestConstexprIf(){
+return TestConstexprIf_431(state_);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestConstexprReturn(){
+return TestConstexprReturn_432(state_);
+}
+TNode<Oddball> TorqueGeneratedExportedMacrosAssembler::TestGotoLabel(){
+return TestGotoLabel_433(state_);
+}
+TNode<Oddball> TorqueGeneratedExportedMacrosAssembler::TestGotoLabelWithOneParameter(){
+return TestGotoLabelWithOneParameter_434(state_);
+}
+TNode<Oddball> TorqueGeneratedExportedMacrosAssembler::TestGotoLabelWithTwoParameters(){
+return TestGotoLabelWithTwoParameters_435(state_);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestBuiltinSpecialization(TNode<Context> p_c){
+return TestBuiltinSpecialization_436(state_, p_c);
+}
+TNode<Oddball> TorqueGeneratedExportedMacrosAssembler::TestPartiallyUnusedLabel(){
+return TestPartiallyUnusedLabel_439(state_);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestMacroSpecialization(){
+return TestMacroSpecialization_442(state_);
+}
+TNode<Oddball> TorqueGeneratedExportedMacrosAssembler::TestFunctionPointers(TNode<Context> p_context){
+return TestFunctionPointers_443(state_, p_context);
+}
+TNode<Oddball> TorqueGeneratedExportedMacrosAssembler::TestVariableRedeclaration(TNode<Context> p_context){
+return TestVariableRedeclaration_444(state_, p_context);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::TestTernaryOperator(TNode<Smi> p_x){
+return TestTernaryOperator_445(state_, p_x);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestFunctionPointerToGeneric(TNode<Context> p_c){
+return TestFunctionPointerToGeneric_446(state_, p_c);
+}
+TNode<BuiltinPtr> TorqueGeneratedExportedMacrosAssembler::TestTypeAlias(TNode<BuiltinPtr> p_x){
+return TestTypeAlias_447(state_, p_x);
+}
+TNode<Oddball> TorqueGeneratedExportedMacrosAssembler::TestUnsafeCast(TNode<Context> p_context, TNode<Number> p_n){
+return TestUnsafeCast_448(state_, p_context, p_n);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestHexLiteral(){
+return TestHexLiteral_449(state_);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestLargeIntegerLiterals(TNode<Context> p_c){
+return TestLargeIntegerLiterals_450(state_, p_c);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestMultilineAssert(){
+return TestMultilineAssert_451(state_);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestNewlineInString(){
+return TestNewlineInString_452(state_);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestModuleConstBindings(){
+return TestModuleConstBindings_456(state_);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestLocalConstBindings(){
+return TestLocalConstBindings_457(state_);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::TestStruct1(TorqueStructTestStructA p_i){
+return TestStruct1_458(state_, p_i);
+}
+TorqueStructTestStructA TorqueGeneratedExportedMacrosAssembler::TestStruct2(TNode<Context> p_context){
+return TestStruct2_459(state_, p_context);
+}
+TorqueStructTestStructA TorqueGeneratedExportedMacrosAssembler::TestStruct3(TNode<Context> p_context){
+return TestStruct3_460(state_, p_context);
+}
+TorqueStructTestStructC TorqueGeneratedExportedMacrosAssembler::TestStruct4(TNode<Context> p_context){
+return TestStruct4_461(state_, p_context);
+}
+void TorqueGeneratedExportedMacrosAssembler::CallTestStructInLabel(TNode<Context> p_context){
+return CallTestStructInLabel_463(state_, p_context);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestForLoop(){
+return TestForLoop_464(state_);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestSubtyping(TNode<Smi> p_x){
+return TestSubtyping_465(state_, p_x);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestTypeswitch(TNode<Context> p_context){
+return TestTypeswitch_467(state_, p_context);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestTypeswitchAsanLsanFailure(TNode<Context> p_context, TNode<Object> p_obj){
+return TestTypeswitchAsanLsanFailure_468(state_, p_context, p_obj);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestGenericOverload(TNode<Context> p_context){
+return TestGenericOverload_469(state_, p_context);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestEquality(TNode<Context> p_context){
+return TestEquality_470(state_, p_context);
+}
+TNode<BoolT> TorqueGeneratedExportedMacrosAssembler::TestOrAnd(TNode<BoolT> p_x, TNode<BoolT> p_y, TNode<BoolT> p_z){
+return TestOrAnd_471(state_, p_x, p_y, p_z);
+}
+TNode<BoolT> TorqueGeneratedExportedMacrosAssembler::TestAndOr(TNode<BoolT> p_x, TNode<BoolT> p_y, TNode<BoolT> p_z){
+return TestAndOr_472(state_, p_x, p_y, p_z);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestLogicalOperators(){
+return TestLogicalOperators_473(state_);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::TestCall(TNode<Smi> p_i, compiler::CodeAssemblerLabel* label_A){
+return TestCall_474(state_, p_i, label_A);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestOtherwiseWithCode1(){
+return TestOtherwiseWithCode1_475(state_);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestOtherwiseWithCode2(){
+return TestOtherwiseWithCode2_476(state_);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestOtherwiseWithCode3(){
+return TestOtherwiseWithCode3_477(state_);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestForwardLabel(){
+return TestForwardLabel_478(state_);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestQualifiedAccess(TNode<Context> p_context){
+return TestQualifiedAccess_479(state_, p_context);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::TestCatch1(TNode<Context> p_context){
+return TestCatch1_480(state_, p_context);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestCatch2Wrapper(TNode<Context> p_context){
+return TestCatch2Wrapper_481(state_, p_context);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::TestCatch2(TNode<Context> p_context){
+return TestCatch2_482(state_, p_context);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestCatch3WrapperWithLabel(TNode<Context> p_context, compiler::CodeAssemblerLabel* label__Abort){
+return TestCatch3WrapperWithLabel_483(state_, p_context, label__Abort);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::TestCatch3(TNode<Context> p_context){
+return TestCatch3_484(state_, p_context);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestIterator(TNode<Context> p_context, TNode<JSReceiver> p_o, TNode<Map> p_map){
+return TestIterator_485(state_, p_context, p_o, p_map);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestFrame1(TNode<Context> p_context){
+return TestFrame1_486(state_, p_context);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestNew(TNode<Context> p_context){
+return TestNew_487(state_, p_context);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestStructConstructor(TNode<Context> p_context){
+return TestStructConstructor_488(state_, p_context);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestInternalClass(TNode<Context> p_context){
+return TestInternalClass_490(state_, p_context);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestConstInStructs(){
+return TestConstInStructs_491(state_);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::TestNewFixedArrayFromSpread(TNode<Context> p_context){
+return TestNewFixedArrayFromSpread_492(state_, p_context);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestReferences(){
+return TestReferences_493(state_);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestSlices(){
+return TestSlices_494(state_);
+}
+TNode<Oddball> TorqueGeneratedExportedMacrosAssembler::TestSliceEnumeration(TNode<Context> p_context){
+return TestSliceEnumeration_495(state_, p_context);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestStaticAssert(){
+return TestStaticAssert_496(state_);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestLoadEliminationFixed(TNode<Context> p_context){
+return TestLoadEliminationFixed_497(state_, p_context);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestLoadEliminationVariable(TNode<Context> p_context){
+return TestLoadEliminationVariable_498(state_, p_context);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::TestRedundantArrayElementCheck(TNode<Context> p_context){
+return TestRedundantArrayElementCheck_499(state_, p_context);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::TestRedundantSmiCheck(TNode<Context> p_context){
+return TestRedundantSmiCheck_500(state_, p_context);
+}
+TNode<IntPtrT> TorqueGeneratedExportedMacrosAssembler::TestGenericStruct1(){
+return TestGenericStruct1_501(state_);
+}
+TorqueStructTestTuple24TestTuple8ATintptr5ATSmi24TestTuple5ATSmi8ATintptr TorqueGeneratedExportedMacrosAssembler::TestGenericStruct2(){
+return TestGenericStruct2_502(state_);
+}
+void TorqueGeneratedExportedMacrosAssembler::TestBranchOnBoolOptimization(TNode<Context> p_context, TNode<Smi> p_input){
+return TestBranchOnBoolOptimization_504(state_, p_context, p_input);
+}
+TNode<Map> TorqueGeneratedExportedMacrosAssembler::LoadHeapObjectMap(TNode<HeapObject> p_o){
+return LoadHeapObjectMap_505(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreHeapObjectMap(TNode<HeapObject> p_o, TNode<Map> p_v){
+return StoreHeapObjectMap_506(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadContextLength(TNode<Context> p_o){
+return LoadContextLength_507(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreContextLength(TNode<Context> p_o, TNode<Smi> p_v){
+return StoreContextLength_508(state_, p_o, p_v);
+}
+TNode<ScopeInfo> TorqueGeneratedExportedMacrosAssembler::LoadContextScopeInfo(TNode<Context> p_o){
+return LoadContextScopeInfo_509(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreContextScopeInfo(TNode<Context> p_o, TNode<ScopeInfo> p_v){
+return StoreContextScopeInfo_510(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadContextPrevious(TNode<Context> p_o){
+return LoadContextPrevious_511(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreContextPrevious(TNode<Context> p_o, TNode<Object> p_v){
+return StoreContextPrevious_512(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadContextExtension(TNode<Context> p_o){
+return LoadContextExtension_513(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreContextExtension(TNode<Context> p_o, TNode<Object> p_v){
+return StoreContextExtension_514(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadContextNativeContext(TNode<Context> p_o){
+return LoadContextNativeContext_515(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreContextNativeContext(TNode<Context> p_o, TNode<Object> p_v){
+return StoreContextNativeContext_516(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSReceiverPropertiesOrHash(TNode<JSReceiver> p_o){
+return LoadJSReceiverPropertiesOrHash_517(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSReceiverPropertiesOrHash(TNode<JSReceiver> p_o, TNode<Object> p_v){
+return StoreJSReceiverPropertiesOrHash_518(state_, p_o, p_v);
+}
+TNode<Float64T> TorqueGeneratedExportedMacrosAssembler::LoadHeapNumberValue(TNode<HeapNumber> p_o){
+return LoadHeapNumberValue_519(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreHeapNumberValue(TNode<HeapNumber> p_o, TNode<Float64T> p_v){
+return StoreHeapNumberValue_520(state_, p_o, p_v);
+}
+TNode<Float64T> TorqueGeneratedExportedMacrosAssembler::LoadOddballToNumberRaw(TNode<Oddball> p_o){
+return LoadOddballToNumberRaw_521(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreOddballToNumberRaw(TNode<Oddball> p_o, TNode<Float64T> p_v){
+return StoreOddballToNumberRaw_522(state_, p_o, p_v);
+}
+TNode<String> TorqueGeneratedExportedMacrosAssembler::LoadOddballToString(TNode<Oddball> p_o){
+return LoadOddballToString_523(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreOddballToString(TNode<Oddball> p_o, TNode<String> p_v){
+return StoreOddballToString_524(state_, p_o, p_v);
+}
+TNode<Number> TorqueGeneratedExportedMacrosAssembler::LoadOddballToNumber(TNode<Oddball> p_o){
+return LoadOddballToNumber_525(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreOddballToNumber(TNode<Oddball> p_o, TNode<Number> p_v){
+return StoreOddballToNumber_526(state_, p_o, p_v);
+}
+TNode<String> TorqueGeneratedExportedMacrosAssembler::LoadOddballTypeOf(TNode<Oddball> p_o){
+return LoadOddballTypeOf_527(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreOddballTypeOf(TNode<Oddball> p_o, TNode<String> p_v){
+return StoreOddballTypeOf_528(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadOddballKind(TNode<Oddball> p_o){
+return LoadOddballKind_529(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreOddballKind(TNode<Oddball> p_o, TNode<Smi> p_v){
+return StoreOddballKind_530(state_, p_o, p_v);
+}
+TNode<Uint32T> TorqueGeneratedExportedMacrosAssembler::LoadNameHashField(TNode<Name> p_o){
+return LoadNameHashField_531(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreNameHashField(TNode<Name> p_o, TNode<Uint32T> p_v){
+return StoreNameHashField_532(state_, p_o, p_v);
+}
+TNode<Int32T> TorqueGeneratedExportedMacrosAssembler::LoadSymbolFlags(TNode<Symbol> p_o){
+return LoadSymbolFlags_533(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSymbolFlags(TNode<Symbol> p_o, TNode<Int32T> p_v){
+return StoreSymbolFlags_534(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadSymbolName(TNode<Symbol> p_o){
+return LoadSymbolName_535(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSymbolName(TNode<Symbol> p_o, TNode<Object> p_v){
+return StoreSymbolName_536(state_, p_o, p_v);
+}
+TNode<Int32T> TorqueGeneratedExportedMacrosAssembler::LoadStringLength(TNode<String> p_o){
+return LoadStringLength_537(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreStringLength(TNode<String> p_o, TNode<Int32T> p_v){
+return StoreStringLength_538(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadFixedArrayBaseLength(TNode<FixedArrayBase> p_o){
+return LoadFixedArrayBaseLength_539(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFixedArrayBaseLength(TNode<FixedArrayBase> p_o, TNode<Smi> p_v){
+return StoreFixedArrayBaseLength_540(state_, p_o, p_v);
+}
+TNode<String> TorqueGeneratedExportedMacrosAssembler::LoadConsStringFirst(TNode<ConsString> p_o){
+return LoadConsStringFirst_541(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreConsStringFirst(TNode<ConsString> p_o, TNode<String> p_v){
+return StoreConsStringFirst_542(state_, p_o, p_v);
+}
+TNode<String> TorqueGeneratedExportedMacrosAssembler::LoadConsStringSecond(TNode<ConsString> p_o){
+return LoadConsStringSecond_543(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreConsStringSecond(TNode<ConsString> p_o, TNode<String> p_v){
+return StoreConsStringSecond_544(state_, p_o, p_v);
+}
+TNode<RawPtrT> TorqueGeneratedExportedMacrosAssembler::LoadExternalStringResource(TNode<ExternalString> p_o){
+return LoadExternalStringResource_545(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreExternalStringResource(TNode<ExternalString> p_o, TNode<RawPtrT> p_v){
+return StoreExternalStringResource_546(state_, p_o, p_v);
+}
+TNode<RawPtrT> TorqueGeneratedExportedMacrosAssembler::LoadExternalStringResourceData(TNode<ExternalString> p_o){
+return LoadExternalStringResourceData_547(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreExternalStringResourceData(TNode<ExternalString> p_o, TNode<RawPtrT> p_v){
+return StoreExternalStringResourceData_548(state_, p_o, p_v);
+}
+TNode<String> TorqueGeneratedExportedMacrosAssembler::LoadSlicedStringParent(TNode<SlicedString> p_o){
+return LoadSlicedStringParent_549(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSlicedStringParent(TNode<SlicedString> p_o, TNode<String> p_v){
+return StoreSlicedStringParent_550(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadSlicedStringOffset(TNode<SlicedString> p_o){
+return LoadSlicedStringOffset_551(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSlicedStringOffset(TNode<SlicedString> p_o, TNode<Smi> p_v){
+return StoreSlicedStringOffset_552(state_, p_o, p_v);
+}
+TNode<String> TorqueGeneratedExportedMacrosAssembler::LoadThinStringActual(TNode<ThinString> p_o){
+return LoadThinStringActual_553(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreThinStringActual(TNode<ThinString> p_o, TNode<String> p_v){
+return StoreThinStringActual_554(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadTuple2Value1(TNode<Tuple2> p_o){
+return LoadTuple2Value1_555(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreTuple2Value1(TNode<Tuple2> p_o, TNode<Object> p_v){
+return StoreTuple2Value1_556(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadTuple2Value2(TNode<Tuple2> p_o){
+return LoadTuple2Value2_557(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreTuple2Value2(TNode<Tuple2> p_o, TNode<Object> p_v){
+return StoreTuple2Value2_558(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadTuple3Value3(TNode<Tuple3> p_o){
+return LoadTuple3Value3_559(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreTuple3Value3(TNode<Tuple3> p_o, TNode<Object> p_v){
+return StoreTuple3Value3_560(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadWeakFixedArrayLength(TNode<WeakFixedArray> p_o){
+return LoadWeakFixedArrayLength_561(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWeakFixedArrayLength(TNode<WeakFixedArray> p_o, TNode<Smi> p_v){
+return StoreWeakFixedArrayLength_562(state_, p_o, p_v);
+}
+TNode<Uint8T> TorqueGeneratedExportedMacrosAssembler::LoadMapInstanceSizeInWords(TNode<Map> p_o){
+return LoadMapInstanceSizeInWords_563(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreMapInstanceSizeInWords(TNode<Map> p_o, TNode<Uint8T> p_v){
+return StoreMapInstanceSizeInWords_564(state_, p_o, p_v);
+}
+TNode<Uint8T> TorqueGeneratedExportedMacrosAssembler::LoadMapInObjectPropertiesStartOrConstructorFunctionIndex(TNode<Map> p_o){
+return LoadMapInObjectPropertiesStartOrConstructorFunctionIndex_565(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreMapInObjectPropertiesStartOrConstructorFunctionIndex(TNode<Map> p_o, TNode<Uint8T> p_v){
+return StoreMapInObjectPropertiesStartOrConstructorFunctionIndex_566(state_, p_o, p_v);
+}
+TNode<Uint8T> TorqueGeneratedExportedMacrosAssembler::LoadMapUsedOrUnusedInstanceSizeInWords(TNode<Map> p_o){
+return LoadMapUsedOrUnusedInstanceSizeInWords_567(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreMapUsedOrUnusedInstanceSizeInWords(TNode<Map> p_o, TNode<Uint8T> p_v){
+return StoreMapUsedOrUnusedInstanceSizeInWords_568(state_, p_o, p_v);
+}
+TNode<Uint8T> TorqueGeneratedExportedMacrosAssembler::LoadMapVisitorId(TNode<Map> p_o){
+return LoadMapVisitorId_569(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreMapVisitorId(TNode<Map> p_o, TNode<Uint8T> p_v){
+return StoreMapVisitorId_570(state_, p_o, p_v);
+}
+TNode<Uint16T> TorqueGeneratedExportedMacrosAssembler::LoadMapInstanceType(TNode<Map> p_o){
+return LoadMapInstanceType_571(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreMapInstanceType(TNode<Map> p_o, TNode<Uint16T> p_v){
+return StoreMapInstanceType_572(state_, p_o, p_v);
+}
+TNode<Uint8T> TorqueGeneratedExportedMacrosAssembler::LoadMapBitField(TNode<Map> p_o){
+return LoadMapBitField_573(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreMapBitField(TNode<Map> p_o, TNode<Uint8T> p_v){
+return StoreMapBitField_574(state_, p_o, p_v);
+}
+TNode<Uint8T> TorqueGeneratedExportedMacrosAssembler::LoadMapBitField2(TNode<Map> p_o){
+return LoadMapBitField2_575(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreMapBitField2(TNode<Map> p_o, TNode<Uint8T> p_v){
+return StoreMapBitField2_576(state_, p_o, p_v);
+}
+TNode<Uint32T> TorqueGeneratedExportedMacrosAssembler::LoadMapBitField3(TNode<Map> p_o){
+return LoadMapBitField3_577(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreMapBitField3(TNode<Map> p_o, TNode<Uint32T> p_v){
+return StoreMapBitField3_578(state_, p_o, p_v);
+}
+TNode<Uint32T> TorqueGeneratedExportedMacrosAssembler::LoadMapOptionalPadding(TNode<Map> p_o){
+return LoadMapOptionalPadding_579(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreMapOptionalPadding(TNode<Map> p_o, TNode<Uint32T> p_v){
+return StoreMapOptionalPadding_580(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadMapPrototype(TNode<Map> p_o){
+return LoadMapPrototype_581(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreMapPrototype(TNode<Map> p_o, TNode<HeapObject> p_v){
+return StoreMapPrototype_582(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadMapConstructorOrBackPointer(TNode<Map> p_o){
+return LoadMapConstructorOrBackPointer_583(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreMapConstructorOrBackPointer(TNode<Map> p_o, TNode<Object> p_v){
+return StoreMapConstructorOrBackPointer_584(state_, p_o, p_v);
+}
+TNode<DescriptorArray> TorqueGeneratedExportedMacrosAssembler::LoadMapInstanceDescriptors(TNode<Map> p_o){
+return LoadMapInstanceDescriptors_585(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreMapInstanceDescriptors(TNode<Map> p_o, TNode<DescriptorArray> p_v){
+return StoreMapInstanceDescriptors_586(state_, p_o, p_v);
+}
+TNode<LayoutDescriptor> TorqueGeneratedExportedMacrosAssembler::LoadMapLayoutDescriptor(TNode<Map> p_o){
+return LoadMapLayoutDescriptor_587(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreMapLayoutDescriptor(TNode<Map> p_o, TNode<LayoutDescriptor> p_v){
+return StoreMapLayoutDescriptor_588(state_, p_o, p_v);
+}
+TNode<WeakFixedArray> TorqueGeneratedExportedMacrosAssembler::LoadMapDependentCode(TNode<Map> p_o){
+return LoadMapDependentCode_589(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreMapDependentCode(TNode<Map> p_o, TNode<WeakFixedArray> p_v){
+return StoreMapDependentCode_590(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadMapPrototypeValidityCell(TNode<Map> p_o){
+return LoadMapPrototypeValidityCell_591(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreMapPrototypeValidityCell(TNode<Map> p_o, TNode<Object> p_v){
+return StoreMapPrototypeValidityCell_592(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadMapTransitionsOrPrototypeInfo(TNode<Map> p_o){
+return LoadMapTransitionsOrPrototypeInfo_593(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreMapTransitionsOrPrototypeInfo(TNode<Map> p_o, TNode<Object> p_v){
+return StoreMapTransitionsOrPrototypeInfo_594(state_, p_o, p_v);
+}
+TNode<FixedArray> TorqueGeneratedExportedMacrosAssembler::LoadEnumCacheKeys(TNode<EnumCache> p_o){
+return LoadEnumCacheKeys_595(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreEnumCacheKeys(TNode<EnumCache> p_o, TNode<FixedArray> p_v){
+return StoreEnumCacheKeys_596(state_, p_o, p_v);
+}
+TNode<FixedArray> TorqueGeneratedExportedMacrosAssembler::LoadEnumCacheIndices(TNode<EnumCache> p_o){
+return LoadEnumCacheIndices_597(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreEnumCacheIndices(TNode<EnumCache> p_o, TNode<FixedArray> p_v){
+return StoreEnumCacheIndices_598(state_, p_o, p_v);
+}
+TNode<ByteArray> TorqueGeneratedExportedMacrosAssembler::LoadSourcePositionTableWithFrameCacheSourcePositionTable(TNode<SourcePositionTableWithFrameCache> p_o){
+return LoadSourcePositionTableWithFrameCacheSourcePositionTable_599(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSourcePositionTableWithFrameCacheSourcePositionTable(TNode<SourcePositionTableWithFrameCache> p_o, TNode<ByteArray> p_v){
+return StoreSourcePositionTableWithFrameCacheSourcePositionTable_600(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadSourcePositionTableWithFrameCacheStackFrameCache(TNode<SourcePositionTableWithFrameCache> p_o){
+return LoadSourcePositionTableWithFrameCacheStackFrameCache_601(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSourcePositionTableWithFrameCacheStackFrameCache(TNode<SourcePositionTableWithFrameCache> p_o, TNode<Object> p_v){
+return StoreSourcePositionTableWithFrameCacheStackFrameCache_602(state_, p_o, p_v);
+}
+TNode<Uint16T> TorqueGeneratedExportedMacrosAssembler::LoadDescriptorArrayNumberOfAllDescriptors(TNode<DescriptorArray> p_o){
+return LoadDescriptorArrayNumberOfAllDescriptors_603(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreDescriptorArrayNumberOfAllDescriptors(TNode<DescriptorArray> p_o, TNode<Uint16T> p_v){
+return StoreDescriptorArrayNumberOfAllDescriptors_604(state_, p_o, p_v);
+}
+TNode<Uint16T> TorqueGeneratedExportedMacrosAssembler::LoadDescriptorArrayNumberOfDescriptors(TNode<DescriptorArray> p_o){
+return LoadDescriptorArrayNumberOfDescriptors_605(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreDescriptorArrayNumberOfDescriptors(TNode<DescriptorArray> p_o, TNode<Uint16T> p_v){
+return StoreDescriptorArrayNumberOfDescriptors_606(state_, p_o, p_v);
+}
+TNode<Uint16T> TorqueGeneratedExportedMacrosAssembler::LoadDescriptorArrayRawNumberOfMarkedDescriptors(TNode<DescriptorArray> p_o){
+return LoadDescriptorArrayRawNumberOfMarkedDescriptors_607(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreDescriptorArrayRawNumberOfMarkedDescriptors(TNode<DescriptorArray> p_o, TNode<Uint16T> p_v){
+return StoreDescriptorArrayRawNumberOfMarkedDescriptors_608(state_, p_o, p_v);
+}
+TNode<Uint16T> TorqueGeneratedExportedMacrosAssembler::LoadDescriptorArrayFiller16Bits(TNode<DescriptorArray> p_o){
+return LoadDescriptorArrayFiller16Bits_609(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreDescriptorArrayFiller16Bits(TNode<DescriptorArray> p_o, TNode<Uint16T> p_v){
+return StoreDescriptorArrayFiller16Bits_610(state_, p_o, p_v);
+}
+TNode<EnumCache> TorqueGeneratedExportedMacrosAssembler::LoadDescriptorArrayEnumCache(TNode<DescriptorArray> p_o){
+return LoadDescriptorArrayEnumCache_611(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreDescriptorArrayEnumCache(TNode<DescriptorArray> p_o, TNode<EnumCache> p_v){
+return StoreDescriptorArrayEnumCache_612(state_, p_o, p_v);
+}
+TNode<FixedArrayBase> TorqueGeneratedExportedMacrosAssembler::LoadJSObjectElements(TNode<JSObject> p_o){
+return LoadJSObjectElements_613(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSObjectElements(TNode<JSObject> p_o, TNode<FixedArrayBase> p_v){
+return StoreJSObjectElements_614(state_, p_o, p_v);
+}
+TNode<SharedFunctionInfo> TorqueGeneratedExportedMacrosAssembler::LoadJSFunctionSharedFunctionInfo(TNode<JSFunction> p_o){
+return LoadJSFunctionSharedFunctionInfo_615(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSFunctionSharedFunctionInfo(TNode<JSFunction> p_o, TNode<SharedFunctionInfo> p_v){
+return StoreJSFunctionSharedFunctionInfo_616(state_, p_o, p_v);
+}
+TNode<Context> TorqueGeneratedExportedMacrosAssembler::LoadJSFunctionContext(TNode<JSFunction> p_o){
+return LoadJSFunctionContext_617(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSFunctionContext(TNode<JSFunction> p_o, TNode<Context> p_v){
+return StoreJSFunctionContext_618(state_, p_o, p_v);
+}
+TNode<FeedbackCell> TorqueGeneratedExportedMacrosAssembler::LoadJSFunctionFeedbackCell(TNode<JSFunction> p_o){
+return LoadJSFunctionFeedbackCell_619(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSFunctionFeedbackCell(TNode<JSFunction> p_o, TNode<FeedbackCell> p_v){
+return StoreJSFunctionFeedbackCell_620(state_, p_o, p_v);
+}
+TNode<Code> TorqueGeneratedExportedMacrosAssembler::LoadJSFunctionCode(TNode<JSFunction> p_o){
+return LoadJSFunctionCode_621(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSFunctionCode(TNode<JSFunction> p_o, TNode<Code> p_v){
+return StoreJSFunctionCode_622(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadJSFunctionPrototypeOrInitialMap(TNode<JSFunction> p_o){
+return LoadJSFunctionPrototypeOrInitialMap_623(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSFunctionPrototypeOrInitialMap(TNode<JSFunction> p_o, TNode<HeapObject> p_v){
+return StoreJSFunctionPrototypeOrInitialMap_624(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadJSProxyTarget(TNode<JSProxy> p_o){
+return LoadJSProxyTarget_625(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSProxyTarget(TNode<JSProxy> p_o, TNode<HeapObject> p_v){
+return StoreJSProxyTarget_626(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadJSProxyHandler(TNode<JSProxy> p_o){
+return LoadJSProxyHandler_627(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSProxyHandler(TNode<JSProxy> p_o, TNode<HeapObject> p_v){
+return StoreJSProxyHandler_628(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSProxyRevocableResultProxy(TNode<JSProxyRevocableResult> p_o){
+return LoadJSProxyRevocableResultProxy_629(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSProxyRevocableResultProxy(TNode<JSProxyRevocableResult> p_o, TNode<Object> p_v){
+return StoreJSProxyRevocableResultProxy_630(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSProxyRevocableResultRevoke(TNode<JSProxyRevocableResult> p_o){
+return LoadJSProxyRevocableResultRevoke_631(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSProxyRevocableResultRevoke(TNode<JSProxyRevocableResult> p_o, TNode<Object> p_v){
+return StoreJSProxyRevocableResultRevoke_632(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSGlobalProxyNativeContext(TNode<JSGlobalProxy> p_o){
+return LoadJSGlobalProxyNativeContext_633(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSGlobalProxyNativeContext(TNode<JSGlobalProxy> p_o, TNode<Object> p_v){
+return StoreJSGlobalProxyNativeContext_634(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSPrimitiveWrapperValue(TNode<JSPrimitiveWrapper> p_o){
+return LoadJSPrimitiveWrapperValue_635(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSPrimitiveWrapperValue(TNode<JSPrimitiveWrapper> p_o, TNode<Object> p_v){
+return StoreJSPrimitiveWrapperValue_636(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSArgumentsObjectWithLengthLength(TNode<JSArgumentsObjectWithLength> p_o){
+return LoadJSArgumentsObjectWithLengthLength_637(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSArgumentsObjectWithLengthLength(TNode<JSArgumentsObjectWithLength> p_o, TNode<Object> p_v){
+return StoreJSArgumentsObjectWithLengthLength_638(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSSloppyArgumentsObjectCallee(TNode<JSSloppyArgumentsObject> p_o){
+return LoadJSSloppyArgumentsObjectCallee_639(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSSloppyArgumentsObjectCallee(TNode<JSSloppyArgumentsObject> p_o, TNode<Object> p_v){
+return StoreJSSloppyArgumentsObjectCallee_640(state_, p_o, p_v);
+}
+TNode<JSReceiver> TorqueGeneratedExportedMacrosAssembler::LoadJSArrayIteratorIteratedObject(TNode<JSArrayIterator> p_o){
+return LoadJSArrayIteratorIteratedObject_641(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSArrayIteratorIteratedObject(TNode<JSArrayIterator> p_o, TNode<JSReceiver> p_v){
+return StoreJSArrayIteratorIteratedObject_642(state_, p_o, p_v);
+}
+TNode<Number> TorqueGeneratedExportedMacrosAssembler::LoadJSArrayIteratorNextIndex(TNode<JSArrayIterator> p_o){
+return LoadJSArrayIteratorNextIndex_643(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSArrayIteratorNextIndex(TNode<JSArrayIterator> p_o, TNode<Number> p_v){
+return StoreJSArrayIteratorNextIndex_644(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadJSArrayIteratorKind(TNode<JSArrayIterator> p_o){
+return LoadJSArrayIteratorKind_645(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSArrayIteratorKind(TNode<JSArrayIterator> p_o, TNode<Smi> p_v){
+return StoreJSArrayIteratorKind_646(state_, p_o, p_v);
+}
+TNode<Number> TorqueGeneratedExportedMacrosAssembler::LoadJSArrayLength(TNode<JSArray> p_o){
+return LoadJSArrayLength_647(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSArrayLength(TNode<JSArray> p_o, TNode<Number> p_v){
+return StoreJSArrayLength_648(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadCallHandlerInfoCallback(TNode<CallHandlerInfo> p_o){
+return LoadCallHandlerInfoCallback_649(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreCallHandlerInfoCallback(TNode<CallHandlerInfo> p_o, TNode<Object> p_v){
+return StoreCallHandlerInfoCallback_650(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadCallHandlerInfoJsCallback(TNode<CallHandlerInfo> p_o){
+return LoadCallHandlerInfoJsCallback_651(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreCallHandlerInfoJsCallback(TNode<CallHandlerInfo> p_o, TNode<Object> p_v){
+return StoreCallHandlerInfoJsCallback_652(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadCallHandlerInfoData(TNode<CallHandlerInfo> p_o){
+return LoadCallHandlerInfoData_653(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreCallHandlerInfoData(TNode<CallHandlerInfo> p_o, TNode<Object> p_v){
+return StoreCallHandlerInfoData_654(state_, p_o, p_v);
+}
+TNode<ObjectHashTable> TorqueGeneratedExportedMacrosAssembler::LoadModuleExports(TNode<Module> p_o){
+return LoadModuleExports_655(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreModuleExports(TNode<Module> p_o, TNode<ObjectHashTable> p_v){
+return StoreModuleExports_656(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadModuleHash(TNode<Module> p_o){
+return LoadModuleHash_657(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreModuleHash(TNode<Module> p_o, TNode<Smi> p_v){
+return StoreModuleHash_658(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadModuleStatus(TNode<Module> p_o){
+return LoadModuleStatus_659(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreModuleStatus(TNode<Module> p_o, TNode<Smi> p_v){
+return StoreModuleStatus_660(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadModuleModuleNamespace(TNode<Module> p_o){
+return LoadModuleModuleNamespace_661(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreModuleModuleNamespace(TNode<Module> p_o, TNode<HeapObject> p_v){
+return StoreModuleModuleNamespace_662(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadModuleException(TNode<Module> p_o){
+return LoadModuleException_663(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreModuleException(TNode<Module> p_o, TNode<Object> p_v){
+return StoreModuleException_664(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadSourceTextModuleCode(TNode<SourceTextModule> p_o){
+return LoadSourceTextModuleCode_665(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSourceTextModuleCode(TNode<SourceTextModule> p_o, TNode<HeapObject> p_v){
+return StoreSourceTextModuleCode_666(state_, p_o, p_v);
+}
+TNode<FixedArray> TorqueGeneratedExportedMacrosAssembler::LoadSourceTextModuleRegularExports(TNode<SourceTextModule> p_o){
+return LoadSourceTextModuleRegularExports_667(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSourceTextModuleRegularExports(TNode<SourceTextModule> p_o, TNode<FixedArray> p_v){
+return StoreSourceTextModuleRegularExports_668(state_, p_o, p_v);
+}
+TNode<FixedArray> TorqueGeneratedExportedMacrosAssembler::LoadSourceTextModuleRegularImports(TNode<SourceTextModule> p_o){
+return LoadSourceTextModuleRegularImports_669(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSourceTextModuleRegularImports(TNode<SourceTextModule> p_o, TNode<FixedArray> p_v){
+return StoreSourceTextModuleRegularImports_670(state_, p_o, p_v);
+}
+TNode<FixedArray> TorqueGeneratedExportedMacrosAssembler::LoadSourceTextModuleRequestedModules(TNode<SourceTextModule> p_o){
+return LoadSourceTextModuleRequestedModules_671(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSourceTextModuleRequestedModules(TNode<SourceTextModule> p_o, TNode<FixedArray> p_v){
+return StoreSourceTextModuleRequestedModules_672(state_, p_o, p_v);
+}
+TNode<Script> TorqueGeneratedExportedMacrosAssembler::LoadSourceTextModuleScript(TNode<SourceTextModule> p_o){
+return LoadSourceTextModuleScript_673(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSourceTextModuleScript(TNode<SourceTextModule> p_o, TNode<Script> p_v){
+return StoreSourceTextModuleScript_674(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadSourceTextModuleImportMeta(TNode<SourceTextModule> p_o){
+return LoadSourceTextModuleImportMeta_675(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSourceTextModuleImportMeta(TNode<SourceTextModule> p_o, TNode<HeapObject> p_v){
+return StoreSourceTextModuleImportMeta_676(state_, p_o, p_v);
+}
+TNode<ArrayList> TorqueGeneratedExportedMacrosAssembler::LoadSourceTextModuleAsyncParentModules(TNode<SourceTextModule> p_o){
+return LoadSourceTextModuleAsyncParentModules_677(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSourceTextModuleAsyncParentModules(TNode<SourceTextModule> p_o, TNode<ArrayList> p_v){
+return StoreSourceTextModuleAsyncParentModules_678(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadSourceTextModuleTopLevelCapability(TNode<SourceTextModule> p_o){
+return LoadSourceTextModuleTopLevelCapability_679(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSourceTextModuleTopLevelCapability(TNode<SourceTextModule> p_o, TNode<HeapObject> p_v){
+return StoreSourceTextModuleTopLevelCapability_680(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadSourceTextModuleDfsIndex(TNode<SourceTextModule> p_o){
+return LoadSourceTextModuleDfsIndex_681(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSourceTextModuleDfsIndex(TNode<SourceTextModule> p_o, TNode<Smi> p_v){
+return StoreSourceTextModuleDfsIndex_682(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadSourceTextModuleDfsAncestorIndex(TNode<SourceTextModule> p_o){
+return LoadSourceTextModuleDfsAncestorIndex_683(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSourceTextModuleDfsAncestorIndex(TNode<SourceTextModule> p_o, TNode<Smi> p_v){
+return StoreSourceTextModuleDfsAncestorIndex_684(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadSourceTextModulePendingAsyncDependencies(TNode<SourceTextModule> p_o){
+return LoadSourceTextModulePendingAsyncDependencies_685(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSourceTextModulePendingAsyncDependencies(TNode<SourceTextModule> p_o, TNode<Smi> p_v){
+return StoreSourceTextModulePendingAsyncDependencies_686(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadSourceTextModuleFlags(TNode<SourceTextModule> p_o){
+return LoadSourceTextModuleFlags_687(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSourceTextModuleFlags(TNode<SourceTextModule> p_o, TNode<Smi> p_v){
+return StoreSourceTextModuleFlags_688(state_, p_o, p_v);
+}
+TNode<String> TorqueGeneratedExportedMacrosAssembler::LoadSyntheticModuleName(TNode<SyntheticModule> p_o){
+return LoadSyntheticModuleName_689(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSyntheticModuleName(TNode<SyntheticModule> p_o, TNode<String> p_v){
+return StoreSyntheticModuleName_690(state_, p_o, p_v);
+}
+TNode<FixedArray> TorqueGeneratedExportedMacrosAssembler::LoadSyntheticModuleExportNames(TNode<SyntheticModule> p_o){
+return LoadSyntheticModuleExportNames_691(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSyntheticModuleExportNames(TNode<SyntheticModule> p_o, TNode<FixedArray> p_v){
+return StoreSyntheticModuleExportNames_692(state_, p_o, p_v);
+}
+TNode<Foreign> TorqueGeneratedExportedMacrosAssembler::LoadSyntheticModuleEvaluationSteps(TNode<SyntheticModule> p_o){
+return LoadSyntheticModuleEvaluationSteps_693(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSyntheticModuleEvaluationSteps(TNode<SyntheticModule> p_o, TNode<Foreign> p_v){
+return StoreSyntheticModuleEvaluationSteps_694(state_, p_o, p_v);
+}
+TNode<Module> TorqueGeneratedExportedMacrosAssembler::LoadJSModuleNamespaceModule(TNode<JSModuleNamespace> p_o){
+return LoadJSModuleNamespaceModule_695(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSModuleNamespaceModule(TNode<JSModuleNamespace> p_o, TNode<Module> p_v){
+return StoreJSModuleNamespaceModule_696(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSWeakCollectionTable(TNode<JSWeakCollection> p_o){
+return LoadJSWeakCollectionTable_697(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSWeakCollectionTable(TNode<JSWeakCollection> p_o, TNode<Object> p_v){
+return StoreJSWeakCollectionTable_698(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSCollectionIteratorTable(TNode<JSCollectionIterator> p_o){
+return LoadJSCollectionIteratorTable_699(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSCollectionIteratorTable(TNode<JSCollectionIterator> p_o, TNode<Object> p_v){
+return StoreJSCollectionIteratorTable_700(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSCollectionIteratorIndex(TNode<JSCollectionIterator> p_o){
+return LoadJSCollectionIteratorIndex_701(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSCollectionIteratorIndex(TNode<JSCollectionIterator> p_o, TNode<Object> p_v){
+return StoreJSCollectionIteratorIndex_702(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadJSMessageObjectMessageType(TNode<JSMessageObject> p_o){
+return LoadJSMessageObjectMessageType_703(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSMessageObjectMessageType(TNode<JSMessageObject> p_o, TNode<Smi> p_v){
+return StoreJSMessageObjectMessageType_704(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSMessageObjectArguments(TNode<JSMessageObject> p_o){
+return LoadJSMessageObjectArguments_705(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSMessageObjectArguments(TNode<JSMessageObject> p_o, TNode<Object> p_v){
+return StoreJSMessageObjectArguments_706(state_, p_o, p_v);
+}
+TNode<Script> TorqueGeneratedExportedMacrosAssembler::LoadJSMessageObjectScript(TNode<JSMessageObject> p_o){
+return LoadJSMessageObjectScript_707(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSMessageObjectScript(TNode<JSMessageObject> p_o, TNode<Script> p_v){
+return StoreJSMessageObjectScript_708(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSMessageObjectStackFrames(TNode<JSMessageObject> p_o){
+return LoadJSMessageObjectStackFrames_709(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSMessageObjectStackFrames(TNode<JSMessageObject> p_o, TNode<Object> p_v){
+return StoreJSMessageObjectStackFrames_710(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadJSMessageObjectSharedInfo(TNode<JSMessageObject> p_o){
+return LoadJSMessageObjectSharedInfo_711(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSMessageObjectSharedInfo(TNode<JSMessageObject> p_o, TNode<HeapObject> p_v){
+return StoreJSMessageObjectSharedInfo_712(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadJSMessageObjectBytecodeOffset(TNode<JSMessageObject> p_o){
+return LoadJSMessageObjectBytecodeOffset_713(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSMessageObjectBytecodeOffset(TNode<JSMessageObject> p_o, TNode<Smi> p_v){
+return StoreJSMessageObjectBytecodeOffset_714(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadJSMessageObjectStartPosition(TNode<JSMessageObject> p_o){
+return LoadJSMessageObjectStartPosition_715(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSMessageObjectStartPosition(TNode<JSMessageObject> p_o, TNode<Smi> p_v){
+return StoreJSMessageObjectStartPosition_716(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadJSMessageObjectEndPosition(TNode<JSMessageObject> p_o){
+return LoadJSMessageObjectEndPosition_717(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSMessageObjectEndPosition(TNode<JSMessageObject> p_o, TNode<Smi> p_v){
+return StoreJSMessageObjectEndPosition_718(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadJSMessageObjectErrorLevel(TNode<JSMessageObject> p_o){
+return LoadJSMessageObjectErrorLevel_719(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSMessageObjectErrorLevel(TNode<JSMessageObject> p_o, TNode<Smi> p_v){
+return StoreJSMessageObjectErrorLevel_720(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadWeakArrayListCapacity(TNode<WeakArrayList> p_o){
+return LoadWeakArrayListCapacity_721(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWeakArrayListCapacity(TNode<WeakArrayList> p_o, TNode<Smi> p_v){
+return StoreWeakArrayListCapacity_722(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadWeakArrayListLength(TNode<WeakArrayList> p_o){
+return LoadWeakArrayListLength_723(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWeakArrayListLength(TNode<WeakArrayList> p_o, TNode<Smi> p_v){
+return StoreWeakArrayListLength_724(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadPrototypeInfoJsModuleNamespace(TNode<PrototypeInfo> p_o){
+return LoadPrototypeInfoJsModuleNamespace_725(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePrototypeInfoJsModuleNamespace(TNode<PrototypeInfo> p_o, TNode<HeapObject> p_v){
+return StorePrototypeInfoJsModuleNamespace_726(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadPrototypeInfoPrototypeUsers(TNode<PrototypeInfo> p_o){
+return LoadPrototypeInfoPrototypeUsers_727(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePrototypeInfoPrototypeUsers(TNode<PrototypeInfo> p_o, TNode<Object> p_v){
+return StorePrototypeInfoPrototypeUsers_728(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadPrototypeInfoRegistrySlot(TNode<PrototypeInfo> p_o){
+return LoadPrototypeInfoRegistrySlot_729(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePrototypeInfoRegistrySlot(TNode<PrototypeInfo> p_o, TNode<Smi> p_v){
+return StorePrototypeInfoRegistrySlot_730(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadPrototypeInfoValidityCell(TNode<PrototypeInfo> p_o){
+return LoadPrototypeInfoValidityCell_731(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePrototypeInfoValidityCell(TNode<PrototypeInfo> p_o, TNode<Object> p_v){
+return StorePrototypeInfoValidityCell_732(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadPrototypeInfoObjectCreateMap(TNode<PrototypeInfo> p_o){
+return LoadPrototypeInfoObjectCreateMap_733(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePrototypeInfoObjectCreateMap(TNode<PrototypeInfo> p_o, TNode<HeapObject> p_v){
+return StorePrototypeInfoObjectCreateMap_734(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadPrototypeInfoBitField(TNode<PrototypeInfo> p_o){
+return LoadPrototypeInfoBitField_735(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePrototypeInfoBitField(TNode<PrototypeInfo> p_o, TNode<Smi> p_v){
+return StorePrototypeInfoBitField_736(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadScriptSource(TNode<Script> p_o){
+return LoadScriptSource_737(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreScriptSource(TNode<Script> p_o, TNode<Object> p_v){
+return StoreScriptSource_738(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadScriptName(TNode<Script> p_o){
+return LoadScriptName_739(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreScriptName(TNode<Script> p_o, TNode<Object> p_v){
+return StoreScriptName_740(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadScriptLineOffset(TNode<Script> p_o){
+return LoadScriptLineOffset_741(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreScriptLineOffset(TNode<Script> p_o, TNode<Smi> p_v){
+return StoreScriptLineOffset_742(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadScriptColumnOffset(TNode<Script> p_o){
+return LoadScriptColumnOffset_743(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreScriptColumnOffset(TNode<Script> p_o, TNode<Smi> p_v){
+return StoreScriptColumnOffset_744(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadScriptContext(TNode<Script> p_o){
+return LoadScriptContext_745(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreScriptContext(TNode<Script> p_o, TNode<Object> p_v){
+return StoreScriptContext_746(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadScriptScriptType(TNode<Script> p_o){
+return LoadScriptScriptType_747(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreScriptScriptType(TNode<Script> p_o, TNode<Smi> p_v){
+return StoreScriptScriptType_748(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadScriptLineEnds(TNode<Script> p_o){
+return LoadScriptLineEnds_749(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreScriptLineEnds(TNode<Script> p_o, TNode<Object> p_v){
+return StoreScriptLineEnds_750(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadScriptId(TNode<Script> p_o){
+return LoadScriptId_751(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreScriptId(TNode<Script> p_o, TNode<Smi> p_v){
+return StoreScriptId_752(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadScriptEvalFromSharedOrWrappedArguments(TNode<Script> p_o){
+return LoadScriptEvalFromSharedOrWrappedArguments_753(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreScriptEvalFromSharedOrWrappedArguments(TNode<Script> p_o, TNode<Object> p_v){
+return StoreScriptEvalFromSharedOrWrappedArguments_754(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadScriptEvalFromPosition(TNode<Script> p_o){
+return LoadScriptEvalFromPosition_755(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreScriptEvalFromPosition(TNode<Script> p_o, TNode<Object> p_v){
+return StoreScriptEvalFromPosition_756(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadScriptSharedFunctionInfos(TNode<Script> p_o){
+return LoadScriptSharedFunctionInfos_757(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreScriptSharedFunctionInfos(TNode<Script> p_o, TNode<Object> p_v){
+return StoreScriptSharedFunctionInfos_758(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadScriptFlags(TNode<Script> p_o){
+return LoadScriptFlags_759(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreScriptFlags(TNode<Script> p_o, TNode<Smi> p_v){
+return StoreScriptFlags_760(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadScriptSourceUrl(TNode<Script> p_o){
+return LoadScriptSourceUrl_761(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreScriptSourceUrl(TNode<Script> p_o, TNode<Object> p_v){
+return StoreScriptSourceUrl_762(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadScriptSourceMappingUrl(TNode<Script> p_o){
+return LoadScriptSourceMappingUrl_763(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreScriptSourceMappingUrl(TNode<Script> p_o, TNode<Object> p_v){
+return StoreScriptSourceMappingUrl_764(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadScriptHostDefinedOptions(TNode<Script> p_o){
+return LoadScriptHostDefinedOptions_765(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreScriptHostDefinedOptions(TNode<Script> p_o, TNode<Object> p_v){
+return StoreScriptHostDefinedOptions_766(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadEmbedderDataArrayLength(TNode<EmbedderDataArray> p_o){
+return LoadEmbedderDataArrayLength_767(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreEmbedderDataArrayLength(TNode<EmbedderDataArray> p_o, TNode<Smi> p_v){
+return StoreEmbedderDataArrayLength_768(state_, p_o, p_v);
+}
+TNode<Int32T> TorqueGeneratedExportedMacrosAssembler::LoadPreparseDataDataLength(TNode<PreparseData> p_o){
+return LoadPreparseDataDataLength_769(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePreparseDataDataLength(TNode<PreparseData> p_o, TNode<Int32T> p_v){
+return StorePreparseDataDataLength_770(state_, p_o, p_v);
+}
+TNode<Int32T> TorqueGeneratedExportedMacrosAssembler::LoadPreparseDataChildrenLength(TNode<PreparseData> p_o){
+return LoadPreparseDataChildrenLength_771(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePreparseDataChildrenLength(TNode<PreparseData> p_o, TNode<Int32T> p_v){
+return StorePreparseDataChildrenLength_772(state_, p_o, p_v);
+}
+TNode<BytecodeArray> TorqueGeneratedExportedMacrosAssembler::LoadInterpreterDataBytecodeArray(TNode<InterpreterData> p_o){
+return LoadInterpreterDataBytecodeArray_773(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreInterpreterDataBytecodeArray(TNode<InterpreterData> p_o, TNode<BytecodeArray> p_v){
+return StoreInterpreterDataBytecodeArray_774(state_, p_o, p_v);
+}
+TNode<Code> TorqueGeneratedExportedMacrosAssembler::LoadInterpreterDataInterpreterTrampoline(TNode<InterpreterData> p_o){
+return LoadInterpreterDataInterpreterTrampoline_775(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreInterpreterDataInterpreterTrampoline(TNode<InterpreterData> p_o, TNode<Code> p_v){
+return StoreInterpreterDataInterpreterTrampoline_776(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadSharedFunctionInfoFunctionData(TNode<SharedFunctionInfo> p_o){
+return LoadSharedFunctionInfoFunctionData_777(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSharedFunctionInfoFunctionData(TNode<SharedFunctionInfo> p_o, TNode<Object> p_v){
+return StoreSharedFunctionInfoFunctionData_778(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadSharedFunctionInfoNameOrScopeInfo(TNode<SharedFunctionInfo> p_o){
+return LoadSharedFunctionInfoNameOrScopeInfo_779(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSharedFunctionInfoNameOrScopeInfo(TNode<SharedFunctionInfo> p_o, TNode<Object> p_v){
+return StoreSharedFunctionInfoNameOrScopeInfo_780(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadSharedFunctionInfoOuterScopeInfoOrFeedbackMetadata(TNode<SharedFunctionInfo> p_o){
+return LoadSharedFunctionInfoOuterScopeInfoOrFeedbackMetadata_781(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSharedFunctionInfoOuterScopeInfoOrFeedbackMetadata(TNode<SharedFunctionInfo> p_o, TNode<HeapObject> p_v){
+return StoreSharedFunctionInfoOuterScopeInfoOrFeedbackMetadata_782(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadSharedFunctionInfoScriptOrDebugInfo(TNode<SharedFunctionInfo> p_o){
+return LoadSharedFunctionInfoScriptOrDebugInfo_783(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSharedFunctionInfoScriptOrDebugInfo(TNode<SharedFunctionInfo> p_o, TNode<HeapObject> p_v){
+return StoreSharedFunctionInfoScriptOrDebugInfo_784(state_, p_o, p_v);
+}
+TNode<Int16T> TorqueGeneratedExportedMacrosAssembler::LoadSharedFunctionInfoLength(TNode<SharedFunctionInfo> p_o){
+return LoadSharedFunctionInfoLength_785(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSharedFunctionInfoLength(TNode<SharedFunctionInfo> p_o, TNode<Int16T> p_v){
+return StoreSharedFunctionInfoLength_786(state_, p_o, p_v);
+}
+TNode<Uint16T> TorqueGeneratedExportedMacrosAssembler::LoadSharedFunctionInfoFormalParameterCount(TNode<SharedFunctionInfo> p_o){
+return LoadSharedFunctionInfoFormalParameterCount_787(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSharedFunctionInfoFormalParameterCount(TNode<SharedFunctionInfo> p_o, TNode<Uint16T> p_v){
+return StoreSharedFunctionInfoFormalParameterCount_788(state_, p_o, p_v);
+}
+TNode<Uint16T> TorqueGeneratedExportedMacrosAssembler::LoadSharedFunctionInfoExpectedNofProperties(TNode<SharedFunctionInfo> p_o){
+return LoadSharedFunctionInfoExpectedNofProperties_789(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSharedFunctionInfoExpectedNofProperties(TNode<SharedFunctionInfo> p_o, TNode<Uint16T> p_v){
+return StoreSharedFunctionInfoExpectedNofProperties_790(state_, p_o, p_v);
+}
+TNode<Int16T> TorqueGeneratedExportedMacrosAssembler::LoadSharedFunctionInfoFunctionTokenOffset(TNode<SharedFunctionInfo> p_o){
+return LoadSharedFunctionInfoFunctionTokenOffset_791(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSharedFunctionInfoFunctionTokenOffset(TNode<SharedFunctionInfo> p_o, TNode<Int16T> p_v){
+return StoreSharedFunctionInfoFunctionTokenOffset_792(state_, p_o, p_v);
+}
+TNode<Int32T> TorqueGeneratedExportedMacrosAssembler::LoadSharedFunctionInfoFlags(TNode<SharedFunctionInfo> p_o){
+return LoadSharedFunctionInfoFlags_793(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSharedFunctionInfoFlags(TNode<SharedFunctionInfo> p_o, TNode<Int32T> p_v){
+return StoreSharedFunctionInfoFlags_794(state_, p_o, p_v);
+}
+TNode<Int32T> TorqueGeneratedExportedMacrosAssembler::LoadSharedFunctionInfoFunctionLiteralId(TNode<SharedFunctionInfo> p_o){
+return LoadSharedFunctionInfoFunctionLiteralId_795(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSharedFunctionInfoFunctionLiteralId(TNode<SharedFunctionInfo> p_o, TNode<Int32T> p_v){
+return StoreSharedFunctionInfoFunctionLiteralId_796(state_, p_o, p_v);
+}
+TNode<String> TorqueGeneratedExportedMacrosAssembler::LoadUncompiledDataInferredName(TNode<UncompiledData> p_o){
+return LoadUncompiledDataInferredName_797(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreUncompiledDataInferredName(TNode<UncompiledData> p_o, TNode<String> p_v){
+return StoreUncompiledDataInferredName_798(state_, p_o, p_v);
+}
+TNode<Int32T> TorqueGeneratedExportedMacrosAssembler::LoadUncompiledDataStartPosition(TNode<UncompiledData> p_o){
+return LoadUncompiledDataStartPosition_799(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreUncompiledDataStartPosition(TNode<UncompiledData> p_o, TNode<Int32T> p_v){
+return StoreUncompiledDataStartPosition_800(state_, p_o, p_v);
+}
+TNode<Int32T> TorqueGeneratedExportedMacrosAssembler::LoadUncompiledDataEndPosition(TNode<UncompiledData> p_o){
+return LoadUncompiledDataEndPosition_801(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreUncompiledDataEndPosition(TNode<UncompiledData> p_o, TNode<Int32T> p_v){
+return StoreUncompiledDataEndPosition_802(state_, p_o, p_v);
+}
+TNode<PreparseData> TorqueGeneratedExportedMacrosAssembler::LoadUncompiledDataWithPreparseDataPreparseData(TNode<UncompiledDataWithPreparseData> p_o){
+return LoadUncompiledDataWithPreparseDataPreparseData_803(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreUncompiledDataWithPreparseDataPreparseData(TNode<UncompiledDataWithPreparseData> p_o, TNode<PreparseData> p_v){
+return StoreUncompiledDataWithPreparseDataPreparseData_804(state_, p_o, p_v);
+}
+TNode<JSReceiver> TorqueGeneratedExportedMacrosAssembler::LoadJSBoundFunctionBoundTargetFunction(TNode<JSBoundFunction> p_o){
+return LoadJSBoundFunctionBoundTargetFunction_805(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSBoundFunctionBoundTargetFunction(TNode<JSBoundFunction> p_o, TNode<JSReceiver> p_v){
+return StoreJSBoundFunctionBoundTargetFunction_806(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSBoundFunctionBoundThis(TNode<JSBoundFunction> p_o){
+return LoadJSBoundFunctionBoundThis_807(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSBoundFunctionBoundThis(TNode<JSBoundFunction> p_o, TNode<Object> p_v){
+return StoreJSBoundFunctionBoundThis_808(state_, p_o, p_v);
+}
+TNode<FixedArray> TorqueGeneratedExportedMacrosAssembler::LoadJSBoundFunctionBoundArguments(TNode<JSBoundFunction> p_o){
+return LoadJSBoundFunctionBoundArguments_809(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSBoundFunctionBoundArguments(TNode<JSBoundFunction> p_o, TNode<FixedArray> p_v){
+return StoreJSBoundFunctionBoundArguments_810(state_, p_o, p_v);
+}
+TNode<RawPtrT> TorqueGeneratedExportedMacrosAssembler::LoadForeignForeignAddress(TNode<Foreign> p_o){
+return LoadForeignForeignAddress_811(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreForeignForeignAddress(TNode<Foreign> p_o, TNode<RawPtrT> p_v){
+return StoreForeignForeignAddress_812(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadFreeSpaceSize(TNode<FreeSpace> p_o){
+return LoadFreeSpaceSize_813(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFreeSpaceSize(TNode<FreeSpace> p_o, TNode<Smi> p_v){
+return StoreFreeSpaceSize_814(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadFreeSpaceNext(TNode<FreeSpace> p_o){
+return LoadFreeSpaceNext_815(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFreeSpaceNext(TNode<FreeSpace> p_o, TNode<Object> p_v){
+return StoreFreeSpaceNext_816(state_, p_o, p_v);
+}
+TNode<UintPtrT> TorqueGeneratedExportedMacrosAssembler::LoadJSArrayBufferByteLength(TNode<JSArrayBuffer> p_o){
+return LoadJSArrayBufferByteLength_817(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSArrayBufferByteLength(TNode<JSArrayBuffer> p_o, TNode<UintPtrT> p_v){
+return StoreJSArrayBufferByteLength_818(state_, p_o, p_v);
+}
+TNode<RawPtrT> TorqueGeneratedExportedMacrosAssembler::LoadJSArrayBufferBackingStore(TNode<JSArrayBuffer> p_o){
+return LoadJSArrayBufferBackingStore_819(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSArrayBufferBackingStore(TNode<JSArrayBuffer> p_o, TNode<RawPtrT> p_v){
+return StoreJSArrayBufferBackingStore_820(state_, p_o, p_v);
+}
+TNode<JSArrayBuffer> TorqueGeneratedExportedMacrosAssembler::LoadJSArrayBufferViewBuffer(TNode<JSArrayBufferView> p_o){
+return LoadJSArrayBufferViewBuffer_821(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSArrayBufferViewBuffer(TNode<JSArrayBufferView> p_o, TNode<JSArrayBuffer> p_v){
+return StoreJSArrayBufferViewBuffer_822(state_, p_o, p_v);
+}
+TNode<UintPtrT> TorqueGeneratedExportedMacrosAssembler::LoadJSArrayBufferViewByteOffset(TNode<JSArrayBufferView> p_o){
+return LoadJSArrayBufferViewByteOffset_823(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSArrayBufferViewByteOffset(TNode<JSArrayBufferView> p_o, TNode<UintPtrT> p_v){
+return StoreJSArrayBufferViewByteOffset_824(state_, p_o, p_v);
+}
+TNode<UintPtrT> TorqueGeneratedExportedMacrosAssembler::LoadJSArrayBufferViewByteLength(TNode<JSArrayBufferView> p_o){
+return LoadJSArrayBufferViewByteLength_825(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSArrayBufferViewByteLength(TNode<JSArrayBufferView> p_o, TNode<UintPtrT> p_v){
+return StoreJSArrayBufferViewByteLength_826(state_, p_o, p_v);
+}
+TNode<UintPtrT> TorqueGeneratedExportedMacrosAssembler::LoadJSTypedArrayLength(TNode<JSTypedArray> p_o){
+return LoadJSTypedArrayLength_827(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSTypedArrayLength(TNode<JSTypedArray> p_o, TNode<UintPtrT> p_v){
+return StoreJSTypedArrayLength_828(state_, p_o, p_v);
+}
+TNode<RawPtrT> TorqueGeneratedExportedMacrosAssembler::LoadJSTypedArrayExternalPointer(TNode<JSTypedArray> p_o){
+return LoadJSTypedArrayExternalPointer_829(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSTypedArrayExternalPointer(TNode<JSTypedArray> p_o, TNode<RawPtrT> p_v){
+return StoreJSTypedArrayExternalPointer_830(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSTypedArrayBasePointer(TNode<JSTypedArray> p_o){
+return LoadJSTypedArrayBasePointer_831(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSTypedArrayBasePointer(TNode<JSTypedArray> p_o, TNode<Object> p_v){
+return StoreJSTypedArrayBasePointer_832(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSCollectionTable(TNode<JSCollection> p_o){
+return LoadJSCollectionTable_833(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSCollectionTable(TNode<JSCollection> p_o, TNode<Object> p_v){
+return StoreJSCollectionTable_834(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSDateValue(TNode<JSDate> p_o){
+return LoadJSDateValue_835(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSDateValue(TNode<JSDate> p_o, TNode<Object> p_v){
+return StoreJSDateValue_836(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSDateYear(TNode<JSDate> p_o){
+return LoadJSDateYear_837(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSDateYear(TNode<JSDate> p_o, TNode<Object> p_v){
+return StoreJSDateYear_838(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSDateMonth(TNode<JSDate> p_o){
+return LoadJSDateMonth_839(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSDateMonth(TNode<JSDate> p_o, TNode<Object> p_v){
+return StoreJSDateMonth_840(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSDateDay(TNode<JSDate> p_o){
+return LoadJSDateDay_841(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSDateDay(TNode<JSDate> p_o, TNode<Object> p_v){
+return StoreJSDateDay_842(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSDateWeekday(TNode<JSDate> p_o){
+return LoadJSDateWeekday_843(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSDateWeekday(TNode<JSDate> p_o, TNode<Object> p_v){
+return StoreJSDateWeekday_844(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSDateHour(TNode<JSDate> p_o){
+return LoadJSDateHour_845(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSDateHour(TNode<JSDate> p_o, TNode<Object> p_v){
+return StoreJSDateHour_846(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSDateMin(TNode<JSDate> p_o){
+return LoadJSDateMin_847(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSDateMin(TNode<JSDate> p_o, TNode<Object> p_v){
+return StoreJSDateMin_848(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSDateSec(TNode<JSDate> p_o){
+return LoadJSDateSec_849(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSDateSec(TNode<JSDate> p_o, TNode<Object> p_v){
+return StoreJSDateSec_850(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSDateCacheStamp(TNode<JSDate> p_o){
+return LoadJSDateCacheStamp_851(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSDateCacheStamp(TNode<JSDate> p_o, TNode<Object> p_v){
+return StoreJSDateCacheStamp_852(state_, p_o, p_v);
+}
+TNode<NativeContext> TorqueGeneratedExportedMacrosAssembler::LoadJSGlobalObjectNativeContext(TNode<JSGlobalObject> p_o){
+return LoadJSGlobalObjectNativeContext_853(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSGlobalObjectNativeContext(TNode<JSGlobalObject> p_o, TNode<NativeContext> p_v){
+return StoreJSGlobalObjectNativeContext_854(state_, p_o, p_v);
+}
+TNode<JSGlobalProxy> TorqueGeneratedExportedMacrosAssembler::LoadJSGlobalObjectGlobalProxy(TNode<JSGlobalObject> p_o){
+return LoadJSGlobalObjectGlobalProxy_855(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSGlobalObjectGlobalProxy(TNode<JSGlobalObject> p_o, TNode<JSGlobalProxy> p_v){
+return StoreJSGlobalObjectGlobalProxy_856(state_, p_o, p_v);
+}
+TNode<JSReceiver> TorqueGeneratedExportedMacrosAssembler::LoadJSAsyncFromSyncIteratorSyncIterator(TNode<JSAsyncFromSyncIterator> p_o){
+return LoadJSAsyncFromSyncIteratorSyncIterator_857(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSAsyncFromSyncIteratorSyncIterator(TNode<JSAsyncFromSyncIterator> p_o, TNode<JSReceiver> p_v){
+return StoreJSAsyncFromSyncIteratorSyncIterator_858(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSAsyncFromSyncIteratorNext(TNode<JSAsyncFromSyncIterator> p_o){
+return LoadJSAsyncFromSyncIteratorNext_859(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSAsyncFromSyncIteratorNext(TNode<JSAsyncFromSyncIterator> p_o, TNode<Object> p_v){
+return StoreJSAsyncFromSyncIteratorNext_860(state_, p_o, p_v);
+}
+TNode<String> TorqueGeneratedExportedMacrosAssembler::LoadJSStringIteratorString(TNode<JSStringIterator> p_o){
+return LoadJSStringIteratorString_861(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSStringIteratorString(TNode<JSStringIterator> p_o, TNode<String> p_v){
+return StoreJSStringIteratorString_862(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadJSStringIteratorIndex(TNode<JSStringIterator> p_o){
+return LoadJSStringIteratorIndex_863(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSStringIteratorIndex(TNode<JSStringIterator> p_o, TNode<Smi> p_v){
+return StoreJSStringIteratorIndex_864(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadTemplateInfoTag(TNode<TemplateInfo> p_o){
+return LoadTemplateInfoTag_865(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreTemplateInfoTag(TNode<TemplateInfo> p_o, TNode<Object> p_v){
+return StoreTemplateInfoTag_866(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadTemplateInfoSerialNumber(TNode<TemplateInfo> p_o){
+return LoadTemplateInfoSerialNumber_867(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreTemplateInfoSerialNumber(TNode<TemplateInfo> p_o, TNode<Object> p_v){
+return StoreTemplateInfoSerialNumber_868(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadTemplateInfoNumberOfProperties(TNode<TemplateInfo> p_o){
+return LoadTemplateInfoNumberOfProperties_869(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreTemplateInfoNumberOfProperties(TNode<TemplateInfo> p_o, TNode<Smi> p_v){
+return StoreTemplateInfoNumberOfProperties_870(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadTemplateInfoPropertyList(TNode<TemplateInfo> p_o){
+return LoadTemplateInfoPropertyList_871(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreTemplateInfoPropertyList(TNode<TemplateInfo> p_o, TNode<Object> p_v){
+return StoreTemplateInfoPropertyList_872(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadTemplateInfoPropertyAccessors(TNode<TemplateInfo> p_o){
+return LoadTemplateInfoPropertyAccessors_873(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreTemplateInfoPropertyAccessors(TNode<TemplateInfo> p_o, TNode<Object> p_v){
+return StoreTemplateInfoPropertyAccessors_874(state_, p_o, p_v);
+}
+TNode<FixedArray> TorqueGeneratedExportedMacrosAssembler::LoadTemplateObjectDescriptionRawStrings(TNode<TemplateObjectDescription> p_o){
+return LoadTemplateObjectDescriptionRawStrings_875(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreTemplateObjectDescriptionRawStrings(TNode<TemplateObjectDescription> p_o, TNode<FixedArray> p_v){
+return StoreTemplateObjectDescriptionRawStrings_876(state_, p_o, p_v);
+}
+TNode<FixedArray> TorqueGeneratedExportedMacrosAssembler::LoadTemplateObjectDescriptionCookedStrings(TNode<TemplateObjectDescription> p_o){
+return LoadTemplateObjectDescriptionCookedStrings_877(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreTemplateObjectDescriptionCookedStrings(TNode<TemplateObjectDescription> p_o, TNode<FixedArray> p_v){
+return StoreTemplateObjectDescriptionCookedStrings_878(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadFunctionTemplateRareDataPrototypeTemplate(TNode<FunctionTemplateRareData> p_o){
+return LoadFunctionTemplateRareDataPrototypeTemplate_879(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFunctionTemplateRareDataPrototypeTemplate(TNode<FunctionTemplateRareData> p_o, TNode<Object> p_v){
+return StoreFunctionTemplateRareDataPrototypeTemplate_880(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadFunctionTemplateRareDataPrototypeProviderTemplate(TNode<FunctionTemplateRareData> p_o){
+return LoadFunctionTemplateRareDataPrototypeProviderTemplate_881(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFunctionTemplateRareDataPrototypeProviderTemplate(TNode<FunctionTemplateRareData> p_o, TNode<Object> p_v){
+return StoreFunctionTemplateRareDataPrototypeProviderTemplate_882(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadFunctionTemplateRareDataParentTemplate(TNode<FunctionTemplateRareData> p_o){
+return LoadFunctionTemplateRareDataParentTemplate_883(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFunctionTemplateRareDataParentTemplate(TNode<FunctionTemplateRareData> p_o, TNode<Object> p_v){
+return StoreFunctionTemplateRareDataParentTemplate_884(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadFunctionTemplateRareDataNamedPropertyHandler(TNode<FunctionTemplateRareData> p_o){
+return LoadFunctionTemplateRareDataNamedPropertyHandler_885(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFunctionTemplateRareDataNamedPropertyHandler(TNode<FunctionTemplateRareData> p_o, TNode<Object> p_v){
+return StoreFunctionTemplateRareDataNamedPropertyHandler_886(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadFunctionTemplateRareDataIndexedPropertyHandler(TNode<FunctionTemplateRareData> p_o){
+return LoadFunctionTemplateRareDataIndexedPropertyHandler_887(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFunctionTemplateRareDataIndexedPropertyHandler(TNode<FunctionTemplateRareData> p_o, TNode<Object> p_v){
+return StoreFunctionTemplateRareDataIndexedPropertyHandler_888(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadFunctionTemplateRareDataInstanceTemplate(TNode<FunctionTemplateRareData> p_o){
+return LoadFunctionTemplateRareDataInstanceTemplate_889(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFunctionTemplateRareDataInstanceTemplate(TNode<FunctionTemplateRareData> p_o, TNode<Object> p_v){
+return StoreFunctionTemplateRareDataInstanceTemplate_890(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadFunctionTemplateRareDataInstanceCallHandler(TNode<FunctionTemplateRareData> p_o){
+return LoadFunctionTemplateRareDataInstanceCallHandler_891(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFunctionTemplateRareDataInstanceCallHandler(TNode<FunctionTemplateRareData> p_o, TNode<Object> p_v){
+return StoreFunctionTemplateRareDataInstanceCallHandler_892(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadFunctionTemplateRareDataAccessCheckInfo(TNode<FunctionTemplateRareData> p_o){
+return LoadFunctionTemplateRareDataAccessCheckInfo_893(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFunctionTemplateRareDataAccessCheckInfo(TNode<FunctionTemplateRareData> p_o, TNode<Object> p_v){
+return StoreFunctionTemplateRareDataAccessCheckInfo_894(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadFunctionTemplateInfoCallCode(TNode<FunctionTemplateInfo> p_o){
+return LoadFunctionTemplateInfoCallCode_895(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFunctionTemplateInfoCallCode(TNode<FunctionTemplateInfo> p_o, TNode<Object> p_v){
+return StoreFunctionTemplateInfoCallCode_896(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadFunctionTemplateInfoClassName(TNode<FunctionTemplateInfo> p_o){
+return LoadFunctionTemplateInfoClassName_897(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFunctionTemplateInfoClassName(TNode<FunctionTemplateInfo> p_o, TNode<Object> p_v){
+return StoreFunctionTemplateInfoClassName_898(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadFunctionTemplateInfoSignature(TNode<FunctionTemplateInfo> p_o){
+return LoadFunctionTemplateInfoSignature_899(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFunctionTemplateInfoSignature(TNode<FunctionTemplateInfo> p_o, TNode<Object> p_v){
+return StoreFunctionTemplateInfoSignature_900(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadFunctionTemplateInfoRareData(TNode<FunctionTemplateInfo> p_o){
+return LoadFunctionTemplateInfoRareData_901(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFunctionTemplateInfoRareData(TNode<FunctionTemplateInfo> p_o, TNode<HeapObject> p_v){
+return StoreFunctionTemplateInfoRareData_902(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadFunctionTemplateInfoSharedFunctionInfo(TNode<FunctionTemplateInfo> p_o){
+return LoadFunctionTemplateInfoSharedFunctionInfo_903(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFunctionTemplateInfoSharedFunctionInfo(TNode<FunctionTemplateInfo> p_o, TNode<Object> p_v){
+return StoreFunctionTemplateInfoSharedFunctionInfo_904(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadFunctionTemplateInfoFlag(TNode<FunctionTemplateInfo> p_o){
+return LoadFunctionTemplateInfoFlag_905(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFunctionTemplateInfoFlag(TNode<FunctionTemplateInfo> p_o, TNode<Smi> p_v){
+return StoreFunctionTemplateInfoFlag_906(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadFunctionTemplateInfoLength(TNode<FunctionTemplateInfo> p_o){
+return LoadFunctionTemplateInfoLength_907(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFunctionTemplateInfoLength(TNode<FunctionTemplateInfo> p_o, TNode<Smi> p_v){
+return StoreFunctionTemplateInfoLength_908(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadFunctionTemplateInfoCachedPropertyName(TNode<FunctionTemplateInfo> p_o){
+return LoadFunctionTemplateInfoCachedPropertyName_909(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFunctionTemplateInfoCachedPropertyName(TNode<FunctionTemplateInfo> p_o, TNode<Object> p_v){
+return StoreFunctionTemplateInfoCachedPropertyName_910(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadObjectTemplateInfoConstructor(TNode<ObjectTemplateInfo> p_o){
+return LoadObjectTemplateInfoConstructor_911(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreObjectTemplateInfoConstructor(TNode<ObjectTemplateInfo> p_o, TNode<Object> p_v){
+return StoreObjectTemplateInfoConstructor_912(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadObjectTemplateInfoData(TNode<ObjectTemplateInfo> p_o){
+return LoadObjectTemplateInfoData_913(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreObjectTemplateInfoData(TNode<ObjectTemplateInfo> p_o, TNode<Object> p_v){
+return StoreObjectTemplateInfoData_914(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadPropertyArrayLengthAndHash(TNode<PropertyArray> p_o){
+return LoadPropertyArrayLengthAndHash_915(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePropertyArrayLengthAndHash(TNode<PropertyArray> p_o, TNode<Smi> p_v){
+return StorePropertyArrayLengthAndHash_916(state_, p_o, p_v);
+}
+TNode<Name> TorqueGeneratedExportedMacrosAssembler::LoadPropertyCellName(TNode<PropertyCell> p_o){
+return LoadPropertyCellName_917(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePropertyCellName(TNode<PropertyCell> p_o, TNode<Name> p_v){
+return StorePropertyCellName_918(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadPropertyCellPropertyDetailsRaw(TNode<PropertyCell> p_o){
+return LoadPropertyCellPropertyDetailsRaw_919(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePropertyCellPropertyDetailsRaw(TNode<PropertyCell> p_o, TNode<Smi> p_v){
+return StorePropertyCellPropertyDetailsRaw_920(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadPropertyCellValue(TNode<PropertyCell> p_o){
+return LoadPropertyCellValue_921(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePropertyCellValue(TNode<PropertyCell> p_o, TNode<Object> p_v){
+return StorePropertyCellValue_922(state_, p_o, p_v);
+}
+TNode<WeakFixedArray> TorqueGeneratedExportedMacrosAssembler::LoadPropertyCellDependentCode(TNode<PropertyCell> p_o){
+return LoadPropertyCellDependentCode_923(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePropertyCellDependentCode(TNode<PropertyCell> p_o, TNode<WeakFixedArray> p_v){
+return StorePropertyCellDependentCode_924(state_, p_o, p_v);
+}
+TNode<RawPtrT> TorqueGeneratedExportedMacrosAssembler::LoadJSDataViewDataPointer(TNode<JSDataView> p_o){
+return LoadJSDataViewDataPointer_925(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSDataViewDataPointer(TNode<JSDataView> p_o, TNode<RawPtrT> p_v){
+return StoreJSDataViewDataPointer_926(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadInterceptorInfoGetter(TNode<InterceptorInfo> p_o){
+return LoadInterceptorInfoGetter_927(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreInterceptorInfoGetter(TNode<InterceptorInfo> p_o, TNode<Object> p_v){
+return StoreInterceptorInfoGetter_928(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadInterceptorInfoSetter(TNode<InterceptorInfo> p_o){
+return LoadInterceptorInfoSetter_929(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreInterceptorInfoSetter(TNode<InterceptorInfo> p_o, TNode<Object> p_v){
+return StoreInterceptorInfoSetter_930(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadInterceptorInfoQuery(TNode<InterceptorInfo> p_o){
+return LoadInterceptorInfoQuery_931(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreInterceptorInfoQuery(TNode<InterceptorInfo> p_o, TNode<Object> p_v){
+return StoreInterceptorInfoQuery_932(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadInterceptorInfoDescriptor(TNode<InterceptorInfo> p_o){
+return LoadInterceptorInfoDescriptor_933(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreInterceptorInfoDescriptor(TNode<InterceptorInfo> p_o, TNode<Object> p_v){
+return StoreInterceptorInfoDescriptor_934(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadInterceptorInfoDeleter(TNode<InterceptorInfo> p_o){
+return LoadInterceptorInfoDeleter_935(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreInterceptorInfoDeleter(TNode<InterceptorInfo> p_o, TNode<Object> p_v){
+return StoreInterceptorInfoDeleter_936(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadInterceptorInfoEnumerator(TNode<InterceptorInfo> p_o){
+return LoadInterceptorInfoEnumerator_937(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreInterceptorInfoEnumerator(TNode<InterceptorInfo> p_o, TNode<Object> p_v){
+return StoreInterceptorInfoEnumerator_938(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadInterceptorInfoDefiner(TNode<InterceptorInfo> p_o){
+return LoadInterceptorInfoDefiner_939(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreInterceptorInfoDefiner(TNode<InterceptorInfo> p_o, TNode<Object> p_v){
+return StoreInterceptorInfoDefiner_940(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadInterceptorInfoData(TNode<InterceptorInfo> p_o){
+return LoadInterceptorInfoData_941(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreInterceptorInfoData(TNode<InterceptorInfo> p_o, TNode<Object> p_v){
+return StoreInterceptorInfoData_942(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadInterceptorInfoFlags(TNode<InterceptorInfo> p_o){
+return LoadInterceptorInfoFlags_943(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreInterceptorInfoFlags(TNode<InterceptorInfo> p_o, TNode<Smi> p_v){
+return StoreInterceptorInfoFlags_944(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadAccessCheckInfoCallback(TNode<AccessCheckInfo> p_o){
+return LoadAccessCheckInfoCallback_945(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreAccessCheckInfoCallback(TNode<AccessCheckInfo> p_o, TNode<Object> p_v){
+return StoreAccessCheckInfoCallback_946(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadAccessCheckInfoNamedInterceptor(TNode<AccessCheckInfo> p_o){
+return LoadAccessCheckInfoNamedInterceptor_947(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreAccessCheckInfoNamedInterceptor(TNode<AccessCheckInfo> p_o, TNode<Object> p_v){
+return StoreAccessCheckInfoNamedInterceptor_948(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadAccessCheckInfoIndexedInterceptor(TNode<AccessCheckInfo> p_o){
+return LoadAccessCheckInfoIndexedInterceptor_949(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreAccessCheckInfoIndexedInterceptor(TNode<AccessCheckInfo> p_o, TNode<Object> p_v){
+return StoreAccessCheckInfoIndexedInterceptor_950(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadAccessCheckInfoData(TNode<AccessCheckInfo> p_o){
+return LoadAccessCheckInfoData_951(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreAccessCheckInfoData(TNode<AccessCheckInfo> p_o, TNode<Object> p_v){
+return StoreAccessCheckInfoData_952(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadArrayBoilerplateDescriptionFlags(TNode<ArrayBoilerplateDescription> p_o){
+return LoadArrayBoilerplateDescriptionFlags_953(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreArrayBoilerplateDescriptionFlags(TNode<ArrayBoilerplateDescription> p_o, TNode<Smi> p_v){
+return StoreArrayBoilerplateDescriptionFlags_954(state_, p_o, p_v);
+}
+TNode<FixedArrayBase> TorqueGeneratedExportedMacrosAssembler::LoadArrayBoilerplateDescriptionConstantElements(TNode<ArrayBoilerplateDescription> p_o){
+return LoadArrayBoilerplateDescriptionConstantElements_955(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreArrayBoilerplateDescriptionConstantElements(TNode<ArrayBoilerplateDescription> p_o, TNode<FixedArrayBase> p_v){
+return StoreArrayBoilerplateDescriptionConstantElements_956(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadAliasedArgumentsEntryAliasedContextSlot(TNode<AliasedArgumentsEntry> p_o){
+return LoadAliasedArgumentsEntryAliasedContextSlot_957(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreAliasedArgumentsEntryAliasedContextSlot(TNode<AliasedArgumentsEntry> p_o, TNode<Smi> p_v){
+return StoreAliasedArgumentsEntryAliasedContextSlot_958(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadCellValue(TNode<Cell> p_o){
+return LoadCellValue_959(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreCellValue(TNode<Cell> p_o, TNode<Object> p_v){
+return StoreCellValue_960(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadDataHandlerSmiHandler(TNode<DataHandler> p_o){
+return LoadDataHandlerSmiHandler_961(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreDataHandlerSmiHandler(TNode<DataHandler> p_o, TNode<Object> p_v){
+return StoreDataHandlerSmiHandler_962(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadDataHandlerValidityCell(TNode<DataHandler> p_o){
+return LoadDataHandlerValidityCell_963(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreDataHandlerValidityCell(TNode<DataHandler> p_o, TNode<Object> p_v){
+return StoreDataHandlerValidityCell_964(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadDataHandlerData1(TNode<DataHandler> p_o){
+return LoadDataHandlerData1_965(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreDataHandlerData1(TNode<DataHandler> p_o, TNode<Object> p_v){
+return StoreDataHandlerData1_966(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadDataHandlerData2(TNode<DataHandler> p_o){
+return LoadDataHandlerData2_967(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreDataHandlerData2(TNode<DataHandler> p_o, TNode<Object> p_v){
+return StoreDataHandlerData2_968(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadDataHandlerData3(TNode<DataHandler> p_o){
+return LoadDataHandlerData3_969(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreDataHandlerData3(TNode<DataHandler> p_o, TNode<Object> p_v){
+return StoreDataHandlerData3_970(state_, p_o, p_v);
+}
+TNode<JSFunction> TorqueGeneratedExportedMacrosAssembler::LoadJSGeneratorObjectFunction(TNode<JSGeneratorObject> p_o){
+return LoadJSGeneratorObjectFunction_971(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSGeneratorObjectFunction(TNode<JSGeneratorObject> p_o, TNode<JSFunction> p_v){
+return StoreJSGeneratorObjectFunction_972(state_, p_o, p_v);
+}
+TNode<Context> TorqueGeneratedExportedMacrosAssembler::LoadJSGeneratorObjectContext(TNode<JSGeneratorObject> p_o){
+return LoadJSGeneratorObjectContext_973(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSGeneratorObjectContext(TNode<JSGeneratorObject> p_o, TNode<Context> p_v){
+return StoreJSGeneratorObjectContext_974(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSGeneratorObjectReceiver(TNode<JSGeneratorObject> p_o){
+return LoadJSGeneratorObjectReceiver_975(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSGeneratorObjectReceiver(TNode<JSGeneratorObject> p_o, TNode<Object> p_v){
+return StoreJSGeneratorObjectReceiver_976(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSGeneratorObjectInputOrDebugPos(TNode<JSGeneratorObject> p_o){
+return LoadJSGeneratorObjectInputOrDebugPos_977(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSGeneratorObjectInputOrDebugPos(TNode<JSGeneratorObject> p_o, TNode<Object> p_v){
+return StoreJSGeneratorObjectInputOrDebugPos_978(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadJSGeneratorObjectResumeMode(TNode<JSGeneratorObject> p_o){
+return LoadJSGeneratorObjectResumeMode_979(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSGeneratorObjectResumeMode(TNode<JSGeneratorObject> p_o, TNode<Smi> p_v){
+return StoreJSGeneratorObjectResumeMode_980(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadJSGeneratorObjectContinuation(TNode<JSGeneratorObject> p_o){
+return LoadJSGeneratorObjectContinuation_981(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSGeneratorObjectContinuation(TNode<JSGeneratorObject> p_o, TNode<Smi> p_v){
+return StoreJSGeneratorObjectContinuation_982(state_, p_o, p_v);
+}
+TNode<FixedArray> TorqueGeneratedExportedMacrosAssembler::LoadJSGeneratorObjectParametersAndRegisters(TNode<JSGeneratorObject> p_o){
+return LoadJSGeneratorObjectParametersAndRegisters_983(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSGeneratorObjectParametersAndRegisters(TNode<JSGeneratorObject> p_o, TNode<FixedArray> p_v){
+return StoreJSGeneratorObjectParametersAndRegisters_984(state_, p_o, p_v);
+}
+TNode<JSPromise> TorqueGeneratedExportedMacrosAssembler::LoadJSAsyncFunctionObjectPromise(TNode<JSAsyncFunctionObject> p_o){
+return LoadJSAsyncFunctionObjectPromise_985(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSAsyncFunctionObjectPromise(TNode<JSAsyncFunctionObject> p_o, TNode<JSPromise> p_v){
+return StoreJSAsyncFunctionObjectPromise_986(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadJSAsyncGeneratorObjectQueue(TNode<JSAsyncGeneratorObject> p_o){
+return LoadJSAsyncGeneratorObjectQueue_987(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSAsyncGeneratorObjectQueue(TNode<JSAsyncGeneratorObject> p_o, TNode<HeapObject> p_v){
+return StoreJSAsyncGeneratorObjectQueue_988(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadJSAsyncGeneratorObjectIsAwaiting(TNode<JSAsyncGeneratorObject> p_o){
+return LoadJSAsyncGeneratorObjectIsAwaiting_989(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSAsyncGeneratorObjectIsAwaiting(TNode<JSAsyncGeneratorObject> p_o, TNode<Smi> p_v){
+return StoreJSAsyncGeneratorObjectIsAwaiting_990(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSPromiseReactionsOrResult(TNode<JSPromise> p_o){
+return LoadJSPromiseReactionsOrResult_991(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSPromiseReactionsOrResult(TNode<JSPromise> p_o, TNode<Object> p_v){
+return StoreJSPromiseReactionsOrResult_992(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadJSPromiseFlags(TNode<JSPromise> p_o){
+return LoadJSPromiseFlags_993(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSPromiseFlags(TNode<JSPromise> p_o, TNode<Smi> p_v){
+return StoreJSPromiseFlags_994(state_, p_o, p_v);
+}
+TNode<Foreign> TorqueGeneratedExportedMacrosAssembler::LoadCallbackTaskCallback(TNode<CallbackTask> p_o){
+return LoadCallbackTaskCallback_995(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreCallbackTaskCallback(TNode<CallbackTask> p_o, TNode<Foreign> p_v){
+return StoreCallbackTaskCallback_996(state_, p_o, p_v);
+}
+TNode<Foreign> TorqueGeneratedExportedMacrosAssembler::LoadCallbackTaskData(TNode<CallbackTask> p_o){
+return LoadCallbackTaskData_997(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreCallbackTaskData(TNode<CallbackTask> p_o, TNode<Foreign> p_v){
+return StoreCallbackTaskData_998(state_, p_o, p_v);
+}
+TNode<JSReceiver> TorqueGeneratedExportedMacrosAssembler::LoadCallableTaskCallable(TNode<CallableTask> p_o){
+return LoadCallableTaskCallable_999(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreCallableTaskCallable(TNode<CallableTask> p_o, TNode<JSReceiver> p_v){
+return StoreCallableTaskCallable_1000(state_, p_o, p_v);
+}
+TNode<Context> TorqueGeneratedExportedMacrosAssembler::LoadCallableTaskContext(TNode<CallableTask> p_o){
+return LoadCallableTaskContext_1001(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreCallableTaskContext(TNode<CallableTask> p_o, TNode<Context> p_v){
+return StoreCallableTaskContext_1002(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadStackFrameInfoLineNumber(TNode<StackFrameInfo> p_o){
+return LoadStackFrameInfoLineNumber_1003(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreStackFrameInfoLineNumber(TNode<StackFrameInfo> p_o, TNode<Smi> p_v){
+return StoreStackFrameInfoLineNumber_1004(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadStackFrameInfoColumnNumber(TNode<StackFrameInfo> p_o){
+return LoadStackFrameInfoColumnNumber_1005(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreStackFrameInfoColumnNumber(TNode<StackFrameInfo> p_o, TNode<Smi> p_v){
+return StoreStackFrameInfoColumnNumber_1006(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadStackFrameInfoPromiseAllIndex(TNode<StackFrameInfo> p_o){
+return LoadStackFrameInfoPromiseAllIndex_1007(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreStackFrameInfoPromiseAllIndex(TNode<StackFrameInfo> p_o, TNode<Smi> p_v){
+return StoreStackFrameInfoPromiseAllIndex_1008(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadStackFrameInfoScriptId(TNode<StackFrameInfo> p_o){
+return LoadStackFrameInfoScriptId_1009(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreStackFrameInfoScriptId(TNode<StackFrameInfo> p_o, TNode<Smi> p_v){
+return StoreStackFrameInfoScriptId_1010(state_, p_o, p_v);
+}
+TNode<PrimitiveHeapObject> TorqueGeneratedExportedMacrosAssembler::LoadStackFrameInfoScriptName(TNode<StackFrameInfo> p_o){
+return LoadStackFrameInfoScriptName_1011(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreStackFrameInfoScriptName(TNode<StackFrameInfo> p_o, TNode<PrimitiveHeapObject> p_v){
+return StoreStackFrameInfoScriptName_1012(state_, p_o, p_v);
+}
+TNode<PrimitiveHeapObject> TorqueGeneratedExportedMacrosAssembler::LoadStackFrameInfoScriptNameOrSourceUrl(TNode<StackFrameInfo> p_o){
+return LoadStackFrameInfoScriptNameOrSourceUrl_1013(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreStackFrameInfoScriptNameOrSourceUrl(TNode<StackFrameInfo> p_o, TNode<PrimitiveHeapObject> p_v){
+return StoreStackFrameInfoScriptNameOrSourceUrl_1014(state_, p_o, p_v);
+}
+TNode<PrimitiveHeapObject> TorqueGeneratedExportedMacrosAssembler::LoadStackFrameInfoFunctionName(TNode<StackFrameInfo> p_o){
+return LoadStackFrameInfoFunctionName_1015(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreStackFrameInfoFunctionName(TNode<StackFrameInfo> p_o, TNode<PrimitiveHeapObject> p_v){
+return StoreStackFrameInfoFunctionName_1016(state_, p_o, p_v);
+}
+TNode<PrimitiveHeapObject> TorqueGeneratedExportedMacrosAssembler::LoadStackFrameInfoMethodName(TNode<StackFrameInfo> p_o){
+return LoadStackFrameInfoMethodName_1017(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreStackFrameInfoMethodName(TNode<StackFrameInfo> p_o, TNode<PrimitiveHeapObject> p_v){
+return StoreStackFrameInfoMethodName_1018(state_, p_o, p_v);
+}
+TNode<PrimitiveHeapObject> TorqueGeneratedExportedMacrosAssembler::LoadStackFrameInfoTypeName(TNode<StackFrameInfo> p_o){
+return LoadStackFrameInfoTypeName_1019(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreStackFrameInfoTypeName(TNode<StackFrameInfo> p_o, TNode<PrimitiveHeapObject> p_v){
+return StoreStackFrameInfoTypeName_1020(state_, p_o, p_v);
+}
+TNode<PrimitiveHeapObject> TorqueGeneratedExportedMacrosAssembler::LoadStackFrameInfoEvalOrigin(TNode<StackFrameInfo> p_o){
+return LoadStackFrameInfoEvalOrigin_1021(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreStackFrameInfoEvalOrigin(TNode<StackFrameInfo> p_o, TNode<PrimitiveHeapObject> p_v){
+return StoreStackFrameInfoEvalOrigin_1022(state_, p_o, p_v);
+}
+TNode<PrimitiveHeapObject> TorqueGeneratedExportedMacrosAssembler::LoadStackFrameInfoWasmModuleName(TNode<StackFrameInfo> p_o){
+return LoadStackFrameInfoWasmModuleName_1023(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreStackFrameInfoWasmModuleName(TNode<StackFrameInfo> p_o, TNode<PrimitiveHeapObject> p_v){
+return StoreStackFrameInfoWasmModuleName_1024(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadStackFrameInfoWasmInstance(TNode<StackFrameInfo> p_o){
+return LoadStackFrameInfoWasmInstance_1025(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreStackFrameInfoWasmInstance(TNode<StackFrameInfo> p_o, TNode<HeapObject> p_v){
+return StoreStackFrameInfoWasmInstance_1026(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadStackFrameInfoFlag(TNode<StackFrameInfo> p_o){
+return LoadStackFrameInfoFlag_1027(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreStackFrameInfoFlag(TNode<StackFrameInfo> p_o, TNode<Smi> p_v){
+return StoreStackFrameInfoFlag_1028(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadStackTraceFrameFrameArray(TNode<StackTraceFrame> p_o){
+return LoadStackTraceFrameFrameArray_1029(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreStackTraceFrameFrameArray(TNode<StackTraceFrame> p_o, TNode<HeapObject> p_v){
+return StoreStackTraceFrameFrameArray_1030(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadStackTraceFrameFrameIndex(TNode<StackTraceFrame> p_o){
+return LoadStackTraceFrameFrameIndex_1031(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreStackTraceFrameFrameIndex(TNode<StackTraceFrame> p_o, TNode<Smi> p_v){
+return StoreStackTraceFrameFrameIndex_1032(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadStackTraceFrameFrameInfo(TNode<StackTraceFrame> p_o){
+return LoadStackTraceFrameFrameInfo_1033(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreStackTraceFrameFrameInfo(TNode<StackTraceFrame> p_o, TNode<HeapObject> p_v){
+return StoreStackTraceFrameFrameInfo_1034(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadStackTraceFrameId(TNode<StackTraceFrame> p_o){
+return LoadStackTraceFrameId_1035(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreStackTraceFrameId(TNode<StackTraceFrame> p_o, TNode<Smi> p_v){
+return StoreStackTraceFrameId_1036(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadClassPositionsStart(TNode<ClassPositions> p_o){
+return LoadClassPositionsStart_1037(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreClassPositionsStart(TNode<ClassPositions> p_o, TNode<Smi> p_v){
+return StoreClassPositionsStart_1038(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadClassPositionsEnd(TNode<ClassPositions> p_o){
+return LoadClassPositionsEnd_1039(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreClassPositionsEnd(TNode<ClassPositions> p_o, TNode<Smi> p_v){
+return StoreClassPositionsEnd_1040(state_, p_o, p_v);
+}
+TNode<Code> TorqueGeneratedExportedMacrosAssembler::LoadWasmExportedFunctionDataWrapperCode(TNode<WasmExportedFunctionData> p_o){
+return LoadWasmExportedFunctionDataWrapperCode_1041(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmExportedFunctionDataWrapperCode(TNode<WasmExportedFunctionData> p_o, TNode<Code> p_v){
+return StoreWasmExportedFunctionDataWrapperCode_1042(state_, p_o, p_v);
+}
+TNode<WasmInstanceObject> TorqueGeneratedExportedMacrosAssembler::LoadWasmExportedFunctionDataInstance(TNode<WasmExportedFunctionData> p_o){
+return LoadWasmExportedFunctionDataInstance_1043(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmExportedFunctionDataInstance(TNode<WasmExportedFunctionData> p_o, TNode<WasmInstanceObject> p_v){
+return StoreWasmExportedFunctionDataInstance_1044(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadWasmExportedFunctionDataJumpTableOffset(TNode<WasmExportedFunctionData> p_o){
+return LoadWasmExportedFunctionDataJumpTableOffset_1045(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmExportedFunctionDataJumpTableOffset(TNode<WasmExportedFunctionData> p_o, TNode<Smi> p_v){
+return StoreWasmExportedFunctionDataJumpTableOffset_1046(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadWasmExportedFunctionDataFunctionIndex(TNode<WasmExportedFunctionData> p_o){
+return LoadWasmExportedFunctionDataFunctionIndex_1047(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmExportedFunctionDataFunctionIndex(TNode<WasmExportedFunctionData> p_o, TNode<Smi> p_v){
+return StoreWasmExportedFunctionDataFunctionIndex_1048(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadWasmExportedFunctionDataCWrapperCode(TNode<WasmExportedFunctionData> p_o){
+return LoadWasmExportedFunctionDataCWrapperCode_1049(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmExportedFunctionDataCWrapperCode(TNode<WasmExportedFunctionData> p_o, TNode<Object> p_v){
+return StoreWasmExportedFunctionDataCWrapperCode_1050(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadWasmExportedFunctionDataWasmCallTarget(TNode<WasmExportedFunctionData> p_o){
+return LoadWasmExportedFunctionDataWasmCallTarget_1051(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmExportedFunctionDataWasmCallTarget(TNode<WasmExportedFunctionData> p_o, TNode<Object> p_v){
+return StoreWasmExportedFunctionDataWasmCallTarget_1052(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadWasmExportedFunctionDataPackedArgsSize(TNode<WasmExportedFunctionData> p_o){
+return LoadWasmExportedFunctionDataPackedArgsSize_1053(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmExportedFunctionDataPackedArgsSize(TNode<WasmExportedFunctionData> p_o, TNode<Smi> p_v){
+return StoreWasmExportedFunctionDataPackedArgsSize_1054(state_, p_o, p_v);
+}
+TNode<JSReceiver> TorqueGeneratedExportedMacrosAssembler::LoadWasmJSFunctionDataCallable(TNode<WasmJSFunctionData> p_o){
+return LoadWasmJSFunctionDataCallable_1055(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmJSFunctionDataCallable(TNode<WasmJSFunctionData> p_o, TNode<JSReceiver> p_v){
+return StoreWasmJSFunctionDataCallable_1056(state_, p_o, p_v);
+}
+TNode<Code> TorqueGeneratedExportedMacrosAssembler::LoadWasmJSFunctionDataWrapperCode(TNode<WasmJSFunctionData> p_o){
+return LoadWasmJSFunctionDataWrapperCode_1057(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmJSFunctionDataWrapperCode(TNode<WasmJSFunctionData> p_o, TNode<Code> p_v){
+return StoreWasmJSFunctionDataWrapperCode_1058(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadWasmJSFunctionDataSerializedReturnCount(TNode<WasmJSFunctionData> p_o){
+return LoadWasmJSFunctionDataSerializedReturnCount_1059(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmJSFunctionDataSerializedReturnCount(TNode<WasmJSFunctionData> p_o, TNode<Smi> p_v){
+return StoreWasmJSFunctionDataSerializedReturnCount_1060(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadWasmJSFunctionDataSerializedParameterCount(TNode<WasmJSFunctionData> p_o){
+return LoadWasmJSFunctionDataSerializedParameterCount_1061(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmJSFunctionDataSerializedParameterCount(TNode<WasmJSFunctionData> p_o, TNode<Smi> p_v){
+return StoreWasmJSFunctionDataSerializedParameterCount_1062(state_, p_o, p_v);
+}
+TNode<ByteArray> TorqueGeneratedExportedMacrosAssembler::LoadWasmJSFunctionDataSerializedSignature(TNode<WasmJSFunctionData> p_o){
+return LoadWasmJSFunctionDataSerializedSignature_1063(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmJSFunctionDataSerializedSignature(TNode<WasmJSFunctionData> p_o, TNode<ByteArray> p_v){
+return StoreWasmJSFunctionDataSerializedSignature_1064(state_, p_o, p_v);
+}
+TNode<RawPtrT> TorqueGeneratedExportedMacrosAssembler::LoadWasmCapiFunctionDataCallTarget(TNode<WasmCapiFunctionData> p_o){
+return LoadWasmCapiFunctionDataCallTarget_1065(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmCapiFunctionDataCallTarget(TNode<WasmCapiFunctionData> p_o, TNode<RawPtrT> p_v){
+return StoreWasmCapiFunctionDataCallTarget_1066(state_, p_o, p_v);
+}
+TNode<Foreign> TorqueGeneratedExportedMacrosAssembler::LoadWasmCapiFunctionDataEmbedderData(TNode<WasmCapiFunctionData> p_o){
+return LoadWasmCapiFunctionDataEmbedderData_1067(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmCapiFunctionDataEmbedderData(TNode<WasmCapiFunctionData> p_o, TNode<Foreign> p_v){
+return StoreWasmCapiFunctionDataEmbedderData_1068(state_, p_o, p_v);
+}
+TNode<Code> TorqueGeneratedExportedMacrosAssembler::LoadWasmCapiFunctionDataWrapperCode(TNode<WasmCapiFunctionData> p_o){
+return LoadWasmCapiFunctionDataWrapperCode_1069(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmCapiFunctionDataWrapperCode(TNode<WasmCapiFunctionData> p_o, TNode<Code> p_v){
+return StoreWasmCapiFunctionDataWrapperCode_1070(state_, p_o, p_v);
+}
+TNode<ByteArray> TorqueGeneratedExportedMacrosAssembler::LoadWasmCapiFunctionDataSerializedSignature(TNode<WasmCapiFunctionData> p_o){
+return LoadWasmCapiFunctionDataSerializedSignature_1071(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmCapiFunctionDataSerializedSignature(TNode<WasmCapiFunctionData> p_o, TNode<ByteArray> p_v){
+return StoreWasmCapiFunctionDataSerializedSignature_1072(state_, p_o, p_v);
+}
+TNode<Uint32T> TorqueGeneratedExportedMacrosAssembler::LoadWasmIndirectFunctionTableSize(TNode<WasmIndirectFunctionTable> p_o){
+return LoadWasmIndirectFunctionTableSize_1073(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmIndirectFunctionTableSize(TNode<WasmIndirectFunctionTable> p_o, TNode<Uint32T> p_v){
+return StoreWasmIndirectFunctionTableSize_1074(state_, p_o, p_v);
+}
+TNode<Uint32T> TorqueGeneratedExportedMacrosAssembler::LoadWasmIndirectFunctionTableOptionalPadding(TNode<WasmIndirectFunctionTable> p_o){
+return LoadWasmIndirectFunctionTableOptionalPadding_1075(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmIndirectFunctionTableOptionalPadding(TNode<WasmIndirectFunctionTable> p_o, TNode<Uint32T> p_v){
+return StoreWasmIndirectFunctionTableOptionalPadding_1076(state_, p_o, p_v);
+}
+TNode<RawPtrT> TorqueGeneratedExportedMacrosAssembler::LoadWasmIndirectFunctionTableSigIds(TNode<WasmIndirectFunctionTable> p_o){
+return LoadWasmIndirectFunctionTableSigIds_1077(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmIndirectFunctionTableSigIds(TNode<WasmIndirectFunctionTable> p_o, TNode<RawPtrT> p_v){
+return StoreWasmIndirectFunctionTableSigIds_1078(state_, p_o, p_v);
+}
+TNode<RawPtrT> TorqueGeneratedExportedMacrosAssembler::LoadWasmIndirectFunctionTableTargets(TNode<WasmIndirectFunctionTable> p_o){
+return LoadWasmIndirectFunctionTableTargets_1079(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmIndirectFunctionTableTargets(TNode<WasmIndirectFunctionTable> p_o, TNode<RawPtrT> p_v){
+return StoreWasmIndirectFunctionTableTargets_1080(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadWasmIndirectFunctionTableManagedNativeAllocations(TNode<WasmIndirectFunctionTable> p_o){
+return LoadWasmIndirectFunctionTableManagedNativeAllocations_1081(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmIndirectFunctionTableManagedNativeAllocations(TNode<WasmIndirectFunctionTable> p_o, TNode<HeapObject> p_v){
+return StoreWasmIndirectFunctionTableManagedNativeAllocations_1082(state_, p_o, p_v);
+}
+TNode<FixedArray> TorqueGeneratedExportedMacrosAssembler::LoadWasmIndirectFunctionTableRefs(TNode<WasmIndirectFunctionTable> p_o){
+return LoadWasmIndirectFunctionTableRefs_1083(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmIndirectFunctionTableRefs(TNode<WasmIndirectFunctionTable> p_o, TNode<FixedArray> p_v){
+return StoreWasmIndirectFunctionTableRefs_1084(state_, p_o, p_v);
+}
+TNode<WasmInstanceObject> TorqueGeneratedExportedMacrosAssembler::LoadWasmDebugInfoInstance(TNode<WasmDebugInfo> p_o){
+return LoadWasmDebugInfoInstance_1085(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmDebugInfoInstance(TNode<WasmDebugInfo> p_o, TNode<WasmInstanceObject> p_v){
+return StoreWasmDebugInfoInstance_1086(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadWasmDebugInfoInterpreterHandle(TNode<WasmDebugInfo> p_o){
+return LoadWasmDebugInfoInterpreterHandle_1087(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmDebugInfoInterpreterHandle(TNode<WasmDebugInfo> p_o, TNode<HeapObject> p_v){
+return StoreWasmDebugInfoInterpreterHandle_1088(state_, p_o, p_v);
+}
+TNode<Cell> TorqueGeneratedExportedMacrosAssembler::LoadWasmDebugInfoInterpreterReferenceStack(TNode<WasmDebugInfo> p_o){
+return LoadWasmDebugInfoInterpreterReferenceStack_1089(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmDebugInfoInterpreterReferenceStack(TNode<WasmDebugInfo> p_o, TNode<Cell> p_v){
+return StoreWasmDebugInfoInterpreterReferenceStack_1090(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadWasmDebugInfoLocalsNames(TNode<WasmDebugInfo> p_o){
+return LoadWasmDebugInfoLocalsNames_1091(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmDebugInfoLocalsNames(TNode<WasmDebugInfo> p_o, TNode<HeapObject> p_v){
+return StoreWasmDebugInfoLocalsNames_1092(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadWasmDebugInfoCWasmEntries(TNode<WasmDebugInfo> p_o){
+return LoadWasmDebugInfoCWasmEntries_1093(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmDebugInfoCWasmEntries(TNode<WasmDebugInfo> p_o, TNode<HeapObject> p_v){
+return StoreWasmDebugInfoCWasmEntries_1094(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadWasmDebugInfoCWasmEntryMap(TNode<WasmDebugInfo> p_o){
+return LoadWasmDebugInfoCWasmEntryMap_1095(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmDebugInfoCWasmEntryMap(TNode<WasmDebugInfo> p_o, TNode<HeapObject> p_v){
+return StoreWasmDebugInfoCWasmEntryMap_1096(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadWasmExceptionTagIndex(TNode<WasmExceptionTag> p_o){
+return LoadWasmExceptionTagIndex_1097(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmExceptionTagIndex(TNode<WasmExceptionTag> p_o, TNode<Smi> p_v){
+return StoreWasmExceptionTagIndex_1098(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadAsyncGeneratorRequestNext(TNode<AsyncGeneratorRequest> p_o){
+return LoadAsyncGeneratorRequestNext_1099(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreAsyncGeneratorRequestNext(TNode<AsyncGeneratorRequest> p_o, TNode<HeapObject> p_v){
+return StoreAsyncGeneratorRequestNext_1100(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadAsyncGeneratorRequestResumeMode(TNode<AsyncGeneratorRequest> p_o){
+return LoadAsyncGeneratorRequestResumeMode_1101(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreAsyncGeneratorRequestResumeMode(TNode<AsyncGeneratorRequest> p_o, TNode<Smi> p_v){
+return StoreAsyncGeneratorRequestResumeMode_1102(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadAsyncGeneratorRequestValue(TNode<AsyncGeneratorRequest> p_o){
+return LoadAsyncGeneratorRequestValue_1103(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreAsyncGeneratorRequestValue(TNode<AsyncGeneratorRequest> p_o, TNode<Object> p_v){
+return StoreAsyncGeneratorRequestValue_1104(state_, p_o, p_v);
+}
+TNode<JSPromise> TorqueGeneratedExportedMacrosAssembler::LoadAsyncGeneratorRequestPromise(TNode<AsyncGeneratorRequest> p_o){
+return LoadAsyncGeneratorRequestPromise_1105(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreAsyncGeneratorRequestPromise(TNode<AsyncGeneratorRequest> p_o, TNode<JSPromise> p_v){
+return StoreAsyncGeneratorRequestPromise_1106(state_, p_o, p_v);
+}
+TNode<PrimitiveHeapObject> TorqueGeneratedExportedMacrosAssembler::LoadSourceTextModuleInfoEntryExportName(TNode<SourceTextModuleInfoEntry> p_o){
+return LoadSourceTextModuleInfoEntryExportName_1107(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSourceTextModuleInfoEntryExportName(TNode<SourceTextModuleInfoEntry> p_o, TNode<PrimitiveHeapObject> p_v){
+return StoreSourceTextModuleInfoEntryExportName_1108(state_, p_o, p_v);
+}
+TNode<PrimitiveHeapObject> TorqueGeneratedExportedMacrosAssembler::LoadSourceTextModuleInfoEntryLocalName(TNode<SourceTextModuleInfoEntry> p_o){
+return LoadSourceTextModuleInfoEntryLocalName_1109(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSourceTextModuleInfoEntryLocalName(TNode<SourceTextModuleInfoEntry> p_o, TNode<PrimitiveHeapObject> p_v){
+return StoreSourceTextModuleInfoEntryLocalName_1110(state_, p_o, p_v);
+}
+TNode<PrimitiveHeapObject> TorqueGeneratedExportedMacrosAssembler::LoadSourceTextModuleInfoEntryImportName(TNode<SourceTextModuleInfoEntry> p_o){
+return LoadSourceTextModuleInfoEntryImportName_1111(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSourceTextModuleInfoEntryImportName(TNode<SourceTextModuleInfoEntry> p_o, TNode<PrimitiveHeapObject> p_v){
+return StoreSourceTextModuleInfoEntryImportName_1112(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadSourceTextModuleInfoEntryModuleRequest(TNode<SourceTextModuleInfoEntry> p_o){
+return LoadSourceTextModuleInfoEntryModuleRequest_1113(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSourceTextModuleInfoEntryModuleRequest(TNode<SourceTextModuleInfoEntry> p_o, TNode<Smi> p_v){
+return StoreSourceTextModuleInfoEntryModuleRequest_1114(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadSourceTextModuleInfoEntryCellIndex(TNode<SourceTextModuleInfoEntry> p_o){
+return LoadSourceTextModuleInfoEntryCellIndex_1115(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSourceTextModuleInfoEntryCellIndex(TNode<SourceTextModuleInfoEntry> p_o, TNode<Smi> p_v){
+return StoreSourceTextModuleInfoEntryCellIndex_1116(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadSourceTextModuleInfoEntryBegPos(TNode<SourceTextModuleInfoEntry> p_o){
+return LoadSourceTextModuleInfoEntryBegPos_1117(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSourceTextModuleInfoEntryBegPos(TNode<SourceTextModuleInfoEntry> p_o, TNode<Smi> p_v){
+return StoreSourceTextModuleInfoEntryBegPos_1118(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadSourceTextModuleInfoEntryEndPos(TNode<SourceTextModuleInfoEntry> p_o){
+return LoadSourceTextModuleInfoEntryEndPos_1119(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSourceTextModuleInfoEntryEndPos(TNode<SourceTextModuleInfoEntry> p_o, TNode<Smi> p_v){
+return StoreSourceTextModuleInfoEntryEndPos_1120(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadPromiseCapabilityPromise(TNode<PromiseCapability> p_o){
+return LoadPromiseCapabilityPromise_1121(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePromiseCapabilityPromise(TNode<PromiseCapability> p_o, TNode<HeapObject> p_v){
+return StorePromiseCapabilityPromise_1122(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadPromiseCapabilityResolve(TNode<PromiseCapability> p_o){
+return LoadPromiseCapabilityResolve_1123(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePromiseCapabilityResolve(TNode<PromiseCapability> p_o, TNode<Object> p_v){
+return StorePromiseCapabilityResolve_1124(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadPromiseCapabilityReject(TNode<PromiseCapability> p_o){
+return LoadPromiseCapabilityReject_1125(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePromiseCapabilityReject(TNode<PromiseCapability> p_o, TNode<Object> p_v){
+return StorePromiseCapabilityReject_1126(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadPromiseReactionNext(TNode<PromiseReaction> p_o){
+return LoadPromiseReactionNext_1127(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePromiseReactionNext(TNode<PromiseReaction> p_o, TNode<Object> p_v){
+return StorePromiseReactionNext_1128(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadPromiseReactionRejectHandler(TNode<PromiseReaction> p_o){
+return LoadPromiseReactionRejectHandler_1129(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePromiseReactionRejectHandler(TNode<PromiseReaction> p_o, TNode<HeapObject> p_v){
+return StorePromiseReactionRejectHandler_1130(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadPromiseReactionFulfillHandler(TNode<PromiseReaction> p_o){
+return LoadPromiseReactionFulfillHandler_1131(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePromiseReactionFulfillHandler(TNode<PromiseReaction> p_o, TNode<HeapObject> p_v){
+return StorePromiseReactionFulfillHandler_1132(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadPromiseReactionPromiseOrCapability(TNode<PromiseReaction> p_o){
+return LoadPromiseReactionPromiseOrCapability_1133(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePromiseReactionPromiseOrCapability(TNode<PromiseReaction> p_o, TNode<HeapObject> p_v){
+return StorePromiseReactionPromiseOrCapability_1134(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadPromiseReactionJobTaskArgument(TNode<PromiseReactionJobTask> p_o){
+return LoadPromiseReactionJobTaskArgument_1135(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePromiseReactionJobTaskArgument(TNode<PromiseReactionJobTask> p_o, TNode<Object> p_v){
+return StorePromiseReactionJobTaskArgument_1136(state_, p_o, p_v);
+}
+TNode<Context> TorqueGeneratedExportedMacrosAssembler::LoadPromiseReactionJobTaskContext(TNode<PromiseReactionJobTask> p_o){
+return LoadPromiseReactionJobTaskContext_1137(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePromiseReactionJobTaskContext(TNode<PromiseReactionJobTask> p_o, TNode<Context> p_v){
+return StorePromiseReactionJobTaskContext_1138(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadPromiseReactionJobTaskHandler(TNode<PromiseReactionJobTask> p_o){
+return LoadPromiseReactionJobTaskHandler_1139(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePromiseReactionJobTaskHandler(TNode<PromiseReactionJobTask> p_o, TNode<HeapObject> p_v){
+return StorePromiseReactionJobTaskHandler_1140(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadPromiseReactionJobTaskPromiseOrCapability(TNode<PromiseReactionJobTask> p_o){
+return LoadPromiseReactionJobTaskPromiseOrCapability_1141(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePromiseReactionJobTaskPromiseOrCapability(TNode<PromiseReactionJobTask> p_o, TNode<HeapObject> p_v){
+return StorePromiseReactionJobTaskPromiseOrCapability_1142(state_, p_o, p_v);
+}
+TNode<Context> TorqueGeneratedExportedMacrosAssembler::LoadPromiseResolveThenableJobTaskContext(TNode<PromiseResolveThenableJobTask> p_o){
+return LoadPromiseResolveThenableJobTaskContext_1143(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePromiseResolveThenableJobTaskContext(TNode<PromiseResolveThenableJobTask> p_o, TNode<Context> p_v){
+return StorePromiseResolveThenableJobTaskContext_1144(state_, p_o, p_v);
+}
+TNode<JSPromise> TorqueGeneratedExportedMacrosAssembler::LoadPromiseResolveThenableJobTaskPromiseToResolve(TNode<PromiseResolveThenableJobTask> p_o){
+return LoadPromiseResolveThenableJobTaskPromiseToResolve_1145(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePromiseResolveThenableJobTaskPromiseToResolve(TNode<PromiseResolveThenableJobTask> p_o, TNode<JSPromise> p_v){
+return StorePromiseResolveThenableJobTaskPromiseToResolve_1146(state_, p_o, p_v);
+}
+TNode<JSReceiver> TorqueGeneratedExportedMacrosAssembler::LoadPromiseResolveThenableJobTaskThen(TNode<PromiseResolveThenableJobTask> p_o){
+return LoadPromiseResolveThenableJobTaskThen_1147(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePromiseResolveThenableJobTaskThen(TNode<PromiseResolveThenableJobTask> p_o, TNode<JSReceiver> p_v){
+return StorePromiseResolveThenableJobTaskThen_1148(state_, p_o, p_v);
+}
+TNode<JSReceiver> TorqueGeneratedExportedMacrosAssembler::LoadPromiseResolveThenableJobTaskThenable(TNode<PromiseResolveThenableJobTask> p_o){
+return LoadPromiseResolveThenableJobTaskThenable_1149(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StorePromiseResolveThenableJobTaskThenable(TNode<PromiseResolveThenableJobTask> p_o, TNode<JSReceiver> p_v){
+return StorePromiseResolveThenableJobTaskThenable_1150(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadJSRegExpData(TNode<JSRegExp> p_o){
+return LoadJSRegExpData_1151(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSRegExpData(TNode<JSRegExp> p_o, TNode<HeapObject> p_v){
+return StoreJSRegExpData_1152(state_, p_o, p_v);
+}
+TNode<PrimitiveHeapObject> TorqueGeneratedExportedMacrosAssembler::LoadJSRegExpSource(TNode<JSRegExp> p_o){
+return LoadJSRegExpSource_1153(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSRegExpSource(TNode<JSRegExp> p_o, TNode<PrimitiveHeapObject> p_v){
+return StoreJSRegExpSource_1154(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSRegExpFlags(TNode<JSRegExp> p_o){
+return LoadJSRegExpFlags_1155(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSRegExpFlags(TNode<JSRegExp> p_o, TNode<Object> p_v){
+return StoreJSRegExpFlags_1156(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSRegExpResultIndex(TNode<JSRegExpResult> p_o){
+return LoadJSRegExpResultIndex_1157(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSRegExpResultIndex(TNode<JSRegExpResult> p_o, TNode<Object> p_v){
+return StoreJSRegExpResultIndex_1158(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSRegExpResultInput(TNode<JSRegExpResult> p_o){
+return LoadJSRegExpResultInput_1159(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSRegExpResultInput(TNode<JSRegExpResult> p_o, TNode<Object> p_v){
+return StoreJSRegExpResultInput_1160(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSRegExpResultGroups(TNode<JSRegExpResult> p_o){
+return LoadJSRegExpResultGroups_1161(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSRegExpResultGroups(TNode<JSRegExpResult> p_o, TNode<Object> p_v){
+return StoreJSRegExpResultGroups_1162(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadJSRegExpResultCachedIndicesOrMatchInfo(TNode<JSRegExpResult> p_o){
+return LoadJSRegExpResultCachedIndicesOrMatchInfo_1163(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSRegExpResultCachedIndicesOrMatchInfo(TNode<JSRegExpResult> p_o, TNode<HeapObject> p_v){
+return StoreJSRegExpResultCachedIndicesOrMatchInfo_1164(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadJSRegExpResultNames(TNode<JSRegExpResult> p_o){
+return LoadJSRegExpResultNames_1165(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSRegExpResultNames(TNode<JSRegExpResult> p_o, TNode<HeapObject> p_v){
+return StoreJSRegExpResultNames_1166(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSRegExpResultIndicesGroups(TNode<JSRegExpResultIndices> p_o){
+return LoadJSRegExpResultIndicesGroups_1167(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSRegExpResultIndicesGroups(TNode<JSRegExpResultIndices> p_o, TNode<Object> p_v){
+return StoreJSRegExpResultIndicesGroups_1168(state_, p_o, p_v);
+}
+TNode<JSReceiver> TorqueGeneratedExportedMacrosAssembler::LoadJSRegExpStringIteratorIteratingRegExp(TNode<JSRegExpStringIterator> p_o){
+return LoadJSRegExpStringIteratorIteratingRegExp_1169(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSRegExpStringIteratorIteratingRegExp(TNode<JSRegExpStringIterator> p_o, TNode<JSReceiver> p_v){
+return StoreJSRegExpStringIteratorIteratingRegExp_1170(state_, p_o, p_v);
+}
+TNode<String> TorqueGeneratedExportedMacrosAssembler::LoadJSRegExpStringIteratorIteratedString(TNode<JSRegExpStringIterator> p_o){
+return LoadJSRegExpStringIteratorIteratedString_1171(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSRegExpStringIteratorIteratedString(TNode<JSRegExpStringIterator> p_o, TNode<String> p_v){
+return StoreJSRegExpStringIteratorIteratedString_1172(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadJSRegExpStringIteratorFlags(TNode<JSRegExpStringIterator> p_o){
+return LoadJSRegExpStringIteratorFlags_1173(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSRegExpStringIteratorFlags(TNode<JSRegExpStringIterator> p_o, TNode<Smi> p_v){
+return StoreJSRegExpStringIteratorFlags_1174(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadAccessorInfoName(TNode<AccessorInfo> p_o){
+return LoadAccessorInfoName_1175(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreAccessorInfoName(TNode<AccessorInfo> p_o, TNode<Object> p_v){
+return StoreAccessorInfoName_1176(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadAccessorInfoFlags(TNode<AccessorInfo> p_o){
+return LoadAccessorInfoFlags_1177(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreAccessorInfoFlags(TNode<AccessorInfo> p_o, TNode<Smi> p_v){
+return StoreAccessorInfoFlags_1178(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadAccessorInfoExpectedReceiverType(TNode<AccessorInfo> p_o){
+return LoadAccessorInfoExpectedReceiverType_1179(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreAccessorInfoExpectedReceiverType(TNode<AccessorInfo> p_o, TNode<Object> p_v){
+return StoreAccessorInfoExpectedReceiverType_1180(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadAccessorInfoSetter(TNode<AccessorInfo> p_o){
+return LoadAccessorInfoSetter_1181(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreAccessorInfoSetter(TNode<AccessorInfo> p_o, TNode<Object> p_v){
+return StoreAccessorInfoSetter_1182(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadAccessorInfoGetter(TNode<AccessorInfo> p_o){
+return LoadAccessorInfoGetter_1183(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreAccessorInfoGetter(TNode<AccessorInfo> p_o, TNode<Object> p_v){
+return StoreAccessorInfoGetter_1184(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadAccessorInfoJsGetter(TNode<AccessorInfo> p_o){
+return LoadAccessorInfoJsGetter_1185(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreAccessorInfoJsGetter(TNode<AccessorInfo> p_o, TNode<Object> p_v){
+return StoreAccessorInfoJsGetter_1186(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadAccessorInfoData(TNode<AccessorInfo> p_o){
+return LoadAccessorInfoData_1187(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreAccessorInfoData(TNode<AccessorInfo> p_o, TNode<Object> p_v){
+return StoreAccessorInfoData_1188(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadAccessorPairGetter(TNode<AccessorPair> p_o){
+return LoadAccessorPairGetter_1189(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreAccessorPairGetter(TNode<AccessorPair> p_o, TNode<Object> p_v){
+return StoreAccessorPairGetter_1190(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadAccessorPairSetter(TNode<AccessorPair> p_o){
+return LoadAccessorPairSetter_1191(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreAccessorPairSetter(TNode<AccessorPair> p_o, TNode<Object> p_v){
+return StoreAccessorPairSetter_1192(state_, p_o, p_v);
+}
+TNode<SharedFunctionInfo> TorqueGeneratedExportedMacrosAssembler::LoadDebugInfoShared(TNode<DebugInfo> p_o){
+return LoadDebugInfoShared_1193(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreDebugInfoShared(TNode<DebugInfo> p_o, TNode<SharedFunctionInfo> p_v){
+return StoreDebugInfoShared_1194(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadDebugInfoDebuggerHints(TNode<DebugInfo> p_o){
+return LoadDebugInfoDebuggerHints_1195(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreDebugInfoDebuggerHints(TNode<DebugInfo> p_o, TNode<Smi> p_v){
+return StoreDebugInfoDebuggerHints_1196(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadDebugInfoScript(TNode<DebugInfo> p_o){
+return LoadDebugInfoScript_1197(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreDebugInfoScript(TNode<DebugInfo> p_o, TNode<HeapObject> p_v){
+return StoreDebugInfoScript_1198(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadDebugInfoOriginalBytecodeArray(TNode<DebugInfo> p_o){
+return LoadDebugInfoOriginalBytecodeArray_1199(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreDebugInfoOriginalBytecodeArray(TNode<DebugInfo> p_o, TNode<HeapObject> p_v){
+return StoreDebugInfoOriginalBytecodeArray_1200(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadDebugInfoDebugBytecodeArray(TNode<DebugInfo> p_o){
+return LoadDebugInfoDebugBytecodeArray_1201(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreDebugInfoDebugBytecodeArray(TNode<DebugInfo> p_o, TNode<HeapObject> p_v){
+return StoreDebugInfoDebugBytecodeArray_1202(state_, p_o, p_v);
+}
+TNode<FixedArray> TorqueGeneratedExportedMacrosAssembler::LoadDebugInfoBreakPoints(TNode<DebugInfo> p_o){
+return LoadDebugInfoBreakPoints_1203(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreDebugInfoBreakPoints(TNode<DebugInfo> p_o, TNode<FixedArray> p_v){
+return StoreDebugInfoBreakPoints_1204(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadDebugInfoFlags(TNode<DebugInfo> p_o){
+return LoadDebugInfoFlags_1205(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreDebugInfoFlags(TNode<DebugInfo> p_o, TNode<Smi> p_v){
+return StoreDebugInfoFlags_1206(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadDebugInfoCoverageInfo(TNode<DebugInfo> p_o){
+return LoadDebugInfoCoverageInfo_1207(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreDebugInfoCoverageInfo(TNode<DebugInfo> p_o, TNode<HeapObject> p_v){
+return StoreDebugInfoCoverageInfo_1208(state_, p_o, p_v);
+}
+TNode<SharedFunctionInfo> TorqueGeneratedExportedMacrosAssembler::LoadFeedbackVectorSharedFunctionInfo(TNode<FeedbackVector> p_o){
+return LoadFeedbackVectorSharedFunctionInfo_1209(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFeedbackVectorSharedFunctionInfo(TNode<FeedbackVector> p_o, TNode<SharedFunctionInfo> p_v){
+return StoreFeedbackVectorSharedFunctionInfo_1210(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadFeedbackVectorOptimizedCodeWeakOrSmi(TNode<FeedbackVector> p_o){
+return LoadFeedbackVectorOptimizedCodeWeakOrSmi_1211(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFeedbackVectorOptimizedCodeWeakOrSmi(TNode<FeedbackVector> p_o, TNode<Object> p_v){
+return StoreFeedbackVectorOptimizedCodeWeakOrSmi_1212(state_, p_o, p_v);
+}
+TNode<FixedArray> TorqueGeneratedExportedMacrosAssembler::LoadFeedbackVectorClosureFeedbackCellArray(TNode<FeedbackVector> p_o){
+return LoadFeedbackVectorClosureFeedbackCellArray_1213(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFeedbackVectorClosureFeedbackCellArray(TNode<FeedbackVector> p_o, TNode<FixedArray> p_v){
+return StoreFeedbackVectorClosureFeedbackCellArray_1214(state_, p_o, p_v);
+}
+TNode<Int32T> TorqueGeneratedExportedMacrosAssembler::LoadFeedbackVectorLength(TNode<FeedbackVector> p_o){
+return LoadFeedbackVectorLength_1215(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFeedbackVectorLength(TNode<FeedbackVector> p_o, TNode<Int32T> p_v){
+return StoreFeedbackVectorLength_1216(state_, p_o, p_v);
+}
+TNode<Int32T> TorqueGeneratedExportedMacrosAssembler::LoadFeedbackVectorInvocationCount(TNode<FeedbackVector> p_o){
+return LoadFeedbackVectorInvocationCount_1217(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFeedbackVectorInvocationCount(TNode<FeedbackVector> p_o, TNode<Int32T> p_v){
+return StoreFeedbackVectorInvocationCount_1218(state_, p_o, p_v);
+}
+TNode<Int32T> TorqueGeneratedExportedMacrosAssembler::LoadFeedbackVectorProfilerTicks(TNode<FeedbackVector> p_o){
+return LoadFeedbackVectorProfilerTicks_1219(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFeedbackVectorProfilerTicks(TNode<FeedbackVector> p_o, TNode<Int32T> p_v){
+return StoreFeedbackVectorProfilerTicks_1220(state_, p_o, p_v);
+}
+TNode<Uint32T> TorqueGeneratedExportedMacrosAssembler::LoadFeedbackVectorPadding(TNode<FeedbackVector> p_o){
+return LoadFeedbackVectorPadding_1221(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFeedbackVectorPadding(TNode<FeedbackVector> p_o, TNode<Uint32T> p_v){
+return StoreFeedbackVectorPadding_1222(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadFeedbackCellValue(TNode<FeedbackCell> p_o){
+return LoadFeedbackCellValue_1223(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFeedbackCellValue(TNode<FeedbackCell> p_o, TNode<HeapObject> p_v){
+return StoreFeedbackCellValue_1224(state_, p_o, p_v);
+}
+TNode<Int32T> TorqueGeneratedExportedMacrosAssembler::LoadFeedbackCellInterruptBudget(TNode<FeedbackCell> p_o){
+return LoadFeedbackCellInterruptBudget_1225(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreFeedbackCellInterruptBudget(TNode<FeedbackCell> p_o, TNode<Int32T> p_v){
+return StoreFeedbackCellInterruptBudget_1226(state_, p_o, p_v);
+}
+TNode<AllocationSite> TorqueGeneratedExportedMacrosAssembler::LoadAllocationMementoAllocationSite(TNode<AllocationMemento> p_o){
+return LoadAllocationMementoAllocationSite_1227(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreAllocationMementoAllocationSite(TNode<AllocationMemento> p_o, TNode<AllocationSite> p_v){
+return StoreAllocationMementoAllocationSite_1228(state_, p_o, p_v);
+}
+TNode<Foreign> TorqueGeneratedExportedMacrosAssembler::LoadWasmModuleObjectNativeModule(TNode<WasmModuleObject> p_o){
+return LoadWasmModuleObjectNativeModule_1229(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmModuleObjectNativeModule(TNode<WasmModuleObject> p_o, TNode<Foreign> p_v){
+return StoreWasmModuleObjectNativeModule_1230(state_, p_o, p_v);
+}
+TNode<FixedArray> TorqueGeneratedExportedMacrosAssembler::LoadWasmModuleObjectExportWrappers(TNode<WasmModuleObject> p_o){
+return LoadWasmModuleObjectExportWrappers_1231(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmModuleObjectExportWrappers(TNode<WasmModuleObject> p_o, TNode<FixedArray> p_v){
+return StoreWasmModuleObjectExportWrappers_1232(state_, p_o, p_v);
+}
+TNode<Script> TorqueGeneratedExportedMacrosAssembler::LoadWasmModuleObjectScript(TNode<WasmModuleObject> p_o){
+return LoadWasmModuleObjectScript_1233(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmModuleObjectScript(TNode<WasmModuleObject> p_o, TNode<Script> p_v){
+return StoreWasmModuleObjectScript_1234(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadWasmModuleObjectAsmJsOffsetTable(TNode<WasmModuleObject> p_o){
+return LoadWasmModuleObjectAsmJsOffsetTable_1235(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmModuleObjectAsmJsOffsetTable(TNode<WasmModuleObject> p_o, TNode<HeapObject> p_v){
+return StoreWasmModuleObjectAsmJsOffsetTable_1236(state_, p_o, p_v);
+}
+TNode<FixedArray> TorqueGeneratedExportedMacrosAssembler::LoadWasmTableObjectEntries(TNode<WasmTableObject> p_o){
+return LoadWasmTableObjectEntries_1237(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmTableObjectEntries(TNode<WasmTableObject> p_o, TNode<FixedArray> p_v){
+return StoreWasmTableObjectEntries_1238(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadWasmTableObjectMaximumLength(TNode<WasmTableObject> p_o){
+return LoadWasmTableObjectMaximumLength_1239(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmTableObjectMaximumLength(TNode<WasmTableObject> p_o, TNode<Object> p_v){
+return StoreWasmTableObjectMaximumLength_1240(state_, p_o, p_v);
+}
+TNode<FixedArray> TorqueGeneratedExportedMacrosAssembler::LoadWasmTableObjectDispatchTables(TNode<WasmTableObject> p_o){
+return LoadWasmTableObjectDispatchTables_1241(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmTableObjectDispatchTables(TNode<WasmTableObject> p_o, TNode<FixedArray> p_v){
+return StoreWasmTableObjectDispatchTables_1242(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadWasmTableObjectRawType(TNode<WasmTableObject> p_o){
+return LoadWasmTableObjectRawType_1243(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmTableObjectRawType(TNode<WasmTableObject> p_o, TNode<Smi> p_v){
+return StoreWasmTableObjectRawType_1244(state_, p_o, p_v);
+}
+TNode<JSArrayBuffer> TorqueGeneratedExportedMacrosAssembler::LoadWasmMemoryObjectArrayBuffer(TNode<WasmMemoryObject> p_o){
+return LoadWasmMemoryObjectArrayBuffer_1245(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmMemoryObjectArrayBuffer(TNode<WasmMemoryObject> p_o, TNode<JSArrayBuffer> p_v){
+return StoreWasmMemoryObjectArrayBuffer_1246(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadWasmMemoryObjectMaximumPages(TNode<WasmMemoryObject> p_o){
+return LoadWasmMemoryObjectMaximumPages_1247(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmMemoryObjectMaximumPages(TNode<WasmMemoryObject> p_o, TNode<Smi> p_v){
+return StoreWasmMemoryObjectMaximumPages_1248(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadWasmMemoryObjectInstances(TNode<WasmMemoryObject> p_o){
+return LoadWasmMemoryObjectInstances_1249(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmMemoryObjectInstances(TNode<WasmMemoryObject> p_o, TNode<HeapObject> p_v){
+return StoreWasmMemoryObjectInstances_1250(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadWasmGlobalObjectUntaggedBuffer(TNode<WasmGlobalObject> p_o){
+return LoadWasmGlobalObjectUntaggedBuffer_1251(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmGlobalObjectUntaggedBuffer(TNode<WasmGlobalObject> p_o, TNode<HeapObject> p_v){
+return StoreWasmGlobalObjectUntaggedBuffer_1252(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadWasmGlobalObjectTaggedBuffer(TNode<WasmGlobalObject> p_o){
+return LoadWasmGlobalObjectTaggedBuffer_1253(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmGlobalObjectTaggedBuffer(TNode<WasmGlobalObject> p_o, TNode<HeapObject> p_v){
+return StoreWasmGlobalObjectTaggedBuffer_1254(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadWasmGlobalObjectOffset(TNode<WasmGlobalObject> p_o){
+return LoadWasmGlobalObjectOffset_1255(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmGlobalObjectOffset(TNode<WasmGlobalObject> p_o, TNode<Smi> p_v){
+return StoreWasmGlobalObjectOffset_1256(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadWasmGlobalObjectFlags(TNode<WasmGlobalObject> p_o){
+return LoadWasmGlobalObjectFlags_1257(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmGlobalObjectFlags(TNode<WasmGlobalObject> p_o, TNode<Smi> p_v){
+return StoreWasmGlobalObjectFlags_1258(state_, p_o, p_v);
+}
+TNode<ByteArray> TorqueGeneratedExportedMacrosAssembler::LoadWasmExceptionObjectSerializedSignature(TNode<WasmExceptionObject> p_o){
+return LoadWasmExceptionObjectSerializedSignature_1259(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmExceptionObjectSerializedSignature(TNode<WasmExceptionObject> p_o, TNode<ByteArray> p_v){
+return StoreWasmExceptionObjectSerializedSignature_1260(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadWasmExceptionObjectExceptionTag(TNode<WasmExceptionObject> p_o){
+return LoadWasmExceptionObjectExceptionTag_1261(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWasmExceptionObjectExceptionTag(TNode<WasmExceptionObject> p_o, TNode<HeapObject> p_v){
+return StoreWasmExceptionObjectExceptionTag_1262(state_, p_o, p_v);
+}
+TNode<Foreign> TorqueGeneratedExportedMacrosAssembler::LoadAsmWasmDataManagedNativeModule(TNode<AsmWasmData> p_o){
+return LoadAsmWasmDataManagedNativeModule_1263(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreAsmWasmDataManagedNativeModule(TNode<AsmWasmData> p_o, TNode<Foreign> p_v){
+return StoreAsmWasmDataManagedNativeModule_1264(state_, p_o, p_v);
+}
+TNode<FixedArray> TorqueGeneratedExportedMacrosAssembler::LoadAsmWasmDataExportWrappers(TNode<AsmWasmData> p_o){
+return LoadAsmWasmDataExportWrappers_1265(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreAsmWasmDataExportWrappers(TNode<AsmWasmData> p_o, TNode<FixedArray> p_v){
+return StoreAsmWasmDataExportWrappers_1266(state_, p_o, p_v);
+}
+TNode<ByteArray> TorqueGeneratedExportedMacrosAssembler::LoadAsmWasmDataAsmJsOffsetTable(TNode<AsmWasmData> p_o){
+return LoadAsmWasmDataAsmJsOffsetTable_1267(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreAsmWasmDataAsmJsOffsetTable(TNode<AsmWasmData> p_o, TNode<ByteArray> p_v){
+return StoreAsmWasmDataAsmJsOffsetTable_1268(state_, p_o, p_v);
+}
+TNode<HeapNumber> TorqueGeneratedExportedMacrosAssembler::LoadAsmWasmDataUsesBitset(TNode<AsmWasmData> p_o){
+return LoadAsmWasmDataUsesBitset_1269(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreAsmWasmDataUsesBitset(TNode<AsmWasmData> p_o, TNode<HeapNumber> p_v){
+return StoreAsmWasmDataUsesBitset_1270(state_, p_o, p_v);
+}
+TNode<NativeContext> TorqueGeneratedExportedMacrosAssembler::LoadJSFinalizationGroupNativeContext(TNode<JSFinalizationGroup> p_o){
+return LoadJSFinalizationGroupNativeContext_1271(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSFinalizationGroupNativeContext(TNode<JSFinalizationGroup> p_o, TNode<NativeContext> p_v){
+return StoreJSFinalizationGroupNativeContext_1272(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSFinalizationGroupCleanup(TNode<JSFinalizationGroup> p_o){
+return LoadJSFinalizationGroupCleanup_1273(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSFinalizationGroupCleanup(TNode<JSFinalizationGroup> p_o, TNode<Object> p_v){
+return StoreJSFinalizationGroupCleanup_1274(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadJSFinalizationGroupActiveCells(TNode<JSFinalizationGroup> p_o){
+return LoadJSFinalizationGroupActiveCells_1275(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSFinalizationGroupActiveCells(TNode<JSFinalizationGroup> p_o, TNode<HeapObject> p_v){
+return StoreJSFinalizationGroupActiveCells_1276(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadJSFinalizationGroupClearedCells(TNode<JSFinalizationGroup> p_o){
+return LoadJSFinalizationGroupClearedCells_1277(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSFinalizationGroupClearedCells(TNode<JSFinalizationGroup> p_o, TNode<HeapObject> p_v){
+return StoreJSFinalizationGroupClearedCells_1278(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadJSFinalizationGroupKeyMap(TNode<JSFinalizationGroup> p_o){
+return LoadJSFinalizationGroupKeyMap_1279(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSFinalizationGroupKeyMap(TNode<JSFinalizationGroup> p_o, TNode<Object> p_v){
+return StoreJSFinalizationGroupKeyMap_1280(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadJSFinalizationGroupNext(TNode<JSFinalizationGroup> p_o){
+return LoadJSFinalizationGroupNext_1281(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSFinalizationGroupNext(TNode<JSFinalizationGroup> p_o, TNode<HeapObject> p_v){
+return StoreJSFinalizationGroupNext_1282(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadJSFinalizationGroupFlags(TNode<JSFinalizationGroup> p_o){
+return LoadJSFinalizationGroupFlags_1283(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSFinalizationGroupFlags(TNode<JSFinalizationGroup> p_o, TNode<Smi> p_v){
+return StoreJSFinalizationGroupFlags_1284(state_, p_o, p_v);
+}
+TNode<JSFinalizationGroup> TorqueGeneratedExportedMacrosAssembler::LoadJSFinalizationGroupCleanupIteratorFinalizationGroup(TNode<JSFinalizationGroupCleanupIterator> p_o){
+return LoadJSFinalizationGroupCleanupIteratorFinalizationGroup_1285(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSFinalizationGroupCleanupIteratorFinalizationGroup(TNode<JSFinalizationGroupCleanupIterator> p_o, TNode<JSFinalizationGroup> p_v){
+return StoreJSFinalizationGroupCleanupIteratorFinalizationGroup_1286(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadWeakCellFinalizationGroup(TNode<WeakCell> p_o){
+return LoadWeakCellFinalizationGroup_1287(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWeakCellFinalizationGroup(TNode<WeakCell> p_o, TNode<HeapObject> p_v){
+return StoreWeakCellFinalizationGroup_1288(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadWeakCellTarget(TNode<WeakCell> p_o){
+return LoadWeakCellTarget_1289(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWeakCellTarget(TNode<WeakCell> p_o, TNode<HeapObject> p_v){
+return StoreWeakCellTarget_1290(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadWeakCellHoldings(TNode<WeakCell> p_o){
+return LoadWeakCellHoldings_1291(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWeakCellHoldings(TNode<WeakCell> p_o, TNode<Object> p_v){
+return StoreWeakCellHoldings_1292(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadWeakCellPrev(TNode<WeakCell> p_o){
+return LoadWeakCellPrev_1293(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWeakCellPrev(TNode<WeakCell> p_o, TNode<HeapObject> p_v){
+return StoreWeakCellPrev_1294(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadWeakCellNext(TNode<WeakCell> p_o){
+return LoadWeakCellNext_1295(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWeakCellNext(TNode<WeakCell> p_o, TNode<HeapObject> p_v){
+return StoreWeakCellNext_1296(state_, p_o, p_v);
+}
+TNode<Object> TorqueGeneratedExportedMacrosAssembler::LoadWeakCellKey(TNode<WeakCell> p_o){
+return LoadWeakCellKey_1297(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWeakCellKey(TNode<WeakCell> p_o, TNode<Object> p_v){
+return StoreWeakCellKey_1298(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadWeakCellKeyListPrev(TNode<WeakCell> p_o){
+return LoadWeakCellKeyListPrev_1299(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWeakCellKeyListPrev(TNode<WeakCell> p_o, TNode<HeapObject> p_v){
+return StoreWeakCellKeyListPrev_1300(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadWeakCellKeyListNext(TNode<WeakCell> p_o){
+return LoadWeakCellKeyListNext_1301(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreWeakCellKeyListNext(TNode<WeakCell> p_o, TNode<HeapObject> p_v){
+return StoreWeakCellKeyListNext_1302(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadJSWeakRefTarget(TNode<JSWeakRef> p_o){
+return LoadJSWeakRefTarget_1303(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreJSWeakRefTarget(TNode<JSWeakRef> p_o, TNode<HeapObject> p_v){
+return StoreJSWeakRefTarget_1304(state_, p_o, p_v);
+}
+TNode<FixedArray> TorqueGeneratedExportedMacrosAssembler::LoadBytecodeArrayConstantPool(TNode<BytecodeArray> p_o){
+return LoadBytecodeArrayConstantPool_1305(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreBytecodeArrayConstantPool(TNode<BytecodeArray> p_o, TNode<FixedArray> p_v){
+return StoreBytecodeArrayConstantPool_1306(state_, p_o, p_v);
+}
+TNode<ByteArray> TorqueGeneratedExportedMacrosAssembler::LoadBytecodeArrayHandlerTable(TNode<BytecodeArray> p_o){
+return LoadBytecodeArrayHandlerTable_1307(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreBytecodeArrayHandlerTable(TNode<BytecodeArray> p_o, TNode<ByteArray> p_v){
+return StoreBytecodeArrayHandlerTable_1308(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadBytecodeArraySourcePositionTable(TNode<BytecodeArray> p_o){
+return LoadBytecodeArraySourcePositionTable_1309(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreBytecodeArraySourcePositionTable(TNode<BytecodeArray> p_o, TNode<HeapObject> p_v){
+return StoreBytecodeArraySourcePositionTable_1310(state_, p_o, p_v);
+}
+TNode<Int32T> TorqueGeneratedExportedMacrosAssembler::LoadBytecodeArrayFrameSize(TNode<BytecodeArray> p_o){
+return LoadBytecodeArrayFrameSize_1311(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreBytecodeArrayFrameSize(TNode<BytecodeArray> p_o, TNode<Int32T> p_v){
+return StoreBytecodeArrayFrameSize_1312(state_, p_o, p_v);
+}
+TNode<Int32T> TorqueGeneratedExportedMacrosAssembler::LoadBytecodeArrayParameterSize(TNode<BytecodeArray> p_o){
+return LoadBytecodeArrayParameterSize_1313(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreBytecodeArrayParameterSize(TNode<BytecodeArray> p_o, TNode<Int32T> p_v){
+return StoreBytecodeArrayParameterSize_1314(state_, p_o, p_v);
+}
+TNode<Int32T> TorqueGeneratedExportedMacrosAssembler::LoadBytecodeArrayIncomingNewTargetOrGeneratorRegister(TNode<BytecodeArray> p_o){
+return LoadBytecodeArrayIncomingNewTargetOrGeneratorRegister_1315(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreBytecodeArrayIncomingNewTargetOrGeneratorRegister(TNode<BytecodeArray> p_o, TNode<Int32T> p_v){
+return StoreBytecodeArrayIncomingNewTargetOrGeneratorRegister_1316(state_, p_o, p_v);
+}
+TNode<Int8T> TorqueGeneratedExportedMacrosAssembler::LoadBytecodeArrayOsrNestingLevel(TNode<BytecodeArray> p_o){
+return LoadBytecodeArrayOsrNestingLevel_1317(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreBytecodeArrayOsrNestingLevel(TNode<BytecodeArray> p_o, TNode<Int8T> p_v){
+return StoreBytecodeArrayOsrNestingLevel_1318(state_, p_o, p_v);
+}
+TNode<Int8T> TorqueGeneratedExportedMacrosAssembler::LoadBytecodeArrayBytecodeAge(TNode<BytecodeArray> p_o){
+return LoadBytecodeArrayBytecodeAge_1319(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreBytecodeArrayBytecodeAge(TNode<BytecodeArray> p_o, TNode<Int8T> p_v){
+return StoreBytecodeArrayBytecodeAge_1320(state_, p_o, p_v);
+}
+TNode<JSReceiver> TorqueGeneratedExportedMacrosAssembler::LoadSortStateReceiver(TNode<SortState> p_o){
+return LoadSortStateReceiver_1321(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSortStateReceiver(TNode<SortState> p_o, TNode<JSReceiver> p_v){
+return StoreSortStateReceiver_1322(state_, p_o, p_v);
+}
+TNode<Map> TorqueGeneratedExportedMacrosAssembler::LoadSortStateInitialReceiverMap(TNode<SortState> p_o){
+return LoadSortStateInitialReceiverMap_1323(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSortStateInitialReceiverMap(TNode<SortState> p_o, TNode<Map> p_v){
+return StoreSortStateInitialReceiverMap_1324(state_, p_o, p_v);
+}
+TNode<Number> TorqueGeneratedExportedMacrosAssembler::LoadSortStateInitialReceiverLength(TNode<SortState> p_o){
+return LoadSortStateInitialReceiverLength_1325(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSortStateInitialReceiverLength(TNode<SortState> p_o, TNode<Number> p_v){
+return StoreSortStateInitialReceiverLength_1326(state_, p_o, p_v);
+}
+TNode<HeapObject> TorqueGeneratedExportedMacrosAssembler::LoadSortStateUserCmpFn(TNode<SortState> p_o){
+return LoadSortStateUserCmpFn_1327(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSortStateUserCmpFn(TNode<SortState> p_o, TNode<HeapObject> p_v){
+return StoreSortStateUserCmpFn_1328(state_, p_o, p_v);
+}
+TNode<BuiltinPtr> TorqueGeneratedExportedMacrosAssembler::LoadSortStateSortComparePtr(TNode<SortState> p_o){
+return LoadSortStateSortComparePtr_1329(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSortStateSortComparePtr(TNode<SortState> p_o, TNode<BuiltinPtr> p_v){
+return StoreSortStateSortComparePtr_1330(state_, p_o, p_v);
+}
+TNode<BuiltinPtr> TorqueGeneratedExportedMacrosAssembler::LoadSortStateLoadFn(TNode<SortState> p_o){
+return LoadSortStateLoadFn_1331(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSortStateLoadFn(TNode<SortState> p_o, TNode<BuiltinPtr> p_v){
+return StoreSortStateLoadFn_1332(state_, p_o, p_v);
+}
+TNode<BuiltinPtr> TorqueGeneratedExportedMacrosAssembler::LoadSortStateStoreFn(TNode<SortState> p_o){
+return LoadSortStateStoreFn_1333(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSortStateStoreFn(TNode<SortState> p_o, TNode<BuiltinPtr> p_v){
+return StoreSortStateStoreFn_1334(state_, p_o, p_v);
+}
+TNode<BuiltinPtr> TorqueGeneratedExportedMacrosAssembler::LoadSortStateDeleteFn(TNode<SortState> p_o){
+return LoadSortStateDeleteFn_1335(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSortStateDeleteFn(TNode<SortState> p_o, TNode<BuiltinPtr> p_v){
+return StoreSortStateDeleteFn_1336(state_, p_o, p_v);
+}
+TNode<BuiltinPtr> TorqueGeneratedExportedMacrosAssembler::LoadSortStateCanUseSameAccessorFn(TNode<SortState> p_o){
+return LoadSortStateCanUseSameAccessorFn_1337(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSortStateCanUseSameAccessorFn(TNode<SortState> p_o, TNode<BuiltinPtr> p_v){
+return StoreSortStateCanUseSameAccessorFn_1338(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadSortStateMinGallop(TNode<SortState> p_o){
+return LoadSortStateMinGallop_1339(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSortStateMinGallop(TNode<SortState> p_o, TNode<Smi> p_v){
+return StoreSortStateMinGallop_1340(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadSortStatePendingRunsSize(TNode<SortState> p_o){
+return LoadSortStatePendingRunsSize_1341(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSortStatePendingRunsSize(TNode<SortState> p_o, TNode<Smi> p_v){
+return StoreSortStatePendingRunsSize_1342(state_, p_o, p_v);
+}
+TNode<FixedArray> TorqueGeneratedExportedMacrosAssembler::LoadSortStatePendingRuns(TNode<SortState> p_o){
+return LoadSortStatePendingRuns_1343(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSortStatePendingRuns(TNode<SortState> p_o, TNode<FixedArray> p_v){
+return StoreSortStatePendingRuns_1344(state_, p_o, p_v);
+}
+TNode<FixedArray> TorqueGeneratedExportedMacrosAssembler::LoadSortStateWorkArray(TNode<SortState> p_o){
+return LoadSortStateWorkArray_1345(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSortStateWorkArray(TNode<SortState> p_o, TNode<FixedArray> p_v){
+return StoreSortStateWorkArray_1346(state_, p_o, p_v);
+}
+TNode<FixedArray> TorqueGeneratedExportedMacrosAssembler::LoadSortStateTempArray(TNode<SortState> p_o){
+return LoadSortStateTempArray_1347(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSortStateTempArray(TNode<SortState> p_o, TNode<FixedArray> p_v){
+return StoreSortStateTempArray_1348(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadSortStateSortLength(TNode<SortState> p_o){
+return LoadSortStateSortLength_1349(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSortStateSortLength(TNode<SortState> p_o, TNode<Smi> p_v){
+return StoreSortStateSortLength_1350(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadSortStateNumberOfUndefined(TNode<SortState> p_o){
+return LoadSortStateNumberOfUndefined_1351(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSortStateNumberOfUndefined(TNode<SortState> p_o, TNode<Smi> p_v){
+return StoreSortStateNumberOfUndefined_1352(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadInternalClassA(TNode<InternalClass> p_o){
+return LoadInternalClassA_1353(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreInternalClassA(TNode<InternalClass> p_o, TNode<Smi> p_v){
+return StoreInternalClassA_1354(state_, p_o, p_v);
+}
+TNode<Number> TorqueGeneratedExportedMacrosAssembler::LoadInternalClassB(TNode<InternalClass> p_o){
+return LoadInternalClassB_1355(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreInternalClassB(TNode<InternalClass> p_o, TNode<Number> p_v){
+return StoreInternalClassB_1356(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadSmiPairA(TNode<SmiPair> p_o){
+return LoadSmiPairA_1357(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSmiPairA(TNode<SmiPair> p_o, TNode<Smi> p_v){
+return StoreSmiPairA_1358(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadSmiPairB(TNode<SmiPair> p_o){
+return LoadSmiPairB_1359(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSmiPairB(TNode<SmiPair> p_o, TNode<Smi> p_v){
+return StoreSmiPairB_1360(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadSmiBoxValue(TNode<SmiBox> p_o){
+return LoadSmiBoxValue_1361(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSmiBoxValue(TNode<SmiBox> p_o, TNode<Smi> p_v){
+return StoreSmiBoxValue_1362(state_, p_o, p_v);
+}
+TNode<Smi> TorqueGeneratedExportedMacrosAssembler::LoadSmiBoxUnrelated(TNode<SmiBox> p_o){
+return LoadSmiBoxUnrelated_1363(state_, p_o);
+}
+void TorqueGeneratedExportedMacrosAssembler::StoreSmiBoxUnrelated(TNode<SmiBox> p_o, TNode<Smi> p_v){
+return StoreSmiBoxUnrelated_1364(state_, p_o, p_v);
+}
+}  // namespace internal
+}  // namespace v8
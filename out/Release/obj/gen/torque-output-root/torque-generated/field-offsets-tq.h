@@ -0,0 +1,1011 @@
+#ifndef V8_GEN_TORQUE_GENERATED_FIELD_OFFSETS_TQ_H_
+#define V8_GEN_TORQUE_GENERATED_FIELD_OFFSETS_TQ_H_
+
+#define TORQUE_GENERATED_CONTEXT_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kLengthOffset, kTaggedSize) \
+V(kScopeInfoOffset, kTaggedSize) \
+V(kPreviousOffset, kTaggedSize) \
+V(kExtensionOffset, kTaggedSize) \
+V(kNativeContextOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kHeaderSize, 0) \
+
+#define TORQUE_GENERATED_HEAP_OBJECT_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kMapOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kHeaderSize, 0) \
+
+#define TORQUE_GENERATED_JS_RECEIVER_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kPropertiesOrHashOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kHeaderSize, 0) \
+
+#define TORQUE_GENERATED_HEAP_NUMBER_FIELDS(V) \
+V(kValueOffset, kDoubleSize) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_BIG_INT_BASE_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_FIXED_ARRAY_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kObjectsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kHeaderSize, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_FIXED_ARRAY_BASE_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kLengthOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kHeaderSize, 0) \
+
+#define TORQUE_GENERATED_HASH_TABLE_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kHeaderSize, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_ORDERED_HASH_MAP_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_ORDERED_HASH_SET_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_ORDERED_NAME_DICTIONARY_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_NAME_DICTIONARY_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_GLOBAL_DICTIONARY_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_SIMPLE_NUMBER_DICTIONARY_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_STRING_TABLE_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_EPHEMERON_HASH_TABLE_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_NUMBER_DICTIONARY_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_CODE_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_AWAIT_CONTEXT_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_BLOCK_CONTEXT_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_CATCH_CONTEXT_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_DEBUG_EVALUATE_CONTEXT_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_EVAL_CONTEXT_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_FUNCTION_CONTEXT_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_MODULE_CONTEXT_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_NATIVE_CONTEXT_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_SCRIPT_CONTEXT_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_WITH_CONTEXT_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_EXTERNAL_STRING_FIELDS(V) \
+V(kResourceOffset, kSystemPointerSize) \
+V(kResourceDataOffset, kSystemPointerSize) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kHeaderSize, 0) \
+
+#define TORQUE_GENERATED_EXTERNAL_ONE_BYTE_STRING_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_EXTERNAL_TWO_BYTE_STRING_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_FIXED_DOUBLE_ARRAY_FIELDS(V) \
+V(kFloatsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_WEAK_FIXED_ARRAY_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kLengthOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kHeaderSize, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_BYTE_ARRAY_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_ARRAY_LIST_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_OBJECT_BOILERPLATE_DESCRIPTION_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_CLOSURE_FEEDBACK_CELL_ARRAY_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_SCRIPT_CONTEXT_TABLE_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_TRANSITION_ARRAY_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_MAP_FIELDS(V) \
+V(kInstanceSizeInWordsOffset, kUInt8Size) \
+V(kInObjectPropertiesStartOrConstructorFunctionIndexOffset, kUInt8Size) \
+V(kUsedOrUnusedInstanceSizeInWordsOffset, kUInt8Size) \
+V(kVisitorIdOffset, kUInt8Size) \
+V(kInstanceTypeOffset, kUInt16Size) \
+V(kBitFieldOffset, kUInt8Size) \
+V(kBitField2Offset, kUInt8Size) \
+V(kBitField3Offset, kInt32Size) \
+V(kOptionalPaddingOffset, kInt32Size) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kPrototypeOffset, kTaggedSize) \
+V(kConstructorOrBackPointerOffset, kTaggedSize) \
+V(kInstanceDescriptorsOffset, kTaggedSize) \
+V(kLayoutDescriptorOffset, kTaggedSize) \
+V(kDependentCodeOffset, kTaggedSize) \
+V(kPrototypeValidityCellOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kTransitionsOrPrototypeInfoOffset, kTaggedSize) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_DESCRIPTOR_ARRAY_FIELDS(V) \
+V(kNumberOfAllDescriptorsOffset, kUInt16Size) \
+V(kNumberOfDescriptorsOffset, kUInt16Size) \
+V(kRawNumberOfMarkedDescriptorsOffset, kUInt16Size) \
+V(kFiller16BitsOffset, kUInt16Size) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEnumCacheOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kHeaderSize, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_JS_FUNCTION_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kSharedFunctionInfoOffset, kTaggedSize) \
+V(kContextOffset, kTaggedSize) \
+V(kFeedbackCellOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kCodeOffset, kTaggedSize) \
+V(kPrototypeOrInitialMapOffset, kTaggedSize) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_JS_PROXY_REVOCABLE_RESULT_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kProxyOffset, kTaggedSize) \
+V(kRevokeOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_JS_ARGUMENTS_OBJECT_WITH_LENGTH_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kLengthOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_JS_SLOPPY_ARGUMENTS_OBJECT_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kCalleeOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_JS_STRICT_ARGUMENTS_OBJECT_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_JS_ARRAY_ITERATOR_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kIteratedObjectOffset, kTaggedSize) \
+V(kNextIndexOffset, kTaggedSize) \
+V(kKindOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_JS_ARRAY_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kLengthOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_MODULE_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kExportsOffset, kTaggedSize) \
+V(kHashOffset, kTaggedSize) \
+V(kStatusOffset, kTaggedSize) \
+V(kModuleNamespaceOffset, kTaggedSize) \
+V(kExceptionOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kHeaderSize, 0) \
+
+#define TORQUE_GENERATED_TEMPLATE_LIST_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_JS_MAP_ITERATOR_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kHeaderSize, 0) \
+
+#define TORQUE_GENERATED_JS_MAP_KEY_ITERATOR_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_JS_MAP_KEY_VALUE_ITERATOR_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_JS_MAP_VALUE_ITERATOR_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_JS_SET_ITERATOR_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kHeaderSize, 0) \
+
+#define TORQUE_GENERATED_JS_SET_KEY_VALUE_ITERATOR_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_JS_SET_VALUE_ITERATOR_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_JS_MESSAGE_OBJECT_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kMessageTypeOffset, kTaggedSize) \
+V(kArgumentsOffset, kTaggedSize) \
+V(kScriptOffset, kTaggedSize) \
+V(kStackFramesOffset, kTaggedSize) \
+V(kSharedInfoOffset, kTaggedSize) \
+V(kBytecodeOffsetOffset, kTaggedSize) \
+V(kStartPositionOffset, kTaggedSize) \
+V(kEndPositionOffset, kTaggedSize) \
+V(kErrorLevelOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_WEAK_ARRAY_LIST_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kCapacityOffset, kTaggedSize) \
+V(kLengthOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_PROTOTYPE_INFO_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kJsModuleNamespaceOffset, kTaggedSize) \
+V(kPrototypeUsersOffset, kTaggedSize) \
+V(kRegistrySlotOffset, kTaggedSize) \
+V(kValidityCellOffset, kTaggedSize) \
+V(kObjectCreateMapOffset, kTaggedSize) \
+V(kBitFieldOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_SCRIPT_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kSourceOffset, kTaggedSize) \
+V(kNameOffset, kTaggedSize) \
+V(kLineOffsetOffset, kTaggedSize) \
+V(kColumnOffsetOffset, kTaggedSize) \
+V(kContextOffset, kTaggedSize) \
+V(kScriptTypeOffset, kTaggedSize) \
+V(kLineEndsOffset, kTaggedSize) \
+V(kIdOffset, kTaggedSize) \
+V(kEvalFromSharedOrWrappedArgumentsOffset, kTaggedSize) \
+V(kEvalFromPositionOffset, kTaggedSize) \
+V(kSharedFunctionInfosOffset, kTaggedSize) \
+V(kFlagsOffset, kTaggedSize) \
+V(kSourceUrlOffset, kTaggedSize) \
+V(kSourceMappingUrlOffset, kTaggedSize) \
+V(kHostDefinedOptionsOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_SCOPE_INFO_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_INTERPRETER_DATA_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kBytecodeArrayOffset, kTaggedSize) \
+V(kInterpreterTrampolineOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_SHARED_FUNCTION_INFO_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kFunctionDataOffset, kTaggedSize) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kNameOrScopeInfoOffset, kTaggedSize) \
+V(kOuterScopeInfoOrFeedbackMetadataOffset, kTaggedSize) \
+V(kScriptOrDebugInfoOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kLengthOffset, kUInt16Size) \
+V(kFormalParameterCountOffset, kUInt16Size) \
+V(kExpectedNofPropertiesOffset, kUInt16Size) \
+V(kFunctionTokenOffsetOffset, kUInt16Size) \
+V(kFlagsOffset, kInt32Size) \
+V(kFunctionLiteralIdOffset, kInt32Size) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_FOREIGN_FIELDS(V) \
+V(kForeignAddressOffset, kSystemPointerSize) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_FREE_SPACE_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kSizeOffset, kTaggedSize) \
+V(kNextOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_JS_ARRAY_BUFFER_FIELDS(V) \
+V(kByteLengthOffset, kIntptrSize) \
+V(kBackingStoreOffset, kSystemPointerSize) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_JS_ARRAY_BUFFER_VIEW_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kBufferOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kByteOffsetOffset, kIntptrSize) \
+V(kByteLengthOffset, kIntptrSize) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kHeaderSize, 0) \
+
+#define TORQUE_GENERATED_JS_TYPED_ARRAY_FIELDS(V) \
+V(kLengthOffset, kIntptrSize) \
+V(kExternalPointerOffset, kSystemPointerSize) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kBasePointerOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_JS_GLOBAL_OBJECT_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kNativeContextOffset, kTaggedSize) \
+V(kGlobalProxyOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_PROPERTY_ARRAY_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kLengthAndHashOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_PROPERTY_CELL_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kNameOffset, kTaggedSize) \
+V(kPropertyDetailsRawOffset, kTaggedSize) \
+V(kValueOffset, kTaggedSize) \
+V(kDependentCodeOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_JS_DATA_VIEW_FIELDS(V) \
+V(kDataPointerOffset, kSystemPointerSize) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_DATA_HANDLER_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kSmiHandlerOffset, kTaggedSize) \
+V(kValidityCellOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kData1Offset, kTaggedSize) \
+V(kData2Offset, kTaggedSize) \
+V(kData3Offset, kTaggedSize) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kHeaderSize, 0) \
+
+#define TORQUE_GENERATED_LOAD_HANDLER_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_STORE_HANDLER_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_STACK_FRAME_INFO_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kLineNumberOffset, kTaggedSize) \
+V(kColumnNumberOffset, kTaggedSize) \
+V(kPromiseAllIndexOffset, kTaggedSize) \
+V(kScriptIdOffset, kTaggedSize) \
+V(kScriptNameOffset, kTaggedSize) \
+V(kScriptNameOrSourceUrlOffset, kTaggedSize) \
+V(kFunctionNameOffset, kTaggedSize) \
+V(kMethodNameOffset, kTaggedSize) \
+V(kTypeNameOffset, kTaggedSize) \
+V(kEvalOriginOffset, kTaggedSize) \
+V(kWasmModuleNameOffset, kTaggedSize) \
+V(kWasmInstanceOffset, kTaggedSize) \
+V(kFlagOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_WASM_INSTANCE_OBJECT_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_WASM_EXPORTED_FUNCTION_DATA_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kWrapperCodeOffset, kTaggedSize) \
+V(kInstanceOffset, kTaggedSize) \
+V(kJumpTableOffsetOffset, kTaggedSize) \
+V(kFunctionIndexOffset, kTaggedSize) \
+V(kCWrapperCodeOffset, kTaggedSize) \
+V(kWasmCallTargetOffset, kTaggedSize) \
+V(kPackedArgsSizeOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_WASM_JS_FUNCTION_DATA_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kCallableOffset, kTaggedSize) \
+V(kWrapperCodeOffset, kTaggedSize) \
+V(kSerializedReturnCountOffset, kTaggedSize) \
+V(kSerializedParameterCountOffset, kTaggedSize) \
+V(kSerializedSignatureOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_WASM_CAPI_FUNCTION_DATA_FIELDS(V) \
+V(kCallTargetOffset, kSystemPointerSize) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEmbedderDataOffset, kTaggedSize) \
+V(kWrapperCodeOffset, kTaggedSize) \
+V(kSerializedSignatureOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_WASM_INDIRECT_FUNCTION_TABLE_FIELDS(V) \
+V(kSizeOffset, kInt32Size) \
+V(kOptionalPaddingOffset, kInt32Size) \
+V(kSigIdsOffset, kSystemPointerSize) \
+V(kTargetsOffset, kSystemPointerSize) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kManagedNativeAllocationsOffset, kTaggedSize) \
+V(kRefsOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_WASM_DEBUG_INFO_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kInstanceOffset, kTaggedSize) \
+V(kInterpreterHandleOffset, kTaggedSize) \
+V(kInterpreterReferenceStackOffset, kTaggedSize) \
+V(kLocalsNamesOffset, kTaggedSize) \
+V(kCWasmEntriesOffset, kTaggedSize) \
+V(kCWasmEntryMapOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_JS_REG_EXP_RESULT_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kIndexOffset, kTaggedSize) \
+V(kInputOffset, kTaggedSize) \
+V(kGroupsOffset, kTaggedSize) \
+V(kCachedIndicesOrMatchInfoOffset, kTaggedSize) \
+V(kNamesOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_JS_REG_EXP_RESULT_INDICES_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kGroupsOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_REG_EXP_MATCH_INFO_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_ACCESSOR_INFO_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kNameOffset, kTaggedSize) \
+V(kFlagsOffset, kTaggedSize) \
+V(kExpectedReceiverTypeOffset, kTaggedSize) \
+V(kSetterOffset, kTaggedSize) \
+V(kGetterOffset, kTaggedSize) \
+V(kJsGetterOffset, kTaggedSize) \
+V(kDataOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_BREAK_POINT_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_BREAK_POINT_INFO_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_FEEDBACK_VECTOR_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kSharedFunctionInfoOffset, kTaggedSize) \
+V(kOptimizedCodeWeakOrSmiOffset, kTaggedSize) \
+V(kClosureFeedbackCellArrayOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kLengthOffset, kInt32Size) \
+V(kInvocationCountOffset, kInt32Size) \
+V(kProfilerTicksOffset, kInt32Size) \
+V(kPaddingOffset, kInt32Size) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_FEEDBACK_METADATA_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_ALLOCATION_SITE_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_ALLOCATION_MEMENTO_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kAllocationSiteOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_WASM_MODULE_OBJECT_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kNativeModuleOffset, kTaggedSize) \
+V(kExportWrappersOffset, kTaggedSize) \
+V(kScriptOffset, kTaggedSize) \
+V(kAsmJsOffsetTableOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_WASM_TABLE_OBJECT_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEntriesOffset, kTaggedSize) \
+V(kMaximumLengthOffset, kTaggedSize) \
+V(kDispatchTablesOffset, kTaggedSize) \
+V(kRawTypeOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_WASM_MEMORY_OBJECT_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kArrayBufferOffset, kTaggedSize) \
+V(kMaximumPagesOffset, kTaggedSize) \
+V(kInstancesOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_WASM_GLOBAL_OBJECT_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kUntaggedBufferOffset, kTaggedSize) \
+V(kTaggedBufferOffset, kTaggedSize) \
+V(kOffsetOffset, kTaggedSize) \
+V(kFlagsOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_WASM_EXCEPTION_OBJECT_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kSerializedSignatureOffset, kTaggedSize) \
+V(kExceptionTagOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_ASM_WASM_DATA_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kManagedNativeModuleOffset, kTaggedSize) \
+V(kExportWrappersOffset, kTaggedSize) \
+V(kAsmJsOffsetTableOffset, kTaggedSize) \
+V(kUsesBitsetOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_JS_FINALIZATION_GROUP_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kNativeContextOffset, kTaggedSize) \
+V(kCleanupOffset, kTaggedSize) \
+V(kActiveCellsOffset, kTaggedSize) \
+V(kClearedCellsOffset, kTaggedSize) \
+V(kKeyMapOffset, kTaggedSize) \
+V(kNextOffset, kTaggedSize) \
+V(kFlagsOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_BYTECODE_ARRAY_FIELDS(V) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kConstantPoolOffset, kTaggedSize) \
+V(kHandlerTableOffset, kTaggedSize) \
+V(kSourcePositionTableOffset, kTaggedSize) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kFrameSizeOffset, kInt32Size) \
+V(kParameterSizeOffset, kInt32Size) \
+V(kIncomingNewTargetOrGeneratorRegisterOffset, kInt32Size) \
+V(kOsrNestingLevelOffset, kUInt8Size) \
+V(kBytecodeAgeOffset, kUInt8Size) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_FILLER_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_CODE_DATA_CONTAINER_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_SMALL_ORDERED_HASH_TABLE_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kHeaderSize, 0) \
+
+#define TORQUE_GENERATED_SMALL_ORDERED_HASH_MAP_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_SMALL_ORDERED_HASH_SET_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_SMALL_ORDERED_NAME_DICTIONARY_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_JS_API_OBJECT_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_JS_SPECIAL_API_OBJECT_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_JS_CONTEXT_EXTENSION_OBJECT_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_JS_ERROR_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#define TORQUE_GENERATED_MUTABLE_BIG_INT_FIELDS(V) \
+V(kStartOfWeakFieldsOffset, 0) \
+V(kEndOfWeakFieldsOffset, 0) \
+V(kStartOfStrongFieldsOffset, 0) \
+V(kEndOfStrongFieldsOffset, 0) \
+V(kSize, 0) \
+
+#endif  // V8_GEN_TORQUE_GENERATED_FIELD_OFFSETS_TQ_H_
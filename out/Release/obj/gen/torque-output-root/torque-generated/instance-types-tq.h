@@ -0,0 +1,388 @@
+#ifndef V8_GEN_TORQUE_GENERATED_INSTANCE_TYPES_TQ_H_
+#define V8_GEN_TORQUE_GENERATED_INSTANCE_TYPES_TQ_H_
+
+// Instance types for all classes except for those that use InstanceType as flags.
+#define TORQUE_ASSIGNED_INSTANCE_TYPES(V) \
+  V(FIRST_HEAP_OBJECT_TYPE, 0) \
+    V(FIRST_PRIMITIVE_HEAP_OBJECT_TYPE, 0) \
+      V(FIRST_NAME_TYPE, 0) \
+        V(FIRST_STRING_TYPE, 0) \
+        V(SYMBOL_TYPE, 64) \
+      V(LAST_NAME_TYPE, 64) \
+      V(BIG_INT_BASE_TYPE, 65) \
+      V(HEAP_NUMBER_TYPE, 66) \
+      V(ODDBALL_TYPE, 67) \
+    V(LAST_PRIMITIVE_HEAP_OBJECT_TYPE, 67) \
+    V(FIRST_MODULE_TYPE, 68) \
+      V(SOURCE_TEXT_MODULE_TYPE, 68) \
+      V(SYNTHETIC_MODULE_TYPE, 69) \
+    V(LAST_MODULE_TYPE, 69) \
+    V(FOREIGN_TYPE, 70) \
+    V(FIRST_STRUCT_TYPE, 71) \
+      V(FIRST_MICROTASK_TYPE, 71) \
+        V(FIRST_PROMISE_REACTION_JOB_TASK_TYPE, 71) \
+          V(PROMISE_FULFILL_REACTION_JOB_TASK_TYPE, 71) \
+          V(PROMISE_REJECT_REACTION_JOB_TASK_TYPE, 72) \
+        V(LAST_PROMISE_REACTION_JOB_TASK_TYPE, 72) \
+        V(CALLABLE_TASK_TYPE, 73) \
+        V(CALLBACK_TASK_TYPE, 74) \
+        V(PROMISE_RESOLVE_THENABLE_JOB_TASK_TYPE, 75) \
+      V(LAST_MICROTASK_TYPE, 75) \
+      V(FIRST_DATA_HANDLER_TYPE, 76) \
+        V(LOAD_HANDLER_TYPE, 76) \
+        V(STORE_HANDLER_TYPE, 77) \
+      V(LAST_DATA_HANDLER_TYPE, 77) \
+      V(FIRST_TEMPLATE_INFO_TYPE, 78) \
+        V(FUNCTION_TEMPLATE_INFO_TYPE, 78) \
+        V(OBJECT_TEMPLATE_INFO_TYPE, 79) \
+      V(LAST_TEMPLATE_INFO_TYPE, 79) \
+      V(FIRST_TUPLE2_TYPE, 80) \
+        V(TUPLE2_TYPE, 80) \
+        V(TUPLE3_TYPE, 81) \
+      V(LAST_TUPLE2_TYPE, 81) \
+      V(ACCESS_CHECK_INFO_TYPE, 82) \
+      V(ACCESSOR_INFO_TYPE, 83) \
+      V(ACCESSOR_PAIR_TYPE, 84) \
+      V(ALIASED_ARGUMENTS_ENTRY_TYPE, 85) \
+      V(ALLOCATION_MEMENTO_TYPE, 86) \
+      V(ALLOCATION_SITE_TYPE, 87) \
+      V(ARRAY_BOILERPLATE_DESCRIPTION_TYPE, 88) \
+      V(ASM_WASM_DATA_TYPE, 89) \
+      V(ASYNC_GENERATOR_REQUEST_TYPE, 90) \
+      V(CALL_HANDLER_INFO_TYPE, 91) \
+      V(CLASS_POSITIONS_TYPE, 92) \
+      V(DEBUG_INFO_TYPE, 93) \
+      V(ENUM_CACHE_TYPE, 94) \
+      V(FEEDBACK_CELL_TYPE, 95) \
+      V(FUNCTION_TEMPLATE_RARE_DATA_TYPE, 96) \
+      V(INTERCEPTOR_INFO_TYPE, 97) \
+      V(INTERNAL_CLASS_TYPE, 98) \
+      V(INTERPRETER_DATA_TYPE, 99) \
+      V(PROMISE_CAPABILITY_TYPE, 100) \
+      V(PROMISE_REACTION_TYPE, 101) \
+      V(PROTOTYPE_INFO_TYPE, 102) \
+      V(SCRIPT_TYPE, 103) \
+      V(SMI_BOX_TYPE, 104) \
+      V(SMI_PAIR_TYPE, 105) \
+      V(SORT_STATE_TYPE, 106) \
+      V(SOURCE_POSITION_TABLE_WITH_FRAME_CACHE_TYPE, 107) \
+      V(SOURCE_TEXT_MODULE_INFO_ENTRY_TYPE, 108) \
+      V(STACK_FRAME_INFO_TYPE, 109) \
+      V(STACK_TRACE_FRAME_TYPE, 110) \
+      V(TEMPLATE_OBJECT_DESCRIPTION_TYPE, 111) \
+      V(WASM_CAPI_FUNCTION_DATA_TYPE, 112) \
+      V(WASM_DEBUG_INFO_TYPE, 113) \
+      V(WASM_EXCEPTION_TAG_TYPE, 114) \
+      V(WASM_EXPORTED_FUNCTION_DATA_TYPE, 115) \
+      V(WASM_INDIRECT_FUNCTION_TABLE_TYPE, 116) \
+      V(WASM_JS_FUNCTION_DATA_TYPE, 117) \
+    V(LAST_STRUCT_TYPE, 117) \
+    V(FIRST_FIXED_ARRAY_BASE_TYPE, 118) \
+      V(FIRST_FIXED_ARRAY_TYPE, 118) \
+        V(FIXED_ARRAY_TYPE, 118) \
+        V(FIRST_HASH_TABLE_TYPE, 119) \
+          V(HASH_TABLE_TYPE, 119) \
+          V(EPHEMERON_HASH_TABLE_TYPE, 120) \
+          V(GLOBAL_DICTIONARY_TYPE, 121) \
+          V(NAME_DICTIONARY_TYPE, 122) \
+          V(NUMBER_DICTIONARY_TYPE, 123) \
+          V(ORDERED_HASH_MAP_TYPE, 124) \
+          V(ORDERED_HASH_SET_TYPE, 125) \
+          V(ORDERED_NAME_DICTIONARY_TYPE, 126) \
+          V(SIMPLE_NUMBER_DICTIONARY_TYPE, 127) \
+          V(STRING_TABLE_TYPE, 128) \
+        V(LAST_HASH_TABLE_TYPE, 128) \
+        V(CLOSURE_FEEDBACK_CELL_ARRAY_TYPE, 129) \
+        V(OBJECT_BOILERPLATE_DESCRIPTION_TYPE, 130) \
+        V(SCOPE_INFO_TYPE, 131) \
+        V(SCRIPT_CONTEXT_TABLE_TYPE, 132) \
+      V(LAST_FIXED_ARRAY_TYPE, 132) \
+      V(BYTE_ARRAY_TYPE, 133) \
+      V(BYTECODE_ARRAY_TYPE, 134) \
+      V(FIXED_DOUBLE_ARRAY_TYPE, 135) \
+    V(LAST_FIXED_ARRAY_BASE_TYPE, 135) \
+    V(FIRST_CONTEXT_TYPE, 136) \
+      V(AWAIT_CONTEXT_TYPE, 136) \
+      V(BLOCK_CONTEXT_TYPE, 137) \
+      V(CATCH_CONTEXT_TYPE, 138) \
+      V(DEBUG_EVALUATE_CONTEXT_TYPE, 139) \
+      V(EVAL_CONTEXT_TYPE, 140) \
+      V(FUNCTION_CONTEXT_TYPE, 141) \
+      V(MODULE_CONTEXT_TYPE, 142) \
+      V(NATIVE_CONTEXT_TYPE, 143) \
+      V(SCRIPT_CONTEXT_TYPE, 144) \
+      V(WITH_CONTEXT_TYPE, 145) \
+    V(LAST_CONTEXT_TYPE, 145) \
+    V(FIRST_SMALL_ORDERED_HASH_TABLE_TYPE, 146) \
+      V(SMALL_ORDERED_HASH_MAP_TYPE, 146) \
+      V(SMALL_ORDERED_HASH_SET_TYPE, 147) \
+      V(SMALL_ORDERED_NAME_DICTIONARY_TYPE, 148) \
+    V(LAST_SMALL_ORDERED_HASH_TABLE_TYPE, 148) \
+    V(FIRST_UNCOMPILED_DATA_TYPE, 149) \
+      V(UNCOMPILED_DATA_WITH_PREPARSE_DATA_TYPE, 149) \
+      V(UNCOMPILED_DATA_WITHOUT_PREPARSE_DATA_TYPE, 150) \
+    V(LAST_UNCOMPILED_DATA_TYPE, 150) \
+    V(FIRST_WEAK_FIXED_ARRAY_TYPE, 151) \
+      V(WEAK_FIXED_ARRAY_TYPE, 151) \
+      V(TRANSITION_ARRAY_TYPE, 152) \
+    V(LAST_WEAK_FIXED_ARRAY_TYPE, 152) \
+    V(CELL_TYPE, 153) \
+    V(CODE_TYPE, 154) \
+    V(CODE_DATA_CONTAINER_TYPE, 155) \
+    V(DESCRIPTOR_ARRAY_TYPE, 156) \
+    V(EMBEDDER_DATA_ARRAY_TYPE, 157) \
+    V(FEEDBACK_METADATA_TYPE, 158) \
+    V(FEEDBACK_VECTOR_TYPE, 159) \
+    V(FILLER_TYPE, 160) \
+    V(FREE_SPACE_TYPE, 161) \
+    V(MAP_TYPE, 162) \
+    V(PREPARSE_DATA_TYPE, 163) \
+    V(PROPERTY_ARRAY_TYPE, 164) \
+    V(PROPERTY_CELL_TYPE, 165) \
+    V(SHARED_FUNCTION_INFO_TYPE, 166) \
+    V(WEAK_ARRAY_LIST_TYPE, 167) \
+    V(WEAK_CELL_TYPE, 168) \
+    V(FIRST_JS_RECEIVER_TYPE, 169) \
+      V(JS_PROXY_TYPE, 169) \
+      V(FIRST_JS_OBJECT_TYPE, 170) \
+        V(JS_OBJECT_TYPE, 1057) \
+        V(FIRST_JS_CUSTOM_ELEMENTS_OBJECT_TYPE, 170) \
+          V(FIRST_JS_SPECIAL_OBJECT_TYPE, 170) \
+            V(JS_GLOBAL_OBJECT_TYPE, 170) \
+            V(JS_GLOBAL_PROXY_TYPE, 171) \
+            V(JS_MODULE_NAMESPACE_TYPE, 172) \
+            V(JS_SPECIAL_API_OBJECT_TYPE, 1040) \
+          V(LAST_JS_SPECIAL_OBJECT_TYPE, 1040) \
+          V(JS_PRIMITIVE_WRAPPER_TYPE, 1041) \
+        V(LAST_JS_CUSTOM_ELEMENTS_OBJECT_TYPE, 1041) \
+        V(FIRST_JS_COLLECTION_ITERATOR_TYPE, 1042) \
+          V(FIRST_JS_MAP_ITERATOR_TYPE, 1042) \
+            V(JS_MAP_KEY_ITERATOR_TYPE, 1042) \
+            V(JS_MAP_KEY_VALUE_ITERATOR_TYPE, 1043) \
+            V(JS_MAP_VALUE_ITERATOR_TYPE, 1044) \
+          V(LAST_JS_MAP_ITERATOR_TYPE, 1044) \
+          V(FIRST_JS_SET_ITERATOR_TYPE, 1045) \
+            V(JS_SET_KEY_VALUE_ITERATOR_TYPE, 1045) \
+            V(JS_SET_VALUE_ITERATOR_TYPE, 1046) \
+          V(LAST_JS_SET_ITERATOR_TYPE, 1046) \
+        V(LAST_JS_COLLECTION_ITERATOR_TYPE, 1046) \
+        V(FIRST_JS_GENERATOR_OBJECT_TYPE, 1047) \
+          V(JS_GENERATOR_OBJECT_TYPE, 1047) \
+          V(JS_ASYNC_FUNCTION_OBJECT_TYPE, 1048) \
+          V(JS_ASYNC_GENERATOR_OBJECT_TYPE, 1049) \
+        V(LAST_JS_GENERATOR_OBJECT_TYPE, 1049) \
+        V(FIRST_JS_ARRAY_BUFFER_VIEW_TYPE, 1050) \
+          V(JS_DATA_VIEW_TYPE, 1050) \
+          V(JS_TYPED_ARRAY_TYPE, 1051) \
+        V(LAST_JS_ARRAY_BUFFER_VIEW_TYPE, 1051) \
+        V(FIRST_JS_COLLECTION_TYPE, 1052) \
+          V(JS_MAP_TYPE, 1052) \
+          V(JS_SET_TYPE, 1053) \
+        V(LAST_JS_COLLECTION_TYPE, 1053) \
+        V(FIRST_JS_WEAK_COLLECTION_TYPE, 1054) \
+          V(JS_WEAK_MAP_TYPE, 1054) \
+          V(JS_WEAK_SET_TYPE, 1055) \
+        V(LAST_JS_WEAK_COLLECTION_TYPE, 1055) \
+        V(JS_API_OBJECT_TYPE, 1056) \
+        V(JS_ARGUMENTS_OBJECT_TYPE, 1058) \
+        V(JS_ARRAY_TYPE, 1059) \
+        V(JS_ARRAY_BUFFER_TYPE, 1060) \
+        V(JS_ARRAY_ITERATOR_TYPE, 1061) \
+        V(JS_ASYNC_FROM_SYNC_ITERATOR_TYPE, 1062) \
+        V(JS_CONTEXT_EXTENSION_OBJECT_TYPE, 1063) \
+        V(JS_DATE_TYPE, 1064) \
+        V(JS_ERROR_TYPE, 1065) \
+        V(JS_FINALIZATION_GROUP_TYPE, 1066) \
+        V(JS_FINALIZATION_GROUP_CLEANUP_ITERATOR_TYPE, 1067) \
+        V(JS_MESSAGE_OBJECT_TYPE, 1068) \
+        V(JS_PROMISE_TYPE, 1069) \
+        V(JS_REG_EXP_TYPE, 1070) \
+        V(JS_REG_EXP_STRING_ITERATOR_TYPE, 1071) \
+        V(JS_STRING_ITERATOR_TYPE, 1072) \
+        V(JS_WEAK_REF_TYPE, 1073) \
+        V(WASM_EXCEPTION_OBJECT_TYPE, 1074) \
+        V(WASM_GLOBAL_OBJECT_TYPE, 1075) \
+        V(WASM_INSTANCE_OBJECT_TYPE, 1076) \
+        V(WASM_MEMORY_OBJECT_TYPE, 1077) \
+        V(WASM_MODULE_OBJECT_TYPE, 1078) \
+        V(WASM_TABLE_OBJECT_TYPE, 1079) \
+        V(FIRST_JS_FUNCTION_OR_BOUND_FUNCTION_TYPE, 1080) \
+          V(JS_BOUND_FUNCTION_TYPE, 1080) \
+          V(JS_FUNCTION_TYPE, 1081) \
+        V(LAST_JS_FUNCTION_OR_BOUND_FUNCTION_TYPE, 1081) \
+      V(LAST_JS_OBJECT_TYPE, 1081) \
+    V(LAST_JS_RECEIVER_TYPE, 1081) \
+  V(LAST_HEAP_OBJECT_TYPE, 1081) \
+
+
+// Instance types for all classes except for those that use InstanceType as flags.
+#define TORQUE_ASSIGNED_INSTANCE_TYPE_LIST(V) \
+  V(SYMBOL_TYPE) \
+  V(BIG_INT_BASE_TYPE) \
+  V(HEAP_NUMBER_TYPE) \
+  V(ODDBALL_TYPE) \
+  V(SOURCE_TEXT_MODULE_TYPE) \
+  V(SYNTHETIC_MODULE_TYPE) \
+  V(FOREIGN_TYPE) \
+  V(PROMISE_FULFILL_REACTION_JOB_TASK_TYPE) \
+  V(PROMISE_REJECT_REACTION_JOB_TASK_TYPE) \
+  V(CALLABLE_TASK_TYPE) \
+  V(CALLBACK_TASK_TYPE) \
+  V(PROMISE_RESOLVE_THENABLE_JOB_TASK_TYPE) \
+  V(LOAD_HANDLER_TYPE) \
+  V(STORE_HANDLER_TYPE) \
+  V(FUNCTION_TEMPLATE_INFO_TYPE) \
+  V(OBJECT_TEMPLATE_INFO_TYPE) \
+  V(TUPLE2_TYPE) \
+  V(TUPLE3_TYPE) \
+  V(ACCESS_CHECK_INFO_TYPE) \
+  V(ACCESSOR_INFO_TYPE) \
+  V(ACCESSOR_PAIR_TYPE) \
+  V(ALIASED_ARGUMENTS_ENTRY_TYPE) \
+  V(ALLOCATION_MEMENTO_TYPE) \
+  V(ALLOCATION_SITE_TYPE) \
+  V(ARRAY_BOILERPLATE_DESCRIPTION_TYPE) \
+  V(ASM_WASM_DATA_TYPE) \
+  V(ASYNC_GENERATOR_REQUEST_TYPE) \
+  V(CALL_HANDLER_INFO_TYPE) \
+  V(CLASS_POSITIONS_TYPE) \
+  V(DEBUG_INFO_TYPE) \
+  V(ENUM_CACHE_TYPE) \
+  V(FEEDBACK_CELL_TYPE) \
+  V(FUNCTION_TEMPLATE_RARE_DATA_TYPE) \
+  V(INTERCEPTOR_INFO_TYPE) \
+  V(INTERNAL_CLASS_TYPE) \
+  V(INTERPRETER_DATA_TYPE) \
+  V(PROMISE_CAPABILITY_TYPE) \
+  V(PROMISE_REACTION_TYPE) \
+  V(PROTOTYPE_INFO_TYPE) \
+  V(SCRIPT_TYPE) \
+  V(SMI_BOX_TYPE) \
+  V(SMI_PAIR_TYPE) \
+  V(SORT_STATE_TYPE) \
+  V(SOURCE_POSITION_TABLE_WITH_FRAME_CACHE_TYPE) \
+  V(SOURCE_TEXT_MODULE_INFO_ENTRY_TYPE) \
+  V(STACK_FRAME_INFO_TYPE) \
+  V(STACK_TRACE_FRAME_TYPE) \
+  V(TEMPLATE_OBJECT_DESCRIPTION_TYPE) \
+  V(WASM_CAPI_FUNCTION_DATA_TYPE) \
+  V(WASM_DEBUG_INFO_TYPE) \
+  V(WASM_EXCEPTION_TAG_TYPE) \
+  V(WASM_EXPORTED_FUNCTION_DATA_TYPE) \
+  V(WASM_INDIRECT_FUNCTION_TABLE_TYPE) \
+  V(WASM_JS_FUNCTION_DATA_TYPE) \
+  V(FIXED_ARRAY_TYPE) \
+  V(HASH_TABLE_TYPE) \
+  V(EPHEMERON_HASH_TABLE_TYPE) \
+  V(GLOBAL_DICTIONARY_TYPE) \
+  V(NAME_DICTIONARY_TYPE) \
+  V(NUMBER_DICTIONARY_TYPE) \
+  V(ORDERED_HASH_MAP_TYPE) \
+  V(ORDERED_HASH_SET_TYPE) \
+  V(ORDERED_NAME_DICTIONARY_TYPE) \
+  V(SIMPLE_NUMBER_DICTIONARY_TYPE) \
+  V(STRING_TABLE_TYPE) \
+  V(CLOSURE_FEEDBACK_CELL_ARRAY_TYPE) \
+  V(OBJECT_BOILERPLATE_DESCRIPTION_TYPE) \
+  V(SCOPE_INFO_TYPE) \
+  V(SCRIPT_CONTEXT_TABLE_TYPE) \
+  V(BYTE_ARRAY_TYPE) \
+  V(BYTECODE_ARRAY_TYPE) \
+  V(FIXED_DOUBLE_ARRAY_TYPE) \
+  V(AWAIT_CONTEXT_TYPE) \
+  V(BLOCK_CONTEXT_TYPE) \
+  V(CATCH_CONTEXT_TYPE) \
+  V(DEBUG_EVALUATE_CONTEXT_TYPE) \
+  V(EVAL_CONTEXT_TYPE) \
+  V(FUNCTION_CONTEXT_TYPE) \
+  V(MODULE_CONTEXT_TYPE) \
+  V(NATIVE_CONTEXT_TYPE) \
+  V(SCRIPT_CONTEXT_TYPE) \
+  V(WITH_CONTEXT_TYPE) \
+  V(SMALL_ORDERED_HASH_MAP_TYPE) \
+  V(SMALL_ORDERED_HASH_SET_TYPE) \
+  V(SMALL_ORDERED_NAME_DICTIONARY_TYPE) \
+  V(UNCOMPILED_DATA_WITH_PREPARSE_DATA_TYPE) \
+  V(UNCOMPILED_DATA_WITHOUT_PREPARSE_DATA_TYPE) \
+  V(WEAK_FIXED_ARRAY_TYPE) \
+  V(TRANSITION_ARRAY_TYPE) \
+  V(CELL_TYPE) \
+  V(CODE_TYPE) \
+  V(CODE_DATA_CONTAINER_TYPE) \
+  V(DESCRIPTOR_ARRAY_TYPE) \
+  V(EMBEDDER_DATA_ARRAY_TYPE) \
+  V(FEEDBACK_METADATA_TYPE) \
+  V(FEEDBACK_VECTOR_TYPE) \
+  V(FILLER_TYPE) \
+  V(FREE_SPACE_TYPE) \
+  V(MAP_TYPE) \
+  V(PREPARSE_DATA_TYPE) \
+  V(PROPERTY_ARRAY_TYPE) \
+  V(PROPERTY_CELL_TYPE) \
+  V(SHARED_FUNCTION_INFO_TYPE) \
+  V(WEAK_ARRAY_LIST_TYPE) \
+  V(WEAK_CELL_TYPE) \
+  V(JS_PROXY_TYPE) \
+  V(JS_OBJECT_TYPE) \
+  V(JS_GLOBAL_OBJECT_TYPE) \
+  V(JS_GLOBAL_PROXY_TYPE) \
+  V(JS_MODULE_NAMESPACE_TYPE) \
+  V(JS_SPECIAL_API_OBJECT_TYPE) \
+  V(JS_PRIMITIVE_WRAPPER_TYPE) \
+  V(JS_MAP_KEY_ITERATOR_TYPE) \
+  V(JS_MAP_KEY_VALUE_ITERATOR_TYPE) \
+  V(JS_MAP_VALUE_ITERATOR_TYPE) \
+  V(JS_SET_KEY_VALUE_ITERATOR_TYPE) \
+  V(JS_SET_VALUE_ITERATOR_TYPE) \
+  V(JS_GENERATOR_OBJECT_TYPE) \
+  V(JS_ASYNC_FUNCTION_OBJECT_TYPE) \
+  V(JS_ASYNC_GENERATOR_OBJECT_TYPE) \
+  V(JS_DATA_VIEW_TYPE) \
+  V(JS_TYPED_ARRAY_TYPE) \
+  V(JS_MAP_TYPE) \
+  V(JS_SET_TYPE) \
+  V(JS_WEAK_MAP_TYPE) \
+  V(JS_WEAK_SET_TYPE) \
+  V(JS_API_OBJECT_TYPE) \
+  V(JS_ARGUMENTS_OBJECT_TYPE) \
+  V(JS_ARRAY_TYPE) \
+  V(JS_ARRAY_BUFFER_TYPE) \
+  V(JS_ARRAY_ITERATOR_TYPE) \
+  V(JS_ASYNC_FROM_SYNC_ITERATOR_TYPE) \
+  V(JS_CONTEXT_EXTENSION_OBJECT_TYPE) \
+  V(JS_DATE_TYPE) \
+  V(JS_ERROR_TYPE) \
+  V(JS_FINALIZATION_GROUP_TYPE) \
+  V(JS_FINALIZATION_GROUP_CLEANUP_ITERATOR_TYPE) \
+  V(JS_MESSAGE_OBJECT_TYPE) \
+  V(JS_PROMISE_TYPE) \
+  V(JS_REG_EXP_TYPE) \
+  V(JS_REG_EXP_STRING_ITERATOR_TYPE) \
+  V(JS_STRING_ITERATOR_TYPE) \
+  V(JS_WEAK_REF_TYPE) \
+  V(WASM_EXCEPTION_OBJECT_TYPE) \
+  V(WASM_GLOBAL_OBJECT_TYPE) \
+  V(WASM_INSTANCE_OBJECT_TYPE) \
+  V(WASM_MEMORY_OBJECT_TYPE) \
+  V(WASM_MODULE_OBJECT_TYPE) \
+  V(WASM_TABLE_OBJECT_TYPE) \
+  V(JS_BOUND_FUNCTION_TYPE) \
+  V(JS_FUNCTION_TYPE) \
+
+
+// Instance types for Torque-internal classes.
+#define TORQUE_INTERNAL_INSTANCE_TYPES(V) \
+  V(SORT_STATE_TYPE) \
+  V(INTERNAL_CLASS_TYPE) \
+  V(SMI_PAIR_TYPE) \
+  V(SMI_BOX_TYPE) \
+
+
+// Struct list entries for Torque-internal classes.
+#define TORQUE_STRUCT_LIST_GENERATOR(V, _) \
+  V(_, SORT_STATE_TYPE, SortState, sort_state) \
+  V(_, INTERNAL_CLASS_TYPE, InternalClass, internal_class) \
+  V(_, SMI_PAIR_TYPE, SmiPair, smi_pair) \
+  V(_, SMI_BOX_TYPE, SmiBox, smi_box) \
+
+#endif  // V8_GEN_TORQUE_GENERATED_INSTANCE_TYPES_TQ_H_
@@ -0,0 +1,19 @@
+#ifndef V8_GEN_TORQUE_GENERATED_INTERNAL_CLASS_DEFINITIONS_TQ_INL_H_
+#define V8_GEN_TORQUE_GENERATED_INTERNAL_CLASS_DEFINITIONS_TQ_INL_H_
+
+#include "torque-generated/internal-class-definitions-tq.h"
+#include "torque-generated/class-definitions-tq-inl.h"
+
+// Has to be the last include (doesn't have include guards):
+#include "src/objects/object-macros.h"
+namespace v8 {
+namespace internal {
+TQ_OBJECT_CONSTRUCTORS_IMPL(SortState)
+TQ_OBJECT_CONSTRUCTORS_IMPL(InternalClass)
+TQ_OBJECT_CONSTRUCTORS_IMPL(SmiPair)
+TQ_OBJECT_CONSTRUCTORS_IMPL(SmiBox)
+}  // namespace internal
+}  // namespace v8
+
+#include "src/objects/object-macros-undef.h"
+#endif  // V8_GEN_TORQUE_GENERATED_INTERNAL_CLASS_DEFINITIONS_TQ_INL_H_
@@ -0,0 +1,296 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := libnode
+### Rules for action "node_js2c":
+quiet_cmd__root_repo_node_gyp_libnode_target_node_js2c = ACTION _root_repo_node_gyp_libnode_target_node_js2c $@
+cmd__root_repo_node_gyp_libnode_target_node_js2c = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/.; mkdir -p $(obj)/gen; python tools/js2c.py lib/internal/bootstrap/environment.js lib/internal/bootstrap/loaders.js lib/internal/bootstrap/node.js lib/internal/bootstrap/pre_execution.js lib/internal/bootstrap/switches/does_own_process_state.js lib/internal/bootstrap/switches/does_not_own_process_state.js lib/internal/bootstrap/switches/is_main_thread.js lib/internal/bootstrap/switches/is_not_main_thread.js lib/internal/per_context/primordials.js lib/internal/per_context/domexception.js lib/internal/per_context/messageport.js lib/async_hooks.js lib/assert.js lib/buffer.js lib/child_process.js lib/console.js lib/constants.js lib/crypto.js lib/cluster.js lib/dgram.js lib/dns.js lib/domain.js lib/events.js lib/fs.js lib/fs/promises.js lib/http.js lib/http2.js lib/_http_agent.js lib/_http_client.js lib/_http_common.js lib/_http_incoming.js lib/_http_outgoing.js lib/_http_server.js lib/https.js lib/inspector.js lib/module.js lib/net.js lib/os.js lib/path.js lib/perf_hooks.js lib/process.js lib/punycode.js lib/querystring.js lib/readline.js lib/repl.js lib/stream.js lib/_stream_readable.js lib/_stream_writable.js lib/_stream_duplex.js lib/_stream_transform.js lib/_stream_passthrough.js lib/_stream_wrap.js lib/string_decoder.js lib/sys.js lib/timers.js lib/tls.js lib/_tls_common.js lib/_tls_wrap.js lib/trace_events.js lib/tty.js lib/url.js lib/util.js lib/v8.js lib/vm.js lib/wasi.js lib/worker_threads.js lib/zlib.js lib/internal/assert.js lib/internal/assert/assertion_error.js lib/internal/async_hooks.js lib/internal/buffer.js lib/internal/cli_table.js lib/internal/child_process.js lib/internal/child_process/serialization.js lib/internal/cluster/child.js lib/internal/cluster/master.js lib/internal/cluster/round_robin_handle.js lib/internal/cluster/shared_handle.js lib/internal/cluster/utils.js lib/internal/cluster/worker.js lib/internal/console/constructor.js lib/internal/console/global.js lib/internal/crypto/certificate.js lib/internal/crypto/cipher.js lib/internal/crypto/diffiehellman.js lib/internal/crypto/hash.js lib/internal/crypto/keygen.js lib/internal/crypto/keys.js lib/internal/crypto/pbkdf2.js lib/internal/crypto/random.js lib/internal/crypto/scrypt.js lib/internal/crypto/sig.js lib/internal/crypto/util.js lib/internal/constants.js lib/internal/dgram.js lib/internal/dns/promises.js lib/internal/dns/utils.js lib/internal/dtrace.js lib/internal/encoding.js lib/internal/errors.js lib/internal/error-serdes.js lib/internal/fixed_queue.js lib/internal/freelist.js lib/internal/freeze_intrinsics.js lib/internal/fs/dir.js lib/internal/fs/promises.js lib/internal/fs/read_file_context.js lib/internal/fs/rimraf.js lib/internal/fs/streams.js lib/internal/fs/sync_write_stream.js lib/internal/fs/utils.js lib/internal/fs/watchers.js lib/internal/http.js lib/internal/heap_utils.js lib/internal/idna.js lib/internal/inspector_async_hook.js lib/internal/js_stream_socket.js lib/internal/linkedlist.js lib/internal/main/check_syntax.js lib/internal/main/eval_string.js lib/internal/main/eval_stdin.js lib/internal/main/inspect.js lib/internal/main/print_help.js lib/internal/main/prof_process.js lib/internal/main/repl.js lib/internal/main/run_main_module.js lib/internal/main/run_third_party_main.js lib/internal/main/worker_thread.js lib/internal/modules/run_main.js lib/internal/modules/cjs/helpers.js lib/internal/modules/cjs/loader.js lib/internal/modules/esm/loader.js lib/internal/modules/esm/create_dynamic_module.js lib/internal/modules/esm/get_format.js lib/internal/modules/esm/get_source.js lib/internal/modules/esm/module_job.js lib/internal/modules/esm/module_map.js lib/internal/modules/esm/resolve.js lib/internal/modules/esm/transform_source.js lib/internal/modules/esm/translators.js lib/internal/net.js lib/internal/options.js lib/internal/policy/manifest.js lib/internal/policy/sri.js lib/internal/priority_queue.js lib/internal/process/esm_loader.js lib/internal/process/execution.js lib/internal/process/per_thread.js lib/internal/process/policy.js lib/internal/process/promises.js lib/internal/process/warning.js lib/internal/process/worker_thread_only.js lib/internal/process/report.js lib/internal/process/signal.js lib/internal/process/task_queues.js lib/internal/querystring.js lib/internal/readline/utils.js lib/internal/repl.js lib/internal/repl/await.js lib/internal/repl/history.js lib/internal/repl/utils.js lib/internal/socket_list.js lib/internal/source_map/prepare_stack_trace.js lib/internal/source_map/source_map.js lib/internal/source_map/source_map_cache.js lib/internal/test/binding.js lib/internal/timers.js lib/internal/tls.js lib/internal/trace_events_async_hooks.js lib/internal/tty.js lib/internal/url.js lib/internal/util.js lib/internal/util/comparisons.js lib/internal/util/debuglog.js lib/internal/util/inspect.js lib/internal/util/inspector.js lib/internal/util/types.js lib/internal/http2/core.js lib/internal/http2/compat.js lib/internal/http2/util.js lib/internal/v8_prof_polyfill.js lib/internal/v8_prof_processor.js lib/internal/validators.js lib/internal/stream_base_commons.js lib/internal/vm/module.js lib/internal/worker.js lib/internal/worker/io.js lib/internal/watchdog.js lib/internal/streams/lazy_transform.js lib/internal/streams/async_iterator.js lib/internal/streams/buffer_list.js lib/internal/streams/duplexpair.js lib/internal/streams/from.js lib/internal/streams/legacy.js lib/internal/streams/destroy.js lib/internal/streams/state.js lib/internal/streams/pipeline.js lib/internal/streams/end-of-stream.js deps/v8/tools/splaytree.js deps/v8/tools/codemap.js deps/v8/tools/consarray.js deps/v8/tools/csvparser.js deps/v8/tools/profile.js deps/v8/tools/profile_view.js deps/v8/tools/logreader.js deps/v8/tools/arguments.js deps/v8/tools/tickprocessor.js deps/v8/tools/SourceMap.js deps/v8/tools/tickprocessor-driver.js deps/node-inspect/lib/_inspect.js deps/node-inspect/lib/internal/inspect_client.js deps/node-inspect/lib/internal/inspect_repl.js deps/acorn/acorn/dist/acorn.js deps/acorn/acorn-walk/dist/walk.js deps/acorn-plugins/acorn-class-fields/index.js deps/acorn-plugins/acorn-numeric-separator/index.js deps/acorn-plugins/acorn-private-class-elements/index.js deps/acorn-plugins/acorn-private-methods/index.js deps/acorn-plugins/acorn-static-class-features/index.js config.gypi --target "$(obj)/gen/node_javascript.cc"
+
+$(obj)/gen/node_javascript.cc: obj := $(abs_obj)
+$(obj)/gen/node_javascript.cc: builddir := $(abs_builddir)
+$(obj)/gen/node_javascript.cc: TOOLSET := $(TOOLSET)
+$(obj)/gen/node_javascript.cc: $(srcdir)/tools/js2c.py $(srcdir)/lib/internal/bootstrap/environment.js $(srcdir)/lib/internal/bootstrap/loaders.js $(srcdir)/lib/internal/bootstrap/node.js $(srcdir)/lib/internal/bootstrap/pre_execution.js $(srcdir)/lib/internal/bootstrap/switches/does_own_process_state.js $(srcdir)/lib/internal/bootstrap/switches/does_not_own_process_state.js $(srcdir)/lib/internal/bootstrap/switches/is_main_thread.js $(srcdir)/lib/internal/bootstrap/switches/is_not_main_thread.js $(srcdir)/lib/internal/per_context/primordials.js $(srcdir)/lib/internal/per_context/domexception.js $(srcdir)/lib/internal/per_context/messageport.js $(srcdir)/lib/async_hooks.js $(srcdir)/lib/assert.js $(srcdir)/lib/buffer.js $(srcdir)/lib/child_process.js $(srcdir)/lib/console.js $(srcdir)/lib/constants.js $(srcdir)/lib/crypto.js $(srcdir)/lib/cluster.js $(srcdir)/lib/dgram.js $(srcdir)/lib/dns.js $(srcdir)/lib/domain.js $(srcdir)/lib/events.js $(srcdir)/lib/fs.js $(srcdir)/lib/fs/promises.js $(srcdir)/lib/http.js $(srcdir)/lib/http2.js $(srcdir)/lib/_http_agent.js $(srcdir)/lib/_http_client.js $(srcdir)/lib/_http_common.js $(srcdir)/lib/_http_incoming.js $(srcdir)/lib/_http_outgoing.js $(srcdir)/lib/_http_server.js $(srcdir)/lib/https.js $(srcdir)/lib/inspector.js $(srcdir)/lib/module.js $(srcdir)/lib/net.js $(srcdir)/lib/os.js $(srcdir)/lib/path.js $(srcdir)/lib/perf_hooks.js $(srcdir)/lib/process.js $(srcdir)/lib/punycode.js $(srcdir)/lib/querystring.js $(srcdir)/lib/readline.js $(srcdir)/lib/repl.js $(srcdir)/lib/stream.js $(srcdir)/lib/_stream_readable.js $(srcdir)/lib/_stream_writable.js $(srcdir)/lib/_stream_duplex.js $(srcdir)/lib/_stream_transform.js $(srcdir)/lib/_stream_passthrough.js $(srcdir)/lib/_stream_wrap.js $(srcdir)/lib/string_decoder.js $(srcdir)/lib/sys.js $(srcdir)/lib/timers.js $(srcdir)/lib/tls.js $(srcdir)/lib/_tls_common.js $(srcdir)/lib/_tls_wrap.js $(srcdir)/lib/trace_events.js $(srcdir)/lib/tty.js $(srcdir)/lib/url.js $(srcdir)/lib/util.js $(srcdir)/lib/v8.js $(srcdir)/lib/vm.js $(srcdir)/lib/wasi.js $(srcdir)/lib/worker_threads.js $(srcdir)/lib/zlib.js $(srcdir)/lib/internal/assert.js $(srcdir)/lib/internal/assert/assertion_error.js $(srcdir)/lib/internal/async_hooks.js $(srcdir)/lib/internal/buffer.js $(srcdir)/lib/internal/cli_table.js $(srcdir)/lib/internal/child_process.js $(srcdir)/lib/internal/child_process/serialization.js $(srcdir)/lib/internal/cluster/child.js $(srcdir)/lib/internal/cluster/master.js $(srcdir)/lib/internal/cluster/round_robin_handle.js $(srcdir)/lib/internal/cluster/shared_handle.js $(srcdir)/lib/internal/cluster/utils.js $(srcdir)/lib/internal/cluster/worker.js $(srcdir)/lib/internal/console/constructor.js $(srcdir)/lib/internal/console/global.js $(srcdir)/lib/internal/crypto/certificate.js $(srcdir)/lib/internal/crypto/cipher.js $(srcdir)/lib/internal/crypto/diffiehellman.js $(srcdir)/lib/internal/crypto/hash.js $(srcdir)/lib/internal/crypto/keygen.js $(srcdir)/lib/internal/crypto/keys.js $(srcdir)/lib/internal/crypto/pbkdf2.js $(srcdir)/lib/internal/crypto/random.js $(srcdir)/lib/internal/crypto/scrypt.js $(srcdir)/lib/internal/crypto/sig.js $(srcdir)/lib/internal/crypto/util.js $(srcdir)/lib/internal/constants.js $(srcdir)/lib/internal/dgram.js $(srcdir)/lib/internal/dns/promises.js $(srcdir)/lib/internal/dns/utils.js $(srcdir)/lib/internal/dtrace.js $(srcdir)/lib/internal/encoding.js $(srcdir)/lib/internal/errors.js $(srcdir)/lib/internal/error-serdes.js $(srcdir)/lib/internal/fixed_queue.js $(srcdir)/lib/internal/freelist.js $(srcdir)/lib/internal/freeze_intrinsics.js $(srcdir)/lib/internal/fs/dir.js $(srcdir)/lib/internal/fs/promises.js $(srcdir)/lib/internal/fs/read_file_context.js $(srcdir)/lib/internal/fs/rimraf.js $(srcdir)/lib/internal/fs/streams.js $(srcdir)/lib/internal/fs/sync_write_stream.js $(srcdir)/lib/internal/fs/utils.js $(srcdir)/lib/internal/fs/watchers.js $(srcdir)/lib/internal/http.js $(srcdir)/lib/internal/heap_utils.js $(srcdir)/lib/internal/idna.js $(srcdir)/lib/internal/inspector_async_hook.js $(srcdir)/lib/internal/js_stream_socket.js $(srcdir)/lib/internal/linkedlist.js $(srcdir)/lib/internal/main/check_syntax.js $(srcdir)/lib/internal/main/eval_string.js $(srcdir)/lib/internal/main/eval_stdin.js $(srcdir)/lib/internal/main/inspect.js $(srcdir)/lib/internal/main/print_help.js $(srcdir)/lib/internal/main/prof_process.js $(srcdir)/lib/internal/main/repl.js $(srcdir)/lib/internal/main/run_main_module.js $(srcdir)/lib/internal/main/run_third_party_main.js $(srcdir)/lib/internal/main/worker_thread.js $(srcdir)/lib/internal/modules/run_main.js $(srcdir)/lib/internal/modules/cjs/helpers.js $(srcdir)/lib/internal/modules/cjs/loader.js $(srcdir)/lib/internal/modules/esm/loader.js $(srcdir)/lib/internal/modules/esm/create_dynamic_module.js $(srcdir)/lib/internal/modules/esm/get_format.js $(srcdir)/lib/internal/modules/esm/get_source.js $(srcdir)/lib/internal/modules/esm/module_job.js $(srcdir)/lib/internal/modules/esm/module_map.js $(srcdir)/lib/internal/modules/esm/resolve.js $(srcdir)/lib/internal/modules/esm/transform_source.js $(srcdir)/lib/internal/modules/esm/translators.js $(srcdir)/lib/internal/net.js $(srcdir)/lib/internal/options.js $(srcdir)/lib/internal/policy/manifest.js $(srcdir)/lib/internal/policy/sri.js $(srcdir)/lib/internal/priority_queue.js $(srcdir)/lib/internal/process/esm_loader.js $(srcdir)/lib/internal/process/execution.js $(srcdir)/lib/internal/process/per_thread.js $(srcdir)/lib/internal/process/policy.js $(srcdir)/lib/internal/process/promises.js $(srcdir)/lib/internal/process/warning.js $(srcdir)/lib/internal/process/worker_thread_only.js $(srcdir)/lib/internal/process/report.js $(srcdir)/lib/internal/process/signal.js $(srcdir)/lib/internal/process/task_queues.js $(srcdir)/lib/internal/querystring.js $(srcdir)/lib/internal/readline/utils.js $(srcdir)/lib/internal/repl.js $(srcdir)/lib/internal/repl/await.js $(srcdir)/lib/internal/repl/history.js $(srcdir)/lib/internal/repl/utils.js $(srcdir)/lib/internal/socket_list.js $(srcdir)/lib/internal/source_map/prepare_stack_trace.js $(srcdir)/lib/internal/source_map/source_map.js $(srcdir)/lib/internal/source_map/source_map_cache.js $(srcdir)/lib/internal/test/binding.js $(srcdir)/lib/internal/timers.js $(srcdir)/lib/internal/tls.js $(srcdir)/lib/internal/trace_events_async_hooks.js $(srcdir)/lib/internal/tty.js $(srcdir)/lib/internal/url.js $(srcdir)/lib/internal/util.js $(srcdir)/lib/internal/util/comparisons.js $(srcdir)/lib/internal/util/debuglog.js $(srcdir)/lib/internal/util/inspect.js $(srcdir)/lib/internal/util/inspector.js $(srcdir)/lib/internal/util/types.js $(srcdir)/lib/internal/http2/core.js $(srcdir)/lib/internal/http2/compat.js $(srcdir)/lib/internal/http2/util.js $(srcdir)/lib/internal/v8_prof_polyfill.js $(srcdir)/lib/internal/v8_prof_processor.js $(srcdir)/lib/internal/validators.js $(srcdir)/lib/internal/stream_base_commons.js $(srcdir)/lib/internal/vm/module.js $(srcdir)/lib/internal/worker.js $(srcdir)/lib/internal/worker/io.js $(srcdir)/lib/internal/watchdog.js $(srcdir)/lib/internal/streams/lazy_transform.js $(srcdir)/lib/internal/streams/async_iterator.js $(srcdir)/lib/internal/streams/buffer_list.js $(srcdir)/lib/internal/streams/duplexpair.js $(srcdir)/lib/internal/streams/from.js $(srcdir)/lib/internal/streams/legacy.js $(srcdir)/lib/internal/streams/destroy.js $(srcdir)/lib/internal/streams/state.js $(srcdir)/lib/internal/streams/pipeline.js $(srcdir)/lib/internal/streams/end-of-stream.js $(srcdir)/deps/v8/tools/splaytree.js $(srcdir)/deps/v8/tools/codemap.js $(srcdir)/deps/v8/tools/consarray.js $(srcdir)/deps/v8/tools/csvparser.js $(srcdir)/deps/v8/tools/profile.js $(srcdir)/deps/v8/tools/profile_view.js $(srcdir)/deps/v8/tools/logreader.js $(srcdir)/deps/v8/tools/arguments.js $(srcdir)/deps/v8/tools/tickprocessor.js $(srcdir)/deps/v8/tools/SourceMap.js $(srcdir)/deps/v8/tools/tickprocessor-driver.js $(srcdir)/deps/node-inspect/lib/_inspect.js $(srcdir)/deps/node-inspect/lib/internal/inspect_client.js $(srcdir)/deps/node-inspect/lib/internal/inspect_repl.js $(srcdir)/deps/acorn/acorn/dist/acorn.js $(srcdir)/deps/acorn/acorn-walk/dist/walk.js $(srcdir)/deps/acorn-plugins/acorn-class-fields/index.js $(srcdir)/deps/acorn-plugins/acorn-numeric-separator/index.js $(srcdir)/deps/acorn-plugins/acorn-private-class-elements/index.js $(srcdir)/deps/acorn-plugins/acorn-private-methods/index.js $(srcdir)/deps/acorn-plugins/acorn-static-class-features/index.js $(srcdir)/config.gypi FORCE_DO_CMD
+	$(call do_cmd,_root_repo_node_gyp_libnode_target_node_js2c)
+
+all_deps += $(obj)/gen/node_javascript.cc
+action__root_repo_node_gyp_libnode_target_node_js2c_outputs := $(obj)/gen/node_javascript.cc
+
+
+DEFS_Debug := \
+	'-DV8_DEPRECATION_WARNINGS' \
+	'-DV8_IMMINENT_DEPRECATION_WARNINGS' \
+	'-D__STDC_FORMAT_MACROS' \
+	'-DOPENSSL_NO_PINSHARED' \
+	'-DOPENSSL_THREADS' \
+	'-DNODE_ARCH="x64"' \
+	'-DNODE_PLATFORM="linux"' \
+	'-DNODE_WANT_INTERNALS=1' \
+	'-DV8_DEPRECATION_WARNINGS=1' \
+	'-DNODE_OPENSSL_SYSTEM_CERT_PATH=""' \
+	'-DHAVE_INSPECTOR=0' \
+	'-DNODE_REPORT' \
+	'-DNODE_ENABLE_LARGE_CODE_PAGES=1' \
+	'-D__POSIX__' \
+	'-DNODE_USE_V8_PLATFORM=1' \
+	'-DHAVE_OPENSSL=1' \
+	'-D_LARGEFILE_SOURCE' \
+	'-D_FILE_OFFSET_BITS=64' \
+	'-D_POSIX_C_SOURCE=200112' \
+	'-DNGHTTP2_STATICLIB' \
+	'-DDEBUG' \
+	'-D_DEBUG' \
+	'-DV8_ENABLE_CHECKS'
+
+# Flags passed to all source files.
+CFLAGS_Debug := \
+	-Wall \
+	-Wextra \
+	-Wno-unused-parameter \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wno-unused-parameter \
+	-m64 \
+	-g \
+	-O0
+
+# Flags passed to only C files.
+CFLAGS_C_Debug :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Debug := \
+	-fno-rtti \
+	-fno-exceptions \
+	-std=gnu++1y
+
+INCS_Debug := \
+	-I$(srcdir)/src \
+	-I$(obj)/gen \
+	-I$(srcdir)/deps/histogram/src \
+	-I$(srcdir)/deps/uvwasi/include \
+	-I$(srcdir)/deps/v8/include \
+	-I$(srcdir)/deps/zlib \
+	-I$(srcdir)/deps/llhttp/include \
+	-I$(srcdir)/deps/cares/include \
+	-I$(srcdir)/deps/uv/include \
+	-I$(srcdir)/deps/nghttp2/lib/includes \
+	-I$(srcdir)/deps/brotli/c/include \
+	-I$(srcdir)/deps/openssl/openssl/include
+
+DEFS_Release := \
+	'-DV8_DEPRECATION_WARNINGS' \
+	'-DV8_IMMINENT_DEPRECATION_WARNINGS' \
+	'-D__STDC_FORMAT_MACROS' \
+	'-DOPENSSL_NO_PINSHARED' \
+	'-DOPENSSL_THREADS' \
+	'-DNODE_ARCH="x64"' \
+	'-DNODE_PLATFORM="linux"' \
+	'-DNODE_WANT_INTERNALS=1' \
+	'-DV8_DEPRECATION_WARNINGS=1' \
+	'-DNODE_OPENSSL_SYSTEM_CERT_PATH=""' \
+	'-DHAVE_INSPECTOR=0' \
+	'-DNODE_REPORT' \
+	'-DNODE_ENABLE_LARGE_CODE_PAGES=1' \
+	'-D__POSIX__' \
+	'-DNODE_USE_V8_PLATFORM=1' \
+	'-DHAVE_OPENSSL=1' \
+	'-D_LARGEFILE_SOURCE' \
+	'-D_FILE_OFFSET_BITS=64' \
+	'-D_POSIX_C_SOURCE=200112' \
+	'-DNGHTTP2_STATICLIB'
+
+# Flags passed to all source files.
+CFLAGS_Release := \
+	-Wall \
+	-Wextra \
+	-Wno-unused-parameter \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wno-unused-parameter \
+	-m64 \
+	-O3 \
+	-fno-omit-frame-pointer
+
+# Flags passed to only C files.
+CFLAGS_C_Release :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Release := \
+	-fno-rtti \
+	-fno-exceptions \
+	-std=gnu++1y
+
+INCS_Release := \
+	-I$(srcdir)/src \
+	-I$(obj)/gen \
+	-I$(srcdir)/deps/histogram/src \
+	-I$(srcdir)/deps/uvwasi/include \
+	-I$(srcdir)/deps/v8/include \
+	-I$(srcdir)/deps/zlib \
+	-I$(srcdir)/deps/llhttp/include \
+	-I$(srcdir)/deps/cares/include \
+	-I$(srcdir)/deps/uv/include \
+	-I$(srcdir)/deps/nghttp2/lib/includes \
+	-I$(srcdir)/deps/brotli/c/include \
+	-I$(srcdir)/deps/openssl/openssl/include
+
+OBJS := \
+	$(obj).target/$(TARGET)/src/api/async_resource.o \
+	$(obj).target/$(TARGET)/src/api/callback.o \
+	$(obj).target/$(TARGET)/src/api/encoding.o \
+	$(obj).target/$(TARGET)/src/api/environment.o \
+	$(obj).target/$(TARGET)/src/api/exceptions.o \
+	$(obj).target/$(TARGET)/src/api/hooks.o \
+	$(obj).target/$(TARGET)/src/api/utils.o \
+	$(obj).target/$(TARGET)/src/async_wrap.o \
+	$(obj).target/$(TARGET)/src/cares_wrap.o \
+	$(obj).target/$(TARGET)/src/connect_wrap.o \
+	$(obj).target/$(TARGET)/src/connection_wrap.o \
+	$(obj).target/$(TARGET)/src/debug_utils.o \
+	$(obj).target/$(TARGET)/src/env.o \
+	$(obj).target/$(TARGET)/src/fs_event_wrap.o \
+	$(obj).target/$(TARGET)/src/handle_wrap.o \
+	$(obj).target/$(TARGET)/src/heap_utils.o \
+	$(obj).target/$(TARGET)/src/js_native_api_v8.o \
+	$(obj).target/$(TARGET)/src/js_stream.o \
+	$(obj).target/$(TARGET)/src/module_wrap.o \
+	$(obj).target/$(TARGET)/src/node.o \
+	$(obj).target/$(TARGET)/src/node_api.o \
+	$(obj).target/$(TARGET)/src/node_binding.o \
+	$(obj).target/$(TARGET)/src/node_buffer.o \
+	$(obj).target/$(TARGET)/src/node_config.o \
+	$(obj).target/$(TARGET)/src/node_constants.o \
+	$(obj).target/$(TARGET)/src/node_contextify.o \
+	$(obj).target/$(TARGET)/src/node_credentials.o \
+	$(obj).target/$(TARGET)/src/node_dir.o \
+	$(obj).target/$(TARGET)/src/node_domain.o \
+	$(obj).target/$(TARGET)/src/node_env_var.o \
+	$(obj).target/$(TARGET)/src/node_errors.o \
+	$(obj).target/$(TARGET)/src/node_file.o \
+	$(obj).target/$(TARGET)/src/node_http_parser.o \
+	$(obj).target/$(TARGET)/src/node_http2.o \
+	$(obj).target/$(TARGET)/src/node_i18n.o \
+	$(obj).target/$(TARGET)/src/node_main_instance.o \
+	$(obj).target/$(TARGET)/src/node_messaging.o \
+	$(obj).target/$(TARGET)/src/node_metadata.o \
+	$(obj).target/$(TARGET)/src/node_native_module.o \
+	$(obj).target/$(TARGET)/src/node_native_module_env.o \
+	$(obj).target/$(TARGET)/src/node_options.o \
+	$(obj).target/$(TARGET)/src/node_os.o \
+	$(obj).target/$(TARGET)/src/node_perf.o \
+	$(obj).target/$(TARGET)/src/node_platform.o \
+	$(obj).target/$(TARGET)/src/node_postmortem_metadata.o \
+	$(obj).target/$(TARGET)/src/node_process_events.o \
+	$(obj).target/$(TARGET)/src/node_process_methods.o \
+	$(obj).target/$(TARGET)/src/node_process_object.o \
+	$(obj).target/$(TARGET)/src/node_serdes.o \
+	$(obj).target/$(TARGET)/src/node_stat_watcher.o \
+	$(obj).target/$(TARGET)/src/node_symbols.o \
+	$(obj).target/$(TARGET)/src/node_task_queue.o \
+	$(obj).target/$(TARGET)/src/node_trace_events.o \
+	$(obj).target/$(TARGET)/src/node_types.o \
+	$(obj).target/$(TARGET)/src/node_url.o \
+	$(obj).target/$(TARGET)/src/node_util.o \
+	$(obj).target/$(TARGET)/src/node_v8.o \
+	$(obj).target/$(TARGET)/src/node_wasi.o \
+	$(obj).target/$(TARGET)/src/node_watchdog.o \
+	$(obj).target/$(TARGET)/src/node_worker.o \
+	$(obj).target/$(TARGET)/src/node_zlib.o \
+	$(obj).target/$(TARGET)/src/pipe_wrap.o \
+	$(obj).target/$(TARGET)/src/process_wrap.o \
+	$(obj).target/$(TARGET)/src/signal_wrap.o \
+	$(obj).target/$(TARGET)/src/spawn_sync.o \
+	$(obj).target/$(TARGET)/src/stream_base.o \
+	$(obj).target/$(TARGET)/src/stream_pipe.o \
+	$(obj).target/$(TARGET)/src/stream_wrap.o \
+	$(obj).target/$(TARGET)/src/string_bytes.o \
+	$(obj).target/$(TARGET)/src/string_decoder.o \
+	$(obj).target/$(TARGET)/src/tcp_wrap.o \
+	$(obj).target/$(TARGET)/src/timers.o \
+	$(obj).target/$(TARGET)/src/tracing/agent.o \
+	$(obj).target/$(TARGET)/src/tracing/node_trace_buffer.o \
+	$(obj).target/$(TARGET)/src/tracing/node_trace_writer.o \
+	$(obj).target/$(TARGET)/src/tracing/trace_event.o \
+	$(obj).target/$(TARGET)/src/tracing/traced_value.o \
+	$(obj).target/$(TARGET)/src/tty_wrap.o \
+	$(obj).target/$(TARGET)/src/udp_wrap.o \
+	$(obj).target/$(TARGET)/src/util.o \
+	$(obj).target/$(TARGET)/src/uv.o \
+	$(obj).target/$(TARGET)/src/node_crypto.o \
+	$(obj).target/$(TARGET)/src/node_crypto_bio.o \
+	$(obj).target/$(TARGET)/src/node_crypto_clienthello.o \
+	$(obj).target/$(TARGET)/src/tls_wrap.o \
+	$(obj).target/$(TARGET)/src/node_report.o \
+	$(obj).target/$(TARGET)/src/node_report_module.o \
+	$(obj).target/$(TARGET)/src/node_report_utils.o \
+	$(obj).target/$(TARGET)/src/large_pages/node_large_page.o \
+	$(obj).target/$(TARGET)/gen/node_javascript.o
+
+# Add to the list of files we specially track dependencies for.
+all_deps += $(OBJS)
+
+# Make sure our dependencies are built before any of us.
+$(OBJS): | $(obj).target/tools/v8_gypfiles/v8_maybe_snapshot.stamp $(builddir)/openssl-cli
+
+# Make sure our actions/rules run before any of us.
+$(OBJS): | $(action__root_repo_node_gyp_libnode_target_node_js2c_outputs)
+
+# CFLAGS et al overrides must be target-local.
+# See "Target-specific Variable Values" in the GNU Make manual.
+$(OBJS): TOOLSET := $(TOOLSET)
+$(OBJS): GYP_CFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_C_$(BUILDTYPE))
+$(OBJS): GYP_CXXFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_CC_$(BUILDTYPE))
+
+# Suffix rules, putting all outputs into $(obj).
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(srcdir)/%.cc FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# Try building from generated source, too.
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj).$(TOOLSET)/%.cc FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj)/%.cc FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# End of this set of suffix rules
+### Rules for final target.
+# Build our special outputs first.
+$(obj).target/libnode.a: | $(action__root_repo_node_gyp_libnode_target_node_js2c_outputs)
+
+# Preserve order dependency of special output on deps.
+$(action__root_repo_node_gyp_libnode_target_node_js2c_outputs): | $(obj).target/tools/v8_gypfiles/v8_maybe_snapshot.stamp $(builddir)/openssl-cli
+
+LDFLAGS_Debug := \
+	-pthread \
+	-rdynamic \
+	-m64 \
+	-Wl,-z,relro \
+	-Wl,-z,now
+
+LDFLAGS_Release := \
+	-pthread \
+	-rdynamic \
+	-m64 \
+	-Wl,-z,relro \
+	-Wl,-z,now
+
+LIBS :=
+
+$(obj).target/libnode.a: GYP_LDFLAGS := $(LDFLAGS_$(BUILDTYPE))
+$(obj).target/libnode.a: LIBS := $(LIBS)
+$(obj).target/libnode.a: TOOLSET := $(TOOLSET)
+$(obj).target/libnode.a: $(OBJS) FORCE_DO_CMD
+	$(call do_cmd,alink_thin)
+
+all_deps += $(obj).target/libnode.a
+# Add target alias
+.PHONY: libnode
+libnode: $(obj).target/libnode.a
+
+# Add target alias to "all" target.
+.PHONY: all
+all: libnode
+
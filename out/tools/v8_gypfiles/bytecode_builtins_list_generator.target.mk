@@ -0,0 +1,171 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bytecode_builtins_list_generator
+DEFS_Debug := \
+	'-DV8_GYP_BUILD' \
+	'-DV8_TYPED_ARRAY_MAX_SIZE_IN_HEAP=64' \
+	'-D__STDC_FORMAT_MACROS' \
+	'-DOPENSSL_NO_PINSHARED' \
+	'-DOPENSSL_THREADS' \
+	'-DV8_TARGET_ARCH_X64' \
+	'-DV8_EMBEDDER_STRING="-node.29"' \
+	'-DENABLE_DISASSEMBLER' \
+	'-DV8_PROMISE_INTERNAL_FIELD_COUNT=1' \
+	'-DENABLE_MINOR_MC' \
+	'-DV8_CONCURRENT_MARKING' \
+	'-DV8_ENABLE_LAZY_SOURCE_POSITIONS' \
+	'-DV8_EMBEDDED_BUILTINS' \
+	'-DV8_USE_SIPHASH' \
+	'-DDISABLE_UNTRUSTED_CODE_MITIGATIONS' \
+	'-DV8_WIN64_UNWINDING_INFO' \
+	'-DV8_ENABLE_REGEXP_INTERPRETER_THREADED_DISPATCH' \
+	'-DDEBUG' \
+	'-D_DEBUG' \
+	'-DV8_ENABLE_CHECKS' \
+	'-DOBJECT_PRINT' \
+	'-DVERIFY_HEAP' \
+	'-DV8_TRACE_MAPS' \
+	'-DV8_ENABLE_ALLOCATION_TIMEOUT' \
+	'-DV8_ENABLE_FORCE_SLOW_PATH' \
+	'-DENABLE_HANDLE_ZAPPING'
+
+# Flags passed to all source files.
+CFLAGS_Debug := \
+	-pthread \
+	-Wno-unused-parameter \
+	-m64 \
+	-Wno-return-type \
+	-fno-strict-aliasing \
+	-m64 \
+	-g \
+	-Woverloaded-virtual \
+	 \
+	-fdata-sections \
+	-ffunction-sections \
+	-O3
+
+# Flags passed to only C files.
+CFLAGS_C_Debug :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Debug := \
+	-fno-rtti \
+	-fno-exceptions \
+	-std=gnu++1y
+
+INCS_Debug := \
+	-I$(srcdir)/deps/v8 \
+	-I$(srcdir)/deps/v8/include
+
+DEFS_Release := \
+	'-DV8_GYP_BUILD' \
+	'-DV8_TYPED_ARRAY_MAX_SIZE_IN_HEAP=64' \
+	'-D__STDC_FORMAT_MACROS' \
+	'-DOPENSSL_NO_PINSHARED' \
+	'-DOPENSSL_THREADS' \
+	'-DV8_TARGET_ARCH_X64' \
+	'-DV8_EMBEDDER_STRING="-node.29"' \
+	'-DENABLE_DISASSEMBLER' \
+	'-DV8_PROMISE_INTERNAL_FIELD_COUNT=1' \
+	'-DENABLE_MINOR_MC' \
+	'-DV8_CONCURRENT_MARKING' \
+	'-DV8_ENABLE_LAZY_SOURCE_POSITIONS' \
+	'-DV8_EMBEDDED_BUILTINS' \
+	'-DV8_USE_SIPHASH' \
+	'-DDISABLE_UNTRUSTED_CODE_MITIGATIONS' \
+	'-DV8_WIN64_UNWINDING_INFO' \
+	'-DV8_ENABLE_REGEXP_INTERPRETER_THREADED_DISPATCH'
+
+# Flags passed to all source files.
+CFLAGS_Release := \
+	-pthread \
+	-Wno-unused-parameter \
+	-m64 \
+	-Wno-return-type \
+	-fno-strict-aliasing \
+	-m64 \
+	-O3 \
+	-fno-omit-frame-pointer \
+	-fdata-sections \
+	-ffunction-sections \
+	 \
+	-O3
+
+# Flags passed to only C files.
+CFLAGS_C_Release :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Release := \
+	-fno-rtti \
+	-fno-exceptions \
+	-std=gnu++1y
+
+INCS_Release := \
+	-I$(srcdir)/deps/v8 \
+	-I$(srcdir)/deps/v8/include
+
+OBJS := \
+	$(obj).target/$(TARGET)/deps/v8/src/builtins/generate-bytecodes-builtins-list.o \
+	$(obj).target/$(TARGET)/deps/v8/src/interpreter/bytecode-operands.o \
+	$(obj).target/$(TARGET)/deps/v8/src/interpreter/bytecodes.o
+
+# Add to the list of files we specially track dependencies for.
+all_deps += $(OBJS)
+
+# Make sure our dependencies are built before any of us.
+$(OBJS): | $(obj).target/tools/v8_gypfiles/libv8_libbase.a $(obj).target/tools/v8_gypfiles/v8_headers.stamp $(obj).target/tools/v8_gypfiles/v8_version.stamp
+
+# CFLAGS et al overrides must be target-local.
+# See "Target-specific Variable Values" in the GNU Make manual.
+$(OBJS): TOOLSET := $(TOOLSET)
+$(OBJS): GYP_CFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_C_$(BUILDTYPE))
+$(OBJS): GYP_CXXFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_CC_$(BUILDTYPE))
+
+# Suffix rules, putting all outputs into $(obj).
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(srcdir)/%.cc FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# Try building from generated source, too.
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj).$(TOOLSET)/%.cc FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj)/%.cc FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# End of this set of suffix rules
+### Rules for final target.
+LDFLAGS_Debug := \
+	-pthread \
+	-rdynamic \
+	-m64 \
+	-m64
+
+LDFLAGS_Release := \
+	-pthread \
+	-rdynamic \
+	-m64 \
+	-m64
+
+LIBS := \
+	-ldl \
+	-lrt
+
+$(builddir)/bytecode_builtins_list_generator: GYP_LDFLAGS := $(LDFLAGS_$(BUILDTYPE))
+$(builddir)/bytecode_builtins_list_generator: LIBS := $(LIBS)
+$(builddir)/bytecode_builtins_list_generator: LD_INPUTS := $(OBJS) $(obj).target/tools/v8_gypfiles/libv8_libbase.a
+$(builddir)/bytecode_builtins_list_generator: TOOLSET := $(TOOLSET)
+$(builddir)/bytecode_builtins_list_generator: $(OBJS) $(obj).target/tools/v8_gypfiles/libv8_libbase.a FORCE_DO_CMD
+	$(call do_cmd,link)
+
+all_deps += $(builddir)/bytecode_builtins_list_generator
+# Add target alias
+.PHONY: bytecode_builtins_list_generator
+bytecode_builtins_list_generator: $(builddir)/bytecode_builtins_list_generator
+
+# Add executable to "all" target.
+.PHONY: all
+all: $(builddir)/bytecode_builtins_list_generator
+
@@ -0,0 +1,42 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := run_torque
+### Rules for action "run_torque_action":
+quiet_cmd__root_repo_tools_v8_gypfiles_v8_gyp_run_torque_target_run_torque_action = ACTION _root_repo_tools_v8_gypfiles_v8_gyp_run_torque_target_run_torque_action $@
+cmd__root_repo_tools_v8_gypfiles_v8_gyp_run_torque_target_run_torque_action = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/tools/v8_gypfiles; mkdir -p $(obj)/gen/torque-output-root/torque-generated $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/test/torque $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/third_party/v8/builtins; "$(builddir)/torque" ../../deps/v8/src/builtins/arguments.tq ../../deps/v8/src/builtins/array-copywithin.tq ../../deps/v8/src/builtins/array-every.tq ../../deps/v8/src/builtins/array-filter.tq ../../deps/v8/src/builtins/array-find.tq ../../deps/v8/src/builtins/array-findindex.tq ../../deps/v8/src/builtins/array-foreach.tq ../../deps/v8/src/builtins/array-join.tq ../../deps/v8/src/builtins/array-lastindexof.tq ../../deps/v8/src/builtins/array-map.tq ../../deps/v8/src/builtins/array-of.tq ../../deps/v8/src/builtins/array-reduce-right.tq ../../deps/v8/src/builtins/array-reduce.tq ../../deps/v8/src/builtins/array-reverse.tq ../../deps/v8/src/builtins/array-shift.tq ../../deps/v8/src/builtins/array-slice.tq ../../deps/v8/src/builtins/array-some.tq ../../deps/v8/src/builtins/array-splice.tq ../../deps/v8/src/builtins/array-unshift.tq ../../deps/v8/src/builtins/array.tq ../../deps/v8/src/builtins/base.tq ../../deps/v8/src/builtins/bigint.tq ../../deps/v8/src/builtins/boolean.tq ../../deps/v8/src/builtins/collections.tq ../../deps/v8/src/builtins/data-view.tq ../../deps/v8/src/builtins/extras-utils.tq ../../deps/v8/src/builtins/frames.tq ../../deps/v8/src/builtins/growable-fixed-array.tq ../../deps/v8/src/builtins/internal-coverage.tq ../../deps/v8/src/builtins/iterator.tq ../../deps/v8/src/builtins/math.tq ../../deps/v8/src/builtins/object-fromentries.tq ../../deps/v8/src/builtins/object.tq ../../deps/v8/src/builtins/proxy-constructor.tq ../../deps/v8/src/builtins/proxy-delete-property.tq ../../deps/v8/src/builtins/proxy-get-property.tq ../../deps/v8/src/builtins/proxy-get-prototype-of.tq ../../deps/v8/src/builtins/proxy-has-property.tq ../../deps/v8/src/builtins/proxy-is-extensible.tq ../../deps/v8/src/builtins/proxy-prevent-extensions.tq ../../deps/v8/src/builtins/proxy-revocable.tq ../../deps/v8/src/builtins/proxy-revoke.tq ../../deps/v8/src/builtins/proxy-set-property.tq ../../deps/v8/src/builtins/proxy-set-prototype-of.tq ../../deps/v8/src/builtins/proxy.tq ../../deps/v8/src/builtins/reflect.tq ../../deps/v8/src/builtins/regexp-exec.tq ../../deps/v8/src/builtins/regexp-match-all.tq ../../deps/v8/src/builtins/regexp-match.tq ../../deps/v8/src/builtins/regexp-replace.tq ../../deps/v8/src/builtins/regexp-search.tq ../../deps/v8/src/builtins/regexp-source.tq ../../deps/v8/src/builtins/regexp-split.tq ../../deps/v8/src/builtins/regexp-test.tq ../../deps/v8/src/builtins/regexp.tq ../../deps/v8/src/builtins/string.tq ../../deps/v8/src/builtins/string-endswith.tq ../../deps/v8/src/builtins/string-html.tq ../../deps/v8/src/builtins/string-iterator.tq ../../deps/v8/src/builtins/string-pad.tq ../../deps/v8/src/builtins/string-repeat.tq ../../deps/v8/src/builtins/string-slice.tq ../../deps/v8/src/builtins/string-startswith.tq ../../deps/v8/src/builtins/string-substring.tq ../../deps/v8/src/builtins/torque-internal.tq ../../deps/v8/src/builtins/typed-array-createtypedarray.tq ../../deps/v8/src/builtins/typed-array-every.tq ../../deps/v8/src/builtins/typed-array-filter.tq ../../deps/v8/src/builtins/typed-array-find.tq ../../deps/v8/src/builtins/typed-array-findindex.tq ../../deps/v8/src/builtins/typed-array-foreach.tq ../../deps/v8/src/builtins/typed-array-reduce.tq ../../deps/v8/src/builtins/typed-array-reduceright.tq ../../deps/v8/src/builtins/typed-array-slice.tq ../../deps/v8/src/builtins/typed-array-some.tq ../../deps/v8/src/builtins/typed-array-subarray.tq ../../deps/v8/src/builtins/typed-array.tq ../../deps/v8/third_party/v8/builtins/array-sort.tq ../../deps/v8/test/torque/test-torque.tq -o "$(obj)/gen/torque-output-root/torque-generated" -v8-root ../../deps/v8
+
+$(obj)/gen/torque-output-root/torque-generated/builtin-definitions-tq.h: obj := $(abs_obj)
+$(obj)/gen/torque-output-root/torque-generated/builtin-definitions-tq.h: builddir := $(abs_builddir)
+$(obj)/gen/torque-output-root/torque-generated/builtin-definitions-tq.h: TOOLSET := $(TOOLSET)
+$(obj)/gen/torque-output-root/torque-generated/builtin-definitions-tq.h $(obj)/gen/torque-output-root/torque-generated/interface-descriptors-tq.inc $(obj)/gen/torque-output-root/torque-generated/field-offsets-tq.h $(obj)/gen/torque-output-root/torque-generated/class-verifiers-tq.cc $(obj)/gen/torque-output-root/torque-generated/class-verifiers-tq.h $(obj)/gen/torque-output-root/torque-generated/objects-printer-tq.cc $(obj)/gen/torque-output-root/torque-generated/class-definitions-tq.cc $(obj)/gen/torque-output-root/torque-generated/class-definitions-tq-inl.h $(obj)/gen/torque-output-root/torque-generated/class-definitions-tq.h $(obj)/gen/torque-output-root/torque-generated/class-debug-readers-tq.cc $(obj)/gen/torque-output-root/torque-generated/class-debug-readers-tq.h $(obj)/gen/torque-output-root/torque-generated/exported-macros-assembler-tq.cc $(obj)/gen/torque-output-root/torque-generated/exported-macros-assembler-tq.h $(obj)/gen/torque-output-root/torque-generated/csa-types-tq.h $(obj)/gen/torque-output-root/torque-generated/instance-types-tq.h $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/arguments-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-copywithin-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-every-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-filter-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-find-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-findindex-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-foreach-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-join-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-lastindexof-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-map-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-of-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-reduce-right-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-reduce-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-reverse-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-shift-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-slice-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-some-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-splice-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-unshift-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/base-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/bigint-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/boolean-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/collections-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/data-view-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/extras-utils-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/frames-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/growable-fixed-array-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/internal-coverage-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/iterator-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/math-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/object-fromentries-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/object-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-constructor-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-delete-property-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-get-property-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-get-prototype-of-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-has-property-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-is-extensible-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-prevent-extensions-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-revocable-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-revoke-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-set-property-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-set-prototype-of-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/reflect-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-exec-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-match-all-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-match-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-replace-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-search-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-source-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-split-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-test-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-endswith-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-html-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-iterator-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-pad-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-repeat-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-slice-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-startswith-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-substring-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/torque-internal-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-createtypedarray-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-every-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-filter-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-find-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-findindex-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-foreach-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-reduce-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-reduceright-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-slice-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-some-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-subarray-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/third_party/v8/builtins/array-sort-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/test/torque/test-torque-tq-csa.cc: 541771286289518efa2205a853042917992636bc.intermediate
+	@:
+.INTERMEDIATE: 541771286289518efa2205a853042917992636bc.intermediate
+541771286289518efa2205a853042917992636bc.intermediate: $(builddir)/torque $(srcdir)/deps/v8/src/builtins/arguments.tq $(srcdir)/deps/v8/src/builtins/array-copywithin.tq $(srcdir)/deps/v8/src/builtins/array-every.tq $(srcdir)/deps/v8/src/builtins/array-filter.tq $(srcdir)/deps/v8/src/builtins/array-find.tq $(srcdir)/deps/v8/src/builtins/array-findindex.tq $(srcdir)/deps/v8/src/builtins/array-foreach.tq $(srcdir)/deps/v8/src/builtins/array-join.tq $(srcdir)/deps/v8/src/builtins/array-lastindexof.tq $(srcdir)/deps/v8/src/builtins/array-map.tq $(srcdir)/deps/v8/src/builtins/array-of.tq $(srcdir)/deps/v8/src/builtins/array-reduce-right.tq $(srcdir)/deps/v8/src/builtins/array-reduce.tq $(srcdir)/deps/v8/src/builtins/array-reverse.tq $(srcdir)/deps/v8/src/builtins/array-shift.tq $(srcdir)/deps/v8/src/builtins/array-slice.tq $(srcdir)/deps/v8/src/builtins/array-some.tq $(srcdir)/deps/v8/src/builtins/array-splice.tq $(srcdir)/deps/v8/src/builtins/array-unshift.tq $(srcdir)/deps/v8/src/builtins/array.tq $(srcdir)/deps/v8/src/builtins/base.tq $(srcdir)/deps/v8/src/builtins/bigint.tq $(srcdir)/deps/v8/src/builtins/boolean.tq $(srcdir)/deps/v8/src/builtins/collections.tq $(srcdir)/deps/v8/src/builtins/data-view.tq $(srcdir)/deps/v8/src/builtins/extras-utils.tq $(srcdir)/deps/v8/src/builtins/frames.tq $(srcdir)/deps/v8/src/builtins/growable-fixed-array.tq $(srcdir)/deps/v8/src/builtins/internal-coverage.tq $(srcdir)/deps/v8/src/builtins/iterator.tq $(srcdir)/deps/v8/src/builtins/math.tq $(srcdir)/deps/v8/src/builtins/object-fromentries.tq $(srcdir)/deps/v8/src/builtins/object.tq $(srcdir)/deps/v8/src/builtins/proxy-constructor.tq $(srcdir)/deps/v8/src/builtins/proxy-delete-property.tq $(srcdir)/deps/v8/src/builtins/proxy-get-property.tq $(srcdir)/deps/v8/src/builtins/proxy-get-prototype-of.tq $(srcdir)/deps/v8/src/builtins/proxy-has-property.tq $(srcdir)/deps/v8/src/builtins/proxy-is-extensible.tq $(srcdir)/deps/v8/src/builtins/proxy-prevent-extensions.tq $(srcdir)/deps/v8/src/builtins/proxy-revocable.tq $(srcdir)/deps/v8/src/builtins/proxy-revoke.tq $(srcdir)/deps/v8/src/builtins/proxy-set-property.tq $(srcdir)/deps/v8/src/builtins/proxy-set-prototype-of.tq $(srcdir)/deps/v8/src/builtins/proxy.tq $(srcdir)/deps/v8/src/builtins/reflect.tq $(srcdir)/deps/v8/src/builtins/regexp-exec.tq $(srcdir)/deps/v8/src/builtins/regexp-match-all.tq $(srcdir)/deps/v8/src/builtins/regexp-match.tq $(srcdir)/deps/v8/src/builtins/regexp-replace.tq $(srcdir)/deps/v8/src/builtins/regexp-search.tq $(srcdir)/deps/v8/src/builtins/regexp-source.tq $(srcdir)/deps/v8/src/builtins/regexp-split.tq $(srcdir)/deps/v8/src/builtins/regexp-test.tq $(srcdir)/deps/v8/src/builtins/regexp.tq $(srcdir)/deps/v8/src/builtins/string.tq $(srcdir)/deps/v8/src/builtins/string-endswith.tq $(srcdir)/deps/v8/src/builtins/string-html.tq $(srcdir)/deps/v8/src/builtins/string-iterator.tq $(srcdir)/deps/v8/src/builtins/string-pad.tq $(srcdir)/deps/v8/src/builtins/string-repeat.tq $(srcdir)/deps/v8/src/builtins/string-slice.tq $(srcdir)/deps/v8/src/builtins/string-startswith.tq $(srcdir)/deps/v8/src/builtins/string-substring.tq $(srcdir)/deps/v8/src/builtins/torque-internal.tq $(srcdir)/deps/v8/src/builtins/typed-array-createtypedarray.tq $(srcdir)/deps/v8/src/builtins/typed-array-every.tq $(srcdir)/deps/v8/src/builtins/typed-array-filter.tq $(srcdir)/deps/v8/src/builtins/typed-array-find.tq $(srcdir)/deps/v8/src/builtins/typed-array-findindex.tq $(srcdir)/deps/v8/src/builtins/typed-array-foreach.tq $(srcdir)/deps/v8/src/builtins/typed-array-reduce.tq $(srcdir)/deps/v8/src/builtins/typed-array-reduceright.tq $(srcdir)/deps/v8/src/builtins/typed-array-slice.tq $(srcdir)/deps/v8/src/builtins/typed-array-some.tq $(srcdir)/deps/v8/src/builtins/typed-array-subarray.tq $(srcdir)/deps/v8/src/builtins/typed-array.tq $(srcdir)/deps/v8/third_party/v8/builtins/array-sort.tq $(srcdir)/deps/v8/test/torque/test-torque.tq FORCE_DO_CMD
+	$(call do_cmd,touch)
+	$(call do_cmd,_root_repo_tools_v8_gypfiles_v8_gyp_run_torque_target_run_torque_action)
+
+all_deps += $(obj)/gen/torque-output-root/torque-generated/builtin-definitions-tq.h $(obj)/gen/torque-output-root/torque-generated/interface-descriptors-tq.inc $(obj)/gen/torque-output-root/torque-generated/field-offsets-tq.h $(obj)/gen/torque-output-root/torque-generated/class-verifiers-tq.cc $(obj)/gen/torque-output-root/torque-generated/class-verifiers-tq.h $(obj)/gen/torque-output-root/torque-generated/objects-printer-tq.cc $(obj)/gen/torque-output-root/torque-generated/class-definitions-tq.cc $(obj)/gen/torque-output-root/torque-generated/class-definitions-tq-inl.h $(obj)/gen/torque-output-root/torque-generated/class-definitions-tq.h $(obj)/gen/torque-output-root/torque-generated/class-debug-readers-tq.cc $(obj)/gen/torque-output-root/torque-generated/class-debug-readers-tq.h $(obj)/gen/torque-output-root/torque-generated/exported-macros-assembler-tq.cc $(obj)/gen/torque-output-root/torque-generated/exported-macros-assembler-tq.h $(obj)/gen/torque-output-root/torque-generated/csa-types-tq.h $(obj)/gen/torque-output-root/torque-generated/instance-types-tq.h $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/arguments-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-copywithin-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-every-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-filter-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-find-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-findindex-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-foreach-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-join-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-lastindexof-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-map-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-of-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-reduce-right-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-reduce-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-reverse-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-shift-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-slice-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-some-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-splice-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-unshift-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/base-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/bigint-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/boolean-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/collections-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/data-view-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/extras-utils-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/frames-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/growable-fixed-array-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/internal-coverage-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/iterator-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/math-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/object-fromentries-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/object-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-constructor-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-delete-property-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-get-property-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-get-prototype-of-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-has-property-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-is-extensible-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-prevent-extensions-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-revocable-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-revoke-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-set-property-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-set-prototype-of-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/reflect-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-exec-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-match-all-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-match-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-replace-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-search-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-source-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-split-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-test-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-endswith-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-html-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-iterator-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-pad-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-repeat-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-slice-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-startswith-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-substring-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/torque-internal-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-createtypedarray-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-every-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-filter-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-find-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-findindex-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-foreach-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-reduce-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-reduceright-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-slice-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-some-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-subarray-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/third_party/v8/builtins/array-sort-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/test/torque/test-torque-tq-csa.cc
+action__root_repo_tools_v8_gypfiles_v8_gyp_run_torque_target_run_torque_action_outputs := $(obj)/gen/torque-output-root/torque-generated/builtin-definitions-tq.h $(obj)/gen/torque-output-root/torque-generated/interface-descriptors-tq.inc $(obj)/gen/torque-output-root/torque-generated/field-offsets-tq.h $(obj)/gen/torque-output-root/torque-generated/class-verifiers-tq.cc $(obj)/gen/torque-output-root/torque-generated/class-verifiers-tq.h $(obj)/gen/torque-output-root/torque-generated/objects-printer-tq.cc $(obj)/gen/torque-output-root/torque-generated/class-definitions-tq.cc $(obj)/gen/torque-output-root/torque-generated/class-definitions-tq-inl.h $(obj)/gen/torque-output-root/torque-generated/class-definitions-tq.h $(obj)/gen/torque-output-root/torque-generated/class-debug-readers-tq.cc $(obj)/gen/torque-output-root/torque-generated/class-debug-readers-tq.h $(obj)/gen/torque-output-root/torque-generated/exported-macros-assembler-tq.cc $(obj)/gen/torque-output-root/torque-generated/exported-macros-assembler-tq.h $(obj)/gen/torque-output-root/torque-generated/csa-types-tq.h $(obj)/gen/torque-output-root/torque-generated/instance-types-tq.h $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/arguments-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-copywithin-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-every-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-filter-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-find-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-findindex-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-foreach-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-join-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-lastindexof-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-map-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-of-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-reduce-right-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-reduce-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-reverse-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-shift-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-slice-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-some-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-splice-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-unshift-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/array-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/base-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/bigint-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/boolean-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/collections-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/data-view-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/extras-utils-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/frames-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/growable-fixed-array-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/internal-coverage-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/iterator-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/math-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/object-fromentries-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/object-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-constructor-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-delete-property-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-get-property-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-get-prototype-of-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-has-property-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-is-extensible-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-prevent-extensions-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-revocable-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-revoke-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-set-property-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-set-prototype-of-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/proxy-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/reflect-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-exec-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-match-all-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-match-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-replace-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-search-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-source-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-split-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-test-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/regexp-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-endswith-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-html-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-iterator-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-pad-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-repeat-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-slice-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-startswith-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/string-substring-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/torque-internal-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-createtypedarray-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-every-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-filter-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-find-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-findindex-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-foreach-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-reduce-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-reduceright-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-slice-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-some-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-subarray-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/src/builtins/typed-array-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/third_party/v8/builtins/array-sort-tq-csa.cc $(obj)/gen/torque-output-root/torque-generated/../../deps/v8/test/torque/test-torque-tq-csa.cc
+
+
+### Rules for final target.
+# Build our special outputs first.
+$(obj).target/tools/v8_gypfiles/run_torque.stamp: | $(action__root_repo_tools_v8_gypfiles_v8_gyp_run_torque_target_run_torque_action_outputs)
+
+# Preserve order dependency of special output on deps.
+$(action__root_repo_tools_v8_gypfiles_v8_gyp_run_torque_target_run_torque_action_outputs): | $(builddir)/torque
+
+$(obj).target/tools/v8_gypfiles/run_torque.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/tools/v8_gypfiles/run_torque.stamp: $(builddir)/torque FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/tools/v8_gypfiles/run_torque.stamp
+# Add target alias
+.PHONY: run_torque
+run_torque: $(obj).target/tools/v8_gypfiles/run_torque.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: run_torque
+
@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := v8_base
+### Rules for final target.
+$(obj).target/tools/v8_gypfiles/v8_base.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/tools/v8_gypfiles/v8_base.stamp: $(obj).target/tools/v8_gypfiles/libv8_base_without_compiler.a $(obj).target/tools/v8_gypfiles/libv8_compiler.a FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/tools/v8_gypfiles/v8_base.stamp
+# Add target alias
+.PHONY: v8_base
+v8_base: $(obj).target/tools/v8_gypfiles/v8_base.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: v8_base
+
@@ -76,10 +76,15 @@ namespace node {
 
 #if HAVE_OPENSSL
 #define NODE_ASYNC_CRYPTO_PROVIDER_TYPES(V)                                   \
+  V(CIPHERREQUEST)                                                            \
+  V(HASHBATCHREQUEST)                                                         \
+  V(HASHREQUEST)                                                              \
   V(PBKDF2REQUEST)                                                            \
   V(KEYPAIRGENREQUEST)                                                        \
   V(RANDOMBYTESREQUEST)                                                       \
   V(SCRYPTREQUEST)                                                            \
+  V(SIGNREQUEST)                                                              \
+  V(VERIFYREQUEST)                                                            \
   V(TLSWRAP)
 #else
 #define NODE_ASYNC_CRYPTO_PROVIDER_TYPES(V)
@@ -0,0 +1,405 @@
+#include "base64.h"  // NOLINT(build/include_inline)
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define NODE_BASE64_NEON 1
+#include <arm_neon.h>
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+// GCC and Clang allow using intrinsics in functions that are compiled for a
+// specific target, so the kernels below can be selected at runtime without
+// raising the baseline that the rest of the binary is compiled for.
+#define NODE_BASE64_X86 1
+#include <immintrin.h>
+#endif
+
+namespace node {
+
+namespace {
+
+// The vectorized kernels only handle whole blocks of input that consist of
+// characters from the base64 alphabet (regular or URL-safe). They stop at the
+// first block that contains padding, whitespace or invalid characters and
+// leave it, along with anything that does not fill a block, to the scalar code
+// in base64.h, which implements the actual error handling semantics.
+
+#ifdef NODE_BASE64_X86
+
+#define NODE_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define NODE_TARGET_AVX2 __attribute__((target("avx2")))
+
+bool HasSSSE3() {
+  static const bool has_ssse3 = __builtin_cpu_supports("ssse3");
+  return has_ssse3;
+}
+
+bool HasAVX2() {
+  static const bool has_avx2 = __builtin_cpu_supports("avx2");
+  return has_avx2;
+}
+
+// Encoding follows http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html:
+// every group of three input bytes is spread out into the four 32-bit lanes
+// of a vector, the four 6-bit indices are moved into place using
+// multiplications, and the indices are translated into the alphabet by adding
+// an offset that depends on the range that the index falls into.
+
+NODE_TARGET_SSSE3
+inline __m128i EncodeIndicesSSSE3(__m128i in) {
+  in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7,
+                                         4, 5, 3, 4, 1, 2, 0, 1));
+  const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+  const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+  const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+  const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+  return _mm_or_si128(t1, t3);
+}
+
+NODE_TARGET_SSSE3
+inline __m128i EncodeLookupSSSE3(__m128i indices) {
+  // 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12.
+  __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+  const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+  range = _mm_or_si128(range, _mm_and_si128(less, _mm_set1_epi8(13)));
+  const __m128i offsets = _mm_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+      '/' - 63, 'A', 0, 0);
+  return _mm_add_epi8(_mm_shuffle_epi8(offsets, range), indices);
+}
+
+NODE_TARGET_SSSE3
+size_t EncodeSSSE3(const char* src, size_t slen, char* dst) {
+  size_t i = 0;
+  size_t k = 0;
+  // Every iteration consumes 12 bytes, but reads 16.
+  while (slen - i >= 16) {
+    const __m128i in =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + k),
+                     EncodeLookupSSSE3(EncodeIndicesSSSE3(in)));
+    i += 12;
+    k += 16;
+  }
+  return i;
+}
+
+NODE_TARGET_AVX2
+inline __m256i EncodeIndicesAVX2(__m256i in) {
+  in = _mm256_shuffle_epi8(in, _mm256_set_epi8(10, 11, 9, 10, 7, 8, 6, 7,
+                                               4, 5, 3, 4, 1, 2, 0, 1,
+                                               10, 11, 9, 10, 7, 8, 6, 7,
+                                               4, 5, 3, 4, 1, 2, 0, 1));
+  const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+  const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+  const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+  const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+  return _mm256_or_si256(t1, t3);
+}
+
+NODE_TARGET_AVX2
+inline __m256i EncodeLookupAVX2(__m256i indices) {
+  __m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+  const __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+  range = _mm256_or_si256(range, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+  const __m256i offsets = _mm256_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+      '/' - 63, 'A', 0, 0,
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+      '/' - 63, 'A', 0, 0);
+  return _mm256_add_epi8(_mm256_shuffle_epi8(offsets, range), indices);
+}
+
+NODE_TARGET_AVX2
+size_t EncodeAVX2(const char* src, size_t slen, char* dst) {
+  size_t i = 0;
+  size_t k = 0;
+  // Every iteration consumes 24 bytes, 12 per 128-bit lane, but reads 28.
+  while (slen - i >= 28) {
+    const __m128i lo =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    const __m128i hi =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 12));
+    const __m256i in =
+        _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + k),
+                        EncodeLookupAVX2(EncodeIndicesAVX2(in)));
+    i += 24;
+    k += 32;
+  }
+  return i;
+}
+
+// Decoding classifies every character by range, which makes it easy to accept
+// both the regular and the URL-safe alphabet, and adds the offset of its
+// range. The 6-bit values are then merged into three bytes per 32-bit lane and
+// packed using multiply-add instructions and a shuffle.
+
+NODE_TARGET_SSSE3
+inline __m128i InRangeSSSE3(__m128i c, char lo, char hi) {
+  return _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8(lo - 1)),
+                       _mm_cmplt_epi8(c, _mm_set1_epi8(hi + 1)));
+}
+
+NODE_TARGET_SSSE3
+inline __m128i OffsetIfSSSE3(__m128i mask, int8_t offset) {
+  return _mm_and_si128(mask, _mm_set1_epi8(offset));
+}
+
+NODE_TARGET_SSSE3
+inline bool DecodeValuesSSSE3(__m128i c, __m128i* values) {
+  const __m128i upper = InRangeSSSE3(c, 'A', 'Z');
+  const __m128i lower = InRangeSSSE3(c, 'a', 'z');
+  const __m128i digit = InRangeSSSE3(c, '0', '9');
+  const __m128i plus = _mm_cmpeq_epi8(c, _mm_set1_epi8('+'));
+  const __m128i minus = _mm_cmpeq_epi8(c, _mm_set1_epi8('-'));
+  const __m128i slash = _mm_cmpeq_epi8(c, _mm_set1_epi8('/'));
+  const __m128i underscore = _mm_cmpeq_epi8(c, _mm_set1_epi8('_'));
+
+  const __m128i valid = _mm_or_si128(
+      _mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, plus)),
+      _mm_or_si128(_mm_or_si128(minus, slash), underscore));
+  if (_mm_movemask_epi8(valid) != 0xffff)
+    return false;
+
+  const __m128i offsets = _mm_or_si128(
+      _mm_or_si128(
+          _mm_or_si128(OffsetIfSSSE3(upper, -'A'),
+                       OffsetIfSSSE3(lower, 26 - 'a')),
+          _mm_or_si128(OffsetIfSSSE3(digit, 52 - '0'),
+                       OffsetIfSSSE3(plus, 62 - '+'))),
+      _mm_or_si128(
+          _mm_or_si128(OffsetIfSSSE3(minus, 62 - '-'),
+                       OffsetIfSSSE3(slash, 63 - '/')),
+          OffsetIfSSSE3(underscore, 63 - '_')));
+  *values = _mm_add_epi8(c, offsets);
+  return true;
+}
+
+NODE_TARGET_SSSE3
+inline __m128i DecodePackSSSE3(__m128i values) {
+  // Merge the four 6-bit values of every 32-bit lane into 24 bits, then move
+  // those three bytes of each lane to the front, most significant first.
+  const __m128i merged_ab_cd =
+      _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+  const __m128i merged =
+      _mm_madd_epi16(merged_ab_cd, _mm_set1_epi32(0x00011000));
+  return _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4,
+                                                10, 9, 8, 14, 13, 12,
+                                                -1, -1, -1, -1));
+}
+
+NODE_TARGET_SSSE3
+size_t DecodeSSSE3(char* dst, size_t dstlen, const char* src, size_t srclen) {
+  size_t i = 0;
+  size_t k = 0;
+  // Every iteration writes 12 bytes, but stores 16.
+  while (srclen - i >= 16 && dstlen - k >= 16) {
+    const __m128i c =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    __m128i values;
+    if (!DecodeValuesSSSE3(c, &values))
+      break;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + k),
+                     DecodePackSSSE3(values));
+    i += 16;
+    k += 12;
+  }
+  return i;
+}
+
+NODE_TARGET_AVX2
+inline __m256i InRangeAVX2(__m256i c, char lo, char hi) {
+  return _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8(lo - 1)),
+                          _mm256_cmpgt_epi8(_mm256_set1_epi8(hi + 1), c));
+}
+
+NODE_TARGET_AVX2
+inline __m256i OffsetIfAVX2(__m256i mask, int8_t offset) {
+  return _mm256_and_si256(mask, _mm256_set1_epi8(offset));
+}
+
+NODE_TARGET_AVX2
+inline bool DecodeValuesAVX2(__m256i c, __m256i* values) {
+  const __m256i upper = InRangeAVX2(c, 'A', 'Z');
+  const __m256i lower = InRangeAVX2(c, 'a', 'z');
+  const __m256i digit = InRangeAVX2(c, '0', '9');
+  const __m256i plus = _mm256_cmpeq_epi8(c, _mm256_set1_epi8('+'));
+  const __m256i minus = _mm256_cmpeq_epi8(c, _mm256_set1_epi8('-'));
+  const __m256i slash = _mm256_cmpeq_epi8(c, _mm256_set1_epi8('/'));
+  const __m256i underscore = _mm256_cmpeq_epi8(c, _mm256_set1_epi8('_'));
+
+  const __m256i valid = _mm256_or_si256(
+      _mm256_or_si256(_mm256_or_si256(upper, lower),
+                      _mm256_or_si256(digit, plus)),
+      _mm256_or_si256(_mm256_or_si256(minus, slash), underscore));
+  if (static_cast<uint32_t>(_mm256_movemask_epi8(valid)) != 0xffffffff)
+    return false;
+
+  const __m256i offsets = _mm256_or_si256(
+      _mm256_or_si256(
+          _mm256_or_si256(OffsetIfAVX2(upper, -'A'),
+                          OffsetIfAVX2(lower, 26 - 'a')),
+          _mm256_or_si256(OffsetIfAVX2(digit, 52 - '0'),
+                          OffsetIfAVX2(plus, 62 - '+'))),
+      _mm256_or_si256(
+          _mm256_or_si256(OffsetIfAVX2(minus, 62 - '-'),
+                          OffsetIfAVX2(slash, 63 - '/')),
+          OffsetIfAVX2(underscore, 63 - '_')));
+  *values = _mm256_add_epi8(c, offsets);
+  return true;
+}
+
+NODE_TARGET_AVX2
+inline __m256i DecodePackAVX2(__m256i values) {
+  const __m256i merged_ab_cd =
+      _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+  const __m256i merged =
+      _mm256_madd_epi16(merged_ab_cd, _mm256_set1_epi32(0x00011000));
+  const __m256i packed = _mm256_shuffle_epi8(
+      merged, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12,
+                               -1, -1, -1, -1,
+                               2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12,
+                               -1, -1, -1, -1));
+  // Move the 12 bytes from the upper lane next to the ones from the lower lane.
+  return _mm256_permutevar8x32_epi32(packed,
+                                     _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+}
+
+NODE_TARGET_AVX2
+size_t DecodeAVX2(char* dst, size_t dstlen, const char* src, size_t srclen) {
+  size_t i = 0;
+  size_t k = 0;
+  // Every iteration writes 24 bytes, but stores 32.
+  while (srclen - i >= 32 && dstlen - k >= 32) {
+    const __m256i c =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+    __m256i values;
+    if (!DecodeValuesAVX2(c, &values))
+      break;
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + k),
+                        DecodePackAVX2(values));
+    i += 32;
+    k += 24;
+  }
+  return i;
+}
+
+#undef NODE_TARGET_SSSE3
+#undef NODE_TARGET_AVX2
+
+#endif  // NODE_BASE64_X86
+
+#ifdef NODE_BASE64_NEON
+
+// NEON can (de)interleave groups of three or four bytes while loading and
+// storing, and look up bytes in tables of up to 64 entries, so both directions
+// are mostly table lookups.
+
+size_t EncodeNEON(const char* src, size_t slen, char* dst) {
+  static const uint8_t table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                                 "abcdefghijklmnopqrstuvwxyz"
+                                 "0123456789+/";
+  uint8x16x4_t alphabet;
+  for (int j = 0; j < 4; j++)
+    alphabet.val[j] = vld1q_u8(table + 16 * j);
+  const uint8x16_t mask = vdupq_n_u8(0x3f);
+
+  size_t i = 0;
+  size_t k = 0;
+  while (slen - i >= 48) {
+    const uint8x16x3_t in =
+        vld3q_u8(reinterpret_cast<const uint8_t*>(src + i));
+    uint8x16x4_t out;
+    out.val[0] = vshrq_n_u8(in.val[0], 2);
+    out.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4),
+                                   vshrq_n_u8(in.val[1], 4)), mask);
+    out.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2),
+                                   vshrq_n_u8(in.val[2], 6)), mask);
+    out.val[3] = vandq_u8(in.val[2], mask);
+    for (int j = 0; j < 4; j++)
+      out.val[j] = vqtbl4q_u8(alphabet, out.val[j]);
+    vst4q_u8(reinterpret_cast<uint8_t*>(dst + k), out);
+    i += 48;
+    k += 64;
+  }
+  return i;
+}
+
+size_t DecodeNEON(char* dst, size_t dstlen, const char* src, size_t srclen) {
+  // unbase64_table maps everything that is not part of the alphabet to a
+  // negative value, i.e. one with the high bit set.
+  const uint8_t* table = reinterpret_cast<const uint8_t*>(unbase64_table);
+  uint8x16x4_t lo_table;
+  uint8x16x4_t hi_table;
+  for (int j = 0; j < 4; j++) {
+    lo_table.val[j] = vld1q_u8(table + 16 * j);
+    hi_table.val[j] = vld1q_u8(table + 64 + 16 * j);
+  }
+
+  size_t i = 0;
+  size_t k = 0;
+  while (srclen - i >= 64 && dstlen - k >= 48) {
+    const uint8x16x4_t in =
+        vld4q_u8(reinterpret_cast<const uint8_t*>(src + i));
+    uint8x16x4_t values;
+    uint8x16_t invalid = vdupq_n_u8(0);
+    for (int j = 0; j < 4; j++) {
+      // Indices of 64 or more yield 0 from vqtbl4q_u8() and leave the value
+      // alone in vqtbx4q_u8(), so that characters of 128 and above are only
+      // caught by checking their own high bit.
+      values.val[j] = vqtbx4q_u8(vqtbl4q_u8(lo_table, in.val[j]),
+                                 hi_table,
+                                 veorq_u8(in.val[j], vdupq_n_u8(0x40)));
+      invalid = vorrq_u8(invalid, vorrq_u8(values.val[j], in.val[j]));
+    }
+    if (vmaxvq_u8(invalid) & 0x80)
+      break;
+
+    uint8x16x3_t out;
+    out.val[0] = vorrq_u8(vshlq_n_u8(values.val[0], 2),
+                          vshrq_n_u8(values.val[1], 4));
+    out.val[1] = vorrq_u8(vshlq_n_u8(values.val[1], 4),
+                          vshrq_n_u8(values.val[2], 2));
+    out.val[2] = vorrq_u8(vshlq_n_u8(values.val[2], 6), values.val[3]);
+    vst3q_u8(reinterpret_cast<uint8_t*>(dst + k), out);
+    i += 64;
+    k += 48;
+  }
+  return i;
+}
+
+#endif  // NODE_BASE64_NEON
+
+}  // anonymous namespace
+
+size_t base64_encode_simd(const char* src, size_t slen, char* dst) {
+#if defined(NODE_BASE64_NEON)
+  return EncodeNEON(src, slen, dst);
+#elif defined(NODE_BASE64_X86)
+  if (HasAVX2())
+    return EncodeAVX2(src, slen, dst);
+  if (HasSSSE3())
+    return EncodeSSSE3(src, slen, dst);
+  return 0;
+#else
+  return 0;
+#endif
+}
+
+size_t base64_decode_simd(char* dst, size_t dstlen,
+                          const char* src, size_t srclen) {
+#if defined(NODE_BASE64_NEON)
+  return DecodeNEON(dst, dstlen, src, srclen);
+#elif defined(NODE_BASE64_X86)
+  if (HasAVX2())
+    return DecodeAVX2(dst, dstlen, src, srclen);
+  if (HasSSSE3())
+    return DecodeSSSE3(dst, dstlen, src, srclen);
+  return 0;
+#else
+  return 0;
+#endif
+}
+
+}  // namespace node
@@ -49,6 +49,23 @@ size_t base64_decoded_size(const TypeName* src, size_t size) {
 extern const int8_t unbase64_table[256];
 
 
+// Vectorized bulk encoding and decoding, see base64.cc. Both process as many
+// whole blocks of input as the CPU allows and return the number of input bytes
+// consumed, which is always a multiple of 3 for encoding and of 4 for decoding.
+// Decoding stops early at blocks that contain padding, whitespace or invalid
+// characters. Anything that is left over is up to the scalar code below.
+size_t base64_encode_simd(const char* src, size_t slen, char* dst);
+size_t base64_decode_simd(char* dst, size_t dstlen,
+                          const char* src, size_t srclen);
+
+// Two-byte strings always take the scalar path.
+template <typename TypeName>
+inline size_t base64_decode_simd(char* dst, size_t dstlen,
+                                 const TypeName* src, size_t srclen) {
+  return 0;
+}
+
+
 inline static int8_t unbase64(uint8_t x) {
   return unbase64_table[x];
 }
@@ -92,8 +109,11 @@ size_t base64_decode_fast(char* const dst, const size_t dstlen,
   const size_t available = dstlen < decoded_size ? dstlen : decoded_size;
   const size_t max_k = available / 3 * 3;
   size_t max_i = srclen / 4 * 4;
-  size_t i = 0;
-  size_t k = 0;
+  // The vectorized code stops at the first block that is not plain base64,
+  // which is usually padding or line breaks near the end of the input, so it
+  // is not worth resuming it after the scalar code has dealt with that.
+  size_t i = base64_decode_simd(dst, max_k, src, max_i);
+  size_t k = i / 4 * 3;
   while (i < max_i && k < max_k) {
     const uint32_t v =
         unbase64(src[i + 0]) << 24 |
@@ -148,9 +168,9 @@ static size_t base64_encode(const char* src,
                               "abcdefghijklmnopqrstuvwxyz"
                               "0123456789+/";
 
-  i = 0;
-  k = 0;
   n = slen / 3 * 3;
+  i = base64_encode_simd(src, slen, dst);
+  k = i / 3 * 4;
 
   while (i < n) {
     a = src[i + 0] & 0xff;
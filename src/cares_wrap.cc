@@ -226,6 +226,9 @@ class GetAddrInfoReqWrap : public ReqWrap<uv_getaddrinfo_t> {
 
   bool verbatim() const { return verbatim_; }
 
+  // Only set while perf_hooks.monitorThreadpool() is in use.
+  uint64_t queued_at = 0;
+
  private:
   const bool verbatim_;
 };
@@ -245,6 +248,9 @@ class GetNameInfoReqWrap : public ReqWrap<uv_getnameinfo_t> {
   SET_NO_MEMORY_INFO()
   SET_MEMORY_INFO_NAME(GetNameInfoReqWrap)
   SET_SELF_SIZE(GetNameInfoReqWrap)
+
+  // Only set while perf_hooks.monitorThreadpool() is in use.
+  uint64_t queued_at = 0;
 };
 
 GetNameInfoReqWrap::GetNameInfoReqWrap(Environment* env,
@@ -1804,10 +1810,22 @@ static void Query(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+void RecordDnsRequest(Environment* env, uint64_t queued_at, uv_req_t* req) {
+  performance::performance_state* state = env->performance_state();
+  if (queued_at != 0 && state->threadpool_monitored()) {
+    state->RecordThreadPoolRequest(
+        performance::NODE_PERFORMANCE_THREADPOOL_TYPE_DNS, queued_at, req);
+  }
+}
+
+
 void AfterGetAddrInfo(uv_getaddrinfo_t* req, int status, struct addrinfo* res) {
   std::unique_ptr<GetAddrInfoReqWrap> req_wrap {
       static_cast<GetAddrInfoReqWrap*>(req->data)};
   Environment* env = req_wrap->env();
+  RecordDnsRequest(env,
+                   req_wrap->queued_at,
+                   reinterpret_cast<uv_req_t*>(req));
 
   HandleScope handle_scope(env->isolate());
   Context::Scope context_scope(env->context());
@@ -1878,6 +1896,9 @@ void AfterGetNameInfo(uv_getnameinfo_t* req,
   std::unique_ptr<GetNameInfoReqWrap> req_wrap {
       static_cast<GetNameInfoReqWrap*>(req->data)};
   Environment* env = req_wrap->env();
+  RecordDnsRequest(env,
+                   req_wrap->queued_at,
+                   reinterpret_cast<uv_req_t*>(req));
 
   HandleScope handle_scope(env->isolate());
   Context::Scope context_scope(env->context());
@@ -1979,6 +2000,9 @@ void GetAddrInfo(const FunctionCallbackInfo<Value>& args) {
       "family",
       family == AF_INET ? "ipv4" : family == AF_INET6 ? "ipv6" : "unspec");
 
+  if (env->performance_state()->threadpool_monitored())
+    req_wrap->queued_at = uv_hrtime();
+
   int err = req_wrap->Dispatch(uv_getaddrinfo,
                                AfterGetAddrInfo,
                                *hostname,
@@ -2012,6 +2036,9 @@ void GetNameInfo(const FunctionCallbackInfo<Value>& args) {
       TRACING_CATEGORY_NODE2(dns, native), "lookupService", req_wrap.get(),
       "ip", TRACE_STR_COPY(*ip), "port", port);
 
+  if (env->performance_state()->threadpool_monitored())
+    req_wrap->queued_at = uv_hrtime();
+
   int err = req_wrap->Dispatch(uv_getnameinfo,
                                AfterGetNameInfo,
                                reinterpret_cast<struct sockaddr*>(&addr),
@@ -609,6 +609,12 @@ inline void Environment::set_http2_state(
   http2_state_ = std::move(buffer);
 }
 
+#if HAVE_OPENSSL
+inline crypto::ContextPool* Environment::crypto_context_pool() const {
+  return crypto_context_pool_.get();
+}
+#endif
+
 bool Environment::debug_enabled(DebugCategory category) const {
   DCHECK_GE(static_cast<int>(category), 0);
   DCHECK_LT(static_cast<int>(category),
@@ -636,6 +642,11 @@ Environment::file_handle_read_wrap_freelist() {
   return file_handle_read_wrap_freelist_;
 }
 
+inline ThreadPoolWorkQueue* Environment::threadpool_work_queue(
+    ThreadPoolWorkType type) {
+  return &threadpool_work_queues_[static_cast<size_t>(type)];
+}
+
 inline std::shared_ptr<EnvironmentOptions> Environment::options() {
   return options_;
 }
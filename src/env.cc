@@ -17,6 +17,10 @@
 #include "util-inl.h"
 #include "v8-profiler.h"
 
+#if HAVE_OPENSSL
+#include "node_crypto.h"
+#endif
+
 #include <algorithm>
 #include <atomic>
 #include <cstdio>
@@ -324,6 +328,19 @@ Environment::Environment(IsolateData* isolate_data,
   inspector_host_port_.reset(
       new ExclusiveAccess<HostPort>(options_->debug_options().host_port));
 
+  threadpool_work_queue(ThreadPoolWorkType::CRYPTO)->limit =
+      options_->threadpool_crypto_size;
+  threadpool_work_queue(ThreadPoolWorkType::CRYPTO)->max_queued =
+      options_->threadpool_crypto_queue_size;
+  threadpool_work_queue(ThreadPoolWorkType::COMPRESSION)->limit =
+      options_->threadpool_compression_size;
+  threadpool_work_queue(ThreadPoolWorkType::COMPRESSION)->max_queued =
+      options_->threadpool_compression_queue_size;
+  threadpool_work_queue(ThreadPoolWorkType::USER)->limit =
+      options_->threadpool_user_size;
+  threadpool_work_queue(ThreadPoolWorkType::USER)->max_queued =
+      options_->threadpool_user_queue_size;
+
 #if HAVE_INSPECTOR
   // We can only create the inspector agent after having cloned the options.
   inspector_agent_ = std::make_unique<inspector::Agent>(this);
@@ -864,6 +881,15 @@ Local<Value> Environment::GetNow() {
     return Number::New(isolate(), static_cast<double>(now));
 }
 
+#if HAVE_OPENSSL
+// Not inline, because crypto::ContextPool is an incomplete type in env.h.
+void Environment::set_crypto_context_pool(
+    std::unique_ptr<crypto::ContextPool> pool) {
+  CHECK(!crypto_context_pool_);  // Should be set only once.
+  crypto_context_pool_ = std::move(pool);
+}
+#endif
+
 void Environment::set_debug_categories(const std::string& cats, bool enabled) {
   std::string debug_categories = cats;
   while (!debug_categories.empty()) {
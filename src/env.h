@@ -43,6 +43,7 @@
 #include <array>
 #include <atomic>
 #include <cstdint>
+#include <deque>
 #include <functional>
 #include <list>
 #include <unordered_map>
@@ -58,6 +59,10 @@ class ContextifyScript;
 class CompiledFnEntry;
 }
 
+namespace crypto {
+class ContextPool;
+}
+
 namespace fs {
 class FileHandleReadWrap;
 }
@@ -150,7 +155,6 @@ constexpr size_t kFsStatsBufferLength =
 // for the sake of convenience.  Strings should be ASCII-only and have a
 // "node:" prefix to avoid name clashes with third-party code.
 #define PER_ISOLATE_PRIVATE_SYMBOL_PROPERTIES(V)                              \
-  V(alpn_buffer_private_symbol, "node:alpnBuffer")                            \
   V(arraybuffer_untransferable_private_symbol, "node:untransferableBuffer")   \
   V(arrow_message_private_symbol, "node:arrowMessage")                        \
   V(contextify_context_private_symbol, "node:contextify:context")             \
@@ -508,6 +512,7 @@ class IsolateData : public MemoryRetainer {
 #undef VP
 
   std::unordered_map<nghttp2_rcbuf*, v8::Eternal<v8::String>> http2_static_strs;
+  std::vector<v8::Eternal<v8::String>> http_parser_strs;
   inline v8::Isolate* isolate() const;
   IsolateData(const IsolateData&) = delete;
   IsolateData& operator=(const IsolateData&) = delete;
@@ -562,6 +567,44 @@ enum class DebugCategory {
   CATEGORY_COUNT
 };
 
+#define THREADPOOL_WORK_TYPES(V)                                               \
+  V(CRYPTO, "crypto")                                                          \
+  V(COMPRESSION, "compression")                                                \
+  V(USER, "user")
+
+enum class ThreadPoolWorkType {
+#define V(name, _) name,
+  THREADPOOL_WORK_TYPES(V)
+#undef V
+  TYPE_COUNT
+};
+
+class ThreadPoolWork;
+
+// Bookkeeping for the ThreadPoolWork of one type submitted from an
+// Environment. When `limit` is non-zero, at most that many work items are
+// handed to libuv at the same time; the rest wait in `pending`. When
+// `max_queued` is non-zero, work is rejected once that many items wait in
+// `pending`, or, without a `limit`, in libuv's queue.
+struct ThreadPoolWorkQueue {
+  uint64_t limit = 0;
+  uint64_t max_queued = 0;
+  uint64_t submitted = 0;  // Handed to libuv and not completed yet.
+  std::atomic<uint64_t> started {0};  // Counted on the threadpool threads.
+  uint64_t completed = 0;
+  uint64_t wait_time = 0;  // Total time completed work spent queued, in ns.
+  std::deque<ThreadPoolWork*> pending;
+
+  inline uint64_t running() const { return started - completed; }
+  inline uint64_t queued() const {
+    return pending.size() + submitted - running();
+  }
+  inline bool full() const {
+    if (max_queued == 0) return false;
+    return (limit != 0 ? pending.size() : queued()) >= max_queued;
+  }
+};
+
 // A unique-pointer-ish object that is compatible with the JS engine's
 // ArrayBuffer::Allocator.
 struct AllocatedBuffer {
@@ -1022,6 +1065,11 @@ class Environment : public MemoryRetainer {
   inline http2::Http2State* http2_state() const;
   inline void set_http2_state(std::unique_ptr<http2::Http2State> state);
 
+#if HAVE_OPENSSL
+  inline crypto::ContextPool* crypto_context_pool() const;
+  void set_crypto_context_pool(std::unique_ptr<crypto::ContextPool> pool);
+#endif
+
   inline bool debug_enabled(DebugCategory category) const;
   inline void set_debug_enabled(DebugCategory category, bool enabled);
   void set_debug_categories(const std::string& cats, bool enabled);
@@ -1032,6 +1080,8 @@ class Environment : public MemoryRetainer {
   inline std::vector<std::unique_ptr<fs::FileHandleReadWrap>>&
       file_handle_read_wrap_freelist();
 
+  inline ThreadPoolWorkQueue* threadpool_work_queue(ThreadPoolWorkType type);
+
   inline performance::performance_state* performance_state();
   inline std::unordered_map<std::string, uint64_t>* performance_marks();
 
@@ -1375,6 +1425,9 @@ class Environment : public MemoryRetainer {
   std::list<HandleCleanup> handle_cleanup_queue_;
   int handle_cleanup_waiting_ = 0;
   int request_waiting_ = 0;
+  std::array<ThreadPoolWorkQueue,
+             static_cast<size_t>(ThreadPoolWorkType::TYPE_COUNT)>
+      threadpool_work_queues_;
 
   std::shared_ptr<v8::BackingStore> heap_statistics_buffer_;
   std::shared_ptr<v8::BackingStore> heap_space_statistics_buffer_;
@@ -1383,6 +1436,9 @@ class Environment : public MemoryRetainer {
   char* http_parser_buffer_ = nullptr;
   bool http_parser_buffer_in_use_ = false;
   std::unique_ptr<http2::Http2State> http2_state_;
+#if HAVE_OPENSSL
+  std::unique_ptr<crypto::ContextPool> crypto_context_pool_;
+#endif
 
   bool debug_enabled_[static_cast<int>(DebugCategory::CATEGORY_COUNT)] = {
       false};
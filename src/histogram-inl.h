@@ -24,6 +24,10 @@ inline bool Histogram::Record(int64_t value) {
   return hdr_record_value(histogram_, value);
 }
 
+inline int64_t Histogram::Count() {
+  return histogram_->total_count;
+}
+
 inline int64_t Histogram::Min() {
   return hdr_min(histogram_);
 }
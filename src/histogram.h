@@ -16,6 +16,7 @@ class Histogram {
 
   inline bool Record(int64_t value);
   inline void Reset();
+  inline int64_t Count();
   inline int64_t Min();
   inline int64_t Max();
   inline double Mean();
@@ -119,6 +119,7 @@
 #include <cstdlib>
 #include <cstring>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -921,6 +922,15 @@ NODE_EXTERN void Init(int* argc,
   for (int i = 0; i < *argc; ++i) argv[i] = strdup(argv_[i].c_str());
 }
 
+static void SetThreadPoolLimits(uv_req_type type,
+                                uint64_t max_running,
+                                uint64_t max_queued) {
+  USE(uv_threadpool_set_limits(
+      type,
+      static_cast<unsigned int>(std::min<uint64_t>(max_running, UINT_MAX)),
+      static_cast<unsigned int>(std::min<uint64_t>(max_queued, UINT_MAX))));
+}
+
 InitializationResult InitializeOncePerProcess(int argc, char** argv) {
   atexit(ResetStdio);
   PlatformInit();
@@ -985,6 +995,16 @@ InitializationResult InitializeOncePerProcess(int argc, char** argv) {
     UNREACHABLE();
   }
 
+  // libuv schedules file system and DNS requests on its threadpool itself, so
+  // their limits apply to the whole process. They only take effect if nothing
+  // has started the threadpool yet, which embedders may have done.
+  SetThreadPoolLimits(UV_FS,
+                      per_process::cli_options->threadpool_fs_size,
+                      per_process::cli_options->threadpool_fs_queue_size);
+  SetThreadPoolLimits(UV_GETADDRINFO,
+                      per_process::cli_options->threadpool_dns_size,
+                      per_process::cli_options->threadpool_dns_queue_size);
+
 #if HAVE_OPENSSL
   {
     std::string extra_ca_certs;
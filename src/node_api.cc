@@ -976,7 +976,8 @@ napi_status napi_queue_async_work(napi_env env, napi_async_work work) {
 
   uvimpl::Work* w = reinterpret_cast<uvimpl::Work*>(work);
 
-  w->ScheduleWork();
+  if (w->ScheduleWork() != 0)
+    return napi_set_last_error(env, napi_queue_full);
 
   return napi_clear_last_error(env);
 }
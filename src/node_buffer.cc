@@ -1133,12 +1133,8 @@ static void EncodeInto(const FunctionCallbackInfo<Value>& args) {
       result_arr->ByteOffset());
 
   int nchars;
-  int written = source->WriteUtf8(
-      isolate,
-      write_result,
-      dest_length,
-      &nchars,
-      String::NO_NULL_TERMINATION | String::REPLACE_INVALID_UTF8);
+  size_t written = StringBytes::Write(
+      isolate, write_result, dest_length, source, UTF8, &nchars);
   results[0] = nchars;
   results[1] = written;
 }
@@ -46,6 +46,7 @@
 #include <openssl/evp.h>
 #include <openssl/pem.h>
 #include <openssl/x509v3.h>
+#include <openssl/ocsp.h>
 #include <openssl/hmac.h>
 #include <openssl/rand.h>
 #include <openssl/pkcs12.h>
@@ -53,9 +54,11 @@
 #include <cerrno>
 #include <climits>  // INT_MAX
 #include <cstring>
+#include <ctime>
 
 #include <algorithm>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -94,6 +97,7 @@ using v8::MaybeLocal;
 using v8::NewStringType;
 using v8::Nothing;
 using v8::Null;
+using v8::Number;
 using v8::Object;
 using v8::PropertyAttribute;
 using v8::ReadOnly;
@@ -497,8 +501,14 @@ void SecureContext::Initialize(Environment* env, Local<Object> target) {
 #endif  // !OPENSSL_NO_ENGINE
   env->SetProtoMethodNoSideEffect(t, "getTicketKeys", GetTicketKeys);
   env->SetProtoMethod(t, "setTicketKeys", SetTicketKeys);
+  env->SetProtoMethod(t, "enableSharedSessionCache", EnableSharedSessionCache);
   env->SetProtoMethod(t, "setFreeListLength", SetFreeListLength);
   env->SetProtoMethod(t, "enableTicketKeyCallback", EnableTicketKeyCallback);
+  env->SetProtoMethod(t, "buildCertChain", BuildCertChain);
+  env->SetProtoMethod(t, "enableKeyOffload", EnableKeyOffload);
+  env->SetProtoMethod(t, "setOCSPResponse", SetOCSPResponse);
+  env->SetProtoMethodNoSideEffect(t, "getOCSPResponseState",
+                                  GetOCSPResponseState);
   env->SetProtoMethodNoSideEffect(t, "getCertificate", GetCertificate<true>);
   env->SetProtoMethodNoSideEffect(t, "getIssuer", GetCertificate<false>);
 
@@ -510,6 +520,9 @@ void SecureContext::Initialize(Environment* env, Local<Object> target) {
   SET_INTEGER_CONSTANTS("kTicketKeyAESIndex", kTicketKeyAESIndex);
   SET_INTEGER_CONSTANTS("kTicketKeyNameIndex", kTicketKeyNameIndex);
   SET_INTEGER_CONSTANTS("kTicketKeyIVIndex", kTicketKeyIVIndex);
+  SET_INTEGER_CONSTANTS("kOCSPResponseMissing", kOCSPResponseMissing);
+  SET_INTEGER_CONSTANTS("kOCSPResponseFresh", kOCSPResponseFresh);
+  SET_INTEGER_CONSTANTS("kOCSPResponseStale", kOCSPResponseStale);
 
 #undef SET_INTEGER_CONSTANTS
 
@@ -697,6 +710,97 @@ static BIOPointer LoadBIO(Environment* env, Local<Value> v) {
 }
 
 
+// RSA and EC key methods that behave like the default ones, but run private
+// key operations through TLSWrap::RunKeyOperation(), so that they are done on
+// the threadpool when they are part of an offloaded handshake.
+static int OffloadableRsaPrivEnc(int flen,
+                                 const unsigned char* from,
+                                 unsigned char* to,
+                                 RSA* rsa,
+                                 int padding) {
+  return TLSWrap::RunKeyOperation([&]() {
+    return RSA_meth_get_priv_enc(RSA_PKCS1_OpenSSL())(
+        flen, from, to, rsa, padding);
+  });
+}
+
+static int OffloadableRsaPrivDec(int flen,
+                                 const unsigned char* from,
+                                 unsigned char* to,
+                                 RSA* rsa,
+                                 int padding) {
+  return TLSWrap::RunKeyOperation([&]() {
+    return RSA_meth_get_priv_dec(RSA_PKCS1_OpenSSL())(
+        flen, from, to, rsa, padding);
+  });
+}
+
+using EcdsaSignFn = int (*)(int type,
+                            const unsigned char* dgst,
+                            int dlen,
+                            unsigned char* sig,
+                            unsigned int* siglen,
+                            const BIGNUM* kinv,
+                            const BIGNUM* r,
+                            EC_KEY* eckey);
+
+static EcdsaSignFn DefaultEcdsaSign() {
+  EcdsaSignFn sign = nullptr;
+  EC_KEY_METHOD_get_sign(EC_KEY_OpenSSL(), &sign, nullptr, nullptr);
+  return sign;
+}
+
+static int OffloadableEcdsaSign(int type,
+                                const unsigned char* dgst,
+                                int dlen,
+                                unsigned char* sig,
+                                unsigned int* siglen,
+                                const BIGNUM* kinv,
+                                const BIGNUM* r,
+                                EC_KEY* eckey) {
+  return TLSWrap::RunKeyOperation([&]() {
+    return DefaultEcdsaSign()(type, dgst, dlen, sig, siglen, kinv, r, eckey);
+  });
+}
+
+static void UseOffloadableKeyMethod(EVP_PKEY* pkey) {
+  switch (EVP_PKEY_base_id(pkey)) {
+    case EVP_PKEY_RSA: {
+      static RSA_METHOD* const method = []() {
+        RSA_METHOD* method = RSA_meth_dup(RSA_PKCS1_OpenSSL());
+        CHECK_NOT_NULL(method);
+        RSA_meth_set1_name(method, "node offloadable RSA method");
+        RSA_meth_set_priv_enc(method, OffloadableRsaPrivEnc);
+        RSA_meth_set_priv_dec(method, OffloadableRsaPrivDec);
+        return method;
+      }();
+      RSA* rsa = EVP_PKEY_get0_RSA(pkey);
+      // Keys that are backed by an engine keep their method.
+      if (rsa != nullptr && RSA_get_method(rsa) == RSA_PKCS1_OpenSSL())
+        RSA_set_method(rsa, method);
+      break;
+    }
+    case EVP_PKEY_EC: {
+      static EC_KEY_METHOD* const method = []() {
+        EC_KEY_METHOD* method = EC_KEY_METHOD_new(EC_KEY_OpenSSL());
+        CHECK_NOT_NULL(method);
+        int (*sign_setup)(EC_KEY*, BN_CTX*, BIGNUM**, BIGNUM**) = nullptr;
+        ECDSA_SIG* (*sign_sig)(const unsigned char*, int, const BIGNUM*,
+                               const BIGNUM*, EC_KEY*) = nullptr;
+        EC_KEY_METHOD_get_sign(method, nullptr, &sign_setup, &sign_sig);
+        EC_KEY_METHOD_set_sign(method, OffloadableEcdsaSign, sign_setup,
+                               sign_sig);
+        return method;
+      }();
+      EC_KEY* ec = EVP_PKEY_get0_EC_KEY(pkey);
+      if (ec != nullptr && EC_KEY_get_method(ec) == EC_KEY_OpenSSL())
+        EC_KEY_set_method(ec, method);
+      break;
+    }
+  }
+}
+
+
 void SecureContext::SetKey(const FunctionCallbackInfo<Value>& args) {
   Environment* env = Environment::GetCurrent(args);
 
@@ -1146,6 +1250,41 @@ static void IsExtraRootCertsFileLoaded(
 }
 
 
+// Sets up the shared session cache of this process, either from the shared
+// memory object that `fd` refers to or, if it is -1, as a new one with room
+// for `entries` sessions. Returns the file descriptor of the cache, or
+// undefined if it could not be set up. If the cache already exists, it is
+// used as is.
+static void InitSharedSessionCache(const FunctionCallbackInfo<Value>& args) {
+  CHECK(args[0]->IsInt32());
+  CHECK(args[1]->IsUint32());
+  const int fd = args[0].As<Int32>()->Value();
+  const uint32_t entries = args[1].As<Uint32>()->Value();
+
+  std::shared_ptr<SharedSessionCache> cache =
+      SharedSessionCache::ForProcess(fd, entries);
+  if (cache)
+    args.GetReturnValue().Set(cache->fd());
+}
+
+
+static void GetSharedSessionCacheStats(
+    const FunctionCallbackInfo<Value>& args) {
+  std::shared_ptr<SharedSessionCache> cache =
+      SharedSessionCache::GetForProcess();
+  if (!cache)
+    return;
+
+  Isolate* isolate = args.GetIsolate();
+  Local<Value> stats[SharedSessionCache::kCounterCount];
+  for (int i = 0; i < SharedSessionCache::kCounterCount; i++) {
+    stats[i] = Number::New(isolate, static_cast<double>(
+        cache->Get(static_cast<SharedSessionCache::Counter>(i))));
+  }
+  args.GetReturnValue().Set(Array::New(isolate, stats, arraysize(stats)));
+}
+
+
 void SecureContext::AddRootCerts(const FunctionCallbackInfo<Value>& args) {
   SecureContext* sc;
   ASSIGN_OR_RETURN_UNWRAP(&sc, args.Holder());
@@ -1557,10 +1696,158 @@ void SecureContext::SetTicketKeys(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+// Use the shared session cache of this process, which must have been set up
+// with InitSharedSessionCache(), for sessions and ticket keys.
+void SecureContext::EnableSharedSessionCache(
+    const FunctionCallbackInfo<Value>& args) {
+  SecureContext* wrap;
+  ASSIGN_OR_RETURN_UNWRAP(&wrap, args.Holder());
+
+  wrap->shared_session_cache_ = SharedSessionCache::GetForProcess();
+  CHECK(wrap->shared_session_cache_);
+
+  const unsigned char* keys = wrap->shared_session_cache_->ticket_keys();
+  memcpy(wrap->ticket_key_name_, keys, 16);
+  memcpy(wrap->ticket_key_hmac_, keys + 16, 16);
+  memcpy(wrap->ticket_key_aes_, keys + 32, 16);
+}
+
+
 void SecureContext::SetFreeListLength(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+// Build the chains of the certificates that do not have one yet from the
+// context's certificate store, so that OpenSSL does not have to do so again
+// for every handshake. Like the chains built during handshakes, they include
+// the root certificate and do not need to verify. Certificates whose chain
+// cannot be built are left to have it built during handshakes, as before.
+void SecureContext::BuildCertChain(const FunctionCallbackInfo<Value>& args) {
+  SecureContext* sc;
+  ASSIGN_OR_RETURN_UNWRAP(&sc, args.Holder());
+  ClearErrorOnReturn clear_error_on_return;
+
+  SSL_CTX* ctx = sc->ctx_.get();
+  X509* current = SSL_CTX_get0_certificate(ctx);
+  if (current == nullptr)
+    return;
+
+  for (int rv = SSL_CTX_set_current_cert(ctx, SSL_CERT_SET_FIRST);
+       rv == 1;
+       rv = SSL_CTX_set_current_cert(ctx, SSL_CERT_SET_NEXT)) {
+    STACK_OF(X509)* chain = nullptr;
+    if (!SSL_CTX_get0_chain_certs(ctx, &chain) || chain != nullptr)
+      continue;
+    if (SSL_CTX_build_cert_chain(ctx, SSL_BUILD_CHAIN_FLAG_IGNORE_ERROR) <= 0 ||
+        !SSL_CTX_get0_chain_certs(ctx, &chain) ||
+        sk_X509_num(chain) <= 0) {
+      SSL_CTX_clear_chain_certs(ctx);
+    }
+  }
+
+  SSL_CTX_select_current_cert(ctx, current);
+}
+
+
+// Give the private keys of the context the methods that let offloaded
+// handshakes run their operations on the threadpool. Only servers with the
+// offloadHandshake option call this, so other keys keep the default methods.
+void SecureContext::EnableKeyOffload(const FunctionCallbackInfo<Value>& args) {
+  SecureContext* sc;
+  ASSIGN_OR_RETURN_UNWRAP(&sc, args.Holder());
+  ClearErrorOnReturn clear_error_on_return;
+
+  SSL_CTX* ctx = sc->ctx_.get();
+  X509* current = SSL_CTX_get0_certificate(ctx);
+  if (current == nullptr)
+    return;
+
+  for (int rv = SSL_CTX_set_current_cert(ctx, SSL_CERT_SET_FIRST);
+       rv == 1;
+       rv = SSL_CTX_set_current_cert(ctx, SSL_CERT_SET_NEXT)) {
+    EVP_PKEY* pkey = SSL_CTX_get0_privatekey(ctx);
+    if (pkey != nullptr)
+      UseOffloadableKeyMethod(pkey);
+  }
+
+  SSL_CTX_select_current_cert(ctx, current);
+}
+
+
+SecureContext::OCSPResponseState SecureContext::ocsp_response_state() const {
+  if (ocsp_response_.empty())
+    return kOCSPResponseMissing;
+  const int64_t now = time(nullptr);
+  if (now >= ocsp_response_expires_)
+    return kOCSPResponseMissing;
+  return now < ocsp_response_refresh_ ? kOCSPResponseFresh : kOCSPResponseStale;
+}
+
+
+// Cache an OCSP response for servers using this context to staple. Returns
+// false, and leaves the cache alone, if the response is not successful or
+// does not say until when it is valid.
+void SecureContext::SetOCSPResponse(const FunctionCallbackInfo<Value>& args) {
+  SecureContext* sc;
+  ASSIGN_OR_RETURN_UNWRAP(&sc, args.Holder());
+  Environment* env = sc->env();
+
+  THROW_AND_RETURN_IF_NOT_BUFFER(env, args[0], "OCSP response");
+  ArrayBufferViewContents<unsigned char> response(args[0]);
+
+  ClearErrorOnReturn clear_error_on_return;
+  args.GetReturnValue().Set(false);
+
+  const unsigned char* p = response.data();
+  DeleteFnPtr<OCSP_RESPONSE, OCSP_RESPONSE_free> resp(
+      d2i_OCSP_RESPONSE(nullptr, &p, response.length()));
+  if (!resp ||
+      OCSP_response_status(resp.get()) != OCSP_RESPONSE_STATUS_SUCCESSFUL) {
+    return;
+  }
+
+  DeleteFnPtr<OCSP_BASICRESP, OCSP_BASICRESP_free> basic(
+      OCSP_response_get1_basic(resp.get()));
+  OCSP_SINGLERESP* single =
+      basic ? OCSP_resp_get0(basic.get(), 0) : nullptr;
+  ASN1_GENERALIZEDTIME* this_update = nullptr;
+  ASN1_GENERALIZEDTIME* next_update = nullptr;
+  if (single == nullptr ||
+      OCSP_single_get0_status(
+          single, nullptr, nullptr, &this_update, &next_update) < 0 ||
+      this_update == nullptr ||
+      next_update == nullptr) {
+    return;
+  }
+
+  int days;
+  int seconds;
+  if (!ASN1_TIME_diff(&days, &seconds, nullptr, next_update))
+    return;
+  const int64_t now = time(nullptr);
+  const int64_t expires = now + int64_t{days} * 86400 + seconds;
+  if (expires <= now)
+    return;
+  if (!ASN1_TIME_diff(&days, &seconds, this_update, next_update))
+    return;
+  const int64_t validity = int64_t{days} * 86400 + seconds;
+
+  sc->ocsp_response_.assign(response.data(),
+                            response.data() + response.length());
+  sc->ocsp_response_expires_ = expires;
+  sc->ocsp_response_refresh_ = expires - validity / 2;
+  args.GetReturnValue().Set(true);
+}
+
+
+void SecureContext::GetOCSPResponseState(
+    const FunctionCallbackInfo<Value>& args) {
+  SecureContext* sc;
+  ASSIGN_OR_RETURN_UNWRAP(&sc, args.Holder());
+  args.GetReturnValue().Set(sc->ocsp_response_state());
+}
+
+
 // Currently, EnableTicketKeyCallback and TicketKeyCallback are only present for
 // the regression test in test/parallel/test-https-resume-after-renew.js.
 void SecureContext::EnableTicketKeyCallback(
@@ -1750,6 +2037,7 @@ void SSLWrap<Base>::AddMethods(Environment* env, Local<FunctionTemplate> t) {
   env->SetProtoMethod(t, "newSessionDone", NewSessionDone);
   env->SetProtoMethod(t, "setOCSPResponse", SetOCSPResponse);
   env->SetProtoMethod(t, "requestOCSP", RequestOCSP);
+  env->SetProtoMethod(t, "enableOCSPCache", EnableOCSPCache);
   env->SetProtoMethodNoSideEffect(t, "getEphemeralKeyInfo",
                                   GetEphemeralKeyInfo);
   env->SetProtoMethodNoSideEffect(t, "getProtocol", GetProtocol);
@@ -1780,6 +2068,8 @@ SSL_SESSION* SSLWrap<Base>::GetSessionCallback(SSL* s,
   Base* w = static_cast<Base*>(SSL_get_app_data(s));
 
   *copy = 0;
+  if (!w->next_sess_ && w->shared_session_cache_)
+    return w->shared_session_cache_->Lookup(key, len);
   return w->next_sess_.release();
 }
 
@@ -1787,13 +2077,19 @@ SSL_SESSION* SSLWrap<Base>::GetSessionCallback(SSL* s,
 template <class Base>
 int SSLWrap<Base>::NewSessionCallback(SSL* s, SSL_SESSION* sess) {
   Base* w = static_cast<Base*>(SSL_get_app_data(s));
-  Environment* env = w->ssl_env();
-  HandleScope handle_scope(env->isolate());
-  Context::Scope context_scope(env->context());
 
+  if (w->is_server() && w->shared_session_cache_)
+    w->shared_session_cache_->Store(sess);
+
+  // Offloaded handshakes run without session callbacks, so nothing below runs
+  // on the stack of an OpenSSL async job.
   if (!w->session_callbacks_)
     return 0;
 
+  Environment* env = w->ssl_env();
+  HandleScope handle_scope(env->isolate());
+  Context::Scope context_scope(env->context());
+
   // Check if session is small enough to be stored
   int size = i2d_SSL_SESSION(sess, nullptr);
   if (size > SecureContext::kMaxSessionSize)
@@ -1827,15 +2123,17 @@ int SSLWrap<Base>::NewSessionCallback(SSL* s, SSL_SESSION* sess) {
 template <class Base>
 void SSLWrap<Base>::KeylogCallback(const SSL* s, const char* line) {
   Base* w = static_cast<Base*>(SSL_get_app_data(s));
-  Environment* env = w->ssl_env();
-  HandleScope handle_scope(env->isolate());
-  Context::Scope context_scope(env->context());
+  w->CallOutsideAsyncJob([w, line = std::string(line)]() {
+    Environment* env = w->ssl_env();
+    HandleScope handle_scope(env->isolate());
+    Context::Scope context_scope(env->context());
 
-  const size_t size = strlen(line);
-  Local<Value> line_bf = Buffer::Copy(env, line, 1 + size).ToLocalChecked();
-  char* data = Buffer::Data(line_bf);
-  data[size] = '\n';
-  w->MakeCallback(env->onkeylog_string(), 1, &line_bf);
+    Local<Value> line_bf =
+        Buffer::Copy(env, line.c_str(), 1 + line.size()).ToLocalChecked();
+    char* data = Buffer::Data(line_bf);
+    data[line.size()] = '\n';
+    w->MakeCallback(env->onkeylog_string(), 1, &line_bf);
+  });
 }
 
 
@@ -2515,6 +2813,16 @@ void SSLWrap<Base>::RequestOCSP(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+template <class Base>
+void SSLWrap<Base>::EnableOCSPCache(const FunctionCallbackInfo<Value>& args) {
+  Base* w;
+  ASSIGN_OR_RETURN_UNWRAP(&w, args.Holder());
+  CHECK(w->is_server());
+
+  w->ocsp_cache_ = true;
+}
+
+
 template <class Base>
 void SSLWrap<Base>::GetEphemeralKeyInfo(
     const FunctionCallbackInfo<Value>& args) {
@@ -2791,17 +3099,9 @@ int SSLWrap<Base>::SelectALPNCallback(SSL* s,
                                       unsigned int inlen,
                                       void* arg) {
   Base* w = static_cast<Base*>(SSL_get_app_data(s));
-  Environment* env = w->env();
-  HandleScope handle_scope(env->isolate());
-  Context::Scope context_scope(env->context());
-
-  Local<Value> alpn_buffer =
-      w->object()->GetPrivate(
-          env->context(),
-          env->alpn_buffer_private_symbol()).ToLocalChecked();
-  ArrayBufferViewContents<unsigned char> alpn_protos(alpn_buffer);
+  const std::vector<unsigned char>& alpn_protos = w->alpn_protos_;
   int status = SSL_select_next_proto(const_cast<unsigned char**>(out), outlen,
-                                     alpn_protos.data(), alpn_protos.length(),
+                                     alpn_protos.data(), alpn_protos.size(),
                                      in, inlen);
   // According to 3.2. Protocol Selection of RFC7301, fatal
   // no_application_protocol alert shall be sent but OpenSSL 1.0.2 does not
@@ -2854,11 +3154,11 @@ void SSLWrap<Base>::SetALPNProtocols(const FunctionCallbackInfo<Value>& args) {
         w->ssl_.get(), alpn_protos.data(), alpn_protos.length());
     CHECK_EQ(r, 0);
   } else {
-    CHECK(
-        w->object()->SetPrivate(
-            env->context(),
-            env->alpn_buffer_private_symbol(),
-            args[0]).FromJust());
+    // The protocols are copied, so that the selection callback does not
+    // call into V8, which it can't do during an offloaded handshake.
+    ArrayBufferViewContents<unsigned char> alpn_protos(args[0]);
+    w->alpn_protos_.assign(alpn_protos.data(),
+                           alpn_protos.data() + alpn_protos.length());
     // Server should select ALPN protocol from list of advertised by client
     SSL_CTX_set_alpn_select_cb(SSL_get_SSL_CTX(w->ssl_.get()),
                                SelectALPNCallback,
@@ -2871,9 +3171,9 @@ template <class Base>
 int SSLWrap<Base>::TLSExtStatusCallback(SSL* s, void* arg) {
   Base* w = static_cast<Base*>(SSL_get_app_data(s));
   Environment* env = w->env();
-  HandleScope handle_scope(env->isolate());
 
   if (w->is_client()) {
+    HandleScope handle_scope(env->isolate());
     // Incoming response
     const unsigned char* resp;
     int len = SSL_get_tlsext_status_ocsp_resp(s, &resp);
@@ -2895,9 +3195,23 @@ int SSLWrap<Base>::TLSExtStatusCallback(SSL* s, void* arg) {
     return 1;
   } else {
     // Outgoing response
-    if (w->ocsp_response_.IsEmpty())
-      return SSL_TLSEXT_ERR_NOACK;
+    if (w->ocsp_response_.IsEmpty()) {
+      // Fall back to the response cached by the certificate's context.
+      SecureContext* sc = w->sni_context_ ?
+          w->sni_context_.get() :
+          static_cast<SecureContext*>(SSL_CTX_get_app_data(SSL_get_SSL_CTX(s)));
+      if (sc->ocsp_response_state() == SecureContext::kOCSPResponseMissing)
+        return SSL_TLSEXT_ERR_NOACK;
+
+      const std::vector<unsigned char>& response = sc->ocsp_response_;
+      unsigned char* data = MallocOpenSSL<unsigned char>(response.size());
+      memcpy(data, response.data(), response.size());
+      if (!SSL_set_tlsext_status_ocsp_resp(s, data, response.size()))
+        OPENSSL_free(data);
+      return SSL_TLSEXT_ERR_OK;
+    }
 
+    HandleScope handle_scope(env->isolate());
     Local<ArrayBufferView> obj = PersistentToLocal::Default(env->isolate(),
                                                             w->ocsp_response_);
     size_t len = obj->ByteLength();
@@ -2937,6 +3251,17 @@ int SSLWrap<Base>::SSLCertCallback(SSL* s, void* arg) {
     // handshake will continue after certcb is done.
     return -1;
 
+  // Without an SNI callback, the certificate callback is only needed for
+  // OCSP requests, which a fresh cached response answers without JS.
+  if (w->ocsp_cache_) {
+    SecureContext* sc =
+        static_cast<SecureContext*>(SSL_CTX_get_app_data(SSL_get_SSL_CTX(s)));
+    if (SSL_get_tlsext_status_type(s) != TLSEXT_STATUSTYPE_ocsp ||
+        sc->ocsp_response_state() == SecureContext::kOCSPResponseFresh) {
+      return 1;
+    }
+  }
+
   Environment* env = w->env();
   Local<Context> context = env->context();
   HandleScope handle_scope(env->isolate());
@@ -3067,6 +3392,7 @@ template <class Base>
 void SSLWrap<Base>::MemoryInfo(MemoryTracker* tracker) const {
   tracker->TrackField("ocsp_response", ocsp_response_);
   tracker->TrackField("sni_context", sni_context_);
+  tracker->TrackFieldWithSize("alpn_protos", alpn_protos_.capacity());
 }
 
 int VerifyCallback(int preverify_ok, X509_STORE_CTX* ctx) {
@@ -3532,7 +3858,7 @@ static NonCopyableMaybe<PrivateKeyEncodingConfig> GetPrivateKeyEncodingFromJs(
       if (args[*offset]->IsString()) {
         String::Utf8Value cipher_name(env->isolate(),
                                       args[*offset].As<String>());
-        result.cipher_ = EVP_get_cipherbyname(*cipher_name);
+        result.cipher_ = GetCipherByName(*cipher_name);
         if (result.cipher_ == nullptr) {
           THROW_ERR_CRYPTO_UNKNOWN_CIPHER(env);
           return NonCopyableMaybe<PrivateKeyEncodingConfig>();
@@ -3959,6 +4285,102 @@ MaybeLocal<Value> KeyObject::ExportPrivateKey(
 }
 
 
+namespace {
+
+// A small per-thread cache of name lookups, so that a cache hit neither
+// allocates nor takes a lock. Names are looked up as passed in, so that a cache
+// hit does not need to normalize them first. Unknown names are not cached,
+// because engines can add algorithms at any time.
+constexpr size_t kNameCacheSize = 16;
+constexpr size_t kMaxCachedNameLength = 31;
+
+template <typename T>
+struct NameCacheEntry {
+  char name[kMaxCachedNameLength + 1];
+  const T* value;
+};
+
+template <typename T>
+const T* LookupCached(NameCacheEntry<T>* cache,
+                      const T* (*lookup)(const char*),
+                      const char* name) {
+  size_t hash = 0;
+  size_t length = 0;
+  for (; name[length] != '\0'; length++) {
+    if (length == kMaxCachedNameLength)
+      return lookup(name);
+    hash = hash * 31 + static_cast<unsigned char>(name[length]);
+  }
+  NameCacheEntry<T>* entry = &cache[hash % kNameCacheSize];
+  if (entry->value != nullptr && memcmp(entry->name, name, length + 1) == 0)
+    return entry->value;
+  const T* result = lookup(name);
+  if (result != nullptr) {
+    memcpy(entry->name, name, length + 1);
+    entry->value = result;
+  }
+  return result;
+}
+
+// Enough for a burst of objects of every algorithm in use, without holding
+// on to much memory afterwards.
+constexpr size_t kContextPoolSize = 64;
+
+template <typename Pointer>
+Pointer TakeContext(std::vector<Pointer>* free_list,
+                    typename Pointer::element_type* (*create)()) {
+  if (free_list->empty())
+    return Pointer(create());
+  Pointer ctx = std::move(free_list->back());
+  free_list->pop_back();
+  return ctx;
+}
+
+template <typename Pointer>
+void ReleaseContext(std::vector<Pointer>* free_list,
+                    Pointer ctx,
+                    int (*reset)(typename Pointer::element_type*)) {
+  if (ctx && free_list->size() < kContextPoolSize && reset(ctx.get()) == 1)
+    free_list->emplace_back(std::move(ctx));
+}
+
+}  // anonymous namespace
+
+const EVP_CIPHER* GetCipherByName(const char* name) {
+  static thread_local NameCacheEntry<EVP_CIPHER> cache[kNameCacheSize];
+  return LookupCached(cache, EVP_get_cipherbyname, name);
+}
+
+const EVP_MD* GetDigestByName(const char* name) {
+  static thread_local NameCacheEntry<EVP_MD> cache[kNameCacheSize];
+  return LookupCached(cache, EVP_get_digestbyname, name);
+}
+
+EVPMDPointer ContextPool::TakeMDCtx() {
+  return TakeContext(&md_ctxs_, EVP_MD_CTX_new);
+}
+
+HMACCtxPointer ContextPool::TakeHMACCtx() {
+  return TakeContext(&hmac_ctxs_, HMAC_CTX_new);
+}
+
+EVPCipherCtxPointer ContextPool::TakeCipherCtx() {
+  return TakeContext(&cipher_ctxs_, EVP_CIPHER_CTX_new);
+}
+
+void ContextPool::Release(EVPMDPointer ctx) {
+  ReleaseContext(&md_ctxs_, std::move(ctx), EVP_MD_CTX_reset);
+}
+
+void ContextPool::Release(HMACCtxPointer ctx) {
+  ReleaseContext(&hmac_ctxs_, std::move(ctx), HMAC_CTX_reset);
+}
+
+void ContextPool::Release(EVPCipherCtxPointer ctx) {
+  ReleaseContext(&cipher_ctxs_, std::move(ctx), EVP_CIPHER_CTX_reset);
+}
+
+
 void CipherBase::Initialize(Environment* env, Local<Object> target) {
   Local<FunctionTemplate> t = env->NewFunctionTemplate(New);
 
@@ -3967,6 +4389,7 @@ void CipherBase::Initialize(Environment* env, Local<Object> target) {
   env->SetProtoMethod(t, "init", Init);
   env->SetProtoMethod(t, "initiv", InitIv);
   env->SetProtoMethod(t, "update", Update);
+  env->SetProtoMethod(t, "updateAsync", UpdateAsync);
   env->SetProtoMethod(t, "final", Final);
   env->SetProtoMethod(t, "setAutoPadding", SetAutoPadding);
   env->SetProtoMethodNoSideEffect(t, "getAuthTag", GetAuthTag);
@@ -3986,6 +4409,10 @@ void CipherBase::New(const FunctionCallbackInfo<Value>& args) {
   new CipherBase(env, args.This(), kind);
 }
 
+CipherBase::~CipherBase() {
+  env()->crypto_context_pool()->Release(std::move(ctx_));
+}
+
 void CipherBase::CommonInit(const char* cipher_type,
                             const EVP_CIPHER* cipher,
                             const unsigned char* key,
@@ -3994,7 +4421,7 @@ void CipherBase::CommonInit(const char* cipher_type,
                             int iv_len,
                             unsigned int auth_tag_len) {
   CHECK(!ctx_);
-  ctx_.reset(EVP_CIPHER_CTX_new());
+  ctx_ = env()->crypto_context_pool()->TakeCipherCtx();
 
   const int mode = EVP_CIPHER_mode(cipher);
   if (mode == EVP_CIPH_WRAP_MODE)
@@ -4038,7 +4465,7 @@ void CipherBase::Init(const char* cipher_type,
   }
 #endif  // NODE_FIPS_MODE
 
-  const EVP_CIPHER* const cipher = EVP_get_cipherbyname(cipher_type);
+  const EVP_CIPHER* const cipher = GetCipherByName(cipher_type);
   if (cipher == nullptr)
     return THROW_ERR_CRYPTO_UNKNOWN_CIPHER(env());
 
@@ -4102,7 +4529,7 @@ void CipherBase::InitIv(const char* cipher_type,
   HandleScope scope(env()->isolate());
   MarkPopErrorOnReturn mark_pop_error_on_return;
 
-  const EVP_CIPHER* const cipher = EVP_get_cipherbyname(cipher_type);
+  const EVP_CIPHER* const cipher = GetCipherByName(cipher_type);
   if (cipher == nullptr) {
     return THROW_ERR_CRYPTO_UNKNOWN_CIPHER(env());
   }
@@ -4550,7 +4977,7 @@ bool CipherBase::Final(AllocatedBuffer* out) {
     }
   }
 
-  ctx_.reset();
+  env()->crypto_context_pool()->Release(std::move(ctx_));
 
   return ok;
 }
@@ -4588,6 +5015,7 @@ void Hmac::Initialize(Environment* env, Local<Object> target) {
 
   env->SetProtoMethod(t, "init", HmacInit);
   env->SetProtoMethod(t, "update", HmacUpdate);
+  env->SetProtoMethod(t, "updateAsync", HmacUpdateAsync);
   env->SetProtoMethod(t, "digest", HmacDigest);
 
   target->Set(env->context(),
@@ -4598,21 +5026,42 @@ void Hmac::Initialize(Environment* env, Local<Object> target) {
 
 void Hmac::New(const FunctionCallbackInfo<Value>& args) {
   Environment* env = Environment::GetCurrent(args);
-  new Hmac(env, args.This());
+
+  const Hmac* orig = nullptr;
+  if (args[0]->IsObject())
+    ASSIGN_OR_RETURN_UNWRAP(&orig, args[0].As<Object>());
+
+  Hmac* hmac = new Hmac(env, args.This());
+  if (orig == nullptr)
+    return;
+
+  // The context is released once the digest has been computed.
+  if (!orig->ctx_)
+    return THROW_ERR_CRYPTO_HASH_FINALIZED(env);
+  hmac->ctx_ = env->crypto_context_pool()->TakeHMACCtx();
+  if (!hmac->ctx_ || !HMAC_CTX_copy(hmac->ctx_.get(), orig->ctx_.get())) {
+    hmac->ctx_.reset();
+    return ThrowCryptoError(env, ERR_get_error(), "Digest copy error");
+  }
+}
+
+
+Hmac::~Hmac() {
+  env()->crypto_context_pool()->Release(std::move(ctx_));
 }
 
 
 void Hmac::HmacInit(const char* hash_type, const char* key, int key_len) {
   HandleScope scope(env()->isolate());
 
-  const EVP_MD* md = EVP_get_digestbyname(hash_type);
+  const EVP_MD* md = GetDigestByName(hash_type);
   if (md == nullptr) {
     return env()->ThrowError("Unknown message digest");
   }
   if (key_len == 0) {
     key = "";
   }
-  ctx_.reset(HMAC_CTX_new());
+  ctx_ = env()->crypto_context_pool()->TakeHMACCtx();
   if (!ctx_ || !HMAC_Init_ex(ctx_.get(), key, key_len, md, nullptr)) {
     ctx_.reset();
     return ThrowCryptoError(env(), ERR_get_error());
@@ -4681,7 +5130,7 @@ void Hmac::HmacDigest(const FunctionCallbackInfo<Value>& args) {
 
   if (hmac->ctx_) {
     HMAC_Final(hmac->ctx_.get(), md_value, &md_len);
-    hmac->ctx_.reset();
+    env->crypto_context_pool()->Release(std::move(hmac->ctx_));
   }
 
   Local<Value> error;
@@ -4706,6 +5155,7 @@ void Hash::Initialize(Environment* env, Local<Object> target) {
   t->InstanceTemplate()->SetInternalFieldCount(1);
 
   env->SetProtoMethod(t, "update", HashUpdate);
+  env->SetProtoMethod(t, "updateAsync", HashUpdateAsync);
   env->SetProtoMethod(t, "digest", HashDigest);
 
   target->Set(env->context(),
@@ -4722,10 +5172,13 @@ void Hash::New(const FunctionCallbackInfo<Value>& args) {
 
   if (args[0]->IsObject()) {
     ASSIGN_OR_RETURN_UNWRAP(&orig, args[0].As<Object>());
+    // The context is released once the digest has been computed.
+    if (!orig->mdctx_)
+      return THROW_ERR_CRYPTO_HASH_FINALIZED(env);
     md = EVP_MD_CTX_md(orig->mdctx_.get());
   } else {
     const node::Utf8Value hash_type(env->isolate(), args[0]);
-    md = EVP_get_digestbyname(*hash_type);
+    md = GetDigestByName(*hash_type);
   }
 
   Maybe<unsigned int> xof_md_len = Nothing<unsigned int>();
@@ -4747,8 +5200,15 @@ void Hash::New(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+Hash::~Hash() {
+  if (md_value_ != nullptr)
+    OPENSSL_clear_free(md_value_, md_len_);
+  env()->crypto_context_pool()->Release(std::move(mdctx_));
+}
+
+
 bool Hash::HashInit(const EVP_MD* md, Maybe<unsigned int> xof_md_len) {
-  mdctx_.reset(EVP_MD_CTX_new());
+  mdctx_ = env()->crypto_context_pool()->TakeMDCtx();
   if (!mdctx_ || EVP_DigestInit_ex(mdctx_.get(), md, nullptr) <= 0) {
     mdctx_.reset();
     return false;
@@ -4848,6 +5308,7 @@ void Hash::HashDigest(const FunctionCallbackInfo<Value>& args) {
     }
 
     hash->has_md_ = true;
+    env->crypto_context_pool()->Release(std::move(hash->mdctx_));
   }
 
   Local<Value> error;
@@ -4874,7 +5335,7 @@ SignBase::Error SignBase::Init(const char* sign_type) {
       strcmp(sign_type, "DSS1") == 0) {
     sign_type = "SHA1";
   }
-  const EVP_MD* md = EVP_get_digestbyname(sign_type);
+  const EVP_MD* md = GetDigestByName(sign_type);
   if (md == nullptr)
     return kSignUnknownDigest;
 
@@ -5225,7 +5686,7 @@ void SignOneShot(const FunctionCallbackInfo<Value>& args) {
     md = nullptr;
   } else {
     const node::Utf8Value sign_type(args.GetIsolate(), args[offset + 1]);
-    md = EVP_get_digestbyname(*sign_type);
+    md = GetDigestByName(*sign_type);
     if (md == nullptr)
       return CheckThrow(env, SignBase::Error::kSignUnknownDigest);
   }
@@ -5419,7 +5880,7 @@ void VerifyOneShot(const FunctionCallbackInfo<Value>& args) {
     md = nullptr;
   } else {
     const node::Utf8Value sign_type(args.GetIsolate(), args[offset + 2]);
-    md = EVP_get_digestbyname(*sign_type);
+    md = GetDigestByName(*sign_type);
     if (md == nullptr)
       return CheckThrow(env, SignBase::Error::kSignUnknownDigest);
   }
@@ -5555,7 +6016,7 @@ void PublicKeyCipher::Cipher(const FunctionCallbackInfo<Value>& args) {
   const char* oaep_hash = args[offset + 2]->IsString() ? *oaep_str : nullptr;
   const EVP_MD* digest = nullptr;
   if (oaep_hash != nullptr) {
-    digest = EVP_get_digestbyname(oaep_hash);
+    digest = GetDigestByName(oaep_hash);
     if (digest == nullptr)
       return THROW_ERR_OSSL_EVP_INVALID_DIGEST(env);
   }
@@ -6198,7 +6659,8 @@ bool ECDH::IsKeyPairValid() {
 // this object. This makes proper reporting of memory usage impossible.
 struct CryptoJob : public ThreadPoolWork {
   std::unique_ptr<AsyncWrap> async_wrap;
-  inline explicit CryptoJob(Environment* env) : ThreadPoolWork(env) {}
+  inline explicit CryptoJob(Environment* env)
+      : ThreadPoolWork(env, ThreadPoolWorkType::CRYPTO) {}
   inline void AfterThreadPoolWork(int status) final;
   virtual void AfterThreadPoolWork() = 0;
   static inline void Run(std::unique_ptr<CryptoJob> job, Local<Value> wrap);
@@ -6221,11 +6683,95 @@ void CryptoJob::Run(std::unique_ptr<CryptoJob> job, Local<Value> wrap) {
   CHECK_NULL(job->async_wrap);
   job->async_wrap.reset(Unwrap<AsyncWrap>(wrap.As<Object>()));
   CHECK_EQ(false, job->async_wrap->persistent().IsWeak());
-  job->ScheduleWork();
+  if (job->ScheduleWork() != 0)
+    return THROW_ERR_THREADPOOL_QUEUE_FULL(job->env());
   job.release();  // Run free, little job!
 }
 
 
+// JS makes sure that the object is not used otherwise while the job is in
+// flight, so that the job has the cipher or digest context to itself.
+template <typename T>
+struct UpdateJob : public CryptoJob {
+  BaseObjectPtr<T> target;
+  const char* data;  // Retained by the wrap object.
+  int len;
+  AllocatedBuffer out;
+  bool ok = false;
+
+  inline UpdateJob(Environment* env, T* target)
+      : CryptoJob(env), target(target) {}
+
+  static inline void Start(const FunctionCallbackInfo<Value>& args) {
+    Environment* env = Environment::GetCurrent(args);
+    T* target;
+    ASSIGN_OR_RETURN_UNWRAP(&target, args.Holder());
+    CHECK(args[0]->IsArrayBufferView());  // data; wrap object retains ref.
+    CHECK(args[1]->IsObject());  // wrap object
+    const size_t len = Buffer::Length(args[0]);
+    CHECK_LE(len, INT_MAX);
+
+    std::unique_ptr<UpdateJob> job(new UpdateJob(env, target));
+    job->data = Buffer::Data(args[0]);
+    job->len = static_cast<int>(len);
+    if (!job->Check()) return;
+    Run(std::move(job), args[1]);
+  }
+
+  // Performs the checks that may throw, before the job is scheduled.
+  inline bool Check() { return true; }
+
+  inline void DoThreadPoolWork() override;
+
+  inline void AfterThreadPoolWork() override {
+    Local<Value> argv[] = {
+      Boolean::New(env()->isolate(), ok),
+      Undefined(env()->isolate())
+    };
+    if (ok && out.data() != nullptr &&
+        !out.ToBuffer().ToLocal(&argv[1])) {
+      return;
+    }
+    async_wrap->MakeCallback(env()->ondone_string(), arraysize(argv), argv);
+  }
+};
+
+template <>
+bool UpdateJob<CipherBase>::Check() {
+  CipherBase* cipher = target.get();
+  return !cipher->ctx_ ||
+         EVP_CIPHER_CTX_mode(cipher->ctx_.get()) != EVP_CIPH_CCM_MODE ||
+         cipher->CheckCCMMessageLength(len);
+}
+
+template <>
+void UpdateJob<CipherBase>::DoThreadPoolWork() {
+  ok = target->Update(data, len, &out) == CipherBase::kSuccess;
+}
+
+template <>
+void UpdateJob<Hash>::DoThreadPoolWork() {
+  ok = target->HashUpdate(data, len);
+}
+
+template <>
+void UpdateJob<Hmac>::DoThreadPoolWork() {
+  ok = target->HmacUpdate(data, len);
+}
+
+void CipherBase::UpdateAsync(const FunctionCallbackInfo<Value>& args) {
+  UpdateJob<CipherBase>::Start(args);
+}
+
+void Hash::HashUpdateAsync(const FunctionCallbackInfo<Value>& args) {
+  UpdateJob<Hash>::Start(args);
+}
+
+void Hmac::HmacUpdateAsync(const FunctionCallbackInfo<Value>& args) {
+  UpdateJob<Hmac>::Start(args);
+}
+
+
 inline void CopyBuffer(Local<Value> buf, std::vector<char>* vec) {
   CHECK(buf->IsArrayBufferView());
   vec->clear();
@@ -6340,7 +6886,7 @@ inline void PBKDF2(const FunctionCallbackInfo<Value>& args) {
   CopyBuffer(args[2], &job->salt);
   job->iteration_count = args[3].As<Uint32>()->Value();
   Utf8Value digest_name(args.GetIsolate(), args[4]);
-  job->digest = EVP_get_digestbyname(*digest_name);
+  job->digest = GetDigestByName(*digest_name);
   if (job->digest == nullptr) return rv.Set(-1);
   if (args[5]->IsObject()) return PBKDF2Job::Run(std::move(job), args[5]);
   env->PrintSyncTrace();
@@ -6349,6 +6895,347 @@ inline void PBKDF2(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+// Computes the digests of many buffers with the same hash function, reusing
+// one EVP_MD_CTX for all of them. The digests are stored one after the other
+// in a single output buffer.
+struct HashBatchJob : public CryptoJob {
+  const EVP_MD* md;
+  std::vector<std::pair<const unsigned char*, size_t>> inputs;
+  AllocatedBuffer out;
+  CryptoErrorVector errors;
+
+  inline explicit HashBatchJob(Environment* env) : CryptoJob(env) {}
+
+  inline void DoThreadPoolWork() override {
+    EVPMDPointer mdctx(EVP_MD_CTX_new());
+    if (!mdctx) return errors.Capture();
+    auto digest = reinterpret_cast<unsigned char*>(out.data());
+    for (const auto& input : inputs) {
+      unsigned int len;
+      if (EVP_DigestInit_ex(mdctx.get(), md, nullptr) <= 0 ||
+          EVP_DigestUpdate(mdctx.get(), input.first, input.second) <= 0 ||
+          EVP_DigestFinal_ex(mdctx.get(), digest, &len) <= 0) {
+        return errors.Capture();
+      }
+      digest += len;
+    }
+  }
+
+  inline void AfterThreadPoolWork() override {
+    Local<Value> argv[2];
+    if (ToResult(&argv[0], &argv[1]))
+      async_wrap->MakeCallback(env()->ondone_string(), arraysize(argv), argv);
+  }
+
+  inline bool ToResult(Local<Value>* err, Local<Value>* result) {
+    *err = Undefined(env()->isolate());
+    *result = Undefined(env()->isolate());
+    if (!errors.empty())
+      return errors.ToException(env()).ToLocal(err);
+    return out.ToBuffer().ToLocal(result);
+  }
+};
+
+
+void HashBatch(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  CHECK(args[0]->IsString());  // algorithm
+  CHECK(args[1]->IsArray());  // buffers; wrap object retains ref.
+  CHECK(args[2]->IsUint32());  // start
+  CHECK(args[3]->IsUint32());  // end
+  CHECK(args[4]->IsObject() || args[4]->IsUndefined());  // wrap object
+
+  Local<Array> buffers = args[1].As<Array>();
+  const uint32_t start = args[2].As<Uint32>()->Value();
+  const uint32_t end = args[3].As<Uint32>()->Value();
+  CHECK_LE(start, end);
+  CHECK_LE(end, buffers->Length());
+
+  const Utf8Value algorithm(env->isolate(), args[0]);
+  std::unique_ptr<HashBatchJob> job(new HashBatchJob(env));
+  job->md = GetDigestByName(*algorithm);
+  if (job->md == nullptr) return args.GetReturnValue().Set(-1);
+
+  job->inputs.reserve(end - start);
+  for (uint32_t i = start; i < end; i++) {
+    Local<Value> buffer;
+    if (!buffers->Get(env->context(), i).ToLocal(&buffer)) return;
+    CHECK(buffer->IsArrayBufferView());
+    job->inputs.emplace_back(
+        reinterpret_cast<const unsigned char*>(Buffer::Data(buffer)),
+        Buffer::Length(buffer));
+  }
+  job->out = env->AllocateManaged(
+      job->inputs.size() * static_cast<size_t>(EVP_MD_size(job->md)));
+
+  if (args[4]->IsObject()) return HashBatchJob::Run(std::move(job), args[4]);
+  job->DoThreadPoolWork();
+  Local<Value> err;
+  Local<Value> result;
+  if (!job->ToResult(&err, &result)) return;
+  if (!err->IsUndefined()) {
+    env->isolate()->ThrowException(err);
+    return;
+  }
+  args.GetReturnValue().Set(result);
+}
+
+
+// Signs a batch of messages, or verifies one signature, with one key. The
+// job holds a reference to the key, which OpenSSL allows to be used by
+// several threads at the same time.
+struct SignJob : public CryptoJob {
+  enum Mode { kSign, kVerify };
+
+  const Mode mode;
+  const ManagedEVPPKey key;
+  const EVP_MD* md = nullptr;
+  int rsa_padding;
+  Maybe<int> rsa_salt_len = Nothing<int>();
+  DSASigEnc dsa_sig_enc = kSigEncDER;
+  // Retained by the wrap object.
+  std::vector<std::pair<const unsigned char*, size_t>> inputs;
+  std::vector<AllocatedBuffer> signatures;
+  std::vector<size_t> signature_lengths;
+  ByteSource signature;
+  bool verify_result = false;
+  SignBase::Error error = SignBase::Error::kSignOk;
+  CryptoErrorVector errors;
+
+  inline SignJob(Environment* env, Mode mode, const ManagedEVPPKey& key)
+      : CryptoJob(env),
+        mode(mode),
+        key(key),
+        rsa_padding(GetDefaultSignPadding(key)) {}
+
+  // Reads the digest, padding, salt length and signature encoding, which
+  // start at `args[offset]`.
+  inline bool ParseOptions(const FunctionCallbackInfo<Value>& args,
+                           unsigned int offset) {
+    if (!args[offset]->IsNullOrUndefined()) {
+      const node::Utf8Value sign_type(args.GetIsolate(), args[offset]);
+      md = GetDigestByName(*sign_type);
+      if (md == nullptr) {
+        CheckThrow(env(), SignBase::Error::kSignUnknownDigest);
+        return false;
+      }
+    }
+
+    if (!args[offset + 1]->IsUndefined()) {
+      CHECK(args[offset + 1]->IsInt32());
+      rsa_padding = args[offset + 1].As<Int32>()->Value();
+    }
+
+    if (!args[offset + 2]->IsUndefined()) {
+      CHECK(args[offset + 2]->IsInt32());
+      rsa_salt_len = Just<int>(args[offset + 2].As<Int32>()->Value());
+    }
+
+    CHECK(args[offset + 3]->IsInt32());
+    dsa_sig_enc = static_cast<DSASigEnc>(args[offset + 3].As<Int32>()->Value());
+    return true;
+  }
+
+  inline void DoThreadPoolWork() override {
+    ClearErrorOnReturn clear_error_on_return;
+    if (mode == kSign)
+      DoSign();
+    else
+      DoVerify();
+  }
+
+  inline void DoSign() {
+    EVPMDPointer mdctx(EVP_MD_CTX_new());
+    for (size_t i = 0; i < inputs.size(); i++) {
+      EVP_PKEY_CTX* pkctx = nullptr;
+      if (!mdctx ||
+          !EVP_MD_CTX_reset(mdctx.get()) ||
+          !EVP_DigestSignInit(mdctx.get(), &pkctx, md, nullptr, key.get())) {
+        return Fail(SignBase::Error::kSignInit);
+      }
+      if (!ApplyRSAOptions(key, pkctx, rsa_padding, rsa_salt_len))
+        return Fail(SignBase::Error::kSignPrivateKey);
+      size_t sig_len = signatures[i].size();
+      if (!EVP_DigestSign(mdctx.get(),
+                          reinterpret_cast<unsigned char*>(
+                              signatures[i].data()),
+                          &sig_len,
+                          inputs[i].first,
+                          inputs[i].second)) {
+        return Fail(SignBase::Error::kSignPrivateKey);
+      }
+      signature_lengths[i] = sig_len;
+    }
+  }
+
+  inline void DoVerify() {
+    EVP_PKEY_CTX* pkctx = nullptr;
+    EVPMDPointer mdctx(EVP_MD_CTX_new());
+    if (!mdctx ||
+        !EVP_DigestVerifyInit(mdctx.get(), &pkctx, md, nullptr, key.get())) {
+      return Fail(SignBase::Error::kSignInit);
+    }
+    if (!ApplyRSAOptions(key, pkctx, rsa_padding, rsa_salt_len))
+      return Fail(SignBase::Error::kSignPublicKey);
+    const int r = EVP_DigestVerify(
+        mdctx.get(),
+        reinterpret_cast<const unsigned char*>(signature.get()),
+        signature.size(),
+        inputs[0].first,
+        inputs[0].second);
+    if (r != 0 && r != 1)
+      return Fail(SignBase::Error::kSignPublicKey);
+    verify_result = r == 1;
+  }
+
+  inline void Fail(SignBase::Error err) {
+    error = err;
+    errors.Capture();
+  }
+
+  inline void AfterThreadPoolWork() override {
+    Local<Value> argv[2];
+    if (ToResult(&argv[0], &argv[1]))
+      async_wrap->MakeCallback(env()->ondone_string(), arraysize(argv), argv);
+  }
+
+  inline bool ToResult(Local<Value>* err, Local<Value>* result) {
+    Isolate* isolate = env()->isolate();
+    *err = Undefined(isolate);
+    *result = Undefined(isolate);
+    if (error != SignBase::Error::kSignOk) {
+      // Matches the messages of CheckThrow().
+      const char* message = nullptr;
+      if (errors.empty()) {
+        switch (error) {
+          case SignBase::Error::kSignInit:
+            message = "EVP_SignInit_ex failed";
+            break;
+          case SignBase::Error::kSignPrivateKey:
+            message = "PEM_read_bio_PrivateKey failed";
+            break;
+          default:
+            message = "PEM_read_bio_PUBKEY failed";
+        }
+      }
+      return errors.ToException(
+          env(),
+          message == nullptr ? Local<String>() : OneByteString(isolate,
+                                                               message))
+          .ToLocal(err);
+    }
+
+    if (mode == kVerify) {
+      *result = Boolean::New(isolate, verify_result);
+      return true;
+    }
+
+    std::vector<Local<Value>> values(signatures.size());
+    for (size_t i = 0; i < signatures.size(); i++) {
+      signatures[i].Resize(signature_lengths[i]);
+      if (dsa_sig_enc == kSigEncP1363) {
+        signatures[i] =
+            ConvertSignatureToP1363(env(), key, std::move(signatures[i]));
+      }
+      if (!signatures[i].ToBuffer().ToLocal(&values[i]))
+        return false;
+    }
+    *result = Array::New(isolate, values.data(), values.size());
+    return true;
+  }
+};
+
+
+void SignBatch(const FunctionCallbackInfo<Value>& args) {
+  ClearErrorOnReturn clear_error_on_return;
+  Environment* env = Environment::GetCurrent(args);
+
+  unsigned int offset = 0;
+  ManagedEVPPKey key = GetPrivateKeyFromJs(args, &offset, true);
+  if (!key)
+    return;
+
+  if (!ValidateDSAParameters(key.get()))
+    return CheckThrow(env, SignBase::Error::kSignPrivateKey);
+
+  CHECK(args[offset]->IsArray());  // messages; wrap object retains ref.
+  CHECK(args[offset + 5]->IsObject() || args[offset + 5]->IsUndefined());
+
+  std::unique_ptr<SignJob> job(new SignJob(env, SignJob::kSign, key));
+  if (!job->ParseOptions(args, offset + 1))
+    return;
+
+  Local<Array> messages = args[offset].As<Array>();
+  const uint32_t count = messages->Length();
+  const size_t max_sig_len = EVP_PKEY_size(key.get());
+  job->inputs.reserve(count);
+  job->signatures.reserve(count);
+  job->signature_lengths.resize(count);
+  for (uint32_t i = 0; i < count; i++) {
+    Local<Value> message;
+    if (!messages->Get(env->context(), i).ToLocal(&message))
+      return;
+    CHECK(message->IsArrayBufferView());
+    job->inputs.emplace_back(
+        reinterpret_cast<const unsigned char*>(Buffer::Data(message)),
+        Buffer::Length(message));
+    job->signatures.emplace_back(env->AllocateManaged(max_sig_len));
+  }
+
+  if (args[offset + 5]->IsObject())
+    return SignJob::Run(std::move(job), args[offset + 5]);
+  job->DoThreadPoolWork();
+  Local<Value> err;
+  Local<Value> result;
+  if (!job->ToResult(&err, &result))
+    return;
+  if (!err->IsUndefined()) {
+    env->isolate()->ThrowException(err);
+    return;
+  }
+  args.GetReturnValue().Set(result);
+}
+
+
+void VerifyAsync(const FunctionCallbackInfo<Value>& args) {
+  ClearErrorOnReturn clear_error_on_return;
+  Environment* env = Environment::GetCurrent(args);
+
+  unsigned int offset = 0;
+  ManagedEVPPKey key = GetPublicOrPrivateKeyFromJs(args, &offset);
+  if (!key)
+    return;
+
+  ArrayBufferViewContents<char> sig(args[offset]);
+  CHECK(args[offset + 1]->IsArrayBufferView());  // Retained by wrap object.
+  CHECK(args[offset + 6]->IsObject());  // wrap object
+
+  std::unique_ptr<SignJob> job(new SignJob(env, SignJob::kVerify, key));
+  if (!job->ParseOptions(args, offset + 2))
+    return;
+
+  ByteSource signature = ByteSource::Foreign(sig.data(), sig.length());
+  if (job->dsa_sig_enc == kSigEncP1363) {
+    signature = ConvertSignatureToDER(key, sig);
+    if (!signature)
+      return CheckThrow(env, SignBase::Error::kSignMalformedSignature);
+  }
+
+  // Small signatures can be in the stack storage of `sig`, which does not
+  // outlive this function, so the job needs a copy of its own.
+  char* copy = MallocOpenSSL<char>(signature.size());
+  if (signature.size() > 0)
+    memcpy(copy, signature.get(), signature.size());
+  job->signature = ByteSource::Allocated(copy, signature.size());
+
+  Local<Value> data = args[offset + 1];
+  job->inputs.emplace_back(
+      reinterpret_cast<const unsigned char*>(Buffer::Data(data)),
+      Buffer::Length(data));
+  SignJob::Run(std::move(job), args[offset + 6]);
+}
+
+
 #ifndef OPENSSL_NO_SCRYPT
 struct ScryptJob : public CryptoJob {
   unsigned char* keybuf_data;
@@ -6825,7 +7712,7 @@ void GenerateKeyPairRSAPSS(const FunctionCallbackInfo<Value>& args) {
   if (!args[2]->IsUndefined()) {
     CHECK(args[2]->IsString());
     String::Utf8Value md_name(env->isolate(), args[2].As<String>());
-    md = EVP_get_digestbyname(*md_name);
+    md = GetDigestByName(*md_name);
     if (md == nullptr)
       return env->ThrowTypeError("Digest method not supported");
   }
@@ -6834,7 +7721,7 @@ void GenerateKeyPairRSAPSS(const FunctionCallbackInfo<Value>& args) {
   if (!args[3]->IsUndefined()) {
     CHECK(args[3]->IsString());
     String::Utf8Value mgf1_md_name(env->isolate(), args[3].As<String>());
-    mgf1_md = EVP_get_digestbyname(*mgf1_md_name);
+    mgf1_md = GetDigestByName(*mgf1_md_name);
     if (mgf1_md == nullptr)
       return env->ThrowTypeError("Digest method not supported");
   }
@@ -7333,6 +8220,7 @@ void Initialize(Local<Object> target,
   uv_once(&init_once, InitCryptoOnce);
 
   Environment* env = Environment::GetCurrent(context);
+  env->set_crypto_context_pool(std::make_unique<ContextPool>());
   SecureContext::Initialize(env, target);
   env->set_crypto_key_object_constructor(KeyObject::Initialize(env, target));
   CipherBase::Initialize(env, target);
@@ -7351,6 +8239,9 @@ void Initialize(Local<Object> target,
   // Exposed for testing purposes only.
   env->SetMethodNoSideEffect(target, "isExtraRootCertsFileLoaded",
                              IsExtraRootCertsFileLoaded);
+  env->SetMethod(target, "initSharedSessionCache", InitSharedSessionCache);
+  env->SetMethodNoSideEffect(target, "getSharedSessionCacheStats",
+                             GetSharedSessionCacheStats);
 
   env->SetMethodNoSideEffect(target, "ECDHConvertKey", ConvertKey);
 #ifndef OPENSSL_NO_ENGINE
@@ -7363,6 +8254,9 @@ void Initialize(Local<Object> target,
 #endif
 
   env->SetMethod(target, "pbkdf2", PBKDF2);
+  env->SetMethod(target, "hashBatch", HashBatch);
+  env->SetMethod(target, "signBatch", SignBatch);
+  env->SetMethod(target, "verifyAsync", VerifyAsync);
   env->SetMethod(target, "generateKeyPairRSA", GenerateKeyPairRSA);
   env->SetMethod(target, "generateKeyPairRSAPSS", GenerateKeyPairRSAPSS);
   env->SetMethod(target, "generateKeyPairDSA", GenerateKeyPairDSA);
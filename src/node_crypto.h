@@ -26,6 +26,7 @@
 
 // ClientHelloParser
 #include "node_crypto_clienthello.h"
+#include "node_crypto_session_cache.h"
 
 #include "env.h"
 #include "base_object.h"
@@ -68,6 +69,8 @@ using PKCS8Pointer = DeleteFnPtr<PKCS8_PRIV_KEY_INFO, PKCS8_PRIV_KEY_INFO_free>;
 using EVPKeyPointer = DeleteFnPtr<EVP_PKEY, EVP_PKEY_free>;
 using EVPKeyCtxPointer = DeleteFnPtr<EVP_PKEY_CTX, EVP_PKEY_CTX_free>;
 using EVPMDPointer = DeleteFnPtr<EVP_MD_CTX, EVP_MD_CTX_free>;
+using EVPCipherCtxPointer = DeleteFnPtr<EVP_CIPHER_CTX, EVP_CIPHER_CTX_free>;
+using HMACCtxPointer = DeleteFnPtr<HMAC_CTX, HMAC_CTX_free>;
 using RSAPointer = DeleteFnPtr<RSA, RSA_free>;
 using ECPointer = DeleteFnPtr<EC_KEY, EC_KEY_free>;
 using BignumPointer = DeleteFnPtr<BIGNUM, BN_free>;
@@ -84,6 +87,30 @@ extern void UseExtraCaCerts(const std::string& file);
 
 void InitCryptoOnce();
 
+// Like EVP_get_cipherbyname() and EVP_get_digestbyname(), but successful
+// lookups are cached per thread.
+const EVP_CIPHER* GetCipherByName(const char* name);
+const EVP_MD* GetDigestByName(const char* name);
+
+// Free lists of the OpenSSL contexts of one Environment's Hash, Hmac and
+// CipherBase objects, so that short-lived objects do not need to allocate
+// new ones. Contexts are reset when they are released.
+class ContextPool {
+ public:
+  EVPMDPointer TakeMDCtx();
+  HMACCtxPointer TakeHMACCtx();
+  EVPCipherCtxPointer TakeCipherCtx();
+
+  void Release(EVPMDPointer ctx);
+  void Release(HMACCtxPointer ctx);
+  void Release(EVPCipherCtxPointer ctx);
+
+ private:
+  std::vector<EVPMDPointer> md_ctxs_;
+  std::vector<HMACCtxPointer> hmac_ctxs_;
+  std::vector<EVPCipherCtxPointer> cipher_ctxs_;
+};
+
 class SecureContext : public BaseObject {
  public:
   ~SecureContext() override {
@@ -118,6 +145,25 @@ class SecureContext : public BaseObject {
   unsigned char ticket_key_aes_[16];
   unsigned char ticket_key_hmac_[16];
 
+  // Set by EnableSharedSessionCache().
+  std::shared_ptr<SharedSessionCache> shared_session_cache_;
+
+  enum OCSPResponseState {
+    kOCSPResponseMissing,
+    kOCSPResponseFresh,
+    kOCSPResponseStale
+  };
+
+  // The OCSP response that is stapled by servers using this context, if they
+  // do not have one of their own. Set by SetOCSPResponse(), and kept until
+  // the response's nextUpdate time. It is considered stale, i.e. it should be
+  // refreshed, once half of its validity period has passed.
+  std::vector<unsigned char> ocsp_response_;
+  int64_t ocsp_response_refresh_ = 0;
+  int64_t ocsp_response_expires_ = 0;
+
+  OCSPResponseState ocsp_response_state() const;
+
  protected:
   // OpenSSL structures are opaque. This is sizeof(SSL_CTX) for OpenSSL 1.1.1b:
   static const int64_t kExternalSize = 1024;
@@ -154,10 +200,18 @@ class SecureContext : public BaseObject {
 #endif  // !OPENSSL_NO_ENGINE
   static void GetTicketKeys(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void SetTicketKeys(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void EnableSharedSessionCache(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
   static void SetFreeListLength(
       const v8::FunctionCallbackInfo<v8::Value>& args);
   static void EnableTicketKeyCallback(
       const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void BuildCertChain(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void EnableKeyOffload(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void SetOCSPResponse(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void GetOCSPResponseState(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
   static void CtxGetter(const v8::FunctionCallbackInfo<v8::Value>& info);
 
   template <bool primary>
@@ -207,11 +261,13 @@ class SSLWrap {
       : env_(env),
         kind_(kind),
         next_sess_(nullptr),
+        shared_session_cache_(sc->shared_session_cache_),
         session_callbacks_(false),
         awaiting_new_session_(false),
         cert_cb_(nullptr),
         cert_cb_arg_(nullptr),
-        cert_cb_running_(false) {
+        cert_cb_running_(false),
+        ocsp_cache_(false) {
     ssl_.reset(SSL_new(sc->ctx_.get()));
     CHECK(ssl_);
     env_->isolate()->AdjustAmountOfExternalAllocatedMemory(kExternalSize);
@@ -270,6 +326,7 @@ class SSLWrap {
   static void NewSessionDone(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void SetOCSPResponse(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void RequestOCSP(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void EnableOCSPCache(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void GetEphemeralKeyInfo(
       const v8::FunctionCallbackInfo<v8::Value>& args);
   static void GetProtocol(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -302,6 +359,7 @@ class SSLWrap {
   Environment* const env_;
   Kind kind_;
   SSLSessionPointer next_sess_;
+  std::shared_ptr<SharedSessionCache> shared_session_cache_;
   SSLPointer ssl_;
   bool session_callbacks_;
   bool awaiting_new_session_;
@@ -310,11 +368,16 @@ class SSLWrap {
   CertCb cert_cb_;
   void* cert_cb_arg_;
   bool cert_cb_running_;
+  // Set by EnableOCSPCache(). If the context's cached OCSP response is fresh,
+  // the certificate callback completes without calling into JS.
+  bool ocsp_cache_;
 
   ClientHelloParser hello_parser_;
 
   v8::Global<v8::ArrayBufferView> ocsp_response_;
   BaseObjectPtr<SecureContext> sni_context_;
+  // The protocols a server selects from, set by SetALPNProtocols().
+  std::vector<unsigned char> alpn_protos_;
 
   friend class SecureContext;
 };
@@ -477,6 +540,10 @@ class KeyObject : public BaseObject {
   ManagedEVPPKey asymmetric_key_;
 };
 
+// Runs an update of a CipherBase, Hash or Hmac on the threadpool.
+template <typename T>
+struct UpdateJob;
+
 class CipherBase : public BaseObject {
  public:
   static void Initialize(Environment* env, v8::Local<v8::Object> target);
@@ -535,6 +602,7 @@ class CipherBase : public BaseObject {
   static void Init(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void InitIv(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Update(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void UpdateAsync(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Final(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void SetAutoPadding(const v8::FunctionCallbackInfo<v8::Value>& args);
 
@@ -542,6 +610,9 @@ class CipherBase : public BaseObject {
   static void SetAuthTag(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void SetAAD(const v8::FunctionCallbackInfo<v8::Value>& args);
 
+  template <typename T>
+  friend struct UpdateJob;
+
   CipherBase(Environment* env,
              v8::Local<v8::Object> wrap,
              CipherKind kind)
@@ -554,8 +625,10 @@ class CipherBase : public BaseObject {
     MakeWeak();
   }
 
+  ~CipherBase() override;
+
  private:
-  DeleteFnPtr<EVP_CIPHER_CTX, EVP_CIPHER_CTX_free> ctx_;
+  EVPCipherCtxPointer ctx_;
   const CipherKind kind_;
   AuthTagState auth_tag_state_;
   unsigned int auth_tag_len_;
@@ -580,16 +653,23 @@ class Hmac : public BaseObject {
   static void New(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void HmacInit(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void HmacUpdate(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void HmacUpdateAsync(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
   static void HmacDigest(const v8::FunctionCallbackInfo<v8::Value>& args);
 
+  template <typename T>
+  friend struct UpdateJob;
+
   Hmac(Environment* env, v8::Local<v8::Object> wrap)
       : BaseObject(env, wrap),
         ctx_(nullptr) {
     MakeWeak();
   }
 
+  ~Hmac() override;
+
  private:
-  DeleteFnPtr<HMAC_CTX, HMAC_CTX_free> ctx_;
+  HMACCtxPointer ctx_;
 };
 
 class Hash : public BaseObject {
@@ -607,6 +687,8 @@ class Hash : public BaseObject {
  protected:
   static void New(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void HashUpdate(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void HashUpdateAsync(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
   static void HashDigest(const v8::FunctionCallbackInfo<v8::Value>& args);
 
   Hash(Environment* env, v8::Local<v8::Object> wrap)
@@ -617,10 +699,7 @@ class Hash : public BaseObject {
     MakeWeak();
   }
 
-  ~Hash() override {
-    if (md_value_ != nullptr)
-      OPENSSL_clear_free(md_value_, md_len_);
-  }
+  ~Hash() override;
 
  private:
   EVPMDPointer mdctx_;
@@ -0,0 +1,334 @@
+#include "node_crypto_session_cache.h"
+#include "node_mutex.h"
+#include "util-inl.h"
+#include "uv.h"
+
+#include "openssl/rand.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sched.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+namespace node {
+namespace crypto {
+
+namespace {
+
+constexpr uint32_t kMagic = 0x4e545343;  // "NTSC"
+constexpr uint32_t kVersion = 1;
+constexpr size_t kWays = 4;
+// Server sessions without a client certificate are well below this size.
+constexpr size_t kMaxSessionLength = 2048;
+// Attempts to take a bucket lock before checking whether its owner is alive.
+constexpr size_t kMaxSpins = 1000;
+
+static_assert(ATOMIC_INT_LOCK_FREE == 2 && ATOMIC_LLONG_LOCK_FREE == 2,
+              "Atomics in shared memory need to be lock-free");
+
+Mutex process_cache_mutex;
+std::shared_ptr<SharedSessionCache> process_cache;
+
+}  // anonymous namespace
+
+struct SharedSessionCache::Entry {
+  uint64_t last_used;
+  int64_t expires;
+  uint32_t id_length;  // 0 if the entry is unused.
+  uint32_t session_length;
+  unsigned char id[SSL_MAX_SSL_SESSION_ID_LENGTH];
+  unsigned char session[kMaxSessionLength];
+};
+
+struct SharedSessionCache::Bucket {
+  // The pid of the process that holds the lock, or 0.
+  std::atomic<uint32_t> owner;
+  Entry entries[kWays];
+};
+
+struct SharedSessionCache::Header {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t bucket_count;
+  unsigned char ticket_keys[kTicketKeysLength];
+  std::atomic<uint64_t> clock;
+  std::atomic<uint64_t> counters[kCounterCount];
+};
+
+size_t SharedSessionCache::BucketsOffset() {
+  return RoundUp(sizeof(Header), alignof(Bucket));
+}
+
+// Bucket locks are only held while copying a session in or out. A process
+// that holds one for long has most likely died while holding it, in which
+// case the lock is taken over and the bucket is cleared, because its entries
+// may have been left half-written.
+class SharedSessionCache::BucketLock {
+ public:
+  explicit BucketLock(Bucket* bucket) : bucket_(bucket) {
+    const uint32_t self = static_cast<uint32_t>(uv_os_getpid());
+    for (size_t spins = 0;; spins++) {
+      uint32_t owner = 0;
+      if (bucket_->owner.compare_exchange_weak(owner, self,
+                                               std::memory_order_acquire)) {
+        return;
+      }
+      if (spins < kMaxSpins)
+        continue;
+#ifndef _WIN32
+      if (owner != 0 && owner != self &&
+          kill(static_cast<pid_t>(owner), 0) == -1 && errno == ESRCH &&
+          bucket_->owner.compare_exchange_strong(owner, self,
+                                                 std::memory_order_acquire)) {
+        for (Entry& entry : bucket_->entries)
+          entry.id_length = 0;
+        return;
+      }
+      sched_yield();
+#endif
+    }
+  }
+
+  ~BucketLock() {
+    bucket_->owner.store(0, std::memory_order_release);
+  }
+
+  BucketLock(const BucketLock&) = delete;
+  BucketLock& operator=(const BucketLock&) = delete;
+
+ private:
+  Bucket* bucket_;
+};
+
+SharedSessionCache::SharedSessionCache(int fd, void* base, size_t size)
+    : fd_(fd),
+      base_(base),
+      size_(size),
+      header_(static_cast<Header*>(base)),
+      buckets_(reinterpret_cast<Bucket*>(
+          static_cast<char*>(base) + BucketsOffset())) {}
+
+SharedSessionCache::~SharedSessionCache() {
+#ifndef _WIN32
+  munmap(base_, size_);
+  close(fd_);
+#endif
+}
+
+std::shared_ptr<SharedSessionCache> SharedSessionCache::ForProcess(
+    int fd, size_t entries) {
+  Mutex::ScopedLock lock(process_cache_mutex);
+  if (!process_cache)
+    process_cache = fd == -1 ? Create(entries) : Open(fd);
+  return process_cache;
+}
+
+std::shared_ptr<SharedSessionCache> SharedSessionCache::GetForProcess() {
+  Mutex::ScopedLock lock(process_cache_mutex);
+  return process_cache;
+}
+
+std::shared_ptr<SharedSessionCache> SharedSessionCache::Create(
+    size_t entries) {
+#ifdef _WIN32
+  return nullptr;
+#else
+  const uint64_t bucket_count = std::max<size_t>(1, (entries + kWays - 1) /
+                                                        kWays);
+  const size_t size = BucketsOffset() + bucket_count * sizeof(Bucket);
+
+#if defined(__linux__) && defined(SYS_memfd_create)
+  // MFD_CLOEXEC; the descriptor is passed on to cluster workers explicitly.
+  int fd = syscall(SYS_memfd_create, "node-tls-session-cache", 1);
+#else
+  char name[64];
+  snprintf(name, sizeof(name), "/node-tls-session-cache-%d",
+           uv_os_getpid());
+  int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (fd != -1)
+    shm_unlink(name);
+#endif
+  if (fd == -1)
+    return nullptr;
+
+  // The new memory is zero-filled, so all entries are unused and all
+  // bucket locks are free.
+  void* base = MAP_FAILED;
+  if (ftruncate(fd, size) == 0)
+    base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (base == MAP_FAILED) {
+    close(fd);
+    return nullptr;
+  }
+
+  std::shared_ptr<SharedSessionCache> cache(
+      new SharedSessionCache(fd, base, size));
+  Header* header = cache->header_;
+  if (RAND_bytes(header->ticket_keys, sizeof(header->ticket_keys)) <= 0)
+    return nullptr;
+  header->bucket_count = bucket_count;
+  header->version = kVersion;
+  header->magic = kMagic;
+  return cache;
+#endif
+}
+
+std::shared_ptr<SharedSessionCache> SharedSessionCache::Open(int fd) {
+#ifdef _WIN32
+  return nullptr;
+#else
+  struct stat st;
+  if (fstat(fd, &st) != 0 ||
+      static_cast<size_t>(st.st_size) < BucketsOffset()) {
+    return nullptr;
+  }
+
+  const size_t size = st.st_size;
+  void* base =
+      mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (base == MAP_FAILED)
+    return nullptr;
+
+  std::shared_ptr<SharedSessionCache> cache(
+      new SharedSessionCache(fd, base, size));
+  const Header* header = cache->header_;
+  if (header->magic != kMagic || header->version != kVersion ||
+      header->bucket_count == 0 ||
+      size < BucketsOffset() + header->bucket_count * sizeof(Bucket)) {
+    return nullptr;
+  }
+  return cache;
+#endif
+}
+
+SharedSessionCache::Bucket* SharedSessionCache::GetBucket(
+    const unsigned char* id, size_t id_length) const {
+  // FNV-1a. Session IDs are random, but may be chosen by the client.
+  uint64_t hash = 0xcbf29ce484222325;
+  for (size_t i = 0; i < id_length; i++) {
+    hash ^= id[i];
+    hash *= 0x100000001b3;
+  }
+  return &buckets_[hash % header_->bucket_count];
+}
+
+void SharedSessionCache::Store(SSL_SESSION* sess) {
+  unsigned int id_length;
+  const unsigned char* id = SSL_SESSION_get_id(sess, &id_length);
+  if (id_length == 0 || id_length > SSL_MAX_SSL_SESSION_ID_LENGTH)
+    return;
+
+  int length = i2d_SSL_SESSION(sess, nullptr);
+  if (length <= 0 || static_cast<size_t>(length) > kMaxSessionLength)
+    return;
+  unsigned char session[kMaxSessionLength];
+  unsigned char* p = session;
+  i2d_SSL_SESSION(sess, &p);
+
+  const int64_t now = time(nullptr);
+  const int64_t expires =
+      SSL_SESSION_get_time(sess) + SSL_SESSION_get_timeout(sess);
+
+  Bucket* bucket = GetBucket(id, id_length);
+  BucketLock lock(bucket);
+
+  // Replace the entry for the same session, an unused or expired entry, or
+  // the least recently used entry, in that order of preference.
+  auto is_free = [now](const Entry& entry) {
+    return entry.id_length == 0 || entry.expires <= now;
+  };
+  Entry* target = nullptr;
+  bool replaces_same = false;
+  for (Entry& entry : bucket->entries) {
+    if (entry.id_length == id_length &&
+        memcmp(entry.id, id, id_length) == 0) {
+      target = &entry;
+      replaces_same = true;
+      break;
+    }
+    if (target == nullptr ||
+        (is_free(entry) && !is_free(*target)) ||
+        (!is_free(entry) && !is_free(*target) &&
+         entry.last_used < target->last_used)) {
+      target = &entry;
+    }
+  }
+
+  if (!replaces_same && !is_free(*target))
+    Count(kEvictions);
+
+  target->last_used = header_->clock.fetch_add(1, std::memory_order_relaxed);
+  target->expires = expires;
+  target->id_length = id_length;
+  target->session_length = length;
+  memcpy(target->id, id, id_length);
+  memcpy(target->session, session, length);
+  Count(kStores);
+}
+
+SSL_SESSION* SharedSessionCache::Lookup(const unsigned char* id,
+                                        int id_length) {
+  Count(kLookups);
+  if (id_length <= 0 || id_length > SSL_MAX_SSL_SESSION_ID_LENGTH)
+    return nullptr;
+
+  unsigned char session[kMaxSessionLength];
+  size_t length = 0;
+  {
+    Bucket* bucket = GetBucket(id, id_length);
+    BucketLock lock(bucket);
+    for (Entry& entry : bucket->entries) {
+      if (entry.id_length != static_cast<uint32_t>(id_length) ||
+          memcmp(entry.id, id, id_length) != 0) {
+        continue;
+      }
+      if (entry.expires <= time(nullptr)) {
+        entry.id_length = 0;
+        break;
+      }
+      entry.last_used =
+          header_->clock.fetch_add(1, std::memory_order_relaxed);
+      length = entry.session_length;
+      memcpy(session, entry.session, length);
+      break;
+    }
+  }
+
+  if (length == 0)
+    return nullptr;
+  const unsigned char* p = session;
+  SSL_SESSION* sess = d2i_SSL_SESSION(nullptr, &p, length);
+  if (sess != nullptr)
+    Count(kHits);
+  return sess;
+}
+
+void SharedSessionCache::Count(Counter counter) {
+  header_->counters[counter].fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t SharedSessionCache::Get(Counter counter) const {
+  return header_->counters[counter].load(std::memory_order_relaxed);
+}
+
+const unsigned char* SharedSessionCache::ticket_keys() const {
+  return header_->ticket_keys;
+}
+
+}  // namespace crypto
+}  // namespace node
@@ -0,0 +1,91 @@
+#ifndef SRC_NODE_CRYPTO_SESSION_CACHE_H_
+#define SRC_NODE_CRYPTO_SESSION_CACHE_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include "openssl/ssl.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace node {
+namespace crypto {
+
+// A TLS server session cache that lives in shared memory, so that it can be
+// used by all threads of a process and, through an inherited file descriptor,
+// by the worker processes of a cluster. It also holds the ticket keys that
+// servers using it share, so that session tickets can be resumed by any of
+// them as well.
+//
+// Sessions are stored in a set-associative hash table keyed by session ID,
+// with a lock per bucket. Within a bucket, the least recently used entry is
+// evicted first, and entries are dropped once their session has expired.
+// Sessions that do not fit into an entry are not cached.
+class SharedSessionCache {
+ public:
+  enum Counter {
+    kHandshakes,
+    kResumed,
+    kLookups,
+    kHits,
+    kStores,
+    kEvictions,
+    kCounterCount
+  };
+
+  static constexpr size_t kTicketKeysLength = 48;
+
+  // Returns the cache of this process, setting it up on first use. If `fd` is
+  // -1, a new cache with room for `entries` sessions is created; otherwise,
+  // the cache is the one in the shared memory object referred to by `fd`.
+  // Returns nullptr if the cache could not be set up.
+  static std::shared_ptr<SharedSessionCache> ForProcess(int fd,
+                                                        size_t entries);
+  // Returns the cache of this process, or nullptr if it has not been set up.
+  static std::shared_ptr<SharedSessionCache> GetForProcess();
+
+  ~SharedSessionCache();
+  SharedSessionCache(const SharedSessionCache&) = delete;
+  SharedSessionCache& operator=(const SharedSessionCache&) = delete;
+
+  inline int fd() const { return fd_; }
+
+  void Store(SSL_SESSION* sess);
+  // Returns a new reference to the session with the given ID, or nullptr.
+  SSL_SESSION* Lookup(const unsigned char* id, int id_length);
+
+  void Count(Counter counter);
+  uint64_t Get(Counter counter) const;
+
+  // The name, HMAC secret, and AES key for session tickets, in that order.
+  const unsigned char* ticket_keys() const;
+
+ private:
+  struct Entry;
+  struct Bucket;
+  struct Header;
+  class BucketLock;
+
+  SharedSessionCache(int fd, void* base, size_t size);
+
+  static size_t BucketsOffset();
+
+  static std::shared_ptr<SharedSessionCache> Create(size_t entries);
+  static std::shared_ptr<SharedSessionCache> Open(int fd);
+
+  Bucket* GetBucket(const unsigned char* id, size_t id_length) const;
+
+  int fd_;
+  void* base_;
+  size_t size_;
+  Header* header_;
+  Bucket* buckets_;
+};
+
+}  // namespace crypto
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_NODE_CRYPTO_SESSION_CACHE_H_
@@ -52,6 +52,8 @@ void FSReqBase::Init(const char* syscall,
                      enum encoding encoding) {
   syscall_ = syscall;
   encoding_ = encoding;
+  if (env()->performance_state()->threadpool_monitored())
+    queued_at_ = uv_hrtime();
 
   if (data != nullptr) {
     CHECK(!has_data_);
@@ -66,6 +68,8 @@ FSReqBase::FSReqBuffer&
 FSReqBase::Init(const char* syscall, size_t len, enum encoding encoding) {
   syscall_ = syscall;
   encoding_ = encoding;
+  if (env()->performance_state()->threadpool_monitored())
+    queued_at_ = uv_hrtime();
 
   buffer_.AllocateSufficientStorage(len + 1);
   has_data_ = false;  // so that the data does not show up in error messages
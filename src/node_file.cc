@@ -528,6 +528,13 @@ FSReqAfterScope::FSReqAfterScope(FSReqBase* wrap, uv_fs_t* req)
       handle_scope_(wrap->env()->isolate()),
       context_scope_(wrap->env()->context()) {
   CHECK_EQ(wrap_->req(), req);
+  performance::performance_state* state = wrap->env()->performance_state();
+  if (wrap->queued_at() != 0 && state->threadpool_monitored()) {
+    state->RecordThreadPoolRequest(
+        performance::NODE_PERFORMANCE_THREADPOOL_TYPE_FS,
+        wrap->queued_at(),
+        reinterpret_cast<uv_req_t*>(req));
+  }
 }
 
 FSReqAfterScope::~FSReqAfterScope() {
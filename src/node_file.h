@@ -66,6 +66,8 @@ class FSReqBase : public ReqWrap<uv_fs_t> {
   const char* data() const { return has_data_ ? *buffer_ : nullptr; }
   enum encoding encoding() const { return encoding_; }
   bool use_bigint() const { return use_bigint_; }
+  // Only set while perf_hooks.monitorThreadpool() is in use.
+  uint64_t queued_at() const { return queued_at_; }
 
   FSContinuationData* continuation_data() const {
     return continuation_data_.get();
@@ -89,6 +91,7 @@ class FSReqBase : public ReqWrap<uv_fs_t> {
   bool has_data_ = false;
   const char* syscall_ = nullptr;
   bool use_bigint_ = false;
+  uint64_t queued_at_ = 0;
 
   // Typically, the content of buffer_ is something like a file name, so
   // something around 64 bytes should be enough.
@@ -211,6 +214,9 @@ class FileHandle final : public AsyncWrap, public StreamBase {
 
   int GetFD() override { return fd_; }
 
+  int64_t read_offset() const { return read_offset_; }
+  int64_t read_length() const { return read_length_; }
+
   // Will asynchronously close the FD and return a Promise that will
   // be resolved once closing is complete.
   static void Close(const v8::FunctionCallbackInfo<v8::Value>& args);
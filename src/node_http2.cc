@@ -510,6 +510,41 @@ void Http2Session::StopTrackingRcbuf(nghttp2_rcbuf* buf) {
   StopTrackingMemory(buf);
 }
 
+inline size_t HeaderStringIndex(nghttp2_rcbuf* buf, size_t size) {
+  uintptr_t address = reinterpret_cast<uintptr_t>(buf);
+  return ((address >> 4) ^ (address >> 10)) % size;
+}
+
+MaybeLocal<String> Http2Session::GetHeaderString(nghttp2_rcbuf* buf) {
+  HeaderString& entry =
+      header_strings_[HeaderStringIndex(buf, header_strings_.size())];
+  if (entry.buf != buf)
+    return MaybeLocal<String>();
+  return entry.str.Get(env()->isolate());
+}
+
+void Http2Session::SetHeaderString(nghttp2_rcbuf* buf, Local<String> str) {
+  if (nghttp2_rcbuf_get_buf(buf).len > kMaxCachedHeaderLength)
+    return;
+  HeaderString& entry =
+      header_strings_[HeaderStringIndex(buf, header_strings_.size())];
+  if (entry.buf != nullptr)
+    nghttp2_rcbuf_decref(entry.buf);
+  nghttp2_rcbuf_incref(buf);
+  entry.buf = buf;
+  entry.str.Reset(env()->isolate(), str);
+}
+
+void Http2Session::ClearHeaderStrings() {
+  for (HeaderString& entry : header_strings_) {
+    if (entry.buf == nullptr)
+      continue;
+    nghttp2_rcbuf_decref(entry.buf);
+    entry.buf = nullptr;
+    entry.str.Reset();
+  }
+}
+
 void Http2Session::CheckAllocatedSize(size_t previous_size) const {
   CHECK_GE(current_nghttp2_memory_, previous_size);
 }
@@ -582,6 +617,8 @@ Http2Session::Http2Session(Environment* env,
 Http2Session::~Http2Session() {
   CHECK_EQ(flags_ & SESSION_STATE_HAS_SCOPE, 0);
   Debug(this, "freeing nghttp2 session");
+  // Release the rcbufs while this session is still around to account for them.
+  ClearHeaderStrings();
   nghttp2_session_del(session_);
   CHECK_EQ(current_nghttp2_memory_, 0);
   js_fields_->~SessionJSFields();
@@ -1601,8 +1638,11 @@ void Http2Session::PushOutgoingBuffer(nghttp2_stream_write&& write) {
 
 // Queue a given block of data for sending. This always creates a copy,
 // so it is used for the cases in which nghttp2 requests sending of a
-// small chunk of data.
-void Http2Session::CopyDataIntoOutgoing(const uint8_t* src, size_t src_length) {
+// small chunk of data. If `req_wrap` is set, it is finished once the copy
+// has been written.
+void Http2Session::CopyDataIntoOutgoing(const uint8_t* src,
+                                        size_t src_length,
+                                        WriteWrap* req_wrap) {
   size_t offset = outgoing_storage_.size();
   outgoing_storage_.resize(offset + src_length);
   memcpy(&outgoing_storage_[offset], src, src_length);
@@ -1612,6 +1652,7 @@ void Http2Session::CopyDataIntoOutgoing(const uint8_t* src, size_t src_length) {
   // The correct base pointers will be set later, before writing to the
   // underlying socket.
   PushOutgoingBuffer(nghttp2_stream_write {
+    req_wrap,
     uv_buf_init(nullptr, src_length)
   });
 }
@@ -1619,7 +1660,6 @@ void Http2Session::CopyDataIntoOutgoing(const uint8_t* src, size_t src_length) {
 // Prompts nghttp2 to begin serializing it's pending data and pushes each
 // chunk out to the i/o socket to be sent. This is a particularly hot method
 // that will generally be called at least twice be event loop iteration.
-// This is a potential performance optimization target later.
 // Returns non-zero value if a write is already in progress.
 uint8_t Http2Session::SendPendingData() {
   Debug(this, "sending pending data");
@@ -1672,19 +1712,30 @@ uint8_t Http2Session::SendPendingData() {
   // Set the buffer base pointers for copied data that ended up in the
   // sessions's own storage since it might have shifted around during gathering.
   // (Those are marked by having .base == nullptr.)
+  // Copied chunks are stored back to back, so consecutive ones are passed on
+  // as a single buffer. With many small frames from many streams, that keeps
+  // the number of buffers per write low.
   size_t offset = 0;
   size_t i = 0;
+  bool previous_copied = false;
   for (const nghttp2_stream_write& write : outgoing_buffers_) {
     statistics_.data_sent += write.buf.len;
     if (write.buf.base == nullptr) {
-      bufs[i++] = uv_buf_init(
-          reinterpret_cast<char*>(outgoing_storage_.data() + offset),
-          write.buf.len);
+      if (previous_copied) {
+        bufs[i - 1].len += write.buf.len;
+      } else {
+        bufs[i++] = uv_buf_init(
+            reinterpret_cast<char*>(outgoing_storage_.data() + offset),
+            write.buf.len);
+      }
       offset += write.buf.len;
+      previous_copied = true;
     } else {
       bufs[i++] = write.buf;
+      previous_copied = false;
     }
   }
+  count = i;
 
   chunks_sent_since_last_write_++;
 
@@ -1734,15 +1785,29 @@ int Http2Session::OnSendData(
     if (write.buf.len <= length) {
       // This write does not suffice by itself, so we can consume it completely.
       length -= write.buf.len;
-      session->PushOutgoingBuffer(std::move(write));
+      if (write.buf.len <= kMaxCopiedDataLength) {
+        // Small chunks are cheaper to copy next to the frame header than to
+        // pass on as a buffer of their own.
+        session->CopyDataIntoOutgoing(
+            reinterpret_cast<const uint8_t*>(write.buf.base),
+            write.buf.len,
+            write.req_wrap);
+      } else {
+        session->PushOutgoingBuffer(std::move(write));
+      }
       stream->queue_.pop();
       continue;
     }
 
     // Slice off `length` bytes of the first write in the queue.
-    session->PushOutgoingBuffer(nghttp2_stream_write {
-      uv_buf_init(write.buf.base, length)
-    });
+    if (length <= kMaxCopiedDataLength) {
+      session->CopyDataIntoOutgoing(
+          reinterpret_cast<const uint8_t*>(write.buf.base), length);
+    } else {
+      session->PushOutgoingBuffer(nghttp2_stream_write {
+        uv_buf_init(write.buf.base, length)
+      });
+    }
     write.buf.base += length;
     write.buf.len -= length;
     break;
@@ -1750,9 +1815,9 @@ int Http2Session::OnSendData(
 
   if (frame->data.padlen > 0) {
     // Send padding if that was requested.
-    session->PushOutgoingBuffer(nghttp2_stream_write {
-      uv_buf_init(const_cast<char*>(zero_bytes_256), frame->data.padlen - 1)
-    });
+    session->CopyDataIntoOutgoing(
+        reinterpret_cast<const uint8_t*>(zero_bytes_256),
+        frame->data.padlen - 1);
   }
 
   return 0;
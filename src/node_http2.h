@@ -863,6 +863,11 @@ class Http2Session : public AsyncWrap,
   // this session now, and may outlive it.
   void StopTrackingRcbuf(nghttp2_rcbuf* buf);
 
+  // Look up and store the string for a received header name or value, see
+  // header_strings_.
+  MaybeLocal<String> GetHeaderString(nghttp2_rcbuf* buf);
+  void SetHeaderString(nghttp2_rcbuf* buf, Local<String> str);
+
   // Returns the current session memory including memory allocated by nghttp2,
   // the current outbound storage queue, and pending writes.
   uint64_t GetCurrentSessionMemory() {
@@ -1031,6 +1036,9 @@ class Http2Session : public AsyncWrap,
 
   std::vector<nghttp2_stream_write> outgoing_buffers_;
   std::vector<uint8_t> outgoing_storage_;
+  // DATA frame payloads up to this size are copied into outgoing_storage_
+  // rather than written from the stream's own buffers.
+  static constexpr size_t kMaxCopiedDataLength = 1024;
   size_t outgoing_length_ = 0;
   std::vector<int32_t> pending_rst_streams_;
   // Count streams that have been rejected while being opened. Exceeding a fixed
@@ -1041,9 +1049,25 @@ class Http2Session : public AsyncWrap,
   // Also use the invalid frame count as a measure for rejecting input frames.
   uint32_t invalid_frame_count_ = 0;
 
+  // Strings for header names and values recently received on this session,
+  // keyed by their rcbuf. The HPACK decoder hands out the same rcbuf for each
+  // use of a dynamic table entry, so headers that recur on a session map to
+  // the same string. Each entry holds a reference to its rcbuf, so that the
+  // address is not reused for another rcbuf while the entry exists.
+  struct HeaderString {
+    nghttp2_rcbuf* buf = nullptr;
+    v8::Global<v8::String> str;
+  };
+  static constexpr size_t kHeaderStringCacheSize = 64;
+  static constexpr size_t kMaxCachedHeaderLength = 1024;
+  std::array<HeaderString, kHeaderStringCacheSize> header_strings_;
+
   void PushOutgoingBuffer(nghttp2_stream_write&& write);
-  void CopyDataIntoOutgoing(const uint8_t* src, size_t src_length);
+  void CopyDataIntoOutgoing(const uint8_t* src,
+                            size_t src_length,
+                            WriteWrap* req_wrap = nullptr);
   void ClearOutgoing(int status);
+  void ClearHeaderStrings();
 
   friend class Http2Scope;
   friend class Http2StreamListener;
@@ -1234,6 +1258,12 @@ class ExternalHeader :
       return eternal.Get(env->isolate());
     }
 
+    Local<String> cached;
+    if (session->GetHeaderString(buf).ToLocal(&cached)) {
+      nghttp2_rcbuf_decref(buf);
+      return cached;
+    }
+
     nghttp2_vec vec = nghttp2_rcbuf_get_buf(buf);
     if (vec.len == 0) {
       nghttp2_rcbuf_decref(buf);
@@ -1241,10 +1271,13 @@ class ExternalHeader :
     }
 
     if (may_internalize && vec.len < 64) {
-      nghttp2_rcbuf_decref(buf);
       // This is a short header name, so there is a good chance V8 already has
       // it internalized.
-      return GetInternalizedString(env, vec);
+      MaybeLocal<String> str = GetInternalizedString(env, vec);
+      if (!str.IsEmpty())
+        session->SetHeaderString(buf, str.ToLocalChecked());
+      nghttp2_rcbuf_decref(buf);
+      return str;
     }
 
     session->StopTrackingRcbuf(buf);
@@ -1252,6 +1285,8 @@ class ExternalHeader :
     MaybeLocal<String> str = String::NewExternalOneByte(env->isolate(), h_str);
     if (str.IsEmpty())
       delete h_str;
+    else
+      session->SetHeaderString(buf, str.ToLocalChecked());
 
     return str;
   }
@@ -21,6 +21,7 @@
 
 #include "node.h"
 #include "node_buffer.h"
+#include "node_errors.h"
 #include "util.h"
 
 #include "async_wrap-inl.h"
@@ -32,6 +33,7 @@
 
 #include <cstdlib>  // free()
 #include <cstring>  // strdup(), strchr()
+#include <vector>
 
 
 // This is a binding to llhttp (https://github.com/nodejs/llhttp)
@@ -53,6 +55,7 @@ using v8::Array;
 using v8::Boolean;
 using v8::Context;
 using v8::EscapableHandleScope;
+using v8::Eternal;
 using v8::Exception;
 using v8::Function;
 using v8::FunctionCallbackInfo;
@@ -60,8 +63,10 @@ using v8::FunctionTemplate;
 using v8::HandleScope;
 using v8::Int32;
 using v8::Integer;
+using v8::Isolate;
 using v8::Local;
 using v8::MaybeLocal;
+using v8::NewStringType;
 using v8::Number;
 using v8::Object;
 using v8::String;
@@ -74,6 +79,7 @@ const uint32_t kOnHeadersComplete = 1;
 const uint32_t kOnBody = 2;
 const uint32_t kOnMessageComplete = 3;
 const uint32_t kOnExecute = 4;
+const uint32_t kOnMessages = 5;
 // Any more fields than this will be flushed into JS
 const size_t kMaxHeaderFieldsCount = 32;
 
@@ -81,6 +87,139 @@ inline bool IsOWS(char c) {
   return c == ' ' || c == '\t';
 }
 
+struct CommonString {
+  const char* data;
+  size_t length;
+};
+
+#define V(str) { str, sizeof(str) - 1 }
+// Header names and values that are common enough to keep internalized strings
+// around for, so that parsing a typical request allocates no new strings for
+// them. Names are listed in lowercase and match either that or Title-Case
+// (e.g. "Content-Type"), so that rawHeaders still sees them as they were
+// sent. Values must match exactly.
+const CommonString kCommonHeaderNames[] = {
+  V("accept"),
+  V("accept-encoding"),
+  V("accept-language"),
+  V("accept-ranges"),
+  V("authorization"),
+  V("cache-control"),
+  V("connection"),
+  V("content-encoding"),
+  V("content-language"),
+  V("content-length"),
+  V("content-type"),
+  V("cookie"),
+  V("date"),
+  V("etag"),
+  V("expect"),
+  V("host"),
+  V("if-modified-since"),
+  V("if-none-match"),
+  V("keep-alive"),
+  V("last-modified"),
+  V("location"),
+  V("origin"),
+  V("pragma"),
+  V("referer"),
+  V("server"),
+  V("set-cookie"),
+  V("transfer-encoding"),
+  V("upgrade"),
+  V("upgrade-insecure-requests"),
+  V("user-agent"),
+  V("vary"),
+  V("x-forwarded-for"),
+  V("x-forwarded-proto"),
+  V("x-requested-with"),
+};
+
+const CommonString kCommonHeaderValues[] = {
+  V("*/*"),
+  V("0"),
+  V("1"),
+  V("application/json"),
+  V("application/x-www-form-urlencoded"),
+  V("chunked"),
+  V("close"),
+  V("gzip"),
+  V("gzip, deflate"),
+  V("gzip, deflate, br"),
+  V("identity"),
+  V("keep-alive"),
+  V("max-age=0"),
+  V("no-cache"),
+  V("text/html"),
+  V("text/plain"),
+  V("text/plain; charset=utf-8"),
+};
+#undef V
+
+// The cached strings are stored in IsolateData::http_parser_strs: the
+// lowercase names, then the Title-Case names, then the values.
+constexpr size_t kCommonHeaderNameCount = arraysize(kCommonHeaderNames);
+constexpr size_t kCommonHeaderValueCount = arraysize(kCommonHeaderValues);
+constexpr size_t kCommonStringCount =
+    2 * kCommonHeaderNameCount + kCommonHeaderValueCount;
+
+// Returns the index of the cached string for the header name `str`, or -1 if
+// there is none.
+int FindCommonHeaderName(const char* str, size_t size) {
+  if (size == 0)
+    return -1;
+  const char first = ToLower(str[0]);
+  for (size_t i = 0; i < kCommonHeaderNameCount; i++) {
+    const CommonString& name = kCommonHeaderNames[i];
+    if (name.length != size || name.data[0] != first)
+      continue;
+    bool lower = true;
+    bool title = true;
+    for (size_t j = 0; j < size && (lower || title); j++) {
+      const char c = name.data[j];
+      const bool upper = j == 0 || name.data[j - 1] == '-';
+      lower = lower && str[j] == c;
+      title = title && str[j] == (upper ? ToUpper(c) : c);
+    }
+    if (lower)
+      return i;
+    if (title)
+      return kCommonHeaderNameCount + i;
+  }
+  return -1;
+}
+
+// Returns the index of the cached string for the header value `str`, or -1 if
+// there is none.
+int FindCommonHeaderValue(const char* str, size_t size) {
+  for (size_t i = 0; i < kCommonHeaderValueCount; i++) {
+    const CommonString& value = kCommonHeaderValues[i];
+    if (value.length == size && memcmp(value.data, str, size) == 0)
+      return 2 * kCommonHeaderNameCount + i;
+  }
+  return -1;
+}
+
+Local<String> GetCommonString(Environment* env,
+                              int index,
+                              const char* str,
+                              size_t size) {
+  std::vector<Eternal<String>>& strs = env->isolate_data()->http_parser_strs;
+  if (strs.empty())
+    strs.resize(kCommonStringCount);
+  Eternal<String>& eternal = strs[index];
+  if (eternal.IsEmpty()) {
+    Local<String> string =
+        String::NewFromOneByte(env->isolate(),
+                               reinterpret_cast<const uint8_t*>(str),
+                               NewStringType::kInternalized,
+                               size).ToLocalChecked();
+    eternal.Set(env->isolate(), string);
+    return string;
+  }
+  return eternal.Get(env->isolate());
+}
+
 // helper class for the Parser
 struct StringPtr {
   StringPtr() {
@@ -147,11 +286,30 @@ struct StringPtr {
   }
 
 
+  // Like ToString(), but returns a cached string for common header names.
+  Local<String> ToHeaderName(Environment* env) const {
+    int index = FindCommonHeaderName(str_, size_);
+    if (index != -1)
+      return GetCommonString(env, index, str_, size_);
+    return ToString(env);
+  }
+
+
   // Strip trailing OWS (SPC or HTAB) from string.
-  Local<String> ToTrimmedString(Environment* env) {
+  void TrimTrailingOWS() {
     while (size_ > 0 && IsOWS(str_[size_ - 1])) {
       size_--;
     }
+  }
+
+
+  // Like TrimTrailingOWS(), but also returns a cached string for common header
+  // values.
+  Local<String> ToTrimmedHeaderValue(Environment* env) {
+    TrimTrailingOWS();
+    int index = FindCommonHeaderValue(str_, size_);
+    if (index != -1)
+      return GetCommonString(env, index, str_, size_);
     return ToString(env);
   }
 
@@ -258,6 +416,13 @@ class Parser : public AsyncWrap, public StreamListener {
   int on_headers_complete() {
     header_nread_ = 0;
 
+    if (BatchMessage())
+      return 0;
+
+    // Requests that were parsed before this one go first.
+    if (!FlushMessages())
+      return -1;
+
     // Arguments for the on-headers-complete javascript callback. This
     // list needs to be kept in sync with the actual argument list for
     // `parserOnHeadersComplete` in lib/_http_common.js.
@@ -291,7 +456,7 @@ class Parser : public AsyncWrap, public StreamListener {
       Flush();
     } else {
       // Fast case, pass headers and URL to JS land.
-      argv[A_HEADERS] = CreateHeaders();
+      argv[A_HEADERS] = CreateHeaderBlock();
       if (parser_.type == HTTP_REQUEST)
         argv[A_URL] = url_.ToString(env());
     }
@@ -385,6 +550,12 @@ class Parser : public AsyncWrap, public StreamListener {
 
 
   int on_message_complete() {
+    if (message_batched_) {
+      // Completed as part of the batch.
+      message_batched_ = false;
+      return 0;
+    }
+
     HandleScope scope(env()->isolate());
 
     if (num_fields_)
@@ -502,6 +673,7 @@ class Parser : public AsyncWrap, public StreamListener {
   static void Initialize(const FunctionCallbackInfo<Value>& args) {
     Environment* env = Environment::GetCurrent(args);
     bool lenient = args[3]->IsTrue();
+    bool header_block = args[4]->IsTrue();
 
     uint64_t max_http_header_size = 0;
 
@@ -532,7 +704,7 @@ class Parser : public AsyncWrap, public StreamListener {
 
     parser->set_provider_type(provider);
     parser->AsyncReset(args[1].As<Object>());
-    parser->Init(type, max_http_header_size, lenient);
+    parser->Init(type, max_http_header_size, lenient, header_block);
   }
 
   template <bool should_pause>
@@ -672,6 +844,7 @@ class Parser : public AsyncWrap, public StreamListener {
       err = llhttp_execute(&parser_, data, len);
       Save();
     }
+    FlushMessages();
     execute_depth_--;
 
     // Calculate bytes read and resume after Upgrade/CONNECT pause
@@ -744,18 +917,150 @@ class Parser : public AsyncWrap, public StreamListener {
     Local<Value> headers_v[kMaxHeaderFieldsCount * 2];
 
     for (size_t i = 0; i < num_values_; ++i) {
-      headers_v[i * 2] = fields_[i].ToString(env());
-      headers_v[i * 2 + 1] = values_[i].ToTrimmedString(env());
+      headers_v[i * 2] = fields_[i].ToHeaderName(env());
+      headers_v[i * 2 + 1] = values_[i].ToTrimmedHeaderValue(env());
     }
 
     return Array::New(env()->isolate(), headers_v, num_values_ * 2);
   }
 
 
+  // Returns the headers as a single string, with all names and values joined
+  // by '\n', which neither can contain. lib/_http_incoming.js only splits it
+  // into separate strings when the headers are accessed, so that listeners
+  // that never look at them do not pay for a string per name and value.
+  // Messages whose headers all have cached strings are passed as an array of
+  // those instead, which costs no new strings at all.
+  Local<Value> CreateHeaderBlock() {
+    if (!header_block_)
+      return CreateHeaders();
+    if (num_values_ == 0)
+      return String::Empty(env()->isolate());
+
+    size_t length = 2 * num_values_ - 1;
+    bool all_common = true;
+    for (size_t i = 0; i < num_values_; ++i) {
+      values_[i].TrimTrailingOWS();
+      length += fields_[i].size_ + values_[i].size_;
+      all_common = all_common &&
+          FindCommonHeaderName(fields_[i].str_, fields_[i].size_) != -1 &&
+          FindCommonHeaderValue(values_[i].str_, values_[i].size_) != -1;
+    }
+    if (all_common)
+      return CreateHeaders();
+
+    MaybeStackBuffer<char, 1024> block(length);
+    char* pos = block.out();
+    for (size_t i = 0; i < num_values_; ++i) {
+      if (i > 0)
+        *pos++ = '\n';
+      if (fields_[i].size_ > 0)
+        memcpy(pos, fields_[i].str_, fields_[i].size_);
+      pos += fields_[i].size_;
+      *pos++ = '\n';
+      if (values_[i].size_ > 0)
+        memcpy(pos, values_[i].str_, values_[i].size_);
+      pos += values_[i].size_;
+    }
+    CHECK_EQ(static_cast<size_t>(pos - block.out()), length);
+
+    return OneByteString(env()->isolate(), block.out(), length);
+  }
+
+
+  // Requests without a body whose headers fit in one go are passed to JS land
+  // together, in one kOnMessages call at the end of Execute(), instead of one
+  // kOnHeadersComplete and one kOnMessageComplete call each. This matters for
+  // pipelined and small keep-alive requests. Returns true if the current
+  // message was added to the batch.
+  bool BatchMessage() {
+    // The message arguments. This list needs to be kept in sync with
+    // `parserOnMessages` in lib/_http_common.js.
+    enum message_field_index {
+      M_VERSION_MAJOR = 0,
+      M_VERSION_MINOR,
+      M_HEADERS,
+      M_METHOD,
+      M_URL,
+      M_SHOULD_KEEP_ALIVE,
+      M_MAX
+    };
+
+    if (parser_.type != HTTP_REQUEST || parser_.upgrade || have_flushed_)
+      return false;
+    if ((parser_.flags & (F_CHUNKED | F_TRANSFER_ENCODING)) != 0 ||
+        parser_.content_length != 0) {
+      return false;
+    }
+
+    Local<Value> cb =
+        object()->Get(env()->context(), kOnMessages).ToLocalChecked();
+    if (!cb->IsFunction())
+      return false;
+
+    // These handles belong to the HandleScope of Execute(), which lasts
+    // until FlushMessages() has run.
+    size_t offset = messages_.size();
+    messages_.resize(offset + M_MAX);
+    Local<Value>* fields = messages_.data() + offset;
+    fields[M_VERSION_MAJOR] =
+        Integer::New(env()->isolate(), parser_.http_major);
+    fields[M_VERSION_MINOR] =
+        Integer::New(env()->isolate(), parser_.http_minor);
+    fields[M_HEADERS] = CreateHeaderBlock();
+    fields[M_METHOD] =
+        Uint32::NewFromUnsigned(env()->isolate(), parser_.method);
+    fields[M_URL] = url_.ToString(env());
+    fields[M_SHOULD_KEEP_ALIVE] =
+        Boolean::New(env()->isolate(), llhttp_should_keep_alive(&parser_));
+
+    num_fields_ = 0;
+    num_values_ = 0;
+    message_batched_ = true;
+    return true;
+  }
+
+
+  // Pass the messages batched by BatchMessage() to JS land. Returns false if
+  // that threw.
+  bool FlushMessages() {
+    if (messages_.empty())
+      return true;
+
+    HandleScope scope(env()->isolate());
+    Local<Value> messages =
+        Array::New(env()->isolate(), messages_.data(), messages_.size());
+    messages_.clear();
+
+    Local<Value> cb =
+        object()->Get(env()->context(), kOnMessages).ToLocalChecked();
+    if (!cb->IsFunction())
+      return true;
+
+    MaybeLocal<Value> r;
+    {
+      InternalCallbackScope callback_scope(
+          this, InternalCallbackScope::kSkipTaskQueues);
+      r = cb.As<Function>()->Call(env()->context(), object(), 1, &messages);
+      if (r.IsEmpty()) callback_scope.MarkAsFailed();
+    }
+
+    if (r.IsEmpty()) {
+      got_exception_ = true;
+      return false;
+    }
+    return true;
+  }
+
+
   // spill headers and request path to JS land
   void Flush() {
     HandleScope scope(env()->isolate());
 
+    // Requests that were parsed before these headers go first.
+    if (!FlushMessages())
+      return;
+
     Local<Object> obj = object();
     Local<Value> cb = obj->Get(env()->context(), kOnHeaders).ToLocalChecked();
 
@@ -779,7 +1084,10 @@ class Parser : public AsyncWrap, public StreamListener {
   }
 
 
-  void Init(llhttp_type_t type, uint64_t max_http_header_size, bool lenient) {
+  void Init(llhttp_type_t type,
+            uint64_t max_http_header_size,
+            bool lenient,
+            bool header_block) {
     llhttp_init(&parser_, type, &settings);
     llhttp_set_lenient(&parser_, lenient);
     header_nread_ = 0;
@@ -788,8 +1096,10 @@ class Parser : public AsyncWrap, public StreamListener {
     num_fields_ = 0;
     num_values_ = 0;
     have_flushed_ = false;
+    message_batched_ = false;
     got_exception_ = false;
     max_http_header_size_ = max_http_header_size;
+    header_block_ = header_block;
   }
 
 
@@ -823,6 +1133,8 @@ class Parser : public AsyncWrap, public StreamListener {
   size_t num_fields_;
   size_t num_values_;
   bool have_flushed_;
+  bool message_batched_ = false;
+  std::vector<Local<Value>> messages_;
   bool got_exception_;
   Local<Object> current_buffer_;
   size_t current_buffer_len_;
@@ -831,6 +1143,9 @@ class Parser : public AsyncWrap, public StreamListener {
   bool pending_pause_ = false;
   uint64_t header_nread_ = 0;
   uint64_t max_http_header_size_;
+  // Whether complete headers are passed to JS land as one string, see
+  // CreateHeaderBlock().
+  bool header_block_ = false;
 
   // These are helper functions for filling `http_parser_settings`, which turn
   // a member function of Parser into a C-style HTTP parser callback.
@@ -867,6 +1182,112 @@ const llhttp_settings_t Parser::settings = {
 };
 
 
+// Owns the memory of a header block that SerializeHeaders() wrote directly
+// into the heap, so that it can be used as a string without another copy.
+class ExternalHeaderBlock : public String::ExternalOneByteStringResource {
+ public:
+  ExternalHeaderBlock(Isolate* isolate, char* data, size_t length)
+      : isolate_(isolate), data_(data), length_(length) {
+    isolate_->AdjustAmountOfExternalAllocatedMemory(length_);
+  }
+
+  ~ExternalHeaderBlock() override {
+    free(data_);
+    isolate_->AdjustAmountOfExternalAllocatedMemory(
+        -static_cast<int64_t>(length_));
+  }
+
+  const char* data() const override { return data_; }
+  size_t length() const override { return length_; }
+
+ private:
+  Isolate* isolate_;
+  char* data_;
+  size_t length_;
+};
+
+// Header blocks up to this size are assembled on the stack and copied into a
+// regular string, which is cheaper than a heap allocation and an external
+// string for the common case.
+constexpr size_t kStackHeaderBlockSize = 4096;
+
+// serializeHeaders(firstLine, fields) returns the header block of a message:
+// `firstLine`, a `name: value` line for each pair of strings in the flat
+// `fields` array, and an empty line. The block is written into a single
+// flat one-byte string. Returns undefined if any of the fields is not a
+// string or has characters outside of Latin-1, leaving those to the caller.
+void SerializeHeaders(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  Isolate* isolate = env->isolate();
+  CHECK(args[0]->IsString());
+  CHECK(args[1]->IsArray());
+  Local<Array> fields = args[1].As<Array>();
+  const uint32_t count = fields->Length();
+  CHECK_EQ(count % 2, 0);
+
+  MaybeStackBuffer<Local<String>, 64> strings(count + 1);
+  strings[0] = args[0].As<String>();
+  for (uint32_t i = 0; i < count; i++) {
+    Local<Value> field;
+    if (!fields->Get(env->context(), i).ToLocal(&field) ||
+        !field->IsString()) {
+      return;
+    }
+    strings[i + 1] = field.As<String>();
+  }
+
+  // Room for ": " after each name, CRLF after each value and the final CRLF.
+  size_t length = 2 * count + 2;
+  for (uint32_t i = 0; i <= count; i++) {
+    if (!strings[i]->IsOneByte() && !strings[i]->ContainsOnlyOneByte())
+      return;
+    length += strings[i]->Length();
+  }
+
+  auto write = [&](uint8_t* const start) {
+    uint8_t* pos = start;
+    auto append = [&](Local<String> str) {
+      pos += str->WriteOneByte(
+          isolate, pos, 0, -1, String::NO_NULL_TERMINATION);
+    };
+    append(strings[0]);
+    for (uint32_t i = 1; i <= count; i += 2) {
+      append(strings[i]);
+      *pos++ = ':';
+      *pos++ = ' ';
+      append(strings[i + 1]);
+      *pos++ = '\r';
+      *pos++ = '\n';
+    }
+    *pos++ = '\r';
+    *pos++ = '\n';
+    CHECK_EQ(static_cast<size_t>(pos - start), length);
+  };
+
+  Local<String> result;
+  if (length <= kStackHeaderBlockSize) {
+    uint8_t header[kStackHeaderBlockSize];
+    write(header);
+    if (!String::NewFromOneByte(
+            isolate, header, NewStringType::kNormal, length).ToLocal(&result)) {
+      return;
+    }
+  } else {
+    char* data = UncheckedMalloc<char>(length);
+    if (data == nullptr)
+      return THROW_ERR_MEMORY_ALLOCATION_FAILED(env);
+    write(reinterpret_cast<uint8_t*>(data));
+    ExternalHeaderBlock* resource =
+        new ExternalHeaderBlock(isolate, data, length);
+    if (!String::NewExternalOneByte(isolate, resource).ToLocal(&result)) {
+      delete resource;
+      return;
+    }
+  }
+  args.GetReturnValue().Set(result);
+}
+
+
 void InitializeHttpParser(Local<Object> target,
                           Local<Value> unused,
                           Local<Context> context,
@@ -890,6 +1311,8 @@ void InitializeHttpParser(Local<Object> target,
          Integer::NewFromUnsigned(env->isolate(), kOnMessageComplete));
   t->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "kOnExecute"),
          Integer::NewFromUnsigned(env->isolate(), kOnExecute));
+  t->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "kOnMessages"),
+         Integer::NewFromUnsigned(env->isolate(), kOnMessages));
 
   Local<Array> methods = Array::New(env->isolate());
 #define V(num, name, string)                                                  \
@@ -916,6 +1339,8 @@ void InitializeHttpParser(Local<Object> target,
   target->Set(env->context(),
               FIXED_ONE_BYTE_STRING(env->isolate(), "HTTPParser"),
               t->GetFunction(env->context()).ToLocalChecked()).Check();
+
+  env->SetMethod(target, "serializeHeaders", SerializeHeaders);
 }
 
 }  // anonymous namespace
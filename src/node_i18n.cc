@@ -49,6 +49,8 @@
 #include "node_buffer.h"
 #include "node_errors.h"
 #include "node_internals.h"
+#include "string_bytes.h"
+#include "utf8.h"
 #include "util-inl.h"
 #include "v8.h"
 
@@ -212,10 +214,6 @@ class ConverterObject : public BaseObject, Converter {
     UErrorCode status = U_ZERO_ERROR;
     MaybeStackBuffer<UChar> result;
     MaybeLocal<Object> ret;
-    size_t limit = ucnv_getMinCharSize(converter->conv) * input.length();
-    if (limit > 0)
-      result.AllocateSufficientStorage(limit);
-
     UBool flush = (flags & CONVERTER_FLAGS_FLUSH) == CONVERTER_FLAGS_FLUSH;
     auto cleanup = OnScopeLeave([&]() {
       if (flush) {
@@ -225,6 +223,40 @@ class ConverterObject : public BaseObject, Converter {
       }
     });
 
+    // UTF-8 input that is well-formed by itself, with no partial sequence left
+    // over from a previous call, decodes to the same string with or without
+    // the converter, and StringBytes::Encode() is much faster at it.
+    if (converter->utf8_ &&
+        ucnv_toUCountPending(converter->conv, &status) == 0 &&
+        U_SUCCESS(status) &&
+        utf8_validate(input.data(), input.length())) {
+      const char* data = input.data();
+      size_t length = input.length();
+      if (length > 0) {
+        if (!converter->ignoreBOM_ && !converter->bomSeen_ &&
+            length >= 3 && memcmp(data, "\xef\xbb\xbf", 3) == 0) {
+          data += 3;
+          length -= 3;
+        }
+        converter->bomSeen_ = true;
+      }
+      Local<Value> error;
+      Local<Value> str;
+      if (!StringBytes::Encode(env->isolate(), data, length, UTF8, &error)
+               .ToLocal(&str)) {
+        CHECK(!error.IsEmpty());
+        env->isolate()->ThrowException(error);
+        return;
+      }
+      args.GetReturnValue().Set(str);
+      return;
+    }
+    status = U_ZERO_ERROR;
+
+    size_t limit = ucnv_getMinCharSize(converter->conv) * input.length();
+    if (limit > 0)
+      result.AllocateSufficientStorage(limit);
+
     const char* source = input.data();
     size_t source_length = input.length();
 
@@ -286,6 +318,9 @@ class ConverterObject : public BaseObject, Converter {
 
     switch (ucnv_getType(converter)) {
       case UCNV_UTF8:
+        utf8_ = true;
+        unicode_ = true;
+        break;
       case UCNV_UTF16_BigEndian:
       case UCNV_UTF16_LittleEndian:
         unicode_ = true;
@@ -297,6 +332,7 @@ class ConverterObject : public BaseObject, Converter {
 
  private:
   bool unicode_ = false;     // True if this is a Unicode converter
+  bool utf8_ = false;        // True if this is a UTF-8 converter
   bool ignoreBOM_ = false;   // True if the BOM should be ignored on Unicode
   bool bomSeen_ = false;     // True if the BOM has been seen
 };
@@ -256,21 +256,33 @@ class DebugSealHandleScope {
 
 class ThreadPoolWork {
  public:
-  explicit inline ThreadPoolWork(Environment* env) : env_(env) {
+  explicit inline ThreadPoolWork(
+      Environment* env,
+      ThreadPoolWorkType type = ThreadPoolWorkType::USER)
+      : env_(env), type_(type) {
     CHECK_NOT_NULL(env);
   }
   inline virtual ~ThreadPoolWork() = default;
 
-  inline void ScheduleWork();
+  // Returns UV_EAGAIN, without scheduling anything, if the queue for this
+  // type of work is full.
+  inline int ScheduleWork();
   inline int CancelWork();
 
   virtual void DoThreadPoolWork() = 0;
   virtual void AfterThreadPoolWork(int status) = 0;
 
   Environment* env() const { return env_; }
+  ThreadPoolWorkType type() const { return type_; }
 
  private:
+  inline void QueueWork();
+
   Environment* env_;
+  ThreadPoolWorkType type_;
+  uint64_t queued_at_ = 0;
+  uint64_t started_at_ = 0;
+  uint64_t finished_at_ = 0;
   uv_work_t work_req_;
 };
 
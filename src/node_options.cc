@@ -478,6 +478,36 @@ EnvironmentOptionsParser::EnvironmentOptionsParser() {
             kAllowedInEnvironment);
   AddOption("--test-udp-no-try-send", "",  // For testing only.
             &EnvironmentOptions::test_udp_no_try_send);
+  AddOption("--threadpool-compression-queue-size",
+            "maximum number of zlib operations that may wait for a libuv "
+            "threadpool thread (default: 0, no limit)",
+            &EnvironmentOptions::threadpool_compression_queue_size,
+            kAllowedInEnvironment);
+  AddOption("--threadpool-compression-size",
+            "maximum number of libuv threadpool threads that zlib work "
+            "may occupy at once (default: 0, no limit)",
+            &EnvironmentOptions::threadpool_compression_size,
+            kAllowedInEnvironment);
+  AddOption("--threadpool-crypto-queue-size",
+            "maximum number of crypto operations that may wait for a libuv "
+            "threadpool thread (default: 0, no limit)",
+            &EnvironmentOptions::threadpool_crypto_queue_size,
+            kAllowedInEnvironment);
+  AddOption("--threadpool-crypto-size",
+            "maximum number of libuv threadpool threads that crypto work "
+            "may occupy at once (default: 0, no limit)",
+            &EnvironmentOptions::threadpool_crypto_size,
+            kAllowedInEnvironment);
+  AddOption("--threadpool-user-queue-size",
+            "maximum number of N-API async work items that may wait for a "
+            "libuv threadpool thread (default: 0, no limit)",
+            &EnvironmentOptions::threadpool_user_queue_size,
+            kAllowedInEnvironment);
+  AddOption("--threadpool-user-size",
+            "maximum number of libuv threadpool threads that N-API async "
+            "work may occupy at once (default: 0, no limit)",
+            &EnvironmentOptions::threadpool_user_size,
+            kAllowedInEnvironment);
   AddOption("--throw-deprecation",
             "throw an exception on deprecations",
             &EnvironmentOptions::throw_deprecation,
@@ -668,6 +698,28 @@ PerProcessOptionsParser::PerProcessOptionsParser(
             kAllowedInEnvironment);
   AddAlias("--trace-events-enabled", {
     "--trace-event-categories", "v8,node,node.async_hooks" });
+  AddOption("--threadpool-dns-queue-size",
+            "maximum number of dns.lookup() and dns.lookupService() calls "
+            "that may wait for a libuv threadpool thread "
+            "(default: 0, no limit)",
+            &PerProcessOptions::threadpool_dns_queue_size,
+            kAllowedInEnvironment);
+  AddOption("--threadpool-dns-size",
+            "maximum number of libuv threadpool threads that dns.lookup() "
+            "and dns.lookupService() may occupy at once "
+            "(default: 0, half of the threads)",
+            &PerProcessOptions::threadpool_dns_size,
+            kAllowedInEnvironment);
+  AddOption("--threadpool-fs-queue-size",
+            "maximum number of file system operations that may wait for a "
+            "libuv threadpool thread (default: 0, no limit)",
+            &PerProcessOptions::threadpool_fs_queue_size,
+            kAllowedInEnvironment);
+  AddOption("--threadpool-fs-size",
+            "maximum number of libuv threadpool threads that file system "
+            "operations may occupy at once (default: 0, no limit)",
+            &PerProcessOptions::threadpool_fs_size,
+            kAllowedInEnvironment);
   AddOption("--v8-pool-size",
             "set V8's thread pool size",
             &PerProcessOptions::v8_thread_pool_size,
@@ -139,6 +139,12 @@ class EnvironmentOptions : public Options {
 #endif  // HAVE_INSPECTOR
   std::string redirect_warnings;
   bool test_udp_no_try_send = false;
+  uint64_t threadpool_compression_queue_size = 0;
+  uint64_t threadpool_compression_size = 0;
+  uint64_t threadpool_crypto_queue_size = 0;
+  uint64_t threadpool_crypto_size = 0;
+  uint64_t threadpool_user_queue_size = 0;
+  uint64_t threadpool_user_size = 0;
   bool throw_deprecation = false;
   bool trace_deprecation = false;
   bool trace_exit = false;
@@ -207,6 +213,10 @@ class PerProcessOptions : public Options {
   std::string title;
   std::string trace_event_categories;
   std::string trace_event_file_pattern = "node_trace.${rotation}.log";
+  uint64_t threadpool_dns_queue_size = 0;
+  uint64_t threadpool_dns_size = 0;
+  uint64_t threadpool_fs_queue_size = 0;
+  uint64_t threadpool_fs_size = 0;
   int64_t v8_thread_pool_size = 4;
   bool zero_fill_all_buffers = false;
   bool debug_arraybuffer_allocations = false;
@@ -6,14 +6,17 @@
 #include "node_process.h"
 #include "util-inl.h"
 
+#include <algorithm>
 #include <cinttypes>
 
 namespace node {
 namespace performance {
 
 using v8::Array;
+using v8::ArrayBuffer;
 using v8::Context;
 using v8::DontDelete;
+using v8::Float64Array;
 using v8::Function;
 using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
@@ -32,6 +35,7 @@ using v8::Object;
 using v8::PropertyAttribute;
 using v8::ReadOnly;
 using v8::String;
+using v8::Uint32;
 using v8::Uint32Array;
 using v8::Value;
 
@@ -53,6 +57,35 @@ void performance_state::Mark(enum PerformanceMilestone milestone,
       TRACE_EVENT_SCOPE_THREAD, ts / 1000);
 }
 
+void performance_state::RecordThreadPoolLatency(PerformanceThreadPoolType type,
+                                                uint64_t queued) {
+  int64_t latency = PERFORMANCE_NOW() - queued;
+  for (ThreadPoolHistogram* histogram : threadpool_histograms)
+    histogram->Record(type, kThreadPoolHistogramLatency, latency);
+}
+
+void performance_state::RecordThreadPoolWork(PerformanceThreadPoolType type,
+                                             uint64_t queued,
+                                             uint64_t started,
+                                             uint64_t finished) {
+  RecordThreadPoolLatency(type, queued);
+  for (ThreadPoolHistogram* histogram : threadpool_histograms) {
+    histogram->Record(type, kThreadPoolHistogramWait, started - queued);
+    histogram->Record(type, kThreadPoolHistogramRun, finished - started);
+  }
+}
+
+void performance_state::RecordThreadPoolRequest(PerformanceThreadPoolType type,
+                                                uint64_t queued,
+                                                const uv_req_t* req) {
+  uint64_t started;
+  uint64_t finished;
+  if (uv_req_get_work_times(req, &started, &finished) == 0)
+    RecordThreadPoolWork(type, queued, started, finished);
+  else
+    RecordThreadPoolLatency(type, queued);
+}
+
 // Initialize the performance entry object properties
 inline void InitObject(const PerformanceEntry& entry, Local<Object> obj) {
   Environment* env = entry.env();
@@ -396,6 +429,69 @@ void Notify(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+// Fills the Float64Array in args[0] with the ThreadPoolWorkQueue state of
+// every ThreadPoolWorkType, followed by libuv's own state of the file system
+// and DNS requests, kThreadPoolUsageFieldCount values per type.
+enum ThreadPoolUsageFields {
+  kThreadPoolUsageLimit,
+  kThreadPoolUsageQueueLimit,
+  kThreadPoolUsageRunning,
+  kThreadPoolUsageQueued,
+  kThreadPoolUsageCompleted,
+  kThreadPoolUsageWaitTime,
+  kThreadPoolUsageFieldCount
+};
+
+// The libuv request types whose threadpool usage is reported after the
+// ThreadPoolWorkTypes, in the order of `threadPoolWorkTypes`.
+#define LIBUV_THREADPOOL_WORK_TYPES(V)                                        \
+  V(UV_FS, "fs")                                                              \
+  V(UV_GETADDRINFO, "dns")
+
+void GetThreadPoolUsage(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  constexpr size_t kTypeCount =
+      static_cast<size_t>(ThreadPoolWorkType::TYPE_COUNT);
+  static const uv_req_type uv_types[] = {
+#define V(type, _) type,
+    LIBUV_THREADPOOL_WORK_TYPES(V)
+#undef V
+  };
+
+  CHECK(args[0]->IsFloat64Array());
+  Local<Float64Array> array = args[0].As<Float64Array>();
+  CHECK_EQ(array->Length(),
+           (kTypeCount + arraysize(uv_types)) * kThreadPoolUsageFieldCount);
+  Local<ArrayBuffer> ab = array->Buffer();
+  double* fields = static_cast<double*>(ab->GetBackingStore()->Data());
+
+  for (size_t i = 0; i < kTypeCount; i++) {
+    ThreadPoolWorkQueue* queue =
+        env->threadpool_work_queue(static_cast<ThreadPoolWorkType>(i));
+    double* type_fields = fields + i * kThreadPoolUsageFieldCount;
+    type_fields[kThreadPoolUsageLimit] = queue->limit;
+    type_fields[kThreadPoolUsageQueueLimit] = queue->max_queued;
+    type_fields[kThreadPoolUsageRunning] = queue->running();
+    type_fields[kThreadPoolUsageQueued] = queue->queued();
+    type_fields[kThreadPoolUsageCompleted] = queue->completed;
+    type_fields[kThreadPoolUsageWaitTime] = queue->wait_time;
+  }
+
+  for (size_t i = 0; i < arraysize(uv_types); i++) {
+    uv_threadpool_usage_t usage;
+    CHECK_EQ(uv_threadpool_get_usage(uv_types[i], &usage), 0);
+    double* type_fields =
+        fields + (kTypeCount + i) * kThreadPoolUsageFieldCount;
+    type_fields[kThreadPoolUsageLimit] = usage.max_running;
+    type_fields[kThreadPoolUsageQueueLimit] = usage.max_queued;
+    type_fields[kThreadPoolUsageRunning] = usage.running;
+    type_fields[kThreadPoolUsageQueued] = usage.queued;
+    type_fields[kThreadPoolUsageCompleted] = usage.completed;
+    type_fields[kThreadPoolUsageWaitTime] = usage.wait_time;
+  }
+}
+
+
 // Event Loop Timing Histogram
 namespace {
 static void ELDHistogramMin(const FunctionCallbackInfo<Value>& args) {
@@ -547,6 +643,159 @@ bool ELDHistogram::Disable() {
   return true;
 }
 
+// Threadpool Histogram
+namespace {
+static ThreadPoolHistogram* UnwrapThreadPoolHistogram(
+    const FunctionCallbackInfo<Value>& args, Histogram** histogram) {
+  ThreadPoolHistogram* wrap = Unwrap<ThreadPoolHistogram>(args.Holder());
+  if (wrap == nullptr) return nullptr;
+  CHECK(args[0]->IsUint32());
+  *histogram = wrap->Get(args[0].As<Uint32>()->Value());
+  return wrap;
+}
+
+static void ThreadPoolHistogramCount(const FunctionCallbackInfo<Value>& args) {
+  Histogram* histogram;
+  if (UnwrapThreadPoolHistogram(args, &histogram) == nullptr) return;
+  double value = static_cast<double>(histogram->Count());
+  args.GetReturnValue().Set(value);
+}
+
+static void ThreadPoolHistogramMin(const FunctionCallbackInfo<Value>& args) {
+  Histogram* histogram;
+  if (UnwrapThreadPoolHistogram(args, &histogram) == nullptr) return;
+  double value = static_cast<double>(histogram->Min());
+  args.GetReturnValue().Set(value);
+}
+
+static void ThreadPoolHistogramMax(const FunctionCallbackInfo<Value>& args) {
+  Histogram* histogram;
+  if (UnwrapThreadPoolHistogram(args, &histogram) == nullptr) return;
+  double value = static_cast<double>(histogram->Max());
+  args.GetReturnValue().Set(value);
+}
+
+static void ThreadPoolHistogramMean(const FunctionCallbackInfo<Value>& args) {
+  Histogram* histogram;
+  if (UnwrapThreadPoolHistogram(args, &histogram) == nullptr) return;
+  args.GetReturnValue().Set(histogram->Mean());
+}
+
+static void ThreadPoolHistogramStddev(
+    const FunctionCallbackInfo<Value>& args) {
+  Histogram* histogram;
+  if (UnwrapThreadPoolHistogram(args, &histogram) == nullptr) return;
+  args.GetReturnValue().Set(histogram->Stddev());
+}
+
+static void ThreadPoolHistogramPercentile(
+    const FunctionCallbackInfo<Value>& args) {
+  Histogram* histogram;
+  if (UnwrapThreadPoolHistogram(args, &histogram) == nullptr) return;
+  CHECK(args[1]->IsNumber());
+  double percentile = args[1].As<Number>()->Value();
+  args.GetReturnValue().Set(histogram->Percentile(percentile));
+}
+
+static void ThreadPoolHistogramPercentiles(
+    const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  Histogram* histogram;
+  if (UnwrapThreadPoolHistogram(args, &histogram) == nullptr) return;
+  CHECK(args[1]->IsMap());
+  Local<Map> map = args[1].As<Map>();
+  histogram->Percentiles([&](double key, double value) {
+    map->Set(env->context(),
+             Number::New(env->isolate(), key),
+             Number::New(env->isolate(), value)).IsEmpty();
+  });
+}
+
+static void ThreadPoolHistogramEnable(const FunctionCallbackInfo<Value>& args) {
+  ThreadPoolHistogram* histogram;
+  ASSIGN_OR_RETURN_UNWRAP(&histogram, args.Holder());
+  args.GetReturnValue().Set(histogram->Enable());
+}
+
+static void ThreadPoolHistogramDisable(
+    const FunctionCallbackInfo<Value>& args) {
+  ThreadPoolHistogram* histogram;
+  ASSIGN_OR_RETURN_UNWRAP(&histogram, args.Holder());
+  args.GetReturnValue().Set(histogram->Disable());
+}
+
+static void ThreadPoolHistogramReset(const FunctionCallbackInfo<Value>& args) {
+  ThreadPoolHistogram* histogram;
+  ASSIGN_OR_RETURN_UNWRAP(&histogram, args.Holder());
+  histogram->ResetState();
+}
+
+static void ThreadPoolHistogramNew(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  CHECK(args.IsConstructCall());
+  new ThreadPoolHistogram(env, args.This());
+}
+}  // namespace
+
+ThreadPoolHistogram::ThreadPoolHistogram(Environment* env, Local<Object> wrap)
+    : BaseObject(env, wrap) {
+  MakeWeak();
+}
+
+ThreadPoolHistogram::~ThreadPoolHistogram() {
+  Disable();
+}
+
+Histogram* ThreadPoolHistogram::Get(size_t index) {
+  CHECK_LT(index, kCount);
+  if (!histograms_[index])
+    histograms_[index] = std::make_unique<Histogram>(1, 3.6e12);
+  return histograms_[index].get();
+}
+
+void ThreadPoolHistogram::Record(PerformanceThreadPoolType type,
+                                 ThreadPoolHistogramPhase phase,
+                                 int64_t value) {
+  // Short phases can take less time than the clock resolves. They still
+  // count, but the histogram cannot record values below 1.
+  Get(type * kThreadPoolHistogramPhaseCount + phase)->Record(
+      std::max<int64_t>(value, 1));
+}
+
+bool ThreadPoolHistogram::Enable() {
+  if (enabled_) return false;
+  enabled_ = true;
+  env()->performance_state()->threadpool_histograms.push_back(this);
+  return true;
+}
+
+bool ThreadPoolHistogram::Disable() {
+  if (!enabled_) return false;
+  enabled_ = false;
+  std::vector<ThreadPoolHistogram*>* histograms =
+      &env()->performance_state()->threadpool_histograms;
+  histograms->erase(
+      std::remove(histograms->begin(), histograms->end(), this),
+      histograms->end());
+  return true;
+}
+
+void ThreadPoolHistogram::ResetState() {
+  for (std::unique_ptr<Histogram>& histogram : histograms_) {
+    if (histogram)
+      histogram->Reset();
+  }
+}
+
+void ThreadPoolHistogram::MemoryInfo(MemoryTracker* tracker) const {
+  size_t size = 0;
+  for (const std::unique_ptr<Histogram>& histogram : histograms_) {
+    if (histogram)
+      size += histogram->GetMemorySize();
+  }
+  tracker->TrackFieldWithSize("histograms", size);
+}
+
 void Initialize(Local<Object> target,
                 Local<Value> unused,
                 Local<Context> context,
@@ -584,6 +833,30 @@ void Initialize(Local<Object> target,
                  "removeGarbageCollectionTracking",
                  RemoveGarbageCollectionTracking);
   env->SetMethod(target, "notify", Notify);
+  env->SetMethod(target, "getThreadPoolUsage", GetThreadPoolUsage);
+
+  Local<Value> threadpool_work_types[] = {
+#define V(_, label) OneByteString(isolate, label),
+    THREADPOOL_WORK_TYPES(V)
+    LIBUV_THREADPOOL_WORK_TYPES(V)
+#undef V
+  };
+  target->Set(context,
+              FIXED_ONE_BYTE_STRING(isolate, "threadPoolWorkTypes"),
+              Array::New(isolate,
+                         threadpool_work_types,
+                         arraysize(threadpool_work_types))).Check();
+
+  Local<Value> threadpool_monitor_types[] = {
+#define V(_, label) OneByteString(isolate, label),
+    NODE_PERFORMANCE_THREADPOOL_TYPES(V)
+#undef V
+  };
+  target->Set(context,
+              FIXED_ONE_BYTE_STRING(isolate, "threadPoolMonitorTypes"),
+              Array::New(isolate,
+                         threadpool_monitor_types,
+                         arraysize(threadpool_monitor_types))).Check();
 
   Local<Object> constants = Object::New(isolate);
 
@@ -607,6 +880,19 @@ void Initialize(Local<Object> target,
   NODE_DEFINE_CONSTANT(
     constants, NODE_PERFORMANCE_GC_FLAGS_SCHEDULE_IDLE);
 
+  NODE_DEFINE_HIDDEN_CONSTANT(constants, kThreadPoolUsageLimit);
+  NODE_DEFINE_HIDDEN_CONSTANT(constants, kThreadPoolUsageQueueLimit);
+  NODE_DEFINE_HIDDEN_CONSTANT(constants, kThreadPoolUsageRunning);
+  NODE_DEFINE_HIDDEN_CONSTANT(constants, kThreadPoolUsageQueued);
+  NODE_DEFINE_HIDDEN_CONSTANT(constants, kThreadPoolUsageCompleted);
+  NODE_DEFINE_HIDDEN_CONSTANT(constants, kThreadPoolUsageWaitTime);
+  NODE_DEFINE_HIDDEN_CONSTANT(constants, kThreadPoolUsageFieldCount);
+
+  NODE_DEFINE_HIDDEN_CONSTANT(constants, kThreadPoolHistogramWait);
+  NODE_DEFINE_HIDDEN_CONSTANT(constants, kThreadPoolHistogramRun);
+  NODE_DEFINE_HIDDEN_CONSTANT(constants, kThreadPoolHistogramLatency);
+  NODE_DEFINE_HIDDEN_CONSTANT(constants, kThreadPoolHistogramPhaseCount);
+
 #define V(name, _)                                                            \
   NODE_DEFINE_HIDDEN_CONSTANT(constants, NODE_PERFORMANCE_ENTRY_TYPE_##name);
   NODE_PERFORMANCE_ENTRY_TYPES(V)
@@ -653,6 +939,25 @@ void Initialize(Local<Object> target,
   env->SetProtoMethod(eldh, "reset", ELDHistogramReset);
   target->Set(context, eldh_classname,
               eldh->GetFunction(env->context()).ToLocalChecked()).Check();
+
+  Local<String> tph_classname =
+      FIXED_ONE_BYTE_STRING(isolate, "ThreadPoolHistogram");
+  Local<FunctionTemplate> tph =
+      env->NewFunctionTemplate(ThreadPoolHistogramNew);
+  tph->SetClassName(tph_classname);
+  tph->InstanceTemplate()->SetInternalFieldCount(1);
+  env->SetProtoMethod(tph, "count", ThreadPoolHistogramCount);
+  env->SetProtoMethod(tph, "min", ThreadPoolHistogramMin);
+  env->SetProtoMethod(tph, "max", ThreadPoolHistogramMax);
+  env->SetProtoMethod(tph, "mean", ThreadPoolHistogramMean);
+  env->SetProtoMethod(tph, "stddev", ThreadPoolHistogramStddev);
+  env->SetProtoMethod(tph, "percentile", ThreadPoolHistogramPercentile);
+  env->SetProtoMethod(tph, "percentiles", ThreadPoolHistogramPercentiles);
+  env->SetProtoMethod(tph, "enable", ThreadPoolHistogramEnable);
+  env->SetProtoMethod(tph, "disable", ThreadPoolHistogramDisable);
+  env->SetProtoMethod(tph, "reset", ThreadPoolHistogramReset);
+  target->Set(context, tph_classname,
+              tph->GetFunction(env->context()).ToLocalChecked()).Check();
 }
 
 }  // namespace performance
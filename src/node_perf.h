@@ -11,6 +11,7 @@
 #include "v8.h"
 #include "uv.h"
 
+#include <memory>
 #include <string>
 
 namespace node {
@@ -180,6 +181,41 @@ class ELDHistogram : public HandleWrap, public Histogram {
   uv_timer_t timer_;
 };
 
+enum ThreadPoolHistogramPhase {
+  kThreadPoolHistogramWait,
+  kThreadPoolHistogramRun,
+  kThreadPoolHistogramLatency,
+  kThreadPoolHistogramPhaseCount
+};
+
+// One histogram per work type and phase. The underlying HdrHistograms are
+// fairly large, so they are only allocated once something is recorded into
+// or read from them.
+class ThreadPoolHistogram : public BaseObject {
+ public:
+  ThreadPoolHistogram(Environment* env, Local<Object> wrap);
+  ~ThreadPoolHistogram() override;
+
+  static constexpr size_t kCount =
+      NODE_PERFORMANCE_THREADPOOL_TYPE_INVALID * kThreadPoolHistogramPhaseCount;
+
+  Histogram* Get(size_t index);
+  void Record(PerformanceThreadPoolType type,
+              ThreadPoolHistogramPhase phase,
+              int64_t value);
+  bool Enable();
+  bool Disable();
+  void ResetState();
+
+  void MemoryInfo(MemoryTracker* tracker) const override;
+  SET_MEMORY_INFO_NAME(ThreadPoolHistogram)
+  SET_SELF_SIZE(ThreadPoolHistogram)
+
+ private:
+  bool enabled_ = false;
+  std::unique_ptr<Histogram> histograms_[kCount];
+};
+
 }  // namespace performance
 }  // namespace node
 
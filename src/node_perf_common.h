@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace node {
 namespace performance {
@@ -38,6 +39,15 @@ extern uint64_t performance_v8_start;
   V(HTTP2, "http2")                                                           \
   V(HTTP, "http")
 
+// Work that is run on the libuv threadpool, as reported by
+// perf_hooks.monitorThreadpool(). Every ThreadPoolWorkType needs an entry here.
+#define NODE_PERFORMANCE_THREADPOOL_TYPES(V)                                  \
+  V(FS, "fs")                                                                 \
+  V(DNS, "dns")                                                               \
+  V(CRYPTO, "crypto")                                                         \
+  V(COMPRESSION, "compression")                                               \
+  V(USER, "user")
+
 enum PerformanceMilestone {
 #define V(name, _) NODE_PERFORMANCE_MILESTONE_##name,
   NODE_PERFORMANCE_MILESTONES(V)
@@ -52,6 +62,15 @@ enum PerformanceEntryType {
   NODE_PERFORMANCE_ENTRY_TYPE_INVALID
 };
 
+enum PerformanceThreadPoolType {
+#define V(name, _) NODE_PERFORMANCE_THREADPOOL_TYPE_##name,
+  NODE_PERFORMANCE_THREADPOOL_TYPES(V)
+#undef V
+  NODE_PERFORMANCE_THREADPOOL_TYPE_INVALID
+};
+
+class ThreadPoolHistogram;
+
 class performance_state {
  public:
   explicit performance_state(v8::Isolate* isolate) :
@@ -78,9 +97,33 @@ class performance_state {
 
   uint64_t performance_last_gc_start_mark = 0;
 
+  // Enabled perf_hooks.monitorThreadpool() histograms. Timestamps for
+  // threadpool requests are only taken while this is non-empty.
+  std::vector<ThreadPoolHistogram*> threadpool_histograms;
+
   void Mark(enum PerformanceMilestone milestone,
             uint64_t ts = PERFORMANCE_NOW());
 
+  bool threadpool_monitored() const { return !threadpool_histograms.empty(); }
+
+  // Records a request that was queued at `queued`, for which only the
+  // completion on the loop thread is observable.
+  void RecordThreadPoolLatency(PerformanceThreadPoolType type,
+                               uint64_t queued);
+  // Records a request for which the time it started and finished running on
+  // the threadpool is known as well.
+  void RecordThreadPoolWork(PerformanceThreadPoolType type,
+                            uint64_t queued,
+                            uint64_t started,
+                            uint64_t finished);
+  // Records a libuv request (fs and dns requests), taking the times it ran
+  // from libuv. Requests that did not run on the threadpool, such as fs
+  // requests that were completed by io_uring, only have their latency
+  // recorded.
+  void RecordThreadPoolRequest(PerformanceThreadPoolType type,
+                               uint64_t queued,
+                               const uv_req_t* req);
+
  private:
   struct performance_state_internal {
     // doubles first so that they are always sizeof(double)-aligned
@@ -45,6 +45,8 @@ namespace node {
 
 using v8::Array;
 using v8::ArrayBuffer;
+using v8::ArrayBufferView;
+using v8::BackingStore;
 using v8::Context;
 using v8::Function;
 using v8::FunctionCallbackInfo;
@@ -54,7 +56,9 @@ using v8::HandleScope;
 using v8::Int32;
 using v8::Integer;
 using v8::Local;
+using v8::Number;
 using v8::Object;
+using v8::SharedArrayBuffer;
 using v8::String;
 using v8::Uint32;
 using v8::Uint32Array;
@@ -121,6 +125,34 @@ struct CompressionError {
   inline bool IsError() const { return code != nullptr; }
 };
 
+// A preset dictionary for deflate and inflate streams. Dictionaries that live
+// in a SharedArrayBuffer, such as the ones created by zlib.createDictionary(),
+// are referenced rather than copied, so that every stream on every thread can
+// use the same memory.
+class ZlibDictionary {
+ public:
+  ZlibDictionary() = default;
+  explicit ZlibDictionary(Local<ArrayBufferView> view);
+
+  inline const unsigned char* data() const { return data_; }
+  inline size_t size() const { return size_; }
+  inline bool empty() const { return size_ == 0; }
+  // The number of bytes owned by this object, as opposed to shared ones.
+  inline size_t copied_size() const { return copy_.size(); }
+  void clear();
+
+  ZlibDictionary(ZlibDictionary&&) = default;
+  ZlibDictionary& operator=(ZlibDictionary&&) = default;
+  ZlibDictionary(const ZlibDictionary&) = delete;
+  ZlibDictionary& operator=(const ZlibDictionary&) = delete;
+
+ private:
+  std::shared_ptr<BackingStore> store_;
+  std::vector<unsigned char> copy_;
+  const unsigned char* data_ = nullptr;
+  size_t size_ = 0;
+};
+
 class ZlibContext : public MemoryRetainer {
  public:
   ZlibContext() = default;
@@ -137,15 +169,22 @@ class ZlibContext : public MemoryRetainer {
 
   // Zlib-specific:
   CompressionError Init(int level, int window_bits, int mem_level, int strategy,
-                        std::vector<unsigned char>&& dictionary);
+                        ZlibDictionary&& dictionary);
   void SetAllocationFunctions(alloc_func alloc, free_func free, void* opaque);
   CompressionError SetParams(int level, int strategy);
+  // Resets a DEFLATERAW stream so that it can compress the next block of a
+  // stream that is split into independent blocks, with a new dictionary.
+  // While compressing, the checksum of the input that a GZIP (CRC-32) or
+  // DEFLATE (Adler-32) stream would carry is computed on the threadpool.
+  CompressionError ResetBlock(node_zlib_mode checksum_mode,
+                              ZlibDictionary&& dictionary);
+  inline uint32_t checksum() const { return checksum_; }
 
   SET_MEMORY_INFO_NAME(ZlibContext)
   SET_SELF_SIZE(ZlibContext)
 
   void MemoryInfo(MemoryTracker* tracker) const override {
-    tracker->TrackField("dictionary", dictionary_);
+    tracker->TrackFieldWithSize("dictionary", dictionary_.copied_size());
   }
 
   ZlibContext(const ZlibContext&) = delete;
@@ -163,7 +202,9 @@ class ZlibContext : public MemoryRetainer {
   int strategy_ = 0;
   int window_bits_ = 0;
   unsigned int gzip_id_bytes_read_ = 0;
-  std::vector<unsigned char> dictionary_;
+  ZlibDictionary dictionary_;
+  node_zlib_mode checksum_mode_ = NONE;
+  uint32_t checksum_ = 0;
 
   z_stream strm_;
 };
@@ -244,7 +285,7 @@ class CompressionStream : public AsyncWrap, public ThreadPoolWork {
  public:
   CompressionStream(Environment* env, Local<Object> wrap)
       : AsyncWrap(env, wrap, AsyncWrap::PROVIDER_ZLIB),
-        ThreadPoolWork(env),
+        ThreadPoolWork(env, ThreadPoolWorkType::COMPRESSION),
         write_result_(nullptr) {
     MakeWeak();
   }
@@ -359,7 +400,13 @@ class CompressionStream : public AsyncWrap, public ThreadPoolWork {
     }
 
     // async version
-    ScheduleWork();
+    if (ScheduleWork() != 0) {
+      write_in_progress_ = false;
+      Unref();
+      EmitError(CompressionError("Too much work is queued for the threadpool",
+                                 "ERR_THREADPOOL_QUEUE_FULL",
+                                 UV_EAGAIN));
+    }
   }
 
   void UpdateWriteResult() {
@@ -435,6 +482,9 @@ class CompressionStream : public AsyncWrap, public ThreadPoolWork {
       Close();
   }
 
+  // Adds methods that only some of the subclasses implement.
+  static void SetProtoMethods(Environment* env, Local<FunctionTemplate> t) {}
+
   static void Reset(const FunctionCallbackInfo<Value> &args) {
     CompressionStream* wrap;
     ASSIGN_OR_RETURN_UNWRAP(&wrap, args.Holder());
@@ -445,6 +495,15 @@ class CompressionStream : public AsyncWrap, public ThreadPoolWork {
       wrap->EmitError(err);
   }
 
+  // Handles that lib/zlib.js puts back into its pool end their async
+  // resource here, and get a new one with asyncReset() when they are reused.
+  static void Release(const FunctionCallbackInfo<Value>& args) {
+    CompressionStream* wrap;
+    ASSIGN_OR_RETURN_UNWRAP(&wrap, args.Holder());
+    wrap->EmitTraceEventDestroy();
+    wrap->EmitDestroy();
+  }
+
   void MemoryInfo(MemoryTracker* tracker) const override {
     tracker->TrackField("compression context", ctx_);
     tracker->TrackFieldWithSize("zlib_memory",
@@ -598,14 +657,9 @@ class ZlibStream : public CompressionStream<ZlibContext> {
     CHECK(args[5]->IsFunction());
     Local<Function> write_js_callback = args[5].As<Function>();
 
-    std::vector<unsigned char> dictionary;
-    if (Buffer::HasInstance(args[6])) {
-      unsigned char* data =
-          reinterpret_cast<unsigned char*>(Buffer::Data(args[6]));
-      dictionary = std::vector<unsigned char>(
-          data,
-          data + Buffer::Length(args[6]));
-    }
+    ZlibDictionary dictionary;
+    if (Buffer::HasInstance(args[6]))
+      dictionary = ZlibDictionary(args[6].As<ArrayBufferView>());
 
     wrap->InitStream(write_result, write_js_callback);
 
@@ -637,6 +691,37 @@ class ZlibStream : public CompressionStream<ZlibContext> {
       wrap->EmitError(err);
   }
 
+  // resetBlock(checksumMode, dictionary)
+  static void ResetBlock(const FunctionCallbackInfo<Value>& args) {
+    CHECK(args.Length() == 2 && "resetBlock(checksumMode, dictionary)");
+    ZlibStream* wrap;
+    ASSIGN_OR_RETURN_UNWRAP(&wrap, args.Holder());
+    CHECK(args[0]->IsInt32());
+    node_zlib_mode checksum_mode =
+        static_cast<node_zlib_mode>(args[0].As<Int32>()->Value());
+
+    ZlibDictionary dictionary;
+    if (Buffer::HasInstance(args[1]))
+      dictionary = ZlibDictionary(args[1].As<ArrayBufferView>());
+
+    AllocScope alloc_scope(wrap);
+    const CompressionError err =
+        wrap->context()->ResetBlock(checksum_mode, std::move(dictionary));
+    if (err.IsError())
+      wrap->EmitError(err);
+  }
+
+  static void GetChecksum(const FunctionCallbackInfo<Value>& args) {
+    ZlibStream* wrap;
+    ASSIGN_OR_RETURN_UNWRAP(&wrap, args.Holder());
+    args.GetReturnValue().Set(wrap->context()->checksum());
+  }
+
+  static void SetProtoMethods(Environment* env, Local<FunctionTemplate> t) {
+    env->SetProtoMethod(t, "resetBlock", ResetBlock);
+    env->SetProtoMethodNoSideEffect(t, "getChecksum", GetChecksum);
+  }
+
   SET_MEMORY_INFO_NAME(ZlibStream)
   SET_SELF_SIZE(ZlibStream)
 };
@@ -747,9 +832,21 @@ void ZlibContext::DoThreadPoolWork() {
   switch (mode_) {
     case DEFLATE:
     case GZIP:
-    case DEFLATERAW:
       err_ = deflate(&strm_, flush_);
       break;
+    case DEFLATERAW: {
+      const Bytef* next_in = strm_.next_in;
+      err_ = deflate(&strm_, flush_);
+      const z_size_t consumed = strm_.next_in - next_in;
+      // crc32_z() and adler32_z() return their initial value for nullptr.
+      if (consumed == 0)
+        break;
+      if (checksum_mode_ == GZIP)
+        checksum_ = crc32_z(checksum_, next_in, consumed);
+      else if (checksum_mode_ == DEFLATE)
+        checksum_ = adler32_z(checksum_, next_in, consumed);
+      break;
+    }
     case UNZIP:
       if (strm_.avail_in > 0) {
         next_expected_header_byte = strm_.next_in;
@@ -918,6 +1015,19 @@ CompressionError ZlibContext::ResetStream() {
 }
 
 
+CompressionError ZlibContext::ResetBlock(node_zlib_mode checksum_mode,
+                                         ZlibDictionary&& dictionary) {
+  CHECK_EQ(mode_, DEFLATERAW);
+  checksum_mode_ = checksum_mode;
+  if (checksum_mode_ == GZIP)
+    checksum_ = crc32_z(0, nullptr, 0);
+  else
+    checksum_ = adler32_z(0, nullptr, 0);
+  dictionary_ = std::move(dictionary);
+  return ResetStream();
+}
+
+
 void ZlibContext::SetAllocationFunctions(alloc_func alloc,
                                          free_func free,
                                          void* opaque) {
@@ -927,9 +1037,34 @@ void ZlibContext::SetAllocationFunctions(alloc_func alloc,
 }
 
 
+ZlibDictionary::ZlibDictionary(Local<ArrayBufferView> view)
+    : size_(view->ByteLength()) {
+  if (size_ == 0)
+    return;
+  Local<ArrayBuffer> buffer = view->Buffer();
+  if (buffer->IsSharedArrayBuffer()) {
+    store_ = buffer.As<SharedArrayBuffer>()->GetBackingStore();
+    data_ = static_cast<const unsigned char*>(store_->Data()) +
+            view->ByteOffset();
+  } else {
+    copy_.resize(size_);
+    view->CopyContents(copy_.data(), size_);
+    data_ = copy_.data();
+  }
+}
+
+
+void ZlibDictionary::clear() {
+  store_.reset();
+  copy_.clear();
+  data_ = nullptr;
+  size_ = 0;
+}
+
+
 CompressionError ZlibContext::Init(
     int level, int window_bits, int mem_level, int strategy,
-    std::vector<unsigned char>&& dictionary) {
+    ZlibDictionary&& dictionary) {
   if (!((window_bits == 0) &&
         (mode_ == INFLATE ||
          mode_ == GUNZIP ||
@@ -1226,6 +1361,8 @@ struct MakeClass {
     env->SetProtoMethod(z, "init", Stream::Init);
     env->SetProtoMethod(z, "params", Stream::Params);
     env->SetProtoMethod(z, "reset", Stream::Reset);
+    env->SetProtoMethod(z, "release", Stream::Release);
+    Stream::SetProtoMethods(env, z);
 
     Local<String> zlibString = OneByteString(env->isolate(), name);
     z->SetClassName(zlibString);
@@ -1235,6 +1372,20 @@ struct MakeClass {
   }
 };
 
+// Combines the checksums of two consecutive pieces of data, given the length
+// of the second one. Streams that are compressed as independent blocks in
+// parallel use this to compute the checksum in their trailer.
+template <uLong (*Combine)(uLong, uLong, z_off_t)>
+void CombineChecksums(const FunctionCallbackInfo<Value>& args) {
+  CHECK(args[0]->IsUint32());
+  CHECK(args[1]->IsUint32());
+  CHECK(args[2]->IsNumber());
+  uLong value = Combine(args[0].As<Uint32>()->Value(),
+                        args[1].As<Uint32>()->Value(),
+                        static_cast<z_off_t>(args[2].As<Number>()->Value()));
+  args.GetReturnValue().Set(static_cast<uint32_t>(value));
+}
+
 void Initialize(Local<Object> target,
                 Local<Value> unused,
                 Local<Context> context,
@@ -1245,6 +1396,11 @@ void Initialize(Local<Object> target,
   MakeClass<BrotliEncoderStream>::Make(env, target, "BrotliEncoder");
   MakeClass<BrotliDecoderStream>::Make(env, target, "BrotliDecoder");
 
+  env->SetMethodNoSideEffect(target, "crc32Combine",
+                             CombineChecksums<crc32_combine>);
+  env->SetMethodNoSideEffect(target, "adler32Combine",
+                             CombineChecksums<adler32_combine>);
+
   target->Set(env->context(),
               FIXED_ONE_BYTE_STRING(env->isolate(), "ZLIB_VERSION"),
               FIXED_ONE_BYTE_STRING(env->isolate(), ZLIB_VERSION)).Check();
@@ -270,6 +270,7 @@ class StreamResource {
   uint64_t bytes_written_ = 0;
 
   friend class StreamListener;
+  friend class StreamPipe;  // For bytes_written_ when using sendfile().
 };
 
 
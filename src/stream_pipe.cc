@@ -1,13 +1,20 @@
 #include "stream_pipe.h"
 #include "stream_base-inl.h"
 #include "node_buffer.h"
+#include "node_file.h"
 #include "util-inl.h"
 
+#ifndef _WIN32
+#include <unistd.h>  // dup(), close()
+#endif
+
 using v8::Context;
 using v8::Function;
 using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
+using v8::Integer;
 using v8::Local;
+using v8::Number;
 using v8::Object;
 using v8::Value;
 
@@ -25,7 +32,8 @@ StreamPipe::StreamPipe(StreamBase* source,
   source->PushStreamListener(&readable_listener_);
   sink->PushStreamListener(&writable_listener_);
 
-  CHECK(sink->HasWantsWrite());
+  is_sendfile_ = CanSendFile(source, sink);
+  CHECK(is_sendfile_ || sink->HasWantsWrite());
 
   // Set up links between this object and the source/sink objects.
   // In particular, this makes sure that they are garbage collected as a group,
@@ -57,6 +65,16 @@ void StreamPipe::Unpipe(bool is_in_deletion) {
   if (is_closed_)
     return;
 
+  // A sendfile() call that is already running cannot be interrupted. Unless
+  // one of the streams is going away, stop once it has returned, so that the
+  // bytes it sent are still accounted for on the socket.
+  if (is_sendfile_ && sendfile_pending_ && !is_in_deletion &&
+      !sink_destroyed_ && !source_destroyed_) {
+    sendfile_stopping_ = true;
+    uv_cancel(reinterpret_cast<uv_req_t*>(&sendfile_req_));
+    return;
+  }
+
   // Note that we possibly cannot use virtual methods on `source` and `sink`
   // here, because this function can be called from their destructors via
   // `OnStreamDestroy()`.
@@ -70,6 +88,21 @@ void StreamPipe::Unpipe(bool is_in_deletion) {
 
   if (is_in_deletion) return;
 
+  if (is_sendfile_) {
+    if (!is_eof_ && sendfile_status_ == 0)
+      sendfile_status_ = UV_ECANCELED;
+    // The rest of the cleanup happens once a running call has returned.
+    if (sendfile_pending_)
+      uv_cancel(reinterpret_cast<uv_req_t*>(&sendfile_req_));
+    else
+      CloseSendFile();
+    return;
+  }
+
+  EmitUnpipe();
+}
+
+void StreamPipe::EmitUnpipe() {
   // Delay the JS-facing part with SetImmediate, because this might be from
   // inside the garbage collector, so we can’t run JS here.
   HandleScope handle_scope(env()->isolate());
@@ -79,11 +112,18 @@ void StreamPipe::Unpipe(bool is_in_deletion) {
     Context::Scope context_scope(env->context());
     Local<Object> object = this->object();
 
+    // The arguments are only meaningful when sendfile() was used, and report
+    // how the transfer ended and how many bytes were sent.
+    Local<Value> argv[] = {
+      Integer::New(env->isolate(), sendfile_status_),
+      Number::New(env->isolate(), static_cast<double>(sendfile_bytes_))
+    };
     Local<Value> onunpipe;
     if (!object->Get(env->context(), env->onunpipe_string()).ToLocal(&onunpipe))
       return;
     if (onunpipe->IsFunction() &&
-        MakeCallback(onunpipe.As<Function>(), 0, nullptr).IsEmpty()) {
+        MakeCallback(onunpipe.As<Function>(), arraysize(argv), argv)
+            .IsEmpty()) {
       return;
     }
 
@@ -159,9 +199,160 @@ void StreamPipe::ShutdownWritable() {
   sink()->Shutdown();
 }
 
+bool StreamPipe::CanSendFile(StreamBase* source, StreamBase* sink) {
+#ifdef _WIN32
+  return false;
+#else
+  return source->GetAsyncWrap()->provider_type() ==
+             AsyncWrap::PROVIDER_FILEHANDLE &&
+         sink->GetAsyncWrap()->provider_type() ==
+             AsyncWrap::PROVIDER_TCPWRAP;
+#endif
+}
+
+void StreamPipe::StartSendFile() {
+#ifdef _WIN32
+  UNREACHABLE();
+#else
+  fs::FileHandle* file = static_cast<fs::FileHandle*>(source());
+  sendfile_in_fd_ = file->GetFD();
+  sendfile_offset_ = file->read_offset();
+  sendfile_remaining_ = file->read_length();
+
+  // Like FileHandle::ReadStart(), a negative offset means that the transfer
+  // starts at the current file position. That position is not advanced.
+  if (sendfile_offset_ < 0) {
+    sendfile_offset_ = lseek(sendfile_in_fd_, 0, SEEK_CUR);
+    if (sendfile_offset_ < 0) {
+      sendfile_status_ = uv_translate_sys_error(errno);
+      return Unpipe();
+    }
+  }
+
+  int fd = dup(sink()->GetFD());
+  if (fd == -1) {
+    sendfile_status_ = uv_translate_sys_error(errno);
+    return Unpipe();
+  }
+  int err = uv_poll_init(env()->event_loop(), &sendfile_poll_, fd);
+  if (err != 0) {
+    close(fd);
+    sendfile_status_ = err;
+    return Unpipe();
+  }
+  sendfile_out_fd_ = fd;
+
+  // Keep this object alive until the poll handle has been closed.
+  sendfile_ref_ = BaseObjectPtr<StreamPipe>(this);
+  SendFileChunk();
+#endif
+}
+
+void StreamPipe::SendFileChunk() {
+  uint64_t length = kSendFileChunkSize;
+  if (sendfile_remaining_ >= 0 &&
+      static_cast<uint64_t>(sendfile_remaining_) < length) {
+    length = sendfile_remaining_;
+  }
+  if (length == 0) {
+    is_eof_ = true;
+    return Unpipe();
+  }
+
+  int err = uv_fs_sendfile(env()->event_loop(),
+                           &sendfile_req_,
+                           sendfile_out_fd_,
+                           sendfile_in_fd_,
+                           sendfile_offset_,
+                           length,
+                           AfterSendFile);
+  if (err < 0) {
+    sendfile_status_ = err;
+    return Unpipe();
+  }
+  sendfile_pending_ = true;
+  env()->IncreaseWaitingRequestCounter();
+}
+
+void StreamPipe::AfterSendFile(uv_fs_t* req) {
+  StreamPipe* pipe = ContainerOf(&StreamPipe::sendfile_req_, req);
+  ssize_t result = req->result;
+  uv_fs_req_cleanup(req);
+  pipe->sendfile_pending_ = false;
+  pipe->env()->DecreaseWaitingRequestCounter();
+
+  if (result > 0) {
+    pipe->sendfile_offset_ += result;
+    if (pipe->sendfile_remaining_ >= 0)
+      pipe->sendfile_remaining_ -= result;
+    pipe->sendfile_bytes_ += result;
+    if (!pipe->is_closed_)
+      pipe->sink()->bytes_written_ += result;
+  }
+
+  if (pipe->is_closed_)
+    return pipe->CloseSendFile();
+  if (pipe->sendfile_stopping_)
+    return pipe->Unpipe();
+
+  // The socket's send buffer is full; wait until it has drained.
+  if (result == UV_EAGAIN) {
+    result = uv_poll_start(&pipe->sendfile_poll_,
+                           UV_WRITABLE,
+                           OnSendFileWritable);
+    if (result == 0)
+      return;
+  }
+
+  if (result < 0) {
+    pipe->sendfile_status_ = result;
+    return pipe->Unpipe();
+  }
+
+  if (result == 0) {
+    pipe->is_eof_ = true;
+    return pipe->Unpipe();
+  }
+
+  pipe->SendFileChunk();
+}
+
+void StreamPipe::OnSendFileWritable(uv_poll_t* handle,
+                                    int status,
+                                    int events) {
+  StreamPipe* pipe = ContainerOf(&StreamPipe::sendfile_poll_, handle);
+  uv_poll_stop(handle);
+  if (status < 0) {
+    pipe->sendfile_status_ = status;
+    return pipe->Unpipe();
+  }
+  pipe->SendFileChunk();
+}
+
+void StreamPipe::CloseSendFile() {
+  if (sendfile_out_fd_ == -1)
+    return EmitUnpipe();
+
+  env()->CloseHandle(&sendfile_poll_, [](uv_poll_t* handle) {
+    StreamPipe* pipe = ContainerOf(&StreamPipe::sendfile_poll_, handle);
+#ifndef _WIN32
+    close(pipe->sendfile_out_fd_);
+#endif
+    pipe->sendfile_out_fd_ = -1;
+    pipe->EmitUnpipe();
+    pipe->sendfile_ref_.reset();
+  });
+}
+
 void StreamPipe::WritableListener::OnStreamAfterWrite(WriteWrap* w,
                                                       int status) {
   StreamPipe* pipe = ContainerOf(&StreamPipe::writable_listener_, this);
+  // When using sendfile(), all writes to the sink come from elsewhere.
+  if (pipe->is_sendfile_) {
+    CHECK_NOT_NULL(previous_listener_);
+    return previous_listener_->OnStreamAfterWrite(w, status);
+  }
+
   pipe->is_writing_ = false;
   if (pipe->is_eof_) {
     HandleScope handle_scope(pipe->env()->isolate());
@@ -193,6 +384,10 @@ void StreamPipe::WritableListener::OnStreamAfterShutdown(ShutdownWrap* w,
 void StreamPipe::ReadableListener::OnStreamDestroy() {
   StreamPipe* pipe = ContainerOf(&StreamPipe::readable_listener_, this);
   pipe->source_destroyed_ = true;
+  if (pipe->is_sendfile_) {
+    pipe->sendfile_status_ = UV_EPIPE;
+    return pipe->Unpipe();
+  }
   if (!pipe->is_eof_) {
     OnStreamRead(UV_EPIPE, uv_buf_init(nullptr, 0));
   }
@@ -242,6 +437,8 @@ void StreamPipe::Start(const FunctionCallbackInfo<Value>& args) {
   StreamPipe* pipe;
   ASSIGN_OR_RETURN_UNWRAP(&pipe, args.Holder());
   pipe->is_closed_ = false;
+  if (pipe->is_sendfile_)
+    return pipe->StartSendFile();
   if (pipe->wanted_data_ > 0)
     pipe->writable_listener_.OnStreamWantsWrite(pipe->wanted_data_);
 }
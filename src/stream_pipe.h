@@ -28,6 +28,21 @@ class StreamPipe : public AsyncWrap {
 
   inline void ShutdownWritable();
 
+  void EmitUnpipe();
+
+  // A FileHandle piped into a plaintext TCP socket is copied with
+  // uv_fs_sendfile() instead of being read into userland buffers first.
+  static bool CanSendFile(StreamBase* source, StreamBase* sink);
+  void StartSendFile();
+  void SendFileChunk();
+  void CloseSendFile();
+  static void AfterSendFile(uv_fs_t* req);
+  static void OnSendFileWritable(uv_poll_t* handle, int status, int events);
+
+  // Upper bound for a single sendfile() call, so that the threadpool is not
+  // held up by one large file.
+  static constexpr size_t kSendFileChunkSize = 1024 * 1024;
+
   bool is_reading_ = false;
   bool is_writing_ = false;
   bool is_eof_ = false;
@@ -35,6 +50,22 @@ class StreamPipe : public AsyncWrap {
   bool sink_destroyed_ = false;
   bool source_destroyed_ = false;
 
+  bool is_sendfile_ = false;
+  bool sendfile_pending_ = false;
+  // Unpipe() was called while a sendfile() call was running.
+  bool sendfile_stopping_ = false;
+  int sendfile_status_ = 0;
+  int sendfile_in_fd_ = -1;
+  // A duplicate of the socket's fd, so that it can be polled for writability
+  // independently of the socket handle.
+  int sendfile_out_fd_ = -1;
+  int64_t sendfile_offset_ = 0;
+  int64_t sendfile_remaining_ = -1;
+  uint64_t sendfile_bytes_ = 0;
+  uv_fs_t sendfile_req_;
+  uv_poll_t sendfile_poll_;
+  BaseObjectPtr<StreamPipe> sendfile_ref_;
+
   // Set a default value so that when we’re coming from Start(), we know
   // that we don’t want to read just yet.
   // This will likely need to be changed when supporting streams without
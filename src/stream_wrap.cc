@@ -148,6 +148,7 @@ Local<FunctionTemplate> LibuvStreamWrap::GetConstructorTemplate(
         Local<FunctionTemplate>(),
         static_cast<PropertyAttribute>(ReadOnly | DontDelete));
     env->SetProtoMethod(tmpl, "setBlocking", SetBlocking);
+    env->SetProtoMethod(tmpl, "setCoalesceWrites", SetCoalesceWrites);
     StreamBase::AddMethods(env, tmpl);
     env->set_libuv_stream_wrap_ctor_template(tmpl);
   }
@@ -293,6 +294,8 @@ void LibuvStreamWrap::GetWriteQueueSize(
   }
 
   uint32_t write_queue_size = wrap->stream()->write_queue_size;
+  if (wrap->pending_write_)
+    write_queue_size += wrap->pending_write_->bytes;
   info.GetReturnValue().Set(write_queue_size);
 }
 
@@ -309,6 +312,16 @@ void LibuvStreamWrap::SetBlocking(const FunctionCallbackInfo<Value>& args) {
   args.GetReturnValue().Set(uv_stream_set_blocking(wrap->stream(), enable));
 }
 
+void LibuvStreamWrap::SetCoalesceWrites(
+    const FunctionCallbackInfo<Value>& args) {
+  LibuvStreamWrap* wrap;
+  ASSIGN_OR_RETURN_UNWRAP(&wrap, args.Holder());
+
+  wrap->coalesce_writes_ = args[0]->IsTrue();
+  if (!wrap->coalesce_writes_)
+    wrap->FlushCoalescedWrites();
+}
+
 typedef SimpleShutdownWrap<ReqWrap<uv_shutdown_t>> LibuvShutdownWrap;
 typedef SimpleWriteWrap<ReqWrap<uv_write_t>> LibuvWriteWrap;
 
@@ -323,6 +336,8 @@ WriteWrap* LibuvStreamWrap::CreateWriteWrap(Local<Object> object) {
 
 int LibuvStreamWrap::DoShutdown(ShutdownWrap* req_wrap_) {
   LibuvShutdownWrap* req_wrap = static_cast<LibuvShutdownWrap*>(req_wrap_);
+  // uv_shutdown() waits for queued writes, so make sure they are queued.
+  FlushCoalescedWrites();
   return req_wrap->Dispatch(uv_shutdown, stream(), AfterUvShutdown);
 }
 
@@ -347,6 +362,11 @@ int LibuvStreamWrap::DoTryWrite(uv_buf_t** bufs, size_t* count) {
   uv_buf_t* vbufs = *bufs;
   size_t vcount = *count;
 
+  // Leave everything to DoWrite() so that it ends up in the next coalesced
+  // write, and so that nothing overtakes writes that are still pending.
+  if (coalesce_writes_ || pending_write_)
+    return 0;
+
   err = uv_try_write(stream(), vbufs, vcount);
   if (err == UV_ENOSYS || err == UV_EAGAIN)
     return 0;
@@ -381,6 +401,12 @@ int LibuvStreamWrap::DoWrite(WriteWrap* req_wrap,
                              uv_buf_t* bufs,
                              size_t count,
                              uv_stream_t* send_handle) {
+  if (coalesce_writes_ && send_handle == nullptr) {
+    CoalesceWrite(req_wrap, bufs, count);
+    return 0;
+  }
+
+  FlushCoalescedWrites();
   LibuvWriteWrap* w = static_cast<LibuvWriteWrap*>(req_wrap);
   return w->Dispatch(uv_write2,
                      stream(),
@@ -391,6 +417,72 @@ int LibuvStreamWrap::DoWrite(WriteWrap* req_wrap,
 }
 
 
+void LibuvStreamWrap::CoalesceWrite(WriteWrap* req_wrap,
+                                    uv_buf_t* bufs,
+                                    size_t count) {
+  if (!pending_write_) {
+    pending_write_ = std::make_unique<CoalescedWrite>();
+    pending_write_->env = env();
+    // Everything written until the end of this event loop iteration goes
+    // into the same uv_write().
+    BaseObjectPtr<LibuvStreamWrap> strong_ref{this};
+    env()->SetImmediate([this, strong_ref](Environment* env) {
+      FlushCoalescedWrites();
+    });
+  }
+
+  CoalescedWrite* batch = pending_write_.get();
+  batch->wraps.push_back(req_wrap);
+  for (size_t i = 0; i < count; i++) {
+    batch->bufs.push_back(bufs[i]);
+    batch->bytes += bufs[i].len;
+  }
+
+  if (batch->bufs.size() >= kMaxCoalescedBufs ||
+      batch->bytes >= kMaxCoalescedBytes) {
+    FlushCoalescedWrites();
+  }
+}
+
+
+void LibuvStreamWrap::FlushCoalescedWrites() {
+  if (!pending_write_)
+    return;
+
+  CoalescedWrite* batch = pending_write_.release();
+  int err = UV_ECANCELED;
+  if (IsAlive() && !IsClosing()) {
+    err = uv_write(&batch->req,
+                   stream(),
+                   batch->bufs.data(),
+                   batch->bufs.size(),
+                   AfterUvCoalescedWrite);
+  }
+  if (err == 0)
+    return;
+
+  // Like for any other write, report the failure asynchronously.
+  BaseObjectPtr<LibuvStreamWrap> strong_ref{this};
+  env()->SetImmediate([batch, err, strong_ref](Environment* env) {
+    FinishCoalescedWrite(batch, err);
+  });
+}
+
+
+void LibuvStreamWrap::AfterUvCoalescedWrite(uv_write_t* req, int status) {
+  FinishCoalescedWrite(ContainerOf(&CoalescedWrite::req, req), status);
+}
+
+
+void LibuvStreamWrap::FinishCoalescedWrite(CoalescedWrite* batch,
+                                           int status) {
+  std::unique_ptr<CoalescedWrite> batch_ptr(batch);
+  HandleScope scope(batch->env->isolate());
+  Context::Scope context_scope(batch->env->context());
+  for (WriteWrap* req_wrap : batch->wraps)
+    req_wrap->Done(status);
+}
+
 
 void LibuvStreamWrap::AfterUvWrite(uv_write_t* req, int status) {
   LibuvWriteWrap* req_wrap = static_cast<LibuvWriteWrap*>(
@@ -28,6 +28,9 @@
 #include "handle_wrap.h"
 #include "v8.h"
 
+#include <memory>
+#include <vector>
+
 namespace node {
 
 class Environment;
@@ -98,19 +101,43 @@ class LibuvStreamWrap : public HandleWrap, public StreamBase {
 
 
  private:
+  // Writes gathered while write coalescing is enabled, sent as one uv_write().
+  struct CoalescedWrite {
+    uv_write_t req;
+    Environment* env;
+    std::vector<uv_buf_t> bufs;
+    std::vector<WriteWrap*> wraps;
+    size_t bytes = 0;
+  };
+
+  // Upper bounds for a single coalesced write. The buffer count matches
+  // IOV_MAX on Linux, so that the batch can be written with one writev().
+  static constexpr size_t kMaxCoalescedBufs = 1024;
+  static constexpr size_t kMaxCoalescedBytes = 64 * 1024;
+
   static void GetWriteQueueSize(
       const v8::FunctionCallbackInfo<v8::Value>& info);
   static void SetBlocking(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void SetCoalesceWrites(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+
+  void CoalesceWrite(WriteWrap* req_wrap, uv_buf_t* bufs, size_t count);
+  void FlushCoalescedWrites();
+  static void FinishCoalescedWrite(CoalescedWrite* batch, int status);
 
   // Callbacks for libuv
   void OnUvAlloc(size_t suggested_size, uv_buf_t* buf);
   void OnUvRead(ssize_t nread, const uv_buf_t* buf);
 
   static void AfterUvWrite(uv_write_t* req, int status);
+  static void AfterUvCoalescedWrite(uv_write_t* req, int status);
   static void AfterUvShutdown(uv_shutdown_t* req, int status);
 
   uv_stream_t* const stream_;
 
+  bool coalesce_writes_ = false;
+  std::unique_ptr<CoalescedWrite> pending_write_;
+
 #ifdef _WIN32
   // We don't always have an FD that we could look up on the stream_
   // object itself on Windows. However, for some cases, we open handles
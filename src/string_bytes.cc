@@ -25,6 +25,7 @@
 #include "env-inl.h"
 #include "node_buffer.h"
 #include "node_errors.h"
+#include "utf8.h"
 #include "util.h"
 
 #include <climits>
@@ -342,7 +343,35 @@ size_t StringBytes::Write(Isolate* isolate,
 
     case BUFFER:
     case UTF8:
-      nbytes = str->WriteUtf8(isolate, buf, buflen, chars_written, flags);
+      // V8's WriteUtf8() encodes one character at a time. Runs of ASCII
+      // characters are copied in blocks instead.
+      if (str->IsExternalOneByte()) {
+        auto ext = str->GetExternalOneByteStringResource();
+        size_t read;
+        nbytes = latin1_to_utf8(ext->data(), ext->length(), buf, buflen, &read);
+        *chars_written = read;
+      } else if (str->IsOneByte()) {
+        // Latin-1 never gets shorter as UTF-8, so no more characters than
+        // fit into the buffer as bytes can be needed. Most strings turn out to
+        // be ASCII, and are then already written; otherwise, the rest of the
+        // string is moved out of the way and transcoded from there.
+        uint8_t* const dst = reinterpret_cast<uint8_t*>(buf);
+        const size_t length =
+            str->WriteOneByte(isolate, dst, 0, buflen, flags);
+        const size_t ascii = ascii_prefix_length(buf, length);
+        size_t read = 0;
+        nbytes = ascii;
+        if (ascii < length) {
+          MaybeStackBuffer<char> rest(length - ascii);
+          memcpy(*rest, buf + ascii, rest.length());
+          nbytes += latin1_to_utf8(
+              *rest, rest.length(), buf + ascii, buflen - ascii, &read);
+        }
+        *chars_written = ascii + read;
+      } else {
+        // Two-byte strings would have to be copied out of V8 first.
+        nbytes = str->WriteUtf8(isolate, buf, buflen, chars_written, flags);
+      }
       break;
 
     case UCS2: {
@@ -365,6 +394,15 @@ size_t StringBytes::Write(Isolate* isolate,
       if (str->IsExternalOneByte()) {
         auto ext = str->GetExternalOneByteStringResource();
         nbytes = base64_decode(buf, buflen, ext->data(), ext->length());
+      } else if (str->IsOneByte()) {
+        // Only one-byte input can be decoded in vectorized blocks.
+        MaybeStackBuffer<char> value(str->Length());
+        str->WriteOneByte(isolate,
+                          reinterpret_cast<uint8_t*>(*value),
+                          0,
+                          value.length(),
+                          flags);
+        nbytes = base64_decode(buf, buflen, *value, value.length());
       } else {
         String::Value value(isolate, str);
         nbytes = base64_decode(buf, buflen, *value, value.length());
@@ -482,111 +520,6 @@ Maybe<size_t> StringBytes::Size(Isolate* isolate,
 }
 
 
-
-
-static bool contains_non_ascii_slow(const char* buf, size_t len) {
-  for (size_t i = 0; i < len; ++i) {
-    if (buf[i] & 0x80)
-      return true;
-  }
-  return false;
-}
-
-
-static bool contains_non_ascii(const char* src, size_t len) {
-  if (len < 16) {
-    return contains_non_ascii_slow(src, len);
-  }
-
-  const unsigned bytes_per_word = sizeof(uintptr_t);
-  const unsigned align_mask = bytes_per_word - 1;
-  const unsigned unaligned = reinterpret_cast<uintptr_t>(src) & align_mask;
-
-  if (unaligned > 0) {
-    const unsigned n = bytes_per_word - unaligned;
-    if (contains_non_ascii_slow(src, n))
-      return true;
-    src += n;
-    len -= n;
-  }
-
-
-#if defined(_WIN64) || defined(_LP64)
-  const uintptr_t mask = 0x8080808080808080ll;
-#else
-  const uintptr_t mask = 0x80808080l;
-#endif
-
-  const uintptr_t* srcw = reinterpret_cast<const uintptr_t*>(src);
-
-  for (size_t i = 0, n = len / bytes_per_word; i < n; ++i) {
-    if (srcw[i] & mask)
-      return true;
-  }
-
-  const unsigned remainder = len & align_mask;
-  if (remainder > 0) {
-    const size_t offset = len - remainder;
-    if (contains_non_ascii_slow(src + offset, remainder))
-      return true;
-  }
-
-  return false;
-}
-
-
-static void force_ascii_slow(const char* src, char* dst, size_t len) {
-  for (size_t i = 0; i < len; ++i) {
-    dst[i] = src[i] & 0x7f;
-  }
-}
-
-
-static void force_ascii(const char* src, char* dst, size_t len) {
-  if (len < 16) {
-    force_ascii_slow(src, dst, len);
-    return;
-  }
-
-  const unsigned bytes_per_word = sizeof(uintptr_t);
-  const unsigned align_mask = bytes_per_word - 1;
-  const unsigned src_unalign = reinterpret_cast<uintptr_t>(src) & align_mask;
-  const unsigned dst_unalign = reinterpret_cast<uintptr_t>(dst) & align_mask;
-
-  if (src_unalign > 0) {
-    if (src_unalign == dst_unalign) {
-      const unsigned unalign = bytes_per_word - src_unalign;
-      force_ascii_slow(src, dst, unalign);
-      src += unalign;
-      dst += unalign;
-      len -= src_unalign;
-    } else {
-      force_ascii_slow(src, dst, len);
-      return;
-    }
-  }
-
-#if defined(_WIN64) || defined(_LP64)
-  const uintptr_t mask = ~0x8080808080808080ll;
-#else
-  const uintptr_t mask = ~0x80808080l;
-#endif
-
-  const uintptr_t* srcw = reinterpret_cast<const uintptr_t*>(src);
-  uintptr_t* dstw = reinterpret_cast<uintptr_t*>(dst);
-
-  for (size_t i = 0, n = len / bytes_per_word; i < n; ++i) {
-    dstw[i] = srcw[i] & mask;
-  }
-
-  const unsigned remainder = len & align_mask;
-  if (remainder > 0) {
-    const size_t offset = len - remainder;
-    force_ascii_slow(src + offset, dst + offset, remainder);
-  }
-}
-
-
 static size_t hex_encode(const char* src, size_t slen, char* dst, size_t dlen) {
   // We know how much we'll write, just make sure that there's space.
   CHECK(dlen >= slen * 2 &&
@@ -604,6 +537,33 @@ static size_t hex_encode(const char* src, size_t slen, char* dst, size_t dlen) {
 }
 
 
+static MaybeLocal<Value> EncodeValidUtf8(Isolate* isolate,
+                                         const char* buf,
+                                         size_t buflen,
+                                         Local<Value>* error) {
+  bool is_latin1;
+  const size_t length = utf8_utf16_length(buf, buflen, &is_latin1);
+
+  if (is_latin1) {
+    char* dst = node::UncheckedMalloc(length);
+    if (dst == nullptr) {
+      *error = node::ERR_MEMORY_ALLOCATION_FAILED(isolate);
+      return MaybeLocal<Value>();
+    }
+    CHECK_EQ(utf8_to_latin1(buf, buflen, dst), length);
+    return ExternOneByteString::New(isolate, dst, length, error);
+  }
+
+  uint16_t* dst = node::UncheckedMalloc<uint16_t>(length);
+  if (dst == nullptr) {
+    *error = node::ERR_MEMORY_ALLOCATION_FAILED(isolate);
+    return MaybeLocal<Value>();
+  }
+  CHECK_EQ(utf8_to_utf16(buf, buflen, dst), length);
+  return ExternTwoByteString::New(isolate, dst, length, error);
+}
+
+
 #define CHECK_BUFLEN_IN_RANGE(len)                                    \
   do {                                                                \
     if ((len) > Buffer::kMaxLength) {                                 \
@@ -642,7 +602,7 @@ MaybeLocal<Value> StringBytes::Encode(Isolate* isolate,
       }
 
     case ASCII:
-      if (contains_non_ascii(buf, buflen)) {
+      if (ascii_prefix_length(buf, buflen) != buflen) {
         char* out = node::UncheckedMalloc(buflen);
         if (out == nullptr) {
           *error = node::ERR_MEMORY_ALLOCATION_FAILED(isolate);
@@ -654,7 +614,17 @@ MaybeLocal<Value> StringBytes::Encode(Isolate* isolate,
         return ExternOneByteString::NewFromCopy(isolate, buf, buflen, error);
       }
 
-    case UTF8:
+    case UTF8: {
+      const size_t ascii = ascii_prefix_length(buf, buflen);
+      if (ascii == buflen)
+        return ExternOneByteString::NewFromCopy(isolate, buf, buflen, error);
+      // Large, valid inputs are transcoded here so that they can become
+      // external strings. Everything else, including input that needs
+      // replacement characters, is left to V8.
+      if (buflen >= EXTERN_APEX &&
+          utf8_validate(buf + ascii, buflen - ascii)) {
+        return EncodeValidUtf8(isolate, buf, buflen, error);
+      }
       val = String::NewFromUtf8(isolate,
                                 buf,
                                 v8::NewStringType::kNormal,
@@ -664,6 +634,7 @@ MaybeLocal<Value> StringBytes::Encode(Isolate* isolate,
         return MaybeLocal<Value>();
       }
       return val.ToLocalChecked();
+    }
 
     case LATIN1:
       return ExternOneByteString::NewFromCopy(isolate, buf, buflen, error);
@@ -24,22 +24,77 @@
 
 #if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
 
-#include "util-inl.h"
+#include "env-inl.h"
 #include "node_internals.h"
+#include "util-inl.h"
+
+#include <algorithm>
 
 namespace node {
 
-void ThreadPoolWork::ScheduleWork() {
+inline performance::PerformanceThreadPoolType ToPerformanceThreadPoolType(
+    ThreadPoolWorkType type) {
+  switch (type) {
+#define V(name, _)                                                            \
+    case ThreadPoolWorkType::name:                                            \
+      return performance::NODE_PERFORMANCE_THREADPOOL_TYPE_##name;
+    THREADPOOL_WORK_TYPES(V)
+#undef V
+    default:
+      UNREACHABLE();
+  }
+}
+
+int ThreadPoolWork::ScheduleWork() {
+  ThreadPoolWorkQueue* queue = env_->threadpool_work_queue(type_);
+  if (queue->full())
+    return UV_EAGAIN;
+
   env_->IncreaseWaitingRequestCounter();
+  queued_at_ = uv_hrtime();
+  if (queue->limit != 0 && queue->submitted >= queue->limit)
+    queue->pending.push_back(this);
+  else
+    QueueWork();
+  return 0;
+}
+
+void ThreadPoolWork::QueueWork() {
+  env_->threadpool_work_queue(type_)->submitted++;
   int status = uv_queue_work(
       env_->event_loop(),
       &work_req_,
       [](uv_work_t* req) {
         ThreadPoolWork* self = ContainerOf(&ThreadPoolWork::work_req_, req);
+        self->started_at_ = uv_hrtime();
+        self->env_->threadpool_work_queue(self->type_)->started++;
         self->DoThreadPoolWork();
+        self->finished_at_ = uv_hrtime();
       },
       [](uv_work_t* req, int status) {
         ThreadPoolWork* self = ContainerOf(&ThreadPoolWork::work_req_, req);
+        ThreadPoolWorkQueue* queue =
+            self->env_->threadpool_work_queue(self->type_);
+        queue->submitted--;
+        if (status == 0) {
+          queue->completed++;
+          queue->wait_time += self->started_at_ - self->queued_at_;
+          performance::performance_state* state =
+              self->env_->performance_state();
+          if (state->threadpool_monitored()) {
+            state->RecordThreadPoolWork(
+                ToPerformanceThreadPoolType(self->type_),
+                self->queued_at_,
+                self->started_at_,
+                self->finished_at_);
+          }
+        }
+        // Hand the freed slot to the oldest waiting work item of this type.
+        if (!queue->pending.empty()) {
+          ThreadPoolWork* next = queue->pending.front();
+          queue->pending.pop_front();
+          next->QueueWork();
+        }
         self->env_->DecreaseWaitingRequestCounter();
         self->AfterThreadPoolWork(status);
       });
@@ -47,6 +102,21 @@ void ThreadPoolWork::ScheduleWork() {
 }
 
 int ThreadPoolWork::CancelWork() {
+  std::deque<ThreadPoolWork*>* pending =
+      &env_->threadpool_work_queue(type_)->pending;
+  auto it = std::find(pending->begin(), pending->end(), this);
+  if (it != pending->end()) {
+    // Not handed to libuv yet. Mirror uv_cancel() and report the
+    // cancellation asynchronously. The request stops counting as waiting
+    // right away: Environment::CleanupHandles() spins the loop until no
+    // requests are waiting, and no longer runs native immediates by then.
+    pending->erase(it);
+    env_->DecreaseWaitingRequestCounter();
+    env_->SetImmediate([this](Environment* env) {
+      AfterThreadPoolWork(UV_ECANCELED);
+    });
+    return 0;
+  }
   return uv_cancel(reinterpret_cast<uv_req_t*>(&work_req_));
 }
 
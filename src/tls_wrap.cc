@@ -30,6 +30,7 @@
 #include "node_crypto_clienthello-inl.h"
 #include "node_errors.h"
 #include "stream_base-inl.h"
+#include "threadpoolwork-inl.h"
 #include "util-inl.h"
 
 namespace node {
@@ -43,6 +44,7 @@ using v8::Exception;
 using v8::Function;
 using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
+using v8::HandleScope;
 using v8::Integer;
 using v8::Isolate;
 using v8::Local;
@@ -88,6 +90,93 @@ TLSWrap::~TLSWrap() {
 }
 
 
+namespace {
+
+// The TLSWrap whose handshake may be offloaded by the SSL function that is
+// currently running on this thread, if any.
+thread_local TLSWrap* offloading_wrap = nullptr;
+
+}  // anonymous namespace
+
+
+class TLSWrap::KeyOperation final : public ThreadPoolWork {
+ public:
+  KeyOperation(TLSWrap* wrap, const std::function<int()>& operation)
+      : ThreadPoolWork(wrap->env(), ThreadPoolWorkType::CRYPTO),
+        wrap_(wrap),
+        operation_(operation) {}
+
+  void DoThreadPoolWork() override {
+    result_ = operation_();
+  }
+
+  void AfterThreadPoolWork(int status) override {
+    // The async job that waits for this operation owns it, and may finish
+    // as soon as it is resumed.
+    BaseObjectPtr<TLSWrap> wrap = std::move(wrap_);
+    if (status != 0)
+      result_ = -1;
+    done_ = true;
+    wrap->OnKeyOperationDone();
+  }
+
+  bool done() const { return done_; }
+  int result() const { return result_; }
+
+ private:
+  BaseObjectPtr<TLSWrap> wrap_;
+  const std::function<int()>& operation_;
+  int result_ = -1;
+  bool done_ = false;
+};
+
+
+int TLSWrap::RunKeyOperation(const std::function<int()>& operation) {
+  TLSWrap* wrap = offloading_wrap;
+  if (wrap == nullptr || ASYNC_get_current_job() == nullptr)
+    return operation();
+
+  Debug(wrap, "Offloading private key operation");
+  KeyOperation op(wrap, operation);
+  // Rather than failing the handshake, run the operation right away if too
+  // much crypto work is queued.
+  if (op.ScheduleWork() != 0)
+    return operation();
+  // A paused job may be resumed by calls that are unrelated to the key
+  // operation, so it only continues once the operation is done.
+  while (!op.done())
+    CHECK_EQ(ASYNC_pause_job(), 1);
+  return op.result();
+}
+
+
+void TLSWrap::OnKeyOperationDone() {
+  Debug(this, "Private key operation done");
+  HandleScope handle_scope(env()->isolate());
+  Context::Scope context_scope(env()->context());
+
+  if (abandoned_ssl_) {
+    // Let the job finish, so that it can be freed along with its SSL.
+    crypto::MarkPopErrorOnReturn mark_pop_error_on_return;
+    SSL_peek(abandoned_ssl_.get(), &peek_byte_, 1);
+    deferred_calls_.clear();
+    if (!SSL_waiting_for_async(abandoned_ssl_.get()))
+      abandoned_ssl_.reset();
+    return;
+  }
+
+  Cycle();
+}
+
+
+void TLSWrap::RunDeferredCalls() {
+  std::vector<std::function<void()>> calls;
+  calls.swap(deferred_calls_);
+  for (const auto& call : calls)
+    call();
+}
+
+
 bool TLSWrap::InvokeQueued(int status, const char* error_str) {
   Debug(this, "InvokeQueued(%d, %s)", status, error_str);
   if (!write_callback_scheduled_)
@@ -235,22 +324,23 @@ void TLSWrap::SSLInfoCallback(const SSL* ssl_, int where, int ret) {
   // SSL_renegotiate_pending() should take `const SSL*`, but it does not.
   SSL* ssl = const_cast<SSL*>(ssl_);
   TLSWrap* c = static_cast<TLSWrap*>(SSL_get_app_data(ssl_));
-  Environment* env = c->env();
-  HandleScope handle_scope(env->isolate());
-  Context::Scope context_scope(env->context());
-  Local<Object> object = c->object();
 
   if (where & SSL_CB_HANDSHAKE_START) {
     Debug(c, "SSLInfoCallback(SSL_CB_HANDSHAKE_START);");
     // Start is tracked to limit number and frequency of renegotiation attempts,
     // since excessive renegotiation may be an attack.
-    Local<Value> callback;
-
-    if (object->Get(env->context(), env->onhandshakestart_string())
-          .ToLocal(&callback) && callback->IsFunction()) {
-      Local<Value> argv[] = { env->GetNow() };
-      c->MakeCallback(callback.As<Function>(), arraysize(argv), argv);
-    }
+    c->CallOutsideAsyncJob([c]() {
+      Environment* env = c->env();
+      HandleScope handle_scope(env->isolate());
+      Context::Scope context_scope(env->context());
+      Local<Value> callback;
+
+      if (c->object()->Get(env->context(), env->onhandshakestart_string())
+            .ToLocal(&callback) && callback->IsFunction()) {
+        Local<Value> argv[] = { env->GetNow() };
+        c->MakeCallback(callback.As<Function>(), arraysize(argv), argv);
+      }
+    });
   }
 
   // SSL_CB_HANDSHAKE_START and SSL_CB_HANDSHAKE_DONE are called
@@ -259,14 +349,28 @@ void TLSWrap::SSLInfoCallback(const SSL* ssl_, int where, int ret) {
   if (where & SSL_CB_HANDSHAKE_DONE && !SSL_renegotiate_pending(ssl)) {
     Debug(c, "SSLInfoCallback(SSL_CB_HANDSHAKE_DONE);");
     CHECK(!SSL_renegotiate_pending(ssl));
-    Local<Value> callback;
 
     c->established_ = true;
+    // Only the initial handshake is offloaded.
+    SSL_clear_mode(ssl, SSL_MODE_ASYNC);
 
-    if (object->Get(env->context(), env->onhandshakedone_string())
-          .ToLocal(&callback) && callback->IsFunction()) {
-      c->MakeCallback(callback.As<Function>(), 0, nullptr);
+    if (c->is_server() && c->shared_session_cache_) {
+      c->shared_session_cache_->Count(crypto::SharedSessionCache::kHandshakes);
+      if (SSL_session_reused(ssl))
+        c->shared_session_cache_->Count(crypto::SharedSessionCache::kResumed);
     }
+
+    c->CallOutsideAsyncJob([c]() {
+      Environment* env = c->env();
+      HandleScope handle_scope(env->isolate());
+      Context::Scope context_scope(env->context());
+      Local<Value> callback;
+
+      if (c->object()->Get(env->context(), env->onhandshakedone_string())
+            .ToLocal(&callback) && callback->IsFunction()) {
+        c->MakeCallback(callback.As<Function>(), 0, nullptr);
+      }
+    });
   }
 }
 
@@ -414,6 +518,7 @@ Local<Value> TLSWrap::GetSSLError(int status, int* err, std::string* msg) {
     case SSL_ERROR_WANT_READ:
     case SSL_ERROR_WANT_WRITE:
     case SSL_ERROR_WANT_X509_LOOKUP:
+    case SSL_ERROR_WANT_ASYNC:
       return Local<Value>();
 
     case SSL_ERROR_ZERO_RETURN:
@@ -503,35 +608,43 @@ void TLSWrap::ClearOut() {
 
   crypto::MarkPopErrorOnReturn mark_pop_error_on_return;
 
-  char out[kClearOutChunkSize];
   int read;
   for (;;) {
-    read = SSL_read(ssl_.get(), out, sizeof(out));
-    Debug(this, "Read %d bytes of cleartext output", read);
-
-    if (read <= 0)
-      break;
-
-    char* current = out;
-    while (read > 0) {
-      int avail = read;
-
-      uv_buf_t buf = EmitAlloc(avail);
-      if (static_cast<int>(buf.len) < avail)
-        avail = buf.len;
-      memcpy(buf.base, current, avail);
-      EmitRead(avail, buf);
-
-      // Caveat emptor: OnRead() calls into JS land which can result in
-      // the SSL context object being destroyed.  We have to carefully
-      // check that ssl_ != nullptr afterwards.
+    // Have OpenSSL decrypt the next record without consuming it, so that its
+    // cleartext can be read straight into a buffer of the right size from
+    // the stream listener, rather than copied there from a buffer of our own.
+    {
+      TLSWrap* previous_offloading_wrap = offloading_wrap;
+      offloading_wrap = IsHandshakeOffloaded() ? this : nullptr;
+      read = SSL_peek(ssl_.get(), &peek_byte_, 1);
+      offloading_wrap = previous_offloading_wrap;
+    }
+    if (!deferred_calls_.empty()) {
+      RunDeferredCalls();
       if (ssl_ == nullptr) {
-        Debug(this, "Returning from read loop, ssl_ == nullptr");
+        Debug(this, "Returning from ClearOut(), ssl_ == nullptr");
         return;
       }
+    }
+    if (read <= 0)
+      break;
 
-      read -= avail;
-      current += avail;
+    size_t avail = SSL_pending(ssl_.get());
+    CHECK_GT(avail, 0);
+    uv_buf_t buf = EmitAlloc(avail);
+    if (buf.len < avail)
+      avail = buf.len;
+    read = SSL_read(ssl_.get(), buf.base, avail);
+    Debug(this, "Read %d bytes of cleartext output", read);
+    CHECK_EQ(read, static_cast<int>(avail));
+    EmitRead(read, buf);
+
+    // Caveat emptor: OnRead() calls into JS land which can result in
+    // the SSL context object being destroyed.  We have to carefully
+    // check that ssl_ != nullptr afterwards.
+    if (ssl_ == nullptr) {
+      Debug(this, "Returning from read loop, ssl_ == nullptr");
+      return;
     }
   }
 
@@ -584,6 +697,13 @@ void TLSWrap::ClearIn() {
     return;
   }
 
+  // SSL_write() would resume the offloaded handshake on its own behalf, so
+  // the data is kept until the handshake is done.
+  if (IsHandshakeOffloaded()) {
+    Debug(this, "Returning from ClearIn(), handshake in progress");
+    return;
+  }
+
   AllocatedBuffer data = std::move(pending_cleartext_input_);
   crypto::MarkPopErrorOnReturn mark_pop_error_on_return;
 
@@ -747,7 +867,16 @@ int TLSWrap::DoWrite(WriteWrap* w,
   crypto::MarkPopErrorOnReturn mark_pop_error_on_return;
 
   int written = 0;
-  if (count != 1) {
+  if (IsHandshakeOffloaded()) {
+    // See ClearIn().
+    data = env()->AllocateManaged(length);
+    size_t offset = 0;
+    for (i = 0; i < count; i++) {
+      memcpy(data.data() + offset, bufs[i].base, bufs[i].len);
+      offset += bufs[i].len;
+    }
+    written = -1;
+  } else if (count != 1) {
     data = env()->AllocateManaged(length);
     size_t offset = 0;
     for (i = 0; i < count; i++) {
@@ -767,7 +896,7 @@ int TLSWrap::DoWrite(WriteWrap* w,
   CHECK(written == -1 || written == static_cast<int>(length));
   Debug(this, "Writing %zu bytes, written = %d", length, written);
 
-  if (written == -1) {
+  if (written == -1 && !IsHandshakeOffloaded()) {
     int err;
     Local<Value> arg = GetSSLError(written, &err, &error_);
 
@@ -777,7 +906,9 @@ int TLSWrap::DoWrite(WriteWrap* w,
       current_write_ = nullptr;
       return UV_EPROTO;
     }
+  }
 
+  if (written == -1) {
     Debug(this, "Saving data for later write");
     // Otherwise, save unwritten data so it can be written later by ClearIn().
     CHECK_EQ(pending_cleartext_input_.size(), 0);
@@ -969,6 +1100,15 @@ void TLSWrap::DestroySSL(const FunctionCallbackInfo<Value>& args) {
   // And destroy
   wrap->InvokeQueued(UV_ECANCELED, "Canceled because of SSL destruction");
 
+  // A paused handshake can only be given up on once its key operation is
+  // done, so the SSL structure is kept until then.
+  if (wrap->ssl_ && SSL_waiting_for_async(wrap->ssl_.get())) {
+    Debug(wrap, "Keeping SSL until its key operation is done");
+    wrap->env()->isolate()->AdjustAmountOfExternalAllocatedMemory(
+        -kExternalSize);
+    wrap->abandoned_ssl_ = std::move(wrap->ssl_);
+  }
+
   // Destroy the SSL structure and friends
   wrap->SSLWrap<TLSWrap>::DestroySSL();
   wrap->enc_in_ = nullptr;
@@ -980,6 +1120,23 @@ void TLSWrap::DestroySSL(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+void TLSWrap::EnableHandshakeOffload(const FunctionCallbackInfo<Value>& args) {
+  TLSWrap* wrap;
+  ASSIGN_OR_RETURN_UNWRAP(&wrap, args.Holder());
+  CHECK(wrap->is_server());
+  CHECK(wrap->ssl_);
+
+  // Session callbacks and the certificate callback call into JS while the
+  // handshake is running, which cannot be done from within an async job.
+  bool enabled = ASYNC_is_capable() &&
+                 !wrap->session_callbacks_ &&
+                 !wrap->is_waiting_cert_cb();
+  if (enabled)
+    SSL_set_mode(wrap->ssl_.get(), SSL_MODE_ASYNC);
+  args.GetReturnValue().Set(enabled);
+}
+
+
 void TLSWrap::EnableCertCb(const FunctionCallbackInfo<Value>& args) {
   TLSWrap* wrap;
   ASSIGN_OR_RETURN_UNWRAP(&wrap, args.Holder());
@@ -1039,6 +1196,22 @@ int TLSWrap::SelectSNIContextCallback(SSL* s, int* ad, void* arg) {
   if (servername == nullptr)
     return SSL_TLSEXT_ERR_OK;
 
+  // An offloaded handshake runs without the certificate callback, which is
+  // what selects SNI contexts, so only the servername is left to record. That
+  // calls into V8, which can't be done on the stack of the async job.
+  if (ASYNC_get_current_job() != nullptr) {
+    p->CallOutsideAsyncJob([p, servername = std::string(servername)]() {
+      Environment* env = p->env();
+      HandleScope handle_scope(env->isolate());
+      Context::Scope context_scope(env->context());
+      USE(p->GetOwner()->Set(env->context(),
+                             env->servername_string(),
+                             OneByteString(env->isolate(),
+                                           servername.c_str())));
+    });
+    return SSL_TLSEXT_ERR_NOACK;
+  }
+
   HandleScope handle_scope(env->isolate());
   Context::Scope context_scope(env->context());
 
@@ -1270,6 +1443,7 @@ void TLSWrap::Initialize(Local<Object> target,
   env->SetProtoMethod(t, "enableTrace", EnableTrace);
   env->SetProtoMethod(t, "destroySSL", DestroySSL);
   env->SetProtoMethod(t, "enableCertCb", EnableCertCb);
+  env->SetProtoMethod(t, "enableHandshakeOffload", EnableHandshakeOffload);
 
 #ifndef OPENSSL_NO_PSK
   env->SetProtoMethod(t, "setPskIdentityHint", SetPskIdentityHint);
@@ -30,9 +30,13 @@
 #include "stream_wrap.h"
 #include "v8.h"
 
+#include <openssl/async.h>
 #include <openssl/ssl.h>
 
+#include <functional>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace node {
 
@@ -83,6 +87,21 @@ class TLSWrap : public AsyncWrap,
   // Called by the done() callback of the 'newSession' event.
   void NewSessionDoneCb();
 
+  // Runs a private key operation of a handshake, on the threadpool if the
+  // handshake is offloaded and right away otherwise.
+  static int RunKeyOperation(const std::function<int()>& operation);
+
+  // An offloaded handshake runs as an OpenSSL async job, on a stack of its
+  // own that JS must not run on. Calls into JS from SSL callbacks are
+  // deferred until the SSL function that ran the job has returned.
+  template <typename Fn>
+  inline void CallOutsideAsyncJob(Fn&& fn) {
+    if (ASYNC_get_current_job() == nullptr)
+      fn();
+    else
+      deferred_calls_.emplace_back(std::forward<Fn>(fn));
+  }
+
   // Implement MemoryRetainer:
   void MemoryInfo(MemoryTracker* tracker) const override;
   SET_MEMORY_INFO_NAME(TLSWrap)
@@ -97,8 +116,6 @@ class TLSWrap : public AsyncWrap,
     return static_cast<StreamBase*>(stream_);
   }
 
-  static const int kClearOutChunkSize = 16384;
-
   // Maximum number of bytes for hello parser
   static const int kMaxHelloLength = 16384;
 
@@ -164,11 +181,24 @@ class TLSWrap : public AsyncWrap,
       const v8::FunctionCallbackInfo<v8::Value>& args);
   static void EnableTrace(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void EnableCertCb(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void EnableHandshakeOffload(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
   static void DestroySSL(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void GetServername(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void SetServername(const v8::FunctionCallbackInfo<v8::Value>& args);
   static int SelectSNIContextCallback(SSL* s, int* ad, void* arg);
 
+  class KeyOperation;
+
+  // Whether the handshake is offloaded and still in progress. Only
+  // ClearOut() drives the handshake then, so that the async job is always
+  // resumed by the same SSL function that started it.
+  inline bool IsHandshakeOffloaded() const {
+    return ssl_ && (SSL_get_mode(ssl_.get()) & SSL_MODE_ASYNC);
+  }
+  void OnKeyOperationDone();
+  void RunDeferredCalls();
+
 #ifndef OPENSSL_NO_PSK
   static void SetPskIdentityHint(
       const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -202,6 +232,13 @@ class TLSWrap : public AsyncWrap,
   bool shutdown_ = false;
   std::string error_;
   int cycle_depth_ = 0;
+  // The buffer for SSL_peek() in ClearOut(). An async job that is paused in
+  // SSL_peek() writes to it when it is resumed, so it can't be on the stack.
+  char peek_byte_ = 0;
+  std::vector<std::function<void()>> deferred_calls_;
+  // The SSL of an offloaded handshake that was destroyed while it was
+  // waiting for a private key operation, until the operation is done.
+  crypto::SSLPointer abandoned_ssl_;
 
   // If true - delivered EOF to the js-land, either after `close_notify`, or
   // after the `UV_EOF` on socket.
@@ -0,0 +1,613 @@
+#include "utf8.h"  // NOLINT(build/include_inline)
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define NODE_UTF8_NEON 1
+#include <arm_neon.h>
+#elif defined(__GNUC__) && defined(__SSE2__)
+// SSE2 is part of the x86-64 baseline. Validation needs SSSE3 and is
+// dispatched at runtime, see base64.cc.
+#define NODE_UTF8_X86 1
+#include <immintrin.h>
+#endif
+
+namespace node {
+
+namespace {
+
+// Validation follows "Validating UTF-8 In Less Than One Instruction Per Byte"
+// by John Keiser and Daniel Lemire: every error in a sequence of up to four
+// bytes shows up in a combination of the high nibble of a byte and the high and
+// low nibbles of the byte before it. The three tables below map each of these
+// nibbles to the set of errors it could be part of; a bit that is set in all
+// three is an error. The remaining cases, continuation bytes that are missing
+// or superfluous in the third and fourth position, are found by checking that
+// continuation bytes appear exactly where a preceding lead byte wants them.
+
+constexpr uint8_t kTooShort = 1 << 0;   // 11______ 0_______
+                                        // 11______ 11______
+constexpr uint8_t kTooLong = 1 << 1;    // 0_______ 10______
+constexpr uint8_t kOverlong3 = 1 << 2;  // 11100000 100_____
+constexpr uint8_t kTooLarge = 1 << 3;   // 11110100 1001____
+                                        // 11110100 101_____
+                                        // 11110101 1001____
+                                        // 11110101 101_____
+                                        // 1111011_ 1001____
+                                        // 1111011_ 101_____
+                                        // 11111___ 1001____
+                                        // 11111___ 101_____
+constexpr uint8_t kSurrogate = 1 << 4;  // 11101101 101_____
+constexpr uint8_t kOverlong2 = 1 << 5;  // 1100000_ 10______
+constexpr uint8_t kTooLarge1000 = 1 << 6;  // 11110101 1000____
+                                           // 1111011_ 1000____
+                                           // 11111___ 1000____
+constexpr uint8_t kOverlong4 = 1 << 6;  // 11110000 1000____
+constexpr uint8_t kTwoConts = 1 << 7;   // 10______ 10______
+constexpr uint8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+// Indexed by the high nibble of the first byte.
+alignas(16) const uint8_t kByte1High[16] = {
+  // 0_______ <ASCII>
+  kTooLong, kTooLong, kTooLong, kTooLong,
+  kTooLong, kTooLong, kTooLong, kTooLong,
+  // 10______ <continuation>
+  kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+  // 1100____ <two byte lead>
+  kTooShort | kOverlong2,
+  // 1101____ <two byte lead>
+  kTooShort,
+  // 1110____ <three byte lead>
+  kTooShort | kOverlong3 | kSurrogate,
+  // 1111____ <four+ byte lead>
+  kTooShort | kTooLarge | kTooLarge1000 | kOverlong4
+};
+
+// Indexed by the low nibble of the first byte.
+alignas(16) const uint8_t kByte1Low[16] = {
+  // ____0000
+  kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+  // ____0001
+  kCarry | kOverlong2,
+  // ____001_
+  kCarry,
+  kCarry,
+  // ____0100
+  kCarry | kTooLarge,
+  // ____0101
+  kCarry | kTooLarge | kTooLarge1000,
+  // ____011_
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  // ____1___
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  // ____1101
+  kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000
+};
+
+// Indexed by the high nibble of the second byte.
+alignas(16) const uint8_t kByte2High[16] = {
+  // 0_______ <ASCII>
+  kTooShort, kTooShort, kTooShort, kTooShort,
+  kTooShort, kTooShort, kTooShort, kTooShort,
+  // 1000____
+  kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 | kOverlong4,
+  // 1001____
+  kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+  // 101_____
+  kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+  kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+  // 11______ <lead>
+  kTooShort, kTooShort, kTooShort, kTooShort
+};
+
+// A block whose last bytes exceed these values ends in the middle of a
+// sequence, which is an error unless the next block continues it.
+alignas(32) const uint8_t kIncompleteMax[32] = {
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 0xf0 - 1, 0xe0 - 1, 0xc0 - 1
+};
+
+bool ValidateScalar(const uint8_t* src, size_t len) {
+  size_t i = 0;
+  while (i < len) {
+    const uint8_t c = src[i];
+    if (c < 0x80) {
+      i++;
+      continue;
+    }
+
+    size_t extra;
+    uint32_t code_point;
+    if (c >= 0xc2 && c <= 0xdf) {
+      extra = 1;
+      code_point = c & 0x1f;
+    } else if (c >= 0xe0 && c <= 0xef) {
+      extra = 2;
+      code_point = c & 0x0f;
+    } else if (c >= 0xf0 && c <= 0xf4) {
+      extra = 3;
+      code_point = c & 0x07;
+    } else {
+      return false;
+    }
+    if (len - i <= extra)
+      return false;
+    for (size_t j = 1; j <= extra; j++) {
+      if ((src[i + j] & 0xc0) != 0x80)
+        return false;
+      code_point = (code_point << 6) | (src[i + j] & 0x3f);
+    }
+    if (extra == 2 &&
+        (code_point < 0x800 || (code_point >= 0xd800 && code_point <= 0xdfff)))
+      return false;
+    if (extra == 3 && (code_point < 0x10000 || code_point > 0x10ffff))
+      return false;
+    i += extra + 1;
+  }
+  return true;
+}
+
+size_t AsciiPrefixLengthScalar(const uint8_t* src, size_t len) {
+  size_t i = 0;
+  while (i < len && src[i] < 0x80)
+    i++;
+  return i;
+}
+
+// Decodes one multi-byte sequence starting at `src[*i]`.
+inline uint32_t DecodeSequence(const uint8_t* src, size_t* i) {
+  const uint8_t c = src[*i];
+  if (c < 0xe0) {
+    *i += 2;
+    return (c & 0x1f) << 6 | (src[*i - 1] & 0x3f);
+  }
+  if (c < 0xf0) {
+    *i += 3;
+    return (c & 0x0f) << 12 | (src[*i - 2] & 0x3f) << 6 |
+           (src[*i - 1] & 0x3f);
+  }
+  *i += 4;
+  return (c & 0x07) << 18 | (src[*i - 3] & 0x3f) << 12 |
+         (src[*i - 2] & 0x3f) << 6 | (src[*i - 1] & 0x3f);
+}
+
+#ifdef NODE_UTF8_X86
+
+#define NODE_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define NODE_TARGET_AVX2 __attribute__((target("avx2")))
+
+bool HasSSSE3() {
+  static const bool has_ssse3 = __builtin_cpu_supports("ssse3");
+  return has_ssse3;
+}
+
+bool HasAVX2() {
+  static const bool has_avx2 = __builtin_cpu_supports("avx2");
+  return has_avx2;
+}
+
+size_t AsciiPrefixLengthSSE2(const uint8_t* src, size_t len) {
+  size_t i = 0;
+  for (; len - i >= 16; i += 16) {
+    const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    const int mask = _mm_movemask_epi8(v);
+    if (mask != 0)
+      return i + __builtin_ctz(mask);
+  }
+  return i + AsciiPrefixLengthScalar(src + i, len - i);
+}
+
+struct ValidationStateSSSE3 {
+  __m128i error = _mm_setzero_si128();
+  __m128i prev_input = _mm_setzero_si128();
+  __m128i prev_incomplete = _mm_setzero_si128();
+};
+
+NODE_TARGET_SSSE3
+inline __m128i HighNibbleSSSE3(__m128i v) {
+  return _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0f));
+}
+
+NODE_TARGET_SSSE3
+inline __m128i LookupSSSE3(const uint8_t* table, __m128i index) {
+  return _mm_shuffle_epi8(
+      _mm_load_si128(reinterpret_cast<const __m128i*>(table)), index);
+}
+
+NODE_TARGET_SSSE3
+inline void ValidateBlockSSSE3(__m128i input, ValidationStateSSSE3* state) {
+  if (_mm_movemask_epi8(input) == 0) {
+    state->error = _mm_or_si128(state->error, state->prev_incomplete);
+  } else {
+    const __m128i prev1 = _mm_alignr_epi8(input, state->prev_input, 15);
+    const __m128i special_cases = _mm_and_si128(
+        _mm_and_si128(LookupSSSE3(kByte1High, HighNibbleSSSE3(prev1)),
+                      LookupSSSE3(kByte1Low,
+                                  _mm_and_si128(prev1, _mm_set1_epi8(0x0f)))),
+        LookupSSSE3(kByte2High, HighNibbleSSSE3(input)));
+    const __m128i prev2 = _mm_alignr_epi8(input, state->prev_input, 14);
+    const __m128i prev3 = _mm_alignr_epi8(input, state->prev_input, 13);
+    // Only 111_____ and 1111____ respectively end up >= 0x80.
+    const __m128i must_be_continuation = _mm_or_si128(
+        _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xe0 - 0x80))),
+        _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xf0 - 0x80))));
+    state->error = _mm_or_si128(
+        state->error,
+        _mm_xor_si128(
+            _mm_and_si128(must_be_continuation,
+                          _mm_set1_epi8(static_cast<char>(0x80))),
+            special_cases));
+    state->prev_incomplete = _mm_subs_epu8(
+        input,
+        _mm_load_si128(reinterpret_cast<const __m128i*>(kIncompleteMax + 16)));
+  }
+  state->prev_input = input;
+}
+
+NODE_TARGET_SSSE3
+bool ValidateSSSE3(const uint8_t* src, size_t len) {
+  ValidationStateSSSE3 state;
+  size_t i = 0;
+  for (; len - i >= 16; i += 16) {
+    ValidateBlockSSSE3(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), &state);
+  }
+  if (i < len) {
+    // The padding is ASCII, so it also catches truncated sequences.
+    uint8_t block[16] = {0};
+    memcpy(block, src + i, len - i);
+    ValidateBlockSSSE3(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(block)), &state);
+  }
+  const __m128i error = _mm_or_si128(state.error, state.prev_incomplete);
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) ==
+         0xffff;
+}
+
+struct ValidationStateAVX2 {
+  __m256i error;
+  __m256i prev_input;
+  __m256i prev_incomplete;
+};
+
+NODE_TARGET_AVX2
+inline __m256i HighNibbleAVX2(__m256i v) {
+  return _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0f));
+}
+
+NODE_TARGET_AVX2
+inline __m256i LookupAVX2(const uint8_t* table, __m256i index) {
+  return _mm256_shuffle_epi8(
+      _mm256_broadcastsi128_si256(
+          _mm_load_si128(reinterpret_cast<const __m128i*>(table))),
+      index);
+}
+
+// The last `16 - shift` bytes of `prev` followed by the first `shift` bytes
+// of `input`.
+#define NODE_PREV_AVX2(input, prev, n)                                        \
+  _mm256_alignr_epi8(input,                                                   \
+                     _mm256_permute2x128_si256(prev, input, 0x21),            \
+                     16 - (n))
+
+NODE_TARGET_AVX2
+inline void ValidateBlockAVX2(__m256i input, ValidationStateAVX2* state) {
+  if (_mm256_movemask_epi8(input) == 0) {
+    state->error = _mm256_or_si256(state->error, state->prev_incomplete);
+  } else {
+    const __m256i prev1 = NODE_PREV_AVX2(input, state->prev_input, 1);
+    const __m256i special_cases = _mm256_and_si256(
+        _mm256_and_si256(
+            LookupAVX2(kByte1High, HighNibbleAVX2(prev1)),
+            LookupAVX2(kByte1Low,
+                       _mm256_and_si256(prev1, _mm256_set1_epi8(0x0f)))),
+        LookupAVX2(kByte2High, HighNibbleAVX2(input)));
+    const __m256i prev2 = NODE_PREV_AVX2(input, state->prev_input, 2);
+    const __m256i prev3 = NODE_PREV_AVX2(input, state->prev_input, 3);
+    const __m256i must_be_continuation = _mm256_or_si256(
+        _mm256_subs_epu8(prev2,
+                         _mm256_set1_epi8(static_cast<char>(0xe0 - 0x80))),
+        _mm256_subs_epu8(prev3,
+                         _mm256_set1_epi8(static_cast<char>(0xf0 - 0x80))));
+    state->error = _mm256_or_si256(
+        state->error,
+        _mm256_xor_si256(
+            _mm256_and_si256(must_be_continuation,
+                             _mm256_set1_epi8(static_cast<char>(0x80))),
+            special_cases));
+    state->prev_incomplete = _mm256_subs_epu8(
+        input,
+        _mm256_load_si256(reinterpret_cast<const __m256i*>(kIncompleteMax)));
+  }
+  state->prev_input = input;
+}
+
+#undef NODE_PREV_AVX2
+
+NODE_TARGET_AVX2
+bool ValidateAVX2(const uint8_t* src, size_t len) {
+  ValidationStateAVX2 state;
+  state.error = _mm256_setzero_si256();
+  state.prev_input = _mm256_setzero_si256();
+  state.prev_incomplete = _mm256_setzero_si256();
+  size_t i = 0;
+  for (; len - i >= 32; i += 32) {
+    ValidateBlockAVX2(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)), &state);
+  }
+  if (i < len) {
+    uint8_t block[32] = {0};
+    memcpy(block, src + i, len - i);
+    ValidateBlockAVX2(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block)), &state);
+  }
+  const __m256i error = _mm256_or_si256(state.error, state.prev_incomplete);
+  return _mm256_testz_si256(error, error) != 0;
+}
+
+#undef NODE_TARGET_SSSE3
+#undef NODE_TARGET_AVX2
+
+#endif  // NODE_UTF8_X86
+
+#ifdef NODE_UTF8_NEON
+
+size_t AsciiPrefixLengthNEON(const uint8_t* src, size_t len) {
+  size_t i = 0;
+  for (; len - i >= 16; i += 16) {
+    if (vmaxvq_u8(vld1q_u8(src + i)) >= 0x80)
+      break;
+  }
+  return i + AsciiPrefixLengthScalar(src + i, len - i);
+}
+
+struct ValidationStateNEON {
+  uint8x16_t error;
+  uint8x16_t prev_input;
+  uint8x16_t prev_incomplete;
+};
+
+inline void ValidateBlockNEON(uint8x16_t input,
+                              const uint8x16_t tables[3],
+                              ValidationStateNEON* state) {
+  if (vmaxvq_u8(input) < 0x80) {
+    state->error = vorrq_u8(state->error, state->prev_incomplete);
+  } else {
+    const uint8x16_t prev1 = vextq_u8(state->prev_input, input, 15);
+    const uint8x16_t special_cases = vandq_u8(
+        vandq_u8(vqtbl1q_u8(tables[0], vshrq_n_u8(prev1, 4)),
+                 vqtbl1q_u8(tables[1], vandq_u8(prev1, vdupq_n_u8(0x0f)))),
+        vqtbl1q_u8(tables[2], vshrq_n_u8(input, 4)));
+    const uint8x16_t prev2 = vextq_u8(state->prev_input, input, 14);
+    const uint8x16_t prev3 = vextq_u8(state->prev_input, input, 13);
+    const uint8x16_t must_be_continuation =
+        vorrq_u8(vqsubq_u8(prev2, vdupq_n_u8(0xe0 - 0x80)),
+                 vqsubq_u8(prev3, vdupq_n_u8(0xf0 - 0x80)));
+    state->error = vorrq_u8(
+        state->error,
+        veorq_u8(vandq_u8(must_be_continuation, vdupq_n_u8(0x80)),
+                 special_cases));
+    state->prev_incomplete =
+        vqsubq_u8(input, vld1q_u8(kIncompleteMax + 16));
+  }
+  state->prev_input = input;
+}
+
+bool ValidateNEON(const uint8_t* src, size_t len) {
+  const uint8x16_t tables[3] = {
+    vld1q_u8(kByte1High), vld1q_u8(kByte1Low), vld1q_u8(kByte2High)
+  };
+  ValidationStateNEON state;
+  state.error = vdupq_n_u8(0);
+  state.prev_input = vdupq_n_u8(0);
+  state.prev_incomplete = vdupq_n_u8(0);
+  size_t i = 0;
+  for (; len - i >= 16; i += 16)
+    ValidateBlockNEON(vld1q_u8(src + i), tables, &state);
+  if (i < len) {
+    uint8_t block[16] = {0};
+    memcpy(block, src + i, len - i);
+    ValidateBlockNEON(vld1q_u8(block), tables, &state);
+  }
+  return vmaxvq_u8(vorrq_u8(state.error, state.prev_incomplete)) == 0;
+}
+
+#endif  // NODE_UTF8_NEON
+
+}  // anonymous namespace
+
+size_t ascii_prefix_length(const char* src, size_t len) {
+  const uint8_t* s = reinterpret_cast<const uint8_t*>(src);
+#if defined(NODE_UTF8_NEON)
+  return AsciiPrefixLengthNEON(s, len);
+#elif defined(NODE_UTF8_X86)
+  return AsciiPrefixLengthSSE2(s, len);
+#else
+  return AsciiPrefixLengthScalar(s, len);
+#endif
+}
+
+void force_ascii(const char* src, char* dst, size_t len) {
+  size_t i = 0;
+#if defined(NODE_UTF8_NEON)
+  for (; len - i >= 16; i += 16) {
+    vst1q_u8(reinterpret_cast<uint8_t*>(dst + i),
+             vandq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(src + i)),
+                      vdupq_n_u8(0x7f)));
+  }
+#elif defined(NODE_UTF8_X86)
+  for (; len - i >= 16; i += 16) {
+    const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                     _mm_and_si128(v, _mm_set1_epi8(0x7f)));
+  }
+#endif
+  for (; i < len; i++)
+    dst[i] = src[i] & 0x7f;
+}
+
+bool utf8_validate(const char* src, size_t len) {
+  const uint8_t* s = reinterpret_cast<const uint8_t*>(src);
+  // Most text starts with, and often consists only of, ASCII.
+  const size_t ascii = ascii_prefix_length(src, len);
+  s += ascii;
+  len -= ascii;
+  if (len == 0)
+    return true;
+#if defined(NODE_UTF8_NEON)
+  return ValidateNEON(s, len);
+#elif defined(NODE_UTF8_X86)
+  if (HasAVX2())
+    return ValidateAVX2(s, len);
+  if (HasSSSE3())
+    return ValidateSSSE3(s, len);
+  return ValidateScalar(s, len);
+#else
+  return ValidateScalar(s, len);
+#endif
+}
+
+size_t utf8_utf16_length(const char* src, size_t len, bool* is_latin1) {
+  const uint8_t* s = reinterpret_cast<const uint8_t*>(src);
+  // Every byte that is not a continuation byte starts a code point, and code
+  // points of four bytes need a surrogate pair.
+  size_t continuation = 0;
+  size_t four_byte = 0;
+  uint8_t max = 0;
+  size_t i = 0;
+#if defined(NODE_UTF8_NEON)
+  uint8x16_t max_v = vdupq_n_u8(0);
+  for (; len - i >= 16; i += 16) {
+    const uint8x16_t v = vld1q_u8(s + i);
+    max_v = vmaxq_u8(max_v, v);
+    // 10______ and 11110___ respectively.
+    continuation += vaddvq_u8(
+        vshrq_n_u8(vceqq_u8(vandq_u8(v, vdupq_n_u8(0xc0)), vdupq_n_u8(0x80)),
+                   7));
+    four_byte += vaddvq_u8(vshrq_n_u8(vcgeq_u8(v, vdupq_n_u8(0xf0)), 7));
+  }
+  max = vmaxvq_u8(max_v);
+#elif defined(NODE_UTF8_X86)
+  __m128i max_v = _mm_setzero_si128();
+  for (; len - i >= 16; i += 16) {
+    const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+    max_v = _mm_max_epu8(max_v, v);
+    // 10______ are the bytes below 0xc0 when compared as signed integers.
+    continuation += __builtin_popcount(_mm_movemask_epi8(
+        _mm_cmplt_epi8(v, _mm_set1_epi8(static_cast<char>(0xc0)))));
+    four_byte += __builtin_popcount(_mm_movemask_epi8(_mm_cmpeq_epi8(
+        _mm_max_epu8(v, _mm_set1_epi8(static_cast<char>(0xf0))), v)));
+  }
+  uint8_t lanes[16];
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), max_v);
+  for (uint8_t lane : lanes)
+    max = lane > max ? lane : max;
+#endif
+  for (; i < len; i++) {
+    continuation += (s[i] & 0xc0) == 0x80;
+    four_byte += s[i] >= 0xf0;
+    max = s[i] > max ? s[i] : max;
+  }
+  // Lead bytes above 0xc3 start code points of U+0100 and above.
+  *is_latin1 = max <= 0xc3;
+  return len - continuation + four_byte;
+}
+
+size_t utf8_to_utf16(const char* src, size_t len, uint16_t* dst) {
+  const uint8_t* s = reinterpret_cast<const uint8_t*>(src);
+  size_t i = 0;
+  size_t k = 0;
+  while (i < len) {
+    const size_t ascii = ascii_prefix_length(src + i, len - i);
+    size_t j = 0;
+#if defined(NODE_UTF8_NEON)
+    for (; ascii - j >= 16; j += 16) {
+      const uint8x16_t v = vld1q_u8(s + i + j);
+      vst1q_u16(dst + k + j, vmovl_u8(vget_low_u8(v)));
+      vst1q_u16(dst + k + j + 8, vmovl_high_u8(v));
+    }
+#elif defined(NODE_UTF8_X86)
+    for (; ascii - j >= 16; j += 16) {
+      const __m128i v =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + j));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + k + j),
+                       _mm_unpacklo_epi8(v, _mm_setzero_si128()));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + k + j + 8),
+                       _mm_unpackhi_epi8(v, _mm_setzero_si128()));
+    }
+#endif
+    for (; j < ascii; j++)
+      dst[k + j] = s[i + j];
+    i += ascii;
+    k += ascii;
+
+    // Decode multi-byte sequences until the next ASCII character.
+    while (i < len && s[i] >= 0x80) {
+      const uint32_t code_point = DecodeSequence(s, &i);
+      if (code_point < 0x10000) {
+        dst[k++] = static_cast<uint16_t>(code_point);
+      } else {
+        dst[k++] =
+            static_cast<uint16_t>(0xd800 + ((code_point - 0x10000) >> 10));
+        dst[k++] = static_cast<uint16_t>(0xdc00 + (code_point & 0x3ff));
+      }
+    }
+  }
+  return k;
+}
+
+size_t utf8_to_latin1(const char* src, size_t len, char* dst) {
+  const uint8_t* s = reinterpret_cast<const uint8_t*>(src);
+  size_t i = 0;
+  size_t k = 0;
+  while (i < len) {
+    const size_t ascii = ascii_prefix_length(src + i, len - i);
+    memcpy(dst + k, src + i, ascii);
+    i += ascii;
+    k += ascii;
+    while (i < len && s[i] >= 0x80) {
+      dst[k++] = static_cast<char>((s[i] & 0x1f) << 6 | (s[i + 1] & 0x3f));
+      i += 2;
+    }
+  }
+  return k;
+}
+
+size_t latin1_to_utf8(const char* src, size_t len,
+                      char* dst, size_t dstlen, size_t* read) {
+  const uint8_t* s = reinterpret_cast<const uint8_t*>(src);
+  size_t i = 0;
+  size_t k = 0;
+  while (i < len && k < dstlen) {
+    const size_t ascii =
+        ascii_prefix_length(src + i, std::min(len - i, dstlen - k));
+    memcpy(dst + k, src + i, ascii);
+    i += ascii;
+    k += ascii;
+    for (; i < len && s[i] >= 0x80; i++) {
+      if (dstlen - k < 2) {
+        *read = i;
+        return k;
+      }
+      dst[k++] = static_cast<char>(0xc0 | s[i] >> 6);
+      dst[k++] = static_cast<char>(0x80 | (s[i] & 0x3f));
+    }
+  }
+  *read = i;
+  return k;
+}
+
+}  // namespace node
@@ -0,0 +1,48 @@
+#ifndef SRC_UTF8_H_
+#define SRC_UTF8_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include <cstddef>
+#include <cstdint>
+
+namespace node {
+
+// ASCII and UTF-8 scanning and transcoding, vectorized where the CPU allows,
+// see utf8.cc.
+
+// Returns the length of the longest prefix of `src` that is pure ASCII.
+size_t ascii_prefix_length(const char* src, size_t len);
+
+// Copies `len` bytes from `src` to `dst`, clearing the high bit of each.
+void force_ascii(const char* src, char* dst, size_t len);
+
+// Returns true if `src` is well-formed UTF-8 as per RFC 3629: no overlong
+// encodings, surrogates, code points above U+10FFFF or truncated sequences.
+bool utf8_validate(const char* src, size_t len);
+
+// The remaining functions expect well-formed UTF-8.
+
+// Returns the number of UTF-16 code units needed to represent `src`, and sets
+// `*is_latin1` to whether all of its code points are below U+0100.
+size_t utf8_utf16_length(const char* src, size_t len, bool* is_latin1);
+
+// Transcodes `src` to UTF-16 in host byte order. `dst` must have room for
+// utf8_utf16_length() code units. Returns the number of code units written.
+size_t utf8_to_utf16(const char* src, size_t len, uint16_t* dst);
+
+// Transcodes `src`, which must only contain code points below U+0100, to
+// Latin-1. Returns the number of bytes written.
+size_t utf8_to_latin1(const char* src, size_t len, char* dst);
+
+// Transcode Latin-1 to UTF-8. At most `dstlen` bytes are written, and never
+// part of a character. `*read` is set to the number of characters consumed.
+// Return the number of bytes written.
+size_t latin1_to_utf8(const char* src, size_t len,
+                      char* dst, size_t dstlen, size_t* read);
+
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_UTF8_H_
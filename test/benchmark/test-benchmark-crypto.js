@@ -15,9 +15,15 @@ runBenchmark('crypto',
                'algo=sha256',
                'api=stream',
                'cipher=',
+               'key=ec',
                'keylen=1024',
+               'kind=hash',
                'len=1',
+               'method=hashBatch',
+               'metric=throughput',
+               'mode=async',
                'n=1',
+               'offload=0',
                'out=buffer',
                'size=1',
                'type=buf',
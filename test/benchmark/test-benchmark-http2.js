@@ -21,7 +21,8 @@ runBenchmark('http2',
                'n=1',
                'nheaders=0',
                'requests=1',
-               'streams=1'
+               'streams=1',
+               'values=repeated'
              ],
              {
                NODEJS_BENCHMARK_ZERO_ALLOWED: 1,
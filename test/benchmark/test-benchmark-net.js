@@ -10,11 +10,15 @@ const runBenchmark = require('../common/benchmark');
 
 runBenchmark('net',
              [
+               'chunklen=64',
+               'coalesce=1',
                'dur=0',
                'len=1024',
+               'pipeline=1',
                'recvbufgenfn=false',
                'recvbuflen=0',
                'sendchunklen=256',
-               'type=buf'
+               'type=buf',
+               'writes=4'
              ],
              { NODEJS_BENCHMARK_ZERO_ALLOWED: 1 });
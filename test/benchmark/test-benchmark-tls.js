@@ -16,9 +16,14 @@ const runBenchmark = require('../common/benchmark');
 
 runBenchmark('tls',
              [
+               'coalesce=0',
                'concurrency=1',
+               'contexts=0',
                'dur=0.1',
+               'metric=handshakes',
                'n=1',
+               'ocspCache=0',
+               'offload=0',
                'size=2',
                'securing=SecurePair',
                'type=asc'
@@ -10,9 +10,11 @@ runBenchmark('zlib',
                'chunkLen=1024',
                'duration=0.001',
                'inputLen=1024',
+               'level=6',
                'method=',
                'n=1',
                'options=true',
+               'parallelism=2',
                'type=Deflate',
              ],
              {
@@ -0,0 +1,29 @@
+'use strict';
+const common = require('../../common');
+const assert = require('assert');
+const { Worker, workerData } = require('worker_threads');
+const test_async = require(`./build/${common.buildType}/test_async`);
+
+// Work that waits for a slot of --threadpool-user-size is cancelled without
+// involving libuv. The cancellation is reported asynchronously, and an
+// Environment that stops right after cancelling such work does not wait for
+// the report.
+
+if (workerData === 'complete') {
+  test_async.TestCancel(common.mustCall());
+  return;
+}
+if (workerData === 'exit') {
+  test_async.TestCancel(() => {});
+  process.exit(0);
+}
+
+for (const mode of ['complete', 'exit']) {
+  const worker = new Worker(__filename, {
+    workerData: mode,
+    execArgv: ['--threadpool-user-size=1']
+  });
+  worker.on('exit', common.mustCall((code) => {
+    assert.strictEqual(code, 0);
+  }));
+}
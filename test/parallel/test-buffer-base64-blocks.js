@@ -0,0 +1,111 @@
+'use strict';
+
+// Base64 is encoded and decoded in blocks of up to 64 characters where the
+// CPU supports it. Check inputs of many sizes, with whitespace, padding and
+// invalid characters at different offsets, against a simple reference
+// implementation.
+
+require('../common');
+const assert = require('assert');
+
+const alphabet =
+  'ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/';
+
+function encode(buf) {
+  let str = '';
+  for (let i = 0; i < buf.length; i += 3) {
+    const n = buf[i] << 16 | buf[i + 1] << 8 | buf[i + 2];
+    str += alphabet[n >> 18 & 63] + alphabet[n >> 12 & 63];
+    str += i + 1 < buf.length ? alphabet[n >> 6 & 63] : '=';
+    str += i + 2 < buf.length ? alphabet[n & 63] : '=';
+  }
+  return str;
+}
+
+// Characters outside the alphabet are skipped; decoding stops at '='.
+function decode(str) {
+  const values = [];
+  for (const c of str) {
+    if (c === '=')
+      break;
+    let value = alphabet.indexOf(c);
+    if (c === '-') value = 62;
+    if (c === '_') value = 63;
+    if (value !== -1)
+      values.push(value);
+  }
+  const bytes = [];
+  for (let i = 0; i + 1 < values.length; i += 4) {
+    bytes.push(values[i] << 2 | values[i + 1] >> 4);
+    if (i + 2 < values.length)
+      bytes.push((values[i + 1] & 15) << 4 | values[i + 2] >> 2);
+    if (i + 3 < values.length)
+      bytes.push((values[i + 2] & 3) << 6 | values[i + 3]);
+  }
+  return Buffer.from(bytes);
+}
+
+let seed = 1;
+function random(n) {
+  seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+  return seed % n;
+}
+
+for (let size = 0; size < 300; size++) {
+  const buf = Buffer.alloc(size);
+  for (let i = 0; i < size; i++)
+    buf[i] = random(256);
+
+  const encoded = buf.toString('base64');
+  assert.strictEqual(encoded, encode(buf));
+  assert.deepStrictEqual(Buffer.from(encoded, 'base64'), buf);
+
+  const urlSafe = encoded.replace(/\+/g, '-').replace(/\//g, '_');
+  assert.deepStrictEqual(Buffer.from(urlSafe, 'base64'), buf);
+  assert.deepStrictEqual(Buffer.from(urlSafe.replace(/=/g, ''), 'base64'),
+                         buf);
+
+  if (encoded.length === 0)
+    continue;
+  for (const c of [' ', '\n', '=', '*', 'é', '✓']) {
+    const offset = random(encoded.length);
+    const str = encoded.slice(0, offset) + c + encoded.slice(offset);
+    assert.deepStrictEqual(Buffer.from(str, 'base64'), decode(str),
+                           `${JSON.stringify(c)} at ${offset} of ${size}`);
+  }
+}
+
+// Line-wrapped input, as found in MIME bodies and PEM files.
+{
+  const buf = Buffer.alloc(64 * 1024);
+  for (let i = 0; i < buf.length; i++)
+    buf[i] = random(256);
+  const wrapped = buf.toString('base64').replace(/.{76}/g, '$&\r\n');
+  assert.deepStrictEqual(Buffer.from(wrapped, 'base64'), buf);
+}
+
+// Large strings that are not external are decoded in blocks as well. The
+// same input as a two-byte string, which is decoded by the scalar code, gives
+// the same result.
+{
+  const buf = Buffer.alloc(192 * 1024);
+  for (let i = 0; i < buf.length; i++)
+    buf[i] = random(256);
+  const encoded = buf.toString('base64');
+  const offset = encoded.length - random(64) - 1;
+  const str = encoded.slice(0, offset) + '*' + encoded.slice(offset);
+  const expected = decode(str);
+  assert.deepStrictEqual(expected, buf);
+  assert.deepStrictEqual(Buffer.from(str, 'base64'), expected);
+  assert.deepStrictEqual(Buffer.from(`${str}✓`, 'base64'), expected);
+}
+
+// Writing into a buffer that is too small must not overrun it.
+{
+  const buf = Buffer.alloc(1000, 'x');
+  const encoded = buf.toString('base64');
+  const target = Buffer.alloc(200, 0);
+  assert.strictEqual(target.write(encoded, 10, 100, 'base64'), 100);
+  assert.deepStrictEqual(target.slice(10, 110), buf.slice(0, 100));
+  assert.strictEqual(target[110], 0);
+}
@@ -0,0 +1,147 @@
+'use strict';
+
+// UTF-8 input is validated and transcoded in blocks where the CPU supports
+// it, with separate paths for ASCII, Latin-1 and other text, and for strings
+// large enough to be external. Check that all of them agree with each other
+// and with the handling of malformed input.
+
+const common = require('../common');
+const assert = require('assert');
+const { TextDecoder, TextEncoder } = require('util');
+
+const kLarge = 2 * 1024 * 1024;
+
+const samples = [
+  'plain ASCII text, nothing to see here. ',
+  'Größenmaßstäbe für Käse, Crème brûlée. ',
+  'Hello, 世界! Привет, мир! 🌍 ',
+  '\u007f\u0080\u07ff\u0800\uffff\u{10000}\u{10ffff}'
+];
+
+for (const sample of samples) {
+  for (const length of [0, 1, 15, 16, 17, 31, 32, 33, 63, 64, 65, 1000,
+                        kLarge]) {
+    const str = sample.repeat(Math.ceil(length / sample.length));
+    const buf = Buffer.from(str);
+    assert.strictEqual(buf.toString(), str);
+    assert.strictEqual(buf.toString('utf8', 0, buf.length), str);
+
+    const target = Buffer.alloc(buf.length + 1, 0xff);
+    assert.strictEqual(target.write(str), buf.length);
+    assert.deepStrictEqual(target.slice(0, buf.length), buf);
+    assert.strictEqual(target[buf.length], 0xff);
+  }
+}
+
+// Latin-1 strings written into a buffer that is too small are only written up
+// to the last complete character.
+{
+  const str = 'éa'.repeat(1000);
+  const target = Buffer.alloc(100);
+  assert.strictEqual(target.write(str, 0, 4), 3);
+  assert.strictEqual(target.toString('utf8', 0, 3), 'éa');
+  assert.strictEqual(target.write('a'.repeat(1000), 0, 4), 4);
+}
+
+// Strings are only written up to the last character that fits completely,
+// with lone surrogates replaced, the same way as by V8's own encoder, which
+// TextEncoder#encode() uses.
+{
+  const encoder = new TextEncoder();
+  const strings = [
+    'abcdefghijklmnopqrstuvwxyzé',
+    'aé'.repeat(20),
+    `${'x'.repeat(20)}é${'y'.repeat(20)}`,
+    `${'x'.repeat(17)}🌍${'y'.repeat(17)}`,
+    `${'x'.repeat(16)}\ud83c${'y'.repeat(16)}\udf0d`,
+    '\udf0d\ud83c'.repeat(10),
+    `${'世界'.repeat(10)}abc`
+  ];
+  for (const str of strings) {
+    const chars = [...str].map((c) => encoder.encode(c));
+    for (let length = 0; length <= 3 * str.length + 1; length++) {
+      let expected = Buffer.alloc(0);
+      for (const bytes of chars) {
+        if (expected.length + bytes.length > length)
+          break;
+        expected = Buffer.concat([expected, bytes]);
+      }
+      const target = Buffer.alloc(length);
+      assert.strictEqual(target.write(str), expected.length);
+      assert.deepStrictEqual(target.slice(0, expected.length), expected);
+    }
+    assert.deepStrictEqual(Buffer.from(str), Buffer.from(encoder.encode(str)));
+  }
+}
+
+// Malformed input is replaced with U+FFFD wherever it appears in a large
+// buffer, the same way as in a small one.
+{
+  const invalid = [
+    [0x80],
+    [0xc0, 0x80],
+    [0xed, 0xa0, 0x80],
+    [0xf4, 0x90, 0x80, 0x80],
+    [0xe2, 0x82]
+  ];
+  for (const bytes of invalid) {
+    for (const offset of [0, 16, kLarge - 64]) {
+      const buf = Buffer.alloc(kLarge, 'é');
+      buf.set(bytes, offset);
+      const expected = buf.slice(0, offset).toString() +
+                       buf.slice(offset, offset + 64).toString() +
+                       buf.slice(offset + 64).toString();
+      assert.ok(expected.includes('\ufffd'));
+      assert.strictEqual(buf.toString(), expected);
+    }
+  }
+}
+
+// TextEncoder.encodeInto() reports the characters read and bytes written.
+{
+  const encoder = new TextEncoder();
+  const target = new Uint8Array(10);
+  assert.deepStrictEqual(encoder.encodeInto('abcdefghijkl', target),
+                         { read: 10, written: 10 });
+  assert.deepStrictEqual(encoder.encodeInto('aéééééé', target),
+                         { read: 5, written: 9 });
+  assert.deepStrictEqual(encoder.encodeInto('a🌍🌍🌍', target),
+                         { read: 5, written: 9 });
+}
+
+if (common.hasIntl) {
+  const decoder = new TextDecoder();
+  const fatal = new TextDecoder('utf-8', { fatal: true });
+  const large = Buffer.from('Käse '.repeat(kLarge / 6));
+
+  assert.strictEqual(decoder.decode(large), large.toString());
+  assert.strictEqual(
+    decoder.decode(Buffer.concat([Buffer.from([0xef, 0xbb, 0xbf]), large])),
+    large.toString());
+  assert.strictEqual(
+    new TextDecoder('utf-8', { ignoreBOM: true }).decode(
+      Buffer.from([0xef, 0xbb, 0xbf, 0x61])),
+    '\ufeffa');
+  assert.strictEqual(decoder.decode(Buffer.from([0xef, 0xbb, 0xbf])), '');
+  assert.strictEqual(decoder.decode(new Uint8Array(0)), '');
+
+  assert.throws(() => fatal.decode(Buffer.from([0x61, 0xc0, 0x80])), {
+    code: 'ERR_ENCODING_INVALID_ENCODED_DATA'
+  });
+  assert.strictEqual(decoder.decode(Buffer.from([0x61, 0xc0, 0x80])),
+                     'a\ufffd\ufffd');
+
+  // A character split across calls in streaming mode, and a BOM that only
+  // counts at the start of the stream.
+  const euro = Buffer.from('€');
+  assert.strictEqual(decoder.decode(euro.slice(0, 1), { stream: true }), '');
+  assert.strictEqual(decoder.decode(euro.slice(1), { stream: true }), '€');
+  assert.strictEqual(
+    decoder.decode(Buffer.from([0xef, 0xbb, 0xbf, 0x61]), { stream: true }),
+    '\ufeffa');
+  assert.strictEqual(decoder.decode(), '');
+  assert.strictEqual(
+    decoder.decode(Buffer.from([0xef, 0xbb, 0xbf, 0x61]), { stream: true }),
+    'a');
+  assert.strictEqual(decoder.decode(large), large.toString());
+}
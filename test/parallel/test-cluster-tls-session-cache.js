@@ -0,0 +1,89 @@
+'use strict';
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+if (common.isWindows)
+  common.skip('shared TLS session caches are not supported on Windows');
+
+// A session created by one cluster worker can be resumed by another when both
+// use the session cache that the master shares with them, with session IDs as
+// well as with session tickets.
+
+const assert = require('assert');
+const cluster = require('cluster');
+const tls = require('tls');
+const { SSL_OP_NO_TICKET } = require('crypto').constants;
+const fixtures = require('../common/fixtures');
+
+if (cluster.isWorker) {
+  const server = tls.createServer({
+    key: fixtures.readKey('agent1-key.pem'),
+    cert: fixtures.readKey('agent1-cert.pem'),
+    sharedSessionCache: true
+  }, (socket) => {
+    // Send data, so that the client gets the TLSv1.3 tickets before the
+    // close_notify.
+    socket.end('x');
+  });
+  server.listen({ port: 0, exclusive: true }, () => {
+    process.send({ port: server.address().port });
+  });
+  return;
+}
+
+assert.strictEqual(tls.getSharedSessionCacheStats(), undefined);
+assert.throws(() => tls.createServer({ sharedSessionCache: 1 }),
+              { code: 'ERR_INVALID_ARG_TYPE' });
+
+const cases = [
+  { maxVersion: 'TLSv1.2', secureOptions: SSL_OP_NO_TICKET },
+  { maxVersion: 'TLSv1.2' },
+  { maxVersion: 'TLSv1.3' },
+];
+
+function connect(port, options, session, callback) {
+  let newSession;
+  const socket = tls.connect({
+    port,
+    session,
+    rejectUnauthorized: false,
+    ...options
+  }, common.mustCall(() => {
+    assert.strictEqual(socket.isSessionReused(), session !== undefined);
+  }));
+  socket.once('session', (sess) => newSession = sess);
+  socket.resume();
+  socket.on('close', common.mustCall(() => callback(newSession)));
+}
+
+function run(ports, i = 0) {
+  if (i === cases.length) {
+    const stats = tls.getSharedSessionCacheStats();
+    assert.strictEqual(stats.handshakes, 2 * cases.length);
+    assert.strictEqual(stats.resumed, cases.length);
+    assert(stats.stores >= 1);
+    assert(stats.hits >= 1);
+    assert(stats.lookups >= stats.hits);
+    assert.strictEqual(stats.evictions, 0);
+    cluster.disconnect();
+    return;
+  }
+
+  connect(ports[0], cases[i], undefined, common.mustCall((session) => {
+    assert(session);
+    connect(ports[1], cases[i], session, common.mustCall(() => {
+      run(ports, i + 1);
+    }));
+  }));
+}
+
+cluster.setupMaster({ tlsSessionCacheSize: 64 });
+
+const ports = [];
+for (let i = 0; i < 2; i++) {
+  cluster.fork().on('message', common.mustCall(({ port }) => {
+    ports.push(port);
+    if (ports.length === 2)
+      run(ports);
+  }));
+}
@@ -0,0 +1,75 @@
+'use strict';
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+// Hash, Hmac and cipher objects reuse the OpenSSL contexts of objects that
+// are done with them. Results must not depend on what a context was used
+// for before.
+
+const assert = require('assert');
+const crypto = require('crypto');
+
+const key = Buffer.alloc(32, 1);
+const iv = Buffer.alloc(16, 2);
+const data = 'hello world';
+
+function digests() {
+  return [
+    crypto.createHash('sha256').update(data).digest('hex'),
+    crypto.createHash('md5').update(data).digest('hex'),
+    crypto.createHmac('sha256', key).update(data).digest('hex'),
+    crypto.createHmac('sha1', 'other key').update(data).digest('hex'),
+  ];
+}
+
+function ciphertexts() {
+  const gcm = crypto.createCipheriv('aes-256-gcm', key, iv.slice(0, 12));
+  const gcmText = Buffer.concat([gcm.update(data), gcm.final()]);
+  const cbc = crypto.createCipheriv('aes-128-cbc', key.slice(0, 16), iv);
+  const cbcText = Buffer.concat([cbc.update(data), cbc.final()]);
+  // Key wrap ciphers need a flag on the context, which must not leak into
+  // other ciphers that reuse it.
+  const wrap = crypto.createCipheriv('id-aes128-wrap', key.slice(0, 16),
+                                     Buffer.from('A6A6A6A6A6A6A6A6', 'hex'));
+  const wrapText = Buffer.concat([wrap.update(key), wrap.final()]);
+  return [gcmText.toString('hex'), gcm.getAuthTag().toString('hex'),
+          cbcText.toString('hex'), wrapText.toString('hex')];
+}
+
+const expectedDigests = digests();
+const expectedCiphertexts = ciphertexts();
+for (let i = 0; i < 100; i++) {
+  assert.deepStrictEqual(digests(), expectedDigests);
+  assert.deepStrictEqual(ciphertexts(), expectedCiphertexts);
+}
+
+{
+  // A copy of a keyed Hmac object computes the same HMACs as the original.
+  const keyed = crypto.createHmac('sha256', key);
+  for (const message of ['one', 'two', 'three']) {
+    assert.strictEqual(
+      keyed.copy().update(message).digest('hex'),
+      crypto.createHmac('sha256', key).update(message).digest('hex'));
+  }
+
+  keyed.update('one');
+  const copy = keyed.copy();
+  keyed.update('two');
+  copy.update('two');
+  assert.strictEqual(copy.digest('hex'), keyed.copy().digest('hex'));
+
+  keyed.digest();
+  assert.throws(() => keyed.copy(), { code: 'ERR_CRYPTO_HASH_FINALIZED' });
+}
+
+{
+  // Once a Hash stream has ended, its state is gone.
+  const hash = crypto.createHash('sha256');
+  hash.on('finish', common.mustCall(() => {
+    assert.throws(() => hash.copy(), { code: 'ERR_CRYPTO_HASH_FINALIZED' });
+    assert.strictEqual(hash.digest('hex'),
+                       crypto.createHash('sha256').update(data).digest('hex'));
+  }));
+  hash.end(data);
+}
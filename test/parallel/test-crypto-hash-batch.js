@@ -0,0 +1,93 @@
+'use strict';
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+const assert = require('assert');
+const crypto = require('crypto');
+
+function expected(algorithm, inputs, encoding = 'buffer') {
+  return inputs.map((input) => {
+    return crypto.createHash(algorithm).update(input).digest(encoding);
+  });
+}
+
+const inputs = [
+  '',
+  'abc',
+  'ünïcödé',
+  Buffer.alloc(1000, 'x'),
+  new Uint8Array([1, 2, 3]),
+  new DataView(new ArrayBuffer(8)),
+];
+
+for (const algorithm of ['sha256', 'md5', 'sha512', 'sha3-256']) {
+  assert.deepStrictEqual(crypto.hashBatch(algorithm, inputs),
+                         expected(algorithm, inputs));
+  for (const outputEncoding of ['hex', 'base64', 'latin1']) {
+    assert.deepStrictEqual(
+      crypto.hashBatch(algorithm, inputs, { outputEncoding }),
+      expected(algorithm, inputs, outputEncoding));
+  }
+  crypto.hashBatch(algorithm, inputs, common.mustCall((err, digests) => {
+    assert.ifError(err);
+    assert.deepStrictEqual(digests, expected(algorithm, inputs));
+  }));
+}
+
+assert.deepStrictEqual(crypto.hashBatch('sha256', []), []);
+crypto.hashBatch('sha256', [], common.mustCall((err, digests) => {
+  assert.ifError(err);
+  assert.deepStrictEqual(digests, []);
+}));
+
+// Batches that are split into several threadpool requests keep their order.
+{
+  const many = [];
+  for (let i = 0; i < 5000; i++)
+    many.push(`${i}`);
+  crypto.hashBatch('sha1', many, { outputEncoding: 'hex' },
+                   common.mustCall((err, digests) => {
+                     assert.ifError(err);
+                     assert.deepStrictEqual(digests,
+                                            expected('sha1', many, 'hex'));
+                   }));
+}
+
+assert.throws(() => crypto.hashBatch('nope', ['a']),
+              { code: 'ERR_CRYPTO_INVALID_DIGEST' });
+assert.throws(() => crypto.hashBatch('nope', ['a'], common.mustNotCall()),
+              { code: 'ERR_CRYPTO_INVALID_DIGEST' });
+assert.throws(() => crypto.hashBatch(1, ['a']),
+              { code: 'ERR_INVALID_ARG_TYPE' });
+assert.throws(() => crypto.hashBatch('sha256', 'a'),
+              { code: 'ERR_INVALID_ARG_TYPE' });
+assert.throws(() => crypto.hashBatch('sha256', ['a', 1]),
+              { code: 'ERR_INVALID_ARG_TYPE', message: /buffers\[1\]/ });
+assert.throws(() => crypto.hashBatch('sha256', ['a'], null),
+              { code: 'ERR_INVALID_ARG_TYPE' });
+assert.throws(() => crypto.hashBatch('sha256', ['a'],
+                                     { outputEncoding: 'nope' }),
+              { code: 'ERR_INVALID_OPT_VALUE' });
+assert.throws(() => crypto.hashBatch('sha256', ['a'], {}, 'nope'),
+              { code: 'ERR_INVALID_CALLBACK' });
+
+// Each element is read once. An element that changes after it was validated
+// does not reach the native side.
+{
+  const changing = () => {
+    const buffers = [Buffer.from('abc')];
+    let reads = 0;
+    Object.defineProperty(buffers, 1, {
+      enumerable: true,
+      get: common.mustCall(() => (reads++ === 0 ? Buffer.from('def') : 1))
+    });
+    return buffers;
+  };
+  assert.deepStrictEqual(crypto.hashBatch('sha256', changing()),
+                         expected('sha256', ['abc', 'def']));
+  crypto.hashBatch('sha256', changing(), common.mustCall((err, digests) => {
+    assert.ifError(err);
+    assert.deepStrictEqual(digests, expected('sha256', ['abc', 'def']));
+  }));
+}
@@ -0,0 +1,91 @@
+'use strict';
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+// Cipher, Decipher, Hash and Hmac streams created with the `offload` option
+// process their chunks on the threadpool, with the same results as without.
+
+const assert = require('assert');
+const crypto = require('crypto');
+const { monitorThreadpool } = require('perf_hooks');
+
+const monitor = monitorThreadpool();
+monitor.enable();
+
+const chunks = [];
+for (let i = 0; i < 8; i++)
+  chunks.push(crypto.randomBytes(64 * 1024 + i));
+const input = Buffer.concat(chunks);
+const key = crypto.randomBytes(32);
+const iv = crypto.randomBytes(12);
+
+function collect(stream, chunks, callback) {
+  const output = [];
+  stream.on('data', (chunk) => output.push(chunk));
+  stream.on('end', common.mustCall(() => callback(Buffer.concat(output))));
+  for (const chunk of chunks)
+    stream.write(chunk);
+  stream.end();
+}
+
+{
+  const expected = crypto.createCipheriv('aes-256-gcm', key, iv);
+  const ciphertext = Buffer.concat([expected.update(input), expected.final()]);
+  const tag = expected.getAuthTag();
+
+  const cipher = crypto.createCipheriv('aes-256-gcm', key, iv,
+                                       { offload: true });
+  collect(cipher, chunks, common.mustCall((output) => {
+    assert.deepStrictEqual(output, ciphertext);
+    assert.deepStrictEqual(cipher.getAuthTag(), tag);
+
+    const decipher = crypto.createDecipheriv('aes-256-gcm', key, iv,
+                                             { offload: true });
+    decipher.setAuthTag(tag);
+    collect(decipher, [output], common.mustCall((plaintext) => {
+      assert.deepStrictEqual(plaintext, input);
+      assert(monitor.crypto.run.count >= chunks.length + 1);
+    }));
+  }));
+
+  // The cipher context can't be used while a chunk is being processed.
+  assert.throws(() => cipher.update('x'), {
+    code: 'ERR_CRYPTO_INVALID_STATE'
+  });
+}
+
+{
+  const hash = crypto.createHash('sha256', { offload: true });
+  collect(hash, chunks, common.mustCall((digest) => {
+    assert.strictEqual(digest.toString('hex'),
+                       crypto.createHash('sha256').update(input).digest('hex'));
+  }));
+  assert.throws(() => hash.digest(), { code: 'ERR_CRYPTO_INVALID_STATE' });
+
+  const hmac = crypto.createHmac('sha256', key, { offload: true });
+  collect(hmac, chunks, common.mustCall((digest) => {
+    assert.deepStrictEqual(digest,
+                           crypto.createHmac('sha256', key).update(input)
+                             .digest());
+  }));
+}
+
+// Decryption errors are reported through the stream.
+{
+  const decipher = crypto.createDecipheriv('aes-256-cbc', key, iv.slice(0, 16),
+                                           { offload: true });
+  decipher.on('error', common.mustCall((err) => {
+    assert(/bad decrypt/.test(err.message), err.message);
+  }));
+  decipher.end(Buffer.alloc(32));
+  decipher.resume();
+}
+
+for (const create of [
+  () => crypto.createCipheriv('aes-256-gcm', key, iv, { offload: 1 }),
+  () => crypto.createHash('sha256', { offload: 'yes' }),
+  () => crypto.createHmac('sha256', key, { offload: null }),
+]) {
+  assert.throws(create, { code: 'ERR_INVALID_ARG_TYPE' });
+}
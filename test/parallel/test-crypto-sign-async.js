@@ -0,0 +1,120 @@
+'use strict';
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+// crypto.sign(), crypto.verify() and crypto.signBatch() with a callback run
+// on the threadpool and give the same results as the synchronous versions.
+
+const assert = require('assert');
+const crypto = require('crypto');
+const fixtures = require('../common/fixtures');
+
+const rsaKey = fixtures.readKey('rsa_private.pem');
+const ecKey = crypto.generateKeyPairSync('ec', { namedCurve: 'P-256' });
+const ed25519Key = fixtures.readKey('ed25519_private.pem');
+const data = Buffer.from('Hello world');
+
+const cases = [
+  { algorithm: 'sha256', key: rsaKey, deterministic: true },
+  { algorithm: 'sha256', key: { key: rsaKey,
+                                padding: crypto.constants.RSA_PKCS1_PSS_PADDING,
+                                saltLength: 32 } },
+  { algorithm: 'sha384', key: ecKey.privateKey },
+  { algorithm: 'sha384', key: { key: ecKey.privateKey,
+                                dsaEncoding: 'ieee-p1363' } },
+  { algorithm: null, key: ed25519Key, deterministic: true },
+];
+
+for (const { algorithm, key, deterministic } of cases) {
+  crypto.sign(algorithm, data, key, common.mustCall((err, signature) => {
+    assert.ifError(err);
+    assert(Buffer.isBuffer(signature));
+    assert(crypto.verify(algorithm, data, key, signature));
+    if (deterministic)
+      assert.deepStrictEqual(signature, crypto.sign(algorithm, data, key));
+
+    crypto.verify(algorithm, data, key, signature,
+                  common.mustCall((err, result) => {
+                    assert.ifError(err);
+                    assert.strictEqual(result, true);
+                  }));
+    crypto.verify(algorithm, Buffer.from('Hello moon'), key, signature,
+                  common.mustCall((err, result) => {
+                    assert.ifError(err);
+                    assert.strictEqual(result, false);
+                  }));
+  }));
+
+  // Batches larger than one threadpool request are split among several.
+  const messages = [];
+  for (let i = 0; i < 150; i++)
+    messages.push(Buffer.from(`message ${i}`));
+  const check = (signatures) => {
+    assert.strictEqual(signatures.length, messages.length);
+    for (let i = 0; i < messages.length; i++)
+      assert(crypto.verify(algorithm, messages[i], key, signatures[i]));
+  };
+  check(crypto.signBatch(algorithm, messages, key));
+  crypto.signBatch(algorithm, messages, key,
+                   common.mustCall((err, signatures) => {
+                     assert.ifError(err);
+                     check(signatures);
+                   }));
+}
+
+// Signatures in small on-heap typed arrays, whose contents are not in a
+// buffer of their own, stay valid until the verification runs.
+{
+  const signature = new Uint8Array(64);
+  signature.set(crypto.sign(null, data, ed25519Key));
+  crypto.verify(null, data, ed25519Key, signature,
+                common.mustCall((err, result) => {
+                  assert.ifError(err);
+                  assert.strictEqual(result, true);
+                }));
+  const tampered = new Uint8Array(64);
+  tampered.set(signature);
+  tampered[0] ^= 1;
+  crypto.verify(null, data, ed25519Key, tampered,
+                common.mustCall((err, result) => {
+                  assert.ifError(err);
+                  assert.strictEqual(result, false);
+                }));
+  // Reuse the stack of the calls above before the threadpool gets to them.
+  for (let i = 0; i < 8; i++)
+    crypto.verify(null, data, ed25519Key, signature);
+}
+
+crypto.signBatch('sha256', [], rsaKey, common.mustCall((err, signatures) => {
+  assert.ifError(err);
+  assert.deepStrictEqual(signatures, []);
+}));
+
+// Errors that occur while signing are passed to the callback.
+crypto.sign('sha256', data, {
+  key: rsaKey,
+  padding: crypto.constants.RSA_PKCS1_PSS_PADDING,
+  saltLength: 1024
+}, common.mustCall((err, signature) => {
+  assert(err instanceof Error);
+  assert.strictEqual(signature, undefined);
+}));
+
+// Invalid arguments are reported synchronously.
+assert.throws(() => crypto.sign('sha256', data, rsaKey, 'cb'),
+              { code: 'ERR_INVALID_CALLBACK' });
+assert.throws(() => crypto.verify('sha256', data, rsaKey, data, 'cb'),
+              { code: 'ERR_INVALID_CALLBACK' });
+assert.throws(() => crypto.signBatch('sha256', data, rsaKey),
+              { code: 'ERR_INVALID_ARG_TYPE' });
+assert.throws(() => crypto.signBatch('sha256', [data, 'a'], rsaKey),
+              { code: 'ERR_INVALID_ARG_TYPE', message: /messages\[1\]/ });
+assert.throws(() => crypto.signBatch('sha256', [data]),
+              { code: 'ERR_CRYPTO_SIGN_KEY_REQUIRED' });
+assert.throws(() => crypto.sign('nope', data, rsaKey, common.mustNotCall()),
+              { message: 'Unknown message digest' });
+assert.throws(() => crypto.verify('sha256', data, {
+  key: ecKey.publicKey,
+  dsaEncoding: 'ieee-p1363'
+}, Buffer.alloc(3), common.mustNotCall()), { message: 'Malformed signature' });
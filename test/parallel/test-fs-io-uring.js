@@ -0,0 +1,99 @@
+'use strict';
+
+// Exercise the fs operations that UV_USE_IO_URING=1 routes through io_uring
+// on Linux. On kernels without io_uring support, and on other platforms, the
+// same calls fall back to the threadpool and must behave identically.
+
+const common = require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+const { spawnSync } = require('child_process');
+const tmpdir = require('../common/tmpdir');
+
+if (process.argv[2] !== 'child') {
+  const child = spawnSync(process.execPath, [__filename, 'child'], {
+    env: { ...process.env, UV_USE_IO_URING: '1' },
+    stdio: 'inherit'
+  });
+  assert.strictEqual(child.signal, null);
+  assert.strictEqual(child.status, 0);
+  return;
+}
+
+tmpdir.refresh();
+
+const filename = path.join(tmpdir.path, 'io-uring.txt');
+const fd = fs.openSync(filename, 'w+');
+const data = Buffer.from('hello io_uring');
+
+fs.write(fd, data, 0, data.length, 0, common.mustCall((err, written) => {
+  assert.ifError(err);
+  assert.strictEqual(written, data.length);
+
+  fs.stat(filename, common.mustCall((err, stats) => {
+    assert.ifError(err);
+    assert.strictEqual(stats.size, data.length);
+  }));
+
+  fs.lstat(tmpdir.path, common.mustCall((err, stats) => {
+    assert.ifError(err);
+    assert(stats.isDirectory());
+  }));
+
+  fs.fsync(fd, common.mustCall((err) => {
+    assert.ifError(err);
+    fs.fdatasync(fd, common.mustCall((err) => {
+      assert.ifError(err);
+      fs.fstat(fd, common.mustCall((err, stats) => {
+        assert.ifError(err);
+        assert.strictEqual(stats.size, data.length);
+        assert(stats.isFile());
+        readBack();
+      }));
+    }));
+  }));
+}));
+
+// Reads at an explicit position and at the current file position.
+function readBack() {
+  const buffer = Buffer.alloc(data.length);
+  fs.read(fd, buffer, 0, 8, 6, common.mustCall((err, bytesRead) => {
+    assert.ifError(err);
+    assert.strictEqual(bytesRead, 8);
+    assert.strictEqual(buffer.toString('latin1', 0, 8), 'io_uring');
+
+    fs.read(fd, buffer, 0, buffer.length, -1, common.mustCall((err, n) => {
+      assert.ifError(err);
+      assert.strictEqual(n, data.length);
+      assert.deepStrictEqual(buffer, data);
+      fs.closeSync(fd);
+    }));
+  }));
+}
+
+// Errors are reported the same way as on the threadpool.
+fs.stat(path.join(tmpdir.path, 'does-not-exist'), common.mustCall((err) => {
+  assert.strictEqual(err.code, 'ENOENT');
+  assert.strictEqual(err.syscall, 'stat');
+}));
+
+// Many concurrent operations, more than fit in the submission queue at once.
+const many = Buffer.alloc(1024, 'x');
+fs.writeFileSync(filename + '.many', many);
+const manyFd = fs.openSync(filename + '.many', 'r');
+let pending = 1000;
+for (let i = 0; i < 1000; i++) {
+  fs.read(manyFd, Buffer.alloc(1), 0, 1, i, common.mustCall((err, n, buf) => {
+    assert.ifError(err);
+    assert.strictEqual(n, 1);
+    assert.strictEqual(buf[0], 0x78);
+    if (--pending === 0)
+      fs.closeSync(manyFd);
+  }));
+}
+
+// The promises API goes through the same code paths.
+fs.promises.readFile(__filename).then(common.mustCall((contents) => {
+  assert.deepStrictEqual(contents, fs.readFileSync(__filename));
+}));
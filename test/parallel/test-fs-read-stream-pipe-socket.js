@@ -0,0 +1,183 @@
+// Flags: --expose-internals
+'use strict';
+
+// Piping a file into a plaintext TCP socket sends it with sendfile(), which
+// must be indistinguishable from the regular pipe() path, including when the
+// receiver is slow and the socket's send buffer fills up.
+
+const common = require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const net = require('net');
+const path = require('path');
+const tmpdir = require('../common/tmpdir');
+const { kSendFileBytes } = require('internal/fs/streams');
+
+tmpdir.refresh();
+
+const filename = path.join(tmpdir.path, 'pipe-socket.bin');
+const data = Buffer.alloc(3 * 1024 * 1024);
+for (let i = 0; i < data.length; i++)
+  data[i] = i % 251;
+fs.writeFileSync(filename, data);
+
+function test(options, expected, slow) {
+  const server = net.createServer(common.mustCall((socket) => {
+    const stream = fs.createReadStream(filename, options);
+    stream.on('end', common.mustCall());
+    stream.on('close', common.mustCall(() => {
+      assert.strictEqual(stream.bytesRead, expected.length);
+      assert.strictEqual(stream[kSendFileBytes], expected.length);
+      assert.strictEqual(socket.bytesWritten, expected.length);
+    }));
+    assert.strictEqual(stream.pipe(socket), socket);
+  }));
+
+  server.listen(0, common.mustCall(() => {
+    const client = net.connect(server.address().port);
+    const chunks = [];
+    client.on('data', (chunk) => {
+      chunks.push(chunk);
+      if (slow) {
+        client.pause();
+        setTimeout(() => client.resume(), 1);
+      }
+    });
+    client.on('end', common.mustCall(() => {
+      assert.deepStrictEqual(Buffer.concat(chunks), expected);
+      server.close();
+    }));
+  }));
+}
+
+test(undefined, data, false);
+test({ start: 1000, end: 1024 * 1024 }, data.slice(1000, 1024 * 1024 + 1),
+     false);
+test({ highWaterMark: 1024 }, data, true);
+
+// A socket that goes away in the middle of the transfer closes the file.
+{
+  const server = net.createServer(common.mustCall((socket) => {
+    const stream = fs.createReadStream(filename);
+    stream.on('close', common.mustCall(() => server.close()));
+    socket.on('error', () => {});
+    stream.pipe(socket);
+  }));
+
+  server.listen(0, common.mustCall(() => {
+    const client = net.connect(server.address().port);
+    client.once('data', common.mustCall(() => client.destroy()));
+  }));
+}
+
+// Streams that are already being consumed keep using Readable#pipe().
+{
+  const server = net.createServer(common.mustCall((socket) => {
+    const stream = fs.createReadStream(filename);
+    let received = 0;
+    stream.on('data', (chunk) => received += chunk.length);
+    stream.on('end', common.mustCall(() => {
+      assert.strictEqual(received, data.length);
+      assert.strictEqual(stream[kSendFileBytes], 0);
+    }));
+    stream.pipe(socket);
+  }));
+
+  server.listen(0, common.mustCall(() => {
+    const client = net.connect(server.address().port);
+    let received = 0;
+    client.on('data', (chunk) => received += chunk.length);
+    client.on('end', common.mustCall(() => {
+      assert.strictEqual(received, data.length);
+      server.close();
+    }));
+  }));
+}
+
+// The remaining tests open the file upfront, so that the first chunk is
+// already being sent when pipe() returns.
+function connect(server, callback) {
+  server.listen(0, common.mustCall(() => {
+    const client = net.connect(server.address().port);
+    const chunks = [];
+    client.on('data', (chunk) => chunks.push(chunk));
+    client.on('end', common.mustCall(() => {
+      callback(Buffer.concat(chunks));
+      server.close();
+    }));
+  }));
+}
+
+// Writes to the socket wait until the file has been sent.
+{
+  const server = net.createServer(common.mustCall((socket) => {
+    const stream = fs.createReadStream(null, {
+      fd: fs.openSync(filename, 'r'),
+      start: 0
+    });
+    stream.pipe(socket);
+    socket.write('tail');
+    stream.on('close', common.mustCall(() => {
+      assert.strictEqual(stream[kSendFileBytes], data.length);
+    }));
+  }));
+
+  connect(server, common.mustCall((received) => {
+    assert.deepStrictEqual(received,
+                           Buffer.concat([data, Buffer.from('tail')]));
+  }));
+}
+
+// unpipe() stops the transfer once the current chunk has been sent, after
+// which the socket can be used again.
+{
+  let sent;
+  const server = net.createServer(common.mustCall((socket) => {
+    const stream = fs.createReadStream(null, {
+      fd: fs.openSync(filename, 'r'),
+      start: 0
+    });
+    socket.on('unpipe', common.mustCall((src) => {
+      assert.strictEqual(src, stream);
+      sent = stream.bytesRead;
+      assert(sent < data.length);
+      assert.strictEqual(stream[kSendFileBytes], sent);
+      assert.strictEqual(socket.bytesWritten, sent);
+      stream.destroy();
+      socket.end('tail');
+    }));
+    stream.pipe(socket);
+    stream.unpipe(socket);
+  }));
+
+  connect(server, common.mustCall((received) => {
+    assert.deepStrictEqual(received,
+                           Buffer.concat([data.slice(0, sent),
+                                          Buffer.from('tail')]));
+  }));
+}
+
+// pause() stops the transfer once the current chunk has been sent, and
+// resume() continues it with sendfile().
+{
+  const server = net.createServer(common.mustCall((socket) => {
+    const stream = fs.createReadStream(null, {
+      fd: fs.openSync(filename, 'r'),
+      start: 0
+    });
+    stream.pipe(socket);
+    stream.pause();
+    setTimeout(common.mustCall(() => {
+      assert(stream.bytesRead < data.length);
+      stream.resume();
+    }), common.platformTimeout(50));
+    stream.on('close', common.mustCall(() => {
+      assert.strictEqual(stream.bytesRead, data.length);
+      assert.strictEqual(stream[kSendFileBytes], data.length);
+    }));
+  }));
+
+  connect(server, common.mustCall((received) => {
+    assert.deepStrictEqual(received, data);
+  }));
+}
@@ -0,0 +1,57 @@
+'use strict';
+
+// The HTTP parser hands out cached strings for common header names and
+// values. Check that rawHeaders still reports them exactly as they were sent,
+// whatever their case, and also when they arrive split across reads.
+
+const common = require('../common');
+const assert = require('assert');
+const http = require('http');
+const net = require('net');
+
+const rawHeaders = [
+  'Host', 'localhost',
+  'content-type', 'text/plain',
+  'CONTENT-LENGTH', '0',
+  'Accept-encoding', 'gzip, deflate, br',
+  'accept', '*/*  ',
+  'Connection', 'Keep-Alive',
+  'Etag', 'keep-alive',
+  'X-Forwarded-For', '127.0.0.1',
+  'user-agentx', 'close',
+  'User-Agen', 'chunked '
+];
+
+const expected = rawHeaders.map((str) => str.trim());
+
+const server = http.createServer(common.mustCall((req, res) => {
+  assert.deepStrictEqual(req.rawHeaders, expected);
+  assert.strictEqual(req.headers['content-type'], 'text/plain');
+  assert.strictEqual(req.headers['content-length'], '0');
+  assert.strictEqual(req.headers.connection, 'Keep-Alive');
+  assert.strictEqual(req.headers.etag, 'keep-alive');
+  assert.strictEqual(req.headers['user-agentx'], 'close');
+  res.end();
+}, 2));
+
+server.listen(0, common.mustCall(() => {
+  let request = 'GET / HTTP/1.1\r\n';
+  for (let i = 0; i < rawHeaders.length; i += 2)
+    request += `${rawHeaders[i]}: ${rawHeaders[i + 1]}\r\n`;
+  request += '\r\n';
+
+  const socket = net.connect(server.address().port);
+  // Once in one piece, then one byte at a time.
+  socket.write(request);
+  for (const c of request)
+    socket.write(c);
+  socket.end();
+
+  let responses = '';
+  socket.setEncoding('latin1');
+  socket.on('data', (data) => responses += data);
+  socket.on('end', common.mustCall(() => {
+    assert.strictEqual(responses.match(/HTTP\/1\.1 200 OK/g).length, 2);
+    server.close();
+  }));
+}));
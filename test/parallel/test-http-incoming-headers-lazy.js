@@ -0,0 +1,170 @@
+'use strict';
+
+// IncomingMessage#headers and #trailers are built from rawHeaders and
+// rawTrailers when they are first accessed. The parsers of http pass the
+// headers of a message as one string, which rawHeaders splits on first access.
+
+const common = require('../common');
+const assert = require('assert');
+const http = require('http');
+const net = require('net');
+
+const raw = [
+  'Host', 'example.com',
+  'X-Foo', '1',
+  'x-foo', '2',
+  'Set-Cookie', 'a=1',
+  'set-cookie', 'b=2',
+  'Host', 'ignored.example.com'
+];
+
+{
+  const message = new http.IncomingMessage();
+  assert.deepStrictEqual(message.headers, {});
+  assert.deepStrictEqual(message.trailers, {});
+}
+
+{
+  const message = new http.IncomingMessage();
+  message._addHeaderLines(raw, raw.length);
+  assert.strictEqual(message.rawHeaders, raw);
+  assert.deepStrictEqual(message.headers, {
+    'host': 'example.com',
+    'x-foo': '1, 2',
+    'set-cookie': ['a=1', 'b=2']
+  });
+  assert.strictEqual(message.headers, message.headers);
+
+  // Once built, `headers` is added to rather than replaced.
+  message._addHeaderLines(['X-Foo', '3'], 2);
+  assert.strictEqual(message.headers['x-foo'], '1, 2, 3');
+
+  message.complete = true;
+  message._addHeaderLines(['Content-MD5', 'abc'], 2);
+  assert.deepStrictEqual(message.rawTrailers, ['Content-MD5', 'abc']);
+  assert.deepStrictEqual(message.trailers, { 'content-md5': 'abc' });
+}
+
+// Only the first `n` entries count, as limited by maxHeadersCount.
+{
+  const message = new http.IncomingMessage();
+  message._addHeaderLines(raw, 4);
+  assert.deepStrictEqual(message.headers, {
+    'host': 'example.com',
+    'x-foo': '1'
+  });
+}
+
+// Header blocks: names and values joined by '\n'.
+{
+  const message = new http.IncomingMessage();
+  message._addHeaderLines(raw.join('\n'), Infinity);
+  assert.deepStrictEqual(message.rawHeaders, raw);
+  assert.strictEqual(message.rawHeaders, message.rawHeaders);
+  assert.deepStrictEqual(message.headers, {
+    'host': 'example.com',
+    'x-foo': '1, 2',
+    'set-cookie': ['a=1', 'b=2']
+  });
+}
+
+{
+  const message = new http.IncomingMessage();
+  message._addHeaderLines('X-Empty\n\nHost\nexample.com', 2);
+  assert.deepStrictEqual(message.rawHeaders,
+                         ['X-Empty', '', 'Host', 'example.com']);
+  assert.deepStrictEqual(message.headers, { 'x-empty': '' });
+}
+
+{
+  const { HTTPParser } = require('_http_common');
+  const parser = new HTTPParser();
+  parser.initialize(HTTPParser.REQUEST, {}, 0, false, true);
+  parser[HTTPParser.kOnHeadersComplete] = common.mustCall((major, minor,
+                                                           headers) => {
+    assert.strictEqual(headers,
+                       'Host\nexample.com\nX-Empty\n\nX-Trimmed\nvalue');
+  });
+  const request = Buffer.from('GET / HTTP/1.1\r\n' +
+                              'Host: example.com\r\n' +
+                              'X-Empty:\r\n' +
+                              'X-Trimmed: value  \r\n\r\n');
+  parser.execute(request, 0, request.length);
+}
+
+// Headers that all have cached strings are passed as an array of those.
+{
+  const { HTTPParser } = require('_http_common');
+  const parser = new HTTPParser();
+  parser.initialize(HTTPParser.REQUEST, {}, 0, false, true);
+  parser[HTTPParser.kOnHeadersComplete] = common.mustCall((major, minor,
+                                                           headers) => {
+    assert.deepStrictEqual(headers, ['Accept', '*/*', 'connection', 'close']);
+  });
+  const request = Buffer.from('GET / HTTP/1.1\r\n' +
+                              'Accept: */*\r\n' +
+                              'connection: close\r\n\r\n');
+  parser.execute(request, 0, request.length);
+}
+
+// getJoinedHeader() matches whole names in any case, in header blocks and in
+// arrays, and only looks at the first `n` entries.
+{
+  const { getJoinedHeader } = require('_http_incoming');
+  const block = 'Content-Length\n0\nTE\ntrailers\nte\nchunked\nExpect\nfoo';
+  for (const headers of [block, block.split('\n')]) {
+    const message = new http.IncomingMessage();
+    message._addHeaderLines(headers, 6);
+    assert.strictEqual(getJoinedHeader(message, 'te'), 'trailers, chunked');
+    assert.strictEqual(getJoinedHeader(message, 'content-length'), '0');
+    assert.strictEqual(getJoinedHeader(message, 'length'), undefined);
+    assert.strictEqual(getJoinedHeader(message, 'expect'), undefined);
+  }
+}
+
+// `headers` and `trailers` can be assigned to.
+{
+  const message = new http.IncomingMessage();
+  message._addHeaderLines(raw, raw.length);
+  message.headers = { foo: 'bar' };
+  assert.deepStrictEqual(message.headers, { foo: 'bar' });
+  message.trailers = { baz: 'qux' };
+  assert.deepStrictEqual(message.trailers, { baz: 'qux' });
+}
+
+// The server looks for `Expect: 100-continue` without building `headers`,
+// in any case and also when the header is repeated.
+{
+  const server = http.createServer(common.mustNotCall());
+  server.on('checkContinue', common.mustCall((req, res) => {
+    assert.strictEqual(req.headers.expect, '100-continue');
+    res.writeContinue();
+    res.end();
+  }));
+  server.on('checkExpectation', common.mustCall((req, res) => {
+    assert.strictEqual(req.headers.expect, 'foo, bar');
+    res.writeHead(417);
+    res.end();
+  }));
+
+  server.listen(0, common.mustCall(() => {
+    const socket = net.connect(server.address().port);
+    socket.end('POST / HTTP/1.1\r\n' +
+               'Host: localhost\r\n' +
+               'EXPECT: 100-continue\r\n' +
+               'Content-Length: 0\r\n\r\n' +
+               'POST / HTTP/1.1\r\n' +
+               'Host: localhost\r\n' +
+               'expect: foo\r\n' +
+               'Expect: bar\r\n' +
+               'Content-Length: 0\r\n\r\n');
+    let response = '';
+    socket.setEncoding('latin1');
+    socket.on('data', (data) => response += data);
+    socket.on('end', common.mustCall(() => {
+      assert.match(response, /^HTTP\/1\.1 100 Continue\r\n/);
+      assert.match(response, /HTTP\/1\.1 417 Expectation Failed\r\n/);
+      server.close();
+    }));
+  }));
+}
@@ -0,0 +1,86 @@
+'use strict';
+
+// The header block of outgoing messages is serialized in C++. Check that it
+// comes out the same for the different ways of passing headers.
+
+const common = require('../common');
+const assert = require('assert');
+const http = require('http');
+
+const cases = [
+  [(res) => res.writeHead(200),
+   'HTTP/1.1 200 OK\r\n' +
+   'Connection: keep-alive\r\n' +
+   'Transfer-Encoding: chunked\r\n\r\n'],
+  [(res) => {
+    res.setHeader('Content-Type', 'text/plain');
+    res.setHeader('X-Number', 42);
+    res.setHeader('Set-Cookie', ['a=1', 'b=2']);
+    res.writeHead(201, 'Made it', { 'X-Latin1': 'café' });
+  },
+   'HTTP/1.1 201 Made it\r\n' +
+   'Content-Type: text/plain\r\n' +
+   'X-Number: 42\r\n' +
+   'Set-Cookie: a=1\r\n' +
+   'Set-Cookie: b=2\r\n' +
+   'X-Latin1: café\r\n' +
+   'Connection: keep-alive\r\n' +
+   'Transfer-Encoding: chunked\r\n\r\n'],
+  [(res) => res.writeHead(204, [['X-A', '1'], ['x-a', '2'], ['Empty', '']]),
+   'HTTP/1.1 204 No Content\r\n' +
+   'X-A: 1\r\n' +
+   'x-a: 2\r\n' +
+   'Empty: \r\n' +
+   'Connection: keep-alive\r\n\r\n'],
+  [(res) => res.writeHead(200, { 'Content-Length': 0, 'Connection': 'close' }),
+   'HTTP/1.1 200 OK\r\n' +
+   'Content-Length: 0\r\n' +
+   'Connection: close\r\n\r\n'],
+  // Too large to be assembled on the stack.
+  [(res) => res.writeHead(200, { 'X-Large': 'é'.repeat(5000),
+                                 'Content-Length': 0 }),
+   'HTTP/1.1 200 OK\r\n' +
+   `X-Large: ${'é'.repeat(5000)}\r\n` +
+   'Content-Length: 0\r\n' +
+   'Connection: keep-alive\r\n\r\n'],
+];
+
+const server = http.createServer(common.mustCall((req, res) => {
+  const [write, expected] = cases[req.url.slice(1)];
+  res.sendDate = false;
+  write(res);
+  assert.strictEqual(res._header, expected);
+  res.end();
+}, cases.length));
+
+server.listen(0, common.mustCall(() => {
+  const agent = new http.Agent({ keepAlive: true });
+  let pending = cases.length;
+  for (let i = 0; i < cases.length; i++) {
+    http.get({ port: server.address().port, path: `/${i}`, agent },
+             common.mustCall((res) => {
+               res.resume();
+               res.on('end', () => {
+                 if (--pending === 0) {
+                   agent.destroy();
+                   server.close();
+                 }
+               });
+             }));
+  }
+}));
+
+// Invalid headers are still rejected with the same errors.
+{
+  const res = new http.ServerResponse({ method: 'GET', httpVersionMajor: 1,
+                                        httpVersionMinor: 1 });
+  assert.throws(() => res.writeHead(200, { 'X-Bad': 'a\nb' }),
+                { code: 'ERR_INVALID_CHAR' });
+  assert.throws(() => res.writeHead(200, { 'X-Bad': 'x✓' }),
+                { code: 'ERR_INVALID_CHAR' });
+  assert.throws(() => res.writeHead(200, { 'Bad Name': 'x' }),
+                { code: 'ERR_INVALID_HTTP_TOKEN' });
+  assert.throws(() => res.writeHead(200, { 'X-Undefined': undefined }),
+                { code: 'ERR_HTTP_INVALID_HEADER_VALUE' });
+  assert.strictEqual(res._header, null);
+}
@@ -0,0 +1,111 @@
+'use strict';
+
+// Pipelined requests without a body are passed from the parser to JS land in
+// batches. Check that they are still handled in order and in the same way as
+// requests that are not batched: with a body, with headers that do not fit
+// in one go, or split across reads.
+
+const common = require('../common');
+const assert = require('assert');
+const http = require('http');
+const net = require('net');
+const { HTTPParser } = require('_http_common');
+
+const kOnMessages = HTTPParser.kOnMessages | 0;
+
+let manyHeaders = '';
+for (let i = 0; i < 40; i++)
+  manyHeaders += `X-Header-${i}: ${i}\r\n`;
+
+const requests = [
+  ['GET /1 HTTP/1.1\r\nHost: a\r\n\r\n', 'GET', '/1', ''],
+  ['GET /2 HTTP/1.1\r\nHost: b\r\nContent-Length: 0\r\n\r\n', 'GET', '/2', ''],
+  ['POST /3 HTTP/1.1\r\nHost: c\r\nContent-Length: 5\r\n\r\nhello',
+   'POST', '/3', 'hello'],
+  ['DELETE /4 HTTP/1.1\r\nHost: d\r\n\r\n', 'DELETE', '/4', ''],
+  ['PUT /5 HTTP/1.1\r\nHost: e\r\nTransfer-Encoding: chunked\r\n\r\n' +
+   '3\r\nabc\r\n0\r\n\r\n', 'PUT', '/5', 'abc'],
+  [`GET /6 HTTP/1.1\r\nHost: f\r\n${manyHeaders}\r\n`, 'GET', '/6', ''],
+  ['HEAD /7 HTTP/1.1\r\nHost: g\r\n\r\n', 'HEAD', '/7', ''],
+  ['GET /8 HTTP/1.1\r\nHost: h\r\n\r\n', 'GET', '/8', ''],
+];
+
+function test(chunks) {
+  let index = 0;
+  const server = http.createServer(common.mustCall((req, res) => {
+    const [, method, url, body] = requests[index];
+    assert.strictEqual(req.method, method);
+    assert.strictEqual(req.url, url);
+    assert.strictEqual(req.headers.host, String.fromCharCode(97 + index));
+    if (url === '/6')
+      assert.strictEqual(req.headers['x-header-39'], '39');
+    index++;
+
+    let data = '';
+    req.setEncoding('latin1');
+    req.on('data', (chunk) => data += chunk);
+    req.on('end', common.mustCall(() => {
+      assert.strictEqual(req.complete, true);
+      assert.strictEqual(data, body);
+      res.end(url);
+    }));
+  }, requests.length));
+
+  server.listen(0, common.mustCall(() => {
+    const socket = net.connect(server.address().port);
+    for (const chunk of chunks)
+      socket.write(chunk);
+    socket.end();
+
+    let response = '';
+    socket.setEncoding('latin1');
+    socket.on('data', (data) => response += data);
+    socket.on('end', common.mustCall(() => {
+      const bodies = response.match(/\r\n\r\n\/\d/g).map((s) => s.slice(4));
+      assert.deepStrictEqual(bodies, ['/1', '/2', '/3', '/4', '/5', '/6',
+                                      '/8']);
+      server.close();
+    }));
+  }));
+}
+
+const all = requests.map((request) => request[0]).join('');
+// In one read.
+test([all]);
+// In reads of varying size.
+test(all.match(/[^]{1,7}/g));
+
+// Requests that are written in one go reach JS land in fewer kOnMessages
+// calls than there are requests, and in no other way.
+{
+  const kRequests = 16;
+  const batches = [];
+  const server = http.createServer(common.mustCall((req, res) => {
+    res.end(req.url);
+  }, kRequests));
+
+  server.on('connection', common.mustCall((socket) => {
+    const { parser } = socket;
+    const onMessages = parser[kOnMessages];
+    parser[kOnMessages] = function(messages) {
+      batches.push(messages.length / 6);
+      return onMessages.call(this, messages);
+    };
+    // Parsers are reused for other connections.
+    socket.on('close', () => parser[kOnMessages] = onMessages);
+  }));
+
+  server.listen(0, common.mustCall(() => {
+    const socket = net.connect(server.address().port);
+    let request = '';
+    for (let i = 0; i < kRequests; i++)
+      request += `GET /${i} HTTP/1.1\r\nHost: a\r\n\r\n`;
+    socket.end(request);
+    socket.resume();
+    socket.on('end', common.mustCall(() => {
+      assert.strictEqual(batches.reduce((a, b) => a + b, 0), kRequests);
+      assert(batches.length < kRequests, `${batches.length} batches`);
+      server.close();
+    }));
+  }));
+}
@@ -0,0 +1,56 @@
+'use strict';
+
+// Strings for received header names and values are reused for headers that
+// are repeated on a session. Check that headers come out right when they are
+// repeated, when they change from request to request, and when the HPACK
+// dynamic table evicts entries.
+
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+const assert = require('assert');
+const http2 = require('http2');
+
+const kRequests = 200;
+const long = 'x'.repeat(2000);
+
+function makeHeaders(i) {
+  return {
+    ':path': `/${i}`,
+    'x-same': 'always the same value',
+    'x-long': long,
+    'x-varying': `value ${i}`,
+    'x-alternating': i % 2 ? 'odd' : 'even',
+    [`x-name-${i % 5}`]: `${i}`,
+    'cookie': `id=${i % 3}`
+  };
+}
+
+const server = http2.createServer({ settings: { headerTableSize: 256 } });
+server.on('stream', common.mustCall((stream, headers) => {
+  const i = +headers[':path'].slice(1);
+  const expected = makeHeaders(i);
+  for (const name of Object.keys(expected))
+    assert.strictEqual(headers[name], expected[name]);
+  stream.respond({ 'x-index': `${i}`, 'x-same': 'same in responses' });
+  stream.end();
+}, kRequests));
+
+server.listen(0, common.mustCall(() => {
+  const client = http2.connect(`http://localhost:${server.address().port}`);
+  let pending = kRequests;
+  for (let i = 0; i < kRequests; i++) {
+    const req = client.request(makeHeaders(i));
+    req.on('response', common.mustCall((headers) => {
+      assert.strictEqual(headers['x-index'], `${i}`);
+      assert.strictEqual(headers['x-same'], 'same in responses');
+    }));
+    req.resume();
+    req.on('end', common.mustCall(() => {
+      if (--pending === 0) {
+        client.close();
+        server.close();
+      }
+    }));
+  }
+}));
@@ -0,0 +1,55 @@
+'use strict';
+
+// Small DATA frame payloads are copied into the session's outgoing storage
+// and written together with the frames of other streams, while larger ones
+// are written from the stream's buffers. Check that bodies written in a mix
+// of sizes arrive intact on many concurrent streams, with and without
+// padding, and that all write callbacks are called.
+
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+const assert = require('assert');
+const http2 = require('http2');
+
+const kStreams = 100;
+const sizes = [1, 100, 1024, 1025, 5000, 0, 17];
+
+function chunksFor(id) {
+  return sizes.map((size, i) => Buffer.alloc(size, 97 + (id + i) % 26));
+}
+
+function test(paddingStrategy, next) {
+  const server = http2.createServer({ paddingStrategy });
+  server.on('stream', common.mustCall((stream, headers) => {
+    const chunks = chunksFor(+headers[':path'].slice(1));
+    stream.respond();
+    for (const chunk of chunks)
+      stream.write(chunk, common.mustCall());
+    stream.end();
+  }, kStreams));
+
+  server.listen(0, common.mustCall(() => {
+    const client = http2.connect(`http://localhost:${server.address().port}`,
+                                 { paddingStrategy });
+    let pending = kStreams;
+    for (let id = 0; id < kStreams; id++) {
+      const req = client.request({ ':path': `/${id}` });
+      const received = [];
+      req.on('data', (chunk) => received.push(chunk));
+      req.on('end', common.mustCall(() => {
+        assert.deepStrictEqual(Buffer.concat(received),
+                               Buffer.concat(chunksFor(id)));
+        if (--pending === 0) {
+          client.close();
+          server.close(next);
+        }
+      }));
+    }
+  }));
+}
+
+const { PADDING_STRATEGY_NONE, PADDING_STRATEGY_MAX } = http2.constants;
+test(PADDING_STRATEGY_NONE, common.mustCall(() => {
+  test(PADDING_STRATEGY_MAX, common.mustCall());
+}));
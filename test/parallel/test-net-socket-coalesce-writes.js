@@ -0,0 +1,52 @@
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const net = require('net');
+
+// Writes issued while write coalescing is enabled must arrive complete and in
+// order, and every write callback must be called, in order, exactly once.
+
+const chunks = [];
+for (let i = 0; i < 100; i++)
+  chunks.push(i % 2 === 0 ? `chunk ${i};` : Buffer.from(`chunk ${i};`));
+// Larger than the coalescing budget, forcing an early flush.
+chunks.push(Buffer.alloc(128 * 1024, 'x'));
+chunks.push('done');
+const expected = chunks.join('');
+
+const server = net.createServer(common.mustCall((socket) => {
+  assert.strictEqual(socket.setCoalesceWrites(), socket);
+
+  let completed = 0;
+  chunks.forEach((chunk, i) => {
+    socket.write(chunk, common.mustCall((err) => {
+      assert.ifError(err);
+      assert.strictEqual(completed++, i);
+    }));
+  });
+  // The shutdown must not overtake the pending writes.
+  socket.end();
+  socket.on('close', common.mustCall(() => {
+    assert.strictEqual(completed, chunks.length);
+    server.close();
+  }));
+}));
+
+server.listen(0, common.mustCall(() => {
+  const client = net.connect(server.address().port);
+  let received = '';
+  client.setEncoding('latin1');
+  client.on('data', (data) => received += data);
+  client.on('end', common.mustCall(() => {
+    assert.strictEqual(received, expected);
+    client.end();
+  }));
+}));
+
+// Coalescing can be switched off again, and is a no-op before connecting.
+{
+  const socket = new net.Socket();
+  assert.strictEqual(socket.setCoalesceWrites(false), socket);
+  socket.destroy();
+}
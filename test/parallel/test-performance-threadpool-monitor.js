@@ -0,0 +1,81 @@
+'use strict';
+
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+const assert = require('assert');
+const crypto = require('crypto');
+const dns = require('dns');
+const fs = require('fs');
+const zlib = require('zlib');
+const { monitorThreadpool } = require('perf_hooks');
+
+const types = ['fs', 'dns', 'crypto', 'compression', 'user'];
+const phases = ['wait', 'run', 'latency'];
+
+const monitor = monitorThreadpool();
+for (const type of types) {
+  for (const phase of phases)
+    assert.strictEqual(monitor[type][phase].count, 0);
+}
+
+// Nothing is recorded while the monitor is disabled.
+fs.stat(__filename, common.mustCall(() => {
+  assert.strictEqual(monitor.fs.latency.count, 0);
+
+  assert.strictEqual(monitor.enable(), true);
+  assert.strictEqual(monitor.enable(), false);
+
+  let pending = 4;
+  const done = common.mustCall(() => {
+    if (--pending > 0)
+      return;
+
+    assert.strictEqual(monitor.fs.latency.count, 1);
+    assert.strictEqual(monitor.dns.latency.count, 1);
+
+    for (const type of ['fs', 'dns', 'crypto', 'compression']) {
+      for (const phase of phases) {
+        const histogram = monitor[type][phase];
+        assert(histogram.count >= 1, `${type}.${phase}`);
+        assert(histogram.min > 0);
+        assert(histogram.max >= histogram.min);
+        assert(histogram.percentile(50) > 0);
+        assert(histogram.percentiles.size > 0);
+      }
+      // Every request is counted in every phase, even if it took less time
+      // than the clock resolves.
+      assert.strictEqual(monitor[type].wait.count,
+                         monitor[type].latency.count);
+      assert.strictEqual(monitor[type].run.count,
+                         monitor[type].latency.count);
+      // Completion is observed after the work has run.
+      assert(monitor[type].latency.max >= monitor[type].run.min);
+    }
+    assert.strictEqual(monitor.user.latency.count, 0);
+
+    [-1, 0, 101].forEach((i) => {
+      assert.throws(() => monitor.fs.latency.percentile(i), {
+        name: 'RangeError',
+        code: 'ERR_INVALID_ARG_VALUE'
+      });
+    });
+
+    assert.strictEqual(monitor.disable(), true);
+    assert.strictEqual(monitor.disable(), false);
+    fs.stat(__filename, common.mustCall(() => {
+      assert.strictEqual(monitor.fs.latency.count, 1);
+      monitor.reset();
+      for (const type of types) {
+        for (const phase of phases)
+          assert.strictEqual(monitor[type][phase].count, 0);
+      }
+    }));
+  }, 4);
+
+  fs.stat(__filename, done);
+  dns.lookup('localhost', done);
+  crypto.pbkdf2('password', 'salt', 1000, 32, 'sha256', done);
+  zlib.deflate(Buffer.alloc(1024), done);
+}));
@@ -0,0 +1,55 @@
+// Flags: --threadpool-crypto-size=1 --threadpool-fs-size=2
+'use strict';
+
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+const assert = require('assert');
+const crypto = require('crypto');
+const { threadpoolUsage } = require('perf_hooks');
+
+{
+  const usage = threadpoolUsage();
+  assert.deepStrictEqual(Object.keys(usage).sort(),
+                         ['compression', 'crypto', 'dns', 'fs', 'user']);
+  assert.strictEqual(usage.crypto.limit, 1);
+  assert.strictEqual(usage.fs.limit, 2);
+  assert.strictEqual(usage.compression.limit, Infinity);
+  assert.strictEqual(usage.dns.limit, Infinity);
+  assert.strictEqual(usage.user.limit, Infinity);
+  for (const type of ['compression', 'crypto', 'user']) {
+    assert.strictEqual(usage[type].queueLimit, Infinity);
+    assert.strictEqual(usage[type].running, 0);
+    assert.strictEqual(usage[type].queued, 0);
+    assert.strictEqual(usage[type].completed, 0);
+    assert.strictEqual(usage[type].waitTime, 0);
+  }
+}
+
+const jobs = 4;
+let remaining = jobs;
+for (let i = 0; i < jobs; i++) {
+  crypto.pbkdf2('password', 'salt', 1000, 32, 'sha256', common.mustCall(
+    (err, key) => {
+      assert.ifError(err);
+      assert.strictEqual(key.length, 32);
+
+      if (--remaining > 0)
+        return;
+
+      // The completion callback runs after the counters have been updated.
+      const { crypto: usage } = threadpoolUsage();
+      assert.strictEqual(usage.running, 0);
+      assert.strictEqual(usage.queued, 0);
+      assert.strictEqual(usage.completed, jobs);
+      assert(usage.waitTime > 0);
+    }));
+}
+
+{
+  // A job counts as running only once a threadpool thread has picked it up.
+  const { crypto: usage } = threadpoolUsage();
+  assert(usage.running <= 1);
+  assert.strictEqual(usage.running + usage.queued, jobs);
+}
@@ -0,0 +1,25 @@
+// Flags: --threadpool-crypto-size=1 --threadpool-crypto-queue-size=1
+'use strict';
+
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+const assert = require('assert');
+const crypto = require('crypto');
+const { threadpoolUsage } = require('perf_hooks');
+
+assert.strictEqual(threadpoolUsage().crypto.queueLimit, 1);
+
+// The first job occupies the only crypto slot, the second one fills the
+// queue and the third one is rejected synchronously.
+crypto.pbkdf2('password', 'salt', 1000, 32, 'sha256', common.mustCall());
+crypto.pbkdf2('password', 'salt', 1000, 32, 'sha256', common.mustCall());
+assert.throws(
+  () => crypto.pbkdf2('password', 'salt', 1000, 32, 'sha256',
+                      common.mustNotCall()),
+  {
+    code: 'ERR_THREADPOOL_QUEUE_FULL',
+    name: 'Error',
+    message: 'Too much work is queued for the threadpool'
+  });
@@ -0,0 +1,46 @@
+'use strict';
+
+// Cleartext is read from OpenSSL one record at a time, straight into the
+// buffer that is passed to JS land. Check that data comes out intact and
+// in record-sized chunks, for small, maximum-sized, and size-limited records.
+
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+const assert = require('assert');
+const tls = require('tls');
+const fixtures = require('../common/fixtures');
+
+const payload = Buffer.alloc(100 * 1024);
+for (let i = 0; i < payload.length; i++)
+  payload[i] = i % 251;
+
+function test(maxFragment, next) {
+  const server = tls.createServer({
+    key: fixtures.readKey('agent1-key.pem'),
+    cert: fixtures.readKey('agent1-cert.pem')
+  }, common.mustCall((socket) => {
+    assert.strictEqual(socket.setMaxSendFragment(maxFragment), true);
+    socket.write(payload.slice(0, 1));
+    socket.end(payload.slice(1));
+  }));
+
+  server.listen(0, common.mustCall(() => {
+    const client = tls.connect({
+      port: server.address().port,
+      rejectUnauthorized: false
+    });
+    const chunks = [];
+    client.on('data', (chunk) => {
+      assert(chunk.length <= maxFragment);
+      chunks.push(chunk);
+    });
+    client.on('end', common.mustCall(() => {
+      assert.strictEqual(chunks[0].length, 1);
+      assert.deepStrictEqual(Buffer.concat(chunks), payload);
+      server.close(next);
+    }));
+  }));
+}
+
+test(16384, common.mustCall(() => test(512, common.mustCall())));
@@ -0,0 +1,74 @@
+'use strict';
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+// With the ocspCache option, the OCSP response of a secure context is only
+// requested from the 'OCSPRequest' listeners once, and then stapled from the
+// context's cache, for SNI contexts as well. Responses that cannot be cached
+// are requested for every handshake, like without the option.
+
+const assert = require('assert');
+const tls = require('tls');
+const fixtures = require('../common/fixtures');
+
+assert.throws(() => tls.createServer({ ocspCache: 1 }),
+              { code: 'ERR_INVALID_ARG_TYPE' });
+
+const key = fixtures.readKey('agent1-key.pem');
+const cert = fixtures.readKey('agent1-cert.pem');
+const ca = fixtures.readKey('ca1-cert.pem');
+
+// A response for agent1's certificate that is valid for a long time.
+const response = fixtures.readKey('agent1-ocsp-response.der');
+
+const kConnections = 3;
+const cases = [
+  { response, requests: 1 },
+  { response, servername: 'agent1.example.com', requests: 1 },
+  { response: Buffer.from('not a response'), requests: kConnections },
+];
+
+function connect(port, servername, expected, callback) {
+  const socket = tls.connect({
+    port,
+    servername,
+    requestOCSP: true,
+    rejectUnauthorized: false
+  }, common.mustCall());
+  socket.on('OCSPResponse', common.mustCall((stapled) => {
+    assert.deepStrictEqual(stapled, expected);
+  }));
+  socket.resume();
+  socket.on('close', common.mustCall(callback));
+}
+
+function run(i = 0) {
+  if (i === cases.length)
+    return;
+  const { response, servername, requests } = cases[i];
+
+  const server = tls.createServer({ key, cert, ca, ocspCache: true },
+                                  (socket) => socket.end());
+  if (servername !== undefined)
+    server.addContext(servername, { key, cert, ca });
+  server.on('OCSPRequest', common.mustCall((cert, issuer, callback) => {
+    assert(Buffer.isBuffer(cert));
+    assert(Buffer.isBuffer(issuer));
+    setImmediate(callback, null, response);
+  }, requests));
+
+  server.listen(0, common.mustCall(() => {
+    const { port } = server.address();
+    let pending = kConnections;
+    const next = () => {
+      if (--pending > 0)
+        return connect(port, servername, response, next);
+      server.close();
+      run(i + 1);
+    };
+    connect(port, servername, response, next);
+  }));
+}
+
+run();
@@ -0,0 +1,88 @@
+'use strict';
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+// With the offloadHandshake option, the private key operations of server
+// handshakes run on the threadpool. Connections work the same either way,
+// including the events that are emitted while the handshake is running and
+// the SNI and ALPN extensions, whose callbacks run inside the handshake.
+
+const assert = require('assert');
+const tls = require('tls');
+const fixtures = require('../common/fixtures');
+const { monitorThreadpool } = require('perf_hooks');
+
+assert.throws(() => tls.createServer({ offloadHandshake: 'yes' }),
+              { code: 'ERR_INVALID_ARG_TYPE' });
+
+const keys = [
+  { key: fixtures.readKey('agent1-key.pem'),
+    cert: fixtures.readKey('agent1-cert.pem') },
+  { key: fixtures.readKey('ec-key.pem'),
+    cert: fixtures.readKey('ec-cert.pem') },
+];
+const cases = [];
+for (const { key, cert } of keys) {
+  for (const maxVersion of ['TLSv1.2', 'TLSv1.3']) {
+    for (const offloadHandshake of [false, true])
+      cases.push({ key, cert, maxVersion, offloadHandshake });
+  }
+}
+
+const kConnections = 4;
+const monitor = monitorThreadpool();
+monitor.enable();
+
+function run(i = 0) {
+  if (i === cases.length)
+    return;
+  const { key, cert, maxVersion, offloadHandshake } = cases[i];
+  monitor.reset();
+
+  let keylogLines = 0;
+  const server = tls.createServer({
+    key,
+    cert,
+    maxVersion,
+    offloadHandshake,
+    ALPNProtocols: ['foo', 'bar']
+  }, (socket) => socket.pipe(socket));
+  server.on('keylog', () => keylogLines++);
+  server.on('secureConnection', common.mustCall((socket) => {
+    assert.strictEqual(socket.servername, 'agent1.example.com');
+    assert.strictEqual(socket.alpnProtocol, 'bar');
+  }, kConnections));
+  server.listen(0, common.mustCall(() => {
+    let pending = kConnections;
+    for (let j = 0; j < kConnections; j++) {
+      const socket = tls.connect({
+        port: server.address().port,
+        servername: 'agent1.example.com',
+        ALPNProtocols: ['bar'],
+        rejectUnauthorized: false
+      }, common.mustCall(() => {
+        assert.strictEqual(socket.getProtocol(), maxVersion);
+        assert.strictEqual(socket.alpnProtocol, 'bar');
+        socket.end(`hello ${j}`);
+      }));
+      let data = '';
+      socket.setEncoding('utf8');
+      socket.on('data', (chunk) => data += chunk);
+      socket.on('end', common.mustCall(() => {
+        assert.strictEqual(data, `hello ${j}`);
+        if (--pending > 0)
+          return;
+        server.close();
+        assert(keylogLines > 0);
+        if (offloadHandshake)
+          assert(monitor.crypto.run.count >= kConnections);
+        else
+          assert.strictEqual(monitor.crypto.run.count, 0);
+        run(i + 1);
+      }));
+    }
+  }));
+}
+
+run();
@@ -0,0 +1,73 @@
+'use strict';
+
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+const assert = require('assert');
+const tls = require('tls');
+const fixtures = require('../common/fixtures');
+
+// Writes issued while write coalescing is enabled on a TLS socket must arrive
+// complete and in order, and every write callback must be called, in order,
+// exactly once.
+
+const chunks = [];
+for (let i = 0; i < 100; i++)
+  chunks.push(i % 2 === 0 ? `chunk ${i};` : Buffer.from(`chunk ${i};`));
+// Larger than the coalescing budget, forcing an early flush.
+chunks.push(Buffer.alloc(128 * 1024, 'x'));
+chunks.push('done');
+const expected = chunks.join('');
+
+const options = {
+  key: fixtures.readKey('agent1-key.pem'),
+  cert: fixtures.readKey('agent1-cert.pem')
+};
+
+const server = tls.createServer(options, common.mustCall((socket) => {
+  assert.strictEqual(socket.setCoalesceWrites(), socket);
+
+  let completed = 0;
+  chunks.forEach((chunk, i) => {
+    socket.write(chunk, common.mustCall((err) => {
+      assert.ifError(err);
+      assert.strictEqual(completed++, i);
+    }));
+  });
+  socket.end();
+
+  let received = '';
+  socket.setEncoding('latin1');
+  socket.on('data', (data) => received += data);
+  socket.on('end', common.mustCall(() => {
+    assert.strictEqual(received, 'ab');
+  }));
+  socket.on('close', common.mustCall(() => {
+    assert.strictEqual(completed, chunks.length);
+    server.close();
+  }));
+}));
+
+server.listen(0, common.mustCall(() => {
+  const client = tls.connect({
+    port: server.address().port,
+    rejectUnauthorized: false
+  }, common.mustCall(() => {
+    // Writes from separate ticks of the same iteration are held back
+    // together, and switching coalescing off flushes them.
+    client.setCoalesceWrites(true);
+    client.write('a');
+    process.nextTick(() => {
+      client.write('b');
+      assert.strictEqual(client.writableLength, 2);
+      client.setCoalesceWrites(false);
+    });
+  }));
+  let received = '';
+  client.setEncoding('latin1');
+  client.on('data', (data) => received += data);
+  client.on('end', common.mustCall(() => {
+    assert.strictEqual(received, expected);
+    client.end();
+  }));
+}));
@@ -0,0 +1,95 @@
+'use strict';
+
+// Dictionaries created with zlib.createDictionary() live in a
+// SharedArrayBuffer, behave like regular dictionaries, and can be shared with
+// workers without copying.
+
+const common = require('../common');
+const assert = require('assert');
+const zlib = require('zlib');
+const { Worker } = require('worker_threads');
+
+const source = Buffer.from('{"id":0,"name":"","email":"@example.com",' +
+                           '"active":true,"tags":["admin","staff"]}');
+const input = Buffer.from('{"id":42,"name":"carol",' +
+                          '"email":"carol@example.com","active":false,' +
+                          '"tags":["staff"]}');
+
+const dictionary = zlib.createDictionary(source);
+assert.strictEqual(dictionary.byteLength, source.length);
+assert.ok(dictionary.buffer.buffer instanceof SharedArrayBuffer);
+assert.deepStrictEqual(dictionary.buffer, source);
+
+// The contents are copied once; later changes to the source do not matter.
+const copy = Buffer.from(source);
+const dictionaryFromCopy = zlib.createDictionary(copy);
+copy.fill(0);
+assert.deepStrictEqual(dictionaryFromCopy.buffer, source);
+
+// The output is the same as with a plain Buffer dictionary.
+for (const [compress, decompress] of [
+  ['deflateSync', 'inflateSync'],
+  ['deflateRawSync', 'inflateRawSync']
+]) {
+  const compressed = zlib[compress](input, { dictionary });
+  assert.deepStrictEqual(compressed,
+                         zlib[compress](input, { dictionary: source }));
+  assert.ok(compressed.length < zlib[compress](input).length);
+  assert.deepStrictEqual(zlib[decompress](compressed, { dictionary }), input);
+}
+
+zlib.deflate(input, { dictionary }, common.mustCall((err, compressed) => {
+  assert.ifError(err);
+  zlib.inflate(compressed, { dictionary }, common.mustCall((err, result) => {
+    assert.ifError(err);
+    assert.deepStrictEqual(result, input);
+  }));
+  // A different dictionary is detected.
+  zlib.inflate(compressed, { dictionary: zlib.createDictionary('nope') },
+               common.mustCall((err) => {
+                 assert.strictEqual(err.code, 'Z_NEED_DICT');
+                 assert.strictEqual(err.message, 'Bad dictionary');
+               }));
+}));
+
+// SharedArrayBuffers and views of them are used without copying.
+{
+  const sab = new SharedArrayBuffer(source.length + 2);
+  Buffer.from(sab).set(source, 2);
+  assert.strictEqual(zlib.createDictionary(sab).buffer.buffer, sab);
+  const view = new Uint8Array(sab, 2);
+  const fromView = zlib.createDictionary(view);
+  assert.strictEqual(fromView.buffer.buffer, sab);
+  assert.strictEqual(fromView.buffer.byteOffset, 2);
+  assert.deepStrictEqual(zlib.inflateSync(zlib.deflateSync(input, {
+    dictionary: fromView
+  }), { dictionary }), input);
+}
+
+// The dictionary's memory can be posted to a worker and used there.
+{
+  const worker = new Worker(`
+    const { parentPort } = require('worker_threads');
+    const zlib = require('zlib');
+    parentPort.once('message', ({ buffer, input }) => {
+      const dictionary = zlib.createDictionary(buffer);
+      parentPort.postMessage({
+        shared: dictionary.buffer.buffer === buffer.buffer,
+        compressed: zlib.deflateSync(input, { dictionary })
+      });
+    });
+  `, { eval: true });
+  worker.once('message', common.mustCall(({ shared, compressed }) => {
+    assert.strictEqual(shared, true);
+    assert.deepStrictEqual(
+      zlib.inflateSync(Buffer.from(compressed), { dictionary }), input);
+    worker.terminate();
+  }));
+  worker.postMessage({ buffer: dictionary.buffer, input });
+}
+
+[undefined, 1, {}].forEach((value) => {
+  assert.throws(() => zlib.createDictionary(value), {
+    code: 'ERR_INVALID_ARG_TYPE'
+  });
+});
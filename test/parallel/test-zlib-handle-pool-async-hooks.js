@@ -0,0 +1,46 @@
+'use strict';
+
+// Each one-shot compression call is its own async resource, even when it
+// reuses a native handle from the pool.
+
+const common = require('../common');
+const assert = require('assert');
+const async_hooks = require('async_hooks');
+const zlib = require('zlib');
+
+const inits = [];
+const destroys = new Set();
+async_hooks.createHook({
+  init(asyncId, type, triggerAsyncId, resource) {
+    if (type === 'ZLIB')
+      inits.push(asyncId);
+  },
+  destroy(asyncId) {
+    destroys.add(asyncId);
+  }
+}).enable();
+
+const input = Buffer.from('handle pool'.repeat(100));
+
+for (let i = 0; i < 3; i++)
+  zlib.deflateSync(input);
+assert.strictEqual(inits.length, 3);
+assert.strictEqual(new Set(inits).size, 3);
+
+const calls = 3;
+let done = 0;
+function next() {
+  zlib.deflate(input, common.mustCall((err) => {
+    assert.ifError(err);
+    if (++done < calls) {
+      setImmediate(next);
+      return;
+    }
+    // Every call but the last one has released its handle by now.
+    assert.strictEqual(inits.length, 3 + calls);
+    assert.strictEqual(new Set(inits).size, 3 + calls);
+    for (const asyncId of inits.slice(0, -1))
+      assert(destroys.has(asyncId));
+  }));
+}
+next();
@@ -0,0 +1,56 @@
+'use strict';
+
+// The one-shot compression methods reuse native handles between calls. Reused
+// handles must behave exactly like fresh ones.
+
+const common = require('../common');
+const assert = require('assert');
+const zlib = require('zlib');
+
+const input = Buffer.from('{"id":1,"name":"handle pool","tags":["a","b"]}'
+  .repeat(50));
+
+for (const [method, inflate] of [
+  ['deflate', zlib.inflateSync],
+  ['gzip', zlib.gunzipSync],
+  ['deflateRaw', zlib.inflateRawSync]
+]) {
+  for (const opts of [undefined, { level: 1 }, { level: 9, memLevel: 9 },
+                      { windowBits: 10, strategy: zlib.constants.Z_RLE }]) {
+    const first = zlib[`${method}Sync`](input, opts);
+    assert.deepStrictEqual(inflate(first), input);
+    // Neither the previous input nor a partial flush may leak into the next
+    // use of the same handle.
+    zlib[`${method}Sync`](Buffer.from('other data'), opts);
+    zlib[`${method}Sync`](input, {
+      ...opts,
+      finishFlush: zlib.constants.Z_SYNC_FLUSH
+    });
+    for (let i = 0; i < 3; i++)
+      assert.deepStrictEqual(zlib[`${method}Sync`](input, opts), first);
+
+    // More concurrent calls than handles are kept around.
+    for (let i = 0; i < 10; i++) {
+      zlib[method](input, opts, common.mustCall((err, result) => {
+        assert.ifError(err);
+        assert.deepStrictEqual(result, first);
+      }));
+    }
+  }
+}
+
+// Streams never share handles with the one-shot methods.
+{
+  const deflate = zlib.createDeflate();
+  zlib.deflateSync(input);
+  deflate.end(input);
+  deflate.on('data', common.mustCall());
+  deflate.on('end', common.mustCall());
+}
+
+// An engine returned through `info` has already released its handle.
+{
+  const { buffer, engine } = zlib.gzipSync(input, { info: true });
+  assert.deepStrictEqual(zlib.gunzipSync(buffer), input);
+  assert.strictEqual(engine._handle, null);
+}
@@ -0,0 +1,104 @@
+'use strict';
+
+// Gzip and Deflate streams with `parallelism > 1` compress blocks of input
+// independently; the result must still be a single valid stream.
+
+const common = require('../common');
+const assert = require('assert');
+const zlib = require('zlib');
+
+// Larger than several blocks, and not a multiple of the block size.
+const input = Buffer.alloc(1024 * 1024 + 12345);
+for (let i = 0; i < input.length; i++)
+  input[i] = (i * 7 + (i >> 11)) % 61;
+
+for (const [compress, decompress] of [
+  ['gzip', 'gunzipSync'],
+  ['deflate', 'inflateSync']
+]) {
+  for (const level of [0, 1, 6, 9]) {
+    zlib[compress](input, { parallelism: 4, level }, common.mustCall(
+      (err, compressed) => {
+        assert.ifError(err);
+        assert.deepStrictEqual(zlib[decompress](compressed), input);
+      }));
+  }
+
+  // Small windows and empty input.
+  zlib[compress](input, { parallelism: 2, windowBits: 9 }, common.mustCall(
+    (err, compressed) => {
+      assert.ifError(err);
+      assert.deepStrictEqual(zlib[decompress](compressed), input);
+    }));
+  zlib[compress](Buffer.alloc(0), { parallelism: 2 }, common.mustCall(
+    (err, compressed) => {
+      assert.ifError(err);
+      assert.strictEqual(zlib[decompress](compressed).length, 0);
+    }));
+}
+
+// Flushing ends the current block early and makes the output so far usable.
+{
+  const gzip = zlib.createGzip({ parallelism: 3 });
+  const chunks = [];
+  gzip.on('data', (chunk) => chunks.push(chunk));
+  gzip.write(input.slice(0, 1000));
+  gzip.flush(common.mustCall(() => {
+    const inflated = zlib.gunzipSync(Buffer.concat(chunks), {
+      finishFlush: zlib.constants.Z_SYNC_FLUSH
+    });
+    assert.deepStrictEqual(inflated, input.slice(0, 1000));
+    gzip.end(input.slice(1000));
+  }));
+  gzip.on('end', common.mustCall(() => {
+    assert.strictEqual(gzip.bytesWritten, input.length);
+    assert.deepStrictEqual(zlib.gunzipSync(Buffer.concat(chunks)), input);
+  }));
+}
+
+// After a full flush, the rest of the output does not depend on the data
+// that precedes it.
+{
+  const deflate = zlib.createDeflate({ parallelism: 2 });
+  const chunks = [];
+  let flushed;
+  deflate.on('data', (chunk) => chunks.push(chunk));
+  deflate.write(input.slice(0, 300000));
+  deflate.flush(zlib.constants.Z_FULL_FLUSH, common.mustCall(() => {
+    flushed = Buffer.concat(chunks).length;
+    deflate.end(input.slice(300000, 400000));
+  }));
+  deflate.on('end', common.mustCall(() => {
+    const compressed = Buffer.concat(chunks);
+    assert.deepStrictEqual(zlib.inflateSync(compressed),
+                           input.slice(0, 400000));
+    // Skip the 2-byte header and leave out the 4-byte trailer.
+    const rest = zlib.inflateRawSync(compressed.slice(flushed, -4));
+    assert.deepStrictEqual(rest, input.slice(300000, 400000));
+  }));
+}
+
+// Changing the parameters applies to the blocks that follow.
+{
+  const gzip = zlib.createGzip({ parallelism: 2, level: 1 });
+  const chunks = [];
+  gzip.on('data', (chunk) => chunks.push(chunk));
+  gzip.write(input.slice(0, 500000));
+  gzip.params(9, zlib.constants.Z_DEFAULT_STRATEGY, common.mustCall(() => {
+    gzip.end(input.slice(500000));
+  }));
+  gzip.on('end', common.mustCall(() => {
+    assert.deepStrictEqual(zlib.gunzipSync(Buffer.concat(chunks)), input);
+  }));
+}
+
+// The synchronous methods compress sequentially.
+assert.deepStrictEqual(zlib.gzipSync(input, { parallelism: 4 }),
+                       zlib.gzipSync(input));
+
+[0, 1.5, 257, 'foo'].forEach((parallelism) => {
+  assert.throws(() => zlib.createGzip({ parallelism }), {
+    code: typeof parallelism === 'string' ?
+      'ERR_INVALID_ARG_TYPE' : 'ERR_OUT_OF_RANGE'
+  });
+});
@@ -117,8 +117,8 @@ function testInitialized(req, ctor_name) {
 if (common.hasCrypto) { // eslint-disable-line node-core/crypto-check
   const crypto = require('crypto');
 
-  // The handle for PBKDF2 and RandomBytes isn't returned by the function call,
-  // so need to check it from the callback.
+  // The handle for PBKDF2, RandomBytes, hashBatch, sign and verify isn't
+  // returned by the function call, so need to check it from the callback.
 
   const mc = common.mustCall(function pb() {
     testInitialized(this, 'AsyncWrap');
@@ -129,6 +129,26 @@ if (common.hasCrypto) { // eslint-disable-line node-core/crypto-check
     testInitialized(this, 'AsyncWrap');
   }));
 
+  crypto.hashBatch('sha256', ['a'], common.mustCall(function hb() {
+    testInitialized(this, 'AsyncWrap');
+  }));
+
+  const { privateKey, publicKey } =
+    crypto.generateKeyPairSync('ec', { namedCurve: 'P-256' });
+  const data = Buffer.from('a');
+  crypto.sign('sha256', data, privateKey, common.mustCall(function sg() {
+    testInitialized(this, 'AsyncWrap');
+  }));
+  crypto.verify('sha256', data, publicKey,
+                crypto.sign('sha256', data, privateKey),
+                common.mustCall(function vf() {
+                  testInitialized(this, 'AsyncWrap');
+                }));
+
+  crypto.createHash('sha256', { offload: true }).end('a').resume();
+  crypto.createCipheriv('aes-128-ecb', Buffer.alloc(16), null,
+                        { offload: true }).end('a').resume();
+
   if (typeof internalBinding('crypto').scrypt === 'function') {
     crypto.scrypt('password', 'salt', 8, common.mustCall(function() {
       testInitialized(this, 'AsyncWrap');
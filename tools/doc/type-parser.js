@@ -123,6 +123,7 @@ const customTypesMap = {
     'perf_hooks.html#perf_hooks_class_performanceobserver',
   'PerformanceObserverEntryList':
     'perf_hooks.html#perf_hooks_class_performanceobserverentrylist',
+  'ThreadpoolMonitor': 'perf_hooks.html#perf_hooks_class_threadpoolmonitor',
 
   'readline.Interface': 'readline.html#readline_class_interface',
 
@@ -153,6 +154,7 @@ const customTypesMap = {
   'MessagePort': 'worker_threads.html#worker_threads_class_messageport',
 
   'zlib options': 'zlib.html#zlib_class_options',
+  'zlib.Dictionary': 'zlib.html#zlib_class_zlib_dictionary',
 };
 
 const arrayPart = /(?:\[])+$/;